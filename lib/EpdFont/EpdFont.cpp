@@ -99,9 +99,14 @@ int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const
   if (!data->kernMatrix) {
     return 0;
   }
-  const uint8_t lc = lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
+  const EpdLatinLookupEntry* latin = data->latinLookup;
+  const uint8_t lc = (latin && leftCp < EPD_LATIN_LOOKUP_SIZE)
+                         ? latin[leftCp].kernLeftClass
+                         : lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
   if (lc == 0) return 0;
-  const uint8_t rc = lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
+  const uint8_t rc = (latin && rightCp < EPD_LATIN_LOOKUP_SIZE)
+                         ? latin[rightCp].kernRightClass
+                         : lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
   if (rc == 0) return 0;
   return data->kernMatrix[(lc - 1) * data->kernRightClassCount + (rc - 1)];
 }
@@ -147,6 +152,12 @@ uint32_t EpdFont::applyLigatures(uint32_t cp, const char*& text) const {
 }
 
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  // Fast path: the table already resolves missing codepoints to the replacement glyph
+  if (data->latinLookup && cp < EPD_LATIN_LOOKUP_SIZE) {
+    const uint16_t glyphIndex = data->latinLookup[cp].glyphIndex;
+    return glyphIndex != EPD_NO_GLYPH ? &data->glyph[glyphIndex] : nullptr;
+  }
+
   const int count = data->intervalCount;
   if (count == 0) return nullptr;
 
@@ -2,6 +2,7 @@
 // https://github.com/vroland/epdiy/blob/c61e9e923ce2418150d54f88cea5d196cdc40c54/src/epd_internals.h
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 /// Font metrics use "fixed-point 4" (4 fractional bits, i.e. 1/16-pixel
@@ -50,7 +51,7 @@ typedef struct {
   uint32_t compressedSize;    ///< Compressed DEFLATE stream size
   uint32_t uncompressedSize;  ///< Decompressed size
   uint16_t glyphCount;        ///< Number of glyphs in this group
-  uint16_t firstGlyphIndex;   ///< First glyph index in the global glyph array
+  uint16_t firstGlyphIndex;   ///< First glyph index in the global glyph array (lowest member with glyphGroups)
 } EpdFontGroup;
 
 /// Glyph interval structure
@@ -74,6 +75,30 @@ typedef struct {
   uint32_t ligatureCp;  ///< Codepoint of the replacement ligature glyph
 } __attribute__((packed)) EpdLigaturePair;
 
+/// Size of the dense per-codepoint lookup table (Basic Latin through Latin Extended-B).
+constexpr uint32_t EPD_LATIN_LOOKUP_SIZE = 0x250;
+/// Glyph index marking a codepoint with neither a glyph nor a replacement glyph.
+constexpr uint16_t EPD_NO_GLYPH = 0xFFFF;
+
+/// Direct-indexed entry for codepoints below EPD_LATIN_LOOKUP_SIZE, indexed by codepoint.
+/// Codepoints missing from the font already point at the replacement glyph.
+typedef struct {
+  uint16_t glyphIndex;     ///< Index into the glyph array, or EPD_NO_GLYPH
+  uint8_t kernLeftClass;   ///< 1-based left kerning class, 0 if none
+  uint8_t kernRightClass;  ///< 1-based right kerning class, 0 if none
+} EpdLatinLookupEntry;
+
+/// Reads `len` bytes at `offset` of a font file into `out`; returns the number of bytes read.
+typedef size_t (*EpdFontReadFn)(void* ctx, size_t offset, uint8_t* out, size_t len);
+
+/// Backing file of a font loaded from the SD card. Such fonts have no bitmap array;
+/// their compressed groups are read from the file when a glyph is drawn.
+typedef struct {
+  EpdFontReadFn read;
+  void* ctx;
+  uint32_t bitmapOffset;  ///< File offset of the compressed group data
+} EpdFontFileSource;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -95,4 +120,7 @@ typedef struct {
   uint8_t kernRightClassCount;           ///< Number of distinct right classes (matrix cols)
   const EpdLigaturePair* ligaturePairs;  ///< Sorted ligature pair table (nullptr if none)
   uint32_t ligaturePairCount;            ///< Number of entries in ligaturePairs
+  const EpdLatinLookupEntry* latinLookup;  ///< Direct-indexed Latin-range table (nullptr if none)
+  const EpdFontFileSource* fileSource;     ///< Group data source for SD-card fonts (nullptr for built-in fonts)
+  const uint8_t* glyphGroups;              ///< Group index per glyph, nullptr when groups are contiguous glyph ranges
 } EpdFontData;
@@ -27,6 +27,10 @@ void FontDecompressor::clearCache() {
 }
 
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex) {
+  // Corpus-grouped fonts: members of a group are scattered across the glyph array
+  if (fontData->glyphGroups) {
+    return fontData->glyphGroups[glyphIndex];
+  }
   for (uint16_t i = 0; i < fontData->groupCount; i++) {
     uint16_t first = fontData->groups[i].firstGlyphIndex;
     if (glyphIndex >= first && glyphIndex < first + fontData->groups[i].glyphCount) {
@@ -79,9 +83,28 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
     return false;
   }
 
+  // SD-card fonts: page the compressed group in from the file for the duration of the inflate
+  const uint8_t* compressed = nullptr;
+  uint8_t* readBuf = nullptr;
+  if (const EpdFontFileSource* source = fontData->fileSource) {
+    readBuf = static_cast<uint8_t*>(malloc(group.compressedSize));
+    if (!readBuf || source->read(source->ctx, source->bitmapOffset + group.compressedOffset, readBuf,
+                                 group.compressedSize) != group.compressedSize) {
+      LOG_ERR("FDC", "Failed to read %u bytes of group %u from font file", group.compressedSize, groupIndex);
+      free(readBuf);
+      free(outBuf);
+      return false;
+    }
+    compressed = readBuf;
+  } else {
+    compressed = &fontData->bitmap[group.compressedOffset];
+  }
+
   inflateReader.init(false);
-  inflateReader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
-  if (!inflateReader.read(outBuf, group.uncompressedSize)) {
+  inflateReader.setSource(compressed, group.compressedSize);
+  const bool inflated = inflateReader.read(outBuf, group.uncompressedSize);
+  free(readBuf);
+  if (!inflated) {
     LOG_ERR("FDC", "Decompression failed for group %u", groupIndex);
     free(outBuf);
     return false;
@@ -0,0 +1,181 @@
+#include "SdFont.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+constexpr char FILE_MAGIC[4] = {'E', 'P', 'D', 'F'};
+constexpr uint8_t FLAG_2BIT = 0x01;
+constexpr uint8_t FLAG_GLYPH_GROUPS = 0x02;  // a group index per glyph follows the kern matrix
+
+// Little-endian, naturally aligned; mirrors the struct.pack layout in fontconvert.py
+struct FileHeader {
+  char magic[4];
+  uint8_t version;
+  uint8_t flags;
+  uint8_t advanceY;
+  uint8_t reserved;
+  int16_t ascender;
+  int16_t descender;
+  uint8_t kernLeftClassCount;
+  uint8_t kernRightClassCount;
+  uint16_t groupCount;
+  uint32_t glyphCount;
+  uint32_t intervalCount;
+  uint16_t kernLeftEntryCount;
+  uint16_t kernRightEntryCount;
+  uint32_t ligaturePairCount;
+  uint32_t latinLookupCount;  // 0 or EPD_LATIN_LOOKUP_SIZE
+  uint32_t bitmapSize;        // compressed group data following the tables
+};
+static_assert(sizeof(FileHeader) == 40, "FileHeader must match the on-card layout");
+static_assert(sizeof(EpdGlyph) == 16 && sizeof(EpdUnicodeInterval) == 12 && sizeof(EpdFontGroup) == 16 &&
+                  sizeof(EpdLatinLookupEntry) == 4 && sizeof(EpdLigaturePair) == 8 && sizeof(EpdKernClassEntry) == 3,
+              "Font tables are read from the card as-is");
+
+bool kernClassesValid(const EpdKernClassEntry* entries, const uint16_t count, const uint8_t classCount) {
+  for (uint16_t i = 0; i < count; i++) {
+    if (entries[i].classId == 0 || entries[i].classId > classCount ||
+        (i > 0 && entries[i].codepoint <= entries[i - 1].codepoint)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+SdFont::~SdFont() { close(); }
+
+void SdFont::close() {
+  free(tables);
+  tables = nullptr;
+  tableBytes = 0;
+  data = {};
+  source = {};
+}
+
+bool SdFont::open(const EpdFontReadFn read, void* ctx, const size_t fileSize) {
+  close();
+
+  FileHeader header;
+  if (read(ctx, 0, reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION) {
+    return false;
+  }
+  // Only compressed fonts: the glyph bitmaps are never addressed directly
+  if ((header.flags & ~(FLAG_2BIT | FLAG_GLYPH_GROUPS)) != 0 || header.groupCount == 0 || header.glyphCount == 0 ||
+      header.glyphCount > EPD_NO_GLYPH ||
+      (header.latinLookupCount != 0 && header.latinLookupCount != EPD_LATIN_LOOKUP_SIZE)) {
+    return false;
+  }
+
+  const size_t glyphBytes = header.glyphCount * sizeof(EpdGlyph);
+  const size_t intervalBytes = header.intervalCount * sizeof(EpdUnicodeInterval);
+  const size_t groupBytes = header.groupCount * sizeof(EpdFontGroup);
+  const size_t latinBytes = header.latinLookupCount * sizeof(EpdLatinLookupEntry);
+  const size_t ligatureBytes = header.ligaturePairCount * sizeof(EpdLigaturePair);
+  const size_t kernLeftBytes = header.kernLeftEntryCount * sizeof(EpdKernClassEntry);
+  const size_t kernRightBytes = header.kernRightEntryCount * sizeof(EpdKernClassEntry);
+  const size_t kernMatrixBytes = header.kernLeftEntryCount > 0 && header.kernRightEntryCount > 0
+                                     ? header.kernLeftClassCount * header.kernRightClassCount
+                                     : 0;
+  const size_t glyphGroupBytes = (header.flags & FLAG_GLYPH_GROUPS) != 0 ? header.glyphCount : 0;
+  const size_t total = glyphBytes + intervalBytes + groupBytes + latinBytes + ligatureBytes + kernLeftBytes +
+                       kernRightBytes + kernMatrixBytes + glyphGroupBytes;
+  if (total > MAX_TABLE_BYTES || sizeof(header) + total + header.bitmapSize > fileSize) {
+    return false;
+  }
+
+  tables = static_cast<uint8_t*>(malloc(total));
+  if (!tables) {
+    return false;
+  }
+  tableBytes = total;
+  if (read(ctx, sizeof(header), tables, total) != total) {
+    close();
+    return false;
+  }
+
+  // Tables are stored back to back in this order; every size before the packed ones is a multiple of 4
+  uint8_t* cursor = tables;
+  const auto take = [&cursor](const size_t bytes) {
+    uint8_t* start = bytes > 0 ? cursor : nullptr;
+    cursor += bytes;
+    return start;
+  };
+  data.glyph = reinterpret_cast<const EpdGlyph*>(take(glyphBytes));
+  data.intervals = reinterpret_cast<const EpdUnicodeInterval*>(take(intervalBytes));
+  data.groups = reinterpret_cast<const EpdFontGroup*>(take(groupBytes));
+  data.latinLookup = reinterpret_cast<const EpdLatinLookupEntry*>(take(latinBytes));
+  data.ligaturePairs = reinterpret_cast<const EpdLigaturePair*>(take(ligatureBytes));
+  data.kernLeftClasses = reinterpret_cast<const EpdKernClassEntry*>(take(kernLeftBytes));
+  data.kernRightClasses = reinterpret_cast<const EpdKernClassEntry*>(take(kernRightBytes));
+  data.kernMatrix = reinterpret_cast<const int8_t*>(take(kernMatrixBytes));
+  data.glyphGroups = take(glyphGroupBytes);
+
+  data.bitmap = nullptr;
+  data.intervalCount = header.intervalCount;
+  data.advanceY = header.advanceY;
+  data.ascender = header.ascender;
+  data.descender = header.descender;
+  data.is2Bit = (header.flags & FLAG_2BIT) != 0;
+  data.groupCount = header.groupCount;
+  data.kernLeftEntryCount = data.kernMatrix ? header.kernLeftEntryCount : 0;
+  data.kernRightEntryCount = data.kernMatrix ? header.kernRightEntryCount : 0;
+  data.kernLeftClassCount = header.kernLeftClassCount;
+  data.kernRightClassCount = header.kernRightClassCount;
+  data.ligaturePairCount = header.ligaturePairCount;
+
+  source.read = read;
+  source.ctx = ctx;
+  source.bitmapOffset = static_cast<uint32_t>(sizeof(header) + total);
+  data.fileSource = &source;
+
+  // The lookups index these tables without bounds checks, so a damaged file must not get through
+  if (!validate(header.glyphCount, header.latinLookupCount, header.bitmapSize)) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+bool SdFont::validate(const uint32_t glyphCount, const uint32_t latinLookupCount, const uint32_t bitmapSize) const {
+  for (uint32_t i = 0; i < data.intervalCount; i++) {
+    const auto& interval = data.intervals[i];
+    if (interval.last < interval.first ||
+        static_cast<uint64_t>(interval.offset) + (interval.last - interval.first) >= glyphCount ||
+        (i > 0 && interval.first <= data.intervals[i - 1].last)) {
+      return false;
+    }
+  }
+  for (uint16_t i = 0; i < data.groupCount; i++) {
+    const auto& group = data.groups[i];
+    if ((!data.glyphGroups && group.firstGlyphIndex + group.glyphCount > glyphCount) ||
+        static_cast<uint64_t>(group.compressedOffset) + group.compressedSize > bitmapSize) {
+      return false;
+    }
+  }
+  if (data.glyphGroups) {
+    for (uint32_t i = 0; i < glyphCount; i++) {
+      if (data.glyphGroups[i] >= data.groupCount) {
+        return false;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < latinLookupCount; i++) {
+    const auto& entry = data.latinLookup[i];
+    if ((entry.glyphIndex != EPD_NO_GLYPH && entry.glyphIndex >= glyphCount) ||
+        entry.kernLeftClass > data.kernLeftClassCount || entry.kernRightClass > data.kernRightClassCount) {
+      return false;
+    }
+  }
+  for (uint32_t i = 1; i < data.ligaturePairCount; i++) {
+    if (data.ligaturePairs[i].pair <= data.ligaturePairs[i - 1].pair) {
+      return false;
+    }
+  }
+  return kernClassesValid(data.kernLeftClasses, data.kernLeftEntryCount, data.kernLeftClassCount) &&
+         kernClassesValid(data.kernRightClasses, data.kernRightEntryCount, data.kernRightClassCount);
+}
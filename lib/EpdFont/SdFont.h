@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "EpdFontData.h"
+
+/**
+ * A font face stored on the SD card as an .epdfont file written by fontconvert.py --binary.
+ *
+ * The file carries the same tables as a generated header. open() reads the glyph metrics, intervals, group
+ * directory, Latin lookup, ligature and kerning tables and, for corpus-grouped fonts, the group index of each glyph
+ * into one allocation; the compressed glyph groups stay in the file and FontDecompressor reads a group through the
+ * EpdFontFileSource when one of its glyphs is drawn. Reads go through a callback, so this class doesn't depend on
+ * the storage layer.
+ *
+ * The file layout is described in docs/file-formats.md.
+ */
+class SdFont {
+ public:
+  static constexpr uint8_t FILE_VERSION = 1;
+  // Faces whose tables need more RAM than this are refused rather than squeezing the heap
+  static constexpr size_t MAX_TABLE_BYTES = 64 * 1024;
+
+  SdFont() = default;
+  ~SdFont();
+  SdFont(const SdFont&) = delete;
+  SdFont& operator=(const SdFont&) = delete;
+
+  // Reads and validates the header and tables. `read` must stay usable until close().
+  bool open(EpdFontReadFn read, void* ctx, size_t fileSize);
+  void close();
+  bool isOpen() const { return tables != nullptr; }
+
+  const EpdFontData* getData() const { return &data; }
+  // RAM held by the open face
+  size_t getTableBytes() const { return tableBytes; }
+
+ private:
+  EpdFontData data = {};
+  EpdFontFileSource source = {};
+  uint8_t* tables = nullptr;
+  size_t tableBytes = 0;
+
+  bool validate(uint32_t glyphCount, uint32_t latinLookupCount, uint32_t bitmapSize) const;
+};
@@ -4521,6 +4521,83 @@ static const EpdLigaturePair bookerly_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry bookerly_12_boldLatinLookup[592] = {
+    { 0x0000, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0003, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0004, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 1, 1 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 0, 0 }, { 0x000C, 1, 1 },
+    { 0x000D, 2, 0 }, { 0x000E, 0, 2 }, { 0x000F, 3, 3 }, { 0x0010, 0, 0 }, { 0x0011, 4, 4 }, { 0x0012, 5, 5 }, { 0x0013, 4, 6 }, { 0x0014, 6, 7 },
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 },
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 7, 8 }, { 0x0020, 7, 9 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 10 },
+    { 0x0025, 8, 0 }, { 0x0026, 9, 11 }, { 0x0027, 10, 12 }, { 0x0028, 11, 13 }, { 0x0029, 12, 12 }, { 0x002A, 13, 12 }, { 0x002B, 14, 12 }, { 0x002C, 15, 13 },
+    { 0x002D, 16, 12 }, { 0x002E, 16, 12 }, { 0x002F, 17, 14 }, { 0x0030, 18, 12 }, { 0x0031, 19, 12 }, { 0x0032, 20, 15 }, { 0x0033, 21, 12 }, { 0x0034, 12, 13 },
+    { 0x0035, 22, 12 }, { 0x0036, 23, 13 }, { 0x0037, 24, 12 }, { 0x0038, 25, 16 }, { 0x0039, 26, 17 }, { 0x003A, 27, 18 }, { 0x003B, 28, 19 }, { 0x003C, 28, 19 },
+    { 0x003D, 29, 20 }, { 0x003E, 30, 21 }, { 0x003F, 31, 22 }, { 0x0040, 32, 0 }, { 0x0041, 33, 23 }, { 0x0042, 0, 24 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 },
+    { 0x0045, 0, 0 }, { 0x0046, 34, 25 }, { 0x0047, 35, 26 }, { 0x0048, 36, 27 }, { 0x0049, 37, 27 }, { 0x004A, 38, 27 }, { 0x004B, 39, 28 }, { 0x004C, 40, 29 },
+    { 0x004D, 41, 30 }, { 0x004E, 42, 31 }, { 0x004F, 43, 32 }, { 0x0050, 44, 30 }, { 0x0051, 45, 30 }, { 0x0052, 41, 33 }, { 0x0053, 41, 33 }, { 0x0054, 35, 27 },
+    { 0x0055, 35, 34 }, { 0x0056, 46, 27 }, { 0x0057, 47, 33 }, { 0x0058, 48, 35 }, { 0x0059, 49, 36 }, { 0x005A, 50, 37 }, { 0x005B, 51, 38 }, { 0x005C, 51, 38 },
+    { 0x005D, 52, 39 }, { 0x005E, 51, 40 }, { 0x005F, 53, 41 }, { 0x0060, 54, 0 }, { 0x0061, 0, 0 }, { 0x0062, 0, 42 }, { 0x0063, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0064, 0, 0 }, { 0x0065, 55, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 },
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 56, 43 }, { 0x0070, 0, 0 }, { 0x0071, 5, 5 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 },
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 },
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 57, 44 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 58, 45 },
+    { 0x0084, 9, 11 }, { 0x0085, 9, 11 }, { 0x0086, 9, 11 }, { 0x0087, 9, 11 }, { 0x0088, 9, 11 }, { 0x0089, 9, 11 }, { 0x008A, 13, 46 }, { 0x008B, 11, 13 },
+    { 0x008C, 13, 12 }, { 0x008D, 13, 12 }, { 0x008E, 13, 12 }, { 0x008F, 13, 12 }, { 0x0090, 16, 12 }, { 0x0091, 16, 12 }, { 0x0092, 16, 12 }, { 0x0093, 16, 12 },
+    { 0x0094, 12, 12 }, { 0x0095, 21, 12 }, { 0x0096, 12, 13 }, { 0x0097, 12, 13 }, { 0x0098, 12, 13 }, { 0x0099, 12, 13 }, { 0x009A, 12, 13 }, { 0x009B, 0, 0 },
+    { 0x009C, 59, 47 }, { 0x009D, 27, 18 }, { 0x009E, 27, 18 }, { 0x009F, 27, 18 }, { 0x00A0, 27, 18 }, { 0x00A1, 30, 21 }, { 0x00A2, 60, 12 }, { 0x00A3, 61, 48 },
+    { 0x00A4, 34, 25 }, { 0x00A5, 34, 25 }, { 0x00A6, 34, 25 }, { 0x00A7, 34, 49 }, { 0x00A8, 34, 50 }, { 0x00A9, 34, 25 }, { 0x00AA, 38, 25 }, { 0x00AB, 36, 27 },
+    { 0x00AC, 38, 27 }, { 0x00AD, 38, 27 }, { 0x00AE, 38, 27 }, { 0x00AF, 38, 51 }, { 0x00B0, 42, 52 }, { 0x00B1, 42, 31 }, { 0x00B2, 62, 53 }, { 0x00B3, 62, 54 },
+    { 0x00B4, 35, 27 }, { 0x00B5, 41, 33 }, { 0x00B6, 35, 27 }, { 0x00B7, 35, 27 }, { 0x00B8, 35, 27 }, { 0x00B9, 35, 27 }, { 0x00BA, 35, 55 }, { 0x00BB, 0, 0 },
+    { 0x00BC, 35, 56 }, { 0x00BD, 50, 37 }, { 0x00BE, 50, 37 }, { 0x00BF, 50, 37 }, { 0x00C0, 50, 37 }, { 0x00C1, 51, 40 }, { 0x00C2, 35, 57 }, { 0x00C3, 51, 40 },
+    { 0x00C4, 9, 11 }, { 0x00C5, 34, 58 }, { 0x00C6, 9, 11 }, { 0x00C7, 34, 59 }, { 0x00C8, 63, 11 }, { 0x00C9, 64, 25 }, { 0x00CA, 11, 13 }, { 0x00CB, 36, 27 },
+    { 0x00CC, 11, 13 }, { 0x00CD, 36, 60 }, { 0x00CE, 11, 13 }, { 0x00CF, 36, 27 }, { 0x00D0, 11, 13 }, { 0x00D1, 36, 61 }, { 0x00D2, 12, 12 }, { 0x00D3, 65, 27 },
+    { 0x00D4, 12, 12 }, { 0x00D5, 66, 27 }, { 0x00D6, 13, 12 }, { 0x00D7, 38, 62 }, { 0x00D8, 13, 12 }, { 0x00D9, 38, 60 }, { 0x00DA, 13, 12 }, { 0x00DB, 38, 27 },
+    { 0x00DC, 67, 12 }, { 0x00DD, 68, 27 }, { 0x00DE, 13, 12 }, { 0x00DF, 38, 60 }, { 0x00E0, 15, 13 }, { 0x00E1, 40, 29 }, { 0x00E2, 15, 13 }, { 0x00E3, 40, 63 },
+    { 0x00E4, 15, 13 }, { 0x00E5, 40, 29 }, { 0x00E6, 15, 13 }, { 0x00E7, 40, 29 }, { 0x00E8, 16, 12 }, { 0x00E9, 41, 30 }, { 0x00EA, 16, 12 }, { 0x00EB, 41, 64 },
+    { 0x00EC, 16, 12 }, { 0x00ED, 62, 54 }, { 0x00EE, 16, 12 }, { 0x00EF, 62, 54 }, { 0x00F0, 16, 12 }, { 0x00F1, 62, 54 }, { 0x00F2, 16, 12 }, { 0x00F3, 69, 31 },
+    { 0x00F4, 16, 12 }, { 0x00F5, 42, 31 }, { 0x00F6, 17, 12 }, { 0x00F7, 43, 31 }, { 0x00F8, 17, 14 }, { 0x00F9, 70, 65 }, { 0x00FA, 18, 12 }, { 0x00FB, 44, 30 },
+    { 0x00FC, 44, 33 }, { 0x00FD, 19, 12 }, { 0x00FE, 45, 30 }, { 0x00FF, 19, 12 }, { 0x0100, 45, 30 }, { 0x0101, 0, 12 }, { 0x0102, 65, 30 }, { 0x0103, 0, 12 },
+    { 0x0104, 0, 30 }, { 0x0105, 19, 12 }, { 0x0106, 71, 66 }, { 0x0107, 21, 12 }, { 0x0108, 41, 33 }, { 0x0109, 21, 12 }, { 0x010A, 41, 33 }, { 0x010B, 21, 12 },
+    { 0x010C, 41, 33 }, { 0x010D, 41, 33 }, { 0x010E, 21, 12 }, { 0x010F, 41, 33 }, { 0x0110, 12, 13 }, { 0x0111, 35, 27 }, { 0x0112, 12, 13 }, { 0x0113, 35, 61 },
+    { 0x0114, 12, 13 }, { 0x0115, 35, 27 }, { 0x0116, 13, 13 }, { 0x0117, 38, 27 }, { 0x0118, 24, 12 }, { 0x0119, 47, 33 }, { 0x011A, 24, 12 }, { 0x011B, 47, 33 },
+    { 0x011C, 24, 12 }, { 0x011D, 47, 67 }, { 0x011E, 25, 16 }, { 0x011F, 48, 35 }, { 0x0120, 25, 16 }, { 0x0121, 48, 68 }, { 0x0122, 25, 16 }, { 0x0123, 48, 35 },
+    { 0x0124, 25, 16 }, { 0x0125, 48, 69 }, { 0x0126, 26, 17 }, { 0x0127, 72, 36 }, { 0x0128, 26, 17 }, { 0x0129, 73, 36 }, { 0x012A, 26, 17 }, { 0x012B, 49, 36 },
+    { 0x012C, 27, 18 }, { 0x012D, 50, 37 }, { 0x012E, 27, 18 }, { 0x012F, 50, 37 }, { 0x0130, 27, 18 }, { 0x0131, 50, 37 }, { 0x0132, 27, 18 }, { 0x0133, 50, 37 },
+    { 0x0134, 27, 18 }, { 0x0135, 50, 37 }, { 0x0136, 27, 18 }, { 0x0137, 74, 37 }, { 0x0138, 28, 19 }, { 0x0139, 51, 38 }, { 0x013A, 30, 21 }, { 0x013B, 51, 40 },
+    { 0x013C, 30, 21 }, { 0x013D, 31, 22 }, { 0x013E, 53, 41 }, { 0x013F, 31, 22 }, { 0x0140, 53, 41 }, { 0x0141, 31, 22 }, { 0x0142, 53, 70 }, { 0x0143, 0, 48 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0144, 75, 13 }, { 0x0145, 76, 27 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0146, 77, 18 },
+    { 0x0147, 78, 37 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0148, 31, 12 }, { 0x0149, 53, 12 }, { 0x014A, 53, 27 }, { 0x014B, 17, 12 },
+    { 0x014C, 43, 12 }, { 0x014D, 43, 30 }, { 0x014E, 17, 12 }, { 0x014F, 43, 12 }, { 0x0150, 43, 33 }, { 0x0151, 9, 11 }, { 0x0152, 34, 25 }, { 0x0153, 16, 12 },
+    { 0x0154, 62, 54 }, { 0x0155, 12, 13 }, { 0x0156, 35, 27 }, { 0x0157, 27, 18 }, { 0x0158, 50, 37 }, { 0x0159, 27, 18 }, { 0x015A, 50, 37 }, { 0x015B, 27, 18 },
+    { 0x015C, 50, 37 }, { 0x015D, 27, 18 }, { 0x015E, 50, 37 }, { 0x015F, 27, 18 }, { 0x0160, 50, 37 }, { 0x0161, 35, 71 }, { 0x0162, 9, 11 }, { 0x0163, 34, 25 },
+    { 0x0164, 9, 11 }, { 0x0165, 34, 25 }, { 0x0166, 13, 46 }, { 0x0167, 38, 25 }, { 0x0168, 15, 13 }, { 0x0169, 79, 72 }, { 0x016A, 15, 13 }, { 0x016B, 40, 29 },
+    { 0x016C, 18, 12 }, { 0x016D, 44, 30 }, { 0x016E, 12, 13 }, { 0x016F, 35, 27 }, { 0x0170, 12, 13 }, { 0x0171, 35, 27 }, { 0x0172, 0, 73 }, { 0x0173, 80, 74 },
+    { 0x0174, 70, 65 }, { 0x0175, 31, 12 }, { 0x0176, 53, 12 }, { 0x0177, 53, 27 }, { 0x0178, 15, 13 }, { 0x0179, 40, 29 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x017A, 21, 12 }, { 0x017B, 41, 33 }, { 0x017C, 9, 11 }, { 0x017D, 34, 25 }, { 0x017E, 13, 46 }, { 0x017F, 38, 25 }, { 0x0180, 59, 47 }, { 0x0181, 35, 27 },
+    { 0x0182, 9, 11 }, { 0x0183, 34, 25 }, { 0x0184, 9, 11 }, { 0x0185, 34, 25 }, { 0x0186, 13, 12 }, { 0x0187, 38, 27 }, { 0x0188, 13, 12 }, { 0x0189, 38, 27 },
+    { 0x018A, 16, 12 }, { 0x018B, 62, 54 }, { 0x018C, 16, 12 }, { 0x018D, 62, 54 }, { 0x018E, 12, 13 }, { 0x018F, 35, 27 }, { 0x0190, 12, 13 }, { 0x0191, 35, 27 },
+    { 0x0192, 24, 12 }, { 0x0193, 47, 33 }, { 0x0194, 24, 12 }, { 0x0195, 47, 33 }, { 0x0196, 27, 18 }, { 0x0197, 50, 37 }, { 0x0198, 27, 18 }, { 0x0199, 50, 37 },
+    { 0x019A, 25, 16 }, { 0x019B, 48, 35 }, { 0x019C, 26, 17 }, { 0x019D, 49, 36 }, { 0x019E, 10, 75 }, { 0x019F, 81, 76 }, { 0x01A0, 16, 12 }, { 0x01A1, 41, 30 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+};
+
 static const EpdFontData bookerly_12_bold = {
     bookerly_12_boldBitmaps,
     bookerly_12_boldGlyphs,
@@ -4541,4 +4618,7 @@ static const EpdFontData bookerly_12_bold = {
     127,
     bookerly_12_boldLigaturePairs,
     5,
+    bookerly_12_boldLatinLookup,
+    nullptr,
+    nullptr,
 };
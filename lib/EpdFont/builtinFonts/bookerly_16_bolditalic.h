@@ -5633,6 +5633,83 @@ static const EpdLigaturePair bookerly_16_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry bookerly_16_bolditalicLatinLookup[592] = {
+    { 0x0000, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0003, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0004, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0005, 0, 0 }, { 0x0006, 0, 1 }, { 0x0007, 0, 2 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 0, 0 }, { 0x000C, 0, 2 },
+    { 0x000D, 1, 0 }, { 0x000E, 0, 3 }, { 0x000F, 2, 4 }, { 0x0010, 0, 0 }, { 0x0011, 3, 5 }, { 0x0012, 4, 6 }, { 0x0013, 3, 7 }, { 0x0014, 5, 8 },
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 },
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 6, 9 }, { 0x0020, 6, 10 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 11 },
+    { 0x0025, 0, 0 }, { 0x0026, 7, 12 }, { 0x0027, 8, 13 }, { 0x0028, 9, 14 }, { 0x0029, 10, 13 }, { 0x002A, 11, 15 }, { 0x002B, 12, 15 }, { 0x002C, 13, 14 },
+    { 0x002D, 14, 15 }, { 0x002E, 14, 15 }, { 0x002F, 15, 16 }, { 0x0030, 16, 15 }, { 0x0031, 17, 15 }, { 0x0032, 18, 17 }, { 0x0033, 19, 15 }, { 0x0034, 10, 14 },
+    { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 13 }, { 0x0038, 23, 18 }, { 0x0039, 24, 19 }, { 0x003A, 25, 20 }, { 0x003B, 26, 21 }, { 0x003C, 27, 21 },
+    { 0x003D, 28, 22 }, { 0x003E, 29, 23 }, { 0x003F, 30, 24 }, { 0x0040, 31, 0 }, { 0x0041, 32, 25 }, { 0x0042, 0, 26 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 },
+    { 0x0045, 0, 0 }, { 0x0046, 33, 27 }, { 0x0047, 34, 28 }, { 0x0048, 35, 27 }, { 0x0049, 36, 27 }, { 0x004A, 37, 27 }, { 0x004B, 38, 29 }, { 0x004C, 39, 30 },
+    { 0x004D, 40, 31 }, { 0x004E, 41, 32 }, { 0x004F, 42, 33 }, { 0x0050, 43, 31 }, { 0x0051, 44, 31 }, { 0x0052, 40, 34 }, { 0x0053, 40, 34 }, { 0x0054, 34, 27 },
+    { 0x0055, 34, 34 }, { 0x0056, 45, 27 }, { 0x0057, 46, 34 }, { 0x0058, 47, 35 }, { 0x0059, 48, 36 }, { 0x005A, 33, 37 }, { 0x005B, 49, 38 }, { 0x005C, 49, 38 },
+    { 0x005D, 50, 39 }, { 0x005E, 49, 40 }, { 0x005F, 51, 41 }, { 0x0060, 52, 0 }, { 0x0061, 0, 0 }, { 0x0062, 0, 42 }, { 0x0063, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0064, 0, 0 }, { 0x0065, 53, 43 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 },
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 44 }, { 0x0070, 0, 0 }, { 0x0071, 4, 6 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 },
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 },
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 54, 45 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 55, 46 },
+    { 0x0084, 7, 12 }, { 0x0085, 7, 12 }, { 0x0086, 7, 12 }, { 0x0087, 7, 12 }, { 0x0088, 7, 12 }, { 0x0089, 7, 12 }, { 0x008A, 11, 47 }, { 0x008B, 9, 14 },
+    { 0x008C, 11, 15 }, { 0x008D, 11, 15 }, { 0x008E, 11, 15 }, { 0x008F, 11, 15 }, { 0x0090, 14, 15 }, { 0x0091, 14, 15 }, { 0x0092, 14, 15 }, { 0x0093, 14, 15 },
+    { 0x0094, 10, 13 }, { 0x0095, 19, 15 }, { 0x0096, 10, 14 }, { 0x0097, 10, 14 }, { 0x0098, 10, 14 }, { 0x0099, 10, 14 }, { 0x009A, 10, 14 }, { 0x009B, 0, 0 },
+    { 0x009C, 10, 14 }, { 0x009D, 25, 20 }, { 0x009E, 25, 20 }, { 0x009F, 25, 20 }, { 0x00A0, 25, 20 }, { 0x00A1, 29, 23 }, { 0x00A2, 56, 15 }, { 0x00A3, 57, 48 },
+    { 0x00A4, 33, 27 }, { 0x00A5, 33, 27 }, { 0x00A6, 33, 27 }, { 0x00A7, 33, 27 }, { 0x00A8, 33, 49 }, { 0x00A9, 33, 27 }, { 0x00AA, 37, 27 }, { 0x00AB, 58, 27 },
+    { 0x00AC, 37, 27 }, { 0x00AD, 37, 27 }, { 0x00AE, 37, 27 }, { 0x00AF, 37, 27 }, { 0x00B0, 41, 50 }, { 0x00B1, 59, 32 }, { 0x00B2, 60, 51 }, { 0x00B3, 60, 51 },
+    { 0x00B4, 34, 27 }, { 0x00B5, 40, 34 }, { 0x00B6, 34, 27 }, { 0x00B7, 34, 27 }, { 0x00B8, 34, 27 }, { 0x00B9, 34, 27 }, { 0x00BA, 34, 27 }, { 0x00BB, 0, 0 },
+    { 0x00BC, 61, 52 }, { 0x00BD, 33, 37 }, { 0x00BE, 33, 37 }, { 0x00BF, 33, 37 }, { 0x00C0, 33, 37 }, { 0x00C1, 49, 38 }, { 0x00C2, 34, 53 }, { 0x00C3, 49, 38 },
+    { 0x00C4, 7, 12 }, { 0x00C5, 33, 27 }, { 0x00C6, 7, 12 }, { 0x00C7, 33, 27 }, { 0x00C8, 62, 12 }, { 0x00C9, 63, 27 }, { 0x00CA, 9, 14 }, { 0x00CB, 35, 27 },
+    { 0x00CC, 9, 14 }, { 0x00CD, 35, 27 }, { 0x00CE, 9, 14 }, { 0x00CF, 35, 27 }, { 0x00D0, 9, 14 }, { 0x00D1, 35, 54 }, { 0x00D2, 10, 13 }, { 0x00D3, 64, 27 },
+    { 0x00D4, 10, 13 }, { 0x00D5, 36, 27 }, { 0x00D6, 11, 15 }, { 0x00D7, 37, 27 }, { 0x00D8, 11, 15 }, { 0x00D9, 37, 27 }, { 0x00DA, 11, 15 }, { 0x00DB, 37, 27 },
+    { 0x00DC, 65, 15 }, { 0x00DD, 66, 27 }, { 0x00DE, 11, 15 }, { 0x00DF, 37, 27 }, { 0x00E0, 13, 14 }, { 0x00E1, 39, 30 }, { 0x00E2, 13, 14 }, { 0x00E3, 39, 30 },
+    { 0x00E4, 13, 14 }, { 0x00E5, 39, 30 }, { 0x00E6, 13, 14 }, { 0x00E7, 39, 30 }, { 0x00E8, 14, 15 }, { 0x00E9, 40, 31 }, { 0x00EA, 67, 15 }, { 0x00EB, 40, 55 },
+    { 0x00EC, 14, 15 }, { 0x00ED, 60, 51 }, { 0x00EE, 14, 15 }, { 0x00EF, 60, 51 }, { 0x00F0, 14, 15 }, { 0x00F1, 60, 51 }, { 0x00F2, 68, 15 }, { 0x00F3, 69, 32 },
+    { 0x00F4, 14, 15 }, { 0x00F5, 33, 34 }, { 0x00F6, 15, 15 }, { 0x00F7, 42, 32 }, { 0x00F8, 15, 16 }, { 0x00F9, 70, 56 }, { 0x00FA, 16, 15 }, { 0x00FB, 43, 31 },
+    { 0x00FC, 71, 34 }, { 0x00FD, 17, 15 }, { 0x00FE, 44, 31 }, { 0x00FF, 17, 15 }, { 0x0100, 72, 31 }, { 0x0101, 0, 15 }, { 0x0102, 64, 31 }, { 0x0103, 0, 15 },
+    { 0x0104, 0, 31 }, { 0x0105, 17, 15 }, { 0x0106, 73, 57 }, { 0x0107, 19, 15 }, { 0x0108, 40, 34 }, { 0x0109, 19, 15 }, { 0x010A, 40, 34 }, { 0x010B, 19, 15 },
+    { 0x010C, 40, 34 }, { 0x010D, 40, 34 }, { 0x010E, 19, 15 }, { 0x010F, 42, 34 }, { 0x0110, 10, 14 }, { 0x0111, 34, 27 }, { 0x0112, 10, 14 }, { 0x0113, 34, 27 },
+    { 0x0114, 10, 14 }, { 0x0115, 34, 27 }, { 0x0116, 11, 14 }, { 0x0117, 37, 27 }, { 0x0118, 22, 13 }, { 0x0119, 46, 34 }, { 0x011A, 22, 13 }, { 0x011B, 46, 34 },
+    { 0x011C, 22, 13 }, { 0x011D, 46, 34 }, { 0x011E, 23, 18 }, { 0x011F, 47, 35 }, { 0x0120, 23, 18 }, { 0x0121, 47, 35 }, { 0x0122, 23, 18 }, { 0x0123, 74, 35 },
+    { 0x0124, 23, 18 }, { 0x0125, 47, 58 }, { 0x0126, 24, 19 }, { 0x0127, 75, 36 }, { 0x0128, 24, 19 }, { 0x0129, 0, 36 }, { 0x012A, 24, 19 }, { 0x012B, 48, 36 },
+    { 0x012C, 25, 20 }, { 0x012D, 33, 37 }, { 0x012E, 25, 20 }, { 0x012F, 33, 37 }, { 0x0130, 25, 20 }, { 0x0131, 33, 37 }, { 0x0132, 25, 20 }, { 0x0133, 33, 37 },
+    { 0x0134, 25, 20 }, { 0x0135, 33, 37 }, { 0x0136, 25, 20 }, { 0x0137, 76, 37 }, { 0x0138, 26, 21 }, { 0x0139, 49, 38 }, { 0x013A, 29, 23 }, { 0x013B, 49, 38 },
+    { 0x013C, 29, 23 }, { 0x013D, 30, 24 }, { 0x013E, 51, 41 }, { 0x013F, 30, 24 }, { 0x0140, 51, 41 }, { 0x0141, 30, 24 }, { 0x0142, 51, 59 }, { 0x0143, 0, 48 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0144, 77, 14 }, { 0x0145, 78, 27 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0146, 79, 20 },
+    { 0x0147, 80, 37 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0148, 30, 13 }, { 0x0149, 51, 13 }, { 0x014A, 51, 27 }, { 0x014B, 15, 15 },
+    { 0x014C, 42, 15 }, { 0x014D, 42, 31 }, { 0x014E, 15, 15 }, { 0x014F, 42, 15 }, { 0x0150, 42, 34 }, { 0x0151, 7, 12 }, { 0x0152, 33, 27 }, { 0x0153, 14, 15 },
+    { 0x0154, 60, 51 }, { 0x0155, 10, 14 }, { 0x0156, 34, 27 }, { 0x0157, 25, 20 }, { 0x0158, 33, 37 }, { 0x0159, 25, 20 }, { 0x015A, 33, 37 }, { 0x015B, 25, 20 },
+    { 0x015C, 33, 37 }, { 0x015D, 25, 20 }, { 0x015E, 33, 37 }, { 0x015F, 25, 20 }, { 0x0160, 33, 37 }, { 0x0161, 34, 60 }, { 0x0162, 7, 12 }, { 0x0163, 33, 27 },
+    { 0x0164, 7, 12 }, { 0x0165, 33, 27 }, { 0x0166, 11, 47 }, { 0x0167, 37, 27 }, { 0x0168, 13, 14 }, { 0x0169, 81, 61 }, { 0x016A, 13, 14 }, { 0x016B, 39, 30 },
+    { 0x016C, 16, 15 }, { 0x016D, 43, 31 }, { 0x016E, 10, 14 }, { 0x016F, 82, 27 }, { 0x0170, 10, 14 }, { 0x0171, 34, 27 }, { 0x0172, 83, 62 }, { 0x0173, 84, 63 },
+    { 0x0174, 70, 56 }, { 0x0175, 30, 13 }, { 0x0176, 51, 13 }, { 0x0177, 51, 27 }, { 0x0178, 13, 14 }, { 0x0179, 39, 30 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x017A, 19, 15 }, { 0x017B, 40, 34 }, { 0x017C, 7, 12 }, { 0x017D, 33, 27 }, { 0x017E, 11, 47 }, { 0x017F, 37, 27 }, { 0x0180, 10, 14 }, { 0x0181, 61, 52 },
+    { 0x0182, 7, 12 }, { 0x0183, 33, 27 }, { 0x0184, 7, 12 }, { 0x0185, 33, 27 }, { 0x0186, 11, 15 }, { 0x0187, 37, 27 }, { 0x0188, 11, 15 }, { 0x0189, 37, 27 },
+    { 0x018A, 14, 15 }, { 0x018B, 60, 51 }, { 0x018C, 14, 15 }, { 0x018D, 60, 51 }, { 0x018E, 10, 14 }, { 0x018F, 34, 27 }, { 0x0190, 10, 14 }, { 0x0191, 34, 27 },
+    { 0x0192, 22, 13 }, { 0x0193, 46, 34 }, { 0x0194, 22, 13 }, { 0x0195, 46, 34 }, { 0x0196, 25, 20 }, { 0x0197, 33, 37 }, { 0x0198, 25, 20 }, { 0x0199, 33, 37 },
+    { 0x019A, 23, 18 }, { 0x019B, 47, 35 }, { 0x019C, 24, 19 }, { 0x019D, 85, 36 }, { 0x019E, 8, 64 }, { 0x019F, 86, 65 }, { 0x01A0, 14, 15 }, { 0x01A1, 40, 31 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+};
+
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
@@ -5653,4 +5730,7 @@ static const EpdFontData bookerly_16_bolditalic = {
     122,
     bookerly_16_bolditalicLigaturePairs,
     5,
+    bookerly_16_bolditalicLatinLookup,
+    nullptr,
+    nullptr,
 };
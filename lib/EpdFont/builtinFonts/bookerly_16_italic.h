@@ -5425,6 +5425,83 @@ static const EpdLigaturePair bookerly_16_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry bookerly_16_italicLatinLookup[592] = {
+    { 0x0000, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0003, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0004, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0005, 0, 0 }, { 0x0006, 0, 1 }, { 0x0007, 0, 0 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 0, 0 }, { 0x000C, 0, 0 },
+    { 0x000D, 1, 0 }, { 0x000E, 0, 2 }, { 0x000F, 2, 3 }, { 0x0010, 0, 0 }, { 0x0011, 3, 4 }, { 0x0012, 4, 5 }, { 0x0013, 3, 6 }, { 0x0014, 5, 7 },
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 },
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 0, 8 }, { 0x0020, 0, 9 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 10 },
+    { 0x0025, 0, 0 }, { 0x0026, 6, 11 }, { 0x0027, 7, 12 }, { 0x0028, 8, 13 }, { 0x0029, 9, 12 }, { 0x002A, 10, 14 }, { 0x002B, 11, 14 }, { 0x002C, 12, 13 },
+    { 0x002D, 13, 14 }, { 0x002E, 13, 14 }, { 0x002F, 14, 15 }, { 0x0030, 15, 14 }, { 0x0031, 16, 14 }, { 0x0032, 17, 16 }, { 0x0033, 18, 14 }, { 0x0034, 9, 13 },
+    { 0x0035, 19, 12 }, { 0x0036, 20, 13 }, { 0x0037, 21, 12 }, { 0x0038, 22, 17 }, { 0x0039, 23, 18 }, { 0x003A, 24, 19 }, { 0x003B, 25, 20 }, { 0x003C, 25, 20 },
+    { 0x003D, 26, 21 }, { 0x003E, 27, 22 }, { 0x003F, 28, 23 }, { 0x0040, 29, 0 }, { 0x0041, 30, 24 }, { 0x0042, 0, 25 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 },
+    { 0x0045, 0, 0 }, { 0x0046, 31, 26 }, { 0x0047, 32, 27 }, { 0x0048, 33, 26 }, { 0x0049, 0, 26 }, { 0x004A, 34, 26 }, { 0x004B, 35, 28 }, { 0x004C, 36, 29 },
+    { 0x004D, 37, 27 }, { 0x004E, 0, 30 }, { 0x004F, 38, 31 }, { 0x0050, 39, 27 }, { 0x0051, 0, 27 }, { 0x0052, 37, 32 }, { 0x0053, 37, 32 }, { 0x0054, 32, 26 },
+    { 0x0055, 32, 33 }, { 0x0056, 40, 26 }, { 0x0057, 41, 32 }, { 0x0058, 42, 34 }, { 0x0059, 43, 35 }, { 0x005A, 31, 36 }, { 0x005B, 44, 37 }, { 0x005C, 44, 37 },
+    { 0x005D, 45, 38 }, { 0x005E, 44, 39 }, { 0x005F, 46, 40 }, { 0x0060, 47, 0 }, { 0x0061, 0, 0 }, { 0x0062, 0, 41 }, { 0x0063, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0064, 0, 0 }, { 0x0065, 48, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 },
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 49, 42 }, { 0x0070, 0, 0 }, { 0x0071, 4, 5 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 },
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 },
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 50, 43 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 51, 44 },
+    { 0x0084, 6, 11 }, { 0x0085, 6, 11 }, { 0x0086, 6, 11 }, { 0x0087, 6, 11 }, { 0x0088, 6, 11 }, { 0x0089, 6, 11 }, { 0x008A, 10, 45 }, { 0x008B, 8, 13 },
+    { 0x008C, 10, 14 }, { 0x008D, 10, 14 }, { 0x008E, 10, 14 }, { 0x008F, 10, 14 }, { 0x0090, 13, 14 }, { 0x0091, 13, 14 }, { 0x0092, 13, 14 }, { 0x0093, 13, 14 },
+    { 0x0094, 9, 12 }, { 0x0095, 18, 14 }, { 0x0096, 9, 13 }, { 0x0097, 9, 13 }, { 0x0098, 9, 13 }, { 0x0099, 9, 13 }, { 0x009A, 9, 13 }, { 0x009B, 0, 0 },
+    { 0x009C, 9, 13 }, { 0x009D, 24, 19 }, { 0x009E, 24, 19 }, { 0x009F, 24, 19 }, { 0x00A0, 24, 19 }, { 0x00A1, 27, 22 }, { 0x00A2, 52, 14 }, { 0x00A3, 53, 46 },
+    { 0x00A4, 31, 26 }, { 0x00A5, 31, 26 }, { 0x00A6, 31, 26 }, { 0x00A7, 31, 26 }, { 0x00A8, 31, 47 }, { 0x00A9, 31, 26 }, { 0x00AA, 34, 26 }, { 0x00AB, 54, 26 },
+    { 0x00AC, 34, 26 }, { 0x00AD, 34, 26 }, { 0x00AE, 34, 26 }, { 0x00AF, 34, 26 }, { 0x00B0, 0, 48 }, { 0x00B1, 0, 30 }, { 0x00B2, 55, 49 }, { 0x00B3, 55, 49 },
+    { 0x00B4, 32, 26 }, { 0x00B5, 37, 32 }, { 0x00B6, 32, 26 }, { 0x00B7, 32, 26 }, { 0x00B8, 32, 26 }, { 0x00B9, 32, 26 }, { 0x00BA, 32, 26 }, { 0x00BB, 0, 0 },
+    { 0x00BC, 56, 50 }, { 0x00BD, 31, 36 }, { 0x00BE, 31, 36 }, { 0x00BF, 31, 36 }, { 0x00C0, 31, 36 }, { 0x00C1, 44, 37 }, { 0x00C2, 32, 51 }, { 0x00C3, 44, 37 },
+    { 0x00C4, 6, 11 }, { 0x00C5, 31, 26 }, { 0x00C6, 6, 11 }, { 0x00C7, 31, 26 }, { 0x00C8, 57, 11 }, { 0x00C9, 58, 26 }, { 0x00CA, 8, 13 }, { 0x00CB, 33, 26 },
+    { 0x00CC, 8, 13 }, { 0x00CD, 33, 26 }, { 0x00CE, 8, 13 }, { 0x00CF, 33, 26 }, { 0x00D0, 8, 13 }, { 0x00D1, 33, 52 }, { 0x00D2, 9, 12 }, { 0x00D3, 59, 26 },
+    { 0x00D4, 9, 12 }, { 0x00D5, 0, 26 }, { 0x00D6, 10, 14 }, { 0x00D7, 34, 26 }, { 0x00D8, 10, 14 }, { 0x00D9, 34, 26 }, { 0x00DA, 10, 14 }, { 0x00DB, 34, 26 },
+    { 0x00DC, 60, 14 }, { 0x00DD, 61, 26 }, { 0x00DE, 10, 14 }, { 0x00DF, 34, 26 }, { 0x00E0, 12, 13 }, { 0x00E1, 36, 29 }, { 0x00E2, 12, 13 }, { 0x00E3, 36, 29 },
+    { 0x00E4, 12, 13 }, { 0x00E5, 36, 29 }, { 0x00E6, 12, 13 }, { 0x00E7, 36, 29 }, { 0x00E8, 13, 14 }, { 0x00E9, 37, 27 }, { 0x00EA, 13, 14 }, { 0x00EB, 37, 53 },
+    { 0x00EC, 13, 14 }, { 0x00ED, 62, 54 }, { 0x00EE, 13, 14 }, { 0x00EF, 55, 49 }, { 0x00F0, 13, 14 }, { 0x00F1, 55, 49 }, { 0x00F2, 63, 14 }, { 0x00F3, 64, 30 },
+    { 0x00F4, 13, 14 }, { 0x00F5, 31, 32 }, { 0x00F6, 14, 14 }, { 0x00F7, 38, 30 }, { 0x00F8, 14, 15 }, { 0x00F9, 65, 55 }, { 0x00FA, 15, 14 }, { 0x00FB, 39, 27 },
+    { 0x00FC, 66, 32 }, { 0x00FD, 16, 14 }, { 0x00FE, 0, 27 }, { 0x00FF, 16, 14 }, { 0x0100, 67, 27 }, { 0x0101, 0, 14 }, { 0x0102, 59, 27 }, { 0x0103, 0, 14 },
+    { 0x0104, 0, 27 }, { 0x0105, 16, 14 }, { 0x0106, 68, 56 }, { 0x0107, 18, 14 }, { 0x0108, 37, 32 }, { 0x0109, 18, 14 }, { 0x010A, 37, 32 }, { 0x010B, 18, 14 },
+    { 0x010C, 37, 32 }, { 0x010D, 37, 32 }, { 0x010E, 18, 14 }, { 0x010F, 69, 32 }, { 0x0110, 9, 13 }, { 0x0111, 32, 26 }, { 0x0112, 9, 13 }, { 0x0113, 32, 26 },
+    { 0x0114, 9, 13 }, { 0x0115, 32, 26 }, { 0x0116, 10, 13 }, { 0x0117, 34, 26 }, { 0x0118, 21, 12 }, { 0x0119, 41, 32 }, { 0x011A, 21, 12 }, { 0x011B, 41, 32 },
+    { 0x011C, 21, 12 }, { 0x011D, 41, 32 }, { 0x011E, 22, 17 }, { 0x011F, 42, 34 }, { 0x0120, 22, 17 }, { 0x0121, 42, 34 }, { 0x0122, 22, 17 }, { 0x0123, 70, 34 },
+    { 0x0124, 22, 17 }, { 0x0125, 42, 57 }, { 0x0126, 23, 18 }, { 0x0127, 71, 35 }, { 0x0128, 23, 18 }, { 0x0129, 0, 35 }, { 0x012A, 23, 18 }, { 0x012B, 43, 35 },
+    { 0x012C, 24, 19 }, { 0x012D, 31, 36 }, { 0x012E, 24, 19 }, { 0x012F, 31, 36 }, { 0x0130, 24, 19 }, { 0x0131, 31, 36 }, { 0x0132, 24, 19 }, { 0x0133, 31, 36 },
+    { 0x0134, 24, 19 }, { 0x0135, 31, 36 }, { 0x0136, 24, 19 }, { 0x0137, 72, 36 }, { 0x0138, 25, 20 }, { 0x0139, 44, 37 }, { 0x013A, 27, 22 }, { 0x013B, 44, 37 },
+    { 0x013C, 27, 22 }, { 0x013D, 28, 23 }, { 0x013E, 46, 40 }, { 0x013F, 28, 23 }, { 0x0140, 46, 40 }, { 0x0141, 28, 23 }, { 0x0142, 46, 58 }, { 0x0143, 0, 46 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x0144, 73, 13 }, { 0x0145, 74, 26 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0146, 75, 19 },
+    { 0x0147, 76, 36 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x0148, 28, 12 }, { 0x0149, 46, 12 }, { 0x014A, 46, 26 }, { 0x014B, 14, 14 },
+    { 0x014C, 38, 14 }, { 0x014D, 38, 27 }, { 0x014E, 14, 14 }, { 0x014F, 38, 14 }, { 0x0150, 38, 32 }, { 0x0151, 6, 11 }, { 0x0152, 31, 26 }, { 0x0153, 13, 14 },
+    { 0x0154, 55, 49 }, { 0x0155, 9, 13 }, { 0x0156, 32, 26 }, { 0x0157, 24, 19 }, { 0x0158, 31, 36 }, { 0x0159, 24, 19 }, { 0x015A, 31, 36 }, { 0x015B, 24, 19 },
+    { 0x015C, 31, 36 }, { 0x015D, 24, 19 }, { 0x015E, 31, 36 }, { 0x015F, 24, 19 }, { 0x0160, 31, 36 }, { 0x0161, 32, 59 }, { 0x0162, 6, 11 }, { 0x0163, 31, 26 },
+    { 0x0164, 6, 11 }, { 0x0165, 31, 26 }, { 0x0166, 10, 45 }, { 0x0167, 34, 26 }, { 0x0168, 12, 13 }, { 0x0169, 77, 60 }, { 0x016A, 12, 13 }, { 0x016B, 36, 29 },
+    { 0x016C, 15, 14 }, { 0x016D, 39, 27 }, { 0x016E, 9, 13 }, { 0x016F, 32, 26 }, { 0x0170, 9, 13 }, { 0x0171, 32, 26 }, { 0x0172, 78, 61 }, { 0x0173, 79, 62 },
+    { 0x0174, 65, 55 }, { 0x0175, 28, 12 }, { 0x0176, 46, 12 }, { 0x0177, 46, 26 }, { 0x0178, 12, 13 }, { 0x0179, 36, 29 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x017A, 18, 14 }, { 0x017B, 37, 32 }, { 0x017C, 6, 11 }, { 0x017D, 31, 26 }, { 0x017E, 10, 45 }, { 0x017F, 34, 26 }, { 0x0180, 9, 13 }, { 0x0181, 56, 50 },
+    { 0x0182, 6, 11 }, { 0x0183, 31, 26 }, { 0x0184, 6, 11 }, { 0x0185, 31, 26 }, { 0x0186, 10, 14 }, { 0x0187, 34, 26 }, { 0x0188, 10, 14 }, { 0x0189, 34, 26 },
+    { 0x018A, 13, 14 }, { 0x018B, 55, 49 }, { 0x018C, 13, 14 }, { 0x018D, 55, 49 }, { 0x018E, 9, 13 }, { 0x018F, 32, 26 }, { 0x0190, 9, 13 }, { 0x0191, 32, 26 },
+    { 0x0192, 21, 12 }, { 0x0193, 41, 32 }, { 0x0194, 21, 12 }, { 0x0195, 41, 32 }, { 0x0196, 24, 19 }, { 0x0197, 31, 36 }, { 0x0198, 24, 19 }, { 0x0199, 31, 36 },
+    { 0x019A, 22, 17 }, { 0x019B, 42, 34 }, { 0x019C, 23, 18 }, { 0x019D, 43, 35 }, { 0x019E, 7, 63 }, { 0x019F, 80, 64 }, { 0x01A0, 13, 14 }, { 0x01A1, 37, 27 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+    { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 }, { 0x03A9, 0, 0 },
+};
+
 static const EpdFontData bookerly_16_italic = {
     bookerly_16_italicBitmaps,
     bookerly_16_italicGlyphs,
@@ -5445,4 +5522,7 @@ static const EpdFontData bookerly_16_italic = {
     117,
     bookerly_16_italicLigaturePairs,
     5,
+    bookerly_16_italicLatinLookup,
+    nullptr,
+    nullptr,
 };
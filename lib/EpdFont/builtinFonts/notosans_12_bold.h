@@ -4143,6 +4143,83 @@ static const EpdLigaturePair notosans_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry notosans_12_boldLatinLookup[592] = {
+    { 0x0000, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x0001, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 },
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 },
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 },
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 },
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 },
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 },
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 },
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 },
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 },
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 },
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 },
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 },
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 },
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 },
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 },
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 },
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 },
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 },
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 },
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 },
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 },
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 },
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 },
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 },
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 },
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 },
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 },
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 },
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 },
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 },
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 },
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 },
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 },
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 },
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 },
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 },
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 },
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 },
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x0141, 39, 10 }, { 0x0142, 40, 21 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x0143, 41, 14 },
+    { 0x0144, 42, 25 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x0145, 0, 0 }, { 0x0146, 0, 0 }, { 0x0147, 0, 0 }, { 0x0148, 0, 0 },
+    { 0x0149, 0, 0 }, { 0x014A, 0, 0 }, { 0x014B, 0, 0 }, { 0x014C, 0, 0 }, { 0x014D, 0, 0 }, { 0x014E, 0, 0 }, { 0x014F, 0, 0 }, { 0x0150, 0, 0 },
+    { 0x0151, 0, 0 }, { 0x0152, 0, 0 }, { 0x0153, 0, 0 }, { 0x0154, 0, 0 }, { 0x0155, 0, 0 }, { 0x0156, 0, 0 }, { 0x0157, 0, 0 }, { 0x0158, 0, 0 },
+    { 0x0159, 0, 0 }, { 0x015A, 0, 0 }, { 0x015B, 0, 0 }, { 0x015C, 0, 0 }, { 0x015D, 0, 0 }, { 0x015E, 0, 0 }, { 0x015F, 0, 0 }, { 0x0160, 0, 0 },
+    { 0x0161, 0, 0 }, { 0x0162, 0, 0 }, { 0x0163, 0, 0 }, { 0x0164, 0, 0 }, { 0x0165, 0, 0 }, { 0x0166, 0, 0 }, { 0x0167, 0, 0 }, { 0x0168, 0, 0 },
+    { 0x0169, 0, 0 }, { 0x016A, 0, 0 }, { 0x016B, 0, 0 }, { 0x016C, 0, 0 }, { 0x016D, 0, 0 }, { 0x016E, 0, 0 }, { 0x016F, 0, 0 }, { 0x0170, 0, 0 },
+    { 0x0171, 0, 0 }, { 0x0172, 0, 0 }, { 0x0173, 0, 0 }, { 0x0174, 0, 0 }, { 0x0175, 0, 0 }, { 0x0176, 0, 0 }, { 0x0177, 0, 0 }, { 0x0178, 0, 0 },
+    { 0x0179, 0, 0 }, { 0x017A, 0, 0 }, { 0x017B, 7, 9 }, { 0x017C, 22, 19 }, { 0x017D, 11, 31 }, { 0x017E, 23, 19 }, { 0x017F, 10, 10 }, { 0x0180, 0, 21 },
+    { 0x0181, 0, 0 }, { 0x0182, 0, 0 }, { 0x0183, 0, 0 }, { 0x0184, 0, 0 }, { 0x0185, 0, 0 }, { 0x0186, 0, 0 }, { 0x0187, 0, 0 }, { 0x0188, 0, 0 },
+    { 0x0189, 0, 0 }, { 0x018A, 0, 0 }, { 0x018B, 0, 0 }, { 0x018C, 33, 0 }, { 0x018D, 0, 0 }, { 0x018E, 0, 0 }, { 0x018F, 0, 0 }, { 0x0190, 0, 0 },
+    { 0x0191, 0, 0 }, { 0x0192, 0, 0 }, { 0x0193, 0, 0 }, { 0x0194, 0, 0 }, { 0x0195, 0, 0 }, { 0x0196, 0, 0 }, { 0x0197, 0, 0 }, { 0x0198, 0, 0 },
+    { 0x0199, 0, 0 }, { 0x019A, 0, 26 }, { 0x019B, 16, 13 }, { 0x019C, 24, 22 }, { 0x019D, 0, 0 }, { 0x019E, 0, 0 }, { 0x019F, 0, 0 }, { 0x01A0, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+    { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 }, { 0x042D, 0, 0 },
+};
+
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
@@ -4163,4 +4240,7 @@ static const EpdFontData notosans_12_bold = {
     76,
     notosans_12_boldLigaturePairs,
     5,
+    notosans_12_boldLatinLookup,
+    nullptr,
+    nullptr,
 };
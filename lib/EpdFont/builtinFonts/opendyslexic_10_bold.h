@@ -2794,6 +2794,83 @@ static const int8_t opendyslexic_10_boldKernMatrix[] = {
       53,
 };
 
+static const EpdLatinLookupEntry opendyslexic_10_boldLatinLookup[592] = {
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0000, 0, 1 }, { 0x0001, 1, 0 }, { 0x0002, 1, 0 }, { 0x0003, 1, 0 }, { 0x0004, 0, 0 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 1, 0 },
+    { 0x0008, 1, 0 }, { 0x0009, 1, 0 }, { 0x000A, 1, 0 }, { 0x000B, 0, 0 }, { 0x000C, 1, 0 }, { 0x000D, 1, 0 }, { 0x000E, 1, 0 }, { 0x000F, 1, 0 },
+    { 0x0010, 0, 0 }, { 0x0011, 0, 0 }, { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 },
+    { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 1, 0 }, { 0x001B, 1, 0 }, { 0x001C, 0, 0 }, { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 1, 0 },
+    { 0x0020, 0, 0 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 0 }, { 0x0025, 0, 0 }, { 0x0026, 0, 0 }, { 0x0027, 0, 0 },
+    { 0x0028, 0, 0 }, { 0x0029, 0, 0 }, { 0x002A, 0, 0 }, { 0x002B, 0, 0 }, { 0x002C, 0, 0 }, { 0x002D, 0, 0 }, { 0x002E, 0, 0 }, { 0x002F, 0, 0 },
+    { 0x0030, 0, 0 }, { 0x0031, 0, 0 }, { 0x0032, 0, 0 }, { 0x0033, 0, 0 }, { 0x0034, 0, 0 }, { 0x0035, 0, 0 }, { 0x0036, 0, 0 }, { 0x0037, 0, 0 },
+    { 0x0038, 0, 0 }, { 0x0039, 0, 0 }, { 0x003A, 0, 0 }, { 0x003B, 1, 0 }, { 0x003C, 1, 0 }, { 0x003D, 1, 0 }, { 0x003E, 0, 0 }, { 0x003F, 1, 0 },
+    { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, { 0x0042, 0, 0 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 }, { 0x0045, 0, 0 }, { 0x0046, 0, 0 }, { 0x0047, 0, 0 },
+    { 0x0048, 0, 0 }, { 0x0049, 0, 0 }, { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 0 }, { 0x004D, 0, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 0 },
+    { 0x0050, 0, 0 }, { 0x0051, 0, 0 }, { 0x0052, 0, 0 }, { 0x0053, 0, 0 }, { 0x0054, 0, 0 }, { 0x0055, 0, 0 }, { 0x0056, 0, 0 }, { 0x0057, 0, 0 },
+    { 0x0058, 0, 0 }, { 0x0059, 0, 0 }, { 0x005A, 0, 0 }, { 0x005B, 1, 0 }, { 0x005C, 0, 0 }, { 0x005D, 1, 0 }, { 0x005E, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x005F, 0, 0 }, { 0x0060, 1, 0 }, { 0x0061, 0, 0 }, { 0x0062, 0, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 },
+    { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 1, 0 }, { 0x006B, 0, 0 }, { 0x006C, 1, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 },
+    { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 1, 0 },
+    { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 1, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 1, 0 },
+    { 0x007F, 0, 0 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 0, 0 }, { 0x0084, 0, 0 }, { 0x0085, 0, 0 }, { 0x0086, 0, 0 },
+    { 0x0087, 0, 0 }, { 0x0088, 0, 0 }, { 0x0089, 0, 0 }, { 0x008A, 0, 0 }, { 0x008B, 0, 0 }, { 0x008C, 0, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 },
+    { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, { 0x0091, 0, 0 }, { 0x0092, 0, 0 }, { 0x0093, 0, 0 }, { 0x0094, 0, 0 }, { 0x0095, 0, 0 }, { 0x0096, 0, 0 },
+    { 0x0097, 0, 0 }, { 0x0098, 0, 0 }, { 0x0099, 0, 0 }, { 0x009A, 0, 0 }, { 0x009B, 0, 0 }, { 0x009C, 0, 0 }, { 0x009D, 0, 0 }, { 0x009E, 0, 0 },
+    { 0x009F, 0, 0 }, { 0x00A0, 0, 0 }, { 0x00A1, 0, 0 }, { 0x00A2, 0, 0 }, { 0x00A3, 0, 0 }, { 0x00A4, 0, 0 }, { 0x00A5, 0, 0 }, { 0x00A6, 0, 0 },
+    { 0x00A7, 0, 0 }, { 0x00A8, 0, 0 }, { 0x00A9, 0, 0 }, { 0x00AA, 0, 0 }, { 0x00AB, 0, 0 }, { 0x00AC, 0, 0 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 },
+    { 0x00AF, 0, 0 }, { 0x00B0, 0, 0 }, { 0x00B1, 0, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 0, 0 }, { 0x00B4, 0, 0 }, { 0x00B5, 0, 0 }, { 0x00B6, 0, 0 },
+    { 0x00B7, 0, 0 }, { 0x00B8, 0, 0 }, { 0x00B9, 0, 0 }, { 0x00BA, 0, 0 }, { 0x00BB, 0, 0 }, { 0x00BC, 0, 0 }, { 0x00BD, 0, 0 }, { 0x00BE, 0, 0 },
+    { 0x00BF, 0, 0 }, { 0x00C0, 0, 0 }, { 0x00C1, 0, 0 }, { 0x00C2, 0, 0 }, { 0x00C3, 0, 0 }, { 0x00C4, 0, 0 }, { 0x00C5, 0, 0 }, { 0x00C6, 0, 0 },
+    { 0x00C7, 0, 0 }, { 0x00C8, 0, 0 }, { 0x00C9, 0, 0 }, { 0x00CA, 0, 0 }, { 0x00CB, 0, 0 }, { 0x00CC, 0, 0 }, { 0x00CD, 0, 0 }, { 0x00CE, 0, 0 },
+    { 0x00CF, 0, 0 }, { 0x00D0, 0, 0 }, { 0x00D1, 0, 0 }, { 0x00D2, 0, 0 }, { 0x00D3, 0, 0 }, { 0x00D4, 0, 0 }, { 0x00D5, 0, 0 }, { 0x00D6, 0, 0 },
+    { 0x00D7, 0, 0 }, { 0x00D8, 0, 0 }, { 0x00D9, 0, 0 }, { 0x00DA, 0, 0 }, { 0x00DB, 0, 0 }, { 0x00DC, 0, 0 }, { 0x00DD, 0, 0 }, { 0x00DE, 0, 0 },
+    { 0x00DF, 0, 0 }, { 0x00E0, 0, 0 }, { 0x00E1, 0, 0 }, { 0x00E2, 0, 0 }, { 0x00E3, 0, 0 }, { 0x00E4, 0, 0 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 },
+    { 0x00E7, 0, 0 }, { 0x00E8, 0, 0 }, { 0x00E9, 0, 0 }, { 0x00EA, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x00EB, 0, 0 }, { 0x00EC, 0, 0 },
+    { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 0, 0 }, { 0x00F0, 0, 0 }, { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 },
+    { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 0, 0 }, { 0x00F8, 0, 0 }, { 0x00F9, 0, 0 }, { 0x00FA, 0, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 0, 0 },
+    { 0x00FD, 0, 0 }, { 0x00FE, 0, 0 }, { 0x00FF, 0, 0 }, { 0x0100, 0, 0 }, { 0x0101, 0, 0 }, { 0x0102, 0, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 },
+    { 0x0105, 0, 0 }, { 0x0106, 0, 0 }, { 0x0107, 0, 0 }, { 0x0108, 0, 0 }, { 0x0109, 0, 0 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 0 },
+    { 0x010D, 0, 0 }, { 0x010E, 0, 0 }, { 0x010F, 0, 0 }, { 0x0110, 0, 0 }, { 0x0111, 0, 0 }, { 0x0112, 0, 0 }, { 0x0113, 0, 0 }, { 0x0114, 0, 0 },
+    { 0x0115, 0, 0 }, { 0x0116, 0, 0 }, { 0x0117, 0, 0 }, { 0x0118, 0, 0 }, { 0x0119, 0, 0 }, { 0x011A, 0, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 0 },
+    { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 0 }, { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 0, 0 }, { 0x0124, 0, 0 },
+    { 0x0125, 0, 0 }, { 0x0126, 0, 0 }, { 0x0127, 0, 0 }, { 0x0128, 0, 0 }, { 0x0129, 0, 0 }, { 0x012A, 0, 0 }, { 0x012B, 0, 0 }, { 0x012C, 0, 0 },
+    { 0x012D, 0, 0 }, { 0x012E, 0, 0 }, { 0x012F, 0, 0 }, { 0x0130, 0, 0 }, { 0x0131, 0, 0 }, { 0x0132, 0, 0 }, { 0x0133, 0, 0 }, { 0x0134, 0, 0 },
+    { 0x0135, 0, 0 }, { 0x0136, 0, 0 }, { 0x0137, 0, 0 }, { 0x0138, 0, 0 }, { 0x0139, 0, 0 }, { 0x013A, 0, 0 }, { 0x013B, 0, 0 }, { 0x013C, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x013D, 0, 0 }, { 0x013E, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x013F, 0, 0 },
+    { 0x0140, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0141, 0, 0 }, { 0x0142, 0, 0 }, { 0x0143, 0, 0 }, { 0x0144, 0, 0 },
+    { 0x0145, 0, 0 }, { 0x0146, 0, 0 }, { 0x0147, 0, 0 }, { 0x0148, 0, 0 }, { 0x0149, 0, 0 }, { 0x014A, 0, 0 }, { 0x014B, 0, 0 }, { 0x014C, 0, 0 },
+    { 0x014D, 0, 0 }, { 0x014E, 0, 0 }, { 0x014F, 0, 0 }, { 0x0150, 0, 0 }, { 0x0151, 0, 0 }, { 0x0152, 0, 0 }, { 0x0153, 0, 0 }, { 0x0154, 0, 0 },
+    { 0x0155, 0, 0 }, { 0x0156, 0, 0 }, { 0x0157, 0, 0 }, { 0x0158, 0, 0 }, { 0x0159, 0, 0 }, { 0x015A, 0, 0 }, { 0x015B, 0, 0 }, { 0x015C, 0, 0 },
+    { 0x015D, 0, 0 }, { 0x015E, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x015F, 0, 0 }, { 0x0160, 0, 0 }, { 0x0161, 0, 0 }, { 0x0162, 0, 0 }, { 0x0163, 0, 0 },
+    { 0x0164, 0, 0 }, { 0x0165, 0, 0 }, { 0x0166, 0, 0 }, { 0x0167, 0, 0 }, { 0x0168, 0, 0 }, { 0x0169, 0, 0 }, { 0x016A, 0, 0 }, { 0x016B, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0x016C, 0, 0 }, { 0x016D, 0, 0 }, { 0x016E, 0, 0 }, { 0x016F, 0, 0 }, { 0x0170, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0171, 0, 0 }, { 0x0172, 0, 0 }, { 0x0173, 0, 0 }, { 0x0174, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0175, 0, 0 }, { 0x0176, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0177, 0, 0 }, { 0x0178, 0, 0 }, { 0x0179, 0, 0 }, { 0x017A, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x017B, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+};
+
 static const EpdFontData opendyslexic_10_bold = {
     opendyslexic_10_boldBitmaps,
     opendyslexic_10_boldGlyphs,
@@ -2814,4 +2891,7 @@ static const EpdFontData opendyslexic_10_bold = {
     1,
     nullptr,
     0,
+    opendyslexic_10_boldLatinLookup,
+    nullptr,
+    nullptr,
 };
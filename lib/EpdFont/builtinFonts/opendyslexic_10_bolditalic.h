@@ -3520,6 +3520,83 @@ static const EpdLigaturePair opendyslexic_10_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry opendyslexic_10_bolditalicLatinLookup[592] = {
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0000, 0, 0 }, { 0x0001, 1, 1 }, { 0x0002, 2, 2 }, { 0x0003, 0, 0 }, { 0x0004, 3, 3 }, { 0x0005, 0, 0 }, { 0x0006, 4, 4 }, { 0x0007, 5, 5 },
+    { 0x0008, 6, 6 }, { 0x0009, 7, 7 }, { 0x000A, 8, 8 }, { 0x000B, 0, 0 }, { 0x000C, 9, 9 }, { 0x000D, 0, 0 }, { 0x000E, 10, 10 }, { 0x000F, 0, 0 },
+    { 0x0010, 11, 11 }, { 0x0011, 12, 12 }, { 0x0012, 13, 13 }, { 0x0013, 14, 14 }, { 0x0014, 15, 15 }, { 0x0015, 16, 16 }, { 0x0016, 17, 17 }, { 0x0017, 18, 18 },
+    { 0x0018, 19, 19 }, { 0x0019, 20, 20 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 }, { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 21, 21 },
+    { 0x0020, 0, 0 }, { 0x0021, 22, 22 }, { 0x0022, 23, 23 }, { 0x0023, 24, 24 }, { 0x0024, 25, 25 }, { 0x0025, 26, 26 }, { 0x0026, 27, 27 }, { 0x0027, 28, 28 },
+    { 0x0028, 29, 29 }, { 0x0029, 30, 30 }, { 0x002A, 31, 31 }, { 0x002B, 32, 32 }, { 0x002C, 33, 33 }, { 0x002D, 34, 34 }, { 0x002E, 35, 35 }, { 0x002F, 36, 36 },
+    { 0x0030, 37, 37 }, { 0x0031, 38, 38 }, { 0x0032, 39, 39 }, { 0x0033, 40, 40 }, { 0x0034, 41, 41 }, { 0x0035, 42, 42 }, { 0x0036, 43, 43 }, { 0x0037, 44, 44 },
+    { 0x0038, 45, 45 }, { 0x0039, 46, 46 }, { 0x003A, 47, 47 }, { 0x003B, 48, 48 }, { 0x003C, 0, 0 }, { 0x003D, 49, 49 }, { 0x003E, 0, 0 }, { 0x003F, 0, 0 },
+    { 0x0040, 0, 0 }, { 0x0041, 50, 50 }, { 0x0042, 51, 51 }, { 0x0043, 52, 52 }, { 0x0044, 53, 53 }, { 0x0045, 54, 54 }, { 0x0046, 55, 55 }, { 0x0047, 56, 56 },
+    { 0x0048, 57, 57 }, { 0x0049, 58, 58 }, { 0x004A, 59, 59 }, { 0x004B, 60, 60 }, { 0x004C, 61, 61 }, { 0x004D, 62, 62 }, { 0x004E, 63, 63 }, { 0x004F, 64, 64 },
+    { 0x0050, 65, 65 }, { 0x0051, 66, 66 }, { 0x0052, 67, 67 }, { 0x0053, 68, 68 }, { 0x0054, 69, 69 }, { 0x0055, 70, 70 }, { 0x0056, 71, 71 }, { 0x0057, 72, 72 },
+    { 0x0058, 73, 73 }, { 0x0059, 74, 74 }, { 0x005A, 75, 75 }, { 0x005B, 76, 76 }, { 0x005C, 0, 0 }, { 0x005D, 77, 77 }, { 0x005E, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x005F, 0, 0 }, { 0x0060, 78, 78 }, { 0x0061, 79, 79 }, { 0x0062, 80, 80 }, { 0x0063, 0, 0 }, { 0x0064, 81, 81 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 },
+    { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 },
+    { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 },
+    { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 82, 82 },
+    { 0x007F, 0, 0 }, { 0x0080, 83, 83 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 83, 83 }, { 0x0084, 83, 83 }, { 0x0085, 84, 84 }, { 0x0086, 85, 85 },
+    { 0x0087, 0, 0 }, { 0x0088, 0, 0 }, { 0x0089, 0, 0 }, { 0x008A, 0, 0 }, { 0x008B, 86, 86 }, { 0x008C, 87, 87 }, { 0x008D, 88, 0 }, { 0x008E, 89, 88 },
+    { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, { 0x0091, 0, 0 }, { 0x0092, 90, 89 }, { 0x0093, 0, 0 }, { 0x0094, 0, 0 }, { 0x0095, 91, 89 }, { 0x0096, 0, 0 },
+    { 0x0097, 92, 90 }, { 0x0098, 93, 91 }, { 0x0099, 0, 0 }, { 0x009A, 93, 92 }, { 0x009B, 94, 93 }, { 0x009C, 0, 0 }, { 0x009D, 95, 94 }, { 0x009E, 96, 95 },
+    { 0x009F, 0, 0 }, { 0x00A0, 0, 0 }, { 0x00A1, 0, 0 }, { 0x00A2, 0, 0 }, { 0x00A3, 97, 96 }, { 0x00A4, 98, 97 }, { 0x00A5, 99, 98 }, { 0x00A6, 100, 99 },
+    { 0x00A7, 0, 0 }, { 0x00A8, 0, 0 }, { 0x00A9, 0, 0 }, { 0x00AA, 0, 0 }, { 0x00AB, 101, 100 }, { 0x00AC, 102, 101 }, { 0x00AD, 103, 102 }, { 0x00AE, 104, 103 },
+    { 0x00AF, 105, 104 }, { 0x00B0, 0, 0 }, { 0x00B1, 0, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 0, 0 }, { 0x00B4, 0, 0 }, { 0x00B5, 106, 105 }, { 0x00B6, 0, 0 },
+    { 0x00B7, 107, 106 }, { 0x00B8, 0, 0 }, { 0x00B9, 0, 0 }, { 0x00BA, 0, 0 }, { 0x00BB, 108, 107 }, { 0x00BC, 0, 0 }, { 0x00BD, 0, 0 }, { 0x00BE, 0, 0 },
+    { 0x00BF, 0, 0 }, { 0x00C0, 0, 0 }, { 0x00C1, 0, 0 }, { 0x00C2, 0, 0 }, { 0x00C3, 0, 0 }, { 0x00C4, 0, 0 }, { 0x00C5, 0, 0 }, { 0x00C6, 0, 0 },
+    { 0x00C7, 0, 0 }, { 0x00C8, 0, 0 }, { 0x00C9, 0, 0 }, { 0x00CA, 0, 0 }, { 0x00CB, 0, 0 }, { 0x00CC, 0, 0 }, { 0x00CD, 0, 0 }, { 0x00CE, 0, 0 },
+    { 0x00CF, 0, 0 }, { 0x00D0, 0, 0 }, { 0x00D1, 0, 0 }, { 0x00D2, 0, 0 }, { 0x00D3, 0, 0 }, { 0x00D4, 0, 0 }, { 0x00D5, 0, 0 }, { 0x00D6, 0, 0 },
+    { 0x00D7, 0, 0 }, { 0x00D8, 0, 0 }, { 0x00D9, 0, 0 }, { 0x00DA, 0, 0 }, { 0x00DB, 0, 0 }, { 0x00DC, 0, 0 }, { 0x00DD, 0, 0 }, { 0x00DE, 0, 0 },
+    { 0x00DF, 0, 0 }, { 0x00E0, 0, 0 }, { 0x00E1, 0, 0 }, { 0x00E2, 0, 0 }, { 0x00E3, 0, 0 }, { 0x00E4, 0, 0 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 },
+    { 0x00E7, 88, 0 }, { 0x00E8, 109, 108 }, { 0x00E9, 88, 0 }, { 0x00EA, 110, 109 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x00EB, 0, 0 }, { 0x00EC, 111, 110 },
+    { 0x00ED, 88, 0 }, { 0x00EE, 112, 111 }, { 0x00EF, 0, 0 }, { 0x00F0, 0, 0 }, { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 },
+    { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 0, 0 }, { 0x00F8, 0, 0 }, { 0x00F9, 0, 0 }, { 0x00FA, 0, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 0, 0 },
+    { 0x00FD, 0, 0 }, { 0x00FE, 0, 0 }, { 0x00FF, 0, 0 }, { 0x0100, 0, 0 }, { 0x0101, 0, 0 }, { 0x0102, 0, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 },
+    { 0x0105, 0, 0 }, { 0x0106, 0, 0 }, { 0x0107, 0, 0 }, { 0x0108, 0, 0 }, { 0x0109, 0, 0 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 0 },
+    { 0x010D, 0, 0 }, { 0x010E, 0, 0 }, { 0x010F, 113, 89 }, { 0x0110, 114, 112 }, { 0x0111, 0, 0 }, { 0x0112, 0, 0 }, { 0x0113, 0, 0 }, { 0x0114, 0, 0 },
+    { 0x0115, 0, 0 }, { 0x0116, 0, 0 }, { 0x0117, 0, 0 }, { 0x0118, 0, 0 }, { 0x0119, 0, 0 }, { 0x011A, 0, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 0 },
+    { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 0 }, { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 0, 0 }, { 0x0124, 0, 0 },
+    { 0x0125, 0, 0 }, { 0x0126, 0, 0 }, { 0x0127, 0, 0 }, { 0x0128, 0, 0 }, { 0x0129, 0, 0 }, { 0x012A, 0, 0 }, { 0x012B, 0, 0 }, { 0x012C, 0, 0 },
+    { 0x012D, 0, 0 }, { 0x012E, 0, 0 }, { 0x012F, 0, 0 }, { 0x0130, 0, 0 }, { 0x0131, 0, 0 }, { 0x0132, 0, 0 }, { 0x0133, 0, 0 }, { 0x0134, 0, 0 },
+    { 0x0135, 0, 0 }, { 0x0136, 0, 0 }, { 0x0137, 0, 0 }, { 0x0138, 0, 0 }, { 0x0139, 0, 0 }, { 0x013A, 0, 0 }, { 0x013B, 0, 0 }, { 0x013C, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x013D, 0, 0 }, { 0x013E, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x013F, 0, 0 },
+    { 0x0140, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0141, 0, 0 }, { 0x0142, 0, 0 }, { 0x0143, 0, 0 }, { 0x0144, 0, 0 },
+    { 0x0145, 0, 0 }, { 0x0146, 0, 0 }, { 0x0147, 0, 0 }, { 0x0148, 0, 0 }, { 0x0149, 0, 0 }, { 0x014A, 0, 0 }, { 0x014B, 0, 0 }, { 0x014C, 88, 0 },
+    { 0x014D, 115, 113 }, { 0x014E, 0, 0 }, { 0x014F, 0, 0 }, { 0x0150, 0, 0 }, { 0x0151, 0, 0 }, { 0x0152, 0, 0 }, { 0x0153, 0, 0 }, { 0x0154, 0, 0 },
+    { 0x0155, 0, 0 }, { 0x0156, 0, 0 }, { 0x0157, 0, 0 }, { 0x0158, 0, 0 }, { 0x0159, 0, 0 }, { 0x015A, 0, 0 }, { 0x015B, 0, 0 }, { 0x015C, 0, 0 },
+    { 0x015D, 0, 0 }, { 0x015E, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x015F, 0, 0 }, { 0x0160, 0, 0 }, { 0x0161, 0, 0 }, { 0x0162, 0, 0 }, { 0x0163, 0, 0 },
+    { 0x0164, 0, 0 }, { 0x0165, 0, 0 }, { 0x0166, 0, 0 }, { 0x0167, 0, 0 }, { 0x0168, 0, 0 }, { 0x0169, 0, 0 }, { 0x016A, 0, 0 }, { 0x016B, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0x016C, 0, 0 }, { 0x016D, 0, 0 }, { 0x016E, 0, 0 }, { 0x016F, 0, 0 }, { 0x0170, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0171, 0, 0 }, { 0x0172, 0, 0 }, { 0x0173, 0, 0 }, { 0x0174, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0175, 0, 0 }, { 0x0176, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0177, 0, 0 }, { 0x0178, 0, 0 }, { 0x0179, 0, 0 }, { 0x017A, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x017B, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+};
+
 static const EpdFontData opendyslexic_10_bolditalic = {
     opendyslexic_10_bolditalicBitmaps,
     opendyslexic_10_bolditalicGlyphs,
@@ -3540,4 +3617,7 @@ static const EpdFontData opendyslexic_10_bolditalic = {
     121,
     opendyslexic_10_bolditalicLigaturePairs,
     5,
+    opendyslexic_10_bolditalicLatinLookup,
+    nullptr,
+    nullptr,
 };
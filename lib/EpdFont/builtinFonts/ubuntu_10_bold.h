@@ -3081,6 +3081,83 @@ static const EpdLigaturePair ubuntu_10_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdLatinLookupEntry ubuntu_10_boldLatinLookup[592] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0003, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0004, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0005, 0, 0 }, { 0x0006, 0, 1 }, { 0x0007, 1, 2 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 2, 3 }, { 0x000C, 1, 2 },
+    { 0x000D, 3, 4 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 0, 0 }, { 0x0011, 6, 7 }, { 0x0012, 7, 8 }, { 0x0013, 6, 7 }, { 0x0014, 8, 9 },
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 },
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 9, 10 }, { 0x0020, 9, 10 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 11 },
+    { 0x0025, 10, 12 }, { 0x0026, 11, 13 }, { 0x0027, 12, 14 }, { 0x0028, 13, 15 }, { 0x0029, 14, 14 }, { 0x002A, 15, 14 }, { 0x002B, 16, 14 }, { 0x002C, 17, 16 },
+    { 0x002D, 18, 14 }, { 0x002E, 18, 14 }, { 0x002F, 19, 17 }, { 0x0030, 20, 14 }, { 0x0031, 21, 14 }, { 0x0032, 22, 18 }, { 0x0033, 18, 14 }, { 0x0034, 23, 19 },
+    { 0x0035, 24, 14 }, { 0x0036, 25, 19 }, { 0x0037, 26, 14 }, { 0x0038, 27, 20 }, { 0x0039, 28, 21 }, { 0x003A, 29, 22 }, { 0x003B, 30, 23 }, { 0x003C, 31, 24 },
+    { 0x003D, 32, 25 }, { 0x003E, 33, 26 }, { 0x003F, 34, 27 }, { 0x0040, 35, 28 }, { 0x0041, 36, 29 }, { 0x0042, 37, 30 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 },
+    { 0x0045, 0, 0 }, { 0x0046, 38, 31 }, { 0x0047, 39, 32 }, { 0x0048, 40, 33 }, { 0x0049, 41, 34 }, { 0x004A, 0, 33 }, { 0x004B, 42, 35 }, { 0x004C, 43, 33 },
+    { 0x004D, 44, 36 }, { 0x004E, 45, 37 }, { 0x004F, 46, 38 }, { 0x0050, 47, 36 }, { 0x0051, 48, 36 }, { 0x0052, 49, 39 }, { 0x0053, 49, 39 }, { 0x0054, 50, 34 },
+    { 0x0055, 39, 39 }, { 0x0056, 51, 33 }, { 0x0057, 52, 39 }, { 0x0058, 53, 40 }, { 0x0059, 54, 41 }, { 0x005A, 55, 42 }, { 0x005B, 56, 43 }, { 0x005C, 57, 44 },
+    { 0x005D, 58, 45 }, { 0x005E, 59, 46 }, { 0x005F, 60, 47 }, { 0x0060, 61, 48 }, { 0x0061, 0, 0 }, { 0x0062, 62, 49 }, { 0x0063, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0064, 0, 0 }, { 0x0065, 63, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 },
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 64, 50 }, { 0x0070, 0, 0 }, { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 },
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 },
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 65, 51 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 66, 0 },
+    { 0x0084, 11, 13 }, { 0x0085, 11, 13 }, { 0x0086, 11, 13 }, { 0x0087, 11, 13 }, { 0x0088, 11, 13 }, { 0x0089, 11, 13 }, { 0x008A, 15, 52 }, { 0x008B, 13, 15 },
+    { 0x008C, 15, 14 }, { 0x008D, 15, 14 }, { 0x008E, 15, 14 }, { 0x008F, 15, 14 }, { 0x0090, 18, 14 }, { 0x0091, 18, 14 }, { 0x0092, 18, 14 }, { 0x0093, 18, 14 },
+    { 0x0094, 14, 14 }, { 0x0095, 18, 14 }, { 0x0096, 23, 19 }, { 0x0097, 23, 19 }, { 0x0098, 23, 19 }, { 0x0099, 23, 19 }, { 0x009A, 23, 19 }, { 0x009B, 0, 0 },
+    { 0x009C, 23, 19 }, { 0x009D, 29, 22 }, { 0x009E, 29, 22 }, { 0x009F, 29, 22 }, { 0x00A0, 29, 22 }, { 0x00A1, 33, 26 }, { 0x00A2, 67, 0 }, { 0x00A3, 68, 53 },
+    { 0x00A4, 38, 31 }, { 0x00A5, 38, 31 }, { 0x00A6, 38, 31 }, { 0x00A7, 38, 31 }, { 0x00A8, 38, 54 }, { 0x00A9, 38, 31 }, { 0x00AA, 0, 31 }, { 0x00AB, 40, 33 },
+    { 0x00AC, 0, 33 }, { 0x00AD, 0, 33 }, { 0x00AE, 0, 33 }, { 0x00AF, 0, 33 }, { 0x00B0, 45, 55 }, { 0x00B1, 45, 37 }, { 0x00B2, 45, 56 }, { 0x00B3, 45, 57 },
+    { 0x00B4, 69, 58 }, { 0x00B5, 49, 39 }, { 0x00B6, 50, 34 }, { 0x00B7, 50, 34 }, { 0x00B8, 50, 34 }, { 0x00B9, 50, 34 }, { 0x00BA, 50, 34 }, { 0x00BB, 0, 0 },
+    { 0x00BC, 50, 34 }, { 0x00BD, 55, 42 }, { 0x00BE, 55, 42 }, { 0x00BF, 55, 42 }, { 0x00C0, 55, 42 }, { 0x00C1, 59, 46 }, { 0x00C2, 70, 0 }, { 0x00C3, 59, 46 },
+    { 0x00C4, 11, 13 }, { 0x00C5, 38, 31 }, { 0x00C6, 11, 13 }, { 0x00C7, 38, 31 }, { 0x00C8, 11, 13 }, { 0x00C9, 38, 31 }, { 0x00CA, 13, 15 }, { 0x00CB, 40, 33 },
+    { 0x00CC, 13, 15 }, { 0x00CD, 40, 33 }, { 0x00CE, 13, 15 }, { 0x00CF, 40, 33 }, { 0x00D0, 13, 15 }, { 0x00D1, 40, 33 }, { 0x00D2, 14, 14 }, { 0x00D3, 71, 34 },
+    { 0x00D4, 14, 0 }, { 0x00D5, 41, 34 }, { 0x00D6, 15, 14 }, { 0x00D7, 0, 33 }, { 0x00D8, 15, 14 }, { 0x00D9, 0, 33 }, { 0x00DA, 15, 14 }, { 0x00DB, 0, 33 },
+    { 0x00DC, 15, 14 }, { 0x00DD, 0, 33 }, { 0x00DE, 15, 14 }, { 0x00DF, 0, 33 }, { 0x00E0, 17, 16 }, { 0x00E1, 43, 33 }, { 0x00E2, 17, 16 }, { 0x00E3, 43, 33 },
+    { 0x00E4, 17, 16 }, { 0x00E5, 43, 33 }, { 0x00E6, 17, 16 }, { 0x00E7, 43, 33 }, { 0x00E8, 18, 14 }, { 0x00E9, 44, 36 }, { 0x00EA, 18, 14 }, { 0x00EB, 44, 36 },
+    { 0x00EC, 18, 14 }, { 0x00ED, 45, 59 }, { 0x00EE, 18, 14 }, { 0x00EF, 45, 60 }, { 0x00F0, 18, 14 }, { 0x00F1, 45, 61 }, { 0x00F2, 18, 14 }, { 0x00F3, 45, 37 },
+    { 0x00F4, 18, 14 }, { 0x00F5, 45, 37 }, { 0x00F6, 19, 14 }, { 0x00F7, 46, 37 }, { 0x00F8, 19, 17 }, { 0x00F9, 46, 38 }, { 0x00FA, 20, 14 }, { 0x00FB, 47, 36 },
+    { 0x00FC, 47, 0 }, { 0x00FD, 21, 14 }, { 0x00FE, 48, 36 }, { 0x00FF, 21, 14 }, { 0x0100, 48, 36 }, { 0x0101, 21, 14 }, { 0x0102, 71, 36 }, { 0x0103, 21, 14 },
+    { 0x0104, 48, 36 }, { 0x0105, 21, 14 }, { 0x0106, 48, 36 }, { 0x0107, 18, 14 }, { 0x0108, 49, 39 }, { 0x0109, 18, 14 }, { 0x010A, 49, 39 }, { 0x010B, 18, 14 },
+    { 0x010C, 49, 39 }, { 0x010D, 49, 39 }, { 0x010E, 72, 62 }, { 0x010F, 73, 63 }, { 0x0110, 23, 19 }, { 0x0111, 50, 34 }, { 0x0112, 23, 19 }, { 0x0113, 50, 34 },
+    { 0x0114, 23, 19 }, { 0x0115, 50, 34 }, { 0x0116, 15, 19 }, { 0x0117, 0, 34 }, { 0x0118, 26, 14 }, { 0x0119, 52, 39 }, { 0x011A, 26, 14 }, { 0x011B, 52, 39 },
+    { 0x011C, 26, 14 }, { 0x011D, 52, 39 }, { 0x011E, 27, 20 }, { 0x011F, 53, 40 }, { 0x0120, 27, 20 }, { 0x0121, 53, 40 }, { 0x0122, 27, 20 }, { 0x0123, 53, 40 },
+    { 0x0124, 27, 20 }, { 0x0125, 53, 40 }, { 0x0126, 28, 21 }, { 0x0127, 54, 41 }, { 0x0128, 28, 21 }, { 0x0129, 54, 41 }, { 0x012A, 28, 21 }, { 0x012B, 54, 41 },
+    { 0x012C, 29, 22 }, { 0x012D, 55, 42 }, { 0x012E, 29, 22 }, { 0x012F, 55, 42 }, { 0x0130, 29, 22 }, { 0x0131, 55, 42 }, { 0x0132, 29, 22 }, { 0x0133, 55, 42 },
+    { 0x0134, 29, 22 }, { 0x0135, 55, 42 }, { 0x0136, 29, 22 }, { 0x0137, 55, 42 }, { 0x0138, 31, 24 }, { 0x0139, 57, 44 }, { 0x013A, 33, 26 }, { 0x013B, 59, 46 },
+    { 0x013C, 33, 26 }, { 0x013D, 34, 27 }, { 0x013E, 60, 47 }, { 0x013F, 34, 27 }, { 0x0140, 60, 47 }, { 0x0141, 34, 27 }, { 0x0142, 60, 47 }, { 0x0143, 42, 35 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0x0144, 74, 19 }, { 0x0145, 0, 34 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0146, 0, 22 },
+    { 0x0147, 0, 42 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0148, 34, 14 }, { 0x0149, 60, 14 }, { 0x014A, 60, 34 }, { 0x014B, 19, 14 },
+    { 0x014C, 46, 14 }, { 0x014D, 46, 36 }, { 0x014E, 19, 14 }, { 0x014F, 46, 14 }, { 0x0150, 46, 39 }, { 0x0151, 11, 13 }, { 0x0152, 38, 31 }, { 0x0153, 18, 14 },
+    { 0x0154, 45, 37 }, { 0x0155, 23, 19 }, { 0x0156, 50, 34 }, { 0x0157, 29, 22 }, { 0x0158, 55, 42 }, { 0x0159, 29, 22 }, { 0x015A, 55, 42 }, { 0x015B, 29, 22 },
+    { 0x015C, 55, 42 }, { 0x015D, 29, 22 }, { 0x015E, 55, 42 }, { 0x015F, 29, 22 }, { 0x0160, 55, 42 }, { 0x0161, 50, 64 }, { 0x0162, 11, 13 }, { 0x0163, 38, 31 },
+    { 0x0164, 11, 13 }, { 0x0165, 38, 31 }, { 0x0166, 15, 52 }, { 0x0167, 0, 31 }, { 0x0168, 17, 16 }, { 0x0169, 43, 33 }, { 0x016A, 17, 16 }, { 0x016B, 43, 33 },
+    { 0x016C, 20, 14 }, { 0x016D, 47, 36 }, { 0x016E, 23, 19 }, { 0x016F, 50, 34 }, { 0x0170, 23, 19 }, { 0x0171, 50, 34 }, { 0x0172, 75, 65 }, { 0x0173, 76, 0 },
+    { 0x0174, 46, 38 }, { 0x0175, 34, 14 }, { 0x0176, 60, 14 }, { 0x0177, 60, 34 }, { 0x0178, 17, 16 }, { 0x0179, 43, 33 }, { 0x017A, 55, 0 }, { 0x017B, 77, 0 },
+    { 0x017C, 18, 14 }, { 0x017D, 49, 39 }, { 0x017E, 11, 13 }, { 0x017F, 38, 31 }, { 0x0180, 15, 52 }, { 0x0181, 0, 31 }, { 0x0182, 23, 19 }, { 0x0183, 50, 34 },
+    { 0x0184, 11, 13 }, { 0x0185, 38, 31 }, { 0x0186, 11, 13 }, { 0x0187, 38, 31 }, { 0x0188, 15, 14 }, { 0x0189, 0, 33 }, { 0x018A, 15, 14 }, { 0x018B, 0, 33 },
+    { 0x018C, 18, 14 }, { 0x018D, 45, 37 }, { 0x018E, 18, 14 }, { 0x018F, 45, 37 }, { 0x0190, 23, 19 }, { 0x0191, 50, 34 }, { 0x0192, 23, 19 }, { 0x0193, 50, 34 },
+    { 0x0194, 26, 14 }, { 0x0195, 52, 39 }, { 0x0196, 26, 14 }, { 0x0197, 52, 39 }, { 0x0198, 29, 22 }, { 0x0199, 55, 42 }, { 0x019A, 29, 22 }, { 0x019B, 55, 42 },
+    { 0x019C, 27, 20 }, { 0x019D, 53, 40 }, { 0x019E, 28, 21 }, { 0x019F, 54, 41 }, { 0x01A0, 78, 66 }, { 0x01A1, 0, 67 }, { 0x01A2, 18, 14 }, { 0x01A3, 44, 36 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 },
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
@@ -3101,4 +3178,7 @@ static const EpdFontData ubuntu_10_bold = {
     132,
     ubuntu_10_boldLigaturePairs,
     5,
+    ubuntu_10_boldLatinLookup,
+    nullptr,
+    nullptr,
 };
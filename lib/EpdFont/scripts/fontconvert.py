@@ -5,8 +5,10 @@ import sys
 import re
 import math
 import argparse
+import struct
 from collections import namedtuple
 from fontTools.ttLib import TTFont
+from glyph_grouping import DEFAULT_GROUP_BYTES, corpus_groups, corpus_pages, is_contiguous, read_corpus, script_groups
 
 # Originally from https://github.com/vroland/epdiy
 
@@ -17,6 +19,9 @@ parser.add_argument("fontstack", action="store", nargs='+', help="list of font f
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="Compress glyph bitmaps using DEFLATE with group-based compression.")
+parser.add_argument("--binary", dest="binary", action="store", metavar="PATH", help="Write an .epdfont file for the SD card to PATH instead of printing a header. Implies --compress.")
+parser.add_argument("--group-corpus", dest="group_corpus", nargs='+', metavar="FILE", help="Group compressed glyphs by how often they appear on the pages of these EPUB or text files instead of by Unicode block. Implies --compress.")
+parser.add_argument("--group-bytes", dest="group_bytes", type=int, default=DEFAULT_GROUP_BYTES, help="Uncompressed size cap of the groups clustered from less frequent corpus glyphs.")
 parser.add_argument("--force-autohint", dest="force_autohint", action="store_true", help="Force FreeType auto-hinter instead of native font hinting. Improves stem width consistency for fonts with weak or no native TrueType hints.")
 args = parser.parse_args()
 
@@ -687,55 +692,29 @@ for packed, lig_cp in ligature_pairs:
 ligature_pairs = sorted(unique_ligature_pairs, key=lambda p: p[0])
 print(f"ligatures: {len(ligature_pairs)} pairs extracted", file=sys.stderr)
 
-compress = args.compress
+# SD card fonts are always compressed: the firmware pages groups in from the file
+compress = args.compress or args.binary is not None or args.group_corpus is not None
 
 # Build groups for compression
 if compress:
-    # Script-based grouping: glyphs that co-occur in typical text rendering
-    # are grouped together for efficient LRU caching on the embedded target.
-    # Since glyphs are in codepoint order, glyphs in the same Unicode block
-    # are contiguous in the array and form natural groups.
-    SCRIPT_GROUP_RANGES = [
-        (0x0000, 0x007F),   # ASCII
-        (0x0080, 0x00FF),   # Latin-1 Supplement
-        (0x0100, 0x017F),   # Latin Extended-A
-        (0x0180, 0x024F),   # Latin Extended-B
-        (0x0300, 0x036F),   # Combining Diacritical Marks
-        (0x0400, 0x04FF),   # Cyrillic
-        (0x1EA0, 0x1EF9),   # Vietnamese Extended
-        (0x2000, 0x206F),   # General Punctuation
-        (0x2070, 0x209F),   # Superscripts & Subscripts
-        (0x20A0, 0x20CF),   # Currency Symbols
-        (0x2190, 0x21FF),   # Arrows
-        (0x2200, 0x22FF),   # Math Operators
-        (0xFB00, 0xFB06),   # Alphabetic Presentation Forms (ligatures)
-        (0xFFFD, 0xFFFD),   # Replacement Character
-    ]
-
-    def get_script_group(code_point):
-        for i, (start, end) in enumerate(SCRIPT_GROUP_RANGES):
-            if start <= code_point <= end:
-                return i
-        return -1
-
-    groups = []  # list of (first_glyph_index, glyph_count)
-    current_group_id = None
-    group_start = 0
-    group_count = 0
-
-    for i, (props, packed) in enumerate(all_glyphs):
-        sg = get_script_group(props.code_point)
-        if sg != current_group_id:
-            if group_count > 0:
-                groups.append((group_start, group_count))
-            current_group_id = sg
-            group_start = i
-            group_count = 1
-        else:
-            group_count += 1
-
-    if group_count > 0:
-        groups.append((group_start, group_count))
+    # Script-based grouping puts each Unicode block in one contiguous group. Corpus grouping trains on sample
+    # text so a typical page touches one or two small groups; its groups are scattered across the glyph array and
+    # the font carries a group index per glyph (see glyph_grouping.py).
+    code_points = [props.code_point for props, _packed in all_glyphs]
+    if args.group_corpus:
+        pages = corpus_pages(read_corpus(args.group_corpus))
+        groups = corpus_groups(code_points, [len(packed) for _props, packed in all_glyphs], pages,
+                               dict(ligature_pairs), group_bytes=args.group_bytes)
+        print(f"grouping: trained on {len(pages)} corpus pages", file=sys.stderr)
+    else:
+        groups = script_groups(code_points)
+    # Contiguous groups need no per-glyph map
+    glyph_groups = None
+    if not is_contiguous(groups):
+        glyph_groups = [0] * len(all_glyphs)
+        for group_index, members in enumerate(groups):
+            for gi in members:
+                glyph_groups[gi] = group_index
 
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
@@ -745,10 +724,10 @@ if compress:
     # Also build modified glyph props with within-group offsets
     modified_glyph_props = list(glyph_props)
 
-    for first_idx, count in groups:
+    for members in groups:
         # Concatenate bitmap data for this group
         group_data = b''
-        for gi in range(first_idx, first_idx + count):
+        for gi in members:
             props, packed = all_glyphs[gi]
             # Update glyph's dataOffset to be within-group offset
             within_group_offset = len(group_data)
@@ -769,7 +748,7 @@ if compress:
         compressor = zlib.compressobj(level=9, wbits=-15)
         compressed = compressor.compress(group_data) + compressor.flush()
 
-        compressed_groups.append((compressed, len(group_data), count, first_idx))
+        compressed_groups.append((compressed, len(group_data), len(members), members[0]))
         compressed_bitmap_data.extend(compressed)
         compressed_offset += len(compressed)
 
@@ -778,6 +757,80 @@ if compress:
     total_uncompressed = len(glyph_data)
     print(f"// Compression: {total_uncompressed} -> {total_compressed} bytes ({100*total_compressed/total_uncompressed:.1f}%), {len(groups)} groups", file=sys.stderr)
 
+# Dense codepoint -> (glyph index, kern classes) table for the Latin range so the
+# hot measurement/render paths can skip the interval and kern class binary searches.
+LATIN_LOOKUP_SIZE = 0x250
+NO_GLYPH = 0xFFFF
+
+def glyph_index_of(code_point):
+    offset = 0
+    for i_start, i_end in intervals:
+        if i_start <= code_point <= i_end:
+            return offset + (code_point - i_start)
+        offset += i_end - i_start + 1
+    return None
+
+replacement_index = glyph_index_of(0xFFFD)
+left_class_of = dict(kern_left_classes)
+right_class_of = dict(kern_right_classes)
+latin_lookup = []
+for cp in range(LATIN_LOOKUP_SIZE):
+    glyph_index = glyph_index_of(cp)
+    if glyph_index is None:
+        # Mirrors EpdFont::getGlyph falling back to the replacement glyph
+        glyph_index = replacement_index if replacement_index is not None else NO_GLYPH
+    latin_lookup.append((glyph_index, left_class_of.get(cp, 0), right_class_of.get(cp, 0)))
+
+if args.binary:
+    # Layout read by lib/EpdFont/SdFont.cpp, see docs/file-formats.md. Tables follow the 40-byte header in this
+    # order, then the compressed groups.
+    with open(args.binary, "wb") as out:
+        out.write(struct.pack(
+            "<4sBBBBhhBBHIIHHIII",
+            b"EPDF",
+            1,
+            (1 if is2Bit else 0) | (2 if glyph_groups else 0),
+            norm_ceil(face.size.height),
+            0,
+            norm_ceil(face.size.ascender),
+            norm_floor(face.size.descender),
+            kern_left_class_count,
+            kern_right_class_count,
+            len(compressed_groups),
+            len(glyph_props),
+            len(intervals),
+            len(kern_left_classes),
+            len(kern_right_classes),
+            len(ligature_pairs),
+            LATIN_LOOKUP_SIZE,
+            len(compressed_bitmap_data),
+        ))
+        for g in glyph_props:
+            out.write(struct.pack("<BBHhhHxxI", g.width, g.height, g.advance_x, g.left, g.top, g.data_length, g.data_offset))
+        offset = 0
+        for i_start, i_end in intervals:
+            out.write(struct.pack("<III", i_start, i_end, offset))
+            offset += i_end - i_start + 1
+        compressed_offset = 0
+        for compressed, uncompressed_size, count, first_idx in compressed_groups:
+            out.write(struct.pack("<IIIHH", compressed_offset, len(compressed), uncompressed_size, count, first_idx))
+            compressed_offset += len(compressed)
+        for g, l, r in latin_lookup:
+            out.write(struct.pack("<HBB", g, l, r))
+        for packed_pair, lig_cp in ligature_pairs:
+            out.write(struct.pack("<II", packed_pair, lig_cp))
+        for cp, cls in kern_left_classes + kern_right_classes:
+            out.write(struct.pack("<HB", cp, cls))
+        out.write(struct.pack(f"<{len(kern_matrix)}b", *kern_matrix))
+        if glyph_groups:
+            out.write(bytes(glyph_groups))
+        out.write(bytes(compressed_bitmap_data))
+    table_bytes = (16 * len(glyph_props) + 12 * len(intervals) + 16 * len(compressed_groups) + 4 * LATIN_LOOKUP_SIZE
+                   + 8 * len(ligature_pairs) + 3 * (len(kern_left_classes) + len(kern_right_classes)) + len(kern_matrix)
+                   + (len(glyph_groups) if glyph_groups else 0))
+    print(f"binary: {args.binary}, {table_bytes} bytes of tables held in RAM", file=sys.stderr)
+    sys.exit(0)
+
 print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
@@ -825,6 +878,12 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+if compress and glyph_groups:
+    print(f"static const uint8_t {font_name}GlyphGroups[{len(glyph_groups)}] = {{")
+    for c in chunks(glyph_groups, 32):
+        print("    " + " ".join(f"{g}," for g in c))
+    print("};\n")
+
 if kern_map:
     print(f"static const EpdKernClassEntry {font_name}KernLeftClasses[] = {{")
     for cp, cls in kern_left_classes:
@@ -849,6 +908,11 @@ if ligature_pairs:
         print(f"    {{ 0x{packed_pair:08X}, 0x{lig_cp:04X} }}, // {cp_label(packed_pair >> 16)} {cp_label(packed_pair & 0xFFFF)} -> {cp_label(lig_cp)}")
     print("};\n")
 
+print(f"static const EpdLatinLookupEntry {font_name}LatinLookup[{LATIN_LOOKUP_SIZE}] = {{")
+for c in chunks(latin_lookup, 8):
+    print("    " + " ".join(f"{{ 0x{g:04X}, {l}, {r} }}," for g, l, r in c))
+print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -886,4 +950,10 @@ if ligature_pairs:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+print(f"    {font_name}LatinLookup,")
+print(f"    nullptr,")
+if compress and glyph_groups:
+    print(f"    {font_name}GlyphGroups,")
+else:
+    print(f"    nullptr,")
 print("};")
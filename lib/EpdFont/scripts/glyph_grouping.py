@@ -0,0 +1,289 @@
+"""
+Glyph grouping for compressed fonts, shared by fontconvert.py and group_page_report.py.
+
+FontDecompressor keeps a few decompressed groups in an LRU cache shared by every face on screen, so how glyphs are
+grouped decides how many groups a page of text inflates. Two groupings are available:
+
+- script_groups: one group per Unicode block, contiguous in the glyph array (the original scheme).
+- corpus_groups: trained on sample text. Glyphs that appear on a noticeable share of pages go into a size-capped hot
+  group per script block, glyphs seen less often are clustered by the pages they share, and glyphs the corpus never
+  uses keep their script-block groups. Members of a group are no longer contiguous, so the font carries a group index
+  per glyph.
+"""
+import html.parser
+import posixpath
+import re
+import zipfile
+from collections import Counter
+
+# Glyphs are in codepoint order, so glyphs in the same Unicode block are contiguous in the array.
+SCRIPT_GROUP_RANGES = [
+    (0x0000, 0x007F),   # ASCII
+    (0x0080, 0x00FF),   # Latin-1 Supplement
+    (0x0100, 0x017F),   # Latin Extended-A
+    (0x0180, 0x024F),   # Latin Extended-B
+    (0x0300, 0x036F),   # Combining Diacritical Marks
+    (0x0400, 0x04FF),   # Cyrillic
+    (0x1EA0, 0x1EF9),   # Vietnamese Extended
+    (0x2000, 0x206F),   # General Punctuation
+    (0x2070, 0x209F),   # Superscripts & Subscripts
+    (0x20A0, 0x20CF),   # Currency Symbols
+    (0x2190, 0x21FF),   # Arrows
+    (0x2200, 0x22FF),   # Math Operators
+    (0xFB00, 0xFB06),   # Alphabetic Presentation Forms (ligatures)
+    (0xFFFD, 0xFFFD),   # Replacement Character
+]
+
+# Groups are indexed with a uint8_t per glyph in corpus-grouped fonts
+MAX_GROUPS = 255
+
+STYLES = ("regular", "bold", "italic", "bolditalic")
+
+# Reader text on the 480x800 panel at the default font size and margins
+DEFAULT_PAGE_CHARS = 1500
+# Glyphs on at least this share of corpus pages go into the hot groups
+DEFAULT_HOT_PAGE_SHARE = 0.05
+# Uncompressed size cap for the hot groups and for the groups clustered from less frequent glyphs
+DEFAULT_GROUP_BYTES = 4096
+# Printable ASCII always goes into the ASCII hot group: a small corpus misses letters every book uses somewhere
+HOT_PRIOR = range(0x21, 0x7F)
+
+
+def script_group_of(code_point):
+    for i, (start, end) in enumerate(SCRIPT_GROUP_RANGES):
+        if start <= code_point <= end:
+            return i
+    return -1
+
+
+def script_groups(code_points):
+    """Contiguous runs of glyph indices sharing a script block."""
+    groups = []
+    current = None
+    for i, cp in enumerate(code_points):
+        sg = script_group_of(cp)
+        if groups and sg == current:
+            groups[-1].append(i)
+        else:
+            groups.append([i])
+            current = sg
+    return groups
+
+
+class _TextExtractor(html.parser.HTMLParser):
+    """Collects (text, style) runs from an XHTML chapter, tracking bold and italic markup."""
+
+    BOLD_TAGS = {"b", "strong", "h1", "h2", "h3", "h4", "h5", "h6", "th"}
+    ITALIC_TAGS = {"i", "em", "cite", "var", "dfn"}
+    SKIP_TAGS = {"head", "script", "style"}
+
+    def __init__(self):
+        super().__init__(convert_charrefs=True)
+        self.runs = []
+        self.stack = []
+
+    def handle_starttag(self, tag, attrs):
+        if tag not in ("br", "img", "hr", "meta", "link"):
+            self.stack.append(tag)
+
+    def handle_endtag(self, tag):
+        if tag in self.stack:
+            while self.stack.pop() != tag:
+                pass
+
+    def handle_data(self, data):
+        if any(t in self.SKIP_TAGS for t in self.stack):
+            return
+        bold = any(t in self.BOLD_TAGS for t in self.stack)
+        italic = any(t in self.ITALIC_TAGS for t in self.stack)
+        self.runs.append((data, STYLES[(1 if bold else 0) + (2 if italic else 0)]))
+
+
+def _epub_chapters(book):
+    """Chapter paths in spine order, or every XHTML file when the package can't be read."""
+    try:
+        container = book.read("META-INF/container.xml").decode("utf-8")
+        opf_path = re.search(r'full-path="([^"]+)"', container).group(1)
+        opf = book.read(opf_path).decode("utf-8")
+        base = posixpath.dirname(opf_path)
+        hrefs = {m.group(1): m.group(2) for m in
+                 re.finditer(r'<item\b[^>]*?\bid="([^"]+)"[^>]*?\bhref="([^"]+)"', opf)}
+        hrefs.update({m.group(2): m.group(1) for m in
+                      re.finditer(r'<item\b[^>]*?\bhref="([^"]+)"[^>]*?\bid="([^"]+)"', opf)})
+        spine = re.findall(r'<itemref\b[^>]*?\bidref="([^"]+)"', opf)
+        return [posixpath.normpath(posixpath.join(base, hrefs[i])) for i in spine if i in hrefs]
+    except (KeyError, AttributeError, UnicodeDecodeError):
+        return sorted(n for n in book.namelist() if n.endswith((".xhtml", ".html", ".htm")))
+
+
+def read_corpus(paths):
+    """(text, style) runs from EPUB files and plain UTF-8 text files (all regular)."""
+    runs = []
+    for path in paths:
+        if path.endswith(".epub"):
+            with zipfile.ZipFile(path) as book:
+                for chapter in _epub_chapters(book):
+                    try:
+                        extractor = _TextExtractor()
+                        extractor.feed(book.read(chapter).decode("utf-8", errors="replace"))
+                        runs.extend(extractor.runs)
+                    except KeyError:
+                        pass
+        else:
+            with open(path, encoding="utf-8", errors="replace") as f:
+                runs.append((f.read(), "regular"))
+    return runs
+
+
+def corpus_pages(runs, page_chars=DEFAULT_PAGE_CHARS):
+    """Splits the corpus into pages of about page_chars characters. Each page is a list of (style, word) in reading
+    order; whitespace is dropped since the renderer never draws it."""
+    pages = []
+    page = []
+    length = 0
+    for text, style in runs:
+        for word in text.split():
+            page.append((style, word))
+            length += len(word) + 1
+            if length >= page_chars:
+                pages.append(page)
+                page = []
+                length = 0
+    if page:
+        pages.append(page)
+    return pages
+
+
+def substitute_ligatures(word, ligatures):
+    """Codepoints the renderer draws for a word, applying the font's ligature pairs left to right the way
+    EpdFont::applyLigatures chains them (f+f -> ff, ff+i -> ffi)."""
+    cps = [ord(c) for c in word]
+    if not ligatures:
+        return cps
+    out = []
+    for cp in cps:
+        while out and (out[-1] << 16 | cp) in ligatures:
+            cp = ligatures[out.pop() << 16 | cp]
+        out.append(cp)
+    return out
+
+
+class GlyphIndexer:
+    """Maps codepoints to glyph indices like EpdFont::getGlyph, falling back to the replacement glyph."""
+
+    def __init__(self, code_points):
+        self.index_of = {cp: i for i, cp in enumerate(code_points)}
+        self.replacement = self.index_of.get(0xFFFD)
+
+    def __call__(self, cp):
+        return self.index_of.get(cp, self.replacement)
+
+
+def page_glyphs(page, code_points, ligatures=None, indexer=None):
+    """Glyph indices drawn for one page, per style, in reading order."""
+    indexer = indexer or GlyphIndexer(code_points)
+    drawn = []
+    for style, word in page:
+        for cp in substitute_ligatures(word, ligatures):
+            glyph = indexer(cp)
+            if glyph is not None:
+                drawn.append((style, glyph))
+    return drawn
+
+
+def corpus_groups(code_points, glyph_bytes, pages, ligatures=None, hot_page_share=DEFAULT_HOT_PAGE_SHARE,
+                  group_bytes=DEFAULT_GROUP_BYTES):
+    """Groups glyph indices for the pages of a training corpus.
+
+    code_points: codepoint of each glyph, in glyph order
+    glyph_bytes: uncompressed bitmap size of each glyph
+    Returns a list of groups, each a sorted list of glyph indices; every glyph is in exactly one group.
+    """
+    indexer = GlyphIndexer(code_points)
+    page_sets = []
+    page_count = Counter()
+    char_count = Counter()
+    for page in pages:
+        glyphs = [g for _style, g in page_glyphs(page, code_points, ligatures, indexer)]
+        char_count.update(glyphs)
+        seen = set(glyphs)
+        page_count.update(seen)
+        page_sets.append(seen)
+
+    # Hot groups: glyphs most pages draw, one group per script block so a page in one script doesn't inflate the
+    # others. Each is capped at group_bytes, or at its HOT_PRIOR glyphs if those are bigger; the most drawn glyphs go
+    # in first and the overflow is left to the warm groups.
+    min_pages = max(1, hot_page_share * len(pages))
+    hot = {}
+    hot_bytes = Counter()
+    for cp in HOT_PRIOR:
+        g = indexer.index_of.get(cp)
+        if g is not None:
+            hot.setdefault(script_group_of(cp), []).append(g)
+            hot_bytes[script_group_of(cp)] += glyph_bytes[g]
+    hot_cap = {block: max(size, group_bytes) for block, size in hot_bytes.items()}
+    prior = {g for members in hot.values() for g in members}
+    for g, n in sorted(page_count.items(), key=lambda item: (-item[1], -char_count[item[0]])):
+        block = script_group_of(code_points[g])
+        if n >= min_pages and g not in prior and hot_bytes[block] + glyph_bytes[g] <= hot_cap.get(block, group_bytes):
+            hot.setdefault(block, []).append(g)
+            hot_bytes[block] += glyph_bytes[g]
+    groups = [sorted(hot[block]) for block in sorted(hot)]
+    assigned = {g for group in groups for g in group}
+
+    # Warm groups: the rest of the glyphs the corpus uses, seeded by frequency and grown with the glyphs sharing the
+    # most pages with the group so far
+    warm = [g for g, _n in char_count.most_common() if g not in assigned]
+    pages_of = {g: set() for g in warm}
+    for p, seen in enumerate(page_sets):
+        for g in seen:
+            if g in pages_of:
+                pages_of[g].add(p)
+    for seed in warm:
+        if seed in assigned:
+            continue
+        group = [seed]
+        assigned.add(seed)
+        size = glyph_bytes[seed]
+        group_pages = set(pages_of[seed])
+        while size < group_bytes:
+            best = None
+            best_shared = 0
+            for g in warm:
+                if g in assigned or size + glyph_bytes[g] > group_bytes:
+                    continue
+                shared = len(pages_of[g] & group_pages)
+                if shared > best_shared:
+                    best, best_shared = g, shared
+            if best is None:
+                break
+            group.append(best)
+            assigned.add(best)
+            size += glyph_bytes[best]
+            group_pages |= pages_of[best]
+        if len(group) > 1:
+            groups.append(sorted(group))
+        else:
+            # Shares no page with anything left: cheaper to leave it with its script block
+            assigned.discard(seed)
+
+    # Cold groups: everything else keeps its script block
+    cold = {}
+    for i, cp in enumerate(code_points):
+        if i not in assigned:
+            cold.setdefault(script_group_of(cp), []).append(i)
+    groups.extend(cold[k] for k in sorted(cold))
+
+    if len(groups) > MAX_GROUPS:
+        raise ValueError(f"{len(groups)} glyph groups, at most {MAX_GROUPS} can be indexed")
+    return groups
+
+
+def is_contiguous(groups):
+    """True when every group is a run of consecutive glyph indices in order, so no per-glyph group map is needed."""
+    expected = 0
+    for group in groups:
+        if group != list(range(expected, expected + len(group))):
+            return False
+        expected += len(group)
+    return True
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Reports how many glyph-group bytes FontDecompressor inflates per page of text, for each compressed built-in font
+family as generated and regrouped with fontconvert.py --group-corpus.
+
+Pages are cut from a text corpus (EPUB or UTF-8 text files) and drawn with the family's regular, bold, italic and
+bold italic faces as the markup asks. The simulation replays FontDecompressor: one LRU cache of CACHE_SLOTS groups
+shared by all faces, each page drawn once per render pass (black and white, then the two grayscale passes with text
+anti-aliasing on) and the cache cleared after the page like EpubReaderActivity does.
+
+Usage: group_page_report.py [options] CORPUS...
+  e.g. python group_page_report.py ../../../test/epubs/*.epub
+"""
+import argparse
+import os
+import re
+import sys
+import zlib
+
+from glyph_grouping import (DEFAULT_GROUP_BYTES, DEFAULT_HOT_PAGE_SHARE, DEFAULT_PAGE_CHARS, STYLES, GlyphIndexer,
+                            corpus_groups, corpus_pages, page_glyphs, read_corpus)
+from verify_compression import parse_glyphs, parse_groups, parse_hex_array
+
+# FontDecompressor::CACHE_SLOTS
+CACHE_SLOTS = 4
+
+
+def parse_array(content, font_name, ctype, suffix):
+    match = re.search(r'static const ' + ctype + r' ' + re.escape(font_name + suffix) + r'\[\d*\]\s*=\s*\{(.+?)\};',
+                      content, re.DOTALL)
+    return match.group(1) if match else None
+
+
+class Font:
+    """A compressed face parsed back out of its generated header."""
+
+    def __init__(self, path):
+        with open(path) as f:
+            content = f.read()
+        self.name = re.search(r'static const EpdFontGroup (\w+)Groups\[\]', content).group(1)
+        bitmap = parse_hex_array(parse_array(content, self.name, 'uint8_t', 'Bitmaps'))
+        self.groups = parse_groups(parse_array(content, self.name, 'EpdFontGroup', 'Groups'))
+        glyphs = parse_glyphs(parse_array(content, self.name, 'EpdGlyph', 'Glyphs'))
+
+        self.code_points = []
+        for first, last in re.findall(r'\{\s*0x([0-9A-F]+),\s*0x([0-9A-F]+),\s*0x[0-9A-F]+\s*\}',
+                                      parse_array(content, self.name, 'EpdUnicodeInterval', 'Intervals')):
+            self.code_points.extend(range(int(first, 16), int(last, 16) + 1))
+        ligature_text = parse_array(content, self.name, 'EpdLigaturePair', 'LigaturePairs') or ''
+        self.ligatures = {int(pair, 16): int(lig, 16) for pair, lig in
+                          re.findall(r'\{\s*0x([0-9A-F]+),\s*0x([0-9A-F]+)\s*\}', ligature_text)}
+        map_text = parse_array(content, self.name, 'uint8_t', 'GlyphGroups')
+        self.group_of = [int(v) for v in re.findall(r'\d+', map_text)] if map_text else None
+
+        # Uncompressed bitmap of every glyph, cut out of its inflated group
+        if self.group_of is None:
+            self.group_of = [0] * len(glyphs)
+            for gi, group in enumerate(self.groups):
+                for i in range(group['firstGlyphIndex'], group['firstGlyphIndex'] + group['glyphCount']):
+                    self.group_of[i] = gi
+        inflated = [zlib.decompress(bitmap[g['compressedOffset']:g['compressedOffset'] + g['compressedSize']], -15)
+                    for g in self.groups]
+        self.glyph_data = [inflated[self.group_of[i]][g['dataOffset']:g['dataOffset'] + g['dataLength']]
+                           for i, g in enumerate(glyphs)]
+        self.indexer = GlyphIndexer(self.code_points)
+
+    def current_grouping(self):
+        return Grouping(self.group_of, [g['uncompressedSize'] for g in self.groups])
+
+    def compressed_size(self):
+        return sum(g['compressedSize'] for g in self.groups)
+
+    def regroup(self, groups):
+        group_of = [0] * len(self.glyph_data)
+        sizes = []
+        compressed = 0
+        for gi, members in enumerate(groups):
+            data = b''.join(self.glyph_data[i] for i in members)
+            for i in members:
+                group_of[i] = gi
+            sizes.append(len(data))
+            compressor = zlib.compressobj(level=9, wbits=-15)
+            compressed += len(compressor.compress(data) + compressor.flush())
+        return Grouping(group_of, sizes), compressed
+
+
+class Grouping:
+    def __init__(self, group_of, group_sizes):
+        self.group_of = group_of
+        self.group_sizes = group_sizes
+
+
+def simulate(faces, groupings, pages, passes, slots):
+    """Average inflated bytes, inflations and distinct groups per page for one grouping of every face."""
+    inflated_bytes = 0
+    inflations = 0
+    touched = 0
+    for page in pages:
+        drawn = []
+        for style, word in page:
+            face = style if style in faces else 'regular'
+            font = faces[face]
+            drawn.extend((face, g) for _s, g in page_glyphs([(face, word)], font.code_points, font.ligatures,
+                                                             font.indexer))
+        keys = [(face, groupings[face].group_of[g]) for face, g in drawn]
+        touched += len(set(keys))
+        cache = []  # (style, group) keys, most recently used last
+        for _ in range(passes):
+            for key in keys:
+                if key in cache:
+                    cache.remove(key)
+                else:
+                    inflations += 1
+                    inflated_bytes += groupings[key[0]].group_sizes[key[1]]
+                    if len(cache) >= slots:
+                        cache.pop(0)
+                cache.append(key)
+    n = max(1, len(pages))
+    return inflated_bytes / n, inflations / n, touched / n
+
+
+def find_families(fonts_dir, only):
+    families = []
+    for name in sorted(os.listdir(fonts_dir)):
+        if not name.endswith('_regular.h'):
+            continue
+        family = name[:-len('_regular.h')]
+        if only and not any(family.startswith(prefix) for prefix in only):
+            continue
+        with open(os.path.join(fonts_dir, name)) as f:
+            if 'EpdFontGroup' not in f.read():
+                continue
+        families.append(family)
+    return families
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Report glyph-group bytes inflated per page, before and after "
+                                                 "corpus-trained grouping.")
+    parser.add_argument("corpus", nargs='+', help="EPUB or UTF-8 text files to train the grouping on.")
+    parser.add_argument("--eval", dest="eval_corpus", nargs='+', help="Files to measure on (default: the training "
+                                                                     "corpus).")
+    parser.add_argument("--fonts-dir", default=os.path.join(here, "..", "builtinFonts"))
+    parser.add_argument("--font", dest="fonts", action="append", help="Only families starting with this prefix, "
+                                                                      "e.g. bookerly_14. Can be repeated.")
+    parser.add_argument("--page-chars", type=int, default=DEFAULT_PAGE_CHARS)
+    parser.add_argument("--passes", type=int, default=3, help="Render passes per page (3 with text anti-aliasing).")
+    parser.add_argument("--hot-page-share", type=float, default=DEFAULT_HOT_PAGE_SHARE)
+    parser.add_argument("--group-bytes", type=int, default=DEFAULT_GROUP_BYTES)
+    args = parser.parse_args()
+
+    train_pages = corpus_pages(read_corpus(args.corpus), args.page_chars)
+    eval_pages = corpus_pages(read_corpus(args.eval_corpus), args.page_chars) if args.eval_corpus else train_pages
+    print(f"{len(train_pages)} training pages, {len(eval_pages)} evaluation pages of ~{args.page_chars} characters, "
+          f"{args.passes} render pass(es), {CACHE_SLOTS} cache slots\n")
+    print(f"{'family':<16} {'groups':>9} {'inflated/page':>17} {'inflations/page':>17} {'groups/page':>13} "
+          f"{'flash bytes':>15}")
+
+    totals = [0.0, 0.0]
+    families = find_families(args.fonts_dir, args.fonts)
+    for family in families:
+        faces = {}
+        for style in STYLES:
+            path = os.path.join(args.fonts_dir, f"{family}_{style}.h")
+            if os.path.exists(path):
+                faces[style] = Font(path)
+        before = {style: font.current_grouping() for style, font in faces.items()}
+        after = {}
+        flash_before = sum(font.compressed_size() for font in faces.values())
+        flash_after = 0
+        for style, font in faces.items():
+            sizes = [len(d) for d in font.glyph_data]
+            groups = corpus_groups(font.code_points, sizes, train_pages, font.ligatures, args.hot_page_share,
+                                   args.group_bytes)
+            after[style], compressed = font.regroup(groups)
+            flash_after += compressed
+
+        b = simulate(faces, before, eval_pages, args.passes, CACHE_SLOTS)
+        a = simulate(faces, after, eval_pages, args.passes, CACHE_SLOTS)
+        totals[0] += b[0]
+        totals[1] += a[0]
+        print(f"{family:<16} {len(before['regular'].group_sizes):>4}->{len(after['regular'].group_sizes):<4} "
+              f"{b[0]:>8.0f}->{a[0]:<8.0f} {b[1]:>8.2f}->{a[1]:<8.2f} {b[2]:>6.2f}->{a[2]:<6.2f} "
+              f"{flash_before:>7}->{flash_after:<7}")
+
+    if families:
+        n = len(families)
+        print(f"\nMean inflated bytes per page: {totals[0] / n:.0f} -> {totals[1] / n:.0f} "
+              f"({100 * (totals[1] - totals[0]) / max(1, totals[0]):+.1f}%)")
+
+
+if __name__ == '__main__':
+    sys.exit(main())
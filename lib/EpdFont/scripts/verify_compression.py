@@ -92,6 +92,22 @@ def verify_font_file(filepath):
 
     glyphs = parse_glyphs(glyphs_match.group(1))
 
+    # Corpus-grouped fonts (fontconvert.py --group-corpus) list each glyph's group instead of using ranges
+    members = [list(range(g['firstGlyphIndex'], g['firstGlyphIndex'] + g['glyphCount'])) for g in groups]
+    glyph_groups_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'GlyphGroups\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    if glyph_groups_match:
+        glyph_groups = [int(v) for v in re.findall(r'\d+', glyph_groups_match.group(1))]
+        if len(glyph_groups) != len(glyphs):
+            return (font_name, False, f"GlyphGroups has {len(glyph_groups)} entries for {len(glyphs)} glyphs")
+        members = [[] for _ in groups]
+        for glyph_idx, gi in enumerate(glyph_groups):
+            if gi >= len(groups):
+                return (font_name, False, f"glyph {glyph_idx}: group {gi} out of range")
+            members[gi].append(glyph_idx)
+
     # Verify each group
     for gi, group in enumerate(groups):
         # Extract compressed chunk
@@ -108,10 +124,11 @@ def verify_font_file(filepath):
         if len(decompressed) != group['uncompressedSize']:
             return (font_name, False, f"group {gi}: size mismatch (expected {group['uncompressedSize']}, got {len(decompressed)})")
 
+        if len(members[gi]) != group['glyphCount']:
+            return (font_name, False, f"group {gi}: {len(members[gi])} glyphs mapped, expected {group['glyphCount']}")
+
         # Verify each glyph's data within the group
-        first = group['firstGlyphIndex']
-        for j in range(group['glyphCount']):
-            glyph_idx = first + j
+        for glyph_idx in members[gi]:
             if glyph_idx >= len(glyphs):
                 return (font_name, False, f"group {gi}: glyph index {glyph_idx} out of range")
 
@@ -13,6 +13,23 @@ constexpr uint8_t BOOK_CACHE_VERSION = 5;
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+
+// FNV-1a of the last path component, the part href resolution compares
+uint32_t fileNameHash(const std::string& href) {
+  const size_t slash = href.find_last_of('/');
+  uint32_t hash = 2166136261u;
+  for (size_t i = slash == std::string::npos ? 0 : slash + 1; i < href.size(); i++) {
+    hash ^= static_cast<uint8_t>(href[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool sameFileName(const std::string& href, const std::string& fileName) {
+  const size_t slash = href.find_last_of('/');
+  const size_t start = slash == std::string::npos ? 0 : slash + 1;
+  return href.size() - start == fileName.size() && href.compare(start, std::string::npos, fileName) == 0;
+}
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
@@ -390,6 +407,114 @@ bool BookMetadataCache::load() {
   return true;
 }
 
+bool BookMetadataCache::ensureSpineTable() {
+  if (spineTableLoaded) {
+    return true;
+  }
+  if (!loaded) {
+    return false;
+  }
+
+  spineTable.resize(spineCount);
+  spineByFileName.resize(spineCount);
+  spineHrefOffsets.resize(spineCount);
+  tocSpineIndex.resize(tocCount);
+  spineHrefPool.clear();
+  bool poolHrefs = true;
+
+  // Spine entries, then TOC entries, are stored back to back after the LUTs, so this is one sequential read
+  bookFile.seek(lutOffset);
+  uint32_t firstEntryPos = 0;
+  serialization::readPod(bookFile, firstEntryPos);
+  bookFile.seek(firstEntryPos);
+  for (int i = 0; i < spineCount; i++) {
+    const auto entry = readSpineEntry(bookFile);
+    spineTable[i] = {static_cast<uint32_t>(entry.cumulativeSize), fileNameHash(entry.href), entry.tocIndex};
+    spineByFileName[i] = static_cast<uint16_t>(i);
+    if (poolHrefs && spineHrefPool.size() + entry.href.size() + 1 <= SPINE_HREF_POOL_BUDGET) {
+      spineHrefOffsets[i] = static_cast<uint32_t>(spineHrefPool.size());
+      spineHrefPool.append(entry.href.c_str(), entry.href.size() + 1);
+    } else {
+      poolHrefs = false;
+    }
+  }
+  for (int i = 0; i < tocCount; i++) {
+    tocSpineIndex[i] = readTocEntry(bookFile).spineIndex;
+  }
+
+  if (!poolHrefs) {
+    LOG_DBG("BMC", "Spine hrefs exceed %u bytes, reading them from book.bin",
+            static_cast<unsigned>(SPINE_HREF_POOL_BUDGET));
+    spineHrefPool.clear();
+    spineHrefPool.shrink_to_fit();
+    spineHrefOffsets.clear();
+    spineHrefOffsets.shrink_to_fit();
+  } else {
+    spineHrefPool.shrink_to_fit();
+  }
+
+  std::sort(spineByFileName.begin(), spineByFileName.end(), [this](const uint16_t a, const uint16_t b) {
+    return spineTable[a].fileNameHash < spineTable[b].fileNameHash ||
+           (spineTable[a].fileNameHash == spineTable[b].fileNameHash && a < b);
+  });
+
+  spineTableLoaded = true;
+  LOG_DBG("BMC", "Spine table loaded: %d spine, %d TOC entries, %u href bytes", spineCount, tocCount,
+          static_cast<unsigned>(spineHrefPool.size()));
+  return true;
+}
+
+std::string BookMetadataCache::readSpineHref(const int index) {
+  if (!spineHrefOffsets.empty()) {
+    return std::string(spineHrefPool.c_str() + spineHrefOffsets[index]);
+  }
+  bookFile.seek(lutOffset + sizeof(uint32_t) * index);
+  uint32_t spineEntryPos;
+  serialization::readPod(bookFile, spineEntryPos);
+  bookFile.seek(spineEntryPos);
+  return readSpineEntry(bookFile).href;
+}
+
+size_t BookMetadataCache::getSpineCumulativeSize(const int index) {
+  if (index < 0 || index >= static_cast<int>(spineCount) || !ensureSpineTable()) {
+    return 0;
+  }
+  return spineTable[index].cumulativeSize;
+}
+
+int16_t BookMetadataCache::getSpineTocIndex(const int index) {
+  if (index < 0 || index >= static_cast<int>(spineCount) || !ensureSpineTable()) {
+    return -1;
+  }
+  return spineTable[index].tocIndex;
+}
+
+int16_t BookMetadataCache::getTocSpineIndex(const int index) {
+  if (index < 0 || index >= static_cast<int>(tocCount) || !ensureSpineTable()) {
+    return -1;
+  }
+  return tocSpineIndex[index];
+}
+
+int BookMetadataCache::findSpineIndexByFileName(const std::string& fileName) {
+  if (!ensureSpineTable()) {
+    return -1;
+  }
+
+  const uint32_t target = fileNameHash(fileName);
+  auto it = std::lower_bound(spineByFileName.begin(), spineByFileName.end(), target,
+                             [this](const uint16_t index, const uint32_t hash) {
+                               return spineTable[index].fileNameHash < hash;
+                             });
+  // Candidates sharing the hash are in spine order, the first real match wins
+  for (; it != spineByFileName.end() && spineTable[*it].fileNameHash == target; ++it) {
+    if (sameFileName(readSpineHref(*it), fileName)) {
+      return *it;
+    }
+  }
+  return -1;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     LOG_ERR("BMC", "getSpineEntry called but cache not loaded");
@@ -401,6 +526,11 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
     return {};
   }
 
+  if (ensureSpineTable()) {
+    const auto& entry = spineTable[index];
+    return SpineEntry(readSpineHref(index), entry.cumulativeSize, entry.tocIndex);
+  }
+
   // Seek to spine LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * index);
   uint32_t spineEntryPos;
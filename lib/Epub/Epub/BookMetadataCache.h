@@ -66,6 +66,23 @@ class BookMetadataCache {
 
   static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
 
+  // Resident spine table, built on first use after load() so progress, href resolution and TOC lookups don't seek
+  // into book.bin and allocate an href string on every call. 14 bytes per spine item and 2 per TOC item; hrefs are
+  // pooled as well while they fit SPINE_HREF_POOL_BUDGET, otherwise they are still read from book.bin on demand.
+  struct SpineTableEntry {
+    uint32_t cumulativeSize;
+    uint32_t fileNameHash;  // FNV-1a of the href's last path component
+    int16_t tocIndex;
+  };
+  std::vector<SpineTableEntry> spineTable;
+  std::vector<uint16_t> spineByFileName;  // spine indices sorted by fileNameHash
+  std::vector<uint32_t> spineHrefOffsets;  // start of each href in spineHrefPool (only when pooled)
+  std::string spineHrefPool;               // NUL-terminated hrefs back to back
+  std::vector<int16_t> tocSpineIndex;
+  bool spineTableLoaded = false;
+
+  static constexpr size_t SPINE_HREF_POOL_BUDGET = 16 * 1024;
+
   // FNV-1a 64-bit hash function
   static uint64_t fnvHash64(const std::string& s) {
     uint64_t hash = 14695981039346656037ull;
@@ -80,6 +97,8 @@ class BookMetadataCache {
   uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
   SpineEntry readSpineEntry(FsFile& file) const;
   TocEntry readTocEntry(FsFile& file) const;
+  bool ensureSpineTable();
+  std::string readSpineHref(int index);
 
  public:
   BookMetadata coreMetadata;
@@ -106,6 +125,11 @@ class BookMetadataCache {
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  size_t getSpineCumulativeSize(int index);
+  int16_t getSpineTocIndex(int index);
+  int16_t getTocSpineIndex(int index);
+  // First spine index whose href ends in the same file name as `fileName`, or -1
+  int findSpineIndexByFileName(const std::string& fileName);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
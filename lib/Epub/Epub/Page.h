@@ -12,6 +12,7 @@
 enum PageElementTag : uint8_t {
   TAG_PageLine = 1,
   TAG_PageImage = 2,  // New tag
+  TAG_PageRule = 3,
 };
 
 // represents something that has been added to a page
@@ -54,6 +55,20 @@ class PageImage final : public PageElement {
   const ImageBlock& getImageBlock() const { return *imageBlock; }
 };
 
+// a solid rectangle, used for the rules between table rows
+class PageRule final : public PageElement {
+  int16_t width;
+  int16_t height;
+
+ public:
+  PageRule(const int16_t xPos, const int16_t yPos, const int16_t width, const int16_t height)
+      : PageElement(xPos, yPos), width(width), height(height) {}
+  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
+  bool serialize(FsFile& file) override;
+  PageElementTag getTag() const override { return TAG_PageRule; }
+  static std::unique_ptr<PageRule> deserialize(FsFile& file);
+};
+
 class Page {
  public:
   // the list of block index and line numbers on this page
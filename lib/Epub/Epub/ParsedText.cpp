@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <vector>
 
+#include "WordWidthCache.h"
 #include "hyphenation/Hyphenator.h"
+#include "linebreak/LineBreakSegmenter.h"
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
 
@@ -54,11 +58,8 @@ void stripSoftHyphensInPlace(std::string& word) {
 // Returns the advance width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
 // Uses advance width (sum of glyph advances + kerning) rather than bounding box width so that italic glyph overhangs
 // don't inflate inter-word spacing.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
-    return renderer.getSpaceWidth(fontId, style);
-  }
+uint16_t measureUncached(const GfxRenderer& renderer, const int fontId, const std::string& word,
+                         const EpdFontFamily::Style style, const bool appendHyphen) {
   const bool hasSoftHyphen = containsSoftHyphen(word);
   if (!hasSoftHyphen && !appendHyphen) {
     return renderer.getTextAdvanceX(fontId, word.c_str(), style);
@@ -74,19 +75,107 @@ uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const s
   return renderer.getTextAdvanceX(fontId, sanitized.c_str(), style);
 }
 
+// Same as measureUncached, but answered from the section-wide width cache when one is attached.
+uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
+                          const EpdFontFamily::Style style, WordWidthCache* cache, const bool appendHyphen = false) {
+  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
+    return renderer.getSpaceWidth(fontId, style);
+  }
+  if (!cache) {
+    return measureUncached(renderer, fontId, word, style, appendHyphen);
+  }
+
+  // Key on the raw word (soft hyphens included) plus a trailing NUL marker when a hyphen is appended.
+  char key[WordWidthCache::MAX_WORD_BYTES];
+  const size_t keyLen = word.size() + (appendHyphen ? 1 : 0);
+  if (keyLen > sizeof(key)) {
+    return measureUncached(renderer, fontId, word, style, appendHyphen);
+  }
+  memcpy(key, word.data(), word.size());
+  if (appendHyphen) {
+    key[word.size()] = '\0';  // words never contain NUL, so this cannot collide with a real word
+  }
+
+  uint16_t width;
+  if (cache->lookup(fontId, key, keyLen, style, width)) {
+    return width;
+  }
+  width = measureUncached(renderer, fontId, word, style, appendHyphen);
+  cache->store(fontId, key, keyLen, style, width);
+  return width;
+}
+
 }  // namespace
 
 void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
-                         const bool attachToPrevious) {
+                         const bool attachToPrevious, const bool joinPrevious) {
   if (word.empty()) return;
 
-  words.push_back(std::move(word));
   EpdFontFamily::Style combinedStyle = fontStyle;
   if (underline) {
     combinedStyle = static_cast<EpdFontFamily::Style>(combinedStyle | EpdFontFamily::UNDERLINE);
   }
+
+  // CJK and Thai runs carry no spaces between words. Split them at their break opportunities so the line breaker
+  // sees one segment per ideograph / Thai word instead of a single oversized word it would have to hyphenate.
+  //
+  // Example: "日本語の本" -> "日" "本" "語" "の" "本", all but the first joined (no gap, breakable)
+  if (LineBreakSegmenter::needsSegmentation(word)) {
+    const auto offsets = LineBreakSegmenter::breakOffsets(word);
+    size_t start = 0;
+    for (const size_t offset : offsets) {
+      words.push_back(word.substr(start, offset - start));
+      wordStyles.push_back(combinedStyle);
+      wordContinues.push_back(start == 0 && attachToPrevious);
+      wordJoins.push_back(start != 0 || joinPrevious);
+      start = offset;
+    }
+    if (start > 0) {
+      word.erase(0, start);
+      words.push_back(std::move(word));
+      wordStyles.push_back(combinedStyle);
+      wordContinues.push_back(false);
+      wordJoins.push_back(true);
+      return;
+    }
+  }
+
+  words.push_back(std::move(word));
   wordStyles.push_back(combinedStyle);
   wordContinues.push_back(attachToPrevious);
+  wordJoins.push_back(joinPrevious);
+}
+
+void ParsedText::appendWords(ParsedText& other) {
+  words.insert(words.end(), std::make_move_iterator(other.words.begin()), std::make_move_iterator(other.words.end()));
+  wordStyles.insert(wordStyles.end(), other.wordStyles.begin(), other.wordStyles.end());
+  wordContinues.insert(wordContinues.end(), other.wordContinues.begin(), other.wordContinues.end());
+  wordJoins.insert(wordJoins.end(), other.wordJoins.begin(), other.wordJoins.end());
+  other.words.clear();
+  other.wordStyles.clear();
+  other.wordContinues.clear();
+  other.wordJoins.clear();
+}
+
+// Gaps are measured the way computeLineBreaks() adds them, so a block given its maxWidth stays on one line
+void ParsedText::measureContentWidths(const GfxRenderer& renderer, const int fontId, int& minWidth, int& maxWidth) {
+  const int spaceWidth = renderer.getSpaceWidth(fontId, EpdFontFamily::REGULAR);
+  minWidth = 0;
+  maxWidth = 0;
+  int run = 0;
+  for (size_t i = 0; i < words.size(); ++i) {
+    const int width = measureWordWidth(renderer, fontId, words[i], wordStyles[i], widthCache);
+    int gap = 0;
+    if (i > 0 && !wordContinues[i] && !wordJoins[i]) {
+      gap = spaceWidth + renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[i - 1]), firstCodepoint(words[i]),
+                                                     wordStyles[i - 1]);
+    } else if (i > 0) {
+      gap = renderer.getKerning(fontId, lastCodepoint(words[i - 1]), firstCodepoint(words[i]), wordStyles[i - 1]);
+    }
+    maxWidth += gap + width;
+    run = i > 0 && wordContinues[i] ? run + gap + width : width;
+    minWidth = std::max(minWidth, run);
+  }
 }
 
 // Consumes data to minimize memory usage
@@ -123,6 +212,7 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
     words.erase(words.begin(), words.begin() + consumed);
     wordStyles.erase(wordStyles.begin(), wordStyles.begin() + consumed);
     wordContinues.erase(wordContinues.begin(), wordContinues.begin() + consumed);
+    wordJoins.erase(wordJoins.begin(), wordJoins.begin() + consumed);
   }
 }
 
@@ -131,7 +221,7 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   wordWidths.reserve(words.size());
 
   for (size_t i = 0; i < words.size(); ++i) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, words[i], wordStyles[i]));
+    wordWidths.push_back(measureWordWidth(renderer, fontId, words[i], wordStyles[i], widthCache));
   }
 
   return wordWidths;
@@ -186,12 +276,12 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     for (size_t j = i; j < totalWordCount; ++j) {
       // Add space before word j, unless it's the first word on the line or a continuation
       int gap = 0;
-      if (j > static_cast<size_t>(i) && !continuesVec[j]) {
+      if (j > static_cast<size_t>(i) && !continuesVec[j] && !wordJoins[j]) {
         gap = spaceWidth;
         gap += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]),
                                            wordStyles[j - 1]);
-      } else if (j > static_cast<size_t>(i) && continuesVec[j]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
+      } else if (j > static_cast<size_t>(i)) {
+        // Cross-boundary kerning for continuation and joined words (e.g. nonbreaking spaces, CJK segments)
         gap = renderer.getKerning(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]), wordStyles[j - 1]);
       }
       currlen += wordWidths[j] + gap;
@@ -303,12 +393,12 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     while (currentIndex < wordWidths.size()) {
       const bool isFirstWord = currentIndex == lineStart;
       int spacing = 0;
-      if (!isFirstWord && !continuesVec[currentIndex]) {
+      if (!isFirstWord && !continuesVec[currentIndex] && !wordJoins[currentIndex]) {
         spacing = spaceWidth;
         spacing += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[currentIndex - 1]),
                                                firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
-      } else if (!isFirstWord && continuesVec[currentIndex]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
+      } else if (!isFirstWord) {
+        // Cross-boundary kerning for continuation and joined words (e.g. nonbreaking spaces, CJK segments)
         spacing = renderer.getKerning(fontId, lastCodepoint(words[currentIndex - 1]),
                                       firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
       }
@@ -367,38 +457,18 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   const std::string& word = words[wordIndex];
   const auto style = wordStyles[wordIndex];
 
-  // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
-    return false;
-  }
-
-  size_t chosenOffset = 0;
+  // Retain the widest prefix, over every legal breakpoint, that still fits.
+  Hyphenator::BreakInfo chosen{};
   int chosenWidth = -1;
-  bool chosenNeedsHyphen = true;
-
-  // Iterate over each legal breakpoint and retain the widest prefix that still fits.
-  for (const auto& info : breakInfos) {
-    const size_t offset = info.byteOffset;
-    if (offset == 0 || offset >= word.size()) {
-      continue;
-    }
-
-    const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
-    if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
-      continue;  // Skip if too wide or not an improvement
-    }
-
-    chosenWidth = prefixWidth;
-    chosenOffset = offset;
-    chosenNeedsHyphen = needsHyphen;
-  }
-
-  if (chosenWidth < 0) {
+  const auto measurePrefix = [&](const size_t offset, const bool withHyphen) {
+    return measureWordWidth(renderer, fontId, word.substr(0, offset), style, widthCache, withHyphen);
+  };
+  if (!Hyphenator::widestFittingBreak(word, allowFallbackBreaks, availableWidth, measurePrefix, chosen, chosenWidth)) {
     // No hyphenation point produced a prefix that fits in the remaining space.
     return false;
   }
+  const size_t chosenOffset = chosen.byteOffset;
+  const bool chosenNeedsHyphen = chosen.requiresInsertedHyphen;
 
   // Split the word at the selected breakpoint and append a hyphen if required.
   std::string remainder = word.substr(chosenOffset);
@@ -432,10 +502,11 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   // line, while "kilometer" moves to the next line.
   // wordContinues[wordIndex] is intentionally left unchanged — the prefix keeps its original attachment.
   wordContinues.insert(wordContinues.begin() + wordIndex + 1, false);
+  wordJoins.insert(wordJoins.begin() + wordIndex + 1, false);
 
   // Update cached widths to reflect the new prefix/remainder pairing.
   wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
+  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style, widthCache);
   wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
   return true;
 }
@@ -469,15 +540,15 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
     // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
+    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx] && !wordJoins[lastBreakAt + wordIdx]) {
       actualGapCount++;
       int naturalGap = spaceWidth;
       naturalGap += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
                                                 firstCodepoint(words[lastBreakAt + wordIdx]),
                                                 wordStyles[lastBreakAt + wordIdx - 1]);
       totalNaturalGaps += naturalGap;
-    } else if (wordIdx > 0 && continuesVec[lastBreakAt + wordIdx]) {
-      // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
+    } else if (wordIdx > 0) {
+      // Cross-boundary kerning for continuation and joined words (e.g. nonbreaking spaces, CJK segments)
       totalNaturalGaps +=
           renderer.getKerning(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
                               firstCodepoint(words[lastBreakAt + wordIdx]), wordStyles[lastBreakAt + wordIdx - 1]);
@@ -511,7 +582,8 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineXPos.push_back(xpos);
 
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
+    const size_t next = lastBreakAt + wordIdx + 1;
+    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && (continuesVec[next] || wordJoins[next]);
     if (nextIsContinuation) {
       int advance = wordWidths[lastBreakAt + wordIdx];
       // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
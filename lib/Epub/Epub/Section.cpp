@@ -1,19 +1,28 @@
 #include "Section.h"
 
 #include <HalStorage.h>
+#include <HeapTelemetry.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "SectionAnchor.h"
+#include "WordWidthCache.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 17;
+constexpr uint8_t SECTION_FILE_VERSION = 20;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint8_t) + sizeof(uint32_t);
+constexpr uint32_t ANCHOR_RECORD_SIZE = sizeof(uint32_t) + sizeof(uint16_t);
+// Upper bound on recorded ids per section; books that put an id on every paragraph would otherwise grow the table
+// without limit while the section is being laid out
+constexpr size_t MAX_SECTION_ANCHORS = 2048;
 }  // namespace
 
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
@@ -134,7 +143,9 @@ bool Section::clearCache() const {
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const uint8_t imageRendering, const std::function<void()>& popupFn) {
+                                const uint8_t imageRendering, const std::function<void()>& popupFn,
+                                const std::function<void(int percent)>& progressFn) {
+  HeapTelemetry::Scope heapScope(HeapTelemetry::INDEXING);
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
@@ -202,13 +213,28 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     }
   }
 
+  // Shared by every paragraph of this section so repeated words are only measured once
+  WordWidthCache widthCache(fontId);
+  std::vector<SectionAnchor> anchors;
   ChapterHtmlSlimParser visitor(
       epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight, hyphenationEnabled,
       [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, cssParser);
+      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, cssParser, &widthCache,
+      [this, &anchors](const uint32_t anchorHash) {
+        // Anchors are reported once the page they land on is the one being filled, i.e. page number pageCount
+        if (anchors.size() < MAX_SECTION_ANCHORS) {
+          anchors.push_back({anchorHash, pageCount});
+        }
+      },
+      progressFn);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
   success = visitor.parseAndBuildPages();
+  LOG_DBG("SCT", "Word width cache: %u hits, %u misses", static_cast<unsigned>(widthCache.getHits()),
+          static_cast<unsigned>(widthCache.getMisses()));
+  [[maybe_unused]] const auto memoStats = Hyphenator::memoStats();
+  LOG_DBG("SCT", "Hyphenation memo: %u hits, %u misses, %u evictions", static_cast<unsigned>(memoStats.hits),
+          static_cast<unsigned>(memoStats.misses), static_cast<unsigned>(memoStats.evictions));
 
   Storage.remove(tmpHtmlPath.c_str());
   if (!success) {
@@ -239,6 +265,20 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     return false;
   }
 
+  // Anchor table follows the LUT, sorted by hash for binary search. Duplicate ids keep their first page.
+  std::sort(anchors.begin(), anchors.end(), [](const SectionAnchor& a, const SectionAnchor& b) {
+    return a.hash < b.hash || (a.hash == b.hash && a.page < b.page);
+  });
+  anchors.erase(std::unique(anchors.begin(), anchors.end(),
+                            [](const SectionAnchor& a, const SectionAnchor& b) { return a.hash == b.hash; }),
+                anchors.end());
+  serialization::writePod(file, static_cast<uint32_t>(anchors.size()));
+  for (const auto& anchor : anchors) {
+    serialization::writePod(file, anchor.hash);
+    serialization::writePod(file, anchor.page);
+  }
+  LOG_DBG("SCT", "Anchor table: %u entries", static_cast<unsigned>(anchors.size()));
+
   // Go back and write LUT offset
   file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
   serialization::writePod(file, pageCount);
@@ -267,3 +307,49 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.close();
   return page;
 }
+
+int Section::findAnchorPage(const std::string& anchor) {
+  if (anchor.empty() || !Storage.openFileForRead("SCT", filePath, file)) {
+    return -1;
+  }
+
+  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  uint32_t lutOffset;
+  serialization::readPod(file, lutOffset);
+  const uint32_t tableOffset = lutOffset + sizeof(uint32_t) * pageCount;
+  file.seek(tableOffset);
+  uint32_t count = 0;
+  serialization::readPod(file, count);
+  if (tableOffset + sizeof(uint32_t) + static_cast<size_t>(count) * ANCHOR_RECORD_SIZE > file.fileSize()) {
+    LOG_ERR("SCT", "Anchor table truncated");
+    file.close();
+    return -1;
+  }
+
+  // Binary search straight from the file, one small read per probe
+  const uint32_t target = SectionAnchor::hashId(anchor.c_str(), anchor.size());
+  const uint32_t recordsOffset = tableOffset + sizeof(uint32_t);
+  uint32_t low = 0;
+  uint32_t high = count;
+  int page = -1;
+  while (low < high) {
+    const uint32_t mid = low + (high - low) / 2;
+    file.seek(recordsOffset + mid * ANCHOR_RECORD_SIZE);
+    uint32_t hash;
+    serialization::readPod(file, hash);
+    if (hash == target) {
+      uint16_t anchorPage;
+      serialization::readPod(file, anchorPage);
+      page = anchorPage < pageCount ? anchorPage : -1;
+      break;
+    }
+    if (hash < target) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  file.close();
+  LOG_DBG("SCT", "Anchor #%s -> page %d", anchor.c_str(), page);
+  return page;
+}
@@ -35,6 +35,9 @@ class Section {
   bool clearCache() const;
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
-                         uint8_t imageRendering, const std::function<void()>& popupFn = nullptr);
+                         uint8_t imageRendering, const std::function<void()>& popupFn = nullptr,
+                         const std::function<void(int percent)>& progressFn = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Page the element with id `anchor` lands on, or -1 if the section has no such anchor
+  int findAnchorPage(const std::string& anchor);
 };
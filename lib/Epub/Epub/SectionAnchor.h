@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// One entry of the anchor table stored after the page LUT of a section file: the page an element id lands on. Ids
+// are kept as 32-bit FNV-1a hashes so the table has fixed-size records and can be binary searched in place.
+struct SectionAnchor {
+  uint32_t hash;
+  uint16_t page;
+
+  static uint32_t hashId(const char* id, const size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+      hash ^= static_cast<uint8_t>(id[i]);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+};
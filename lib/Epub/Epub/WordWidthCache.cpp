@@ -0,0 +1,61 @@
+#include "WordWidthCache.h"
+
+#include <Logging.h>
+
+#include <cstdlib>
+#include <cstring>
+
+WordWidthCache::WordWidthCache(const int fontId) : fontId(fontId) {
+  slots = static_cast<Slot*>(calloc(SLOT_COUNT, sizeof(Slot)));
+  if (!slots) {
+    LOG_ERR("WWC", "Failed to allocate word width cache (%zu bytes), measuring uncached", SLOT_COUNT * sizeof(Slot));
+  }
+}
+
+WordWidthCache::~WordWidthCache() {
+  free(slots);
+  slots = nullptr;
+}
+
+// FNV-1a over the word bytes, seeded with the style so bold/italic variants land in different slots
+uint32_t WordWidthCache::hashWord(const char* word, const size_t len, const uint8_t style) {
+  uint32_t hash = 2166136261u ^ style;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= static_cast<uint8_t>(word[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool WordWidthCache::lookup(const int fontId, const char* word, const size_t len, const EpdFontFamily::Style style,
+                            uint16_t& width) {
+  if (!slots || fontId != this->fontId || len == 0 || len > MAX_WORD_BYTES) {
+    return false;
+  }
+
+  const uint32_t hash = hashWord(word, len, style);
+  const Slot& slot = slots[hash & (SLOT_COUNT - 1)];
+  if (slot.len == len && slot.hash == hash && slot.style == style && memcmp(slot.bytes, word, len) == 0) {
+    width = slot.width;
+    hits++;
+    return true;
+  }
+
+  misses++;
+  return false;
+}
+
+void WordWidthCache::store(const int fontId, const char* word, const size_t len, const EpdFontFamily::Style style,
+                           const uint16_t width) {
+  if (!slots || fontId != this->fontId || len == 0 || len > MAX_WORD_BYTES) {
+    return;
+  }
+
+  const uint32_t hash = hashWord(word, len, style);
+  Slot& slot = slots[hash & (SLOT_COUNT - 1)];
+  slot.hash = hash;
+  slot.width = width;
+  slot.style = style;
+  slot.len = static_cast<uint8_t>(len);
+  memcpy(slot.bytes, word, len);
+}
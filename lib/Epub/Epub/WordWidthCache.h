@@ -0,0 +1,45 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Bounded memo of measured word widths, shared by every ParsedText built while indexing one section.
+// Natural text repeats the same few thousand words constantly, so most getTextAdvanceX calls during
+// layout can be answered from here. Direct-mapped: a colliding word simply replaces the previous one.
+class WordWidthCache {
+ public:
+  static constexpr size_t SLOT_COUNT = 256;     // must be a power of two
+  static constexpr size_t MAX_WORD_BYTES = 24;  // longer words bypass the cache
+
+  explicit WordWidthCache(int fontId);
+  ~WordWidthCache();
+  WordWidthCache(const WordWidthCache&) = delete;
+  WordWidthCache& operator=(const WordWidthCache&) = delete;
+
+  // Returns true and fills width if the (word, style) pair was measured before with this cache's font.
+  bool lookup(int fontId, const char* word, size_t len, EpdFontFamily::Style style, uint16_t& width);
+  void store(int fontId, const char* word, size_t len, EpdFontFamily::Style style, uint16_t width);
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+
+ private:
+  struct Slot {
+    uint32_t hash;
+    uint16_t width;
+    uint8_t style;
+    uint8_t len;  // 0 = empty slot
+    char bytes[MAX_WORD_BYTES];
+  };
+  static_assert((SLOT_COUNT & (SLOT_COUNT - 1)) == 0, "SLOT_COUNT must be a power of two");
+  static_assert(sizeof(Slot) == 32, "Slot layout changed");
+
+  Slot* slots = nullptr;  // SLOT_COUNT entries (8KB), heap-allocated to keep it off the task stack
+  int fontId;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+  static uint32_t hashWord(const char* word, size_t len, uint8_t style);
+};
@@ -2,6 +2,7 @@
 
 #include <HalStorage.h>
 #include <Logging.h>
+#include <ScratchArena.h>
 #include <stdint.h>
 
 #include <cstring>
@@ -16,14 +17,16 @@ struct PixelCache {
   int bytesPerRow;
   int originX;  // config.x - to convert screen coords to cache coords
   int originY;  // config.y
+  bool ownsBuffer;
 
-  PixelCache() : buffer(nullptr), width(0), height(0), bytesPerRow(0), originX(0), originY(0) {}
+  PixelCache() : buffer(nullptr), width(0), height(0), bytesPerRow(0), originX(0), originY(0), ownsBuffer(false) {}
   PixelCache(const PixelCache&) = delete;
   PixelCache& operator=(const PixelCache&) = delete;
 
   static constexpr size_t MAX_CACHE_BYTES = 256 * 1024;  // 256KB limit for embedded targets
 
-  bool allocate(int w, int h, int ox, int oy) {
+  // Takes the buffer from `scratch` when it has room, so it must outlive the cache
+  bool allocate(int w, int h, int ox, int oy, ScratchArena::Lease* scratch = nullptr) {
     width = w;
     height = h;
     originX = ox;
@@ -34,7 +37,11 @@ struct PixelCache {
       LOG_ERR("IMG", "Cache buffer too large: %d bytes for %dx%d (limit %d)", bufferSize, w, h, MAX_CACHE_BYTES);
       return false;
     }
-    buffer = (uint8_t*)malloc(bufferSize);
+    buffer = scratch ? static_cast<uint8_t*>(scratch->allocate(bufferSize)) : nullptr;
+    ownsBuffer = buffer == nullptr;
+    if (ownsBuffer) {
+      buffer = (uint8_t*)malloc(bufferSize);
+    }
     if (buffer) {
       memset(buffer, 0, bufferSize);
       LOG_DBG("IMG", "Allocated cache buffer: %d bytes for %dx%d", bufferSize, w, h);
@@ -74,9 +81,9 @@ struct PixelCache {
   }
 
   ~PixelCache() {
-    if (buffer) {
+    if (buffer && ownsBuffer) {
       free(buffer);
-      buffer = nullptr;
     }
+    buffer = nullptr;
   }
 };
@@ -0,0 +1,118 @@
+#include "HyphenationMemo.h"
+
+#include <cstdlib>
+
+HyphenationMemo::~HyphenationMemo() { clear(); }
+
+// FNV-1a for the set index and main hash, plus a multiplicative hash of its own for the check bits
+HyphenationMemo::Key HyphenationMemo::keyFor(const std::string& word, const bool includeFallback) {
+  uint32_t hash = 2166136261u ^ (includeFallback ? 1u : 0u);
+  uint32_t check = 0x9E3779B9u;
+  for (const char c : word) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+    check = (check ^ static_cast<uint8_t>(c)) * 0x85EBCA6Bu;
+    check ^= check >> 13;
+  }
+  return {hash, static_cast<uint16_t>(check >> 16)};
+}
+
+size_t HyphenationMemo::findWay(const Entry* set, const std::string& word, const bool includeFallback,
+                                const Key& key) {
+  for (size_t way = 0; way < WAYS; way++) {
+    const Entry& entry = set[way];
+    if (entry.len == word.size() && entry.hash == key.hash && entry.check == key.check &&
+        entry.fallback == includeFallback) {
+      return way;
+    }
+  }
+  return WAYS;
+}
+
+HyphenationMemo::Entry& HyphenationMemo::promote(Entry* set, size_t way) {
+  const Entry entry = set[way];
+  for (; way > 0; way--) {
+    set[way] = set[way - 1];
+  }
+  set[0] = entry;
+  return set[0];
+}
+
+bool HyphenationMemo::lookup(const std::string& word, const bool includeFallback, Hyphenator::BreakInfo* out,
+                             const size_t capacity, size_t& count) {
+  if (word.empty() || word.size() > MAX_WORD_BYTES) {
+    return false;
+  }
+  if (!entries) {
+    misses++;
+    return false;
+  }
+
+  const Key key = keyFor(word, includeFallback);
+  Entry* set = entries + (key.hash & (SET_COUNT - 1)) * WAYS;
+  const size_t way = findWay(set, word, includeFallback, key);
+  if (way == WAYS) {
+    misses++;
+    return false;
+  }
+
+  const Entry& entry = promote(set, way);
+  count = 0;
+  for (uint32_t mask = entry.breakMask; mask != 0 && count < capacity; mask &= mask - 1) {
+    const uint32_t offset = __builtin_ctz(mask);
+    out[count++] = {offset, (entry.hyphenMask & (1u << offset)) != 0};
+  }
+  hits++;
+  return true;
+}
+
+void HyphenationMemo::store(const std::string& word, const bool includeFallback, const Hyphenator::BreakInfo* breaks,
+                            const size_t count) {
+  if (word.empty() || word.size() > MAX_WORD_BYTES) {
+    return;
+  }
+  // The masks can only represent strictly ascending offsets inside the word
+  for (size_t i = 0; i < count; i++) {
+    if (breaks[i].byteOffset == 0 || breaks[i].byteOffset >= word.size() ||
+        (i > 0 && breaks[i].byteOffset <= breaks[i - 1].byteOffset)) {
+      return;
+    }
+  }
+  if (!entries) {
+    entries = static_cast<Entry*>(calloc(SET_COUNT * WAYS, sizeof(Entry)));
+    if (!entries) {
+      return;  // out of memory: keep hyphenating uncached
+    }
+  }
+
+  const Key key = keyFor(word, includeFallback);
+  Entry* set = entries + (key.hash & (SET_COUNT - 1)) * WAYS;
+  size_t way = findWay(set, word, includeFallback, key);
+  if (way == WAYS) {
+    // Replace the least recently used way, which is the last one
+    way = WAYS - 1;
+    if (set[way].len != 0) {
+      evictions++;
+    }
+  }
+
+  Entry& entry = promote(set, way);
+  entry.hash = key.hash;
+  entry.check = key.check;
+  entry.len = static_cast<uint8_t>(word.size());
+  entry.fallback = includeFallback ? 1 : 0;
+  entry.breakMask = 0;
+  entry.hyphenMask = 0;
+  for (size_t i = 0; i < count; i++) {
+    const uint32_t bit = 1u << breaks[i].byteOffset;
+    entry.breakMask |= bit;
+    if (breaks[i].requiresInsertedHyphen) {
+      entry.hyphenMask |= bit;
+    }
+  }
+}
+
+void HyphenationMemo::clear() {
+  free(entries);
+  entries = nullptr;
+}
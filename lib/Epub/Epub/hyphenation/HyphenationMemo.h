@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Hyphenator.h"
+
+// Bounded memo of Hyphenator::breakOffsets results for the active language. Books repeat the same words at line ends
+// over and over, so most hyphenation requests can skip the codepoint conversion and the Liang pass. Set-associative
+// with LRU order inside each set. Entries store the breaks as byte bitmasks and identify words by two independent
+// hashes plus the length, so a 16-byte entry covers any word of up to MAX_WORD_BYTES bytes; longer words bypass it.
+class HyphenationMemo {
+ public:
+  static constexpr size_t SET_COUNT = 128;  // must be a power of two
+  static constexpr size_t WAYS = 4;
+  static constexpr size_t MAX_WORD_BYTES = 32;
+
+  HyphenationMemo() = default;
+  ~HyphenationMemo();
+  HyphenationMemo(const HyphenationMemo&) = delete;
+  HyphenationMemo& operator=(const HyphenationMemo&) = delete;
+
+  // Copies up to `capacity` memoized breaks into `out` and returns true if (word, includeFallback) is known.
+  bool lookup(const std::string& word, bool includeFallback, Hyphenator::BreakInfo* out, size_t capacity,
+              size_t& count);
+  void store(const std::string& word, bool includeFallback, const Hyphenator::BreakInfo* breaks, size_t count);
+  // Drops every entry and frees the table (language change); counters are kept.
+  void clear();
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+  uint32_t getEvictions() const { return evictions; }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    uint16_t check;      // second, independent hash of the word
+    uint8_t len;         // 0 = empty entry
+    uint8_t fallback;    // includeFallback of the request
+    uint32_t breakMask;  // bit i set = break before byte i
+    uint32_t hyphenMask;  // bit i set = the break before byte i needs an inserted hyphen
+  };
+  struct Key {
+    uint32_t hash;
+    uint16_t check;
+  };
+  static_assert((SET_COUNT & (SET_COUNT - 1)) == 0, "SET_COUNT must be a power of two");
+  static_assert(MAX_WORD_BYTES <= 32, "break masks hold one bit per byte");
+  static_assert(sizeof(Entry) == 16, "Entry layout changed");
+
+  Entry* entries = nullptr;  // SET_COUNT * WAYS entries (8KB), allocated on the first store
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t evictions = 0;
+
+  static Key keyFor(const std::string& word, bool includeFallback);
+  // Index of the matching way inside `set`, or WAYS if absent
+  static size_t findWay(const Entry* set, const std::string& word, bool includeFallback, const Key& key);
+  // Moves set[way] to the front (most recently used) and returns it
+  static Entry& promote(Entry* set, size_t way);
+};
@@ -1,9 +1,12 @@
 #include "Hyphenator.h"
 
 #include <algorithm>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "HyphenationCommon.h"
+#include "HyphenationMemo.h"
 #include "LanguageHyphenator.h"
 #include "LanguageRegistry.h"
 
@@ -11,11 +14,14 @@ const LanguageHyphenator* Hyphenator::cachedHyphenator_ = nullptr;
 
 namespace {
 
-// Maps a BCP-47 language tag to a language-specific hyphenator.
-const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
-  if (langTag.empty()) return nullptr;
+// Shared by every ParsedText of the book; only ever touched from the indexing task.
+HyphenationMemo memo;
 
-  // Extract primary subtag and normalize to lowercase (e.g., "en-US" -> "en").
+// Language the memo was filled for; languages loaded from SD may reuse one hyphenator object.
+std::string memoLanguage;
+
+// Extracts the primary subtag of a BCP-47 language tag, lowercased (e.g., "en-US" -> "en").
+std::string primaryLanguage(const std::string& langTag) {
   std::string primary;
   primary.reserve(langTag.size());
   for (char c : langTag) {
@@ -23,8 +29,12 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
     if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
     primary.push_back(c);
   }
-  if (primary.empty()) return nullptr;
+  return primary;
+}
 
+// Maps a primary language subtag to a language-specific hyphenator.
+const LanguageHyphenator* hyphenatorForLanguage(const std::string& primary) {
+  if (primary.empty()) return nullptr;
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
@@ -59,17 +69,12 @@ std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<Cod
   return breaks;
 }
 
-}  // namespace
-
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
-  }
-
+// Uncached break computation behind Hyphenator::breakOffsets; writes at most `capacity` entries.
+size_t computeBreakOffsets(const std::string& word, const bool includeFallback, const LanguageHyphenator* hyphenator,
+                           Hyphenator::BreakInfo* out, const size_t capacity) {
   // Convert to codepoints and normalize word boundaries.
   auto cps = collectCodepoints(word);
   trimSurroundingPunctuationAndFootnote(cps);
-  const auto* hyphenator = cachedHyphenator_;
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
   auto explicitBreakInfos = buildExplicitBreakInfos(cps);
@@ -109,37 +114,93 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
       }
       // Merge explicit and pattern breaks into ascending byte-offset order.
       std::sort(explicitBreakInfos.begin(), explicitBreakInfos.end(),
-                [](const BreakInfo& a, const BreakInfo& b) { return a.byteOffset < b.byteOffset; });
+                [](const auto& a, const auto& b) { return a.byteOffset < b.byteOffset; });
     }
-    return explicitBreakInfos;
+    const size_t count = std::min(explicitBreakInfos.size(), capacity);
+    std::copy_n(explicitBreakInfos.begin(), count, out);
+    return count;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
+  size_t count = 0;
   if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+    for (const size_t idx : hyphenator->breakIndexes(cps)) {
+      if (count == capacity) break;
+      out[count++] = {byteOffsetForIndex(cps, idx), true};
+    }
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && count == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
-    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+    for (size_t idx = minPrefix; idx + minSuffix <= cps.size() && count < capacity; ++idx) {
+      out[count++] = {byteOffsetForIndex(cps, idx), true};
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  return count;
+}
+
+}  // namespace
+
+size_t Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, BreakInfo* out,
+                                const size_t capacity) {
+  if (word.empty() || capacity == 0) {
+    return 0;
+  }
+
+  size_t count = 0;
+  if (memo.lookup(word, includeFallback, out, capacity, count)) {
+    return count;
   }
+  count = computeBreakOffsets(word, includeFallback, cachedHyphenator_, out, capacity);
+  // A result cut short by a small caller buffer isn't the full answer, so it isn't memoized
+  if (count < capacity) {
+    memo.store(word, includeFallback, out, count);
+  }
+  return count;
+}
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+bool Hyphenator::widestFittingBreak(const std::string& word, const bool includeFallback, const int maxWidth,
+                                    const std::function<int(size_t byteOffset, bool withHyphen)>& measure,
+                                    BreakInfo& chosen, int& chosenWidth) {
+  // Short words fit the stack buffer; a longer one gets room for a break before each of its bytes
+  BreakInfo stackBreaks[MAX_BREAKS];
+  std::unique_ptr<BreakInfo[]> heapBreaks;
+  BreakInfo* breaks = stackBreaks;
+  size_t capacity = MAX_BREAKS;
+  if (word.size() > MAX_BREAKS) {
+    heapBreaks.reset(new BreakInfo[word.size()]);
+    breaks = heapBreaks.get();
+    capacity = word.size();
   }
 
-  return breaks;
+  const size_t breakCount = breakOffsets(word, includeFallback, breaks, capacity);
+  chosenWidth = -1;
+  for (size_t i = 0; i < breakCount; ++i) {
+    const size_t offset = breaks[i].byteOffset;
+    if (offset == 0 || offset >= word.size()) {
+      continue;
+    }
+    const int prefixWidth = measure(offset, breaks[i].requiresInsertedHyphen);
+    if (prefixWidth > maxWidth || prefixWidth <= chosenWidth) {
+      continue;  // Skip if too wide or not an improvement
+    }
+    chosenWidth = prefixWidth;
+    chosen = breaks[i];
+  }
+  return chosenWidth >= 0;
+}
+
+void Hyphenator::setPreferredLanguage(const std::string& lang) {
+  std::string primary = primaryLanguage(lang);
+  const LanguageHyphenator* hyphenator = hyphenatorForLanguage(primary);
+  if (hyphenator != cachedHyphenator_ || primary != memoLanguage) {
+    memo.clear();
+    memoLanguage = std::move(primary);
+  }
+  cachedHyphenator_ = hyphenator;
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+Hyphenator::MemoStats Hyphenator::memoStats() { return {memo.getHits(), memo.getMisses(), memo.getEvictions()}; }
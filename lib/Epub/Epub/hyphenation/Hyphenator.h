@@ -1,8 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
-#include <vector>
 
 class LanguageHyphenator;
 
@@ -14,7 +15,18 @@ class Hyphenator {
                                   // false = the word already contains a hyphen at this position (explicit '-').
   };
 
-  // Returns byte offsets where the word may be hyphenated.
+  // Stack buffer size for breakOffsets. A word has fewer break points than bytes, so callers that need every break of a
+  // longer word size the buffer from word.size() instead.
+  static constexpr size_t MAX_BREAKS = 64;
+
+  struct MemoStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+  };
+
+  // Writes the byte offsets where the word may be hyphenated into `out` (at most `capacity`, ascending) and returns
+  // how many were written. Results are memoized per language, so a repeated word costs one table probe.
   //
   // Break sources (in priority order):
   //   1. Explicit hyphens already present in the word (e.g. '-' or soft-hyphen U+00AD).
@@ -27,11 +39,20 @@ class Hyphenator {
   //   3. Fallback every-N-chars splitting (only when includeFallback is true AND no
   //      pattern breaks were found). Used as a last resort to prevent a single oversized
   //      word from overflowing the page width.
-  static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+  static size_t breakOffsets(const std::string& word, bool includeFallback, BreakInfo* out, size_t capacity);
+
+  // Returns the break point of `word` with the widest prefix that `measure` (prefix byte length, inserted hyphen) keeps
+  // within maxWidth, or false if none fits. Every break of the word is considered, however long it is.
+  static bool widestFittingBreak(const std::string& word, bool includeFallback, int maxWidth,
+                                 const std::function<int(size_t byteOffset, bool withHyphen)>& measure,
+                                 BreakInfo& chosen, int& chosenWidth);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
+  // Switching to a different language drops the memo.
   static void setPreferredLanguage(const std::string& lang);
 
+  static MemoStats memoStats();
+
  private:
   static const LanguageHyphenator* cachedHyphenator_;
 };
\ No newline at end of file
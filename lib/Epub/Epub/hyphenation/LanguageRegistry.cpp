@@ -1,51 +1,58 @@
 #include "LanguageRegistry.h"
 
 #include <algorithm>
-#include <array>
+#include <iterator>
 
 #include "HyphenationCommon.h"
-#include "generated/hyph-de.trie.h"
 #include "generated/hyph-en.trie.h"
+#ifndef OMIT_HYPHENATION_PATTERNS
+#include "generated/hyph-de.trie.h"
 #include "generated/hyph-es.trie.h"
 #include "generated/hyph-fr.trie.h"
 #include "generated/hyph-it.trie.h"
 #include "generated/hyph-ru.trie.h"
 #include "generated/hyph-uk.trie.h"
+#endif  // OMIT_HYPHENATION_PATTERNS
 
 namespace {
 
 // English hyphenation patterns (3/3 minimum prefix/suffix length)
 LanguageHyphenator englishHyphenator(en_patterns, isLatinLetter, toLowerLatin, 3, 3);
+#ifndef OMIT_HYPHENATION_PATTERNS
 LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator germanHyphenator(de_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator russianHyphenator(ru_patterns, isCyrillicLetter, toLowerCyrillic);
 LanguageHyphenator spanishHyphenator(es_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator italianHyphenator(it_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator ukrainianHyphenator(uk_patterns, isCyrillicLetter, toLowerCyrillic);
-
-using EntryArray = std::array<LanguageEntry, 7>;
-
-const EntryArray& entries() {
-  static const EntryArray kEntries = {{{"english", "en", &englishHyphenator},
-                                       {"french", "fr", &frenchHyphenator},
-                                       {"german", "de", &germanHyphenator},
-                                       {"russian", "ru", &russianHyphenator},
-                                       {"spanish", "es", &spanishHyphenator},
-                                       {"italian", "it", &italianHyphenator},
-                                       {"ukrainian", "uk", &ukrainianHyphenator}}};
-  return kEntries;
-}
+#endif  // OMIT_HYPHENATION_PATTERNS
+
+// With OMIT_HYPHENATION_PATTERNS only the default language stays in flash; the others can be installed on SD.
+const LanguageEntry kEntries[] = {
+    {"english", "en", &englishHyphenator},
+#ifndef OMIT_HYPHENATION_PATTERNS
+    {"french", "fr", &frenchHyphenator},
+    {"german", "de", &germanHyphenator},
+    {"russian", "ru", &russianHyphenator},
+    {"spanish", "es", &spanishHyphenator},
+    {"italian", "it", &italianHyphenator},
+    {"ukrainian", "uk", &ukrainianHyphenator},
+#endif  // OMIT_HYPHENATION_PATTERNS
+};
+
+HyphenatorLoader externalLoader = nullptr;
 
 }  // namespace
 
 const LanguageHyphenator* getLanguageHyphenatorForPrimaryTag(const std::string& primaryTag) {
-  const auto& allEntries = entries();
-  const auto it = std::find_if(allEntries.begin(), allEntries.end(),
+  const auto it = std::find_if(std::begin(kEntries), std::end(kEntries),
                                [&primaryTag](const LanguageEntry& entry) { return primaryTag == entry.primaryTag; });
-  return (it != allEntries.end()) ? it->hyphenator : nullptr;
+  if (it != std::end(kEntries)) {
+    return it->hyphenator;
+  }
+  return externalLoader ? externalLoader(primaryTag) : nullptr;
 }
 
-LanguageEntryView getLanguageEntries() {
-  const auto& allEntries = entries();
-  return LanguageEntryView{allEntries.data(), allEntries.size()};
-}
+LanguageEntryView getLanguageEntries() { return LanguageEntryView{kEntries, std::size(kEntries)}; }
+
+void setHyphenatorLoader(const HyphenatorLoader loader) { externalLoader = loader; }
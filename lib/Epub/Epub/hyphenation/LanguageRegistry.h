@@ -22,5 +22,10 @@ struct LanguageEntryView {
 // Returns the Liang-backed hyphenator for a given primary language tag (e.g., "en", "fr").
 const LanguageHyphenator* getLanguageHyphenatorForPrimaryTag(const std::string& primaryTag);
 
-// Exposes the list of supported languages primarily for tooling/tests.
+// Exposes the list of flash-resident languages primarily for tooling/tests.
 LanguageEntryView getLanguageEntries();
+
+// Fallback for languages without flash-resident patterns (e.g. trie files on SD). Returns nullptr when the language
+// isn't available; a returned hyphenator stays valid until the loader is asked for a different language.
+using HyphenatorLoader = const LanguageHyphenator* (*)(const std::string& primaryTag);
+void setHyphenatorLoader(HyphenatorLoader loader);
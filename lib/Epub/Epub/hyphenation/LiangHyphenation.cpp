@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "PagedHyphenationTrie.h"
+
 /*
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
@@ -26,6 +28,10 @@
  *       flash memory; no heap allocations besides the stack-local AutomatonState
  *       structs. getAutomaton caches parseAutomaton results per blob pointer so
  *       multiple words hitting the same language only pay the cost once.
+ *     - Languages installed as `.bin` files on SD are walked the same way
+ *       through PagedHyphenationTrie, which serves the bytes from a few cached
+ *       512-byte blocks. Node accessors are templated on the byte source so the
+ *       flash path still compiles down to direct array loads.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -181,36 +187,54 @@ bool buildAugmentedWord(AugmentedWord& word, const std::vector<CodepointInfo>& c
   return true;
 }
 
-// Decoded view of a single trie node pulled straight out of the serialized blob.
+// Byte access to a serialized trie. FlashAutomaton reads the generated array in place; PagedAutomaton goes through
+// the block cache of a trie file on SD. The walker below is instantiated once per source, so the flash path keeps
+// its plain array loads.
+struct FlashAutomaton {
+  const EmbeddedAutomaton& patterns;
+
+  size_t size() const { return patterns.size; }
+  size_t rootOffset() const { return patterns.rootOffset; }
+  uint8_t at(const size_t offset) const { return patterns.data[offset]; }
+};
+
+struct PagedAutomaton {
+  PagedHyphenationTrie& trie;
+
+  size_t size() const { return trie.size(); }
+  size_t rootOffset() const { return trie.rootOffset(); }
+  uint8_t at(const size_t offset) const { return trie.byteAt(offset); }
+};
+
+// Decoded view of a single trie node, as offsets into the serialized blob.
 // - transitions: contiguous list of next-byte values
 // - targets: packed relative offsets (1/2/3 bytes) for each transition
-// - levels: optional pointer into the global levels list with packed dist/level pairs
+// - levels: optional offset into the global levels list with packed dist/level pairs
 struct AutomatonState {
-  const uint8_t* data = nullptr;
-  size_t size = 0;
+  bool isValid = false;
   size_t addr = 0;
   uint8_t stride = 1;
   size_t childCount = 0;
-  const uint8_t* transitions = nullptr;
-  const uint8_t* targets = nullptr;
-  const uint8_t* levels = nullptr;
+  size_t transitions = 0;
+  size_t targets = 0;
+  size_t levels = 0;
   size_t levelsLen = 0;
 
-  bool valid() const { return data != nullptr; }
+  bool valid() const { return isValid; }
 };
 
 // Interpret the node located at `addr`, returning transition metadata.
-AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
+template <typename Automaton>
+AutomatonState decodeState(const Automaton& automaton, size_t addr) {
   AutomatonState state;
-  if (addr >= automaton.size) {
+  if (addr >= automaton.size()) {
     return state;
   }
 
-  const uint8_t* base = automaton.data + addr;
-  size_t remaining = automaton.size - addr;
+  size_t remaining = automaton.size() - addr;
   size_t pos = 0;
 
-  const uint8_t header = base[pos++];
+  const uint8_t header = automaton.at(addr + pos++);
   // Header layout (bits):
   //   7        - hasLevels flag
   //   6..5     - stride selector (0 -> 1 byte, otherwise 1|2|3)
@@ -225,66 +249,69 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     if (pos >= remaining) {
       return AutomatonState{};
     }
-    childCount = base[pos++];
+    childCount = automaton.at(addr + pos++);
   }
 
-  const uint8_t* levelsPtr = nullptr;
+  size_t levels = 0;
   size_t levelsLen = 0;
   if (hasLevels) {
     if (pos + 1 >= remaining) {
       return AutomatonState{};
     }
-    const uint8_t offsetHi = base[pos++];
-    const uint8_t offsetLoLen = base[pos++];
+    const uint8_t offsetHi = automaton.at(addr + pos++);
+    const uint8_t offsetLoLen = automaton.at(addr + pos++);
     // The 12-bit offset (hi<<4 | top nibble) points into the blob-level levels list.
     // The bottom nibble stores how many packed entries belong to this node.
     const size_t offset = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
     levelsLen = offsetLoLen & 0x0Fu;
-    if (offset + levelsLen > automaton.size) {
+    // The offset counts the 4-byte root header the blob no longer carries.
+    if (offset < 4u || offset + levelsLen > automaton.size()) {
       return AutomatonState{};
     }
-    levelsPtr = automaton.data + offset - 4u;
+    levels = offset - 4u;
   }
 
   if (pos + childCount > remaining) {
     return AutomatonState{};
   }
-  const uint8_t* transitions = base + pos;
+  const size_t transitions = addr + pos;
   pos += childCount;
 
   const size_t targetsBytes = childCount * stride;
   if (pos + targetsBytes > remaining) {
     return AutomatonState{};
   }
-  const uint8_t* targets = base + pos;
 
-  state.data = automaton.data;
-  state.size = automaton.size;
+  state.isValid = true;
   state.addr = addr;
   state.stride = stride;
   state.childCount = childCount;
   state.transitions = transitions;
-  state.targets = targets;
-  state.levels = levelsPtr;
+  state.targets = addr + pos;
+  state.levels = levels;
   state.levelsLen = levelsLen;
   return state;
 }
 
 // Convert the packed stride-sized delta back into a signed offset.
-int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
+template <typename Automaton>
+int32_t decodeDelta(const Automaton& automaton, const size_t offset, uint8_t stride) {
   if (stride == 1) {
-    return static_cast<int8_t>(buf[0]);
+    return static_cast<int8_t>(automaton.at(offset));
   }
   if (stride == 2) {
-    return static_cast<int16_t>((static_cast<uint16_t>(buf[0]) << 8) | static_cast<uint16_t>(buf[1]));
+    return static_cast<int16_t>((static_cast<uint16_t>(automaton.at(offset)) << 8) |
+                                static_cast<uint16_t>(automaton.at(offset + 1)));
   }
-  const int32_t unsignedVal =
-      (static_cast<int32_t>(buf[0]) << 16) | (static_cast<int32_t>(buf[1]) << 8) | static_cast<int32_t>(buf[2]);
+  const int32_t unsignedVal = (static_cast<int32_t>(automaton.at(offset)) << 16) |
+                              (static_cast<int32_t>(automaton.at(offset + 1)) << 8) |
+                              static_cast<int32_t>(automaton.at(offset + 2));
   return unsignedVal - (1 << 23);
 }
 
 // Follow a single byte transition from `state`, decoding the child node on success.
-bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
+template <typename Automaton>
+bool transition(const Automaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
   if (!state.valid()) {
     return false;
   }
@@ -292,15 +319,14 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
   // Children remain sorted by letter in the serialized blob, but the lists are
   // short enough that a linear scan keeps code size down compared to binary search.
   for (size_t idx = 0; idx < state.childCount; ++idx) {
-    if (state.transitions[idx] != letter) {
+    if (automaton.at(state.transitions + idx) != letter) {
       continue;
     }
-    const uint8_t* deltaPtr = state.targets + idx * state.stride;
-    const int32_t delta = decodeDelta(deltaPtr, state.stride);
+    const int32_t delta = decodeDelta(automaton, state.targets + idx * state.stride, state.stride);
     // Deltas are relative to the current node's address, allowing us to keep all
     // targets within 24 bits while still referencing further nodes in the blob.
     const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
+    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size()) {
       return false;
     }
     out = decodeState(automaton, static_cast<size_t>(nextAddr));
@@ -343,11 +369,10 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
   return indexes;
 }
 
-}  // namespace
-
-// Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
+// Runs the full Liang pipeline for a single word against either trie source.
+template <typename Automaton>
+std::vector<size_t> runLiang(const std::vector<CodepointInfo>& cps, const Automaton& automaton,
+                             const LiangWordConfig& config) {
   // AugmentedWord uses fixed-size C arrays (no heap allocation) to avoid
   // fragmenting the heap across hundreds of words during page layout.
   AugmentedWord augmented;
@@ -355,9 +380,7 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
     return {};
   }
 
-  const EmbeddedAutomaton& automaton = patterns;
-
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
+  const AutomatonState root = decodeState(automaton, automaton.rootOffset());
   if (!root.valid()) {
     return {};
   }
@@ -381,11 +404,11 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
       }
       state = next;
 
-      if (state.levels && state.levelsLen > 0) {
+      if (state.levelsLen > 0) {
         size_t offset = 0;
         // Each packed byte stores the byte-distance delta and the Liang level digit.
         for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
+          const uint8_t packed = automaton.at(state.levels + i);
           const size_t dist = static_cast<size_t>(packed / 10);
           const uint8_t level = static_cast<uint8_t>(packed % 10);
 
@@ -415,3 +438,20 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
 
   return collectBreakIndexes(cps, scores, augmented.charCount_, config.minPrefix, config.minSuffix);
 }
+
+}  // namespace
+
+// Entry point for flash-resident patterns.
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
+                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
+  return runLiang(cps, FlashAutomaton{patterns}, config);
+}
+
+// Entry point for patterns paged in from a trie file.
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps, PagedHyphenationTrie& patterns,
+                                      const LiangWordConfig& config) {
+  if (!patterns.isOpen()) {
+    return {};
+  }
+  return runLiang(cps, PagedAutomaton{patterns}, config);
+}
@@ -7,6 +7,8 @@
 #include "HyphenationCommon.h"
 #include "SerializedHyphenationTrie.h"
 
+class PagedHyphenationTrie;
+
 // Encapsulates every language-specific dial the Liang algorithm needs at runtime.  The helpers are
 // intentionally represented as bare function pointers because we invoke them inside tight loops and
 // want to avoid the overhead of std::function or functors.  The minima default to the TeX-recommended
@@ -36,3 +38,6 @@ struct LiangWordConfig {
 // Shared Liang pattern evaluator used by every language-specific hyphenator.
 std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
                                       const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+// Same evaluation against a trie file paged in from SD; returns no breaks while the trie isn't open.
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps, PagedHyphenationTrie& patterns,
+                                      const LiangWordConfig& config);
@@ -0,0 +1,89 @@
+#include "PagedHyphenationTrie.h"
+
+#include <cstdlib>
+
+PagedHyphenationTrie::~PagedHyphenationTrie() { close(); }
+
+bool PagedHyphenationTrie::open(const ReadFn readFn, void* readCtx, const size_t size, const size_t maxBlocks) {
+  close();
+  if (!readFn || size <= HEADER_SIZE || maxBlocks == 0) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (readFn(readCtx, 0, header, HEADER_SIZE) != HEADER_SIZE) {
+    return false;
+  }
+  const size_t rootAddr = (static_cast<size_t>(header[0]) << 24) | (static_cast<size_t>(header[1]) << 16) |
+                          (static_cast<size_t>(header[2]) << 8) | header[3];
+  if (rootAddr < HEADER_SIZE || rootAddr >= size) {
+    return false;
+  }
+
+  const size_t fileBlocks = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  blockCount = maxBlocks < fileBlocks ? maxBlocks : fileBlocks;
+  blocks = static_cast<Block*>(calloc(blockCount, sizeof(Block)));
+  if (!blocks) {
+    blockCount = 0;
+    return false;
+  }
+  read = readFn;
+  ctx = readCtx;
+  fileSize = size;
+  root = rootAddr - HEADER_SIZE;
+  blobSize = size - HEADER_SIZE;
+  return true;
+}
+
+void PagedHyphenationTrie::close() {
+  free(blocks);
+  blocks = nullptr;
+  blockCount = 0;
+  currentIndex = NO_BLOCK;
+  currentBytes = nullptr;
+  read = nullptr;
+  ctx = nullptr;
+  fileSize = 0;
+  root = 0;
+  blobSize = 0;
+}
+
+bool PagedHyphenationTrie::selectBlock(const size_t index) {
+  if (!blocks || index * BLOCK_SIZE >= fileSize) {
+    return false;
+  }
+
+  Block* victim = &blocks[0];
+  for (size_t i = 0; i < blockCount; i++) {
+    Block& block = blocks[i];
+    if (block.valid && block.index == index) {
+      block.lastUse = ++useClock;
+      currentIndex = index;
+      currentBytes = block.bytes;
+      blockHits++;
+      return true;
+    }
+    if (!block.valid || (victim->valid && block.lastUse < victim->lastUse)) {
+      victim = &block;
+    }
+  }
+
+  // The last block of the file may be short; the bytes past its end are never addressed
+  const size_t offset = index * BLOCK_SIZE;
+  const size_t wanted = (fileSize - offset < BLOCK_SIZE) ? fileSize - offset : BLOCK_SIZE;
+  blockReads++;
+  if (read(ctx, offset, victim->bytes, wanted) != wanted) {
+    victim->valid = false;
+    if (currentBytes == victim->bytes) {
+      currentIndex = NO_BLOCK;
+      currentBytes = nullptr;
+    }
+    return false;
+  }
+  victim->index = index;
+  victim->valid = true;
+  victim->lastUse = ++useClock;
+  currentIndex = index;
+  currentBytes = victim->bytes;
+  return true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Liang trie read from a hypher `.bin` file (the same format the generated flash headers embed) through a small
+// LRU block cache instead of being compiled into the firmware. Offsets passed to byteAt() are blob offsets, i.e. the
+// same addresses SerializedHyphenationPatterns uses once the 4-byte root header is stripped.
+//
+// Pattern lookups touch nodes all over the trie (children are laid out after their whole subtree), so the miss rate
+// depends on how much of the file the cache holds rather than on the block size.
+class PagedHyphenationTrie {
+ public:
+  static constexpr size_t BLOCK_SIZE = 512;  // one SD sector
+  static constexpr size_t DEFAULT_BLOCK_COUNT = 8;
+  static constexpr size_t HEADER_SIZE = 4;  // big-endian root address
+
+  // Reads up to `len` bytes at file `offset` into `out`, returning how many were read. A bare function pointer
+  // (like the LiangWordConfig helpers) keeps the trie independent of the storage layer.
+  using ReadFn = size_t (*)(void* ctx, size_t offset, uint8_t* out, size_t len);
+
+  PagedHyphenationTrie() = default;
+  ~PagedHyphenationTrie();
+  PagedHyphenationTrie(const PagedHyphenationTrie&) = delete;
+  PagedHyphenationTrie& operator=(const PagedHyphenationTrie&) = delete;
+
+  // Validates the header of a `fileSize`-byte trie and allocates up to `maxBlocks` cache blocks (never more than
+  // the file needs). `ctx` must outlive the trie.
+  bool open(ReadFn read, void* ctx, size_t fileSize, size_t maxBlocks = DEFAULT_BLOCK_COUNT);
+  void close();
+  bool isOpen() const { return blocks != nullptr; }
+
+  size_t rootOffset() const { return root; }
+  size_t size() const { return blobSize; }
+
+  // Unreadable bytes come back as 0, which decodes as a node without children and ends the walk.
+  uint8_t byteAt(const size_t offset) {
+    const size_t fileOffset = offset + HEADER_SIZE;
+    if (fileOffset / BLOCK_SIZE != currentIndex && !selectBlock(fileOffset / BLOCK_SIZE)) {
+      return 0;
+    }
+    return currentBytes[fileOffset % BLOCK_SIZE];
+  }
+
+  uint32_t getBlockHits() const { return blockHits; }
+  uint32_t getBlockReads() const { return blockReads; }
+
+ private:
+  struct Block {
+    size_t index;
+    uint32_t lastUse;
+    bool valid;
+    uint8_t bytes[BLOCK_SIZE];
+  };
+
+  static constexpr size_t NO_BLOCK = static_cast<size_t>(-1);
+
+  ReadFn read = nullptr;
+  void* ctx = nullptr;
+  size_t fileSize = 0;
+  size_t root = 0;
+  size_t blobSize = 0;
+
+  Block* blocks = nullptr;
+  size_t blockCount = 0;
+  size_t currentIndex = NO_BLOCK;
+  const uint8_t* currentBytes = nullptr;
+  uint32_t useClock = 0;
+  uint32_t blockHits = 0;
+  uint32_t blockReads = 0;
+
+  // Makes block `index` current, reading it over the least recently used block if it isn't cached
+  bool selectBlock(size_t index);
+};
@@ -0,0 +1,75 @@
+#include "SdHyphenationPatterns.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <memory>
+
+#include "HyphenationCommon.h"
+#include "LanguageHyphenator.h"
+#include "PagedHyphenationTrie.h"
+
+namespace {
+
+constexpr char PATTERN_DIR[] = "/.crosspoint/hyphenation";
+// 16KB of cached trie blocks while an SD language is active; tries up to that size end up fully resident
+constexpr size_t CACHE_BLOCKS = 32;
+
+// SD languages have no dedicated helpers, so they accept any letter the hyphenation code knows about
+uint32_t toLowerAlphabetic(const uint32_t cp) { return isCyrillicLetter(cp) ? toLowerCyrillic(cp) : toLowerLatin(cp); }
+
+struct SdLanguage {
+  std::string primaryTag;
+  FsFile file;
+  PagedHyphenationTrie trie;
+  LanguageHyphenator hyphenator{trie, isAlphabetic, toLowerAlphabetic};
+};
+
+std::unique_ptr<SdLanguage> current;
+// Tag of the last lookup that found no file, so a book in that language doesn't probe the card per section
+std::string missingTag;
+
+size_t readFromFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file.seekSet(offset)) {
+    return 0;
+  }
+  const int bytesRead = file.read(out, len);
+  return bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0;
+}
+
+}  // namespace
+
+const LanguageHyphenator* loadSdHyphenator(const std::string& primaryTag) {
+  if (current && current->primaryTag == primaryTag) {
+    return &current->hyphenator;
+  }
+  if (primaryTag == missingTag) {
+    return nullptr;
+  }
+  current.reset();
+
+  const std::string path = std::string(PATTERN_DIR) + "/" + primaryTag + ".bin";
+  if (!Storage.exists(path.c_str())) {
+    missingTag = primaryTag;
+    return nullptr;
+  }
+
+  auto language = std::unique_ptr<SdLanguage>(new SdLanguage());
+  language->primaryTag = primaryTag;
+  if (!Storage.openFileForRead("HYP", path, language->file)) {
+    missingTag = primaryTag;
+    return nullptr;
+  }
+  if (!language->trie.open(readFromFile, &language->file, language->file.fileSize(), CACHE_BLOCKS)) {
+    LOG_ERR("HYP", "Invalid hyphenation trie %s", path.c_str());
+    missingTag = primaryTag;
+    return nullptr;
+  }
+
+  LOG_DBG("HYP", "Loaded hyphenation patterns for %s from SD (%u bytes)", primaryTag.c_str(),
+          static_cast<unsigned>(language->trie.size()));
+  current = std::move(language);
+  missingTag.clear();
+  return &current->hyphenator;
+}
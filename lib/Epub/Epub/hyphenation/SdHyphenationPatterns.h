@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+class LanguageHyphenator;
+
+// HyphenatorLoader for languages installed on the SD card as hypher tries, e.g. /.crosspoint/hyphenation/nl.bin.
+// One language is kept open at a time; asking for another one closes it. Register with setHyphenatorLoader().
+const LanguageHyphenator* loadSdHyphenator(const std::string& primaryTag);
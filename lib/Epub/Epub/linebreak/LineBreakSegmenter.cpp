@@ -0,0 +1,290 @@
+#include "LineBreakSegmenter.h"
+
+#include <Utf8.h>
+
+#include <cstdint>
+
+#include "ThaiWordBreaker.h"
+
+namespace {
+
+// The subset of UAX #14 line-break classes the segmenter distinguishes
+enum class BreakClass : uint8_t {
+  AL,  // everything else: letters, digits, symbols (never broken apart here)
+  ID,  // ideographs, kana, fullwidth forms: break on either side
+  SA,  // Thai: resolved by the dictionary
+  OP,  // opening punctuation: no break after
+  CL,  // closing punctuation, full stops, commas: no break before
+  NS,  // small kana, prolonged sound mark, iteration marks: no break before
+  CM,  // combining marks and soft hyphens: take the class of the base
+};
+
+struct SegmentCodepoint {
+  uint32_t value;
+  size_t byteOffset;
+  BreakClass cls;
+};
+
+bool isSmallKana(const uint32_t cp) {
+  switch (cp) {
+    case 0x3041:
+    case 0x3043:
+    case 0x3045:
+    case 0x3047:
+    case 0x3049:
+    case 0x3063:
+    case 0x3083:
+    case 0x3085:
+    case 0x3087:
+    case 0x308E:
+    case 0x3095:
+    case 0x3096:
+    case 0x30A1:
+    case 0x30A3:
+    case 0x30A5:
+    case 0x30A7:
+    case 0x30A9:
+    case 0x30C3:
+    case 0x30E3:
+    case 0x30E5:
+    case 0x30E7:
+    case 0x30EE:
+    case 0x30F5:
+    case 0x30F6:
+      return true;
+    default:
+      return (cp >= 0x31F0 && cp <= 0x31FF) || (cp >= 0xFF67 && cp <= 0xFF70);
+  }
+}
+
+BreakClass classify(const uint32_t cp) {
+  if (cp < 0x0080) {
+    switch (cp) {
+      case '(':
+      case '[':
+      case '{':
+        return BreakClass::OP;
+      case ')':
+      case ']':
+      case '}':
+      case '!':
+      case '?':
+      case ',':
+      case '.':
+      case ':':
+      case ';':
+        return BreakClass::CL;
+      default:
+        return BreakClass::AL;
+    }
+  }
+  if (cp == 0x00AD || utf8IsCombiningMark(cp) || cp == 0x3099 || cp == 0x309A) {
+    return BreakClass::CM;
+  }
+  if (ThaiWordBreaker::isThai(cp)) {
+    return BreakClass::SA;
+  }
+  if (cp < 0x2018) {
+    return BreakClass::AL;
+  }
+
+  switch (cp) {
+    case 0x2018:  // ‘
+    case 0x201C:  // “
+    case 0x3008:  // 〈
+    case 0x300A:  // 《
+    case 0x300C:  // 「
+    case 0x300E:  // 『
+    case 0x3010:  // 【
+    case 0x3014:  // 〔
+    case 0x3016:  // 〖
+    case 0x3018:  // 〘
+    case 0x301A:  // 〚
+    case 0x301D:  // 〝
+    case 0xFF08:  // （
+    case 0xFF3B:  // ［
+    case 0xFF5B:  // ｛
+    case 0xFF5F:  // ｟
+    case 0xFF62:  // ｢
+      return BreakClass::OP;
+    case 0x2019:  // ’
+    case 0x201D:  // ”
+    case 0x2026:  // …
+    case 0x3001:  // 、
+    case 0x3002:  // 。
+    case 0x3009:  // 〉
+    case 0x300B:  // 》
+    case 0x300D:  // 」
+    case 0x300F:  // 』
+    case 0x3011:  // 】
+    case 0x3015:  // 〕
+    case 0x3017:  // 〗
+    case 0x3019:  // 〙
+    case 0x301B:  // 〛
+    case 0x301E:  // 〞
+    case 0x301F:  // 〟
+    case 0xFF01:  // ！
+    case 0xFF09:  // ）
+    case 0xFF0C:  // ，
+    case 0xFF0E:  // ．
+    case 0xFF1A:  // ：
+    case 0xFF1B:  // ；
+    case 0xFF1F:  // ？
+    case 0xFF3D:  // ］
+    case 0xFF5D:  // ｝
+    case 0xFF60:  // ｠
+    case 0xFF61:  // ｡
+    case 0xFF63:  // ｣
+    case 0xFF64:  // ､
+      return BreakClass::CL;
+    case 0x3005:  // 々
+    case 0x303B:  // 〻
+    case 0x309B:  // ゛
+    case 0x309C:  // ゜
+    case 0x309D:  // ゝ
+    case 0x309E:  // ゞ
+    case 0x30FB:  // ・
+    case 0x30FC:  // ー
+    case 0x30FD:  // ヽ
+    case 0x30FE:  // ヾ
+      return BreakClass::NS;
+    default:
+      break;
+  }
+  if (isSmallKana(cp)) {
+    return BreakClass::NS;
+  }
+
+  if ((cp >= 0x2E80 && cp <= 0x31EF)      // CJK radicals, symbols and punctuation, kana, bopomofo
+      || (cp >= 0x3200 && cp <= 0x4DBF)   // enclosed CJK, compatibility, extension A
+      || (cp >= 0x4E00 && cp <= 0x9FFF)   // CJK unified ideographs
+      || (cp >= 0xA000 && cp <= 0xA4CF)   // Yi
+      || (cp >= 0xF900 && cp <= 0xFAFF)   // CJK compatibility ideographs
+      || (cp >= 0xFF00 && cp <= 0xFF60)   // fullwidth forms
+      || (cp >= 0xFF66 && cp <= 0xFF9F)   // halfwidth katakana
+      || (cp >= 0x20000 && cp <= 0x3FFFD)) {  // supplementary ideographic planes
+    return BreakClass::ID;
+  }
+  return BreakClass::AL;
+}
+
+// East Asian wide punctuation (fullwidth commas, corner brackets, ...) allows breaks towards any neighbour, unlike
+// its narrow counterparts in Latin text
+bool isWide(const uint32_t cp) { return cp >= 0x2E80; }
+
+// Pair rule for everything except Thai-Thai, which the dictionary decides
+bool canBreakBetween(const SegmentCodepoint& before, const SegmentCodepoint& after) {
+  if (before.cls == BreakClass::OP || after.cls == BreakClass::CL || after.cls == BreakClass::NS) {
+    return false;
+  }
+  if (before.cls == BreakClass::ID || after.cls == BreakClass::ID) {
+    return true;
+  }
+  return ((before.cls == BreakClass::CL || before.cls == BreakClass::NS) && isWide(before.value)) ||
+         (after.cls == BreakClass::OP && isWide(after.value));
+}
+
+// Marks the Thai-internal breaks of cps[start, end). Runs longer than one dictionary pass are segmented a window at a
+// time; only the breaks before the window's last word are kept, and the next window starts at that word.
+void markThaiRun(const std::vector<SegmentCodepoint>& cps, size_t start, const size_t end, std::vector<bool>& breaks) {
+  uint32_t run[ThaiWordBreaker::MAX_RUN_CHARS];
+  bool runBreaks[ThaiWordBreaker::MAX_RUN_CHARS];
+
+  while (start < end) {
+    const bool lastWindow = end - start <= ThaiWordBreaker::MAX_RUN_CHARS;
+    const size_t count = lastWindow ? end - start : ThaiWordBreaker::MAX_RUN_CHARS;
+    for (size_t i = 0; i < count; ++i) {
+      run[i] = cps[start + i].value;
+      runBreaks[i] = false;
+    }
+    ThaiWordBreaker::markBreaks(run, count, runBreaks);
+
+    size_t lastBreak = 0;
+    for (size_t i = 1; i < count; ++i) {
+      if (runBreaks[i]) {
+        lastBreak = i;
+      }
+    }
+    if (lastWindow) {
+      lastBreak = count;
+    } else if (lastBreak == 0) {
+      // Not a single boundary in a whole window: cut at the last cluster boundary instead
+      lastBreak = count;
+      while (lastBreak > 1 && !ThaiWordBreaker::isClusterBoundary(run[lastBreak - 1], cps[start + lastBreak].value)) {
+        --lastBreak;
+      }
+    }
+
+    for (size_t i = 1; i < lastBreak; ++i) {
+      if (runBreaks[i]) {
+        breaks[start + i] = true;
+      }
+    }
+    if (!lastWindow) {
+      breaks[start + lastBreak] = true;
+    }
+    start += lastBreak;
+  }
+}
+
+}  // namespace
+
+bool LineBreakSegmenter::needsSegmentation(const std::string& word) {
+  // Thai and CJK all encode as 3 or 4 byte sequences, so pure Latin/Cyrillic words never reach the decoder
+  const auto* ptr = reinterpret_cast<const unsigned char*>(word.c_str());
+  while (*ptr != 0) {
+    if (*ptr < 0xE0) {
+      ++ptr;
+      continue;
+    }
+    const BreakClass cls = classify(utf8NextCodepoint(&ptr));
+    if (cls == BreakClass::ID || cls == BreakClass::SA) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<size_t> LineBreakSegmenter::breakOffsets(const std::string& word) {
+  std::vector<SegmentCodepoint> cps;
+  cps.reserve(word.size() / 2);
+
+  const auto* base = reinterpret_cast<const unsigned char*>(word.c_str());
+  const unsigned char* ptr = base;
+  while (*ptr != 0) {
+    const size_t offset = static_cast<size_t>(ptr - base);
+    const uint32_t cp = utf8NextCodepoint(&ptr);
+    BreakClass cls = classify(cp);
+    // Combining marks (LB9) take over the class of their base character
+    if (cls == BreakClass::CM && !cps.empty()) {
+      cls = cps.back().cls;
+    }
+    cps.push_back({cp, offset, cls});
+  }
+
+  // breaks[i]: a line may end right before cps[i]
+  std::vector<bool> breaks(cps.size() + 1, false);
+  size_t i = 1;
+  while (i < cps.size()) {
+    if (cps[i - 1].cls == BreakClass::SA && cps[i].cls == BreakClass::SA) {
+      size_t runEnd = i;
+      while (runEnd < cps.size() && cps[runEnd].cls == BreakClass::SA) {
+        ++runEnd;
+      }
+      markThaiRun(cps, i - 1, runEnd, breaks);
+      i = runEnd;
+      continue;
+    }
+    const bool isMark = classify(cps[i].value) == BreakClass::CM;
+    breaks[i] = !isMark && canBreakBetween(cps[i - 1], cps[i]);
+    ++i;
+  }
+
+  std::vector<size_t> offsets;
+  for (size_t idx = 1; idx < cps.size(); ++idx) {
+    if (breaks[idx]) {
+      offsets.push_back(cps[idx].byteOffset);
+    }
+  }
+  return offsets;
+}
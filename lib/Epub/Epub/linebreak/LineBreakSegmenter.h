@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Line-break opportunities inside words of scripts that don't separate words with spaces, following the UAX #14 rules
+// that matter for book text: CJK ideographs and kana break between any two characters (except before closing
+// punctuation and small kana, or after opening punctuation), Thai breaks between dictionary words. Hangul is left to
+// its spaces, matching the usual keep-all setting for Korean.
+namespace LineBreakSegmenter {
+
+// Cheap pre-check: true if the word contains CJK or Thai text that breakOffsets may split.
+bool needsSegmentation(const std::string& word);
+
+// Byte offsets strictly inside `word`, ascending, where a line may break without a space or an inserted hyphen.
+std::vector<size_t> breakOffsets(const std::string& word);
+
+}  // namespace LineBreakSegmenter
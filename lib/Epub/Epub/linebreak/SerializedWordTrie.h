@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Lightweight descriptor that points at a serialized dictionary trie stored in flash.
+struct SerializedWordTrie {
+  size_t rootOffset;
+  const std::uint8_t* data;
+  size_t size;
+};
@@ -0,0 +1,177 @@
+#include "ThaiWordBreaker.h"
+
+#include "generated/th-words.trie.h"
+
+/*
+ * Thai segmentation overview
+ * --------------------------
+ * Thai separates sentences with spaces at most, so line-break opportunities have to be found between the words of a
+ * run. The run is split into character clusters first (a consonant together with its leading vowel, following vowels
+ * and tone marks); a line may only ever be cut between clusters. On top of that a shortest-path pass picks the
+ * segmentation that leaves the fewest clusters outside dictionary words and, among those, uses the fewest words
+ * (i.e. prefers the longest matches). Clusters outside dictionary words stay together as one segment, like a word the
+ * dictionary doesn't know; a line too narrow for it falls back to hyphenation. The dictionary is a suffix-shared trie
+ * generated by scripts/generate_word_break_trie.py into flash; it is walked in place like the hyphenation tries, one
+ * byte per Thai codepoint. Work is O(run length x longest dictionary match) with fixed stack tables and no heap use.
+ */
+
+namespace {
+
+constexpr uint16_t WORD_COST = 1;
+// Every cluster left outside a dictionary word costs more than any number of words, so coverage always wins
+constexpr uint16_t UNKNOWN_CLUSTER_COST = ThaiWordBreaker::MAX_RUN_CHARS + 1;
+constexpr uint16_t UNREACHED = 0xFFFF;
+
+// เ แ โ ใ ไ are written before the consonant they belong to
+bool isLeadingVowel(const uint32_t cp) { return cp >= 0x0E40 && cp <= 0x0E44; }
+
+// Marks and vowels that always belong to the preceding consonant
+bool isAttached(const uint32_t cp) {
+  return cp == 0x0E2F                        // ฯ abbreviation sign
+         || (cp >= 0x0E30 && cp <= 0x0E3A)   // following, above and below vowels
+         || (cp >= 0x0E45 && cp <= 0x0E4E);  // lakkhangyao, mai yamok, tone marks and other diacritics
+}
+
+bool isThaiDigit(const uint32_t cp) { return cp >= 0x0E50 && cp <= 0x0E59; }
+
+struct TrieNode {
+  size_t addr = 0;
+  bool terminal = false;
+  uint8_t stride = 1;
+  size_t childCount = 0;
+  const uint8_t* transitions = nullptr;
+  const uint8_t* targets = nullptr;
+};
+
+// Header layout: bit 7 terminal, bits 6..5 stride, bits 4..0 child count (31 -> extra count byte).
+bool decodeNode(const SerializedWordTrie& trie, const size_t addr, TrieNode& out) {
+  if (addr >= trie.size) {
+    return false;
+  }
+  const uint8_t* base = trie.data + addr;
+  const size_t remaining = trie.size - addr;
+  size_t pos = 0;
+
+  const uint8_t header = base[pos++];
+  out.addr = addr;
+  out.terminal = (header & 0x80u) != 0;
+  out.stride = static_cast<uint8_t>((header >> 5) & 0x03u);
+  out.childCount = header & 0x1Fu;
+  if (out.stride == 0) {
+    return false;
+  }
+  if (out.childCount == 31u) {
+    if (pos >= remaining) {
+      return false;
+    }
+    out.childCount = base[pos++];
+  }
+  if (pos + out.childCount * (1u + out.stride) > remaining) {
+    return false;
+  }
+  out.transitions = base + pos;
+  out.targets = base + pos + out.childCount;
+  return true;
+}
+
+// Follows one letter. Children are stored before their parent, so targets are backward distances.
+bool followLetter(const SerializedWordTrie& trie, const TrieNode& node, const uint8_t letter, TrieNode& out) {
+  for (size_t idx = 0; idx < node.childCount; ++idx) {
+    if (node.transitions[idx] != letter) {
+      continue;
+    }
+    const uint8_t* delta = node.targets + idx * node.stride;
+    size_t distance = 0;
+    for (uint8_t b = 0; b < node.stride; ++b) {
+      distance = (distance << 8) | delta[b];
+    }
+    if (distance == 0 || distance > node.addr) {
+      return false;
+    }
+    return decodeNode(trie, node.addr - distance, out);
+  }
+  return false;
+}
+
+}  // namespace
+
+bool ThaiWordBreaker::isClusterBoundary(const uint32_t prev, const uint32_t cur) {
+  if (isLeadingVowel(prev) || isAttached(cur)) {
+    return false;
+  }
+  return !(isThaiDigit(prev) && isThaiDigit(cur));
+}
+
+void ThaiWordBreaker::markBreaks(const uint32_t* cps, const size_t count, bool* breakBefore) {
+  if (count < 2 || count > MAX_RUN_CHARS) {
+    return;
+  }
+
+  const SerializedWordTrie& trie = th_words_trie;
+  TrieNode root;
+  if (!decodeNode(trie, trie.rootOffset, root)) {
+    return;
+  }
+
+  // boundary[i]: a segment may start at i. cost/from: cheapest segmentation of cps[0, i) and its last cut;
+  // unknown[i]: that last segment is a cluster outside the dictionary.
+  bool boundary[MAX_RUN_CHARS + 1];
+  uint16_t cost[MAX_RUN_CHARS + 1];
+  uint8_t from[MAX_RUN_CHARS + 1];
+  bool unknown[MAX_RUN_CHARS + 1];
+  boundary[0] = true;
+  boundary[count] = true;
+  for (size_t i = 1; i < count; ++i) {
+    boundary[i] = isClusterBoundary(cps[i - 1], cps[i]);
+  }
+  for (size_t i = 0; i <= count; ++i) {
+    cost[i] = UNREACHED;
+    from[i] = 0;
+    unknown[i] = false;
+  }
+  cost[0] = 0;
+
+  const auto relax = [&](const size_t start, const size_t end, const uint16_t step) {
+    const uint16_t candidate = cost[start] + step;
+    if (candidate < cost[end]) {
+      cost[end] = candidate;
+      from[end] = static_cast<uint8_t>(start);
+      unknown[end] = step == UNKNOWN_CLUSTER_COST;
+    }
+  };
+
+  for (size_t start = 0; start < count; ++start) {
+    if (!boundary[start] || cost[start] == UNREACHED) {
+      continue;
+    }
+
+    // Every dictionary word beginning here that also ends on a cluster boundary
+    TrieNode node = root;
+    for (size_t end = start; end < count; ++end) {
+      TrieNode next;
+      if (!followLetter(trie, node, static_cast<uint8_t>(cps[end] - 0x0E00), next)) {
+        break;
+      }
+      node = next;
+      if (node.terminal && boundary[end + 1]) {
+        relax(start, end + 1, WORD_COST);
+      }
+    }
+
+    // Or step over one cluster the dictionary doesn't know
+    size_t clusterEnd = start + 1;
+    while (!boundary[clusterEnd]) {
+      ++clusterEnd;
+    }
+    relax(start, clusterEnd, UNKNOWN_CLUSTER_COST);
+  }
+
+  // Words get a break before them; a run of unknown clusters is kept whole
+  for (size_t end = count; end > 0;) {
+    const size_t start = from[end];
+    if (start > 0 && !(unknown[start] && unknown[end])) {
+      breakBefore[start] = true;
+    }
+    end = start;
+  }
+}
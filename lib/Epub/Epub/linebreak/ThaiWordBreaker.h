@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Dictionary-based word boundaries for Thai, which puts no spaces between words. The dictionary is ICU's thaidict
+// (scripts/data/th-words.txt, 26,383 words), compiled into a 140KB trie in flash.
+namespace ThaiWordBreaker {
+
+// Longest run segmented in one pass; the DP tables for it live on the stack.
+constexpr size_t MAX_RUN_CHARS = 96;
+
+inline bool isThai(const uint32_t cp) { return cp >= 0x0E01 && cp <= 0x0E5B; }
+
+// True if a line may be cut between prev and cur without splitting a character cluster (a consonant with its
+// vowels and tone marks, or a run of Thai digits).
+bool isClusterBoundary(uint32_t prev, uint32_t cur);
+
+// Sets breakBefore[i] for every 0 < i < count where a word starts at cps[i]. All cps must be Thai and
+// count <= MAX_RUN_CHARS. Text not covered by the dictionary is kept whole between the words around it.
+void markBreaks(const uint32_t* cps, size_t count, bool* breakBefore);
+
+}  // namespace ThaiWordBreaker
@@ -0,0 +1,8811 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../SerializedWordTrie.h"
+
+// Auto-generated by generate_word_break_trie.py from 26383 words. Do not edit manually.
+alignas(4) constexpr uint8_t th_words_trie_data[] = {
+    0xA0, 0x21, 0x01, 0x01, 0x21, 0x32, 0x03, 0x21, 0x19, 0x03, 0x21, 0x07, 0x0A, 0x21, 0x32, 0x03,
+    0x21, 0x49, 0x03, 0x21, 0x1B, 0x13, 0x21, 0x39, 0x03, 0x21, 0x39, 0x19, 0x21, 0x4C, 0x1C, 0x21,
+    0x11, 0x03, 0x21, 0x13, 0x03, 0x21, 0x31, 0x03, 0x21, 0x20, 0x03, 0x21, 0x18, 0x03, 0xA5, 0x02,
+    0x0A, 0x18, 0x2B, 0x38, 0x27, 0x1E, 0x18, 0x15, 0x03, 0x21, 0x19, 0x39, 0x22, 0x07, 0x23, 0x3C,
+    0x3C, 0x22, 0x2D, 0x32, 0x08, 0x05, 0x21, 0x23, 0x46, 0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0x21,
+    0x14, 0x4F, 0x21, 0x31, 0x03, 0x21, 0x2D, 0x55, 0x21, 0x49, 0x03, 0x21, 0x32, 0x22, 0x21, 0x25,
+    0x5E, 0x22, 0x35, 0x38, 0x61, 0x03, 0x21, 0x32, 0x66, 0x21, 0x23, 0x03, 0x21, 0x22, 0x33, 0x21,
+    0x35, 0x03, 0x21, 0x27, 0x03, 0x22, 0x47, 0x4A, 0x74, 0x74, 0x22, 0x01, 0x15, 0x08, 0x05, 0x21,
+    0x49, 0x7F, 0x21, 0x01, 0x03, 0x21, 0x28, 0x85, 0x21, 0x32, 0x03, 0x21, 0x25, 0x03, 0x21, 0x23,
+    0x03, 0x21, 0x48, 0x91, 0x22, 0x01, 0x09, 0x06, 0x03, 0xAC, 0x01, 0x04, 0x08, 0x09, 0x1E, 0x25,
+    0x27, 0x2A, 0x2B, 0x40, 0x42, 0x44, 0x58, 0x89, 0x4D, 0x95, 0x47, 0x41, 0x3E, 0x38, 0x30, 0x1F,
+    0x17, 0x05, 0xA1, 0x01, 0x6C, 0x21, 0x15, 0x6F, 0x21, 0x31, 0x03, 0x21, 0x22, 0xBB, 0x22, 0x32,
+    0x39, 0x03, 0x2D, 0x21, 0x21, 0x05, 0x21, 0x35, 0xC6, 0x21, 0x1E, 0x03, 0x21, 0x21, 0x03, 0xA3,
+    0x1A, 0x2B, 0x38, 0x17, 0x0C, 0x03, 0xA1, 0x1C, 0x78, 0x21, 0x01, 0x03, 0x22, 0x34, 0x38, 0xDC,
+    0x03, 0x21, 0x16, 0x7B, 0x21, 0x15, 0x03, 0x21, 0x31, 0x03, 0xA1, 0x19, 0x03, 0x21, 0x19, 0x03,
+    0x21, 0x34, 0x03, 0x21, 0x23, 0xD7, 0x21, 0x32, 0x03, 0x21, 0x01, 0x03, 0x21, 0x34, 0x03, 0x21,
+    0x35, 0x6E, 0x21, 0x31, 0xC9, 0x41, 0x27, 0x01, 0x05, 0x21, 0x31, 0x04, 0x41, 0x2D, 0x01, 0x02,
+    0x21, 0x37, 0x04, 0x21, 0x25, 0x03, 0x21, 0x2B, 0x03, 0xA4, 0x02, 0x14, 0x2B, 0x40, 0x1A, 0x17,
+    0x10, 0x03, 0x21, 0x25, 0x5C, 0x21, 0x15, 0xBF, 0xA1, 0x15, 0xC2, 0x22, 0x38, 0x39, 0x06, 0x03,
+    0x22, 0x0A, 0x0D, 0x0E, 0x05, 0x21, 0x0D, 0x05, 0x21, 0x32, 0xF2, 0x21, 0x01, 0x03, 0x21, 0x34,
+    0x03, 0x21, 0x2B, 0x09, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x22, 0x18, 0x20,
+    0x0F, 0x03, 0x21, 0x0D, 0xEC, 0x21, 0x0D, 0x03, 0x21, 0x31, 0x03, 0xA1, 0x2A, 0x03, 0x21, 0x32,
+    0x03, 0x21, 0x01, 0x03, 0x22, 0x34, 0x35, 0x3F, 0x3C, 0x21, 0x17, 0x05, 0x21, 0x27, 0x03, 0x24,
+    0x31, 0x32, 0x34, 0x40, 0x3A, 0x22, 0x0E, 0x03, 0x41, 0x19, 0x01, 0x12, 0x21, 0x2A, 0x04, 0x21,
+    0x17, 0x03, 0xA1, 0x40, 0x03, 0x21, 0x04, 0x03, 0x41, 0x02, 0x01, 0x88, 0x22, 0x31, 0x38, 0x07,
+    0x04, 0xA1, 0x21, 0x05, 0x21, 0x32, 0x03, 0x41, 0x14, 0x01, 0x31, 0x21, 0x32, 0x04, 0xC2, 0x20,
+    0x32, 0x00, 0x03, 0x01, 0x9E, 0x21, 0x10, 0x07, 0x21, 0x29, 0x03, 0xC2, 0x01, 0x34, 0x01, 0xAB,
+    0x00, 0x03, 0x21, 0x23, 0xEC, 0x21, 0x38, 0x03, 0xA1, 0x1A, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23,
+    0x03, 0x21, 0x17, 0x03, 0x42, 0x19, 0x25, 0x00, 0x03, 0x01, 0xC4, 0xC8, 0x0E, 0x0F, 0x14, 0x17,
+    0x32, 0x34, 0x35, 0x39, 0x01, 0xCB, 0x01, 0xCB, 0x01, 0x70, 0x01, 0xB2, 0x01, 0x6D, 0x00, 0x07,
+    0x01, 0x3A, 0x01, 0x85, 0x21, 0x15, 0xE2, 0x21, 0x34, 0x03, 0x41, 0x17, 0x01, 0xE9, 0x21, 0x25,
+    0x04, 0x21, 0x42, 0x03, 0x21, 0x11, 0x03, 0xC1, 0x28, 0x01, 0xF7, 0xA1, 0x32, 0x04, 0x41, 0x17,
+    0x01, 0xFE, 0x41, 0x25, 0x01, 0x7D, 0xA4, 0x13, 0x25, 0x38, 0x40, 0x12, 0x0B, 0x08, 0x04, 0x41,
+    0x21, 0x02, 0x0F, 0x21, 0x04, 0x04, 0xA1, 0x32, 0x03, 0x43, 0x0A, 0x0E, 0x0F, 0x02, 0x19, 0x00,
+    0x03, 0x02, 0x19, 0x41, 0x31, 0x02, 0x19, 0xA1, 0x02, 0x04, 0x41, 0x32, 0x01, 0x6F, 0x21, 0x01,
+    0x04, 0x41, 0x08, 0x02, 0x31, 0x21, 0x34, 0x04, 0xC2, 0x01, 0x4C, 0x00, 0x03, 0x02, 0x38, 0xA1,
+    0x22, 0x07, 0x43, 0x11, 0x34, 0x35, 0x02, 0x26, 0x01, 0x49, 0x00, 0x03, 0x41, 0x37, 0x01, 0xF7,
+    0x21, 0x25, 0x04, 0x21, 0x01, 0x03, 0x41, 0x01, 0x01, 0xC5, 0xA2, 0x40, 0x41, 0x07, 0x04, 0xC1,
+    0x17, 0x01, 0xF9, 0xC1, 0x39, 0x02, 0x1D, 0x41, 0x18, 0x02, 0x4B, 0x21, 0x19, 0x04, 0x41, 0x38,
+    0x02, 0x52, 0x21, 0x18, 0x04, 0x21, 0x19, 0x03, 0x22, 0x31, 0x34, 0x0D, 0x03, 0x21, 0x38, 0x6E,
+    0x41, 0x17, 0x02, 0x25, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x25, 0x03,
+    0x41, 0x48, 0x02, 0x2A, 0x41, 0x21, 0x02, 0x78, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03, 0xC5, 0x0A,
+    0x17, 0x18, 0x19, 0x27, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x03, 0x02, 0x38, 0x00, 0x7B, 0x43, 0x07,
+    0x0E, 0x28, 0x02, 0xAE, 0x02, 0xAE, 0x02, 0xAE, 0x42, 0x07, 0x14, 0x02, 0xB8, 0x02, 0xB8, 0x21,
+    0x34, 0x07, 0x42, 0x32, 0x4C, 0x02, 0xC2, 0x02, 0xC2, 0x41, 0x04, 0x02, 0x6B, 0x21, 0x38, 0x04,
+    0xC1, 0x23, 0x02, 0xB4, 0x21, 0x32, 0x04, 0x21, 0x01, 0x03, 0xC3, 0x22, 0x32, 0x34, 0x00, 0x0D,
+    0x02, 0xDA, 0x00, 0x03, 0x41, 0x38, 0x02, 0xE4, 0x41, 0x34, 0x02, 0xE7, 0x21, 0x2A, 0x04, 0x43,
+    0x32, 0x34, 0x39, 0x00, 0x03, 0x02, 0xA0, 0x02, 0xA9, 0xC1, 0x30, 0x02, 0xF9, 0x21, 0x23, 0x04,
+    0x21, 0x38, 0x03, 0xC1, 0x13, 0x02, 0xE7, 0x42, 0x23, 0x32, 0x00, 0x04, 0x02, 0xC1, 0x41, 0x15,
+    0x03, 0x0E, 0x21, 0x32, 0x04, 0x21, 0x27, 0x03, 0x41, 0x16, 0x03, 0x18, 0x21, 0x31, 0xA7, 0x41,
+    0x18, 0x02, 0x59, 0x21, 0x34, 0x04, 0x41, 0x34, 0x03, 0x0A, 0x21, 0x18, 0x04, 0x21, 0x17, 0x03,
+    0x21, 0x34, 0x03, 0x41, 0x1E, 0x03, 0x33, 0x21, 0x35, 0x04, 0x43, 0x0A, 0x18, 0x23, 0x00, 0x03,
+    0x01, 0xFC, 0x03, 0x3A, 0x41, 0x27, 0x02, 0xFE, 0xC9, 0x01, 0x0A, 0x10, 0x1A, 0x1E, 0x27, 0x2A,
+    0x32, 0x40, 0x00, 0x41, 0x00, 0x33, 0x02, 0xED, 0x00, 0x30, 0x00, 0x2C, 0x00, 0x25, 0x00, 0x18,
+    0x00, 0x0E, 0x00, 0x04, 0x42, 0x35, 0x36, 0x03, 0x64, 0x03, 0x5A, 0x41, 0x30, 0x03, 0x6B, 0x41,
+    0x22, 0x03, 0x6E, 0x21, 0x35, 0x04, 0x41, 0x22, 0x03, 0x6C, 0x42, 0x2D, 0x35, 0x03, 0x7A, 0x00,
+    0x04, 0x44, 0x01, 0x08, 0x0A, 0x2D, 0x03, 0x32, 0x00, 0x0E, 0x00, 0x07, 0x03, 0x1B, 0x42, 0x01,
+    0x23, 0x03, 0x8E, 0x03, 0x8D, 0x43, 0x0B, 0x17, 0x2A, 0x03, 0x8B, 0x00, 0x07, 0x03, 0x8B, 0x42,
+    0x0A, 0x2B, 0x03, 0x9E, 0x02, 0xE4, 0x42, 0x01, 0x15, 0x03, 0x60, 0x03, 0x60, 0xD0, 0x01, 0x0A,
+    0x10, 0x13, 0x15, 0x1A, 0x1B, 0x1E, 0x21, 0x25, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x00, 0xFF,
+    0x00, 0xEE, 0x00, 0xEB, 0x00, 0xD3, 0x00, 0xC9, 0x00, 0xBE, 0x00, 0xAD, 0x01, 0x30, 0x00, 0x65,
+    0x00, 0x49, 0x00, 0x42, 0x01, 0x83, 0x00, 0x2C, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x07, 0x41, 0x49,
+    0x03, 0x83, 0x41, 0x34, 0x03, 0xD8, 0x21, 0x0A, 0x04, 0xA2, 0x1A, 0x40, 0x0B, 0x03, 0x46, 0x14,
+    0x19, 0x1A, 0x21, 0x22, 0x34, 0x03, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x00, 0x05, 0x03,
+    0xED, 0x21, 0x38, 0xD4, 0x41, 0x23, 0x04, 0x03, 0x21, 0x01, 0x04, 0xA1, 0x41, 0x03, 0x41, 0x2D,
+    0x03, 0x53, 0x21, 0x23, 0x04, 0xA1, 0x01, 0x03, 0x41, 0x1A, 0x04, 0x18, 0x21, 0x23, 0x04, 0x21,
+    0x01, 0x03, 0xA1, 0x41, 0x03, 0x41, 0x15, 0x04, 0x09, 0x21, 0x23, 0x04, 0x21, 0x44, 0x03, 0x21,
+    0x32, 0x03, 0x21, 0x25, 0x03, 0x21, 0x39, 0x03, 0x21, 0x0B, 0x03, 0xC6, 0x01, 0x07, 0x14, 0x1A,
+    0x21, 0x2A, 0x00, 0x30, 0x00, 0x26, 0x04, 0x3B, 0x00, 0x19, 0x04, 0x3B, 0x00, 0x03, 0x41, 0x4A,
+    0x03, 0xFF, 0x41, 0x48, 0x04, 0x19, 0xA2, 0x35, 0x38, 0x08, 0x04, 0x46, 0x23, 0x27, 0x2D, 0x31,
+    0x35, 0x39, 0x00, 0x05, 0x04, 0x0C, 0x04, 0x51, 0x04, 0x0C, 0x03, 0xDC, 0x03, 0xFD, 0x43, 0x19,
+    0x32, 0x38, 0x04, 0x6E, 0x03, 0xB3, 0x04, 0x6D, 0x21, 0x34, 0x26, 0x21, 0x07, 0x03, 0x21, 0x40,
+    0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x41, 0x48, 0x04, 0x80, 0x21, 0x07,
+    0x04, 0x21, 0x41, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x4B,
+    0x21, 0x41, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x22, 0x07, 0x19, 0x12,
+    0x03, 0x21, 0x2D, 0x05, 0x43, 0x01, 0x2D, 0x48, 0x00, 0x2D, 0x04, 0x65, 0x00, 0x03, 0x41, 0x39,
+    0x04, 0x85, 0x41, 0x49, 0x04, 0x5C, 0x42, 0x07, 0x27, 0x04, 0x60, 0x00, 0x04, 0xC3, 0x15, 0x19,
+    0x40, 0x04, 0x67, 0x00, 0x0F, 0x00, 0x07, 0x41, 0x41, 0x04, 0xCD, 0x21, 0x2D, 0x04, 0x41, 0x2B,
+    0x04, 0xC5, 0xC3, 0x01, 0x07, 0x19, 0x04, 0xE2, 0x00, 0x07, 0x00, 0x04, 0x41, 0x08, 0x02, 0xC2,
+    0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x41, 0x49, 0x04, 0xEF, 0x42, 0x34, 0x35,
+    0x00, 0x04, 0x04, 0x6C, 0xC2, 0x1A, 0x1B, 0x05, 0x03, 0x00, 0x07, 0x44, 0x01, 0x07, 0x14, 0x1A,
+    0x05, 0x0B, 0x05, 0x0B, 0x00, 0x15, 0x00, 0x07, 0x46, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x27, 0x05,
+    0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x41, 0x34, 0x04, 0xDC, 0x45,
+    0x01, 0x14, 0x1A, 0x23, 0x4B, 0x05, 0x2F, 0x05, 0x2F, 0x05, 0x2F, 0x00, 0x04, 0x04, 0x2A, 0x42,
+    0x49, 0x4B, 0x05, 0x3F, 0x05, 0x3F, 0x41, 0x34, 0x01, 0x2E, 0x21, 0x08, 0x04, 0x21, 0x30, 0x03,
+    0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x41, 0x4B, 0x05, 0x4C, 0x21, 0x34, 0x04, 0x21, 0x08, 0x03,
+    0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x41, 0x4B, 0x03, 0x5A, 0x21, 0x34, 0x04,
+    0x21, 0x08, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x22, 0x07, 0x21, 0x16,
+    0x03, 0x44, 0x01, 0x1A, 0x22, 0x4B, 0x05, 0x81, 0x00, 0x2E, 0x05, 0x81, 0x00, 0x05, 0x41, 0x4B,
+    0x05, 0x8E, 0x21, 0x35, 0x04, 0x21, 0x08, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01,
+    0x03, 0x43, 0x14, 0x49, 0x4B, 0x05, 0xA1, 0x05, 0xA1, 0x00, 0x03, 0xC1, 0x07, 0x05, 0xAB, 0x21,
+    0x32, 0x04, 0x41, 0x2D, 0x05, 0x79, 0x4D, 0x01, 0x07, 0x23, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35,
+    0x38, 0x39, 0x48, 0x49, 0x00, 0xE9, 0x05, 0xB6, 0x05, 0xB6, 0x00, 0xD4, 0x05, 0xB6, 0x00, 0xAB,
+    0x00, 0x9E, 0x00, 0x87, 0x00, 0x77, 0x00, 0x35, 0x00, 0x15, 0x00, 0x07, 0x00, 0x04, 0x41, 0x09,
+    0x05, 0xD4, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x1A,
+    0x03, 0x46, 0x07, 0x2D, 0x31, 0x35, 0x39, 0x48, 0x05, 0xF1, 0x05, 0xF0, 0x00, 0x03, 0x05, 0xF0,
+    0x05, 0xA2, 0x00, 0x3F, 0x43, 0x01, 0x19, 0x21, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x43, 0x07,
+    0x1A, 0x49, 0x06, 0x0E, 0x06, 0x0E, 0x05, 0xD5, 0x42, 0x01, 0x22, 0x06, 0x18, 0x06, 0x18, 0x41,
+    0x27, 0x05, 0x64, 0x21, 0x0A, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21,
+    0x21, 0x03, 0xC2, 0x01, 0x48, 0x06, 0x32, 0x00, 0x03, 0x47, 0x07, 0x27, 0x2D, 0x31, 0x32, 0x34,
+    0x38, 0x06, 0x39, 0x05, 0x7E, 0x00, 0x35, 0x00, 0x2B, 0x00, 0x21, 0x03, 0x81, 0x00, 0x07, 0x42,
+    0x01, 0x1A, 0x06, 0x4F, 0x06, 0x4F, 0x41, 0x0B, 0x01, 0x10, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x01, 0x03, 0x42, 0x07, 0x1A, 0x06, 0x63, 0x00, 0x03, 0x48, 0x27, 0x31, 0x32, 0x34, 0x35,
+    0x38, 0x39, 0x49, 0x05, 0xAF, 0x02, 0x52, 0x02, 0x52, 0x00, 0x1B, 0x05, 0xEB, 0x00, 0x07, 0x05,
+    0xD9, 0x06, 0x15, 0x42, 0x35, 0x38, 0x06, 0x83, 0x05, 0xB7, 0x42, 0x07, 0x19, 0x06, 0x8A, 0x06,
+    0x8A, 0xC3, 0x07, 0x19, 0x21, 0x06, 0x91, 0x06, 0x91, 0x06, 0x91, 0x41, 0x07, 0x06, 0x35, 0x21,
+    0x07, 0x04, 0x41, 0x25, 0x06, 0x95, 0x41, 0x37, 0x02, 0x54, 0x21, 0x25, 0x04, 0x21, 0x04, 0x03,
+    0x21, 0x49, 0x03, 0x21, 0x15, 0x03, 0xC2, 0x1E, 0x42, 0x06, 0x7D, 0x00, 0x03, 0x45, 0x01, 0x07,
+    0x14, 0x19, 0x29, 0x06, 0xBD, 0x00, 0x1B, 0x06, 0xBD, 0x00, 0x07, 0x06, 0xBD, 0x43, 0x01, 0x1A,
+    0x48, 0x06, 0xCD, 0x06, 0xCD, 0x06, 0xC3, 0x41, 0x14, 0x03, 0xEF, 0x21, 0x30, 0x04, 0x21, 0x23,
+    0x03, 0x21, 0x01, 0x03, 0xC3, 0x01, 0x1A, 0x21, 0x00, 0x03, 0x06, 0xE4, 0x06, 0xE4, 0x41, 0x33,
+    0x06, 0xEE, 0xC2, 0x01, 0x14, 0x02, 0xDA, 0x00, 0x04, 0x21, 0x01, 0x07, 0x42, 0x07, 0x32, 0x06,
+    0xFC, 0x06, 0xF2, 0x4C, 0x01, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x49,
+    0x07, 0x03, 0x00, 0x79, 0x00, 0x72, 0x00, 0x64, 0x00, 0x46, 0x00, 0x36, 0x06, 0x72, 0x06, 0xF9,
+    0x02, 0xEB, 0x00, 0x1F, 0x00, 0x0A, 0x00, 0x07, 0x42, 0x01, 0x49, 0x07, 0x28, 0x06, 0x23, 0x43,
+    0x01, 0x1A, 0x4A, 0x07, 0x2F, 0x07, 0x2F, 0x06, 0xE0, 0x41, 0x49, 0x07, 0x00, 0x21, 0x23, 0x04,
+    0x21, 0x2D, 0x03, 0x21, 0x37, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x41, 0x34, 0x02, 0x53,
+    0x21, 0x15, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x42, 0x07, 0x19, 0x00,
+    0x03, 0x07, 0x5C, 0x42, 0x01, 0x49, 0x07, 0x63, 0x00, 0x07, 0x41, 0x15, 0x02, 0xE0, 0x21, 0x41,
+    0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x03, 0x42, 0x2D, 0x32,
+    0x00, 0x03, 0x06, 0xC2, 0x41, 0x22, 0x05, 0x75, 0x21, 0x49, 0x04, 0x21, 0x35, 0x03, 0x21, 0x15,
+    0x03, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x21, 0x03,
+    0x42, 0x27, 0x2D, 0x00, 0x03, 0x07, 0xA0, 0x41, 0x2D, 0x03, 0x8F, 0x4A, 0x23, 0x31, 0x32, 0x34,
+    0x37, 0x38, 0x39, 0x48, 0x49, 0x4A, 0x00, 0xBD, 0x00, 0x83, 0x07, 0xAA, 0x00, 0x7C, 0x00, 0x62,
+    0x00, 0x48, 0x03, 0x93, 0x00, 0x2E, 0x00, 0x0B, 0x00, 0x04, 0x42, 0x01, 0x19, 0x07, 0xCA, 0x07,
+    0xCA, 0x44, 0x14, 0x2D, 0x32, 0x34, 0x07, 0xD1, 0x03, 0xB9, 0x07, 0xC7, 0x00, 0x07, 0xC1, 0x25,
+    0x05, 0xB4, 0x41, 0x27, 0x07, 0xD8, 0x42, 0x19, 0x48, 0x07, 0xE6, 0x07, 0xDC, 0xC1, 0x2A, 0x07,
+    0x27, 0xC3, 0x0A, 0x22, 0x2B, 0x05, 0xC7, 0x00, 0x04, 0x06, 0xE5, 0x41, 0x25, 0x07, 0x95, 0x21,
+    0x1B, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x37, 0x03, 0x21, 0x2A, 0x03, 0x41, 0x1A, 0x07, 0xD2, 0x22,
+    0x40, 0x41, 0x07, 0x04, 0x21, 0x21, 0x05, 0xC3, 0x07, 0x48, 0x49, 0x08, 0x17, 0x00, 0x03, 0x08,
+    0x0D, 0x41, 0x2D, 0x06, 0x12, 0x41, 0x49, 0x06, 0x16, 0x21, 0x17, 0x04, 0x21, 0x41, 0x03, 0x21,
+    0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x42, 0x19, 0x21, 0x08, 0x38, 0x00, 0x03, 0x21,
+    0x2D, 0x07, 0x52, 0x01, 0x07, 0x14, 0x1A, 0x23, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x36,
+    0x37, 0x38, 0x39, 0x48, 0x49, 0x08, 0x42, 0x00, 0x64, 0x08, 0x42, 0x08, 0x42, 0x00, 0x60, 0x07,
+    0x87, 0x08, 0x41, 0x08, 0x42, 0x00, 0x5C, 0x00, 0x51, 0x08, 0x42, 0x08, 0x38, 0x08, 0x38, 0x04,
+    0x2A, 0x00, 0x2B, 0x07, 0xC3, 0x00, 0x21, 0x00, 0x03, 0x44, 0x01, 0x27, 0x31, 0x35, 0x08, 0x79,
+    0x08, 0x40, 0x01, 0x40, 0x07, 0xFA, 0xC1, 0x04, 0x06, 0x5C, 0xC1, 0x01, 0x07, 0x52, 0x43, 0x19,
+    0x22, 0x23, 0x00, 0x04, 0x08, 0x8E, 0x08, 0x8E, 0x42, 0x01, 0x07, 0x08, 0x98, 0x08, 0x98, 0x42,
+    0x14, 0x17, 0x08, 0x9F, 0x08, 0x9F, 0x43, 0x01, 0x22, 0x25, 0x08, 0xA6, 0x08, 0xA6, 0x08, 0xA6,
+    0xC2, 0x14, 0x25, 0x08, 0xB0, 0x08, 0xB0, 0x43, 0x07, 0x21, 0x23, 0x08, 0xB7, 0x08, 0xB7, 0x07,
+    0xF1, 0x42, 0x19, 0x23, 0x08, 0xC1, 0x08, 0xC1, 0x4D, 0x01, 0x16, 0x27, 0x2D, 0x30, 0x31, 0x32,
+    0x34, 0x35, 0x37, 0x38, 0x39, 0x48, 0x00, 0x42, 0x08, 0xC8, 0x00, 0x3A, 0x00, 0x30, 0x08, 0xC8,
+    0x00, 0x29, 0x00, 0x22, 0x00, 0x18, 0x08, 0x37, 0x08, 0x73, 0x00, 0x11, 0x00, 0x07, 0x08, 0x62,
+    0x41, 0x23, 0x06, 0x60, 0x21, 0x1B, 0x04, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x49, 0x03, 0x21, 0x35, 0x03, 0x41, 0x49, 0x08, 0x4E, 0x21, 0x35, 0x04,
+    0x21, 0x1B, 0x03, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21,
+    0x27, 0x03, 0x21, 0x49, 0x03, 0x41, 0x1B, 0x08, 0xA6, 0x21, 0x41, 0x04, 0x21, 0x30, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x2D, 0x03, 0x47, 0x23, 0x31, 0x33, 0x38, 0x48, 0x49, 0x4B,
+    0x00, 0x32, 0x00, 0x16, 0x09, 0x38, 0x09, 0x37, 0x02, 0x4A, 0x00, 0x03, 0x08, 0x2C, 0x41, 0x32,
+    0x07, 0x3F, 0x21, 0x25, 0x04, 0x21, 0x1C, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01,
+    0x03, 0x21, 0x35, 0x03, 0x44, 0x21, 0x25, 0x32, 0x35, 0x09, 0x64, 0x00, 0x03, 0x09, 0x2B, 0x09,
+    0x63, 0x42, 0x27, 0x34, 0x09, 0x38, 0x01, 0x4C, 0x41, 0x2B, 0x07, 0x69, 0xA1, 0x42, 0x04, 0x44,
+    0x01, 0x07, 0x14, 0x19, 0x09, 0x7F, 0x00, 0x03, 0x09, 0x7F, 0x09, 0x7F, 0xC1, 0x01, 0x09, 0x8C,
+    0x42, 0x48, 0x49, 0x07, 0x81, 0x09, 0x86, 0x47, 0x23, 0x2D, 0x31, 0x32, 0x35, 0x37, 0x38, 0x00,
+    0x26, 0x00, 0xFF, 0x00, 0x18, 0x00, 0x0B, 0x09, 0x18, 0x09, 0x42, 0x00, 0x07, 0x41, 0x22, 0x09,
+    0x5E, 0x21, 0x35, 0x04, 0x21, 0x1F, 0x03, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x14, 0x03, 0x41, 0x1F, 0x07, 0x9C, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x21, 0x03, 0x43, 0x31, 0x32, 0x39, 0x00, 0x13, 0x09, 0x1B, 0x00, 0x03,
+    0x41, 0x21, 0x07, 0xD1, 0x21, 0x41, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03,
+    0x42, 0x1A, 0x21, 0x09, 0xF0, 0x00, 0x03, 0x45, 0x25, 0x2D, 0x31, 0x36, 0x38, 0x09, 0xF7, 0x00,
+    0x07, 0x03, 0x6D, 0x09, 0xBE, 0x07, 0xF9, 0x42, 0x07, 0x32, 0x09, 0x05, 0x09, 0xC1, 0x41, 0x2A,
+    0x03, 0xEF, 0xC4, 0x07, 0x14, 0x2B, 0x40, 0x0A, 0x12, 0x0A, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x41,
+    0x22, 0x07, 0xD3, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x01, 0x03, 0x41,
+    0x2D, 0x03, 0xA5, 0x44, 0x32, 0x34, 0x36, 0x48, 0x00, 0x21, 0x0A, 0x32, 0x00, 0x07, 0x00, 0x04,
+    0x41, 0x2D, 0x0A, 0x3F, 0x42, 0x01, 0x21, 0x0A, 0x44, 0x0A, 0x44, 0x41, 0x1E, 0x0A, 0x05, 0x43,
+    0x14, 0x1A, 0x21, 0x0A, 0x4F, 0x0A, 0x4F, 0x00, 0x04, 0x42, 0x31, 0x38, 0x0A, 0x58, 0x0A, 0x58,
+    0xA1, 0x1E, 0x07, 0x41, 0x1E, 0x0A, 0x4A, 0x21, 0x21, 0x04, 0x41, 0x19, 0x0A, 0x4E, 0x42, 0x19,
+    0x48, 0x0A, 0x6E, 0x00, 0x04, 0x4B, 0x14, 0x1A, 0x2D, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x38,
+    0x39, 0x0A, 0x75, 0x0A, 0x75, 0x00, 0x31, 0x00, 0x26, 0x01, 0xEB, 0x00, 0x15, 0x0A, 0x6B, 0x0A,
+    0x75, 0x0A, 0x6B, 0x00, 0x0E, 0x00, 0x07, 0x41, 0x27, 0x08, 0x6D, 0x21, 0x30, 0x04, 0x21, 0x23,
+    0x03, 0xA1, 0x01, 0x03, 0x43, 0x14, 0x19, 0x22, 0x0A, 0xA4, 0x0A, 0xA4, 0x0A, 0xA4, 0x41, 0x32,
+    0x0A, 0x5F, 0x21, 0x27, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x46, 0x19,
+    0x31, 0x32, 0x34, 0x35, 0x48, 0x00, 0x1D, 0x0A, 0x6F, 0x00, 0x1A, 0x0A, 0x85, 0x00, 0x03, 0x0A,
+    0x58, 0x42, 0x01, 0x31, 0x0A, 0xD1, 0x0A, 0x16, 0x42, 0x15, 0x22, 0x09, 0x26, 0x0A, 0xD8, 0x41,
+    0x13, 0x0A, 0xC3, 0x21, 0x1B, 0x04, 0x43, 0x31, 0x32, 0x34, 0x00, 0x0E, 0x00, 0x03, 0x0A, 0xA0,
+    0x41, 0x49, 0x06, 0xE2, 0x42, 0x19, 0x22, 0x0A, 0xF4, 0x0A, 0xF4, 0x41, 0x15, 0x07, 0xD5, 0xC3,
+    0x19, 0x1A, 0x22, 0x00, 0x04, 0x0A, 0xFF, 0x0A, 0xFF, 0x41, 0x18, 0x08, 0x25, 0x21, 0x19, 0x04,
+    0x41, 0x2A, 0x07, 0x2E, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x42, 0x07, 0x19,
+    0x00, 0x03, 0x0B, 0x1D, 0x4F, 0x07, 0x19, 0x1A, 0x21, 0x23, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34,
+    0x37, 0x38, 0x39, 0x48, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x00, 0x34, 0x00, 0x30,
+    0x07, 0x0C, 0x0B, 0x24, 0x04, 0x9A, 0x00, 0x25, 0x00, 0x17, 0x0A, 0xCF, 0x00, 0x07, 0x07, 0x0C,
+    0x08, 0xFA, 0x41, 0x48, 0x0A, 0x46, 0x42, 0x2D, 0x33, 0x0B, 0x4C, 0x0B, 0x56, 0xC3, 0x01, 0x32,
+    0x48, 0x0B, 0x5D, 0x07, 0x45, 0x00, 0x07, 0x44, 0x31, 0x34, 0x38, 0x48, 0x06, 0xDD, 0x07, 0x4F,
+    0x07, 0x15, 0x03, 0x46, 0x41, 0x48, 0x09, 0x65, 0x42, 0x19, 0x21, 0x0B, 0x78, 0x0B, 0x78, 0x21,
+    0x2D, 0x07, 0x45, 0x14, 0x1A, 0x30, 0x34, 0x48, 0x0B, 0x82, 0x0B, 0x82, 0x0B, 0x82, 0x00, 0x0E,
+    0x00, 0x03, 0x42, 0x07, 0x21, 0x0B, 0x92, 0x0B, 0x92, 0x21, 0x48, 0x07, 0x21, 0x34, 0x03, 0x42,
+    0x07, 0x22, 0x0B, 0x9F, 0x0B, 0x9F, 0x42, 0x21, 0x48, 0x0B, 0xA6, 0x09, 0x97, 0x4A, 0x07, 0x19,
+    0x21, 0x22, 0x23, 0x27, 0x2D, 0x31, 0x32, 0x36, 0x00, 0x5B, 0x00, 0x50, 0x00, 0x46, 0x00, 0x2B,
+    0x00, 0x11, 0x0B, 0x74, 0x0B, 0xA3, 0x08, 0xF5, 0x00, 0x0E, 0x00, 0x07, 0x42, 0x1A, 0x21, 0x0B,
+    0xCC, 0x0B, 0xCC, 0x41, 0x27, 0x0B, 0x9A, 0x21, 0x48, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x30, 0x03,
+    0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x21, 0x01, 0x03, 0x42, 0x01, 0x14, 0x0B, 0xE9, 0x0B, 0xE9,
+    0x49, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x36, 0x37, 0x38, 0x49, 0x0B, 0x92, 0x00, 0x24, 0x00, 0x0A,
+    0x0B, 0xB7, 0x0B, 0xA1, 0x00, 0x07, 0x0B, 0xA1, 0x02, 0x64, 0x0B, 0x8A, 0x41, 0x23, 0x09, 0x24,
+    0x41, 0x2D, 0x0B, 0xC1, 0x21, 0x07, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03,
+    0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x41, 0x08, 0x08, 0x44, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x42, 0x07, 0x14, 0x0C, 0x36, 0x00, 0x03, 0x42, 0x1A, 0x27,
+    0x0C, 0x3D, 0x0C, 0x3D, 0x21, 0x22, 0x07, 0x42, 0x22, 0x4A, 0x0B, 0x42, 0x00, 0x03, 0x44, 0x32,
+    0x34, 0x35, 0x48, 0x0C, 0x4E, 0x00, 0x18, 0x00, 0x07, 0x0B, 0xE8, 0x43, 0x01, 0x07, 0x14, 0x0C,
+    0x5B, 0x0C, 0x5B, 0x0C, 0x5B, 0x44, 0x2D, 0x32, 0x35, 0x49, 0x0C, 0x65, 0x0C, 0x65, 0x08, 0xEF,
+    0x0B, 0xFF, 0xC4, 0x2D, 0x34, 0x47, 0x49, 0x0C, 0x72, 0x0C, 0x68, 0x0C, 0x39, 0x0C, 0x0C, 0x42,
+    0x14, 0x21, 0x0C, 0x7F, 0x0C, 0x7F, 0x42, 0x22, 0x49, 0x00, 0x07, 0x0B, 0xCB, 0x42, 0x2D, 0x48,
+    0x0C, 0x8C, 0x0B, 0x81, 0x42, 0x07, 0x32, 0x0C, 0x94, 0x0C, 0x94, 0x46, 0x01, 0x34, 0x35, 0x37,
+    0x47, 0x49, 0x0C, 0x9B, 0x0C, 0x4C, 0x00, 0x15, 0x00, 0x0E, 0x0C, 0x62, 0x00, 0x07, 0x41, 0x49,
+    0x0B, 0xA2, 0x44, 0x07, 0x32, 0x37, 0x47, 0x0C, 0xB2, 0x09, 0x47, 0x00, 0x04, 0x0C, 0x79, 0x21,
+    0x22, 0xF3, 0x43, 0x35, 0x37, 0x48, 0x00, 0x03, 0x07, 0x10, 0x0C, 0xC2, 0x42, 0x14, 0x19, 0x0C,
+    0xCC, 0x0C, 0xCC, 0x42, 0x22, 0x49, 0x00, 0x07, 0x0C, 0x18, 0x46, 0x07, 0x0D, 0x19, 0x32, 0x35,
+    0x37, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x00, 0x07, 0x00, 0x2C, 0x43, 0x32, 0x35,
+    0x4B, 0x09, 0xF4, 0x03, 0xE4, 0x0C, 0x87, 0x41, 0x34, 0x0C, 0x72, 0x41, 0x48, 0x04, 0xDA, 0x43,
+    0x25, 0x32, 0x37, 0x00, 0x08, 0x09, 0x94, 0x00, 0x04, 0x41, 0x22, 0x08, 0x7F, 0x21, 0x2B, 0x04,
+    0x21, 0x41, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x2D, 0x03, 0x21,
+    0x49, 0x03, 0x42, 0x35, 0x37, 0x03, 0x75, 0x02, 0xE2, 0x41, 0x19, 0x09, 0x04, 0x21, 0x32, 0x04,
+    0xA1, 0x2A, 0x03, 0x41, 0x22, 0x0C, 0xED, 0x22, 0x21, 0x35, 0x07, 0x04, 0x41, 0x22, 0x04, 0x7B,
+    0x41, 0x2A, 0x0B, 0x16, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x19, 0x03,
+    0x45, 0x14, 0x35, 0x37, 0x47, 0x48, 0x0D, 0x50, 0x00, 0x14, 0x03, 0x10, 0x00, 0x03, 0x0C, 0xEA,
+    0x41, 0x47, 0x0B, 0x2F, 0x41, 0x21, 0x0C, 0xD3, 0x21, 0x2B, 0x04, 0x21, 0x41, 0x03, 0x21, 0x30,
+    0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x14, 0x03, 0x42, 0x19, 0x32, 0x0D, 0x7A, 0x0D,
+    0x7A, 0x22, 0x47, 0x48, 0x0A, 0x07, 0x43, 0x19, 0x21, 0x27, 0x00, 0x26, 0x00, 0x05, 0x0A, 0xF6,
+    0x42, 0x1A, 0x32, 0x0D, 0x90, 0x0D, 0x90, 0x56, 0x01, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15,
+    0x16, 0x17, 0x1A, 0x1B, 0x1E, 0x1F, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x2B, 0x2D, 0x01, 0x8B,
+    0x01, 0x74, 0x01, 0x49, 0x01, 0x3C, 0x01, 0x32, 0x01, 0x25, 0x00, 0xFC, 0x00, 0xE5, 0x08, 0x51,
+    0x00, 0xD5, 0x00, 0xBD, 0x00, 0xAA, 0x00, 0x98, 0x03, 0xE6, 0x00, 0x78, 0x0D, 0x28, 0x00, 0x75,
+    0x0D, 0x5E, 0x00, 0x60, 0x00, 0x47, 0x00, 0x11, 0x00, 0x07, 0x42, 0x07, 0x30, 0x0D, 0xDA, 0x0D,
+    0xDA, 0x41, 0x31, 0x09, 0xC9, 0xC2, 0x27, 0x30, 0x00, 0x04, 0x0D, 0xE5, 0x42, 0x01, 0x30, 0x0D,
+    0xEC, 0x0D, 0xEC, 0xC1, 0x07, 0x0D, 0x8D, 0x43, 0x01, 0x30, 0x48, 0x00, 0x04, 0x0D, 0xF7, 0x0D,
+    0xF7, 0x42, 0x14, 0x49, 0x0E, 0x01, 0x0E, 0x01, 0x41, 0x23, 0x0D, 0xFE, 0x21, 0x25, 0x2B, 0xC4,
+    0x07, 0x15, 0x2A, 0x30, 0x0E, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x0E, 0x0F, 0xC4, 0x19, 0x22, 0x23,
+    0x25, 0x0E, 0x1C, 0x09, 0x92, 0x02, 0xA8, 0x09, 0x92, 0x45, 0x01, 0x14, 0x1A, 0x21, 0x49, 0x0E,
+    0x29, 0x0E, 0x29, 0x0E, 0x29, 0x0E, 0x29, 0x0E, 0x29, 0x4F, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15,
+    0x17, 0x1A, 0x1B, 0x1E, 0x21, 0x27, 0x2A, 0x2B, 0x2D, 0x0A, 0xCE, 0x0E, 0x38, 0x00, 0x5F, 0x0B,
+    0x40, 0x0A, 0xCE, 0x00, 0x54, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x38, 0x0E, 0x2F, 0x0C, 0x2A, 0x0E,
+    0x00, 0x00, 0x2A, 0x00, 0x1D, 0x00, 0x10, 0xC2, 0x17, 0x2D, 0x0D, 0x5B, 0x0E, 0x66, 0x42, 0x19,
+    0x21, 0x0E, 0x6E, 0x00, 0x07, 0x41, 0x09, 0x0E, 0x74, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x01, 0x03, 0x42, 0x01, 0x21, 0x00, 0x03, 0x0E, 0x85, 0x41, 0x14, 0x0E, 0x8B,
+    0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x44, 0x01, 0x07, 0x14,
+    0x19, 0x00, 0x03, 0x0E, 0x9C, 0x0E, 0x9C, 0x0E, 0x9C, 0x42, 0x01, 0x23, 0x0E, 0xA9, 0x0E, 0x9F,
+    0xC1, 0x48, 0x0E, 0xA6, 0x43, 0x21, 0x22, 0x49, 0x0E, 0xB4, 0x00, 0x04, 0x0E, 0xB4, 0x4D, 0x07,
+    0x08, 0x09, 0x0A, 0x14, 0x15, 0x16, 0x1A, 0x1B, 0x23, 0x25, 0x2A, 0x2B, 0x0E, 0xBD, 0x00, 0x50,
+    0x00, 0x39, 0x0E, 0xBD, 0x00, 0x22, 0x0E, 0x85, 0x0E, 0x85, 0x0C, 0xAF, 0x00, 0x15, 0x0E, 0xBD,
+    0x0E, 0xB4, 0x0E, 0xB4, 0x00, 0x0A, 0xC1, 0x25, 0x0B, 0x04, 0x41, 0x0A, 0x0C, 0xC0, 0x47, 0x14,
+    0x15, 0x17, 0x19, 0x23, 0x2A, 0x2D, 0x00, 0x08, 0x0E, 0xA8, 0x00, 0x04, 0x0E, 0xEE, 0x0E, 0xEE,
+    0x0E, 0xEE, 0x0E, 0xEE, 0xDF, 0x21, 0x01, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0E, 0x14, 0x15,
+    0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A,
+    0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x0A, 0xA9, 0x0A, 0x96, 0x0A, 0x50, 0x09, 0x4E, 0x09,
+    0x13, 0x08, 0xCB, 0x08, 0x9A, 0x08, 0x81, 0x08, 0x01, 0x07, 0x59, 0x07, 0x33, 0x06, 0xC2, 0x06,
+    0x8B, 0x06, 0x3C, 0x05, 0xCC, 0x05, 0xA0, 0x05, 0x6D, 0x05, 0x2E, 0x05, 0x0D, 0x04, 0xD1, 0x04,
+    0xC4, 0x04, 0x8F, 0x04, 0x46, 0x04, 0x33, 0x04, 0x1E, 0x03, 0xE0, 0x03, 0x57, 0x03, 0x14, 0x01,
+    0x6D, 0x00, 0xCB, 0x00, 0x46, 0x0E, 0xB5, 0x00, 0x16, 0xC1, 0x02, 0x0E, 0xA3, 0xC1, 0x4C, 0x0F,
+    0x6D, 0x42, 0x11, 0x22, 0x00, 0x04, 0x0F, 0x55, 0x46, 0x01, 0x07, 0x13, 0x19, 0x1A, 0x21, 0x00,
+    0x0F, 0x0F, 0x78, 0x00, 0x07, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x41, 0x39, 0x0F, 0x2D, 0xA1,
+    0x17, 0x04, 0x42, 0x01, 0x04, 0x0F, 0x92, 0x0F, 0x92, 0xC2, 0x1F, 0x34, 0x0C, 0xB1, 0x00, 0x07,
+    0xC1, 0x0A, 0x0F, 0x90, 0x41, 0x48, 0x0F, 0x97, 0xA1, 0x14, 0x04, 0x4B, 0x01, 0x07, 0x14, 0x19,
+    0x1A, 0x1F, 0x21, 0x22, 0x25, 0x27, 0x2A, 0x0F, 0xAB, 0x0F, 0xAB, 0x0F, 0xAB, 0x0F, 0xAB, 0x00,
+    0x1C, 0x00, 0x12, 0x00, 0x0B, 0x0F, 0xAB, 0x0F, 0xAB, 0x00, 0x03, 0x0C, 0xC3, 0x41, 0x34, 0x0E,
+    0xC8, 0x21, 0x23, 0x04, 0xA1, 0x01, 0x03, 0x21, 0x01, 0x06, 0xC1, 0x35, 0x0F, 0xDA, 0x4E, 0x01,
+    0x07, 0x0A, 0x13, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x27, 0x48, 0x49, 0x4A, 0x00, 0x0A, 0x00,
+    0x07, 0x0F, 0xDE, 0x0F, 0x18, 0x0F, 0xDE, 0x0F, 0x23, 0x00, 0x04, 0x0F, 0xDE, 0x0F, 0xDE, 0x0F,
+    0x78, 0x0F, 0xDE, 0x04, 0x4C, 0x0E, 0xD9, 0x07, 0x46, 0x42, 0x14, 0x22, 0x10, 0x09, 0x10, 0x09,
+    0x21, 0x32, 0x07, 0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x41, 0x14, 0x0F, 0xFD, 0x21, 0x19, 0x04,
+    0x21, 0x25, 0x03, 0x21, 0x41, 0x03, 0xC9, 0x01, 0x0B, 0x11, 0x14, 0x18, 0x19, 0x29, 0x2A, 0x4A,
+    0x10, 0x26, 0x10, 0x26, 0x0F, 0xC0, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x03, 0x10, 0x26, 0x10, 0x26,
+    0x0F, 0xD7, 0x41, 0x4A, 0x10, 0x42, 0x21, 0x39, 0x04, 0x21, 0x23, 0x03, 0xA1, 0x01, 0x03, 0x41,
+    0x19, 0x0E, 0x97, 0x41, 0x32, 0x0F, 0x31, 0x41, 0x29, 0x0E, 0x48, 0x41, 0x21, 0x0F, 0xF5, 0x41,
+    0x11, 0x0F, 0xF9, 0x21, 0x35, 0x04, 0x21, 0x23, 0x03, 0x41, 0x15, 0x0F, 0xFA, 0x21, 0x40, 0x04,
+    0x21, 0x2A, 0x03, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x41, 0x04, 0x10, 0x33, 0x21, 0x19, 0x04,
+    0x21, 0x32, 0x03, 0x21, 0x2B, 0x03, 0x41, 0x25, 0x0E, 0x55, 0x21, 0x40, 0x04, 0x21, 0x25, 0x03,
+    0x21, 0x34, 0x03, 0xC5, 0x01, 0x04, 0x21, 0x27, 0x2F, 0x00, 0x2D, 0x00, 0x1D, 0x00, 0x10, 0x00,
+    0x03, 0x10, 0x93, 0x21, 0x1E, 0x10, 0x23, 0x01, 0x02, 0x17, 0x4F, 0x4B, 0x03, 0xA3, 0x18, 0x1E,
+    0x40, 0x5E, 0x5A, 0x07, 0x41, 0x13, 0x10, 0xB4, 0x21, 0x38, 0x04, 0x21, 0x04, 0x03, 0x21, 0x34,
+    0x03, 0x41, 0x29, 0x10, 0xA5, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03, 0x21, 0x17, 0x03, 0x21, 0x34,
+    0x03, 0xA2, 0x18, 0x1E, 0x13, 0x03, 0xA1, 0x32, 0x05, 0x41, 0x23, 0x0B, 0x93, 0xA1, 0x01, 0x04,
+    0x41, 0x34, 0x05, 0x6C, 0x21, 0x23, 0x04, 0x21, 0x01, 0x03, 0x21, 0x21, 0x03, 0xC9, 0x01, 0x07,
+    0x13, 0x19, 0x1A, 0x22, 0x48, 0x49, 0x4A, 0x00, 0xA1, 0x00, 0x40, 0x00, 0x17, 0x10, 0xED, 0x00,
+    0x10, 0x10, 0xED, 0x05, 0x75, 0x00, 0x03, 0x10, 0xDA, 0xC3, 0x14, 0x21, 0x48, 0x11, 0x09, 0x11,
+    0x09, 0x0E, 0xFA, 0x21, 0x01, 0xBC, 0x41, 0x4B, 0x0D, 0x08, 0x21, 0x23, 0x04, 0x21, 0x01, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x2D, 0x03, 0x43, 0x19, 0x21, 0x22, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26,
+    0x43, 0x2D, 0x32, 0x33, 0x00, 0x0A, 0x05, 0x91, 0x11, 0x30, 0x42, 0x19, 0x27, 0x11, 0x3A, 0x11,
+    0x3A, 0x43, 0x27, 0x2D, 0x32, 0x0F, 0x32, 0x11, 0x41, 0x00, 0x07, 0xDB, 0x01, 0x07, 0x0A, 0x13,
+    0x14, 0x19, 0x1A, 0x1E, 0x20, 0x21, 0x23, 0x27, 0x2A, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x38, 0x39, 0x40, 0x47, 0x48, 0x49, 0x0F, 0x32, 0x0F, 0x24, 0x0F, 0x1D, 0x0F, 0x09, 0x0E,
+    0xF1, 0x0E, 0xEC, 0x0E, 0xE8, 0x0E, 0xD3, 0x0E, 0xCE, 0x0E, 0xAD, 0x0D, 0x9E, 0x0D, 0x5D, 0x0D,
+    0x4A, 0x0D, 0x10, 0x02, 0x47, 0x01, 0xD3, 0x01, 0xA0, 0x11, 0x4B, 0x01, 0x6D, 0x01, 0x25, 0x11,
+    0x41, 0x00, 0x5E, 0x00, 0x42, 0x00, 0x38, 0x00, 0x28, 0x00, 0x1B, 0x00, 0x0A, 0xC1, 0x18, 0x11,
+    0x9D, 0x41, 0x01, 0x11, 0x3B, 0xC3, 0x32, 0x34, 0x35, 0x00, 0x08, 0x11, 0xA5, 0x00, 0x04, 0xC1,
+    0x32, 0x11, 0xAF, 0x43, 0x01, 0x22, 0x34, 0x11, 0x4D, 0x00, 0x04, 0x00, 0x12, 0xC1, 0x18, 0x10,
+    0x85, 0xC1, 0x01, 0x11, 0x5B, 0x22, 0x32, 0x35, 0x08, 0x04, 0x41, 0x22, 0x11, 0x64, 0x21, 0x17,
+    0x04, 0x21, 0x34, 0x03, 0x21, 0x27, 0x03, 0x42, 0x30, 0x32, 0x00, 0x03, 0x11, 0xD7, 0x43, 0x0E,
+    0x0F, 0x13, 0x00, 0x19, 0x11, 0x18, 0x00, 0x07, 0x44, 0x0A, 0x14, 0x15, 0x29, 0x11, 0xE8, 0x00,
+    0x43, 0x00, 0x35, 0x00, 0x0A, 0x42, 0x37, 0x48, 0x11, 0xBC, 0x09, 0xD4, 0x21, 0x25, 0x07, 0xC2,
+    0x01, 0x14, 0x00, 0x03, 0x0F, 0x17, 0x41, 0x17, 0x0F, 0x9F, 0x21, 0x38, 0x04, 0x43, 0x07, 0x21,
+    0x34, 0x12, 0x0D, 0x12, 0x0D, 0x0E, 0xEE, 0x41, 0x15, 0x11, 0x24, 0x21, 0x2A, 0x04, 0x21, 0x32,
+    0x03, 0x41, 0x23, 0x07, 0x42, 0x21, 0x01, 0x04, 0x21, 0x1B, 0x03, 0x41, 0x2D, 0x0F, 0x1D, 0x41,
+    0x1F, 0x11, 0xF6, 0x43, 0x14, 0x40, 0x44, 0x00, 0x08, 0x00, 0x04, 0x05, 0x0A, 0x21, 0x04, 0x0A,
+    0x46, 0x01, 0x07, 0x19, 0x22, 0x38, 0x42, 0x12, 0x40, 0x12, 0x40, 0x12, 0x40, 0x12, 0x40, 0x00,
+    0x18, 0x00, 0x03, 0x41, 0x38, 0x0A, 0x2E, 0x21, 0x25, 0x04, 0xA1, 0x01, 0x03, 0x42, 0x15, 0x17,
+    0x11, 0x5B, 0x12, 0x5D, 0x41, 0x25, 0x08, 0x24, 0x41, 0x22, 0x12, 0x4C, 0x21, 0x17, 0x04, 0x21,
+    0x34, 0x03, 0xA2, 0x01, 0x27, 0x0E, 0x03, 0x42, 0x01, 0x23, 0x12, 0x77, 0x12, 0x77, 0x21, 0x1E,
+    0x07, 0x49, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x27, 0x48, 0x49, 0x12, 0x81, 0x12, 0x81, 0x00,
+    0x27, 0x00, 0x24, 0x00, 0x0F, 0x00, 0x03, 0x12, 0x81, 0x12, 0x48, 0x01, 0x47, 0x41, 0x48, 0x0C,
+    0xEB, 0x21, 0x37, 0x04, 0x21, 0x25, 0x03, 0x21, 0x01, 0x03, 0xA1, 0x40, 0x03, 0xA1, 0x01, 0x49,
+    0x47, 0x01, 0x07, 0x14, 0x1A, 0x1B, 0x22, 0x42, 0x12, 0xB0, 0x12, 0xB0, 0x00, 0x06, 0x0F, 0x9E,
+    0x12, 0xB0, 0x00, 0x03, 0x09, 0x38, 0x41, 0x04, 0x12, 0xAA, 0x41, 0x37, 0x08, 0x8A, 0x21, 0x25,
+    0x04, 0x21, 0x01, 0x03, 0xA2, 0x01, 0x40, 0x70, 0x03, 0x42, 0x07, 0x21, 0x00, 0x05, 0x12, 0xD9,
+    0x43, 0x07, 0x48, 0x49, 0x00, 0x1A, 0x0C, 0x56, 0x00, 0x07, 0x41, 0x04, 0x12, 0xEA, 0x21, 0x38,
+    0x04, 0xC3, 0x1A, 0x22, 0x48, 0x12, 0xF1, 0x00, 0x03, 0x12, 0xF1, 0xC1, 0x04, 0x12, 0xDF, 0x42,
+    0x07, 0x49, 0x00, 0x04, 0x12, 0xF5, 0xC1, 0x23, 0x10, 0x89, 0x21, 0x21, 0x04, 0x42, 0x48, 0x49,
+    0x10, 0xFE, 0x00, 0x03, 0x41, 0x21, 0x10, 0x06, 0x21, 0x40, 0x04, 0x21, 0x32, 0x03, 0x41, 0x2A,
+    0x13, 0x1E, 0x21, 0x04, 0x04, 0x44, 0x17, 0x19, 0x42, 0x48, 0x00, 0x0A, 0x13, 0x25, 0x00, 0x03,
+    0x13, 0x25, 0x41, 0x47, 0x12, 0xE3, 0x42, 0x21, 0x2B, 0x00, 0x04, 0x12, 0x7B, 0x41, 0x15, 0x0F,
+    0x18, 0x21, 0x34, 0x04, 0xA1, 0x08, 0x03, 0x43, 0x07, 0x19, 0x21, 0x13, 0x47, 0x13, 0x47, 0x00,
+    0x03, 0x44, 0x19, 0x2D, 0x32, 0x33, 0x13, 0x51, 0x00, 0x0A, 0x12, 0x4C, 0x13, 0x51, 0x41, 0x44,
+    0x11, 0x60, 0x21, 0x33, 0x04, 0x21, 0x49, 0x03, 0x41, 0x21, 0x12, 0xE9, 0xA2, 0x19, 0x44, 0x07,
+    0x04, 0x21, 0x22, 0x05, 0x41, 0x28, 0x09, 0x0A, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03, 0x21, 0x17,
+    0x03, 0x21, 0x25, 0x03, 0x21, 0x38, 0x03, 0x41, 0x14, 0x05, 0xA6, 0x21, 0x30, 0x04, 0x41, 0x21,
+    0x11, 0x11, 0x21, 0x14, 0x04, 0x21, 0x31, 0x03, 0x41, 0x27, 0x11, 0x67, 0x21, 0x23, 0x04, 0x21,
+    0x33, 0x03, 0x21, 0x23, 0x24, 0x21, 0x17, 0x03, 0xA5, 0x08, 0x23, 0x27, 0x2A, 0x42, 0x24, 0x1D,
+    0x13, 0x09, 0x03, 0x41, 0x25, 0x0B, 0x8E, 0x21, 0x01, 0x04, 0x21, 0x41, 0x03, 0xC3, 0x07, 0x19,
+    0x21, 0x00, 0x15, 0x13, 0xBD, 0x00, 0x03, 0xC2, 0x21, 0x22, 0x13, 0xC7, 0x13, 0xC7, 0x41, 0x37,
+    0x13, 0x95, 0x42, 0x23, 0x25, 0x11, 0xA8, 0x00, 0x04, 0xA1, 0x01, 0x07, 0x24, 0x27, 0x2D, 0x32,
+    0x33, 0x6B, 0x1F, 0x15, 0x03, 0xD4, 0x14, 0x1A, 0x21, 0x22, 0x27, 0x28, 0x2B, 0x2D, 0x31, 0x32,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x44, 0x48, 0x49, 0x13, 0xE5, 0x13, 0xE5, 0x01, 0xE6,
+    0x01, 0xDB, 0x01, 0xD8, 0x01, 0xC7, 0x11, 0xBB, 0x01, 0xA5, 0x01, 0x64, 0x01, 0x35, 0x01, 0x05,
+    0x00, 0xF4, 0x00, 0xE6, 0x13, 0xAC, 0x00, 0xD8, 0x00, 0xC0, 0x00, 0xAF, 0x13, 0xE4, 0x00, 0x94,
+    0x00, 0x09, 0xC1, 0x02, 0x13, 0x20, 0xC1, 0x2D, 0x14, 0x0D, 0x41, 0x4A, 0x10, 0x12, 0x42, 0x31,
+    0x35, 0x00, 0x04, 0x03, 0xEC, 0xA1, 0x08, 0x07, 0x41, 0x27, 0x0F, 0xAE, 0x21, 0x01, 0x04, 0xA1,
+    0x41, 0x03, 0x41, 0x21, 0x13, 0xF3, 0x21, 0x30, 0x04, 0x41, 0x38, 0x0F, 0x50, 0xC3, 0x0A, 0x15,
+    0x1C, 0x00, 0x07, 0x00, 0x04, 0x13, 0xE7, 0x42, 0x32, 0x49, 0x14, 0x57, 0x0E, 0xA5, 0xC2, 0x15,
+    0x25, 0x00, 0x07, 0x14, 0x4E, 0x41, 0x23, 0x12, 0x19, 0x21, 0x04, 0x04, 0x21, 0x40, 0x03, 0xC4,
+    0x07, 0x14, 0x19, 0x27, 0x00, 0x22, 0x00, 0x11, 0x14, 0x6F, 0x00, 0x03, 0xC3, 0x07, 0x19, 0x27,
+    0x14, 0x7C, 0x14, 0x7C, 0x14, 0x7C, 0x21, 0x32, 0x0A, 0x4C, 0x14, 0x19, 0x21, 0x22, 0x30, 0x31,
+    0x32, 0x34, 0x35, 0x48, 0x49, 0x4A, 0x00, 0x67, 0x00, 0x63, 0x14, 0x89, 0x00, 0x54, 0x00, 0x4A,
+    0x08, 0xA0, 0x00, 0x1A, 0x14, 0x50, 0x14, 0x89, 0x0E, 0xDA, 0x00, 0x03, 0x14, 0x2E, 0xC1, 0x22,
+    0x14, 0x92, 0xC3, 0x32, 0x34, 0x35, 0x14, 0xB2, 0x02, 0x4A, 0x00, 0x04, 0x21, 0x23, 0x0A, 0x42,
+    0x15, 0x22, 0x00, 0x03, 0x0C, 0x35, 0x41, 0x34, 0x14, 0xC6, 0x21, 0x14, 0x04, 0x41, 0x23, 0x11,
+    0x9A, 0x21, 0x28, 0x04, 0x21, 0x32, 0x03, 0x41, 0x32, 0x14, 0x6E, 0x41, 0x1E, 0x11, 0xF7, 0x41,
+    0x13, 0x11, 0xAC, 0x22, 0x21, 0x23, 0x08, 0x04, 0xC3, 0x18, 0x30, 0x32, 0x00, 0x11, 0x14, 0xE8,
+    0x00, 0x05, 0x22, 0x13, 0x23, 0x1E, 0x0A, 0x46, 0x13, 0x21, 0x31, 0x32, 0x34, 0x35, 0x11, 0x8C,
+    0x14, 0x91, 0x00, 0x38, 0x0A, 0x14, 0x00, 0x2D, 0x00, 0x05, 0x41, 0x19, 0x0A, 0x0F, 0xC1, 0x23,
+    0x12, 0xFF, 0x21, 0x23, 0x04, 0xC2, 0x01, 0x13, 0x00, 0x03, 0x15, 0x15, 0x22, 0x32, 0x34, 0x12,
+    0x07, 0x41, 0x32, 0x03, 0x57, 0x21, 0x1B, 0x04, 0x21, 0x07, 0x03, 0x41, 0x13, 0x11, 0xC0, 0x21,
+    0x1B, 0x04, 0x22, 0x31, 0x32, 0x0A, 0x03, 0x42, 0x31, 0x38, 0x12, 0x04, 0x14, 0xFE, 0x42, 0x25,
+    0x31, 0x15, 0x3E, 0x15, 0x05, 0x41, 0x49, 0x14, 0x40, 0x21, 0x01, 0x04, 0xC4, 0x01, 0x17, 0x1E,
+    0x41, 0x11, 0x3E, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x03, 0xC2, 0x2B, 0x2D, 0x0D, 0xB2, 0x15, 0x58,
+    0x41, 0x01, 0x14, 0xA5, 0xC2, 0x19, 0x42, 0x15, 0x57, 0x00, 0x04, 0x41, 0x01, 0x15, 0x13, 0x41,
+    0x25, 0x0D, 0x74, 0x21, 0x34, 0x04, 0x41, 0x1F, 0x15, 0x76, 0x21, 0x4C, 0x04, 0x41, 0x22, 0x12,
+    0x12, 0x21, 0x4A, 0x04, 0x21, 0x35, 0x03, 0x21, 0x2D, 0x03, 0x41, 0x25, 0x12, 0x1F, 0x42, 0x01,
+    0x2B, 0x15, 0x8E, 0x00, 0x04, 0xCD, 0x01, 0x07, 0x0B, 0x14, 0x15, 0x1A, 0x1B, 0x21, 0x22, 0x23,
+    0x25, 0x40, 0x41, 0x15, 0x95, 0x00, 0x49, 0x15, 0x95, 0x00, 0x3C, 0x05, 0x72, 0x00, 0x31, 0x15,
+    0x4F, 0x00, 0x2A, 0x15, 0x95, 0x00, 0x22, 0x00, 0x1B, 0x00, 0x0E, 0x00, 0x07, 0x43, 0x31, 0x36,
+    0x48, 0x15, 0xB3, 0x15, 0xBC, 0x14, 0xB1, 0x41, 0x48, 0x15, 0xC6, 0x21, 0x31, 0x04, 0x21, 0x0A,
+    0x03, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x01, 0x03, 0x21, 0x48, 0x03, 0x44, 0x30, 0x31,
+    0x34, 0x36, 0x15, 0xDD, 0x15, 0xD3, 0x15, 0xD3, 0x00, 0x03, 0x41, 0x2B, 0x11, 0xDC, 0x21, 0x32,
+    0x04, 0x43, 0x27, 0x35, 0x49, 0x15, 0xF0, 0x15, 0x60, 0x00, 0x03, 0x41, 0x1A, 0x13, 0xD1, 0x42,
+    0x07, 0x14, 0x00, 0x04, 0x15, 0xFF, 0xC1, 0x48, 0x16, 0x06, 0x48, 0x01, 0x07, 0x2D, 0x30, 0x31,
+    0x35, 0x38, 0x49, 0x16, 0x0A, 0x16, 0x0A, 0x16, 0x09, 0x16, 0x0A, 0x00, 0x0B, 0x00, 0x04, 0x11,
+    0x11, 0x15, 0xFD, 0x41, 0x38, 0x15, 0xD4, 0x43, 0x14, 0x21, 0x4A, 0x16, 0x27, 0x16, 0x0E, 0x16,
+    0x26, 0x42, 0x2D, 0x32, 0x15, 0x76, 0x16, 0x31, 0x48, 0x23, 0x2D, 0x31, 0x35, 0x38, 0x48, 0x49,
+    0x4A, 0x00, 0x15, 0x16, 0x37, 0x0D, 0xA0, 0x12, 0x20, 0x00, 0x11, 0x00, 0x07, 0x0F, 0x4A, 0x16,
+    0x34, 0xC1, 0x2B, 0x15, 0x4F, 0x41, 0x23, 0x16, 0x03, 0x44, 0x07, 0x14, 0x19, 0x1A, 0x00, 0x08,
+    0x00, 0x04, 0x00, 0x08, 0x16, 0x59, 0x48, 0x01, 0x2D, 0x31, 0x33, 0x34, 0x37, 0x38, 0x39, 0x12,
+    0x62, 0x16, 0x66, 0x00, 0x0D, 0x16, 0x66, 0x16, 0x66, 0x16, 0x11, 0x16, 0x2D, 0x15, 0xE7, 0x42,
+    0x27, 0x31, 0x16, 0x21, 0x16, 0x30, 0xC1, 0x25, 0x14, 0x77, 0x42, 0x07, 0x49, 0x00, 0x04, 0x16,
+    0x80, 0xC2, 0x25, 0x49, 0x16, 0x91, 0x16, 0x87, 0x44, 0x30, 0x31, 0x34, 0x38, 0x16, 0x98, 0x00,
+    0x0E, 0x00, 0x07, 0x16, 0x49, 0x41, 0x1B, 0x12, 0x93, 0x21, 0x30, 0x04, 0x21, 0x01, 0x03, 0x42,
+    0x14, 0x1A, 0x00, 0x03, 0x16, 0xAF, 0x21, 0x34, 0x07, 0x41, 0x1B, 0x13, 0x46, 0x21, 0x40, 0x04,
+    0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x01, 0x03, 0xC1, 0x02, 0x16, 0xBC, 0x21, 0x21, 0x04,
+    0xC1, 0x15, 0x15, 0xCE, 0xC1, 0x14, 0x16, 0xD4, 0x48, 0x07, 0x23, 0x27, 0x2D, 0x30, 0x31, 0x34,
+    0x39, 0x16, 0xD8, 0x00, 0x22, 0x00, 0x12, 0x00, 0x0B, 0x16, 0xD8, 0x12, 0x86, 0x00, 0x08, 0x00,
+    0x04, 0x42, 0x34, 0x38, 0x12, 0xD9, 0x16, 0xB8, 0x41, 0x25, 0x12, 0x6E, 0x21, 0x1E, 0x04, 0x21,
+    0x41, 0x03, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0x42, 0x48,
+    0x49, 0x00, 0x03, 0x16, 0xB9, 0x45, 0x07, 0x23, 0x25, 0x31, 0x49, 0x17, 0x15, 0x00, 0x24, 0x00,
+    0x07, 0x16, 0xDC, 0x16, 0xC0, 0x41, 0x15, 0x13, 0xBA, 0x42, 0x07, 0x15, 0x17, 0x29, 0x17, 0x29,
+    0x41, 0x34, 0x12, 0xA6, 0x21, 0x23, 0x04, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x03,
+    0x42, 0x19, 0x48, 0x17, 0x40, 0x00, 0x03, 0x45, 0x30, 0x31, 0x32, 0x34, 0x38, 0x00, 0x22, 0x00,
+    0x1E, 0x17, 0x3D, 0x17, 0x3D, 0x00, 0x07, 0x41, 0x2B, 0x16, 0xF1, 0x21, 0x07, 0x04, 0x21, 0x31,
+    0x03, 0x44, 0x1B, 0x21, 0x2D, 0x41, 0x00, 0x03, 0x15, 0x3E, 0x0F, 0x40, 0x15, 0x52, 0xC2, 0x0B,
+    0x2A, 0x17, 0x19, 0x16, 0xA8, 0x41, 0x1E, 0x17, 0x20, 0x41, 0x48, 0x16, 0xBE, 0x21, 0x35, 0x04,
+    0x21, 0x25, 0x03, 0x21, 0x2B, 0x03, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21,
+    0x21, 0x03, 0x43, 0x07, 0x2D, 0x49, 0x17, 0x92, 0x0C, 0x40, 0x00, 0x03, 0x41, 0x25, 0x0C, 0x28,
+    0x21, 0x41, 0x04, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x41, 0x25, 0x12, 0x63, 0x21, 0x2B, 0x04,
+    0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x43, 0x19, 0x21, 0x22, 0x17, 0xB6, 0x00, 0x10, 0x00, 0x03,
+    0x21, 0x2D, 0x0A, 0x48, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x48, 0x17, 0x08, 0x17, 0xC3,
+    0x00, 0x62, 0x17, 0x8A, 0x00, 0x55, 0x00, 0x4E, 0x00, 0x31, 0x00, 0x03, 0x41, 0x49, 0x01, 0xEE,
+    0x41, 0x19, 0x13, 0xFE, 0x21, 0x2B, 0x04, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x03,
+    0x41, 0x47, 0x17, 0xE6, 0x21, 0x19, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x41, 0x03, 0x21, 0x30, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0x43, 0x30, 0x38, 0x47, 0x18, 0x09, 0x00,
+    0x1C, 0x00, 0x03, 0x41, 0x47, 0x16, 0x04, 0x21, 0x23, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x41, 0x03,
+    0x21, 0x30, 0x03, 0x21, 0x01, 0x03, 0x21, 0x21, 0x03, 0x21, 0x2D, 0x03, 0x45, 0x2D, 0x32, 0x35,
+    0x47, 0x48, 0x17, 0xDD, 0x17, 0xF3, 0x17, 0x9B, 0x00, 0x03, 0x17, 0x20, 0x41, 0x4B, 0x17, 0xD6,
+    0x21, 0x1B, 0x04, 0x41, 0x25, 0x15, 0x5B, 0x21, 0x2B, 0x04, 0x21, 0x30, 0x03, 0x21, 0x01, 0x03,
+    0x21, 0x01, 0x03, 0x44, 0x32, 0x35, 0x38, 0x48, 0x00, 0x13, 0x17, 0xC2, 0x00, 0x03, 0x11, 0x65,
+    0x47, 0x19, 0x21, 0x23, 0x25, 0x33, 0x37, 0x39, 0x00, 0x57, 0x0E, 0x20, 0x00, 0x34, 0x00, 0x0D,
+    0x18, 0x60, 0x18, 0x0B, 0x18, 0x11, 0x45, 0x27, 0x2D, 0x32, 0x34, 0x38, 0x16, 0x67, 0x16, 0x67,
+    0x0C, 0xFE, 0x18, 0x27, 0x14, 0x5E, 0x41, 0x32, 0x15, 0x1B, 0x41, 0x22, 0x17, 0x85, 0x21, 0x4B,
+    0x04, 0x42, 0x01, 0x35, 0x18, 0x91, 0x00, 0x03, 0xC1, 0x23, 0x18, 0x8E, 0xA1, 0x40, 0x04, 0x42,
+    0x01, 0x07, 0x18, 0x9F, 0x00, 0x03, 0x42, 0x22, 0x32, 0x18, 0xA6, 0x15, 0x3B, 0x42, 0x37, 0x49,
+    0x18, 0x58, 0x18, 0x58, 0x41, 0x32, 0x14, 0x9C, 0x21, 0x4A, 0x04, 0x21, 0x1B, 0x03, 0x21, 0x30,
+    0x03, 0x21, 0x01, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x4A, 0x03, 0x43, 0x2D, 0x30, 0x34, 0x17, 0xD7,
+    0x18, 0xCA, 0x00, 0x03, 0x42, 0x25, 0x48, 0x18, 0xD3, 0x18, 0x9B, 0x42, 0x35, 0x47, 0x18, 0x20,
+    0x18, 0xD1, 0x41, 0x23, 0x0E, 0x34, 0x21, 0x30, 0x04, 0x21, 0x01, 0x03, 0x21, 0x22, 0x03, 0x21,
+    0x48, 0x03, 0xC2, 0x35, 0x48, 0x00, 0x03, 0x18, 0x9D, 0x41, 0x25, 0x16, 0x69, 0x21, 0x30, 0x04,
+    0x21, 0x01, 0x03, 0x21, 0x2D, 0x03, 0x43, 0x34, 0x47, 0x48, 0x18, 0xB7, 0x18, 0xFC, 0x00, 0x03,
+    0x41, 0x48, 0x15, 0x9A, 0x21, 0x35, 0x04, 0x21, 0x1B, 0x91, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03,
+    0x21, 0x32, 0x03, 0x22, 0x23, 0x25, 0x0F, 0x03, 0x4D, 0x01, 0x14, 0x15, 0x17, 0x1A, 0x1B, 0x1C,
+    0x1E, 0x21, 0x23, 0x25, 0x2B, 0x2D, 0x00, 0xA2, 0x00, 0x97, 0x00, 0x89, 0x00, 0x82, 0x00, 0x7B,
+    0x00, 0x5E, 0x00, 0x54, 0x18, 0xBF, 0x00, 0x4D, 0x00, 0x36, 0x00, 0x22, 0x00, 0x05, 0x18, 0x23,
+    0x42, 0x27, 0x48, 0x19, 0x50, 0x18, 0x4B, 0x43, 0x19, 0x48, 0x49, 0x19, 0x57, 0x19, 0x4D, 0x19,
+    0x57, 0x42, 0x30, 0x49, 0x19, 0x61, 0x19, 0x28, 0x42, 0x22, 0x30, 0x19, 0x67, 0x19, 0x68, 0xC1,
+    0x19, 0x19, 0x6F, 0x48, 0x08, 0x0A, 0x15, 0x17, 0x1B, 0x25, 0x2B, 0x2D, 0x16, 0x08, 0x18, 0xE2,
+    0x00, 0x23, 0x00, 0x1C, 0x00, 0x12, 0x19, 0x73, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x23, 0x16, 0x21,
+    0x42, 0x48, 0x49, 0x19, 0x90, 0x19, 0x90, 0x41, 0x15, 0x19, 0x8D, 0x21, 0x40, 0x04, 0x21, 0x30,
+    0x03, 0x21, 0x01, 0x03, 0x41, 0x2B, 0x15, 0x1A, 0x21, 0x42, 0x04, 0x21, 0x07, 0x03, 0x43, 0x07,
+    0x49, 0x4A, 0x00, 0x0D, 0x00, 0x03, 0x19, 0xAD, 0x41, 0x42, 0x19, 0x5A, 0x42, 0x23, 0x42, 0x19,
+    0xB2, 0x19, 0x5E, 0x41, 0x25, 0x19, 0xC2, 0x21, 0x1C, 0x04, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x01, 0x03, 0x21, 0x25, 0x03, 0x41, 0x40, 0x19, 0x93, 0x21, 0x30, 0x04,
+    0x21, 0x01, 0x03, 0x42, 0x07, 0x48, 0x19, 0xE3, 0x19, 0xE3, 0x42, 0x25, 0x49, 0x19, 0xE9, 0x19,
+    0xEA, 0x29, 0x01, 0x0B, 0x15, 0x1A, 0x1B, 0x1C, 0x23, 0x25, 0x2B, 0x65, 0x61, 0x43, 0x39, 0x35,
+    0x1B, 0x11, 0x0E, 0x07, 0x41, 0x25, 0x19, 0x73, 0x42, 0x14, 0x2B, 0x1A, 0x08, 0x00, 0x04, 0xD6,
+    0x01, 0x08, 0x0A, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x23, 0x25, 0x27, 0x2A,
+    0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x04, 0x52, 0x17, 0xEC, 0x04, 0x32, 0x04, 0x1E, 0x04, 0x05,
+    0x03, 0xD7, 0x19, 0x06, 0x03, 0xA9, 0x03, 0x90, 0x03, 0x77, 0x03, 0x37, 0x02, 0xFA, 0x02, 0xC8,
+    0x02, 0x4C, 0x16, 0xA4, 0x02, 0x33, 0x01, 0xAF, 0x01, 0x99, 0x00, 0xE7, 0x00, 0x9C, 0x00, 0x1E,
+    0x00, 0x07, 0x42, 0x23, 0x31, 0x19, 0xEC, 0x1A, 0x19, 0x42, 0x2C, 0x31, 0x16, 0xEE, 0x1A, 0x4F,
+    0x42, 0x31, 0x38, 0x19, 0x5B, 0x1A, 0x27, 0xA3, 0x01, 0x02, 0x15, 0x15, 0x0E, 0x07, 0x41, 0x34,
+    0x1A, 0x35, 0x41, 0x47, 0x10, 0x32, 0x42, 0x19, 0x25, 0x1A, 0x76, 0x1A, 0x76, 0x42, 0x25, 0x32,
+    0x1A, 0x7D, 0x00, 0x07, 0x41, 0x32, 0x1A, 0x26, 0x21, 0x14, 0x04, 0x41, 0x35, 0x17, 0x15, 0x43,
+    0x01, 0x09, 0x27, 0x00, 0x04, 0x00, 0x21, 0x1A, 0x20, 0xCA, 0x01, 0x02, 0x09, 0x15, 0x1F, 0x27,
+    0x2A, 0x2B, 0x40, 0x44, 0x15, 0xD7, 0x1A, 0x33, 0x00, 0x2B, 0x00, 0x27, 0x1A, 0x80, 0x00, 0x1C,
+    0x00, 0x11, 0x19, 0x97, 0x00, 0x0A, 0x07, 0x7B, 0x43, 0x1B, 0x30, 0x32, 0x17, 0x4D, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x21, 0x09, 0x0A, 0x41, 0x01, 0x17, 0xCC, 0x21, 0x38, 0x04, 0xC3, 0x08, 0x0A, 0x0D,
+    0x00, 0x03, 0x1A, 0x66, 0x1A, 0x66, 0x41, 0x01, 0x17, 0x6B, 0xC7, 0x01, 0x0A, 0x30, 0x31, 0x32,
+    0x35, 0x4C, 0x1A, 0xDA, 0x17, 0x6F, 0x1A, 0xDA, 0x1A, 0x55, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA,
+    0x41, 0x23, 0x18, 0xE1, 0x21, 0x23, 0x04, 0xA1, 0x18, 0x03, 0x45, 0x0F, 0x10, 0x11, 0x13, 0x2B,
+    0x00, 0x24, 0x00, 0x20, 0x1A, 0xDE, 0x1A, 0xDE, 0x00, 0x03, 0x41, 0x23, 0x08, 0x6D, 0x41, 0x14,
+    0x16, 0xE9, 0x21, 0x44, 0x04, 0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0xC3, 0x01, 0x1F, 0x21, 0x00,
+    0x11, 0x1A, 0x19, 0x00, 0x03, 0x41, 0x32, 0x08, 0x07, 0x21, 0x21, 0x04, 0x21, 0x01, 0x03, 0x41,
+    0x08, 0x1B, 0x2E, 0x21, 0x32, 0x04, 0xC2, 0x27, 0x2A, 0x00, 0x03, 0x19, 0xDE, 0x22, 0x34, 0x38,
+    0x11, 0x07, 0x42, 0x15, 0x23, 0x00, 0x05, 0x1A, 0xDC, 0x42, 0x07, 0x32, 0x1B, 0x49, 0x1A, 0x56,
+    0x43, 0x19, 0x34, 0x35, 0x1B, 0x50, 0x1B, 0x46, 0x18, 0x1D, 0x42, 0x23, 0x25, 0x1B, 0x5A, 0x1B,
+    0x5A, 0x42, 0x2D, 0x32, 0x1B, 0x57, 0x00, 0x07, 0x41, 0x23, 0x12, 0x1A, 0x21, 0x32, 0x04, 0x21,
+    0x22, 0x03, 0x42, 0x07, 0x27, 0x1B, 0x72, 0x1B, 0x72, 0x43, 0x30, 0x31, 0x4C, 0x00, 0x0A, 0x00,
+    0x07, 0x1B, 0x79, 0x41, 0x31, 0x1A, 0xC8, 0x21, 0x0A, 0x04, 0x21, 0x34, 0x03, 0x41, 0x21, 0x09,
+    0x25, 0x42, 0x01, 0x23, 0x1B, 0x4B, 0x00, 0x04, 0xC3, 0x25, 0x27, 0x32, 0x0A, 0xD0, 0x00, 0x0E,
+    0x00, 0x07, 0x43, 0x23, 0x30, 0x48, 0x00, 0x0A, 0x1B, 0xA2, 0x1B, 0x3C, 0x41, 0x23, 0x0A, 0xF4,
+    0x21, 0x34, 0x04, 0xC1, 0x22, 0x1B, 0x7A, 0x42, 0x32, 0x4C, 0x00, 0x04, 0x1B, 0xB7, 0x43, 0x07,
+    0x2D, 0x36, 0x1B, 0xBE, 0x1B, 0xB4, 0x1B, 0xB4, 0x43, 0x0A, 0x21, 0x2D, 0x1B, 0x73, 0x01, 0x3D,
+    0x0F, 0x34, 0x43, 0x0B, 0x14, 0x2A, 0x1B, 0xC8, 0x1B, 0x83, 0x1B, 0xC8, 0x43, 0x01, 0x14, 0x15,
+    0x1B, 0x96, 0x1B, 0xDC, 0x1B, 0x96, 0xCD, 0x01, 0x0A, 0x14, 0x15, 0x17, 0x1E, 0x20, 0x22, 0x25,
+    0x2A, 0x40, 0x41, 0x44, 0x00, 0x9D, 0x00, 0x96, 0x00, 0x85, 0x00, 0x6D, 0x00, 0x44, 0x00, 0x36,
+    0x00, 0x63, 0x00, 0x2F, 0x00, 0x28, 0x11, 0x38, 0x00, 0x1E, 0x00, 0x14, 0x00, 0x0A, 0x41, 0x32,
+    0x1B, 0x09, 0x21, 0x49, 0x04, 0x41, 0x23, 0x1B, 0x90, 0x21, 0x40, 0x04, 0x21, 0x38, 0x03, 0x42,
+    0x25, 0x49, 0x13, 0xFA, 0x1C, 0x1F, 0x21, 0x01, 0x07, 0xA3, 0x02, 0x1A, 0x41, 0x17, 0x0D, 0x03,
+    0x41, 0x32, 0x19, 0x44, 0x42, 0x31, 0x32, 0x1C, 0x12, 0x18, 0x30, 0xA1, 0x01, 0x07, 0x21, 0x22,
+    0x03, 0x44, 0x23, 0x30, 0x32, 0x34, 0x18, 0xD6, 0x02, 0xB5, 0x19, 0x55, 0x00, 0x03, 0xC4, 0x15,
+    0x19, 0x1A, 0x1B, 0x1B, 0x4C, 0x1C, 0x4D, 0x00, 0x1E, 0x00, 0x0D, 0x42, 0x01, 0x17, 0x1B, 0x23,
+    0x1C, 0x5B, 0x42, 0x30, 0x32, 0x1C, 0x62, 0x00, 0x07, 0x41, 0x42, 0x1C, 0x1A, 0x21, 0x30, 0x04,
+    0x43, 0x19, 0x23, 0x35, 0x00, 0x0E, 0x00, 0x03, 0x1C, 0x70, 0x42, 0x0A, 0x21, 0x1C, 0x7A, 0x1C,
+    0x7A, 0xC1, 0x0A, 0x1C, 0x1B, 0x43, 0x25, 0x38, 0x39, 0x1C, 0x85, 0x00, 0x0B, 0x00, 0x04, 0x41,
+    0x2A, 0x1B, 0xC9, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03, 0x21, 0x23, 0x03, 0x21, 0x1E, 0x03, 0x21,
+    0x32, 0x03, 0x22, 0x20, 0x23, 0x03, 0x0C, 0x21, 0x15, 0x05, 0x42, 0x0A, 0x19, 0x19, 0x95, 0x00,
+    0x03, 0x42, 0x31, 0x32, 0x00, 0x07, 0x1C, 0x6B, 0x41, 0x0A, 0x1C, 0xB8, 0x21, 0x1E, 0x04, 0x46,
+    0x1A, 0x1B, 0x1E, 0x21, 0x25, 0x42, 0x1C, 0x86, 0x00, 0x4F, 0x00, 0x3A, 0x00, 0x0E, 0x1C, 0x37,
+    0x00, 0x03, 0x41, 0x01, 0x01, 0x4F, 0x21, 0x34, 0x04, 0x21, 0x27, 0x03, 0x41, 0x0D, 0x1C, 0xDC,
+    0x21, 0x32, 0x04, 0x41, 0x24, 0x0C, 0x1E, 0x41, 0x2A, 0x1C, 0x8C, 0x21, 0x27, 0x04, 0xC6, 0x19,
+    0x1E, 0x31, 0x32, 0x34, 0x4C, 0x1C, 0x88, 0x00, 0x0B, 0x05, 0x93, 0x00, 0x03, 0x19, 0xE0, 0x1C,
+    0xEE, 0x41, 0x34, 0x1C, 0x4C, 0x41, 0x15, 0x1B, 0x53, 0x21, 0x21, 0x04, 0xC3, 0x21, 0x35, 0x44,
+    0x00, 0x0B, 0x1D, 0x0C, 0x00, 0x03, 0xA1, 0x13, 0x0A, 0x21, 0x32, 0x03, 0x41, 0x2D, 0x1C, 0xB6,
+    0x42, 0x0A, 0x2B, 0x1D, 0x20, 0x1C, 0x65, 0x48, 0x0A, 0x1A, 0x1B, 0x22, 0x2B, 0x2D, 0x40, 0x42,
+    0x00, 0x47, 0x1D, 0x26, 0x00, 0x39, 0x00, 0x0E, 0x1A, 0xFD, 0x15, 0x06, 0x00, 0x0B, 0x00, 0x07,
+    0x41, 0x19, 0x1C, 0xE2, 0x21, 0x41, 0x04, 0x21, 0x30, 0x03, 0x21, 0x04, 0x03, 0x21, 0x25, 0x03,
+    0x21, 0x31, 0x03, 0x41, 0x2D, 0x1C, 0x60, 0x21, 0x1B, 0x04, 0x21, 0x40, 0x03, 0x21, 0x21, 0x03,
+    0x21, 0x31, 0x03, 0x21, 0x25, 0x03, 0x21, 0x32, 0x03, 0x41, 0x25, 0x1D, 0x53, 0x21, 0x2D, 0x04,
+    0x41, 0x15, 0x1C, 0xAA, 0x21, 0x34, 0x04, 0xA1, 0x0B, 0x03, 0x21, 0x32, 0x03, 0x21, 0x25, 0x03,
+    0x21, 0x32, 0x03, 0x21, 0x21, 0x03, 0x22, 0x14, 0x15, 0x19, 0x03, 0x23, 0x14, 0x25, 0x40, 0x3B,
+    0x25, 0x05, 0x41, 0x21, 0x1D, 0x34, 0x41, 0x2A, 0x1A, 0x2B, 0x41, 0x31, 0x19, 0x48, 0x21, 0x22,
+    0x04, 0xA1, 0x2B, 0x03, 0x42, 0x07, 0x19, 0x1D, 0xA4, 0x00, 0x03, 0x55, 0x01, 0x07, 0x08, 0x0D,
+    0x10, 0x13, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x48, 0x49,
+    0x4A, 0x03, 0x44, 0x03, 0x12, 0x02, 0xE9, 0x02, 0xDF, 0x1D, 0xAB, 0x02, 0xB1, 0x02, 0x90, 0x02,
+    0x69, 0x1C, 0x89, 0x01, 0xC5, 0x01, 0x82, 0x01, 0x5D, 0x00, 0xEC, 0x00, 0xD2, 0x00, 0x84, 0x00,
+    0x20, 0x00, 0x19, 0x00, 0x15, 0x1D, 0x72, 0x00, 0x07, 0x1D, 0xAA, 0x41, 0x35, 0x1D, 0xEA, 0x41,
+    0x32, 0x1B, 0xF1, 0x41, 0x35, 0x1D, 0x38, 0x21, 0x22, 0x04, 0x21, 0x40, 0x03, 0xC4, 0x13, 0x1A,
+    0x30, 0x35, 0x00, 0x12, 0x00, 0x0E, 0x00, 0x03, 0x1D, 0xFD, 0x42, 0x07, 0x35, 0x1E, 0x0A, 0x1A,
+    0x94, 0x43, 0x01, 0x02, 0x27, 0x00, 0x07, 0x1D, 0xD8, 0x1D, 0xA2, 0xC2, 0x02, 0x40, 0x1D, 0x0F,
+    0x00, 0x0A, 0x41, 0x25, 0x1D, 0x16, 0x41, 0x42, 0x1B, 0x18, 0x21, 0x15, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x40, 0x03, 0x21, 0x19, 0x03, 0x22, 0x30, 0x31, 0x14, 0x03, 0x41, 0x10, 0x1E, 0x1F, 0x21,
+    0x29, 0x04, 0x21, 0x34, 0x03, 0xC1, 0x04, 0x1C, 0x36, 0x43, 0x14, 0x1A, 0x32, 0x00, 0x07, 0x1C,
+    0x94, 0x00, 0x04, 0x21, 0x19, 0x0A, 0x21, 0x08, 0x03, 0x41, 0x11, 0x1B, 0x75, 0x21, 0x13, 0x04,
+    0x21, 0x31, 0x03, 0xA1, 0x21, 0x03, 0x41, 0x14, 0x1B, 0x82, 0x21, 0x19, 0x04, 0x22, 0x31, 0x32,
+    0x03, 0x03, 0x21, 0x21, 0x05, 0x41, 0x25, 0x1E, 0x5C, 0x42, 0x32, 0x33, 0x1E, 0x79, 0x1E, 0x79,
+    0xC7, 0x14, 0x15, 0x17, 0x19, 0x1E, 0x32, 0x49, 0x1E, 0x1A, 0x1E, 0x64, 0x1E, 0x64, 0x1E, 0x80,
+    0x00, 0x0B, 0x1E, 0x80, 0x00, 0x07, 0x41, 0x35, 0x1E, 0x17, 0xC1, 0x23, 0x1E, 0x9A, 0x41, 0x35,
+    0x06, 0x14, 0x42, 0x0A, 0x14, 0x1A, 0xC0, 0x00, 0x04, 0xC7, 0x01, 0x1A, 0x2B, 0x2D, 0x30, 0x39,
+    0x40, 0x00, 0x13, 0x1D, 0xA0, 0x1A, 0x9B, 0x1E, 0x9F, 0x1E, 0xA9, 0x00, 0x0F, 0x00, 0x07, 0x41,
+    0x34, 0x0B, 0xA1, 0x21, 0x23, 0x04, 0x21, 0x38, 0x03, 0x41, 0x13, 0x07, 0x72, 0x21, 0x31, 0x04,
+    0x41, 0x32, 0x0B, 0xE6, 0x42, 0x01, 0x16, 0x1E, 0xD4, 0x1D, 0x9C, 0x21, 0x15, 0x07, 0x21, 0x34,
+    0x03, 0x41, 0x19, 0x1B, 0xAE, 0x21, 0x35, 0x04, 0x41, 0x08, 0x1E, 0xA2, 0x41, 0x21, 0x14, 0x0D,
+    0xA3, 0x17, 0x1E, 0x23, 0x0B, 0x08, 0x04, 0x42, 0x19, 0x28, 0x1E, 0x31, 0x1E, 0xF7, 0x41, 0x17,
+    0x1B, 0xCB, 0x41, 0x23, 0x0C, 0x18, 0xCB, 0x04, 0x15, 0x19, 0x20, 0x23, 0x27, 0x31, 0x32, 0x34,
+    0x40, 0x42, 0x0E, 0x4E, 0x00, 0x39, 0x1F, 0x06, 0x1B, 0xD3, 0x00, 0x36, 0x00, 0x28, 0x02, 0x4E,
+    0x00, 0x16, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x04, 0x41, 0x27, 0x1D, 0xF0, 0x41, 0x18, 0x14, 0xC2,
+    0x21, 0x19, 0x04, 0x21, 0x31, 0x03, 0x41, 0x1A, 0x1E, 0xE4, 0x21, 0x33, 0x04, 0xA1, 0x1A, 0x03,
+    0x21, 0x1E, 0x03, 0x21, 0x32, 0x03, 0xC1, 0x28, 0x0D, 0x28, 0x21, 0x04, 0x04, 0x21, 0x32, 0x03,
+    0x21, 0x20, 0x03, 0x21, 0x34, 0x03, 0x41, 0x22, 0x1C, 0x23, 0x21, 0x1E, 0x04, 0xC7, 0x01, 0x17,
+    0x1E, 0x20, 0x27, 0x2A, 0x32, 0x04, 0x69, 0x00, 0x35, 0x00, 0x2A, 0x00, 0x1A, 0x00, 0x0A, 0x1C,
+    0x2D, 0x00, 0x03, 0x41, 0x25, 0x1D, 0x49, 0x21, 0x33, 0x04, 0x21, 0x17, 0x03, 0x21, 0x19, 0x03,
+    0x21, 0x48, 0x03, 0x21, 0x31, 0x03, 0xA1, 0x25, 0x03, 0x41, 0x0A, 0x1F, 0x50, 0x21, 0x25, 0x04,
+    0x21, 0x27, 0x03, 0x21, 0x21, 0x03, 0x21, 0x07, 0x03, 0x21, 0x48, 0x03, 0x21, 0x2A, 0x03, 0x21,
+    0x19, 0x03, 0x41, 0x17, 0x1E, 0xE7, 0x21, 0x44, 0x04, 0x21, 0x19, 0x03, 0x43, 0x34, 0x39, 0x49,
+    0x00, 0x03, 0x1F, 0x66, 0x1F, 0x51, 0x41, 0x38, 0x07, 0xD2, 0x41, 0x01, 0x1F, 0x6B, 0x22, 0x1A,
+    0x40, 0x08, 0x04, 0x41, 0x29, 0x1F, 0x5D, 0x21, 0x01, 0x04, 0x21, 0x36, 0x03, 0x21, 0x28, 0x03,
+    0x43, 0x0D, 0x13, 0x19, 0x00, 0x03, 0x0D, 0x68, 0x1B, 0xAB, 0x41, 0x08, 0x10, 0x00, 0x42, 0x0D,
+    0x13, 0x1F, 0xDE, 0x0D, 0x76, 0x41, 0x29, 0x1F, 0x30, 0x41, 0x22, 0x03, 0x0D, 0x21, 0x35, 0x04,
+    0x21, 0x23, 0x03, 0x41, 0x37, 0x1A, 0x41, 0x46, 0x01, 0x15, 0x1B, 0x21, 0x23, 0x27, 0x00, 0x12,
+    0x1F, 0xF7, 0x00, 0x07, 0x1E, 0xE7, 0x00, 0x04, 0x1F, 0xF6, 0x41, 0x48, 0x03, 0x71, 0x21, 0x1C,
+    0x04, 0x41, 0x48, 0x18, 0x2F, 0x21, 0x16, 0x04, 0x21, 0x21, 0x03, 0x21, 0x49, 0x03, 0x21, 0x19,
+    0x03, 0x41, 0x19, 0x02, 0x2E, 0x21, 0x40, 0x04, 0xA1, 0x35, 0x03, 0x41, 0x22, 0x1B, 0xFF, 0x42,
+    0x15, 0x35, 0x20, 0x2F, 0x00, 0x04, 0x41, 0x17, 0x20, 0x1A, 0x21, 0x19, 0x04, 0x43, 0x14, 0x19,
+    0x21, 0x20, 0x04, 0x00, 0x0E, 0x00, 0x03, 0x43, 0x14, 0x15, 0x40, 0x00, 0x1F, 0x1B, 0x89, 0x00,
+    0x0A, 0xD0, 0x01, 0x02, 0x13, 0x19, 0x1A, 0x1E, 0x22, 0x27, 0x30, 0x31, 0x32, 0x38, 0x40, 0x41,
+    0x42, 0x4C, 0x00, 0xCB, 0x00, 0xB2, 0x20, 0x35, 0x19, 0x63, 0x00, 0xA5, 0x1F, 0xEB, 0x20, 0x35,
+    0x1D, 0x69, 0x00, 0x93, 0x00, 0x81, 0x00, 0x77, 0x00, 0x73, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x33,
+    0x00, 0x0A, 0x41, 0x13, 0x1F, 0xBC, 0x21, 0x23, 0x04, 0x41, 0x34, 0x0E, 0xBF, 0x42, 0x13, 0x23,
+    0x1F, 0xC7, 0x00, 0x04, 0x22, 0x23, 0x34, 0x0E, 0x07, 0x42, 0x21, 0x41, 0x1E, 0x76, 0x1E, 0x8A,
+    0x41, 0x49, 0x19, 0xB2, 0x21, 0x19, 0x04, 0x42, 0x38, 0x39, 0x1F, 0x82, 0x20, 0xA7, 0x21, 0x0D,
+    0x07, 0x43, 0x01, 0x0D, 0x14, 0x00, 0x0D, 0x00, 0x03, 0x20, 0xB1, 0x41, 0x2D, 0x0D, 0x9D, 0x21,
+    0x01, 0x04, 0x42, 0x31, 0x32, 0x20, 0x89, 0x00, 0x03, 0xA1, 0x1B, 0x07, 0xC1, 0x19, 0x20, 0x66,
+    0x41, 0x28, 0x1D, 0x65, 0x21, 0x17, 0x04, 0x41, 0x22, 0x0D, 0xED, 0xC8, 0x01, 0x30, 0x31, 0x32,
+    0x34, 0x35, 0x40, 0x42, 0x00, 0x47, 0x00, 0x42, 0x00, 0x2A, 0x00, 0x12, 0x20, 0xDA, 0x00, 0x0F,
+    0x00, 0x07, 0x00, 0x04, 0xC2, 0x27, 0x32, 0x04, 0xE6, 0x20, 0xEA, 0x42, 0x10, 0x32, 0x1D, 0x90,
+    0x20, 0xFB, 0x41, 0x42, 0x1F, 0x04, 0x21, 0x17, 0x04, 0x21, 0x31, 0x03, 0x42, 0x01, 0x17, 0x21,
+    0x0C, 0x00, 0x0A, 0x41, 0x1B, 0x03, 0x28, 0x41, 0x31, 0x0E, 0xFC, 0xA1, 0x1E, 0x04, 0xC3, 0x21,
+    0x23, 0x27, 0x00, 0x0B, 0x21, 0x1E, 0x00, 0x03, 0x41, 0x42, 0x20, 0xEF, 0x46, 0x23, 0x2A, 0x30,
+    0x31, 0x32, 0x34, 0x21, 0x2C, 0x00, 0x23, 0x21, 0x2C, 0x00, 0x20, 0x00, 0x0E, 0x00, 0x04, 0xC4,
+    0x07, 0x31, 0x32, 0x34, 0x21, 0x3F, 0x21, 0x35, 0x21, 0x3F, 0x1D, 0x27, 0x41, 0x44, 0x14, 0x23,
+    0x44, 0x22, 0x25, 0x31, 0x4C, 0x21, 0x37, 0x00, 0x11, 0x21, 0x4F, 0x00, 0x04, 0x41, 0x34, 0x1E,
+    0xE8, 0x41, 0x27, 0x21, 0x60, 0xC4, 0x1E, 0x2A, 0x32, 0x42, 0x04, 0x82, 0x00, 0x08, 0x00, 0x04,
+    0x02, 0x63, 0x41, 0x49, 0x17, 0xC5, 0x21, 0x35, 0x04, 0x41, 0x35, 0x21, 0x40, 0x21, 0x2D, 0x04,
+    0x41, 0x08, 0x20, 0x48, 0x21, 0x32, 0x04, 0x21, 0x09, 0x03, 0x21, 0x08, 0x03, 0x21, 0x34, 0x03,
+    0x21, 0x21, 0x03, 0x21, 0x38, 0x03, 0x42, 0x28, 0x2A, 0x21, 0x96, 0x00, 0x03, 0x41, 0x27, 0x1F,
+    0x0D, 0x45, 0x1B, 0x1F, 0x21, 0x22, 0x2B, 0x00, 0x2B, 0x00, 0x24, 0x00, 0x0B, 0x21, 0x68, 0x00,
+    0x04, 0x41, 0x0B, 0x1D, 0x8C, 0x21, 0x44, 0x04, 0x41, 0x17, 0x0E, 0x9A, 0x42, 0x0B, 0x42, 0x20,
+    0xF6, 0x00, 0x04, 0x21, 0x01, 0x07, 0x22, 0x01, 0x47, 0x11, 0x03, 0x43, 0x1F, 0x25, 0x27, 0x21,
+    0xCB, 0x00, 0x05, 0x21, 0x92, 0x41, 0x21, 0x02, 0x33, 0x41, 0x2B, 0x07, 0xD5, 0xDC, 0x01, 0x07,
+    0x0A, 0x0B, 0x0D, 0x10, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2E, 0x40, 0x41, 0x42, 0x44, 0x03, 0xE0, 0x03, 0xC2, 0x17, 0x2F,
+    0x03, 0xA7, 0x03, 0x87, 0x03, 0x7A, 0x21, 0xDD, 0x03, 0x6B, 0x03, 0x5D, 0x03, 0x34, 0x03, 0x17,
+    0x21, 0xD9, 0x0F, 0x75, 0x02, 0xD7, 0x02, 0x80, 0x01, 0x8C, 0x01, 0x02, 0x00, 0xE9, 0x1E, 0xF5,
+    0x00, 0xE2, 0x00, 0xB1, 0x00, 0x8D, 0x00, 0x78, 0x1F, 0xBA, 0x00, 0x3C, 0x00, 0x12, 0x00, 0x08,
+    0x00, 0x04, 0x42, 0x14, 0x1A, 0x22, 0x32, 0x22, 0x32, 0x43, 0x27, 0x31, 0x39, 0x20, 0x2A, 0x00,
+    0x07, 0x22, 0x00, 0x43, 0x23, 0x31, 0x32, 0x22, 0x43, 0x21, 0xF4, 0x21, 0x88, 0x42, 0x31, 0x33,
+    0x1E, 0x35, 0x22, 0x4D, 0x42, 0x32, 0x33, 0x1E, 0x3C, 0x22, 0x54, 0x43, 0x31, 0x32, 0x49, 0x22,
+    0x0C, 0x21, 0xFD, 0x22, 0x22, 0x42, 0x31, 0x32, 0x22, 0x16, 0x22, 0x64, 0x41, 0x48, 0x21, 0x67,
+    0x21, 0x31, 0x04, 0x43, 0x14, 0x19, 0x25, 0x22, 0x73, 0x22, 0x73, 0x22, 0x73, 0x42, 0x25, 0x31,
+    0x22, 0x7D, 0x00, 0x0A, 0x44, 0x14, 0x19, 0x31, 0x34, 0x22, 0x84, 0x22, 0x84, 0x1F, 0xCC, 0x22,
+    0x35, 0x42, 0x48, 0x49, 0x22, 0x58, 0x22, 0x58, 0x42, 0x2D, 0x31, 0x22, 0x98, 0x00, 0x07, 0x42,
+    0x32, 0x49, 0x22, 0x9E, 0x22, 0x39, 0x48, 0x07, 0x14, 0x15, 0x23, 0x27, 0x2D, 0x37, 0x39, 0x22,
+    0xA6, 0x22, 0xA6, 0x22, 0xA6, 0x00, 0x07, 0x22, 0x57, 0x22, 0x9C, 0x22, 0x57, 0x22, 0xA6, 0x41,
+    0x32, 0x0F, 0x4B, 0x42, 0x22, 0x23, 0x21, 0xC4, 0x1D, 0x98, 0x43, 0x16, 0x25, 0x2B, 0x21, 0xC8,
+    0x22, 0x75, 0x00, 0x07, 0x41, 0x30, 0x21, 0x99, 0x41, 0x34, 0x1F, 0xCA, 0x21, 0x25, 0x04, 0x21,
+    0x34, 0x03, 0x22, 0x25, 0x27, 0x0E, 0x03, 0x21, 0x07, 0x05, 0x46, 0x1E, 0x25, 0x30, 0x31, 0x32,
+    0x40, 0x06, 0x07, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x03, 0x22, 0xEA, 0x20, 0xE8, 0x42, 0x32, 0x33,
+    0x22, 0xC4, 0x22, 0xFD, 0x43, 0x01, 0x1A, 0x25, 0x23, 0x04, 0x23, 0x04, 0x23, 0x04, 0x43, 0x2D,
+    0x32, 0x39, 0x23, 0x0E, 0x00, 0x0A, 0x23, 0x0E, 0x41, 0x0A, 0x22, 0xB2, 0x21, 0x07, 0x04, 0x21,
+    0x31, 0x03, 0x41, 0x17, 0x22, 0xB3, 0xA2, 0x27, 0x40, 0x07, 0x04, 0x21, 0x07, 0x05, 0x44, 0x2D,
+    0x31, 0x38, 0x39, 0x23, 0x24, 0x00, 0x03, 0x23, 0x24, 0x22, 0xF5, 0x42, 0x14, 0x27, 0x23, 0x3B,
+    0x22, 0xDD, 0x21, 0x23, 0x07, 0x42, 0x14, 0x31, 0x1A, 0xBB, 0x22, 0xF6, 0x21, 0x19, 0x07, 0x41,
+    0x23, 0x1F, 0xDC, 0x41, 0x32, 0x20, 0x5A, 0x42, 0x19, 0x25, 0x15, 0xF7, 0x1F, 0x75, 0x48, 0x01,
+    0x14, 0x19, 0x1A, 0x23, 0x25, 0x2A, 0x2B, 0x00, 0x0F, 0x00, 0x0B, 0x1E, 0x33, 0x23, 0x06, 0x1E,
+    0x18, 0x00, 0x0B, 0x0A, 0xD8, 0x00, 0x07, 0x41, 0x0A, 0x23, 0x31, 0x21, 0x1E, 0x04, 0x41, 0x2A,
+    0x23, 0x45, 0xC3, 0x02, 0x40, 0x41, 0x07, 0x74, 0x00, 0x07, 0x00, 0x04, 0x21, 0x07, 0x0A, 0x43,
+    0x1E, 0x2A, 0x2B, 0x00, 0x03, 0x23, 0x85, 0x23, 0x85, 0x42, 0x0A, 0x1A, 0x23, 0x98, 0x23, 0x3B,
+    0xDA, 0x01, 0x04, 0x08, 0x0A, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1E,
+    0x20, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x01, 0x67, 0x1E, 0xE2, 0x01,
+    0x5D, 0x01, 0x53, 0x01, 0x4C, 0x01, 0x45, 0x01, 0x3B, 0x01, 0x30, 0x17, 0xCD, 0x23, 0x5A, 0x01,
+    0x23, 0x01, 0x1C, 0x01, 0x08, 0x1B, 0xA5, 0x00, 0xFA, 0x23, 0x87, 0x00, 0xB6, 0x00, 0xA3, 0x00,
+    0x92, 0x00, 0x72, 0x00, 0x5E, 0x00, 0x54, 0x00, 0x42, 0x00, 0x11, 0x00, 0x07, 0x08, 0x46, 0x41,
+    0x1A, 0x1F, 0xCA, 0xA1, 0x44, 0x04, 0x41, 0x04, 0x1F, 0xD1, 0xA2, 0x30, 0x44, 0x07, 0x04, 0x41,
+    0x29, 0x23, 0xFF, 0x21, 0x38, 0x04, 0x21, 0x23, 0x03, 0x21, 0x38, 0x03, 0x21, 0x1A, 0x03, 0x42,
+    0x23, 0x32, 0x09, 0x1F, 0x23, 0xC9, 0x41, 0x29, 0x0E, 0xEB, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03,
+    0xA1, 0x25, 0x03, 0x41, 0x01, 0x21, 0xEE, 0x21, 0x38, 0x04, 0xA1, 0x19, 0x03, 0x22, 0x30, 0x32,
+    0x0D, 0x03, 0x41, 0x07, 0x22, 0x1F, 0x21, 0x31, 0x04, 0xC4, 0x01, 0x08, 0x27, 0x2A, 0x00, 0x2A,
+    0x00, 0x0C, 0x23, 0x81, 0x00, 0x03, 0x41, 0x22, 0x23, 0x44, 0x21, 0x2B, 0x04, 0x21, 0x32, 0x03,
+    0x41, 0x01, 0x23, 0xC8, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x21, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x23, 0x03, 0x41, 0x14, 0x21, 0x40, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03,
+    0x21, 0x28, 0x03, 0x41, 0x34, 0x07, 0xBB, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0x41, 0x1E, 0x04,
+    0x47, 0x21, 0x31, 0x04, 0xC5, 0x01, 0x04, 0x21, 0x27, 0x28, 0x00, 0x21, 0x13, 0xCC, 0x00, 0x14,
+    0x00, 0x0A, 0x00, 0x03, 0x21, 0x34, 0x10, 0x41, 0x0A, 0x12, 0x2F, 0x21, 0x34, 0x04, 0x21, 0x13,
+    0x03, 0x21, 0x32, 0x03, 0x42, 0x02, 0x1E, 0x05, 0xBC, 0x00, 0x03, 0x22, 0x15, 0x34, 0x17, 0x07,
+    0x41, 0x0B, 0x24, 0x4A, 0x42, 0x31, 0x32, 0x24, 0x7B, 0x00, 0x04, 0x42, 0x34, 0x35, 0x24, 0x82,
+    0x24, 0xBB, 0xC6, 0x0A, 0x14, 0x19, 0x1B, 0x23, 0x35, 0x00, 0x0E, 0x1F, 0x7C, 0x24, 0x7C, 0x23,
+    0xA0, 0x00, 0x07, 0x24, 0xC2, 0x41, 0x4C, 0x03, 0x20, 0x21, 0x1A, 0x04, 0x41, 0x15, 0x10, 0x16,
+    0x21, 0x32, 0x04, 0x42, 0x0A, 0x27, 0x00, 0x03, 0x13, 0x12, 0x21, 0x34, 0x07, 0x42, 0x13, 0x22,
+    0x24, 0x27, 0x24, 0x87, 0x21, 0x34, 0x07, 0x41, 0x4C, 0x21, 0xE9, 0x21, 0x23, 0x04, 0x21, 0x2D,
+    0x03, 0x42, 0x14, 0x1A, 0x07, 0xAE, 0x00, 0x03, 0x21, 0x40, 0x07, 0x41, 0x32, 0x23, 0x93, 0xC1,
+    0x21, 0x23, 0xD7, 0x42, 0x19, 0x2A, 0x25, 0x13, 0x00, 0x04, 0x21, 0x25, 0x07, 0x41, 0x15, 0x03,
+    0xA4, 0x41, 0x31, 0x23, 0x12, 0x21, 0x23, 0x04, 0x41, 0x0B, 0x25, 0x0C, 0x21, 0x15, 0x04, 0x21,
+    0x23, 0x03, 0x21, 0x34, 0x03, 0x42, 0x21, 0x2E, 0x24, 0x80, 0x00, 0x03, 0x41, 0x34, 0x24, 0xDE,
+    0x21, 0x01, 0x04, 0x21, 0x40, 0x03, 0x21, 0x0B, 0x03, 0xC5, 0x01, 0x21, 0x25, 0x40, 0x44, 0x00,
+    0x24, 0x0A, 0x73, 0x08, 0x48, 0x00, 0x14, 0x00, 0x03, 0x44, 0x0B, 0x21, 0x22, 0x25, 0x25, 0x59,
+    0x04, 0x31, 0x00, 0x3C, 0x00, 0x10, 0x41, 0x17, 0x24, 0x73, 0x21, 0x19, 0x04, 0x21, 0x31, 0x03,
+    0xC3, 0x01, 0x08, 0x40, 0x1A, 0x80, 0x00, 0x03, 0x01, 0xF5, 0x42, 0x07, 0x27, 0x00, 0x0A, 0x25,
+    0x7A, 0x42, 0x37, 0x48, 0x25, 0x2C, 0x25, 0x1B, 0x41, 0x04, 0x17, 0x80, 0x22, 0x01, 0x42, 0x0B,
+    0x04, 0x21, 0x07, 0x05, 0xC1, 0x46, 0x25, 0x94, 0x21, 0x27, 0x04, 0x52, 0x01, 0x07, 0x08, 0x14,
+    0x15, 0x19, 0x1A, 0x1F, 0x21, 0x23, 0x25, 0x2D, 0x40, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0xA1,
+    0x01, 0x8F, 0x01, 0x62, 0x01, 0x4E, 0x00, 0xF0, 0x00, 0xD9, 0x00, 0xC2, 0x05, 0x65, 0x00, 0xB1,
+    0x00, 0xA7, 0x00, 0x93, 0x00, 0x90, 0x00, 0x81, 0x00, 0x42, 0x00, 0x21, 0x00, 0x0A, 0x1F, 0x4C,
+    0x00, 0x03, 0xC1, 0x27, 0x14, 0x01, 0x42, 0x19, 0x49, 0x25, 0xD6, 0x25, 0x9D, 0x21, 0x31, 0x07,
+    0x41, 0x27, 0x25, 0xD3, 0xA2, 0x01, 0x02, 0x07, 0x04, 0x41, 0x0B, 0x25, 0xD0, 0x21, 0x2A, 0x04,
+    0x21, 0x34, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x35, 0x03, 0x41, 0x23, 0x25, 0xAA, 0xA1, 0x41, 0x04,
+    0x4C, 0x0E, 0x0F, 0x14, 0x15, 0x19, 0x1A, 0x23, 0x27, 0x2C, 0x48, 0x49, 0x4B, 0x14, 0x2C, 0x00,
+    0x2E, 0x00, 0x1C, 0x25, 0x0A, 0x00, 0x0A, 0x00, 0x03, 0x01, 0x24, 0x25, 0x3A, 0x25, 0x9A, 0x26,
+    0x00, 0x26, 0x00, 0x26, 0x00, 0x43, 0x31, 0x37, 0x49, 0x26, 0x24, 0x25, 0xD0, 0x25, 0x19, 0xC2,
+    0x01, 0x16, 0x00, 0x0A, 0x25, 0x23, 0xC1, 0x01, 0x24, 0x13, 0xC1, 0x01, 0x1F, 0x98, 0x21, 0x07,
+    0x04, 0x44, 0x01, 0x07, 0x48, 0x4B, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x03, 0x26, 0x08, 0x42, 0x0F,
+    0x23, 0x26, 0x4E, 0x26, 0x4E, 0x42, 0x31, 0x38, 0x26, 0x54, 0x00, 0x07, 0xC4, 0x01, 0x23, 0x30,
+    0x48, 0x00, 0x07, 0x0B, 0x6C, 0x26, 0x5C, 0x25, 0x50, 0x42, 0x2D, 0x32, 0x26, 0x30, 0x26, 0x30,
+    0x41, 0x22, 0x1C, 0x06, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x21, 0x19, 0x03,
+    0x21, 0x34, 0x03, 0x41, 0x31, 0x26, 0x82, 0x21, 0x25, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x33, 0x03,
+    0x21, 0x08, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x41, 0x2A, 0x0C, 0x0E, 0xC3, 0x1B, 0x21,
+    0x40, 0x00, 0x07, 0x24, 0x51, 0x00, 0x04, 0x21, 0x08, 0x0A, 0x43, 0x0A, 0x18, 0x41, 0x26, 0x64,
+    0x26, 0x64, 0x00, 0x03, 0x41, 0x2A, 0x1C, 0x4A, 0x21, 0x32, 0x04, 0x21, 0x1E, 0x03, 0x21, 0x0D,
+    0x03, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x21, 0x08, 0x03, 0x21, 0x40, 0x03, 0xC3, 0x34, 0x35,
+    0x38, 0x00, 0x03, 0x26, 0xCD, 0x26, 0x01, 0x44, 0x10, 0x23, 0x34, 0x44, 0x24, 0xB4, 0x24, 0xB4,
+    0x26, 0xD7, 0x23, 0xC9, 0x43, 0x25, 0x35, 0x4C, 0x26, 0xE4, 0x26, 0xE4, 0x26, 0xE4, 0x41, 0x11,
+    0x26, 0xEE, 0x44, 0x11, 0x32, 0x34, 0x42, 0x00, 0x0E, 0x26, 0x94, 0x26, 0xF2, 0x00, 0x04, 0x41,
+    0x38, 0x1F, 0xC6, 0x21, 0x1B, 0x04, 0x21, 0x27, 0x03, 0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x42,
+    0x07, 0x48, 0x27, 0x0F, 0x26, 0xD6, 0xC6, 0x02, 0x08, 0x0A, 0x1A, 0x31, 0x32, 0x00, 0x0A, 0x19,
+    0x35, 0x24, 0x99, 0x27, 0x12, 0x00, 0x07, 0x27, 0x16, 0x41, 0x0A, 0x0C, 0x9E, 0xC3, 0x0B, 0x17,
+    0x40, 0x24, 0xE1, 0x26, 0x67, 0x00, 0x04, 0xC1, 0x01, 0x19, 0x56, 0x41, 0x1B, 0x26, 0x75, 0x21,
+    0x32, 0x04, 0x41, 0x31, 0x24, 0xD7, 0xA1, 0x1E, 0x04, 0x41, 0x25, 0x27, 0x2D, 0xC8, 0x01, 0x19,
+    0x27, 0x31, 0x32, 0x34, 0x35, 0x4C, 0x26, 0x15, 0x06, 0xC4, 0x00, 0x0E, 0x27, 0x2B, 0x00, 0x07,
+    0x26, 0xEF, 0x00, 0x04, 0x27, 0x4D, 0x41, 0x04, 0x1C, 0xFC, 0x21, 0x31, 0x04, 0xC2, 0x32, 0x35,
+    0x27, 0x6D, 0x27, 0x6D, 0x21, 0x23, 0x07, 0x41, 0x2B, 0x27, 0x6D, 0xC6, 0x1D, 0x20, 0x25, 0x32,
+    0x38, 0x40, 0x23, 0x6D, 0x00, 0x2E, 0x00, 0x11, 0x00, 0x07, 0x25, 0x7D, 0x00, 0x04, 0x41, 0x48,
+    0x25, 0x64, 0x41, 0x2E, 0x27, 0x88, 0xC3, 0x0A, 0x1A, 0x40, 0x00, 0x08, 0x25, 0xE1, 0x00, 0x04,
+    0x41, 0x34, 0x07, 0x66, 0x42, 0x07, 0x1E, 0x27, 0xA4, 0x00, 0x04, 0x42, 0x30, 0x38, 0x27, 0xAB,
+    0x00, 0x07, 0x41, 0x34, 0x26, 0x1B, 0x42, 0x14, 0x38, 0x26, 0xF0, 0x27, 0x01, 0x41, 0x35, 0x1D,
+    0x7D, 0xC3, 0x14, 0x15, 0x2B, 0x20, 0xD3, 0x00, 0x04, 0x27, 0x63, 0x41, 0x08, 0x27, 0x76, 0xA1,
+    0x38, 0x04, 0xA1, 0x01, 0x03, 0xC5, 0x18, 0x1A, 0x2A, 0x32, 0x35, 0x00, 0x23, 0x00, 0x1F, 0x0A,
+    0xD0, 0x00, 0x14, 0x00, 0x03, 0x41, 0x32, 0x0B, 0x2D, 0xC1, 0x34, 0x27, 0xB0, 0x41, 0x25, 0x11,
+    0xF2, 0x23, 0x23, 0x25, 0x42, 0x0C, 0x08, 0x04, 0xC1, 0x25, 0x15, 0x90, 0xA1, 0x32, 0x04, 0x21,
+    0x21, 0x03, 0x42, 0x25, 0x38, 0x28, 0x02, 0x00, 0x03, 0x42, 0x35, 0x38, 0x28, 0x09, 0x27, 0xFF,
+    0x42, 0x32, 0x48, 0x23, 0xF8, 0x27, 0xAA, 0x43, 0x19, 0x23, 0x25, 0x00, 0x0E, 0x25, 0x87, 0x00,
+    0x07, 0x42, 0x1B, 0x32, 0x27, 0x1F, 0x28, 0x21, 0x43, 0x23, 0x25, 0x27, 0x00, 0x07, 0x27, 0xC2,
+    0x27, 0xE2, 0x42, 0x25, 0x2B, 0x28, 0x32, 0x12, 0xA8, 0x41, 0x21, 0x27, 0xE4, 0x21, 0x32, 0x04,
+    0x21, 0x01, 0x03, 0x42, 0x07, 0x19, 0x28, 0x42, 0x00, 0x03, 0x41, 0x25, 0x20, 0x68, 0x41, 0x15,
+    0x21, 0x15, 0xC1, 0x49, 0x28, 0x48, 0x21, 0x2B, 0x04, 0xA3, 0x2B, 0x40, 0x41, 0x0F, 0x0B, 0x03,
+    0x21, 0x07, 0x07, 0x41, 0x4A, 0x28, 0x62, 0x21, 0x34, 0x04, 0xA1, 0x01, 0x03, 0x43, 0x01, 0x19,
+    0x22, 0x00, 0x03, 0x28, 0x6D, 0x28, 0x6D, 0xDA, 0x01, 0x07, 0x08, 0x09, 0x0D, 0x0E, 0x0F, 0x13,
+    0x14, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x28, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x48, 0x49,
+    0x4A, 0x4B, 0x02, 0x1B, 0x02, 0x0E, 0x27, 0xB1, 0x01, 0xF7, 0x01, 0xCD, 0x01, 0xAA, 0x01, 0xA0,
+    0x01, 0x85, 0x01, 0x61, 0x01, 0x4A, 0x01, 0x40, 0x00, 0xFC, 0x00, 0xE1, 0x00, 0xCC, 0x00, 0xA2,
+    0x00, 0x86, 0x00, 0x75, 0x00, 0x60, 0x00, 0x4F, 0x00, 0x45, 0x00, 0x34, 0x28, 0x19, 0x26, 0x68,
+    0x00, 0x17, 0x00, 0x0A, 0x27, 0xBC, 0x42, 0x21, 0x33, 0x28, 0xC6, 0x28, 0xC6, 0xC1, 0x20, 0x0D,
+    0x4A, 0xCD, 0x01, 0x0E, 0x0F, 0x13, 0x14, 0x19, 0x1A, 0x1B, 0x23, 0x25, 0x48, 0x49, 0x4A, 0x1C,
+    0xFE, 0x17, 0x22, 0x28, 0xD1, 0x28, 0xB2, 0x28, 0xD1, 0x28, 0xD1, 0x28, 0xD1, 0x27, 0x1F, 0x00,
+    0x0B, 0x28, 0xD1, 0x28, 0xD1, 0x00, 0x04, 0x28, 0xD0, 0x41, 0x38, 0x17, 0x38, 0x41, 0x17, 0x28,
+    0xB7, 0x22, 0x13, 0x19, 0x08, 0x04, 0x41, 0x27, 0x0F, 0x7A, 0x41, 0x23, 0x29, 0x06, 0x21, 0x27,
+    0x04, 0x44, 0x1A, 0x23, 0x25, 0x2C, 0x03, 0xA7, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x03, 0x42, 0x23,
+    0x25, 0x26, 0x25, 0x29, 0x1E, 0x21, 0x1A, 0x07, 0x41, 0x1B, 0x0A, 0x92, 0x21, 0x1B, 0x04, 0x41,
+    0x14, 0x28, 0xB0, 0xC3, 0x15, 0x2D, 0x44, 0x1F, 0xE5, 0x00, 0x07, 0x00, 0x04, 0x42, 0x27, 0x32,
+    0x29, 0x04, 0x28, 0xF7, 0x41, 0x23, 0x29, 0x34, 0xC4, 0x01, 0x07, 0x19, 0x2A, 0x00, 0x0B, 0x29,
+    0x48, 0x29, 0x48, 0x00, 0x04, 0xC1, 0x15, 0x22, 0x1C, 0x45, 0x07, 0x19, 0x2D, 0x32, 0x33, 0x29,
+    0x59, 0x29, 0x59, 0x00, 0x11, 0x1E, 0x65, 0x00, 0x04, 0x41, 0x04, 0x24, 0x70, 0xA1, 0x42, 0x04,
+    0x41, 0x25, 0x1E, 0x1E, 0xC4, 0x01, 0x02, 0x1B, 0x2B, 0x25, 0x5C, 0x25, 0x5C, 0x00, 0x04, 0x25,
+    0x66, 0x41, 0x15, 0x26, 0x99, 0x21, 0x2D, 0x04, 0x21, 0x49, 0x03, 0xA1, 0x01, 0x03, 0x21, 0x2D,
+    0x03, 0x21, 0x48, 0x03, 0xC5, 0x07, 0x19, 0x21, 0x22, 0x23, 0x29, 0x94, 0x29, 0x94, 0x29, 0x94,
+    0x29, 0x94, 0x00, 0x03, 0xC1, 0x04, 0x29, 0x4F, 0x42, 0x23, 0x38, 0x20, 0x5A, 0x24, 0xAF, 0xC2,
+    0x01, 0x1B, 0x00, 0x07, 0x29, 0x96, 0x41, 0x19, 0x24, 0xF4, 0xC3, 0x01, 0x23, 0x2B, 0x02, 0x2C,
+    0x0D, 0xA8, 0x00, 0x04, 0x45, 0x07, 0x19, 0x1A, 0x21, 0x27, 0x29, 0xC4, 0x00, 0x20, 0x04, 0x30,
+    0x00, 0x15, 0x00, 0x0A, 0x41, 0x36, 0x25, 0x4A, 0x41, 0x01, 0x0F, 0x6A, 0xA2, 0x01, 0x40, 0x08,
+    0x04, 0x46, 0x07, 0x19, 0x21, 0x2D, 0x32, 0x33, 0x00, 0x74, 0x00, 0x6D, 0x29, 0xE1, 0x00, 0x4D,
+    0x00, 0x1D, 0x00, 0x05, 0xC3, 0x01, 0x1A, 0x1B, 0x29, 0xF4, 0x00, 0xCC, 0x00, 0xCC, 0x41, 0x33,
+    0x28, 0xD9, 0x21, 0x49, 0x04, 0x41, 0x48, 0x25, 0xF7, 0x21, 0x37, 0x04, 0x21, 0x09, 0x03, 0x41,
+    0x19, 0x27, 0x7F, 0x21, 0x40, 0x04, 0x21, 0x48, 0x03, 0x21, 0x02, 0x03, 0xA3, 0x19, 0x40, 0x44,
+    0x1A, 0x10, 0x03, 0x44, 0x0A, 0x0B, 0x14, 0x19, 0x2A, 0x23, 0x00, 0x07, 0x2A, 0x23, 0x2A, 0x23,
+    0x44, 0x01, 0x07, 0x2D, 0x32, 0x2A, 0x30, 0x2A, 0x30, 0x00, 0x3C, 0x00, 0x0D, 0x41, 0x35, 0x11,
+    0xAF, 0x21, 0x15, 0x04, 0x21, 0x40, 0x03, 0x21, 0x22, 0x03, 0xC2, 0x01, 0x27, 0x0C, 0xB0, 0x2A,
+    0x4A, 0x44, 0x07, 0x27, 0x2D, 0x32, 0x2A, 0x51, 0x00, 0x0A, 0x29, 0x96, 0x00, 0x07, 0x5F, 0x27,
+    0x01, 0x07, 0x0A, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x23,
+    0x24, 0x25, 0x27, 0x29, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x38, 0x39,
+    0x40, 0x42, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x2A, 0x30, 0x29, 0xC5, 0x29, 0xAC, 0x29, 0x8F, 0x29,
+    0x82, 0x29, 0x6E, 0x29, 0x62, 0x29, 0x45, 0x28, 0xEF, 0x28, 0xCA, 0x29, 0x3C, 0x28, 0xB3, 0x28,
+    0x93, 0x28, 0x77, 0x28, 0x58, 0x19, 0x13, 0x18, 0x76, 0x16, 0x79, 0x15, 0xD5, 0x15, 0x67, 0x15,
+    0x42, 0x15, 0x2C, 0x14, 0xC9, 0x10, 0x4F, 0x0C, 0xB3, 0x08, 0x81, 0x06, 0xBE, 0x04, 0xC3, 0x04,
+    0x5E, 0x04, 0x1D, 0x01, 0xE7, 0x01, 0x8D, 0x01, 0x4D, 0x01, 0x39, 0x01, 0x2B, 0x01, 0x05, 0x00,
+    0x7D, 0x00, 0x2E, 0x00, 0x0D, 0x41, 0x4A, 0x2A, 0x80, 0x21, 0x37, 0x04, 0x41, 0x1A, 0x25, 0xE3,
+    0xA2, 0x08, 0x40, 0x07, 0x04, 0xC2, 0x08, 0x28, 0x26, 0xCD, 0x0B, 0x1B, 0xC1, 0x02, 0x26, 0x00,
+    0x21, 0x14, 0x04, 0x42, 0x22, 0x27, 0x2A, 0xF3, 0x2A, 0xF3, 0x42, 0x15, 0x23, 0x2A, 0xFA, 0x25,
+    0xCF, 0x48, 0x23, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x38, 0x48, 0x00, 0x1C, 0x2B, 0x00, 0x00, 0x11,
+    0x00, 0x0E, 0x00, 0x07, 0x2B, 0x01, 0x2A, 0x46, 0x2A, 0xF4, 0xC2, 0x16, 0x32, 0x20, 0x83, 0x2A,
+    0xE1, 0x42, 0x34, 0x36, 0x2B, 0x17, 0x2B, 0x17, 0x41, 0x37, 0x2A, 0xD0, 0x21, 0x19, 0x04, 0xA1,
+    0x40, 0x03, 0x41, 0x35, 0x23, 0xAE, 0x21, 0x19, 0x04, 0x21, 0x40, 0x03, 0x21, 0x21, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x23, 0x03, 0x41, 0x1E, 0x0A, 0xC3, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21,
+    0x23, 0x03, 0xA2, 0x18, 0x1B, 0x10, 0x03, 0x41, 0x1B, 0x15, 0xD3, 0xC5, 0x04, 0x08, 0x1B, 0x2D,
+    0x40, 0x27, 0x57, 0x09, 0xE2, 0x29, 0x38, 0x27, 0x43, 0x00, 0x04, 0x41, 0x38, 0x2B, 0x6A, 0x42,
+    0x19, 0x22, 0x2B, 0x56, 0x2A, 0x63, 0x45, 0x07, 0x19, 0x1A, 0x21, 0x38, 0x2B, 0x76, 0x2B, 0x76,
+    0x2B, 0x76, 0x2B, 0x76, 0x2A, 0xBB, 0xC1, 0x22, 0x1E, 0x5D, 0x46, 0x01, 0x07, 0x14, 0x19, 0x1A,
+    0x22, 0x2B, 0x8A, 0x2B, 0x8A, 0x2B, 0x8A, 0x00, 0x04, 0x2B, 0x8A, 0x2B, 0x8A, 0x41, 0x19, 0x2A,
+    0xD7, 0x21, 0x34, 0x04, 0x42, 0x04, 0x32, 0x00, 0x03, 0x2A, 0x7F, 0x41, 0x23, 0x03, 0xC6, 0x21,
+    0x34, 0x04, 0xA1, 0x18, 0x03, 0xA2, 0x20, 0x32, 0x11, 0x03, 0x21, 0x10, 0x05, 0x21, 0x29, 0x03,
+    0xC1, 0x19, 0x2B, 0xBF, 0x21, 0x19, 0x04, 0x41, 0x21, 0x2A, 0xC2, 0xD1, 0x07, 0x14, 0x15, 0x19,
+    0x1A, 0x21, 0x25, 0x2A, 0x2B, 0x2D, 0x31, 0x32, 0x33, 0x34, 0x38, 0x40, 0x41, 0x00, 0x9C, 0x2B,
+    0xCB, 0x2B, 0x65, 0x2B, 0xCB, 0x00, 0x79, 0x00, 0x70, 0x00, 0x60, 0x27, 0x41, 0x00, 0x5C, 0x00,
+    0x55, 0x1E, 0xFF, 0x00, 0x41, 0x2B, 0xCB, 0x00, 0x0E, 0x00, 0x07, 0x08, 0x50, 0x00, 0x04, 0x41,
+    0x19, 0x23, 0x75, 0x41, 0x49, 0x13, 0x79, 0x21, 0x35, 0x04, 0x42, 0x04, 0x1C, 0x00, 0x03, 0x13,
+    0x84, 0xC7, 0x02, 0x04, 0x09, 0x16, 0x27, 0x39, 0x40, 0x2B, 0x0F, 0x26, 0xE6, 0x2B, 0x0F, 0x2C,
+    0x11, 0x00, 0x12, 0x2B, 0xCB, 0x00, 0x07, 0xC1, 0x22, 0x2B, 0xC1, 0x42, 0x14, 0x19, 0x00, 0x04,
+    0x2C, 0x2B, 0x42, 0x07, 0x1A, 0x2C, 0x32, 0x2C, 0x32, 0xC1, 0x02, 0x10, 0x2B, 0x21, 0x19, 0x04,
+    0x42, 0x1A, 0x49, 0x2C, 0x40, 0x00, 0x03, 0x41, 0x21, 0x2B, 0x45, 0x21, 0x02, 0x04, 0x41, 0x36,
+    0x2C, 0x44, 0xA1, 0x17, 0x04, 0x21, 0x07, 0x03, 0x42, 0x2D, 0x31, 0x2A, 0x49, 0x2B, 0x53, 0x21,
+    0x21, 0x07, 0x21, 0x02, 0x03, 0x41, 0x21, 0x27, 0x1F, 0xA1, 0x02, 0x04, 0xC3, 0x01, 0x1A, 0x21,
+    0x00, 0x0A, 0x00, 0x03, 0x2C, 0x6C, 0xCC, 0x02, 0x27, 0x2B, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36,
+    0x38, 0x48, 0x49, 0x25, 0xD0, 0x00, 0x4B, 0x12, 0x08, 0x20, 0xD7, 0x00, 0x44, 0x2C, 0x76, 0x00,
+    0x36, 0x00, 0x2B, 0x00, 0x21, 0x00, 0x0A, 0x24, 0x55, 0x25, 0x88, 0x41, 0x02, 0x29, 0x25, 0xA1,
+    0x41, 0x04, 0x41, 0x49, 0x26, 0xF0, 0x21, 0x22, 0x04, 0xA1, 0x02, 0x03, 0x21, 0x37, 0x0A, 0x21,
+    0x22, 0x03, 0x21, 0x02, 0x03, 0xA1, 0x40, 0x03, 0x44, 0x01, 0x19, 0x1A, 0x49, 0x00, 0x0F, 0x2C,
+    0xB8, 0x00, 0x03, 0x2C, 0x7F, 0x43, 0x14, 0x1A, 0x22, 0x2C, 0xC5, 0x2C, 0xC5, 0x2C, 0xC5, 0x43,
+    0x01, 0x1A, 0x48, 0x2C, 0xCF, 0x2C, 0xCF, 0x2A, 0xC0, 0x42, 0x34, 0x38, 0x2C, 0xD8, 0x2C, 0x1E,
+    0x21, 0x22, 0x07, 0x21, 0x02, 0x03, 0x41, 0x22, 0x27, 0xA0, 0xA1, 0x02, 0x04, 0x45, 0x01, 0x1A,
+    0x21, 0x22, 0x49, 0x00, 0x0A, 0x00, 0x03, 0x2C, 0xED, 0x2C, 0xED, 0x2A, 0xDE, 0x42, 0x21, 0x2D,
+    0x2C, 0xFD, 0x2C, 0xC4, 0x42, 0x2D, 0x33, 0x2C, 0xCB, 0x2D, 0x04, 0x4B, 0x14, 0x2D, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x38, 0x48, 0x49, 0x2D, 0x0B, 0x24, 0x73, 0x00, 0x6C, 0x00, 0x53, 0x00,
+    0x46, 0x2D, 0x0B, 0x00, 0x3C, 0x2C, 0x8C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x07, 0x41, 0x04, 0x1D,
+    0xC0, 0x41, 0x02, 0x13, 0xA5, 0x47, 0x21, 0x23, 0x31, 0x34, 0x35, 0x36, 0x38, 0x2D, 0x35, 0x00,
+    0x08, 0x2C, 0x30, 0x29, 0x1D, 0x2D, 0x35, 0x2B, 0x26, 0x00, 0x04, 0xC2, 0x14, 0x22, 0x2D, 0x4B,
+    0x2D, 0x4B, 0x42, 0x31, 0x34, 0x2D, 0x51, 0x2D, 0x51, 0x21, 0x25, 0x07, 0xA1, 0x02, 0x03, 0x45,
+    0x01, 0x07, 0x1A, 0x21, 0x48, 0x00, 0x03, 0x2D, 0x5F, 0x2D, 0x5F, 0x2D, 0x5F, 0x2C, 0xA4, 0x4A,
+    0x1A, 0x21, 0x27, 0x31, 0x32, 0x34, 0x36, 0x38, 0x39, 0x49, 0x2D, 0x6F, 0x2D, 0x6F, 0x2D, 0x36,
+    0x01, 0x3D, 0x00, 0x24, 0x29, 0x57, 0x2D, 0x65, 0x00, 0x10, 0x17, 0x69, 0x2D, 0x65, 0x41, 0x2B,
+    0x2D, 0x30, 0xA1, 0x42, 0x04, 0xC2, 0x02, 0x43, 0x22, 0xFE, 0x2B, 0x64, 0x41, 0x02, 0x13, 0x2E,
+    0xC2, 0x40, 0x43, 0x00, 0x04, 0x2B, 0x6F, 0x41, 0x27, 0x2D, 0x16, 0x21, 0x02, 0x04, 0x21, 0x44,
+    0x03, 0x41, 0x1E, 0x1B, 0x49, 0x21, 0x34, 0x04, 0xC4, 0x14, 0x15, 0x17, 0x43, 0x2C, 0xF2, 0x2D,
+    0x52, 0x00, 0x03, 0x2B, 0x87, 0x41, 0x27, 0x0F, 0x27, 0x21, 0x02, 0x04, 0xA1, 0x40, 0x03, 0x45,
+    0x01, 0x0D, 0x14, 0x1A, 0x49, 0x00, 0x21, 0x00, 0x17, 0x2D, 0xCF, 0x00, 0x03, 0x2D, 0x96, 0x41,
+    0x02, 0x22, 0x0C, 0xC6, 0x01, 0x07, 0x14, 0x19, 0x22, 0x27, 0x2D, 0xE3, 0x2D, 0xE3, 0x2D, 0xE3,
+    0x2D, 0xE3, 0x00, 0x04, 0x2D, 0xE3, 0x41, 0x32, 0x12, 0x84, 0x49, 0x07, 0x14, 0x19, 0x1A, 0x22,
+    0x31, 0x32, 0x34, 0x49, 0x2D, 0xFA, 0x00, 0x68, 0x00, 0x65, 0x2D, 0xFA, 0x00, 0x5A, 0x00, 0x2B,
+    0x00, 0x17, 0x2D, 0xAB, 0x00, 0x04, 0x43, 0x13, 0x31, 0x35, 0x2A, 0xAB, 0x2D, 0x5B, 0x2D, 0xD0,
+    0x42, 0x2D, 0x34, 0x2E, 0x16, 0x2D, 0xE7, 0x41, 0x25, 0x2D, 0x22, 0x21, 0x2B, 0x04, 0x41, 0x02,
+    0x16, 0x3E, 0x41, 0x0A, 0x2D, 0xB3, 0x42, 0x2D, 0x32, 0x2E, 0x36, 0x2D, 0x31, 0xCE, 0x01, 0x04,
+    0x0A, 0x14, 0x19, 0x25, 0x27, 0x2A, 0x40, 0x41, 0x42, 0x43, 0x44, 0x49, 0x00, 0x1D, 0x12, 0x2F,
+    0x27, 0x4F, 0x2D, 0x77, 0x23, 0xFD, 0x20, 0x5C, 0x2D, 0xEB, 0x2D, 0xEE, 0x00, 0x12, 0x00, 0x0F,
+    0x0F, 0x55, 0x00, 0x0B, 0x00, 0xAF, 0x00, 0x07, 0x43, 0x2D, 0x32, 0x35, 0x2E, 0x5E, 0x2E, 0x2F,
+    0x2E, 0x68, 0x41, 0x01, 0x2A, 0x20, 0xC3, 0x14, 0x2A, 0x41, 0x24, 0x36, 0x07, 0xF3, 0x00, 0x04,
+    0x42, 0x04, 0x17, 0x1D, 0xC8, 0x12, 0xFD, 0x21, 0x30, 0x07, 0x21, 0x23, 0x03, 0x41, 0x02, 0x2B,
+    0x7F, 0xC6, 0x02, 0x04, 0x1E, 0x40, 0x43, 0x44, 0x07, 0x03, 0x1D, 0xD9, 0x00, 0x07, 0x00, 0x04,
+    0x2C, 0x60, 0x2E, 0x4B, 0x41, 0x37, 0x2C, 0x95, 0x42, 0x31, 0x49, 0x2A, 0x90, 0x2D, 0x9C, 0x41,
+    0x20, 0x13, 0x2C, 0x41, 0x0A, 0x2B, 0x48, 0x42, 0x14, 0x1D, 0x00, 0x04, 0x29, 0xF5, 0x42, 0x01,
+    0x23, 0x2D, 0xB9, 0x2E, 0xB4, 0x41, 0x17, 0x0A, 0xC6, 0xD1, 0x01, 0x07, 0x09, 0x0A, 0x14, 0x15,
+    0x17, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x2A, 0x2D, 0x40, 0x41, 0x42, 0x2E, 0xC9, 0x00, 0x8C, 0x2C,
+    0x9F, 0x2E, 0xB9, 0x2E, 0xC9, 0x2D, 0xC0, 0x00, 0x61, 0x00, 0x53, 0x00, 0x38, 0x2E, 0xC9, 0x00,
+    0x25, 0x00, 0x21, 0x20, 0xE8, 0x00, 0x1A, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x48, 0x28,
+    0x0F, 0x41, 0x02, 0x25, 0x1A, 0x21, 0x21, 0x04, 0x41, 0x21, 0x27, 0xCF, 0x21, 0x02, 0x04, 0x21,
+    0x40, 0x03, 0x21, 0x01, 0x03, 0x41, 0x21, 0x26, 0xF4, 0x21, 0x30, 0x04, 0x21, 0x02, 0x03, 0x21,
+    0x01, 0x03, 0x23, 0x2D, 0x31, 0x38, 0x1D, 0x10, 0x03, 0x42, 0x34, 0x38, 0x2F, 0x28, 0x2F, 0x28,
+    0x41, 0x02, 0x22, 0x27, 0x21, 0x41, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x49, 0x03, 0x42, 0x19, 0x22,
+    0x1C, 0x0B, 0x00, 0x03, 0x42, 0x0B, 0x18, 0x2E, 0xEF, 0x2D, 0x35, 0x45, 0x02, 0x08, 0x16, 0x21,
+    0x22, 0x2A, 0xF9, 0x2B, 0xE0, 0x2F, 0x4A, 0x00, 0x07, 0x2B, 0xE0, 0x46, 0x02, 0x19, 0x21, 0x22,
+    0x40, 0x41, 0x00, 0x5E, 0x2F, 0x00, 0x00, 0x39, 0x00, 0x32, 0x00, 0x1E, 0x00, 0x10, 0x42, 0x2D,
+    0x49, 0x2F, 0x6D, 0x2F, 0x19, 0xA1, 0x02, 0x07, 0xC1, 0x01, 0x2C, 0x0D, 0x42, 0x01, 0x35, 0x2F,
+    0x36, 0x1F, 0x21, 0xA1, 0x2A, 0x07, 0x21, 0x11, 0x03, 0x42, 0x37, 0x49, 0x2F, 0x50, 0x2E, 0x7D,
+    0x41, 0x27, 0x2C, 0x25, 0x21, 0x2B, 0x04, 0x21, 0x07, 0x03, 0x21, 0x31, 0x03, 0x41, 0x20, 0x2F,
+    0x9D, 0x21, 0x32, 0x04, 0x43, 0x01, 0x04, 0x1A, 0x27, 0xA9, 0x2E, 0x94, 0x2F, 0x3E, 0xCE, 0x02,
+    0x04, 0x08, 0x14, 0x15, 0x1A, 0x21, 0x22, 0x25, 0x2A, 0x2B, 0x40, 0x41, 0x43, 0x00, 0x25, 0x2F,
+    0x59, 0x00, 0x14, 0x25, 0x6E, 0x2F, 0x48, 0x2D, 0xB0, 0x29, 0xFC, 0x25, 0x6E, 0x00, 0x0D, 0x2F,
+    0x75, 0x2F, 0x95, 0x00, 0x0A, 0x18, 0x89, 0x2D, 0x7D, 0x41, 0x19, 0x2C, 0x6E, 0x21, 0x32, 0x04,
+    0xC2, 0x21, 0x30, 0x00, 0x03, 0x2F, 0xE0, 0x21, 0x22, 0x07, 0x21, 0x34, 0x03, 0x21, 0x15, 0x03,
+    0x41, 0x19, 0x17, 0x6A, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x42, 0x34, 0x48, 0x2F, 0xFA, 0x2F,
+    0xA5, 0x42, 0x2D, 0x35, 0x2F, 0xF7, 0x30, 0x01, 0x42, 0x2A, 0x4C, 0x2C, 0xD8, 0x30, 0x08, 0x42,
+    0x21, 0x39, 0x2F, 0xBA, 0x2F, 0x90, 0x41, 0x21, 0x30, 0x12, 0x41, 0x15, 0x30, 0x19, 0xC8, 0x0A,
+    0x15, 0x17, 0x18, 0x2A, 0x2B, 0x40, 0x42, 0x00, 0x27, 0x00, 0x24, 0x00, 0x1D, 0x00, 0x16, 0x00,
+    0x0F, 0x00, 0x08, 0x26, 0xA6, 0x00, 0x04, 0x42, 0x31, 0x35, 0x2F, 0xFE, 0x2F, 0xA6, 0x41, 0x48,
+    0x17, 0xB4, 0x21, 0x35, 0x04, 0x21, 0x04, 0x03, 0xC5, 0x02, 0x0B, 0x1E, 0x40, 0x44, 0x00, 0x11,
+    0x2F, 0xF3, 0x2F, 0xEA, 0x00, 0x03, 0x1C, 0xE0, 0xC1, 0x25, 0x2C, 0x40, 0x42, 0x19, 0x27, 0x30,
+    0x5C, 0x00, 0x04, 0x4B, 0x04, 0x07, 0x0A, 0x13, 0x14, 0x15, 0x19, 0x1A, 0x22, 0x27, 0x49, 0x30,
+    0x63, 0x00, 0xEE, 0x00, 0xEB, 0x00, 0xDD, 0x00, 0xB5, 0x00, 0x76, 0x00, 0x45, 0x00, 0x1B, 0x30,
+    0x63, 0x30, 0x63, 0x00, 0x07, 0xC3, 0x1A, 0x2D, 0x4A, 0x30, 0x85, 0x2E, 0x76, 0x2A, 0x66, 0x41,
+    0x14, 0x30, 0x85, 0xC2, 0x14, 0x41, 0x2E, 0x70, 0x00, 0x04, 0x41, 0x1A, 0x2E, 0xE5, 0x21, 0x29,
+    0x04, 0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0x21, 0x25, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x27, 0x03,
+    0x21, 0x38, 0x03, 0x42, 0x33, 0x48, 0x30, 0xB3, 0x30, 0x4D, 0x42, 0x2D, 0x31, 0x30, 0x81, 0x2F,
+    0xB5, 0x41, 0x38, 0x30, 0x88, 0x41, 0x25, 0x30, 0x8C, 0x21, 0x04, 0x04, 0xC9, 0x01, 0x04, 0x15,
+    0x17, 0x1B, 0x21, 0x25, 0x41, 0x43, 0x2F, 0xCA, 0x00, 0x19, 0x00, 0x12, 0x00, 0x0B, 0x30, 0xC8,
+    0x2E, 0x80, 0x2C, 0xBE, 0x00, 0x03, 0x2E, 0x9B, 0x41, 0x35, 0x1B, 0x6B, 0x42, 0x19, 0x23, 0x00,
+    0x04, 0x2E, 0xC2, 0xC4, 0x19, 0x23, 0x32, 0x44, 0x12, 0x23, 0x23, 0x12, 0x30, 0xE9, 0x2F, 0x6B,
+    0x41, 0x2A, 0x30, 0xAB, 0x21, 0x25, 0x04, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0x41, 0x2A, 0x31,
+    0x03, 0x21, 0x41, 0x04, 0x21, 0x01, 0x03, 0x21, 0x41, 0x03, 0x21, 0x30, 0x03, 0xC3, 0x17, 0x2A,
+    0x49, 0x00, 0x13, 0x00, 0x03, 0x30, 0xB7, 0xC3, 0x02, 0x15, 0x2A, 0x26, 0x79, 0x30, 0x1E, 0x2C,
+    0x9D, 0x41, 0x35, 0x2D, 0x19, 0xC3, 0x08, 0x1E, 0x21, 0x00, 0x04, 0x29, 0x53, 0x2C, 0x73, 0x41,
+    0x31, 0x2C, 0xB5, 0x42, 0x21, 0x22, 0x30, 0xDD, 0x00, 0x04, 0xD0, 0x01, 0x07, 0x08, 0x13, 0x14,
+    0x17, 0x19, 0x1A, 0x1E, 0x21, 0x22, 0x25, 0x27, 0x2B, 0x2D, 0x44, 0x00, 0xC5, 0x00, 0xB7, 0x31,
+    0x04, 0x00, 0x9A, 0x00, 0x7E, 0x00, 0x5E, 0x00, 0x57, 0x31, 0x4A, 0x23, 0x69, 0x00, 0x2D, 0x00,
+    0x23, 0x31, 0x4A, 0x00, 0x15, 0x00, 0x07, 0x1E, 0xAD, 0x2E, 0xF4, 0x41, 0x2A, 0x10, 0x72, 0x46,
+    0x01, 0x07, 0x13, 0x1B, 0x21, 0x48, 0x0B, 0xEB, 0x31, 0x7F, 0x31, 0x7F, 0x00, 0x04, 0x31, 0x7F,
+    0x31, 0x75, 0x41, 0x2A, 0x2E, 0x5F, 0x42, 0x30, 0x32, 0x31, 0x96, 0x00, 0x04, 0x41, 0x16, 0x30,
+    0xD7, 0x21, 0x34, 0x04, 0x21, 0x27, 0x03, 0x21, 0x33, 0x03, 0xA1, 0x19, 0x03, 0x21, 0x18, 0x03,
+    0x21, 0x38, 0x03, 0x21, 0x27, 0x03, 0x21, 0x32, 0x03, 0x21, 0x19, 0x03, 0x44, 0x21, 0x27, 0x38,
+    0x49, 0x31, 0xBC, 0x31, 0xB2, 0x31, 0x01, 0x31, 0x56, 0x42, 0x14, 0x37, 0x31, 0xC9, 0x31, 0x7A,
+    0x42, 0x32, 0x39, 0x31, 0xD0, 0x31, 0x81, 0x43, 0x2D, 0x39, 0x49, 0x31, 0x88, 0x31, 0xD6, 0x31,
+    0x71, 0x42, 0x2D, 0x32, 0x31, 0xE0, 0x31, 0xE1, 0x43, 0x21, 0x2D, 0x35, 0x31, 0xE8, 0x31, 0xE7,
+    0x2D, 0xD0, 0x41, 0x39, 0x31, 0xA3, 0x42, 0x19, 0x21, 0x31, 0xDD, 0x31, 0x90, 0x41, 0x06, 0x31,
+    0xFD, 0x41, 0x0D, 0x31, 0x70, 0x21, 0x2B, 0x04, 0x21, 0x43, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x37,
+    0x03, 0x41, 0x23, 0x31, 0x80, 0x46, 0x0B, 0x17, 0x1B, 0x21, 0x2A, 0x2B, 0x31, 0xAF, 0x31, 0xAF,
+    0x31, 0x96, 0x00, 0x18, 0x00, 0x07, 0x00, 0x04, 0x44, 0x15, 0x21, 0x22, 0x23, 0x31, 0xA9, 0x31,
+    0x23, 0x32, 0x28, 0x31, 0xD9, 0x41, 0x25, 0x31, 0xB6, 0x43, 0x0B, 0x15, 0x16, 0x31, 0xBA, 0x31,
+    0xBA, 0x32, 0x39, 0xD4, 0x01, 0x02, 0x04, 0x08, 0x15, 0x16, 0x17, 0x19, 0x1B, 0x1C, 0x21, 0x22,
+    0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x24, 0xB3, 0x00, 0x87, 0x06, 0xD8, 0x19, 0x8F,
+    0x00, 0x7A, 0x30, 0x20, 0x00, 0x73, 0x32, 0x42, 0x32, 0x3F, 0x32, 0x39, 0x00, 0x6C, 0x00, 0x62,
+    0x00, 0x5B, 0x00, 0x51, 0x00, 0x4D, 0x2B, 0x0A, 0x00, 0x2E, 0x00, 0x1B, 0x00, 0x0E, 0x00, 0x0A,
+    0x46, 0x13, 0x14, 0x1B, 0x23, 0x48, 0x49, 0x00, 0xEA, 0x32, 0x80, 0x00, 0xC7, 0x32, 0x80, 0x32,
+    0x80, 0x00, 0x3D, 0x42, 0x32, 0x36, 0x32, 0x93, 0x32, 0x89, 0x41, 0x37, 0x32, 0x4B, 0xC4, 0x02,
+    0x15, 0x1E, 0x2D, 0x30, 0x7B, 0x00, 0x0B, 0x00, 0x04, 0x00, 0xAC, 0xC3, 0x09, 0x2B, 0x43, 0x0B,
+    0x1D, 0x32, 0x45, 0x30, 0x7A, 0x42, 0x07, 0x19, 0x32, 0xB5, 0x00, 0x0A, 0x22, 0x07, 0x49, 0x1E,
+    0x07, 0xC1, 0x43, 0x30, 0x90, 0xC1, 0x02, 0x30, 0xB6, 0xC1, 0x1C, 0x32, 0x03, 0x22, 0x19, 0x2D,
+    0x08, 0x04, 0x22, 0x19, 0x48, 0x11, 0x05, 0x42, 0x32, 0x49, 0x32, 0xCD, 0x2B, 0xE9, 0x41, 0x27,
+    0x30, 0xCF, 0x41, 0x08, 0x15, 0xE1, 0x21, 0x34, 0x04, 0x42, 0x32, 0x36, 0x32, 0x8B, 0x32, 0xE8,
+    0x41, 0x02, 0x32, 0x8A, 0x41, 0x1C, 0x32, 0xBB, 0xCA, 0x17, 0x19, 0x1A, 0x1E, 0x22, 0x27, 0x28,
+    0x2B, 0x40, 0x41, 0x31, 0xEC, 0x00, 0x21, 0x18, 0x74, 0x32, 0x9A, 0x00, 0x1A, 0x00, 0x12, 0x00,
+    0x0F, 0x16, 0x18, 0x00, 0x08, 0x00, 0x04, 0x41, 0x31, 0x05, 0x66, 0x21, 0x23, 0x04, 0xC2, 0x17,
+    0x19, 0x00, 0x03, 0x2F, 0x1A, 0x41, 0x35, 0x20, 0xBD, 0x21, 0x23, 0x04, 0x21, 0x17, 0x03, 0x21,
+    0x19, 0x03, 0x21, 0x34, 0x03, 0x41, 0x1C, 0x32, 0xA4, 0xA2, 0x2D, 0x44, 0x07, 0x04, 0x41, 0x38,
+    0x33, 0x34, 0x21, 0x19, 0x04, 0x21, 0x19, 0x84, 0x48, 0x01, 0x02, 0x14, 0x19, 0x21, 0x22, 0x2B,
+    0x48, 0x33, 0x48, 0x0C, 0x06, 0x33, 0x48, 0x00, 0x50, 0x00, 0x2A, 0x00, 0x0F, 0x00, 0x06, 0x00,
+    0x03, 0x41, 0x35, 0x33, 0x12, 0xA1, 0x23, 0x04, 0x41, 0x47, 0x16, 0x8C, 0x21, 0x02, 0x04, 0xA1,
+    0x40, 0x03, 0xA2, 0x14, 0x48, 0x0D, 0x03, 0x41, 0x08, 0x33, 0x11, 0x41, 0x21, 0x32, 0xC0, 0x43,
+    0x35, 0x37, 0x39, 0x32, 0xEE, 0x33, 0x46, 0x32, 0xEE, 0x41, 0x21, 0x33, 0x70, 0xC4, 0x02, 0x19,
+    0x2B, 0x40, 0x00, 0x0E, 0x2A, 0x3F, 0x00, 0x04, 0x0C, 0x16, 0xC1, 0x2B, 0x33, 0x9A, 0xC2, 0x19,
+    0x22, 0x33, 0x9E, 0x00, 0x04, 0xC1, 0x07, 0x33, 0x4A, 0x42, 0x14, 0x32, 0x33, 0xA9, 0x33, 0x63,
+    0xC2, 0x14, 0x2A, 0x32, 0xEA, 0x00, 0x07, 0xC7, 0x07, 0x15, 0x19, 0x21, 0x22, 0x27, 0x41, 0x33,
+    0xB7, 0x2C, 0x7E, 0x33, 0xB7, 0x33, 0xB7, 0x00, 0x12, 0x00, 0x07, 0x03, 0x28, 0x44, 0x21, 0x27,
+    0x2D, 0x32, 0x00, 0x40, 0x2D, 0x43, 0x00, 0x2F, 0x00, 0x16, 0x41, 0x48, 0x33, 0x85, 0x21, 0x22,
+    0x04, 0x21, 0x14, 0x03, 0x43, 0x27, 0x31, 0x34, 0x2A, 0x96, 0x00, 0x03, 0x33, 0x95, 0x41, 0x2A,
+    0x31, 0xA2, 0xCD, 0x02, 0x04, 0x07, 0x14, 0x19, 0x21, 0x22, 0x28, 0x2A, 0x2B, 0x40, 0x41, 0x44,
+    0x27, 0xE2, 0x00, 0x0E, 0x01, 0x31, 0x33, 0x2C, 0x33, 0xF2, 0x24, 0x67, 0x33, 0xF2, 0x29, 0xB2,
+    0x2C, 0x4B, 0x33, 0x8C, 0x00, 0x04, 0x20, 0x8A, 0x32, 0x6A, 0xC2, 0x15, 0x46, 0x34, 0x19, 0x34,
+    0x1A, 0x41, 0x08, 0x2F, 0x5F, 0x21, 0x40, 0x04, 0x41, 0x0A, 0x32, 0xED, 0x21, 0x32, 0x04, 0x42,
+    0x39, 0x49, 0x34, 0x2F, 0x32, 0x20, 0x41, 0x21, 0x31, 0xA6, 0x41, 0x1E, 0x33, 0xEB, 0xC8, 0x04,
+    0x15, 0x19, 0x22, 0x2A, 0x2B, 0x40, 0x42, 0x2D, 0x50, 0x00, 0x0F, 0x34, 0x3D, 0x2D, 0x50, 0x33,
+    0x06, 0x2A, 0xEC, 0x00, 0x08, 0x00, 0x04, 0x41, 0x36, 0x34, 0x56, 0x41, 0x14, 0x19, 0xED, 0x21,
+    0x19, 0x04, 0x21, 0x48, 0x03, 0x21, 0x1C, 0x03, 0xC9, 0x07, 0x1E, 0x21, 0x23, 0x27, 0x28, 0x2B,
+    0x41, 0x44, 0x00, 0x4E, 0x00, 0x43, 0x34, 0x68, 0x00, 0x3C, 0x00, 0x2A, 0x00, 0x11, 0x0C, 0x1E,
+    0x00, 0x03, 0x32, 0x6A, 0x43, 0x19, 0x2D, 0x32, 0x34, 0x84, 0x00, 0x92, 0x00, 0x1C, 0x5C, 0x07,
+    0x08, 0x13, 0x14, 0x17, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2D, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x42, 0x48, 0x49, 0x09, 0xAE, 0x09, 0x8D, 0x31,
+    0x23, 0x09, 0x74, 0x09, 0x6D, 0x08, 0xC3, 0x08, 0x7D, 0x08, 0x18, 0x07, 0x83, 0x07, 0x59, 0x07,
+    0x1F, 0x06, 0x94, 0x06, 0x78, 0x05, 0xC5, 0x05, 0x33, 0x04, 0x2B, 0x03, 0x44, 0x34, 0x8E, 0x03,
+    0x0F, 0x02, 0x0E, 0x01, 0xD2, 0x01, 0xBC, 0x01, 0x46, 0x01, 0x1C, 0x01, 0x17, 0x01, 0x13, 0x00,
+    0xC1, 0x00, 0x0A, 0x41, 0x21, 0x2A, 0x98, 0x42, 0x07, 0x19, 0x22, 0x21, 0x30, 0xC2, 0x22, 0x31,
+    0x32, 0x0B, 0x07, 0x21, 0x19, 0x05, 0x41, 0x1E, 0x33, 0xF4, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0x42, 0x25, 0x32, 0x32, 0xDD, 0x35, 0x00, 0x42, 0x19, 0x35, 0x35, 0x07, 0x34, 0x76, 0x41, 0x04,
+    0x34, 0x53, 0xC7, 0x01, 0x02, 0x04, 0x08, 0x15, 0x17, 0x44, 0x00, 0x15, 0x2A, 0x64, 0x00, 0x12,
+    0x31, 0xA7, 0x34, 0x09, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x2B, 0x35, 0x0C, 0x43, 0x32, 0x35, 0x48,
+    0x34, 0xE6, 0x00, 0x04, 0x34, 0xD1, 0x42, 0x32, 0x35, 0x10, 0x5A, 0x32, 0x03, 0xC3, 0x0A, 0x18,
+    0x20, 0x00, 0x07, 0x34, 0x05, 0x23, 0x1C, 0xC6, 0x01, 0x18, 0x19, 0x23, 0x2A, 0x32, 0x1A, 0x53,
+    0x34, 0x0F, 0x2B, 0xF9, 0x0D, 0x62, 0x00, 0x1B, 0x00, 0x0A, 0x41, 0x14, 0x34, 0x94, 0x41, 0x23,
+    0x22, 0xF6, 0x21, 0x32, 0x04, 0x41, 0x15, 0x34, 0xAA, 0x21, 0x44, 0x04, 0x42, 0x01, 0x1B, 0x34,
+    0x34, 0x00, 0x03, 0x21, 0x34, 0x07, 0x22, 0x08, 0x18, 0x14, 0x03, 0x42, 0x01, 0x15, 0x35, 0x15,
+    0x16, 0x35, 0x45, 0x19, 0x1A, 0x30, 0x32, 0x34, 0x35, 0x1C, 0x00, 0x28, 0x35, 0x82, 0x00, 0x0C,
+    0x00, 0x07, 0x41, 0x23, 0x11, 0x1F, 0xC2, 0x14, 0x41, 0x2E, 0xA8, 0x05, 0x07, 0x41, 0x01, 0x35,
+    0x93, 0xC5, 0x01, 0x07, 0x0B, 0x35, 0x42, 0x00, 0x0F, 0x35, 0x4C, 0x25, 0xFD, 0x00, 0x0B, 0x00,
+    0x04, 0x41, 0x1A, 0x31, 0xD3, 0x21, 0x27, 0x04, 0x42, 0x19, 0x32, 0x35, 0xB8, 0x00, 0x03, 0x41,
+    0x34, 0x2E, 0x3B, 0x41, 0x08, 0x2B, 0x59, 0xC4, 0x0A, 0x18, 0x19, 0x1E, 0x00, 0x0F, 0x1A, 0xD3,
+    0x00, 0x08, 0x00, 0x04, 0x21, 0x34, 0x0D, 0xC1, 0x34, 0x35, 0xCD, 0x42, 0x19, 0x23, 0x35, 0xDB,
+    0x00, 0x04, 0xC1, 0x2A, 0x35, 0x8D, 0x44, 0x23, 0x32, 0x34, 0x35, 0x35, 0xDC, 0x35, 0xE6, 0x04,
+    0xE6, 0x00, 0x04, 0x41, 0x1E, 0x26, 0x86, 0x21, 0x23, 0x04, 0x42, 0x23, 0x4C, 0x00, 0x03, 0x35,
+    0xFA, 0x42, 0x27, 0x49, 0x35, 0x46, 0x33, 0xD7, 0x42, 0x0A, 0x19, 0x35, 0x89, 0x36, 0x08, 0x41,
+    0x02, 0x35, 0x90, 0xCB, 0x01, 0x08, 0x17, 0x18, 0x19, 0x23, 0x25, 0x2A, 0x42, 0x43, 0x44, 0x2F,
+    0x71, 0x00, 0x38, 0x00, 0x2D, 0x00, 0x19, 0x2B, 0xD3, 0x00, 0x12, 0x32, 0xA8, 0x2A, 0x40, 0x34,
+    0x15, 0x00, 0x0B, 0x00, 0x04, 0x42, 0x34, 0x49, 0x35, 0xE6, 0x35, 0xCF, 0x41, 0x39, 0x35, 0xBD,
+    0xC4, 0x04, 0x0A, 0x2B, 0x44, 0x00, 0x0B, 0x00, 0x04, 0x35, 0xDA, 0x20, 0xCA, 0x42, 0x01, 0x04,
+    0x35, 0x15, 0x34, 0x3E, 0xA1, 0x32, 0x07, 0xC6, 0x01, 0x02, 0x04, 0x19, 0x1A, 0x2A, 0x25, 0x7E,
+    0x2F, 0x69, 0x34, 0x2D, 0x00, 0x03, 0x36, 0x4A, 0x35, 0x55, 0xC2, 0x21, 0x38, 0x34, 0x1E, 0x34,
+    0xB8, 0xC2, 0x21, 0x4C, 0x36, 0x13, 0x36, 0x71, 0x41, 0x25, 0x36, 0x6E, 0x46, 0x0A, 0x20, 0x25,
+    0x2B, 0x42, 0x44, 0x13, 0xA4, 0x00, 0x0B, 0x35, 0x70, 0x13, 0xA4, 0x00, 0x04, 0x36, 0x1E, 0xC1,
+    0x2B, 0x36, 0x29, 0x43, 0x0D, 0x31, 0x35, 0x00, 0x04, 0x36, 0x92, 0x36, 0x93, 0xC1, 0x41, 0x11,
+    0x15, 0x42, 0x23, 0x25, 0x35, 0x98, 0x34, 0x24, 0xC2, 0x04, 0x07, 0x00, 0x07, 0x2F, 0xBA, 0x43,
+    0x01, 0x07, 0x1A, 0x36, 0xAF, 0x00, 0x12, 0x00, 0x07, 0x44, 0x19, 0x27, 0x32, 0x34, 0x36, 0xB9,
+    0x36, 0x80, 0x35, 0xFE, 0x35, 0xB4, 0x42, 0x25, 0x27, 0x36, 0xBC, 0x36, 0xBC, 0x41, 0x2B, 0x36,
+    0x12, 0xC4, 0x2B, 0x41, 0x42, 0x44, 0x00, 0x18, 0x00, 0x0B, 0x00, 0x04, 0x36, 0x73, 0x41, 0x23,
+    0x32, 0x54, 0x21, 0x04, 0x04, 0x21, 0x40, 0x03, 0x41, 0x07, 0x16, 0xB2, 0x21, 0x2D, 0x04, 0xC2,
+    0x0B, 0x44, 0x00, 0x03, 0x21, 0x79, 0x46, 0x14, 0x19, 0x1A, 0x27, 0x48, 0x49, 0x00, 0x11, 0x36,
+    0xF6, 0x36, 0xF6, 0x00, 0x07, 0x30, 0x6C, 0x30, 0x6C, 0xC9, 0x01, 0x07, 0x0D, 0x14, 0x1A, 0x1F,
+    0x21, 0x27, 0x2A, 0x37, 0x09, 0x37, 0x09, 0x37, 0x09, 0x37, 0x09, 0x37, 0x09, 0x16, 0xD3, 0x37,
+    0x09, 0x37, 0x09, 0x37, 0x09, 0x41, 0x47, 0x35, 0x27, 0x21, 0x01, 0x04, 0x21, 0x40, 0x03, 0x41,
+    0x17, 0x31, 0x7D, 0x42, 0x07, 0x25, 0x37, 0x33, 0x37, 0x33, 0xC1, 0x21, 0x1C, 0x15, 0x43, 0x01,
+    0x31, 0x4C, 0x1C, 0xBA, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x25, 0x33, 0x23, 0x21, 0x44, 0x04, 0x21,
+    0x32, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x17, 0x03, 0x43, 0x15, 0x40, 0x42, 0x00, 0x1A, 0x26, 0xEF,
+    0x00, 0x03, 0x41, 0x23, 0x12, 0x26, 0x41, 0x23, 0x24, 0x48, 0x22, 0x1A, 0x1E, 0x08, 0x04, 0x41,
+    0x17, 0x10, 0x26, 0x22, 0x40, 0x44, 0x09, 0x04, 0x41, 0x2D, 0x22, 0x09, 0x21, 0x04, 0x04, 0x22,
+    0x0B, 0x27, 0x0C, 0x03, 0x24, 0x01, 0x1B, 0x2A, 0x42, 0x58, 0x55, 0x2C, 0x05, 0x41, 0x23, 0x37,
+    0x38, 0x41, 0x32, 0x13, 0x4B, 0x21, 0x21, 0x04, 0x41, 0x35, 0x22, 0x22, 0x21, 0x17, 0x04, 0x21,
+    0x2D, 0x03, 0x47, 0x04, 0x15, 0x1A, 0x21, 0x29, 0x40, 0x49, 0x00, 0x15, 0x37, 0xA2, 0x37, 0xA2,
+    0x37, 0xA2, 0x00, 0x0D, 0x00, 0x03, 0x37, 0xA2, 0x41, 0x37, 0x30, 0x7F, 0x21, 0x23, 0x04, 0x41,
+    0x04, 0x1C, 0xCF, 0x22, 0x04, 0x42, 0x07, 0x04, 0xC5, 0x01, 0x19, 0x21, 0x48, 0x49, 0x00, 0x05,
+    0x37, 0xC8, 0x37, 0xC8, 0x37, 0xBE, 0x35, 0xB9, 0x41, 0x23, 0x03, 0x81, 0xC2, 0x04, 0x40, 0x00,
+    0x04, 0x12, 0x54, 0x21, 0x19, 0x07, 0x44, 0x14, 0x19, 0x2D, 0x49, 0x37, 0xE6, 0x37, 0xE6, 0x37,
+    0xE6, 0x00, 0x03, 0x41, 0x23, 0x37, 0xAD, 0x21, 0x2A, 0x04, 0x21, 0x14, 0x03, 0x21, 0x31, 0x03,
+    0xC4, 0x01, 0x08, 0x22, 0x48, 0x38, 0x00, 0x00, 0x03, 0x38, 0x00, 0x37, 0xC7, 0x42, 0x19, 0x32,
+    0x37, 0xA7, 0x37, 0xC7, 0xC1, 0x04, 0x32, 0xE9, 0x21, 0x19, 0x04, 0xC9, 0x01, 0x04, 0x11, 0x20,
+    0x21, 0x22, 0x27, 0x28, 0x48, 0x38, 0x1B, 0x1E, 0x8F, 0x00, 0x1B, 0x37, 0xF6, 0x23, 0xAF, 0x38,
+    0x1B, 0x00, 0x0E, 0x25, 0xFD, 0x00, 0x03, 0xC4, 0x14, 0x1A, 0x44, 0x48, 0x38, 0x37, 0x37, 0xD1,
+    0x18, 0x95, 0x38, 0x37, 0xC1, 0x27, 0x12, 0xB0, 0x41, 0x27, 0x1B, 0x6C, 0x21, 0x23, 0x04, 0xA1,
+    0x04, 0x03, 0x44, 0x07, 0x2D, 0x32, 0x33, 0x38, 0x52, 0x36, 0x43, 0x00, 0x0E, 0x00, 0x03, 0x41,
+    0x32, 0x2C, 0xE7, 0x52, 0x01, 0x1A, 0x23, 0x27, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x48, 0x49, 0x38, 0x63, 0x01, 0xF9, 0x01, 0xE7, 0x01, 0xD0, 0x37, 0xFD,
+    0x01, 0xB4, 0x01, 0x92, 0x01, 0x6D, 0x01, 0x5A, 0x38, 0x63, 0x00, 0xDF, 0x00, 0xC1, 0x00, 0x9B,
+    0x00, 0x7D, 0x00, 0x48, 0x00, 0x2C, 0x00, 0x11, 0x00, 0x04, 0x41, 0x16, 0x38, 0x7E, 0x21, 0x2A,
+    0x04, 0xC1, 0x2A, 0x2E, 0x37, 0xC3, 0x1A, 0x31, 0x32, 0x03, 0x4B, 0x00, 0x07, 0x00, 0x04, 0x41,
+    0x06, 0x14, 0xB0, 0x22, 0x2B, 0x42, 0x0E, 0x04, 0x41, 0x25, 0x05, 0x7A, 0x41, 0x17, 0x0D, 0x8A,
+    0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x21, 0x07, 0x03, 0x42,
+    0x23, 0x48, 0x00, 0x03, 0x30, 0xAE, 0x41, 0x21, 0x24, 0x10, 0x21, 0x39, 0x04, 0x41, 0x08, 0x35,
+    0x6A, 0x42, 0x1B, 0x40, 0x12, 0x5E, 0x00, 0x04, 0x42, 0x32, 0x33, 0x38, 0xAF, 0x00, 0x07, 0xC2,
+    0x27, 0x43, 0x27, 0x1E, 0x38, 0xB6, 0x21, 0x22, 0x07, 0x41, 0x19, 0x2E, 0x09, 0x21, 0x2D, 0x04,
+    0x21, 0x37, 0x03, 0x22, 0x15, 0x2A, 0x0D, 0x03, 0x42, 0x0D, 0x21, 0x38, 0x77, 0x38, 0x77, 0x21,
+    0x2B, 0x07, 0xCA, 0x02, 0x08, 0x15, 0x17, 0x20, 0x25, 0x2A, 0x2B, 0x40, 0x43, 0x00, 0x5A, 0x1B,
+    0x78, 0x38, 0x10, 0x00, 0x43, 0x00, 0x38, 0x00, 0x2A, 0x38, 0xB7, 0x10, 0xC8, 0x00, 0x0F, 0x00,
+    0x03, 0xC1, 0x41, 0x08, 0x68, 0x41, 0x22, 0x29, 0x1C, 0x21, 0x2D, 0x04, 0x21, 0x17, 0x03, 0x42,
+    0x34, 0x35, 0x00, 0x03, 0x39, 0x06, 0x41, 0x25, 0x1B, 0x53, 0x21, 0x04, 0x04, 0x41, 0x17, 0x35,
+    0x28, 0x21, 0x44, 0x04, 0x21, 0x19, 0x03, 0x42, 0x04, 0x2D, 0x38, 0xF9, 0x00, 0x03, 0x41, 0x4C,
+    0x37, 0x4F, 0x21, 0x23, 0x04, 0x41, 0x25, 0x12, 0x1C, 0x22, 0x2D, 0x35, 0x07, 0x04, 0x21, 0x1F,
+    0x05, 0x21, 0x23, 0x03, 0xC9, 0x01, 0x07, 0x14, 0x19, 0x23, 0x40, 0x41, 0x42, 0x44, 0x39, 0x74,
+    0x00, 0x62, 0x39, 0x74, 0x00, 0x43, 0x00, 0x35, 0x00, 0x2A, 0x00, 0x1D, 0x00, 0x03, 0x35, 0x4B,
+    0x41, 0x25, 0x0A, 0x93, 0xC2, 0x04, 0x1B, 0x00, 0x04, 0x39, 0x5B, 0x41, 0x19, 0x1C, 0x96, 0x41,
+    0x37, 0x2D, 0x8F, 0x21, 0x25, 0x04, 0xA2, 0x21, 0x40, 0x0B, 0x03, 0x41, 0x0A, 0x39, 0x8F, 0x41,
+    0x15, 0x1C, 0x5C, 0x21, 0x40, 0x04, 0x46, 0x01, 0x07, 0x15, 0x1A, 0x2A, 0x48, 0x39, 0xB6, 0x00,
+    0x10, 0x00, 0x0B, 0x39, 0xB6, 0x00, 0x03, 0x31, 0x1E, 0x41, 0x04, 0x03, 0x51, 0x21, 0x41, 0x04,
+    0x41, 0x34, 0x26, 0xE6, 0xA1, 0x2A, 0x04, 0xC7, 0x07, 0x14, 0x19, 0x22, 0x28, 0x2A, 0x44, 0x00,
+    0x0A, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x00, 0x03, 0x37, 0x0E, 0x41, 0x4C, 0x39,
+    0x9E, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x41, 0x4C, 0x38, 0x13, 0x21, 0x23, 0x04, 0x21, 0x2D,
+    0x03, 0x21, 0x1B, 0x03, 0xA2, 0x1A, 0x40, 0x10, 0x03, 0x46, 0x01, 0x07, 0x14, 0x19, 0x1B, 0x49,
+    0x3A, 0x09, 0x3A, 0x09, 0x3A, 0x09, 0x37, 0x21, 0x00, 0x05, 0x3A, 0x08, 0x41, 0x25, 0x1F, 0x07,
+    0x21, 0x41, 0x04, 0xC1, 0x04, 0x1A, 0xB0, 0xA3, 0x19, 0x1F, 0x48, 0x57, 0x07, 0x04, 0x41, 0x01,
+    0x33, 0x8C, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0x41, 0x22, 0x37, 0x54, 0x21, 0x17, 0x04, 0x21,
+    0x34, 0x03, 0x41, 0x31, 0x33, 0x09, 0x41, 0x2B, 0x39, 0xD7, 0x41, 0x1F, 0x35, 0x88, 0x21, 0x1F,
+    0x04, 0x21, 0x44, 0x03, 0x21, 0x01, 0x03, 0x21, 0x47, 0x03, 0x21, 0x25, 0x03, 0x21, 0x2B, 0x03,
+    0x21, 0x40, 0x03, 0x21, 0x48, 0x03, 0x21, 0x21, 0x03, 0x41, 0x49, 0x19, 0xC5, 0x21, 0x15, 0x04,
+    0x41, 0x2A, 0x39, 0xF1, 0xC8, 0x1B, 0x22, 0x27, 0x2A, 0x40, 0x41, 0x43, 0x44, 0x00, 0x3F, 0x1E,
+    0x66, 0x00, 0x35, 0x00, 0x32, 0x00, 0x2E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x04, 0x21, 0x19, 0x19,
+    0x21, 0x48, 0x03, 0xC1, 0x04, 0x39, 0x71, 0x41, 0x1B, 0x3A, 0x8D, 0xC2, 0x40, 0x42, 0x26, 0x32,
+    0x00, 0x04, 0x41, 0x25, 0x09, 0x63, 0xA1, 0x04, 0x04, 0x42, 0x07, 0x21, 0x3A, 0xA9, 0x00, 0x03,
+    0x45, 0x01, 0x1A, 0x21, 0x48, 0x49, 0x00, 0x1D, 0x3A, 0xB0, 0x00, 0x15, 0x38, 0xA1, 0x00, 0x07,
+    0x41, 0x25, 0x18, 0x54, 0x21, 0x04, 0x04, 0xA1, 0x41, 0x03, 0x21, 0x07, 0x03, 0x43, 0x2D, 0x32,
+    0x33, 0x00, 0x03, 0x39, 0xC8, 0x3A, 0xCD, 0xC1, 0x08, 0x39, 0xCB, 0x41, 0x17, 0x2D, 0xE4, 0x21,
+    0x38, 0x04, 0xA1, 0x2D, 0x03, 0x22, 0x07, 0x22, 0x0E, 0x03, 0x41, 0x25, 0x0E, 0x9C, 0xC2, 0x04,
+    0x41, 0x00, 0x04, 0x25, 0xA5, 0xA1, 0x22, 0x07, 0x43, 0x2D, 0x32, 0x33, 0x00, 0x13, 0x00, 0x03,
+    0x3A, 0xF8, 0x4D, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x48, 0x49,
+    0x3A, 0xF8, 0x01, 0x8E, 0x01, 0x6E, 0x01, 0x4C, 0x01, 0x2B, 0x3B, 0x02, 0x00, 0xF9, 0x00, 0xDB,
+    0x3A, 0xF8, 0x00, 0x72, 0x00, 0x52, 0x00, 0x35, 0x00, 0x0A, 0x41, 0x02, 0x3A, 0xF1, 0xA1, 0x41,
+    0x04, 0x41, 0x2B, 0x04, 0xB9, 0x21, 0x32, 0x04, 0x41, 0x19, 0x0A, 0x77, 0x41, 0x14, 0x3B, 0x03,
+    0xA3, 0x01, 0x02, 0x42, 0x0B, 0x08, 0x04, 0x42, 0x38, 0x39, 0x39, 0x38, 0x3A, 0xB6, 0x41, 0x19,
+    0x36, 0xFC, 0xA2, 0x04, 0x41, 0x0B, 0x04, 0x41, 0x15, 0x1C, 0xC1, 0x21, 0x34, 0x04, 0x45, 0x15,
+    0x17, 0x23, 0x25, 0x40, 0x16, 0x36, 0x3B, 0x5E, 0x16, 0x3D, 0x00, 0x03, 0x01, 0xAF, 0x42, 0x31,
+    0x34, 0x39, 0x5F, 0x00, 0x17, 0xA1, 0x15, 0x07, 0x43, 0x01, 0x19, 0x48, 0x3B, 0x78, 0x00, 0x03,
+    0x3B, 0x3F, 0x41, 0x25, 0x30, 0xD4, 0x41, 0x39, 0x29, 0x65, 0x41, 0x31, 0x29, 0x84, 0x22, 0x1A,
+    0x1E, 0x08, 0x04, 0x21, 0x21, 0x05, 0x21, 0x31, 0x03, 0xA1, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x21,
+    0x49, 0x03, 0x21, 0x37, 0x03, 0xC1, 0x27, 0x01, 0x66, 0x21, 0x48, 0x04, 0x41, 0x1E, 0x23, 0x26,
+    0x21, 0x40, 0x04, 0x21, 0x33, 0x03, 0xA1, 0x08, 0x03, 0x21, 0x07, 0x03, 0x21, 0x27, 0x03, 0x22,
+    0x35, 0x48, 0x16, 0x03, 0x41, 0x27, 0x35, 0x17, 0x21, 0x32, 0x04, 0x41, 0x37, 0x30, 0x79, 0x42,
+    0x02, 0x14, 0x00, 0x04, 0x37, 0x7D, 0x42, 0x14, 0x40, 0x30, 0xE6, 0x00, 0x07, 0x21, 0x01, 0x07,
+    0x21, 0x36, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x49, 0x03, 0x21, 0x39, 0x03, 0x41, 0x19, 0x1B, 0xDB,
+    0x42, 0x23, 0x49, 0x32, 0x3F, 0x3B, 0xB7, 0x42, 0x47, 0x48, 0x3A, 0xF2, 0x3B, 0xED, 0x43, 0x04,
+    0x09, 0x23, 0x00, 0x0E, 0x11, 0xF5, 0x00, 0x07, 0xA7, 0x04, 0x0A, 0x16, 0x22, 0x23, 0x2B, 0x40,
+    0x86, 0x66, 0x49, 0x40, 0x1F, 0x1C, 0x0A, 0x45, 0x01, 0x0D, 0x19, 0x21, 0x22, 0x3C, 0x17, 0x3C,
+    0x17, 0x3C, 0x17, 0x00, 0x0F, 0x3C, 0x17, 0x41, 0x46, 0x3C, 0x27, 0x43, 0x19, 0x27, 0x42, 0x21,
+    0xBD, 0x00, 0x04, 0x39, 0x1D, 0x41, 0x47, 0x2A, 0x0A, 0x21, 0x25, 0x04, 0x21, 0x4C, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x32, 0x03, 0xC2, 0x0A, 0x2A, 0x00, 0x03, 0x2C, 0x22, 0x21, 0x19, 0x07, 0x42,
+    0x32, 0x33, 0x3B, 0x4A, 0x3C, 0x4F, 0xC2, 0x07, 0x19, 0x16, 0xC2, 0x3C, 0x56, 0x21, 0x32, 0x07,
+    0x4C, 0x07, 0x19, 0x1A, 0x22, 0x23, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x48, 0x49, 0x01, 0x32, 0x01,
+    0x20, 0x01, 0x0E, 0x3C, 0x60, 0x3C, 0x60, 0x01, 0x02, 0x00, 0xE8, 0x00, 0x49, 0x00, 0x35, 0x00,
+    0x14, 0x00, 0x11, 0x00, 0x03, 0x41, 0x21, 0x1D, 0x3F, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03, 0x41,
+    0x32, 0x10, 0xF2, 0x21, 0x15, 0x04, 0x41, 0x10, 0x3C, 0x96, 0xC4, 0x01, 0x1A, 0x1B, 0x31, 0x00,
+    0x0E, 0x07, 0x40, 0x00, 0x07, 0x00, 0x04, 0x41, 0x01, 0x05, 0x41, 0x43, 0x04, 0x40, 0x42, 0x02,
+    0xB7, 0x00, 0x04, 0x3C, 0xAA, 0x45, 0x01, 0x15, 0x31, 0x35, 0x48, 0x3C, 0xB5, 0x37, 0x03, 0x37,
+    0xBC, 0x38, 0x9D, 0x3C, 0x60, 0x41, 0x41, 0x2E, 0xBD, 0x21, 0x14, 0x04, 0x21, 0x31, 0x03, 0x41,
+    0x47, 0x3C, 0xCE, 0x21, 0x25, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x40, 0x03, 0x21, 0x21, 0x03, 0x21,
+    0x34, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2A, 0x03, 0xA2, 0x2D, 0x40, 0x1C, 0x03, 0x21, 0x15, 0x05,
+    0x21, 0x35, 0x03, 0x21, 0x23, 0x03, 0x41, 0x0A, 0x3B, 0xF4, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03,
+    0x41, 0x21, 0x1F, 0xAD, 0x21, 0x40, 0x04, 0x21, 0x21, 0x03, 0x21, 0x39, 0x03, 0x41, 0x01, 0x03,
+    0x5A, 0x22, 0x31, 0x34, 0x04, 0x1B, 0xC1, 0x2A, 0x1C, 0xE0, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03,
+    0x41, 0x04, 0x1C, 0xEA, 0x21, 0x34, 0x04, 0x21, 0x23, 0x31, 0x21, 0x40, 0x03, 0xA1, 0x39, 0x03,
+    0x21, 0x01, 0x03, 0x22, 0x25, 0x34, 0x0F, 0x03, 0x41, 0x31, 0x2A, 0x4E, 0x41, 0x23, 0x2A, 0x76,
+    0x21, 0x23, 0x04, 0x42, 0x27, 0x32, 0x00, 0x03, 0x3D, 0x0A, 0x41, 0x1B, 0x1D, 0x14, 0x21, 0x47,
+    0x04, 0x41, 0x0B, 0x1F, 0xFE, 0x21, 0x40, 0x04, 0x21, 0x19, 0x03, 0x41, 0x19, 0x20, 0x08, 0x21,
+    0x40, 0x04, 0x42, 0x19, 0x2A, 0x00, 0x03, 0x1D, 0x2C, 0x41, 0x31, 0x3A, 0x5B, 0x21, 0x01, 0x04,
+    0x21, 0x34, 0x03, 0x21, 0x15, 0x03, 0x42, 0x01, 0x2D, 0x00, 0x03, 0x3C, 0x83, 0x41, 0x34, 0x04,
+    0x1B, 0x42, 0x17, 0x2A, 0x3D, 0x81, 0x3D, 0x81, 0x21, 0x4C, 0x07, 0x21, 0x23, 0x03, 0x22, 0x19,
+    0x34, 0x98, 0x03, 0x41, 0x34, 0x18, 0x98, 0x27, 0x0B, 0x14, 0x17, 0x19, 0x1F, 0x27, 0x2A, 0x49,
+    0x3F, 0x35, 0x21, 0x1A, 0x09, 0x04, 0x41, 0x2A, 0x3D, 0x8A, 0x21, 0x19, 0x04, 0x21, 0x25, 0x03,
+    0xA1, 0x40, 0x03, 0x42, 0x04, 0x23, 0x00, 0x03, 0x2A, 0xC9, 0x42, 0x17, 0x27, 0x00, 0x07, 0x30,
+    0x91, 0x41, 0x34, 0x12, 0x88, 0x42, 0x21, 0x23, 0x00, 0x04, 0x22, 0xB3, 0x41, 0x25, 0x20, 0x79,
+    0xA1, 0x40, 0x04, 0x21, 0x25, 0x03, 0x21, 0x23, 0x03, 0x43, 0x0B, 0x14, 0x17, 0x3D, 0x7B, 0x00,
+    0x14, 0x00, 0x03, 0xCD, 0x01, 0x08, 0x0B, 0x14, 0x17, 0x1F, 0x22, 0x27, 0x2A, 0x32, 0x40, 0x41,
+    0x42, 0x00, 0xF0, 0x00, 0xE6, 0x00, 0xD9, 0x00, 0xD2, 0x00, 0xC6, 0x00, 0xB0, 0x00, 0xAB, 0x39,
+    0xD5, 0x00, 0xA0, 0x2A, 0xF9, 0x00, 0x4C, 0x00, 0x29, 0x00, 0x0A, 0xC1, 0x31, 0x3D, 0x06, 0x42,
+    0x32, 0x40, 0x3D, 0xC0, 0x20, 0xB8, 0x42, 0x2D, 0x31, 0x3E, 0x15, 0x39, 0xFE, 0x41, 0x27, 0x2E,
+    0x04, 0x21, 0x32, 0x04, 0x41, 0x21, 0x1D, 0xEA, 0x21, 0x40, 0x04, 0x42, 0x34, 0x35, 0x00, 0x03,
+    0x3C, 0x2D, 0x41, 0x27, 0x04, 0x7F, 0x22, 0x25, 0x34, 0x0B, 0x04, 0x41, 0x4C, 0x3C, 0x3D, 0x21,
+    0x23, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x0B, 0x9B, 0x21, 0x40, 0x03, 0x21, 0x19, 0x03, 0x41, 0x14,
+    0x20, 0xFB, 0xC2, 0x40, 0x42, 0x00, 0x04, 0x3E, 0x03, 0xA1, 0x19, 0x07, 0x41, 0x0A, 0x20, 0xC2,
+    0x42, 0x34, 0x35, 0x3E, 0x60, 0x3D, 0xE1, 0x41, 0x2A, 0x3A, 0x42, 0x21, 0x34, 0x04, 0x21, 0x19,
+    0x03, 0x23, 0x0A, 0x14, 0x27, 0x15, 0x11, 0x03, 0x44, 0x2D, 0x32, 0x34, 0x39, 0x00, 0x2D, 0x00,
+    0x1F, 0x00, 0x07, 0x3E, 0x3F, 0x41, 0x2A, 0x01, 0x30, 0x41, 0x01, 0x19, 0x61, 0x21, 0x47, 0x04,
+    0x22, 0x23, 0x25, 0x0B, 0x03, 0x41, 0x0B, 0x3E, 0x95, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0x43,
+    0x19, 0x2D, 0x34, 0x1E, 0x69, 0x00, 0x03, 0x00, 0x0A, 0x22, 0x1E, 0x21, 0x19, 0x0A, 0x42, 0x04,
+    0x25, 0x3E, 0xAE, 0x3E, 0x75, 0x42, 0x1A, 0x1E, 0x07, 0x90, 0x00, 0x07, 0x41, 0x21, 0x01, 0x16,
+    0x21, 0x44, 0x04, 0x42, 0x15, 0x17, 0x3E, 0xA7, 0x3E, 0xA7, 0x21, 0x19, 0x07, 0x21, 0x19, 0x03,
+    0x22, 0x23, 0x40, 0x10, 0x03, 0x42, 0x1A, 0x1E, 0x3E, 0xD5, 0x00, 0x05, 0xC8, 0x1B, 0x1E, 0x1F,
+    0x21, 0x40, 0x41, 0x42, 0x49, 0x00, 0xBB, 0x00, 0xA6, 0x00, 0x9A, 0x00, 0x64, 0x00, 0x33, 0x00,
+    0x27, 0x00, 0x07, 0x3E, 0x76, 0xC3, 0x17, 0x25, 0x2A, 0x3C, 0x65, 0x3E, 0xD9, 0x3E, 0xD9, 0x41,
+    0x14, 0x19, 0xDE, 0x44, 0x19, 0x1B, 0x25, 0x2A, 0x00, 0x04, 0x00, 0xA7, 0x3F, 0x03, 0x3F, 0x03,
+    0x41, 0x34, 0x2D, 0x6F, 0x21, 0x23, 0xB8, 0x21, 0x40, 0x03, 0x21, 0x2D, 0x03, 0x41, 0x1B, 0x02,
+    0x27, 0x21, 0x31, 0x04, 0x41, 0x35, 0x1E, 0xF9, 0x21, 0x14, 0x04, 0x49, 0x0B, 0x14, 0x15, 0x19,
+    0x1B, 0x1F, 0x23, 0x2A, 0x40, 0x00, 0x1B, 0x3F, 0x2B, 0x3F, 0x2B, 0x3F, 0x2B, 0x00, 0x11, 0x3F,
+    0x12, 0x00, 0x0A, 0x3F, 0x2B, 0x00, 0x03, 0x22, 0x31, 0x4C, 0x44, 0x1C, 0x41, 0x21, 0x34, 0xE2,
+    0x41, 0x01, 0x02, 0x5A, 0x43, 0x04, 0x08, 0x47, 0x02, 0x5E, 0x3F, 0x54, 0x00, 0x04, 0x21, 0x25,
+    0x0A, 0x41, 0x40, 0x2D, 0x32, 0x21, 0x25, 0x04, 0x44, 0x25, 0x31, 0x40, 0x42, 0x06, 0x2F, 0x00,
+    0x1C, 0x00, 0x0A, 0x00, 0x03, 0x21, 0x23, 0x65, 0x41, 0x0B, 0x3D, 0xE1, 0x21, 0x42, 0x04, 0x21,
+    0x01, 0x03, 0x22, 0x32, 0x34, 0x0D, 0x03, 0x41, 0x21, 0x16, 0x06, 0xC6, 0x15, 0x17, 0x21, 0x2D,
+    0x39, 0x40, 0x00, 0x09, 0x3F, 0x6F, 0x3C, 0xA3, 0x3F, 0x81, 0x3F, 0x81, 0x00, 0x04, 0x42, 0x2D,
+    0x48, 0x3E, 0xE3, 0x3F, 0x43, 0x41, 0x0B, 0x06, 0x6C, 0x41, 0x2D, 0x3F, 0x4B, 0x21, 0x23, 0x04,
+    0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0x21, 0x40, 0x03, 0x21, 0x2A, 0x03, 0x22, 0x04, 0x25, 0x17,
+    0x03, 0x42, 0x25, 0x49, 0x3D, 0xB2, 0x3F, 0xB7, 0x46, 0x02, 0x14, 0x1A, 0x23, 0x25, 0x2B, 0x27,
+    0xD8, 0x3F, 0xBE, 0x3C, 0x5D, 0x3A, 0xCF, 0x3F, 0x8F, 0x00, 0x07, 0xD5, 0x01, 0x04, 0x07, 0x0B,
+    0x14, 0x15, 0x16, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41,
+    0x44, 0x29, 0x55, 0x33, 0xCB, 0x03, 0x30, 0x3E, 0xCF, 0x3F, 0xDB, 0x03, 0x26, 0x1F, 0xCA, 0x01,
+    0xF8, 0x01, 0xD0, 0x01, 0xCC, 0x01, 0xC5, 0x00, 0xFF, 0x00, 0xE6, 0x00, 0x94, 0x00, 0x73, 0x00,
+    0x50, 0x00, 0x3D, 0x2D, 0x3E, 0x00, 0x1F, 0x00, 0x13, 0x2A, 0x65, 0x42, 0x32, 0x36, 0x3F, 0xE2,
+    0x40, 0x11, 0x43, 0x2D, 0x36, 0x49, 0x40, 0x18, 0x40, 0x18, 0x3F, 0xBC, 0x42, 0x33, 0x36, 0x40,
+    0x2C, 0x40, 0x2B, 0x41, 0x22, 0x3F, 0xDE, 0x21, 0x30, 0x04, 0x21, 0x04, 0x03, 0x21, 0x19, 0x03,
+    0x21, 0x49, 0x03, 0x21, 0x31, 0x03, 0xC1, 0x47, 0x3F, 0xF7, 0x42, 0x19, 0x22, 0x00, 0x04, 0x3F,
+    0xF5, 0x41, 0x19, 0x40, 0x18, 0xC7, 0x04, 0x19, 0x21, 0x22, 0x40, 0x41, 0x44, 0x00, 0x3A, 0x00,
+    0x33, 0x00, 0x29, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x12, 0xAA, 0x41, 0x31, 0x0B, 0x88, 0x42,
+    0x19, 0x21, 0x0B, 0x81, 0x00, 0x04, 0x41, 0x44, 0x0B, 0x68, 0x41, 0x39, 0x3F, 0xC5, 0x21, 0x2A,
+    0x04, 0x21, 0x11, 0x03, 0xC4, 0x04, 0x09, 0x0A, 0x21, 0x3C, 0xA6, 0x40, 0x80, 0x0F, 0xC3, 0x3A,
+    0xD2, 0x41, 0x35, 0x2E, 0xC7, 0x21, 0x25, 0x04, 0x42, 0x31, 0x35, 0x40, 0x97, 0x3D, 0x65, 0x41,
+    0x0E, 0x3F, 0xD9, 0x21, 0x38, 0x04, 0xC2, 0x01, 0x4C, 0x00, 0x03, 0x40, 0xA6, 0xC1, 0x22, 0x24,
+    0x9F, 0x21, 0x32, 0x04, 0x42, 0x14, 0x1E, 0x40, 0xAA, 0x40, 0xAA, 0xCA, 0x02, 0x08, 0x09, 0x0A,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x42, 0x40, 0x55, 0x37, 0x6D, 0x3E, 0x91, 0x00, 0x23, 0x40, 0xBB,
+    0x32, 0xB3, 0x00, 0x15, 0x00, 0x0A, 0x3A, 0x9C, 0x00, 0x07, 0x42, 0x31, 0x32, 0x3C, 0x50, 0x40,
+    0xDA, 0xC4, 0x02, 0x04, 0x41, 0x43, 0x3F, 0xDF, 0x00, 0x07, 0x2D, 0xF7, 0x3E, 0xB0, 0x41, 0x32,
+    0x38, 0xF3, 0x41, 0x32, 0x3D, 0xBF, 0xC2, 0x20, 0x4C, 0x00, 0x04, 0x40, 0xF6, 0x21, 0x23, 0x07,
+    0x21, 0x35, 0x03, 0x41, 0x17, 0x1F, 0xB7, 0x21, 0x42, 0x04, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03,
+    0x23, 0x1B, 0x20, 0x21, 0x22, 0x10, 0x03, 0x44, 0x01, 0x07, 0x19, 0x27, 0x41, 0x17, 0x41, 0x17,
+    0x41, 0x17, 0x41, 0x17, 0x4E, 0x01, 0x04, 0x07, 0x13, 0x14, 0x17, 0x19, 0x1A, 0x1E, 0x21, 0x25,
+    0x27, 0x48, 0x49, 0x41, 0x24, 0x00, 0xB5, 0x00, 0xAE, 0x00, 0xA3, 0x00, 0xA0, 0x00, 0x8F, 0x00,
+    0x69, 0x00, 0x43, 0x11, 0x87, 0x00, 0x14, 0x41, 0x24, 0x41, 0x24, 0x00, 0x0D, 0x40, 0xEB, 0x41,
+    0x23, 0x40, 0x43, 0x41, 0x39, 0x3F, 0x44, 0x41, 0x17, 0x41, 0x1E, 0xC4, 0x04, 0x17, 0x2B, 0x42,
+    0x41, 0x5A, 0x00, 0x08, 0x0D, 0xD2, 0x00, 0x04, 0x41, 0x16, 0x41, 0x0D, 0x21, 0x2A, 0x04, 0x21,
+    0x04, 0x03, 0x21, 0x32, 0x03, 0xC1, 0x04, 0x3E, 0xE5, 0x41, 0x2D, 0x29, 0x36, 0xC3, 0x2B, 0x32,
+    0x49, 0x38, 0x2F, 0x3F, 0xCB, 0x41, 0x17, 0x41, 0x38, 0x18, 0x8A, 0x21, 0x21, 0x04, 0x41, 0x40,
+    0x3D, 0x65, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0xC4, 0x0A, 0x2A, 0x32, 0x39, 0x2B, 0x75, 0x00,
+    0x0D, 0x00, 0x03, 0x41, 0x3A, 0x41, 0x38, 0x3E, 0x97, 0x21, 0x22, 0x04, 0x41, 0x35, 0x2C, 0xFE,
+    0x41, 0x35, 0x40, 0xBD, 0x41, 0x32, 0x25, 0x25, 0x41, 0x0B, 0x41, 0x27, 0x21, 0x40, 0x04, 0x21,
+    0x32, 0x03, 0x41, 0x25, 0x41, 0x53, 0x21, 0x40, 0x04, 0x22, 0x04, 0x25, 0x0A, 0x03, 0xC5, 0x13,
+    0x20, 0x27, 0x34, 0x35, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x05, 0x41, 0xCE, 0xC2, 0x01,
+    0x31, 0x41, 0xDE, 0x41, 0xA5, 0x41, 0x31, 0x2E, 0xC7, 0x41, 0x15, 0x41, 0x6A, 0x41, 0x40, 0x27,
+    0x17, 0x21, 0x2D, 0x04, 0xC4, 0x01, 0x27, 0x40, 0x42, 0x00, 0x0F, 0x41, 0x99, 0x00, 0x0B, 0x00,
+    0x03, 0x41, 0x35, 0x04, 0x5B, 0x21, 0x1A, 0x04, 0x21, 0x1A, 0x03, 0x41, 0x31, 0x41, 0xAD, 0x42,
+    0x19, 0x1F, 0x00, 0x04, 0x42, 0x0F, 0x21, 0x34, 0x07, 0x41, 0x25, 0x0A, 0xCD, 0x21, 0x27, 0x12,
+    0x22, 0x31, 0x34, 0x07, 0x03, 0x41, 0x0B, 0x32, 0x0C, 0x21, 0x44, 0x04, 0x21, 0x01, 0x03, 0x21,
+    0x2D, 0x03, 0x21, 0x19, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x2D, 0x09, 0x21, 0x14, 0x03, 0xA2, 0x21,
+    0x44, 0x09, 0x03, 0x41, 0x19, 0x3F, 0x35, 0x43, 0x19, 0x25, 0x40, 0x00, 0x09, 0x3F, 0x5F, 0x00,
+    0x04, 0x41, 0x23, 0x08, 0x9E, 0x21, 0x40, 0x04, 0x22, 0x2D, 0x39, 0x11, 0x03, 0x41, 0x0B, 0x24,
+    0xE9, 0x21, 0x19, 0x04, 0x21, 0x31, 0x03, 0x42, 0x0A, 0x40, 0x24, 0xCD, 0x00, 0xA5, 0x41, 0x22,
+    0x41, 0x7B, 0x21, 0x35, 0x04, 0x43, 0x19, 0x1E, 0x27, 0x00, 0x0E, 0x0B, 0x50, 0x00, 0x03, 0x41,
+    0x19, 0x03, 0x80, 0x21, 0x31, 0x04, 0x41, 0x23, 0x3F, 0x78, 0x21, 0x14, 0x04, 0x21, 0x40, 0x03,
+    0x21, 0x2E, 0x03, 0x22, 0x23, 0x44, 0x10, 0x03, 0x42, 0x01, 0x1A, 0x42, 0x98, 0x00, 0x05, 0x48,
+    0x14, 0x17, 0x19, 0x1A, 0x1E, 0x2A, 0x40, 0x42, 0x00, 0x89, 0x01, 0x4C, 0x00, 0x7F, 0x00, 0x47,
+    0x42, 0x9F, 0x00, 0x3B, 0x00, 0x2A, 0x00, 0x07, 0x46, 0x1E, 0x21, 0x27, 0x32, 0x34, 0x4C, 0x42,
+    0xB8, 0x42, 0xB8, 0x3F, 0x4D, 0x00, 0xC4, 0x00, 0xB0, 0x00, 0x19, 0x41, 0x14, 0x17, 0x2E, 0x21,
+    0x42, 0x04, 0x21, 0x34, 0x03, 0x41, 0x44, 0x03, 0x89, 0x41, 0x19, 0x22, 0x1E, 0x21, 0x21, 0x04,
+    0x41, 0x44, 0x1E, 0xF1, 0x41, 0x04, 0x09, 0x90, 0x41, 0x1E, 0x3E, 0xBC, 0x42, 0x42, 0x44, 0x21,
+    0x3B, 0x00, 0x04, 0x21, 0x04, 0x07, 0x26, 0x0B, 0x32, 0x34, 0x35, 0x41, 0x42, 0x24, 0x21, 0x19,
+    0x16, 0x12, 0x03, 0xC5, 0x15, 0x1A, 0x1B, 0x35, 0x38, 0x41, 0xF7, 0x3E, 0xF5, 0x3B, 0x08, 0x43,
+    0x03, 0x3F, 0xF5, 0x41, 0x40, 0x42, 0x0E, 0x21, 0x32, 0x04, 0x21, 0x25, 0x03, 0x21, 0x39, 0x03,
+    0x41, 0x23, 0x42, 0xB7, 0x41, 0x23, 0x25, 0x31, 0x21, 0x40, 0x04, 0x21, 0x35, 0x03, 0x21, 0x17,
+    0x03, 0xC2, 0x17, 0x48, 0x00, 0x03, 0x43, 0x31, 0x44, 0x14, 0x18, 0x1A, 0x1F, 0x41, 0x3A, 0x30,
+    0xD0, 0x00, 0x18, 0x00, 0x07, 0x41, 0x04, 0x09, 0x92, 0x21, 0x23, 0x04, 0x41, 0x25, 0x38, 0xE2,
+    0x21, 0x44, 0x04, 0x41, 0x40, 0x25, 0xC1, 0x22, 0x23, 0x25, 0x07, 0x04, 0xD5, 0x01, 0x07, 0x0B,
+    0x14, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2E, 0x40,
+    0x41, 0x42, 0x02, 0x0D, 0x02, 0x01, 0x01, 0xEA, 0x01, 0xE7, 0x42, 0xF6, 0x01, 0xE3, 0x43, 0x5C,
+    0x01, 0xDF, 0x01, 0xC4, 0x41, 0xAA, 0x01, 0xB3, 0x01, 0x8E, 0x01, 0x7E, 0x00, 0xA4, 0x00, 0x66,
+    0x00, 0x59, 0x43, 0x5C, 0x00, 0x3F, 0x00, 0x24, 0x00, 0x13, 0x00, 0x05, 0x41, 0x31, 0x26, 0xC0,
+    0x43, 0x27, 0x2D, 0x32, 0x00, 0x04, 0x43, 0xA0, 0x43, 0x51, 0x41, 0x2D, 0x42, 0xE4, 0x21, 0x30,
+    0x04, 0x41, 0x25, 0x3E, 0xEF, 0x42, 0x01, 0x22, 0x00, 0x04, 0x43, 0xB5, 0x42, 0x31, 0x32, 0x3E,
+    0xC3, 0x00, 0x07, 0x42, 0x13, 0x23, 0x43, 0xC3, 0x43, 0xC3, 0x42, 0x1A, 0x25, 0x43, 0xCA, 0x43,
+    0xCA, 0x45, 0x27, 0x31, 0x33, 0x36, 0x39, 0x00, 0x0E, 0x00, 0x07, 0x43, 0xD1, 0x43, 0xC7, 0x33,
+    0x1D, 0x43, 0x31, 0x39, 0x48, 0x3F, 0x8F, 0x43, 0x83, 0x3B, 0xFF, 0x44, 0x19, 0x1A, 0x32, 0x49,
+    0x43, 0xEB, 0x43, 0xEB, 0x41, 0xDC, 0x42, 0xDF, 0x41, 0x41, 0x2E, 0xAF, 0x21, 0x19, 0x04, 0x21,
+    0x2D, 0x03, 0x21, 0x48, 0x03, 0x21, 0x37, 0x03, 0x41, 0x34, 0x41, 0xF9, 0x42, 0x23, 0x47, 0x41,
+    0xFD, 0x43, 0xD3, 0x23, 0x02, 0x15, 0x1B, 0x0E, 0x0B, 0x07, 0x43, 0x16, 0x2A, 0x2B, 0x0D, 0xA2,
+    0x43, 0xCB, 0x44, 0x10, 0x43, 0x14, 0x1A, 0x2D, 0x43, 0xD5, 0x43, 0xC6, 0x44, 0x1A, 0xD0, 0x02,
+    0x04, 0x0A, 0x15, 0x16, 0x17, 0x19, 0x1D, 0x1F, 0x21, 0x23, 0x2B, 0x40, 0x41, 0x42, 0x43, 0x00,
+    0x8E, 0x42, 0x1F, 0x00, 0x80, 0x00, 0x72, 0x3A, 0xE0, 0x42, 0x04, 0x00, 0x5D, 0x40, 0x20, 0x37,
+    0x80, 0x00, 0x4D, 0x00, 0x43, 0x1B, 0xE4, 0x00, 0x1B, 0x00, 0x14, 0x00, 0x0A, 0x02, 0x45, 0xC2,
+    0x32, 0x46, 0x43, 0x3D, 0x44, 0x5F, 0xC1, 0x2A, 0x42, 0x82, 0x42, 0x14, 0x49, 0x44, 0x6A, 0x44,
+    0x31, 0xC4, 0x04, 0x15, 0x16, 0x21, 0x00, 0x07, 0x44, 0x70, 0x18, 0x23, 0x44, 0x6D, 0xC1, 0x31,
+    0x37, 0x55, 0x21, 0x2B, 0x04, 0x41, 0x08, 0x29, 0x02, 0x21, 0x08, 0x04, 0x21, 0x31, 0x03, 0xA1,
+    0x1B, 0x03, 0x21, 0x19, 0x03, 0x21, 0x32, 0x03, 0xC1, 0x44, 0x37, 0x6F, 0x21, 0x32, 0x04, 0x41,
+    0x1E, 0x40, 0x76, 0xC4, 0x0A, 0x1A, 0x1B, 0x44, 0x44, 0x8A, 0x00, 0x07, 0x3F, 0x78, 0x00, 0x04,
+    0x49, 0x01, 0x07, 0x14, 0x17, 0x21, 0x23, 0x25, 0x27, 0x49, 0x00, 0x51, 0x00, 0x4A, 0x00, 0x3F,
+    0x01, 0xD7, 0x00, 0x2E, 0x2F, 0xEA, 0x00, 0x1B, 0x00, 0x0D, 0x43, 0xAB, 0x41, 0x08, 0x0F, 0x6A,
+    0xC2, 0x28, 0x32, 0x32, 0xB2, 0x00, 0x04, 0x41, 0x34, 0x0A, 0xE6, 0x21, 0x27, 0x04, 0xC2, 0x1A,
+    0x40, 0x0A, 0xEA, 0x00, 0x03, 0x21, 0x4C, 0x07, 0x41, 0x34, 0x42, 0xD5, 0x21, 0x19, 0x04, 0x21,
+    0x10, 0x03, 0x21, 0x31, 0x03, 0xC3, 0x1A, 0x21, 0x23, 0x40, 0x37, 0x44, 0x6D, 0x00, 0x03, 0x21,
+    0x35, 0x0A, 0x41, 0x25, 0x41, 0x20, 0x41, 0x2D, 0x2F, 0x90, 0xC9, 0x15, 0x19, 0x1A, 0x21, 0x22,
+    0x23, 0x25, 0x40, 0x48, 0x00, 0x3A, 0x33, 0x40, 0x45, 0x0A, 0x45, 0x0A, 0x00, 0x25, 0x00, 0x0B,
+    0x00, 0x08, 0x00, 0x04, 0x45, 0x0A, 0x42, 0x31, 0x32, 0x45, 0x25, 0x43, 0x17, 0xA1, 0x04, 0x07,
+    0x42, 0x01, 0x48, 0x00, 0x03, 0x45, 0x2F, 0x41, 0x2B, 0x44, 0xB8, 0xC5, 0x04, 0x0A, 0x14, 0x15,
+    0x43, 0x3E, 0x4D, 0x42, 0x04, 0x44, 0x75, 0x44, 0x32, 0x00, 0x04, 0x43, 0x19, 0x1A, 0x2D, 0x00,
+    0x10, 0x45, 0x4B, 0x45, 0x4B, 0x41, 0x02, 0x42, 0xC5, 0xC3, 0x01, 0x04, 0x40, 0x26, 0xC3, 0x3C,
+    0x0B, 0x00, 0x04, 0x42, 0x23, 0x48, 0x45, 0x4A, 0x44, 0xFD, 0x42, 0x21, 0x22, 0x45, 0x6A, 0x45,
+    0x6A, 0x21, 0x32, 0x07, 0x41, 0x12, 0x30, 0xAE, 0x21, 0x38, 0x04, 0x41, 0x31, 0x20, 0x9F, 0x21,
+    0x1A, 0x04, 0x21, 0x21, 0x03, 0x41, 0x1B, 0x44, 0x4A, 0xCE, 0x04, 0x0A, 0x18, 0x19, 0x1A, 0x20,
+    0x22, 0x25, 0x27, 0x28, 0x2A, 0x32, 0x39, 0x42, 0x00, 0x26, 0x43, 0x5F, 0x2A, 0x95, 0x00, 0x18,
+    0x43, 0x8B, 0x04, 0x97, 0x42, 0xF9, 0x21, 0x6C, 0x00, 0x11, 0x21, 0x08, 0x00, 0x07, 0x44, 0xD7,
+    0x00, 0x04, 0x16, 0xC4, 0xC2, 0x04, 0x17, 0x0F, 0x78, 0x2C, 0xCE, 0xC1, 0x15, 0x30, 0xF5, 0x42,
+    0x34, 0x4C, 0x45, 0xBF, 0x45, 0xBF, 0xA1, 0x15, 0x07, 0xC2, 0x19, 0x1D, 0x43, 0x4C, 0x41, 0xBB,
+    0x41, 0x17, 0x45, 0x4B, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0xC2, 0x10, 0x1B,
+    0x45, 0x82, 0x00, 0x03, 0xA1, 0x2B, 0x07, 0x42, 0x30, 0x38, 0x15, 0x4D, 0x45, 0xE7, 0x21, 0x13,
+    0x69, 0xC1, 0x04, 0x04, 0xA2, 0x44, 0x07, 0x19, 0x21, 0x22, 0x45, 0xF5, 0x45, 0xF5, 0x00, 0x04,
+    0x45, 0xF5, 0x41, 0x01, 0x27, 0x6C, 0x21, 0x01, 0x04, 0xD1, 0x01, 0x04, 0x07, 0x13, 0x14, 0x15,
+    0x19, 0x1B, 0x21, 0x22, 0x23, 0x25, 0x2B, 0x42, 0x48, 0x49, 0x4A, 0x00, 0xB0, 0x42, 0x9E, 0x46,
+    0x09, 0x00, 0x80, 0x00, 0x55, 0x00, 0x4E, 0x24, 0x54, 0x00, 0x43, 0x00, 0x40, 0x00, 0x25, 0x00,
+    0x22, 0x45, 0xA3, 0x45, 0xA3, 0x00, 0x1B, 0x3A, 0x91, 0x00, 0x14, 0x00, 0x03, 0x41, 0x21, 0x0D,
+    0x44, 0x21, 0x27, 0x04, 0x21, 0x48, 0x03, 0xA1, 0x23, 0x03, 0x41, 0x40, 0x21, 0x9A, 0x42, 0x32,
+    0x34, 0x00, 0x04, 0x45, 0xF0, 0x41, 0x27, 0x09, 0x15, 0xA1, 0x2A, 0x04, 0x21, 0x32, 0x03, 0xC1,
+    0x39, 0x03, 0x37, 0x21, 0x21, 0x04, 0x21, 0x22, 0x03, 0x21, 0x35, 0x03, 0x43, 0x21, 0x23, 0x27,
+    0x45, 0x5C, 0x00, 0x03, 0x43, 0x5E, 0x41, 0x40, 0x46, 0x21, 0x21, 0x0B, 0x04, 0x43, 0x27, 0x34,
+    0x35, 0x46, 0x37, 0x46, 0x2E, 0x45, 0xEC, 0x41, 0x38, 0x29, 0xAB, 0x41, 0x2A, 0x44, 0x7C, 0x41,
+    0x27, 0x46, 0x40, 0x41, 0x23, 0x31, 0xCD, 0x41, 0x2B, 0x46, 0x06, 0xCF, 0x02, 0x04, 0x09, 0x0A,
+    0x1A, 0x1C, 0x21, 0x22, 0x23, 0x2A, 0x2B, 0x2D, 0x41, 0x42, 0x43, 0x46, 0x35, 0x00, 0x1E, 0x28,
+    0xB0, 0x06, 0x03, 0x00, 0x14, 0x00, 0x10, 0x44, 0x4F, 0x46, 0x97, 0x20, 0x18, 0x00, 0x0C, 0x46,
+    0x82, 0x00, 0x08, 0x00, 0x04, 0x33, 0xB1, 0x44, 0x6A, 0xC1, 0x1A, 0x41, 0x17, 0xCA, 0x0B, 0x13,
+    0x19, 0x1B, 0x23, 0x2B, 0x40, 0x44, 0x48, 0x49, 0x42, 0xEB, 0x00, 0x86, 0x46, 0xCD, 0x45, 0xC1,
+    0x00, 0x7F, 0x00, 0x71, 0x00, 0x61, 0x00, 0x53, 0x00, 0x32, 0x00, 0x04, 0x42, 0x13, 0x19, 0x46,
+    0x67, 0x28, 0x04, 0x41, 0x17, 0x46, 0x95, 0x42, 0x04, 0x40, 0x05, 0x12, 0x00, 0x04, 0x41, 0x1F,
+    0x46, 0x38, 0x22, 0x01, 0x1F, 0x0B, 0x04, 0x21, 0x2D, 0x05, 0x41, 0x04, 0x43, 0x9F, 0xC2, 0x02,
+    0x41, 0x3A, 0xFE, 0x00, 0x04, 0x43, 0x19, 0x21, 0x22, 0x00, 0x07, 0x47, 0x15, 0x47, 0x15, 0x41,
+    0x08, 0x46, 0x1D, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x07, 0x03, 0x21, 0x32, 0x03, 0xA1,
+    0x1A, 0x03, 0x41, 0x1A, 0x0B, 0xAC, 0x21, 0x21, 0x04, 0x21, 0x31, 0x03, 0x42, 0x14, 0x31, 0x47,
+    0x3C, 0x46, 0x37, 0x41, 0x20, 0x28, 0x73, 0x21, 0x2D, 0x04, 0x21, 0x21, 0x03, 0x42, 0x1C, 0x2A,
+    0x46, 0xE7, 0x00, 0x03, 0xCB, 0x04, 0x07, 0x15, 0x17, 0x19, 0x22, 0x27, 0x2A, 0x2B, 0x40, 0x41,
+    0x43, 0x3C, 0x47, 0x54, 0x46, 0x4B, 0x46, 0x55, 0x26, 0xB4, 0x00, 0x25, 0x47, 0x54, 0x00, 0x1B,
+    0x00, 0x18, 0x00, 0x07, 0x39, 0x4C, 0xC1, 0x04, 0x33, 0xA8, 0x44, 0x2D, 0x30, 0x32, 0x33, 0x00,
+    0x65, 0x47, 0x7A, 0x00, 0x26, 0x00, 0x04, 0x41, 0x27, 0x42, 0xC5, 0x42, 0x32, 0x39, 0x47, 0x8B,
+    0x47, 0x8A, 0xA2, 0x04, 0x2B, 0x0B, 0x07, 0xC4, 0x19, 0x21, 0x22, 0x27, 0x47, 0x97, 0x47, 0x97,
+    0x47, 0x97, 0x45, 0x74, 0x41, 0x15, 0x30, 0x74, 0xC3, 0x04, 0x1B, 0x40, 0x2B, 0x9A, 0x46, 0xE2,
+    0x00, 0x04, 0xC4, 0x02, 0x07, 0x19, 0x27, 0x45, 0x88, 0x00, 0x0A, 0x47, 0xB2, 0x47, 0xB2, 0xC5,
+    0x04, 0x08, 0x0A, 0x1F, 0x2B, 0x47, 0x6A, 0x16, 0xFE, 0x47, 0xA6, 0x42, 0xFD, 0x46, 0xB6, 0x24,
+    0x19, 0x2D, 0x32, 0x33, 0x3D, 0x38, 0x1D, 0x10, 0x5F, 0x1F, 0x04, 0x07, 0x0A, 0x13, 0x14, 0x15,
+    0x17, 0x18, 0x19, 0x1A, 0x21, 0x23, 0x24, 0x25, 0x27, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x47, 0x48, 0x49, 0x12, 0xE5, 0x12, 0xC6, 0x12, 0x91, 0x12,
+    0x56, 0x12, 0x37, 0x12, 0x04, 0x47, 0x72, 0x47, 0x72, 0x11, 0xC5, 0x11, 0x98, 0x11, 0x81, 0x0F,
+    0x75, 0x0F, 0x25, 0x0C, 0xD6, 0x0B, 0x78, 0x0B, 0x3E, 0x07, 0xFD, 0x07, 0x83, 0x06, 0xB4, 0x04,
+    0x7C, 0x03, 0xAA, 0x03, 0x28, 0x02, 0xCE, 0x02, 0xA8, 0x02, 0x8D, 0x01, 0xCF, 0x01, 0x0B, 0x00,
+    0xEC, 0x00, 0xD1, 0x00, 0x5E, 0x00, 0x09, 0x41, 0x27, 0x2D, 0x12, 0x21, 0x32, 0x04, 0xC1, 0x01,
+    0x33, 0x2C, 0x43, 0x0F, 0x15, 0x19, 0x48, 0x42, 0x00, 0x04, 0x48, 0x42, 0xC1, 0x27, 0x48, 0x42,
+    0x21, 0x07, 0x04, 0x21, 0x2D, 0x03, 0x44, 0x23, 0x32, 0x48, 0x49, 0x00, 0x1B, 0x00, 0x14, 0x47,
+    0xF0, 0x00, 0x03, 0x42, 0x27, 0x31, 0x47, 0xA8, 0x48, 0x2A, 0xC2, 0x07, 0x34, 0x00, 0x07, 0x48,
+    0x1B, 0xC1, 0x07, 0x3F, 0x23, 0x41, 0x38, 0x48, 0x17, 0xA1, 0x14, 0x04, 0x41, 0x02, 0x43, 0xF2,
+    0xC2, 0x07, 0x42, 0x46, 0x56, 0x00, 0x04, 0x41, 0x07, 0x48, 0x7D, 0x43, 0x07, 0x14, 0x22, 0x48,
+    0x8B, 0x48, 0x8B, 0x00, 0x04, 0x41, 0x07, 0x47, 0xDA, 0x41, 0x07, 0x48, 0x98, 0xC3, 0x07, 0x40,
+    0x41, 0x3F, 0x4F, 0x00, 0x08, 0x00, 0x04, 0x41, 0x07, 0x48, 0x58, 0xA1, 0x41, 0x04, 0x41, 0x07,
+    0x14, 0xD4, 0xC3, 0x07, 0x2B, 0x44, 0x48, 0x5A, 0x00, 0x04, 0x45, 0x9A, 0x41, 0x07, 0x46, 0xAD,
+    0xA1, 0x41, 0x04, 0xC8, 0x01, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x2B, 0x41, 0x00, 0x26, 0x00, 0x18,
+    0x00, 0x11, 0x48, 0xC3, 0x00, 0x03, 0x48, 0xC3, 0x46, 0x99, 0x48, 0xB9, 0xC1, 0x02, 0x48, 0x84,
+    0xC1, 0x07, 0x48, 0xDF, 0xC1, 0x41, 0x48, 0xDA, 0x41, 0x07, 0x2A, 0xF5, 0xC2, 0x0B, 0x40, 0x46,
+    0xC9, 0x00, 0x04, 0x43, 0x01, 0x07, 0x27, 0x48, 0xF3, 0x48, 0xF3, 0x48, 0xF3, 0x48, 0x01, 0x07,
+    0x14, 0x19, 0x1A, 0x27, 0x48, 0x49, 0x23, 0x69, 0x0C, 0xD6, 0x00, 0x21, 0x00, 0x1D, 0x00, 0x19,
+    0x00, 0x11, 0x00, 0x0A, 0x48, 0xC4, 0x41, 0x1E, 0x47, 0xF4, 0x21, 0x39, 0x04, 0x41, 0x27, 0x48,
+    0xC2, 0x21, 0x4C, 0x04, 0x21, 0x28, 0x03, 0x21, 0x07, 0x03, 0xC4, 0x07, 0x14, 0x21, 0x27, 0x43,
+    0x78, 0x00, 0x10, 0x19, 0x4D, 0x00, 0x03, 0x41, 0x0B, 0x49, 0x2D, 0xCB, 0x0A, 0x15, 0x19, 0x1A,
+    0x21, 0x22, 0x25, 0x27, 0x2A, 0x41, 0x44, 0x49, 0x2B, 0x48, 0xE9, 0x40, 0xB1, 0x23, 0xA7, 0x00,
+    0x11, 0x49, 0x3B, 0x26, 0xCB, 0x49, 0x3B, 0x48, 0xE0, 0x00, 0x04, 0x0A, 0xA6, 0x42, 0x27, 0x33,
+    0x49, 0x5D, 0x49, 0x5D, 0x21, 0x49, 0x07, 0xC1, 0x07, 0x42, 0x79, 0x43, 0x01, 0x19, 0x21, 0x23,
+    0xD7, 0x49, 0x6B, 0x00, 0x04, 0xC1, 0x07, 0x44, 0x2F, 0x41, 0x48, 0x49, 0x1E, 0x21, 0x07, 0x04,
+    0x41, 0x48, 0x40, 0x32, 0x21, 0x07, 0x04, 0x22, 0x19, 0x21, 0x0A, 0x03, 0x46, 0x14, 0x19, 0x1A,
+    0x22, 0x48, 0x49, 0x49, 0x8C, 0x01, 0x05, 0x00, 0x17, 0x49, 0x8C, 0x00, 0x05, 0x47, 0x7D, 0x41,
+    0x27, 0x49, 0x4D, 0x41, 0x2B, 0x47, 0x13, 0x41, 0x2B, 0x1E, 0x0A, 0xC4, 0x1A, 0x2A, 0x40, 0x48,
+    0x49, 0xAB, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x04, 0x41, 0x2B, 0x43, 0x1D, 0xC2, 0x07, 0x40, 0x18,
+    0xFB, 0x00, 0x04, 0x42, 0x07, 0x19, 0x00, 0x07, 0x49, 0xC3, 0x43, 0x07, 0x19, 0x22, 0x49, 0xCA,
+    0x49, 0xCA, 0x49, 0xCA, 0xC2, 0x14, 0x46, 0x47, 0xAA, 0x49, 0xD4, 0xC4, 0x19, 0x21, 0x22, 0x40,
+    0x49, 0xDB, 0x49, 0xDB, 0x00, 0x07, 0x01, 0x46, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x00, 0x25, 0x00,
+    0x1E, 0x00, 0x0D, 0x49, 0xE8, 0xC2, 0x07, 0x21, 0x44, 0x43, 0x49, 0xF5, 0x44, 0x27, 0x2D, 0x32,
+    0x33, 0x49, 0xC3, 0x00, 0x07, 0x2E, 0x8A, 0x49, 0xFC, 0x52, 0x01, 0x07, 0x14, 0x1A, 0x21, 0x27,
+    0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x38, 0x39, 0x48, 0x49, 0x4A, 0x09, 0x01, 0x9F,
+    0x01, 0x98, 0x01, 0x90, 0x01, 0x89, 0x01, 0x7E, 0x01, 0x46, 0x4A, 0x09, 0x01, 0x0C, 0x00, 0xCE,
+    0x4A, 0x09, 0x00, 0xA5, 0x45, 0xF1, 0x00, 0x9E, 0x00, 0x7D, 0x00, 0x5E, 0x00, 0x21, 0x00, 0x0D,
+    0xC1, 0x19, 0x49, 0x7A, 0x42, 0x23, 0x25, 0x48, 0x35, 0x00, 0x04, 0x41, 0x19, 0x42, 0x2A, 0x41,
+    0x38, 0x48, 0xC7, 0x42, 0x23, 0x32, 0x4A, 0x53, 0x4A, 0x49, 0x41, 0x34, 0x2D, 0x7E, 0x21, 0x23,
+    0x04, 0x21, 0x08, 0x03, 0xC8, 0x01, 0x14, 0x16, 0x23, 0x2A, 0x2D, 0x40, 0x43, 0x00, 0x20, 0x49,
+    0x9E, 0x00, 0x19, 0x23, 0xE1, 0x00, 0x15, 0x00, 0x11, 0x00, 0x03, 0x48, 0x33, 0x43, 0x33, 0x48,
+    0x49, 0x4A, 0x7D, 0x4A, 0x28, 0x49, 0x71, 0x41, 0x15, 0x47, 0xA3, 0x21, 0x2B, 0x04, 0xA1, 0x40,
+    0x03, 0x21, 0x22, 0x03, 0x42, 0x31, 0x32, 0x4A, 0x45, 0x00, 0x03, 0x21, 0x21, 0x07, 0xC4, 0x08,
+    0x2B, 0x38, 0x39, 0x00, 0x21, 0x00, 0x03, 0x4A, 0x58, 0x4A, 0x58, 0x41, 0x35, 0x4A, 0x4D, 0x21,
+    0x28, 0x04, 0x21, 0x34, 0x03, 0x21, 0x18, 0x03, 0x21, 0x17, 0x03, 0x21, 0x34, 0x03, 0x21, 0x2A,
+    0x03, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x42, 0x31, 0x32, 0x06, 0x3E, 0x00, 0x03, 0x41, 0x21,
+    0x4A, 0x73, 0x21, 0x34, 0x04, 0xA1, 0x1E, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x15,
+    0x03, 0x21, 0x01, 0x03, 0x41, 0x18, 0x4A, 0xE4, 0x22, 0x31, 0x34, 0x07, 0x04, 0x42, 0x38, 0x39,
+    0x2E, 0x35, 0x12, 0x17, 0xC5, 0x07, 0x16, 0x1E, 0x20, 0x21, 0x38, 0x2E, 0x4A, 0xF4, 0x00, 0x0C,
+    0x00, 0x07, 0x2D, 0xF3, 0x41, 0x20, 0x4A, 0xE8, 0x21, 0x21, 0x04, 0x21, 0x14, 0x03, 0xC6, 0x08,
+    0x15, 0x1A, 0x1B, 0x23, 0x2A, 0x4A, 0xC2, 0x47, 0xF6, 0x49, 0x10, 0x00, 0x47, 0x00, 0x1A, 0x00,
+    0x03, 0x21, 0x38, 0x13, 0xC3, 0x01, 0x0A, 0x16, 0x29, 0x87, 0x10, 0xE2, 0x1E, 0xD6, 0xC1, 0x40,
+    0x04, 0x97, 0xC1, 0x21, 0x4A, 0xE3, 0x21, 0x01, 0x04, 0x41, 0x1A, 0x46, 0x77, 0xC4, 0x1B, 0x23,
+    0x39, 0x40, 0x24, 0xB6, 0x3B, 0x63, 0x00, 0x07, 0x00, 0x04, 0x41, 0x38, 0x26, 0x6E, 0x41, 0x39,
+    0x4A, 0xBD, 0xA1, 0x25, 0x04, 0x42, 0x23, 0x31, 0x09, 0x4A, 0x4B, 0x06, 0xC1, 0x25, 0x4B, 0x5C,
+    0x43, 0x19, 0x31, 0x32, 0x4B, 0x60, 0x4B, 0x27, 0x49, 0x62, 0x42, 0x31, 0x39, 0x4B, 0x31, 0x4B,
+    0x69, 0x42, 0x08, 0x25, 0x27, 0x72, 0x4B, 0x67, 0x44, 0x08, 0x21, 0x22, 0x42, 0x4B, 0x12, 0x4B,
+    0x78, 0x4B, 0x12, 0x00, 0x07, 0x42, 0x27, 0x33, 0x4B, 0x7B, 0x4B, 0x85, 0x46, 0x27, 0x32, 0x34,
+    0x35, 0x39, 0x48, 0x4B, 0x82, 0x3B, 0x83, 0x29, 0x20, 0x4B, 0x8C, 0x4A, 0xFB, 0x00, 0x07, 0x43,
+    0x08, 0x14, 0x31, 0x4B, 0x9F, 0x19, 0xF5, 0x4B, 0x9E, 0x42, 0x32, 0x35, 0x4B, 0x70, 0x4B, 0xA9,
+    0x41, 0x04, 0x4B, 0xA6, 0x46, 0x02, 0x17, 0x19, 0x1A, 0x40, 0x41, 0x33, 0x00, 0x4B, 0xB3, 0x44,
+    0xC6, 0x00, 0x0B, 0x15, 0xA5, 0x00, 0x04, 0x41, 0x28, 0x4B, 0xAB, 0x21, 0x07, 0x04, 0x21, 0x27,
+    0x03, 0x21, 0x17, 0x03, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x21, 0x2A, 0x03, 0x41, 0x21, 0x4A,
+    0xCD, 0xA1, 0x40, 0x04, 0x43, 0x0D, 0x25, 0x2A, 0x00, 0x0A, 0x4B, 0xE4, 0x00, 0x03, 0x47, 0x01,
+    0x07, 0x08, 0x0D, 0x22, 0x27, 0x2A, 0x4B, 0xEE, 0x4B, 0xEE, 0x4B, 0xA8, 0x4B, 0xEE, 0x4B, 0xEE,
+    0x4B, 0xEE, 0x4B, 0xEE, 0xC2, 0x08, 0x43, 0x49, 0xE1, 0x49, 0xD3, 0x42, 0x32, 0x36, 0x39, 0xF0,
+    0x2C, 0x44, 0xC4, 0x18, 0x27, 0x28, 0x32, 0x31, 0x1E, 0x4B, 0x5A, 0x00, 0x07, 0x4C, 0x12, 0x46,
+    0x01, 0x07, 0x15, 0x21, 0x22, 0x27, 0x4C, 0x1F, 0x00, 0x1B, 0x4C, 0x1F, 0x4C, 0x1F, 0x00, 0x0D,
+    0x4C, 0x1F, 0x42, 0x0D, 0x2A, 0x4C, 0x32, 0x4C, 0x32, 0xD4, 0x01, 0x04, 0x08, 0x13, 0x14, 0x1A,
+    0x21, 0x23, 0x25, 0x27, 0x2A, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x36, 0x38, 0x39, 0x00, 0xE7,
+    0x1A, 0xFA, 0x00, 0xE4, 0x48, 0xCE, 0x00, 0xDD, 0x00, 0xD9, 0x00, 0xCF, 0x00, 0xC1, 0x00, 0xAD,
+    0x00, 0x9A, 0x4C, 0x39, 0x4C, 0x38, 0x00, 0x85, 0x00, 0x55, 0x00, 0x4B, 0x00, 0x1A, 0x4C, 0x39,
+    0x4C, 0x2F, 0x43, 0xA1, 0x00, 0x07, 0x41, 0x28, 0x3A, 0x58, 0x21, 0x25, 0x04, 0x43, 0x1E, 0x28,
+    0x35, 0x00, 0x03, 0x3A, 0x5F, 0x4C, 0x7D, 0xC1, 0x08, 0x4C, 0x29, 0xA2, 0x19, 0x32, 0x0E, 0x04,
+    0xC1, 0x25, 0x4C, 0x8C, 0xC2, 0x15, 0x41, 0x4B, 0x8B, 0x4A, 0x63, 0xC1, 0x08, 0x40, 0xC8, 0x46,
+    0x01, 0x07, 0x14, 0x19, 0x1A, 0x31, 0x4C, 0x9F, 0x4C, 0x9F, 0x00, 0x0F, 0x00, 0x0B, 0x00, 0x04,
+    0x4C, 0x9E, 0x41, 0x2B, 0x4C, 0x79, 0xA1, 0x41, 0x04, 0xC3, 0x04, 0x08, 0x2B, 0x30, 0x01, 0x45,
+    0xCB, 0x4B, 0xAD, 0xC1, 0x08, 0x18, 0xE9, 0x42, 0x2D, 0x31, 0x4C, 0xBD, 0x49, 0x94, 0x42, 0x23,
+    0x25, 0x49, 0x63, 0x4C, 0xCE, 0xC5, 0x17, 0x1A, 0x1E, 0x43, 0x44, 0x00, 0x0E, 0x20, 0x87, 0x00,
+    0x07, 0x4A, 0xA4, 0x4C, 0x20, 0x41, 0x08, 0x2E, 0xF2, 0x42, 0x40, 0x41, 0x00, 0x04, 0x11, 0xAD,
+    0x21, 0x4C, 0x07, 0x42, 0x08, 0x2A, 0x4C, 0xF3, 0x4C, 0xF3, 0xC9, 0x01, 0x07, 0x14, 0x19, 0x1A,
+    0x20, 0x21, 0x23, 0x41, 0x00, 0x44, 0x00, 0x41, 0x4C, 0xFA, 0x00, 0x37, 0x4C, 0xFA, 0x0C, 0x08,
+    0x00, 0x25, 0x00, 0x0A, 0x00, 0x07, 0x42, 0x30, 0x32, 0x4D, 0x16, 0x4B, 0x07, 0x44, 0x23, 0x25,
+    0x27, 0x39, 0x1C, 0x5C, 0x00, 0x07, 0x4C, 0xCE, 0x4C, 0xCE, 0x42, 0x30, 0x49, 0x4D, 0x2A, 0x4C,
+    0xC4, 0x41, 0x27, 0x2F, 0x97, 0x41, 0x21, 0x3A, 0x03, 0x22, 0x2B, 0x40, 0x08, 0x04, 0x21, 0x30,
+    0x05, 0x41, 0x23, 0x35, 0x51, 0x42, 0x47, 0x49, 0x49, 0x2D, 0x4D, 0x45, 0x22, 0x01, 0x02, 0x0B,
+    0x07, 0x41, 0x08, 0x43, 0xC1, 0x41, 0x08, 0x4C, 0xD6, 0xCB, 0x01, 0x02, 0x07, 0x08, 0x19, 0x1A,
+    0x1B, 0x25, 0x40, 0x41, 0x44, 0x00, 0x3C, 0x34, 0xA5, 0x49, 0x4B, 0x00, 0x2F, 0x49, 0xEE, 0x4C,
+    0x57, 0x46, 0x0D, 0x00, 0x1B, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x04, 0x42, 0x31, 0x35, 0x49, 0x29,
+    0x4C, 0xFC, 0x41, 0x01, 0x40, 0x55, 0x21, 0x23, 0x04, 0x41, 0x23, 0x38, 0xBF, 0x43, 0x07, 0x23,
+    0x31, 0x3C, 0xCC, 0x00, 0x04, 0x4B, 0x22, 0x41, 0x19, 0x22, 0x11, 0x21, 0x32, 0x04, 0x41, 0x28,
+    0x4C, 0xD8, 0x21, 0x32, 0x04, 0xC2, 0x19, 0x4C, 0x17, 0xE6, 0x4D, 0xA5, 0x21, 0x34, 0x07, 0x21,
+    0x14, 0x03, 0x21, 0x23, 0x03, 0x42, 0x23, 0x32, 0x00, 0x03, 0x4D, 0x57, 0xC1, 0x0A, 0x4D, 0xBC,
+    0xC9, 0x1E, 0x20, 0x22, 0x23, 0x27, 0x32, 0x34, 0x35, 0x40, 0x00, 0x33, 0x4A, 0x8D, 0x00, 0x25,
+    0x00, 0x1E, 0x00, 0x0B, 0x00, 0x04, 0x4D, 0x87, 0x4D, 0xC0, 0x2A, 0x45, 0x41, 0x25, 0x49, 0x8A,
+    0x21, 0x2B, 0x04, 0xC8, 0x01, 0x02, 0x08, 0x17, 0x23, 0x29, 0x2A, 0x41, 0x4B, 0xB9, 0x4A, 0xFF,
+    0x00, 0x68, 0x00, 0x5D, 0x00, 0x23, 0x4A, 0xFF, 0x4D, 0x88, 0x00, 0x03, 0x45, 0x27, 0x2D, 0x32,
+    0x39, 0x49, 0x4D, 0xAD, 0x49, 0xE4, 0x4D, 0xFC, 0x4D, 0xAD, 0x4D, 0x96, 0x42, 0x30, 0x31, 0x4E,
+    0x0C, 0x4D, 0xBD, 0x42, 0x27, 0x31, 0x00, 0x07, 0x4D, 0xDA, 0xC8, 0x01, 0x07, 0x21, 0x25, 0x2B,
+    0x2D, 0x40, 0x44, 0x00, 0x1E, 0x4B, 0xF7, 0x4B, 0xF7, 0x48, 0x68, 0x00, 0x07, 0x48, 0x68, 0x4E,
+    0x19, 0x4D, 0xD4, 0x41, 0x44, 0x4D, 0xED, 0xC2, 0x32, 0x4C, 0x4D, 0xD9, 0x4E, 0x37, 0x21, 0x11,
+    0x07, 0x42, 0x2D, 0x49, 0x4E, 0x37, 0x4D, 0xDB, 0x41, 0x08, 0x4E, 0x0F, 0x41, 0x08, 0x4E, 0x42,
+    0xC6, 0x01, 0x08, 0x2A, 0x2B, 0x40, 0x41, 0x4D, 0x18, 0x00, 0x0F, 0x16, 0x5D, 0x4D, 0xEA, 0x00,
+    0x08, 0x00, 0x04, 0xC1, 0x31, 0x3B, 0x45, 0xC2, 0x23, 0x2A, 0x00, 0x04, 0x03, 0x5C, 0x42, 0x27,
+    0x38, 0x4E, 0x08, 0x00, 0x07, 0x41, 0x25, 0x49, 0xFD, 0x41, 0x01, 0x4B, 0xE9, 0xA1, 0x40, 0x04,
+    0x42, 0x32, 0x4C, 0x4E, 0x80, 0x00, 0x03, 0x42, 0x15, 0x23, 0x39, 0xC1, 0x33, 0x62, 0x41, 0x04,
+    0x07, 0x84, 0xC1, 0x23, 0x45, 0x44, 0x41, 0x04, 0x4E, 0x30, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x1B, 0x03, 0x41, 0x23, 0x47, 0x57, 0x41, 0x15, 0x3C, 0x3F, 0x21, 0x34, 0x04, 0x42, 0x16,
+    0x38, 0x00, 0x03, 0x4D, 0x26, 0x41, 0x1E, 0x1B, 0x4D, 0x21, 0x40, 0x04, 0x21, 0x33, 0x03, 0x21,
+    0x1A, 0x03, 0x21, 0x19, 0x03, 0x21, 0x48, 0x03, 0x21, 0x38, 0x03, 0x41, 0x10, 0x4E, 0x05, 0x21,
+    0x29, 0x04, 0x21, 0x23, 0x03, 0x43, 0x01, 0x23, 0x28, 0x3E, 0x7E, 0x4D, 0xC5, 0x00, 0x03, 0xC6,
+    0x1E, 0x21, 0x25, 0x2A, 0x2B, 0x40, 0x00, 0x3C, 0x2E, 0xCE, 0x4A, 0xD1, 0x00, 0x31, 0x00, 0x17,
+    0x00, 0x0A, 0xA5, 0x04, 0x31, 0x32, 0x38, 0x4C, 0x6B, 0x64, 0x60, 0x52, 0x13, 0x42, 0x21, 0x23,
+    0x4E, 0x97, 0x4E, 0x97, 0x46, 0x19, 0x1A, 0x23, 0x31, 0x34, 0x4C, 0x00, 0x84, 0x4D, 0x4F, 0x00,
+    0x12, 0x4E, 0xCB, 0x00, 0x07, 0x4F, 0x04, 0x41, 0x08, 0x2B, 0x18, 0xC6, 0x01, 0x17, 0x25, 0x2D,
+    0x40, 0x42, 0x00, 0xA6, 0x00, 0x17, 0x4E, 0x0F, 0x41, 0x3A, 0x47, 0x20, 0x00, 0x04, 0x42, 0x31,
+    0x38, 0x4F, 0x24, 0x4D, 0x1F, 0x43, 0x14, 0x2D, 0x34, 0x4F, 0x35, 0x4F, 0x2B, 0x4C, 0x27, 0xC1,
+    0x22, 0x4F, 0x3F, 0x21, 0x32, 0x04, 0x41, 0x01, 0x4E, 0x80, 0x21, 0x48, 0x04, 0x42, 0x32, 0x35,
+    0x4D, 0x3E, 0x00, 0x03, 0x42, 0x35, 0x48, 0x36, 0xC6, 0x4E, 0xEE, 0x21, 0x08, 0x07, 0xCD, 0x01,
+    0x08, 0x09, 0x15, 0x1A, 0x1B, 0x1C, 0x22, 0x2A, 0x40, 0x42, 0x43, 0x44, 0x00, 0x30, 0x00, 0x29,
+    0x27, 0xD0, 0x00, 0x1B, 0x4F, 0x5D, 0x48, 0x12, 0x4A, 0x33, 0x00, 0x11, 0x31, 0xC4, 0x00, 0x03,
+    0x14, 0xC7, 0x4D, 0x2D, 0x19, 0x4F, 0x42, 0x01, 0x21, 0x4D, 0x09, 0x4C, 0x1B, 0x41, 0x14, 0x24,
+    0x5B, 0x43, 0x08, 0x40, 0x46, 0x30, 0xFB, 0x00, 0x04, 0x4F, 0x91, 0x43, 0x01, 0x1A, 0x27, 0x00,
+    0x0A, 0x4F, 0x9B, 0x4C, 0x30, 0x4D, 0x01, 0x07, 0x0D, 0x13, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x48,
+    0x49, 0x4A, 0x4B, 0x01, 0xC2, 0x01, 0x8B, 0x01, 0x72, 0x01, 0x67, 0x01, 0x55, 0x01, 0x37, 0x00,
+    0x8A, 0x00, 0x47, 0x00, 0x1F, 0x3E, 0x6B, 0x4F, 0x9B, 0x00, 0x0A, 0x4F, 0x9B, 0x41, 0x4C, 0x4E,
+    0xA8, 0x21, 0x23, 0x04, 0xC2, 0x32, 0x41, 0x00, 0x03, 0x1F, 0x45, 0x41, 0x1B, 0x2E, 0x26, 0x42,
+    0x2D, 0x35, 0x00, 0x04, 0x4F, 0xDF, 0xC1, 0x27, 0x4F, 0xD9, 0x41, 0x01, 0x2D, 0x7A, 0x21, 0x30,
+    0x04, 0xA1, 0x15, 0x03, 0x41, 0x13, 0x1C, 0xCF, 0x21, 0x23, 0x04, 0x41, 0x32, 0x24, 0x50, 0x21,
+    0x2B, 0x04, 0x41, 0x1A, 0x4C, 0xF0, 0x21, 0x34, 0x04, 0x21, 0x19, 0x03, 0x21, 0x19, 0x03, 0x21,
+    0x31, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x04, 0x03, 0xC2, 0x07, 0x31, 0x00, 0x03, 0x42, 0xEF, 0xC4,
+    0x01, 0x17, 0x21, 0x23, 0x00, 0x27, 0x33, 0x90, 0x00, 0x20, 0x00, 0x07, 0x21, 0x38, 0x0D, 0xC3,
+    0x1A, 0x1C, 0x40, 0x35, 0xC1, 0x4F, 0x69, 0x29, 0x96, 0x41, 0x25, 0x3B, 0x8B, 0xA1, 0x31, 0x04,
+    0xC4, 0x08, 0x23, 0x34, 0x35, 0x4E, 0x8B, 0x40, 0x66, 0x4F, 0xF7, 0x4F, 0xF7, 0x42, 0x1A, 0x44,
+    0x4F, 0x87, 0x50, 0x14, 0x41, 0x25, 0x3D, 0xEC, 0x21, 0x39, 0x04, 0x21, 0x1A, 0x03, 0x21, 0x34,
+    0x03, 0x42, 0x01, 0x1E, 0x50, 0x61, 0x00, 0x03, 0xC1, 0x15, 0x50, 0x68, 0x41, 0x25, 0x0E, 0x87,
+    0xC2, 0x01, 0x40, 0x00, 0x04, 0x04, 0x93, 0xC6, 0x27, 0x30, 0x34, 0x35, 0x36, 0x38, 0x50, 0x73,
+    0x00, 0x2A, 0x00, 0x16, 0x00, 0x0F, 0x50, 0x76, 0x00, 0x07, 0x42, 0x01, 0x19, 0x50, 0x24, 0x50,
+    0x24, 0x21, 0x21, 0x07, 0xCD, 0x01, 0x04, 0x07, 0x0B, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x21, 0x23,
+    0x27, 0x40, 0x00, 0xC0, 0x00, 0xB5, 0x00, 0xAE, 0x28, 0xF4, 0x00, 0xA3, 0x00, 0x68, 0x00, 0x65,
+    0x00, 0x57, 0x50, 0x94, 0x00, 0x54, 0x00, 0x1D, 0x3E, 0xE5, 0x00, 0x03, 0x42, 0x27, 0x31, 0x4E,
+    0x2C, 0x50, 0x6D, 0x41, 0x37, 0x1C, 0xE9, 0x42, 0x23, 0x32, 0x4C, 0xAF, 0x50, 0xC7, 0x44, 0x19,
+    0x27, 0x31, 0x32, 0x50, 0xCE, 0x50, 0x13, 0x4C, 0xB6, 0x4C, 0xB6, 0x41, 0x08, 0x4E, 0x19, 0x21,
+    0x23, 0x04, 0x41, 0x20, 0x0F, 0xF0, 0x21, 0x15, 0x04, 0x21, 0x19, 0x03, 0x42, 0x23, 0x34, 0x4D,
+    0x0A, 0x00, 0x03, 0x41, 0x01, 0x3B, 0x76, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03, 0x21, 0x15, 0x03,
+    0x41, 0x0B, 0x24, 0x5E, 0x21, 0x07, 0x04, 0x21, 0x34, 0x03, 0x42, 0x0A, 0x15, 0x00, 0x03, 0x38,
+    0xF7, 0xC5, 0x08, 0x15, 0x19, 0x2D, 0x40, 0x00, 0x25, 0x00, 0x17, 0x43, 0x30, 0x00, 0x14, 0x00,
+    0x07, 0x21, 0x19, 0x10, 0x47, 0x07, 0x19, 0x23, 0x27, 0x2D, 0x31, 0x33, 0x3E, 0x29, 0x51, 0x24,
+    0x00, 0x45, 0x00, 0x03, 0x51, 0x1A, 0x0D, 0x5A, 0x51, 0x24, 0x42, 0x31, 0x48, 0x25, 0x08, 0x4F,
+    0x2B, 0xC1, 0x14, 0x4D, 0xD6, 0x43, 0x32, 0x35, 0x39, 0x00, 0x04, 0x51, 0x45, 0x51, 0x0C, 0x42,
+    0x0D, 0x22, 0x51, 0x4F, 0x51, 0x4F, 0x44, 0x14, 0x31, 0x32, 0x39, 0x51, 0x56, 0x3E, 0x38, 0x00,
+    0x07, 0x34, 0x7A, 0x42, 0x2D, 0x32, 0x51, 0x59, 0x50, 0xA8, 0x42, 0x31, 0x48, 0x4D, 0x52, 0x4F,
+    0x40, 0x43, 0x2D, 0x31, 0x48, 0x51, 0x70, 0x51, 0x70, 0x51, 0x1C, 0x46, 0x19, 0x23, 0x25, 0x31,
+    0x32, 0x38, 0x00, 0x11, 0x4E, 0x10, 0x00, 0x0A, 0x51, 0x42, 0x50, 0xC0, 0x51, 0x2C, 0x42, 0x27,
+    0x37, 0x51, 0x3F, 0x4D, 0x3C, 0x41, 0x23, 0x0D, 0x8D, 0x21, 0x2A, 0x04, 0xC2, 0x2A, 0x40, 0x07,
+    0x4D, 0x00, 0x03, 0x21, 0x23, 0x07, 0x21, 0x22, 0x03, 0x21, 0x35, 0x03, 0x41, 0x47, 0x51, 0x73,
+    0x42, 0x34, 0x35, 0x34, 0xD4, 0x4E, 0x3A, 0x49, 0x08, 0x14, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x23,
+    0x25, 0x51, 0xB7, 0x0D, 0xAF, 0x4C, 0x8C, 0x00, 0x0E, 0x51, 0x32, 0x00, 0x0B, 0x39, 0x31, 0x00,
+    0x07, 0x39, 0x11, 0x45, 0x17, 0x19, 0x1A, 0x1E, 0x25, 0x51, 0xC9, 0x51, 0xD2, 0x51, 0xD3, 0x4D,
+    0xCF, 0x2A, 0xC4, 0xD3, 0x01, 0x02, 0x04, 0x07, 0x08, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x22, 0x23,
+    0x25, 0x27, 0x28, 0x2B, 0x2D, 0x40, 0x41, 0x01, 0x27, 0x01, 0x20, 0x01, 0x1C, 0x4F, 0xB9, 0x50,
+    0xD7, 0x01, 0x15, 0x00, 0xBF, 0x00, 0xA9, 0x00, 0x9E, 0x30, 0x82, 0x49, 0xC2, 0x00, 0x8D, 0x00,
+    0x80, 0x51, 0x91, 0x07, 0x38, 0x00, 0x68, 0x00, 0x55, 0x00, 0x2C, 0x00, 0x10, 0xC2, 0x1B, 0x2B,
+    0x34, 0x32, 0x51, 0x14, 0x42, 0x31, 0x49, 0x52, 0x1A, 0x51, 0xCF, 0x42, 0x08, 0x42, 0x00, 0x07,
+    0x04, 0xD6, 0x41, 0x19, 0x1D, 0xDB, 0x21, 0x33, 0x04, 0x21, 0x2A, 0x03, 0x21, 0x07, 0x03, 0x21,
+    0x48, 0x03, 0x21, 0x36, 0x03, 0x41, 0x27, 0x50, 0xCD, 0x21, 0x32, 0x04, 0x41, 0x01, 0x1C, 0xF2,
+    0x21, 0x31, 0x04, 0x41, 0x48, 0x1F, 0x75, 0xA2, 0x20, 0x23, 0x07, 0x04, 0xA2, 0x20, 0x4C, 0x13,
+    0x05, 0x41, 0x1E, 0x40, 0x8D, 0x21, 0x44, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x41, 0x32,
+    0x50, 0xBC, 0xC5, 0x01, 0x08, 0x25, 0x27, 0x32, 0x3D, 0x60, 0x09, 0xFD, 0x50, 0xDB, 0x00, 0x04,
+    0x52, 0x72, 0x42, 0x17, 0x2A, 0x40, 0xB8, 0x36, 0xFF, 0x21, 0x34, 0x07, 0x41, 0x0A, 0x33, 0x46,
+    0x21, 0x27, 0x04, 0x41, 0x1E, 0x40, 0x27, 0x21, 0x49, 0x5E, 0x42, 0x08, 0x15, 0x52, 0x9A, 0x00,
+    0x03, 0x21, 0x23, 0x0A, 0xCD, 0x01, 0x15, 0x19, 0x1A, 0x1B, 0x20, 0x23, 0x27, 0x2A, 0x40, 0x41,
+    0x43, 0x44, 0x00, 0x62, 0x00, 0x48, 0x1C, 0xE5, 0x33, 0x6A, 0x00, 0x39, 0x11, 0xB2, 0x00, 0x32,
+    0x00, 0x1B, 0x00, 0x6E, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0A, 0x00, 0x03, 0xC2, 0x21, 0x2B, 0x32,
+    0x4A, 0x52, 0x63, 0x21, 0x32, 0x07, 0x41, 0x27, 0x52, 0x10, 0x41, 0x32, 0x4A, 0x50, 0xC4, 0x01,
+    0x19, 0x20, 0x4C, 0x00, 0x08, 0x00, 0x04, 0x11, 0xEC, 0x06, 0x57, 0x43, 0x14, 0x15, 0x40, 0x00,
+    0x18, 0x00, 0x0D, 0x1F, 0x74, 0x41, 0x34, 0x1D, 0xCD, 0x21, 0x23, 0x04, 0x21, 0x33, 0x03, 0x41,
+    0x16, 0x4F, 0x94, 0x22, 0x14, 0x32, 0x07, 0x04, 0x41, 0x01, 0x38, 0x84, 0x21, 0x34, 0x04, 0x21,
+    0x15, 0x03, 0x21, 0x34, 0x03, 0x21, 0x10, 0x03, 0xC2, 0x01, 0x31, 0x38, 0x94, 0x00, 0x03, 0x41,
+    0x42, 0x52, 0x64, 0x43, 0x01, 0x2D, 0x31, 0x53, 0x23, 0x53, 0x22, 0x53, 0x19, 0x41, 0x23, 0x1F,
+    0xCC, 0x41, 0x2B, 0x22, 0x6C, 0x23, 0x08, 0x2B, 0x40, 0x12, 0x08, 0x04, 0x41, 0x34, 0x4B, 0x17,
+    0xC2, 0x01, 0x25, 0x46, 0x92, 0x00, 0x04, 0x22, 0x07, 0x21, 0x12, 0x07, 0xCC, 0x01, 0x07, 0x15,
+    0x19, 0x1A, 0x1B, 0x23, 0x25, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0x2F, 0x01, 0x21, 0x00, 0xA8, 0x00,
+    0x61, 0x53, 0x4C, 0x00, 0x49, 0x00, 0x34, 0x00, 0x2D, 0x47, 0xBA, 0x00, 0x05, 0x53, 0x39, 0x52,
+    0x47, 0xC2, 0x31, 0x41, 0x40, 0x53, 0x40, 0x53, 0x42, 0x34, 0x35, 0x53, 0x78, 0x53, 0x78, 0x21,
+    0x15, 0x07, 0xC2, 0x1E, 0x39, 0x35, 0x0D, 0x00, 0x03, 0x41, 0x32, 0x0C, 0x8B, 0x21, 0x23, 0x04,
+    0x41, 0x17, 0x51, 0xDE, 0x21, 0x21, 0x04, 0x22, 0x01, 0x40, 0x0A, 0x03, 0x21, 0x2D, 0x05, 0x41,
+    0x22, 0x40, 0x81, 0x21, 0x35, 0x04, 0x41, 0x42, 0x53, 0x51, 0x21, 0x21, 0x04, 0x21, 0x47, 0x03,
+    0x22, 0x19, 0x2D, 0x0D, 0x03, 0x41, 0x4A, 0x53, 0xA2, 0x21, 0x08, 0x04, 0x41, 0x1B, 0x53, 0xA0,
+    0x21, 0x17, 0x04, 0x21, 0x44, 0x03, 0x42, 0x19, 0x1A, 0x00, 0x03, 0x53, 0xC6, 0xC2, 0x08, 0x14,
+    0x1D, 0x91, 0x53, 0xCD, 0xC1, 0x08, 0x53, 0x7C, 0xCE, 0x19, 0x1A, 0x1E, 0x21, 0x23, 0x27, 0x2D,
+    0x40, 0x41, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x67, 0x00, 0x56, 0x53, 0x92, 0x53, 0xD8, 0x51,
+    0xB5, 0x53, 0x92, 0x00, 0x3C, 0x00, 0x28, 0x00, 0x1F, 0x00, 0x12, 0x53, 0xD8, 0x53, 0xD8, 0x00,
+    0x0B, 0x00, 0x04, 0x43, 0x07, 0x48, 0x49, 0x54, 0x03, 0x53, 0xF9, 0x53, 0xF9, 0xC3, 0x08, 0x0A,
+    0x15, 0x54, 0x00, 0x21, 0x73, 0x53, 0xA7, 0x21, 0x14, 0x0A, 0xC4, 0x08, 0x0A, 0x1C, 0x22, 0x51,
+    0x32, 0x53, 0x54, 0x4A, 0xCC, 0x53, 0xB4, 0x42, 0x13, 0x32, 0x53, 0x61, 0x53, 0xA2, 0xA1, 0x21,
+    0x07, 0x21, 0x32, 0x03, 0x41, 0x1A, 0x52, 0x36, 0x21, 0x22, 0x04, 0x21, 0x35, 0x03, 0xA1, 0x13,
+    0x03, 0x41, 0x19, 0x1E, 0x82, 0x21, 0x28, 0x04, 0x41, 0x04, 0x54, 0x38, 0x21, 0x33, 0x04, 0x21,
+    0x49, 0x03, 0x42, 0x01, 0x16, 0x4D, 0xB0, 0x34, 0x41, 0x21, 0x4C, 0x07, 0x21, 0x22, 0x03, 0x21,
+    0x19, 0x03, 0x21, 0x39, 0x03, 0x41, 0x1C, 0x12, 0x80, 0x21, 0x21, 0x04, 0x21, 0x31, 0x03, 0x41,
+    0x40, 0x26, 0x44, 0x21, 0x21, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x25, 0x03, 0x41, 0x15, 0x53, 0x73,
+    0x21, 0x21, 0x04, 0x21, 0x48, 0x03, 0x21, 0x34, 0x03, 0x41, 0x41, 0x26, 0x5B, 0x21, 0x01, 0x04,
+    0x21, 0x2D, 0x03, 0x21, 0x37, 0x03, 0x41, 0x09, 0x54, 0x30, 0x21, 0x40, 0x04, 0x21, 0x27, 0x03,
+    0x21, 0x22, 0x03, 0x21, 0x48, 0x03, 0x21, 0x35, 0x03, 0x43, 0x14, 0x22, 0x2B, 0x1B, 0x0A, 0x00,
+    0x16, 0x00, 0x03, 0xCB, 0x08, 0x17, 0x19, 0x1A, 0x22, 0x23, 0x28, 0x2A, 0x2B, 0x2D, 0x40, 0x50,
+    0x9B, 0x00, 0x6E, 0x00, 0x64, 0x48, 0xA3, 0x40, 0xE5, 0x21, 0xD5, 0x00, 0x51, 0x00, 0x47, 0x00,
+    0x3A, 0x00, 0x2D, 0x00, 0x0A, 0x41, 0x32, 0x44, 0x21, 0x21, 0x0D, 0x04, 0x21, 0x15, 0x03, 0x21,
+    0x32, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x1B, 0x03, 0x42, 0x34, 0x39, 0x54, 0xE8, 0x00, 0x03, 0x41,
+    0x39, 0x4F, 0x61, 0x41, 0x08, 0x52, 0xA7, 0xC3, 0x08, 0x2A, 0x40, 0x00, 0x08, 0x54, 0x31, 0x00,
+    0x04, 0xC1, 0x08, 0x4F, 0xBB, 0x43, 0x0F, 0x25, 0x34, 0x55, 0x05, 0x55, 0x05, 0x51, 0xF7, 0x21,
+    0x1E, 0x0A, 0x42, 0x13, 0x35, 0x55, 0x12, 0x55, 0x12, 0x41, 0x01, 0x11, 0x68, 0xA1, 0x40, 0x04,
+    0x21, 0x21, 0x03, 0x21, 0x2D, 0x03, 0x42, 0x31, 0x34, 0x54, 0xED, 0x54, 0xED, 0x42, 0x1E, 0x27,
+    0x55, 0x2D, 0x00, 0x07, 0x21, 0x35, 0x07, 0x42, 0x04, 0x1E, 0x55, 0x37, 0x55, 0x37, 0x21, 0x32,
+    0x07, 0x41, 0x23, 0x36, 0x3F, 0x41, 0x01, 0x29, 0x9A, 0x21, 0x31, 0x04, 0xC8, 0x08, 0x0A, 0x17,
+    0x20, 0x27, 0x28, 0x2A, 0x34, 0x00, 0x29, 0x00, 0x18, 0x41, 0xD1, 0x00, 0x0E, 0x00, 0x0B, 0x00,
+    0x03, 0x54, 0x14, 0x22, 0x1D, 0x41, 0x21, 0x1B, 0xCA, 0x21, 0x0A, 0x04, 0x21, 0x32, 0x03, 0x41,
+    0x07, 0x43, 0x4A, 0x41, 0x1E, 0x2E, 0x31, 0x21, 0x21, 0x04, 0x21, 0x31, 0x03, 0xC4, 0x23, 0x25,
+    0x2A, 0x40, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x03, 0x44, 0x6A, 0x21, 0x32, 0x0D, 0x43, 0x07, 0x19,
+    0x21, 0x55, 0x8D, 0x55, 0x8D, 0x55, 0x8D, 0xC1, 0x08, 0x45, 0x51, 0x43, 0x19, 0x21, 0x22, 0x00,
+    0x04, 0x55, 0x9B, 0x55, 0x9B, 0x41, 0x01, 0x45, 0x5C, 0xC1, 0x41, 0x07, 0x5D, 0x22, 0x01, 0x1A,
+    0x08, 0x04, 0x42, 0x07, 0x21, 0x50, 0x55, 0x50, 0x42, 0xD3, 0x01, 0x11, 0x13, 0x14, 0x15, 0x17,
+    0x19, 0x1A, 0x1B, 0x21, 0x23, 0x25, 0x2C, 0x43, 0x44, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0x9F, 0x01,
+    0x88, 0x01, 0x7B, 0x01, 0x06, 0x00, 0xD1, 0x42, 0x9B, 0x00, 0xC2, 0x00, 0xB8, 0x55, 0xB5, 0x00,
+    0xAA, 0x00, 0xA7, 0x00, 0x6D, 0x00, 0x2F, 0x53, 0x88, 0x55, 0x73, 0x00, 0x2C, 0x00, 0x1E, 0x00,
+    0x0C, 0x00, 0x07, 0xC2, 0x21, 0x43, 0x53, 0xA7, 0x53, 0xC2, 0x41, 0x08, 0x53, 0xEB, 0xC3, 0x25,
+    0x42, 0x46, 0x0A, 0xB0, 0x00, 0x04, 0x55, 0xFE, 0xC1, 0x08, 0x37, 0x72, 0xC1, 0x08, 0x50, 0x7A,
+    0xC7, 0x07, 0x1A, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x1D, 0x56, 0x10, 0x55, 0xD7, 0x00, 0x12,
+    0x00, 0x08, 0x55, 0xC1, 0x00, 0x04, 0x41, 0x08, 0x4E, 0xED, 0xC3, 0x07, 0x21, 0x22, 0x56, 0x2A,
+    0x56, 0x2A, 0x56, 0x2A, 0xC5, 0x07, 0x1B, 0x22, 0x23, 0x27, 0x56, 0x34, 0x55, 0x35, 0x56, 0x34,
+    0x56, 0x2A, 0x56, 0x34, 0x44, 0x07, 0x21, 0x2D, 0x32, 0x56, 0x44, 0x56, 0x44, 0x00, 0x1A, 0x00,
+    0x10, 0x41, 0x49, 0x56, 0x50, 0x21, 0x08, 0x04, 0xA1, 0x41, 0x03, 0xC1, 0x40, 0x53, 0x4D, 0xC4,
+    0x01, 0x07, 0x19, 0x22, 0x00, 0x07, 0x00, 0x04, 0x56, 0x5F, 0x56, 0x5F, 0x41, 0x2B, 0x09, 0x3B,
+    0x21, 0x30, 0x04, 0xC4, 0x07, 0x19, 0x25, 0x27, 0x56, 0x73, 0x56, 0x73, 0x00, 0x03, 0x56, 0x73,
+    0x41, 0x4A, 0x53, 0x15, 0xC4, 0x08, 0x1A, 0x21, 0x40, 0x37, 0xEE, 0x00, 0x04, 0x27, 0x87, 0x0B,
+    0x4B, 0x46, 0x19, 0x27, 0x2D, 0x30, 0x32, 0x33, 0x56, 0x91, 0x56, 0x87, 0x00, 0x32, 0x56, 0x91,
+    0x00, 0x1E, 0x00, 0x0D, 0x41, 0x08, 0x2E, 0x41, 0xC2, 0x41, 0x46, 0x00, 0x04, 0x56, 0xA8, 0x21,
+    0x01, 0x07, 0x41, 0x2D, 0x51, 0x24, 0xA1, 0x40, 0x04, 0x43, 0x27, 0x2D, 0x30, 0x56, 0xB8, 0x00,
+    0x0A, 0x00, 0x03, 0x41, 0x08, 0x51, 0x35, 0xC3, 0x07, 0x22, 0x41, 0x56, 0xC7, 0x56, 0xC7, 0x00,
+    0x04, 0x45, 0x07, 0x27, 0x2D, 0x30, 0x32, 0x56, 0xD1, 0x56, 0xC7, 0x00, 0x0A, 0x56, 0xD1, 0x56,
+    0xD1, 0x5E, 0x01, 0x07, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2D, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x56, 0xE1, 0x0C, 0x7D, 0x0C, 0x43, 0x0B, 0xC0, 0x2A, 0x93, 0x0B, 0xBD, 0x0B, 0xB3, 0x0B, 0xA4,
+    0x0B, 0x97, 0x0A, 0xA8, 0x0A, 0x56, 0x0A, 0x42, 0x09, 0xE7, 0x09, 0x88, 0x07, 0x3C, 0x06, 0x4D,
+    0x04, 0xFE, 0x03, 0x95, 0x03, 0x09, 0x02, 0xDE, 0x02, 0xCA, 0x01, 0x28, 0x00, 0xD1, 0x56, 0x9B,
+    0x00, 0xBB, 0x4F, 0x3A, 0x00, 0x9D, 0x00, 0x50, 0x00, 0x28, 0x00, 0x10, 0x41, 0x27, 0x30, 0xB9,
+    0x41, 0x08, 0x57, 0x24, 0x21, 0x23, 0x04, 0x41, 0x34, 0x44, 0xDF, 0x21, 0x23, 0x04, 0x21, 0x15,
+    0x03, 0x21, 0x31, 0x03, 0x41, 0x1E, 0x38, 0x6C, 0x21, 0x32, 0x04, 0x42, 0x08, 0x21, 0x57, 0x5B,
+    0x00, 0x03, 0xC6, 0x08, 0x09, 0x0A, 0x23, 0x29, 0x32, 0x00, 0x26, 0x51, 0x43, 0x53, 0x80, 0x00,
+    0x1E, 0x00, 0x11, 0x00, 0x07, 0x43, 0x0A, 0x19, 0x32, 0x40, 0x45, 0x57, 0x75, 0x56, 0xBA, 0x42,
+    0x27, 0x36, 0x56, 0x47, 0x57, 0x75, 0x44, 0x27, 0x31, 0x32, 0x33, 0x57, 0x4D, 0x57, 0x7C, 0x57,
+    0x85, 0x57, 0x86, 0x43, 0x07, 0x14, 0x1A, 0x57, 0x93, 0x57, 0x93, 0x57, 0x93, 0x42, 0x31, 0x33,
+    0x00, 0x0A, 0x57, 0x9D, 0xC4, 0x27, 0x31, 0x32, 0x33, 0x51, 0x8C, 0x51, 0x1A, 0x57, 0xA4, 0x57,
+    0xA4, 0x45, 0x01, 0x07, 0x14, 0x21, 0x22, 0x57, 0xB1, 0x57, 0xB1, 0x57, 0xB1, 0x57, 0xB1, 0x57,
+    0xB1, 0x41, 0x25, 0x51, 0xA2, 0x21, 0x09, 0x04, 0xC2, 0x01, 0x25, 0x00, 0x03, 0x55, 0x9E, 0xC8,
+    0x27, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x38, 0x39, 0x57, 0x14, 0x4C, 0x3D, 0x51, 0x80, 0x00, 0x1E,
+    0x56, 0xCA, 0x57, 0xCE, 0x00, 0x07, 0x57, 0xCF, 0xC1, 0x09, 0x3F, 0x34, 0x41, 0x09, 0x57, 0x7A,
+    0x21, 0x40, 0x04, 0x21, 0x14, 0x03, 0x41, 0x23, 0x47, 0x42, 0x21, 0x23, 0x04, 0xA1, 0x27, 0x03,
+    0x45, 0x22, 0x30, 0x31, 0x32, 0x35, 0x00, 0x18, 0x58, 0x00, 0x00, 0x0D, 0x57, 0xF6, 0x00, 0x03,
+    0x41, 0x44, 0x57, 0xC1, 0x41, 0x25, 0x3F, 0x8E, 0x44, 0x01, 0x07, 0x14, 0x40, 0x58, 0x18, 0x00,
+    0x08, 0x32, 0x84, 0x00, 0x04, 0x43, 0x32, 0x35, 0x48, 0x4B, 0x59, 0x57, 0x94, 0x51, 0x37, 0x42,
+    0x31, 0x35, 0x50, 0xF6, 0x57, 0xB0, 0x41, 0x17, 0x57, 0xCD, 0x21, 0x40, 0x04, 0x21, 0x07, 0x03,
+    0x21, 0x34, 0x03, 0x21, 0x0A, 0x03, 0xC6, 0x01, 0x09, 0x15, 0x19, 0x2D, 0x40, 0x54, 0xDB, 0x00,
+    0x21, 0x53, 0x84, 0x00, 0x17, 0x2B, 0xA4, 0x00, 0x03, 0x41, 0x07, 0x55, 0x90, 0x41, 0x2A, 0x56,
+    0xAB, 0xC3, 0x21, 0x40, 0x41, 0x00, 0x08, 0x00, 0x04, 0x43, 0x18, 0x21, 0x23, 0x0A, 0x41, 0x31,
+    0x4B, 0x45, 0x21, 0x17, 0x04, 0x41, 0x29, 0x4D, 0x96, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03, 0x41,
+    0x21, 0x13, 0x04, 0x21, 0x38, 0x04, 0xC2, 0x04, 0x19, 0x33, 0xAA, 0x00, 0x03, 0xC4, 0x25, 0x30,
+    0x32, 0x4C, 0x00, 0x11, 0x58, 0x8D, 0x00, 0x07, 0x58, 0x8D, 0xC2, 0x17, 0x43, 0x00, 0x0D, 0x58,
+    0x4B, 0xC1, 0x44, 0x57, 0x9C, 0x48, 0x01, 0x10, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x22, 0x3D, 0xCF,
+    0x58, 0xA5, 0x58, 0xA5, 0x00, 0x3A, 0x00, 0x33, 0x00, 0x0B, 0x00, 0x04, 0x46, 0xDB, 0xC1, 0x09,
+    0x58, 0x63, 0x41, 0x01, 0x2A, 0x13, 0xC1, 0x09, 0x52, 0xA7, 0xA1, 0x25, 0x4E, 0xA1, 0x32, 0x03,
+    0x41, 0x09, 0x58, 0x3F, 0xA1, 0x42, 0x04, 0x4A, 0x01, 0x07, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B,
+    0x22, 0x27, 0x58, 0xD7, 0x58, 0xD7, 0x00, 0x19, 0x00, 0x15, 0x58, 0x9E, 0x58, 0xD7, 0x00, 0x11,
+    0x58, 0xD7, 0x00, 0x0A, 0x00, 0x03, 0x41, 0x09, 0x55, 0x8B, 0x43, 0x09, 0x40, 0x41, 0x58, 0x94,
+    0x53, 0x1C, 0x00, 0x04, 0xC1, 0x17, 0x49, 0x97, 0xC1, 0x2B, 0x56, 0xDE, 0x41, 0x01, 0x10, 0xD1,
+    0x21, 0x34, 0x04, 0x21, 0x22, 0x03, 0x21, 0x32, 0x03, 0x42, 0x17, 0x1E, 0x00, 0x03, 0x57, 0xF7,
+    0x45, 0x19, 0x1A, 0x21, 0x27, 0x48, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x07, 0x59, 0x20, 0x59, 0x16,
+    0x43, 0x01, 0x14, 0x48, 0x59, 0x30, 0x2D, 0x09, 0x59, 0x30, 0x41, 0x09, 0x3E, 0xCC, 0xC3, 0x04,
+    0x40, 0x43, 0x54, 0x13, 0x00, 0x04, 0x57, 0x0D, 0x41, 0x09, 0x3A, 0xAA, 0xA1, 0x40, 0x04, 0xC1,
+    0x09, 0x57, 0x25, 0xC5, 0x01, 0x14, 0x19, 0x1B, 0x22, 0x00, 0x15, 0x59, 0x53, 0x00, 0x07, 0x59,
+    0x53, 0x00, 0x04, 0xC1, 0x09, 0x4E, 0xB5, 0xC1, 0x09, 0x58, 0x68, 0x22, 0x14, 0x48, 0x08, 0x04,
+    0xC2, 0x07, 0x09, 0x59, 0x70, 0x3D, 0x62, 0x43, 0x2D, 0x32, 0x33, 0x4D, 0xD8, 0x00, 0x07, 0x59,
+    0x77, 0xC2, 0x09, 0x42, 0x59, 0x23, 0x23, 0xE4, 0x21, 0x2D, 0x07, 0x54, 0x01, 0x07, 0x17, 0x19,
+    0x1A, 0x21, 0x25, 0x27, 0x28, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x38, 0x39, 0x48, 0x49,
+    0x02, 0x29, 0x02, 0x16, 0x02, 0x0C, 0x02, 0x05, 0x01, 0xEE, 0x01, 0xE7, 0x01, 0xBC, 0x01, 0x8B,
+    0x59, 0x8A, 0x01, 0x73, 0x01, 0x45, 0x00, 0xE6, 0x00, 0xB4, 0x00, 0x91, 0x00, 0x6B, 0x00, 0x5B,
+    0x00, 0x38, 0x00, 0x20, 0x00, 0x14, 0x00, 0x03, 0xC2, 0x21, 0x32, 0x53, 0xA9, 0x59, 0xC8, 0x42,
+    0x04, 0x25, 0x59, 0xCF, 0x59, 0xC5, 0xC3, 0x04, 0x06, 0x42, 0x59, 0x70, 0x4A, 0x69, 0x00, 0x07,
+    0xC1, 0x1E, 0x4F, 0xA0, 0x42, 0x32, 0x34, 0x00, 0x04, 0x59, 0x86, 0x41, 0x18, 0x58, 0xB3, 0x21,
+    0x32, 0x04, 0x41, 0x0A, 0x59, 0x37, 0xC3, 0x0A, 0x40, 0x43, 0x4F, 0x06, 0x00, 0x04, 0x2B, 0xC4,
+    0x43, 0x31, 0x32, 0x49, 0x52, 0xC7, 0x35, 0x24, 0x59, 0xF3, 0x41, 0x23, 0x3A, 0x47, 0x21, 0x23,
+    0x04, 0x43, 0x1E, 0x32, 0x4C, 0x00, 0x03, 0x1F, 0xD9, 0x5A, 0x11, 0x41, 0x48, 0x21, 0x22, 0x21,
+    0x39, 0x04, 0x21, 0x21, 0x03, 0x41, 0x04, 0x3E, 0xBD, 0x21, 0x07, 0x04, 0xA1, 0x2A, 0x03, 0xCC,
+    0x01, 0x0A, 0x19, 0x1A, 0x21, 0x27, 0x2B, 0x30, 0x31, 0x32, 0x34, 0x41, 0x5A, 0x2F, 0x00, 0x2F,
+    0x59, 0x69, 0x58, 0x31, 0x00, 0x1E, 0x59, 0xF6, 0x00, 0x0D, 0x00, 0x03, 0x5A, 0x2E, 0x54, 0x84,
+    0x59, 0xE0, 0x1E, 0xF3, 0x41, 0x19, 0x5A, 0x3B, 0xA1, 0x2B, 0x04, 0x21, 0x32, 0x03, 0x41, 0x42,
+    0x39, 0x87, 0x43, 0x31, 0x32, 0x37, 0x59, 0x5D, 0x3D, 0x86, 0x56, 0x10, 0x41, 0x21, 0x4F, 0x7C,
+    0x21, 0x0A, 0x04, 0x42, 0x17, 0x38, 0x5A, 0x73, 0x58, 0x75, 0xC2, 0x19, 0x48, 0x00, 0x07, 0x5A,
+    0x7A, 0x21, 0x39, 0x07, 0x41, 0x40, 0x39, 0x23, 0x21, 0x39, 0x04, 0x43, 0x0A, 0x1B, 0x25, 0x59,
+    0xD0, 0x42, 0x05, 0x42, 0x05, 0x42, 0x2D, 0x32, 0x59, 0xDA, 0x59, 0xDA, 0xCB, 0x0A, 0x14, 0x19,
+    0x1E, 0x20, 0x23, 0x31, 0x32, 0x40, 0x44, 0x49, 0x00, 0x3A, 0x00, 0x2C, 0x4F, 0xEE, 0x00, 0x1B,
+    0x00, 0x14, 0x58, 0x8D, 0x5A, 0x63, 0x5A, 0x9C, 0x00, 0x11, 0x3D, 0xE4, 0x00, 0x07, 0x42, 0x32,
+    0x34, 0x5A, 0xB4, 0x5A, 0x85, 0x45, 0x2D, 0x31, 0x37, 0x38, 0x48, 0x56, 0xAD, 0x5A, 0x76, 0x5A,
+    0x6D, 0x4F, 0x51, 0x53, 0xD7, 0x42, 0x2D, 0x32, 0x56, 0xBD, 0x56, 0xBD, 0x44, 0x2D, 0x31, 0x38,
+    0x49, 0x55, 0x31, 0x5A, 0x8D, 0x5A, 0xDC, 0x53, 0xEE, 0x42, 0x31, 0x32, 0x56, 0xD1, 0x56, 0xD1,
+    0xC8, 0x07, 0x14, 0x1A, 0x21, 0x25, 0x2D, 0x40, 0x41, 0x32, 0x2A, 0x5A, 0x9E, 0x00, 0x1B, 0x13,
+    0xB4, 0x00, 0x14, 0x00, 0x07, 0x52, 0xCF, 0x24, 0x78, 0x42, 0x14, 0x27, 0x5B, 0x09, 0x5B, 0x09,
+    0xC3, 0x1A, 0x20, 0x22, 0x5B, 0x10, 0x1A, 0x1E, 0x58, 0x2C, 0x42, 0x07, 0x48, 0x5B, 0x1A, 0x5B,
+    0x10, 0x21, 0x23, 0x07, 0x42, 0x21, 0x25, 0x5A, 0xC6, 0x5B, 0x1A, 0xCC, 0x17, 0x23, 0x2D, 0x30,
+    0x31, 0x32, 0x34, 0x38, 0x39, 0x41, 0x42, 0x44, 0x2E, 0xDD, 0x00, 0x6D, 0x00, 0x66, 0x00, 0x3B,
+    0x00, 0x22, 0x00, 0x1B, 0x5A, 0xF2, 0x5B, 0x2A, 0x57, 0x13, 0x00, 0x0A, 0x00, 0x07, 0x59, 0x1C,
+    0x41, 0x23, 0x51, 0xC4, 0x43, 0x32, 0x34, 0x35, 0x00, 0x04, 0x5A, 0xCF, 0x5B, 0x54, 0x41, 0x32,
+    0x3C, 0x5C, 0x41, 0x21, 0x46, 0x87, 0x41, 0x38, 0x3E, 0xAE, 0x21, 0x1E, 0x04, 0x45, 0x18, 0x1E,
+    0x21, 0x25, 0x28, 0x5A, 0x35, 0x00, 0x07, 0x00, 0x03, 0x3F, 0xEA, 0x3F, 0xEA, 0x41, 0x19, 0x5A,
+    0xC8, 0xCD, 0x08, 0x0A, 0x18, 0x19, 0x1A, 0x1B, 0x21, 0x2A, 0x31, 0x32, 0x35, 0x39, 0x40, 0x5B,
+    0x3B, 0x36, 0xA1, 0x00, 0x2D, 0x5B, 0x1B, 0x59, 0xCC, 0x58, 0xFA, 0x00, 0x23, 0x1A, 0x19, 0x00,
+    0x1F, 0x00, 0x14, 0x5B, 0x81, 0x49, 0xE0, 0x00, 0x04, 0xC2, 0x0A, 0x2B, 0x59, 0x9A, 0x5A, 0xA0,
+    0xC1, 0x25, 0x4A, 0x01, 0xC7, 0x14, 0x19, 0x22, 0x23, 0x25, 0x31, 0x32, 0x5B, 0xB4, 0x00, 0x0B,
+    0x5B, 0xB4, 0x5B, 0xB4, 0x38, 0xDC, 0x5B, 0xB3, 0x00, 0x04, 0xC1, 0x0A, 0x3B, 0x2A, 0xC3, 0x01,
+    0x1E, 0x43, 0x5B, 0x70, 0x5B, 0x79, 0x59, 0x9D, 0xC1, 0x1B, 0x54, 0x8C, 0x41, 0x4C, 0x24, 0x90,
+    0x41, 0x4C, 0x5B, 0xDF, 0x4B, 0x01, 0x07, 0x19, 0x1A, 0x1B, 0x21, 0x23, 0x25, 0x37, 0x38, 0x48,
+    0x00, 0x1A, 0x5B, 0xE4, 0x5B, 0xE4, 0x00, 0x16, 0x00, 0x0C, 0x5B, 0xE4, 0x00, 0x08, 0x00, 0x04,
+    0x5B, 0x8C, 0x50, 0x70, 0x54, 0xF6, 0x46, 0x2D, 0x31, 0x32, 0x38, 0x48, 0x49, 0x5C, 0x05, 0x50,
+    0x1D, 0x57, 0xEE, 0x53, 0xE1, 0x56, 0x54, 0x55, 0x18, 0x43, 0x34, 0x48, 0x49, 0x5B, 0xCA, 0x5B,
+    0x0D, 0x5B, 0xB3, 0x42, 0x32, 0x49, 0x5C, 0x23, 0x5B, 0xBD, 0x44, 0x14, 0x1A, 0x27, 0x31, 0x5C,
+    0x2A, 0x5C, 0x2A, 0x5C, 0x20, 0x59, 0x72, 0xC1, 0x21, 0x5C, 0x37, 0x46, 0x2D, 0x32, 0x34, 0x39,
+    0x48, 0x49, 0x00, 0x04, 0x5C, 0x02, 0x5C, 0x02, 0x5B, 0xEC, 0x5B, 0xD5, 0x5C, 0x2E, 0x41, 0x40,
+    0x5B, 0xF0, 0x21, 0x30, 0x04, 0xA1, 0x17, 0x03, 0x42, 0x01, 0x14, 0x00, 0x03, 0x5C, 0x58, 0x43,
+    0x31, 0x32, 0x38, 0x5C, 0x55, 0x00, 0x07, 0x57, 0x66, 0x44, 0x21, 0x27, 0x33, 0x49, 0x5C, 0x69,
+    0x5C, 0x1A, 0x5C, 0x69, 0x56, 0xB7, 0x44, 0x07, 0x19, 0x25, 0x2D, 0x5C, 0x1E, 0x43, 0xF0, 0x50,
+    0xD7, 0x5A, 0x67, 0x42, 0x07, 0x47, 0x5C, 0x83, 0x5C, 0x82, 0x44, 0x07, 0x21, 0x25, 0x27, 0x5C,
+    0x0B, 0x5B, 0xF9, 0x00, 0x07, 0x5C, 0x80, 0xC1, 0x1C, 0x5C, 0x31, 0x21, 0x01, 0x04, 0x43, 0x07,
+    0x14, 0x2D, 0x00, 0x03, 0x5C, 0x9E, 0x5C, 0x65, 0xCF, 0x04, 0x07, 0x09, 0x0A, 0x15, 0x19, 0x1E,
+    0x21, 0x23, 0x25, 0x27, 0x2D, 0x40, 0x41, 0x42, 0x41, 0x40, 0x00, 0xA2, 0x5A, 0x18, 0x00, 0x8F,
+    0x00, 0x85, 0x34, 0x9F, 0x3E, 0x33, 0x00, 0x7E, 0x58, 0x9A, 0x00, 0x6D, 0x00, 0x49, 0x00, 0x3F,
+    0x00, 0x32, 0x00, 0x1E, 0x00, 0x0A, 0x41, 0x39, 0x5C, 0xCC, 0x42, 0x27, 0x49, 0x5C, 0xA1, 0x5C,
+    0x74, 0x42, 0x07, 0x22, 0x5C, 0x7B, 0x29, 0x07, 0x41, 0x04, 0x58, 0xE4, 0xC8, 0x08, 0x0A, 0x19,
+    0x1E, 0x28, 0x40, 0x42, 0x43, 0x00, 0x16, 0x00, 0x12, 0x55, 0xFE, 0x43, 0x60, 0x59, 0xB9, 0x00,
+    0x0B, 0x00, 0x04, 0x5C, 0x31, 0xC2, 0x04, 0x06, 0x5C, 0x9F, 0x5D, 0x05, 0x41, 0x27, 0x42, 0x88,
+    0xC2, 0x0A, 0x40, 0x58, 0x4E, 0x0E, 0xC8, 0x42, 0x30, 0x38, 0x12, 0x90, 0x5D, 0x17, 0x42, 0x19,
+    0x39, 0x5D, 0x1E, 0x5C, 0x69, 0xC9, 0x01, 0x04, 0x0A, 0x15, 0x19, 0x1E, 0x29, 0x2A, 0x42, 0x52,
+    0x77, 0x5C, 0xD0, 0x5C, 0x5F, 0x5A, 0x41, 0x00, 0x0E, 0x57, 0x73, 0x5C, 0xBF, 0x00, 0x07, 0x4F,
+    0x1D, 0x41, 0x07, 0x4A, 0x7B, 0x21, 0x23, 0x04, 0x42, 0x14, 0x19, 0x42, 0xC4, 0x5D, 0x48, 0x21,
+    0x32, 0x07, 0x41, 0x12, 0x52, 0xE8, 0x21, 0x31, 0x04, 0x21, 0x27, 0x03, 0x22, 0x31, 0x34, 0x0A,
+    0x03, 0x41, 0x20, 0x24, 0x87, 0x21, 0x23, 0x04, 0x21, 0x21, 0x03, 0xCA, 0x0A, 0x13, 0x19, 0x1A,
+    0x1E, 0x20, 0x21, 0x27, 0x28, 0x2A, 0x2D, 0x92, 0x00, 0x26, 0x3F, 0x7C, 0x00, 0x1C, 0x40, 0x88,
+    0x24, 0x91, 0x05, 0x12, 0x00, 0x0F, 0x5B, 0xB9, 0x00, 0x03, 0x41, 0x38, 0x42, 0xB4, 0x21, 0x25,
+    0x04, 0x42, 0x0A, 0x23, 0x5B, 0x82, 0x5D, 0x75, 0x42, 0x19, 0x23, 0x5D, 0x98, 0x41, 0x8A, 0x41,
+    0x21, 0x5D, 0x95, 0xA2, 0x04, 0x42, 0x0B, 0x04, 0x42, 0x07, 0x27, 0x2A, 0xE7, 0x00, 0x05, 0x4F,
+    0x01, 0x04, 0x07, 0x0A, 0x0F, 0x14, 0x15, 0x19, 0x1B, 0x1E, 0x22, 0x25, 0x27, 0x48, 0x49, 0x00,
+    0xC3, 0x5D, 0xAF, 0x00, 0xAA, 0x00, 0xA3, 0x5D, 0xAF, 0x00, 0x9F, 0x23, 0xFC, 0x00, 0x8A, 0x5D,
+    0x76, 0x5D, 0xAF, 0x00, 0x44, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x07, 0x4C, 0x75, 0xC1, 0x34, 0x5A,
+    0xCF, 0x21, 0x23, 0x04, 0x41, 0x4C, 0x4C, 0x10, 0x21, 0x22, 0x04, 0x21, 0x17, 0x03, 0x21, 0x34,
+    0x03, 0xA1, 0x27, 0x03, 0x42, 0x35, 0x39, 0x5D, 0xF4, 0x5D, 0xE1, 0x41, 0x23, 0x3B, 0x27, 0x41,
+    0x13, 0x5C, 0x87, 0x21, 0x23, 0x04, 0x42, 0x23, 0x34, 0x00, 0x03, 0x4C, 0x38, 0xA1, 0x27, 0x07,
+    0x21, 0x4C, 0x03, 0x21, 0x38, 0x03, 0x21, 0x18, 0x03, 0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0x42,
+    0x2A, 0x39, 0x5E, 0x1F, 0x5E, 0x0C, 0x41, 0x30, 0x28, 0xFE, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x04, 0x03, 0x21, 0x40, 0x03, 0x21, 0x07, 0x03, 0xC5, 0x15, 0x19, 0x1E, 0x23, 0x2A, 0x00,
+    0x3E, 0x28, 0x7A, 0x00, 0x1D, 0x00, 0x1A, 0x00, 0x03, 0xC5, 0x23, 0x2A, 0x30, 0x32, 0x34, 0x00,
+    0x55, 0x44, 0xBD, 0x5E, 0x49, 0x5E, 0x49, 0x00, 0x10, 0x41, 0x11, 0x5D, 0xFB, 0x42, 0x13, 0x32,
+    0x00, 0x04, 0x5E, 0x24, 0xC2, 0x01, 0x21, 0x5A, 0xF9, 0x00, 0x07, 0xC2, 0x38, 0x40, 0x00, 0x07,
+    0x12, 0x8E, 0x42, 0x23, 0x32, 0x5E, 0x72, 0x5E, 0x72, 0x42, 0x14, 0x15, 0x00, 0x07, 0x5B, 0x95,
+    0xA1, 0x32, 0x07, 0x41, 0x2B, 0x5D, 0x7E, 0xC9, 0x04, 0x15, 0x17, 0x18, 0x1D, 0x2B, 0x32, 0x41,
+    0x44, 0x5E, 0x21, 0x5E, 0x21, 0x02, 0x35, 0x5E, 0x7D, 0x2D, 0x48, 0x53, 0xD9, 0x5E, 0x87, 0x23,
+    0x4B, 0x00, 0x04, 0x41, 0x21, 0x4E, 0x50, 0x21, 0x32, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03,
+    0x21, 0x2D, 0x03, 0x42, 0x2A, 0x47, 0x5C, 0xCF, 0x00, 0x03, 0x44, 0x08, 0x17, 0x1B, 0x25, 0x5E,
+    0xBA, 0x5E, 0xBA, 0x5E, 0xBA, 0x00, 0x07, 0x42, 0x35, 0x4C, 0x5E, 0xC7, 0x00, 0x0D, 0xC2, 0x32,
+    0x34, 0x5E, 0xCE, 0x33, 0x31, 0x43, 0x2D, 0x32, 0x49, 0x5E, 0xD4, 0x5E, 0xD5, 0x57, 0xE7, 0xC6,
+    0x19, 0x27, 0x2A, 0x35, 0x40, 0x44, 0x00, 0x0A, 0x5C, 0xBC, 0x53, 0x0C, 0x5E, 0xDF, 0x5E, 0x81,
+    0x2C, 0xCE, 0x41, 0x22, 0x5E, 0x6D, 0xCD, 0x01, 0x04, 0x0D, 0x14, 0x15, 0x19, 0x21, 0x22, 0x23,
+    0x25, 0x27, 0x2B, 0x40, 0x3E, 0x3B, 0x01, 0x15, 0x01, 0x05, 0x55, 0x6A, 0x00, 0xAD, 0x00, 0x8B,
+    0x00, 0x76, 0x00, 0x6F, 0x00, 0x2F, 0x00, 0x28, 0x00, 0x17, 0x5E, 0xDA, 0x00, 0x04, 0x43, 0x31,
+    0x32, 0x37, 0x5E, 0xCF, 0x5E, 0x63, 0x5E, 0xC9, 0x42, 0x0D, 0x19, 0x5F, 0x28, 0x5F, 0x28, 0x46,
+    0x19, 0x23, 0x30, 0x31, 0x32, 0x34, 0x5F, 0x2F, 0x5E, 0xE9, 0x5F, 0x2F, 0x00, 0x07, 0x42, 0x53,
+    0x5F, 0x2F, 0x41, 0x25, 0x44, 0xB7, 0x42, 0x19, 0x40, 0x54, 0x98, 0x00, 0x04, 0x21, 0x30, 0x07,
+    0x43, 0x30, 0x38, 0x48, 0x5F, 0x50, 0x5F, 0x01, 0x59, 0x31, 0x41, 0x35, 0x52, 0x1E, 0x43, 0x19,
+    0x23, 0x25, 0x00, 0x04, 0x5E, 0xF8, 0x5E, 0x4E, 0x42, 0x23, 0x2B, 0x51, 0x7C, 0x49, 0xDE, 0xC7,
+    0x07, 0x19, 0x21, 0x23, 0x25, 0x40, 0x41, 0x00, 0x51, 0x00, 0x40, 0x00, 0x22, 0x00, 0x1F, 0x5F,
+    0x09, 0x00, 0x11, 0x00, 0x07, 0x41, 0x42, 0x5F, 0x84, 0x21, 0x32, 0x04, 0x43, 0x31, 0x35, 0x49,
+    0x15, 0xC2, 0x5E, 0xFB, 0x5F, 0x26, 0x41, 0x25, 0x5B, 0x7E, 0xC4, 0x04, 0x0A, 0x14, 0x1E, 0x5D,
+    0x8B, 0x00, 0x0E, 0x57, 0xB8, 0x00, 0x04, 0xC2, 0x0A, 0x25, 0x5F, 0x6E, 0x5D, 0x98, 0xC1, 0x34,
+    0x2C, 0x7F, 0xC2, 0x40, 0x42, 0x31, 0x25, 0x5C, 0xA4, 0x41, 0x0B, 0x5E, 0xF3, 0x21, 0x19, 0x04,
+    0x21, 0x1B, 0x03, 0xC2, 0x25, 0x41, 0x5F, 0xB6, 0x00, 0x03, 0x42, 0x13, 0x30, 0x5F, 0xCA, 0x5F,
+    0xCA, 0x42, 0x25, 0x35, 0x48, 0xA1, 0x5F, 0xD1, 0x41, 0x01, 0x5C, 0xF4, 0x42, 0x01, 0x19, 0x00,
+    0x04, 0x28, 0x76, 0xD1, 0x04, 0x07, 0x13, 0x14, 0x15, 0x19, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25,
+    0x27, 0x2A, 0x42, 0x48, 0x49, 0x00, 0x5A, 0x00, 0x49, 0x4A, 0xB8, 0x00, 0x3C, 0x00, 0x35, 0x00,
+    0x31, 0x5F, 0xE3, 0x5F, 0xE3, 0x00, 0x20, 0x5F, 0x7D, 0x00, 0x19, 0x00, 0x12, 0x48, 0x8C, 0x5F,
+    0x7D, 0x00, 0x07, 0x59, 0x59, 0x5F, 0xAA, 0x41, 0x02, 0x44, 0x09, 0x42, 0x30, 0x48, 0x00, 0x04,
+    0x5F, 0xB5, 0x41, 0x29, 0x44, 0x9F, 0x21, 0x01, 0x04, 0xA1, 0x31, 0x03, 0x21, 0x15, 0x03, 0xC3,
+    0x08, 0x34, 0x38, 0x5F, 0xE9, 0x00, 0x03, 0x60, 0x2E, 0xC1, 0x2D, 0x60, 0x2F, 0xC1, 0x27, 0x60,
+    0x3D, 0x42, 0x32, 0x49, 0x00, 0x04, 0x58, 0x20, 0x41, 0x04, 0x5D, 0x3A, 0x41, 0x27, 0x1A, 0xD1,
+    0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xC2, 0x15, 0x25, 0x5D, 0xC2, 0x44, 0xD3, 0x42, 0x15, 0x19,
+    0x00, 0x34, 0x60, 0x5D, 0x41, 0x21, 0x5F, 0x9E, 0x21, 0x04, 0x04, 0xCB, 0x07, 0x1B, 0x20, 0x27,
+    0x30, 0x31, 0x32, 0x34, 0x35, 0x40, 0x42, 0x00, 0x23, 0x00, 0x18, 0x1F, 0x79, 0x4E, 0x9A, 0x60,
+    0x6B, 0x60, 0x32, 0x00, 0x15, 0x00, 0x0E, 0x60, 0x6B, 0x00, 0x03, 0x46, 0xA8, 0x42, 0x08, 0x19,
+    0x60, 0x83, 0x5D, 0x22, 0xC5, 0x02, 0x15, 0x19, 0x1F, 0x41, 0x55, 0xE6, 0x5F, 0x8B, 0x59, 0xA6,
+    0x5B, 0xD2, 0x00, 0x07, 0xD0, 0x04, 0x0A, 0x15, 0x17, 0x1B, 0x1E, 0x1F, 0x21, 0x23, 0x25, 0x27,
+    0x2A, 0x2D, 0x44, 0x48, 0x49, 0x60, 0xA4, 0x40, 0x04, 0x59, 0x6B, 0x60, 0xA4, 0x00, 0x89, 0x00,
+    0x75, 0x00, 0x6B, 0x2E, 0x0A, 0x00, 0xDA, 0x00, 0x63, 0x00, 0x39, 0x60, 0xA4, 0x02, 0x7E, 0x29,
+    0x5C, 0x60, 0xA4, 0x00, 0x10, 0x41, 0x12, 0x5F, 0x5D, 0x21, 0x31, 0x04, 0xC5, 0x0A, 0x1A, 0x21,
+    0x24, 0x27, 0x5E, 0xCD, 0x60, 0x81, 0x5A, 0x36, 0x2B, 0x82, 0x00, 0x03, 0x42, 0x19, 0x2D, 0x00,
+    0x10, 0x60, 0xEC, 0x42, 0x19, 0x2D, 0x60, 0xF3, 0x60, 0xF3, 0x43, 0x14, 0x48, 0x49, 0x60, 0xFA,
+    0x00, 0x0E, 0x00, 0x07, 0x42, 0x35, 0x38, 0x61, 0x04, 0x5E, 0xF5, 0xA1, 0x0A, 0x07, 0x41, 0x2B,
+    0x61, 0x0E, 0xC1, 0x21, 0x60, 0xAC, 0x21, 0x34, 0x04, 0xC4, 0x0A, 0x15, 0x2A, 0x2D, 0x61, 0x00,
+    0x60, 0x10, 0x53, 0x11, 0x48, 0x65, 0x44, 0x23, 0x25, 0x27, 0x32, 0x61, 0x26, 0x5F, 0x6E, 0x61,
+    0x1C, 0x61, 0x26, 0x42, 0x1E, 0x2A, 0x61, 0x33, 0x61, 0x29, 0xC6, 0x0A, 0x19, 0x1E, 0x23, 0x2A,
+    0x41, 0x61, 0x01, 0x5E, 0xBD, 0x00, 0x14, 0x5E, 0xBD, 0x5F, 0x10, 0x00, 0x07, 0xC1, 0x1E, 0x61,
+    0x07, 0x42, 0x21, 0x35, 0x30, 0x90, 0x00, 0x04, 0x43, 0x07, 0x21, 0x22, 0x61, 0x58, 0x2E, 0x97,
+    0x61, 0x58, 0xCB, 0x01, 0x13, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x25, 0x29, 0x48, 0x49, 0x00, 0x57,
+    0x00, 0x54, 0x61, 0x62, 0x00, 0x4C, 0x61, 0x62, 0x00, 0x49, 0x00, 0x28, 0x00, 0x11, 0x50, 0xAE,
+    0x00, 0x0A, 0x61, 0x58, 0xC2, 0x23, 0x2A, 0x3B, 0x01, 0x45, 0x76, 0xC7, 0x0A, 0x17, 0x23, 0x2A,
+    0x42, 0x43, 0x49, 0x2C, 0x55, 0x61, 0x8B, 0x4E, 0x6D, 0x61, 0x8B, 0x53, 0x83, 0x5F, 0x5A, 0x00,
+    0x07, 0x41, 0x15, 0x44, 0x31, 0x42, 0x19, 0x25, 0x00, 0x04, 0x61, 0xA5, 0x43, 0x07, 0x17, 0x21,
+    0x61, 0xAC, 0x61, 0x66, 0x61, 0xAC, 0x42, 0x22, 0x25, 0x61, 0xB6, 0x00, 0x0A, 0x41, 0x01, 0x44,
+    0x6A, 0x41, 0x25, 0x5E, 0xB3, 0x22, 0x40, 0x41, 0x04, 0x04, 0x21, 0x01, 0x05, 0xA2, 0x40, 0x42,
+    0x10, 0x03, 0x41, 0x31, 0x61, 0xBF, 0xA1, 0x2D, 0x04, 0x46, 0x01, 0x04, 0x17, 0x1B, 0x22, 0x23,
+    0x00, 0x0C, 0x00, 0x03, 0x61, 0xD9, 0x61, 0xD9, 0x3C, 0xB1, 0x23, 0x9E, 0x21, 0x2D, 0x13, 0x41,
+    0x04, 0x5D, 0xD7, 0xC5, 0x19, 0x25, 0x40, 0x41, 0x44, 0x2E, 0xC4, 0x5F, 0xE4, 0x2F, 0x03, 0x00,
+    0x04, 0x4C, 0x7D, 0xC4, 0x07, 0x19, 0x1F, 0x22, 0x00, 0x10, 0x62, 0x03, 0x5D, 0x41, 0x62, 0x03,
+    0x41, 0x27, 0x61, 0x0E, 0x21, 0x21, 0x04, 0x21, 0x38, 0x03, 0x21, 0x17, 0x03, 0x21, 0x1B, 0x03,
+    0x21, 0x25, 0x03, 0x41, 0x17, 0x60, 0xE2, 0x21, 0x2D, 0x04, 0x21, 0x37, 0x03, 0x21, 0x21, 0x03,
+    0x21, 0x35, 0x03, 0x41, 0x23, 0x2E, 0xF5, 0x21, 0x33, 0x04, 0x21, 0x1A, 0x03, 0x21, 0x28, 0x03,
+    0x21, 0x32, 0x03, 0x21, 0x01, 0x03, 0x21, 0x32, 0x03, 0x42, 0x1F, 0x21, 0x62, 0x49, 0x61, 0xCA,
+    0xC5, 0x01, 0x1D, 0x2D, 0x40, 0x44, 0x00, 0x30, 0x00, 0x20, 0x00, 0x0A, 0x25, 0x7A, 0x00, 0x07,
+    0x21, 0x07, 0x10, 0x42, 0x2D, 0x48, 0x62, 0x59, 0x61, 0xFD, 0xC3, 0x0A, 0x1B, 0x43, 0x00, 0x07,
+    0x56, 0x5A, 0x60, 0x39, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x56, 0xD5, 0x00, 0x71, 0x00, 0x14, 0x00,
+    0x0A, 0xC1, 0x0A, 0x62, 0x32, 0x43, 0x07, 0x19, 0x22, 0x62, 0x85, 0x62, 0x85, 0x00, 0x04, 0xC3,
+    0x07, 0x1B, 0x1E, 0x39, 0x3A, 0x61, 0x90, 0x44, 0x1A, 0xC2, 0x0A, 0x43, 0x58, 0x59, 0x60, 0x68,
+    0x23, 0x2D, 0x32, 0x33, 0x1B, 0x11, 0x07, 0x5F, 0x1F, 0x01, 0x04, 0x07, 0x0E, 0x0F, 0x14, 0x17,
+    0x19, 0x1A, 0x1B, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x37,
+    0x38, 0x39, 0x40, 0x42, 0x44, 0x47, 0x48, 0x49, 0x08, 0xDF, 0x2D, 0x4D, 0x08, 0xD1, 0x08, 0xC3,
+    0x08, 0xB8, 0x08, 0xB1, 0x36, 0x59, 0x08, 0x78, 0x08, 0x4C, 0x08, 0x49, 0x08, 0x0B, 0x50, 0xF8,
+    0x07, 0x7C, 0x07, 0x26, 0x06, 0xF3, 0x06, 0xC3, 0x05, 0xFF, 0x04, 0xF8, 0x03, 0xB1, 0x03, 0x38,
+    0x02, 0xC4, 0x02, 0x03, 0x01, 0xAD, 0x01, 0x45, 0x01, 0x1C, 0x01, 0x02, 0x00, 0xF1, 0x60, 0x98,
+    0x00, 0xBB, 0x00, 0x33, 0x00, 0x07, 0x42, 0x14, 0x49, 0x5C, 0x18, 0x62, 0xA0, 0xC1, 0x40, 0x3E,
+    0x5D, 0xC1, 0x0B, 0x62, 0xB6, 0xC2, 0x17, 0x40, 0x55, 0x0D, 0x24, 0x80, 0xC1, 0x40, 0x24, 0x87,
+    0x43, 0x14, 0x19, 0x22, 0x00, 0x0B, 0x00, 0x04, 0x63, 0x20, 0x42, 0x2D, 0x31, 0x62, 0xF1, 0x63,
+    0x20, 0x41, 0x0B, 0x63, 0x30, 0xA2, 0x0B, 0x41, 0x0B, 0x04, 0xC4, 0x1E, 0x21, 0x2B, 0x41, 0x44,
+    0xC5, 0x60, 0xEE, 0x63, 0x2D, 0x37, 0x73, 0x41, 0x27, 0x62, 0x54, 0x21, 0x41, 0x04, 0x21, 0x4C,
+    0x03, 0x21, 0x15, 0x03, 0x42, 0x32, 0x35, 0x63, 0x54, 0x62, 0xD5, 0xC2, 0x0B, 0x1A, 0x2F, 0x81,
+    0x00, 0x07, 0xC2, 0x1C, 0x44, 0x61, 0x53, 0x41, 0xB1, 0x41, 0x49, 0x63, 0x1A, 0x21, 0x04, 0x04,
+    0xA1, 0x42, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x4C, 0x03, 0x41, 0x01, 0x21, 0x1C, 0x21, 0x25, 0x04,
+    0x21, 0x40, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x15, 0x03, 0x41, 0x39, 0x5F, 0x5D, 0x41, 0x2D, 0x61,
+    0xDB, 0x21, 0x1A, 0x04, 0xA2, 0x0B, 0x40, 0x0B, 0x03, 0xCA, 0x01, 0x07, 0x19, 0x1F, 0x21, 0x22,
+    0x23, 0x25, 0x2A, 0x41, 0x00, 0x64, 0x00, 0x5F, 0x63, 0x99, 0x00, 0x48, 0x00, 0x3E, 0x00, 0x37,
+    0x00, 0x23, 0x00, 0x13, 0x00, 0x05, 0x25, 0x04, 0x42, 0x34, 0x48, 0x5F, 0xA0, 0x62, 0xAC, 0x41,
+    0x0B, 0x4B, 0x39, 0xA2, 0x0B, 0x40, 0x0B, 0x04, 0x41, 0x2B, 0x5E, 0xCF, 0x41, 0x0B, 0x63, 0x4D,
+    0xC4, 0x1F, 0x23, 0x41, 0x44, 0x59, 0x90, 0x30, 0x6F, 0x00, 0x08, 0x00, 0x04, 0x41, 0x0B, 0x62,
+    0xD8, 0xA1, 0x41, 0x04, 0xC4, 0x17, 0x19, 0x22, 0x40, 0x57, 0xD4, 0x43, 0x44, 0x63, 0x7E, 0x25,
+    0x4F, 0x41, 0x15, 0x21, 0xD4, 0x21, 0x42, 0x04, 0x21, 0x2A, 0x03, 0x21, 0x34, 0x03, 0x21, 0x23,
+    0x03, 0x41, 0x32, 0x25, 0xB3, 0x21, 0x27, 0x04, 0x21, 0x25, 0x03, 0x21, 0x31, 0x03, 0x41, 0x25,
+    0x43, 0x53, 0x41, 0x2D, 0x63, 0xA9, 0x43, 0x04, 0x21, 0x40, 0x00, 0x08, 0x00, 0x04, 0x4E, 0xA0,
+    0x41, 0x2D, 0x04, 0x97, 0x22, 0x32, 0x34, 0x0E, 0x04, 0x41, 0x35, 0x4E, 0x23, 0x42, 0x34, 0x35,
+    0x43, 0x05, 0x43, 0x05, 0x21, 0x23, 0x07, 0x21, 0x32, 0x03, 0x41, 0x07, 0x04, 0xB5, 0x21, 0x34,
+    0x04, 0x21, 0x21, 0x03, 0x21, 0x14, 0x03, 0x21, 0x42, 0x03, 0x41, 0x40, 0x25, 0xB5, 0x22, 0x15,
+    0x2E, 0x07, 0x04, 0xC7, 0x04, 0x0B, 0x15, 0x19, 0x21, 0x2E, 0x42, 0x00, 0x55, 0x00, 0x48, 0x00,
+    0x2F, 0x00, 0x2A, 0x00, 0x1C, 0x58, 0x80, 0x00, 0x05, 0x42, 0x32, 0x35, 0x60, 0x51, 0x63, 0xD8,
+    0x41, 0x27, 0x52, 0x08, 0xC3, 0x0B, 0x40, 0x43, 0x00, 0x0B, 0x00, 0x04, 0x64, 0x3B, 0x41, 0x34,
+    0x26, 0x56, 0x21, 0x25, 0x04, 0x21, 0x1E, 0x03, 0x42, 0x25, 0x2D, 0x62, 0x5E, 0x3F, 0x8D, 0x42,
+    0x1E, 0x40, 0x00, 0x07, 0x47, 0x38, 0x41, 0x34, 0x26, 0x0D, 0x21, 0x1F, 0x04, 0x41, 0x34, 0x62,
+    0x9F, 0x41, 0x0B, 0x61, 0x93, 0xA1, 0x40, 0x04, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D,
+    0x03, 0x21, 0x21, 0x03, 0xA2, 0x21, 0x40, 0x17, 0x03, 0x42, 0x15, 0x2D, 0x64, 0xB9, 0x63, 0xC6,
+    0x21, 0x1F, 0x07, 0x43, 0x1F, 0x40, 0x42, 0x64, 0x5D, 0x00, 0x03, 0x63, 0xBE, 0x43, 0x07, 0x19,
+    0x27, 0x64, 0xCD, 0x64, 0xCD, 0x64, 0xCD, 0x4C, 0x01, 0x04, 0x07, 0x14, 0x19, 0x1A, 0x1B, 0x1E,
+    0x1F, 0x21, 0x25, 0x49, 0x01, 0x07, 0x27, 0xE1, 0x00, 0xF6, 0x00, 0xF3, 0x00, 0x84, 0x00, 0x63,
+    0x00, 0x52, 0x00, 0x48, 0x00, 0x3D, 0x00, 0x23, 0x00, 0x14, 0x00, 0x0A, 0x41, 0x1E, 0x64, 0xE0,
+    0x21, 0x23, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x33, 0x03, 0x21, 0x14, 0x03, 0x21,
+    0x01, 0x03, 0x21, 0x36, 0x03, 0xC3, 0x14, 0x28, 0x38, 0x00, 0x03, 0x61, 0xE2, 0x4B, 0x89, 0x41,
+    0x2A, 0x62, 0x8B, 0xA1, 0x34, 0x04, 0x42, 0x32, 0x34, 0x64, 0xED, 0x64, 0xED, 0x41, 0x1B, 0x64,
+    0x37, 0x21, 0x2A, 0x04, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x41, 0x04, 0x01, 0x2C, 0x21, 0x32,
+    0x04, 0x41, 0x2A, 0x05, 0xBC, 0x21, 0x34, 0x04, 0x21, 0x0B, 0x03, 0x21, 0x19, 0x03, 0x21, 0x32,
+    0x03, 0x21, 0x23, 0x03, 0x41, 0x14, 0x43, 0xDB, 0xC4, 0x15, 0x1F, 0x32, 0x34, 0x00, 0x1A, 0x00,
+    0x07, 0x65, 0x58, 0x00, 0x04, 0x42, 0x36, 0x48, 0x60, 0x6C, 0x65, 0x0A, 0xA1, 0x0B, 0x07, 0x41,
+    0x01, 0x61, 0x4A, 0x21, 0x44, 0x04, 0xA1, 0x2A, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x44,
+    0x2D, 0x31, 0x32, 0x39, 0x52, 0x61, 0x64, 0x7A, 0x00, 0x03, 0x17, 0x4C, 0x41, 0x42, 0x64, 0x87,
+    0x21, 0x22, 0x04, 0x42, 0x27, 0x40, 0x3F, 0x10, 0x00, 0x03, 0xC1, 0x34, 0x45, 0x75, 0x41, 0x19,
+    0x01, 0x08, 0x21, 0x14, 0x04, 0xC3, 0x14, 0x2A, 0x42, 0x00, 0x0B, 0x65, 0xA5, 0x00, 0x03, 0x22,
+    0x32, 0x4C, 0x1C, 0x0A, 0x41, 0x32, 0x48, 0x44, 0x21, 0x27, 0x04, 0x41, 0x1B, 0x65, 0x55, 0x42,
+    0x21, 0x40, 0x65, 0xBF, 0x00, 0x04, 0x44, 0x30, 0x32, 0x34, 0x39, 0x00, 0x0E, 0x00, 0x07, 0x64,
+    0x4E, 0x65, 0x8D, 0x41, 0x47, 0x61, 0xCF, 0x21, 0x17, 0x04, 0xA1, 0x41, 0x03, 0x21, 0x14, 0x03,
+    0x42, 0x49, 0x4C, 0x5E, 0xF2, 0x00, 0x03, 0xC2, 0x14, 0x19, 0x65, 0xCB, 0x00, 0x07, 0x41, 0x1A,
+    0x47, 0xFB, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x21, 0x2D,
+    0x03, 0x22, 0x34, 0x35, 0x03, 0x03, 0x21, 0x14, 0x05, 0x42, 0x35, 0x38, 0x65, 0x16, 0x00, 0x03,
+    0x42, 0x1A, 0x47, 0x66, 0x10, 0x61, 0xF8, 0x21, 0x23, 0x07, 0x21, 0x01, 0x03, 0x41, 0x23, 0x3A,
+    0xEB, 0x21, 0x40, 0x04, 0x21, 0x21, 0x03, 0x41, 0x32, 0x4C, 0x9B, 0x21, 0x19, 0x04, 0x43, 0x1E,
+    0x22, 0x27, 0x44, 0xE2, 0x00, 0x03, 0x66, 0x2E, 0x42, 0x01, 0x25, 0x66, 0x38, 0x62, 0x13, 0xD1,
+    0x01, 0x07, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x2D, 0x40, 0x41, 0x42,
+    0x44, 0x01, 0x2A, 0x66, 0x3F, 0x01, 0x1C, 0x01, 0x19, 0x01, 0x08, 0x00, 0xE7, 0x00, 0xD3, 0x13,
+    0xD1, 0x00, 0xC0, 0x00, 0x90, 0x00, 0x79, 0x00, 0x58, 0x00, 0x36, 0x00, 0x25, 0x00, 0x1B, 0x00,
+    0x11, 0x00, 0x07, 0x41, 0x25, 0x4A, 0xF0, 0x21, 0x32, 0x04, 0x21, 0x22, 0x03, 0x21, 0x17, 0x03,
+    0x21, 0x34, 0x03, 0x21, 0x27, 0x03, 0x21, 0x4C, 0x03, 0x41, 0x23, 0x64, 0x8B, 0xA1, 0x40, 0x04,
+    0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x42, 0x0B, 0x19, 0x29, 0xC7, 0x66, 0x38, 0xC5, 0x02, 0x0B,
+    0x19, 0x32, 0x41, 0x00, 0x17, 0x48, 0x07, 0x66, 0x81, 0x00, 0x0A, 0x00, 0x07, 0x41, 0x48, 0x65,
+    0xB7, 0x21, 0x25, 0x04, 0x21, 0x39, 0x03, 0x42, 0x1B, 0x34, 0x66, 0xB7, 0x66, 0x59, 0x21, 0x01,
+    0x07, 0x41, 0x04, 0x65, 0x49, 0x45, 0x01, 0x04, 0x40, 0x42, 0x44, 0x00, 0x11, 0x66, 0xA9, 0x00,
+    0x07, 0x00, 0x04, 0x42, 0xCF, 0x42, 0x25, 0x40, 0x66, 0x0F, 0x25, 0x13, 0x21, 0x34, 0x07, 0x41,
+    0x19, 0x33, 0xBA, 0x41, 0x0B, 0x66, 0xAA, 0x21, 0x40, 0x04, 0x42, 0x34, 0x35, 0x00, 0x03, 0x66,
+    0x6B, 0x41, 0x23, 0x4C, 0x83, 0x42, 0x1A, 0x21, 0x65, 0xFF, 0x64, 0x0D, 0x21, 0x32, 0x07, 0x42,
+    0x01, 0x0B, 0x4C, 0x74, 0x24, 0x8D, 0x41, 0x47, 0x54, 0x1C, 0x42, 0x17, 0x2A, 0x00, 0x04, 0x67,
+    0x0A, 0x41, 0x19, 0x23, 0x09, 0x21, 0x19, 0x04, 0x45, 0x19, 0x22, 0x40, 0x41, 0x42, 0x00, 0x1C,
+    0x49, 0xC5, 0x00, 0x19, 0x00, 0x0E, 0x00, 0x03, 0xC1, 0x0B, 0x59, 0x47, 0x41, 0x25, 0x48, 0x6D,
+    0x42, 0x19, 0x34, 0x46, 0x75, 0x00, 0x04, 0x41, 0x1A, 0x24, 0x24, 0x21, 0x31, 0x04, 0x41, 0x17,
+    0x13, 0xAE, 0x21, 0x34, 0x04, 0x41, 0x0B, 0x3C, 0x13, 0x21, 0x40, 0x04, 0x41, 0x19, 0x03, 0x23,
+    0x43, 0x1A, 0x1E, 0x1F, 0x66, 0xF2, 0x00, 0x07, 0x00, 0x04, 0x23, 0x1A, 0x21, 0x42, 0x1F, 0x18,
+    0x0A, 0x41, 0x32, 0x46, 0x15, 0x21, 0x21, 0x04, 0x21, 0x34, 0x03, 0x42, 0x01, 0x04, 0x67, 0x05,
+    0x61, 0xB9, 0x41, 0x27, 0x4A, 0x1F, 0x41, 0x27, 0x63, 0x51, 0x46, 0x04, 0x25, 0x27, 0x34, 0x40,
+    0x44, 0x67, 0x5E, 0x00, 0x12, 0x00, 0x19, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x04, 0xC1, 0x34, 0x54,
+    0xA3, 0x42, 0x21, 0x47, 0x67, 0x91, 0x65, 0x82, 0x21, 0x15, 0x07, 0x21, 0x40, 0x03, 0x41, 0x2D,
+    0x63, 0x72, 0x21, 0x14, 0x04, 0x42, 0x07, 0x21, 0x54, 0xDF, 0x67, 0xA5, 0xD1, 0x01, 0x07, 0x0B,
+    0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1F, 0x21, 0x25, 0x27, 0x2A, 0x40, 0x48, 0x49, 0x01, 0x0F,
+    0x00, 0xE7, 0x00, 0xD0, 0x00, 0xCD, 0x00, 0xC2, 0x00, 0xBB, 0x00, 0x94, 0x00, 0x84, 0x67, 0xAC,
+    0x00, 0x7C, 0x00, 0x52, 0x00, 0x32, 0x00, 0x1F, 0x00, 0x11, 0x00, 0x0A, 0x61, 0x22, 0x00, 0x07,
+    0x41, 0x04, 0x04, 0x99, 0x21, 0x41, 0x04, 0x21, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x21, 0x2D, 0x03,
+    0x41, 0x0B, 0x49, 0x52, 0xC2, 0x35, 0x40, 0x67, 0xF4, 0x00, 0x04, 0xC1, 0x2D, 0x67, 0xC2, 0x41,
+    0x2D, 0x30, 0xB3, 0x21, 0x42, 0x04, 0x41, 0x22, 0x67, 0xED, 0x22, 0x34, 0x35, 0x07, 0x04, 0x41,
+    0x48, 0x2A, 0x69, 0x42, 0x2D, 0x35, 0x29, 0x8A, 0x00, 0x04, 0xC1, 0x35, 0x3C, 0xE1, 0x41, 0x4A,
+    0x67, 0x19, 0x21, 0x34, 0x04, 0x41, 0x23, 0x31, 0x00, 0x42, 0x17, 0x35, 0x68, 0x29, 0x25, 0xBB,
+    0xC1, 0x44, 0x48, 0x8E, 0x21, 0x4C, 0x04, 0x21, 0x15, 0x03, 0x21, 0x19, 0x03, 0xC2, 0x21, 0x2A,
+    0x68, 0x3D, 0x68, 0x3D, 0x21, 0x22, 0x07, 0x21, 0x35, 0x03, 0x41, 0x04, 0x2B, 0x54, 0x47, 0x01,
+    0x04, 0x0B, 0x19, 0x21, 0x23, 0x25, 0x29, 0x92, 0x00, 0x29, 0x3D, 0x1C, 0x00, 0x25, 0x00, 0x14,
+    0x00, 0x07, 0x00, 0x04, 0x41, 0x17, 0x65, 0xD0, 0x21, 0x44, 0x04, 0x42, 0x19, 0x2D, 0x00, 0x03,
+    0x31, 0x1F, 0xC1, 0x42, 0x42, 0xEA, 0x42, 0x2D, 0x31, 0x68, 0x3D, 0x53, 0x31, 0x41, 0x0B, 0x2B,
+    0xAE, 0x21, 0x40, 0x04, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x49, 0x03, 0xA2, 0x0B, 0x1A,
+    0x17, 0x03, 0xCE, 0x01, 0x04, 0x14, 0x19, 0x1B, 0x1E, 0x23, 0x25, 0x2D, 0x40, 0x41, 0x42, 0x48,
+    0x49, 0x68, 0x92, 0x00, 0xA5, 0x00, 0x9E, 0x00, 0x97, 0x41, 0x04, 0x00, 0x88, 0x00, 0x7F, 0x00,
+    0x78, 0x00, 0x70, 0x00, 0x44, 0x58, 0x72, 0x00, 0x27, 0x00, 0x20, 0x00, 0x05, 0xC2, 0x0B, 0x40,
+    0x0D, 0xD4, 0x44, 0x0D, 0x45, 0x01, 0x07, 0x21, 0x48, 0x49, 0x68, 0xC4, 0x68, 0xC4, 0x00, 0x07,
+    0x68, 0xBA, 0x68, 0xBA, 0x41, 0x31, 0x1A, 0x2D, 0xC2, 0x15, 0x2A, 0x5A, 0xD0, 0x00, 0x04, 0x21,
+    0x2D, 0x07, 0x42, 0x48, 0x49, 0x00, 0x03, 0x68, 0x8D, 0x43, 0x19, 0x34, 0x48, 0x68, 0xE9, 0x68,
+    0xE8, 0x63, 0x37, 0xA1, 0x0B, 0x0A, 0x42, 0x19, 0x43, 0x5E, 0x06, 0x36, 0xF1, 0x21, 0x32, 0x07,
+    0xA1, 0x14, 0x03, 0x42, 0x34, 0x39, 0x64, 0xEB, 0x68, 0x72, 0xA1, 0x0B, 0x07, 0x41, 0x47, 0x65,
+    0xFF, 0x21, 0x01, 0x04, 0x21, 0x40, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03,
+    0x41, 0x27, 0x2B, 0xCB, 0xA2, 0x21, 0x44, 0x07, 0x04, 0x21, 0x4C, 0x05, 0x21, 0x23, 0x03, 0x21,
+    0x2D, 0x03, 0x21, 0x1B, 0x03, 0xA1, 0x40, 0x03, 0xC1, 0x27, 0x68, 0xD2, 0x21, 0x32, 0x04, 0x42,
+    0x1A, 0x41, 0x00, 0x03, 0x05, 0x62, 0xC3, 0x04, 0x0B, 0x40, 0x67, 0x37, 0x1F, 0xC6, 0x42, 0xAD,
+    0x21, 0x21, 0x0A, 0x49, 0x01, 0x07, 0x19, 0x1A, 0x1B, 0x21, 0x22, 0x48, 0x49, 0x00, 0x60, 0x69,
+    0x53, 0x00, 0x53, 0x00, 0x49, 0x00, 0x1E, 0x00, 0x14, 0x69, 0x53, 0x00, 0x03, 0x67, 0x44, 0x41,
+    0x01, 0x54, 0xA9, 0x21, 0x39, 0x04, 0xC2, 0x0B, 0x32, 0x5E, 0xC8, 0x69, 0x3D, 0xC1, 0x0B, 0x36,
+    0x1C, 0x21, 0x32, 0x6D, 0x21, 0x21, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03,
+    0x41, 0x4B, 0x68, 0xD5, 0x21, 0x35, 0x04, 0x22, 0x1B, 0x2D, 0x0A, 0x03, 0x42, 0x04, 0x21, 0x32,
+    0x36, 0x53, 0x96, 0xC1, 0x0B, 0x67, 0x13, 0xCC, 0x0A, 0x0B, 0x14, 0x1A, 0x21, 0x23, 0x25, 0x27,
+    0x40, 0x42, 0x48, 0x49, 0x54, 0xE1, 0x00, 0x34, 0x00, 0x31, 0x00, 0x2A, 0x69, 0xA7, 0x2F, 0xD7,
+    0x69, 0x8E, 0x69, 0x41, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x04, 0x69, 0x58, 0xC2, 0x2A, 0x42, 0x67,
+    0x4F, 0x4A, 0xE4, 0xC3, 0x01, 0x07, 0x2B, 0x1B, 0x5E, 0x62, 0xE5, 0x69, 0x6D, 0x41, 0x0B, 0x67,
+    0xCE, 0xA1, 0x41, 0x04, 0x23, 0x07, 0x19, 0x21, 0x18, 0x11, 0x03, 0x41, 0x1A, 0x66, 0x80, 0xC4,
+    0x07, 0x19, 0x2B, 0x42, 0x69, 0xEF, 0x69, 0xEF, 0x59, 0x0B, 0x00, 0x04, 0x44, 0x01, 0x19, 0x2D,
+    0x32, 0x69, 0xFC, 0x69, 0xFC, 0x00, 0x18, 0x00, 0x0D, 0xC1, 0x01, 0x69, 0xAB, 0xC5, 0x07, 0x19,
+    0x21, 0x2A, 0x41, 0x6A, 0x0D, 0x00, 0x04, 0x6A, 0x0D, 0x6A, 0x0D, 0x06, 0x41, 0xC2, 0x0B, 0x2A,
+    0x6A, 0x19, 0x60, 0xCF, 0x44, 0x19, 0x2D, 0x32, 0x33, 0x6A, 0x24, 0x00, 0x17, 0x69, 0x69, 0x00,
+    0x07, 0x53, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x48, 0x49, 0x6A, 0x31, 0x07, 0x2B, 0x6A, 0x31, 0x6A, 0x31, 0x07, 0x24, 0x07,
+    0x20, 0x07, 0x11, 0x06, 0x98, 0x06, 0x6E, 0x05, 0x5A, 0x03, 0xF2, 0x02, 0x85, 0x01, 0x9F, 0x01,
+    0x6D, 0x01, 0x4F, 0x00, 0xDE, 0x00, 0x8A, 0x00, 0x35, 0x00, 0x0D, 0xC2, 0x01, 0x2A, 0x68, 0x36,
+    0x29, 0x03, 0x21, 0x19, 0x07, 0x42, 0x19, 0x1B, 0x6A, 0x75, 0x00, 0x03, 0x21, 0x32, 0x07, 0xC1,
+    0x01, 0x4F, 0x8B, 0x21, 0x34, 0x04, 0x21, 0x15, 0x03, 0x21, 0x15, 0x03, 0xC2, 0x27, 0x35, 0x58,
+    0xBB, 0x6A, 0x8C, 0x41, 0x20, 0x68, 0x95, 0xC4, 0x01, 0x21, 0x40, 0x42, 0x6A, 0x31, 0x4D, 0x96,
+    0x00, 0x04, 0x63, 0x13, 0x21, 0x34, 0x0D, 0x22, 0x13, 0x15, 0x1B, 0x03, 0x41, 0x38, 0x66, 0x5A,
+    0xA1, 0x1B, 0x04, 0x21, 0x48, 0x03, 0x46, 0x0D, 0x27, 0x31, 0x32, 0x34, 0x35, 0x43, 0x28, 0x6A,
+    0x7D, 0x00, 0x2D, 0x00, 0x0F, 0x66, 0x9E, 0x00, 0x03, 0x41, 0x35, 0x59, 0x28, 0x41, 0x39, 0x6A,
+    0x87, 0x41, 0x31, 0x67, 0x9E, 0x41, 0x14, 0x6A, 0x8F, 0x21, 0x19, 0x04, 0x42, 0x01, 0x23, 0x4F,
+    0xEC, 0x6A, 0xC6, 0x21, 0x38, 0x07, 0x21, 0x19, 0x03, 0x41, 0x22, 0x67, 0xF0, 0xC7, 0x17, 0x19,
+    0x23, 0x30, 0x31, 0x32, 0x35, 0x00, 0x1C, 0x35, 0x2E, 0x6A, 0xE9, 0x6A, 0xED, 0x00, 0x14, 0x00,
+    0x07, 0x00, 0x04, 0x41, 0x19, 0x59, 0x54, 0x44, 0x01, 0x19, 0x1B, 0x22, 0x00, 0x3A, 0x00, 0x1A,
+    0x00, 0x04, 0x6A, 0x41, 0xC1, 0x34, 0x6B, 0x14, 0x21, 0x15, 0x04, 0x43, 0x01, 0x32, 0x34, 0x6A,
+    0xC9, 0x00, 0x14, 0x00, 0x03, 0x41, 0x2A, 0x68, 0x2C, 0x21, 0x07, 0x04, 0x41, 0x34, 0x50, 0x56,
+    0x44, 0x01, 0x10, 0x12, 0x2B, 0x6B, 0x30, 0x00, 0x04, 0x00, 0x04, 0x5D, 0x44, 0x22, 0x31, 0x32,
+    0x14, 0x0D, 0xC1, 0x01, 0x69, 0x0D, 0x21, 0x4C, 0x04, 0x21, 0x04, 0x03, 0x21, 0x07, 0x03, 0x21,
+    0x23, 0x03, 0xC1, 0x14, 0x64, 0xAC, 0x43, 0x32, 0x34, 0x36, 0x6B, 0x1D, 0x67, 0x3E, 0x6B, 0x55,
+    0x41, 0x25, 0x2E, 0x87, 0x21, 0x39, 0x04, 0xC4, 0x14, 0x21, 0x27, 0x2B, 0x00, 0x11, 0x00, 0x03,
+    0x69, 0x3D, 0x43, 0x1D, 0x41, 0x14, 0x6A, 0xE3, 0x45, 0x15, 0x31, 0x38, 0x39, 0x42, 0x69, 0xC6,
+    0x6A, 0xBD, 0x1D, 0xBC, 0x6B, 0x78, 0x00, 0x04, 0xC2, 0x14, 0x44, 0x63, 0x67, 0x6B, 0x42, 0x41,
+    0x4A, 0x58, 0xA5, 0x21, 0x38, 0x04, 0x41, 0x40, 0x0A, 0x88, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03,
+    0xA1, 0x2B, 0x03, 0x21, 0x35, 0x03, 0x21, 0x19, 0x03, 0x21, 0x0A, 0x03, 0x43, 0x01, 0x1F, 0x44,
+    0x65, 0xFA, 0x67, 0x87, 0x04, 0x36, 0x41, 0x49, 0x0E, 0x75, 0xC4, 0x1E, 0x28, 0x32, 0x35, 0x59,
+    0xE9, 0x59, 0x9C, 0x6B, 0xBA, 0x6B, 0xBA, 0xA1, 0x13, 0x0D, 0x41, 0x2D, 0x6B, 0xB7, 0xC9, 0x07,
+    0x13, 0x18, 0x23, 0x31, 0x32, 0x34, 0x38, 0x47, 0x59, 0x08, 0x6B, 0x08, 0x6B, 0x73, 0x00, 0x25,
+    0x6B, 0xCD, 0x00, 0x22, 0x00, 0x18, 0x00, 0x07, 0x00, 0x04, 0x41, 0x34, 0x25, 0x57, 0xC3, 0x20,
+    0x28, 0x43, 0x4D, 0x1E, 0x00, 0x04, 0x69, 0xBD, 0x42, 0x30, 0x32, 0x09, 0xE8, 0x6B, 0xF8, 0x41,
+    0x21, 0x6B, 0xB9, 0xC6, 0x14, 0x15, 0x21, 0x2A, 0x41, 0x43, 0x4F, 0xF5, 0x00, 0x0B, 0x4B, 0x81,
+    0x00, 0x04, 0x6A, 0x7B, 0x69, 0xD2, 0x44, 0x07, 0x08, 0x14, 0x25, 0x00, 0x13, 0x6C, 0x16, 0x6C,
+    0x16, 0x6C, 0x16, 0x41, 0x43, 0x2A, 0x3A, 0x21, 0x33, 0x04, 0x43, 0x2D, 0x31, 0x34, 0x6C, 0x29,
+    0x6B, 0xF1, 0x6C, 0x29, 0x42, 0x31, 0x38, 0x6B, 0x2F, 0x6C, 0x33, 0x42, 0x15, 0x1A, 0x4E, 0xE8,
+    0x63, 0x2E, 0xCB, 0x04, 0x08, 0x14, 0x17, 0x1A, 0x1F, 0x23, 0x2B, 0x2D, 0x40, 0x44, 0x00, 0x1B,
+    0x00, 0x18, 0x51, 0xD4, 0x6B, 0x36, 0x00, 0x0E, 0x67, 0x80, 0x45, 0xBF, 0x51, 0xD4, 0x50, 0x34,
+    0x00, 0x07, 0x58, 0xDA, 0xC3, 0x09, 0x14, 0x22, 0x6A, 0x3A, 0x40, 0x16, 0x6B, 0xFE, 0x42, 0x32,
+    0x39, 0x6C, 0x10, 0x6A, 0x5F, 0x41, 0x14, 0x39, 0x50, 0x42, 0x08, 0x21, 0x00, 0x04, 0x6B, 0x69,
+    0xC4, 0x15, 0x1E, 0x2A, 0x40, 0x00, 0x12, 0x56, 0x5D, 0x45, 0xFD, 0x00, 0x07, 0xC1, 0x14, 0x6A,
+    0x7E, 0x41, 0x01, 0x59, 0x5F, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x41, 0x15, 0x6A, 0x0B, 0xC4,
+    0x0A, 0x25, 0x2A, 0x40, 0x6C, 0x83, 0x6B, 0xA0, 0x00, 0x07, 0x00, 0x04, 0x41, 0x31, 0x2D, 0xF0,
+    0x21, 0x23, 0x04, 0x42, 0x14, 0x25, 0x00, 0x03, 0x6B, 0xBD, 0x48, 0x01, 0x07, 0x14, 0x19, 0x21,
+    0x22, 0x25, 0x2A, 0x00, 0x78, 0x00, 0x56, 0x6C, 0xBA, 0x00, 0x3A, 0x00, 0x2D, 0x00, 0x1B, 0x00,
+    0x07, 0x6C, 0xBA, 0x41, 0x21, 0x6A, 0xB0, 0xA1, 0x2B, 0x04, 0x41, 0x27, 0x2E, 0xB2, 0x42, 0x2D,
+    0x34, 0x6C, 0xDE, 0x00, 0x04, 0x42, 0x19, 0x32, 0x6C, 0xE5, 0x6C, 0xAC, 0x43, 0x01, 0x13, 0x31,
+    0x6C, 0xEC, 0x5D, 0x12, 0x6C, 0xB3, 0xC7, 0x04, 0x14, 0x17, 0x1F, 0x25, 0x29, 0x41, 0x00, 0x18,
+    0x00, 0x11, 0x06, 0x05, 0x6A, 0xD3, 0x51, 0xD1, 0x00, 0x0A, 0x43, 0xC7, 0x42, 0x32, 0x45, 0x6D,
+    0x0C, 0x6D, 0x0C, 0xC3, 0x19, 0x23, 0x24, 0x4E, 0x7D, 0x6A, 0xC7, 0x00, 0x07, 0x41, 0x23, 0x4A,
+    0x45, 0x41, 0x14, 0x6C, 0xC6, 0x21, 0x19, 0x04, 0x21, 0x31, 0x03, 0x41, 0x1B, 0x36, 0xB3, 0xC4,
+    0x08, 0x15, 0x2A, 0x41, 0x00, 0x12, 0x6C, 0xF6, 0x00, 0x07, 0x00, 0x04, 0x42, 0x0A, 0x0B, 0x6D,
+    0x20, 0x6D, 0x20, 0x41, 0x23, 0x6B, 0x20, 0x21, 0x38, 0x04, 0xA1, 0x17, 0x03, 0x41, 0x25, 0x52,
+    0xDF, 0x42, 0x21, 0x34, 0x6D, 0x51, 0x6D, 0x18, 0x42, 0x25, 0x49, 0x6D, 0x58, 0x6C, 0xFA, 0x21,
+    0x34, 0x07, 0x21, 0x1A, 0x03, 0xC5, 0x08, 0x0A, 0x1A, 0x25, 0x40, 0x4A, 0x8D, 0x6A, 0x2E, 0x00,
+    0x18, 0x00, 0x14, 0x00, 0x03, 0x41, 0x23, 0x5D, 0x9B, 0x21, 0x01, 0x04, 0x41, 0x14, 0x29, 0x74,
+    0xA1, 0x40, 0x04, 0x42, 0x07, 0x19, 0x00, 0x03, 0x6D, 0x83, 0x4B, 0x01, 0x07, 0x0A, 0x14, 0x15,
+    0x19, 0x1A, 0x21, 0x2A, 0x48, 0x49, 0x00, 0x94, 0x00, 0x77, 0x41, 0xED, 0x00, 0x5B, 0x00, 0x4E,
+    0x00, 0x40, 0x00, 0x25, 0x08, 0x8E, 0x00, 0x11, 0x6D, 0x80, 0x00, 0x07, 0xC1, 0x32, 0x6A, 0xDC,
+    0xC3, 0x1F, 0x32, 0x33, 0x68, 0xEE, 0x49, 0xB1, 0x6D, 0xB0, 0x41, 0x4C, 0x30, 0x65, 0xA1, 0x0B,
+    0x04, 0xC2, 0x25, 0x2A, 0x51, 0xB3, 0x6D, 0xC1, 0x41, 0x01, 0x2B, 0xE3, 0x21, 0x2A, 0x04, 0xC3,
+    0x1E, 0x23, 0x31, 0x5E, 0x62, 0x6D, 0xCF, 0x00, 0x03, 0xC1, 0x19, 0x6D, 0xBD, 0x41, 0x32, 0x49,
+    0xDE, 0xC2, 0x1A, 0x28, 0x6A, 0xC9, 0x5B, 0xC3, 0x41, 0x32, 0x64, 0x96, 0x21, 0x0B, 0x04, 0x21,
+    0x2A, 0x03, 0x21, 0x2D, 0x03, 0xC2, 0x25, 0x40, 0x6A, 0x13, 0x00, 0x03, 0xC5, 0x01, 0x13, 0x14,
+    0x32, 0x4C, 0x6D, 0xFC, 0x6D, 0x36, 0x00, 0x1F, 0x00, 0x1B, 0x00, 0x07, 0xC2, 0x31, 0x38, 0x6D,
+    0xBD, 0x20, 0x50, 0x41, 0x19, 0x6D, 0x07, 0x21, 0x30, 0x04, 0x42, 0x29, 0x2A, 0x52, 0xAE, 0x6D,
+    0xFE, 0x21, 0x07, 0x07, 0x21, 0x36, 0x03, 0x42, 0x01, 0x25, 0x6E, 0x27, 0x6E, 0x26, 0x41, 0x25,
+    0x6D, 0xDF, 0x21, 0x2B, 0x04, 0xA1, 0x42, 0x03, 0x21, 0x4C, 0x03, 0x41, 0x08, 0x30, 0x91, 0xC9,
+    0x04, 0x14, 0x15, 0x19, 0x1A, 0x24, 0x2B, 0x40, 0x42, 0x00, 0x28, 0x00, 0x1B, 0x00, 0x18, 0x00,
+    0x07, 0x5B, 0x21, 0x5D, 0x7A, 0x6E, 0x32, 0x35, 0x83, 0x00, 0x04, 0x42, 0x32, 0x37, 0x6E, 0x5B,
+    0x6A, 0x09, 0xA1, 0x14, 0x07, 0x43, 0x07, 0x25, 0x32, 0x6D, 0x63, 0x6C, 0x42, 0x6E, 0x65, 0x41,
+    0x19, 0x6C, 0x23, 0x21, 0x2B, 0x04, 0xC2, 0x40, 0x43, 0x00, 0x03, 0x2C, 0x8D, 0x21, 0x32, 0x07,
+    0x21, 0x15, 0x03, 0x41, 0x40, 0x6C, 0x74, 0x22, 0x01, 0x2E, 0x07, 0x04, 0xCE, 0x01, 0x14, 0x15,
+    0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2B, 0x2C, 0x42, 0x00, 0xE0, 0x00, 0xDC, 0x69,
+    0xCA, 0x00, 0xCE, 0x00, 0xCB, 0x00, 0xBD, 0x00, 0xB3, 0x00, 0x90, 0x00, 0x80, 0x00, 0x4D, 0x00,
+    0x2A, 0x00, 0x27, 0x6E, 0x8C, 0x00, 0x05, 0x42, 0x07, 0x34, 0x6E, 0xB7, 0x6E, 0x7E, 0xC2, 0x13,
+    0x19, 0x6E, 0xBE, 0x6E, 0xBE, 0x42, 0x32, 0x39, 0x00, 0x07, 0x6E, 0xC5, 0xC2, 0x04, 0x23, 0x6E,
+    0xB0, 0x5E, 0x04, 0x46, 0x07, 0x27, 0x31, 0x34, 0x35, 0x39, 0x00, 0x07, 0x6C, 0xA2, 0x5B, 0xB5,
+    0x6E, 0xD3, 0x6E, 0xD3, 0x6E, 0xD3, 0x41, 0x13, 0x6E, 0x80, 0x21, 0x29, 0x04, 0x42, 0x31, 0x34,
+    0x6E, 0xEC, 0x6E, 0xED, 0x42, 0x19, 0x31, 0x00, 0x07, 0x6D, 0xEF, 0x41, 0x14, 0x4D, 0x9A, 0x21,
+    0x30, 0x04, 0xA1, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x43, 0x01, 0x19, 0x25, 0x6B,
+    0x29, 0x00, 0x03, 0x6B, 0x29, 0x43, 0x04, 0x14, 0x25, 0x6F, 0x0B, 0x6F, 0x0B, 0x6F, 0x0B, 0xCD,
+    0x01, 0x14, 0x19, 0x1A, 0x1B, 0x1E, 0x23, 0x24, 0x2B, 0x2D, 0x40, 0x41, 0x44, 0x6E, 0xC1, 0x00,
+    0x68, 0x00, 0x5A, 0x6E, 0xC1, 0x5B, 0x51, 0x6E, 0x13, 0x00, 0x4C, 0x00, 0x35, 0x00, 0x2B, 0x28,
+    0x90, 0x00, 0x14, 0x00, 0x0A, 0x6E, 0xD9, 0x42, 0x15, 0x17, 0x2F, 0x9E, 0x2D, 0x3C, 0x21, 0x34,
+    0x07, 0x41, 0x48, 0x67, 0xCD, 0x21, 0x35, 0x04, 0x21, 0x25, 0x03, 0x21, 0x2B, 0x03, 0x21, 0x40,
+    0x03, 0x21, 0x21, 0x03, 0x21, 0x32, 0x03, 0xA1, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x43, 0x2D, 0x32,
+    0x33, 0x00, 0x03, 0x6F, 0x34, 0x6F, 0x6D, 0x41, 0x27, 0x6F, 0x19, 0x42, 0x2D, 0x49, 0x6F, 0x7B,
+    0x6D, 0x6C, 0x42, 0x19, 0x1A, 0x52, 0x2F, 0x6F, 0x82, 0xC9, 0x01, 0x02, 0x14, 0x19, 0x1B, 0x2A,
+    0x2B, 0x40, 0x41, 0x49, 0x90, 0x53, 0x7B, 0x00, 0x1C, 0x00, 0x12, 0x5B, 0xBB, 0x00, 0x0E, 0x6F,
+    0x70, 0x00, 0x07, 0x3E, 0xFA, 0xC1, 0x14, 0x6E, 0xDF, 0x41, 0x25, 0x3B, 0x73, 0x21, 0x1E, 0x04,
+    0x21, 0x42, 0x03, 0x41, 0x09, 0x6F, 0x58, 0x21, 0x08, 0x04, 0x21, 0x31, 0x03, 0x41, 0x34, 0x31,
+    0x61, 0x41, 0x22, 0x1E, 0x15, 0x42, 0x10, 0x40, 0x6F, 0xA9, 0x00, 0x04, 0x41, 0x40, 0x08, 0x5A,
+    0x21, 0x1F, 0x04, 0x43, 0x2D, 0x31, 0x4C, 0x00, 0x03, 0x5C, 0xB5, 0x6F, 0xD3, 0x41, 0x1E, 0x1F,
+    0x89, 0x41, 0x23, 0x08, 0x98, 0x21, 0x1E, 0x04, 0x46, 0x01, 0x04, 0x0B, 0x19, 0x40, 0x42, 0x6F,
+    0xCC, 0x00, 0x15, 0x6F, 0xCC, 0x3C, 0xC3, 0x00, 0x0B, 0x00, 0x03, 0xC1, 0x23, 0x6F, 0xC2, 0x42,
+    0x19, 0x27, 0x00, 0x04, 0x6F, 0xFF, 0x52, 0x01, 0x07, 0x08, 0x09, 0x10, 0x15, 0x16, 0x19, 0x1A,
+    0x1E, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x40, 0x48, 0x49, 0x4A, 0x72, 0x70, 0x06, 0x00, 0xB8, 0x6F,
+    0x04, 0x70, 0x06, 0x37, 0x6C, 0x6F, 0x40, 0x00, 0x7D, 0x00, 0x61, 0x00, 0x56, 0x00, 0x4C, 0x70,
+    0x05, 0x00, 0x49, 0x00, 0x41, 0x00, 0x1E, 0x6C, 0x02, 0x54, 0x94, 0x00, 0x07, 0x41, 0x17, 0x6F,
+    0x77, 0xC4, 0x02, 0x27, 0x31, 0x35, 0x6F, 0x3F, 0x6F, 0xF2, 0x70, 0x40, 0x00, 0x04, 0x41, 0x22,
+    0x6C, 0x29, 0x21, 0x2D, 0x04, 0x21, 0x23, 0x03, 0x42, 0x01, 0x27, 0x70, 0x58, 0x70, 0x58, 0x42,
+    0x31, 0x38, 0x00, 0x07, 0x70, 0x5E, 0x41, 0x42, 0x5E, 0x4F, 0x21, 0x2A, 0x04, 0x21, 0x4C, 0x03,
+    0x21, 0x17, 0x03, 0x21, 0x19, 0x03, 0x21, 0x21, 0x03, 0x21, 0x40, 0x03, 0x21, 0x17, 0x03, 0x21,
+    0x4C, 0x03, 0x21, 0x23, 0x03, 0x42, 0x23, 0x32, 0x70, 0x85, 0x00, 0x03, 0x41, 0x25, 0x31, 0xC9,
+    0x41, 0x27, 0x32, 0xEA, 0x22, 0x2D, 0x34, 0x08, 0x04, 0x41, 0x15, 0x0A, 0x10, 0x21, 0x40, 0x04,
+    0x21, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x41, 0x19, 0x37, 0x6A, 0xC3, 0x2D, 0x31, 0x32, 0x00, 0x07,
+    0x00, 0x04, 0x60, 0x8D, 0x42, 0x31, 0x49, 0x50, 0xED, 0x6E, 0x8A, 0x42, 0x30, 0x35, 0x70, 0xBB,
+    0x6E, 0xBD, 0x41, 0x35, 0x3B, 0x68, 0x42, 0x21, 0x25, 0x70, 0x00, 0x70, 0x00, 0x41, 0x23, 0x3F,
+    0x8E, 0x21, 0x1D, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x37, 0x03, 0x21, 0x25, 0x03, 0x41, 0x1A, 0x53,
+    0x8A, 0x21, 0x40, 0x04, 0x42, 0x21, 0x25, 0x00, 0x03, 0x70, 0xE4, 0x42, 0x19, 0x48, 0x70, 0xEB,
+    0x70, 0xB2, 0x21, 0x31, 0x07, 0x21, 0x0A, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x23, 0x03, 0x41, 0x19,
+    0x2A, 0x88, 0x21, 0x47, 0x04, 0x46, 0x01, 0x0B, 0x17, 0x1B, 0x25, 0x2D, 0x00, 0x2B, 0x00, 0x21,
+    0x70, 0xA7, 0x00, 0x0A, 0x5E, 0x9D, 0x00, 0x03, 0x42, 0x15, 0x25, 0x71, 0x17, 0x5B, 0xD3, 0x41,
+    0x23, 0x11, 0x66, 0x21, 0x04, 0x04, 0x21, 0x40, 0x03, 0x21, 0x21, 0x03, 0x42, 0x19, 0x40, 0x71,
+    0x10, 0x33, 0xD1, 0x21, 0x0B, 0x07, 0xD9, 0x01, 0x07, 0x09, 0x0B, 0x14, 0x17, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2B, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x49,
+    0x6F, 0x84, 0x71, 0x1D, 0x70, 0x34, 0x27, 0xBD, 0x00, 0xF5, 0x00, 0xE1, 0x00, 0xD7, 0x70, 0x14,
+    0x70, 0xD0, 0x3D, 0x5C, 0x00, 0xB1, 0x00, 0xA2, 0x00, 0x8C, 0x70, 0xD0, 0x00, 0x82, 0x00, 0x7B,
+    0x00, 0x74, 0x00, 0x70, 0x00, 0x31, 0x00, 0x1E, 0x00, 0x0D, 0x6F, 0x05, 0x00, 0x03, 0x71, 0x36,
+    0x71, 0x36, 0x42, 0x33, 0x37, 0x0C, 0x7C, 0x6D, 0x30, 0xA1, 0x14, 0x07, 0x42, 0x31, 0x39, 0x71,
+    0x53, 0x71, 0x3D, 0xC2, 0x14, 0x2A, 0x00, 0x07, 0x6E, 0x9A, 0x43, 0x01, 0x07, 0x48, 0x00, 0x11,
+    0x00, 0x07, 0x66, 0x08, 0xC1, 0x14, 0x03, 0xC7, 0xC1, 0x14, 0x42, 0xAB, 0x22, 0x19, 0x21, 0x08,
+    0x04, 0x41, 0x2D, 0x45, 0x8A, 0x43, 0x2D, 0x48, 0x49, 0x71, 0xB5, 0x00, 0x09, 0x00, 0x04, 0xC1,
+    0x14, 0x6E, 0xD7, 0xC1, 0x14, 0x6F, 0xA0, 0x41, 0x40, 0x6D, 0xAF, 0x21, 0x19, 0x04, 0x21, 0x32,
+    0x03, 0x21, 0x0A, 0x03, 0xC1, 0x31, 0x71, 0x9B, 0x42, 0x35, 0x4C, 0x71, 0xD8, 0x71, 0xD8, 0x21,
+    0x04, 0x07, 0x41, 0x25, 0x1E, 0x26, 0x42, 0x32, 0x34, 0x5F, 0xCB, 0x00, 0x04, 0x42, 0x28, 0x4C,
+    0x00, 0x07, 0x71, 0xED, 0x21, 0x04, 0x07, 0x21, 0x07, 0x03, 0xC2, 0x30, 0x32, 0x71, 0xFA, 0x00,
+    0x03, 0x21, 0x22, 0x07, 0x44, 0x04, 0x07, 0x34, 0x49, 0x72, 0x04, 0x00, 0x25, 0x00, 0x03, 0x6F,
+    0xDA, 0x41, 0x07, 0x57, 0xA3, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x21, 0x33,
+    0x03, 0x42, 0x04, 0x0A, 0x6D, 0x5F, 0x00, 0x03, 0x21, 0x23, 0x07, 0x21, 0x32, 0x03, 0x41, 0x19,
+    0x6F, 0xF9, 0x21, 0x34, 0x04, 0xC2, 0x1E, 0x20, 0x00, 0x03, 0x31, 0x43, 0x41, 0x32, 0x70, 0x0B,
+    0x21, 0x19, 0x04, 0x21, 0x33, 0x03, 0xC5, 0x01, 0x1E, 0x20, 0x22, 0x2D, 0x00, 0x1B, 0x00, 0x14,
+    0x53, 0x76, 0x00, 0x11, 0x00, 0x03, 0x41, 0x1E, 0x6F, 0xEB, 0x21, 0x34, 0x04, 0x41, 0x11, 0x4F,
+    0x85, 0x21, 0x19, 0x04, 0x21, 0x31, 0x03, 0xA2, 0x19, 0x1A, 0x0D, 0x03, 0x21, 0x35, 0x05, 0x43,
+    0x0E, 0x13, 0x34, 0x00, 0x03, 0x71, 0xA9, 0x6F, 0x61, 0xC1, 0x32, 0x57, 0x11, 0x21, 0x15, 0x04,
+    0x21, 0x34, 0x03, 0x41, 0x2B, 0x50, 0xE6, 0xC1, 0x14, 0x6B, 0x3B, 0x42, 0x07, 0x19, 0x00, 0x04,
+    0x72, 0x8B, 0xCE, 0x01, 0x08, 0x0A, 0x14, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x29, 0x2A, 0x40, 0x48,
+    0x49, 0x00, 0xD3, 0x00, 0xCF, 0x00, 0xC1, 0x00, 0xBE, 0x72, 0x92, 0x4C, 0xFE, 0x72, 0x92, 0x00,
+    0x8E, 0x00, 0x4C, 0x00, 0x23, 0x00, 0x12, 0x00, 0x0F, 0x2D, 0x28, 0x00, 0x07, 0xC3, 0x14, 0x32,
+    0x39, 0x46, 0x6F, 0x72, 0x02, 0x6D, 0x2F, 0x41, 0x39, 0x72, 0xC6, 0x41, 0x04, 0x70, 0xCD, 0x21,
+    0x40, 0x04, 0x21, 0x34, 0x03, 0x21, 0x25, 0x03, 0x42, 0x32, 0x36, 0x72, 0xD8, 0x72, 0xD8, 0x41,
+    0x23, 0x72, 0xC6, 0x42, 0x2D, 0x34, 0x6F, 0x78, 0x72, 0x94, 0x42, 0x16, 0x1A, 0x00, 0x07, 0x72,
+    0x84, 0x42, 0x04, 0x25, 0x42, 0x2C, 0x72, 0xF1, 0xC9, 0x01, 0x14, 0x16, 0x1E, 0x23, 0x2B, 0x40,
+    0x41, 0x43, 0x72, 0xB2, 0x00, 0x3B, 0x00, 0x31, 0x00, 0x23, 0x00, 0x20, 0x00, 0x19, 0x00, 0x0E,
+    0x00, 0x07, 0x70, 0xC7, 0x41, 0x2D, 0x71, 0x16, 0x43, 0x07, 0x19, 0x21, 0x36, 0xF1, 0x73, 0x18,
+    0x73, 0x18, 0x41, 0x17, 0x72, 0xD3, 0x21, 0x19, 0x04, 0x21, 0x38, 0x03, 0x41, 0x49, 0x71, 0x02,
+    0x41, 0x42, 0x65, 0x28, 0x21, 0x33, 0x04, 0xC4, 0x02, 0x0A, 0x0B, 0x2A, 0x00, 0x0E, 0x73, 0x27,
+    0x00, 0x0B, 0x00, 0x03, 0xC4, 0x07, 0x17, 0x19, 0x27, 0x73, 0x44, 0x72, 0xEF, 0x00, 0x0D, 0x73,
+    0x44, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x73, 0x18, 0x00, 0x39, 0x00, 0x0D, 0x73, 0x51, 0x43, 0x07,
+    0x21, 0x22, 0x73, 0x5E, 0x73, 0x5E, 0x73, 0x5E, 0x45, 0x07, 0x19, 0x21, 0x22, 0x27, 0x73, 0x68,
+    0x73, 0x68, 0x73, 0x68, 0x73, 0x68, 0x73, 0x68, 0x46, 0x07, 0x19, 0x27, 0x2D, 0x32, 0x33, 0x73,
+    0x78, 0x73, 0x78, 0x29, 0xAE, 0x00, 0x1A, 0x00, 0x10, 0x73, 0x78, 0x57, 0x01, 0x07, 0x19, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x47, 0x48, 0x49, 0x08, 0x39, 0x08, 0x24, 0x08, 0x13, 0x08, 0x03, 0x07, 0xF8, 0x07, 0xBD, 0x41,
+    0xEE, 0x07, 0x9D, 0x07, 0x75, 0x06, 0xD1, 0x06, 0xB4, 0x06, 0x01, 0x04, 0xFF, 0x04, 0x6C, 0x03,
+    0x85, 0x02, 0x55, 0x01, 0xF1, 0x01, 0xD6, 0x00, 0xF9, 0x00, 0x93, 0x00, 0x77, 0x00, 0x3A, 0x00,
+    0x13, 0x44, 0x2D, 0x32, 0x38, 0x49, 0x6F, 0xB9, 0x72, 0xCC, 0x73, 0x16, 0x57, 0xC3, 0x42, 0x25,
+    0x49, 0x4D, 0x5B, 0x73, 0xD1, 0x42, 0x2D, 0x31, 0x73, 0xE4, 0x73, 0xE4, 0x21, 0x25, 0x07, 0x41,
+    0x25, 0x3F, 0x98, 0x42, 0x07, 0x39, 0x73, 0xF3, 0x73, 0xF2, 0x41, 0x19, 0x66, 0x19, 0x42, 0x38,
+    0x48, 0x71, 0xEF, 0x73, 0xC5, 0x43, 0x19, 0x21, 0x25, 0x4D, 0x82, 0x74, 0x04, 0x00, 0x07, 0x42,
+    0x34, 0x47, 0x74, 0x0E, 0x73, 0xC0, 0x21, 0x1A, 0x07, 0x42, 0x15, 0x2A, 0x6F, 0x8F, 0x74, 0x18,
+    0x42, 0x08, 0x19, 0x74, 0x20, 0x74, 0x20, 0xD5, 0x01, 0x02, 0x04, 0x07, 0x08, 0x14, 0x15, 0x17,
+    0x1B, 0x1C, 0x1F, 0x21, 0x22, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x43, 0x5A, 0x9B, 0x00,
+    0x56, 0x00, 0x49, 0x73, 0xCC, 0x56, 0x8D, 0x59, 0xB9, 0x45, 0x2A, 0x68, 0x17, 0x00, 0x3B, 0x00,
+    0x38, 0x74, 0x23, 0x28, 0xBD, 0x74, 0x23, 0x00, 0x34, 0x71, 0x97, 0x00, 0x2D, 0x00, 0x22, 0x66,
+    0x46, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x07, 0xC3, 0x09, 0x34, 0x38, 0x59, 0xF9, 0x74, 0x18, 0x70,
+    0x15, 0xC1, 0x40, 0x18, 0xF4, 0x42, 0x2A, 0x30, 0x73, 0x3D, 0x00, 0x04, 0x41, 0x34, 0x73, 0xC1,
+    0x41, 0x32, 0x14, 0x38, 0xC3, 0x31, 0x38, 0x40, 0x73, 0xC9, 0x74, 0x84, 0x73, 0x78, 0x41, 0x17,
+    0x6F, 0xCC, 0x42, 0x15, 0x1C, 0x70, 0x08, 0x5F, 0x08, 0xC6, 0x15, 0x21, 0x22, 0x30, 0x40, 0x41,
+    0x74, 0x33, 0x72, 0x4D, 0x41, 0x5B, 0x74, 0x99, 0x00, 0x0B, 0x00, 0x07, 0x41, 0x19, 0x43, 0xC4,
+    0xC1, 0x39, 0x74, 0xAF, 0x41, 0x04, 0x64, 0xDA, 0x42, 0x32, 0x38, 0x00, 0x04, 0x4F, 0xDC, 0x41,
+    0x23, 0x6C, 0x9E, 0xC2, 0x15, 0x27, 0x00, 0x04, 0x74, 0x65, 0xC3, 0x27, 0x28, 0x30, 0x62, 0xF9,
+    0x62, 0xAC, 0x74, 0xCA, 0x21, 0x01, 0x0A, 0x44, 0x1A, 0x2D, 0x30, 0x32, 0x74, 0xD7, 0x74, 0x88,
+    0x74, 0xD7, 0x5E, 0x03, 0x41, 0x32, 0x62, 0xC3, 0xA1, 0x01, 0x04, 0x44, 0x08, 0x14, 0x19, 0x22,
+    0x00, 0x03, 0x74, 0xEB, 0x74, 0xEB, 0x74, 0xEB, 0xC2, 0x15, 0x43, 0x5A, 0x08, 0x72, 0xC7, 0x44,
+    0x01, 0x07, 0x19, 0x21, 0x74, 0xFF, 0x74, 0xFF, 0x74, 0xFF, 0x00, 0x07, 0x42, 0x19, 0x49, 0x75,
+    0x0C, 0x74, 0xB7, 0x41, 0x1C, 0x74, 0xB5, 0x21, 0x0A, 0x04, 0x21, 0x37, 0x03, 0xA1, 0x1E, 0x03,
+    0x21, 0x23, 0x03, 0x47, 0x23, 0x25, 0x27, 0x2D, 0x31, 0x32, 0x39, 0x00, 0x17, 0x75, 0x23, 0x74,
+    0xEA, 0x75, 0x19, 0x74, 0xD4, 0x00, 0x03, 0x74, 0xC5, 0x41, 0x31, 0x74, 0xF3, 0x42, 0x01, 0x32,
+    0x75, 0x3D, 0x51, 0x3E, 0x44, 0x01, 0x2D, 0x30, 0x31, 0x75, 0x44, 0x6C, 0xAC, 0x75, 0x44, 0x68,
+    0x78, 0x42, 0x2D, 0x31, 0x75, 0x47, 0x75, 0x47, 0x43, 0x01, 0x31, 0x35, 0x75, 0x58, 0x75, 0x57,
+    0x74, 0xC7, 0x43, 0x07, 0x19, 0x25, 0x2B, 0xE9, 0x00, 0x0A, 0x71, 0x4A, 0x42, 0x23, 0x32, 0x75,
+    0x6C, 0x75, 0x0E, 0x42, 0x1A, 0x27, 0x5D, 0x83, 0x75, 0x3A, 0x44, 0x01, 0x07, 0x19, 0x48, 0x75,
+    0x7A, 0x75, 0x7A, 0x75, 0x7A, 0x75, 0x7A, 0x21, 0x1A, 0x0D, 0x43, 0x1A, 0x21, 0x2D, 0x73, 0x7B,
+    0x73, 0x59, 0x73, 0x7B, 0xD0, 0x01, 0x04, 0x08, 0x0A, 0x14, 0x19, 0x1A, 0x1E, 0x27, 0x2A, 0x2B,
+    0x2D, 0x40, 0x41, 0x42, 0x44, 0x00, 0x71, 0x00, 0x5B, 0x4F, 0x11, 0x4F, 0x11, 0x00, 0x57, 0x59,
+    0x86, 0x00, 0x50, 0x00, 0x43, 0x74, 0x92, 0x4F, 0x11, 0x00, 0x32, 0x00, 0x28, 0x00, 0x21, 0x00,
+    0x0D, 0x00, 0x0A, 0x75, 0x5B, 0xC1, 0x04, 0x75, 0xC5, 0x41, 0x07, 0x38, 0x23, 0x21, 0x36, 0x04,
+    0x21, 0x23, 0x03, 0xA1, 0x15, 0x03, 0xC2, 0x23, 0x2A, 0x3F, 0x9A, 0x75, 0x70, 0x44, 0x07, 0x1A,
+    0x22, 0x2A, 0x00, 0x18, 0x75, 0xDD, 0x00, 0x0A, 0x00, 0x07, 0x41, 0x23, 0x6E, 0xFC, 0x21, 0x15,
+    0x04, 0xC1, 0x32, 0x75, 0xDE, 0x43, 0x31, 0x32, 0x34, 0x75, 0xEB, 0x75, 0xAF, 0x75, 0xBC, 0xC8,
+    0x01, 0x08, 0x0A, 0x14, 0x1A, 0x22, 0x2A, 0x41, 0x00, 0x11, 0x74, 0xF3, 0x75, 0xE6, 0x75, 0xFF,
+    0x00, 0x0E, 0x75, 0xF2, 0x00, 0x0A, 0x45, 0x70, 0x41, 0x14, 0x75, 0xC9, 0x21, 0x41, 0x04, 0x21,
+    0x34, 0x03, 0x41, 0x19, 0x64, 0x58, 0x21, 0x38, 0x04, 0x21, 0x04, 0x03, 0x21, 0x32, 0x03, 0x21,
+    0x14, 0x03, 0x21, 0x19, 0x03, 0x21, 0x32, 0x03, 0x21, 0x15, 0x03, 0x41, 0x34, 0x51, 0x5F, 0x21,
+    0x21, 0x04, 0x21, 0x13, 0x03, 0x42, 0x01, 0x1B, 0x00, 0x03, 0x75, 0x23, 0xC5, 0x15, 0x19, 0x27,
+    0x2A, 0x42, 0x34, 0xFD, 0x00, 0x2D, 0x76, 0x4C, 0x00, 0x14, 0x00, 0x07, 0x41, 0x0F, 0x76, 0x5C,
+    0x42, 0x32, 0x39, 0x76, 0x02, 0x00, 0x04, 0x41, 0x39, 0x65, 0xB3, 0x43, 0x28, 0x34, 0x39, 0x76,
+    0x6B, 0x73, 0x38, 0x73, 0x5D, 0x42, 0x16, 0x39, 0x76, 0x75, 0x76, 0x2F, 0x41, 0x0E, 0x76, 0x7B,
+    0x42, 0x27, 0x34, 0x74, 0x56, 0x00, 0x04, 0x42, 0x1E, 0x39, 0x76, 0x87, 0x75, 0x82, 0x41, 0x1B,
+    0x6B, 0xF7, 0x21, 0x21, 0x04, 0x42, 0x21, 0x31, 0x76, 0x94, 0x00, 0x03, 0x42, 0x01, 0x39, 0x76,
+    0x9C, 0x76, 0x3E, 0x42, 0x21, 0x32, 0x76, 0x4E, 0x76, 0x5D, 0x42, 0x19, 0x1E, 0x75, 0xF5, 0x53,
+    0x33, 0xA1, 0x21, 0x76, 0x21, 0x13, 0x03, 0x43, 0x01, 0x17, 0x25, 0x00, 0x03, 0x52, 0xB8, 0x76,
+    0xB6, 0xCE, 0x01, 0x04, 0x0A, 0x17, 0x1A, 0x1B, 0x1C, 0x20, 0x21, 0x22, 0x28, 0x2A, 0x40, 0x42,
+    0x00, 0x61, 0x00, 0x5A, 0x73, 0xAF, 0x00, 0x56, 0x00, 0x4C, 0x00, 0x41, 0x6E, 0xC6, 0x00, 0x3A,
+    0x59, 0xC0, 0x00, 0x2C, 0x00, 0x25, 0x00, 0x1E, 0x00, 0x17, 0x00, 0x0A, 0xC2, 0x15, 0x28, 0x76,
+    0x83, 0x76, 0xEC, 0x42, 0x01, 0x07, 0x76, 0xF3, 0x00, 0x07, 0xC1, 0x08, 0x76, 0xFA, 0xC3, 0x13,
+    0x22, 0x29, 0x76, 0xFE, 0x76, 0xFE, 0x00, 0x04, 0x41, 0x25, 0x71, 0xDD, 0x52, 0x07, 0x13, 0x21,
+    0x23, 0x25, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x38, 0x39, 0x40, 0x48, 0x77,
+    0x0C, 0x76, 0x46, 0x02, 0x49, 0x02, 0x38, 0x02, 0x35, 0x02, 0x21, 0x02, 0x0D, 0x01, 0x78, 0x01,
+    0x2F, 0x01, 0x0D, 0x77, 0x0C, 0x00, 0xC0, 0x00, 0x4B, 0x00, 0x19, 0x00, 0x0E, 0x61, 0x06, 0x00,
+    0x04, 0x70, 0x1E, 0xC2, 0x0A, 0x21, 0x52, 0x63, 0x5B, 0xC0, 0x47, 0x13, 0x15, 0x17, 0x1B, 0x29,
+    0x32, 0x45, 0x00, 0x07, 0x59, 0x57, 0x77, 0x4A, 0x77, 0x4A, 0x08, 0x64, 0x77, 0x4A, 0x77, 0x4A,
+    0x41, 0x41, 0x40, 0xE8, 0x21, 0x30, 0x04, 0x41, 0x15, 0x40, 0xEF, 0xC3, 0x15, 0x19, 0x41, 0x00,
+    0x07, 0x77, 0x6A, 0x00, 0x04, 0xC1, 0x41, 0x6A, 0x11, 0x41, 0x17, 0x44, 0x5E, 0x21, 0x01, 0x04,
+    0x21, 0x31, 0x03, 0x21, 0x25, 0x03, 0xC3, 0x1E, 0x2A, 0x2B, 0x59, 0x11, 0x77, 0x37, 0x00, 0x03,
+    0x21, 0x14, 0x0A, 0xC1, 0x0A, 0x76, 0x91, 0x21, 0x07, 0x04, 0x21, 0x48, 0x03, 0xC8, 0x01, 0x1A,
+    0x2D, 0x30, 0x31, 0x32, 0x34, 0x36, 0x77, 0x9D, 0x00, 0x32, 0x77, 0x4E, 0x00, 0x28, 0x73, 0x85,
+    0x00, 0x0D, 0x00, 0x03, 0x77, 0x93, 0x43, 0x07, 0x31, 0x32, 0x77, 0xB6, 0x6B, 0xCD, 0x77, 0x67,
+    0xC1, 0x22, 0x57, 0x20, 0xC3, 0x01, 0x15, 0x41, 0x77, 0x5E, 0x73, 0xB6, 0x47, 0xAA, 0xC1, 0x15,
+    0x43, 0xF4, 0xC2, 0x41, 0x42, 0x36, 0x7B, 0x35, 0xE9, 0xC1, 0x48, 0x77, 0x84, 0x41, 0x34, 0x5B,
+    0x74, 0x21, 0x1B, 0x04, 0x21, 0x4C, 0x03, 0x41, 0x1A, 0x77, 0x81, 0x42, 0x22, 0x2B, 0x77, 0xEB,
+    0x77, 0x8D, 0xC9, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x23, 0x40, 0x41, 0x00, 0x32, 0x00, 0x2E,
+    0x00, 0x24, 0x77, 0xF2, 0x00, 0x20, 0x00, 0x19, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x07, 0x42, 0x19,
+    0x1A, 0x78, 0x0E, 0x78, 0x0E, 0x42, 0x2D, 0x32, 0x78, 0x15, 0x78, 0x15, 0x46, 0x19, 0x27, 0x31,
+    0x32, 0x38, 0x49, 0x78, 0x1C, 0x77, 0x61, 0x00, 0x0E, 0x76, 0x0D, 0x6B, 0x9D, 0x00, 0x07, 0x43,
+    0x30, 0x32, 0x48, 0x78, 0x2F, 0x76, 0x20, 0x71, 0x41, 0x41, 0x38, 0x73, 0xAF, 0xC3, 0x17, 0x1B,
+    0x41, 0x00, 0x04, 0x75, 0xAD, 0x47, 0xAE, 0x21, 0x27, 0x0A, 0x42, 0x07, 0x48, 0x78, 0x4A, 0x00,
+    0x03, 0x44, 0x07, 0x14, 0x22, 0x27, 0x78, 0x51, 0x78, 0x51, 0x78, 0x51, 0x78, 0x51, 0x41, 0x01,
+    0x51, 0xDB, 0x21, 0x30, 0x04, 0x21, 0x15, 0x03, 0x42, 0x01, 0x22, 0x00, 0x03, 0x78, 0x68, 0x4A,
+    0x07, 0x23, 0x25, 0x27, 0x2D, 0x31, 0x32, 0x35, 0x38, 0x39, 0x78, 0x6F, 0x00, 0x53, 0x00, 0x40,
+    0x78, 0x20, 0x5F, 0x00, 0x00, 0x25, 0x00, 0x1E, 0x77, 0xF0, 0x00, 0x07, 0x61, 0x9B, 0x41, 0x02,
+    0x70, 0xAC, 0x21, 0x30, 0x04, 0x21, 0x15, 0x03, 0x21, 0x14, 0x03, 0x44, 0x1A, 0x2D, 0x32, 0x34,
+    0x78, 0x9B, 0x78, 0x9B, 0x74, 0x83, 0x00, 0x03, 0x42, 0x2D, 0x33, 0x78, 0xA8, 0x78, 0xA8, 0x44,
+    0x2D, 0x34, 0x38, 0x49, 0x78, 0xA5, 0x77, 0xAA, 0x74, 0x97, 0x00, 0x07, 0x41, 0x32, 0x5F, 0x4D,
+    0x46, 0x23, 0x2D, 0x31, 0x32, 0x38, 0x49, 0x00, 0x11, 0x78, 0xBF, 0x78, 0x87, 0x70, 0x28, 0x6D,
+    0x4C, 0x00, 0x04, 0x42, 0x2D, 0x32, 0x78, 0x18, 0x77, 0xCE, 0x42, 0x14, 0x49, 0x78, 0xDA, 0x78,
+    0xD0, 0x47, 0x21, 0x2D, 0x31, 0x34, 0x36, 0x38, 0x39, 0x78, 0xE1, 0x6D, 0x42, 0x78, 0xA8, 0x00,
+    0x07, 0x78, 0xD7, 0x6F, 0xD8, 0x78, 0xA8, 0x41, 0x1B, 0x49, 0xFA, 0x21, 0x30, 0x04, 0x21, 0x15,
+    0x03, 0x21, 0x21, 0x03, 0x21, 0x48, 0x03, 0x45, 0x1A, 0x25, 0x34, 0x38, 0x39, 0x79, 0x07, 0x75,
+    0x25, 0x74, 0x0E, 0x00, 0x03, 0x79, 0x07, 0x44, 0x01, 0x07, 0x14, 0x49, 0x79, 0x17, 0x79, 0x17,
+    0x79, 0x17, 0x78, 0xDE, 0xC1, 0x2B, 0x5E, 0xB6, 0xC1, 0x19, 0x58, 0x88, 0x44, 0x01, 0x19, 0x1A,
+    0x22, 0x79, 0x2C, 0x00, 0x08, 0x00, 0x04, 0x79, 0x2C, 0x41, 0x1E, 0x76, 0xED, 0x21, 0x30, 0x04,
+    0xA1, 0x15, 0x03, 0x21, 0x14, 0x03, 0x47, 0x07, 0x14, 0x2D, 0x31, 0x32, 0x36, 0x38, 0x79, 0x46,
+    0x79, 0x46, 0x79, 0x3C, 0x00, 0x2F, 0x00, 0x1A, 0x00, 0x03, 0x74, 0xF4, 0x42, 0x2D, 0x48, 0x78,
+    0xA1, 0x79, 0x07, 0x42, 0x31, 0x32, 0x79, 0x59, 0x79, 0x59, 0x41, 0x25, 0x79, 0x0F, 0x41, 0x2B,
+    0x66, 0xA0, 0x21, 0x40, 0x04, 0x22, 0x30, 0x32, 0x0B, 0x03, 0x21, 0x15, 0x05, 0xC2, 0x1A, 0x1E,
+    0x73, 0xCB, 0x4E, 0x12, 0x44, 0x07, 0x21, 0x22, 0x48, 0x79, 0x84, 0x00, 0x07, 0x79, 0x84, 0x77,
+    0x75, 0x48, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x36, 0x38, 0x48, 0x73, 0x07, 0x79, 0x91, 0x79, 0x58,
+    0x75, 0x79, 0x00, 0x17, 0x79, 0x87, 0x00, 0x0D, 0x71, 0x70, 0x41, 0x01, 0x47, 0x75, 0x41, 0x01,
+    0x79, 0x50, 0x43, 0x01, 0x43, 0x44, 0x73, 0x10, 0x00, 0x08, 0x00, 0x04, 0x21, 0x01, 0x0A, 0x21,
+    0x2D, 0x03, 0xA1, 0x2D, 0x03, 0x21, 0x19, 0x03, 0x42, 0x31, 0x32, 0x00, 0x03, 0x79, 0xBE, 0x42,
+    0x34, 0x38, 0x78, 0xCA, 0x71, 0x37, 0x42, 0x07, 0x25, 0x74, 0xAB, 0x00, 0x07, 0x41, 0x30, 0x77,
+    0xAF, 0x21, 0x15, 0x04, 0x43, 0x01, 0x07, 0x1A, 0x00, 0x03, 0x79, 0xE4, 0x79, 0xE4, 0x21, 0x22,
+    0x0A, 0x21, 0x35, 0x03, 0x43, 0x34, 0x47, 0x49, 0x79, 0xEA, 0x75, 0xDC, 0x79, 0xF4, 0x41, 0x22,
+    0x68, 0xC4, 0x21, 0x35, 0x04, 0x42, 0x47, 0x4A, 0x79, 0xFB, 0x76, 0x9A, 0x43, 0x07, 0x14, 0x48,
+    0x7A, 0x0C, 0x7A, 0x0C, 0x79, 0xD3, 0x43, 0x23, 0x34, 0x35, 0x79, 0xB0, 0x00, 0x0A, 0x79, 0xAA,
+    0x49, 0x01, 0x02, 0x04, 0x06, 0x1A, 0x1E, 0x20, 0x25, 0x27, 0x00, 0x2F, 0x00, 0x2C, 0x00, 0x1E,
+    0x79, 0x8F, 0x00, 0x1B, 0x00, 0x0A, 0x79, 0xBA, 0x7A, 0x16, 0x79, 0xE7, 0x44, 0x01, 0x04, 0x07,
+    0x1A, 0x61, 0xA4, 0x7A, 0x32, 0x79, 0xBD, 0x71, 0xA4, 0xC5, 0x01, 0x14, 0x19, 0x23, 0x49, 0x7A,
+    0x49, 0x73, 0x5B, 0x7A, 0x49, 0x6E, 0xB7, 0x7A, 0x49, 0x43, 0x01, 0x07, 0x19, 0x7A, 0x59, 0x7A,
+    0x59, 0x7A, 0x59, 0x45, 0x01, 0x02, 0x1A, 0x1E, 0x2B, 0x00, 0x1A, 0x7A, 0x59, 0x78, 0x54, 0x00,
+    0x0A, 0x31, 0xCA, 0x41, 0x20, 0x79, 0xF4, 0x41, 0x23, 0x60, 0xE7, 0x44, 0x01, 0x04, 0x1A, 0x25,
+    0x7A, 0x35, 0x00, 0x04, 0x7A, 0x7B, 0x7A, 0x7B, 0xD2, 0x01, 0x02, 0x04, 0x15, 0x19, 0x1A, 0x1B,
+    0x1E, 0x21, 0x23, 0x25, 0x27, 0x2B, 0x40, 0x41, 0x42, 0x43, 0x44, 0x02, 0x19, 0x01, 0xED, 0x01,
+    0xC8, 0x60, 0x1A, 0x01, 0xB5, 0x01, 0xA7, 0x01, 0x81, 0x01, 0x42, 0x01, 0x2C, 0x01, 0x25, 0x00,
+    0xF7, 0x00, 0xC0, 0x00, 0xB2, 0x00, 0x68, 0x00, 0x4C, 0x00, 0x25, 0x00, 0x15, 0x00, 0x0D, 0x41,
+    0x32, 0x7A, 0x0A, 0x42, 0x13, 0x31, 0x6A, 0xE9, 0x7A, 0x08, 0xC4, 0x01, 0x15, 0x1A, 0x29, 0x77,
+    0x5F, 0x72, 0xE8, 0x00, 0x0B, 0x00, 0x07, 0xC7, 0x04, 0x09, 0x15, 0x27, 0x2A, 0x40, 0x42, 0x7A,
+    0xBB, 0x53, 0x49, 0x75, 0xAC, 0x78, 0xAD, 0x6B, 0x0A, 0x70, 0x93, 0x24, 0x25, 0x42, 0x01, 0x19,
+    0x7A, 0xED, 0x7A, 0x27, 0x21, 0x09, 0x07, 0x42, 0x11, 0x2B, 0x32, 0x82, 0x7A, 0x91, 0x41, 0x1E,
+    0x7A, 0x6D, 0xCB, 0x02, 0x15, 0x16, 0x17, 0x1A, 0x1C, 0x1E, 0x23, 0x2A, 0x43, 0x44, 0x70, 0x54,
+    0x75, 0x50, 0x3A, 0xB1, 0x7A, 0xF5, 0x79, 0x04, 0x78, 0xF3, 0x7A, 0xAA, 0x75, 0x50, 0x60, 0x94,
+    0x78, 0xD1, 0x00, 0x04, 0x42, 0x23, 0x34, 0x77, 0xB9, 0x7B, 0x24, 0xC2, 0x15, 0x2B, 0x00, 0x07,
+    0x77, 0xB5, 0x42, 0x25, 0x32, 0x7B, 0x25, 0x7A, 0xEC, 0x42, 0x32, 0x33, 0x7B, 0x2F, 0x7B, 0x39,
+    0x41, 0x01, 0x73, 0x99, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x42, 0x07, 0x37, 0x7B, 0x4A, 0x7B,
+    0x11, 0x41, 0x22, 0x6B, 0xAD, 0x42, 0x25, 0x2D, 0x79, 0xCD, 0x7B, 0x54, 0x42, 0x17, 0x1B, 0x7B,
+    0x23, 0x7B, 0x16, 0xCD, 0x01, 0x14, 0x15, 0x19, 0x1B, 0x1C, 0x1E, 0x22, 0x25, 0x2D, 0x40, 0x41,
+    0x44, 0x00, 0x31, 0x7A, 0x9D, 0x48, 0xC9, 0x00, 0x2A, 0x00, 0x1C, 0x45, 0x27, 0x61, 0xD7, 0x00,
+    0x19, 0x59, 0xEA, 0x00, 0x12, 0x00, 0x0E, 0x00, 0x07, 0x67, 0xFB, 0x41, 0x34, 0x66, 0x46, 0x41,
+    0x15, 0x7A, 0xFE, 0xC4, 0x09, 0x2D, 0x41, 0x43, 0x54, 0x05, 0x00, 0x08, 0x00, 0x04, 0x79, 0x62,
+    0x41, 0x2E, 0x5D, 0xAD, 0x41, 0x1C, 0x7B, 0xA4, 0x22, 0x40, 0x42, 0x08, 0x04, 0x22, 0x07, 0x27,
+    0x1A, 0x05, 0x41, 0x15, 0x7B, 0x79, 0x21, 0x41, 0x04, 0x21, 0x01, 0x03, 0x4E, 0x01, 0x07, 0x08,
+    0x13, 0x14, 0x15, 0x16, 0x19, 0x1A, 0x27, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0xF2, 0x00, 0xE5, 0x00,
+    0xC8, 0x00, 0xC5, 0x00, 0xBA, 0x7A, 0xB7, 0x69, 0x54, 0x00, 0x91, 0x7B, 0xBC, 0x00, 0x59, 0x7B,
+    0xB2, 0x00, 0x0F, 0x00, 0x03, 0x7A, 0xB7, 0x44, 0x21, 0x31, 0x34, 0x49, 0x7B, 0xE7, 0x77, 0xCF,
+    0x76, 0xEE, 0x7B, 0x81, 0xC8, 0x15, 0x1A, 0x1F, 0x25, 0x27, 0x2A, 0x38, 0x43, 0x7B, 0xBB, 0x7B,
+    0xF4, 0x77, 0x32, 0x00, 0x0D, 0x7B, 0xE7, 0x61, 0x86, 0x76, 0xFB, 0x77, 0xDC, 0x44, 0x27, 0x2D,
+    0x32, 0x48, 0x7C, 0x00, 0x7C, 0x0D, 0x7B, 0x08, 0x79, 0xE3, 0x43, 0x21, 0x25, 0x49, 0x7C, 0x1A,
+    0x7B, 0x54, 0x7C, 0x0D, 0x42, 0x31, 0x49, 0x77, 0x9A, 0x7C, 0x17, 0x43, 0x31, 0x35, 0x38, 0x77,
+    0x32, 0x7B, 0x9A, 0x70, 0xB7, 0x42, 0x27, 0x31, 0x7B, 0xE6, 0x79, 0x02, 0xC3, 0x2B, 0x35, 0x49,
+    0x7C, 0x3B, 0x7C, 0x3C, 0x75, 0x4E, 0x42, 0x31, 0x34, 0x78, 0x2E, 0x7B, 0xC1, 0xC2, 0x17, 0x2D,
+    0x00, 0x07, 0x7B, 0xFE, 0x43, 0x25, 0x35, 0x39, 0x7B, 0xEE, 0x7C, 0x54, 0x7C, 0x54, 0x42, 0x31,
+    0x32, 0x77, 0xD4, 0x7C, 0x0F, 0x42, 0x30, 0x48, 0x6A, 0x9B, 0x7B, 0xFF, 0x42, 0x23, 0x2D, 0x00,
+    0x07, 0x7C, 0x62, 0x41, 0x41, 0x7C, 0x3A, 0xC5, 0x17, 0x1E, 0x30, 0x34, 0x43, 0x7B, 0xB1, 0x79,
+    0x7E, 0x00, 0x04, 0x7C, 0x3E, 0x7A, 0x46, 0x42, 0x32, 0x38, 0x7C, 0x4E, 0x7B, 0xCC, 0x42, 0x04,
+    0x2B, 0x7A, 0x7F, 0x7C, 0x84, 0xC9, 0x02, 0x0B, 0x15, 0x1D, 0x23, 0x25, 0x2B, 0x42, 0x43, 0x00,
+    0x0E, 0x7C, 0x91, 0x7B, 0x8C, 0x78, 0x87, 0x63, 0xE1, 0x4C, 0xF4, 0x7A, 0x05, 0x00, 0x07, 0x7A,
+    0x64, 0x43, 0x07, 0x27, 0x44, 0x7C, 0xB1, 0x7C, 0x4B, 0x79, 0xA3, 0x44, 0x32, 0x34, 0x49, 0x4C,
+    0x00, 0x0A, 0x67, 0x76, 0x7A, 0x91, 0x7A, 0xBD, 0x42, 0x25, 0x40, 0x7C, 0x6D, 0x03, 0x5A, 0x21,
+    0x32, 0x07, 0x21, 0x15, 0x03, 0xC2, 0x01, 0x0A, 0x7C, 0xD5, 0x7C, 0xD5, 0xC6, 0x1B, 0x21, 0x2D,
+    0x32, 0x35, 0x38, 0x7C, 0x24, 0x7C, 0xDC, 0x2D, 0x9D, 0x71, 0xE8, 0x00, 0x0A, 0x00, 0x07, 0x42,
+    0x32, 0x39, 0x7C, 0xEF, 0x7C, 0xEF, 0x43, 0x19, 0x22, 0x27, 0x00, 0x07, 0x7C, 0x30, 0x7C, 0x9B,
+    0x43, 0x27, 0x37, 0x48, 0x7D, 0x00, 0x72, 0xC0, 0x7D, 0x00, 0x21, 0x25, 0x0A, 0x46, 0x02, 0x15,
+    0x23, 0x2A, 0x2B, 0x2D, 0x7D, 0x0D, 0x65, 0x1D, 0x7A, 0xC1, 0x7A, 0xC1, 0x00, 0x03, 0x7D, 0x0C,
+    0x42, 0x02, 0x14, 0x65, 0x30, 0x7D, 0x16, 0x43, 0x01, 0x15, 0x1B, 0x78, 0x2E, 0x7D, 0x27, 0x78,
+    0x9D, 0xDC, 0x01, 0x02, 0x04, 0x07, 0x0A, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1D, 0x1E,
+    0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x40, 0x41, 0x42, 0x44, 0x01, 0x3D,
+    0x01, 0x24, 0x01, 0x17, 0x3F, 0x26, 0x01, 0x0D, 0x7D, 0x31, 0x01, 0x06, 0x5A, 0xC1, 0x00, 0xFC,
+    0x00, 0xF5, 0x00, 0xE4, 0x00, 0xDD, 0x00, 0xD3, 0x00, 0xC5, 0x00, 0xBA, 0x00, 0x9C, 0x00, 0x76,
+    0x00, 0x55, 0x7D, 0x31, 0x6A, 0x94, 0x00, 0x3B, 0x7D, 0x31, 0x72, 0x41, 0x5F, 0xBD, 0x00, 0x24,
+    0x00, 0x11, 0x00, 0x0A, 0x7A, 0xDB, 0x41, 0x1A, 0x63, 0x02, 0x21, 0x23, 0x04, 0x21, 0x04, 0x03,
+    0xA1, 0x19, 0x03, 0x21, 0x08, 0x03, 0x44, 0x27, 0x31, 0x32, 0x38, 0x00, 0x03, 0x79, 0x7E, 0x7D,
+    0x96, 0x7D, 0x96, 0xC1, 0x43, 0x3B, 0xBA, 0x21, 0x01, 0x04, 0x42, 0x31, 0x34, 0x00, 0x03, 0x7D,
+    0xAA, 0x42, 0x30, 0x31, 0x7D, 0xB1, 0x79, 0x99, 0x22, 0x19, 0x23, 0x0E, 0x07, 0x42, 0x19, 0x2A,
+    0x63, 0x4F, 0x7D, 0x57, 0xC1, 0x41, 0x7D, 0xC4, 0x41, 0x31, 0x78, 0xCF, 0x21, 0x15, 0x04, 0x21,
+    0x48, 0x03, 0x21, 0x35, 0x03, 0xA1, 0x17, 0x03, 0x21, 0x07, 0x03, 0x21, 0x48, 0x03, 0x21, 0x19,
+    0x03, 0x43, 0x1A, 0x22, 0x2B, 0x7D, 0xE1, 0x00, 0x1D, 0x00, 0x03, 0xC9, 0x15, 0x19, 0x1A, 0x23,
+    0x25, 0x2A, 0x2B, 0x40, 0x41, 0x7D, 0x85, 0x7D, 0x90, 0x7D, 0x8D, 0x00, 0x55, 0x51, 0x9D, 0x75,
+    0xC6, 0x00, 0x33, 0x00, 0x2E, 0x00, 0x0A, 0x42, 0x23, 0x25, 0x7B, 0xE4, 0x7B, 0xE4, 0x21, 0x2B,
+    0x07, 0xA1, 0x32, 0x03, 0xC1, 0x2A, 0x7E, 0x14, 0x44, 0x25, 0x31, 0x32, 0x48, 0x7E, 0x17, 0x7D,
+    0x13, 0x21, 0xE1, 0x7D, 0xC3, 0xCB, 0x02, 0x15, 0x1A, 0x1B, 0x1E, 0x21, 0x25, 0x2A, 0x43, 0x44,
+    0x46, 0x7D, 0xD3, 0x00, 0x0D, 0x5C, 0xC4, 0x7E, 0x21, 0x7D, 0x23, 0x7B, 0xD9, 0x72, 0x59, 0x7D,
+    0xD3, 0x7B, 0xF4, 0x68, 0xAF, 0x7E, 0x25, 0x41, 0x34, 0x6B, 0xD0, 0x43, 0x15, 0x16, 0x23, 0x00,
+    0x04, 0x7E, 0x4B, 0x7D, 0x3F, 0xC1, 0x16, 0x7A, 0xEA, 0x21, 0x32, 0x04, 0x42, 0x2D, 0x34, 0x7D,
+    0x69, 0x7E, 0x5C, 0x41, 0x19, 0x7D, 0xF4, 0x21, 0x40, 0x04, 0x21, 0x23, 0x03, 0x21, 0x40, 0x03,
+    0x43, 0x31, 0x32, 0x4C, 0x0E, 0xB9, 0x7C, 0xF8, 0x00, 0x03, 0xC2, 0x01, 0x2D, 0x7E, 0x7A, 0x6B,
+    0x5C, 0x41, 0x19, 0x5E, 0x47, 0xC2, 0x32, 0x40, 0x00, 0x04, 0x44, 0xD6, 0xC1, 0x2B, 0x7E, 0x73,
+    0x21, 0x07, 0x04, 0xD2, 0x01, 0x07, 0x09, 0x13, 0x14, 0x15, 0x16, 0x19, 0x1B, 0x21, 0x23, 0x25,
+    0x27, 0x40, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x82, 0x00, 0x7F, 0x64, 0x25, 0x7E, 0x93, 0x00, 0x6E,
+    0x00, 0x48, 0x7D, 0xCD, 0x5D, 0xD8, 0x00, 0x3A, 0x00, 0x37, 0x00, 0x23, 0x00, 0x19, 0x00, 0x0E,
+    0x00, 0x30, 0x00, 0x03, 0x63, 0x21, 0x7E, 0x92, 0x7E, 0x89, 0x42, 0x32, 0x34, 0x7E, 0xC9, 0x7E,
+    0x91, 0x42, 0x19, 0x25, 0x66, 0x1D, 0x7C, 0x54, 0x43, 0x27, 0x2D, 0x39, 0x75, 0x8A, 0x7E, 0xD8,
+    0x7E, 0x47, 0x41, 0x4B, 0x7D, 0xDD, 0x44, 0x23, 0x31, 0x37, 0x48, 0x73, 0x13, 0x00, 0x04, 0x77,
+    0xAD, 0x7E, 0xD9, 0x42, 0x01, 0x49, 0x7E, 0xF3, 0x78, 0x05, 0xC6, 0x01, 0x04, 0x08, 0x19, 0x1C,
+    0x41, 0x7E, 0x94, 0x48, 0xBE, 0x00, 0x07, 0x7E, 0xF9, 0x7E, 0x34, 0x59, 0x01, 0x42, 0x35, 0x36,
+    0x7F, 0x0D, 0x7A, 0x14, 0x43, 0x16, 0x30, 0x31, 0x7B, 0xA9, 0x7F, 0x14, 0x7A, 0x1B, 0x41, 0x19,
+    0x1A, 0x81, 0x42, 0x19, 0x48, 0x7A, 0x60, 0x7F, 0x15, 0x42, 0x21, 0x49, 0x7E, 0xD4, 0x7E, 0xF0,
+    0x21, 0x2A, 0x07, 0x43, 0x15, 0x1B, 0x1C, 0x7B, 0xC8, 0x48, 0xBB, 0x7E, 0xA2, 0x41, 0x1A, 0x7E,
+    0xBE, 0xA1, 0x43, 0x04, 0xD7, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1C,
+    0x21, 0x23, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x48, 0x4B, 0x00, 0x7A, 0x00, 0x73,
+    0x00, 0x6C, 0x7F, 0x40, 0x7B, 0x62, 0x00, 0x5E, 0x7E, 0x38, 0x00, 0x4A, 0x7F, 0x44, 0x61, 0x59,
+    0x00, 0x37, 0x7E, 0x38, 0x00, 0x30, 0x7F, 0x3A, 0x00, 0x26, 0x00, 0x22, 0x73, 0x71, 0x00, 0x14,
+    0x00, 0x11, 0x3D, 0x5B, 0x7C, 0xEE, 0x00, 0x03, 0x7F, 0x44, 0x41, 0x30, 0x45, 0x40, 0x41, 0x16,
+    0x7E, 0x89, 0xC3, 0x23, 0x41, 0x46, 0x00, 0x08, 0x00, 0x04, 0x7F, 0x92, 0x41, 0x31, 0x64, 0x2A,
+    0x41, 0x23, 0x75, 0xEF, 0x21, 0x04, 0x04, 0xA2, 0x15, 0x40, 0x0B, 0x03, 0x41, 0x4B, 0x7F, 0x57,
+    0x21, 0x37, 0x04, 0x21, 0x15, 0x03, 0x41, 0x31, 0x29, 0x65, 0xA1, 0x15, 0x04, 0x42, 0x01, 0x07,
+    0x00, 0x03, 0x7F, 0xBD, 0x42, 0x01, 0x14, 0x7F, 0xC4, 0x00, 0x11, 0xC6, 0x01, 0x07, 0x14, 0x15,
+    0x49, 0x4A, 0x00, 0x39, 0x00, 0x24, 0x00, 0x18, 0x7D, 0xA8, 0x00, 0x0E, 0x00, 0x07, 0xC1, 0x2E,
+    0x74, 0x0B, 0x46, 0x14, 0x2D, 0x48, 0x49, 0x4A, 0x4B, 0x7F, 0xE2, 0x00, 0x04, 0x7F, 0xA9, 0x1E,
+    0xEF, 0x7F, 0x8D, 0x7F, 0x8D, 0x41, 0x2E, 0x7F, 0xF5, 0xA1, 0x44, 0x04, 0x41, 0x07, 0x7E, 0xFA,
+    0x21, 0x2B, 0x04, 0xA1, 0x32, 0x03, 0x41, 0x1B, 0x74, 0xB4, 0x21, 0x38, 0x04, 0x21, 0x15, 0x03,
+    0x21, 0x14, 0x03, 0x21, 0x31, 0x03, 0x43, 0x01, 0x15, 0x1E, 0x7F, 0xB0, 0x7D, 0xF3, 0x80, 0x16,
+    0x43, 0x01, 0x04, 0x07, 0x7F, 0x5A, 0x80, 0x20, 0x6D, 0x36, 0xC2, 0x01, 0x04, 0x7E, 0xF2, 0x7E,
+    0x1B, 0x42, 0x2A, 0x32, 0x6B, 0x6B, 0x00, 0x07, 0x41, 0x2B, 0x4E, 0x27, 0x21, 0x40, 0x04, 0x21,
+    0x38, 0x03, 0x21, 0x15, 0x03, 0x21, 0x14, 0x03, 0x21, 0x31, 0x03, 0x21, 0x23, 0x03, 0x43, 0x19,
+    0x21, 0x22, 0x80, 0x4E, 0x80, 0x4E, 0x5A, 0xBA, 0xC2, 0x01, 0x15, 0x7D, 0xC8, 0x79, 0x0C, 0x41,
+    0x49, 0x7C, 0x47, 0x21, 0x31, 0x04, 0xA1, 0x15, 0x03, 0x41, 0x38, 0x77, 0x60, 0xA1, 0x19, 0x04,
+    0x44, 0x07, 0x1A, 0x21, 0x22, 0x00, 0x18, 0x00, 0x0A, 0x01, 0xE4, 0x00, 0x03, 0x42, 0x48, 0x4B,
+    0x80, 0x44, 0x7F, 0xC2, 0x42, 0x32, 0x38, 0x80, 0x84, 0x00, 0x07, 0xC2, 0x15, 0x41, 0x00, 0x07,
+    0x80, 0x8A, 0xC1, 0x15, 0x35, 0x44, 0xC5, 0x01, 0x14, 0x15, 0x1A, 0x22, 0x00, 0x0B, 0x00, 0x04,
+    0x2A, 0x16, 0x00, 0x90, 0x80, 0x96, 0x41, 0x38, 0x69, 0x2D, 0x21, 0x15, 0x04, 0x43, 0x19, 0x21,
+    0x22, 0x80, 0xAD, 0x80, 0xAD, 0x00, 0x03, 0xCE, 0x01, 0x07, 0x15, 0x19, 0x1A, 0x1B, 0x21, 0x23,
+    0x25, 0x2B, 0x48, 0x49, 0x4A, 0x4B, 0x57, 0x36, 0x00, 0xBE, 0x7E, 0x94, 0x00, 0xB4, 0x5B, 0x23,
+    0x00, 0xA4, 0x00, 0xA1, 0x00, 0x97, 0x00, 0x86, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x47, 0x00, 0x21,
+    0x00, 0x0A, 0xC1, 0x07, 0x7B, 0x30, 0x41, 0x0B, 0x62, 0xF3, 0x42, 0x2A, 0x40, 0x80, 0xEA, 0x00,
+    0x04, 0x21, 0x34, 0x07, 0xC1, 0x15, 0x77, 0xA6, 0x41, 0x15, 0x80, 0xDF, 0x21, 0x21, 0x04, 0x21,
+    0x42, 0x03, 0x21, 0x32, 0x03, 0xC1, 0x15, 0x7F, 0xFC, 0x41, 0x21, 0x7E, 0xDF, 0x21, 0x2B, 0x04,
+    0x21, 0x14, 0x03, 0xA1, 0x08, 0x03, 0xCA, 0x01, 0x02, 0x14, 0x19, 0x1A, 0x21, 0x2B, 0x2D, 0x48,
+    0x49, 0x81, 0x16, 0x7C, 0x54, 0x00, 0x34, 0x00, 0x25, 0x81, 0x16, 0x00, 0x22, 0x7F, 0x9E, 0x00,
+    0x14, 0x00, 0x11, 0x00, 0x03, 0x41, 0x38, 0x7F, 0x37, 0x43, 0x19, 0x2B, 0x2C, 0x00, 0x04, 0x80,
+    0xF3, 0x80, 0x01, 0x21, 0x21, 0x0A, 0xC1, 0x41, 0x79, 0xDC, 0x42, 0x32, 0x35, 0x25, 0x13, 0x81,
+    0x4A, 0xC8, 0x01, 0x07, 0x15, 0x21, 0x22, 0x27, 0x2A, 0x44, 0x81, 0x0B, 0x00, 0x0B, 0x00, 0x07,
+    0x81, 0x51, 0x81, 0x51, 0x7E, 0xC1, 0x4B, 0x15, 0x46, 0xE1, 0xC2, 0x14, 0x46, 0x65, 0x58, 0x81,
+    0x6A, 0x42, 0x07, 0x19, 0x00, 0x07, 0x81, 0x71, 0x42, 0x19, 0x49, 0x81, 0x78, 0x7D, 0x6A, 0xC3,
+    0x0A, 0x15, 0x43, 0x7C, 0xBD, 0x00, 0x07, 0x7F, 0x4E, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x81, 0x50,
+    0x00, 0x38, 0x00, 0x18, 0x00, 0x0A, 0x42, 0x2D, 0x34, 0x81, 0x96, 0x81, 0x47, 0x41, 0x1A, 0x73,
+    0xBC, 0x42, 0x2D, 0x32, 0x81, 0xA1, 0x81, 0x43, 0x42, 0x32, 0x38, 0x81, 0x9E, 0x81, 0x6F, 0x41,
+    0x02, 0x78, 0x61, 0x42, 0x30, 0x37, 0x00, 0x04, 0x81, 0x5E, 0x42, 0x17, 0x1A, 0x81, 0x81, 0x7D,
+    0xA2, 0x42, 0x17, 0x21, 0x81, 0x7B, 0x81, 0x42, 0xCC, 0x01, 0x04, 0x09, 0x15, 0x17, 0x19, 0x1A,
+    0x21, 0x2A, 0x2B, 0x41, 0x44, 0x81, 0x6A, 0x00, 0x32, 0x00, 0x2B, 0x00, 0x27, 0x00, 0x20, 0x61,
+    0x28, 0x7F, 0xCA, 0x00, 0x15, 0x81, 0x8F, 0x81, 0x8F, 0x00, 0x0E, 0x00, 0x07, 0x42, 0x38, 0x49,
+    0x81, 0xEC, 0x7F, 0xDE, 0xC3, 0x02, 0x22, 0x2A, 0x7F, 0x64, 0x7B, 0x06, 0x00, 0x07, 0xC1, 0x40,
+    0x7A, 0x70, 0x21, 0x21, 0x04, 0x41, 0x30, 0x66, 0xD6, 0x21, 0x23, 0x04, 0xC5, 0x01, 0x15, 0x2B,
+    0x40, 0x43, 0x80, 0xD4, 0x81, 0xA6, 0x81, 0xA6, 0x7E, 0xFE, 0x7F, 0xDB, 0xC1, 0x23, 0x74, 0x3B,
+    0x41, 0x27, 0x7C, 0xF5, 0x42, 0x34, 0x35, 0x7D, 0x9A, 0x00, 0x04, 0xA1, 0x15, 0x07, 0x41, 0x44,
+    0x81, 0x73, 0x41, 0x2B, 0x71, 0xD7, 0x21, 0x19, 0x04, 0x21, 0x49, 0x03, 0x22, 0x33, 0x34, 0x0E,
+    0x03, 0xC7, 0x01, 0x07, 0x19, 0x22, 0x25, 0x2B, 0x40, 0x00, 0x38, 0x00, 0x35, 0x00, 0x25, 0x00,
+    0x16, 0x00, 0x05, 0x67, 0xD3, 0x57, 0x15, 0xC1, 0x17, 0x81, 0xFC, 0x42, 0x19, 0x22, 0x00, 0x04,
+    0x82, 0x5B, 0x42, 0x1B, 0x1C, 0x56, 0xF7, 0x82, 0x55, 0x26, 0x19, 0x21, 0x27, 0x2D, 0x32, 0x33,
+    0xA1, 0x75, 0x67, 0x28, 0x0E, 0x07, 0xC1, 0x15, 0x71, 0x60, 0x21, 0x01, 0x04, 0x42, 0x01, 0x2D,
+    0x64, 0x57, 0x00, 0x03, 0x41, 0x15, 0x7D, 0x1B, 0xA1, 0x41, 0x04, 0x21, 0x21, 0x03, 0x42, 0x07,
+    0x2D, 0x82, 0x8E, 0x00, 0x03, 0x5F, 0x1F, 0x01, 0x07, 0x08, 0x14, 0x15, 0x16, 0x19, 0x1A, 0x1B,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x0E, 0x6E, 0x0E, 0x2E, 0x0E, 0x20, 0x82, 0x95, 0x0E, 0x19,
+    0x0E, 0x15, 0x0E, 0x11, 0x0D, 0xFC, 0x0D, 0xE9, 0x0D, 0xE5, 0x0D, 0xDD, 0x0B, 0x89, 0x0B, 0x4B,
+    0x0A, 0xF8, 0x0A, 0xDF, 0x0A, 0xA3, 0x08, 0x0D, 0x06, 0xD9, 0x05, 0x64, 0x04, 0xAA, 0x04, 0x02,
+    0x03, 0x51, 0x02, 0xCA, 0x02, 0xB3, 0x01, 0xDE, 0x01, 0x7F, 0x01, 0x52, 0x01, 0x0C, 0x00, 0x2C,
+    0x00, 0x18, 0x00, 0x07, 0x41, 0x02, 0x16, 0xF5, 0xC2, 0x25, 0x40, 0x82, 0xF8, 0x00, 0x04, 0x42,
+    0x31, 0x32, 0x82, 0xC6, 0x82, 0xB0, 0xC1, 0x16, 0x7E, 0xF8, 0xC1, 0x21, 0x66, 0x09, 0x21, 0x21,
+    0x04, 0x41, 0x19, 0x82, 0x12, 0xC2, 0x16, 0x43, 0x00, 0x04, 0x80, 0xE4, 0x42, 0x14, 0x19, 0x00,
+    0x07, 0x83, 0x1C, 0xC1, 0x17, 0x4E, 0xCC, 0x45, 0x19, 0x2D, 0x31, 0x33, 0x34, 0x83, 0x27, 0x00,
+    0x19, 0x00, 0x0B, 0x00, 0x04, 0x81, 0x18, 0x42, 0x07, 0x16, 0x68, 0xC9, 0x83, 0x37, 0xC7, 0x16,
+    0x17, 0x1B, 0x2D, 0x36, 0x40, 0x44, 0x50, 0xA4, 0x82, 0x32, 0x82, 0xEC, 0x83, 0x3E, 0x56, 0xE9,
+    0x00, 0x07, 0x83, 0x2B, 0xC3, 0x01, 0x07, 0x22, 0x83, 0x54, 0x83, 0x54, 0x83, 0x54, 0xC2, 0x15,
+    0x43, 0x82, 0x55, 0x81, 0x2D, 0x41, 0x25, 0x7C, 0x77, 0x21, 0x16, 0x04, 0x41, 0x07, 0x82, 0x44,
+    0xCB, 0x01, 0x19, 0x21, 0x2D, 0x31, 0x32, 0x33, 0x35, 0x36, 0x38, 0x48, 0x83, 0x70, 0x83, 0x70,
+    0x83, 0x70, 0x83, 0x6F, 0x83, 0x37, 0x00, 0x1C, 0x00, 0x12, 0x00, 0x07, 0x00, 0x04, 0x7C, 0xE6,
+    0x81, 0x61, 0xC1, 0x28, 0x5F, 0x25, 0x21, 0x4C, 0x04, 0xA1, 0x22, 0x03, 0x42, 0x14, 0x25, 0x83,
+    0x9C, 0x00, 0x03, 0x41, 0x22, 0x82, 0xF1, 0x42, 0x19, 0x25, 0x83, 0xA7, 0x4D, 0x18, 0x23, 0x31,
+    0x32, 0x34, 0x12, 0x0B, 0x07, 0x42, 0x2B, 0x39, 0x41, 0xD0, 0x83, 0xA2, 0xC4, 0x16, 0x23, 0x2A,
+    0x44, 0x7E, 0x0A, 0x00, 0x07, 0x82, 0xF6, 0x08, 0xBE, 0x41, 0x34, 0x5F, 0xCA, 0xC4, 0x17, 0x1E,
+    0x22, 0x2A, 0x53, 0x0C, 0x00, 0x04, 0x7B, 0xEB, 0x5B, 0x94, 0x41, 0x16, 0x7F, 0xC2, 0xA1, 0x41,
+    0x04, 0x42, 0x30, 0x32, 0x83, 0xE1, 0x83, 0xE0, 0x42, 0x14, 0x31, 0x83, 0xE8, 0x80, 0xB5, 0xC3,
+    0x09, 0x16, 0x17, 0x00, 0x0E, 0x83, 0xA0, 0x00, 0x07, 0x46, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x22,
+    0x83, 0xF9, 0x83, 0xF9, 0x00, 0x3D, 0x00, 0x2C, 0x00, 0x1B, 0x00, 0x0A, 0x42, 0x1A, 0x48, 0x84,
+    0x0C, 0x83, 0xD3, 0x21, 0x31, 0x07, 0x41, 0x01, 0x83, 0xDD, 0xC4, 0x01, 0x16, 0x40, 0x42, 0x83,
+    0xC8, 0x00, 0x07, 0x5A, 0x42, 0x00, 0x04, 0x41, 0x31, 0x7E, 0xD1, 0x21, 0x08, 0x04, 0x21, 0x33,
+    0x03, 0xA1, 0x0B, 0x03, 0x41, 0x11, 0x5E, 0xF8, 0x42, 0x16, 0x20, 0x84, 0x1C, 0x84, 0x1C, 0x41,
+    0x22, 0x68, 0x31, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03, 0xC7, 0x02, 0x07, 0x14, 0x19, 0x1D, 0x1E,
+    0x40, 0x84, 0x49, 0x7A, 0x09, 0x7D, 0x5B, 0x83, 0xE3, 0x00, 0x03, 0x84, 0x30, 0x48, 0x9D, 0x43,
+    0x07, 0x19, 0x27, 0x84, 0x5F, 0x5E, 0xCB, 0x00, 0x16, 0x4A, 0x01, 0x07, 0x13, 0x14, 0x17, 0x19,
+    0x1A, 0x21, 0x27, 0x48, 0x84, 0x69, 0x00, 0x38, 0x00, 0x35, 0x84, 0x69, 0x39, 0x85, 0x84, 0x69,
+    0x84, 0x69, 0x00, 0x31, 0x84, 0x69, 0x00, 0x0A, 0xC1, 0x16, 0x84, 0x7B, 0x41, 0x16, 0x83, 0xFB,
+    0xC3, 0x15, 0x30, 0x44, 0x80, 0xAE, 0x84, 0x90, 0x00, 0x04, 0x41, 0x31, 0x67, 0xE2, 0x21, 0x27,
+    0x04, 0x41, 0x16, 0x81, 0xBD, 0x21, 0x15, 0x04, 0x21, 0x31, 0x03, 0xA2, 0x18, 0x27, 0x0D, 0x03,
+    0x21, 0x23, 0x05, 0x41, 0x16, 0x82, 0xA4, 0xC8, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x27, 0x42,
+    0x00, 0x2F, 0x84, 0xB7, 0x84, 0xB7, 0x84, 0xB7, 0x84, 0xB7, 0x00, 0x27, 0x00, 0x07, 0x00, 0x04,
+    0xC1, 0x10, 0x84, 0x75, 0x21, 0x19, 0x04, 0x42, 0x23, 0x48, 0x84, 0xD7, 0x00, 0x03, 0xC4, 0x09,
+    0x15, 0x17, 0x23, 0x84, 0x8C, 0x83, 0xD5, 0x84, 0xD1, 0x81, 0xC6, 0x41, 0x49, 0x79, 0x18, 0xC2,
+    0x16, 0x22, 0x00, 0x04, 0x7F, 0xA9, 0x43, 0x19, 0x1A, 0x48, 0x84, 0xF6, 0x00, 0x18, 0x00, 0x07,
+    0xC7, 0x01, 0x06, 0x17, 0x1C, 0x27, 0x41, 0x43, 0x83, 0xFE, 0x81, 0xEE, 0x84, 0x01, 0x80, 0x3E,
+    0x82, 0x70, 0x82, 0xAA, 0x82, 0xCF, 0x42, 0x01, 0x07, 0x85, 0x16, 0x00, 0x16, 0x41, 0x27, 0x68,
+    0x65, 0xCC, 0x14, 0x15, 0x1A, 0x1B, 0x1C, 0x1E, 0x22, 0x27, 0x28, 0x2A, 0x2B, 0x43, 0x84, 0x5B,
+    0x84, 0x18, 0x00, 0x04, 0x80, 0x63, 0x75, 0x54, 0x84, 0xC3, 0x84, 0x9C, 0x82, 0x91, 0x3A, 0x76,
+    0x84, 0xBB, 0x85, 0x14, 0x82, 0xF0, 0x21, 0x2D, 0x25, 0xC2, 0x21, 0x40, 0x82, 0xFD, 0x10, 0xBB,
+    0x44, 0x07, 0x19, 0x22, 0x25, 0x00, 0x07, 0x85, 0x50, 0x85, 0x50, 0x85, 0x50, 0x42, 0x2D, 0x39,
+    0x85, 0x5D, 0x84, 0xCC, 0xC6, 0x01, 0x02, 0x04, 0x15, 0x1B, 0x43, 0x84, 0x62, 0x84, 0xFE, 0x00,
+    0x07, 0x84, 0xFE, 0x85, 0x60, 0x83, 0x33, 0xC4, 0x01, 0x1B, 0x25, 0x44, 0x00, 0x13, 0x85, 0x77,
+    0x85, 0x77, 0x82, 0x5F, 0x41, 0x17, 0x85, 0x05, 0xA1, 0x41, 0x04, 0xC3, 0x07, 0x21, 0x22, 0x00,
+    0x03, 0x85, 0x8B, 0x85, 0x8B, 0x41, 0x04, 0x2F, 0x44, 0xC2, 0x2B, 0x42, 0x6B, 0x2B, 0x00, 0x04,
+    0xC3, 0x17, 0x22, 0x40, 0x79, 0x90, 0x85, 0x3A, 0x83, 0xA2, 0x44, 0x07, 0x19, 0x22, 0x27, 0x84,
+    0x82, 0x00, 0x11, 0x00, 0x0A, 0x85, 0xAA, 0x44, 0x21, 0x27, 0x2D, 0x32, 0x85, 0xB7, 0x85, 0xAD,
+    0x00, 0x2C, 0x00, 0x0D, 0x41, 0x16, 0x4F, 0x4C, 0xC2, 0x04, 0x41, 0x7E, 0xDA, 0x00, 0x04, 0xC3,
+    0x07, 0x16, 0x22, 0x85, 0xCF, 0x81, 0xC1, 0x00, 0x07, 0xC1, 0x27, 0x83, 0x49, 0xC2, 0x0A, 0x21,
+    0x85, 0x77, 0x84, 0xD1, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x7A, 0xF0, 0x00, 0x15, 0x00, 0x0B, 0x00,
+    0x07, 0x54, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x25, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x48, 0x49, 0x02, 0xF9, 0x02, 0xF2, 0x02, 0xEB, 0x02, 0xCA, 0x50, 0x97,
+    0x02, 0xB3, 0x02, 0x81, 0x02, 0x43, 0x01, 0xF8, 0x01, 0xD7, 0x01, 0x88, 0x01, 0x3A, 0x01, 0x1A,
+    0x00, 0xFB, 0x00, 0xDB, 0x00, 0xAB, 0x00, 0xA1, 0x00, 0x7A, 0x00, 0x3A, 0x00, 0x0D, 0xC1, 0x25,
+    0x81, 0x6C, 0x41, 0x25, 0x84, 0xAA, 0xC6, 0x16, 0x23, 0x25, 0x2A, 0x40, 0x41, 0x82, 0x28, 0x85,
+    0x2A, 0x85, 0x2A, 0x7E, 0x8F, 0x00, 0x04, 0x44, 0xDF, 0x42, 0x01, 0x4C, 0x18, 0x6C, 0x86, 0x49,
+    0x41, 0x27, 0x7D, 0x02, 0xA1, 0x04, 0x04, 0x21, 0x22, 0x03, 0x41, 0x17, 0x85, 0xC9, 0xC5, 0x14,
+    0x15, 0x17, 0x32, 0x42, 0x85, 0x98, 0x00, 0x15, 0x86, 0x03, 0x00, 0x07, 0x00, 0x04, 0xC2, 0x17,
+    0x27, 0x7A, 0x9B, 0x86, 0x64, 0x41, 0x2C, 0x86, 0x75, 0xA1, 0x34, 0x04, 0x41, 0x38, 0x7C, 0xF0,
+    0xA1, 0x25, 0x04, 0x42, 0x2D, 0x32, 0x85, 0xC8, 0x00, 0x03, 0x41, 0x31, 0x16, 0x32, 0x41, 0x27,
+    0x73, 0x1A, 0x21, 0x40, 0x04, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x21, 0x14, 0x03, 0x21, 0x32,
+    0x03, 0x21, 0x2D, 0x03, 0x21, 0x30, 0x03, 0xC6, 0x01, 0x15, 0x18, 0x21, 0x27, 0x2A, 0x18, 0x79,
+    0x00, 0x1D, 0x6B, 0xB3, 0x85, 0xA5, 0x7B, 0xF9, 0x00, 0x03, 0x42, 0x19, 0x32, 0x86, 0xBA, 0x61,
+    0xDE, 0x43, 0x25, 0x34, 0x35, 0x86, 0xC1, 0x62, 0xC2, 0x86, 0xC1, 0x42, 0x32, 0x38, 0x86, 0x92,
+    0x86, 0xCA, 0x42, 0x28, 0x38, 0x86, 0xD2, 0x73, 0xE8, 0x42, 0x30, 0x32, 0x86, 0xD9, 0x85, 0x9E,
+    0x21, 0x19, 0x07, 0x44, 0x17, 0x1B, 0x28, 0x32, 0x5A, 0x95, 0x83, 0xE0, 0x00, 0x03, 0x6A, 0x2B,
+    0xC1, 0x2D, 0x86, 0xEF, 0xC1, 0x17, 0x78, 0xEC, 0x43, 0x07, 0x14, 0x32, 0x00, 0x08, 0x00, 0x04,
+    0x86, 0xB2, 0x42, 0x32, 0x38, 0x86, 0x47, 0x84, 0xF3, 0x45, 0x14, 0x19, 0x27, 0x36, 0x39, 0x87,
+    0x09, 0x87, 0x09, 0x86, 0xAB, 0x86, 0xFF, 0x87, 0x09, 0x41, 0x42, 0x7F, 0x0E, 0xC3, 0x21, 0x36,
+    0x38, 0x00, 0x04, 0x87, 0x13, 0x7E, 0xF8, 0x42, 0x07, 0x32, 0x87, 0x27, 0x86, 0x22, 0x21, 0x19,
+    0x07, 0x41, 0x0A, 0x62, 0x51, 0x21, 0x21, 0x04, 0x42, 0x13, 0x23, 0x86, 0x72, 0x00, 0x03, 0x21,
+    0x23, 0x07, 0xA1, 0x18, 0x03, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0xC1, 0x2A, 0x6C, 0xDD, 0xA2,
+    0x32, 0x4C, 0x07, 0x04, 0x21, 0x22, 0x05, 0x42, 0x15, 0x47, 0x87, 0x57, 0x84, 0x49, 0x21, 0x1B,
+    0x07, 0x21, 0x40, 0x03, 0x43, 0x1E, 0x21, 0x2A, 0x00, 0x10, 0x00, 0x03, 0x83, 0x3F, 0x41, 0x2A,
+    0x4D, 0xBB, 0x21, 0x34, 0x04, 0x41, 0x4C, 0x4A, 0x71, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x42,
+    0x1F, 0x25, 0x6A, 0x2C, 0x84, 0x71, 0x43, 0x1B, 0x1F, 0x40, 0x62, 0x88, 0x00, 0x0A, 0x00, 0x07,
+    0x22, 0x0B, 0x2A, 0x1E, 0x0A, 0xC2, 0x0A, 0x27, 0x85, 0x86, 0x6C, 0x12, 0xC1, 0x21, 0x78, 0x11,
+    0x44, 0x19, 0x1A, 0x21, 0x22, 0x00, 0x10, 0x87, 0xA0, 0x00, 0x0B, 0x00, 0x04, 0x42, 0x04, 0x17,
+    0x87, 0xAD, 0x87, 0x67, 0x41, 0x17, 0x49, 0x8C, 0xD6, 0x01, 0x07, 0x0A, 0x17, 0x18, 0x1E, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x38, 0x39, 0x40, 0x6C,
+    0xC4, 0x01, 0x11, 0x00, 0xFE, 0x5B, 0x6A, 0x53, 0x61, 0x00, 0xF7, 0x00, 0xED, 0x00, 0xE6, 0x00,
+    0xD5, 0x2F, 0x3C, 0x00, 0xC0, 0x00, 0xB6, 0x00, 0xAF, 0x00, 0x9B, 0x00, 0x8A, 0x00, 0x54, 0x00,
+    0x18, 0x00, 0x0B, 0x00, 0x04, 0x7B, 0x39, 0x87, 0x27, 0x5A, 0x2A, 0xC1, 0x1A, 0x85, 0xFD, 0x21,
+    0x35, 0x04, 0x21, 0x0E, 0x03, 0x42, 0x06, 0x29, 0x88, 0x05, 0x00, 0x03, 0xC1, 0x32, 0x87, 0x51,
+    0xC1, 0x16, 0x7E, 0xC2, 0x41, 0x1A, 0x84, 0xFC, 0xC2, 0x17, 0x2A, 0x84, 0x00, 0x00, 0x04, 0x41,
+    0x16, 0x88, 0x15, 0xC2, 0x30, 0x42, 0x88, 0x23, 0x00, 0x04, 0xC2, 0x21, 0x35, 0x88, 0x2A, 0x88,
+    0x2A, 0x21, 0x28, 0x07, 0xC1, 0x1A, 0x85, 0x1C, 0xC5, 0x17, 0x1A, 0x22, 0x23, 0x40, 0x00, 0x07,
+    0x87, 0xF2, 0x88, 0x38, 0x00, 0x04, 0x6C, 0x23, 0xC1, 0x32, 0x63, 0x6C, 0x43, 0x16, 0x17, 0x32,
+    0x88, 0x4C, 0x88, 0x4C, 0x86, 0x4E, 0x41, 0x32, 0x13, 0xA2, 0xC6, 0x0A, 0x15, 0x1A, 0x1B, 0x20,
+    0x23, 0x00, 0x12, 0x6A, 0x67, 0x00, 0x0E, 0x88, 0x5A, 0x00, 0x04, 0x88, 0x5A, 0x41, 0x29, 0x88,
+    0x6C, 0x21, 0x40, 0x04, 0x21, 0x34, 0x03, 0x21, 0x20, 0x03, 0x21, 0x32, 0x03, 0x41, 0x0A, 0x88,
+    0x64, 0x21, 0x14, 0x04, 0x21, 0x34, 0x03, 0x21, 0x0A, 0x03, 0xC6, 0x04, 0x18, 0x1B, 0x21, 0x2A,
+    0x40, 0x12, 0x23, 0x00, 0x10, 0x78, 0xB0, 0x6B, 0x89, 0x85, 0x5A, 0x00, 0x03, 0x4A, 0x07, 0x14,
+    0x19, 0x22, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x48, 0x00, 0x8D, 0x88, 0x9D, 0x00, 0x85, 0x00, 0x7A,
+    0x87, 0xE2, 0x87, 0xE2, 0x00, 0x65, 0x00, 0x43, 0x00, 0x13, 0x88, 0x37, 0x42, 0x32, 0x35, 0x75,
+    0x9E, 0x88, 0xBC, 0x41, 0x23, 0x64, 0xC4, 0x21, 0x23, 0x04, 0xC7, 0x0A, 0x17, 0x19, 0x1E, 0x21,
+    0x27, 0x32, 0x63, 0xEA, 0x7B, 0xD3, 0x53, 0x0B, 0x6D, 0x70, 0x00, 0x0E, 0x00, 0x03, 0x2B, 0x89,
+    0x41, 0x28, 0x54, 0x89, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0x21, 0x48, 0x03, 0xC2, 0x1C, 0x44,
+    0x00, 0x03, 0x69, 0x4B, 0x21, 0x23, 0x07, 0x21, 0x32, 0x03, 0x42, 0x23, 0x27, 0x88, 0xFA, 0x6C,
+    0xEC, 0x41, 0x33, 0x5C, 0xC8, 0x41, 0x38, 0x84, 0xED, 0x42, 0x28, 0x36, 0x89, 0x09, 0x84, 0xF1,
+    0x41, 0x1B, 0x1B, 0xCD, 0x42, 0x1E, 0x32, 0x78, 0x59, 0x00, 0x04, 0x41, 0x19, 0x63, 0xF3, 0x21,
+    0x2D, 0x04, 0x42, 0x19, 0x23, 0x89, 0x22, 0x00, 0x03, 0x41, 0x32, 0x2B, 0xC8, 0x42, 0x25, 0x34,
+    0x86, 0x49, 0x88, 0xA8, 0x41, 0x07, 0x7F, 0xE6, 0x21, 0x32, 0x04, 0x21, 0x25, 0x03, 0x21, 0x32,
+    0x03, 0x41, 0x18, 0x6D, 0xD5, 0x21, 0x17, 0x04, 0x21, 0x38, 0x03, 0x42, 0x32, 0x48, 0x89, 0x41,
+    0x88, 0xF6, 0x21, 0x25, 0x07, 0x41, 0x38, 0x3B, 0x22, 0x41, 0x29, 0x89, 0x13, 0x45, 0x01, 0x04,
+    0x1E, 0x2A, 0x2D, 0x00, 0x04, 0x89, 0x5D, 0x52, 0xE5, 0x89, 0x24, 0x89, 0x5C, 0x42, 0x14, 0x1B,
+    0x89, 0x63, 0x89, 0x6D, 0xD3, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x17, 0x19, 0x1A, 0x1C, 0x1E, 0x20,
+    0x25, 0x28, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x43, 0x00, 0x7A, 0x6D, 0x66, 0x00, 0x73, 0x00, 0x6F,
+    0x82, 0x86, 0x00, 0x6B, 0x00, 0x60, 0x00, 0x52, 0x00, 0x4B, 0x00, 0x47, 0x89, 0x5B, 0x6F, 0x06,
+    0x00, 0x36, 0x00, 0x2C, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x17, 0x00, 0x07, 0x11, 0x66, 0x42, 0x31,
+    0x32, 0x88, 0xA9, 0x89, 0xAE, 0x42, 0x01, 0x21, 0x89, 0x4F, 0x89, 0x60, 0xC8, 0x15, 0x17, 0x19,
+    0x21, 0x22, 0x23, 0x2A, 0x41, 0x00, 0x0E, 0x88, 0xBD, 0x69, 0x1C, 0x88, 0xBA, 0x7D, 0xAC, 0x81,
+    0xDA, 0x00, 0x07, 0x28, 0xAE, 0xC1, 0x0B, 0x64, 0x99, 0x41, 0x1F, 0x88, 0xDA, 0x41, 0x2D, 0x68,
+    0x91, 0xA1, 0x0B, 0x04, 0xC1, 0x01, 0x88, 0xD8, 0x41, 0x32, 0x6D, 0x7F, 0x41, 0x4C, 0x68, 0xA0,
+    0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x1A, 0x03, 0x22, 0x19, 0x40, 0x11, 0x03, 0x21, 0x4C,
+    0x05, 0x41, 0x4C, 0x77, 0x17, 0x42, 0x21, 0x44, 0x8A, 0x05, 0x7C, 0xDC, 0x21, 0x22, 0x07, 0x21,
+    0x35, 0x03, 0x21, 0x23, 0x03, 0xCD, 0x01, 0x07, 0x14, 0x19, 0x1F, 0x21, 0x22, 0x23, 0x25, 0x2B,
+    0x40, 0x41, 0x44, 0x8A, 0x15, 0x00, 0xA1, 0x00, 0x59, 0x00, 0x40, 0x00, 0x3C, 0x00, 0x34, 0x00,
+    0x31, 0x00, 0x17, 0x00, 0x14, 0x17, 0x4E, 0x00, 0x03, 0x59, 0x08, 0x85, 0xEC, 0x45, 0x31, 0x32,
+    0x36, 0x48, 0x49, 0x89, 0xEE, 0x3A, 0xFE, 0x8A, 0x3C, 0x6E, 0x2F, 0x6E, 0x2F, 0xC3, 0x01, 0x16,
+    0x1A, 0x8A, 0x4D, 0x40, 0x02, 0x28, 0x16, 0x45, 0x07, 0x19, 0x30, 0x32, 0x38, 0x06, 0xC5, 0x8A,
+    0x57, 0x8A, 0x57, 0x8A, 0x1E, 0x00, 0x0A, 0x41, 0x41, 0x2C, 0xC8, 0x21, 0x30, 0x04, 0x21, 0x17,
+    0x03, 0x21, 0x14, 0x03, 0x43, 0x31, 0x36, 0x37, 0x00, 0x03, 0x8A, 0x3B, 0x86, 0x22, 0x47, 0x27,
+    0x2D, 0x31, 0x32, 0x34, 0x36, 0x38, 0x8A, 0x74, 0x8A, 0x7D, 0x8A, 0x7D, 0x89, 0xC3, 0x86, 0x2C,
+    0x85, 0xF4, 0x8A, 0x7E, 0x41, 0x22, 0x8A, 0x39, 0x21, 0x30, 0x04, 0x21, 0x17, 0x03, 0x21, 0x2D,
+    0x03, 0x41, 0x19, 0x0C, 0xFE, 0x21, 0x35, 0x04, 0x41, 0x1B, 0x1F, 0xFC, 0x21, 0x48, 0x04, 0x21,
+    0x35, 0x03, 0x41, 0x43, 0x8A, 0x79, 0x21, 0x22, 0x04, 0x21, 0x32, 0x03, 0x41, 0x40, 0x5C, 0x2F,
+    0x21, 0x32, 0x04, 0x21, 0x13, 0x03, 0x21, 0x32, 0x03, 0x42, 0x19, 0x25, 0x88, 0x7D, 0x89, 0xB9,
+    0x21, 0x2B, 0x07, 0x41, 0x35, 0x8A, 0xC0, 0x21, 0x27, 0x04, 0x21, 0x17, 0x03, 0x21, 0x48, 0x03,
+    0x21, 0x25, 0x03, 0x21, 0x2B, 0x03, 0x41, 0x17, 0x71, 0xE9, 0x21, 0x2D, 0x04, 0xCF, 0x02, 0x08,
+    0x0D, 0x14, 0x20, 0x2A, 0x2B, 0x2D, 0x32, 0x40, 0x41, 0x43, 0x44, 0x48, 0x49, 0x6E, 0xDF, 0x00,
+    0x48, 0x00, 0x3E, 0x83, 0xFF, 0x00, 0x34, 0x72, 0x39, 0x62, 0xA3, 0x00, 0x27, 0x87, 0x82, 0x00,
+    0x1D, 0x5A, 0x5E, 0x8A, 0xB4, 0x00, 0x0A, 0x00, 0x03, 0x8A, 0xB4, 0x44, 0x1A, 0x22, 0x25, 0x27,
+    0x8A, 0xAC, 0x00, 0x7D, 0x00, 0x2E, 0x8A, 0xE2, 0x41, 0x07, 0x65, 0x94, 0x21, 0x48, 0x04, 0x42,
+    0x21, 0x22, 0x00, 0x03, 0x8B, 0x2F, 0xCA, 0x07, 0x17, 0x19, 0x1A, 0x21, 0x22, 0x25, 0x27, 0x40,
+    0x41, 0x8A, 0x34, 0x00, 0xF9, 0x00, 0xDF, 0x8B, 0x1D, 0x00, 0xC2, 0x8A, 0xDB, 0x00, 0xB8, 0x89,
+    0x0C, 0x00, 0x1B, 0x00, 0x07, 0x41, 0x31, 0x14, 0xF9, 0xA1, 0x27, 0x04, 0xA1, 0x32, 0x03, 0x41,
+    0x13, 0x89, 0x75, 0x41, 0x04, 0x88, 0x9A, 0x21, 0x38, 0x04, 0x21, 0x1A, 0x03, 0x21, 0x22, 0x03,
+    0x21, 0x13, 0x03, 0x44, 0x0D, 0x13, 0x42, 0x44, 0x8B, 0x73, 0x00, 0x17, 0x00, 0x14, 0x00, 0x03,
+    0x42, 0x34, 0x4C, 0x00, 0x0D, 0x8B, 0x80, 0x43, 0x32, 0x34, 0x49, 0x8A, 0xCC, 0x8B, 0x4E, 0x83,
+    0xA5, 0x41, 0x23, 0x49, 0x0B, 0xA1, 0x27, 0x04, 0xA1, 0x32, 0x03, 0x22, 0x13, 0x42, 0x03, 0x3C,
+    0xC3, 0x30, 0x32, 0x34, 0x8B, 0xA0, 0x8B, 0xA0, 0x00, 0x05, 0xC4, 0x02, 0x0B, 0x17, 0x29, 0x00,
+    0x2A, 0x13, 0xCD, 0x00, 0x23, 0x00, 0x0A, 0x41, 0x40, 0x10, 0x05, 0xC2, 0x27, 0x2A, 0x8B, 0x5D,
+    0x00, 0x04, 0xC1, 0x1A, 0x8B, 0x89, 0xC7, 0x01, 0x06, 0x19, 0x27, 0x2A, 0x30, 0x4C, 0x70, 0xD2,
+    0x88, 0xB4, 0x46, 0xDE, 0x79, 0xF5, 0x4A, 0x5E, 0x8B, 0xC6, 0x00, 0x04, 0x21, 0x11, 0x16, 0xC2,
+    0x17, 0x40, 0x13, 0x23, 0x53, 0x23, 0xC5, 0x0A, 0x32, 0x34, 0x41, 0x4C, 0x88, 0x7B, 0x8B, 0xE6,
+    0x8B, 0xAD, 0x39, 0x53, 0x8B, 0xE6, 0x42, 0x08, 0x14, 0x8B, 0xF6, 0x8B, 0xF6, 0xC6, 0x01, 0x15,
+    0x17, 0x18, 0x19, 0x43, 0x71, 0x8F, 0x00, 0x17, 0x8B, 0x37, 0x8B, 0xE1, 0x6B, 0x5D, 0x00, 0x07,
+    0x45, 0x23, 0x2D, 0x32, 0x34, 0x35, 0x84, 0x2E, 0x8C, 0x06, 0x8C, 0x06, 0x8A, 0x01, 0x8B, 0x7F,
+    0x41, 0x04, 0x84, 0x25, 0x21, 0x07, 0x04, 0x21, 0x34, 0x03, 0x41, 0x41, 0x8C, 0x29, 0x22, 0x21,
+    0x30, 0x07, 0x04, 0x42, 0x01, 0x1E, 0x76, 0xEE, 0x8C, 0x33, 0xC6, 0x16, 0x17, 0x1B, 0x2A, 0x40,
+    0x41, 0x8A, 0x2B, 0x00, 0x2A, 0x76, 0x17, 0x00, 0x0C, 0x41, 0xD9, 0x00, 0x07, 0x42, 0x30, 0x35,
+    0x8C, 0x4D, 0x8C, 0x4D, 0xC2, 0x17, 0x1E, 0x8B, 0x52, 0x00, 0x07, 0x41, 0x01, 0x8C, 0x3F, 0x41,
+    0x25, 0x6A, 0xE6, 0x21, 0x32, 0x04, 0xA1, 0x21, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x41,
+    0x2A, 0x70, 0xEC, 0x21, 0x34, 0x04, 0xC2, 0x01, 0x08, 0x8B, 0x3E, 0x8C, 0x30, 0x41, 0x22, 0x4B,
+    0x87, 0xC8, 0x04, 0x27, 0x28, 0x30, 0x32, 0x35, 0x39, 0x4C, 0x67, 0xA5, 0x00, 0x0E, 0x40, 0x76,
+    0x8C, 0x81, 0x00, 0x0B, 0x00, 0x04, 0x7A, 0x59, 0x8C, 0x81, 0x41, 0x19, 0x8B, 0xDF, 0xA2, 0x19,
+    0x44, 0x1D, 0x04, 0xC1, 0x44, 0x8C, 0x90, 0x42, 0x07, 0x27, 0x8C, 0xA7, 0x00, 0x04, 0xC5, 0x04,
+    0x17, 0x19, 0x2B, 0x40, 0x8C, 0x75, 0x8B, 0xE8, 0x6E, 0x18, 0x78, 0x6C, 0x89, 0x7B, 0x21, 0x07,
+    0x10, 0x51, 0x01, 0x04, 0x07, 0x0A, 0x13, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1E, 0x25, 0x27, 0x28,
+    0x2C, 0x48, 0x49, 0x01, 0x17, 0x8A, 0x5A, 0x01, 0x06, 0x8C, 0xC1, 0x00, 0xE5, 0x00, 0xE2, 0x8C,
+    0xC1, 0x00, 0xC4, 0x00, 0x87, 0x73, 0x52, 0x00, 0x6D, 0x00, 0x66, 0x00, 0x55, 0x00, 0x23, 0x2B,
+    0xB3, 0x00, 0x1A, 0x00, 0x03, 0x41, 0x32, 0x6D, 0x82, 0x21, 0x49, 0x04, 0x41, 0x40, 0x3E, 0x83,
+    0x21, 0x1F, 0x04, 0x21, 0x44, 0x03, 0x21, 0x16, 0x03, 0x42, 0x17, 0x2D, 0x88, 0x47, 0x8D, 0x08,
+    0xC9, 0x01, 0x14, 0x21, 0x23, 0x2B, 0x2D, 0x40, 0x42, 0x43, 0x8B, 0xD8, 0x81, 0x39, 0x00, 0x17,
+    0x00, 0x0A, 0x64, 0xC6, 0x82, 0xD0, 0x00, 0x07, 0x8B, 0x12, 0x8C, 0xD7, 0x41, 0x35, 0x4B, 0xC0,
+    0x21, 0x01, 0x04, 0x21, 0x34, 0x03, 0x42, 0x30, 0x34, 0x8D, 0x36, 0x72, 0x60, 0x42, 0x30, 0x4C,
+    0x2B, 0x2D, 0x8D, 0x3D, 0x41, 0x23, 0x2C, 0xE0, 0x43, 0x14, 0x19, 0x32, 0x8C, 0x82, 0x8D, 0x48,
+    0x00, 0x04, 0x41, 0x1E, 0x2C, 0x79, 0x21, 0x4C, 0x04, 0x21, 0x34, 0x03, 0x21, 0x18, 0x03, 0x21,
+    0x17, 0x03, 0x21, 0x24, 0x03, 0x21, 0x21, 0x03, 0x21, 0x31, 0x03, 0x41, 0x1A, 0x58, 0x11, 0x21,
+    0x34, 0x04, 0x41, 0x23, 0x55, 0xDA, 0x21, 0x32, 0x04, 0x22, 0x18, 0x19, 0x0A, 0x03, 0xC7, 0x15,
+    0x1A, 0x1E, 0x21, 0x28, 0x2A, 0x32, 0x00, 0x41, 0x00, 0x36, 0x8D, 0x7E, 0x71, 0xFB, 0x42, 0xD3,
+    0x00, 0x16, 0x00, 0x05, 0xC1, 0x17, 0x84, 0x46, 0xC2, 0x14, 0x17, 0x8D, 0x98, 0x8D, 0x98, 0xC4,
+    0x01, 0x31, 0x32, 0x34, 0x8D, 0x9F, 0x70, 0xE7, 0x00, 0x07, 0x7B, 0xFE, 0xC1, 0x13, 0x8D, 0xAC,
+    0x41, 0x01, 0x8B, 0xB2, 0x42, 0x0B, 0x40, 0x8D, 0x59, 0x00, 0x04, 0xC5, 0x01, 0x1E, 0x34, 0x38,
+    0x4C, 0x8D, 0xBB, 0x8C, 0xF5, 0x7C, 0x1A, 0x00, 0x0F, 0x00, 0x07, 0xC2, 0x19, 0x40, 0x8D, 0xAF,
+    0x26, 0x59, 0xC3, 0x17, 0x1B, 0x35, 0x8D, 0x77, 0x8C, 0x7A, 0x8D, 0xD2, 0xCF, 0x01, 0x07, 0x08,
+    0x0B, 0x10, 0x12, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x8D, 0xDC, 0x00, 0xCC,
+    0x00, 0xA9, 0x6D, 0x21, 0x00, 0xA6, 0x00, 0xA6, 0x00, 0x5E, 0x00, 0x48, 0x8D, 0xDC, 0x00, 0x3D,
+    0x00, 0x21, 0x20, 0x8F, 0x00, 0x11, 0x8D, 0xDC, 0x00, 0x0A, 0x41, 0x27, 0x4A, 0x6E, 0x44, 0x23,
+    0x25, 0x27, 0x38, 0x8D, 0x05, 0x81, 0xFE, 0x84, 0xC0, 0x7D, 0x5A, 0x46, 0x1A, 0x27, 0x2D, 0x32,
+    0x38, 0x39, 0x8E, 0x1B, 0x8D, 0x60, 0x8E, 0x11, 0x8D, 0x60, 0x8E, 0x1B, 0x8D, 0xBD, 0x42, 0x32,
+    0x38, 0x8E, 0x1B, 0x71, 0x52, 0x42, 0x32, 0x34, 0x8D, 0x7A, 0x8E, 0x2B, 0x42, 0x19, 0x31, 0x8E,
+    0x3C, 0x8D, 0x87, 0x41, 0x47, 0x8A, 0x2B, 0x42, 0x32, 0x35, 0x8E, 0x47, 0x81, 0x88, 0x42, 0x23,
+    0x25, 0x8E, 0x4E, 0x8D, 0xE8, 0x46, 0x08, 0x19, 0x25, 0x27, 0x2B, 0x2D, 0x00, 0x12, 0x00, 0x0E,
+    0x8E, 0x55, 0x00, 0x07, 0x43, 0xCE, 0x8D, 0xEF, 0x41, 0x17, 0x89, 0x6F, 0x42, 0x08, 0x2B, 0x8E,
+    0x6C, 0x8D, 0xED, 0x44, 0x14, 0x1E, 0x1F, 0x21, 0x8D, 0xF4, 0x8D, 0xE2, 0x8E, 0x73, 0x8E, 0x73,
+    0xD5, 0x01, 0x02, 0x04, 0x07, 0x15, 0x17, 0x19, 0x1A, 0x1E, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x2A,
+    0x2B, 0x40, 0x41, 0x42, 0x43, 0x44, 0x6A, 0x71, 0x00, 0x76, 0x00, 0x72, 0x21, 0x9B, 0x04, 0xD2,
+    0x8B, 0xF0, 0x00, 0x65, 0x00, 0x52, 0x0A, 0xB7, 0x8D, 0x7E, 0x8C, 0x5D, 0x1B, 0x54, 0x00, 0x4B,
+    0x00, 0x44, 0x72, 0x72, 0x62, 0x39, 0x00, 0x2B, 0x00, 0x18, 0x5F, 0xBB, 0x00, 0x14, 0x00, 0x0D,
+    0x41, 0x08, 0x71, 0x6D, 0x21, 0x40, 0x04, 0xC2, 0x0A, 0x32, 0x8E, 0xAE, 0x8E, 0x7E, 0x42, 0x30,
+    0x34, 0x8E, 0xCE, 0x8E, 0xCE, 0x21, 0x10, 0x07, 0xC2, 0x18, 0x34, 0x73, 0xE4, 0x8E, 0xD8, 0xC1,
+    0x2D, 0x8D, 0xEC, 0xC2, 0x01, 0x32, 0x8E, 0x9D, 0x8C, 0xE5, 0x41, 0x29, 0x8C, 0x06, 0x21, 0x01,
+    0x04, 0x21, 0x31, 0x03, 0xC5, 0x08, 0x0D, 0x23, 0x40, 0x4C, 0x00, 0x03, 0x3A, 0x1F, 0x7B, 0xD6,
+    0x33, 0x77, 0x8E, 0xF4, 0x41, 0x31, 0x3E, 0xB0, 0x41, 0x2A, 0x8B, 0xFA, 0xC4, 0x22, 0x27, 0x32,
+    0x42, 0x00, 0x18, 0x00, 0x08, 0x8E, 0x5A, 0x00, 0x04, 0xC4, 0x14, 0x17, 0x1F, 0x41, 0x76, 0x65,
+    0x8E, 0x0D, 0x8F, 0x00, 0x7E, 0xF9, 0x41, 0x31, 0x7B, 0xB2, 0xC2, 0x01, 0x17, 0x8E, 0xE4, 0x61,
+    0x75, 0xC5, 0x01, 0x07, 0x17, 0x2A, 0x32, 0x74, 0xAD, 0x2E, 0xE9, 0x00, 0x0B, 0x8F, 0x31, 0x00,
+    0x07, 0xC2, 0x14, 0x19, 0x8E, 0xFB, 0x54, 0x62, 0xC2, 0x17, 0x32, 0x8F, 0x3B, 0x00, 0x07, 0x41,
+    0x1A, 0x8C, 0x41, 0xC1, 0x15, 0x88, 0x65, 0x21, 0x21, 0x04, 0x51, 0x04, 0x06, 0x07, 0x0A, 0x0F,
+    0x10, 0x14, 0x15, 0x19, 0x1B, 0x1E, 0x21, 0x27, 0x28, 0x40, 0x48, 0x49, 0x4E, 0xEF, 0x4E, 0xEF,
+    0x00, 0x96, 0x00, 0x93, 0x00, 0x85, 0x00, 0x82, 0x00, 0x7B, 0x8F, 0x5A, 0x00, 0x77, 0x8F, 0x5A,
+    0x00, 0x4E, 0x00, 0x41, 0x00, 0x29, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x03, 0x8F, 0x50, 0xC2, 0x0A,
+    0x32, 0x6A, 0xAE, 0x55, 0x56, 0x41, 0x2D, 0x8D, 0x64, 0x42, 0x35, 0x40, 0x8F, 0x1A, 0x00, 0x04,
+    0x41, 0x25, 0x8D, 0x7D, 0x41, 0x19, 0x1F, 0x67, 0x42, 0x14, 0x2D, 0x7C, 0x76, 0x00, 0x04, 0x42,
+    0x32, 0x33, 0x8F, 0xA5, 0x8E, 0x74, 0xC1, 0x2A, 0x32, 0xE0, 0x21, 0x1A, 0x04, 0x42, 0x31, 0x32,
+    0x8F, 0xBC, 0x00, 0x03, 0xC9, 0x14, 0x17, 0x19, 0x1E, 0x21, 0x23, 0x2A, 0x41, 0x44, 0x75, 0x56,
+    0x00, 0x15, 0x8A, 0x12, 0x69, 0x41, 0x8F, 0x5E, 0x00, 0x07, 0x79, 0xA1, 0x0A, 0x40, 0x43, 0x12,
+    0xCA, 0x06, 0x17, 0x19, 0x1B, 0x21, 0x23, 0x27, 0x2B, 0x40, 0x48, 0x00, 0x52, 0x8D, 0x50, 0x00,
+    0x47, 0x8F, 0xE0, 0x8F, 0xE0, 0x5D, 0xE3, 0x8F, 0x1A, 0x00, 0x40, 0x00, 0x38, 0x00, 0x1C, 0xC1,
+    0x17, 0x69, 0x7C, 0x41, 0x17, 0x8D, 0xB7, 0x41, 0x17, 0x5B, 0xB0, 0x47, 0x01, 0x14, 0x19, 0x1A,
+    0x21, 0x48, 0x49, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x04, 0x90, 0x0B, 0x90, 0x0B, 0x84, 0x79, 0x90,
+    0x01, 0x41, 0x23, 0x45, 0x3D, 0x21, 0x42, 0x04, 0x21, 0x34, 0x03, 0x41, 0x17, 0x74, 0xA8, 0x21,
+    0x38, 0x04, 0x21, 0x21, 0x03, 0x41, 0x23, 0x71, 0x49, 0x41, 0x17, 0x8E, 0xC1, 0x21, 0x27, 0x04,
+    0xC6, 0x19, 0x25, 0x2A, 0x32, 0x40, 0x4C, 0x00, 0x18, 0x60, 0x9F, 0x00, 0x0E, 0x00, 0x0B, 0x00,
+    0x03, 0x90, 0x40, 0x41, 0x23, 0x6F, 0xCA, 0x21, 0x34, 0x04, 0xA1, 0x01, 0x03, 0xCA, 0x02, 0x0E,
+    0x17, 0x19, 0x1E, 0x23, 0x29, 0x2B, 0x31, 0x39, 0x00, 0x1D, 0x90, 0x5D, 0x8F, 0x97, 0x40, 0x57,
+    0x8E, 0x33, 0x00, 0x03, 0x25, 0x88, 0x90, 0x24, 0x90, 0x53, 0x8F, 0xFF, 0x41, 0x15, 0x01, 0xAE,
+    0x41, 0x17, 0x90, 0x76, 0x21, 0x40, 0x04, 0x41, 0x19, 0x3C, 0x46, 0x21, 0x28, 0x04, 0x21, 0x23,
+    0x03, 0x21, 0x23, 0x03, 0x42, 0x21, 0x22, 0x6D, 0xBC, 0x8E, 0x85, 0x42, 0x2D, 0x34, 0x90, 0x62,
+    0x00, 0x07, 0x41, 0x15, 0x90, 0x39, 0x21, 0x19, 0x04, 0x21, 0x34, 0x03, 0x21, 0x07, 0x03, 0xA1,
+    0x40, 0x03, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x23, 0x03, 0x21, 0x33, 0x03, 0x41, 0x40,
+    0x90, 0x4C, 0x21, 0x19, 0x04, 0x21, 0x38, 0x03, 0x21, 0x21, 0x03, 0xC5, 0x19, 0x23, 0x2A, 0x2B,
+    0x34, 0x00, 0x30, 0x8B, 0x19, 0x00, 0x10, 0x00, 0x03, 0x89, 0x47, 0xC2, 0x15, 0x17, 0x90, 0x15,
+    0x90, 0xC2, 0xC1, 0x20, 0x4F, 0xF0, 0x21, 0x25, 0x04, 0x41, 0x02, 0x62, 0x3A, 0x21, 0x01, 0x04,
+    0x21, 0x34, 0x03, 0x22, 0x1E, 0x20, 0x0D, 0x03, 0xC1, 0x42, 0x90, 0xBF, 0x41, 0x14, 0x8F, 0xC4,
+    0x21, 0x19, 0x04, 0x21, 0x31, 0x03, 0x41, 0x23, 0x8E, 0xDC, 0x21, 0x38, 0x04, 0xA1, 0x17, 0x03,
+    0xC7, 0x01, 0x04, 0x0A, 0x19, 0x1E, 0x31, 0x32, 0x00, 0x0D, 0x8F, 0x01, 0x0A, 0x56, 0x00, 0x03,
+    0x90, 0xB2, 0x90, 0x8B, 0x8E, 0xFD, 0x41, 0x38, 0x34, 0xD8, 0x21, 0x17, 0x04, 0x21, 0x01, 0x03,
+    0x21, 0x31, 0x03, 0x41, 0x34, 0x46, 0x4F, 0xC1, 0x2A, 0x46, 0x8C, 0x42, 0x28, 0x35, 0x91, 0x3B,
+    0x90, 0xCF, 0x42, 0x23, 0x25, 0x00, 0x07, 0x90, 0xDC, 0x41, 0x30, 0x31, 0xC4, 0x41, 0x21, 0x5F,
+    0x50, 0x21, 0x40, 0x04, 0x21, 0x32, 0x03, 0x21, 0x2B, 0x03, 0x41, 0x41, 0x60, 0xCB, 0x21, 0x07,
+    0x04, 0x21, 0x32, 0x03, 0x41, 0x19, 0x8F, 0xEC, 0x21, 0x32, 0x04, 0x41, 0x2B, 0x84, 0xBD, 0x21,
+    0x07, 0x04, 0x42, 0x07, 0x2D, 0x91, 0x72, 0x00, 0x03, 0x41, 0x0A, 0x91, 0x69, 0x21, 0x27, 0x04,
+    0x42, 0x27, 0x31, 0x8C, 0xBE, 0x00, 0x03, 0x42, 0x23, 0x25, 0x90, 0xC1, 0x22, 0x32, 0x21, 0x2A,
+    0x07, 0xCA, 0x0A, 0x15, 0x1D, 0x21, 0x22, 0x25, 0x2A, 0x2B, 0x40, 0x43, 0x91, 0x81, 0x00, 0x48,
+    0x91, 0x58, 0x00, 0x3A, 0x00, 0x30, 0x00, 0x29, 0x00, 0x1F, 0x00, 0x11, 0x00, 0x03, 0x5F, 0x8C,
+    0xC1, 0x40, 0x8F, 0xB2, 0x43, 0x07, 0x19, 0x21, 0x00, 0x23, 0x91, 0xB4, 0x00, 0x04, 0xD5, 0x01,
+    0x04, 0x07, 0x08, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29,
+    0x2A, 0x40, 0x48, 0x49, 0x01, 0x61, 0x01, 0x42, 0x01, 0x3A, 0x24, 0xA1, 0x91, 0xBE, 0x1D, 0x42,
+    0x01, 0x2D, 0x00, 0xF3, 0x00, 0xE3, 0x00, 0xCB, 0x00, 0xC6, 0x91, 0xBE, 0x00, 0xAE, 0x00, 0x8E,
+    0x00, 0x8B, 0x47, 0x13, 0x55, 0x28, 0x00, 0x87, 0x00, 0x7C, 0x00, 0x0A, 0x1E, 0x60, 0x41, 0x39,
+    0x8E, 0xF0, 0x21, 0x17, 0x04, 0x21, 0x38, 0x03, 0x21, 0x19, 0x03, 0xA1, 0x32, 0x03, 0xC2, 0x2B,
+    0x48, 0x91, 0x05, 0x91, 0xA8, 0x41, 0x2F, 0x92, 0x15, 0x21, 0x32, 0x04, 0x21, 0x49, 0x03, 0x21,
+    0x25, 0x03, 0x21, 0x01, 0x03, 0xA1, 0x40, 0x03, 0x41, 0x25, 0x66, 0xF6, 0x41, 0x21, 0x8D, 0xA2,
+    0xC1, 0x0B, 0x73, 0x9A, 0xCD, 0x01, 0x15, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x29, 0x40, 0x42, 0x44,
+    0x48, 0x49, 0x90, 0x11, 0x00, 0x29, 0x00, 0x26, 0x92, 0x34, 0x04, 0xA0, 0x92, 0x34, 0x00, 0x0F,
+    0x92, 0x33, 0x00, 0x0C, 0x00, 0x08, 0x5A, 0xEC, 0x00, 0x04, 0x92, 0x34, 0x41, 0x21, 0x77, 0xEE,
+    0x41, 0x25, 0x7D, 0x1B, 0x42, 0x01, 0x22, 0x00, 0x04, 0x92, 0x5A, 0x41, 0x21, 0x92, 0x32, 0x41,
+    0x25, 0x72, 0x39, 0x21, 0x44, 0x04, 0x21, 0x27, 0x03, 0x41, 0x0B, 0x78, 0x0B, 0x41, 0x25, 0x5B,
+    0x58, 0x21, 0x40, 0x04, 0x22, 0x01, 0x22, 0x0B, 0x03, 0x21, 0x2D, 0x05, 0x43, 0x33, 0x35, 0x48,
+    0x24, 0x79, 0x92, 0x8C, 0x92, 0x26, 0xA1, 0x17, 0x0A, 0xC1, 0x17, 0x8B, 0x60, 0x43, 0x07, 0x21,
+    0x22, 0x00, 0x07, 0x00, 0x04, 0x92, 0x9D, 0xC2, 0x08, 0x2A, 0x8B, 0xB9, 0x90, 0x5B, 0xC3, 0x07,
+    0x19, 0x21, 0x00, 0x07, 0x92, 0xAE, 0x6D, 0x1A, 0x41, 0x19, 0x71, 0xB6, 0x21, 0x31, 0x04, 0x42,
+    0x19, 0x49, 0x8F, 0x54, 0x92, 0xB2, 0x41, 0x19, 0x01, 0x6C, 0x21, 0x34, 0x04, 0x42, 0x30, 0x39,
+    0x33, 0x48, 0x90, 0xBE, 0x43, 0x23, 0x32, 0x35, 0x90, 0xAA, 0x92, 0xCA, 0x92, 0xD4, 0x41, 0x0D,
+    0x8E, 0xFC, 0x21, 0x2B, 0x04, 0x21, 0x49, 0x03, 0x21, 0x39, 0x03, 0x41, 0x17, 0x62, 0x51, 0x21,
+    0x19, 0x04, 0xA1, 0x19, 0x03, 0x21, 0x33, 0x03, 0xA2, 0x1C, 0x49, 0x10, 0x03, 0x43, 0x01, 0x30,
+    0x48, 0x8C, 0x5B, 0x81, 0x5C, 0x8B, 0x1B, 0x41, 0x1C, 0x92, 0xA1, 0x21, 0x07, 0x04, 0xC2, 0x31,
+    0x38, 0x00, 0x03, 0x8E, 0x15, 0x41, 0x22, 0x93, 0x08, 0x21, 0x07, 0x04, 0x21, 0x2D, 0x03, 0x41,
+    0x40, 0x51, 0xC8, 0x21, 0x38, 0x04, 0x41, 0x2D, 0x6D, 0x54, 0x21, 0x37, 0x04, 0x21, 0x23, 0x03,
+    0x42, 0x0A, 0x1E, 0x8F, 0xC5, 0x93, 0x30, 0xD4, 0x04, 0x09, 0x0A, 0x14, 0x15, 0x17, 0x19, 0x1A,
+    0x1B, 0x1E, 0x21, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x2D, 0x40, 0x41, 0x43, 0x00, 0x7B, 0x93, 0x2A,
+    0x00, 0x78, 0x00, 0x6D, 0x00, 0x6A, 0x00, 0x63, 0x00, 0x3F, 0x5F, 0x5D, 0x8B, 0x3C, 0x79, 0xAB,
+    0x00, 0x3A, 0x93, 0x2A, 0x92, 0x38, 0x00, 0x29, 0x52, 0x49, 0x00, 0x1B, 0x00, 0x14, 0x00, 0x0A,
+    0x00, 0x07, 0x85, 0xCF, 0x44, 0x07, 0x27, 0x2D, 0x32, 0x93, 0x74, 0x00, 0xD7, 0x00, 0xC6, 0x00,
+    0x3D, 0x44, 0x07, 0x19, 0x21, 0x22, 0x93, 0x81, 0x93, 0x81, 0x93, 0x81, 0x93, 0x81, 0xC2, 0x04,
+    0x1F, 0x7F, 0x45, 0x8E, 0xCC, 0xC4, 0x07, 0x16, 0x41, 0x43, 0x00, 0x07, 0x8F, 0x87, 0x0E, 0x11,
+    0x91, 0x64, 0x42, 0x21, 0x2B, 0x92, 0x92, 0x47, 0xC5, 0xC4, 0x17, 0x1D, 0x27, 0x40, 0x8F, 0x9B,
+    0x93, 0x70, 0x91, 0x86, 0x00, 0x07, 0xC4, 0x07, 0x17, 0x22, 0x27, 0x93, 0xB6, 0x91, 0x8C, 0x00,
+    0x0D, 0x93, 0xB6, 0x44, 0x19, 0x27, 0x2D, 0x32, 0x93, 0xC3, 0x00, 0x42, 0x00, 0x2E, 0x00, 0x0D,
+    0x5F, 0x23, 0x01, 0x07, 0x0A, 0x10, 0x14, 0x18, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x24, 0x25, 0x27,
+    0x28, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41,
+    0x42, 0x44, 0x47, 0x48, 0x49, 0x0D, 0xA2, 0x92, 0xCE, 0x93, 0x0A, 0x28, 0xA4, 0x0D, 0x9A, 0x7F,
+    0x0A, 0x0D, 0x72, 0x0D, 0x62, 0x0D, 0x57, 0x0D, 0x4D, 0x0C, 0x18, 0x0B, 0xCB, 0x0B, 0xC4, 0x0B,
+    0x33, 0x0B, 0x06, 0x93, 0x6A, 0x0A, 0xD9, 0x09, 0xBB, 0x08, 0x9A, 0x07, 0x0F, 0x05, 0xF4, 0x05,
+    0x50, 0x04, 0x76, 0x03, 0xF0, 0x03, 0xC5, 0x5F, 0xF6, 0x02, 0x12, 0x01, 0x9C, 0x01, 0x74, 0x01,
+    0x6C, 0x01, 0x65, 0x01, 0x5A, 0x01, 0x47, 0x00, 0x5C, 0x00, 0x0D, 0x42, 0x15, 0x22, 0x7F, 0x75,
+    0x94, 0x3B, 0x42, 0x31, 0x32, 0x93, 0x87, 0x00, 0x07, 0xC3, 0x01, 0x09, 0x0A, 0x94, 0x2D, 0x93,
+    0xEE, 0x00, 0x07, 0x41, 0x23, 0x57, 0xBD, 0x41, 0x23, 0x83, 0x8F, 0x21, 0x32, 0x04, 0x21, 0x25,
+    0x03, 0x21, 0x1E, 0x03, 0x21, 0x35, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x17, 0x03, 0x21, 0x40, 0x03,
+    0x21, 0x23, 0x03, 0xA1, 0x27, 0x03, 0x21, 0x35, 0x03, 0x21, 0x23, 0x03, 0x43, 0x14, 0x31, 0x38,
+    0x93, 0xB6, 0x93, 0xC7, 0x00, 0x03, 0x42, 0x21, 0x32, 0x4F, 0x07, 0x94, 0x40, 0xC1, 0x42, 0x7A,
+    0xCA, 0x21, 0x23, 0x04, 0x42, 0x21, 0x32, 0x94, 0x94, 0x00, 0x03, 0x44, 0x01, 0x04, 0x13, 0x23,
+    0x94, 0x55, 0x00, 0x07, 0x4F, 0x20, 0x83, 0xD3, 0x41, 0x10, 0x94, 0x42, 0x43, 0x15, 0x22, 0x29,
+    0x94, 0xAC, 0x91, 0x41, 0x00, 0x04, 0xC1, 0x17, 0x79, 0x33, 0xC8, 0x18, 0x1A, 0x2A, 0x31, 0x32,
+    0x34, 0x38, 0x39, 0x58, 0x2B, 0x00, 0x3E, 0x00, 0x34, 0x94, 0xB0, 0x00, 0x1F, 0x00, 0x0E, 0x94,
+    0xBA, 0x00, 0x04, 0x42, 0x19, 0x28, 0x94, 0xD3, 0x94, 0xD3, 0xC3, 0x19, 0x27, 0x2A, 0x4F, 0xF2,
+    0x83, 0x09, 0x94, 0xDA, 0x22, 0x34, 0x35, 0x11, 0x0A, 0x42, 0x22, 0x23, 0x94, 0xE9, 0x94, 0xE9,
+    0x42, 0x16, 0x32, 0x94, 0x8A, 0x00, 0x07, 0x41, 0x23, 0x83, 0x2D, 0x43, 0x23, 0x31, 0x32, 0x00,
+    0x04, 0x94, 0xB2, 0x93, 0x49, 0x41, 0x32, 0x4A, 0x7E, 0x41, 0x39, 0x78, 0x2D, 0x42, 0x17, 0x32,
+    0x95, 0x0D, 0x94, 0xAF, 0x42, 0x07, 0x32, 0x92, 0x4B, 0x79, 0xAC, 0x41, 0x23, 0x78, 0x63, 0x21,
+    0x42, 0x04, 0x42, 0x20, 0x32, 0x94, 0xBC, 0x00, 0x03, 0x41, 0x42, 0x93, 0x1A, 0x21, 0x21, 0x04,
+    0x21, 0x31, 0x03, 0xA1, 0x18, 0x03, 0x41, 0x10, 0x94, 0xDB, 0x42, 0x1B, 0x29, 0x5F, 0xD1, 0x00,
+    0x04, 0x42, 0x23, 0x34, 0x7A, 0x51, 0x00, 0x07, 0x41, 0x38, 0x78, 0x61, 0x41, 0x21, 0x79, 0xC9,
+    0x42, 0x21, 0x2A, 0x4B, 0x01, 0x00, 0x04, 0x21, 0x34, 0x07, 0x41, 0x15, 0x65, 0x81, 0x47, 0x17,
+    0x18, 0x19, 0x20, 0x22, 0x23, 0x2A, 0x46, 0xB3, 0x00, 0x1D, 0x00, 0x16, 0x00, 0x07, 0x00, 0x04,
+    0x76, 0x72, 0x8A, 0xF4, 0xCF, 0x01, 0x08, 0x0A, 0x14, 0x18, 0x19, 0x1A, 0x21, 0x27, 0x28, 0x2A,
+    0x30, 0x32, 0x34, 0x40, 0x00, 0x84, 0x00, 0x79, 0x70, 0x94, 0x95, 0x0E, 0x00, 0x6F, 0x00, 0x6B,
+    0x00, 0x67, 0x00, 0x60, 0x94, 0xBC, 0x83, 0x56, 0x00, 0x52, 0x00, 0x41, 0x00, 0x16, 0x95, 0x73,
+    0x6A, 0x3E, 0x21, 0x21, 0x2E, 0x42, 0x1A, 0x1B, 0x60, 0x4B, 0x95, 0xA5, 0x43, 0x23, 0x32, 0x34,
+    0x95, 0xAC, 0x95, 0x66, 0x00, 0x07, 0xC2, 0x14, 0x18, 0x95, 0x58, 0x00, 0x0A, 0xC4, 0x13, 0x21,
+    0x23, 0x32, 0x00, 0xD9, 0x95, 0x62, 0x00, 0x1B, 0x00, 0x07, 0x41, 0x0A, 0x94, 0x12, 0x21, 0x31,
+    0x04, 0x41, 0x32, 0x94, 0x90, 0x41, 0x31, 0x93, 0xA4, 0x41, 0x37, 0x79, 0x21, 0x41, 0x01, 0x95,
+    0x58, 0xC7, 0x0D, 0x14, 0x1A, 0x1E, 0x21, 0x40, 0x42, 0x00, 0x10, 0x00, 0x0C, 0x94, 0x2C, 0x00,
+    0x08, 0x7A, 0xBC, 0x67, 0x54, 0x00, 0x04, 0x41, 0x32, 0x77, 0xB2, 0x43, 0x22, 0x27, 0x40, 0x95,
+    0x95, 0x00, 0x04, 0x57, 0xAD, 0x41, 0x21, 0x92, 0x9A, 0x45, 0x07, 0x0A, 0x0D, 0x19, 0x21, 0x96,
+    0x08, 0x96, 0x09, 0x00, 0x28, 0x00, 0x0E, 0x00, 0x04, 0x41, 0x32, 0x95, 0xD0, 0x41, 0x19, 0x94,
+    0x0E, 0xC2, 0x17, 0x1E, 0x95, 0x15, 0x00, 0x04, 0x43, 0x23, 0x27, 0x38, 0x95, 0x62, 0x00, 0x0F,
+    0x00, 0x07, 0xC1, 0x17, 0x95, 0x3F, 0x21, 0x19, 0x04, 0x42, 0x34, 0x35, 0x00, 0x03, 0x96, 0x39,
+    0x41, 0x19, 0x54, 0x35, 0x21, 0x33, 0x04, 0xC1, 0x21, 0x7A, 0xC4, 0xC2, 0x30, 0x32, 0x96, 0x4B,
+    0x00, 0x04, 0xC4, 0x01, 0x13, 0x32, 0x42, 0x00, 0x0E, 0x00, 0x07, 0x96, 0x52, 0x93, 0x44, 0x42,
+    0x15, 0x31, 0x94, 0xAD, 0x79, 0x5A, 0x46, 0x01, 0x14, 0x15, 0x19, 0x23, 0x29, 0x96, 0x00, 0x96,
+    0x00, 0x00, 0x3E, 0x00, 0x2D, 0x00, 0x14, 0x00, 0x07, 0x42, 0x21, 0x23, 0x39, 0x34, 0x96, 0x6F,
+    0x43, 0x14, 0x15, 0x40, 0x96, 0x1A, 0x81, 0xBA, 0x07, 0x31, 0xC2, 0x20, 0x23, 0x55, 0x98, 0x6E,
+    0xA5, 0x43, 0x0B, 0x21, 0x23, 0x77, 0xD2, 0x96, 0x91, 0x00, 0x07, 0x41, 0x07, 0x69, 0x6E, 0xC2,
+    0x0A, 0x32, 0x7C, 0x1B, 0x96, 0x9F, 0x41, 0x13, 0x24, 0x49, 0x21, 0x31, 0x04, 0xA1, 0x1A, 0x03,
+    0x21, 0x08, 0x03, 0x43, 0x23, 0x32, 0x34, 0x7B, 0xC3, 0x96, 0x6D, 0x00, 0x03, 0x43, 0x01, 0x30,
+    0x33, 0x00, 0x0A, 0x96, 0xBD, 0x96, 0xBD, 0x41, 0x13, 0x38, 0x6E, 0x43, 0x14, 0x20, 0x21, 0x81,
+    0xF4, 0x77, 0xFB, 0x00, 0x04, 0x47, 0x0A, 0x14, 0x15, 0x21, 0x23, 0x25, 0x27, 0x96, 0xD5, 0x00,
+    0x3A, 0x96, 0xD5, 0x00, 0x36, 0x00, 0x18, 0x96, 0x0F, 0x00, 0x0A, 0xC1, 0x27, 0x96, 0xA5, 0x21,
+    0x28, 0x04, 0x42, 0x19, 0x23, 0x00, 0x03, 0x96, 0x6D, 0x4F, 0x07, 0x0A, 0x15, 0x19, 0x21, 0x23,
+    0x27, 0x31, 0x32, 0x33, 0x34, 0x35, 0x38, 0x39, 0x40, 0x02, 0xB0, 0x96, 0x33, 0x02, 0xA6, 0x02,
+    0x3F, 0x96, 0xF9, 0x01, 0x3C, 0x01, 0x2B, 0x00, 0xF0, 0x00, 0x93, 0x00, 0x80, 0x00, 0x79, 0x00,
+    0x68, 0x00, 0x24, 0x96, 0xE6, 0x00, 0x07, 0x41, 0x38, 0x8B, 0xB3, 0x42, 0x01, 0x27, 0x97, 0x2B,
+    0x63, 0xCA, 0x41, 0x41, 0x6B, 0x6B, 0x21, 0x32, 0x04, 0x21, 0x49, 0x03, 0x42, 0x02, 0x04, 0x96,
+    0xD6, 0x00, 0x03, 0x41, 0x27, 0x5E, 0x4A, 0x21, 0x49, 0x04, 0x21, 0x01, 0x03, 0xC8, 0x04, 0x08,
+    0x15, 0x23, 0x2B, 0x38, 0x40, 0x41, 0x00, 0x26, 0x97, 0x49, 0x63, 0x73, 0x61, 0x11, 0x00, 0x22,
+    0x96, 0xEF, 0x00, 0x11, 0x00, 0x03, 0x41, 0x25, 0x64, 0x76, 0xC2, 0x32, 0x40, 0x97, 0x6A, 0x00,
+    0x04, 0x41, 0x23, 0x77, 0xA4, 0x21, 0x32, 0x04, 0x41, 0x28, 0x95, 0xC6, 0x21, 0x22, 0x04, 0x21,
+    0x31, 0x03, 0x41, 0x32, 0x94, 0x13, 0x41, 0x2B, 0x67, 0x70, 0x21, 0x32, 0x04, 0x42, 0x10, 0x48,
+    0x95, 0x7E, 0x00, 0x03, 0x41, 0x01, 0x96, 0x92, 0x21, 0x34, 0x04, 0x21, 0x15, 0x03, 0x21, 0x32,
+    0x03, 0xA1, 0x27, 0x03, 0x21, 0x10, 0x03, 0x41, 0x35, 0x87, 0x4C, 0x21, 0x2A, 0x04, 0x21, 0x0A,
+    0x03, 0x22, 0x31, 0x32, 0x0D, 0x03, 0x41, 0x21, 0x6C, 0x0B, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x18, 0x03, 0x21, 0x35, 0x03, 0x21, 0x23, 0x03, 0x41, 0x02, 0x70, 0x87, 0x21, 0x19, 0x04,
+    0x21, 0x2D, 0x03, 0x21, 0x48, 0x03, 0x21, 0x37, 0x03, 0x21, 0x02, 0x03, 0x41, 0x19, 0x62, 0xB4,
+    0x21, 0x34, 0x04, 0x21, 0x21, 0x03, 0x21, 0x34, 0x03, 0x21, 0x08, 0x03, 0x21, 0x2E, 0x03, 0x42,
+    0x0A, 0x17, 0x00, 0x73, 0x97, 0x34, 0xD0, 0x01, 0x0A, 0x19, 0x1A, 0x1B, 0x1E, 0x23, 0x27, 0x28,
+    0x2A, 0x2B, 0x32, 0x34, 0x40, 0x42, 0x44, 0x00, 0x81, 0x00, 0x77, 0x00, 0x74, 0x7D, 0x72, 0x00,
+    0x69, 0x01, 0xD9, 0x00, 0x45, 0x56, 0x42, 0x00, 0x30, 0x51, 0xA1, 0x6F, 0xAC, 0x6E, 0xF9, 0x72,
+    0x8C, 0x00, 0x1D, 0x00, 0x0A, 0x00, 0x07, 0x41, 0x19, 0x6F, 0x2A, 0x44, 0x23, 0x2A, 0x34, 0x40,
+    0x00, 0x35, 0x76, 0xCE, 0x00, 0x04, 0x7C, 0x16, 0x42, 0x23, 0x38, 0x7B, 0x58, 0x5B, 0xA2, 0x43,
+    0x30, 0x32, 0x38, 0x91, 0xA4, 0x97, 0xE1, 0x4D, 0x5B, 0x41, 0x27, 0x98, 0x2D, 0x21, 0x32, 0x04,
+    0x21, 0x22, 0x03, 0x41, 0x1E, 0x4D, 0x6F, 0xC7, 0x04, 0x19, 0x1E, 0x23, 0x25, 0x40, 0x42, 0x00,
+    0x1F, 0x3C, 0xF1, 0x00, 0x18, 0x8F, 0x09, 0x3F, 0xDB, 0x00, 0x07, 0x00, 0x04, 0xC2, 0x17, 0x23,
+    0x6A, 0xB8, 0x7C, 0xEA, 0xA1, 0x35, 0x07, 0x41, 0x35, 0x72, 0xA5, 0x46, 0x1A, 0x23, 0x25, 0x34,
+    0x40, 0x4C, 0x96, 0xC6, 0x00, 0x04, 0x97, 0xB5, 0x98, 0x7B, 0x13, 0x5E, 0x98, 0x7B, 0x42, 0x15,
+    0x17, 0x98, 0x25, 0x00, 0x13, 0xC1, 0x19, 0x90, 0xEE, 0x41, 0x0E, 0x98, 0x3B, 0x43, 0x25, 0x27,
+    0x31, 0x98, 0x9D, 0x98, 0x93, 0x98, 0x64, 0x41, 0x18, 0x5C, 0x18, 0x21, 0x0A, 0x04, 0x21, 0x32,
+    0x03, 0xA1, 0x23, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x19, 0x03, 0x21, 0x15, 0x03, 0x21, 0x31, 0x03,
+    0x41, 0x01, 0x93, 0xFE, 0xC9, 0x01, 0x04, 0x19, 0x1B, 0x1E, 0x21, 0x23, 0x28, 0x40, 0x95, 0x59,
+    0x88, 0x0C, 0x75, 0xEC, 0x00, 0x2B, 0x00, 0x27, 0x98, 0x3C, 0x00, 0x07, 0x22, 0x28, 0x00, 0x04,
+    0xC3, 0x01, 0x25, 0x28, 0x98, 0x58, 0x7D, 0x5D, 0x74, 0x5F, 0xC6, 0x08, 0x14, 0x21, 0x27, 0x28,
+    0x32, 0x98, 0xA4, 0x98, 0x8C, 0x02, 0x23, 0x67, 0x49, 0x89, 0x5F, 0x00, 0x0A, 0x42, 0x30, 0x49,
+    0x6D, 0x60, 0x98, 0xF0, 0x41, 0x32, 0x92, 0x7A, 0x41, 0x2A, 0x97, 0xCD, 0xCE, 0x02, 0x04, 0x0A,
+    0x19, 0x1A, 0x1C, 0x1E, 0x27, 0x2A, 0x2B, 0x31, 0x32, 0x41, 0x44, 0x91, 0xD3, 0x8E, 0x75, 0x00,
+    0x0F, 0x00, 0x08, 0x8C, 0xFC, 0x8C, 0x78, 0x91, 0x2A, 0x98, 0x03, 0x7C, 0xFE, 0x3E, 0xB8, 0x00,
+    0x04, 0x5A, 0x77, 0x6D, 0x45, 0x85, 0xA4, 0x42, 0x19, 0x31, 0x95, 0xCC, 0x88, 0x72, 0x42, 0x19,
+    0x23, 0x95, 0x19, 0x99, 0x3E, 0xA1, 0x32, 0x07, 0x42, 0x16, 0x22, 0x99, 0x48, 0x99, 0x47, 0x21,
+    0x32, 0x07, 0x42, 0x14, 0x32, 0x98, 0x8C, 0x98, 0xF4, 0x41, 0x06, 0x99, 0x3D, 0x21, 0x04, 0x04,
+    0x21, 0x31, 0x03, 0x21, 0x22, 0x03, 0x41, 0x07, 0x64, 0x3E, 0x42, 0x34, 0x35, 0x00, 0x04, 0x64,
+    0x42, 0x42, 0x1B, 0x27, 0x99, 0x71, 0x7E, 0x4C, 0x21, 0x34, 0x07, 0xC3, 0x01, 0x17, 0x18, 0x99,
+    0x35, 0x99, 0x35, 0x00, 0x03, 0xC2, 0x23, 0x27, 0x99, 0x85, 0x99, 0x3F, 0x43, 0x19, 0x22, 0x28,
+    0x74, 0x26, 0x99, 0x8C, 0x00, 0x07, 0x41, 0x0A, 0x73, 0xC4, 0x21, 0x27, 0x04, 0xC2, 0x40, 0x41,
+    0x00, 0x03, 0x47, 0x0A, 0xCA, 0x01, 0x19, 0x1A, 0x1E, 0x23, 0x2A, 0x32, 0x34, 0x35, 0x40, 0x00,
+    0x5F, 0x00, 0x55, 0x00, 0x52, 0x00, 0x41, 0x71, 0xBF, 0x00, 0x3A, 0x00, 0x29, 0x00, 0x18, 0x00,
+    0x07, 0x7A, 0xA6, 0x41, 0x2B, 0x76, 0xEB, 0x41, 0x22, 0x8A, 0x5A, 0x43, 0x25, 0x32, 0x34, 0x99,
+    0xCB, 0x89, 0x17, 0x96, 0xBD, 0x42, 0x17, 0x1A, 0x96, 0xA2, 0x99, 0x50, 0x4A, 0x04, 0x14, 0x15,
+    0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x40, 0x42, 0x00, 0x19, 0x97, 0xCD, 0x00, 0x15, 0x7B, 0xED, 0x00,
+    0x8A, 0x99, 0xDC, 0x99, 0x81, 0x00, 0x11, 0x00, 0x07, 0x61, 0x2D, 0x41, 0x19, 0x8A, 0x21, 0x42,
+    0x32, 0x34, 0x23, 0xA3, 0x00, 0x04, 0xC4, 0x23, 0x30, 0x32, 0x34, 0x7F, 0x16, 0x9A, 0x06, 0x99,
+    0xC0, 0x97, 0xD5, 0x41, 0x2B, 0x96, 0xA8, 0x42, 0x23, 0x38, 0x00, 0x04, 0x89, 0x63, 0x42, 0x15,
+    0x22, 0x9A, 0x1E, 0x97, 0xF4, 0x21, 0x34, 0x07, 0x41, 0x18, 0x9A, 0x0F, 0x41, 0x39, 0x5F, 0x51,
+    0x21, 0x0A, 0x04, 0x21, 0x32, 0x03, 0x21, 0x23, 0x03, 0x21, 0x17, 0x03, 0x21, 0x19, 0x03, 0xC3,
+    0x34, 0x35, 0x38, 0x00, 0x03, 0x9A, 0x3F, 0x98, 0xB7, 0xC1, 0x19, 0x8F, 0x9B, 0x41, 0x15, 0x8F,
+    0xE3, 0x21, 0x31, 0x04, 0x41, 0x14, 0x8D, 0x5D, 0x21, 0x23, 0x04, 0x41, 0x2D, 0x99, 0x4F, 0x42,
+    0x2D, 0x30, 0x9A, 0x0A, 0x00, 0x04, 0xC5, 0x08, 0x17, 0x19, 0x25, 0x2B, 0x74, 0xF9, 0x99, 0x5A,
+    0x00, 0x0E, 0x00, 0x07, 0x9A, 0x5C, 0x41, 0x01, 0x7F, 0x82, 0x21, 0x15, 0x04, 0x41, 0x27, 0x7C,
+    0x8E, 0x22, 0x01, 0x25, 0x04, 0x6E, 0xD0, 0x01, 0x04, 0x0A, 0x14, 0x17, 0x19, 0x1B, 0x1E, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x31, 0x32, 0x42, 0x00, 0x80, 0x00, 0x6F, 0x97, 0x74, 0x9A, 0x86, 0x7B,
+    0x5E, 0x00, 0x61, 0x01, 0xED, 0x00, 0x5E, 0x00, 0x47, 0x00, 0x3D, 0x00, 0x35, 0x00, 0x20, 0x09,
+    0x53, 0x00, 0x0C, 0x80, 0xFA, 0x00, 0x05, 0x43, 0x14, 0x19, 0x23, 0x9A, 0xB6, 0x9A, 0xB7, 0x97,
+    0xD3, 0x42, 0x32, 0x38, 0x00, 0x0A, 0x97, 0xB3, 0x42, 0x01, 0x1B, 0x99, 0x90, 0x9A, 0xC8, 0x42,
+    0x23, 0x2D, 0x9A, 0xB6, 0x9A, 0xCE, 0x41, 0x35, 0x97, 0xC8, 0xC6, 0x04, 0x08, 0x0A, 0x16, 0x23,
+    0x43, 0x00, 0x0B, 0x9A, 0xD6, 0x9A, 0x7F, 0x5A, 0x89, 0x00, 0x04, 0x98, 0xA9, 0x42, 0x34, 0x49,
+    0x9A, 0xB4, 0x9A, 0xB4, 0x41, 0x23, 0x79, 0xA8, 0x42, 0x17, 0x23, 0x00, 0x04, 0x9A, 0xEE, 0xC6,
+    0x01, 0x19, 0x27, 0x40, 0x42, 0x43, 0x00, 0x12, 0x9A, 0xFE, 0x99, 0xFD, 0x97, 0xBB, 0x00, 0x07,
+    0x98, 0xCE, 0x42, 0x1A, 0x49, 0x9B, 0x12, 0x92, 0xF1, 0xA1, 0x19, 0x07, 0xC1, 0x2D, 0x9A, 0xBE,
+    0x41, 0x08, 0x9A, 0xB1, 0x21, 0x40, 0x04, 0x21, 0x35, 0x03, 0x41, 0x27, 0x86, 0x7C, 0x44, 0x21,
+    0x23, 0x27, 0x40, 0x00, 0x12, 0x9B, 0x15, 0x00, 0x07, 0x00, 0x04, 0x21, 0x4C, 0x0D, 0xC6, 0x01,
+    0x07, 0x15, 0x19, 0x1A, 0x23, 0x00, 0x64, 0x9B, 0x3E, 0x9B, 0x3E, 0x00, 0x3F, 0x00, 0x25, 0x00,
+    0x03, 0x41, 0x19, 0x96, 0xC7, 0x41, 0x1B, 0x59, 0x8F, 0xA2, 0x41, 0x42, 0x08, 0x04, 0x41, 0x2C,
+    0x9A, 0xF8, 0x43, 0x30, 0x32, 0x35, 0x9B, 0x62, 0x9B, 0x1C, 0x00, 0x04, 0x43, 0x27, 0x34, 0x38,
+    0x7E, 0xB4, 0x9B, 0x33, 0x7E, 0x90, 0xC1, 0x1A, 0x9B, 0x76, 0x43, 0x19, 0x27, 0x37, 0x99, 0x6B,
+    0x9B, 0x2B, 0x97, 0x62, 0x43, 0x17, 0x23, 0x25, 0x9A, 0xFF, 0x9B, 0x15, 0x9B, 0x7A, 0xCD, 0x01,
+    0x02, 0x07, 0x15, 0x1A, 0x1E, 0x23, 0x28, 0x29, 0x2A, 0x2B, 0x40, 0x42, 0x00, 0x2C, 0x5E, 0x25,
+    0x9B, 0x33, 0x98, 0x23, 0x00, 0x22, 0x59, 0x08, 0x00, 0x18, 0x7B, 0xC4, 0x9A, 0xD6, 0x00, 0x14,
+    0x9A, 0x16, 0x00, 0x0A, 0x6C, 0xC9, 0x41, 0x04, 0x59, 0xAB, 0xC2, 0x14, 0x41, 0x9B, 0x54, 0x6B,
+    0xE1, 0x42, 0x38, 0x4C, 0x9B, 0xA5, 0x9B, 0xC1, 0x21, 0x16, 0x07, 0x42, 0x32, 0x4C, 0x9A, 0x90,
+    0x9B, 0xCB, 0xC3, 0x19, 0x32, 0x34, 0x00, 0x07, 0x9B, 0xD2, 0x9B, 0xD2, 0x21, 0x17, 0x0A, 0xC1,
+    0x16, 0x99, 0x93, 0x42, 0x32, 0x4C, 0x9B, 0xE3, 0x9A, 0xBB, 0xC2, 0x19, 0x27, 0x00, 0x07, 0x99,
+    0x5A, 0xC1, 0x40, 0x7B, 0xD0, 0x41, 0x0B, 0x9B, 0xA0, 0xC2, 0x0B, 0x40, 0x9B, 0x33, 0x9A, 0xED,
+    0x42, 0x07, 0x19, 0x9C, 0x00, 0x00, 0x07, 0xC1, 0x41, 0x9B, 0xA9, 0x21, 0x19, 0x04, 0x51, 0x01,
+    0x02, 0x04, 0x07, 0x08, 0x0F, 0x11, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x27, 0x2A, 0x48, 0x49,
+    0x00, 0x80, 0x9C, 0x0E, 0x9C, 0x0E, 0x00, 0x58, 0x9C, 0x0E, 0x9C, 0x0E, 0x9C, 0x0E, 0x00, 0x54,
+    0x00, 0x46, 0x00, 0x32, 0x00, 0x2F, 0x2B, 0x2D, 0x00, 0x24, 0x00, 0x1D, 0x00, 0x19, 0x00, 0x0E,
+    0x00, 0x03, 0x41, 0x2B, 0x9A, 0x90, 0x21, 0x32, 0x04, 0x21, 0x2A, 0x03, 0xC3, 0x1A, 0x25, 0x32,
+    0x86, 0x29, 0x9C, 0x3F, 0x00, 0x03, 0x41, 0x34, 0x54, 0x1F, 0x42, 0x23, 0x31, 0x9C, 0x59, 0x9C,
+    0x59, 0x41, 0x23, 0x66, 0x9E, 0x21, 0x42, 0x04, 0x21, 0x07, 0x03, 0x21, 0x48, 0x03, 0xC3, 0x27,
+    0x32, 0x38, 0x9B, 0xB3, 0x7F, 0xB6, 0x00, 0x03, 0x41, 0x27, 0x44, 0x7E, 0x21, 0x38, 0x04, 0xC9,
+    0x19, 0x1A, 0x1B, 0x23, 0x25, 0x2A, 0x32, 0x35, 0x40, 0x00, 0x29, 0x9B, 0xF7, 0x00, 0x25, 0x00,
+    0x11, 0x9A, 0xE8, 0x00, 0x03, 0x3C, 0x42, 0x9C, 0x7F, 0x52, 0x1E, 0x41, 0x33, 0x7D, 0x12, 0x44,
+    0x27, 0x2D, 0x39, 0x49, 0x9C, 0x41, 0x9C, 0x95, 0x9C, 0x66, 0x00, 0x04, 0x43, 0x21, 0x2D, 0x33,
+    0x9C, 0xAC, 0x9C, 0xA2, 0x9C, 0xAC, 0x41, 0x07, 0x8B, 0xF5, 0x42, 0x25, 0x2D, 0x95, 0x6E, 0x9C,
+    0xB9, 0xC1, 0x48, 0x9C, 0x88, 0x42, 0x19, 0x2D, 0x98, 0xAD, 0x00, 0x04, 0xD0, 0x07, 0x08, 0x0A,
+    0x14, 0x19, 0x1E, 0x1F, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x43, 0x44, 0x93, 0x7E, 0x9A,
+    0x4F, 0x9C, 0x06, 0x95, 0xDE, 0x00, 0x2D, 0x9B, 0x7A, 0x98, 0x0A, 0x00, 0x20, 0x98, 0xBE, 0x80,
+    0xBE, 0x00, 0x16, 0x9A, 0xA2, 0x00, 0x12, 0x00, 0x07, 0x9C, 0x93, 0x89, 0x64, 0x41, 0x2B, 0x45,
+    0x3C, 0x21, 0x30, 0x04, 0x42, 0x32, 0x35, 0x9D, 0x04, 0x9D, 0x04, 0xC1, 0x23, 0x82, 0x1B, 0x41,
+    0x34, 0x2B, 0x2D, 0xC3, 0x01, 0x22, 0x28, 0x00, 0x08, 0x9D, 0x13, 0x00, 0x04, 0xC4, 0x33, 0x35,
+    0x39, 0x49, 0x9D, 0x1D, 0x9D, 0x1D, 0x9C, 0xE4, 0x95, 0x3B, 0x41, 0x39, 0x9B, 0xB2, 0xC3, 0x27,
+    0x2D, 0x35, 0x9C, 0x68, 0x9D, 0x24, 0x9D, 0x2E, 0x42, 0x15, 0x1B, 0x9C, 0x33, 0x9B, 0xFD, 0xC2,
+    0x0A, 0x1E, 0x78, 0x5F, 0x45, 0x45, 0xC5, 0x19, 0x31, 0x32, 0x44, 0x49, 0x9B, 0x37, 0x00, 0x0E,
+    0x00, 0x07, 0x1D, 0x51, 0x99, 0x38, 0x42, 0x23, 0x35, 0x9B, 0x33, 0x9D, 0x56, 0x41, 0x01, 0x8B,
+    0xBC, 0x21, 0x32, 0x04, 0x42, 0x01, 0x07, 0x54, 0xEF, 0x3F, 0x31, 0x41, 0x01, 0x82, 0x7B, 0x21,
+    0x38, 0x04, 0x41, 0x18, 0x9C, 0xB7, 0x21, 0x44, 0x04, 0x21, 0x34, 0x03, 0x22, 0x19, 0x20, 0x0D,
+    0x03, 0x41, 0x1D, 0x9D, 0x77, 0xC9, 0x01, 0x18, 0x19, 0x1A, 0x1B, 0x2A, 0x32, 0x41, 0x44, 0x9D,
+    0x3F, 0x82, 0x91, 0x9D, 0x85, 0x9C, 0xCD, 0x00, 0x24, 0x00, 0x21, 0x00, 0x09, 0x00, 0x04, 0x00,
+    0x13, 0x42, 0x38, 0x48, 0x9D, 0x68, 0x9D, 0x3B, 0xC8, 0x01, 0x07, 0x08, 0x17, 0x18, 0x34, 0x40,
+    0x42, 0x9D, 0xA8, 0x9D, 0x4D, 0x9D, 0x98, 0x00, 0x07, 0x9D, 0x9E, 0x8C, 0x07, 0x9A, 0x64, 0x8F,
+    0xA0, 0xC1, 0x20, 0x9D, 0x9C, 0x21, 0x4C, 0x04, 0x21, 0x13, 0x03, 0xA1, 0x22, 0x03, 0x42, 0x32,
+    0x35, 0x00, 0x03, 0x9C, 0xF8, 0xC3, 0x32, 0x34, 0x35, 0x9D, 0xD5, 0x96, 0x0B, 0x9D, 0xD5, 0x43,
+    0x27, 0x32, 0x34, 0x9D, 0xA6, 0x9D, 0xDF, 0x9D, 0xDE, 0x42, 0x01, 0x40, 0x9D, 0x83, 0x9D, 0xE8,
+    0x42, 0x34, 0x35, 0x00, 0x07, 0x9D, 0xF0, 0x41, 0x39, 0x2B, 0x18, 0x44, 0x0A, 0x19, 0x23, 0x27,
+    0x8B, 0x31, 0x9D, 0xFA, 0x9D, 0x76, 0x9D, 0x76, 0x42, 0x01, 0x2B, 0x9E, 0x08, 0x88, 0xC3, 0xDC,
+    0x01, 0x04, 0x07, 0x08, 0x0B, 0x0F, 0x11, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x20, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2C, 0x2D, 0x40, 0x41, 0x42, 0x01, 0xC3, 0x01, 0x90,
+    0x01, 0x43, 0x01, 0x0E, 0x01, 0x0B, 0x00, 0xFC, 0x5E, 0xFF, 0x00, 0xF2, 0x00, 0xE5, 0x9E, 0x0F,
+    0x00, 0xE1, 0x00, 0xC9, 0x36, 0x14, 0x00, 0xB9, 0x4A, 0x97, 0x00, 0x8A, 0x00, 0x67, 0x00, 0x41,
+    0x9D, 0x49, 0x00, 0x3A, 0x9E, 0x0F, 0x00, 0x30, 0x56, 0x88, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x14,
+    0x00, 0x07, 0x9D, 0xD6, 0x42, 0x21, 0x37, 0x82, 0xE1, 0x9A, 0x4C, 0x41, 0x2A, 0x6D, 0xDC, 0xC7,
+    0x08, 0x17, 0x1E, 0x23, 0x2A, 0x41, 0x44, 0x90, 0x8E, 0x9E, 0x62, 0x9E, 0x09, 0x93, 0x1D, 0x00,
+    0x0B, 0x00, 0x04, 0x7E, 0xCD, 0xC1, 0x2D, 0x65, 0x50, 0x41, 0x01, 0x9D, 0x80, 0x21, 0x32, 0x04,
+    0x43, 0x22, 0x23, 0x40, 0x9E, 0x90, 0x00, 0x03, 0x5B, 0x6C, 0x41, 0x04, 0x67, 0x4E, 0x45, 0x02,
+    0x23, 0x32, 0x40, 0x42, 0x9B, 0x33, 0x00, 0x19, 0x00, 0x0E, 0x79, 0x5E, 0x00, 0x04, 0x41, 0x23,
+    0x93, 0xBE, 0x21, 0x2A, 0x04, 0x21, 0x33, 0x03, 0x41, 0x48, 0x6A, 0x5D, 0x21, 0x35, 0x04, 0x41,
+    0x2D, 0x9A, 0x01, 0x21, 0x33, 0x04, 0x21, 0x49, 0x03, 0x41, 0x44, 0x89, 0x53, 0x21, 0x16, 0x04,
+    0x41, 0x40, 0x9D, 0xC4, 0x21, 0x19, 0x04, 0x21, 0x15, 0x03, 0x21, 0x07, 0x03, 0x21, 0x32, 0x03,
+    0x21, 0x49, 0x03, 0x21, 0x23, 0x03, 0xA5, 0x04, 0x17, 0x19, 0x23, 0x2A, 0x31, 0x2A, 0x20, 0x19,
+    0x03, 0x41, 0x19, 0x66, 0x57, 0xC2, 0x30, 0x34, 0x9E, 0xF5, 0x9B, 0xE7, 0x41, 0x2B, 0x9E, 0xFB,
+    0x45, 0x21, 0x23, 0x2A, 0x2B, 0x32, 0x00, 0x1A, 0x00, 0x0F, 0x9E, 0xE4, 0x00, 0x0B, 0x00, 0x04,
+    0x41, 0x38, 0x40, 0xDD, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0xC2, 0x08, 0x28, 0x00, 0x03, 0x54,
+    0x6F, 0x41, 0x23, 0x7E, 0x66, 0x21, 0x34, 0x04, 0xC1, 0x49, 0x9E, 0xC2, 0xC3, 0x17, 0x2A, 0x4C,
+    0x9E, 0xD1, 0x9D, 0xF4, 0x9F, 0x2C, 0xC2, 0x13, 0x23, 0x9F, 0x1A, 0x9D, 0x27, 0x42, 0x23, 0x32,
+    0x00, 0x07, 0x8D, 0x1C, 0x41, 0x0D, 0x59, 0xC9, 0x21, 0x0D, 0x04, 0x42, 0x31, 0x38, 0x00, 0x03,
+    0x13, 0xE8, 0x41, 0x32, 0x6F, 0xC2, 0x41, 0x32, 0x52, 0xE0, 0x21, 0x22, 0x04, 0x21, 0x17, 0x03,
+    0x21, 0x34, 0x03, 0x41, 0x0A, 0x52, 0xED, 0x21, 0x27, 0x04, 0xC8, 0x01, 0x18, 0x19, 0x1A, 0x20,
+    0x27, 0x28, 0x40, 0x00, 0x2D, 0x84, 0x76, 0x83, 0xE7, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x0A, 0x8D,
+    0x4C, 0x00, 0x03, 0xA2, 0x22, 0x34, 0x57, 0x19, 0x41, 0x28, 0x96, 0xFE, 0xC2, 0x23, 0x32, 0x00,
+    0x04, 0x9F, 0x8C, 0x42, 0x06, 0x19, 0x9F, 0x93, 0x9F, 0x93, 0x43, 0x23, 0x31, 0x32, 0x00, 0x0E,
+    0x8C, 0x26, 0x00, 0x07, 0x42, 0x32, 0x34, 0x9F, 0x6B, 0x9F, 0xA4, 0x42, 0x30, 0x32, 0x9F, 0xAB,
+    0x9D, 0xAD, 0x44, 0x08, 0x17, 0x19, 0x2B, 0x9F, 0x4C, 0x9F, 0x4C, 0x00, 0x07, 0x5E, 0x0D, 0x41,
+    0x1B, 0x9A, 0x0D, 0xC1, 0x4C, 0x8D, 0xEF, 0x21, 0x18, 0x04, 0x21, 0x17, 0x03, 0x45, 0x08, 0x19,
+    0x1E, 0x31, 0x34, 0x95, 0x63, 0x9D, 0x66, 0x9F, 0x72, 0x00, 0x03, 0x9D, 0xCF, 0xC1, 0x23, 0x6A,
+    0x83, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0x41, 0x15, 0x81, 0x4D, 0x43, 0x19, 0x21, 0x34, 0x9B,
+    0xC6, 0x00, 0x07, 0x00, 0x04, 0x41, 0x34, 0x4B, 0xB4, 0x21, 0x15, 0x04, 0x46, 0x15, 0x21, 0x22,
+    0x31, 0x32, 0x38, 0x9F, 0xFC, 0x9F, 0xFC, 0x9F, 0xA1, 0x00, 0x03, 0x5A, 0x92, 0x9C, 0xEE, 0x41,
+    0x23, 0x8E, 0x60, 0x41, 0x02, 0x9F, 0xF7, 0x21, 0x01, 0x04, 0x21, 0x38, 0x03, 0x42, 0x31, 0x32,
+    0x9F, 0x62, 0x9E, 0x0E, 0x42, 0x13, 0x19, 0xA0, 0x24, 0xA0, 0x24, 0x43, 0x25, 0x32, 0x34, 0xA0,
+    0x2B, 0x00, 0x07, 0x9D, 0x1D, 0xC2, 0x21, 0x28, 0x84, 0xB2, 0x81, 0x9B, 0x41, 0x34, 0x53, 0xC6,
+    0x21, 0x15, 0x04, 0x42, 0x01, 0x18, 0xA0, 0x43, 0xA0, 0x27, 0x43, 0x01, 0x15, 0x17, 0x00, 0x0A,
+    0x7B, 0x6E, 0x00, 0x07, 0x42, 0x06, 0x17, 0x7C, 0x55, 0x7C, 0x55, 0x4B, 0x04, 0x0A, 0x17, 0x19,
+    0x20, 0x21, 0x31, 0x32, 0x38, 0x40, 0x42, 0x8F, 0xA3, 0x00, 0x4C, 0x00, 0x41, 0x00, 0x3E, 0x84,
+    0xD8, 0x00, 0x30, 0x35, 0x82, 0x00, 0x26, 0x00, 0x11, 0x5A, 0x8B, 0x00, 0x07, 0x41, 0x1A, 0xA0,
+    0x1F, 0xA1, 0x38, 0x04, 0x41, 0x2D, 0x9D, 0x9C, 0x21, 0x34, 0x04, 0x41, 0x14, 0x80, 0x66, 0x21,
+    0x42, 0x04, 0x21, 0x34, 0x03, 0x21, 0x25, 0x03, 0x22, 0x25, 0x32, 0x10, 0x03, 0x41, 0x40, 0x53,
+    0xB8, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x41, 0x35, 0x90, 0x87, 0x41, 0x23,
+    0x9A, 0xFC, 0x41, 0x34, 0x14, 0xFB, 0x21, 0x23, 0x04, 0x41, 0x4C, 0x90, 0x96, 0x21, 0x14, 0x04,
+    0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0x41, 0x2D, 0x80, 0xA1, 0x41, 0x4C, 0x91, 0x38, 0x21, 0x23,
+    0x04, 0x21, 0x2D, 0x03, 0x41, 0x15, 0x32, 0xFB, 0x42, 0x15, 0x2A, 0xA0, 0xD8, 0xA0, 0xD8, 0x42,
+    0x23, 0x2A, 0xA0, 0xC3, 0xA0, 0xDF, 0x21, 0x22, 0x07, 0x21, 0x35, 0x03, 0x21, 0x25, 0x03, 0x41,
+    0x4C, 0x41, 0x36, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x41, 0x25, 0x63, 0x53, 0x21, 0x27, 0x04,
+    0x21, 0x40, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x17, 0x03, 0x21, 0x32, 0x03, 0x41, 0x2E, 0xA0, 0x46,
+    0x21, 0x25, 0x04, 0x41, 0x34, 0x41, 0x8E, 0x21, 0x0B, 0x04, 0x21, 0x01, 0x03, 0x42, 0x15, 0x47,
+    0x67, 0x4D, 0x00, 0x03, 0x41, 0x25, 0x91, 0x0B, 0x21, 0x34, 0x04, 0x26, 0x04, 0x08, 0x0B, 0x14,
+    0x21, 0x27, 0x3F, 0x35, 0x22, 0x1B, 0x0E, 0x03, 0x41, 0x0A, 0x5E, 0xC6, 0x21, 0x40, 0x04, 0x21,
+    0x4C, 0x03, 0x21, 0x1B, 0x03, 0x41, 0x19, 0x31, 0x79, 0x22, 0x21, 0x42, 0x07, 0x04, 0x21, 0x2E,
+    0x05, 0x41, 0x23, 0xA0, 0xE2, 0x21, 0x40, 0x04, 0x21, 0x35, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x23,
+    0xA5, 0x22, 0x0B, 0x2D, 0x06, 0x03, 0x4F, 0x01, 0x04, 0x08, 0x0B, 0x15, 0x1A, 0x1F, 0x21, 0x22,
+    0x23, 0x31, 0x32, 0x40, 0x41, 0x44, 0x75, 0xC5, 0x00, 0xCE, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0xB8,
+    0x00, 0xB0, 0x00, 0xA3, 0x00, 0xA0, 0x00, 0x95, 0x96, 0x87, 0x00, 0x92, 0x00, 0x8E, 0x00, 0x3B,
+    0x00, 0x18, 0x00, 0x05, 0xC4, 0x01, 0x04, 0x0A, 0x17, 0xA1, 0x4E, 0x9F, 0x85, 0xA1, 0x36, 0x8C,
+    0xCE, 0x21, 0x32, 0x0D, 0x42, 0x01, 0x32, 0x86, 0xB4, 0x9F, 0xA6, 0x42, 0x0A, 0x22, 0xA1, 0xAB,
+    0xA1, 0xAB, 0x45, 0x20, 0x31, 0x32, 0x34, 0x35, 0xA1, 0xB2, 0x00, 0x07, 0x9F, 0xB4, 0x9E, 0xA4,
+    0x60, 0x5B, 0x41, 0x28, 0x82, 0x7C, 0xC2, 0x19, 0x27, 0xA1, 0xAA, 0x8F, 0xF5, 0x21, 0x28, 0x07,
+    0x45, 0x04, 0x17, 0x1E, 0x27, 0x2A, 0x43, 0xA3, 0x00, 0x0E, 0x9F, 0xD2, 0x00, 0x03, 0x56, 0xEC,
+    0x42, 0x23, 0x40, 0xA1, 0xE0, 0x20, 0xFA, 0x42, 0x18, 0x21, 0xA1, 0xE7, 0xA1, 0xE7, 0x43, 0x15,
+    0x1A, 0x23, 0x87, 0x80, 0xA0, 0xF8, 0x00, 0x07, 0x42, 0x0A, 0x18, 0xA1, 0xF8, 0xA1, 0xF8, 0x42,
+    0x15, 0x1A, 0x01, 0x82, 0xA1, 0xA1, 0x45, 0x01, 0x04, 0x23, 0x25, 0x2D, 0x00, 0x26, 0x00, 0x18,
+    0x00, 0x0E, 0x00, 0x07, 0xA2, 0x06, 0x43, 0x07, 0x21, 0x27, 0xA2, 0x16, 0xA2, 0x16, 0xA2, 0x16,
+    0x42, 0x21, 0x27, 0xA2, 0x20, 0xA2, 0x20, 0xDA, 0x01, 0x04, 0x07, 0x08, 0x0B, 0x14, 0x15, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x40, 0x42,
+    0x48, 0x49, 0x03, 0x89, 0x03, 0x27, 0xA2, 0x27, 0x03, 0x0D, 0x03, 0x02, 0x02, 0xFF, 0x02, 0xA4,
+    0x02, 0x8D, 0x02, 0x83, 0x02, 0x75, 0x9F, 0x15, 0x02, 0x68, 0x02, 0x5A, 0xA1, 0xC1, 0x02, 0x3C,
+    0x02, 0x2B, 0x01, 0xCC, 0x01, 0xA6, 0x00, 0xC1, 0x00, 0x86, 0x00, 0x83, 0x00, 0x75, 0x00, 0x57,
+    0x00, 0x21, 0x00, 0x11, 0x00, 0x07, 0x43, 0x08, 0x0A, 0x19, 0xA2, 0x30, 0xA2, 0x76, 0x84, 0x87,
+    0x41, 0x2D, 0xA2, 0x67, 0x21, 0x32, 0x04, 0x21, 0x2E, 0x03, 0x43, 0x2D, 0x32, 0x35, 0xA2, 0x51,
+    0x34, 0x07, 0x00, 0x03, 0x42, 0x19, 0x21, 0x77, 0x62, 0x77, 0x62, 0x21, 0x40, 0x07, 0x41, 0x21,
+    0x77, 0x6C, 0x21, 0x40, 0x04, 0x22, 0x34, 0x35, 0x0A, 0x03, 0x21, 0x14, 0x05, 0x21, 0x2D, 0x03,
+    0xC2, 0x19, 0x40, 0xA1, 0xAE, 0xA1, 0xA4, 0xC6, 0x15, 0x23, 0x2D, 0x42, 0x48, 0x49, 0x8D, 0xF1,
+    0x00, 0x41, 0x00, 0x2D, 0x00, 0x0A, 0x00, 0x07, 0xA2, 0xB7, 0xC4, 0x04, 0x14, 0x16, 0x2D, 0x9D,
+    0x9F, 0xA2, 0xB1, 0x76, 0x7C, 0x98, 0x8A, 0x43, 0x01, 0x07, 0x48, 0x00, 0x0D, 0xA2, 0xD7, 0xA2,
+    0xCD, 0xC2, 0x16, 0x19, 0x6F, 0xA3, 0xA0, 0xBE, 0xC6, 0x07, 0x0A, 0x14, 0x15, 0x48, 0x49, 0x00,
+    0x07, 0x2E, 0x77, 0xA2, 0xE8, 0xA2, 0xE8, 0x4D, 0x5B, 0xA2, 0x2D, 0x41, 0x1F, 0xA2, 0x95, 0x21,
+    0x25, 0x04, 0x21, 0x42, 0x03, 0x21, 0x27, 0x03, 0x21, 0x31, 0x03, 0x41, 0x0A, 0x90, 0xE0, 0x21,
+    0x01, 0x04, 0x21, 0x2D, 0x03, 0x45, 0x01, 0x19, 0x41, 0x48, 0x49, 0x00, 0x0D, 0xA3, 0x15, 0x00,
+    0x03, 0xA2, 0xDC, 0xA2, 0xDC, 0x41, 0x28, 0x9F, 0xE1, 0xC2, 0x27, 0x39, 0xA2, 0xE3, 0xA2, 0xE3,
+    0x21, 0x28, 0x07, 0x22, 0x04, 0x23, 0x0E, 0x03, 0x41, 0x14, 0xA1, 0x29, 0x43, 0x04, 0x22, 0x23,
+    0x7A, 0x3F, 0x8D, 0x41, 0x00, 0x04, 0x42, 0x04, 0x15, 0xA3, 0x46, 0xA3, 0x46, 0x21, 0x2D, 0x07,
+    0x41, 0x2D, 0x18, 0x8A, 0x21, 0x33, 0x04, 0x21, 0x49, 0x03, 0xA1, 0x19, 0x03, 0xC3, 0x0A, 0x19,
+    0x22, 0xA1, 0x3A, 0x00, 0x03, 0xA3, 0x5D, 0x43, 0x27, 0x2D, 0x32, 0xA1, 0x58, 0xA3, 0x5D, 0x00,
+    0x0A, 0xC3, 0x08, 0x19, 0x40, 0x86, 0x70, 0x9C, 0x83, 0x11, 0x4F, 0x41, 0x1E, 0x92, 0xC0, 0xC1,
+    0x19, 0xA0, 0xEF, 0x41, 0x2B, 0x08, 0x32, 0xC4, 0x19, 0x2B, 0x42, 0x43, 0x00, 0x0C, 0x00, 0x08,
+    0x00, 0x04, 0xA1, 0x56, 0x43, 0x07, 0x21, 0x22, 0x7E, 0x00, 0x00, 0x23, 0x00, 0x0D, 0x42, 0x23,
+    0x32, 0xA3, 0x4F, 0xA1, 0x8F, 0xC1, 0x41, 0x75, 0x77, 0x21, 0x07, 0x04, 0x21, 0x32, 0x03, 0x43,
+    0x23, 0x33, 0x49, 0x9C, 0xC1, 0xA3, 0xAF, 0x00, 0x03, 0x42, 0x19, 0x38, 0xA3, 0xB9, 0x9F, 0xA1,
+    0x42, 0x31, 0x36, 0x9F, 0xA8, 0xA1, 0xB1, 0x42, 0x34, 0x35, 0x9F, 0xAF, 0xA3, 0xC7, 0xC2, 0x22,
+    0x25, 0xA3, 0xCE, 0xA3, 0xCE, 0x43, 0x01, 0x31, 0x32, 0xA3, 0xD5, 0x9F, 0xBD, 0x00, 0x07, 0x42,
+    0x23, 0x48, 0xA3, 0xD5, 0xA3, 0x79, 0x43, 0x21, 0x27, 0x2D, 0xA3, 0xE6, 0xA3, 0x88, 0xA3, 0xDC,
+    0x43, 0x25, 0x32, 0x48, 0xA3, 0x8A, 0xA3, 0xA1, 0xA3, 0x8A, 0x42, 0x2D, 0x38, 0xA3, 0xF0, 0xA3,
+    0xFA, 0x42, 0x23, 0x4C, 0xA3, 0xE5, 0xA4, 0x01, 0x21, 0x15, 0x07, 0x44, 0x19, 0x31, 0x37, 0x39,
+    0x00, 0x03, 0xA3, 0xD2, 0xA3, 0xB6, 0xA4, 0x0A, 0x42, 0x32, 0x37, 0xA4, 0x18, 0xA3, 0xDF, 0x42,
+    0x07, 0x32, 0xA4, 0x1F, 0xA3, 0x64, 0x42, 0x19, 0x49, 0xA4, 0x26, 0xA3, 0xC0, 0x43, 0x04, 0x07,
+    0x21, 0xA3, 0x72, 0x89, 0xBF, 0xA3, 0xC7, 0x41, 0x41, 0x40, 0x6F, 0x21, 0x07, 0x04, 0x21, 0x47,
+    0x03, 0x42, 0x02, 0x23, 0x00, 0x03, 0xA3, 0xB0, 0x42, 0x1A, 0x2A, 0xA3, 0x8D, 0xA2, 0x39, 0x42,
+    0x17, 0x27, 0xA3, 0x94, 0xA4, 0x4F, 0xD8, 0x01, 0x02, 0x04, 0x0A, 0x0B, 0x14, 0x15, 0x17, 0x19,
+    0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00,
+    0xB8, 0x88, 0x48, 0x00, 0xA7, 0x00, 0x9D, 0x00, 0x96, 0x00, 0x8F, 0x00, 0x81, 0x00, 0x77, 0x00,
+    0x70, 0x00, 0x66, 0x00, 0x5C, 0x00, 0x4B, 0x00, 0x3E, 0x7D, 0xD3, 0x00, 0x37, 0x00, 0x30, 0x22,
+    0x69, 0x9C, 0x35, 0xA0, 0x3E, 0x00, 0x29, 0x00, 0x15, 0x00, 0x0E, 0xA2, 0x25, 0x00, 0x07, 0x43,
+    0x2D, 0x32, 0x33, 0x01, 0x0B, 0x44, 0x62, 0x00, 0x49, 0x5F, 0x20, 0x01, 0x02, 0x04, 0x07, 0x17,
+    0x19, 0x1A, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x27, 0x2B, 0x2C, 0x2D, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x38, 0x39, 0x40, 0x42, 0x47, 0x48, 0x49, 0x0D, 0x5C, 0x0D, 0x3F, 0x0C,
+    0x7E, 0x0C, 0x52, 0x0C, 0x35, 0x0C, 0x1B, 0x0C, 0x14, 0x0B, 0xE5, 0x0B, 0xBF, 0x0B, 0x9D, 0x0B,
+    0x72, 0x0B, 0x05, 0x0A, 0xCD, 0x0A, 0xAA, 0x0A, 0x23, 0x09, 0xE8, 0x09, 0xE1, 0x09, 0x6B, 0x09,
+    0x50, 0x08, 0x9B, 0x06, 0x9A, 0x06, 0x3A, 0x02, 0x82, 0x01, 0xF2, 0x01, 0xD2, 0x01, 0xC1, 0x01,
+    0x94, 0x01, 0x76, 0x01, 0x6D, 0x01, 0x5C, 0x01, 0x42, 0x00, 0x0A, 0x41, 0x23, 0x99, 0xB9, 0xA1,
+    0x1E, 0x04, 0x43, 0x0A, 0x32, 0x4C, 0xA4, 0x60, 0xA4, 0xCC, 0xA5, 0x12, 0x41, 0x38, 0x95, 0xAF,
+    0xA2, 0x01, 0x2A, 0x0E, 0x04, 0x41, 0x22, 0x86, 0x8F, 0x41, 0x14, 0x82, 0x11, 0xA1, 0x40, 0x04,
+    0x22, 0x40, 0x4C, 0x07, 0x03, 0x21, 0x23, 0x05, 0x21, 0x17, 0x03, 0x21, 0x19, 0x03, 0xC2, 0x1E,
+    0x28, 0x62, 0xB8, 0xA4, 0xF8, 0xC4, 0x02, 0x1A, 0x34, 0x35, 0x00, 0x20, 0xA3, 0x22, 0x00, 0x0A,
+    0x00, 0x07, 0x41, 0x25, 0x9F, 0xA0, 0x42, 0x27, 0x31, 0x9C, 0x08, 0x71, 0x75, 0x41, 0x01, 0x88,
+    0xA5, 0x41, 0x18, 0xA4, 0x23, 0x21, 0x32, 0x04, 0x21, 0x13, 0x03, 0x21, 0x23, 0x03, 0x44, 0x07,
+    0x23, 0x31, 0x32, 0x00, 0x11, 0x00, 0x03, 0x06, 0x26, 0xA3, 0x70, 0x42, 0x31, 0x49, 0x88, 0xC3,
+    0xA4, 0x6F, 0x42, 0x32, 0x40, 0xA5, 0x3C, 0x89, 0x6D, 0x41, 0x30, 0x52, 0x81, 0x21, 0x32, 0x04,
+    0x21, 0x1E, 0x03, 0x43, 0x09, 0x1E, 0x23, 0x00, 0x03, 0x6F, 0x1B, 0xA5, 0x0E, 0xC9, 0x01, 0x04,
+    0x08, 0x19, 0x1A, 0x23, 0x27, 0x28, 0x40, 0x00, 0x4B, 0x00, 0x47, 0xA5, 0x57, 0x9E, 0xAF, 0x00,
+    0x2F, 0x00, 0x22, 0x00, 0x1B, 0xA3, 0xEB, 0x00, 0x0A, 0xC2, 0x1A, 0x21, 0xA5, 0x5E, 0xA5, 0xB9,
+    0x42, 0x17, 0x21, 0x93, 0xF6, 0x5B, 0x71, 0x21, 0x34, 0x07, 0xA1, 0x1E, 0x03, 0x21, 0x23, 0x03,
+    0x42, 0x15, 0x18, 0x00, 0x03, 0xA5, 0xD0, 0x21, 0x34, 0x07, 0x41, 0x10, 0x91, 0x14, 0x21, 0x31,
+    0x04, 0x41, 0x15, 0x6D, 0x47, 0xC3, 0x18, 0x2D, 0x31, 0x10, 0xE0, 0x00, 0x07, 0x00, 0x04, 0x45,
+    0x07, 0x16, 0x1A, 0x27, 0x38, 0xA5, 0xEF, 0x93, 0xCE, 0xA5, 0xEF, 0xA1, 0xD7, 0xA5, 0xEF, 0x42,
+    0x28, 0x4C, 0x93, 0xE1, 0xA5, 0xFF, 0x21, 0x29, 0x07, 0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0x45,
+    0x01, 0x04, 0x18, 0x19, 0x23, 0xA4, 0xD7, 0xA4, 0x00, 0xA4, 0xD1, 0x08, 0xA0, 0x00, 0x03, 0xA1,
+    0x32, 0x10, 0xC2, 0x01, 0x28, 0xA6, 0x22, 0x81, 0xB5, 0x21, 0x32, 0x07, 0xC2, 0x10, 0x17, 0xA5,
+    0xD1, 0xA5, 0x20, 0x42, 0x14, 0x1A, 0x00, 0x07, 0xA6, 0x33, 0x44, 0x21, 0x31, 0x32, 0x38, 0xA6,
+    0x3A, 0x00, 0x07, 0xA6, 0x01, 0xA6, 0x39, 0x42, 0x32, 0x34, 0xA6, 0x47, 0xA3, 0x39, 0xC1, 0x1E,
+    0x19, 0xDB, 0xC5, 0x0A, 0x15, 0x1A, 0x40, 0x4C, 0x00, 0x0B, 0x00, 0x04, 0x82, 0x49, 0x3B, 0xBF,
+    0xA6, 0x52, 0xC1, 0x01, 0xA6, 0x46, 0x42, 0x01, 0x22, 0xA5, 0xDE, 0xA6, 0x66, 0x22, 0x07, 0x32,
+    0x0B, 0x07, 0x41, 0x31, 0x34, 0x90, 0xA1, 0x01, 0x04, 0x21, 0x22, 0x03, 0x43, 0x31, 0x32, 0x38,
+    0x00, 0x03, 0xA5, 0xC1, 0xA6, 0x7C, 0x41, 0x31, 0xA4, 0x88, 0x44, 0x1A, 0x1E, 0x21, 0x32, 0xA6,
+    0x8A, 0xA6, 0x8A, 0xA6, 0x8A, 0x9D, 0xC9, 0x41, 0x32, 0x9D, 0xD6, 0x43, 0x08, 0x17, 0x25, 0xA1,
+    0x70, 0xA6, 0x35, 0xA6, 0x91, 0x41, 0x25, 0xA4, 0x96, 0x4E, 0x01, 0x08, 0x13, 0x14, 0x16, 0x17,
+    0x1E, 0x22, 0x25, 0x29, 0x2A, 0x2B, 0x40, 0x42, 0x60, 0x1A, 0x00, 0xBA, 0x00, 0x8A, 0x00, 0x80,
+    0xA6, 0x63, 0x00, 0x6F, 0x00, 0x57, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x23, 0x00, 0x1F, 0x00, 0x12,
+    0x00, 0x0E, 0x00, 0x04, 0x41, 0x25, 0x92, 0x0E, 0x21, 0x2D, 0x04, 0x21, 0x04, 0x03, 0x21, 0x40,
+    0x03, 0x41, 0x1A, 0x96, 0xC4, 0x21, 0x41, 0x04, 0x42, 0x0B, 0x44, 0xA6, 0xCC, 0x85, 0x37, 0x23,
+    0x04, 0x14, 0x19, 0x11, 0x0A, 0x07, 0x41, 0x0B, 0x05, 0xFD, 0x21, 0x40, 0x04, 0x41, 0x19, 0x71,
+    0xA3, 0x44, 0x14, 0x28, 0x2A, 0x48, 0xA7, 0x01, 0x0E, 0xB8, 0x00, 0x07, 0x00, 0x04, 0x42, 0x25,
+    0x40, 0xA7, 0x0E, 0x6D, 0xC8, 0x21, 0x34, 0x07, 0x42, 0x2D, 0x40, 0x36, 0xCA, 0x69, 0xC7, 0xC5,
+    0x01, 0x07, 0x0B, 0x25, 0x27, 0x8C, 0x2F, 0xA7, 0x1F, 0x00, 0x0A, 0xA6, 0x59, 0x00, 0x07, 0x42,
+    0x21, 0x23, 0xA7, 0x2F, 0xA5, 0x20, 0x43, 0x23, 0x31, 0x32, 0x00, 0x07, 0xA7, 0x23, 0xA6, 0xF0,
+    0x41, 0x32, 0x88, 0xA6, 0x41, 0x18, 0x92, 0x7E, 0x21, 0x19, 0x04, 0xA1, 0x2A, 0x03, 0x21, 0x4C,
+    0x03, 0x21, 0x2B, 0x03, 0x21, 0x13, 0x03, 0x42, 0x01, 0x34, 0xA7, 0x57, 0x95, 0xB6, 0x42, 0x04,
+    0x23, 0xA7, 0x5E, 0x00, 0x07, 0x21, 0x32, 0x07, 0x41, 0x32, 0x9C, 0xFE, 0x21, 0x17, 0x04, 0x21,
+    0x40, 0x03, 0x21, 0x4C, 0x03, 0x42, 0x08, 0x0A, 0xA7, 0x59, 0x00, 0x03, 0x41, 0x21, 0x95, 0xDB,
+    0x21, 0x44, 0x04, 0x21, 0x25, 0x03, 0x21, 0x34, 0x03, 0x21, 0x17, 0x03, 0x42, 0x34, 0x40, 0x8A,
+    0xD4, 0x00, 0x03, 0x43, 0x17, 0x32, 0x39, 0xA7, 0x93, 0xA7, 0x35, 0x95, 0x72, 0x42, 0x15, 0x19,
+    0xA7, 0x57, 0xA5, 0x36, 0x43, 0x19, 0x31, 0x32, 0xA5, 0x3D, 0x00, 0x07, 0xA7, 0x5E, 0x42, 0x31,
+    0x32, 0xA7, 0x8C, 0x83, 0xAF, 0x43, 0x21, 0x31, 0x32, 0xA7, 0xB5, 0x96, 0xF0, 0x8A, 0xFD, 0x42,
+    0x23, 0x2A, 0xA7, 0xBF, 0xA7, 0xBF, 0x42, 0x23, 0x32, 0x65, 0x40, 0x00, 0x07, 0x43, 0x0A, 0x38,
+    0x40, 0xA7, 0x94, 0xA4, 0xA0, 0x9F, 0xC2, 0x41, 0x23, 0x83, 0xB4, 0x21, 0x38, 0x04, 0xA1, 0x18,
+    0x03, 0x42, 0x23, 0x2A, 0x00, 0x03, 0xA7, 0xE1, 0x21, 0x32, 0x07, 0xC1, 0x43, 0x75, 0xE6, 0x21,
+    0x19, 0x04, 0x43, 0x09, 0x15, 0x27, 0xA5, 0xF4, 0x00, 0x03, 0x97, 0x3E, 0x41, 0x20, 0x95, 0x12,
+    0x53, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x14, 0x15, 0x1A, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x27, 0x29,
+    0x2A, 0x2B, 0x40, 0x42, 0x00, 0xCA, 0x00, 0xC0, 0x00, 0xAC, 0x00, 0x9B, 0xA7, 0xC7, 0x00, 0x8B,
+    0x00, 0x74, 0x00, 0x6D, 0x00, 0x5C, 0x00, 0x52, 0x8C, 0xDB, 0xA5, 0xD6, 0x00, 0x4B, 0x00, 0x3A,
+    0x01, 0x7A, 0x00, 0x33, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x04, 0x42, 0x0B, 0x19, 0xA4, 0x15, 0xA8,
+    0x3A, 0x21, 0x44, 0x07, 0xCA, 0x17, 0x1A, 0x21, 0x23, 0x2D, 0x31, 0x32, 0x34, 0x37, 0x39, 0xA7,
+    0x0C, 0xA5, 0xF8, 0x02, 0x5F, 0x01, 0x9B, 0x01, 0x55, 0x01, 0x43, 0x01, 0x25, 0x00, 0x44, 0x28,
+    0x98, 0x00, 0x03, 0x41, 0x04, 0xA5, 0x30, 0x21, 0x07, 0x04, 0x41, 0x1F, 0xA8, 0x4E, 0x21, 0x1F,
+    0x04, 0x41, 0x39, 0x5D, 0x8D, 0x41, 0x4C, 0xA6, 0xC3, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x21,
+    0x1A, 0x03, 0x22, 0x17, 0x40, 0x11, 0x03, 0x41, 0x2D, 0x98, 0xF5, 0x23, 0x31, 0x39, 0x47, 0x1D,
+    0x09, 0x04, 0x41, 0x23, 0xA0, 0xB0, 0xA1, 0x2A, 0x04, 0xC1, 0x0A, 0xA7, 0xD3, 0xC2, 0x19, 0x21,
+    0x22, 0x08, 0x50, 0x44, 0x47, 0x01, 0x07, 0x0A, 0x19, 0x1A, 0x21, 0x23, 0xA8, 0xA4, 0x00, 0x0E,
+    0x00, 0x0B, 0xA8, 0xA4, 0x75, 0xDF, 0xA8, 0xA4, 0x00, 0x07, 0x41, 0x25, 0x97, 0xDA, 0x42, 0x17,
+    0x38, 0xA8, 0xBE, 0x8B, 0xE2, 0x41, 0x02, 0xA8, 0xC4, 0xC5, 0x1A, 0x1B, 0x41, 0x43, 0x44, 0x00,
+    0x0B, 0xA8, 0x77, 0x00, 0x04, 0x29, 0x8C, 0x87, 0x18, 0xC1, 0x2B, 0xA0, 0xDE, 0xC2, 0x2A, 0x35,
+    0xA8, 0x17, 0xA8, 0x5E, 0xC2, 0x14, 0x19, 0xA8, 0xC8, 0xA8, 0xC8, 0x41, 0x1A, 0xA4, 0xD3, 0xC3,
+    0x0A, 0x1A, 0x41, 0x88, 0x4F, 0xA8, 0xE2, 0x00, 0x04, 0x41, 0x1A, 0xA8, 0xDD, 0x42, 0x04, 0x0B,
+    0x35, 0xE9, 0xA8, 0x37, 0x41, 0x25, 0x6F, 0xA6, 0x21, 0x2E, 0x04, 0x21, 0x42, 0x03, 0x41, 0x19,
+    0x8A, 0x70, 0x41, 0x19, 0x87, 0xC6, 0x45, 0x14, 0x19, 0x40, 0x42, 0x44, 0xA9, 0x16, 0x00, 0x0B,
+    0x00, 0x08, 0x00, 0x04, 0x9B, 0xED, 0x21, 0x4C, 0x10, 0xC2, 0x15, 0x25, 0xA6, 0x41, 0xA4, 0x6B,
+    0xC2, 0x15, 0x40, 0xA8, 0x2E, 0x89, 0x0F, 0x42, 0x01, 0x47, 0x84, 0x0F, 0x6A, 0xAE, 0x21, 0x23,
+    0x07, 0xAB, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x41, 0x78, 0x68, 0x64,
+    0x5D, 0x52, 0x48, 0x44, 0x1B, 0x18, 0x11, 0x03, 0x41, 0x21, 0xA8, 0x59, 0x42, 0x09, 0x2B, 0x75,
+    0x82, 0x00, 0x04, 0xC2, 0x2D, 0x42, 0xA9, 0x08, 0xA5, 0x5B, 0x41, 0x40, 0x8C, 0x65, 0x41, 0x32,
+    0x63, 0x9A, 0x45, 0x25, 0x30, 0x31, 0x32, 0x35, 0x00, 0x04, 0x8F, 0xBA, 0xA9, 0x23, 0xA9, 0x72,
+    0xA9, 0x72, 0x41, 0x19, 0x82, 0xFF, 0xC2, 0x2B, 0x40, 0x00, 0x04, 0x31, 0x9F, 0x42, 0x23, 0x32,
+    0xA9, 0x8D, 0xA7, 0x7E, 0x42, 0x1A, 0x25, 0xA1, 0x0A, 0xA9, 0x94, 0x45, 0x19, 0x21, 0x25, 0x27,
+    0x31, 0x00, 0x15, 0xA9, 0x9B, 0xA9, 0x9B, 0x00, 0x0E, 0x00, 0x07, 0x41, 0x07, 0x1D, 0x50, 0x21,
+    0x31, 0x04, 0x42, 0x38, 0x39, 0xA9, 0x54, 0xA9, 0x54, 0x21, 0x01, 0x07, 0x43, 0x32, 0x38, 0x39,
+    0xA9, 0x6D, 0x00, 0x03, 0x74, 0x5E, 0x45, 0x23, 0x27, 0x32, 0x34, 0x39, 0xA9, 0xC6, 0xA7, 0x95,
+    0xA7, 0x95, 0xA9, 0xBC, 0xA9, 0x80, 0x42, 0x2D, 0x34, 0xA8, 0xE3, 0xA9, 0x87, 0x42, 0x34, 0x35,
+    0xA9, 0xA4, 0xA9, 0x71, 0x45, 0x01, 0x07, 0x27, 0x2B, 0x2D, 0x00, 0x0E, 0xA9, 0x7E, 0xA9, 0x75,
+    0x00, 0x07, 0x5F, 0x8A, 0x41, 0x17, 0xA5, 0xF0, 0x42, 0x01, 0x04, 0x79, 0x33, 0x79, 0x33, 0xCF,
+    0x01, 0x04, 0x15, 0x1F, 0x21, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00,
+    0x8D, 0x00, 0x64, 0xA9, 0x99, 0xA8, 0xFD, 0x77, 0x65, 0x00, 0x50, 0xA7, 0xD5, 0x00, 0x43, 0x80,
+    0x49, 0x00, 0x39, 0x00, 0x1B, 0x00, 0x0B, 0x00, 0x07, 0xA5, 0xE7, 0x9F, 0xB4, 0x42, 0x01, 0x23,
+    0xAA, 0x2D, 0x4C, 0xEC, 0x43, 0x23, 0x32, 0x35, 0xAA, 0x34, 0xA1, 0xAA, 0xAA, 0x34, 0x41, 0x32,
+    0x5E, 0x73, 0x21, 0x22, 0x04, 0x21, 0x23, 0x03, 0x21, 0x15, 0x03, 0xA1, 0x44, 0x03, 0x21, 0x34,
+    0x03, 0x21, 0x15, 0x03, 0x21, 0x31, 0x03, 0x45, 0x08, 0x0A, 0x0D, 0x11, 0x2B, 0x00, 0x2A, 0x00,
+    0x23, 0x00, 0x03, 0x87, 0x7F, 0xA9, 0xF1, 0x41, 0x15, 0x95, 0xB9, 0x44, 0x23, 0x34, 0x38, 0x39,
+    0xAA, 0x6B, 0x00, 0x04, 0xAA, 0x6B, 0xAA, 0x25, 0x41, 0x2A, 0x9A, 0x9E, 0x42, 0x01, 0x27, 0xAA,
+    0x60, 0xAA, 0x60, 0x21, 0x30, 0x07, 0x21, 0x32, 0x03, 0x21, 0x11, 0x03, 0x44, 0x11, 0x13, 0x23,
+    0x40, 0x00, 0x21, 0x8F, 0x67, 0x00, 0x14, 0x00, 0x03, 0x42, 0x25, 0x35, 0xAA, 0x99, 0xAA, 0x1A,
+    0xC7, 0x01, 0x0B, 0x14, 0x19, 0x1A, 0x2A, 0x40, 0xA8, 0xEE, 0xA6, 0x88, 0x00, 0x07, 0x52, 0x71,
+    0xAA, 0x96, 0xA9, 0xDA, 0x41, 0x8F, 0x42, 0x0A, 0x23, 0xAA, 0x5B, 0xAA, 0xB6, 0x42, 0x27, 0x2D,
+    0xA6, 0xA5, 0xAA, 0x02, 0x42, 0x25, 0x32, 0xAA, 0xC4, 0x5F, 0x68, 0x41, 0x36, 0xA2, 0x33, 0x41,
+    0x2A, 0xA9, 0xAA, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03, 0x41, 0x22, 0xA8, 0xB6, 0x21, 0x19, 0x04,
+    0x21, 0x31, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x30, 0x03, 0x42, 0x17, 0x1A, 0xA7, 0x07, 0xAA, 0x83,
+    0x41, 0x14, 0xAA, 0x35, 0xCB, 0x01, 0x08, 0x14, 0x17, 0x19, 0x22, 0x25, 0x40, 0x41, 0x42, 0x44,
+    0x64, 0x65, 0x00, 0x37, 0x00, 0x30, 0x00, 0x29, 0x00, 0x1E, 0x00, 0x0E, 0xA8, 0xA8, 0x00, 0x0B,
+    0x25, 0x30, 0x00, 0x04, 0xAA, 0xA5, 0x41, 0x32, 0x8D, 0x80, 0x21, 0x1C, 0x04, 0xC2, 0x0A, 0x1E,
+    0x04, 0xD6, 0x83, 0x38, 0x41, 0x15, 0xA9, 0x26, 0x21, 0x40, 0x04, 0xA1, 0x2A, 0x03, 0x21, 0x4C,
+    0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0x21, 0x40, 0x03, 0x41, 0x1E, 0x8D,
+    0xEA, 0x42, 0x1E, 0x40, 0xAB, 0x25, 0x00, 0x04, 0x41, 0x32, 0x68, 0x20, 0x43, 0x1E, 0x31, 0x39,
+    0xAB, 0x4C, 0x01, 0xA1, 0xAB, 0x13, 0x41, 0x01, 0x68, 0x2E, 0xC5, 0x01, 0x15, 0x25, 0x40, 0x41,
+    0x00, 0x12, 0xAA, 0xF4, 0x00, 0x0E, 0x18, 0xEB, 0x00, 0x04, 0x42, 0x27, 0x32, 0x67, 0xCE, 0x9F,
+    0x2D, 0x42, 0x01, 0x32, 0xAB, 0x71, 0xA9, 0x73, 0x41, 0x07, 0x1E, 0x26, 0x21, 0x49, 0x04, 0x42,
+    0x36, 0x38, 0x00, 0x03, 0xAB, 0x30, 0x41, 0x40, 0x74, 0x20, 0x21, 0x2D, 0x04, 0x21, 0x44, 0x03,
+    0x21, 0x2A, 0x03, 0x42, 0x19, 0x23, 0x00, 0x03, 0xAA, 0xD8, 0xC9, 0x02, 0x15, 0x16, 0x19, 0x1A,
+    0x1C, 0x25, 0x42, 0x43, 0x00, 0x30, 0x6A, 0x47, 0xA3, 0x9F, 0xAB, 0x8D, 0x00, 0x29, 0x00, 0x1B,
+    0xA7, 0x8C, 0x00, 0x07, 0x79, 0x95, 0xC3, 0x40, 0x41, 0x44, 0x7A, 0xF1, 0x99, 0x9F, 0x72, 0x69,
+    0xC1, 0x17, 0xA6, 0x0E, 0x21, 0x19, 0x04, 0xC1, 0x44, 0x96, 0x51, 0x41, 0x2D, 0xAA, 0xC6, 0xC3,
+    0x17, 0x1B, 0x40, 0x38, 0xA3, 0x8C, 0x5C, 0x00, 0x04, 0x22, 0x07, 0x19, 0x12, 0x0A, 0x54, 0x01,
+    0x04, 0x07, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x19, 0x1B, 0x1E, 0x1F, 0x21, 0x25, 0x27, 0x2A,
+    0x48, 0x49, 0x4A, 0x02, 0x7B, 0x02, 0x74, 0x01, 0xDF, 0x01, 0x87, 0xAB, 0xDE, 0x01, 0x52, 0x01,
+    0x3E, 0x01, 0x28, 0xA9, 0x4A, 0x00, 0xEA, 0x00, 0xC4, 0x00, 0xC1, 0x00, 0xA4, 0x00, 0x9D, 0x00,
+    0x84, 0x00, 0x44, 0x00, 0x28, 0x00, 0x1A, 0x00, 0x05, 0xAB, 0xDD, 0xC1, 0x17, 0xA9, 0x8B, 0x43,
+    0x17, 0x2A, 0x40, 0x14, 0xF8, 0xA4, 0x78, 0x77, 0xFE, 0x42, 0x27, 0x30, 0xAB, 0x6E, 0x00, 0x0A,
+    0xC2, 0x19, 0x43, 0xA1, 0x40, 0x7A, 0x2B, 0x42, 0x01, 0x1A, 0x00, 0x07, 0xAB, 0x2E, 0x41, 0x1B,
+    0x97, 0x78, 0x23, 0x23, 0x2D, 0x30, 0x19, 0x0B, 0x04, 0x41, 0x34, 0xA5, 0x10, 0x42, 0x19, 0x40,
+    0x8C, 0x13, 0x89, 0x2B, 0x21, 0x19, 0x07, 0x22, 0x21, 0x38, 0x0E, 0x03, 0x41, 0x2B, 0x05, 0xB7,
+    0x21, 0x41, 0x04, 0x43, 0x19, 0x25, 0x2D, 0x3C, 0x26, 0xA7, 0xA1, 0x00, 0x03, 0x42, 0x37, 0x49,
+    0x78, 0x93, 0xAA, 0x43, 0x41, 0x36, 0xA7, 0x7B, 0x41, 0x23, 0x80, 0x71, 0x21, 0x1B, 0x04, 0x43,
+    0x0A, 0x1C, 0x40, 0xAC, 0x46, 0x00, 0x0B, 0x00, 0x03, 0x21, 0x33, 0x0A, 0x42, 0x32, 0x49, 0xAC,
+    0x8C, 0x00, 0x03, 0xC1, 0x17, 0xAB, 0x87, 0x21, 0x27, 0x04, 0x41, 0x23, 0xA9, 0xB6, 0x21, 0x2B,
+    0x04, 0x44, 0x31, 0x32, 0x33, 0x48, 0x00, 0x0A, 0xAC, 0x43, 0x00, 0x03, 0xAC, 0x4C, 0x41, 0x21,
+    0xA7, 0xEC, 0x21, 0x32, 0x04, 0x43, 0x01, 0x2B, 0x2D, 0xAC, 0xAB, 0xAB, 0xB3, 0x92, 0x47, 0x43,
+    0x25, 0x30, 0x39, 0x00, 0x0D, 0x00, 0x0A, 0xAC, 0xBF, 0x42, 0x31, 0x35, 0xAC, 0x7A, 0xAC, 0xC9,
+    0x42, 0x25, 0x36, 0x00, 0x07, 0xA8, 0x46, 0x41, 0x25, 0xAC, 0xD0, 0x42, 0x14, 0x39, 0xAC, 0xDB,
+    0x00, 0x04, 0x42, 0x02, 0x40, 0xAB, 0xE0, 0x98, 0x7D, 0x21, 0x48, 0x07, 0x21, 0x35, 0x03, 0x42,
+    0x01, 0x08, 0xA6, 0x01, 0xAB, 0xED, 0x42, 0x30, 0x31, 0x00, 0x07, 0xAC, 0xF5, 0x41, 0x21, 0x79,
+    0xBF, 0x41, 0x20, 0xAC, 0xE8, 0x22, 0x30, 0x33, 0x08, 0x04, 0x41, 0x40, 0x61, 0x2D, 0x21, 0x35,
+    0x04, 0x21, 0x23, 0x03, 0x42, 0x1E, 0x41, 0xAC, 0xB9, 0xAD, 0x13, 0x42, 0x30, 0x38, 0x00, 0x07,
+    0xAD, 0x1B, 0x41, 0x1E, 0xA9, 0x1E, 0x21, 0x41, 0x04, 0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x21,
+    0x0D, 0x03, 0xC1, 0x28, 0x8D, 0x68, 0x21, 0x2D, 0x04, 0x21, 0x49, 0x03, 0x41, 0x18, 0xAD, 0x32,
+    0x21, 0x32, 0x04, 0x45, 0x02, 0x15, 0x1A, 0x25, 0x2A, 0xAD, 0x0A, 0xAC, 0x88, 0xAC, 0xDD, 0xAD,
+    0x0A, 0x00, 0x03, 0xC1, 0x23, 0xAD, 0x52, 0x43, 0x01, 0x04, 0x1E, 0x98, 0x12, 0xAD, 0x57, 0x00,
+    0x04, 0x41, 0x1E, 0xAD, 0x54, 0xA1, 0x07, 0x04, 0x21, 0x1E, 0x03, 0x41, 0x44, 0xAB, 0x15, 0x21,
+    0x49, 0x04, 0x43, 0x17, 0x1C, 0x2A, 0xAD, 0x2C, 0xAC, 0xE1, 0x00, 0x03, 0xDA, 0x01, 0x02, 0x04,
+    0x08, 0x0A, 0x0B, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x2A,
+    0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x01, 0x3A, 0x01, 0x25, 0x01, 0x19, 0xAD, 0x78, 0xAC,
+    0x7A, 0x01, 0x0F, 0xAD, 0x16, 0xAC, 0xB6, 0x00, 0xF0, 0x00, 0xDB, 0x00, 0xBD, 0x00, 0xAC, 0x00,
+    0xA1, 0x00, 0x90, 0x00, 0x86, 0x00, 0x77, 0xAC, 0x73, 0x00, 0x6B, 0x00, 0x61, 0x00, 0x4D, 0x00,
+    0x43, 0x00, 0x39, 0x00, 0x25, 0x00, 0x14, 0x7B, 0x77, 0x00, 0x0A, 0x42, 0x25, 0x31, 0x6B, 0xE6,
+    0xAD, 0x92, 0x21, 0x25, 0x07, 0x43, 0x32, 0x34, 0x39, 0xAC, 0xE2, 0x00, 0x03, 0x9C, 0x34, 0x41,
+    0x22, 0x87, 0x5C, 0x21, 0x30, 0x04, 0x42, 0x21, 0x39, 0xAD, 0xD9, 0xAD, 0xE6, 0xC8, 0x04, 0x15,
+    0x17, 0x2B, 0x32, 0x41, 0x43, 0x44, 0xAD, 0x98, 0xAD, 0x87, 0x00, 0x0A, 0x00, 0x07, 0xAD, 0x8F,
+    0x38, 0xDA, 0xAB, 0xBC, 0xA4, 0x75, 0x42, 0x01, 0x2A, 0x91, 0x4E, 0xAB, 0x98, 0x41, 0x32, 0x6E,
+    0x98, 0x21, 0x08, 0x04, 0x21, 0x34, 0x03, 0xA2, 0x07, 0x23, 0x11, 0x03, 0x42, 0x31, 0x32, 0x37,
+    0xC0, 0x9B, 0x32, 0x42, 0x0A, 0x31, 0xAE, 0x23, 0x91, 0x6B, 0xC1, 0x18, 0x79, 0xD3, 0xC8, 0x1A,
+    0x20, 0x21, 0x22, 0x23, 0x2B, 0x32, 0x38, 0x00, 0x17, 0x00, 0x12, 0x9E, 0xA3, 0xAB, 0x61, 0x00,
+    0x0B, 0x85, 0xE4, 0x00, 0x04, 0x9C, 0x8D, 0x41, 0x25, 0x9B, 0x15, 0x43, 0x01, 0x0A, 0x22, 0x00,
+    0x04, 0xA9, 0x89, 0x5C, 0x9F, 0xC7, 0x01, 0x0A, 0x1A, 0x1E, 0x35, 0x40, 0x41, 0xAA, 0x3D, 0xA7,
+    0xAF, 0xAC, 0xA0, 0xA0, 0x74, 0x98, 0xD8, 0x00, 0x0A, 0x44, 0x6A, 0x41, 0x25, 0x8E, 0x46, 0x21,
+    0x42, 0x04, 0x44, 0x32, 0x34, 0x35, 0x39, 0xAD, 0x7F, 0x00, 0x03, 0xAE, 0x72, 0xAE, 0x39, 0xC3,
+    0x01, 0x2B, 0x35, 0x93, 0x8B, 0xAD, 0x07, 0xAE, 0x7F, 0x41, 0x31, 0x70, 0x00, 0x21, 0x14, 0x04,
+    0x21, 0x23, 0x03, 0x21, 0x1B, 0x03, 0xC3, 0x1E, 0x28, 0x42, 0x93, 0x71, 0xAC, 0xE4, 0x00, 0x03,
+    0x41, 0x34, 0x74, 0xED, 0x42, 0x19, 0x21, 0xAE, 0xA4, 0x00, 0x04, 0x41, 0x44, 0x8A, 0xB5, 0x21,
+    0x34, 0x04, 0x21, 0x27, 0x03, 0x21, 0x35, 0x03, 0x41, 0x04, 0x9E, 0xEB, 0x42, 0x35, 0x39, 0x00,
+    0x04, 0xAD, 0x25, 0x41, 0x14, 0x9B, 0xA5, 0x43, 0x25, 0x2D, 0x42, 0xAE, 0xC7, 0xAD, 0xD4, 0x00,
+    0x04, 0xC3, 0x1A, 0x23, 0x25, 0x00, 0x0A, 0x94, 0x5B, 0x9C, 0x69, 0x41, 0x1A, 0x0D, 0x86, 0xA4,
+    0x04, 0x1A, 0x40, 0x41, 0x2A, 0x23, 0x0E, 0x04, 0x44, 0x19, 0x21, 0x2D, 0x4C, 0xAE, 0x22, 0xAE,
+    0x22, 0x00, 0x44, 0x00, 0x09, 0xC2, 0x32, 0x35, 0x25, 0xDA, 0xAE, 0xF5, 0x41, 0x1A, 0x6F, 0x53,
+    0x21, 0x15, 0x04, 0x21, 0x01, 0x03, 0x42, 0x15, 0x40, 0x89, 0xCA, 0x00, 0x03, 0x41, 0x23, 0xAE,
+    0xD4, 0x21, 0x40, 0x04, 0x42, 0x25, 0x4C, 0xAE, 0x4E, 0x00, 0x03, 0x41, 0x32, 0x93, 0xF2, 0x41,
+    0x08, 0x96, 0x99, 0x41, 0x1A, 0x9C, 0x05, 0xD7, 0x01, 0x07, 0x08, 0x0B, 0x14, 0x15, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x28, 0x2A, 0x2B, 0x2E, 0x40, 0x41, 0x42, 0x03,
+    0x0C, 0x01, 0xAB, 0x07, 0xD0, 0x01, 0x52, 0x01, 0x3A, 0x90, 0x8D, 0x00, 0xF9, 0x94, 0x33, 0x00,
+    0xD2, 0x00, 0xB5, 0x00, 0xA8, 0xAF, 0x26, 0x4F, 0x9E, 0x00, 0x91, 0x00, 0x3F, 0x00, 0x32, 0x08,
+    0xC5, 0x00, 0x21, 0x00, 0x13, 0x00, 0x0C, 0x00, 0x08, 0x7E, 0x98, 0x00, 0x04, 0x42, 0x27, 0x31,
+    0xAF, 0x63, 0xAF, 0x1E, 0x41, 0x14, 0x44, 0xA7, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03, 0xA1, 0x19,
+    0x03, 0x42, 0x1A, 0x28, 0xAF, 0x81, 0x00, 0x03, 0x41, 0x0E, 0xAE, 0x95, 0x21, 0x29, 0x04, 0x21,
+    0x32, 0x03, 0x41, 0x34, 0x8C, 0x7A, 0xC5, 0x23, 0x27, 0x28, 0x2A, 0x40, 0x00, 0x07, 0x00, 0x04,
+    0x12, 0x87, 0x65, 0x47, 0x63, 0xB9, 0x21, 0x07, 0x10, 0x43, 0x32, 0x38, 0x39, 0x00, 0x28, 0x00,
+    0x03, 0xAF, 0xA9, 0x41, 0x22, 0xAF, 0x61, 0xC1, 0x13, 0x52, 0x72, 0x21, 0x08, 0x04, 0x21, 0x47,
+    0x03, 0x21, 0x19, 0x03, 0x44, 0x17, 0x1E, 0x23, 0x2B, 0xAB, 0xE2, 0x7C, 0x5C, 0xAF, 0x6F, 0x00,
+    0x03, 0x46, 0x19, 0x1A, 0x23, 0x2B, 0x40, 0x42, 0x92, 0xF1, 0x00, 0x64, 0x00, 0x28, 0x00, 0x1E,
+    0x00, 0x0D, 0xAB, 0xB9, 0x42, 0x34, 0x39, 0x84, 0x47, 0xAF, 0xE4, 0x41, 0x19, 0x9C, 0xCD, 0x21,
+    0x40, 0x04, 0x21, 0x34, 0x03, 0xC1, 0x1A, 0xAC, 0xE3, 0x21, 0x11, 0x04, 0x41, 0x27, 0xAF, 0x96,
+    0x41, 0x25, 0x34, 0x75, 0x41, 0x1A, 0x90, 0x11, 0xC6, 0x02, 0x1E, 0x23, 0x32, 0x40, 0x44, 0x00,
+    0x0C, 0x00, 0x08, 0xB0, 0x08, 0xB0, 0x08, 0x00, 0x04, 0x75, 0x98, 0xC4, 0x08, 0x23, 0x25, 0x40,
+    0x5B, 0x85, 0x52, 0xDA, 0x9E, 0x6C, 0x94, 0x06, 0xA1, 0x38, 0x0D, 0xC2, 0x15, 0x22, 0xAF, 0x29,
+    0xAF, 0xC5, 0x41, 0x25, 0xA6, 0x81, 0xC3, 0x25, 0x34, 0x40, 0xAE, 0x4F, 0x50, 0x7D, 0x00, 0x04,
+    0x41, 0x23, 0x9D, 0x03, 0x42, 0x15, 0x40, 0x91, 0xAE, 0x00, 0x04, 0x41, 0x34, 0x8E, 0xFF, 0xA1,
+    0x2D, 0x04, 0x21, 0x17, 0x03, 0x41, 0x23, 0x54, 0x75, 0x22, 0x31, 0x32, 0x07, 0x04, 0x41, 0x04,
+    0x9D, 0x74, 0x44, 0x04, 0x0B, 0x21, 0x40, 0x8D, 0x8A, 0xB0, 0x49, 0x00, 0x09, 0x00, 0x04, 0xCF,
+    0x01, 0x07, 0x0A, 0x0B, 0x10, 0x13, 0x14, 0x15, 0x17, 0x19, 0x25, 0x27, 0x28, 0x2A, 0x48, 0x00,
+    0x8B, 0x50, 0xEA, 0x44, 0xA5, 0x00, 0x7D, 0xB0, 0x6F, 0x00, 0x76, 0x00, 0x67, 0x00, 0x47, 0xB0,
+    0x6F, 0x00, 0x44, 0x00, 0x39, 0x00, 0x2B, 0x3E, 0x33, 0x00, 0x0D, 0xB0, 0x36, 0xC1, 0x23, 0xB0,
+    0x4B, 0xC1, 0x41, 0xA8, 0x96, 0x46, 0x11, 0x15, 0x19, 0x1A, 0x40, 0x49, 0xB0, 0x3F, 0xB0, 0x3F,
+    0xB0, 0xA5, 0x00, 0x08, 0x51, 0xB3, 0x00, 0x04, 0x41, 0x36, 0xB0, 0x7F, 0xA1, 0x1A, 0x04, 0x42,
+    0x32, 0x38, 0x2A, 0x4A, 0xA5, 0x4B, 0x41, 0x2B, 0xAA, 0x24, 0x21, 0x07, 0x04, 0x21, 0x2D, 0x03,
+    0x41, 0x21, 0x7B, 0xDA, 0x21, 0x32, 0x04, 0xC4, 0x01, 0x17, 0x1A, 0x2A, 0x00, 0x18, 0x00, 0x0A,
+    0xB0, 0xCA, 0x00, 0x03, 0x44, 0x01, 0x07, 0x48, 0x49, 0x00, 0x28, 0x00, 0x0D, 0xB0, 0xDA, 0xB0,
+    0xDA, 0x41, 0x1A, 0xAE, 0x09, 0xC3, 0x1A, 0x23, 0x40, 0x40, 0x03, 0x85, 0x8A, 0x00, 0x04, 0x42,
+    0x25, 0x42, 0xB0, 0xFF, 0xB0, 0xA1, 0x41, 0x29, 0x1B, 0xD0, 0x21, 0x34, 0x04, 0x42, 0x01, 0x18,
+    0xB0, 0xC7, 0x00, 0x03, 0xC2, 0x20, 0x25, 0x70, 0x22, 0x8C, 0xF7, 0x21, 0x01, 0x07, 0x22, 0x32,
+    0x34, 0x11, 0x03, 0x22, 0x04, 0x25, 0x24, 0x05, 0x42, 0x39, 0x48, 0x19, 0xB0, 0xAB, 0x09, 0x41,
+    0x38, 0x60, 0x4D, 0x41, 0x02, 0xAF, 0xFB, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03, 0x42, 0x19, 0x2A,
+    0xAF, 0xF9, 0x00, 0x03, 0x21, 0x34, 0x07, 0x22, 0x19, 0x20, 0x18, 0x03, 0x21, 0x32, 0x05, 0x41,
+    0x2A, 0x81, 0x5F, 0x42, 0x04, 0x40, 0xB1, 0x53, 0x00, 0x04, 0x21, 0x32, 0x07, 0x42, 0x32, 0x49,
+    0x9E, 0x73, 0xA9, 0x3C, 0x41, 0x07, 0x91, 0xA1, 0x41, 0x49, 0xA9, 0x47, 0x42, 0x21, 0x48, 0xB1,
+    0x6C, 0xB1, 0x62, 0xCD, 0x0A, 0x0D, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1E, 0x23, 0x25, 0x28, 0x2A,
+    0x40, 0x00, 0x4B, 0x00, 0x27, 0x00, 0x19, 0x67, 0x28, 0xAF, 0x49, 0x96, 0x7F, 0x00, 0x16, 0x00,
+    0x0F, 0xA5, 0x63, 0x00, 0x0B, 0x45, 0x89, 0x00, 0x07, 0x82, 0xE6, 0x43, 0x11, 0x21, 0x22, 0xA5,
+    0x8F, 0xB0, 0xD5, 0xB1, 0x7F, 0x41, 0x2A, 0xAF, 0x28, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xA1,
+    0x15, 0x03, 0xC3, 0x18, 0x32, 0x35, 0x96, 0xBE, 0xB1, 0xB2, 0x00, 0x03, 0x21, 0x23, 0x0A, 0x41,
+    0x38, 0x92, 0x36, 0x41, 0x19, 0x92, 0xF3, 0xC1, 0x1A, 0xAC, 0x81, 0xC2, 0x0A, 0x32, 0x8C, 0xEB,
+    0x63, 0x39, 0x21, 0x1C, 0x07, 0x43, 0x23, 0x32, 0x34, 0x96, 0xE5, 0xB0, 0x23, 0xAF, 0xA4, 0x41,
+    0x34, 0xA1, 0x2B, 0x21, 0x29, 0x04, 0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0x41, 0x21, 0x8F, 0x14,
+    0x21, 0x34, 0x04, 0x41, 0x32, 0x6D, 0x27, 0x41, 0x19, 0x15, 0xA1, 0x21, 0x19, 0x04, 0x21, 0x31,
+    0x03, 0x21, 0x2A, 0x03, 0x21, 0x1E, 0x03, 0xC9, 0x01, 0x0A, 0x17, 0x19, 0x1A, 0x1E, 0x20, 0x40,
+    0x42, 0x00, 0x32, 0x8D, 0x27, 0x00, 0x1E, 0x00, 0x17, 0xB0, 0x09, 0x00, 0x14, 0x93, 0x37, 0x00,
+    0x03, 0xAE, 0xD4, 0x43, 0x15, 0x17, 0x48, 0xB2, 0x07, 0xB2, 0x07, 0xAD, 0xFE, 0x21, 0x1F, 0x0A,
+    0x21, 0x40, 0x03, 0xC3, 0x17, 0x1A, 0x32, 0xA5, 0x3C, 0xB0, 0x35, 0x6D, 0x67, 0x41, 0x17, 0x0A,
+    0xF9, 0x21, 0x34, 0x04, 0x43, 0x17, 0x1E, 0x2A, 0xA5, 0x4D, 0x58, 0x36, 0x00, 0x03, 0x21, 0x21,
+    0x0A, 0x41, 0x31, 0x96, 0xC4, 0xA1, 0x23, 0x04, 0x42, 0x19, 0x29, 0x7C, 0xFE, 0xB2, 0x58, 0x47,
+    0x13, 0x1E, 0x30, 0x32, 0x34, 0x35, 0x38, 0xAE, 0xF4, 0x00, 0x2C, 0xB2, 0x5F, 0xA1, 0xAB, 0x00,
+    0x11, 0x00, 0x0A, 0x00, 0x07, 0xC1, 0x21, 0x21, 0xCC, 0xC4, 0x01, 0x07, 0x31, 0x32, 0xB2, 0x79,
+    0xB2, 0x79, 0xB2, 0x40, 0x00, 0x04, 0x41, 0x04, 0x8D, 0x65, 0x21, 0x32, 0x04, 0x45, 0x01, 0x1A,
+    0x1B, 0x22, 0x23, 0xB2, 0x47, 0x00, 0x14, 0xB2, 0x8D, 0x7B, 0x53, 0x00, 0x03, 0x41, 0x30, 0x32,
+    0x9D, 0x21, 0x23, 0x04, 0x41, 0x44, 0xB2, 0x91, 0x21, 0x33, 0x04, 0xA2, 0x1B, 0x23, 0x0A, 0x03,
+    0x43, 0x07, 0x31, 0x32, 0xB2, 0xB0, 0xB2, 0x77, 0x00, 0x05, 0x42, 0x07, 0x35, 0xB2, 0xBA, 0xB2,
+    0x29, 0x43, 0x07, 0x23, 0x25, 0x00, 0x11, 0x00, 0x07, 0xB1, 0xBF, 0x41, 0x17, 0x81, 0x8C, 0x21,
+    0x23, 0x04, 0x41, 0x1A, 0x69, 0x52, 0x42, 0x07, 0x21, 0xB2, 0xD6, 0x00, 0x04, 0x41, 0x32, 0x02,
+    0x88, 0x41, 0x19, 0x79, 0x2E, 0x21, 0x47, 0x04, 0x21, 0x0B, 0x03, 0xC3, 0x01, 0x21, 0x40, 0xAB,
+    0x9F, 0x00, 0x0E, 0x00, 0x03, 0x21, 0x04, 0x0A, 0xD6, 0x01, 0x04, 0x07, 0x0D, 0x13, 0x15, 0x16,
+    0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x23, 0x29, 0x2B, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x02,
+    0x03, 0x01, 0xD5, 0xB2, 0xF8, 0x01, 0x85, 0x01, 0x5D, 0x01, 0x3C, 0x01, 0x39, 0xB0, 0x2F, 0x01,
+    0x35, 0x01, 0x31, 0x01, 0x26, 0xA3, 0x2B, 0x00, 0xF1, 0x00, 0xC8, 0x00, 0x99, 0x00, 0x6B, 0x00,
+    0x37, 0x00, 0x29, 0x00, 0x22, 0xA7, 0x59, 0x00, 0x03, 0xA7, 0x80, 0x41, 0x23, 0x74, 0xD4, 0x21,
+    0x40, 0x04, 0x21, 0x32, 0x03, 0xC1, 0x22, 0x6F, 0xA9, 0x42, 0x15, 0x42, 0xB3, 0x49, 0xB2, 0xFA,
+    0x43, 0x19, 0x32, 0x34, 0x95, 0x5D, 0x00, 0x0B, 0x00, 0x07, 0xC1, 0x15, 0xB3, 0x3E, 0x21, 0x2A,
+    0x04, 0x21, 0x1B, 0x03, 0x21, 0x40, 0x03, 0xC2, 0x32, 0x39, 0x00, 0x03, 0xB3, 0x67, 0xC2, 0x34,
+    0x38, 0xA0, 0x84, 0xB3, 0x64, 0x41, 0x48, 0xAD, 0x56, 0x21, 0x19, 0x04, 0x21, 0x2B, 0x03, 0x21,
+    0x21, 0x03, 0x21, 0x27, 0x03, 0x21, 0x23, 0x03, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x21, 0x01,
+    0x03, 0xC4, 0x20, 0x21, 0x30, 0x32, 0x72, 0x9F, 0xB2, 0xCB, 0x06, 0x5F, 0x00, 0x03, 0xC1, 0x08,
+    0x7E, 0x3C, 0xA1, 0x32, 0x04, 0xC3, 0x13, 0x1E, 0x44, 0x00, 0x14, 0x00, 0x03, 0xB3, 0x6C, 0x43,
+    0x01, 0x0A, 0x27, 0xAF, 0x8A, 0xB3, 0x1E, 0xAF, 0x8A, 0x41, 0x08, 0x4C, 0x1B, 0x21, 0x40, 0x04,
+    0x21, 0x19, 0x03, 0x21, 0x25, 0x03, 0xC1, 0x1A, 0x95, 0x30, 0x4F, 0x01, 0x04, 0x0A, 0x0B, 0x14,
+    0x15, 0x17, 0x18, 0x21, 0x23, 0x40, 0x41, 0x48, 0x49, 0x4A, 0xB3, 0x64, 0x00, 0x88, 0x00, 0x7A,
+    0x93, 0x94, 0x00, 0x63, 0x00, 0x5C, 0xB3, 0xCA, 0xB3, 0xCA, 0xB3, 0xCA, 0x00, 0x25, 0x00, 0x1B,
+    0x00, 0x07, 0xB3, 0xCA, 0x00, 0x04, 0x63, 0x62, 0xC1, 0x16, 0x87, 0xAA, 0xC2, 0x1C, 0x21, 0xA4,
+    0x2F, 0xB2, 0xFA, 0xC1, 0x49, 0xAD, 0x15, 0x41, 0x25, 0xAF, 0xF9, 0xC6, 0x07, 0x19, 0x1E, 0x22,
+    0x41, 0x44, 0xB4, 0x0B, 0x00, 0x08, 0x00, 0x04, 0xB4, 0x0B, 0x81, 0xFA, 0x81, 0xFA, 0xC4, 0x07,
+    0x19, 0x22, 0x27, 0xB4, 0x1E, 0xB3, 0x1F, 0xB4, 0x1E, 0xB4, 0x1E, 0xC7, 0x07, 0x19, 0x21, 0x27,
+    0x2D, 0x2E, 0x32, 0xB4, 0x2B, 0x00, 0x33, 0x00, 0x2F, 0xAD, 0xA1, 0x00, 0x20, 0x7D, 0xEF, 0x00,
+    0x0D, 0x41, 0x1A, 0x4C, 0x23, 0xC3, 0x2B, 0x41, 0x44, 0xB4, 0x2C, 0x00, 0x04, 0x9E, 0xCF, 0xC2,
+    0x07, 0x21, 0x00, 0x0A, 0xB4, 0x4F, 0x41, 0x23, 0x6D, 0xC7, 0x41, 0x1E, 0x17, 0xA4, 0x21, 0x28,
+    0x04, 0x41, 0x19, 0x9E, 0x77, 0x21, 0x32, 0x04, 0x21, 0x25, 0x03, 0x21, 0x19, 0x03, 0x21, 0x32,
+    0x03, 0x43, 0x34, 0x38, 0x48, 0x00, 0x13, 0xB4, 0x67, 0x00, 0x03, 0x42, 0x01, 0x02, 0xB4, 0x7B,
+    0x83, 0xBA, 0x21, 0x32, 0x07, 0x41, 0x07, 0x94, 0xDF, 0x21, 0x23, 0x04, 0xC2, 0x2A, 0x40, 0xB3,
+    0x54, 0x47, 0x10, 0x21, 0x32, 0x07, 0x41, 0x27, 0x97, 0x04, 0x41, 0x30, 0x08, 0x5C, 0x21, 0x01,
+    0x04, 0x42, 0x07, 0x15, 0x00, 0x03, 0xB4, 0x5B, 0x43, 0x31, 0x32, 0x36, 0x00, 0x12, 0x00, 0x07,
+    0xB4, 0x9E, 0x41, 0x14, 0xA7, 0x52, 0x21, 0x40, 0x04, 0x42, 0x21, 0x23, 0x00, 0x03, 0xB4, 0xA9,
+    0x41, 0x41, 0x8D, 0x49, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x07, 0x03, 0x42, 0x2D, 0x39,
+    0x00, 0x03, 0xB4, 0xCD, 0x43, 0x2D, 0x35, 0x49, 0xB4, 0xD4, 0xB4, 0x43, 0xB4, 0x7F, 0x43, 0x19,
+    0x21, 0x25, 0x00, 0x11, 0x00, 0x0A, 0xAC, 0xFC, 0x41, 0x37, 0xA7, 0xED, 0x21, 0x25, 0x04, 0x42,
+    0x02, 0x2B, 0x6D, 0x68, 0x00, 0x03, 0x43, 0x07, 0x23, 0x49, 0xB4, 0xF6, 0xB4, 0xF5, 0xB3, 0xF1,
+    0x43, 0x17, 0x1E, 0x2B, 0xB0, 0xAE, 0x00, 0x0A, 0x0E, 0x5B, 0x43, 0x1B, 0x1E, 0x2E, 0xB0, 0x80,
+    0xB1, 0xE0, 0xB0, 0x80, 0x42, 0x1C, 0x23, 0xB4, 0x83, 0xB4, 0x83, 0xD3, 0x01, 0x04, 0x08, 0x09,
+    0x14, 0x15, 0x17, 0x19, 0x1A, 0x1C, 0x1D, 0x21, 0x25, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x00,
+    0xC5, 0x8D, 0x8D, 0xB5, 0x1B, 0xB5, 0x0E, 0x00, 0xAA, 0x00, 0x99, 0x00, 0x92, 0x00, 0x88, 0x00,
+    0x73, 0x64, 0x58, 0xB5, 0x0E, 0x95, 0x0A, 0xAA, 0x6D, 0x00, 0x62, 0x00, 0x3D, 0x00, 0x2C, 0x00,
+    0x1B, 0x00, 0x11, 0x00, 0x07, 0x42, 0x48, 0x4B, 0xB5, 0x1C, 0xB4, 0xEF, 0x41, 0x2B, 0x86, 0x5F,
+    0x21, 0x30, 0x04, 0xC8, 0x07, 0x08, 0x19, 0x1A, 0x22, 0x23, 0x2B, 0x46, 0xB5, 0x63, 0x96, 0xCD,
+    0x00, 0x48, 0x00, 0x0E, 0xB5, 0x63, 0x00, 0x03, 0x81, 0xDA, 0xB5, 0x63, 0x43, 0x27, 0x2D, 0x32,
+    0xB5, 0x43, 0x01, 0x2D, 0x00, 0x19, 0x41, 0x4A, 0xB5, 0x7C, 0x21, 0x1A, 0x04, 0x21, 0x40, 0x03,
+    0x42, 0x01, 0x07, 0x90, 0x68, 0xB5, 0x90, 0x45, 0x07, 0x27, 0x2D, 0x30, 0x32, 0x00, 0x0A, 0xB4,
+    0xDC, 0x00, 0x07, 0xB5, 0x97, 0xB4, 0xDC, 0x42, 0x2D, 0x33, 0x70, 0x3D, 0xB5, 0xA7, 0x5C, 0x01,
+    0x07, 0x14, 0x17, 0x19, 0x1E, 0x21, 0x23, 0x24, 0x25, 0x27, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x10, 0x9F, 0x10, 0x8E, 0x10,
+    0x69, 0x10, 0x11, 0x0F, 0xF5, 0x0F, 0xD7, 0xA0, 0xE8, 0x0D, 0x6A, 0x0D, 0x47, 0x0D, 0x23, 0x0D,
+    0x0A, 0x0C, 0xF4, 0x0C, 0x6D, 0x0C, 0x52, 0x09, 0xD0, 0x06, 0x87, 0x05, 0xDD, 0x05, 0x3F, 0x05,
+    0x09, 0x04, 0xCA, 0x81, 0xD4, 0x02, 0xB6, 0x01, 0xE4, 0xAE, 0x07, 0x01, 0x83, 0x00, 0x32, 0x00,
+    0x17, 0x00, 0x07, 0x41, 0x21, 0xA9, 0x08, 0x21, 0x2B, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03,
+    0x42, 0x23, 0x25, 0xB5, 0x04, 0xB3, 0x93, 0x42, 0x34, 0x49, 0xB5, 0xC8, 0xB5, 0x0B, 0x42, 0x31,
+    0x4C, 0xB4, 0x0F, 0xB6, 0x1E, 0x21, 0x13, 0x07, 0x41, 0x13, 0x9B, 0x52, 0x42, 0x25, 0x28, 0xB1,
+    0x6A, 0xB6, 0x2C, 0x21, 0x01, 0x07, 0xC8, 0x01, 0x04, 0x15, 0x1B, 0x23, 0x32, 0x34, 0x40, 0x00,
+    0x29, 0x00, 0x26, 0xA1, 0x70, 0x00, 0x1F, 0x00, 0x11, 0xB5, 0xF0, 0x00, 0x0E, 0x00, 0x03, 0x42,
+    0x25, 0x34, 0xB6, 0x4F, 0x21, 0x19, 0x41, 0x21, 0x5C, 0x2A, 0x42, 0x13, 0x23, 0xB6, 0x3E, 0x00,
+    0x04, 0x44, 0x23, 0x32, 0x34, 0x39, 0x00, 0x07, 0xB6, 0x1B, 0x26, 0x0E, 0xB6, 0x03, 0x41, 0x27,
+    0x86, 0x95, 0x21, 0x35, 0x04, 0x42, 0x0D, 0x32, 0xB6, 0x0F, 0xA5, 0xC1, 0x42, 0x15, 0x1E, 0xA1,
+    0xB6, 0xB6, 0x7C, 0x42, 0x16, 0x31, 0xB6, 0x83, 0x00, 0x07, 0x42, 0x01, 0x19, 0xA5, 0xC9, 0xB6,
+    0x8A, 0x42, 0x17, 0x31, 0xB6, 0x2B, 0x00, 0x07, 0x41, 0x01, 0xA4, 0x30, 0x42, 0x31, 0x32, 0xA4,
+    0x96, 0x00, 0x04, 0x42, 0x04, 0x13, 0xB6, 0xA3, 0xB6, 0xA3, 0x21, 0x32, 0x07, 0x41, 0x32, 0xB5,
+    0xFB, 0x42, 0x1E, 0x39, 0xB6, 0xB1, 0xB6, 0x9E, 0x42, 0x15, 0x17, 0xB6, 0xB8, 0xB6, 0xB8, 0x43,
+    0x31, 0x32, 0x34, 0x91, 0xE3, 0x00, 0x07, 0x91, 0xE3, 0x41, 0x02, 0xA4, 0xA8, 0x42, 0x23, 0x27,
+    0xB6, 0xCD, 0xB6, 0x87, 0x21, 0x32, 0x07, 0x21, 0x16, 0x03, 0x43, 0x07, 0x19, 0x21, 0x00, 0x11,
+    0x00, 0x03, 0x61, 0x67, 0x43, 0x19, 0x27, 0x31, 0x0F, 0xA0, 0xB3, 0x79, 0x00, 0x0A, 0x41, 0x32,
+    0x5F, 0xA3, 0x42, 0x27, 0x2A, 0x6C, 0x0E, 0x6C, 0x0E, 0xD2, 0x01, 0x04, 0x06, 0x0A, 0x0D, 0x17,
+    0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x27, 0x2A, 0x2B, 0x40, 0x42, 0x00, 0x98, 0xB4, 0xEA,
+    0xB3, 0x8E, 0x00, 0x87, 0x00, 0x84, 0x9C, 0x8B, 0x00, 0x76, 0x00, 0x68, 0x00, 0x5D, 0x00, 0x4F,
+    0x00, 0x4C, 0xA4, 0xEF, 0x00, 0x48, 0x00, 0x3A, 0x00, 0x15, 0x00, 0x0B, 0x00, 0x07, 0x10, 0x54,
+    0x42, 0x31, 0x34, 0xB7, 0x2F, 0x00, 0x37, 0x41, 0x34, 0x71, 0x63, 0x41, 0x32, 0x39, 0xB5, 0x21,
+    0x22, 0x04, 0x41, 0x1E, 0x0F, 0xFE, 0x21, 0x42, 0x04, 0x21, 0x21, 0x03, 0x41, 0x28, 0xB5, 0xD4,
+    0x21, 0x17, 0x04, 0x41, 0x18, 0x64, 0x47, 0x21, 0x1E, 0x04, 0xCA, 0x0C, 0x17, 0x19, 0x1E, 0x22,
+    0x24, 0x27, 0x2A, 0x40, 0x42, 0xB6, 0xFF, 0x28, 0x34, 0x00, 0x23, 0x00, 0x1B, 0xAE, 0x0C, 0xA6,
+    0x95, 0x9B, 0xD7, 0x00, 0x11, 0x00, 0x0A, 0x00, 0x03, 0x43, 0x1E, 0x21, 0x27, 0x1F, 0x02, 0x00,
+    0x1F, 0xB6, 0xB3, 0x41, 0x18, 0x17, 0xDF, 0x44, 0x15, 0x32, 0x34, 0x35, 0xB7, 0x87, 0xB5, 0x78,
+    0x00, 0x04, 0xB4, 0x79, 0xC1, 0x22, 0x7A, 0x2B, 0x21, 0x34, 0x04, 0x43, 0x1E, 0x21, 0x27, 0xB6,
+    0xD5, 0xB5, 0x78, 0xB6, 0xD5, 0x41, 0x19, 0x1A, 0x36, 0x41, 0x31, 0xA4, 0x6C, 0xC4, 0x17, 0x18,
+    0x23, 0x27, 0x89, 0xF8, 0x7B, 0x1E, 0x00, 0x04, 0xB6, 0xAB, 0x21, 0x21, 0x0D, 0x43, 0x32, 0x35,
+    0x38, 0x00, 0x18, 0xB7, 0xAA, 0x00, 0x03, 0x41, 0x14, 0xB6, 0x30, 0xC3, 0x31, 0x32, 0x40, 0x00,
+    0x04, 0xA4, 0xE1, 0xB7, 0xB8, 0x41, 0x0D, 0xB5, 0xA4, 0x21, 0x31, 0x04, 0x41, 0x2A, 0xB7, 0x96,
+    0x21, 0x2A, 0x04, 0x21, 0x31, 0x03, 0x43, 0x02, 0x14, 0x1B, 0x7C, 0x1B, 0xB3, 0x94, 0xB7, 0x80,
+    0xC3, 0x08, 0x14, 0x40, 0x95, 0x18, 0xAD, 0x00, 0x00, 0x0A, 0x42, 0x22, 0x40, 0x99, 0x2A, 0xB4,
+    0x8B, 0x41, 0x34, 0x72, 0x82, 0xC2, 0x19, 0x31, 0x00, 0x04, 0xB7, 0x4A, 0xC1, 0x44, 0xB5, 0xB6,
+    0x42, 0x40, 0x44, 0x2F, 0xA3, 0x1A, 0x9E, 0x21, 0x34, 0x07, 0x43, 0x08, 0x13, 0x20, 0x82, 0xB8,
+    0xB8, 0x01, 0x00, 0x03, 0xC2, 0x31, 0x32, 0x12, 0x43, 0x00, 0x0A, 0x41, 0x1B, 0xB7, 0xE5, 0x21,
+    0x41, 0x04, 0x43, 0x14, 0x19, 0x32, 0xB8, 0x32, 0x00, 0x03, 0x47, 0xF5, 0x41, 0x15, 0x92, 0x6A,
+    0x21, 0x34, 0x04, 0x41, 0x14, 0xB7, 0x37, 0x44, 0x07, 0x14, 0x17, 0x22, 0x00, 0x04, 0x92, 0xB3,
+    0xB8, 0x47, 0xB8, 0x47, 0xC1, 0x1E, 0x80, 0x7C, 0x41, 0x1A, 0xB7, 0xA0, 0x21, 0x22, 0x04, 0x21,
+    0x35, 0x03, 0xC2, 0x19, 0x34, 0x00, 0x03, 0xB5, 0x54, 0x43, 0x22, 0x23, 0x28, 0x00, 0x15, 0xB8,
+    0x69, 0x00, 0x07, 0x42, 0x14, 0x15, 0xB8, 0x73, 0xB8, 0x73, 0x49, 0x1A, 0x24, 0x25, 0x27, 0x2D,
+    0x31, 0x32, 0x33, 0x34, 0xB8, 0x7A, 0xB5, 0x6C, 0xB8, 0x7A, 0xB8, 0x2B, 0xB4, 0x62, 0x40, 0x6C,
+    0x00, 0x11, 0xB8, 0x7A, 0x00, 0x07, 0x41, 0x2B, 0x6F, 0xDA, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0xA1, 0x1B, 0x03, 0x45, 0x14, 0x1A, 0x2D, 0x33, 0x38, 0xB8, 0xA3, 0x00, 0x03, 0xB8, 0x99, 0xB8,
+    0xA3, 0xA7, 0xEF, 0x41, 0x35, 0x20, 0xEA, 0x21, 0x23, 0x04, 0x21, 0x35, 0x03, 0xA1, 0x04, 0x03,
+    0x21, 0x1A, 0x03, 0xC2, 0x27, 0x28, 0xA6, 0xF2, 0x1B, 0xB4, 0x21, 0x4C, 0x07, 0x21, 0x29, 0x03,
+    0xC1, 0x1A, 0xB8, 0x75, 0x41, 0x04, 0xAF, 0x86, 0xA1, 0x15, 0x04, 0x23, 0x01, 0x0D, 0x19, 0x0E,
+    0x0B, 0x03, 0x43, 0x01, 0x04, 0x19, 0xB8, 0xE2, 0xB8, 0xE2, 0xB8, 0xE2, 0xC1, 0x44, 0x7E, 0x9E,
+    0x41, 0x41, 0x62, 0x2D, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x2D, 0x03,
+    0x4A, 0x07, 0x0D, 0x1A, 0x27, 0x31, 0x32, 0x33, 0x34, 0x38, 0x4B, 0xB9, 0x00, 0xB9, 0x00, 0xB9,
+    0x00, 0x00, 0x40, 0x00, 0x25, 0x00, 0x1E, 0xB9, 0x00, 0xB6, 0xF1, 0x00, 0x14, 0x00, 0x03, 0x42,
+    0x21, 0x23, 0xB9, 0x1F, 0xB9, 0x1F, 0x41, 0x23, 0x99, 0xE0, 0x43, 0x19, 0x32, 0x37, 0xB9, 0x2A,
+    0x94, 0x4E, 0xB4, 0xD8, 0x43, 0x01, 0x31, 0x44, 0xB9, 0x34, 0x6A, 0x8D, 0x83, 0xCF, 0x21, 0x1B,
+    0x0A, 0x21, 0x34, 0x03, 0x41, 0x21, 0x9C, 0x43, 0x42, 0x24, 0x32, 0x00, 0x04, 0xB6, 0x30, 0x41,
+    0x34, 0x3B, 0xC9, 0x41, 0x18, 0x9E, 0x5F, 0x21, 0x2D, 0x04, 0x21, 0x37, 0x03, 0x21, 0x1A, 0x03,
+    0x41, 0x31, 0x6E, 0x58, 0x21, 0x16, 0x04, 0x21, 0x1B, 0x03, 0x21, 0x38, 0x03, 0xA1, 0x2D, 0x03,
+    0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x0E, 0x03, 0x21, 0x29, 0x03, 0x22, 0x30, 0x32, 0x1F,
+    0x03, 0x44, 0x07, 0x23, 0x31, 0x38, 0x5B, 0x4E, 0x7C, 0x45, 0x64, 0x0A, 0xB7, 0xF9, 0xCC, 0x01,
+    0x04, 0x0A, 0x17, 0x18, 0x19, 0x1A, 0x20, 0x21, 0x23, 0x2A, 0x2D, 0x00, 0x68, 0xB7, 0x7F, 0x00,
+    0x64, 0xB9, 0x69, 0x00, 0x4D, 0x00, 0x46, 0x20, 0x3C, 0x00, 0x3F, 0x94, 0xB2, 0x00, 0x12, 0x00,
+    0x0D, 0x7E, 0xAF, 0x41, 0x22, 0xAD, 0xA3, 0x21, 0x14, 0x04, 0x21, 0x38, 0x03, 0xA1, 0x2A, 0x03,
+    0x21, 0x21, 0x03, 0x48, 0x14, 0x19, 0x27, 0x31, 0x32, 0x34, 0x35, 0x38, 0xB9, 0xC3, 0xB9, 0xC3,
+    0x00, 0xA4, 0xB9, 0x8A, 0x00, 0x35, 0xB9, 0x74, 0xB9, 0xC3, 0x00, 0x03, 0x46, 0x15, 0x21, 0x32,
+    0x34, 0x35, 0x38, 0xB9, 0xDC, 0xB9, 0xDC, 0xB7, 0xCD, 0x02, 0x59, 0xB6, 0xCE, 0xB7, 0xDE, 0x41,
+    0x14, 0xB4, 0xC4, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03, 0x43,
+    0x01, 0x07, 0x1A, 0x00, 0x03, 0xB9, 0xFF, 0xB9, 0xFF, 0xC3, 0x01, 0x1B, 0x29, 0xBA, 0x09, 0xBA,
+    0x09, 0xBA, 0x09, 0x41, 0x14, 0xB6, 0x05, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1B, 0x03,
+    0x43, 0x01, 0x32, 0x4C, 0x9F, 0x2C, 0xB9, 0xE7, 0xBA, 0x20, 0x21, 0x10, 0x0A, 0xC4, 0x14, 0x17,
+    0x1E, 0x29, 0x00, 0x10, 0x9F, 0xBF, 0x7E, 0xA3, 0x00, 0x03, 0x42, 0x07, 0x08, 0xBA, 0x3A, 0xBA,
+    0x3A, 0x41, 0x48, 0xB2, 0x63, 0x49, 0x07, 0x19, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x38, 0x39, 0xBA,
+    0x45, 0xBA, 0x45, 0xBA, 0x0C, 0xAF, 0x51, 0x00, 0x46, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x0B, 0x00,
+    0x04, 0x41, 0x32, 0x1F, 0xEB, 0xA1, 0x21, 0x04, 0x44, 0x07, 0x31, 0x34, 0x39, 0xBA, 0x68, 0xBA,
+    0x67, 0x00, 0x03, 0xBA, 0x68, 0x41, 0x04, 0xB5, 0xB3, 0x21, 0x19, 0x04, 0x21, 0x34, 0x03, 0xA1,
+    0x2A, 0x03, 0x21, 0x19, 0x03, 0x44, 0x01, 0x07, 0x14, 0x1A, 0xA9, 0xC4, 0xBA, 0x85, 0xBA, 0x85,
+    0xBA, 0x85, 0xC1, 0x42, 0x8B, 0xCD, 0x42, 0x19, 0x22, 0x00, 0x04, 0xBA, 0x96, 0xC1, 0x23, 0x47,
+    0x71, 0x45, 0x01, 0x10, 0x19, 0x21, 0x29, 0xBA, 0xA1, 0xBA, 0xA1, 0xBA, 0xA1, 0xBA, 0xA1, 0x00,
+    0x04, 0x4A, 0x21, 0x22, 0x27, 0x31, 0x32, 0x34, 0x35, 0x38, 0x48, 0x49, 0xBA, 0xB1, 0xBA, 0x62,
+    0x00, 0x2F, 0x00, 0x2C, 0x00, 0x1B, 0x49, 0xC6, 0xBA, 0x9E, 0x00, 0x10, 0xBA, 0x4B, 0xB2, 0xCF,
+    0x41, 0x18, 0x2D, 0x61, 0xA1, 0x32, 0x04, 0x21, 0x19, 0x03, 0x21, 0x32, 0x03, 0x41, 0x30, 0x70,
+    0x92, 0x21, 0x23, 0x04, 0x42, 0x1B, 0x49, 0x00, 0x03, 0xBA, 0xE4, 0x45, 0x21, 0x2D, 0x31, 0x32,
+    0x35, 0xBA, 0xEB, 0x5E, 0xB4, 0xBA, 0xE1, 0xB8, 0xDC, 0x00, 0x07, 0x42, 0x31, 0x32, 0xBA, 0xAC,
+    0xB7, 0xED, 0x42, 0x23, 0x32, 0xB8, 0xD8, 0xBB, 0x02, 0x41, 0x18, 0x37, 0x73, 0x43, 0x14, 0x17,
+    0x19, 0xBB, 0x0D, 0xB8, 0xA6, 0x00, 0x04, 0x43, 0x15, 0x2A, 0x2C, 0xBB, 0x17, 0xBB, 0x17, 0xBB,
+    0x17, 0x48, 0x08, 0x19, 0x23, 0x24, 0x31, 0x32, 0x34, 0x38, 0xB0, 0xB7, 0xB8, 0xBA, 0xB9, 0x12,
+    0x96, 0x45, 0x00, 0x14, 0x00, 0x0A, 0xAA, 0x6D, 0xA9, 0x1B, 0xC6, 0x01, 0x04, 0x1E, 0x21, 0x29,
+    0x2A, 0xBA, 0xF4, 0xBA, 0x02, 0xBB, 0x3A, 0x81, 0x9F, 0xBB, 0x3A, 0xBB, 0x3A, 0x43, 0x1E, 0x31,
+    0x32, 0xBB, 0x4D, 0x03, 0x6D, 0x00, 0x13, 0x42, 0x0D, 0x25, 0xBB, 0x57, 0xBB, 0x57, 0x42, 0x13,
+    0x17, 0xBB, 0x5E, 0xBB, 0x5E, 0x42, 0x02, 0x17, 0xBB, 0x65, 0xBB, 0x65, 0x45, 0x07, 0x27, 0x32,
+    0x38, 0x39, 0xBB, 0x6C, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x07, 0xBB, 0x0E, 0x43, 0x01, 0x17, 0x23,
+    0xB7, 0x57, 0xB9, 0x15, 0xBB, 0x7C, 0x43, 0x07, 0x38, 0x39, 0xA8, 0xC0, 0x00, 0x0A, 0xBB, 0x40,
+    0x42, 0x15, 0x22, 0xBB, 0x90, 0xBB, 0x90, 0x46, 0x21, 0x2D, 0x31, 0x32, 0x36, 0x38, 0x56, 0x9B,
+    0xBB, 0x8D, 0xBA, 0xDC, 0x00, 0x07, 0xBB, 0x8D, 0xB5, 0xEC, 0x41, 0x23, 0x1A, 0xD6, 0x42, 0x23,
+    0x25, 0xB8, 0xAB, 0xBB, 0xAE, 0x21, 0x32, 0x07, 0xC2, 0x01, 0x28, 0x00, 0x03, 0xA9, 0x9A, 0x21,
+    0x34, 0x07, 0x21, 0x15, 0x03, 0x43, 0x15, 0x25, 0x2A, 0xBB, 0xC5, 0xBB, 0xC5, 0xBB, 0xC5, 0x44,
+    0x07, 0x0A, 0x15, 0x17, 0xBB, 0xCF, 0xBB, 0xCF, 0xBB, 0x89, 0xA9, 0x67, 0x45, 0x23, 0x31, 0x32,
+    0x34, 0x35, 0x00, 0x32, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x0D, 0xAB, 0x28, 0x43, 0x21, 0x32, 0x38,
+    0xBB, 0xEC, 0x95, 0x38, 0xBB, 0xEC, 0xC1, 0x19, 0x86, 0x37, 0x21, 0x4C, 0x04, 0x21, 0x13, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0xA1, 0x01, 0x03, 0xC1, 0x2A, 0x71, 0xBA, 0xC2, 0x1E, 0x2B,
+    0xBB, 0xC7, 0x16, 0xBB, 0xC3, 0x17, 0x19, 0x23, 0x00, 0x07, 0x39, 0x0A, 0xBC, 0x14, 0x43, 0x1C,
+    0x20, 0x4C, 0xBB, 0xC0, 0x7B, 0x2C, 0xBC, 0x1E, 0x21, 0x34, 0x0A, 0x21, 0x18, 0x03, 0x21, 0x17,
+    0x03, 0x4A, 0x01, 0x07, 0x1A, 0x1E, 0x21, 0x30, 0x31, 0x32, 0x34, 0x39, 0xBC, 0x31, 0xA9, 0x6B,
+    0x00, 0x2B, 0x00, 0x28, 0xBC, 0x31, 0xBC, 0x31, 0xBC, 0x30, 0x00, 0x1D, 0x00, 0x03, 0x51, 0x19,
+    0x41, 0x22, 0xBB, 0x8A, 0x21, 0x2B, 0x04, 0x21, 0x32, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x19, 0x03,
+    0x42, 0x31, 0x48, 0x00, 0x03, 0xBB, 0xFA, 0x42, 0x32, 0x48, 0xBC, 0x18, 0xB5, 0x79, 0x42, 0x14,
+    0x48, 0xBC, 0x6E, 0xBC, 0x35, 0x21, 0x31, 0x07, 0x43, 0x13, 0x23, 0x2A, 0xBC, 0x78, 0xBC, 0x78,
+    0xBC, 0x78, 0x47, 0x19, 0x21, 0x22, 0x25, 0x27, 0x31, 0x32, 0x92, 0xAE, 0x00, 0x22, 0xBC, 0x30,
+    0x00, 0x1B, 0x00, 0x0D, 0x04, 0x0F, 0x00, 0x0A, 0x44, 0x1A, 0x23, 0x36, 0x38, 0xBC, 0x98, 0xBC,
+    0x98, 0xBC, 0x8E, 0xBC, 0x97, 0x41, 0x08, 0xBC, 0x4D, 0x21, 0x40, 0x04, 0x21, 0x30, 0x03, 0x21,
+    0x23, 0x03, 0xA1, 0x1B, 0x03, 0x21, 0x14, 0x03, 0x43, 0x01, 0x34, 0x35, 0xBC, 0xB8, 0x00, 0x03,
+    0xB3, 0x0B, 0x41, 0x21, 0x5B, 0x75, 0x41, 0x4B, 0xA0, 0xB8, 0x21, 0x14, 0x04, 0x21, 0x30, 0x03,
+    0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03, 0x21, 0x27, 0x03, 0x21, 0x22, 0x03, 0x42, 0x22, 0x4B, 0xBC,
+    0xD2, 0x00, 0x03, 0xC3, 0x34, 0x35, 0x47, 0x00, 0x21, 0x00, 0x07, 0xBC, 0xAA, 0x41, 0x19, 0x9D,
+    0x64, 0x21, 0x31, 0x04, 0xC3, 0x01, 0x23, 0x44, 0x00, 0x03, 0x95, 0x0F, 0x9D, 0x52, 0x41, 0x22,
+    0xB8, 0xE6, 0x44, 0x28, 0x32, 0x35, 0x37, 0x00, 0x0E, 0xBD, 0x02, 0x00, 0x04, 0xBB, 0xF6, 0x41,
+    0x23, 0x9E, 0x71, 0x42, 0x13, 0x49, 0xBC, 0x4D, 0xBC, 0xBE, 0x42, 0x13, 0x28, 0xBC, 0x54, 0x4F,
+    0x41, 0x41, 0x2A, 0xB3, 0xCF, 0x21, 0x34, 0x04, 0xC2, 0x0A, 0x2D, 0xA1, 0xA5, 0x00, 0x03, 0x21,
+    0x10, 0x07, 0x21, 0x34, 0x03, 0x41, 0x32, 0x87, 0x98, 0x21, 0x2D, 0x04, 0x21, 0x19, 0x03, 0x21,
+    0x31, 0x03, 0x21, 0x23, 0x03, 0x22, 0x23, 0x2B, 0x13, 0x03, 0x42, 0x25, 0x2A, 0xBD, 0x4A, 0xBD,
+    0x4A, 0x4C, 0x04, 0x08, 0x0A, 0x14, 0x17, 0x1B, 0x1E, 0x20, 0x21, 0x27, 0x2A, 0x2B, 0xBD, 0x18,
+    0x00, 0x99, 0x72, 0xF7, 0x00, 0x6E, 0x00, 0x4F, 0x00, 0x42, 0x00, 0x3E, 0xBB, 0x53, 0xA2, 0xE3,
+    0x00, 0x37, 0x00, 0x0C, 0x00, 0x07, 0x44, 0x01, 0x08, 0x14, 0x2D, 0xBD, 0x75, 0xBD, 0x76, 0xAF,
+    0x9C, 0xBD, 0x75, 0x42, 0x19, 0x21, 0x45, 0xF0, 0xBD, 0x83, 0x42, 0x07, 0x17, 0xBD, 0x8A, 0xAB,
+    0x22, 0x42, 0x04, 0x0A, 0xBD, 0x91, 0xB3, 0x27, 0x46, 0x04, 0x14, 0x1E, 0x21, 0x22, 0x25, 0x00,
+    0x15, 0xBC, 0xDD, 0x72, 0xB4, 0x00, 0x0E, 0x00, 0x07, 0xBB, 0x89, 0xDC, 0x01, 0x04, 0x08, 0x0A,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x25, 0x27, 0x28,
+    0x2A, 0x2B, 0x2D, 0x2E, 0x40, 0x41, 0x42, 0x44, 0x05, 0x31, 0x05, 0x08, 0x04, 0xAB, 0x03, 0xE8,
+    0x03, 0xCF, 0x03, 0x66, 0x03, 0x43, 0xBB, 0x9C, 0x02, 0xFA, 0x02, 0xD1, 0x02, 0xC0, 0x02, 0xB0,
+    0x02, 0xA9, 0x02, 0x8A, 0x02, 0x5E, 0x02, 0x3F, 0x02, 0x25, 0x02, 0x14, 0x01, 0xCF, 0x01, 0xBF,
+    0x01, 0x7A, 0x01, 0x29, 0x01, 0x13, 0xB4, 0x5D, 0x00, 0x5A, 0x00, 0x35, 0x00, 0x13, 0xBA, 0x78,
+    0xC2, 0x1B, 0x21, 0x48, 0x16, 0xBA, 0x95, 0x41, 0x1A, 0xBD, 0x05, 0x42, 0x15, 0x1A, 0x00, 0x04,
+    0xBD, 0x09, 0x21, 0x38, 0x07, 0x21, 0x22, 0x03, 0xC1, 0x1B, 0x5B, 0xE5, 0x41, 0x1B, 0xBD, 0xB3,
+    0x42, 0x19, 0x27, 0x21, 0x1C, 0xBE, 0x04, 0x4A, 0x01, 0x07, 0x0A, 0x14, 0x15, 0x19, 0x1A, 0x21,
+    0x28, 0x48, 0x00, 0x27, 0xBE, 0x27, 0xBC, 0xD5, 0xBE, 0x27, 0x00, 0x12, 0xBE, 0x27, 0x00, 0x0F,
+    0x00, 0x0B, 0x00, 0x07, 0xBD, 0xEE, 0xC4, 0x0F, 0x23, 0x24, 0x32, 0x49, 0x5E, 0xBC, 0x37, 0xBB,
+    0x38, 0xBE, 0x00, 0x42, 0x20, 0x32, 0xBD, 0x1B, 0xBE, 0x0D, 0xC1, 0x01, 0x73, 0x0C, 0x21, 0x4C,
+    0x04, 0xA1, 0x04, 0x03, 0x41, 0x35, 0xAE, 0x15, 0x43, 0x0D, 0x31, 0x34, 0xBB, 0xA6, 0xBD, 0xAD,
+    0xBB, 0x5A, 0xC2, 0x1A, 0x35, 0xBC, 0xBD, 0xBE, 0x72, 0x41, 0x23, 0xA2, 0xF6, 0x21, 0x28, 0x04,
+    0x21, 0x32, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03, 0xA1, 0x35, 0x03, 0xC1, 0x14, 0x36, 0x12,
+    0xC1, 0x32, 0xAB, 0x72, 0x43, 0x16, 0x20, 0x21, 0x9D, 0xC8, 0xBE, 0x94, 0x73, 0x90, 0xC2, 0x08,
+    0x23, 0xBE, 0x9A, 0xA3, 0x1B, 0x42, 0x13, 0x32, 0xBD, 0xDF, 0xAD, 0xF1, 0x42, 0x31, 0x32, 0xBD,
+    0xF1, 0xBC, 0xAE, 0x41, 0x4C, 0x98, 0xE1, 0x21, 0x22, 0x04, 0x42, 0x0A, 0x17, 0xBE, 0xBA, 0x00,
+    0x03, 0x21, 0x21, 0x07, 0x52, 0x01, 0x04, 0x07, 0x08, 0x0A, 0x13, 0x14, 0x19, 0x1A, 0x1B, 0x20,
+    0x21, 0x22, 0x23, 0x28, 0x29, 0x2A, 0x42, 0x00, 0x7E, 0x00, 0x71, 0x00, 0x63, 0x00, 0x60, 0x00,
+    0x5C, 0x00, 0x52, 0xBE, 0xC4, 0x00, 0x3B, 0x00, 0x38, 0xBA, 0x9F, 0xBB, 0x91, 0x00, 0x34, 0xBE,
+    0xC4, 0x00, 0x30, 0x00, 0x26, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x03, 0xC2, 0x23, 0x31, 0xA4, 0x0B,
+    0xBE, 0xE8, 0x41, 0x13, 0x89, 0xDA, 0x42, 0x04, 0x23, 0xBF, 0x06, 0x7F, 0xF6, 0x21, 0x32, 0x07,
+    0x41, 0x36, 0xBD, 0x01, 0x42, 0x21, 0x22, 0xBF, 0x14, 0xBF, 0x13, 0x21, 0x32, 0x07, 0xC3, 0x15,
+    0x23, 0x2D, 0xBB, 0xB3, 0xBF, 0x1E, 0x7B, 0xF6, 0x42, 0x23, 0x31, 0xAB, 0xB0, 0xAB, 0xB4, 0x41,
+    0x1F, 0x1E, 0x2F, 0x21, 0x2D, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x4C, 0x03, 0x41, 0x1E, 0xBE, 0xE1,
+    0x21, 0x1E, 0x04, 0x43, 0x2A, 0x32, 0x34, 0x00, 0x0A, 0xBB, 0xD4, 0x00, 0x03, 0x42, 0x32, 0x39,
+    0x9B, 0x4E, 0x86, 0x77, 0x42, 0x13, 0x15, 0xBF, 0x54, 0xBF, 0x0E, 0x43, 0x13, 0x31, 0x32, 0x61,
+    0x02, 0xBD, 0x5D, 0x00, 0x07, 0xC3, 0x23, 0x31, 0x32, 0xAE, 0xB1, 0x9A, 0x89, 0xBE, 0xAA, 0x41,
+    0x15, 0x54, 0xF0, 0x21, 0x23, 0x04, 0x43, 0x23, 0x31, 0x32, 0x00, 0x03, 0xBE, 0xC1, 0x17, 0xB7,
+    0x41, 0x27, 0xBF, 0x01, 0x21, 0x02, 0x04, 0x21, 0x44, 0x03, 0x21, 0x23, 0x03, 0x21, 0x29, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0xA1, 0x2D, 0x03, 0x21, 0x32, 0x03, 0x21, 0x19, 0x03, 0x43,
+    0x19, 0x23, 0x2A, 0xBF, 0x9F, 0xBF, 0x9F, 0xBF, 0x9F, 0x21, 0x32, 0x0A, 0x44, 0x09, 0x17, 0x22,
+    0x27, 0xBD, 0xAE, 0xBC, 0x79, 0xBF, 0x27, 0xAE, 0xF8, 0x42, 0x2A, 0x40, 0xBF, 0x9D, 0x86, 0x0A,
+    0x21, 0x19, 0x07, 0xD9, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x0B, 0x0D, 0x13, 0x15, 0x17, 0x19, 0x1A,
+    0x1B, 0x1E, 0x20, 0x21, 0x22, 0x27, 0x28, 0x29, 0x2B, 0x40, 0x42, 0x48, 0x49, 0x00, 0xC8, 0xBF,
+    0x5D, 0x00, 0xC1, 0x00, 0xB6, 0xBF, 0x8A, 0x00, 0xB3, 0xBE, 0x71, 0x00, 0xA8, 0x00, 0xA5, 0x00,
+    0x9B, 0x00, 0x80, 0xBF, 0xC3, 0xBF, 0xBF, 0xBF, 0x0B, 0x00, 0x76, 0x00, 0x68, 0x00, 0x5E, 0x00,
+    0x4D, 0x00, 0x27, 0x19, 0x3D, 0x00, 0x1A, 0x00, 0x17, 0x17, 0xC7, 0xBD, 0xB4, 0x00, 0x03, 0x42,
+    0x0D, 0x32, 0xBF, 0xA9, 0xC0, 0x0F, 0x43, 0x32, 0x34, 0x35, 0xC0, 0x16, 0xB0, 0xA9, 0xC0, 0x16,
+    0x46, 0x0A, 0x14, 0x15, 0x22, 0x48, 0x4A, 0x00, 0x11, 0x00, 0x0A, 0xAB, 0x5A, 0xAE, 0x71, 0xC0,
+    0x20, 0xBF, 0xD1, 0xC1, 0x29, 0xBF, 0xCD, 0x42, 0x01, 0x07, 0x00, 0x04, 0xC0, 0x37, 0x42, 0x2D,
+    0x4B, 0xC0, 0x3E, 0xBF, 0xE9, 0x41, 0x1B, 0x89, 0x67, 0xC2, 0x07, 0x42, 0xC0, 0x49, 0x00, 0x04,
+    0x41, 0x4A, 0xB5, 0xA2, 0x21, 0x23, 0x04, 0x21, 0x1B, 0x03, 0x42, 0x14, 0x1F, 0x00, 0x03, 0xC0,
+    0x5A, 0xC3, 0x14, 0x4A, 0x4B, 0xC0, 0x61, 0x00, 0x07, 0xC0, 0x61, 0x43, 0x19, 0x29, 0x2B, 0x9B,
+    0x05, 0xA2, 0x30, 0xBD, 0x00, 0x21, 0x21, 0x0A, 0xDA, 0x01, 0x07, 0x14, 0x15, 0x19, 0x1A, 0x1B,
+    0x21, 0x27, 0x28, 0x2A, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40,
+    0x42, 0x48, 0x4B, 0x7A, 0xBD, 0xC0, 0x78, 0xC0, 0x78, 0x08, 0x7E, 0x08, 0x73, 0x08, 0x6C, 0xAF,
+    0xB0, 0x08, 0x54, 0x08, 0x46, 0xBD, 0x94, 0x08, 0x38, 0x08, 0x31, 0x02, 0xCD, 0x02, 0x51, 0x01,
+    0xB4, 0xC0, 0x78, 0x00, 0xB5, 0x00, 0x58, 0x00, 0x41, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x17, 0x00,
+    0x03, 0xA6, 0xB5, 0xC0, 0x12, 0xC0, 0x23, 0x41, 0x32, 0x63, 0x86, 0x43, 0x0E, 0x0F, 0x10, 0x00,
+    0x04, 0xC0, 0xAF, 0xC0, 0xCB, 0x43, 0x07, 0x08, 0x29, 0x18, 0x72, 0x6C, 0x3F, 0x00, 0x0A, 0xC4,
+    0x15, 0x1C, 0x28, 0x43, 0xC0, 0xDE, 0xBE, 0xD0, 0xBD, 0xAC, 0xBE, 0xAE, 0x41, 0x38, 0x76, 0x08,
+    0x21, 0x27, 0x04, 0x21, 0x32, 0x03, 0x41, 0x37, 0xB4, 0x48, 0x21, 0x25, 0x04, 0x21, 0x1B, 0x03,
+    0xC4, 0x1B, 0x2D, 0x40, 0x41, 0x8A, 0x88, 0x00, 0x0D, 0x00, 0x03, 0xB6, 0xC0, 0xC1, 0x41, 0x90,
+    0x7E, 0x41, 0x07, 0xAE, 0x27, 0x22, 0x01, 0x31, 0x08, 0x04, 0x41, 0x21, 0xBB, 0x68, 0xC2, 0x04,
+    0x2B, 0xC0, 0xC9, 0x00, 0x04, 0xC2, 0x17, 0x20, 0xBF, 0xE4, 0xA5, 0xA2, 0xC1, 0x42, 0xC0, 0xC0,
+    0xC1, 0x1B, 0xC0, 0xF7, 0x24, 0x01, 0x14, 0x1A, 0x21, 0x16, 0x0F, 0x08, 0x04, 0x41, 0x23, 0xA6,
+    0xB2, 0x21, 0x1B, 0x04, 0xC2, 0x02, 0x40, 0xBE, 0x5C, 0x00, 0x03, 0xC1, 0x2D, 0xA6, 0xDD, 0x21,
+    0x01, 0x04, 0x46, 0x01, 0x07, 0x14, 0x2A, 0x48, 0x4A, 0xC1, 0x52, 0xC1, 0x52, 0x00, 0x0E, 0xB0,
+    0xF7, 0xC1, 0x48, 0x00, 0x03, 0xC1, 0x32, 0xC0, 0x60, 0xC1, 0x39, 0xC0, 0xEA, 0x41, 0x37, 0xB9,
+    0x48, 0x21, 0x25, 0x04, 0xA1, 0x1B, 0x03, 0x41, 0x30, 0xAF, 0xAD, 0x21, 0x23, 0x04, 0xC4, 0x02,
+    0x19, 0x1E, 0x21, 0xC1, 0x7E, 0xC1, 0x18, 0x00, 0x03, 0xC0, 0xF6, 0x41, 0x32, 0x3B, 0x16, 0x41,
+    0x32, 0xC0, 0x54, 0x44, 0x19, 0x21, 0x40, 0x49, 0x00, 0x04, 0xC1, 0x2D, 0x87, 0xE4, 0xBF, 0x84,
+    0x41, 0x21, 0x8D, 0x49, 0x42, 0x14, 0x19, 0xB9, 0x0C, 0xBF, 0x95, 0xD1, 0x01, 0x08, 0x0A, 0x14,
+    0x15, 0x17, 0x1A, 0x1B, 0x1D, 0x21, 0x22, 0x23, 0x27, 0x2A, 0x2B, 0x40, 0x41, 0xC1, 0xAB, 0xA0,
+    0x32, 0xC1, 0x45, 0x00, 0x46, 0x00, 0x42, 0xC0, 0x9F, 0x00, 0x37, 0xC1, 0xA7, 0xC1, 0x45, 0xA1,
+    0x0B, 0x00, 0x2D, 0xBC, 0xE9, 0x00, 0x20, 0x00, 0x18, 0x00, 0x0B, 0x07, 0x36, 0x00, 0x07, 0x42,
+    0x2D, 0x49, 0xC1, 0xDE, 0xBC, 0x2D, 0x21, 0x25, 0x07, 0xA1, 0x1B, 0x03, 0x21, 0x19, 0x03, 0x47,
+    0x07, 0x14, 0x21, 0x27, 0x42, 0x48, 0x49, 0xC1, 0xEF, 0xC1, 0xEF, 0xC1, 0xEF, 0xC1, 0xEF, 0x29,
+    0x9C, 0xBF, 0xE0, 0x00, 0x03, 0xC1, 0x21, 0xA1, 0x83, 0x21, 0x21, 0x04, 0x21, 0x49, 0x03, 0x41,
+    0x25, 0xA1, 0x6F, 0xC3, 0x1B, 0x1C, 0x43, 0x00, 0x04, 0xC1, 0x4D, 0xBF, 0xE2, 0x21, 0x01, 0x0A,
+    0x41, 0x34, 0x22, 0x39, 0xC2, 0x08, 0x1D, 0x00, 0x04, 0xC1, 0x5E, 0x21, 0x01, 0x07, 0x42, 0x07,
+    0x2D, 0xC2, 0x2E, 0xB6, 0x8F, 0x43, 0x19, 0x2D, 0x33, 0xC2, 0x35, 0xBB, 0xAB, 0xC2, 0x35, 0x4F,
+    0x01, 0x07, 0x14, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x37, 0x38, 0x39, 0x48, 0x49, 0xC2,
+    0x3F, 0x01, 0x60, 0x01, 0x3F, 0x01, 0x2A, 0x01, 0x0B, 0xC2, 0x3F, 0x00, 0xED, 0x00, 0x94, 0x00,
+    0x50, 0xB8, 0xB3, 0x00, 0x33, 0x00, 0x22, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0A, 0xC1, 0x21, 0xB6,
+    0x9A, 0x44, 0x23, 0x25, 0x2A, 0x2C, 0x53, 0x8B, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0x44, 0x0A,
+    0x15, 0x18, 0x40, 0xC2, 0x7E, 0xC2, 0x38, 0xC2, 0x7E, 0xA1, 0x1D, 0x48, 0x01, 0x07, 0x14, 0x31,
+    0x32, 0x34, 0x35, 0x38, 0xAB, 0xCE, 0xC2, 0x8B, 0x00, 0x1E, 0x46, 0xD9, 0x00, 0x1A, 0x00, 0x0D,
+    0xB1, 0xD7, 0x9D, 0xAF, 0x41, 0x15, 0x2A, 0x5B, 0x21, 0x31, 0x04, 0xA1, 0x2A, 0x03, 0x21, 0x38,
+    0x03, 0x42, 0x19, 0x22, 0xC2, 0x78, 0x61, 0xA3, 0x43, 0x17, 0x19, 0x2A, 0xC2, 0xB8, 0xC2, 0xB8,
+    0xB8, 0x4E, 0x45, 0x1E, 0x31, 0x32, 0x38, 0x39, 0xC2, 0xC2, 0x00, 0x11, 0x00, 0x0A, 0x72, 0x5A,
+    0x9D, 0xE6, 0x41, 0x07, 0xAF, 0xB4, 0x42, 0x31, 0x32, 0x00, 0x04, 0x03, 0x37, 0xC1, 0x25, 0xB8,
+    0x9D, 0xC1, 0x23, 0x9C, 0x5E, 0x42, 0x1B, 0x2B, 0xC2, 0x96, 0xC2, 0xE4, 0xC3, 0x1A, 0x25, 0x41,
+    0x90, 0x0E, 0xBE, 0xDE, 0x00, 0x07, 0xC2, 0x0B, 0x14, 0xA8, 0x88, 0xC2, 0xDA, 0x41, 0x1B, 0x7F,
+    0x53, 0xA1, 0x40, 0x04, 0x41, 0x22, 0x85, 0x5E, 0x21, 0x38, 0x04, 0x21, 0x25, 0x03, 0xA1, 0x2B,
+    0x03, 0x41, 0x07, 0x9D, 0xE9, 0x21, 0x23, 0x04, 0x21, 0x1B, 0x03, 0x41, 0x19, 0x5D, 0x8F, 0x22,
+    0x41, 0x42, 0x07, 0x04, 0x21, 0x15, 0x05, 0x22, 0x15, 0x42, 0x19, 0x03, 0x21, 0x4C, 0x05, 0xC9,
+    0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x40, 0x00, 0x52, 0x00, 0x4E, 0x00, 0x43, 0x00,
+    0x39, 0xC3, 0x2F, 0x00, 0x2E, 0xC3, 0x2F, 0x00, 0x03, 0x93, 0x3F, 0x45, 0x19, 0x1A, 0x31, 0x32,
+    0x33, 0xC3, 0x4B, 0xC3, 0x4B, 0xC3, 0x41, 0x56, 0x08, 0xC3, 0x4B, 0x41, 0x2B, 0xC2, 0xF2, 0x21,
+    0x32, 0x04, 0x21, 0x01, 0x03, 0x21, 0x30, 0x03, 0x42, 0x1B, 0x23, 0xC3, 0x02, 0x00, 0x03, 0x21,
+    0x32, 0x07, 0x43, 0x30, 0x34, 0x38, 0xC3, 0x72, 0xC2, 0x6D, 0xAA, 0x03, 0x41, 0x40, 0xA9, 0xF0,
+    0x21, 0x32, 0x04, 0x43, 0x19, 0x31, 0x4B, 0xC3, 0x83, 0xC3, 0x79, 0xC3, 0x1D, 0x42, 0x32, 0x33,
+    0xC2, 0x6B, 0xC3, 0x8D, 0x42, 0x2D, 0x34, 0xC1, 0x85, 0xB0, 0x76, 0x43, 0x07, 0x19, 0x31, 0xB5,
+    0xBA, 0xC2, 0x99, 0xC3, 0x91, 0x42, 0x32, 0x35, 0xC0, 0x3A, 0xC3, 0x39, 0x21, 0x25, 0x07, 0x43,
+    0x15, 0x25, 0x2B, 0xC0, 0x44, 0xC3, 0xA5, 0x00, 0x03, 0xCF, 0x01, 0x02, 0x15, 0x17, 0x19, 0x1A,
+    0x1B, 0x21, 0x23, 0x25, 0x27, 0x2B, 0x40, 0x41, 0x42, 0x00, 0x6E, 0xA7, 0xAB, 0x00, 0x4A, 0x00,
+    0x47, 0x00, 0x39, 0x98, 0x4E, 0x00, 0x36, 0xC3, 0xAF, 0x00, 0x2C, 0x00, 0x25, 0xC1, 0x29, 0x00,
+    0x1E, 0x00, 0x0A, 0xAC, 0x1D, 0x8D, 0x41, 0x41, 0x07, 0xA8, 0x60, 0x42, 0x31, 0x33, 0xC3, 0xB2,
+    0xC3, 0xEB, 0xC1, 0x27, 0xA7, 0x0B, 0xC7, 0x01, 0x04, 0x18, 0x32, 0x34, 0x35, 0x4C, 0x63, 0xD4,
+    0xC1, 0xE7, 0xC3, 0xB0, 0x00, 0x04, 0xC3, 0xBD, 0xC3, 0xF6, 0xC3, 0xF6, 0x41, 0x1B, 0xBF, 0x4A,
+    0xC7, 0x01, 0x02, 0x18, 0x1B, 0x29, 0x40, 0x43, 0xAC, 0xE0, 0xC4, 0x10, 0x00, 0x29, 0x00, 0x25,
+    0x00, 0x1A, 0x00, 0x04, 0xC1, 0xDF, 0x42, 0x01, 0x4C, 0x7B, 0xB1, 0xC4, 0x26, 0x21, 0x38, 0x07,
+    0xC2, 0x15, 0x2A, 0xC3, 0xDB, 0x00, 0x03, 0x41, 0x19, 0x70, 0x03, 0x44, 0x04, 0x0A, 0x1B, 0x4C,
+    0xBA, 0xED, 0x00, 0x04, 0x7E, 0x61, 0xC4, 0x3B, 0x21, 0x15, 0x0D, 0x42, 0x19, 0x22, 0x00, 0x03,
+    0xC4, 0x4B, 0x42, 0x1A, 0x2A, 0xC3, 0x50, 0x2E, 0x0B, 0x44, 0x09, 0x31, 0x32, 0x38, 0x80, 0x51,
+    0x00, 0x0E, 0x0B, 0x15, 0x00, 0x07, 0x41, 0x02, 0xA1, 0x8E, 0x21, 0x34, 0x04, 0x41, 0x32, 0x90,
+    0xF6, 0xA2, 0x25, 0x27, 0x07, 0x04, 0x21, 0x21, 0x05, 0x42, 0x32, 0x34, 0xC4, 0x79, 0x00, 0x03,
+    0xC1, 0x1A, 0x39, 0x19, 0x21, 0x01, 0x04, 0x21, 0x08, 0x03, 0x44, 0x08, 0x09, 0x19, 0x40, 0x00,
+    0x31, 0x00, 0x11, 0x90, 0x33, 0x00, 0x03, 0x42, 0x23, 0x38, 0xC4, 0x97, 0xC4, 0x5E, 0x21, 0x0A,
+    0x07, 0xC2, 0x34, 0x35, 0xC3, 0xEC, 0xC4, 0xA1, 0x41, 0x04, 0x91, 0x83, 0x21, 0x04, 0x04, 0x21,
+    0x31, 0x03, 0xC4, 0x01, 0x17, 0x21, 0x27, 0xC4, 0xB2, 0x91, 0x97, 0x00, 0x11, 0x00, 0x03, 0x41,
+    0x34, 0xC4, 0x76, 0x21, 0x12, 0x04, 0x21, 0x38, 0x03, 0x41, 0x19, 0x6C, 0x93, 0x42, 0x34, 0x48,
+    0x00, 0x04, 0xBF, 0x1B, 0xC3, 0x27, 0x2A, 0x2D, 0x00, 0x0E, 0xC4, 0xD4, 0x00, 0x07, 0x21, 0x32,
+    0x0A, 0x44, 0x08, 0x0A, 0x0D, 0x2B, 0x00, 0x2F, 0xC4, 0x7B, 0x00, 0x03, 0xC4, 0x7B, 0xC1, 0x19,
+    0xC1, 0x83, 0x41, 0x34, 0xB2, 0xCD, 0x21, 0x27, 0x04, 0x42, 0x30, 0x32, 0xC4, 0xF9, 0xB1, 0xDB,
+    0x41, 0x2A, 0x3C, 0xD6, 0x43, 0x13, 0x23, 0x2B, 0x00, 0x0B, 0x00, 0x04, 0xB0, 0x3E, 0x41, 0x28,
+    0xA1, 0x0F, 0xC5, 0x02, 0x2A, 0x40, 0x44, 0x46, 0xC4, 0xAC, 0x95, 0x82, 0x00, 0x04, 0x40, 0x5F,
+    0xC5, 0x12, 0x41, 0x27, 0xA7, 0x2F, 0x42, 0x19, 0x40, 0xC4, 0x60, 0x00, 0x04, 0x43, 0x30, 0x32,
+    0x34, 0xC5, 0x2D, 0x00, 0x07, 0xBB, 0xA1, 0x42, 0x23, 0x30, 0xC5, 0x37, 0xC5, 0x37, 0x46, 0x04,
+    0x15, 0x16, 0x19, 0x21, 0x22, 0xBA, 0x90, 0x00, 0x11, 0x00, 0x07, 0xB0, 0x78, 0xA4, 0x83, 0xA9,
+    0xBB, 0x42, 0x1E, 0x27, 0xC4, 0x8B, 0xC4, 0x8B, 0xC3, 0x30, 0x32, 0x4C, 0xC5, 0x58, 0xC5, 0x58,
+    0xC5, 0x58, 0x21, 0x21, 0x0A, 0x41, 0x23, 0xB8, 0x05, 0x21, 0x2B, 0x04, 0x21, 0x40, 0x03, 0x21,
+    0x38, 0x03, 0xC4, 0x08, 0x15, 0x1C, 0x2B, 0x00, 0x03, 0xC4, 0x7C, 0xC5, 0x14, 0x09, 0x22, 0x42,
+    0x30, 0x32, 0xC5, 0x7F, 0xC5, 0x7F, 0x42, 0x01, 0x22, 0x00, 0x07, 0x86, 0x76, 0x42, 0x31, 0x39,
+    0xC5, 0x54, 0xC5, 0x8D, 0x42, 0x08, 0x15, 0x81, 0x8C, 0x00, 0x07, 0x42, 0x27, 0x2A, 0xC2, 0x30,
+    0xC2, 0x30, 0x21, 0x32, 0x07, 0x21, 0x2A, 0x03, 0x42, 0x19, 0x27, 0x19, 0xE1, 0xC5, 0xA8, 0xC5,
+    0x08, 0x22, 0x25, 0x40, 0x41, 0xA8, 0x15, 0xC5, 0x2A, 0xC3, 0xA0, 0x22, 0x2C, 0x96, 0xA7, 0x21,
+    0x19, 0x10, 0x58, 0x01, 0x04, 0x07, 0x08, 0x0A, 0x0D, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x19, 0x1A, 0x1B, 0x22, 0x27, 0x28, 0x2A, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0xB2, 0x2B, 0xAF, 0x01,
+    0x92, 0x01, 0x38, 0x01, 0x24, 0x00, 0xE1, 0x00, 0xD4, 0x00, 0xCC, 0x00, 0xBE, 0x00, 0xB0, 0x00,
+    0x84, 0x00, 0x71, 0x00, 0x60, 0x00, 0x50, 0xC5, 0xC2, 0x1A, 0xA8, 0x00, 0x3C, 0xC5, 0xC2, 0x00,
+    0x2E, 0x00, 0x1D, 0x00, 0x1A, 0x00, 0x03, 0xB9, 0xF6, 0xC5, 0xB8, 0x42, 0x21, 0x2D, 0xC6, 0x0B,
+    0xC6, 0x0B, 0x41, 0x07, 0xA9, 0x2B, 0x21, 0x2D, 0x04, 0x46, 0x21, 0x25, 0x2D, 0x31, 0x33, 0x35,
+    0xC6, 0x19, 0x00, 0x03, 0xC6, 0x18, 0xC5, 0xE0, 0xC6, 0x19, 0xC2, 0x01, 0x42, 0x2D, 0x31, 0xC2,
+    0x14, 0xC5, 0xDD, 0x42, 0x21, 0x48, 0xC6, 0x33, 0xC5, 0x27, 0x41, 0x32, 0xC4, 0x27, 0x21, 0x22,
+    0x04, 0x21, 0x17, 0x03, 0x21, 0x34, 0x03, 0xA1, 0x27, 0x03, 0x21, 0x33, 0x03, 0x42, 0x01, 0x49,
+    0xC6, 0x4D, 0x00, 0x03, 0x42, 0x2D, 0x48, 0xC6, 0x1B, 0xC5, 0xFF, 0x41, 0x22, 0xC1, 0x9D, 0x43,
+    0x19, 0x25, 0x30, 0xC4, 0x3C, 0xC5, 0x99, 0x00, 0x04, 0x41, 0x23, 0xB3, 0x37, 0x42, 0x01, 0x1A,
+    0x00, 0x04, 0xC6, 0x07, 0x42, 0x15, 0x1A, 0xC6, 0x2E, 0xC3, 0x09, 0x42, 0x01, 0x21, 0xC5, 0xEA,
+    0xC5, 0xFC, 0xD3, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x27,
+    0x31, 0x35, 0x40, 0x41, 0x43, 0x44, 0xB8, 0xF2, 0x00, 0x77, 0x00, 0x69, 0x00, 0x56, 0x00, 0x4F,
+    0x92, 0xA8, 0x00, 0x35, 0x00, 0x2E, 0xBE, 0x87, 0x00, 0x23, 0xC6, 0x7E, 0xC6, 0x7E, 0xC3, 0x17,
+    0xC6, 0x49, 0x85, 0x16, 0x00, 0x15, 0x00, 0x0E, 0x84, 0x99, 0x00, 0x07, 0x41, 0x15, 0x93, 0x97,
+    0x21, 0x15, 0x04, 0x43, 0x19, 0x34, 0x35, 0xC3, 0x58, 0x00, 0x03, 0xC6, 0x8A, 0x42, 0x1A, 0x2B,
+    0xC4, 0xCF, 0x0F, 0xDF, 0x42, 0x25, 0x34, 0xB2, 0x0E, 0x00, 0x07, 0xC1, 0x16, 0xC6, 0x75, 0xA1,
+    0x01, 0x04, 0xC1, 0x0A, 0xA2, 0x02, 0xC1, 0x15, 0x76, 0xE0, 0xC1, 0x14, 0xC6, 0x8C, 0xC8, 0x01,
+    0x19, 0x20, 0x2A, 0x30, 0x32, 0x34, 0x35, 0x00, 0x0C, 0xC6, 0x66, 0x34, 0xF0, 0xC5, 0xB6, 0xC6,
+    0xEE, 0x00, 0x08, 0x00, 0x04, 0xC6, 0xEE, 0xC1, 0x2B, 0xAA, 0xF9, 0x41, 0x21, 0x26, 0xF4, 0x21,
+    0x42, 0x04, 0x42, 0x34, 0x35, 0x00, 0x03, 0xC7, 0x12, 0x41, 0x07, 0xB5, 0x78, 0x41, 0x01, 0xC1,
+    0x8F, 0x21, 0x42, 0x04, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0xC5, 0x1B, 0x31, 0x32, 0x38, 0x48,
+    0xC7, 0x2A, 0x00, 0x11, 0xC6, 0xF1, 0xB5, 0x89, 0x00, 0x03, 0x41, 0x2D, 0x8C, 0x5B, 0x21, 0x4C,
+    0x04, 0x21, 0x15, 0x03, 0x21, 0x15, 0x03, 0x21, 0x34, 0x03, 0x41, 0x21, 0xA9, 0xD0, 0x41, 0x40,
+    0xC6, 0xE2, 0xC8, 0x08, 0x14, 0x17, 0x19, 0x30, 0x32, 0x34, 0x35, 0x00, 0x0B, 0xC7, 0x48, 0x99,
+    0x9D, 0xA8, 0xBC, 0xC7, 0x52, 0x00, 0x08, 0x00, 0x04, 0xC6, 0x97, 0x41, 0x32, 0xC6, 0x46, 0x21,
+    0x06, 0x04, 0x21, 0x07, 0x03, 0x21, 0x31, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x35, 0x03, 0x21, 0x22,
+    0x03, 0x21, 0x2B, 0x03, 0x41, 0x38, 0xB4, 0x66, 0x21, 0x23, 0x04, 0xC5, 0x21, 0x2D, 0x31, 0x34,
+    0x35, 0x85, 0xE6, 0x00, 0x0A, 0xC6, 0x86, 0x00, 0x03, 0xA2, 0xAF, 0x41, 0x27, 0xAC, 0x18, 0x41,
+    0x42, 0xC3, 0x87, 0x21, 0x34, 0x04, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x43, 0x01, 0x0A, 0x21,
+    0x00, 0x11, 0xC4, 0xC4, 0x00, 0x03, 0x41, 0x32, 0x5C, 0x9E, 0x42, 0x09, 0x0A, 0xC7, 0x02, 0x00,
+    0x04, 0x41, 0x21, 0xC7, 0x3C, 0x44, 0x04, 0x15, 0x23, 0x40, 0xC7, 0xC5, 0xA9, 0x2F, 0xC6, 0xFF,
+    0x62, 0x56, 0xC9, 0x04, 0x21, 0x29, 0x2D, 0x32, 0x34, 0x35, 0x40, 0x4C, 0xC7, 0xB9, 0xC7, 0x0C,
+    0x67, 0x6E, 0xB4, 0xB4, 0x00, 0x26, 0x00, 0x18, 0xB4, 0xB4, 0x00, 0x11, 0x00, 0x0D, 0x41, 0x22,
+    0x3B, 0x93, 0x21, 0x25, 0x04, 0x21, 0x44, 0x03, 0xC4, 0x32, 0x34, 0x35, 0x4C, 0x65, 0xE8, 0x00,
+    0x03, 0xC7, 0xF8, 0xC5, 0xE9, 0xC4, 0x01, 0x08, 0x32, 0x46, 0xC8, 0x05, 0x98, 0x2C, 0xC7, 0xBF,
+    0xC8, 0x05, 0xC1, 0x32, 0xB7, 0x5E, 0x43, 0x19, 0x35, 0x38, 0xC7, 0x14, 0xC7, 0x85, 0xB7, 0x62,
+    0x41, 0x44, 0x2D, 0xD3, 0x21, 0x2A, 0x04, 0x21, 0x25, 0x07, 0x44, 0x01, 0x15, 0x25, 0x2A, 0xC7,
+    0xAB, 0x71, 0xAA, 0x00, 0x06, 0x00, 0x03, 0xD7, 0x01, 0x07, 0x08, 0x0F, 0x10, 0x13, 0x14, 0x15,
+    0x17, 0x19, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x2B, 0x40, 0x42, 0x44, 0x01,
+    0xB5, 0xC8, 0x37, 0x01, 0x74, 0x01, 0x63, 0x01, 0x58, 0x01, 0x49, 0x01, 0x30, 0x01, 0x25, 0x01,
+    0x0D, 0x00, 0xE5, 0x00, 0xAC, 0x92, 0x74, 0xC8, 0x37, 0x09, 0xA7, 0x00, 0x65, 0x00, 0x3F, 0x00,
+    0x32, 0x73, 0x62, 0x00, 0x25, 0x00, 0x21, 0x00, 0x0D, 0x01, 0x2C, 0xC7, 0xFE, 0x43, 0x19, 0x21,
+    0x2D, 0xC5, 0x95, 0xC7, 0x7E, 0x5D, 0xAC, 0x42, 0x19, 0x2D, 0x8E, 0xB7, 0x5D, 0xB6, 0x42, 0x04,
+    0x1B, 0xC8, 0x30, 0xC7, 0x82, 0x42, 0x01, 0x10, 0xC8, 0x95, 0xC5, 0x2A, 0x41, 0x11, 0xC5, 0x31,
+    0xC5, 0x09, 0x15, 0x1A, 0x1B, 0x40, 0xC8, 0x9C, 0xC6, 0x76, 0xC6, 0x7D, 0xC8, 0x9C, 0x50, 0xB9,
+    0x41, 0x22, 0xB7, 0x0F, 0x21, 0x31, 0x04, 0x21, 0x2B, 0x03, 0xA1, 0x21, 0x03, 0xC4, 0x06, 0x08,
+    0x20, 0x25, 0xC5, 0xAB, 0x74, 0x27, 0x8F, 0xE3, 0xB7, 0x0E, 0x44, 0x15, 0x32, 0x34, 0x38, 0xC5,
+    0x5F, 0x00, 0x10, 0xC8, 0xCA, 0x00, 0x0D, 0x41, 0x1C, 0xC7, 0xB5, 0x41, 0x04, 0xC5, 0xF7, 0x21,
+    0x07, 0x04, 0xC3, 0x21, 0x30, 0x31, 0xAB, 0xE1, 0xC8, 0xE2, 0x00, 0x03, 0x42, 0x04, 0x25, 0x68,
+    0x88, 0x9D, 0xBA, 0x21, 0x40, 0x07, 0x21, 0x23, 0x03, 0x42, 0x15, 0x22, 0x00, 0x03, 0x91, 0x93,
+    0x41, 0x20, 0x02, 0xC6, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xC3, 0x15, 0x1B, 0x42, 0xC8, 0xB5,
+    0x00, 0x03, 0xC5, 0xFC, 0x42, 0x19, 0x21, 0x00, 0x0A, 0xC9, 0x14, 0x56, 0x01, 0x04, 0x07, 0x0E,
+    0x0F, 0x10, 0x13, 0x14, 0x15, 0x19, 0x1B, 0x22, 0x25, 0x28, 0x2A, 0x2B, 0x41, 0x42, 0x44, 0x48,
+    0x49, 0x4B, 0x00, 0x9E, 0x00, 0x94, 0x00, 0x8D, 0xC9, 0x1A, 0x00, 0x86, 0xB4, 0x55, 0x00, 0x7F,
+    0x00, 0x7B, 0x00, 0x51, 0x1E, 0x05, 0x00, 0x44, 0x00, 0x39, 0xA9, 0xE8, 0x56, 0xDF, 0xC6, 0xF8,
+    0xAE, 0x56, 0xAB, 0xC8, 0x00, 0x22, 0xB5, 0xFD, 0x00, 0x07, 0xBD, 0x89, 0xC8, 0x16, 0xC5, 0x01,
+    0x19, 0x25, 0x2B, 0x44, 0xC8, 0xF8, 0xC9, 0x5D, 0xC7, 0x34, 0xA2, 0xDB, 0xB5, 0xF6, 0x41, 0x21,
+    0x74, 0x99, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x1A, 0x03, 0xC1, 0x31,
+    0xC9, 0x74, 0x41, 0x17, 0xAF, 0x14, 0x21, 0x34, 0x04, 0x21, 0x0F, 0x03, 0x41, 0x42, 0x0A, 0x0C,
+    0x21, 0x30, 0x04, 0xC2, 0x30, 0x32, 0xC9, 0x93, 0xC9, 0x93, 0xA1, 0x01, 0x07, 0x41, 0x09, 0xC9,
+    0x64, 0xA1, 0x44, 0x04, 0xD0, 0x01, 0x07, 0x10, 0x15, 0x19, 0x1A, 0x1B, 0x21, 0x25, 0x28, 0x2C,
+    0x41, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x46, 0x00, 0x29, 0xC6, 0x39, 0xB4, 0xDE, 0x00, 0x26, 0xC9,
+    0xA4, 0x00, 0x1B, 0x00, 0x14, 0xAE, 0xCE, 0x57, 0x68, 0x00, 0x0A, 0x98, 0x97, 0x00, 0x03, 0xC9,
+    0xA4, 0xA7, 0x72, 0xC9, 0xA4, 0xC1, 0x1B, 0xC7, 0xB2, 0x41, 0x07, 0xAD, 0x58, 0x45, 0x01, 0x07,
+    0x48, 0x49, 0x4B, 0xC9, 0xDD, 0x00, 0x08, 0x00, 0x04, 0xC9, 0x8E, 0xC9, 0xD3, 0x41, 0x1B, 0x9D,
+    0x9F, 0x45, 0x14, 0x19, 0x2D, 0x49, 0x4B, 0x00, 0x04, 0x9D, 0xCA, 0xC9, 0xF1, 0x68, 0xFE, 0xC9,
+    0x9C, 0x41, 0x38, 0xC9, 0x46, 0xA1, 0x1B, 0x04, 0x41, 0x11, 0xBD, 0xFC, 0x42, 0x19, 0x20, 0xAB,
+    0x3C, 0xC6, 0xD9, 0xC1, 0x1B, 0xBC, 0x32, 0x42, 0x1C, 0x30, 0xC6, 0xAC, 0xCA, 0x17, 0x41, 0x1E,
+    0xC6, 0xB3, 0x41, 0x13, 0xC7, 0x29, 0xC3, 0x13, 0x1E, 0x32, 0xC6, 0xBB, 0xCA, 0x26, 0x00, 0x04,
+    0x41, 0x2B, 0xB4, 0xA6, 0x41, 0x23, 0x30, 0x71, 0x41, 0x01, 0xC4, 0xA6, 0x43, 0x07, 0x21, 0x22,
+    0x00, 0x04, 0xCA, 0x3C, 0xCA, 0x3C, 0xD9, 0x01, 0x04, 0x07, 0x08, 0x0A, 0x0F, 0x13, 0x14, 0x15,
+    0x16, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x2C, 0x41, 0x42, 0x48, 0x49, 0x4A, 0x4B,
+    0x00, 0x41, 0xB4, 0xBC, 0x21, 0xE3, 0x75, 0xB0, 0x75, 0xB0, 0xCA, 0x46, 0x00, 0x3E, 0xCA, 0x46,
+    0xB3, 0x21, 0x18, 0x87, 0x00, 0x3A, 0x00, 0x33, 0x00, 0x2F, 0x00, 0x28, 0xCA, 0x46, 0xCA, 0x46,
+    0x00, 0x20, 0xCA, 0x2D, 0x9A, 0xB6, 0x00, 0x16, 0x00, 0x12, 0xC8, 0x37, 0x00, 0x0A, 0x2E, 0xD0,
+    0x84, 0xDC, 0xC2, 0x1A, 0x27, 0x3F, 0x2B, 0x45, 0xEA, 0x21, 0x22, 0x07, 0x21, 0x35, 0x03, 0x44,
+    0x01, 0x19, 0x32, 0x34, 0xC7, 0x34, 0x00, 0x03, 0xCA, 0x9F, 0xC7, 0x91, 0x41, 0x21, 0xBD, 0x83,
+    0x21, 0x40, 0x04, 0x21, 0x35, 0x03, 0x41, 0x32, 0x43, 0x48, 0x21, 0x25, 0x04, 0xC4, 0x0B, 0x1B,
+    0x32, 0x40, 0x00, 0x0A, 0x00, 0x03, 0xCA, 0xBD, 0xB4, 0x04, 0x41, 0x07, 0x8C, 0x7C, 0x21, 0x2D,
+    0x04, 0xA1, 0x01, 0x03, 0x42, 0x32, 0x39, 0xCA, 0x19, 0x00, 0x03, 0x41, 0x43, 0xC6, 0xC3, 0x21,
+    0x07, 0x04, 0x42, 0x27, 0x2D, 0xCA, 0x93, 0x00, 0x03, 0x41, 0x1E, 0x39, 0xE3, 0x21, 0x07, 0x04,
+    0x21, 0x34, 0x03, 0x21, 0x21, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x21,
+    0x08, 0x03, 0xC4, 0x04, 0x17, 0x22, 0x40, 0x58, 0x23, 0x00, 0x20, 0xC8, 0x72, 0x00, 0x03, 0x41,
+    0x22, 0xC4, 0x21, 0x21, 0x49, 0x04, 0x21, 0x39, 0x03, 0x21, 0x1B, 0x03, 0x22, 0x48, 0x49, 0x03,
+    0x03, 0x21, 0x35, 0x05, 0x21, 0x22, 0x03, 0xCD, 0x02, 0x08, 0x0A, 0x14, 0x15, 0x19, 0x21, 0x23,
+    0x25, 0x27, 0x40, 0x48, 0x49, 0xCA, 0xEE, 0xB2, 0xEB, 0x00, 0x88, 0x09, 0xC2, 0xB6, 0x61, 0x00,
+    0x6A, 0x2B, 0xFF, 0xC7, 0xBC, 0x00, 0x53, 0xCA, 0xC1, 0xCA, 0xC9, 0x00, 0x25, 0x00, 0x03, 0x42,
+    0x13, 0x2A, 0xCA, 0x89, 0xCB, 0x4F, 0x21, 0x27, 0x07, 0x41, 0x0F, 0xB6, 0x93, 0xC2, 0x18, 0x23,
+    0x2B, 0x4E, 0xCA, 0xD5, 0x22, 0x01, 0x22, 0x0B, 0x07, 0x41, 0x4C, 0xCB, 0x30, 0x21, 0x23, 0x04,
+    0x21, 0x2D, 0x03, 0xA1, 0x04, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x2D, 0x03, 0xC1, 0x1B, 0xAC, 0xE6,
+    0xC1, 0x1B, 0xAD, 0xE6, 0x43, 0x07, 0x19, 0x22, 0xCB, 0x84, 0x00, 0x04, 0xCB, 0x84, 0x42, 0x07,
+    0x34, 0xCB, 0x8E, 0xC7, 0x76, 0x42, 0x14, 0x1E, 0xC8, 0xDD, 0xC8, 0x2A, 0x41, 0x21, 0xCB, 0x9B,
+    0xCE, 0x07, 0x0A, 0x0B, 0x14, 0x15, 0x19, 0x1B, 0x22, 0x27, 0x2A, 0x40, 0x41, 0x42, 0x43, 0xCB,
+    0xA0, 0xC6, 0xDE, 0xCB, 0x93, 0x00, 0x12, 0x50, 0x15, 0xAD, 0x5B, 0xC7, 0x16, 0xCB, 0xA0, 0xCB,
+    0xA0, 0x6E, 0xCA, 0xAB, 0xE6, 0x00, 0x0B, 0x00, 0x04, 0xB8, 0x82, 0x45, 0x07, 0x19, 0x27, 0x2D,
+    0x32, 0xCB, 0xCB, 0x00, 0x4F, 0x00, 0x47, 0xCB, 0xC1, 0x00, 0x2B, 0x41, 0x49, 0xCB, 0x6F, 0x21,
+    0x35, 0x04, 0x21, 0x1B, 0x03, 0xA1, 0x40, 0x03, 0x21, 0x19, 0x03, 0xC1, 0x01, 0xCA, 0xE9, 0x41,
+    0x1E, 0xA4, 0x61, 0x21, 0x39, 0x04, 0x21, 0x23, 0x03, 0x21, 0x15, 0x03, 0x21, 0x31, 0x03, 0xA1,
+    0x28, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x32, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03, 0xC1, 0x2D,
+    0xCC, 0x0E, 0xC5, 0x07, 0x19, 0x21, 0x22, 0x41, 0x00, 0x27, 0xCC, 0x12, 0x00, 0x07, 0x00, 0x04,
+    0xC2, 0xED, 0xC3, 0x1A, 0x22, 0x25, 0xCC, 0x22, 0xCC, 0x22, 0x6F, 0xEB, 0xC4, 0x07, 0x19, 0x1A,
+    0x22, 0xCC, 0x2C, 0x00, 0x0A, 0xCC, 0x2C, 0xC4, 0x3F, 0x44, 0x27, 0x2D, 0x32, 0x33, 0x00, 0x51,
+    0x00, 0x27, 0x00, 0x0D, 0xCC, 0x39, 0xC1, 0x01, 0xAD, 0xB0, 0x42, 0x01, 0x1B, 0x00, 0x04, 0xA3,
+    0x22, 0x43, 0x2D, 0x30, 0x32, 0x00, 0x07, 0xB4, 0x11, 0xC0, 0x14, 0x42, 0x2D, 0x32, 0x70, 0x24,
+    0xCC, 0x5B, 0x5F, 0x28, 0x01, 0x07, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A,
+    0x1B, 0x20, 0x21, 0x23, 0x24, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x42, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x16, 0x2C, 0xBC, 0xC2,
+    0x16, 0x13, 0x15, 0x32, 0x14, 0xE9, 0x14, 0xDB, 0xCC, 0x62, 0x14, 0xCA, 0x14, 0xC7, 0x14, 0xA5,
+    0x14, 0x97, 0xCC, 0x62, 0x14, 0x89, 0x14, 0x7F, 0x14, 0x72, 0x0B, 0xEA, 0x0B, 0x8D, 0x0A, 0x23,
+    0x09, 0xD7, 0x09, 0xB4, 0x09, 0xA0, 0x09, 0x8C, 0x09, 0x33, 0x08, 0xA9, 0x06, 0xA0, 0x04, 0x2B,
+    0xCC, 0x62, 0x03, 0x47, 0x02, 0xBE, 0x02, 0x85, 0x02, 0x71, 0x02, 0x1C, 0x01, 0x3B, 0x01, 0x0C,
+    0x00, 0xFE, 0x00, 0xE9, 0x00, 0x97, 0x00, 0x29, 0x00, 0x11, 0x00, 0x07, 0x43, 0x07, 0x31, 0x34,
+    0xCC, 0xDB, 0xCC, 0xA3, 0xCC, 0xA3, 0xC2, 0x22, 0x23, 0xCC, 0xE6, 0xCA, 0xBC, 0xA2, 0x1C, 0x32,
+    0x11, 0x07, 0x41, 0x39, 0x95, 0x8C, 0xC9, 0x01, 0x02, 0x04, 0x0A, 0x1F, 0x2D, 0x30, 0x32, 0x48,
+    0xCC, 0xF6, 0xB0, 0xE8, 0xCB, 0xD4, 0x00, 0x04, 0xCC, 0xDD, 0xC8, 0xDE, 0xCC, 0xF6, 0xCC, 0xA7,
+    0xCC, 0x9B, 0x44, 0x07, 0x0D, 0x31, 0x32, 0xCD, 0x12, 0xCD, 0x12, 0xB0, 0x36, 0xCC, 0xD9, 0xC1,
+    0x17, 0xCC, 0xD9, 0x42, 0x19, 0x28, 0x00, 0x04, 0xC9, 0xDF, 0x21, 0x34, 0x07, 0x41, 0x23, 0x82,
+    0x29, 0x21, 0x23, 0x04, 0xA1, 0x04, 0x03, 0x21, 0x07, 0x03, 0xA1, 0x38, 0x03, 0x42, 0x01, 0x0A,
+    0xCD, 0x3D, 0xCD, 0x3D, 0x44, 0x27, 0x31, 0x34, 0x36, 0x00, 0x07, 0xCD, 0x3A, 0xCC, 0xF5, 0xCD,
+    0x43, 0x41, 0x07, 0xA8, 0x0E, 0x21, 0x34, 0x04, 0x41, 0x4A, 0xC5, 0xB1, 0x41, 0x1B, 0xC7, 0xCE,
+    0x41, 0x1B, 0xC8, 0xD6, 0xC9, 0x0B, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x40, 0x42, 0x44, 0x00, 0x0F,
+    0xCD, 0x12, 0xCD, 0x57, 0x00, 0x0C, 0xAF, 0x79, 0xC8, 0xA2, 0x00, 0x08, 0x00, 0x04, 0xB7, 0xEE,
+    0xC1, 0x27, 0xAF, 0x91, 0x42, 0x1E, 0x2A, 0xCD, 0x83, 0x00, 0x04, 0x44, 0x13, 0x2A, 0x34, 0x38,
+    0xCD, 0x8B, 0xCA, 0xA7, 0xCA, 0x7D, 0x00, 0x07, 0x41, 0x38, 0x33, 0x9D, 0x41, 0x44, 0xA4, 0x6D,
+    0x21, 0x22, 0x04, 0x21, 0x2D, 0x03, 0x42, 0x25, 0x31, 0x00, 0x03, 0x6C, 0xD1, 0x41, 0x1E, 0xCB,
+    0x46, 0x21, 0x31, 0x04, 0xC1, 0x44, 0xBA, 0x96, 0x44, 0x01, 0x14, 0x1A, 0x27, 0x00, 0x04, 0xCD,
+    0xB8, 0xCD, 0xB8, 0xCA, 0x4D, 0x41, 0x2A, 0x57, 0xFC, 0x21, 0x34, 0x04, 0xC4, 0x0D, 0x19, 0x1C,
+    0x2B, 0xCD, 0xCC, 0x00, 0x03, 0xCD, 0x6E, 0xCC, 0x94, 0xC3, 0x01, 0x1C, 0x20, 0xB2, 0xE5, 0xCD,
+    0x7B, 0xCD, 0xB4, 0xC3, 0x01, 0x15, 0x19, 0xCD, 0xE3, 0x00, 0x0A, 0xCD, 0xE3, 0xC1, 0x1C, 0xC4,
+    0x9B, 0x42, 0x01, 0x48, 0xCD, 0xF1, 0xCD, 0xE7, 0xC5, 0x07, 0x14, 0x19, 0x1A, 0x22, 0xCD, 0xF8,
+    0xCD, 0xF8, 0xCD, 0xF8, 0xCD, 0xF8, 0xCD, 0xF8, 0x41, 0x1A, 0xCE, 0x07, 0xC2, 0x1A, 0x41, 0xCD,
+    0xBD, 0x00, 0x04, 0x41, 0x2D, 0xC2, 0x74, 0xD1, 0x01, 0x04, 0x07, 0x1C, 0x1E, 0x25, 0x2D, 0x30,
+    0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x47, 0xCE, 0x17, 0x00, 0x7F, 0xCE, 0x17, 0xAB,
+    0x3B, 0x00, 0x71, 0x00, 0x66, 0xCE, 0x17, 0xCE, 0x17, 0x00, 0x5F, 0x00, 0x4B, 0x00, 0x34, 0x00,
+    0x2A, 0x00, 0x26, 0xCD, 0xC2, 0x00, 0x1F, 0x00, 0x0B, 0x00, 0x04, 0xC1, 0x1C, 0xCD, 0x49, 0xC1,
+    0x01, 0xC2, 0x3F, 0x43, 0x19, 0x22, 0x32, 0x00, 0x08, 0xCE, 0x53, 0x00, 0x04, 0x41, 0x40, 0xBB,
+    0x3F, 0x41, 0x0E, 0xCE, 0x1B, 0x21, 0x29, 0x04, 0x21, 0x32, 0x03, 0x21, 0x23, 0x03, 0x21, 0x02,
+    0x03, 0x21, 0x38, 0x03, 0xC4, 0x1C, 0x2A, 0x40, 0x42, 0x00, 0x17, 0x00, 0x03, 0x95, 0xB8, 0xC0,
+    0x6C, 0x43, 0x19, 0x22, 0x23, 0xCE, 0x81, 0xCE, 0x81, 0xCE, 0x81, 0x22, 0x21, 0x32, 0x17, 0x0A,
+    0xC1, 0x42, 0x8F, 0xFB, 0x47, 0x01, 0x07, 0x14, 0x1A, 0x21, 0x27, 0x39, 0xCE, 0x94, 0xCE, 0x94,
+    0xCE, 0x94, 0xCE, 0x94, 0x00, 0x04, 0xCE, 0x45, 0xCE, 0x5B, 0xC4, 0x14, 0x2A, 0x2D, 0x41, 0xCE,
+    0x44, 0xCE, 0x44, 0xC7, 0x03, 0x82, 0xFA, 0x41, 0x09, 0xCC, 0xA8, 0x42, 0x21, 0x48, 0xCE, 0xBB,
+    0xCE, 0xBB, 0x43, 0x01, 0x1C, 0x2B, 0xCE, 0xC2, 0xCE, 0x31, 0x00, 0x07, 0xC5, 0x02, 0x0A, 0x2A,
+    0x42, 0x44, 0xC6, 0xEA, 0xCE, 0x06, 0xB6, 0x18, 0x00, 0x15, 0x00, 0x0A, 0x42, 0x31, 0x48, 0xCE,
+    0xA3, 0xC9, 0x2A, 0xA1, 0x1C, 0x07, 0x42, 0x27, 0x32, 0xCE, 0xAD, 0xBE, 0xDD, 0x41, 0x0A, 0xB2,
+    0x0D, 0x21, 0x34, 0x04, 0xC3, 0x1C, 0x27, 0x41, 0x00, 0x0E, 0x00, 0x03, 0x16, 0xC9, 0x48, 0x01,
+    0x04, 0x07, 0x14, 0x19, 0x1A, 0x27, 0x2A, 0x00, 0x32, 0xBE, 0x43, 0x83, 0x1D, 0x00, 0x1B, 0x00,
+    0x0A, 0xCE, 0xFE, 0xCC, 0x05, 0xBB, 0xE0, 0xC3, 0x1C, 0x33, 0x42, 0xCC, 0xF4, 0xCF, 0x17, 0x9C,
+    0x23, 0x41, 0x31, 0xC8, 0x97, 0xC3, 0x1B, 0x1C, 0x25, 0xC3, 0x15, 0x00, 0x04, 0xCD, 0x16, 0xC2,
+    0x04, 0x32, 0x9E, 0x6E, 0xCF, 0x2F, 0x42, 0x01, 0x02, 0xCF, 0x36, 0xCF, 0x36, 0x21, 0x38, 0x07,
+    0xCA, 0x01, 0x07, 0x13, 0x14, 0x15, 0x21, 0x22, 0x25, 0x2A, 0x2B, 0xCF, 0x40, 0xCF, 0x40, 0xAC,
+    0x68, 0x00, 0x29, 0xBA, 0x7A, 0xCF, 0x40, 0x00, 0x1B, 0x00, 0x11, 0x00, 0x03, 0xC7, 0x1F, 0x42,
+    0x31, 0x49, 0xC3, 0x76, 0xC8, 0x71, 0x41, 0x1C, 0xCF, 0x65, 0xC8, 0x01, 0x15, 0x17, 0x19, 0x1C,
+    0x2B, 0x41, 0x43, 0xCF, 0x6A, 0xCF, 0x04, 0xCC, 0xDA, 0x00, 0x0B, 0xCE, 0xA4, 0xCF, 0x51, 0x00,
+    0x04, 0xCD, 0x39, 0x41, 0x19, 0xCD, 0x60, 0xC5, 0x19, 0x1A, 0x1B, 0x2B, 0x48, 0xAE, 0xE7, 0xCF,
+    0x7A, 0xCF, 0x83, 0x00, 0x04, 0xCF, 0x21, 0xC5, 0x07, 0x14, 0x15, 0x19, 0x27, 0xCF, 0x97, 0x00,
+    0x2D, 0xCF, 0x97, 0xCF, 0x97, 0x00, 0x10, 0x41, 0x2A, 0xA4, 0x7F, 0xC8, 0x14, 0x15, 0x1A, 0x1F,
+    0x2B, 0x2D, 0x40, 0x49, 0xCA, 0x65, 0xCF, 0xAB, 0x89, 0x24, 0xCA, 0xE9, 0xBD, 0x47, 0xC8, 0xBD,
+    0x00, 0x04, 0x37, 0x62, 0xC1, 0x1C, 0xCD, 0x9A, 0x21, 0x07, 0x04, 0x43, 0x07, 0x48, 0x49, 0xCF,
+    0xCB, 0x00, 0x03, 0xCF, 0xC1, 0x42, 0x32, 0x48, 0xBF, 0xCC, 0xCE, 0xC9, 0xA1, 0x1C, 0x07, 0x41,
+    0x1C, 0xCF, 0xD5, 0xA2, 0x14, 0x22, 0x07, 0x04, 0x42, 0x27, 0x2D, 0xCF, 0xDE, 0xCF, 0xE7, 0xC5,
+    0x02, 0x14, 0x1E, 0x21, 0x2B, 0xC5, 0x41, 0x00, 0x07, 0xCE, 0xED, 0xCF, 0x9D, 0xCF, 0xD6, 0x42,
+    0x31, 0x49, 0xCB, 0xE7, 0xCD, 0xD5, 0xC9, 0x04, 0x0A, 0x0D, 0x14, 0x17, 0x19, 0x23, 0x43, 0x44,
+    0xCF, 0xCD, 0xCD, 0xDC, 0x7B, 0x31, 0xCF, 0x40, 0xC1, 0xFE, 0xC9, 0x18, 0x00, 0x07, 0x9E, 0x01,
+    0xB0, 0x64, 0x22, 0x01, 0x49, 0x33, 0x1C, 0x42, 0x23, 0x25, 0x78, 0x31, 0xCC, 0x19, 0x41, 0x1C,
+    0xBA, 0xE9, 0xC3, 0x1E, 0x41, 0x43, 0x00, 0x0B, 0x00, 0x04, 0xBD, 0x14, 0x43, 0x07, 0x19, 0x22,
+    0x00, 0x0A, 0xD0, 0x3C, 0xD0, 0x3C, 0xC1, 0x1C, 0xC8, 0x25, 0x41, 0x1C, 0xCF, 0x8F, 0x41, 0x1B,
+    0xCF, 0xFF, 0xC6, 0x15, 0x19, 0x22, 0x27, 0x40, 0x41, 0xD0, 0x00, 0xD0, 0x52, 0x00, 0x0C, 0xD0,
+    0x52, 0x00, 0x08, 0x00, 0x04, 0x22, 0x2D, 0x32, 0x29, 0x13, 0x41, 0x20, 0xD0, 0x04, 0x21, 0x2A,
+    0x04, 0x21, 0x42, 0x03, 0x21, 0x27, 0x03, 0x42, 0x33, 0x34, 0xD0, 0x77, 0xCC, 0x5F, 0x41, 0x19,
+    0xCA, 0xCC, 0x21, 0x48, 0x04, 0x21, 0x35, 0x03, 0x21, 0x17, 0x03, 0x42, 0x39, 0x48, 0x00, 0x03,
+    0xD0, 0x25, 0xC1, 0x32, 0xD0, 0x88, 0x42, 0x15, 0x2B, 0xCF, 0x8D, 0xA6, 0xE0, 0x21, 0x14, 0x07,
+    0x21, 0x47, 0x03, 0x42, 0x0A, 0x17, 0x00, 0x03, 0xD0, 0x1E, 0x43, 0x14, 0x16, 0x1D, 0xD0, 0xA0,
+    0xCC, 0x92, 0xD0, 0xA0, 0xCD, 0x14, 0x15, 0x16, 0x1B, 0x1C, 0x22, 0x25, 0x2B, 0x2D, 0x2E, 0x40,
+    0x41, 0x43, 0x00, 0x3D, 0xD0, 0x4E, 0x9D, 0x76, 0x00, 0x29, 0xCA, 0x95, 0x00, 0x22, 0xCE, 0x8A,
+    0xC5, 0x40, 0xB8, 0x00, 0xC6, 0x06, 0x00, 0x11, 0x00, 0x0A, 0xCC, 0x9C, 0x43, 0x2D, 0x32, 0x33,
+    0x00, 0x68, 0x00, 0x28, 0x94, 0xB5, 0x5D, 0x01, 0x07, 0x08, 0x0A, 0x13, 0x14, 0x17, 0x19, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x2A, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x47, 0x48, 0x49, 0x03, 0xF9, 0x03, 0xF0, 0x03, 0xD4, 0xCE, 0x69, 0x03, 0xBC, 0x03, 0xAC,
+    0xCE, 0xD7, 0x03, 0xA2, 0x03, 0x82, 0xCF, 0xDA, 0x03, 0x5B, 0x02, 0xCF, 0x02, 0x93, 0x02, 0x5B,
+    0x02, 0x52, 0x02, 0x3C, 0x01, 0xE8, 0x01, 0xA6, 0xD0, 0xE6, 0x01, 0x4F, 0x01, 0x3B, 0x01, 0x1B,
+    0x5F, 0xFB, 0x01, 0x03, 0x00, 0xC4, 0x9C, 0x8B, 0xCC, 0xD8, 0x00, 0x81, 0x00, 0x0A, 0xC1, 0x19,
+    0x4A, 0xA9, 0x21, 0x07, 0x04, 0x21, 0x2D, 0x03, 0xC3, 0x0B, 0x17, 0x40, 0x85, 0xFA, 0x00, 0x03,
+    0x98, 0x8C, 0x41, 0x28, 0xBE, 0x34, 0xA1, 0x40, 0x04, 0x42, 0x07, 0x19, 0x00, 0x03, 0xD1, 0x59,
+    0x21, 0x48, 0x07, 0x21, 0x31, 0x03, 0x41, 0x22, 0x24, 0xD3, 0x41, 0x1D, 0xD0, 0xD9, 0xC4, 0x1A,
+    0x22, 0x41, 0x43, 0xD0, 0x65, 0xB5, 0x60, 0xBE, 0x84, 0x00, 0x04, 0x42, 0x2D, 0x39, 0xD0, 0xC0,
+    0xD1, 0x68, 0xC3, 0x23, 0x2B, 0x43, 0x00, 0x07, 0xD0, 0x79, 0xCF, 0x51, 0xC2, 0x1D, 0x43, 0xD1,
+    0x26, 0x8F, 0xA3, 0x21, 0x07, 0x07, 0x45, 0x01, 0x07, 0x14, 0x19, 0x48, 0x00, 0x28, 0x00, 0x14,
+    0xD1, 0x96, 0xD1, 0x96, 0x00, 0x03, 0xC6, 0x01, 0x15, 0x1C, 0x1D, 0x2A, 0x44, 0x80, 0x43, 0xD0,
+    0x9D, 0xD0, 0xE0, 0xCF, 0x83, 0x86, 0x58, 0x9B, 0x97, 0x41, 0x30, 0x71, 0x55, 0x41, 0x1D, 0xD1,
+    0x6E, 0xC9, 0x01, 0x07, 0x0A, 0x14, 0x19, 0x22, 0x25, 0x41, 0x44, 0x00, 0x1B, 0xD1, 0xC1, 0xD0,
+    0xFB, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0x00, 0x08, 0x00, 0x04, 0xA4, 0x33, 0xC1, 0x32, 0x4B,
+    0x68, 0x42, 0x32, 0x34, 0xAD, 0xE2, 0xCD, 0xC9, 0x41, 0x21, 0xCA, 0x41, 0x42, 0x17, 0x22, 0xCD,
+    0x2A, 0x43, 0xA9, 0xC9, 0x01, 0x08, 0x14, 0x1B, 0x1E, 0x21, 0x2B, 0x40, 0x48, 0x00, 0x16, 0xD1,
+    0xA7, 0x00, 0x12, 0xD1, 0xEF, 0xCF, 0xC9, 0xCF, 0xA7, 0x00, 0x0B, 0x00, 0x07, 0xD1, 0xF3, 0xC4,
+    0x07, 0x1D, 0x2A, 0x2B, 0xD1, 0xB4, 0xD1, 0xD6, 0xCC, 0x5D, 0xD1, 0xBD, 0x21, 0x01, 0x0D, 0xC1,
+    0x1A, 0xB7, 0xB1, 0x21, 0x07, 0x04, 0xC1, 0x43, 0xD1, 0xED, 0xC5, 0x1D, 0x1F, 0x21, 0x22, 0x40,
+    0xBE, 0x5C, 0xD1, 0x28, 0xCF, 0xDE, 0x00, 0x04, 0x5D, 0x9C, 0x42, 0x2D, 0x32, 0xD2, 0x3A, 0x00,
+    0x10, 0xC2, 0x04, 0x1C, 0xCB, 0x53, 0xD1, 0x7B, 0xA1, 0x22, 0x07, 0x21, 0x32, 0x03, 0x4D, 0x19,
+    0x23, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x48, 0x49, 0x01, 0x06, 0x00, 0xEB,
+    0x00, 0xE8, 0x00, 0xB8, 0x00, 0x8D, 0xCD, 0xFC, 0x00, 0x5B, 0x00, 0x32, 0xC5, 0x82, 0xCD, 0xFC,
+    0x00, 0x2B, 0x00, 0x14, 0x00, 0x03, 0xC7, 0x08, 0x19, 0x1E, 0x25, 0x2B, 0x32, 0x38, 0xD2, 0x30,
+    0x67, 0xCA, 0xAA, 0xE8, 0xD0, 0x67, 0xB8, 0x08, 0xD2, 0x76, 0x85, 0xA8, 0x42, 0x27, 0x35, 0xD1,
+    0xD1, 0xD2, 0x8C, 0xC1, 0x27, 0x41, 0x97, 0xC4, 0x01, 0x18, 0x32, 0x4C, 0xD2, 0x51, 0xD2, 0x51,
+    0x00, 0x04, 0xD2, 0x97, 0x41, 0x2A, 0xAE, 0x3E, 0x21, 0x31, 0x04, 0x41, 0x07, 0x32, 0x98, 0x22,
+    0x27, 0x31, 0x07, 0x04, 0x41, 0x19, 0xB8, 0x46, 0x21, 0x40, 0x04, 0x21, 0x33, 0x03, 0x42, 0x14,
+    0x19, 0x00, 0x03, 0x4C, 0x29, 0x21, 0x23, 0x07, 0x21, 0x0A, 0x03, 0x41, 0x2A, 0xC0, 0xAA, 0x21,
+    0x38, 0x04, 0x21, 0x19, 0x03, 0xA1, 0x2D, 0x03, 0x21, 0x0A, 0x03, 0x43, 0x02, 0x1E, 0x27, 0xCF,
+    0xCD, 0x00, 0x13, 0x00, 0x03, 0x22, 0x2A, 0x40, 0x36, 0x0A, 0x21, 0x4C, 0x05, 0xC4, 0x1E, 0x28,
+    0x29, 0x44, 0x00, 0x61, 0x00, 0x56, 0x00, 0x03, 0xC8, 0xA2, 0xC2, 0x19, 0x23, 0x35, 0x8B, 0xCF,
+    0xE2, 0xC3, 0x32, 0x35, 0x4C, 0x00, 0x07, 0xC0, 0x99, 0xD3, 0x01, 0x43, 0x19, 0x21, 0x35, 0x00,
+    0x0A, 0xD2, 0xB0, 0xD3, 0x0B, 0x41, 0x28, 0xD3, 0x14, 0x43, 0x17, 0x1F, 0x21, 0x83, 0xDA, 0xD3,
+    0x19, 0xD2, 0x9A, 0xC6, 0x13, 0x19, 0x22, 0x25, 0x42, 0x44, 0xD3, 0x23, 0xB4, 0x53, 0xD2, 0xBD,
+    0xD2, 0xCE, 0x00, 0x0E, 0x00, 0x0A, 0x21, 0x32, 0x13, 0x42, 0x01, 0x4C, 0xD2, 0x01, 0xD3, 0x39,
+    0xA1, 0x22, 0x07, 0x21, 0x0A, 0x03, 0x21, 0x34, 0x03, 0x41, 0x49, 0xCB, 0x67, 0xC2, 0x01, 0x14,
+    0x9D, 0xBB, 0x00, 0x04, 0x41, 0x35, 0x80, 0x7E, 0x42, 0x01, 0x1E, 0xD3, 0x58, 0xD3, 0x58, 0x41,
+    0x23, 0x1A, 0x8B, 0x21, 0x32, 0x04, 0x41, 0x1B, 0xB6, 0x8A, 0xC5, 0x17, 0x28, 0x2A, 0x40, 0x44,
+    0xC7, 0x97, 0x00, 0x12, 0x00, 0x07, 0x00, 0x04, 0xAA, 0x6D, 0xC1, 0x14, 0xD3, 0x34, 0xC2, 0x14,
+    0x19, 0xD1, 0x6F, 0x8E, 0x96, 0x44, 0x01, 0x07, 0x19, 0x2A, 0x9F, 0xE0, 0xD3, 0x85, 0x00, 0x0B,
+    0x00, 0x07, 0xC2, 0x23, 0x2D, 0xD3, 0x92, 0xD3, 0x59, 0x42, 0x31, 0x35, 0xD2, 0xDE, 0xD3, 0x99,
+    0x41, 0x32, 0x55, 0x8C, 0x41, 0x27, 0xD3, 0x1F, 0xC9, 0x14, 0x18, 0x19, 0x22, 0x23, 0x25, 0x27,
+    0x28, 0x40, 0x00, 0x16, 0x23, 0xAC, 0x68, 0xD3, 0xD3, 0xA8, 0xCA, 0x5A, 0x00, 0x0F, 0x00, 0x08,
+    0xB8, 0xB8, 0x00, 0x04, 0x42, 0x14, 0x15, 0xD3, 0x5E, 0xD3, 0xC4, 0x41, 0x04, 0xB4, 0xE3, 0xCC,
+    0x08, 0x0A, 0x18, 0x21, 0x27, 0x2A, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x42, 0x78, 0x7F, 0x00, 0x7B,
+    0xBE, 0xF8, 0x00, 0x65, 0x92, 0x1B, 0xD3, 0xAD, 0xC8, 0x3D, 0x00, 0x4A, 0x00, 0x27, 0x00, 0x0B,
+    0xD0, 0x60, 0x00, 0x04, 0x42, 0x23, 0x32, 0xD0, 0x89, 0xD3, 0xBB, 0x41, 0x2B, 0x82, 0x4F, 0xC4,
+    0x1B, 0x1E, 0x39, 0x40, 0xD0, 0x94, 0x00, 0x0B, 0xD3, 0xFF, 0x00, 0x04, 0x41, 0x22, 0xCE, 0xE1,
+    0x21, 0x40, 0x04, 0xA1, 0x1E, 0x03, 0x41, 0x1E, 0x47, 0xA3, 0x21, 0x34, 0x04, 0x21, 0x21, 0x03,
+    0x21, 0x39, 0x03, 0xC5, 0x20, 0x32, 0x34, 0x35, 0x4C, 0x00, 0x03, 0xD4, 0x23, 0x3D, 0xED, 0xD4,
+    0x23, 0xD4, 0x23, 0x21, 0x06, 0x10, 0x41, 0x0A, 0xA4, 0x5D, 0xC1, 0x1D, 0xD4, 0x01, 0x46, 0x01,
+    0x04, 0x0A, 0x0D, 0x15, 0x1A, 0x00, 0x2B, 0x00, 0x0B, 0xC9, 0xD4, 0x00, 0x08, 0xD4, 0x3E, 0x00,
+    0x04, 0x42, 0x17, 0x25, 0xD4, 0x51, 0xD4, 0x51, 0x21, 0x32, 0x07, 0x49, 0x01, 0x06, 0x07, 0x18,
+    0x19, 0x1A, 0x21, 0x22, 0x25, 0xC2, 0x3A, 0xD3, 0x68, 0xC1, 0x95, 0xBF, 0x95, 0xD4, 0x5B, 0x00,
+    0x03, 0xD4, 0x5B, 0xCB, 0x0D, 0xD4, 0x5B, 0x41, 0x32, 0x43, 0xD5, 0x41, 0x35, 0xD2, 0xC9, 0xA1,
+    0x04, 0x04, 0x41, 0x22, 0x3E, 0x69, 0x21, 0x19, 0x04, 0x21, 0x2A, 0x03, 0x41, 0x18, 0xD4, 0x26,
+    0x21, 0x22, 0x04, 0xC7, 0x1A, 0x22, 0x23, 0x30, 0x40, 0x41, 0x42, 0x59, 0xD4, 0x00, 0x1C, 0xD4,
+    0x93, 0x00, 0x14, 0xD3, 0x17, 0x00, 0x0A, 0x00, 0x03, 0xC2, 0x07, 0x2B, 0xD4, 0xA9, 0x00, 0x16,
+    0x41, 0x48, 0x9F, 0x88, 0x47, 0x0A, 0x19, 0x28, 0x31, 0x32, 0x38, 0x39, 0x66, 0xDB, 0xD0, 0x8F,
+    0xD4, 0xB4, 0x00, 0x76, 0x00, 0x59, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x1E, 0x77, 0x74, 0x42, 0x31,
+    0x34, 0x73, 0xF9, 0x00, 0x04, 0xC2, 0x04, 0x41, 0xD4, 0x86, 0x99, 0x99, 0x41, 0x23, 0x27, 0xD2,
+    0x21, 0x32, 0x04, 0xC2, 0x01, 0x4C, 0x00, 0x03, 0xD4, 0xE3, 0xC1, 0x19, 0x90, 0x02, 0xC3, 0x19,
+    0x32, 0x35, 0xD4, 0x88, 0x00, 0x04, 0xD4, 0xEE, 0x46, 0x04, 0x13, 0x14, 0x25, 0x29, 0x40, 0x00,
+    0x15, 0x00, 0x0A, 0xA0, 0xA1, 0xD2, 0xCE, 0xC3, 0x49, 0xBD, 0xA1, 0xC1, 0x1E, 0xBC, 0x29, 0x42,
+    0x14, 0x19, 0x00, 0x04, 0xD5, 0x0F, 0x42, 0x34, 0x35, 0xB4, 0x94, 0xD5, 0x16, 0x21, 0x23, 0x07,
+    0x43, 0x23, 0x31, 0x32, 0x9F, 0xC2, 0xD4, 0xD7, 0x00, 0x03, 0x43, 0x16, 0x17, 0x38, 0xD5, 0x2A,
+    0xD5, 0x2A, 0xD3, 0x78, 0x41, 0x34, 0xB9, 0xCC, 0xC6, 0x04, 0x08, 0x1A, 0x1E, 0x28, 0x32, 0x00,
+    0xBD, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x04, 0xD4, 0xF2, 0xD5, 0x38, 0x21, 0x21, 0x13, 0x41, 0x08,
+    0x7C, 0x58, 0x41, 0x42, 0x34, 0xD5, 0x44, 0x23, 0x25, 0x31, 0x33, 0xD5, 0x56, 0xD5, 0x07, 0x00,
+    0x08, 0x00, 0x04, 0x42, 0x23, 0x38, 0xD5, 0x4A, 0xC4, 0xAF, 0x41, 0x40, 0x80, 0x51, 0x21, 0x21,
+    0x04, 0x42, 0x2D, 0x31, 0x00, 0x03, 0xB0, 0x07, 0x42, 0x1E, 0x4C, 0x7B, 0x6A, 0xD5, 0x78, 0x21,
+    0x21, 0x07, 0x41, 0x19, 0xD2, 0x9E, 0x43, 0x07, 0x19, 0x32, 0x3C, 0x2D, 0x00, 0x07, 0x00, 0x04,
+    0x42, 0x10, 0x12, 0xD2, 0x25, 0xD2, 0x25, 0x21, 0x32, 0x07, 0x41, 0x19, 0xA4, 0x5B, 0x21, 0x48,
+    0x04, 0x43, 0x2D, 0x31, 0x35, 0xD5, 0x97, 0xD4, 0xE6, 0x00, 0x03, 0x41, 0x18, 0xC3, 0xE1, 0x21,
+    0x38, 0x04, 0x21, 0x22, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x35, 0x03, 0x21, 0x23, 0x03, 0xC2, 0x28,
+    0x40, 0x00, 0x03, 0x67, 0x4B, 0x21, 0x23, 0x07, 0x45, 0x07, 0x14, 0x21, 0x22, 0x2A, 0xD5, 0xC8,
+    0xD5, 0xC8, 0xD5, 0xC8, 0xD5, 0xC8, 0xD2, 0xE0, 0x44, 0x04, 0x21, 0x2D, 0x32, 0x00, 0x13, 0xD5,
+    0xD8, 0xD3, 0xC9, 0x00, 0x10, 0x44, 0x0F, 0x17, 0x23, 0x32, 0xD5, 0xE5, 0xD5, 0xE5, 0xD3, 0xD6,
+    0xD3, 0xE7, 0x41, 0x30, 0x44, 0x98, 0x41, 0x40, 0x32, 0x73, 0x21, 0x19, 0x04, 0x21, 0x49, 0x03,
+    0x41, 0x25, 0xBB, 0x2A, 0x44, 0x23, 0x31, 0x34, 0x35, 0x00, 0x12, 0x00, 0x07, 0xD1, 0xB2, 0x00,
+    0x04, 0x42, 0x32, 0x38, 0xD6, 0x11, 0xD6, 0x11, 0x21, 0x2B, 0x07, 0x42, 0x1E, 0x42, 0x44, 0xE8,
+    0x45, 0xFA, 0xC2, 0x1A, 0x40, 0xB8, 0x33, 0xA2, 0x01, 0x21, 0x18, 0x07, 0x21, 0x17, 0x03, 0x44,
+    0x23, 0x32, 0x34, 0x38, 0xD6, 0x2F, 0x00, 0x17, 0x00, 0x14, 0x00, 0x03, 0x21, 0x0E, 0xD2, 0x21,
+    0x38, 0x03, 0x21, 0x01, 0x03, 0x41, 0x23, 0xD4, 0xAE, 0x43, 0x07, 0x32, 0x38, 0x00, 0x07, 0x00,
+    0x04, 0x30, 0x6F, 0x41, 0x23, 0xB0, 0xE9, 0x21, 0x40, 0x04, 0x21, 0x38, 0x03, 0xC2, 0x17, 0x2A,
+    0xCF, 0x6F, 0x00, 0x03, 0x42, 0x32, 0x37, 0x00, 0x07, 0xD6, 0x2B, 0x41, 0x20, 0xC4, 0x4A, 0x21,
+    0x32, 0x04, 0x21, 0x22, 0x03, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x42, 0x31, 0x34, 0xD6, 0x71,
+    0x00, 0x03, 0x43, 0x14, 0x17, 0x27, 0x03, 0xC7, 0xD6, 0x27, 0x00, 0x07, 0x42, 0x0A, 0x21, 0x00,
+    0x0A, 0xD6, 0x8C, 0x41, 0x2A, 0xD3, 0x63, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03,
+    0x21, 0x07, 0x03, 0x21, 0x27, 0x03, 0x44, 0x2D, 0x32, 0x39, 0x48, 0xD6, 0x9C, 0x00, 0x1A, 0xD6,
+    0x93, 0x00, 0x03, 0x43, 0x1A, 0x37, 0x48, 0xD6, 0xB3, 0xD6, 0x5E, 0xA3, 0xD5, 0x41, 0x21, 0x2A,
+    0x23, 0x21, 0x40, 0x04, 0x21, 0x38, 0x03, 0x45, 0x19, 0x24, 0x31, 0x32, 0x34, 0xD3, 0xE3, 0x46,
+    0x9C, 0x30, 0xE6, 0x7A, 0x90, 0xD6, 0x78, 0x41, 0x04, 0xD5, 0x9F, 0x42, 0x07, 0x10, 0x00, 0x04,
+    0xC2, 0x15, 0x41, 0x17, 0x88, 0x37, 0x45, 0x07, 0x31, 0x32, 0x34, 0x39, 0xC4, 0x20, 0x00, 0x0B,
+    0x00, 0x04, 0xB1, 0x7C, 0x2A, 0x4C, 0x41, 0x2A, 0xBC, 0x88, 0x21, 0x01, 0x04, 0x21, 0x32, 0x03,
+    0x41, 0x2B, 0xD5, 0xF7, 0x21, 0x48, 0x04, 0x21, 0x39, 0x03, 0x21, 0x22, 0x03, 0xA2, 0x15, 0x2D,
+    0x10, 0x03, 0x21, 0x32, 0x05, 0x21, 0x49, 0x03, 0x41, 0x1E, 0xD6, 0xDF, 0x21, 0x38, 0x04, 0x21,
+    0x15, 0x03, 0x47, 0x08, 0x0A, 0x19, 0x1E, 0x21, 0x27, 0x2D, 0x00, 0x0D, 0x00, 0x03, 0xD6, 0x6D,
+    0xCF, 0x27, 0xB6, 0x20, 0xD5, 0x24, 0xD7, 0x21, 0x42, 0x21, 0x2A, 0x84, 0xCA, 0x79, 0x02, 0x21,
+    0x48, 0x07, 0x45, 0x17, 0x1C, 0x21, 0x27, 0x2A, 0xD2, 0xF0, 0xD7, 0x38, 0x00, 0x03, 0xD6, 0x3D,
+    0xD7, 0x38, 0x41, 0x19, 0xD7, 0x48, 0x43, 0x02, 0x2A, 0x2D, 0x00, 0x04, 0xD4, 0x48, 0xB9, 0x17,
+    0xD6, 0x01, 0x04, 0x08, 0x09, 0x0A, 0x11, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x23,
+    0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x02, 0x0A, 0x01, 0xFD, 0x01, 0xEF, 0xD5, 0x36, 0x01,
+    0xDA, 0x01, 0xC9, 0x01, 0xBF, 0x01, 0x88, 0x01, 0x7B, 0x01, 0x5C, 0x01, 0x31, 0x9E, 0x86, 0x01,
+    0x17, 0x00, 0xFC, 0x00, 0xBA, 0x00, 0xAD, 0x00, 0x9C, 0x00, 0x99, 0x00, 0x7A, 0x00, 0x3E, 0x00,
+    0x1E, 0x00, 0x0A, 0x41, 0x23, 0x26, 0x3B, 0x21, 0x1E, 0x04, 0x45, 0x01, 0x07, 0x14, 0x1A, 0x48,
+    0x00, 0x03, 0x4B, 0x4F, 0xD7, 0xAA, 0xD7, 0xAA, 0xD1, 0x20, 0x41, 0x15, 0xB0, 0x2C, 0x21, 0x30,
+    0x04, 0x21, 0x23, 0x03, 0xC2, 0x01, 0x19, 0x00, 0x03, 0xD7, 0xC3, 0x42, 0x13, 0x35, 0xD7, 0xAF,
+    0xD7, 0xCB, 0x21, 0x21, 0x07, 0x47, 0x01, 0x07, 0x14, 0x19, 0x22, 0x27, 0x2B, 0xD7, 0xD5, 0xD7,
+    0xD5, 0xD7, 0xD5, 0x00, 0x11, 0xD7, 0xD5, 0xD7, 0xD5, 0x00, 0x03, 0x41, 0x25, 0x92, 0xE5, 0xA1,
+    0x34, 0x04, 0x44, 0x01, 0x19, 0x1A, 0x49, 0xD7, 0xF2, 0x9E, 0x3F, 0x00, 0x03, 0x35, 0xDC, 0x42,
+    0x47, 0x49, 0x25, 0x1E, 0xB7, 0xC5, 0x42, 0x21, 0x23, 0xD8, 0x06, 0xD7, 0xEA, 0x21, 0x22, 0x07,
+    0x21, 0x35, 0x03, 0x43, 0x0B, 0x1E, 0x21, 0x00, 0x14, 0xD7, 0xC4, 0x00, 0x03, 0x45, 0x1F, 0x2B,
+    0x40, 0x41, 0x42, 0x73, 0x87, 0x4E, 0x31, 0x00, 0x0A, 0xCD, 0xD2, 0x69, 0xEB, 0x43, 0x07, 0x19,
+    0x1A, 0xD8, 0x2D, 0xD8, 0x2D, 0xD8, 0x2D, 0xC3, 0x01, 0x19, 0x48, 0xD8, 0x37, 0xD8, 0x37, 0xD8,
+    0x2D, 0xC2, 0x14, 0x2A, 0xD8, 0x41, 0x9E, 0xF0, 0x41, 0x25, 0xC0, 0x35, 0x21, 0x1A, 0x04, 0x21,
+    0x40, 0x03, 0x41, 0x21, 0xB9, 0x93, 0x22, 0x1A, 0x21, 0x07, 0x04, 0x21, 0x2D, 0x05, 0x41, 0x23,
+    0xD8, 0x06, 0x21, 0x1E, 0x04, 0x43, 0x07, 0x21, 0x22, 0xD8, 0x65, 0x00, 0x03, 0xD8, 0x65, 0x42,
+    0x23, 0x49, 0x87, 0xAC, 0xD8, 0x1A, 0x21, 0x1E, 0x07, 0xA1, 0x40, 0x03, 0x43, 0x2D, 0x32, 0x33,
+    0x00, 0x17, 0xD2, 0xD1, 0x00, 0x03, 0x42, 0x23, 0x31, 0xC7, 0xD2, 0xD8, 0x85, 0x21, 0x23, 0x07,
+    0xC3, 0x1E, 0x21, 0x43, 0x00, 0x03, 0xBB, 0x8F, 0xD6, 0x5F, 0x43, 0x07, 0x21, 0x22, 0xD8, 0x9A,
+    0x00, 0x0A, 0xD8, 0x9A, 0x43, 0x2D, 0x32, 0x33, 0x00, 0x0A, 0x78, 0x67, 0xD8, 0xA4, 0xD7, 0x01,
+    0x15, 0x1E, 0x21, 0x23, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x40, 0x47, 0x48, 0x49, 0xD8, 0xAE, 0xD8, 0xAE, 0x03, 0xE0, 0x03, 0xD9, 0x03, 0xB6,
+    0x03, 0x9F, 0x92, 0x59, 0x03, 0x63, 0xCC, 0xC5, 0x01, 0x4E, 0x01, 0x04, 0x00, 0xD9, 0xD8, 0xAE,
+    0x00, 0xBC, 0x00, 0x91, 0x00, 0x81, 0xD8, 0x5F, 0x00, 0x77, 0x00, 0x6D, 0x8E, 0x4D, 0x00, 0x53,
+    0x00, 0x32, 0x00, 0x0A, 0x41, 0x27, 0xD7, 0x5D, 0x21, 0x17, 0x04, 0xC7, 0x0A, 0x17, 0x23, 0x28,
+    0x32, 0x40, 0x4C, 0xB4, 0x1B, 0xD8, 0x9D, 0xB1, 0x16, 0xC6, 0xDD, 0xD8, 0xFB, 0x00, 0x03, 0xD8,
+    0xFB, 0x21, 0x29, 0x16, 0xC2, 0x32, 0x34, 0x25, 0x76, 0xD9, 0x14, 0x42, 0x23, 0x32, 0xBE, 0x2B,
+    0xC6, 0xFA, 0xC2, 0x01, 0x19, 0x00, 0x07, 0xBD, 0x9F, 0xA1, 0x34, 0x07, 0x42, 0x34, 0x4C, 0xD9,
+    0x10, 0xD9, 0x2C, 0x21, 0x18, 0x07, 0x41, 0x29, 0xC8, 0x82, 0x21, 0x39, 0x04, 0xC1, 0x32, 0xD8,
+    0xD1, 0x21, 0x01, 0x04, 0x21, 0x34, 0x03, 0x21, 0x08, 0x03, 0xC1, 0x32, 0xBB, 0x05, 0x21, 0x20,
+    0x04, 0xC1, 0x1A, 0xA3, 0xF7, 0x21, 0x2A, 0x04, 0x21, 0x31, 0x03, 0x49, 0x01, 0x12, 0x15, 0x17,
+    0x19, 0x20, 0x28, 0x29, 0x2B, 0x00, 0x4A, 0x00, 0x47, 0x00, 0x32, 0x00, 0x28, 0x9A, 0x98, 0x00,
+    0x21, 0x00, 0x14, 0x00, 0x0D, 0x00, 0x03, 0x41, 0x32, 0x44, 0x8E, 0xC1, 0x04, 0xAA, 0x7E, 0xC2,
+    0x23, 0x34, 0xD9, 0x7F, 0xD9, 0x7F, 0x21, 0x15, 0x07, 0xC3, 0x01, 0x07, 0x31, 0xD9, 0x89, 0xD9,
+    0x89, 0x00, 0x03, 0x41, 0x1E, 0x32, 0xEE, 0x21, 0x41, 0x04, 0xC5, 0x07, 0x14, 0x19, 0x21, 0x22,
+    0xD9, 0x9A, 0xD9, 0x9A, 0xD9, 0x9A, 0x00, 0x03, 0xD9, 0x9A, 0xC1, 0x1E, 0xD1, 0xAF, 0xC1, 0x08,
+    0x96, 0x62, 0x21, 0x19, 0x04, 0x21, 0x32, 0x03, 0xC2, 0x07, 0x08, 0x00, 0x03, 0xB6, 0xE0, 0xC1,
+    0x1E, 0xB0, 0xB5, 0xC1, 0x44, 0x7F, 0xD1, 0x42, 0x32, 0x36, 0x00, 0x04, 0xD9, 0xBD, 0x21, 0x25,
+    0x07, 0xA1, 0x1E, 0x03, 0x47, 0x07, 0x14, 0x19, 0x1A, 0x2A, 0x48, 0x49, 0x00, 0x1C, 0x00, 0x15,
+    0xD9, 0xD4, 0x00, 0x03, 0xD9, 0xD4, 0x90, 0xE1, 0xD9, 0xCA, 0x42, 0x32, 0x36, 0x44, 0x9E, 0xD9,
+    0xE9, 0x41, 0x39, 0x76, 0x88, 0xA1, 0x27, 0x04, 0x42, 0x15, 0x21, 0xD7, 0x10, 0xD9, 0x92, 0x4B,
+    0x01, 0x07, 0x0B, 0x0D, 0x14, 0x18, 0x19, 0x21, 0x22, 0x2A, 0x2B, 0xD9, 0xB9, 0xD9, 0xFF, 0xD7,
+    0x6F, 0xD9, 0xFF, 0xD9, 0xFF, 0xD8, 0xC1, 0x00, 0x15, 0xD9, 0xFF, 0x00, 0x0A, 0x00, 0x07, 0xD9,
+    0xFE, 0xC1, 0x20, 0xD7, 0xFE, 0xC1, 0x28, 0xD6, 0xF2, 0xC3, 0x01, 0x1E, 0x49, 0x00, 0x04, 0x33,
+    0xA3, 0xD9, 0x24, 0x41, 0x32, 0x9B, 0xCC, 0x21, 0x19, 0x04, 0x21, 0x2D, 0x03, 0xC4, 0x17, 0x21,
+    0x2A, 0x42, 0xDA, 0x3D, 0x8F, 0xEE, 0xDA, 0x3D, 0x00, 0x03, 0x41, 0x25, 0x90, 0xD1, 0xA1, 0x1E,
+    0x04, 0x43, 0x01, 0x07, 0x22, 0xDA, 0x51, 0xDA, 0x51, 0xDA, 0x51, 0xC3, 0x01, 0x48, 0x49, 0x00,
+    0x0D, 0x00, 0x0A, 0xCF, 0x67, 0x42, 0x15, 0x17, 0xDA, 0x65, 0xAF, 0x2C, 0xC4, 0x04, 0x15, 0x41,
+    0x42, 0xBE, 0x5E, 0xD3, 0x33, 0xDA, 0x6B, 0x00, 0x07, 0x43, 0x17, 0x21, 0x23, 0xD7, 0x46, 0xD9,
+    0x69, 0xBA, 0x86, 0xC2, 0x19, 0x21, 0xDA, 0x83, 0xDA, 0x83, 0x42, 0x2D, 0x32, 0xD9, 0xCF, 0x00,
+    0x07, 0x42, 0x2D, 0x33, 0x8A, 0x29, 0xDA, 0x91, 0xD4, 0x01, 0x04, 0x1A, 0x1E, 0x23, 0x27, 0x28,
+    0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x38, 0x39, 0x40, 0x42, 0x48, 0x49, 0x01, 0x21, 0x54,
+    0x48, 0x01, 0x1D, 0x85, 0x57, 0xCF, 0x24, 0x01, 0x0F, 0x8E, 0x8D, 0x00, 0xFE, 0x00, 0xEE, 0x00,
+    0xC4, 0x00, 0x99, 0x00, 0x77, 0x00, 0x6F, 0x00, 0x5B, 0x00, 0x3D, 0x00, 0x2C, 0x00, 0x1F, 0xC0,
+    0xD5, 0x00, 0x0E, 0x00, 0x07, 0x42, 0x22, 0x23, 0xDA, 0xD4, 0xA7, 0x74, 0x41, 0x2A, 0xDA, 0x8D,
+    0xC3, 0x17, 0x2B, 0x41, 0xD9, 0xD4, 0x00, 0x0B, 0x00, 0x04, 0x44, 0x01, 0x07, 0x19, 0x22, 0xDA,
+    0xEA, 0x00, 0x0A, 0xDA, 0xEA, 0x61, 0xC2, 0xC2, 0x18, 0x21, 0xDA, 0x91, 0xA5, 0x9D, 0x42, 0x01,
+    0x38, 0xDA, 0xFE, 0x00, 0x07, 0x41, 0x18, 0xC0, 0x97, 0x21, 0x22, 0x04, 0xC2, 0x2F, 0x42, 0xDB,
+    0x0C, 0x00, 0x03, 0x41, 0x04, 0xDA, 0x4D, 0x21, 0x32, 0x04, 0xC3, 0x04, 0x20, 0x25, 0x64, 0xB3,
+    0x00, 0x03, 0xDB, 0x1A, 0xC2, 0x1E, 0x2A, 0xA5, 0x61, 0x49, 0x26, 0x23, 0x25, 0x38, 0x39, 0x1F,
+    0x11, 0x07, 0xC3, 0x1E, 0x31, 0x32, 0xD6, 0x74, 0xDA, 0xF9, 0xDA, 0xEC, 0x41, 0x19, 0xAF, 0x9F,
+    0x21, 0x31, 0x04, 0x42, 0x1A, 0x21, 0x6F, 0xB0, 0x00, 0x03, 0x21, 0x15, 0x07, 0x21, 0x01, 0x03,
+    0x42, 0x27, 0x40, 0xDB, 0x0A, 0x00, 0x03, 0x42, 0x35, 0x39, 0xDB, 0x57, 0xDB, 0x57, 0x41, 0x25,
+    0x72, 0x51, 0xC2, 0x40, 0x41, 0x00, 0x04, 0xA1, 0x46, 0x42, 0x15, 0x17, 0x00, 0x07, 0x99, 0x5E,
+    0x21, 0x4C, 0x07, 0x42, 0x23, 0x25, 0xDB, 0x69, 0xC6, 0x2E, 0x41, 0x25, 0xB0, 0x41, 0x42, 0x08,
+    0x0A, 0xDB, 0x7E, 0xDA, 0xFF, 0xCE, 0x01, 0x04, 0x07, 0x14, 0x15, 0x17, 0x19, 0x1F, 0x22, 0x23,
+    0x41, 0x42, 0x43, 0x44, 0x00, 0x53, 0x00, 0x35, 0xDB, 0x85, 0x00, 0x2E, 0xDA, 0x7C, 0x77, 0x5C,
+    0xDB, 0x85, 0xDB, 0x33, 0xBB, 0x4F, 0x00, 0x15, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x07, 0xB2, 0x56,
+    0x41, 0x32, 0x40, 0x3A, 0x42, 0x32, 0x34, 0xDB, 0x7B, 0xDB, 0xAA, 0x42, 0x2D, 0x39, 0xD9, 0xAC,
+    0xD5, 0x31, 0x41, 0x30, 0x6E, 0x7F, 0x21, 0x1E, 0x04, 0x21, 0x07, 0x03, 0x21, 0x38, 0x03, 0x41,
+    0x30, 0xCF, 0xFC, 0x21, 0x1E, 0x04, 0x21, 0x01, 0x03, 0x41, 0x27, 0xD9, 0xB6, 0x21, 0x30, 0x04,
+    0x21, 0x1E, 0x03, 0x21, 0x32, 0x03, 0x44, 0x07, 0x31, 0x32, 0x49, 0xDB, 0xE6, 0x00, 0x10, 0xDB,
+    0xE6, 0x00, 0x03, 0x41, 0x30, 0xD3, 0xD2, 0x21, 0x1E, 0x04, 0x21, 0x14, 0x03, 0x42, 0x07, 0x37,
+    0xDB, 0xFD, 0x00, 0x03, 0x41, 0x22, 0xD9, 0x4C, 0x41, 0x19, 0xDB, 0xB3, 0x21, 0x30, 0x04, 0x21,
+    0x1E, 0x03, 0x21, 0x32, 0x03, 0x43, 0x34, 0x35, 0x49, 0xDB, 0xDC, 0x00, 0x11, 0x00, 0x03, 0x41,
+    0x22, 0xC3, 0x6B, 0x21, 0x30, 0x04, 0xA1, 0x1E, 0x03, 0x21, 0x1A, 0x03, 0x42, 0x32, 0x34, 0xDC,
+    0x2C, 0x00, 0x03, 0x44, 0x19, 0x1E, 0x22, 0x25, 0x00, 0x1E, 0xD8, 0x51, 0x00, 0x07, 0xDB, 0x78,
+    0x42, 0x15, 0x25, 0x85, 0xC0, 0xDB, 0xC1, 0xCC, 0x07, 0x08, 0x19, 0x1E, 0x22, 0x23, 0x27, 0x2D,
+    0x40, 0x41, 0x42, 0x44, 0x00, 0x97, 0xDC, 0x3D, 0xDB, 0xF2, 0x00, 0x93, 0x00, 0x8C, 0x00, 0x7B,
+    0x00, 0x61, 0x00, 0x4A, 0x00, 0x14, 0x04, 0xF5, 0x00, 0x07, 0xDB, 0xE9, 0xC2, 0x32, 0x4C, 0xDC,
+    0x6C, 0xDC, 0x6C, 0x42, 0x23, 0x32, 0x00, 0x07, 0xDC, 0x73, 0x41, 0x1E, 0xDB, 0x75, 0xC4, 0x15,
+    0x1E, 0x23, 0x41, 0x00, 0x0B, 0xD8, 0x9C, 0xDC, 0x7E, 0x00, 0x04, 0x43, 0x27, 0x2D, 0x32, 0xDB,
+    0xD0, 0xDC, 0x52, 0x64, 0x7D, 0x41, 0x1E, 0xDB, 0xDA, 0x41, 0x04, 0xDC, 0x60, 0xC7, 0x01, 0x04,
+    0x07, 0x1C, 0x1E, 0x40, 0x42, 0x17, 0x1E, 0xDC, 0x37, 0xDC, 0x37, 0xAA, 0x03, 0x00, 0x12, 0x00,
+    0x08, 0x00, 0x04, 0xC2, 0x19, 0x23, 0xDB, 0xED, 0xCB, 0x04, 0x42, 0x01, 0x19, 0xDC, 0xBA, 0xDC,
+    0x9E, 0x21, 0x08, 0x07, 0x41, 0x23, 0x90, 0x4E, 0x21, 0x32, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x34,
+    0x03, 0x21, 0x23, 0x03, 0x42, 0x23, 0x32, 0xDC, 0xD4, 0xDC, 0x8E, 0xC4, 0x01, 0x17, 0x19, 0x27,
+    0x00, 0x07, 0x3E, 0x1F, 0x97, 0xF3, 0xAB, 0x3A, 0x42, 0x0A, 0x28, 0xDC, 0xE8, 0xDA, 0x54, 0x21,
+    0x27, 0x07, 0xC5, 0x1A, 0x30, 0x32, 0x40, 0x4C, 0x00, 0x21, 0xDC, 0xF2, 0x00, 0x17, 0x00, 0x03,
+    0xDC, 0xF2, 0x42, 0x01, 0x19, 0xDC, 0x3C, 0x00, 0x10, 0x42, 0x31, 0x32, 0xDD, 0x08, 0xDD, 0x09,
+    0xC5, 0x0A, 0x22, 0x25, 0x41, 0x42, 0x00, 0x07, 0xDC, 0x8B, 0xDB, 0x01, 0x00, 0x96, 0x0F, 0x08,
+    0xC2, 0x22, 0x2A, 0xDC, 0xBA, 0x45, 0x79, 0x44, 0x18, 0x22, 0x23, 0x25, 0x00, 0x07, 0xDC, 0xC1,
+    0xDD, 0x27, 0xA9, 0xE9, 0x43, 0x31, 0x32, 0x39, 0xDC, 0xFB, 0xDD, 0x34, 0xDD, 0x34, 0x42, 0x01,
+    0x04, 0xDC, 0x06, 0xDC, 0x06, 0xC2, 0x32, 0x33, 0x00, 0x07, 0xDD, 0x45, 0xC2, 0x01, 0x4C, 0xC2,
+    0x58, 0xDD, 0x4C, 0xC1, 0x17, 0xAF, 0x9E, 0xC8, 0x01, 0x17, 0x19, 0x1A, 0x21, 0x30, 0x38, 0x4C,
+    0xBC, 0xD1, 0xAF, 0xA2, 0x00, 0x12, 0xDC, 0x9F, 0xC0, 0x56, 0xDD, 0x57, 0x00, 0x0B, 0x00, 0x04,
+    0x45, 0x2D, 0x32, 0x33, 0x36, 0x37, 0xDD, 0x6F, 0xDC, 0xB5, 0xDD, 0x70, 0xDD, 0x6F, 0xDD, 0x1B,
+    0x41, 0x2B, 0xC0, 0xA0, 0x21, 0x01, 0x04, 0x21, 0x2D, 0x03, 0xCC, 0x07, 0x08, 0x0B, 0x15, 0x17,
+    0x18, 0x1B, 0x1E, 0x25, 0x40, 0x41, 0x44, 0xDD, 0x71, 0xAC, 0xD7, 0xD2, 0xDC, 0x00, 0x56, 0xDD,
+    0x7D, 0x00, 0x33, 0xDC, 0xC4, 0xDC, 0x81, 0x00, 0x1A, 0x00, 0x03, 0xAC, 0x7D, 0x13, 0xED, 0x42,
+    0x48, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0x41, 0x0A, 0xC0, 0x63, 0x43, 0x01, 0x0A, 0x40, 0xDD, 0xBA,
+    0xDD, 0xBA, 0x00, 0x04, 0x21, 0x34, 0x0A, 0xC3, 0x10, 0x1C, 0x25, 0xDD, 0x6C, 0x00, 0x18, 0x00,
+    0x03, 0x41, 0x19, 0x8B, 0x63, 0x21, 0x21, 0x04, 0x43, 0x25, 0x27, 0x42, 0xAE, 0x3B, 0xDC, 0xD6,
+    0x00, 0x03, 0xC2, 0x1E, 0x30, 0xDC, 0xE0, 0xDD, 0xE2, 0x41, 0x29, 0x8D, 0xF5, 0x21, 0x23, 0x04,
+    0x21, 0x1B, 0x03, 0xC2, 0x20, 0x44, 0xDD, 0xCE, 0x00, 0x03, 0x21, 0x38, 0x07, 0x45, 0x14, 0x15,
+    0x16, 0x27, 0x40, 0x00, 0x03, 0xDD, 0x0A, 0xDD, 0xA2, 0xDD, 0x37, 0xDC, 0x66, 0x41, 0x19, 0xA4,
+    0x62, 0x51, 0x01, 0x07, 0x0A, 0x0D, 0x12, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1E, 0x1F, 0x25, 0x27,
+    0x28, 0x2A, 0x49, 0x01, 0x93, 0x01, 0x74, 0x01, 0x5E, 0x01, 0x50, 0x01, 0x0F, 0x01, 0x01, 0xBF,
+    0x77, 0x00, 0xEA, 0x00, 0x87, 0x00, 0x4A, 0xDD, 0x48, 0xDE, 0x11, 0x00, 0x39, 0x00, 0x2F, 0xA8,
+    0xB7, 0x00, 0x14, 0x00, 0x04, 0x41, 0x35, 0xD1, 0x12, 0x21, 0x1E, 0x04, 0xC2, 0x22, 0x40, 0xDE,
+    0x30, 0x00, 0x03, 0x42, 0x0A, 0x19, 0x0B, 0x13, 0xDD, 0x8D, 0xC3, 0x27, 0x34, 0x35, 0xDD, 0x22,
+    0x00, 0x07, 0xDE, 0x5A, 0xC2, 0x1E, 0x44, 0xDA, 0x82, 0x14, 0xC7, 0x41, 0x32, 0xCE, 0x10, 0x21,
+    0x23, 0x04, 0x41, 0x19, 0x86, 0x04, 0x42, 0x01, 0x2D, 0x96, 0x01, 0x00, 0x04, 0x21, 0x0A, 0x07,
+    0xC5, 0x17, 0x23, 0x2D, 0x34, 0x40, 0xDD, 0x74, 0xDE, 0x80, 0x00, 0x11, 0x00, 0x03, 0xC2, 0x6B,
+    0x41, 0x1B, 0xB9, 0x54, 0x21, 0x40, 0x04, 0x21, 0x1B, 0x03, 0x21, 0x2D, 0x03, 0xC4, 0x21, 0x31,
+    0x38, 0x41, 0xD9, 0xDB, 0xDB, 0x6A, 0xDE, 0x9D, 0x00, 0x03, 0x41, 0x32, 0xC9, 0x34, 0x21, 0x23,
+    0x04, 0x41, 0x21, 0x9F, 0x08, 0x21, 0x32, 0x04, 0x21, 0x15, 0x03, 0x41, 0x32, 0xBE, 0x85, 0x22,
+    0x0B, 0x21, 0x07, 0x04, 0x42, 0x01, 0x1A, 0xBD, 0x78, 0xD6, 0xC9, 0x42, 0x0B, 0x2A, 0xDE, 0xAF,
+    0xDE, 0xAF, 0x41, 0x2D, 0xD9, 0x20, 0x22, 0x14, 0x17, 0x0B, 0x04, 0xC6, 0x01, 0x1F, 0x21, 0x40,
+    0x42, 0x44, 0x00, 0x2D, 0xC4, 0x6D, 0x30, 0x3B, 0x00, 0x1C, 0x00, 0x17, 0x00, 0x05, 0xC3, 0x15,
+    0x17, 0x40, 0xA1, 0x8F, 0x76, 0x86, 0x7B, 0xBD, 0x43, 0x13, 0x32, 0x4C, 0xDE, 0xF8, 0x00, 0x1D,
+    0x00, 0x0A, 0xC2, 0x35, 0x38, 0xDF, 0x02, 0xDF, 0x01, 0x41, 0x34, 0x9D, 0x43, 0x41, 0x01, 0xDD,
+    0x5B, 0x41, 0x19, 0x50, 0x4D, 0x42, 0x0B, 0x27, 0x00, 0x04, 0x9A, 0x3E, 0xC4, 0x19, 0x38, 0x40,
+    0x44, 0xDC, 0x5A, 0x00, 0x0F, 0x00, 0x07, 0x76, 0xB8, 0xC4, 0x19, 0x30, 0x32, 0x38, 0xDB, 0xBE,
+    0xDF, 0x29, 0xDF, 0x29, 0x2E, 0x8C, 0x41, 0x24, 0xCC, 0x4C, 0xC2, 0x21, 0x2B, 0x00, 0x04, 0xDB,
+    0xCF, 0x41, 0x49, 0xBF, 0x07, 0x21, 0x21, 0x04, 0x21, 0x40, 0x03, 0x21, 0x22, 0x03, 0x42, 0x14,
+    0x35, 0xDF, 0x4E, 0x00, 0x03, 0x42, 0x23, 0x35, 0xDF, 0x06, 0xD2, 0x22, 0x43, 0x19, 0x23, 0x2B,
+    0xDE, 0xFE, 0x00, 0x0E, 0x00, 0x07, 0xD6, 0x01, 0x07, 0x0A, 0x0B, 0x13, 0x14, 0x15, 0x17, 0x18,
+    0x19, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2C, 0x40, 0x42, 0x44, 0x01, 0x1A, 0xDF,
+    0x66, 0xDE, 0xA0, 0x8E, 0xA3, 0x01, 0x0C, 0x01, 0x02, 0x40, 0x3E, 0xCA, 0xB8, 0xCD, 0xB7, 0x00,
+    0xE6, 0xCC, 0xFE, 0xDF, 0x66, 0x00, 0xC9, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x5D, 0x00, 0x4A, 0x00,
+    0x3D, 0x00, 0x2C, 0x00, 0x0A, 0xDF, 0x08, 0xDF, 0x08, 0x42, 0x27, 0x36, 0xDF, 0xA8, 0xDD, 0x9A,
+    0xC3, 0x19, 0x1E, 0x25, 0xB9, 0x2D, 0x00, 0x07, 0xDF, 0x4A, 0x43, 0x14, 0x15, 0x19, 0xDF, 0xBA,
+    0xCA, 0xF4, 0xDF, 0xBA, 0x43, 0x09, 0x0B, 0x21, 0xDF, 0x09, 0xDF, 0x66, 0xBF, 0x8A, 0x46, 0x25,
+    0x2A, 0x31, 0x32, 0x38, 0x40, 0xDF, 0xCE, 0xBC, 0xF6, 0x00, 0x14, 0xDF, 0x88, 0xDF, 0x70, 0x00,
+    0x0A, 0x41, 0x04, 0xC6, 0x29, 0x42, 0x40, 0x42, 0x02, 0x2F, 0x00, 0x04, 0x41, 0x19, 0xDF, 0x67,
+    0x43, 0x19, 0x32, 0x40, 0xDF, 0xD4, 0xDC, 0xE2, 0x00, 0x04, 0xC1, 0x13, 0xDD, 0x38, 0x21, 0x23,
+    0x04, 0x43, 0x01, 0x15, 0x42, 0xE0, 0x01, 0xC1, 0x67, 0x56, 0x24, 0x45, 0x22, 0x25, 0x31, 0x32,
+    0x34, 0xE0, 0x0B, 0xE0, 0x0B, 0xDF, 0x50, 0x00, 0x0D, 0x00, 0x0A, 0xC1, 0x0D, 0xBB, 0x3B, 0x21,
+    0x22, 0x04, 0x45, 0x0D, 0x22, 0x31, 0x32, 0x34, 0xE0, 0x06, 0xE0, 0x22, 0x00, 0x03, 0xDF, 0xE9,
+    0xDD, 0x14, 0x41, 0x0B, 0xDD, 0xA2, 0x41, 0x2D, 0xA6, 0xE2, 0x44, 0x17, 0x21, 0x23, 0x32, 0xD0,
+    0xAF, 0x00, 0x04, 0xE0, 0x39, 0xE0, 0x01, 0x41, 0x1A, 0xD0, 0x27, 0x21, 0x40, 0x04, 0x21, 0x4C,
+    0x03, 0x42, 0x0A, 0x23, 0x00, 0x03, 0xE0, 0x51, 0x41, 0x16, 0xDF, 0x56, 0x21, 0x34, 0x04, 0xA1,
+    0x1E, 0x03, 0x42, 0x22, 0x35, 0xE0, 0x62, 0x00, 0x03, 0x42, 0x21, 0x32, 0xE0, 0x69, 0xE0, 0x23,
+    0xC2, 0x04, 0x25, 0x00, 0x07, 0xC4, 0xED, 0xC2, 0x32, 0x4C, 0x00, 0x07, 0xE0, 0x77, 0x41, 0x2A,
+    0x96, 0x2F, 0x21, 0x19, 0x04, 0x21, 0x48, 0x03, 0x21, 0x34, 0x03, 0xC2, 0x18, 0x1B, 0xC5, 0x97,
+    0x00, 0x03, 0x21, 0x4C, 0x07, 0x21, 0x29, 0x03, 0x21, 0x01, 0x03, 0x43, 0x22, 0x31, 0x39, 0x00,
+    0x24, 0x00, 0x03, 0xE0, 0x55, 0x42, 0x23, 0x32, 0xCB, 0x97, 0xE0, 0x5F, 0x41, 0x15, 0xDF, 0xA0,
+    0x21, 0x35, 0x04, 0xC4, 0x01, 0x18, 0x23, 0x2A, 0x00, 0x0E, 0xC5, 0xBF, 0x00, 0x03, 0xDF, 0x7B,
+    0x43, 0x32, 0x35, 0x38, 0xE0, 0x87, 0x00, 0x0D, 0xC2, 0x26, 0x41, 0x17, 0xE0, 0x64, 0x21, 0x40,
+    0x04, 0x21, 0x34, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x1A, 0x03, 0x41, 0x22, 0x76, 0x5B, 0x43, 0x08,
+    0x15, 0x28, 0xE0, 0xDE, 0xE0, 0xDE, 0xE0, 0xDE, 0x46, 0x17, 0x1E, 0x2D, 0x31, 0x32, 0x34, 0xDE,
+    0x04, 0xE0, 0xDE, 0x00, 0x11, 0x00, 0x0E, 0xE0, 0x63, 0x00, 0x0A, 0x41, 0x2A, 0x4B, 0x2A, 0x21,
+    0x07, 0x04, 0x21, 0x31, 0x03, 0x41, 0x4C, 0x86, 0xD9, 0xA2, 0x21, 0x22, 0x07, 0x04, 0x21, 0x25,
+    0x05, 0x44, 0x31, 0x32, 0x38, 0x39, 0xBC, 0x35, 0xE1, 0x10, 0xE0, 0xB3, 0x00, 0x03, 0x41, 0x2A,
+    0xDF, 0xA2, 0x44, 0x23, 0x25, 0x31, 0x39, 0xBE, 0x4A, 0xC5, 0xFD, 0x00, 0x04, 0xE0, 0xE9, 0x41,
+    0x1E, 0xD5, 0x58, 0x21, 0x34, 0x04, 0x21, 0x1E, 0x03, 0x42, 0x32, 0x4C, 0xE0, 0xF0, 0xE1, 0x39,
+    0xA1, 0x19, 0x07, 0x22, 0x01, 0x12, 0x0D, 0x03, 0x41, 0x29, 0xDE, 0x86, 0x42, 0x01, 0x17, 0x00,
+    0x04, 0xE1, 0x4C, 0x42, 0x2A, 0x4C, 0x9F, 0xEB, 0xE1, 0x53, 0x21, 0x11, 0x07, 0x21, 0x13, 0x03,
+    0x21, 0x31, 0x03, 0xA1, 0x20, 0x03, 0x21, 0x18, 0x03, 0x44, 0x23, 0x31, 0x32, 0x34, 0x51, 0x48,
+    0x00, 0x26, 0x00, 0x1D, 0x00, 0x03, 0x43, 0x1E, 0x31, 0x32, 0xE1, 0x76, 0xC4, 0xBE, 0xCE, 0x8C,
+    0x41, 0x02, 0xC2, 0xE2, 0xA1, 0x40, 0x04, 0x42, 0x32, 0x4C, 0xE1, 0x87, 0x00, 0x03, 0x45, 0x1E,
+    0x25, 0x32, 0x38, 0x40, 0x00, 0x07, 0xE1, 0x8E, 0xD6, 0x9A, 0xE0, 0x06, 0xBE, 0x10, 0x44, 0x01,
+    0x1A, 0x21, 0x25, 0xE1, 0x40, 0xE1, 0x9E, 0xE1, 0x9E, 0xC6, 0x1B, 0x41, 0x34, 0x93, 0x78, 0x21,
+    0x1E, 0x04, 0x21, 0x49, 0x03, 0x42, 0x13, 0x18, 0xE1, 0xB5, 0xE1, 0xB5, 0x41, 0x23, 0xA8, 0x6B,
+    0x21, 0x42, 0x04, 0xC6, 0x2D, 0x32, 0x34, 0x35, 0x38, 0x4C, 0xE1, 0x74, 0x00, 0x25, 0x76, 0xDA,
+    0x00, 0x11, 0x00, 0x0E, 0x00, 0x03, 0x43, 0x1B, 0x25, 0x2A, 0xE1, 0xD6, 0xCE, 0xB8, 0xE1, 0xD6,
+    0x41, 0x01, 0xDF, 0x94, 0x21, 0x01, 0x04, 0x21, 0x36, 0x03, 0x41, 0x25, 0xC4, 0x50, 0x21, 0x34,
+    0x04, 0xA2, 0x01, 0x1E, 0x0A, 0x03, 0x21, 0x01, 0x05, 0x22, 0x32, 0x36, 0x23, 0x03, 0x42, 0x07,
+    0x32, 0xE1, 0xFE, 0xCE, 0xE0, 0x41, 0x25, 0x87, 0xD9, 0x41, 0x17, 0x08, 0xD6, 0xA3, 0x27, 0x32,
+    0x38, 0x0F, 0x08, 0x04, 0x41, 0x42, 0xC8, 0x51, 0x21, 0x38, 0x04, 0xC3, 0x10, 0x13, 0x2A, 0xE1,
+    0xC0, 0x00, 0x03, 0xE2, 0x11, 0x42, 0x23, 0x31, 0xE2, 0x25, 0xE1, 0x6A, 0x43, 0x07, 0x0A, 0x22,
+    0xE2, 0x2C, 0xE2, 0x2C, 0xE2, 0x2C, 0x41, 0x13, 0xE1, 0xED, 0x21, 0x23, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x1A, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x10, 0x03, 0x42, 0x10, 0x29, 0xE2, 0x49, 0x00, 0x03,
+    0x46, 0x14, 0x21, 0x31, 0x34, 0x38, 0x39, 0xE1, 0x18, 0x00, 0x2B, 0x00, 0x24, 0x00, 0x07, 0xDF,
+    0x23, 0xAC, 0x8D, 0x42, 0x04, 0x32, 0xE2, 0x63, 0xE2, 0x1D, 0x42, 0x19, 0x32, 0xBD, 0x04, 0xDE,
+    0xFF, 0x47, 0x04, 0x0A, 0x17, 0x19, 0x20, 0x23, 0x28, 0x84, 0x44, 0xA5, 0xDB, 0xE1, 0xEC, 0xDF,
+    0x63, 0xE2, 0x70, 0x00, 0x07, 0xBE, 0x72, 0x41, 0x40, 0x5E, 0x71, 0x21, 0x34, 0x04, 0x21, 0x1E,
+    0x03, 0x42, 0x01, 0x04, 0x00, 0x03, 0xE2, 0x91, 0x46, 0x04, 0x14, 0x21, 0x22, 0x23, 0x25, 0xA9,
+    0x47, 0xE2, 0x52, 0x42, 0x81, 0x00, 0x07, 0x97, 0xB4, 0xC8, 0x22, 0x5D, 0x01, 0x04, 0x06, 0x07,
+    0x08, 0x0A, 0x0B, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x23,
+    0x25, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x40, 0x42, 0x44, 0x02, 0xDD, 0x02, 0xC6, 0x02, 0xBB, 0xCF,
+    0xB0, 0x02, 0xA0, 0x02, 0x89, 0x02, 0x79, 0xE2, 0xAB, 0x02, 0x71, 0x02, 0x5A, 0x02, 0x49, 0x02,
+    0x10, 0x01, 0xEB, 0x01, 0xC3, 0x01, 0x9A, 0x01, 0x89, 0x01, 0x42, 0x01, 0x35, 0x01, 0x1D, 0x00,
+    0xE8, 0x00, 0xB2, 0x00, 0x9E, 0x00, 0x90, 0x00, 0x5B, 0x00, 0x48, 0xE1, 0x73, 0x00, 0x3A, 0x00,
+    0x13, 0xC7, 0x51, 0x41, 0x13, 0xC0, 0x2B, 0xA1, 0x04, 0x04, 0x41, 0x21, 0xDD, 0xDF, 0xA2, 0x30,
+    0x32, 0x04, 0x04, 0x41, 0x41, 0x5E, 0xFD, 0x21, 0x34, 0x04, 0x43, 0x08, 0x1E, 0x23, 0xE2, 0xAB,
+    0xBD, 0xDE, 0xD9, 0x69, 0x41, 0x1E, 0xE2, 0xA5, 0xA1, 0x42, 0x04, 0xC7, 0x0A, 0x0B, 0x23, 0x25,
+    0x40, 0x48, 0x49, 0x00, 0x24, 0xD3, 0x51, 0x00, 0x1D, 0x00, 0x14, 0x00, 0x11, 0xE3, 0x2B, 0x00,
+    0x03, 0xC2, 0x15, 0x43, 0xE2, 0xDB, 0xE1, 0x10, 0xC1, 0x1E, 0xDC, 0x5A, 0xC2, 0x1A, 0x1E, 0x9C,
+    0xC5, 0xE2, 0xE6, 0x42, 0x07, 0x1A, 0x00, 0x07, 0xE3, 0x53, 0x23, 0x07, 0x21, 0x48, 0x19, 0x12,
+    0x07, 0x42, 0x15, 0x2A, 0xB4, 0x64, 0x86, 0x8B, 0x21, 0x19, 0x07, 0x21, 0x49, 0x03, 0x21, 0x31,
+    0x03, 0xC3, 0x04, 0x0A, 0x1E, 0xDA, 0x23, 0x00, 0x03, 0xE0, 0x55, 0xC4, 0x14, 0x17, 0x40, 0x46,
+    0xE2, 0xB5, 0xE2, 0x7C, 0xE0, 0x48, 0xE3, 0x7B, 0x21, 0x19, 0x0D, 0x43, 0x0A, 0x14, 0x49, 0x00,
+    0x1A, 0xE3, 0x8B, 0x00, 0x03, 0xC1, 0x32, 0xE1, 0x86, 0xC6, 0x08, 0x14, 0x1B, 0x1E, 0x41, 0x42,
+    0xE3, 0x8F, 0xE3, 0x44, 0xDB, 0x9E, 0xDB, 0xB7, 0xE3, 0x98, 0xE3, 0x53, 0x41, 0x0B, 0xE2, 0xAD,
+    0x41, 0x1E, 0xE0, 0x86, 0xA1, 0x42, 0x04, 0xA1, 0x34, 0x03, 0xC3, 0x08, 0x14, 0x15, 0xB2, 0x89,
+    0xDC, 0x6E, 0xE3, 0x5F, 0x41, 0x34, 0xD3, 0x69, 0x21, 0x0F, 0x04, 0x41, 0x21, 0xC8, 0xF5, 0x21,
+    0x32, 0x04, 0x41, 0x31, 0xC4, 0x0B, 0x41, 0x01, 0xC4, 0x4D, 0x21, 0x34, 0x04, 0x21, 0x19, 0x03,
+    0x21, 0x2A, 0x03, 0x42, 0x31, 0x32, 0x8E, 0x9E, 0x00, 0x03, 0x42, 0x16, 0x21, 0xE3, 0x8F, 0xC8,
+    0x67, 0x41, 0x08, 0x77, 0x7C, 0x41, 0x2A, 0xE0, 0xDD, 0x21, 0x2D, 0x04, 0xCE, 0x01, 0x04, 0x08,
+    0x0A, 0x1B, 0x21, 0x23, 0x28, 0x2A, 0x30, 0x32, 0x34, 0x40, 0x42, 0xC9, 0x78, 0xD3, 0x44, 0xE3,
+    0xB0, 0xD9, 0x4E, 0x00, 0x34, 0x00, 0x2D, 0x00, 0x2A, 0x00, 0x19, 0x00, 0x12, 0xE3, 0xFC, 0x9B,
+    0xC5, 0xE3, 0xFC, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x18, 0xE3, 0x96, 0x41, 0x18, 0xB3, 0x1E, 0x44,
+    0x18, 0x23, 0x42, 0x44, 0x00, 0x33, 0xE3, 0xC9, 0x00, 0x08, 0x00, 0x04, 0x41, 0x1E, 0xC9, 0xCE,
+    0x41, 0x40, 0x23, 0x03, 0x41, 0x25, 0xC8, 0x36, 0xA1, 0x2B, 0x04, 0x41, 0x44, 0xD0, 0xE3, 0x21,
+    0x01, 0x04, 0x21, 0x2D, 0x03, 0xC4, 0x14, 0x1E, 0x2D, 0x42, 0x00, 0x03, 0xDC, 0x73, 0x5B, 0x00,
+    0x00, 0xA5, 0x22, 0x07, 0x21, 0x1A, 0x0D, 0xCC, 0x01, 0x07, 0x0B, 0x12, 0x14, 0x17, 0x18, 0x19,
+    0x1E, 0x21, 0x48, 0x49, 0x00, 0xD2, 0x00, 0xCE, 0x00, 0xBB, 0x00, 0xB0, 0x00, 0xAD, 0x00, 0x38,
+    0xE4, 0x67, 0x00, 0x2B, 0xE3, 0x5B, 0x00, 0x27, 0x00, 0x05, 0xE3, 0xAC, 0xC1, 0x08, 0xE4, 0x26,
+    0x41, 0x4C, 0x0D, 0x9A, 0x21, 0x22, 0x04, 0x21, 0x1E, 0x03, 0x21, 0x31, 0x03, 0x21, 0x23, 0x03,
+    0xC2, 0x17, 0x2A, 0x00, 0x03, 0x9A, 0x51, 0x41, 0x17, 0xA7, 0x52, 0xA1, 0x34, 0x04, 0x41, 0x30,
+    0xBD, 0x37, 0xC2, 0x01, 0x23, 0xE3, 0xB0, 0x00, 0x04, 0xC7, 0x01, 0x14, 0x19, 0x1E, 0x25, 0x48,
+    0x49, 0xDB, 0x6B, 0x00, 0x2D, 0x00, 0x19, 0xDF, 0x07, 0x00, 0x0E, 0x00, 0x07, 0xE4, 0x80, 0x42,
+    0x01, 0x08, 0xE4, 0xCF, 0xE4, 0x89, 0x42, 0x19, 0x22, 0x00, 0x07, 0xC6, 0xE3, 0xC2, 0x17, 0x1E,
+    0xB1, 0xC2, 0xE4, 0x17, 0x21, 0x07, 0x07, 0x42, 0x38, 0x49, 0xD4, 0x33, 0xE4, 0x81, 0xC3, 0x02,
+    0x04, 0x15, 0xB4, 0x2D, 0x00, 0x07, 0xE4, 0x88, 0x44, 0x07, 0x19, 0x22, 0x2B, 0xE4, 0xF8, 0xE4,
+    0xF8, 0xE4, 0xF8, 0xE4, 0xDC, 0x45, 0x19, 0x27, 0x2D, 0x30, 0x32, 0xE5, 0x05, 0x00, 0x21, 0x00,
+    0x17, 0xE5, 0x05, 0x00, 0x0D, 0xC1, 0x1E, 0xE4, 0xBA, 0xC2, 0x07, 0x21, 0x00, 0x04, 0xE5, 0x19,
+    0x42, 0x19, 0x2D, 0xE5, 0x20, 0x00, 0x07, 0x5F, 0x20, 0x01, 0x07, 0x08, 0x0A, 0x0D, 0x13, 0x14,
+    0x18, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x24, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x48, 0x49, 0x12, 0xB1, 0x12, 0x3A, 0x12, 0x1C, 0xCB,
+    0x9B, 0x11, 0xF1, 0x11, 0xE1, 0x11, 0xDA, 0xE5, 0x0E, 0x11, 0x58, 0x11, 0x28, 0xE2, 0x97, 0x10,
+    0x73, 0x0C, 0x79, 0x0B, 0xCC, 0x0A, 0x8F, 0x0A, 0x3D, 0x0A, 0x29, 0x09, 0xFC, 0x09, 0xA2, 0x08,
+    0xE0, 0x07, 0x16, 0x05, 0xC1, 0x05, 0x77, 0x02, 0x7C, 0x01, 0xFC, 0x01, 0xCD, 0x01, 0x9C, 0x00,
+    0xC0, 0x00, 0x6E, 0x00, 0x51, 0x00, 0x22, 0x00, 0x07, 0x42, 0x0B, 0x2A, 0xE5, 0x89, 0xC5, 0x53,
+    0x41, 0x42, 0xC3, 0xD8, 0x21, 0x01, 0x04, 0x41, 0x0B, 0xE5, 0x28, 0x21, 0x40, 0x04, 0x42, 0x01,
+    0x17, 0xE2, 0x90, 0x3E, 0x36, 0xC4, 0x1A, 0x2A, 0x2D, 0x40, 0xE4, 0xAF, 0xE5, 0xA5, 0xDF, 0xF3,
+    0x00, 0x07, 0x41, 0x49, 0xE2, 0xA4, 0x41, 0x2D, 0xC5, 0x7C, 0x26, 0x2D, 0x31, 0x34, 0x35, 0x38,
+    0x49, 0x31, 0x26, 0x1F, 0x15, 0x08, 0x04, 0x41, 0x2A, 0x59, 0x6C, 0x21, 0x34, 0x04, 0x21, 0x14,
+    0x03, 0x21, 0x35, 0x03, 0x21, 0x1B, 0x03, 0x41, 0x17, 0xE5, 0xC4, 0x21, 0x40, 0x04, 0x42, 0x14,
+    0x2A, 0xE5, 0x78, 0xC5, 0xA8, 0x41, 0x0A, 0x4D, 0x9C, 0xA1, 0x42, 0x04, 0x23, 0x32, 0x34, 0x4C,
+    0x11, 0x0E, 0x03, 0x42, 0x19, 0x2A, 0xC0, 0xCB, 0xE5, 0xF3, 0x21, 0x23, 0x07, 0x23, 0x1B, 0x23,
+    0x40, 0x29, 0x11, 0x03, 0x42, 0x49, 0x4A, 0xD3, 0x1A, 0xD3, 0x1A, 0x42, 0x23, 0x44, 0xC4, 0x92,
+    0xE1, 0xE2, 0x21, 0x2D, 0x07, 0x21, 0x2D, 0x03, 0x21, 0x49, 0x4A, 0x21, 0x35, 0x03, 0x21, 0x1B,
+    0x03, 0x21, 0x1B, 0x03, 0x21, 0x2D, 0x03, 0x46, 0x2D, 0x32, 0x34, 0x38, 0x39, 0x47, 0x00, 0x2A,
+    0xE5, 0x6C, 0xD8, 0xFE, 0x00, 0x23, 0x00, 0x12, 0x00, 0x03, 0x41, 0x23, 0xAA, 0x05, 0x21, 0x17,
+    0x04, 0x42, 0x31, 0x4C, 0xE6, 0x40, 0x00, 0x03, 0xC2, 0x0B, 0x1C, 0x00, 0x07, 0xE1, 0x86, 0xC3,
+    0x01, 0x19, 0x21, 0xDD, 0x01, 0xC5, 0xAF, 0xE5, 0x4D, 0x41, 0x1F, 0xE6, 0x0A, 0xA1, 0x41, 0x04,
+    0x41, 0x2E, 0xD6, 0x47, 0x21, 0x44, 0x04, 0x21, 0x35, 0x03, 0x42, 0x14, 0x34, 0x00, 0x03, 0xE6,
+    0x31, 0x21, 0x25, 0x07, 0xC2, 0x32, 0x39, 0x00, 0x03, 0xCD, 0x7B, 0x41, 0x15, 0x7E, 0xDD, 0x21,
+    0x40, 0x04, 0x42, 0x27, 0x2D, 0xA1, 0xAB, 0x76, 0xB6, 0x41, 0x40, 0x55, 0xE7, 0x42, 0x15, 0x19,
+    0xE6, 0x8D, 0x00, 0x04, 0x21, 0x21, 0x07, 0x41, 0x21, 0xC1, 0xE7, 0x46, 0x08, 0x21, 0x2A, 0x40,
+    0x41, 0x42, 0xE1, 0xDD, 0x00, 0x27, 0x00, 0x1C, 0x00, 0x19, 0x00, 0x07, 0x00, 0x04, 0x21, 0x4C,
+    0x13, 0x41, 0x04, 0xD6, 0x8E, 0x21, 0x4C, 0x04, 0x42, 0x23, 0x44, 0xA4, 0xD3, 0xE2, 0x8F, 0x21,
+    0x2D, 0x07, 0x41, 0x1F, 0xE3, 0xB4, 0x43, 0x0B, 0x1F, 0x40, 0xC1, 0x8A, 0x00, 0x07, 0x00, 0x04,
+    0x48, 0x01, 0x07, 0x14, 0x19, 0x22, 0x23, 0x25, 0x2A, 0x00, 0x88, 0x00, 0x81, 0x00, 0x73, 0x33,
+    0x76, 0xBF, 0x87, 0x00, 0x22, 0x00, 0x1B, 0x00, 0x0A, 0x42, 0x31, 0x48, 0x2A, 0x7B, 0xE4, 0xBF,
+    0x21, 0x1F, 0x07, 0xC4, 0x02, 0x15, 0x17, 0x1F, 0xCA, 0xE1, 0xE5, 0xEA, 0xE5, 0xE7, 0xA5, 0xA0,
+    0x41, 0x4C, 0xAA, 0x0A, 0xC4, 0x01, 0x0A, 0x2D, 0x44, 0x00, 0x04, 0xC9, 0x6A, 0xDC, 0xC4, 0xBD,
+    0xD5, 0xC6, 0x14, 0x1B, 0x1D, 0x21, 0x2B, 0x41, 0xCE, 0x5D, 0xDF, 0x16, 0xE4, 0x81, 0xE2, 0x4F,
+    0x8C, 0xBD, 0x61, 0x8D, 0x42, 0x23, 0x2D, 0xC2, 0x03, 0xE6, 0xEB, 0x21, 0x04, 0x07, 0x47, 0x01,
+    0x07, 0x14, 0x19, 0x25, 0x48, 0x49, 0x00, 0x3B, 0x00, 0x2A, 0xE7, 0x2E, 0x00, 0x1D, 0x00, 0x03,
+    0xE6, 0xF5, 0xE6, 0xF5, 0xC1, 0x25, 0xE3, 0x36, 0xC1, 0x2B, 0xE6, 0x3F, 0xC2, 0x21, 0x32, 0xE5,
+    0x00, 0xB0, 0x00, 0xC1, 0x27, 0x86, 0x7A, 0x21, 0x21, 0x04, 0x42, 0x34, 0x4C, 0x24, 0x49, 0x00,
+    0x03, 0x42, 0x0B, 0x1F, 0xA8, 0xF6, 0x0D, 0x70, 0x41, 0x2E, 0xE3, 0x43, 0x21, 0x44, 0x04, 0x21,
+    0x19, 0x03, 0x21, 0x23, 0x03, 0x41, 0x23, 0xB2, 0x4D, 0x4B, 0x01, 0x07, 0x14, 0x17, 0x19, 0x22,
+    0x23, 0x27, 0x2A, 0x40, 0x42, 0x3B, 0x5E, 0x00, 0x35, 0x00, 0x31, 0xDF, 0x58, 0xE7, 0x79, 0x00,
+    0x2D, 0x00, 0x1F, 0xC0, 0x30, 0x00, 0x18, 0x00, 0x07, 0x00, 0x04, 0xC1, 0x0B, 0xE7, 0x7F, 0x41,
+    0x1A, 0xD4, 0xB5, 0xA1, 0x41, 0x04, 0xC1, 0x40, 0x37, 0xBB, 0x42, 0x34, 0x41, 0xA9, 0x21, 0xD7,
+    0x8A, 0x41, 0x34, 0xAA, 0x07, 0x21, 0x1B, 0x04, 0x21, 0x1B, 0x03, 0x43, 0x14, 0x34, 0x4C, 0xE7,
+    0x9F, 0x00, 0x03, 0xE5, 0xAC, 0x41, 0x01, 0xAA, 0x1F, 0x21, 0x34, 0x04, 0x41, 0x0B, 0xE7, 0x03,
+    0x21, 0x42, 0x04, 0x21, 0x25, 0x03, 0x4B, 0x01, 0x08, 0x0A, 0x14, 0x15, 0x19, 0x1A, 0x25, 0x27,
+    0x2A, 0x42, 0x00, 0x3B, 0xD3, 0x10, 0xA9, 0x7A, 0x00, 0x33, 0x00, 0x30, 0x00, 0x2C, 0xE7, 0xD6,
+    0x00, 0x1B, 0xAA, 0x30, 0x00, 0x0D, 0x00, 0x03, 0x42, 0x34, 0x40, 0xE3, 0x6E, 0xAE, 0x49, 0x43,
+    0x08, 0x21, 0x27, 0xCA, 0xAC, 0xE7, 0xA1, 0xCA, 0xAC, 0x47, 0x15, 0x19, 0x1F, 0x25, 0x40, 0x48,
+    0x49, 0xA6, 0x24, 0x83, 0x73, 0xE5, 0x79, 0x00, 0x11, 0x00, 0x0A, 0xE8, 0x09, 0xE8, 0x09, 0xC1,
+    0x1F, 0xE8, 0x06, 0x21, 0x19, 0x04, 0x43, 0x19, 0x21, 0x49, 0xE8, 0x26, 0xE8, 0x26, 0x00, 0x03,
+    0x42, 0x2D, 0x32, 0xE7, 0xD2, 0xE6, 0x32, 0x41, 0x19, 0x02, 0x85, 0xA2, 0x1A, 0x42, 0x0B, 0x04,
+    0x41, 0x01, 0x94, 0x8B, 0x21, 0x41, 0x04, 0x21, 0x2A, 0x03, 0x41, 0x37, 0xE4, 0x3C, 0x21, 0x1F,
+    0x04, 0x21, 0x40, 0x03, 0x42, 0x1A, 0x21, 0xE8, 0x54, 0x00, 0x03, 0x42, 0x37, 0x49, 0xDD, 0x09,
+    0xE8, 0x06, 0x21, 0x1F, 0x07, 0xC2, 0x0B, 0x40, 0x9E, 0xEC, 0x00, 0x03, 0x21, 0x07, 0x07, 0xC7,
+    0x15, 0x19, 0x1A, 0x1F, 0x25, 0x48, 0x49, 0x00, 0x34, 0xE8, 0x6F, 0xE8, 0x6F, 0xE5, 0x04, 0x00,
+    0x28, 0x00, 0x1B, 0x00, 0x03, 0xC1, 0x1F, 0xDD, 0xD7, 0x42, 0x31, 0x32, 0xE8, 0x88, 0xE7, 0xCE,
+    0xC2, 0x19, 0x1F, 0xC7, 0xF0, 0x00, 0x07, 0x41, 0x38, 0xE8, 0x2E, 0x21, 0x15, 0x04, 0x21, 0x19,
+    0x03, 0x21, 0x27, 0x03, 0x21, 0x40, 0x03, 0x21, 0x15, 0x03, 0x21, 0x40, 0x03, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0xC1, 0x1F, 0xE6, 0x26, 0xC7, 0x01, 0x08, 0x14, 0x1F, 0x21,
+    0x41, 0x48, 0xE8, 0xBA, 0xD3, 0xF4, 0x00, 0x35, 0xDD, 0x68, 0x00, 0x2A, 0x00, 0x07, 0x00, 0x04,
+    0xC2, 0x07, 0x19, 0x00, 0xB1, 0xE8, 0xD0, 0x42, 0x2D, 0x32, 0x00, 0x07, 0xDD, 0x45, 0xC2, 0x07,
+    0x19, 0xE8, 0xDE, 0xE8, 0xDE, 0x41, 0x25, 0xE7, 0xDC, 0xC5, 0x1C, 0x1D, 0x23, 0x2B, 0x41, 0xE6,
+    0x59, 0xB5, 0x0F, 0xDC, 0x3B, 0x00, 0x04, 0x89, 0x53, 0x43, 0x07, 0x2D, 0x32, 0xE8, 0xF9, 0x00,
+    0x1B, 0x00, 0x10, 0x4E, 0x01, 0x23, 0x25, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x37, 0x38, 0x39,
+    0x48, 0x49, 0x8D, 0x39, 0x03, 0x49, 0x02, 0xDC, 0x02, 0x33, 0x02, 0x13, 0x01, 0xD5, 0x01, 0x8A,
+    0x01, 0x2D, 0x00, 0xFA, 0x00, 0xDD, 0x00, 0x94, 0x00, 0x49, 0x00, 0x2C, 0x00, 0x0A, 0x43, 0x15,
+    0x19, 0x21, 0xE9, 0x2E, 0xE5, 0x09, 0xE9, 0x2E, 0x43, 0x14, 0x31, 0x32, 0xE8, 0x72, 0x00, 0x0A,
+    0xE9, 0x38, 0x41, 0x17, 0xE1, 0x47, 0x21, 0x19, 0x04, 0x43, 0x27, 0x31, 0x34, 0x00, 0x11, 0x00,
+    0x03, 0xBD, 0xAC, 0xC2, 0x34, 0x35, 0xE9, 0x1A, 0xE9, 0x53, 0x44, 0x01, 0x23, 0x38, 0x39, 0xE8,
+    0x22, 0x00, 0x07, 0xE9, 0x5A, 0xE9, 0x5A, 0x41, 0x15, 0x58, 0x61, 0x21, 0x19, 0x04, 0x41, 0x04,
+    0xC4, 0x92, 0x22, 0x31, 0x32, 0x07, 0x04, 0xC1, 0x20, 0xE9, 0x5E, 0x21, 0x35, 0x04, 0x42, 0x14,
+    0x22, 0x8B, 0x0C, 0xE9, 0x18, 0x41, 0x21, 0x7C, 0x10, 0xC1, 0x32, 0xE6, 0x56, 0xA1, 0x20, 0x04,
+    0x42, 0x23, 0x32, 0x00, 0x03, 0xE9, 0x90, 0x41, 0x23, 0xB9, 0xFA, 0x22, 0x14, 0x15, 0x0B, 0x04,
+    0x47, 0x13, 0x15, 0x23, 0x30, 0x32, 0x34, 0x39, 0x00, 0x25, 0xE9, 0xA0, 0x00, 0x22, 0x00, 0x1B,
+    0x00, 0x05, 0xD7, 0xD6, 0xE9, 0xA0, 0x42, 0x01, 0x35, 0xE9, 0xB6, 0xE9, 0xB6, 0x41, 0x0F, 0xE9,
+    0xA1, 0x45, 0x07, 0x14, 0x15, 0x28, 0x29, 0x12, 0xEA, 0x00, 0x0B, 0xD7, 0x59, 0xE9, 0xC1, 0x00,
+    0x04, 0xC2, 0x08, 0x4C, 0xC6, 0xF9, 0xE9, 0xD1, 0x21, 0x04, 0x07, 0x43, 0x04, 0x07, 0x19, 0xE9,
+    0x95, 0x00, 0x03, 0x7F, 0x06, 0x41, 0x20, 0xE6, 0xB2, 0x46, 0x01, 0x15, 0x19, 0x1B, 0x31, 0x32,
+    0x89, 0xC7, 0xCB, 0x1C, 0xE6, 0x7E, 0x83, 0xC2, 0x00, 0x0E, 0x00, 0x04, 0xC1, 0x01, 0xA1, 0x87,
+    0x21, 0x35, 0x04, 0xC1, 0x2B, 0xE8, 0xCB, 0xA1, 0x32, 0x04, 0x44, 0x02, 0x14, 0x15, 0x29, 0xE6,
+    0x9F, 0x00, 0x0A, 0x7E, 0xF6, 0x00, 0x03, 0xC4, 0x19, 0x32, 0x39, 0x4C, 0xE6, 0xAC, 0x13, 0x40,
+    0xEA, 0x17, 0xEA, 0x17, 0x21, 0x11, 0x0D, 0x42, 0x04, 0x2B, 0xE8, 0xEF, 0xE8, 0xEF, 0x21, 0x32,
+    0x07, 0xC2, 0x01, 0x15, 0xE7, 0xFC, 0x00, 0x03, 0x42, 0x17, 0x34, 0xEA, 0x38, 0xAD, 0xA2, 0xA1,
+    0x1A, 0x07, 0x21, 0x23, 0x03, 0x44, 0x14, 0x15, 0x21, 0x2A, 0xE9, 0xDF, 0xE9, 0xDC, 0xE6, 0xDA,
+    0xE9, 0xFF, 0x4B, 0x01, 0x04, 0x07, 0x08, 0x0D, 0x13, 0x15, 0x17, 0x1E, 0x22, 0x2A, 0x00, 0x48,
+    0x7C, 0x79, 0x75, 0x9E, 0xEA, 0x52, 0xBB, 0x9F, 0x00, 0x2E, 0x00, 0x21, 0x00, 0x10, 0xEA, 0x52,
+    0xEA, 0x52, 0x00, 0x0D, 0x41, 0x23, 0xE4, 0x55, 0x21, 0x01, 0x04, 0x21, 0x14, 0x03, 0x21, 0x31,
+    0x03, 0x41, 0x38, 0x8A, 0x35, 0x21, 0x19, 0x04, 0x42, 0x32, 0x4C, 0x00, 0x03, 0xEA, 0x88, 0x42,
+    0x19, 0x44, 0xE9, 0xC9, 0x5D, 0xF5, 0xC1, 0x22, 0xE7, 0x2B, 0x41, 0x2A, 0x9F, 0xB6, 0xC7, 0x15,
+    0x17, 0x19, 0x22, 0x34, 0x35, 0x40, 0x00, 0x20, 0xEA, 0x79, 0x78, 0x44, 0x00, 0x16, 0x00, 0x0F,
+    0x00, 0x08, 0x00, 0x04, 0x43, 0x30, 0x35, 0x4C, 0xEA, 0xB4, 0xE9, 0xF9, 0xEA, 0xB4, 0x42, 0x19,
+    0x35, 0x00, 0x0A, 0xEA, 0xBE, 0x41, 0x29, 0xE9, 0xFF, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03, 0xC2,
+    0x21, 0x23, 0xEA, 0x47, 0x00, 0x03, 0xC4, 0x01, 0x27, 0x35, 0x38, 0xEA, 0xD6, 0xE9, 0x9E, 0xEA,
+    0xD6, 0x00, 0x07, 0x42, 0x01, 0x22, 0x25, 0x64, 0xE7, 0x78, 0x44, 0x23, 0x32, 0x34, 0x38, 0xEA,
+    0xEA, 0xEA, 0xEA, 0x00, 0x07, 0xEA, 0xEA, 0x41, 0x23, 0xE7, 0x15, 0x42, 0x19, 0x4C, 0x46, 0xF3,
+    0xEA, 0xFB, 0x41, 0x07, 0xE9, 0xDD, 0x21, 0x27, 0x04, 0x41, 0x21, 0xCB, 0x16, 0x21, 0x2A, 0x04,
+    0xC7, 0x01, 0x08, 0x16, 0x1E, 0x22, 0x25, 0x40, 0xEB, 0x0C, 0x00, 0x19, 0xC3, 0x82, 0xB5, 0x4D,
+    0x00, 0x15, 0x00, 0x0A, 0x00, 0x03, 0xC2, 0x19, 0x43, 0xE0, 0xE6, 0xEA, 0xED, 0xC7, 0x01, 0x14,
+    0x15, 0x22, 0x30, 0x32, 0x42, 0xE8, 0xF8, 0xEA, 0x67, 0xDB, 0x53, 0xEA, 0xC7, 0xEB, 0x2D, 0xEB,
+    0x2D, 0xDD, 0x25, 0x41, 0x40, 0x92, 0x09, 0x21, 0x01, 0x04, 0x21, 0x38, 0x03, 0xA1, 0x09, 0x03,
+    0xC2, 0x19, 0x30, 0xEA, 0xEA, 0x00, 0x03, 0xC1, 0x40, 0xA0, 0xF6, 0xC5, 0x01, 0x13, 0x32, 0x34,
+    0x35, 0xEB, 0x5B, 0xEB, 0x3F, 0xCC, 0x15, 0xE8, 0x4D, 0x00, 0x04, 0xC5, 0x01, 0x19, 0x27, 0x32,
+    0x38, 0xEB, 0x25, 0xEB, 0x4F, 0xEB, 0x25, 0xEB, 0x6B, 0xEB, 0x25, 0xCD, 0x01, 0x04, 0x0A, 0x13,
+    0x14, 0x15, 0x1E, 0x21, 0x22, 0x23, 0x27, 0x29, 0x2A, 0xEB, 0x35, 0x00, 0xDD, 0x00, 0xBD, 0x00,
+    0xA5, 0x8D, 0x09, 0x00, 0x91, 0x00, 0x6B, 0xEB, 0x7B, 0x00, 0x55, 0x00, 0x4E, 0x00, 0x2B, 0x00,
+    0x20, 0x00, 0x10, 0xC1, 0x08, 0xEA, 0x6B, 0xC2, 0x13, 0x19, 0xEA, 0xE1, 0xEA, 0xE1, 0x22, 0x32,
+    0x38, 0x0B, 0x07, 0xC2, 0x08, 0x2B, 0xEA, 0x7B, 0xEA, 0x7B, 0xC1, 0x13, 0xEA, 0xF4, 0x22, 0x32,
+    0x38, 0x0B, 0x04, 0x22, 0x02, 0x29, 0x15, 0x05, 0x42, 0x04, 0x2A, 0xEA, 0x90, 0x26, 0xDA, 0x41,
+    0x0D, 0x5A, 0xED, 0x21, 0x42, 0x04, 0xC1, 0x32, 0xEA, 0x9B, 0x42, 0x19, 0x4C, 0x00, 0x04, 0xEB,
+    0xDA, 0xC2, 0x0A, 0x17, 0xC7, 0x01, 0x00, 0x07, 0xC1, 0x31, 0xEB, 0xE7, 0x4A, 0x01, 0x07, 0x0D,
+    0x15, 0x17, 0x19, 0x22, 0x23, 0x29, 0x2A, 0x00, 0x29, 0x00, 0x24, 0x00, 0x19, 0xC7, 0x10, 0xEB,
+    0xEC, 0x00, 0x0B, 0x98, 0xCD, 0xD0, 0x5F, 0x67, 0x52, 0x00, 0x04, 0x43, 0x15, 0x21, 0x23, 0xE8,
+    0xA0, 0xEC, 0x0B, 0xE9, 0x27, 0x42, 0x21, 0x4C, 0xEC, 0x15, 0xEC, 0x15, 0x21, 0x04, 0x07, 0xC3,
+    0x04, 0x07, 0x32, 0xEC, 0x1F, 0x00, 0x03, 0xEC, 0x1F, 0x44, 0x30, 0x32, 0x34, 0x35, 0xEC, 0x29,
+    0xEC, 0x29, 0xEB, 0xF0, 0xEC, 0x29, 0xC3, 0x23, 0x27, 0x40, 0x00, 0x0D, 0xEA, 0xFE, 0xD0, 0x21,
+    0x47, 0x01, 0x02, 0x0A, 0x0D, 0x15, 0x21, 0x2A, 0xE9, 0x32, 0xEB, 0x3E, 0x00, 0x21, 0xCF, 0x88,
+    0xEC, 0x40, 0x00, 0x0A, 0xEC, 0x40, 0x41, 0x14, 0xC0, 0x08, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0x42, 0x25, 0x32, 0xEC, 0x60, 0xEC, 0x11, 0xC6, 0x04, 0x1A, 0x1C, 0x23, 0x34, 0x35, 0xE3, 0x19,
+    0xB7, 0x0D, 0xEB, 0xA1, 0xEC, 0x51, 0xEC, 0x67, 0xEC, 0x67, 0x42, 0x23, 0x40, 0xEC, 0x7A, 0xD0,
+    0x65, 0x41, 0x21, 0x54, 0xED, 0x21, 0x49, 0x04, 0x21, 0x38, 0x03, 0x42, 0x23, 0x31, 0xA6, 0xB4,
+    0xEB, 0x36, 0x41, 0x10, 0xA0, 0x1C, 0x21, 0x31, 0x04, 0x41, 0x40, 0xEB, 0x21, 0x21, 0x33, 0x04,
+    0x42, 0x01, 0x21, 0xCC, 0xBB, 0xEB, 0x90, 0x21, 0x40, 0x07, 0x42, 0x22, 0x23, 0x9B, 0xC8, 0x00,
+    0x03, 0x21, 0x32, 0x07, 0x41, 0x0A, 0x56, 0x9B, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0x41, 0x10,
+    0xC8, 0x9B, 0x21, 0x29, 0x04, 0x21, 0x23, 0x03, 0x21, 0x28, 0x03, 0xA3, 0x01, 0x1B, 0x40, 0x1A,
+    0x10, 0x03, 0x21, 0x4C, 0x07, 0x21, 0x23, 0x03, 0x21, 0x15, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x32,
+    0x03, 0x41, 0x27, 0xEA, 0xE3, 0xCE, 0x04, 0x10, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x23, 0x25,
+    0x28, 0x40, 0x41, 0x43, 0x00, 0x5D, 0xEC, 0x8A, 0xD7, 0xD3, 0xC7, 0x7F, 0xD2, 0x61, 0x00, 0x5A,
+    0xEC, 0x87, 0xCE, 0x15, 0x00, 0x4F, 0x00, 0x48, 0x00, 0x07, 0x00, 0x04, 0x09, 0xC1, 0xEA, 0xB4,
+    0xC2, 0x34, 0x35, 0x00, 0x2B, 0xED, 0x10, 0x43, 0x34, 0x35, 0x42, 0xED, 0x17, 0xED, 0x17, 0xD3,
+    0x54, 0xC1, 0x32, 0xEA, 0x09, 0xC4, 0x14, 0x19, 0x40, 0x44, 0xEC, 0xC7, 0x00, 0x04, 0x91, 0xA8,
+    0x60, 0x8B, 0xC1, 0x21, 0xAC, 0x44, 0x44, 0x13, 0x19, 0x32, 0x34, 0xED, 0x36, 0xE9, 0xCB, 0x00,
+    0x04, 0xEA, 0x28, 0x41, 0x33, 0x98, 0xBA, 0x21, 0x49, 0x04, 0xC3, 0x17, 0x19, 0x44, 0xEC, 0x3E,
+    0x00, 0x03, 0xD7, 0xD4, 0x42, 0x32, 0x35, 0x00, 0x0A, 0xD4, 0xCA, 0x46, 0x01, 0x02, 0x19, 0x1A,
+    0x23, 0x27, 0x84, 0x4E, 0x00, 0x07, 0xA2, 0xD4, 0xEC, 0xD6, 0xEB, 0x0F, 0xD2, 0xD0, 0xC1, 0x2A,
+    0x50, 0xF2, 0xD2, 0x01, 0x0F, 0x10, 0x14, 0x15, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x20, 0x21, 0x23,
+    0x27, 0x29, 0x40, 0x42, 0x48, 0x01, 0x15, 0xED, 0x17, 0xED, 0x17, 0x01, 0x12, 0x01, 0x0B, 0x00,
+    0xF8, 0x54, 0x23, 0x54, 0x20, 0xED, 0x72, 0xED, 0x0C, 0x92, 0x0C, 0x00, 0x62, 0x00, 0x5B, 0x00,
+    0x4D, 0x00, 0x3C, 0x00, 0x17, 0xD0, 0xBA, 0x00, 0x04, 0x4E, 0x04, 0x13, 0x1E, 0x21, 0x22, 0x23,
+    0x24, 0x27, 0x31, 0x32, 0x34, 0x35, 0x38, 0x39, 0x04, 0x60, 0xC5, 0xF7, 0xED, 0xA9, 0x04, 0x4F,
+    0x04, 0x37, 0x04, 0x09, 0x03, 0xE8, 0x03, 0xC0, 0x03, 0x57, 0x02, 0x2E, 0x01, 0xBD, 0x01, 0x9E,
+    0x01, 0x69, 0x00, 0x37, 0x42, 0x0E, 0x25, 0xED, 0xD4, 0xED, 0xD4, 0xC3, 0x23, 0x2A, 0x38, 0xEB,
+    0xC5, 0xED, 0xDB, 0x00, 0x07, 0x41, 0x0E, 0xED, 0xE5, 0x21, 0x38, 0x04, 0x41, 0x23, 0xD2, 0x80,
+    0xC2, 0x17, 0x27, 0xBA, 0xD5, 0x00, 0x04, 0x21, 0x25, 0x07, 0x41, 0x23, 0xED, 0x3F, 0x21, 0x01,
+    0x04, 0x23, 0x01, 0x04, 0x42, 0x18, 0x0A, 0x03, 0xC1, 0x23, 0xEA, 0xD5, 0x47, 0x01, 0x19, 0x1B,
+    0x25, 0x32, 0x34, 0x4C, 0xEE, 0x0C, 0xEA, 0xA1, 0xEE, 0x0C, 0xEE, 0x0C, 0x00, 0x04, 0xED, 0xC6,
+    0xEE, 0x0C, 0xC3, 0x01, 0x1E, 0x23, 0xEC, 0xEA, 0x58, 0x49, 0xCF, 0x52, 0x41, 0x11, 0x0F, 0xE7,
+    0x23, 0x11, 0x35, 0x40, 0x24, 0x0E, 0x04, 0x41, 0x17, 0xE0, 0xD7, 0xC7, 0x14, 0x22, 0x25, 0x32,
+    0x35, 0x40, 0x41, 0xE7, 0x4D, 0xE6, 0x94, 0x7B, 0x74, 0xED, 0x80, 0xEE, 0x3B, 0x00, 0x04, 0xBD,
+    0xAC, 0x41, 0x31, 0x32, 0xC1, 0xA1, 0x20, 0x04, 0x41, 0x32, 0xCE, 0xCF, 0x21, 0x2B, 0x04, 0xA1,
+    0x21, 0x03, 0x22, 0x01, 0x34, 0x0D, 0x03, 0x42, 0x30, 0x35, 0xEE, 0x67, 0xD8, 0xEA, 0x21, 0x19,
+    0x07, 0x41, 0x24, 0xDD, 0xBD, 0xC1, 0x0E, 0xEE, 0x17, 0xC8, 0x01, 0x15, 0x1B, 0x1E, 0x23, 0x2A,
+    0x40, 0x42, 0x81, 0x04, 0x00, 0x08, 0x00, 0x04, 0xAB, 0xF3, 0x70, 0x65, 0xEE, 0x33, 0x29, 0x6B,
+    0x58, 0x9C, 0x21, 0x38, 0x19, 0x42, 0x23, 0x4C, 0x7C, 0xBD, 0xEE, 0x95, 0xC2, 0x32, 0x34, 0xC5,
+    0x9F, 0xEE, 0x56, 0xC1, 0x27, 0xED, 0xDD, 0x21, 0x2A, 0x04, 0x42, 0x21, 0x25, 0xED, 0x32, 0xEE,
+    0x44, 0x41, 0x27, 0xCA, 0x61, 0xA1, 0x2D, 0x04, 0xC7, 0x0A, 0x18, 0x28, 0x2A, 0x40, 0x42, 0x4C,
+    0xC9, 0xD8, 0xD3, 0xC4, 0xDC, 0x9A, 0x99, 0x3E, 0xCF, 0xBA, 0xD4, 0xF5, 0x00, 0x03, 0x21, 0x22,
+    0x16, 0xC4, 0x0A, 0x0D, 0x29, 0x2A, 0xEE, 0xD1, 0xEE, 0xD1, 0x00, 0x03, 0xED, 0x99, 0xC1, 0x2A,
+    0xED, 0xA6, 0x41, 0x17, 0x10, 0x9D, 0xC8, 0x15, 0x17, 0x2A, 0x31, 0x34, 0x38, 0x39, 0x40, 0x00,
+    0x51, 0x00, 0x4A, 0xED, 0xA8, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x15, 0x00, 0x08, 0x00, 0x04, 0x41,
+    0x07, 0xED, 0xC4, 0x42, 0x31, 0x32, 0x00, 0x04, 0xEF, 0x02, 0xC4, 0x09, 0x30, 0x32, 0x35, 0xEE,
+    0x52, 0xEF, 0x0A, 0xEF, 0x0A, 0xEF, 0x0A, 0x42, 0x23, 0x40, 0x00, 0x0D, 0xD3, 0x02, 0x42, 0x02,
+    0x23, 0xEF, 0x1E, 0xEF, 0x1E, 0x22, 0x38, 0x39, 0x0E, 0x07, 0x42, 0x31, 0x32, 0xEE, 0x6F, 0xEB,
+    0xF7, 0xC6, 0x01, 0x18, 0x1A, 0x20, 0x30, 0x4C, 0xD4, 0x3D, 0xD4, 0x3D, 0xEE, 0x79, 0x00, 0x07,
+    0xEF, 0x31, 0xEF, 0x31, 0xC3, 0x19, 0x1C, 0x32, 0x57, 0xC2, 0xEE, 0xE6, 0xEF, 0x44, 0xC1, 0x17,
+    0xEF, 0x4E, 0x21, 0x32, 0x04, 0x45, 0x04, 0x15, 0x17, 0x22, 0x29, 0x00, 0x11, 0xEE, 0x9A, 0xEF,
+    0x1C, 0x00, 0x03, 0xEF, 0x55, 0x42, 0x08, 0x22, 0xEF, 0x65, 0xD1, 0x76, 0x41, 0x08, 0xDA, 0xA6,
+    0xCA, 0x01, 0x04, 0x11, 0x13, 0x14, 0x23, 0x2A, 0x34, 0x35, 0x38, 0xEC, 0x62, 0xEF, 0x0A, 0xEF,
+    0x5D, 0x00, 0x3F, 0xEF, 0x6F, 0x00, 0x1B, 0xEC, 0xF3, 0x00, 0x0B, 0x00, 0x04, 0x9F, 0x08, 0x41,
+    0x22, 0x8D, 0x7F, 0x21, 0x32, 0x04, 0x41, 0x34, 0xEF, 0x50, 0xC5, 0x17, 0x22, 0x23, 0x27, 0x28,
+    0x00, 0x07, 0xEF, 0x7E, 0xC7, 0xB5, 0xEE, 0x98, 0x00, 0x04, 0xC2, 0x01, 0x22, 0xEF, 0xAA, 0xEF,
+    0x91, 0x41, 0x38, 0xC0, 0x39, 0x47, 0x04, 0x08, 0x14, 0x15, 0x17, 0x18, 0x29, 0x00, 0x1B, 0x9B,
+    0x1F, 0xEF, 0xB4, 0x00, 0x0B, 0x00, 0x04, 0xEC, 0xD1, 0xEF, 0x4F, 0x41, 0x31, 0xB3, 0x35, 0x41,
+    0x21, 0xBE, 0x90, 0x21, 0x30, 0x04, 0xC2, 0x32, 0x39, 0xEF, 0xD6, 0xEF, 0xD6, 0x41, 0x2A, 0xEF,
+    0x22, 0x46, 0x01, 0x0B, 0x19, 0x22, 0x27, 0x44, 0xEF, 0xE1, 0xEF, 0x8C, 0xEF, 0xE1, 0x00, 0x0B,
+    0xEF, 0xE1, 0x00, 0x04, 0x42, 0x2D, 0x32, 0xE5, 0x00, 0xEF, 0xBB, 0xCF, 0x17, 0x19, 0x1E, 0x20,
+    0x23, 0x25, 0x27, 0x30, 0x31, 0x32, 0x34, 0x37, 0x42, 0x48, 0x49, 0xD5, 0x8D, 0xEF, 0xFB, 0x6C,
+    0x32, 0x50, 0xA9, 0x00, 0x30, 0x00, 0x28, 0xEF, 0xFA, 0xEF, 0xFB, 0xEF, 0xFA, 0x00, 0x1A, 0xCA,
+    0x25, 0xEB, 0xA9, 0xDD, 0x11, 0x00, 0x07, 0xEA, 0x4C, 0xC3, 0x25, 0x27, 0x44, 0xE8, 0x04, 0xEF,
+    0xD7, 0xD0, 0x87, 0x41, 0x32, 0xCB, 0xE3, 0xC3, 0x0A, 0x2A, 0x2D, 0xEF, 0xFE, 0xEE, 0xFF, 0x00,
+    0x04, 0x44, 0x01, 0x19, 0x22, 0x25, 0x93, 0xAA, 0xF0, 0x41, 0x00, 0x18, 0x00, 0x0A, 0x42, 0x32,
+    0x34, 0xF0, 0x08, 0xF0, 0x4E, 0x42, 0x06, 0x13, 0xF0, 0x55, 0xED, 0x22, 0x43, 0x13, 0x23, 0x2A,
+    0xED, 0x29, 0x00, 0x07, 0xED, 0x29, 0xC3, 0x20, 0x42, 0x4C, 0xD4, 0xE3, 0xC1, 0xA1, 0xF0, 0x66,
+    0x21, 0x15, 0x0A, 0x41, 0x23, 0xBB, 0x15, 0x21, 0x08, 0x04, 0x47, 0x04, 0x13, 0x15, 0x19, 0x22,
+    0x25, 0x28, 0xBE, 0x7D, 0xDB, 0x9B, 0xF0, 0x7A, 0x00, 0x0A, 0xDE, 0xD9, 0xF0, 0x7A, 0x00, 0x03,
+    0x41, 0x18, 0xDF, 0xD2, 0x21, 0x32, 0x04, 0x21, 0x13, 0x03, 0x21, 0x38, 0x03, 0x42, 0x23, 0x32,
+    0x00, 0x03, 0x6A, 0x28, 0xC1, 0x30, 0xD5, 0x1D, 0x43, 0x19, 0x31, 0x32, 0x00, 0x04, 0xEF, 0xED,
+    0xCB, 0xCC, 0xC1, 0x2B, 0xC8, 0x68, 0x21, 0x01, 0x04, 0x21, 0x47, 0x03, 0x21, 0x25, 0x03, 0x42,
+    0x40, 0x44, 0x00, 0x03, 0xD1, 0x1D, 0x41, 0x23, 0x1F, 0x88, 0x44, 0x04, 0x2A, 0x32, 0x34, 0x00,
+    0x04, 0xED, 0x5F, 0xDD, 0xE0, 0xF0, 0x6C, 0x41, 0x28, 0xDE, 0x6F, 0x42, 0x1E, 0x38, 0xD3, 0xDA,
+    0x00, 0x04, 0x41, 0x12, 0xD5, 0x76, 0x43, 0x19, 0x23, 0x24, 0xF0, 0xE6, 0xE7, 0x6E, 0x00, 0x04,
+    0x41, 0x01, 0x03, 0x07, 0x21, 0x07, 0x04, 0x42, 0x32, 0x38, 0xF0, 0xBE, 0xDE, 0x0D, 0x43, 0x07,
+    0x23, 0x34, 0xA5, 0x37, 0xD1, 0xFC, 0x8A, 0x81, 0x44, 0x14, 0x21, 0x32, 0x34, 0xEA, 0x1A, 0xAF,
+    0x81, 0x1D, 0xA9, 0xF0, 0xCF, 0x41, 0x04, 0xEE, 0xA7, 0x21, 0x07, 0x04, 0x42, 0x07, 0x34, 0xB3,
+    0x76, 0x00, 0x03, 0x41, 0x23, 0x5B, 0x0A, 0x43, 0x08, 0x14, 0x1B, 0xF1, 0x27, 0xF1, 0x27, 0x00,
+    0x04, 0x42, 0x33, 0x38, 0x7E, 0xF1, 0x00, 0x0A, 0x42, 0x17, 0x21, 0xEE, 0x05, 0xBF, 0x3B, 0x42,
+    0x0A, 0x16, 0xF0, 0x84, 0xF0, 0xAE, 0xD6, 0x01, 0x08, 0x0A, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A,
+    0x1E, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2D, 0x40, 0x44, 0x00, 0xA9, 0xF0,
+    0xFA, 0x00, 0x9E, 0x00, 0x87, 0x5B, 0x41, 0xC0, 0x85, 0x5C, 0x41, 0x00, 0x7C, 0x00, 0x6B, 0x00,
+    0x60, 0x5F, 0x48, 0x00, 0x52, 0x00, 0x4F, 0xC9, 0x61, 0xC1, 0xA5, 0x00, 0x48, 0xD6, 0xC2, 0x00,
+    0x3E, 0x00, 0x2A, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x07, 0xC9, 0x07, 0x14, 0x17, 0x18, 0x19, 0x1A,
+    0x21, 0x28, 0x29, 0xB3, 0xE3, 0xF1, 0x2B, 0x4A, 0x45, 0xF1, 0x43, 0xD1, 0x53, 0xF1, 0x89, 0xF1,
+    0x23, 0x3A, 0xBC, 0xE1, 0xAF, 0x41, 0x23, 0xBC, 0x4B, 0x49, 0x01, 0x20, 0x23, 0x31, 0x32, 0x34,
+    0x36, 0x38, 0x39, 0xD6, 0xB5, 0x9C, 0x6B, 0x01, 0x4D, 0x01, 0x2F, 0x00, 0x63, 0x00, 0x20, 0xE1,
+    0x4E, 0x00, 0x04, 0xF1, 0xA9, 0x41, 0x23, 0xBD, 0xEB, 0x41, 0x2D, 0xD4, 0x76, 0x21, 0x40, 0x04,
+    0x21, 0x34, 0x03, 0x41, 0x31, 0x94, 0x92, 0x21, 0x25, 0x04, 0x21, 0x1A, 0x03, 0x21, 0x4C, 0x03,
+    0x42, 0x25, 0x40, 0x53, 0x5B, 0xB8, 0x9A, 0x21, 0x01, 0x07, 0xA4, 0x04, 0x0B, 0x15, 0x42, 0x25,
+    0x1A, 0x0D, 0x03, 0x41, 0x49, 0xEB, 0xD4, 0xA1, 0x21, 0x04, 0x41, 0x2D, 0xAB, 0x67, 0x21, 0x21,
+    0x04, 0x21, 0x40, 0x03, 0x21, 0x01, 0x03, 0x41, 0x25, 0xD0, 0xBB, 0x21, 0x42, 0x04, 0x21, 0x25,
+    0x03, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x41, 0x25, 0xAF, 0xA8, 0x21, 0x40,
+    0x04, 0x21, 0x1B, 0x03, 0x22, 0x21, 0x40, 0x0D, 0x03, 0x43, 0x32, 0x42, 0x4C, 0xF0, 0xB1, 0x00,
+    0x25, 0x00, 0x05, 0x41, 0x02, 0xF1, 0xA2, 0xC3, 0x15, 0x34, 0x44, 0x00, 0x0E, 0xB8, 0x84, 0x00,
+    0x04, 0xC3, 0x22, 0x40, 0x41, 0xF1, 0xDB, 0xE1, 0xE6, 0xE8, 0x61, 0x42, 0x0A, 0x15, 0x9E, 0xA8,
+    0xD2, 0x26, 0x21, 0x40, 0x07, 0x41, 0x01, 0xD1, 0x09, 0x43, 0x1F, 0x21, 0x41, 0xD0, 0xE0, 0xEC,
+    0xA7, 0x00, 0x04, 0x22, 0x34, 0x4C, 0x11, 0x0A, 0x41, 0x40, 0x2D, 0x46, 0x21, 0x14, 0x04, 0x44,
+    0x15, 0x25, 0x40, 0x42, 0xF2, 0x09, 0xF2, 0x53, 0x00, 0x03, 0xD0, 0xB7, 0x42, 0x01, 0x04, 0xF2,
+    0x7C, 0x5A, 0x33, 0x21, 0x42, 0x07, 0x41, 0x0B, 0xDF, 0xC0, 0xC2, 0x40, 0x44, 0x8E, 0x1A, 0x00,
+    0x04, 0x21, 0x4C, 0x07, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0x41, 0x44, 0xEF,
+    0x8F, 0x21, 0x23, 0x04, 0xCF, 0x04, 0x07, 0x0B, 0x0D, 0x14, 0x17, 0x19, 0x1A, 0x21, 0x23, 0x25,
+    0x2A, 0x2B, 0x40, 0x42, 0xD7, 0x3C, 0x00, 0xBA, 0xF2, 0x4F, 0xF2, 0xA4, 0x00, 0xAD, 0xD4, 0x7E,
+    0x00, 0x6D, 0x71, 0x9F, 0x00, 0x63, 0x00, 0x41, 0x00, 0x35, 0x00, 0x21, 0x31, 0x04, 0x00, 0x0A,
+    0x00, 0x03, 0x41, 0x23, 0xC7, 0x35, 0x21, 0x42, 0x04, 0x47, 0x23, 0x25, 0x2D, 0x30, 0x32, 0x39,
+    0x48, 0xC0, 0xE7, 0xC3, 0xDC, 0xF2, 0xD8, 0x00, 0x03, 0xF2, 0xD9, 0xF2, 0x8A, 0xF1, 0xCD, 0x43,
+    0x27, 0x32, 0x48, 0xED, 0xC4, 0xF0, 0xE0, 0xEB, 0x0D, 0x42, 0x30, 0x48, 0xF2, 0xF9, 0xF2, 0x93,
+    0x42, 0x19, 0x48, 0xF3, 0x00, 0xF1, 0xFB, 0x41, 0x07, 0x2F, 0xA8, 0x21, 0x30, 0x04, 0x21, 0x21,
+    0x03, 0x21, 0x21, 0x03, 0x22, 0x31, 0x38, 0x14, 0x03, 0x43, 0x31, 0x32, 0x48, 0xF3, 0x18, 0xF3,
+    0x0F, 0xF2, 0xBE, 0x43, 0x31, 0x32, 0x39, 0xF2, 0xEA, 0xF3, 0x23, 0xF3, 0x22, 0x41, 0x30, 0xF1,
+    0x7B, 0xC2, 0x14, 0x2B, 0xF3, 0x31, 0x00, 0x04, 0x41, 0x4B, 0xF2, 0xFF, 0x48, 0x2D, 0x30, 0x32,
+    0x35, 0x36, 0x37, 0x39, 0x49, 0xF2, 0x81, 0x89, 0x51, 0x00, 0x0B, 0xF3, 0x3C, 0xEE, 0xB2, 0x00,
+    0x04, 0xF1, 0x2D, 0xF2, 0x30, 0x42, 0x32, 0x34, 0xF2, 0x50, 0xEB, 0x5A, 0x42, 0x32, 0x34, 0xF3,
+    0x52, 0xF3, 0x52, 0x42, 0x23, 0x48, 0x00, 0x07, 0xF2, 0x57, 0x43, 0x23, 0x25, 0x39, 0xD7, 0x58,
+    0xE5, 0x89, 0xF3, 0x1B, 0x41, 0x1E, 0xE6, 0x47, 0x21, 0x21, 0x04, 0x21, 0x34, 0x03, 0xA1, 0x2B,
+    0x03, 0x21, 0x07, 0x03, 0x42, 0x27, 0x32, 0x00, 0x03, 0xF2, 0x7F, 0x44, 0x35, 0x37, 0x38, 0x48,
+    0xF2, 0xFA, 0xEF, 0x39, 0xF3, 0x3C, 0x00, 0x07, 0x44, 0x30, 0x34, 0x37, 0x38, 0xF3, 0x98, 0xF3,
+    0x49, 0xF3, 0x5F, 0xF1, 0x89, 0x41, 0x01, 0x7B, 0x90, 0x41, 0x2D, 0x5C, 0x15, 0x21, 0x23, 0x04,
+    0xC2, 0x19, 0x48, 0xF3, 0xB0, 0xF1, 0xA1, 0x46, 0x30, 0x32, 0x33, 0x34, 0x37, 0x38, 0x00, 0x12,
+    0x00, 0x0A, 0xF3, 0xB7, 0x00, 0x07, 0xEF, 0x65, 0xF2, 0x95, 0x41, 0x21, 0xF3, 0x78, 0x21, 0x2B,
+    0x04, 0x46, 0x25, 0x27, 0x30, 0x31, 0x32, 0x34, 0xE2, 0xF1, 0xF3, 0x82, 0x00, 0x03, 0xF3, 0x73,
+    0xF3, 0x82, 0xEF, 0x47, 0x41, 0x01, 0xB7, 0x55, 0x21, 0x01, 0x04, 0x21, 0x2D, 0x03, 0x42, 0x2B,
+    0x37, 0xA1, 0x18, 0xC0, 0x14, 0x42, 0x2D, 0x35, 0xF3, 0xF5, 0xF3, 0x3A, 0x48, 0x01, 0x02, 0x14,
+    0x1F, 0x21, 0x23, 0x2A, 0x2B, 0xF1, 0xAC, 0xF1, 0xB0, 0x00, 0x0E, 0xF2, 0xEC, 0x00, 0x07, 0xDC,
+    0x0C, 0xDC, 0x0C, 0xAB, 0x63, 0x46, 0x02, 0x15, 0x1E, 0x1F, 0x21, 0x27, 0xEF, 0xC3, 0xF4, 0x14,
+    0xF3, 0xDC, 0xF3, 0xDC, 0xF4, 0x15, 0xEF, 0x1C, 0x42, 0x23, 0x27, 0xF4, 0x1E, 0xF3, 0xA9, 0xD8,
+    0x01, 0x02, 0x04, 0x07, 0x0B, 0x14, 0x15, 0x19, 0x1B, 0x1D, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27,
+    0x2A, 0x2B, 0x2D, 0x2E, 0x40, 0x41, 0x42, 0x44, 0x01, 0x56, 0x01, 0x40, 0x01, 0x36, 0x01, 0x1B,
+    0x01, 0x16, 0x01, 0x0C, 0x00, 0xF3, 0x00, 0xDA, 0x00, 0xCC, 0xC0, 0x55, 0x00, 0xC5, 0x00, 0xA4,
+    0xE8, 0x9D, 0x00, 0x97, 0x00, 0x78, 0xF2, 0xF7, 0xF2, 0x0C, 0x00, 0x5E, 0xBF, 0xD8, 0x00, 0x44,
+    0x00, 0x33, 0x00, 0x1A, 0x00, 0x07, 0xDE, 0xB9, 0xC1, 0x2A, 0xF3, 0x76, 0x21, 0x30, 0x04, 0x42,
+    0x30, 0x34, 0xF4, 0x7F, 0xE2, 0xDE, 0x42, 0x01, 0x30, 0xF1, 0x1B, 0xF4, 0x86, 0xC5, 0x01, 0x02,
+    0x0F, 0x21, 0x44, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x07, 0xF4, 0x89, 0xCB, 0x5E, 0x41, 0x28, 0x68,
+    0x42, 0x21, 0x17, 0x04, 0x21, 0x40, 0x03, 0x42, 0x30, 0x38, 0xF4, 0xA7, 0x00, 0x03, 0xC1, 0x22,
+    0xF4, 0xAD, 0x21, 0x32, 0x04, 0xA2, 0x04, 0x19, 0x0E, 0x03, 0x41, 0x27, 0x7B, 0xFE, 0x43, 0x07,
+    0x23, 0x38, 0xF4, 0xBE, 0xF4, 0xBE, 0xF4, 0xBE, 0x42, 0x30, 0x32, 0x47, 0x96, 0xD9, 0x60, 0x43,
+    0x25, 0x38, 0x48, 0x00, 0x07, 0xF4, 0x80, 0xF4, 0x69, 0x41, 0x23, 0xAF, 0x5E, 0x21, 0x34, 0x04,
+    0xC4, 0x27, 0x30, 0x32, 0x35, 0x00, 0x03, 0xF4, 0xE0, 0xF4, 0xE0, 0xF4, 0xE0, 0x44, 0x01, 0x04,
+    0x15, 0x2A, 0x00, 0x2F, 0x00, 0x1E, 0xF4, 0x92, 0x00, 0x0D, 0xC1, 0x23, 0xCD, 0x15, 0x42, 0x30,
+    0x38, 0xF4, 0xFE, 0x00, 0x04, 0x43, 0x30, 0x34, 0x35, 0xF5, 0x05, 0xDF, 0x88, 0xF5, 0x05, 0xC2,
+    0x0A, 0x19, 0xD0, 0x2F, 0xF2, 0x2B, 0x43, 0x23, 0x30, 0x32, 0x00, 0x11, 0xF5, 0x16, 0x00, 0x07,
+    0x22, 0x08, 0x09, 0x22, 0x0A, 0x41, 0x23, 0xE5, 0xB8, 0x21, 0x32, 0x04, 0xC3, 0x22, 0x27, 0x32,
+    0xEB, 0xDE, 0xD9, 0xA9, 0xF5, 0x2C, 0x21, 0x21, 0x0A, 0xA1, 0x34, 0x03, 0xC3, 0x0A, 0x0C, 0x13,
+    0x00, 0x13, 0x00, 0x03, 0x11, 0x78, 0x41, 0x04, 0x20, 0xCB, 0x42, 0x01, 0x32, 0xF5, 0x4A, 0x00,
+    0x04, 0x42, 0x35, 0x38, 0xF5, 0x0B, 0xF5, 0x51, 0x22, 0x08, 0x0A, 0x0E, 0x07, 0x41, 0x10, 0xF1,
+    0xF2, 0xC2, 0x28, 0x32, 0x58, 0x52, 0xF5, 0x61, 0xC2, 0x19, 0x38, 0x00, 0x07, 0xF5, 0x67, 0x21,
+    0x11, 0x07, 0xC2, 0x08, 0x2B, 0xEE, 0x84, 0xC1, 0xE9, 0x42, 0x07, 0x38, 0xE2, 0xB3, 0x98, 0x38,
+    0x42, 0x01, 0x25, 0xF5, 0x80, 0x00, 0x07, 0x42, 0x22, 0x23, 0x30, 0x08, 0xF5, 0x87, 0x43, 0x15,
+    0x16, 0x2A, 0x30, 0x0F, 0x00, 0x0E, 0x00, 0x07, 0x43, 0x30, 0x32, 0x35, 0xF5, 0x98, 0xF5, 0x98,
+    0xE0, 0x1B, 0x42, 0x19, 0x22, 0x00, 0x0A, 0xF2, 0x37, 0xC2, 0x28, 0x32, 0xD5, 0xDF, 0xF5, 0xA9,
+    0xC3, 0x10, 0x21, 0x31, 0xF5, 0x55, 0x00, 0x07, 0xBD, 0x12, 0x21, 0x22, 0x0A, 0x42, 0x25, 0x39,
+    0xF5, 0x57, 0xF5, 0xBD, 0x42, 0x17, 0x2A, 0xF5, 0x3F, 0xF5, 0x5E, 0x41, 0x01, 0xF4, 0xC6, 0x41,
+    0x23, 0x03, 0x67, 0xCB, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1B, 0x2A, 0x40, 0x41, 0x42, 0x44, 0xF5,
+    0x0D, 0xF5, 0x6D, 0xF2, 0x68, 0x06, 0x3D, 0xF5, 0xD2, 0x00, 0x16, 0xF5, 0xB7, 0x00, 0x0F, 0x00,
+    0x08, 0x00, 0x04, 0xBB, 0x63, 0xC1, 0x25, 0xC6, 0x54, 0x42, 0x34, 0x35, 0xE0, 0x83, 0xE0, 0x83,
+    0x41, 0x14, 0xD8, 0x0D, 0x21, 0x40, 0x04, 0x21, 0x35, 0x03, 0xA1, 0x21, 0x03, 0x21, 0x34, 0x03,
+    0x44, 0x01, 0x14, 0x15, 0x25, 0xF6, 0x10, 0x00, 0x17, 0x00, 0x03, 0x01, 0x91, 0xC3, 0x0B, 0x21,
+    0x40, 0xF5, 0x14, 0xED, 0xFC, 0xE5, 0xC2, 0x42, 0x01, 0x38, 0xF6, 0x27, 0xF6, 0x27, 0x41, 0x4A,
+    0xE3, 0x10, 0x21, 0x01, 0x04, 0xA1, 0x41, 0x03, 0x21, 0x14, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23,
+    0x03, 0x21, 0x32, 0x03, 0x42, 0x32, 0x34, 0xF6, 0x44, 0xF5, 0xF5, 0x41, 0x01, 0xF3, 0x3D, 0x41,
+    0x44, 0x8E, 0xD9, 0x21, 0x04, 0x04, 0x49, 0x14, 0x15, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x41, 0x42,
+    0x00, 0x2F, 0x00, 0x15, 0xD8, 0xBC, 0x00, 0x12, 0xAB, 0x08, 0xDB, 0xE8, 0xF3, 0x72, 0x00, 0x0B,
+    0x00, 0x03, 0xC2, 0x04, 0x21, 0xC5, 0x33, 0xF5, 0xAC, 0xC3, 0x04, 0x2A, 0x43, 0xF6, 0x6F, 0xDC,
+    0x0B, 0xF4, 0x48, 0xC1, 0x2A, 0xF4, 0x06, 0x23, 0x07, 0x19, 0x27, 0x15, 0x0E, 0x04, 0x41, 0x48,
+    0xF3, 0x23, 0x21, 0x25, 0x04, 0x21, 0x22, 0x03, 0x58, 0x01, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0D,
+    0x0F, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x21, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x48, 0x49,
+    0x4A, 0x02, 0x0B, 0x01, 0xE3, 0x01, 0xDE, 0x01, 0xAB, 0x01, 0x78, 0x01, 0x5C, 0x01, 0x40, 0x01,
+    0x3B, 0x01, 0x29, 0x01, 0x26, 0x01, 0x0A, 0x00, 0xF6, 0x00, 0xDE, 0x00, 0xC5, 0xD1, 0x04, 0x4D,
+    0x40, 0x00, 0xA3, 0x00, 0x88, 0x00, 0x7B, 0xE4, 0xCE, 0x00, 0x42, 0x00, 0x11, 0xB1, 0x2E, 0x00,
+    0x03, 0xC3, 0x01, 0x21, 0x27, 0xD5, 0x44, 0xF4, 0xB7, 0xF4, 0x51, 0x42, 0x2A, 0x34, 0x07, 0x55,
+    0xF6, 0xB2, 0x41, 0x39, 0xD3, 0xDA, 0xC2, 0x1A, 0x30, 0x00, 0x04, 0xF6, 0xF6, 0x41, 0x4C, 0xE5,
+    0x5C, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x42, 0x1E, 0x27, 0xF7, 0x07, 0xB7, 0xF7, 0x41, 0x2A,
+    0xF6, 0xB0, 0x21, 0x40, 0x04, 0x21, 0x27, 0x03, 0x21, 0x31, 0x03, 0x41, 0x2A, 0xF6, 0x22, 0x21,
+    0x31, 0x04, 0xC2, 0x01, 0x21, 0x00, 0x03, 0xF7, 0x22, 0xC5, 0x21, 0x23, 0x2D, 0x32, 0x39, 0x00,
+    0x11, 0xF1, 0xFE, 0x65, 0xC5, 0x00, 0x07, 0xF6, 0xC0, 0xC1, 0x2A, 0xEB, 0x62, 0xC3, 0x01, 0x10,
+    0x32, 0xF6, 0x05, 0xF6, 0xE2, 0x00, 0x04, 0x41, 0x2B, 0x2E, 0x97, 0x21, 0x44, 0x04, 0xC2, 0x19,
+    0x21, 0x24, 0x7F, 0x00, 0x03, 0x41, 0x01, 0xE5, 0xA6, 0x42, 0x07, 0x32, 0xE4, 0x93, 0xDA, 0xA1,
+    0x42, 0x30, 0x32, 0xF7, 0x60, 0xAD, 0x20, 0xC6, 0x04, 0x08, 0x20, 0x23, 0x25, 0x40, 0xEE, 0x19,
+    0xA2, 0xD1, 0xBE, 0x8D, 0x00, 0x0E, 0x00, 0x07, 0xDB, 0x52, 0x48, 0x07, 0x23, 0x24, 0x31, 0x32,
+    0x34, 0x35, 0x38, 0xE4, 0xB4, 0x00, 0x3D, 0xC8, 0x02, 0x36, 0x69, 0x00, 0x2C, 0x00, 0x25, 0xF7,
+    0x7A, 0x00, 0x13, 0xC1, 0x32, 0xB9, 0x45, 0x42, 0x23, 0x2A, 0xF7, 0x97, 0xF7, 0x51, 0x21, 0x38,
+    0x07, 0x42, 0x01, 0x21, 0xF6, 0x98, 0xF7, 0x3B, 0xC1, 0x22, 0xE5, 0xD4, 0x21, 0x29, 0x04, 0xC7,
+    0x1E, 0x30, 0x31, 0x32, 0x34, 0x35, 0x38, 0xF7, 0xAF, 0xF7, 0xAF, 0x56, 0xD7, 0x00, 0x0E, 0xF4,
+    0xA1, 0xF7, 0xAF, 0x00, 0x03, 0x41, 0x1E, 0xE1, 0xA2, 0x21, 0x32, 0x04, 0x41, 0x04, 0xB6, 0x7D,
+    0x21, 0x0D, 0x04, 0xA2, 0x15, 0x38, 0x0A, 0x03, 0x41, 0x39, 0xD9, 0xB2, 0xC2, 0x01, 0x27, 0xDC,
+    0x82, 0xF7, 0x16, 0xC4, 0x14, 0x2D, 0x31, 0x32, 0xF7, 0xC7, 0xF7, 0xE3, 0xF7, 0xD9, 0x00, 0x07,
+    0x41, 0x34, 0xA7, 0x88, 0x41, 0x08, 0xDB, 0x18, 0x41, 0x18, 0xF2, 0x46, 0xC2, 0x15, 0x19, 0xF7,
+    0xFC, 0xF7, 0x96, 0x41, 0x23, 0xD6, 0x8A, 0x42, 0x2D, 0x32, 0x8D, 0x36, 0x00, 0x04, 0xC4, 0x27,
+    0x31, 0x32, 0x40, 0xD9, 0x4F, 0xE4, 0xF0, 0xD6, 0x59, 0x96, 0x51, 0x41, 0x32, 0xBA, 0x75, 0x21,
+    0x23, 0x04, 0x21, 0x01, 0x03, 0x21, 0x34, 0x03, 0x42, 0x34, 0x35, 0xF8, 0x27, 0xF8, 0x28, 0x21,
+    0x19, 0x07, 0x21, 0x34, 0x03, 0x41, 0x0B, 0xB6, 0x50, 0x42, 0x01, 0x04, 0x8F, 0x2C, 0x00, 0x04,
+    0x41, 0x0A, 0xF7, 0xE2, 0x4A, 0x01, 0x04, 0x08, 0x0A, 0x14, 0x15, 0x25, 0x40, 0x41, 0x44, 0x00,
+    0x3D, 0x00, 0x36, 0xDD, 0xD6, 0xF8, 0x44, 0x00, 0x1F, 0x00, 0x12, 0xF8, 0x44, 0x00, 0x0B, 0x00,
+    0x04, 0xBE, 0xF7, 0xCC, 0x04, 0x0A, 0x14, 0x1C, 0x22, 0x28, 0x29, 0x30, 0x32, 0x34, 0x38, 0x4C,
+    0xF8, 0x63, 0x00, 0x73, 0x99, 0xF1, 0x00, 0x6F, 0x09, 0x11, 0xF6, 0xB1, 0xF7, 0xFD, 0xF8, 0x63,
+    0x00, 0x6B, 0x00, 0x67, 0xF5, 0x55, 0x00, 0x1F, 0x41, 0x32, 0x98, 0xCF, 0xC5, 0x01, 0x15, 0x27,
+    0x40, 0x44, 0x00, 0x04, 0xF7, 0xC6, 0xF7, 0xC6, 0xB5, 0x68, 0xD4, 0x96, 0xC1, 0x19, 0x25, 0xCD,
+    0x46, 0x22, 0x31, 0x32, 0x34, 0x35, 0x38, 0xF8, 0x84, 0xF7, 0xE5, 0x00, 0x14, 0xCD, 0x03, 0x00,
+    0x04, 0xF5, 0x92, 0x41, 0x40, 0xF5, 0xA5, 0x21, 0x32, 0x04, 0xC4, 0x01, 0x04, 0x1A, 0x40, 0xF8,
+    0xBA, 0xE3, 0xE3, 0x00, 0x03, 0xBF, 0x0B, 0x42, 0x34, 0x4C, 0xE5, 0xA9, 0xF8, 0xC7, 0x41, 0x4A,
+    0xF8, 0x68, 0x42, 0x34, 0x35, 0xE5, 0xE8, 0xF8, 0xD2, 0x21, 0x15, 0x07, 0x21, 0x2A, 0x03, 0x41,
+    0x22, 0xF8, 0x76, 0x21, 0x35, 0x04, 0x42, 0x32, 0x48, 0xF8, 0xE6, 0x00, 0xCB, 0x21, 0x19, 0x07,
+    0x21, 0x22, 0x03, 0x21, 0x35, 0x03, 0xC2, 0x15, 0x40, 0xF8, 0x90, 0x78, 0x10, 0x46, 0x01, 0x08,
+    0x14, 0x1F, 0x23, 0x25, 0x00, 0x2F, 0x00, 0x21, 0x00, 0x1A, 0xDB, 0x0A, 0x00, 0x0A, 0x00, 0x07,
+    0x41, 0x0D, 0xF8, 0xF4, 0x21, 0x0A, 0x04, 0x43, 0x04, 0x19, 0x1B, 0xF8, 0xD1, 0x00, 0x03, 0xD3,
+    0x1E, 0xD9, 0x01, 0x04, 0x06, 0x07, 0x08, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E,
+    0x20, 0x22, 0x23, 0x25, 0x28, 0x2A, 0x2B, 0x2C, 0x40, 0x41, 0x42, 0x02, 0x40, 0x02, 0x36, 0x02,
+    0x2B, 0xDB, 0x8B, 0x02, 0x1D, 0x02, 0x1A, 0x01, 0xF8, 0x01, 0xA7, 0x01, 0x8E, 0x01, 0x83, 0x01,
+    0x72, 0x01, 0x4E, 0xF9, 0x20, 0x01, 0x49, 0xF8, 0xBB, 0x01, 0x3E, 0x00, 0xBE, 0x00, 0x81, 0xF9,
+    0x21, 0x00, 0x67, 0x00, 0x5A, 0xF9, 0x20, 0x00, 0x24, 0x50, 0x5C, 0x00, 0x0A, 0x41, 0x40, 0xF8,
+    0x5A, 0x41, 0x0D, 0xF8, 0xAB, 0x21, 0x0D, 0x04, 0x42, 0x31, 0x34, 0x00, 0x03, 0xF9, 0x32, 0xC3,
+    0x25, 0x2A, 0x35, 0x78, 0x4A, 0x00, 0x07, 0xF9, 0x7F, 0x41, 0x42, 0xE6, 0x9F, 0x41, 0x34, 0x53,
+    0xB3, 0xC3, 0x0A, 0x17, 0x1A, 0xF6, 0x5A, 0x00, 0x04, 0xF6, 0x79, 0x21, 0x32, 0x0A, 0x21, 0x09,
+    0x03, 0x42, 0x0A, 0x34, 0xDC, 0x07, 0x16, 0x8E, 0x41, 0x25, 0x96, 0x5D, 0x42, 0x22, 0x34, 0xF9,
+    0x90, 0x00, 0x04, 0x45, 0x14, 0x17, 0x21, 0x22, 0x27, 0x00, 0x07, 0xF1, 0x92, 0x2D, 0xD4, 0xB7,
+    0x41, 0xF9, 0xB3, 0xC5, 0x0A, 0x1F, 0x2B, 0x40, 0x44, 0xF4, 0x98, 0x58, 0x9B, 0x99, 0x5F, 0x00,
+    0x10, 0xD9, 0x89, 0x41, 0x30, 0xD6, 0xBB, 0x21, 0x23, 0x04, 0x42, 0x19, 0x38, 0xA1, 0x6C, 0x56,
+    0xA2, 0x41, 0x14, 0xBD, 0x12, 0xC9, 0x1A, 0x1B, 0x1E, 0x20, 0x27, 0x2D, 0x40, 0x41, 0x44, 0x97,
+    0xAE, 0x00, 0x0E, 0xD2, 0xA3, 0xB8, 0xF3, 0xC8, 0x44, 0x00, 0x0B, 0x00, 0x04, 0x74, 0x61, 0xDC,
+    0xDC, 0xC2, 0x23, 0x34, 0x00, 0x1C, 0xFA, 0x01, 0x41, 0x19, 0x20, 0xCB, 0x42, 0x22, 0x38, 0xF9,
+    0xA6, 0x00, 0x04, 0x41, 0x18, 0x6D, 0xC6, 0x41, 0x32, 0x0D, 0x7E, 0x42, 0x23, 0x32, 0xF9, 0xB5,
+    0xFA, 0x1B, 0x41, 0x0B, 0xF8, 0xFD, 0x21, 0x42, 0x04, 0x21, 0x34, 0x03, 0x42, 0x01, 0x15, 0xBC,
+    0x99, 0xDC, 0xD9, 0x21, 0x40, 0x07, 0x42, 0x21, 0x2A, 0xD5, 0x15, 0x00, 0x03, 0x41, 0x23, 0xB8,
+    0x32, 0x21, 0x2D, 0x04, 0x21, 0x19, 0x03, 0x41, 0x42, 0xFA, 0x01, 0x21, 0x14, 0x04, 0x4A, 0x14,
+    0x15, 0x17, 0x19, 0x2A, 0x2D, 0x34, 0x40, 0x42, 0x48, 0x00, 0x37, 0x00, 0x33, 0xFA, 0x32, 0x00,
+    0x25, 0x6D, 0xF3, 0x03, 0x4D, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x03, 0xF9, 0xE8, 0x41, 0x19, 0xDC,
+    0xFD, 0x42, 0x31, 0x32, 0x00, 0x04, 0xF8, 0x40, 0x41, 0x21, 0xF9, 0xC3, 0xC4, 0x01, 0x1A, 0x25,
+    0x40, 0xD5, 0x57, 0xF9, 0x86, 0xDD, 0x7B, 0x00, 0x04, 0x21, 0x34, 0x0D, 0x44, 0x15, 0x25, 0x2D,
+    0x32, 0xE5, 0xC6, 0x00, 0x03, 0xE7, 0x6E, 0xF7, 0x7E, 0x41, 0x35, 0xA6, 0xF3, 0x21, 0x14, 0x04,
+    0x21, 0x35, 0x03, 0xA1, 0x27, 0x03, 0x21, 0x04, 0x03, 0x21, 0x34, 0x03, 0x42, 0x2A, 0x40, 0x00,
+    0x03, 0x93, 0x67, 0x41, 0x21, 0xA8, 0x45, 0x42, 0x19, 0x48, 0x00, 0x04, 0xFA, 0x7E, 0x21, 0x31,
+    0x07, 0x41, 0x1B, 0xD3, 0x86, 0x21, 0x34, 0x04, 0xA1, 0x0B, 0x03, 0x21, 0x2A, 0x03, 0x43, 0x32,
+    0x34, 0x39, 0xFA, 0xCE, 0x00, 0x03, 0xF9, 0x1C, 0xC4, 0x01, 0x0A, 0x0B, 0x40, 0xF9, 0x26, 0x00,
+    0x1A, 0x00, 0x0A, 0xC1, 0x29, 0x41, 0x0B, 0xFA, 0x87, 0x41, 0x0A, 0xFA, 0x58, 0x42, 0x14, 0x22,
+    0xFA, 0x6E, 0xFA, 0xED, 0xC2, 0x02, 0x21, 0x6C, 0xEA, 0xDD, 0xF3, 0x21, 0x07, 0x07, 0xD7, 0x01,
+    0x04, 0x07, 0x08, 0x0A, 0x0D, 0x14, 0x15, 0x16, 0x17, 0x19, 0x22, 0x23, 0x25, 0x27, 0x28, 0x2A,
+    0x40, 0x42, 0x43, 0x44, 0x48, 0x49, 0xD5, 0xD6, 0x01, 0x7F, 0x01, 0x75, 0x01, 0x60, 0x01, 0x5D,
+    0xDE, 0x46, 0x01, 0x3B, 0x00, 0xFD, 0x00, 0xF2, 0x00, 0xEB, 0x00, 0xB0, 0xFA, 0x98, 0x00, 0x8D,
+    0x00, 0x72, 0x00, 0x52, 0xFA, 0xB8, 0x00, 0x26, 0xC1, 0x4F, 0x00, 0x19, 0x00, 0x15, 0x00, 0x11,
+    0x00, 0x03, 0x93, 0x59, 0x42, 0x37, 0x39, 0xC7, 0x6A, 0xFA, 0xC5, 0x41, 0x23, 0xF6, 0x89, 0xC5,
+    0x15, 0x1E, 0x22, 0x2B, 0x42, 0xF1, 0x0F, 0x00, 0x04, 0xED, 0x6E, 0xD3, 0x16, 0x77, 0x39, 0xC3,
+    0x19, 0x1A, 0x32, 0xE4, 0x2F, 0xF9, 0xAA, 0xF9, 0x4C, 0x41, 0x32, 0xC1, 0x31, 0x41, 0x22, 0x9F,
+    0x36, 0x21, 0x35, 0x04, 0x43, 0x14, 0x17, 0x1E, 0x00, 0x03, 0xFB, 0x3B, 0x1D, 0x2F, 0x41, 0x31,
+    0xE6, 0x39, 0xC2, 0x09, 0x2A, 0xDF, 0x74, 0x00, 0x04, 0xCA, 0x0A, 0x14, 0x17, 0x19, 0x2A, 0x2B,
+    0x2C, 0x2D, 0x40, 0x48, 0x00, 0x45, 0x00, 0x3A, 0xF4, 0x39, 0x00, 0x2A, 0x5F, 0x0D, 0xD1, 0xD3,
+    0x9A, 0x7B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x07, 0xC1, 0x21, 0xF5, 0x89, 0xC5, 0x07, 0x0A, 0x0B,
+    0x15, 0x40, 0xFB, 0xA2, 0xFB, 0x46, 0x3C, 0x9C, 0xCF, 0x5E, 0xEB, 0x51, 0x43, 0x01, 0x07, 0x19,
+    0x00, 0x14, 0xFB, 0xBC, 0x00, 0x10, 0x42, 0x19, 0x31, 0xFB, 0xC6, 0xFA, 0xC1, 0xC2, 0x04, 0x21,
+    0xCC, 0xD0, 0x00, 0x07, 0xCC, 0x01, 0x02, 0x14, 0x15, 0x1A, 0x1B, 0x1C, 0x21, 0x25, 0x2A, 0x40,
+    0x44, 0xDF, 0xC6, 0x4B, 0xD8, 0xFB, 0x0E, 0xFB, 0xD3, 0xF6, 0x22, 0xE8, 0x06, 0xFB, 0x0E, 0xC9,
+    0x3A, 0xF7, 0xF2, 0xFB, 0x0E, 0x83, 0xED, 0xFA, 0xCF, 0x45, 0x14, 0x19, 0x2D, 0x48, 0x49, 0x00,
+    0x2C, 0xFB, 0xF9, 0x00, 0x25, 0xFB, 0xC0, 0xFB, 0xA4, 0x41, 0x32, 0x12, 0x06, 0xC3, 0x14, 0x38,
+    0x40, 0x00, 0x04, 0xE0, 0xB3, 0xC0, 0xD1, 0x41, 0x32, 0xBF, 0x81, 0xC3, 0x1A, 0x22, 0x25, 0x00,
+    0x04, 0xFC, 0x1B, 0xFB, 0xCC, 0x43, 0x04, 0x18, 0x23, 0xF8, 0xBA, 0xFC, 0x09, 0xFC, 0x25, 0x43,
+    0x09, 0x19, 0x25, 0xFB, 0xC9, 0xFC, 0x2F, 0xD4, 0x8F, 0x42, 0x08, 0x0A, 0xCC, 0x60, 0xFC, 0x39,
+    0x43, 0x30, 0x32, 0x34, 0xFC, 0x40, 0xFC, 0x40, 0xFC, 0x40, 0xC1, 0x07, 0xE9, 0x84, 0xC4, 0x01,
+    0x06, 0x15, 0x34, 0xF7, 0x23, 0xF9, 0x3C, 0x00, 0x0E, 0x00, 0x04, 0x42, 0x0A, 0x32, 0xF8, 0xF0,
+    0xFC, 0x5B, 0x41, 0x25, 0xF9, 0x7E, 0x43, 0x01, 0x15, 0x19, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x66,
+    0x48, 0x04, 0x17, 0x18, 0x23, 0x30, 0x32, 0x34, 0x38, 0xDD, 0xD6, 0xFC, 0x0A, 0x00, 0x15, 0xFC,
+    0x0A, 0x00, 0x0E, 0xFC, 0x70, 0x00, 0x0A, 0xFB, 0x48, 0xC1, 0x19, 0xD7, 0x23, 0x42, 0x34, 0x35,
+    0x00, 0x04, 0xFC, 0x8D, 0xC2, 0x21, 0x46, 0xF7, 0x4E, 0xFC, 0x94, 0x43, 0x07, 0x17, 0x2B, 0xFB,
+    0xE0, 0xFC, 0x9B, 0xFC, 0x9B, 0xC6, 0x01, 0x09, 0x15, 0x21, 0x32, 0x40, 0xF4, 0x80, 0xFC, 0xA1,
+    0xEE, 0x9D, 0xCA, 0x0B, 0xCC, 0xCC, 0x00, 0x0A, 0x42, 0x0A, 0x18, 0xFC, 0xB8, 0xFC, 0x52, 0x43,
+    0x38, 0x39, 0x44, 0xF9, 0xB1, 0xFC, 0xBF, 0xC5, 0x77, 0x42, 0x30, 0x34, 0xFC, 0xC9, 0xFA, 0xBA,
+    0x44, 0x25, 0x30, 0x32, 0x34, 0x00, 0x07, 0xFC, 0xD0, 0xFC, 0xD0, 0xFC, 0xCF, 0x42, 0x07, 0x38,
+    0xF7, 0xB2, 0xF9, 0xCF, 0xC1, 0x21, 0xF2, 0x36, 0x44, 0x07, 0x19, 0x21, 0x22, 0x00, 0x04, 0xCA,
+    0x27, 0xFC, 0xE8, 0xFC, 0xE8, 0xD4, 0x01, 0x02, 0x04, 0x07, 0x08, 0x0D, 0x10, 0x13, 0x14, 0x15,
+    0x17, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x2A, 0x2B, 0x48, 0x49, 0x00, 0xE8, 0x00, 0xDA, 0x00, 0xD0,
+    0xFC, 0xF5, 0x00, 0xC6, 0x00, 0xBC, 0x91, 0xE1, 0xD6, 0x07, 0x15, 0xAD, 0x00, 0xA7, 0x00, 0x85,
+    0x00, 0x68, 0x00, 0x61, 0x00, 0x50, 0x00, 0x3D, 0x00, 0x36, 0x00, 0x25, 0x00, 0x18, 0x00, 0x0D,
+    0xF1, 0x63, 0xC1, 0x21, 0xFC, 0x30, 0x41, 0x42, 0x81, 0x84, 0xC3, 0x21, 0x2A, 0x32, 0xFC, 0x2E,
+    0x00, 0x04, 0xFD, 0x3A, 0x41, 0x21, 0xF3, 0xF6, 0xC1, 0x32, 0x74, 0xD1, 0x42, 0x14, 0x18, 0xFC,
+    0x86, 0x00, 0x04, 0x42, 0x32, 0x34, 0xFC, 0x98, 0x56, 0x0F, 0x41, 0x01, 0x40, 0x69, 0x21, 0x4C,
+    0x04, 0x21, 0x11, 0x03, 0x21, 0x13, 0x03, 0x21, 0x31, 0x03, 0xC9, 0x04, 0x08, 0x10, 0x19, 0x1D,
+    0x20, 0x32, 0x42, 0x44, 0xFA, 0xDA, 0xDA, 0x92, 0xFD, 0x0F, 0x00, 0x17, 0xF9, 0x5C, 0x00, 0x03,
+    0xFD, 0x6A, 0xEA, 0x80, 0xFA, 0x52, 0x42, 0x31, 0x34, 0xFD, 0x7C, 0xFD, 0x85, 0x42, 0x0B, 0x25,
+    0xFD, 0x38, 0xFC, 0xFC, 0x42, 0x17, 0x25, 0xB2, 0x46, 0xFC, 0x95, 0xC1, 0x14, 0xDF, 0x05, 0x21,
+    0x14, 0x04, 0x4F, 0x01, 0x04, 0x0B, 0x15, 0x19, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x2A, 0x2C, 0x40,
+    0x48, 0x49, 0x00, 0x70, 0xFD, 0xA2, 0xFB, 0x7F, 0xFD, 0x5C, 0x00, 0x68, 0xFD, 0xA2, 0x00, 0x5E,
+    0x00, 0x56, 0x00, 0x38, 0xFC, 0xA3, 0x00, 0x1C, 0x9C, 0x94, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x03,
+    0x43, 0x31, 0x34, 0x35, 0x5D, 0xB9, 0xFD, 0xD0, 0xFD, 0xD0, 0x42, 0x29, 0x2C, 0xB2, 0xF6, 0xFC,
+    0xA2, 0x43, 0x28, 0x2A, 0x32, 0x66, 0xF6, 0x00, 0x11, 0x00, 0x07, 0x21, 0x2B, 0x0A, 0xC1, 0x0D,
+    0xFD, 0xD2, 0x43, 0x16, 0x21, 0x32, 0xFD, 0xF2, 0xE9, 0x44, 0xC8, 0xCA, 0x41, 0x40, 0xCB, 0xEB,
+    0x21, 0x32, 0x04, 0xC9, 0x01, 0x04, 0x0A, 0x18, 0x20, 0x21, 0x23, 0x2A, 0x2B, 0xE3, 0x0F, 0xD9,
+    0x27, 0x00, 0x15, 0xE3, 0x0F, 0xBD, 0x11, 0xE2, 0x80, 0x00, 0x11, 0x00, 0x03, 0xFD, 0xBD, 0x43,
+    0x2A, 0x30, 0x35, 0xFA, 0xEC, 0x6E, 0x18, 0xFE, 0x1F, 0x44, 0x06, 0x23, 0x29, 0x2C, 0xFE, 0x29,
+    0x00, 0x0A, 0xB3, 0x45, 0xFC, 0xF1, 0x22, 0x19, 0x2B, 0x33, 0x0D, 0x41, 0x2A, 0xB7, 0xE6, 0x21,
+    0x2B, 0x04, 0x41, 0x4C, 0x6F, 0x7E, 0x21, 0x0B, 0x04, 0x42, 0x1A, 0x22, 0xFE, 0x49, 0x00, 0x03,
+    0x21, 0x2D, 0x07, 0x41, 0x2A, 0xF9, 0x0D, 0x21, 0x21, 0x04, 0x21, 0x32, 0x03, 0xC2, 0x2A, 0x41,
+    0x00, 0x03, 0xEB, 0x73, 0x43, 0x07, 0x19, 0x22, 0x00, 0x07, 0xFE, 0x64, 0xFE, 0x64, 0x46, 0x07,
+    0x15, 0x19, 0x21, 0x22, 0x2E, 0xFE, 0x6E, 0xFE, 0x16, 0xFE, 0x6E, 0xFE, 0x6E, 0xFE, 0x6E, 0xF1,
+    0x73, 0x42, 0x19, 0x22, 0xFD, 0x59, 0xFE, 0x81, 0x45, 0x07, 0x19, 0x27, 0x2D, 0x32, 0xFE, 0x88,
+    0xFE, 0x88, 0x00, 0x24, 0x00, 0x1A, 0x00, 0x07, 0xC1, 0x37, 0xFE, 0x49, 0x42, 0x32, 0x48, 0xFD,
+    0xE1, 0xFE, 0x47, 0xC8, 0x07, 0x15, 0x19, 0x21, 0x23, 0x25, 0x40, 0x43, 0xFE, 0xA3, 0xF7, 0x6A,
+    0x4A, 0xA0, 0x00, 0x0B, 0xF7, 0xB5, 0x00, 0x07, 0xB8, 0xD3, 0xD0, 0x71, 0x42, 0x27, 0x32, 0xF3,
+    0xC8, 0x00, 0x19, 0x5F, 0x23, 0x01, 0x04, 0x06, 0x07, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x40, 0x42, 0x44, 0x47, 0x48, 0x49, 0x10, 0xE8, 0xB3, 0xDF, 0x9C, 0xB3, 0x10, 0xC2,
+    0x10, 0x93, 0x10, 0x88, 0x10, 0x61, 0x10, 0x55, 0x10, 0x31, 0x0F, 0xDD, 0x0F, 0xC0, 0x0F, 0x9E,
+    0x0F, 0x53, 0x0F, 0x0E, 0x0E, 0xC8, 0x0E, 0x82, 0x0E, 0x75, 0x0D, 0x1A, 0x0C, 0x1F, 0x0A, 0x94,
+    0x08, 0x2B, 0x05, 0xA2, 0x05, 0x56, 0x03, 0xC5, 0x03, 0x3A, 0x03, 0x07, 0x02, 0xCA, 0x01, 0xCE,
+    0x01, 0x21, 0x00, 0xD8, 0x00, 0x8D, 0x00, 0x84, 0x00, 0x73, 0x00, 0x3B, 0x00, 0x07, 0xC2, 0x30,
+    0x34, 0xFF, 0x2E, 0xE9, 0xE9, 0x42, 0x2D, 0x48, 0xE8, 0x61, 0xFE, 0x29, 0x44, 0x04, 0x21, 0x25,
+    0x27, 0xFA, 0x7A, 0xCD, 0x3F, 0xFC, 0x54, 0xF8, 0x03, 0xCA, 0x04, 0x17, 0x19, 0x1E, 0x1F, 0x21,
+    0x22, 0x40, 0x43, 0x44, 0x8C, 0x6A, 0xF1, 0x41, 0x00, 0x1B, 0xC7, 0x91, 0xF2, 0x9B, 0xFC, 0xFD,
+    0x00, 0x14, 0x00, 0x0D, 0xCD, 0x44, 0x3F, 0xC9, 0x41, 0x22, 0xFE, 0xD7, 0xA1, 0x42, 0x04, 0xC1,
+    0x20, 0x0D, 0x9C, 0x21, 0x34, 0x04, 0x41, 0x32, 0x94, 0xF7, 0x42, 0x14, 0x25, 0xFE, 0xBF, 0xFF,
+    0x79, 0xC7, 0x01, 0x17, 0x19, 0x1A, 0x23, 0x25, 0x42, 0xFF, 0x81, 0x6D, 0x83, 0xFF, 0x1B, 0xE4,
+    0xFD, 0xD7, 0x9C, 0xFF, 0x81, 0x00, 0x07, 0x41, 0x23, 0xFC, 0x21, 0x43, 0x07, 0x32, 0x34, 0xFF,
+    0x9B, 0xFF, 0x62, 0xFB, 0x11, 0xA1, 0x22, 0x0A, 0xC1, 0x22, 0xFE, 0xE2, 0xC2, 0x22, 0x46, 0xE6,
+    0xF8, 0xFF, 0xAC, 0x45, 0x07, 0x14, 0x19, 0x1A, 0x32, 0xFF, 0xB3, 0x00, 0x0E, 0x00, 0x0B, 0x00,
+    0x07, 0x36, 0xD8, 0xC1, 0x40, 0xEC, 0xA5, 0xC2, 0x43, 0x44, 0xFF, 0x0C, 0x00, 0x5F, 0xC3, 0x08,
+    0x14, 0x19, 0xFF, 0xCA, 0xFF, 0x08, 0xDF, 0x2E, 0xC1, 0x41, 0x42, 0xDA, 0x41, 0x0A, 0x58, 0x6D,
+    0x21, 0x4C, 0x04, 0xC9, 0x01, 0x07, 0x0A, 0x14, 0x19, 0x1A, 0x21, 0x23, 0x41, 0xFF, 0xE3, 0x00,
+    0x1C, 0xFB, 0xBE, 0x00, 0x15, 0xFF, 0xE3, 0x00, 0x0B, 0x7D, 0xC7, 0x00, 0x03, 0xCE, 0xD6, 0x41,
+    0x32, 0xD5, 0x0C, 0x44, 0x2D, 0x31, 0x32, 0x49, 0xFB, 0xEB, 0x87, 0xF5, 0xFF, 0xCA, 0x00, 0x04,
+    0x63, 0x23, 0x32, 0x34, 0x00, 0xE8, 0xE0, 0x01, 0x00, 0x10, 0x00, 0x1F, 0x46, 0x41, 0x22, 0xFB,
+    0x24, 0x41, 0x32, 0x8D, 0x42, 0xA1, 0x1A, 0x04, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2E,
+    0x03, 0xC6, 0x22, 0x23, 0x25, 0x2B, 0x41, 0x42, 0x00, 0x2E, 0xFE, 0x0E, 0xFF, 0xCB, 0x00, 0x21,
+    0x00, 0x14, 0x00, 0x03, 0x62, 0x34, 0x4C, 0x00, 0xD4, 0xA7, 0x01, 0x00, 0x44, 0x62, 0x2D, 0x49,
+    0x01, 0x00, 0x4C, 0x00, 0xFE, 0x23, 0x63, 0x34, 0x35, 0x4C, 0x00, 0xDF, 0xD4, 0x01, 0x00, 0x56,
+    0x01, 0x00, 0x56, 0x41, 0x22, 0x3F, 0x6D, 0xC6, 0x02, 0x17, 0x22, 0x29, 0x2B, 0x40, 0x00, 0x23,
+    0xFD, 0xD7, 0x00, 0x1A, 0x00, 0x11, 0x7C, 0x28, 0x00, 0x04, 0xC1, 0x0A, 0xFD, 0x43, 0x62, 0x19,
+    0x21, 0x01, 0x00, 0x7E, 0x01, 0x00, 0x23, 0x41, 0x22, 0xF6, 0xD6, 0xA1, 0x40, 0x04, 0x41, 0x20,
+    0x0E, 0xBB, 0x21, 0x34, 0x04, 0x62, 0x23, 0x4C, 0x00, 0x23, 0x49, 0x01, 0x00, 0x95, 0xA1, 0x15,
+    0x09, 0x63, 0x07, 0x31, 0x32, 0x01, 0x00, 0xA1, 0x00, 0xFB, 0xA8, 0x00, 0x88, 0x93, 0xA1, 0x22,
+    0x0D, 0x41, 0x0E, 0xEB, 0xEB, 0x41, 0x22, 0xEC, 0xE7, 0x41, 0x22, 0xFB, 0xF7, 0xC2, 0x22, 0x40,
+    0xF4, 0xEA, 0x00, 0x04, 0x63, 0x07, 0x19, 0x27, 0x00, 0x00, 0x0F, 0x01, 0x00, 0xC4, 0x00, 0x00,
+    0x07, 0x41, 0x22, 0xF7, 0xC4, 0xA1, 0x40, 0x04, 0x62, 0x07, 0x27, 0x01, 0x00, 0xD8, 0x00, 0x00,
+    0x03, 0x6D, 0x01, 0x07, 0x0A, 0x0D, 0x10, 0x14, 0x15, 0x19, 0x1A, 0x27, 0x29, 0x48, 0x49, 0x00,
+    0x00, 0x7A, 0x00, 0x00, 0x67, 0x00, 0x00, 0x63, 0x01, 0x00, 0xE1, 0x00, 0xEC, 0x1B, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x43, 0x00, 0x00, 0x33, 0x00, 0xFF, 0xEE, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x1D, 0x00, 0x00, 0x09, 0x61, 0x23, 0x01, 0x00, 0x97, 0xE3, 0x08, 0x19, 0x44, 0x01,
+    0x00, 0xE2, 0x01, 0x00, 0xC0, 0x00, 0x00, 0x05, 0xE1, 0x38, 0x01, 0x01, 0x28, 0x41, 0x38, 0xBA,
+    0xF0, 0xE7, 0x0A, 0x15, 0x1A, 0x1E, 0x25, 0x2A, 0x2D, 0x00, 0x00, 0x04, 0x00, 0xC5, 0xAF, 0x00,
+    0xFB, 0x7F, 0x00, 0xEC, 0x5A, 0x00, 0xFD, 0x19, 0x01, 0x00, 0xF8, 0x00, 0xFF, 0x07, 0x63, 0x01,
+    0x19, 0x37, 0x01, 0x01, 0x4E, 0x01, 0x01, 0x4E, 0x01, 0x00, 0xFF, 0xE2, 0x32, 0x33, 0x01, 0x01,
+    0x5B, 0x01, 0x01, 0x5B, 0x63, 0x19, 0x23, 0x31, 0x01, 0x00, 0xFE, 0x00, 0xEF, 0xB5, 0x00, 0xFC,
+    0x6B, 0x41, 0x32, 0x51, 0x75, 0x41, 0x16, 0xFF, 0x07, 0x21, 0x15, 0x04, 0xE7, 0x01, 0x04, 0x19,
+    0x21, 0x31, 0x32, 0x35, 0x01, 0x01, 0x7C, 0x01, 0x01, 0x6F, 0x00, 0x00, 0x0B, 0x01, 0x00, 0xF4,
+    0x00, 0x00, 0x03, 0x00, 0x51, 0x80, 0x01, 0x01, 0x7C, 0x41, 0x32, 0xE9, 0x56, 0x61, 0x01, 0x01,
+    0x00, 0x62, 0xE6, 0x01, 0x1E, 0x31, 0x34, 0x40, 0x42, 0x00, 0x00, 0x09, 0x00, 0xF6, 0xF4, 0x00,
+    0x00, 0x05, 0x01, 0x01, 0xA1, 0x00, 0xF0, 0x01, 0x00, 0xE0, 0xCB, 0x41, 0x1B, 0xFA, 0x82, 0xE5,
+    0x17, 0x19, 0x23, 0x35, 0x41, 0x00, 0xBB, 0x30, 0x00, 0x81, 0x56, 0x00, 0xF6, 0x4B, 0x01, 0x01,
+    0xBF, 0x00, 0x00, 0x04, 0xE3, 0x19, 0x23, 0x31, 0x01, 0x01, 0x79, 0x01, 0x01, 0x0E, 0x00, 0xEE,
+    0xB6, 0x61, 0x1F, 0x01, 0x00, 0xDF, 0x44, 0x25, 0x31, 0x35, 0x39, 0xFD, 0xCE, 0xFD, 0x5C, 0x00,
+    0x05, 0xFD, 0xCE, 0x62, 0x31, 0x35, 0x01, 0x01, 0xE9, 0x01, 0x01, 0xF3, 0x63, 0x21, 0x22, 0x31,
+    0x00, 0xB6, 0xAE, 0x00, 0x00, 0x09, 0x01, 0x01, 0xAD, 0x61, 0x40, 0x01, 0x01, 0xBA, 0x21, 0x19,
+    0x05, 0x21, 0x38, 0x03, 0x42, 0x22, 0x2A, 0xE4, 0x21, 0xFA, 0xDB, 0x62, 0x14, 0x1D, 0x01, 0x02,
+    0x11, 0x01, 0x01, 0xCC, 0x62, 0x09, 0x2A, 0x01, 0x01, 0xEB, 0x01, 0x01, 0xA5, 0xF8, 0x01, 0x04,
+    0x07, 0x08, 0x09, 0x0A, 0x14, 0x15, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x21, 0x22, 0x23, 0x27, 0x2A,
+    0x2B, 0x2D, 0x40, 0x41, 0x43, 0x44, 0x00, 0x01, 0x12, 0x00, 0x01, 0x05, 0x00, 0x00, 0xFC, 0x00,
+    0x00, 0xDF, 0x00, 0xD1, 0x6C, 0x01, 0x02, 0x2C, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xC9, 0x00, 0x6D,
+    0x28, 0x00, 0x00, 0xB1, 0x00, 0x63, 0x05, 0x01, 0x01, 0xF4, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x8B,
+    0x00, 0x00, 0x6E, 0x00, 0xC8, 0x40, 0x00, 0x00, 0x59, 0x00, 0x00, 0x47, 0x00, 0x00, 0x31, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x19, 0x00, 0x00, 0x12, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x09, 0x62, 0x07,
+    0x35, 0x01, 0x02, 0x8E, 0x01, 0x01, 0xD3, 0x42, 0x01, 0x22, 0xF4, 0x8F, 0x00, 0x09, 0xC2, 0x22,
+    0x40, 0xF9, 0x50, 0x00, 0x07, 0xE1, 0x1F, 0x01, 0x01, 0xA3, 0xE5, 0x14, 0x22, 0x23, 0x41, 0x43,
+    0x01, 0x01, 0xE4, 0x00, 0xFA, 0x89, 0x00, 0x8F, 0x7E, 0x00, 0xD1, 0xE1, 0x01, 0x00, 0x79, 0x62,
+    0x31, 0x35, 0x01, 0x00, 0xB0, 0x01, 0x02, 0xBF, 0x21, 0x0B, 0x09, 0x41, 0x2A, 0xD9, 0x4A, 0x21,
+    0x32, 0x04, 0x41, 0x19, 0x9B, 0x89, 0xA2, 0x19, 0x40, 0x07, 0x04, 0x61, 0x2A, 0x01, 0x02, 0xC2,
+    0x21, 0x15, 0x05, 0x21, 0x34, 0x03, 0xA1, 0x22, 0x03, 0x41, 0x19, 0xFC, 0xCA, 0x21, 0x33, 0x04,
+    0xC2, 0x22, 0x2D, 0xBC, 0x61, 0x00, 0x03, 0x21, 0x07, 0x07, 0x42, 0x01, 0x22, 0xFB, 0x53, 0x98,
+    0x2D, 0x21, 0x30, 0x07, 0x21, 0x23, 0x03, 0x41, 0x22, 0xF9, 0xB9, 0xA2, 0x1B, 0x2A, 0x07, 0x04,
+    0x21, 0x21, 0x05, 0x6B, 0x01, 0x07, 0x0F, 0x19, 0x1A, 0x1B, 0x21, 0x27, 0x2B, 0x48, 0x49, 0x01,
+    0x03, 0x13, 0x00, 0x00, 0x6E, 0x00, 0x0D, 0xB6, 0x00, 0x00, 0x69, 0x00, 0xDD, 0x7F, 0x00, 0x00,
+    0x4B, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2D, 0x00, 0x53, 0x17, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03,
+    0x67, 0x01, 0x07, 0x19, 0x32, 0x34, 0x38, 0x48, 0x01, 0x03, 0x40, 0x01, 0x03, 0x40, 0x01, 0x03,
+    0x40, 0x00, 0xF8, 0x4C, 0x00, 0xFF, 0x28, 0x00, 0xFE, 0xEE, 0x01, 0x02, 0xE5, 0x63, 0x23, 0x38,
+    0x49, 0x00, 0x10, 0x64, 0x00, 0xFF, 0x45, 0x01, 0x03, 0x08, 0x62, 0x01, 0x02, 0x01, 0x03, 0x6A,
+    0x00, 0xFE, 0xE0, 0x62, 0x16, 0x1B, 0x01, 0x03, 0x73, 0x01, 0x02, 0xF4, 0xE7, 0x01, 0x07, 0x20,
+    0x2A, 0x2B, 0x40, 0x42, 0x01, 0x00, 0xEC, 0x01, 0x03, 0x27, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xE7, 0x14, 0x19, 0x22, 0x23, 0x2A, 0x48,
+    0x49, 0x01, 0x03, 0x99, 0x01, 0x03, 0x99, 0x00, 0xF7, 0xC6, 0x00, 0x24, 0xEF, 0x00, 0xFF, 0x74,
+    0x00, 0x00, 0x1D, 0x01, 0x03, 0x99, 0xE2, 0x15, 0x16, 0x00, 0xCF, 0xDC, 0x01, 0x01, 0x6A, 0x42,
+    0x01, 0x14, 0xF9, 0xA0, 0x00, 0x09, 0x41, 0x22, 0x99, 0x1A, 0xC2, 0x22, 0x2B, 0xF9, 0x1C, 0x00,
+    0x04, 0x63, 0x07, 0x31, 0x32, 0x01, 0x03, 0xD1, 0x01, 0x03, 0x98, 0x00, 0x61, 0xB1, 0xE4, 0x15,
+    0x19, 0x22, 0x42, 0x00, 0xFC, 0xA5, 0x01, 0x03, 0x83, 0x00, 0x00, 0x0D, 0x00, 0xF5, 0xD6, 0xC1,
+    0x22, 0xED, 0xCC, 0x21, 0x2D, 0x04, 0x65, 0x14, 0x19, 0x21, 0x48, 0x49, 0x00, 0x00, 0x2C, 0x00,
+    0x00, 0x18, 0x01, 0x03, 0xF6, 0x01, 0x03, 0xBD, 0x00, 0x00, 0x03, 0x62, 0x14, 0x15, 0x00, 0xEF,
+    0x45, 0x01, 0x03, 0xEF, 0x61, 0x18, 0x01, 0x03, 0xCE, 0xC1, 0x1A, 0xE6, 0x2A, 0x41, 0x15, 0xF4,
+    0xB0, 0x21, 0x19, 0x04, 0xA3, 0x19, 0x25, 0x31, 0x10, 0x0B, 0x03, 0xE1, 0x1B, 0x01, 0x03, 0xD9,
+    0xC2, 0x15, 0x34, 0xEF, 0x6A, 0xE9, 0x39, 0x62, 0x31, 0x39, 0x01, 0x04, 0x15, 0x00, 0xCB, 0x61,
+    0x41, 0x15, 0xD2, 0xA3, 0x21, 0x31, 0x04, 0xE8, 0x01, 0x19, 0x20, 0x27, 0x28, 0x2B, 0x42, 0x4C,
+    0x01, 0x03, 0x0F, 0x00, 0xB1, 0x6D, 0x00, 0x00, 0x10, 0x01, 0x01, 0x24, 0x00, 0xF2, 0x29, 0x00,
+    0x00, 0x03, 0x00, 0x2F, 0xB7, 0x01, 0x04, 0x47, 0x41, 0x18, 0xF2, 0x40, 0x22, 0x18, 0x42, 0x25,
+    0x04, 0x63, 0x2D, 0x31, 0x34, 0x01, 0x00, 0x59, 0x01, 0x00, 0x59, 0x01, 0x00, 0x59, 0xE2, 0x22,
+    0x25, 0x00, 0x00, 0x0D, 0x01, 0x04, 0x7E, 0x62, 0x22, 0x23, 0x00, 0x6C, 0x3A, 0x01, 0x04, 0x02,
+    0xE5, 0x14, 0x22, 0x23, 0x32, 0x40, 0x01, 0x03, 0xCA, 0x01, 0x04, 0x86, 0x00, 0xDC, 0xAB, 0x00,
+    0xEB, 0x21, 0x00, 0x00, 0x09, 0x41, 0x22, 0x89, 0xE6, 0x41, 0x29, 0xC8, 0x13, 0x21, 0x34, 0x04,
+    0x21, 0x19, 0x03, 0xE5, 0x01, 0x0A, 0x14, 0x23, 0x32, 0x00, 0x00, 0x03, 0x01, 0x04, 0x7A, 0x01,
+    0x03, 0xED, 0x00, 0xDC, 0xCE, 0x00, 0xEB, 0x44, 0x62, 0x22, 0x2B, 0x01, 0x04, 0xBE, 0x00, 0x05,
+    0x60, 0x61, 0x23, 0x01, 0x04, 0xBE, 0x61, 0x22, 0x01, 0x00, 0xF4, 0x21, 0x2B, 0x05, 0xE2, 0x40,
+    0x43, 0x00, 0x00, 0x03, 0x01, 0x02, 0xAD, 0x41, 0x22, 0xBB, 0x67, 0x63, 0x07, 0x21, 0x22, 0x00,
+    0x00, 0x0D, 0x00, 0x00, 0x04, 0x01, 0x04, 0xEB, 0xEF, 0x01, 0x04, 0x07, 0x14, 0x15, 0x17, 0x1A,
+    0x1E, 0x22, 0x23, 0x27, 0x41, 0x42, 0x48, 0x49, 0x00, 0x00, 0xED, 0x00, 0x00, 0xD4, 0x00, 0x00,
+    0xCD, 0x01, 0x04, 0xF8, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x68,
+    0x01, 0x04, 0xEE, 0x00, 0x00, 0x53, 0x00, 0x00, 0x45, 0x00, 0x00, 0x30, 0x00, 0x00, 0x27, 0x00,
+    0x00, 0x0D, 0x00, 0xF9, 0x59, 0x61, 0x19, 0x01, 0x03, 0x9E, 0x21, 0x31, 0x05, 0x41, 0x32, 0xD0,
+    0x15, 0x41, 0x25, 0xE7, 0xCD, 0x21, 0x34, 0x04, 0xE1, 0x35, 0x01, 0x04, 0xC9, 0x41, 0x2D, 0xCB,
+    0xEB, 0x41, 0x0B, 0xC9, 0xF6, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0x41, 0x4C, 0xF2, 0x3D, 0x21,
+    0x23, 0x04, 0x22, 0x2D, 0x34, 0x0A, 0x03, 0x42, 0x0B, 0x27, 0xEF, 0xF1, 0x00, 0x05, 0x46, 0x01,
+    0x04, 0x15, 0x1F, 0x40, 0x42, 0xE0, 0x46, 0x9D, 0x73, 0x00, 0x26, 0x00, 0x21, 0x00, 0x07, 0xA2,
+    0x01, 0x21, 0x34, 0x13, 0x62, 0x22, 0x34, 0x00, 0x8A, 0xC5, 0x01, 0x05, 0x83, 0x41, 0x0B, 0xE6,
+    0xCE, 0x21, 0x34, 0x04, 0x62, 0x23, 0x25, 0x01, 0x05, 0x5B, 0x00, 0xF2, 0x76, 0x41, 0x08, 0x9E,
+    0x97, 0xA1, 0x41, 0x04, 0x21, 0x19, 0x03, 0x21, 0x22, 0x03, 0x21, 0x35, 0x03, 0x42, 0x31, 0x34,
+    0xF2, 0x8F, 0xE4, 0x61, 0x42, 0x19, 0x40, 0x00, 0x07, 0xDA, 0x7E, 0x62, 0x2A, 0x47, 0x01, 0x05,
+    0xBB, 0x01, 0x05, 0x82, 0x65, 0x04, 0x0B, 0x19, 0x23, 0x2D, 0x00, 0x00, 0x30, 0x01, 0x05, 0x75,
+    0x00, 0x00, 0x1A, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x41, 0x32, 0x13, 0x71, 0x21, 0x25, 0x04,
+    0x21, 0x2A, 0x03, 0x41, 0x1B, 0xE7, 0xF0, 0x21, 0x40, 0x04, 0x41, 0x1E, 0xDA, 0xB8, 0xA1, 0x40,
+    0x04, 0x65, 0x01, 0x14, 0x17, 0x19, 0x23, 0x00, 0x00, 0x11, 0x01, 0x05, 0xF1, 0x00, 0x00, 0x0A,
+    0x01, 0x05, 0xF1, 0x00, 0x00, 0x03, 0x62, 0x14, 0x47, 0x01, 0x06, 0x06, 0x01, 0x05, 0xB7, 0x21,
+    0x15, 0x09, 0x21, 0x40, 0x03, 0x21, 0x19, 0x03, 0xE1, 0x22, 0x01, 0x05, 0x19, 0xF0, 0x01, 0x07,
+    0x0B, 0x15, 0x16, 0x17, 0x19, 0x1B, 0x23, 0x25, 0x29, 0x2A, 0x40, 0x42, 0x44, 0x48, 0x00, 0x00,
+    0xE3, 0x01, 0x06, 0x1D, 0x00, 0xE7, 0x5E, 0x00, 0x00, 0xE0, 0x00, 0x11, 0x9E, 0x00, 0x00, 0xD8,
+    0x00, 0x00, 0x9C, 0x01, 0x02, 0xB2, 0x00, 0x00, 0x99, 0x00, 0x00, 0x8C, 0x01, 0x02, 0xB2, 0x00,
+    0xC8, 0xC8, 0x00, 0x00, 0x59, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0xE1, 0x18,
+    0x01, 0x06, 0x18, 0x21, 0x2A, 0x05, 0xC1, 0x22, 0xD2, 0x8C, 0xC2, 0x01, 0x41, 0xF5, 0x91, 0xF9,
+    0x61, 0xC1, 0x40, 0xF4, 0xA7, 0xE2, 0x22, 0x48, 0x00, 0xF8, 0x94, 0x01, 0x06, 0x3C, 0x62, 0x19,
+    0x22, 0x01, 0x01, 0xBC, 0x00, 0xF3, 0xE1, 0x62, 0x22, 0x2B, 0x01, 0x05, 0xF6, 0x01, 0x03, 0x11,
+    0xE7, 0x07, 0x17, 0x1E, 0x21, 0x22, 0x2B, 0x41, 0x00, 0x00, 0x26, 0x01, 0x06, 0x38, 0x01, 0x06,
+    0x32, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xC1, 0x01, 0xF2,
+    0x64, 0x41, 0x32, 0xA6, 0x9A, 0x41, 0x40, 0x36, 0x4B, 0x21, 0x34, 0x04, 0xE3, 0x15, 0x25, 0x32,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x01, 0x06, 0xB2, 0xC5, 0x07, 0x17, 0x19, 0x21, 0x2B, 0x00,
+    0x1C, 0xC0, 0x3A, 0x00, 0x0D, 0xD4, 0x08, 0xF4, 0xFF, 0x41, 0x17, 0xF4, 0x0F, 0xE3, 0x22, 0x40,
+    0x41, 0x01, 0x06, 0x17, 0x00, 0x00, 0x04, 0x00, 0x07, 0x75, 0x65, 0x19, 0x2D, 0x30, 0x32, 0x33,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x01, 0x06, 0xEA, 0x00, 0x00, 0x21, 0x00, 0x00, 0x0D, 0xC1,
+    0x22, 0xFC, 0xBF, 0x61, 0x22, 0x01, 0x06, 0x84, 0x65, 0x07, 0x19, 0x21, 0x22, 0x41, 0x01, 0x07,
+    0x08, 0x00, 0x00, 0x09, 0x00, 0xD4, 0x47, 0x01, 0x07, 0x08, 0x00, 0x00, 0x05, 0x64, 0x27, 0x2D,
+    0x32, 0x33, 0x01, 0x06, 0x62, 0x00, 0x00, 0x15, 0x00, 0xDC, 0x2A, 0x01, 0x07, 0x1D, 0x78, 0x01,
+    0x07, 0x15, 0x16, 0x19, 0x21, 0x23, 0x25, 0x27, 0x28, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x42, 0x48, 0x49, 0x00, 0x07, 0xE5, 0x00, 0x07, 0xC2, 0x00, 0x07, 0xBB,
+    0x00, 0x07, 0xB8, 0x00, 0x63, 0x26, 0x00, 0x07, 0xAD, 0x00, 0x07, 0x97, 0x01, 0x07, 0x2E, 0x00,
+    0x07, 0x7B, 0x00, 0x07, 0x6B, 0x00, 0x07, 0x4B, 0x00, 0x06, 0xFD, 0x00, 0x06, 0x4D, 0x00, 0x05,
+    0x01, 0x00, 0x04, 0x90, 0x00, 0x04, 0x1B, 0x00, 0x03, 0x95, 0x00, 0x03, 0x6F, 0x00, 0x03, 0x38,
+    0x00, 0x02, 0x36, 0x00, 0x01, 0x11, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x44, 0x00, 0x00, 0x11, 0x62,
+    0x31, 0x49, 0x00, 0x91, 0x33, 0x01, 0x07, 0x82, 0x62, 0x32, 0x49, 0x01, 0x07, 0x97, 0x01, 0x07,
+    0x8B, 0xE4, 0x0A, 0x1A, 0x1F, 0x23, 0x00, 0x00, 0x12, 0x00, 0xED, 0x33, 0x01, 0x02, 0xDF, 0x00,
+    0x00, 0x09, 0x62, 0x27, 0x4C, 0x00, 0x83, 0x0A, 0x01, 0x07, 0xB2, 0xE3, 0x01, 0x04, 0x23, 0x01,
+    0x05, 0x4D, 0x00, 0x00, 0x09, 0x01, 0x06, 0xAF, 0x62, 0x23, 0x25, 0x01, 0x06, 0x40, 0x01, 0x06,
+    0x40, 0x63, 0x19, 0x34, 0x40, 0x01, 0x07, 0x6B, 0x01, 0x04, 0xC3, 0x00, 0x00, 0x09, 0x62, 0x34,
+    0x35, 0x01, 0x07, 0xDE, 0x01, 0x07, 0x95, 0x64, 0x01, 0x15, 0x19, 0x30, 0x01, 0x04, 0x7C, 0x01,
+    0x04, 0x7C, 0x00, 0x00, 0x09, 0x01, 0x07, 0xE7, 0xC1, 0x21, 0xF3, 0x32, 0x21, 0x39, 0x04, 0x41,
+    0x1E, 0xEC, 0x75, 0x21, 0x4C, 0x04, 0x21, 0x34, 0x03, 0x21, 0x18, 0x03, 0x21, 0x17, 0x03, 0x62,
+    0x16, 0x34, 0x01, 0x07, 0xB4, 0x00, 0x00, 0x03, 0xC5, 0x0A, 0x20, 0x23, 0x2A, 0x31, 0xEC, 0x95,
+    0x00, 0x1C, 0xAA, 0xD7, 0x00, 0x09, 0xCB, 0x82, 0xE2, 0x19, 0x35, 0x00, 0xE7, 0x88, 0x01, 0x08,
+    0x28, 0x63, 0x19, 0x30, 0x34, 0x01, 0x05, 0x38, 0x01, 0x08, 0x31, 0x01, 0x08, 0x31, 0x62, 0x19,
+    0x32, 0x01, 0x04, 0x19, 0x01, 0x08, 0x3E, 0x41, 0x21, 0xE0, 0xFE, 0xE1, 0x1F, 0x01, 0x03, 0x89,
+    0x21, 0x1F, 0x05, 0xA3, 0x22, 0x40, 0x44, 0x15, 0x0C, 0x03, 0xC3, 0x01, 0x32, 0x40, 0xFC, 0x87,
+    0xEB, 0x7E, 0x0D, 0x0F, 0xE2, 0x34, 0x35, 0x01, 0x08, 0x64, 0x01, 0x08, 0x64, 0xC1, 0x22, 0xF9,
+    0x00, 0x21, 0x35, 0x04, 0xE3, 0x13, 0x22, 0x40, 0x00, 0x00, 0x03, 0x01, 0x08, 0x58, 0x00, 0xA9,
+    0x82, 0x62, 0x30, 0x32, 0x01, 0x08, 0x81, 0x00, 0xAB, 0x40, 0xE1, 0x47, 0x01, 0x07, 0x85, 0x21,
+    0x23, 0x05, 0xA1, 0x40, 0x03, 0xE1, 0x40, 0x01, 0x08, 0x4F, 0x62, 0x27, 0x31, 0x01, 0x06, 0x8B,
+    0x01, 0x08, 0x4B, 0xA1, 0x23, 0x09, 0x41, 0x0A, 0xF5, 0xBC, 0xE3, 0x2B, 0x42, 0x43, 0x01, 0x07,
+    0xA1, 0x00, 0x00, 0x04, 0x01, 0x06, 0x79, 0xE2, 0x23, 0x25, 0x00, 0xEE, 0x49, 0x01, 0x06, 0xA8,
+    0xE1, 0x27, 0x01, 0x07, 0x88, 0x6B, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x30, 0x31, 0x34,
+    0x35, 0x01, 0x08, 0xC5, 0x01, 0x08, 0xC5, 0x00, 0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x0E, 0x01, 0x08, 0xC5, 0x00, 0x03, 0x90, 0x00, 0x00, 0x05, 0x01,
+    0x08, 0xC5, 0x62, 0x32, 0x34, 0x01, 0x08, 0xF2, 0x01, 0x01, 0x6E, 0x41, 0x40, 0x1C, 0x1A, 0x21,
+    0x19, 0x04, 0x21, 0x22, 0x03, 0xE4, 0x0A, 0x19, 0x32, 0x34, 0x00, 0xE4, 0x25, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x01, 0x09, 0x04, 0x62, 0x31, 0x34, 0x00, 0xCB, 0x95, 0x01, 0x06, 0x08, 0x62,
+    0x23, 0x38, 0x01, 0x09, 0x15, 0x01, 0x08, 0xE6, 0x41, 0x31, 0xDC, 0xF6, 0x63, 0x07, 0x17, 0x21,
+    0x00, 0xF1, 0x3C, 0x01, 0x04, 0x6A, 0x01, 0x08, 0x1C, 0xE5, 0x04, 0x0A, 0x17, 0x23, 0x40, 0x01,
+    0x08, 0xE4, 0x00, 0xE8, 0x99, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x11, 0x00, 0x00, 0x0D, 0xE2, 0x15,
+    0x1E, 0x01, 0x08, 0x45, 0x01, 0x02, 0x15, 0xE2, 0x41, 0x46, 0x00, 0xEE, 0x67, 0x01, 0x09, 0x57,
+    0xE2, 0x04, 0x23, 0x01, 0x01, 0xB9, 0x00, 0xD3, 0x24, 0xE2, 0x0A, 0x23, 0x01, 0x01, 0x48, 0x00,
+    0xD5, 0x8F, 0xE1, 0x31, 0x01, 0x09, 0x14, 0xE9, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x22, 0x25,
+    0x2A, 0x01, 0x09, 0x77, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x29, 0x00, 0x00, 0x20, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x01, 0x08, 0xB1, 0x00, 0xA9, 0xBE, 0x63, 0x30, 0x32, 0x33,
+    0x01, 0x09, 0x9C, 0x01, 0x09, 0x9C, 0x00, 0xE8, 0xD0, 0x62, 0x19, 0x32, 0x01, 0x09, 0xA9, 0x00,
+    0xFE, 0x0A, 0x63, 0x21, 0x31, 0x35, 0x01, 0x09, 0xB2, 0x01, 0x05, 0x9A, 0x01, 0x09, 0x21, 0xC1,
+    0x1B, 0xCF, 0x8A, 0x21, 0x25, 0x04, 0x21, 0x40, 0x03, 0x21, 0x30, 0x03, 0xA1, 0x17, 0x03, 0x21,
+    0x1A, 0x03, 0x65, 0x21, 0x30, 0x31, 0x39, 0x48, 0x01, 0x09, 0xD2, 0x01, 0x09, 0xD2, 0x00, 0x00,
+    0x03, 0x01, 0x09, 0xD2, 0x00, 0xED, 0xC4, 0x68, 0x01, 0x14, 0x21, 0x27, 0x2D, 0x32, 0x36, 0x49,
+    0x01, 0x09, 0xE7, 0x01, 0x09, 0xE7, 0x01, 0x09, 0xE7, 0x01, 0x09, 0x2C, 0x01, 0x09, 0x98, 0x01,
+    0x09, 0xE7, 0x01, 0x01, 0x4F, 0x01, 0x09, 0x92, 0x41, 0x2D, 0xEF, 0x7D, 0xA1, 0x40, 0x04, 0x64,
+    0x14, 0x1A, 0x21, 0x27, 0x01, 0x0A, 0x0F, 0x00, 0x00, 0x03, 0x01, 0x0A, 0x0F, 0x01, 0x0A, 0x0F,
+    0x63, 0x2D, 0x31, 0x32, 0x01, 0x0A, 0x16, 0x01, 0x08, 0x11, 0x00, 0x00, 0x11, 0x64, 0x0D, 0x14,
+    0x19, 0x22, 0x01, 0x0A, 0x2D, 0x01, 0x0A, 0x2D, 0x01, 0x09, 0x67, 0x01, 0x0A, 0x2D, 0x69, 0x1A,
+    0x21, 0x2D, 0x31, 0x32, 0x33, 0x34, 0x37, 0x38, 0x01, 0x0A, 0x3E, 0x01, 0x0A, 0x3E, 0x01, 0x06,
+    0x26, 0x00, 0xE8, 0x0C, 0x00, 0x00, 0x11, 0x01, 0x0A, 0x3E, 0x00, 0xBE, 0xE2, 0x01, 0x09, 0xE9,
+    0x01, 0x0A, 0x3E, 0x41, 0x23, 0x2E, 0x86, 0x21, 0x14, 0x04, 0x42, 0x31, 0x32, 0x00, 0x03, 0xF3,
+    0x96, 0x64, 0x07, 0x14, 0x1A, 0x49, 0x01, 0x0A, 0x71, 0x01, 0x0A, 0x71, 0x01, 0x0A, 0x71, 0x01,
+    0x0A, 0x67, 0x41, 0x2D, 0xAE, 0x4B, 0x68, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x48, 0x49, 0x01,
+    0x0A, 0x7C, 0x01, 0x0A, 0x86, 0x00, 0x00, 0x15, 0x00, 0x92, 0x78, 0x01, 0x0A, 0x86, 0x01, 0x06,
+    0x6E, 0x00, 0x00, 0x04, 0x01, 0x0A, 0x20, 0x62, 0x2D, 0x32, 0x01, 0x0A, 0x6E, 0x01, 0x09, 0xEC,
+    0x69, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x48, 0x01, 0x09, 0xF5, 0x01, 0x0A, 0xA6,
+    0x01, 0x09, 0xAB, 0x00, 0xF9, 0x76, 0x01, 0x0A, 0xAF, 0x01, 0x0A, 0x1F, 0x01, 0x0A, 0xA6, 0x01,
+    0x06, 0x5E, 0x00, 0x00, 0x09, 0x66, 0x07, 0x27, 0x2D, 0x31, 0x36, 0x38, 0x01, 0x0A, 0xD5, 0x01,
+    0x0A, 0xCB, 0x01, 0x02, 0x3D, 0x01, 0x0A, 0x86, 0x01, 0x0A, 0xD4, 0x01, 0x02, 0x3D, 0x63, 0x31,
+    0x32, 0x34, 0x01, 0x0A, 0xE4, 0x00, 0x97, 0x90, 0x01, 0x0A, 0xE4, 0x41, 0x33, 0xFD, 0xB4, 0x63,
+    0x32, 0x35, 0x48, 0x01, 0x0A, 0x44, 0x01, 0x0A, 0xFF, 0x00, 0x00, 0x04, 0x62, 0x22, 0x48, 0x01,
+    0x0B, 0x0C, 0x01, 0x0A, 0xFF, 0x67, 0x07, 0x27, 0x2D, 0x31, 0x32, 0x38, 0x48, 0x01, 0x0B, 0x15,
+    0x00, 0x00, 0x09, 0x01, 0x06, 0xFD, 0x01, 0x0A, 0xC6, 0x01, 0x0A, 0x5A, 0x01, 0x0A, 0x5A, 0x01,
+    0x04, 0x27, 0x61, 0x19, 0x01, 0x00, 0x84, 0x21, 0x30, 0x05, 0x63, 0x19, 0x23, 0x35, 0x01, 0x0B,
+    0x3A, 0x00, 0x00, 0x03, 0x01, 0x01, 0x8D, 0x41, 0x40, 0xBC, 0xFF, 0x21, 0x23, 0x04, 0x21, 0x14,
+    0x03, 0x21, 0x42, 0x03, 0x21, 0x2E, 0x03, 0xA1, 0x44, 0x03, 0x21, 0x14, 0x03, 0xC1, 0x27, 0xA5,
+    0x36, 0x63, 0x07, 0x19, 0x1A, 0x01, 0x0B, 0x61, 0x01, 0x0B, 0x61, 0x00, 0x00, 0x04, 0x21, 0x22,
+    0x0D, 0x64, 0x07, 0x34, 0x35, 0x47, 0x01, 0x0B, 0x71, 0x00, 0x00, 0x17, 0x00, 0x00, 0x03, 0x01,
+    0x0B, 0x67, 0xE3, 0x34, 0x47, 0x49, 0x01, 0x0B, 0x78, 0x01, 0x0A, 0x7D, 0x01, 0x0B, 0x78, 0x63,
+    0x22, 0x34, 0x47, 0x01, 0x0B, 0x8F, 0x01, 0x0B, 0x40, 0x01, 0x09, 0x5E, 0x67, 0x14, 0x19, 0x1A,
+    0x21, 0x23, 0x25, 0x2B, 0x01, 0x07, 0x4A, 0x00, 0x00, 0x62, 0x00, 0x00, 0x2B, 0x00, 0x2D, 0x57,
+    0x00, 0x00, 0x1A, 0x01, 0x07, 0xBA, 0x00, 0x00, 0x0D, 0x62, 0x30, 0x49, 0x01, 0x0B, 0xB9, 0x01,
+    0x0B, 0xB9, 0x69, 0x04, 0x07, 0x14, 0x17, 0x19, 0x1A, 0x23, 0x27, 0x2B, 0x01, 0x08, 0x57, 0x00,
+    0x00, 0x09, 0x01, 0x0B, 0xC2, 0x01, 0x08, 0x57, 0x00, 0xFD, 0xE8, 0x01, 0x07, 0xAA, 0x00, 0xF1,
+    0xDF, 0x01, 0x0B, 0xB8, 0x01, 0x03, 0x2A, 0x63, 0x19, 0x22, 0x2B, 0x01, 0x0B, 0x98, 0x01, 0x0B,
+    0xDD, 0x01, 0x0B, 0x2C, 0xF8, 0x01, 0x04, 0x06, 0x07, 0x0A, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1F,
+    0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00, 0x02, 0x58,
+    0x00, 0x02, 0x4B, 0x01, 0x09, 0xD1, 0x00, 0x02, 0x42, 0x01, 0x05, 0xD5, 0x00, 0x02, 0x22, 0x01,
+    0x0B, 0xDB, 0x00, 0x02, 0x0D, 0x00, 0x01, 0xD4, 0x00, 0x01, 0xB6, 0x01, 0x07, 0x32, 0x00, 0x01,
+    0x8A, 0x00, 0x01, 0x6E, 0x00, 0x01, 0x44, 0x00, 0x01, 0x1F, 0x00, 0x01, 0x06, 0x00, 0x00, 0xF5,
+    0x00, 0x00, 0xDF, 0x00, 0x35, 0xE3, 0x00, 0x00, 0x58, 0x00, 0x00, 0x32, 0x00, 0x00, 0x0D, 0x01,
+    0x07, 0xDC, 0x01, 0x0A, 0xEF, 0x64, 0x2A, 0x32, 0x34, 0x4C, 0x01, 0x08, 0xEA, 0x01, 0x0C, 0x55,
+    0x01, 0x09, 0x47, 0x01, 0x0C, 0x55, 0x62, 0x1B, 0x30, 0x01, 0x0C, 0x66, 0x01, 0x0C, 0x66, 0x41,
+    0x32, 0x85, 0xDD, 0xA1, 0x19, 0x04, 0x62, 0x32, 0x4C, 0x01, 0x0C, 0x76, 0x00, 0x00, 0x03, 0xE8,
+    0x02, 0x14, 0x1A, 0x22, 0x29, 0x2B, 0x40, 0x41, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x19, 0x00, 0xED,
+    0xE9, 0x01, 0x0A, 0x70, 0x00, 0x00, 0x09, 0x00, 0xD8, 0xF6, 0x00, 0xDA, 0x6E, 0x00, 0x0B, 0x69,
+    0x62, 0x27, 0x4C, 0x01, 0x0C, 0x45, 0x01, 0x0C, 0xA0, 0x62, 0x01, 0x32, 0x01, 0x0C, 0xA9, 0x01,
+    0x0C, 0x70, 0x61, 0x27, 0x01, 0x08, 0x9A, 0x41, 0x23, 0xF9, 0xBC, 0x61, 0x0E, 0x01, 0x0C, 0x9F,
+    0x21, 0x29, 0x05, 0xE2, 0x15, 0x21, 0x01, 0x0C, 0xC3, 0x01, 0x0C, 0x5D, 0x61, 0x21, 0x01, 0x09,
+    0xE4, 0x21, 0x2A, 0x05, 0x21, 0x2D, 0x03, 0xC3, 0x04, 0x27, 0x41, 0x00, 0x03, 0xFB, 0x06, 0xBA,
+    0x44, 0x24, 0x23, 0x24, 0x34, 0x35, 0x2A, 0x21, 0x1E, 0x0A, 0x61, 0x22, 0x01, 0x0A, 0xB9, 0x21,
+    0x35, 0x05, 0x63, 0x01, 0x1E, 0x23, 0x00, 0x00, 0x03, 0x00, 0xC7, 0xF0, 0x01, 0x0B, 0x6A, 0x64,
+    0x01, 0x04, 0x15, 0x23, 0x01, 0x0C, 0xFF, 0x01, 0x0C, 0xFF, 0x01, 0x0C, 0xC6, 0x01, 0x0C, 0xFE,
+    0xEC, 0x01, 0x04, 0x14, 0x19, 0x1A, 0x21, 0x23, 0x27, 0x2A, 0x40, 0x41, 0x44, 0x01, 0x0C, 0xAA,
+    0x00, 0x00, 0x70, 0x01, 0x0A, 0x93, 0x00, 0x00, 0x67, 0x00, 0x00, 0x5E, 0x01, 0x0C, 0xC1, 0x01,
+    0x0C, 0x04, 0x01, 0x0C, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x11, 0x00, 0x1A,
+    0xDD, 0x62, 0x30, 0x32, 0x01, 0x0D, 0x41, 0x01, 0x0C, 0xE3, 0x41, 0x22, 0xEF, 0x5B, 0x21, 0x32,
+    0x04, 0xE2, 0x30, 0x35, 0x01, 0x0D, 0x51, 0x01, 0x0D, 0x51, 0xE6, 0x01, 0x0A, 0x0E, 0x14, 0x17,
+    0x19, 0x00, 0x00, 0x19, 0x01, 0x0A, 0x76, 0x00, 0x84, 0xE0, 0x00, 0x10, 0x12, 0x00, 0x00, 0x0C,
+    0x00, 0x00, 0x09, 0x61, 0x08, 0x01, 0x01, 0xA0, 0x41, 0x19, 0x78, 0x6F, 0x21, 0x21, 0x04, 0x21,
+    0x23, 0x03, 0x21, 0x23, 0x03, 0x62, 0x32, 0x38, 0x01, 0x0D, 0x27, 0x00, 0xE9, 0x7F, 0x62, 0x15,
+    0x19, 0x01, 0x0C, 0x9B, 0x01, 0x0D, 0x72, 0x21, 0x2A, 0x09, 0x21, 0x32, 0x03, 0x62, 0x28, 0x4C,
+    0x00, 0x00, 0x03, 0x01, 0x0D, 0x9D, 0x21, 0x19, 0x09, 0x21, 0x2A, 0x03, 0x21, 0x32, 0x03, 0x62,
+    0x28, 0x2B, 0x00, 0x00, 0x03, 0x01, 0x0C, 0x77, 0x21, 0x30, 0x09, 0x21, 0x23, 0x03, 0x41, 0x2B,
+    0xE9, 0x9B, 0x21, 0x32, 0x04, 0x21, 0x2A, 0x03, 0x21, 0x34, 0x03, 0xC9, 0x01, 0x17, 0x18, 0x1A,
+    0x1B, 0x21, 0x27, 0x28, 0x2A, 0xFB, 0xAA, 0x7B, 0xCD, 0x00, 0x49, 0x00, 0x46, 0x00, 0x10, 0xD4,
+    0x30, 0x00, 0x03, 0xFB, 0xAD, 0x3D, 0x61, 0x61, 0x36, 0x01, 0x09, 0xCF, 0x62, 0x36, 0x39, 0x01,
+    0x0D, 0xE2, 0x01, 0x0D, 0xD9, 0xE5, 0x01, 0x15, 0x17, 0x23, 0x40, 0x01, 0x0B, 0x78, 0x01, 0x0C,
+    0xEC, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x00, 0xB8, 0xDC, 0x61, 0x1E, 0x01, 0x0D, 0xAC, 0x21,
+    0x21, 0x05, 0x21, 0x31, 0x03, 0x61, 0x17, 0x01, 0x03, 0xAB, 0x21, 0x19, 0x05, 0x21, 0x31, 0x03,
+    0xC1, 0x01, 0xF3, 0x9C, 0x21, 0x34, 0x04, 0x62, 0x23, 0x27, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x61,
+    0x41, 0x25, 0x64, 0x81, 0x21, 0x25, 0x04, 0x62, 0x31, 0x38, 0x00, 0x00, 0x03, 0x01, 0x0C, 0x85,
+    0x61, 0x28, 0x01, 0x0D, 0x4D, 0x21, 0x1A, 0x05, 0x21, 0x40, 0x03, 0x21, 0x34, 0x03, 0xE3, 0x01,
+    0x18, 0x23, 0x01, 0x0E, 0x08, 0x00, 0x00, 0x03, 0x01, 0x05, 0x00, 0x41, 0x20, 0xF1, 0xA3, 0x21,
+    0x42, 0x04, 0x21, 0x21, 0x03, 0xA1, 0x2A, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x17,
+    0x03, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x01, 0x03, 0xE8, 0x01, 0x15,
+    0x1A, 0x21, 0x30, 0x32, 0x42, 0x4C, 0x00, 0x00, 0x56, 0x00, 0x50, 0x04, 0x00, 0x00, 0x46, 0x00,
+    0xED, 0xFB, 0x01, 0x0E, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0x01, 0x0E, 0x7D, 0x62, 0x13,
+    0x32, 0x01, 0x0D, 0xD8, 0x01, 0x0E, 0x9E, 0xE8, 0x01, 0x04, 0x08, 0x15, 0x19, 0x1E, 0x20, 0x21,
+    0x00, 0x00, 0x95, 0x01, 0x0E, 0x6E, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x83, 0x00, 0x00, 0x2A, 0x00,
+    0xED, 0x90, 0x00, 0xD5, 0xCD, 0x00, 0x00, 0x09, 0x62, 0x14, 0x40, 0x01, 0x0E, 0xC8, 0x00, 0xBF,
+    0x3B, 0x21, 0x4C, 0x09, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x17, 0x03, 0x21, 0x40, 0x03, 0x63, 0x14, 0x27, 0x33,
+    0x01, 0x0E, 0xEC, 0x01, 0x0E, 0x31, 0x01, 0x0E, 0xEC, 0x41, 0x21, 0x9E, 0x18, 0x21, 0x31, 0x04,
+    0x21, 0x19, 0x03, 0x21, 0x07, 0x03, 0x21, 0x34, 0x03, 0x61, 0x17, 0x01, 0x0B, 0x9E, 0xE7, 0x17,
+    0x18, 0x19, 0x2D, 0x40, 0x41, 0x44, 0x00, 0x00, 0x22, 0x01, 0x0B, 0xA3, 0x00, 0x00, 0x08, 0x00,
+    0xF4, 0xA0, 0x00, 0xAA, 0x9E, 0x00, 0x00, 0x05, 0x00, 0xA6, 0xAA, 0xE7, 0x04, 0x08, 0x1B, 0x21,
+    0x23, 0x2A, 0x41, 0x01, 0x08, 0x3D, 0x01, 0x0F, 0x1B, 0x01, 0x0F, 0x27, 0x01, 0x0C, 0xDF, 0x01,
+    0x0E, 0x1F, 0x00, 0xDD, 0xEC, 0x00, 0x66, 0x66, 0xE5, 0x01, 0x13, 0x20, 0x21, 0x22, 0x01, 0x0F,
+    0x48, 0x00, 0xF1, 0x55, 0x01, 0x0E, 0xE2, 0x01, 0x0E, 0x49, 0x01, 0x0F, 0x2C, 0x62, 0x31, 0x32,
+    0x01, 0x0C, 0x4F, 0x01, 0x0F, 0x24, 0x21, 0x21, 0x09, 0x62, 0x34, 0x35, 0x00, 0x00, 0x03, 0x01,
+    0x0F, 0x69, 0x21, 0x21, 0x09, 0x41, 0x0E, 0x79, 0x5C, 0x62, 0x23, 0x30, 0x01, 0x0C, 0x0E, 0x01,
+    0x0F, 0x79, 0x62, 0x25, 0x35, 0x00, 0xD1, 0xDC, 0x01, 0x0E, 0xC7, 0x21, 0x0B, 0x09, 0xA2, 0x2A,
+    0x40, 0x15, 0x03, 0xE1, 0x23, 0x01, 0x0F, 0x3E, 0x63, 0x07, 0x19, 0x27, 0x00, 0x00, 0x05, 0x01,
+    0x0F, 0x98, 0x01, 0x0F, 0x98, 0x74, 0x01, 0x07, 0x08, 0x0A, 0x0D, 0x10, 0x14, 0x15, 0x16, 0x17,
+    0x19, 0x1A, 0x21, 0x22, 0x27, 0x28, 0x29, 0x2A, 0x48, 0x49, 0x00, 0x03, 0x26, 0x00, 0x02, 0x95,
+    0x00, 0xBB, 0x0F, 0x00, 0x02, 0x4B, 0x00, 0x02, 0x32, 0x00, 0x01, 0xDA, 0x00, 0x01, 0xB0, 0x00,
+    0x00, 0xFE, 0x00, 0xE3, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x97, 0x00, 0x00, 0x7A, 0x00, 0x00,
+    0x5D, 0x01, 0x0F, 0xA5, 0x01, 0x0F, 0xA5, 0x00, 0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x17,
+    0x01, 0x0E, 0xA0, 0x00, 0x00, 0x0D, 0x41, 0x29, 0xFC, 0xD8, 0xE7, 0x10, 0x14, 0x1D, 0x1F, 0x29,
+    0x2A, 0x42, 0x01, 0x0F, 0x9F, 0x00, 0xF5, 0x8C, 0x01, 0x0B, 0xEC, 0x01, 0x0E, 0xF8, 0x00, 0xFC,
+    0xDC, 0x01, 0x05, 0x4C, 0x00, 0x00, 0x04, 0xE4, 0x30, 0x32, 0x34, 0x35, 0x01, 0x10, 0x17, 0x01,
+    0x10, 0x17, 0x01, 0x0F, 0xDE, 0x01, 0x10, 0x17, 0x62, 0x32, 0x49, 0x01, 0x0F, 0xEF, 0x01, 0x09,
+    0x3A, 0xE6, 0x08, 0x0A, 0x14, 0x19, 0x27, 0x41, 0x00, 0xDD, 0x97, 0x01, 0x10, 0x24, 0x01, 0x09,
+    0x43, 0x00, 0x00, 0x09, 0x00, 0xCE, 0x26, 0x00, 0xDF, 0xA2, 0x41, 0x08, 0xDC, 0xD3, 0x63, 0x23,
+    0x32, 0x34, 0x00, 0xFF, 0xEB, 0x01, 0x10, 0x08, 0x00, 0x00, 0x04, 0x62, 0x23, 0x24, 0x01, 0x10,
+    0x42, 0x00, 0xDB, 0x33, 0xE3, 0x01, 0x19, 0x43, 0x01, 0x09, 0xC2, 0x01, 0x06, 0x24, 0x01, 0x10,
+    0x2B, 0x21, 0x19, 0x0D, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x42, 0x23, 0x40, 0xFB, 0xB4, 0x00,
+    0x03, 0x62, 0x31, 0x33, 0x01, 0x10, 0x32, 0x00, 0x00, 0x07, 0x41, 0x13, 0x7B, 0x3E, 0x22, 0x24,
+    0x34, 0x04, 0x04, 0x61, 0x19, 0x01, 0x07, 0x45, 0x21, 0x19, 0x05, 0x63, 0x31, 0x34, 0x39, 0x01,
+    0x10, 0x79, 0x00, 0x00, 0x03, 0x01, 0x0D, 0x8D, 0x42, 0x23, 0x32, 0xF5, 0xB8, 0xE5, 0x0B, 0x41,
+    0x01, 0xC8, 0x3A, 0x21, 0x34, 0x04, 0x41, 0x22, 0xCF, 0x4A, 0x21, 0x15, 0x04, 0x21, 0x34, 0x03,
+    0x21, 0x11, 0x03, 0x21, 0x13, 0x03, 0x62, 0x35, 0x38, 0x01, 0x10, 0xC6, 0x00, 0xEC, 0xC7, 0x62,
+    0x15, 0x23, 0x01, 0x10, 0x89, 0x00, 0x00, 0x09, 0x43, 0x1E, 0x31, 0x38, 0x7F, 0xA5, 0x00, 0x15,
+    0x00, 0x09, 0x41, 0x32, 0x27, 0x4B, 0x42, 0x23, 0x30, 0x00, 0x04, 0x95, 0x30, 0x62, 0x24, 0x25,
+    0x01, 0x00, 0x28, 0x01, 0x10, 0x27, 0x63, 0x01, 0x0E, 0x0F, 0x00, 0xDB, 0x9C, 0x01, 0x10, 0xF6,
+    0x01, 0x10, 0xF6, 0x21, 0x31, 0x0D, 0x62, 0x29, 0x2A, 0x01, 0x11, 0x06, 0x01, 0x11, 0x06, 0x62,
+    0x31, 0x32, 0x01, 0x10, 0xB1, 0x00, 0x00, 0x09, 0x62, 0x32, 0x4C, 0x01, 0x10, 0xDF, 0x01, 0x11,
+    0x18, 0x61, 0x08, 0x01, 0x10, 0xD8, 0x21, 0x0D, 0x05, 0x21, 0x31, 0x03, 0x62, 0x27, 0x32, 0x01,
+    0x0F, 0xE8, 0x00, 0xF5, 0xC4, 0x62, 0x07, 0x15, 0x01, 0x11, 0x35, 0x00, 0xFC, 0x6F, 0x62, 0x16,
+    0x19, 0x01, 0x10, 0x78, 0x00, 0xEE, 0x66, 0x41, 0x23, 0x22, 0x48, 0x45, 0x07, 0x23, 0x31, 0x34,
+    0x42, 0xC5, 0x84, 0x00, 0x1F, 0x00, 0x16, 0x00, 0x0D, 0x00, 0x04, 0x61, 0x02, 0x01, 0x11, 0x15,
+    0x21, 0x07, 0x05, 0x62, 0x21, 0x2B, 0x01, 0x10, 0xFD, 0x01, 0x11, 0x47, 0x44, 0x01, 0x32, 0x34,
+    0x35, 0xC8, 0xF7, 0xEA, 0xB8, 0x00, 0x0C, 0x00, 0x09, 0x62, 0x19, 0x22, 0x00, 0xFC, 0xCB, 0x01,
+    0x11, 0x79, 0x62, 0x14, 0x32, 0x01, 0x10, 0xBC, 0x01, 0x10, 0xC7, 0x42, 0x1A, 0x23, 0x00, 0x09,
+    0xE9, 0xA6, 0x21, 0x34, 0x07, 0x61, 0x01, 0x01, 0x02, 0x0A, 0x21, 0x38, 0x05, 0x62, 0x14, 0x25,
+    0x01, 0x10, 0xD7, 0x01, 0x10, 0xD7, 0xC5, 0x18, 0x19, 0x20, 0x27, 0x28, 0x00, 0x14, 0x00, 0x0C,
+    0x89, 0x32, 0x00, 0x09, 0xED, 0x25, 0x61, 0x32, 0x01, 0x0E, 0x9E, 0xA1, 0x19, 0x05, 0x43, 0x34,
+    0x35, 0x39, 0x01, 0x0F, 0x00, 0x03, 0x58, 0x57, 0xA1, 0x19, 0x0A, 0x42, 0x16, 0x42, 0x58, 0x6B,
+    0x69, 0xCF, 0x21, 0x1B, 0x07, 0x41, 0x17, 0xBE, 0xFF, 0x62, 0x07, 0x23, 0x01, 0x10, 0x9E, 0x00,
+    0xFE, 0xBB, 0x42, 0x22, 0x2D, 0xFE, 0xF8, 0x00, 0x09, 0xF9, 0x01, 0x04, 0x0D, 0x10, 0x14, 0x15,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x25, 0x27, 0x2A, 0x30, 0x31, 0x32, 0x34,
+    0x39, 0x40, 0x42, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x8E, 0x01, 0x11, 0x23, 0x01, 0x11, 0x8E, 0x00,
+    0x01, 0x68, 0x00, 0x01, 0x5B, 0x00, 0x01, 0x4E, 0x00, 0x01, 0x41, 0x00, 0x01, 0x36, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x03, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xDA, 0x00, 0x00, 0xD1,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x7D, 0x01, 0x11, 0xE9, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x43, 0x00, 0x00, 0x21, 0x00, 0x00, 0x17, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xE1, 0x23,
+    0x01, 0x0C, 0x9C, 0xE1, 0x23, 0x01, 0x02, 0x79, 0xE2, 0x04, 0x32, 0x00, 0xF9, 0xA4, 0x01, 0x0F,
+    0x4A, 0x41, 0x2A, 0xA7, 0x94, 0x62, 0x32, 0x4C, 0x00, 0x00, 0x04, 0x01, 0x12, 0x65, 0x21, 0x13,
+    0x09, 0x41, 0x33, 0x5D, 0xB1, 0x41, 0x38, 0xF5, 0x70, 0x41, 0x34, 0x4D, 0xB0, 0xC1, 0x18, 0x85,
+    0x0E, 0x61, 0x23, 0x01, 0x07, 0x86, 0x21, 0x22, 0x05, 0x21, 0x35, 0x03, 0x21, 0x01, 0x03, 0xC7,
+    0x04, 0x1A, 0x2A, 0x2D, 0x31, 0x32, 0x40, 0x00, 0x1E, 0x00, 0x1A, 0xA7, 0xC2, 0x00, 0x16, 0xB3,
+    0x67, 0x00, 0x12, 0x00, 0x03, 0xE5, 0x01, 0x07, 0x17, 0x23, 0x27, 0x01, 0x11, 0x6D, 0x01, 0x12,
+    0x4A, 0x01, 0x12, 0x98, 0x01, 0x04, 0xC4, 0x00, 0x63, 0x13, 0xE3, 0x01, 0x1B, 0x35, 0x00, 0x95,
+    0x09, 0x01, 0x10, 0x2A, 0x01, 0x12, 0xBA, 0x41, 0x23, 0xFD, 0x9C, 0x21, 0x39, 0x04, 0x41, 0x2A,
+    0xD5, 0x8E, 0x21, 0x07, 0x04, 0x21, 0x31, 0x03, 0x41, 0x17, 0x3E, 0x4C, 0x21, 0x31, 0x04, 0x21,
+    0x23, 0x03, 0xC5, 0x1A, 0x1E, 0x23, 0x28, 0x2D, 0x00, 0x17, 0xB2, 0x09, 0x00, 0x0D, 0x00, 0x03,
+    0xD8, 0x03, 0xA1, 0x4C, 0x10, 0x21, 0x23, 0x03, 0x61, 0x28, 0x01, 0x12, 0x9A, 0x21, 0x44, 0x05,
+    0x63, 0x0E, 0x15, 0x35, 0x00, 0x00, 0x0B, 0x01, 0x11, 0x4E, 0x00, 0x00, 0x03, 0x62, 0x38, 0x39,
+    0x01, 0x13, 0x0D, 0x01, 0x13, 0x0D, 0x62, 0x0A, 0x23, 0x00, 0x7C, 0xE0, 0x01, 0x0D, 0xEB, 0x63,
+    0x1A, 0x1B, 0x27, 0x01, 0x10, 0xF5, 0x00, 0x59, 0xBB, 0x00, 0xF5, 0x30, 0x41, 0x2D, 0x4C, 0x13,
+    0x21, 0x15, 0x04, 0x63, 0x0A, 0x17, 0x23, 0x00, 0x00, 0x14, 0x01, 0x13, 0x33, 0x00, 0x00, 0x03,
+    0xF6, 0x01, 0x02, 0x04, 0x07, 0x0A, 0x0D, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x00, 0x03, 0x46, 0x01, 0x12, 0xE8, 0x00, 0x03, 0x29,
+    0x00, 0x03, 0x0F, 0x00, 0x01, 0x57, 0x00, 0x00, 0xF2, 0x01, 0x13, 0x40, 0x00, 0x00, 0xED, 0x01,
+    0x13, 0x40, 0x00, 0x00, 0xE8, 0x00, 0xF5, 0x55, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xB1, 0x00, 0x00,
+    0x9B, 0x00, 0x00, 0x86, 0x01, 0x12, 0x7A, 0x00, 0x00, 0x40, 0x01, 0x12, 0x7A, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x2A, 0x00, 0xF8, 0x50, 0x00, 0x00, 0x0D, 0x63, 0x31, 0x32, 0x36, 0x01, 0x06, 0xCD,
+    0x01, 0x12, 0xDE, 0x01, 0x13, 0x8F, 0x62, 0x19, 0x41, 0x01, 0x13, 0x40, 0x01, 0x12, 0x1E, 0x21,
+    0x30, 0x09, 0x62, 0x27, 0x49, 0x01, 0x13, 0x79, 0x01, 0x0F, 0xA4, 0x63, 0x07, 0x32, 0x33, 0x01,
+    0x00, 0xF5, 0x00, 0xF6, 0xDF, 0x01, 0x13, 0xBB, 0x62, 0x14, 0x2A, 0x01, 0x13, 0xC8, 0x01, 0x13,
+    0xC8, 0x21, 0x31, 0x09, 0x64, 0x02, 0x17, 0x1E, 0x23, 0x00, 0x3C, 0x82, 0x01, 0x0F, 0x12, 0x01,
+    0x13, 0x19, 0x01, 0x13, 0xD4, 0x62, 0x1E, 0x22, 0x01, 0x13, 0xAC, 0x01, 0x13, 0x66, 0x62, 0x1E,
+    0x23, 0x01, 0x13, 0xEE, 0x01, 0x13, 0xEE, 0xF1, 0x04, 0x07, 0x08, 0x0B, 0x1A, 0x1C, 0x1E, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x00, 0xF7, 0x17, 0x01, 0x06, 0x16, 0x01,
+    0x08, 0x24, 0x00, 0x49, 0xF6, 0x00, 0xF7, 0x17, 0x01, 0x13, 0x31, 0x00, 0x00, 0x5E, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x45, 0x00, 0x00, 0x3C, 0x00, 0xDF, 0xA0, 0x01, 0x13, 0xED, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x12, 0x01, 0x11, 0xE4, 0x00, 0x00, 0x09, 0x41, 0x42, 0xD2, 0xE5,
+    0x61, 0x2D, 0x01, 0x04, 0x23, 0x21, 0x21, 0x05, 0x61, 0x14, 0x01, 0x0C, 0x66, 0x21, 0x35, 0x05,
+    0x41, 0x2A, 0xF4, 0x1A, 0x21, 0x08, 0x04, 0x21, 0x40, 0x03, 0x21, 0x14, 0x03, 0x21, 0x44, 0x03,
+    0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x14, 0x03, 0x22, 0x2A, 0x40, 0x1F,
+    0x03, 0xE2, 0x1A, 0x23, 0x00, 0x68, 0x28, 0x01, 0x13, 0x72, 0x62, 0x14, 0x23, 0x01, 0x14, 0x7A,
+    0x00, 0xDA, 0x8D, 0x21, 0x32, 0x09, 0x61, 0x01, 0x01, 0x04, 0xB9, 0x62, 0x23, 0x27, 0x01, 0x03,
+    0xAB, 0x00, 0xDD, 0x66, 0xEF, 0x01, 0x07, 0x0A, 0x14, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x22, 0x27,
+    0x29, 0x2D, 0x40, 0x49, 0x01, 0x02, 0xE5, 0x00, 0x00, 0x58, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x28,
+    0x00, 0xEF, 0x73, 0x01, 0x14, 0x94, 0x00, 0x00, 0x23, 0x00, 0x70, 0x9A, 0x01, 0x14, 0x94, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x0E, 0x01, 0x02, 0xCA, 0x00, 0xCB, 0x1B, 0x00, 0x00, 0x09, 0x01, 0x03,
+    0x5A, 0x41, 0x22, 0xEF, 0xA9, 0x41, 0x2A, 0xC1, 0x45, 0x22, 0x2D, 0x34, 0x08, 0x04, 0x62, 0x1E,
+    0x1F, 0x00, 0xF4, 0xA8, 0x01, 0x14, 0xDE, 0x43, 0x2D, 0x34, 0x35, 0x0F, 0x88, 0x8D, 0x79, 0x00,
+    0x09, 0x41, 0x27, 0xEF, 0xC9, 0xC3, 0x25, 0x31, 0x34, 0xA2, 0x2E, 0xD5, 0xA5, 0x00, 0x04, 0xC1,
+    0x23, 0xFE, 0xDC, 0x41, 0x1A, 0xFC, 0xC0, 0x63, 0x2D, 0x31, 0x35, 0x00, 0xF0, 0x0C, 0x00, 0x00,
+    0x04, 0x01, 0x13, 0x09, 0x42, 0x25, 0x27, 0xED, 0xCB, 0xD7, 0x6E, 0x21, 0x34, 0x07, 0x41, 0x23,
+    0x8B, 0x1D, 0xE2, 0x32, 0x34, 0x00, 0x00, 0x04, 0x01, 0x13, 0x24, 0x62, 0x2D, 0x35, 0x01, 0x15,
+    0x2B, 0x01, 0x14, 0xDC, 0xC1, 0x35, 0xD6, 0x9F, 0x62, 0x2D, 0x34, 0x00, 0xDB, 0x47, 0x01, 0x14,
+    0x33, 0x61, 0x25, 0x01, 0x14, 0x48, 0x21, 0x31, 0x05, 0x41, 0x0B, 0xF5, 0x13, 0x21, 0x27, 0x04,
+    0x62, 0x0A, 0x17, 0x01, 0x14, 0x4E, 0x01, 0x15, 0x34, 0x62, 0x0B, 0x17, 0x01, 0x14, 0x93, 0x01,
+    0x15, 0x3D, 0x22, 0x04, 0x19, 0x12, 0x09, 0x62, 0x1E, 0x47, 0x00, 0xD8, 0x71, 0x01, 0x12, 0x59,
+    0x62, 0x25, 0x2D, 0x01, 0x15, 0x70, 0x00, 0x4A, 0x03, 0x41, 0x01, 0x66, 0xCE, 0x42, 0x01, 0x04,
+    0xF0, 0x55, 0xF5, 0x47, 0x63, 0x23, 0x25, 0x2D, 0x00, 0xF8, 0xCC, 0x00, 0x00, 0x07, 0x01, 0x14,
+    0x91, 0x41, 0x2D, 0x10, 0x32, 0x62, 0x0A, 0x17, 0x01, 0x15, 0x95, 0x01, 0x15, 0x95, 0x21, 0x4C,
+    0x09, 0x21, 0x23, 0x03, 0x21, 0x34, 0x03, 0x6B, 0x04, 0x08, 0x0B, 0x17, 0x19, 0x1A, 0x1F, 0x21,
+    0x25, 0x27, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x45, 0x00, 0x00, 0x40, 0x00, 0x00, 0x37, 0x00,
+    0xEA, 0x75, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x23, 0x00, 0x06, 0xAE, 0x01, 0x03, 0x3F, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x03, 0x41, 0x04, 0xD7, 0x78, 0x63, 0x1E, 0x25, 0x2D, 0x01, 0x14, 0xE5, 0x00,
+    0xD7, 0x4F, 0x00, 0x00, 0x04, 0x61, 0x23, 0x01, 0x15, 0x87, 0x21, 0x17, 0x05, 0x21, 0x42, 0x03,
+    0x21, 0x19, 0x03, 0x21, 0x2D, 0x03, 0xA1, 0x04, 0x03, 0x62, 0x15, 0x17, 0x01, 0x15, 0xF9, 0x00,
+    0x00, 0x03, 0x21, 0x21, 0x09, 0x41, 0x04, 0xF0, 0xC9, 0x21, 0x40, 0x04, 0x63, 0x0B, 0x17, 0x27,
+    0x00, 0x00, 0x03, 0x01, 0x15, 0x19, 0x00, 0xD8, 0x66, 0xE2, 0x1E, 0x23, 0x01, 0x15, 0xBB, 0x01,
+    0x13, 0x31, 0xF5, 0x01, 0x04, 0x08, 0x0B, 0x14, 0x15, 0x1A, 0x1E, 0x1F, 0x21, 0x23, 0x25, 0x27,
+    0x2A, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x48, 0x49, 0x00, 0x8E, 0xB0, 0x00, 0xD6, 0x79, 0x00, 0x01,
+    0x49, 0x00, 0x01, 0x3B, 0x00, 0x01, 0x2D, 0x01, 0x16, 0x22, 0x00, 0x01, 0x23, 0x00, 0x01, 0x1B,
+    0x00, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0xEE, 0x00, 0x00, 0xEA, 0x00,
+    0xD7, 0xE0, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x16, 0x01, 0x16, 0x22, 0x00, 0x00, 0x09, 0x63, 0x01, 0x07, 0x49, 0x01, 0x12, 0x52, 0x01, 0x16,
+    0x77, 0x01, 0x16, 0x6D, 0x41, 0x2A, 0xFD, 0xFE, 0xA1, 0x40, 0x04, 0xC2, 0x23, 0x40, 0xFA, 0xFE,
+    0x2B, 0x94, 0x21, 0x19, 0x07, 0xC1, 0x1F, 0xDE, 0xDD, 0x62, 0x19, 0x2D, 0x01, 0x16, 0x99, 0x00,
+    0x00, 0x04, 0x23, 0x2D, 0x48, 0x49, 0x1A, 0x10, 0x09, 0xE6, 0x01, 0x0A, 0x21, 0x32, 0x40, 0x4C,
+    0x01, 0x13, 0x3E, 0x00, 0xF1, 0xC9, 0x01, 0x07, 0x1E, 0x01, 0x16, 0xA9, 0x00, 0x3D, 0xB1, 0x01,
+    0x16, 0xA9, 0x64, 0x32, 0x34, 0x38, 0x49, 0x01, 0x16, 0x89, 0x01, 0x16, 0xC1, 0x01, 0x16, 0x07,
+    0x01, 0x16, 0x89, 0xE4, 0x02, 0x06, 0x23, 0x29, 0x00, 0x00, 0x2A, 0x01, 0x13, 0xC1, 0x00, 0x00,
+    0x11, 0x01, 0x13, 0x68, 0xC2, 0x23, 0x40, 0x51, 0x65, 0xBE, 0x87, 0xE4, 0x19, 0x32, 0x34, 0x35,
+    0x01, 0x07, 0x7E, 0x01, 0x16, 0xEB, 0x00, 0x00, 0x07, 0x01, 0x16, 0xEB, 0x62, 0x18, 0x23, 0x01,
+    0x16, 0xE0, 0x01, 0x16, 0xFC, 0xE1, 0x41, 0x01, 0x08, 0xFD, 0x41, 0x23, 0xCB, 0xBC, 0x62, 0x02,
+    0x1F, 0x01, 0x16, 0x8F, 0x01, 0x17, 0x0E, 0xA1, 0x44, 0x09, 0x62, 0x30, 0x32, 0x01, 0x17, 0x1A,
+    0x00, 0xFA, 0x3E, 0x61, 0x23, 0x01, 0x16, 0x13, 0xC4, 0x1B, 0x2D, 0x40, 0x42, 0x1D, 0x51, 0xFB,
+    0x7C, 0x00, 0x05, 0x7A, 0xC7, 0xC1, 0x23, 0xCD, 0xB5, 0xC1, 0x23, 0xEF, 0xAB, 0x64, 0x07, 0x19,
+    0x21, 0x22, 0x00, 0x00, 0x15, 0x01, 0x17, 0x3D, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x41, 0x19,
+    0xF6, 0xAA, 0x21, 0x34, 0x04, 0xA1, 0x01, 0x03, 0x21, 0x07, 0x03, 0xF2, 0x01, 0x02, 0x07, 0x08,
+    0x0A, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x29, 0x2B, 0x48, 0x49, 0x00, 0x00,
+    0x88, 0x00, 0xFB, 0x49, 0x00, 0xAA, 0x18, 0x00, 0x00, 0x70, 0x01, 0x16, 0xF5, 0x01, 0x17, 0x5B,
+    0x01, 0x17, 0x5B, 0x00, 0x00, 0x5F, 0x00, 0x27, 0xC5, 0x00, 0x00, 0x56, 0x00, 0x00, 0x51, 0x00,
+    0x00, 0x44, 0x01, 0x17, 0x5B, 0x01, 0x14, 0x77, 0x00, 0x2D, 0x9E, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x03, 0x41, 0x1A, 0xD5, 0x32, 0xC2, 0x35, 0x40, 0xEC, 0x6F, 0x00, 0x04, 0x41,
+    0x40, 0xC8, 0x22, 0x62, 0x34, 0x35, 0x00, 0x00, 0x04, 0x01, 0x17, 0xB3, 0xE6, 0x01, 0x0A, 0x20,
+    0x25, 0x34, 0x35, 0x01, 0x16, 0x84, 0x01, 0x16, 0xF6, 0x00, 0xD6, 0xCA, 0x01, 0x0D, 0x7C, 0x01,
+    0x02, 0x3F, 0x01, 0x17, 0xBC, 0x41, 0x42, 0xD9, 0x40, 0x62, 0x25, 0x35, 0x00, 0xE0, 0x8D, 0x01,
+    0x17, 0x1E, 0x61, 0x47, 0x01, 0x04, 0xA5, 0x43, 0x1A, 0x21, 0x25, 0x00, 0x0E, 0xF7, 0xC2, 0x00,
+    0x05, 0x62, 0x34, 0x38, 0x01, 0x17, 0xA2, 0x01, 0x07, 0x3D, 0x62, 0x31, 0x35, 0x01, 0x17, 0xC1,
+    0x01, 0x17, 0xFA, 0xE7, 0x04, 0x08, 0x15, 0x17, 0x21, 0x2A, 0x44, 0x00, 0x00, 0x12, 0x00, 0xF1,
+    0x80, 0x01, 0x16, 0xFA, 0x00, 0x00, 0x09, 0x01, 0x17, 0xFF, 0x00, 0xE3, 0xAC, 0x00, 0xDD, 0x93,
+    0xEA, 0x08, 0x14, 0x17, 0x1A, 0x1B, 0x2A, 0x40, 0x44, 0x48, 0x49, 0x01, 0x08, 0x46, 0x01, 0x18,
+    0x20, 0x00, 0x00, 0x78, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x39,
+    0x00, 0xE0, 0xB1, 0x01, 0x18, 0x20, 0x00, 0x00, 0x1D, 0x61, 0x20, 0x01, 0x14, 0xDE, 0x21, 0x2A,
+    0x05, 0x21, 0x16, 0x03, 0xE2, 0x04, 0x10, 0x01, 0x15, 0x46, 0x01, 0x17, 0xF9, 0x21, 0x2B, 0x09,
+    0x61, 0x47, 0x01, 0x18, 0x60, 0x21, 0x17, 0x05, 0x21, 0x25, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x0B,
+    0x03, 0x21, 0x01, 0x03, 0x21, 0x2D, 0x03, 0x62, 0x01, 0x22, 0x01, 0x17, 0xF2, 0x00, 0xC6, 0xCB,
+    0xE5, 0x18, 0x1C, 0x23, 0x40, 0x42, 0x01, 0x18, 0x76, 0x01, 0x13, 0xBE, 0x01, 0x11, 0xDA, 0x00,
+    0x00, 0x09, 0x00, 0x34, 0xD0, 0x62, 0x15, 0x23, 0x01, 0x18, 0x79, 0x01, 0x18, 0x95, 0x21, 0x15,
+    0x09, 0x21, 0x34, 0x03, 0x61, 0x43, 0x01, 0x16, 0x73, 0x21, 0x33, 0x05, 0x21, 0x49, 0x03, 0x41,
+    0x28, 0x8B, 0x59, 0x21, 0x07, 0x04, 0x41, 0x34, 0x5F, 0x72, 0x21, 0x23, 0x04, 0x21, 0x34, 0x03,
+    0x41, 0x19, 0xF3, 0xE4, 0x41, 0x04, 0x3D, 0xB1, 0x21, 0x31, 0x04, 0x21, 0x21, 0x03, 0x22, 0x31,
+    0x32, 0x0E, 0x03, 0x21, 0x32, 0x08, 0xA1, 0x2A, 0x03, 0x21, 0x08, 0x03, 0xC9, 0x08, 0x19, 0x1E,
+    0x21, 0x24, 0x27, 0x28, 0x2A, 0x43, 0x00, 0x3B, 0x00, 0x30, 0xB8, 0x03, 0xFB, 0xDB, 0xE3, 0x82,
+    0x00, 0x29, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x03, 0x63, 0x07, 0x19, 0x21, 0x01, 0x18, 0xF8, 0x01,
+    0x18, 0xF8, 0x00, 0x00, 0x1C, 0xE2, 0x04, 0x21, 0x01, 0x12, 0x17, 0x01, 0x18, 0xB6, 0xC1, 0x1E,
+    0xC8, 0xB0, 0xE4, 0x07, 0x19, 0x22, 0x41, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0x01, 0x19, 0x12,
+    0x00, 0xE7, 0x01, 0xE2, 0x01, 0x41, 0x01, 0x16, 0xF9, 0x00, 0xB8, 0x15, 0xE4, 0x07, 0x19, 0x22,
+    0x40, 0x00, 0x00, 0x09, 0x01, 0x19, 0x2C, 0x01, 0x19, 0x2C, 0x00, 0x2E, 0x35, 0x63, 0x1B, 0x23,
+    0x2B, 0x01, 0x19, 0x3D, 0x01, 0x19, 0x3D, 0x01, 0x18, 0xBE, 0xE3, 0x23, 0x40, 0x44, 0x01, 0x13,
+    0x2B, 0x00, 0x77, 0xF9, 0x00, 0x00, 0x0D, 0x66, 0x19, 0x21, 0x27, 0x2D, 0x32, 0x33, 0x01, 0x19,
+    0x57, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x45, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x0D,
+    0xE3, 0x01, 0x02, 0x44, 0x00, 0xF3, 0x90, 0x01, 0x19, 0x1B, 0x00, 0xD4, 0x39, 0xE2, 0x15, 0x23,
+    0x01, 0x19, 0x7D, 0x01, 0x19, 0x44, 0x61, 0x2D, 0x01, 0x06, 0x54, 0xA1, 0x40, 0x05, 0x23, 0x07,
+    0x19, 0x22, 0x1E, 0x11, 0x03, 0xE1, 0x32, 0x01, 0x17, 0x64, 0xA1, 0x01, 0x05, 0xE1, 0x23, 0x01,
+    0x19, 0x42, 0xE4, 0x07, 0x19, 0x22, 0x27, 0x01, 0x19, 0xA2, 0x01, 0x19, 0xA2, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x05, 0x63, 0x19, 0x2D, 0x32, 0x01, 0x19, 0xB3, 0x00, 0x00, 0x25, 0x00, 0x00, 0x11,
+    0x7F, 0x21, 0x01, 0x07, 0x08, 0x0A, 0x13, 0x14, 0x15, 0x16, 0x19, 0x1A, 0x1E, 0x21, 0x22, 0x27,
+    0x28, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x42,
+    0x47, 0x48, 0x49, 0x00, 0x12, 0x1F, 0x00, 0x12, 0x05, 0x00, 0x11, 0xEF, 0x00, 0x11, 0xD9, 0x00,
+    0x11, 0xA8, 0x00, 0x11, 0x98, 0x00, 0x11, 0x8F, 0x00, 0x11, 0x6D, 0x01, 0x19, 0xC0, 0x00, 0x11,
+    0x66, 0x00, 0x11, 0x5C, 0x00, 0x11, 0x4C, 0x00, 0x11, 0x3F, 0x00, 0x10, 0xFB, 0x01, 0x18, 0x48,
+    0x00, 0x10, 0xBB, 0x00, 0x10, 0xAA, 0x00, 0x10, 0x49, 0x00, 0x0D, 0xCC, 0x00, 0x0A, 0x1B, 0x00,
+    0x06, 0x80, 0x00, 0x05, 0xC9, 0x00, 0x05, 0x2C, 0x00, 0x03, 0x9E, 0x00, 0x03, 0x49, 0x00, 0x03,
+    0x1E, 0x00, 0x02, 0x65, 0x00, 0x01, 0xA0, 0x00, 0x01, 0x6F, 0x00, 0x01, 0x63, 0x00, 0x01, 0x4C,
+    0x00, 0x00, 0x69, 0x00, 0x00, 0x0D, 0x62, 0x13, 0x4C, 0x01, 0x16, 0xDB, 0x00, 0x8E, 0x84, 0x21,
+    0x29, 0x09, 0x62, 0x32, 0x38, 0x01, 0x19, 0xA0, 0x01, 0x1A, 0x52, 0x42, 0x35, 0x39, 0xEE, 0x34,
+    0x0C, 0x3B, 0x41, 0x4C, 0x79, 0xB4, 0x21, 0x04, 0x04, 0x21, 0x07, 0x03, 0x21, 0x23, 0x03, 0x63,
+    0x13, 0x44, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x1A, 0x26, 0x01, 0x1A, 0x6F, 0x62, 0x32, 0x34, 0x01,
+    0x1A, 0x7C, 0x00, 0x00, 0x0D, 0x62, 0x18, 0x31, 0x00, 0x00, 0x09, 0x01, 0x19, 0xCA, 0x63, 0x20,
+    0x22, 0x35, 0x01, 0x1A, 0x8E, 0x01, 0x1A, 0x28, 0x01, 0x1A, 0x8E, 0x61, 0x38, 0x01, 0x19, 0x73,
+    0xE6, 0x0A, 0x14, 0x17, 0x29, 0x2A, 0x40, 0x00, 0x00, 0x05, 0x01, 0x19, 0xDA, 0x00, 0xFF, 0x1D,
+    0x01, 0x19, 0xDA, 0x01, 0x18, 0x76, 0x01, 0x08, 0xD6, 0x6A, 0x01, 0x04, 0x0A, 0x13, 0x14, 0x15,
+    0x17, 0x29, 0x32, 0x45, 0x00, 0x00, 0x6A, 0x00, 0x11, 0xBE, 0x00, 0x00, 0x67, 0x01, 0x1A, 0xB9,
+    0x00, 0x00, 0x5E, 0x01, 0x1A, 0xB9, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x19, 0x62, 0x32, 0x38, 0x01, 0x1A, 0x9C, 0x01, 0x18, 0xB1, 0x41, 0x38, 0xF3, 0xFD, 0xC2,
+    0x08, 0x20, 0xF8, 0x17, 0xD9, 0xFD, 0x21, 0x38, 0x07, 0x62, 0x25, 0x32, 0x01, 0x15, 0x47, 0x01,
+    0x1A, 0xF9, 0x62, 0x31, 0x48, 0x01, 0x1A, 0xC9, 0x00, 0xFE, 0xF4, 0x64, 0x2D, 0x38, 0x48, 0x49,
+    0x01, 0x1B, 0x01, 0x01, 0x1A, 0xD2, 0x01, 0x1A, 0xA5, 0x00, 0xC9, 0xA8, 0x62, 0x37, 0x38, 0x01,
+    0x13, 0xE3, 0x01, 0x1B, 0x12, 0x62, 0x35, 0x37, 0x01, 0x1A, 0xD6, 0x01, 0x1A, 0xD0, 0x62, 0x31,
+    0x32, 0x01, 0x1B, 0x2D, 0x01, 0x1B, 0x2D, 0x61, 0x32, 0x01, 0x19, 0xE5, 0x62, 0x07, 0x2D, 0x01,
+    0x00, 0xCE, 0x01, 0x1A, 0x81, 0x64, 0x02, 0x14, 0x1B, 0x23, 0x01, 0x1B, 0x44, 0x01, 0x1B, 0x3B,
+    0x01, 0x16, 0x4C, 0x01, 0x1B, 0x3B, 0x62, 0x17, 0x23, 0x00, 0xF7, 0x57, 0x01, 0x1B, 0x4C, 0xF3,
+    0x01, 0x02, 0x04, 0x0A, 0x15, 0x17, 0x19, 0x1C, 0x1D, 0x1E, 0x21, 0x22, 0x23, 0x2A, 0x2B, 0x2D,
+    0x40, 0x41, 0x42, 0x00, 0x00, 0x66, 0x00, 0x00, 0x5D, 0x01, 0x1B, 0x0A, 0x00, 0xCA, 0x9C, 0x01,
+    0x1A, 0x56, 0x00, 0x00, 0x54, 0x01, 0x1A, 0xF9, 0x01, 0x1A, 0x99, 0x00, 0xF4, 0xDC, 0x00, 0x00,
+    0x43, 0x00, 0x00, 0x3A, 0x01, 0x1A, 0xF9, 0x00, 0x00, 0x31, 0x01, 0x0D, 0x57, 0x01, 0x00, 0xF1,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x09, 0xC1, 0x27, 0x8C, 0xA8,
+    0xE2, 0x25, 0x32, 0x01, 0x18, 0x45, 0x00, 0x00, 0x04, 0xE2, 0x04, 0x25, 0x00, 0xB9, 0xA9, 0x01,
+    0x1B, 0x5E, 0x41, 0x25, 0xD0, 0x74, 0xE6, 0x21, 0x23, 0x25, 0x2B, 0x2D, 0x42, 0x01, 0x1B, 0xC6,
+    0x01, 0x17, 0xB8, 0x01, 0x1B, 0xB6, 0x00, 0x00, 0x04, 0x01, 0x1B, 0xBC, 0x01, 0x02, 0x03, 0x62,
+    0x1A, 0x38, 0x01, 0x1A, 0x2A, 0x00, 0xFF, 0x27, 0x61, 0x36, 0x01, 0x14, 0xAF, 0x41, 0x21, 0x61,
+    0x78, 0x21, 0x25, 0x04, 0x21, 0x19, 0x03, 0x42, 0x27, 0x30, 0x00, 0x03, 0xBF, 0xA9, 0x62, 0x23,
+    0x32, 0x00, 0xC7, 0x29, 0x01, 0x1B, 0xFD, 0x41, 0x48, 0xFF, 0xF9, 0x41, 0x2A, 0xFE, 0x18, 0x62,
+    0x14, 0x25, 0x01, 0x1C, 0x05, 0x01, 0x17, 0x16, 0xEF, 0x01, 0x02, 0x04, 0x07, 0x08, 0x17, 0x1A,
+    0x1B, 0x1E, 0x25, 0x27, 0x32, 0x40, 0x41, 0x46, 0x00, 0xF6, 0x1F, 0x00, 0x00, 0x30, 0x01, 0x17,
+    0x56, 0x01, 0x14, 0x36, 0x01, 0x0E, 0x37, 0x00, 0x00, 0x21, 0x01, 0x1C, 0x17, 0x00, 0x00, 0x1A,
+    0x00, 0x98, 0x4F, 0x01, 0x10, 0xC6, 0x00, 0x00, 0x11, 0x01, 0x1B, 0xC9, 0x00, 0x00, 0x0D, 0x00,
+    0x00, 0x09, 0x01, 0x1C, 0x18, 0x41, 0x23, 0xE3, 0x9D, 0x62, 0x0E, 0x0F, 0x01, 0x1C, 0x59, 0x01,
+    0x1C, 0x59, 0x63, 0x19, 0x32, 0x34, 0x01, 0x1B, 0xFC, 0x00, 0x00, 0x09, 0x01, 0x19, 0x54, 0xE2,
+    0x04, 0x15, 0x01, 0x1C, 0x53, 0x01, 0x1C, 0x09, 0x62, 0x25, 0x30, 0x01, 0x13, 0x2A, 0x01, 0x1C,
+    0x78, 0x67, 0x01, 0x07, 0x13, 0x14, 0x19, 0x30, 0x34, 0x01, 0x1C, 0x81, 0x00, 0x00, 0x12, 0x01,
+    0x19, 0x16, 0x01, 0x14, 0xA3, 0x00, 0x00, 0x09, 0x01, 0x1C, 0x81, 0x01, 0x1B, 0xCC, 0xE2, 0x01,
+    0x42, 0x01, 0x1C, 0x9E, 0x00, 0xED, 0xD9, 0x21, 0x38, 0x09, 0x41, 0x17, 0x5D, 0x9A, 0x21, 0x34,
+    0x04, 0x21, 0x23, 0x03, 0xE4, 0x25, 0x32, 0x40, 0x41, 0x01, 0x1A, 0x8A, 0x00, 0x00, 0x03, 0x00,
+    0xEB, 0xEF, 0x01, 0x02, 0xF1, 0x41, 0x08, 0xEA, 0xD3, 0x21, 0x34, 0x04, 0xE6, 0x01, 0x08, 0x14,
+    0x40, 0x43, 0x44, 0x01, 0x1B, 0xC0, 0x00, 0x00, 0x03, 0x01, 0x1C, 0x06, 0x00, 0xAC, 0xEF, 0x00,
+    0xA8, 0xAC, 0x01, 0x1C, 0x93, 0xE1, 0x4C, 0x01, 0x1A, 0xB4, 0x61, 0x23, 0x01, 0x1B, 0xEB, 0x21,
+    0x2D, 0x05, 0x21, 0x15, 0x03, 0x21, 0x40, 0x03, 0x62, 0x23, 0x2D, 0x01, 0x08, 0x32, 0x01, 0x1C,
+    0xBF, 0x41, 0x19, 0xFE, 0x42, 0x21, 0x19, 0x04, 0x21, 0x17, 0x03, 0xE3, 0x14, 0x17, 0x40, 0x00,
+    0x00, 0x13, 0x01, 0x1B, 0xFF, 0x00, 0x00, 0x03, 0xE1, 0x01, 0x01, 0x1C, 0xC6, 0x41, 0x1A, 0xEC,
+    0x58, 0xE4, 0x0A, 0x1A, 0x1E, 0x40, 0x01, 0x15, 0x00, 0x01, 0x12, 0xE1, 0x01, 0x12, 0xE1, 0x00,
+    0x00, 0x04, 0x61, 0x32, 0x01, 0x1D, 0x1F, 0xEC, 0x04, 0x0A, 0x14, 0x15, 0x19, 0x1A, 0x1F, 0x25,
+    0x2A, 0x40, 0x41, 0x46, 0x01, 0x1C, 0xE2, 0x01, 0x1B, 0x0D, 0x01, 0x12, 0xF7, 0x01, 0x1C, 0x2E,
+    0x00, 0xAD, 0xC0, 0x00, 0x00, 0x05, 0x01, 0x18, 0x75, 0x01, 0x16, 0x49, 0x01, 0x1B, 0x0D, 0x00,
+    0x8B, 0xEA, 0x01, 0x1A, 0x04, 0x01, 0x1D, 0x37, 0x41, 0x23, 0x1A, 0x96, 0x62, 0x14, 0x40, 0x01,
+    0x1D, 0x6C, 0x00, 0x00, 0x04, 0x21, 0x4C, 0x09, 0x42, 0x0B, 0x40, 0x93, 0x9B, 0x00, 0x10, 0x21,
+    0x4C, 0x07, 0x41, 0x08, 0xB6, 0x56, 0x21, 0x40, 0x04, 0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0x21,
+    0x41, 0x03, 0x6E, 0x01, 0x07, 0x08, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x27, 0x2A, 0x2D,
+    0x41, 0x00, 0x00, 0xDE, 0x00, 0x00, 0xC6, 0x00, 0xE3, 0xC2, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x9D,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x71, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x1D, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0x03, 0x01, 0x1D, 0x92, 0x01, 0x0D, 0x72, 0x63, 0x23, 0x34, 0x36, 0x00,
+    0x29, 0x1D, 0x01, 0x1D, 0xCB, 0x01, 0x1D, 0xCA, 0x63, 0x32, 0x34, 0x39, 0x01, 0x1D, 0x89, 0x01,
+    0x1D, 0x89, 0x01, 0x1D, 0xD8, 0x62, 0x08, 0x19, 0x00, 0xEB, 0xF3, 0x01, 0x1D, 0xE5, 0x21, 0x34,
+    0x09, 0x64, 0x21, 0x2D, 0x31, 0x37, 0x01, 0x1D, 0xF1, 0x01, 0x1D, 0xE7, 0x01, 0x1D, 0xA2, 0x01,
+    0x1D, 0x9C, 0xE2, 0x14, 0x19, 0x01, 0x1E, 0x02, 0x01, 0x1E, 0x02, 0x66, 0x31, 0x32, 0x37, 0x38,
+    0x48, 0x49, 0x01, 0x19, 0x81, 0x01, 0x04, 0x9C, 0x01, 0x1D, 0xB6, 0x00, 0x00, 0x09, 0x01, 0x15,
+    0xEA, 0x01, 0x1B, 0xE1, 0x63, 0x19, 0x1A, 0x22, 0x01, 0x1E, 0x24, 0x01, 0x1E, 0x24, 0x01, 0x1E,
+    0x24, 0x62, 0x27, 0x32, 0x01, 0x1E, 0x27, 0x00, 0xBD, 0xF4, 0x68, 0x14, 0x27, 0x2D, 0x31, 0x32,
+    0x34, 0x38, 0x49, 0x01, 0x1E, 0x3A, 0x01, 0x1D, 0x7F, 0x01, 0x1E, 0x39, 0x01, 0x1B, 0x82, 0x00,
+    0x00, 0x16, 0x01, 0x1A, 0x22, 0x01, 0x12, 0xA8, 0x00, 0x00, 0x09, 0x63, 0x25, 0x32, 0x49, 0x01,
+    0x1E, 0x5B, 0x01, 0x1B, 0xA3, 0x00, 0xA6, 0x46, 0xC1, 0x17, 0x8D, 0x62, 0x21, 0x19, 0x04, 0x65,
+    0x21, 0x25, 0x32, 0x38, 0x49, 0x01, 0x13, 0xC1, 0x01, 0x1E, 0x1D, 0x00, 0x00, 0x03, 0x01, 0x19,
+    0xE5, 0x01, 0x1A, 0x61, 0x64, 0x07, 0x2D, 0x32, 0x38, 0x01, 0x1E, 0x84, 0x01, 0x1E, 0x7A, 0x01,
+    0x1D, 0xC9, 0x01, 0x1A, 0x32, 0x65, 0x2D, 0x32, 0x34, 0x35, 0x47, 0x01, 0x1E, 0x95, 0x01, 0x1B,
+    0x2A, 0x01, 0x11, 0xC9, 0x01, 0x14, 0xE8, 0x01, 0x1E, 0x46, 0x66, 0x07, 0x22, 0x32, 0x34, 0x35,
+    0x49, 0x01, 0x1E, 0xAA, 0x01, 0x1E, 0xAA, 0x01, 0x1B, 0x3F, 0x01, 0x1E, 0xA0, 0x01, 0x14, 0xFD,
+    0x01, 0x1E, 0x44, 0x62, 0x07, 0x49, 0x01, 0x1E, 0xC3, 0x01, 0x1E, 0x8A, 0x62, 0x22, 0x35, 0x01,
+    0x1E, 0xCC, 0x01, 0x07, 0x53, 0x66, 0x1A, 0x21, 0x25, 0x27, 0x2B, 0x2D, 0x01, 0x06, 0xE5, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01, 0x15, 0x24, 0x63, 0x21,
+    0x27, 0x2D, 0x01, 0x1B, 0xF5, 0x01, 0x1E, 0xED, 0x01, 0x1E, 0xB5, 0x63, 0x1A, 0x21, 0x27, 0x01,
+    0x1C, 0xEC, 0x01, 0x18, 0xAC, 0x01, 0x1E, 0x7C, 0x63, 0x21, 0x25, 0x27, 0x01, 0x1F, 0x08, 0x01,
+    0x1E, 0x89, 0x01, 0x1E, 0x89, 0xF1, 0x01, 0x04, 0x07, 0x15, 0x17, 0x1A, 0x1E, 0x21, 0x23, 0x25,
+    0x27, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x01, 0x1E, 0xB7, 0x00, 0x01, 0x4A, 0x00, 0x01, 0x3D,
+    0x00, 0x01, 0x27, 0x01, 0x17, 0xC9, 0x00, 0x01, 0x24, 0x00, 0xC0, 0x23, 0x00, 0x01, 0x0A, 0x01,
+    0x1E, 0x4F, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xBA, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x91, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x27, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0D, 0x61, 0x34, 0x01, 0x09, 0xE4, 0x21,
+    0x14, 0x05, 0x21, 0x32, 0x03, 0x63, 0x13, 0x30, 0x35, 0x00, 0x59, 0xE6, 0x01, 0x1F, 0x65, 0x01,
+    0x1F, 0x65, 0x62, 0x2D, 0x32, 0x01, 0x1B, 0x5A, 0x01, 0x1E, 0xB7, 0x41, 0x23, 0xFA, 0x9F, 0x21,
+    0x22, 0x04, 0x21, 0x35, 0x03, 0x21, 0x01, 0x03, 0xA1, 0x40, 0x03, 0x62, 0x30, 0x4C, 0x00, 0x00,
+    0x03, 0x01, 0x1F, 0x8B, 0x63, 0x13, 0x21, 0x30, 0x00, 0x00, 0x09, 0x01, 0x1E, 0xCE, 0x01, 0x1F,
+    0x94, 0x41, 0x2D, 0x6F, 0x4C, 0x21, 0x1A, 0x04, 0x21, 0x40, 0x03, 0x21, 0x21, 0x03, 0x62, 0x0B,
+    0x1E, 0x00, 0x00, 0x03, 0x01, 0x1F, 0x29, 0xE9, 0x01, 0x02, 0x1E, 0x25, 0x28, 0x29, 0x2A, 0x40,
+    0x44, 0x00, 0x00, 0x55, 0x00, 0x00, 0x52, 0x01, 0x1F, 0x51, 0x00, 0x00, 0x45, 0x01, 0x1C, 0x84,
+    0x00, 0x00, 0x23, 0x01, 0x1E, 0xF1, 0x00, 0x00, 0x09, 0x01, 0x1D, 0x61, 0x63, 0x01, 0x04, 0x19,
+    0x01, 0x01, 0x46, 0x01, 0x1C, 0x71, 0x00, 0x43, 0x70, 0x62, 0x01, 0x25, 0x01, 0x0F, 0xC6, 0x01,
+    0x1F, 0xE9, 0xE6, 0x01, 0x04, 0x16, 0x25, 0x2A, 0x40, 0x01, 0x1F, 0x8C, 0x01, 0x0B, 0x2C, 0x00,
+    0xF3, 0xA4, 0x01, 0x1E, 0xE6, 0x01, 0x15, 0x44, 0x00, 0x00, 0x09, 0x41, 0x0A, 0x83, 0x07, 0x62,
+    0x01, 0x4C, 0x01, 0x1F, 0xC9, 0x01, 0x20, 0x0F, 0xE3, 0x01, 0x19, 0x4C, 0x01, 0x1F, 0xD2, 0x01,
+    0x1F, 0xFC, 0x01, 0x20, 0x18, 0x22, 0x08, 0x09, 0x16, 0x0D, 0x61, 0x07, 0x01, 0x01, 0x42, 0xE4,
+    0x04, 0x27, 0x32, 0x41, 0x01, 0x10, 0x62, 0x00, 0x00, 0x05, 0x01, 0x20, 0x2F, 0x00, 0xE9, 0xB7,
+    0x41, 0x18, 0xDA, 0x81, 0x41, 0x23, 0x27, 0x91, 0x21, 0x42, 0x04, 0x21, 0x32, 0x03, 0x61, 0x15,
+    0x01, 0x0E, 0x9F, 0x61, 0x17, 0x01, 0x1E, 0x44, 0xE7, 0x0A, 0x0B, 0x14, 0x17, 0x40, 0x42, 0x44,
+    0x01, 0x20, 0x3C, 0x00, 0x00, 0x0D, 0x01, 0x1F, 0xF2, 0x01, 0x1A, 0x39, 0x00, 0x00, 0x0A, 0x00,
+    0x00, 0x05, 0x01, 0x1D, 0x4A, 0x62, 0x35, 0x48, 0x01, 0x1F, 0xF6, 0x01, 0x20, 0x20, 0xE5, 0x15,
+    0x1B, 0x25, 0x2B, 0x41, 0x01, 0x20, 0x18, 0x01, 0x20, 0x7A, 0x00, 0x00, 0x09, 0x01, 0x20, 0x65,
+    0x01, 0x20, 0x20, 0x62, 0x19, 0x22, 0x01, 0x1D, 0x28, 0x01, 0x20, 0x77, 0xE2, 0x01, 0x04, 0x01,
+    0x06, 0x18, 0x01, 0x1D, 0x8E, 0xE3, 0x17, 0x19, 0x44, 0x01, 0x1E, 0x96, 0x01, 0x20, 0xA4, 0x01,
+    0x20, 0xA4, 0x62, 0x07, 0x19, 0x01, 0x20, 0xB2, 0x00, 0x00, 0x0D, 0x6F, 0x01, 0x04, 0x07, 0x0A,
+    0x0D, 0x10, 0x14, 0x17, 0x19, 0x1A, 0x1E, 0x20, 0x21, 0x22, 0x48, 0x00, 0x01, 0x04, 0x00, 0x00,
+    0xDF, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x96, 0x01, 0x0B, 0xF5, 0x00, 0x00, 0x8C,
+    0x00, 0x00, 0x7B, 0x00, 0x00, 0x63, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x28, 0x00,
+    0xBB, 0xBF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x09, 0xE3, 0x25, 0x29, 0x2D, 0x01, 0x13, 0x17, 0x01,
+    0x20, 0x92, 0x01, 0x0D, 0xDA, 0xE6, 0x04, 0x07, 0x17, 0x25, 0x2A, 0x32, 0x00, 0xDE, 0xFA, 0x01,
+    0x1B, 0xDA, 0x01, 0x20, 0x3F, 0x01, 0x1D, 0x23, 0x01, 0x16, 0x57, 0x01, 0x20, 0xB6, 0x62, 0x23,
+    0x25, 0x01, 0x1C, 0xF9, 0x01, 0x1C, 0xF9, 0x21, 0x44, 0x09, 0x42, 0x32, 0x39, 0xD5, 0xCE, 0x00,
+    0x03, 0x61, 0x1A, 0x01, 0x1F, 0x0E, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0x41, 0x2B, 0xF8, 0xF2,
+    0x21, 0x27, 0x04, 0x21, 0x31, 0x03, 0x61, 0x23, 0x01, 0x05, 0x34, 0x41, 0x21, 0xDD, 0x53, 0x21,
+    0x38, 0x04, 0x21, 0x25, 0x03, 0x62, 0x17, 0x25, 0x01, 0x21, 0x55, 0x01, 0x20, 0xEF, 0xC7, 0x01,
+    0x17, 0x1A, 0x1E, 0x22, 0x2B, 0x40, 0x00, 0x25, 0x96, 0x87, 0x00, 0x1B, 0x00, 0x18, 0xF3, 0x68,
+    0x00, 0x0C, 0x00, 0x09, 0x41, 0x1A, 0xDA, 0xED, 0x21, 0x32, 0x04, 0x62, 0x30, 0x31, 0x01, 0x0F,
+    0xDA, 0x01, 0x21, 0x7A, 0xA2, 0x19, 0x2A, 0x0C, 0x09, 0xE1, 0x27, 0x01, 0x21, 0x50, 0xC1, 0x32,
+    0xE2, 0xF9, 0x61, 0x39, 0x01, 0x20, 0x70, 0x21, 0x0B, 0x05, 0x21, 0x32, 0x03, 0x21, 0x25, 0x03,
+    0x21, 0x2A, 0x03, 0x63, 0x2D, 0x34, 0x38, 0x01, 0x21, 0x6A, 0x00, 0x00, 0x03, 0x01, 0x21, 0xA3,
+    0xE4, 0x01, 0x1B, 0x25, 0x30, 0x01, 0x21, 0xB0, 0x01, 0x18, 0x62, 0x01, 0x15, 0xDD, 0x01, 0x21,
+    0xB0, 0x63, 0x2D, 0x32, 0x37, 0x01, 0x1C, 0x16, 0x01, 0x1D, 0xA9, 0x01, 0x21, 0x6C, 0x62, 0x28,
+    0x49, 0x01, 0x21, 0xCE, 0x01, 0x21, 0x68, 0x21, 0x17, 0x09, 0xE9, 0x02, 0x15, 0x19, 0x21, 0x2A,
+    0x2E, 0x40, 0x41, 0x44, 0x01, 0x21, 0x88, 0x01, 0x21, 0x74, 0x01, 0x01, 0x3A, 0x01, 0x1F, 0x8E,
+    0x00, 0x00, 0x19, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x03, 0x00, 0x91, 0x5A, 0x01, 0x0E, 0x72, 0x63,
+    0x19, 0x2A, 0x32, 0x01, 0x1E, 0x94, 0x01, 0x21, 0xFF, 0x01, 0x21, 0xFF, 0x61, 0x13, 0x01, 0x0F,
+    0xA4, 0xE3, 0x01, 0x31, 0x32, 0x01, 0x22, 0x11, 0x00, 0x00, 0x05, 0x01, 0x22, 0x11, 0x41, 0x40,
+    0xE3, 0xD0, 0x21, 0x19, 0x04, 0x64, 0x07, 0x17, 0x1E, 0x27, 0x01, 0x0E, 0xF3, 0x00, 0xE3, 0x98,
+    0x01, 0x22, 0x25, 0x00, 0x00, 0x03, 0x63, 0x19, 0x23, 0x25, 0x00, 0xB4, 0xE9, 0x01, 0x22, 0x2C,
+    0x01, 0x22, 0x35, 0xF5, 0x01, 0x02, 0x07, 0x0A, 0x0B, 0x0D, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1E,
+    0x20, 0x21, 0x22, 0x25, 0x27, 0x2A, 0x40, 0x42, 0x44, 0x00, 0x01, 0x4B, 0x01, 0x21, 0xDD, 0x00,
+    0x01, 0x3E, 0x01, 0x22, 0x43, 0x00, 0x01, 0x19, 0x00, 0x92, 0x44, 0x00, 0x00, 0xE5, 0x01, 0x20,
+    0x19, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBA, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xA0, 0x01, 0x22, 0x43,
+    0x00, 0x00, 0x93, 0x00, 0x00, 0x69, 0x00, 0x00, 0x44, 0x00, 0x00, 0x32, 0x00, 0xF2, 0x6A, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x0D, 0x01, 0x22, 0x0A, 0x62, 0x27, 0x31, 0x01, 0x22, 0x5F, 0x01, 0x1E,
+    0x80, 0x62, 0x31, 0x49, 0x01, 0x22, 0x52, 0x01, 0x22, 0x68, 0x63, 0x31, 0x33, 0x49, 0x01, 0x22,
+    0xA9, 0x01, 0x22, 0xAA, 0x01, 0x1B, 0xBC, 0x63, 0x2D, 0x32, 0x38, 0x01, 0x22, 0xAD, 0x01, 0x22,
+    0xB6, 0x01, 0x22, 0xB7, 0x64, 0x27, 0x2D, 0x31, 0x39, 0x01, 0x22, 0x8B, 0x01, 0x22, 0xBA, 0x01,
+    0x22, 0xBA, 0x01, 0x09, 0x55, 0x61, 0x02, 0x01, 0x21, 0xD3, 0x21, 0x38, 0x05, 0x61, 0x32, 0x01,
+    0x00, 0xAB, 0x62, 0x2D, 0x32, 0x01, 0x22, 0xD8, 0x01, 0x22, 0xE2, 0x65, 0x2D, 0x32, 0x33, 0x36,
+    0x39, 0x01, 0x22, 0xE1, 0x01, 0x1E, 0xD3, 0x01, 0x22, 0xEB, 0x01, 0x22, 0xEA, 0x00, 0x85, 0x8E,
+    0x63, 0x19, 0x34, 0x49, 0x00, 0xFC, 0x7D, 0x01, 0x22, 0xC7, 0x01, 0x1C, 0xE1, 0x41, 0x0A, 0x6F,
+    0x98, 0x21, 0x0D, 0x04, 0x21, 0x38, 0x03, 0xA1, 0x1A, 0x03, 0x21, 0x01, 0x03, 0x21, 0x22, 0x03,
+    0x21, 0x35, 0x03, 0x62, 0x32, 0x47, 0x01, 0x23, 0x23, 0x01, 0x06, 0x47, 0x63, 0x32, 0x34, 0x35,
+    0x01, 0x1F, 0xC1, 0x01, 0x23, 0x2B, 0x01, 0x1F, 0xB6, 0x69, 0x02, 0x04, 0x08, 0x19, 0x1E, 0x21,
+    0x25, 0x2A, 0x2D, 0x00, 0xEF, 0xD1, 0x00, 0xEF, 0xD1, 0x00, 0x00, 0x19, 0x01, 0x22, 0xD3, 0x00,
+    0x00, 0x16, 0x01, 0x0A, 0xB3, 0x00, 0x00, 0x0D, 0x01, 0x22, 0xD3, 0x01, 0x08, 0xAE, 0xE3, 0x19,
+    0x47, 0x49, 0x01, 0x23, 0x5E, 0x01, 0x23, 0x54, 0x01, 0x23, 0x54, 0x63, 0x02, 0x1E, 0x2A, 0x00,
+    0x00, 0x0D, 0x01, 0x1C, 0xE1, 0x01, 0x23, 0x61, 0x62, 0x1E, 0x2D, 0x01, 0x23, 0x6E, 0x01, 0x23,
+    0x6E, 0xC2, 0x40, 0x43, 0xE6, 0xAE, 0xF1, 0x7C, 0x21, 0x49, 0x07, 0x63, 0x1E, 0x22, 0x2A, 0x01,
+    0x22, 0xFA, 0x01, 0x23, 0x8B, 0x00, 0x00, 0x03, 0xF4, 0x04, 0x07, 0x14, 0x15, 0x18, 0x19, 0x1A,
+    0x1B, 0x1E, 0x20, 0x21, 0x22, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x01, 0x05, 0x76,
+    0x01, 0x18, 0xEA, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF7, 0x01, 0x22, 0x60, 0x00, 0x00, 0xEE, 0x00,
+    0x00, 0xE1, 0x00, 0xA8, 0x5F, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBB, 0x00, 0x00,
+    0xB6, 0x00, 0x00, 0xAD, 0x01, 0x13, 0x45, 0x00, 0x00, 0x98, 0x01, 0x0D, 0x75, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x2D, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0D, 0x65, 0x02, 0x29, 0x38, 0x39, 0x44, 0x01,
+    0x23, 0x83, 0x01, 0x23, 0x83, 0x01, 0x21, 0xB8, 0x00, 0x82, 0x94, 0x01, 0x16, 0xC0, 0x63, 0x19,
+    0x2A, 0x34, 0x01, 0x20, 0x93, 0x01, 0x20, 0xCE, 0x01, 0x20, 0xF0, 0x41, 0x19, 0x5B, 0xE7, 0x21,
+    0x15, 0x04, 0x62, 0x27, 0x40, 0x01, 0x1E, 0xE7, 0x00, 0x00, 0x03, 0x62, 0x32, 0x4C, 0x01, 0x23,
+    0xD5, 0x01, 0x24, 0x1B, 0xE5, 0x01, 0x04, 0x1B, 0x25, 0x42, 0x00, 0x00, 0x09, 0x01, 0x24, 0x08,
+    0x01, 0x1C, 0xD8, 0x01, 0x22, 0x15, 0x00, 0xB5, 0xF6, 0x61, 0x23, 0x01, 0x09, 0xC7, 0x21, 0x25,
+    0x05, 0x21, 0x34, 0x03, 0x21, 0x15, 0x03, 0xE3, 0x21, 0x23, 0x40, 0x00, 0xE2, 0x62, 0x01, 0x24,
+    0x47, 0x00, 0x00, 0x03, 0x61, 0x27, 0x01, 0x04, 0x2F, 0x21, 0x31, 0x05, 0x41, 0x25, 0x58, 0xF3,
+    0x21, 0x2D, 0x04, 0x62, 0x01, 0x19, 0x00, 0xFF, 0x3B, 0x01, 0x24, 0x63, 0x65, 0x04, 0x08, 0x25,
+    0x2A, 0x34, 0x00, 0x00, 0x0C, 0x01, 0x24, 0x62, 0x01, 0x24, 0x06, 0x00, 0xF1, 0x0B, 0x00, 0x00,
+    0x09, 0xE1, 0x25, 0x01, 0x16, 0xA0, 0x66, 0x0B, 0x14, 0x15, 0x2A, 0x34, 0x42, 0x01, 0x20, 0xA4,
+    0x01, 0x24, 0x20, 0x01, 0x24, 0x6A, 0x00, 0xFB, 0x05, 0x01, 0x23, 0xD4, 0x00, 0xE5, 0xF1, 0x41,
+    0x1A, 0xBD, 0x99, 0x21, 0x41, 0x04, 0x21, 0x4C, 0x03, 0x62, 0x15, 0x17, 0x01, 0x24, 0x8D, 0x00,
+    0x00, 0x03, 0x62, 0x19, 0x4C, 0x01, 0x21, 0x47, 0x01, 0x24, 0xB2, 0x61, 0x15, 0x01, 0x24, 0x6C,
+    0x62, 0x17, 0x40, 0x01, 0x24, 0xC0, 0x00, 0x00, 0x05, 0x63, 0x1B, 0x32, 0x34, 0x00, 0x00, 0x17,
+    0x01, 0x24, 0xC9, 0x00, 0x00, 0x09, 0x62, 0x25, 0x34, 0x01, 0x23, 0xD7, 0x01, 0x21, 0xC8, 0xE1,
+    0x41, 0x01, 0x11, 0xBD, 0x63, 0x07, 0x17, 0x1A, 0x01, 0x24, 0xE4, 0x01, 0x24, 0xC8, 0x01, 0x1F,
+    0x32, 0x41, 0x23, 0x96, 0x2D, 0x21, 0x40, 0x04, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x62, 0x2D,
+    0x35, 0x00, 0x00, 0x03, 0x01, 0x1D, 0x7A, 0x41, 0x27, 0xFF, 0xCB, 0x21, 0x30, 0x04, 0x21, 0x2D,
+    0x03, 0x62, 0x31, 0x4C, 0x01, 0x24, 0xB3, 0x00, 0xE9, 0xBA, 0x21, 0x23, 0x09, 0x63, 0x23, 0x2D,
+    0x35, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0x24, 0x62, 0x61, 0x1E, 0x01, 0x15, 0x9F, 0x21,
+    0x4C, 0x05, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x65, 0x01, 0x17, 0x1A, 0x20, 0x27, 0x01, 0x25,
+    0x38, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x1B, 0x01, 0x24, 0xD2, 0x00, 0x00, 0x03, 0x61, 0x0B, 0x01,
+    0x03, 0xD4, 0x62, 0x19, 0x21, 0x01, 0x00, 0xA2, 0x00, 0x00, 0x05, 0x63, 0x19, 0x21, 0x27, 0x01,
+    0x25, 0x5B, 0x01, 0x25, 0x5B, 0x01, 0x25, 0x5B, 0xE2, 0x08, 0x25, 0x01, 0x24, 0x69, 0x01, 0x23,
+    0x59, 0x62, 0x19, 0x21, 0x00, 0x00, 0x09, 0x01, 0x25, 0x71, 0xD3, 0x01, 0x02, 0x04, 0x07, 0x14,
+    0x15, 0x18, 0x19, 0x1A, 0x1B, 0x1F, 0x21, 0x25, 0x27, 0x2A, 0x40, 0x42, 0x48, 0x49, 0x01, 0x91,
+    0x01, 0x7C, 0x01, 0x68, 0x01, 0x56, 0x13, 0x2C, 0x01, 0x33, 0x01, 0x21, 0x01, 0x0E, 0x00, 0xF9,
+    0x00, 0xF4, 0x00, 0xD1, 0x00, 0xB1, 0x00, 0xA4, 0x00, 0x9B, 0x00, 0x96, 0x00, 0x42, 0x00, 0x28,
+    0x00, 0x1F, 0x00, 0x09, 0x41, 0x38, 0xE7, 0x2B, 0xE2, 0x28, 0x2A, 0x01, 0x25, 0xB8, 0x01, 0x25,
+    0xB8, 0x21, 0x32, 0x09, 0x41, 0x32, 0xEB, 0xD3, 0xEA, 0x01, 0x0B, 0x14, 0x19, 0x1A, 0x25, 0x27,
+    0x2C, 0x48, 0x49, 0x01, 0x25, 0xC8, 0x01, 0x25, 0x73, 0x00, 0x03, 0xAA, 0x00, 0x00, 0x14, 0x01,
+    0x25, 0xC8, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x01, 0x0E, 0x71, 0x01, 0x25, 0xC8, 0x00, 0x01,
+    0x47, 0x62, 0x31, 0x49, 0x01, 0x21, 0xD9, 0x01, 0x1F, 0x03, 0xA1, 0x25, 0x09, 0x62, 0x01, 0x07,
+    0x00, 0x00, 0x03, 0x01, 0x13, 0x37, 0x64, 0x19, 0x31, 0x32, 0x49, 0x01, 0x26, 0x06, 0x01, 0x25,
+    0x01, 0x01, 0x26, 0x06, 0x01, 0x25, 0xCD, 0xA1, 0x15, 0x11, 0xE3, 0x0A, 0x19, 0x2A, 0x01, 0x25,
+    0xB4, 0x01, 0x1C, 0xCC, 0x01, 0x23, 0xF0, 0x66, 0x14, 0x1A, 0x21, 0x2D, 0x48, 0x49, 0x01, 0x26,
+    0x27, 0x01, 0x26, 0x27, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x00, 0xC5, 0x34, 0x00, 0xC5, 0x34,
+    0x62, 0x19, 0x32, 0x01, 0x26, 0x40, 0x01, 0x24, 0x31, 0xE2, 0x25, 0x2E, 0x00, 0x00, 0x09, 0x01,
+    0x23, 0xFD, 0xE1, 0x1E, 0x01, 0x24, 0x2F, 0x41, 0x34, 0xC0, 0xE4, 0x21, 0x27, 0x04, 0xE2, 0x01,
+    0x18, 0x01, 0x22, 0xF3, 0x01, 0x26, 0x42, 0x62, 0x01, 0x4C, 0x01, 0x22, 0xFC, 0x01, 0x26, 0x67,
+    0x21, 0x18, 0x09, 0x62, 0x1B, 0x1E, 0x01, 0x26, 0x57, 0x00, 0x4B, 0x1C, 0x61, 0x22, 0x01, 0x25,
+    0x04, 0x21, 0x35, 0x05, 0x21, 0x0B, 0x03, 0xA1, 0x40, 0x03, 0x62, 0x32, 0x48, 0x01, 0x25, 0xCF,
+    0x01, 0x1E, 0xA8, 0x62, 0x32, 0x34, 0x01, 0x26, 0x93, 0x01, 0x14, 0xF2, 0xC1, 0x1E, 0xC5, 0xC3,
+    0x63, 0x19, 0x21, 0x22, 0x01, 0x01, 0x0C, 0x00, 0x00, 0x04, 0x00, 0xA8, 0x14, 0xED, 0x01, 0x07,
+    0x14, 0x15, 0x17, 0x1B, 0x1E, 0x21, 0x22, 0x25, 0x2A, 0x48, 0x49, 0x00, 0x00, 0x64, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x52, 0x01, 0x26, 0xAD, 0x00, 0x00, 0x4F, 0x01, 0x22, 0x88, 0x00, 0x00, 0x3D,
+    0x00, 0x00, 0x3A, 0x00, 0x00, 0x26, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0D, 0x00,
+    0xDC, 0xE3, 0x61, 0x41, 0x01, 0x24, 0xB1, 0x21, 0x0D, 0x05, 0x63, 0x01, 0x23, 0x38, 0x01, 0x26,
+    0xEA, 0x01, 0x26, 0xE0, 0x00, 0x00, 0x03, 0x62, 0x31, 0x38, 0x01, 0x26, 0xA8, 0x01, 0x26, 0xBE,
+    0x66, 0x2D, 0x31, 0x33, 0x34, 0x39, 0x49, 0x01, 0x1D, 0x74, 0x01, 0x26, 0xC7, 0x01, 0x27, 0x00,
+    0x01, 0x26, 0xB1, 0x01, 0x26, 0x6F, 0x01, 0x26, 0x9A, 0x62, 0x32, 0x34, 0x01, 0x26, 0x5E, 0x01,
+    0x26, 0xCA, 0x62, 0x32, 0x49, 0x01, 0x27, 0x22, 0x01, 0x20, 0x34, 0x65, 0x17, 0x27, 0x2D, 0x32,
+    0x34, 0x01, 0x27, 0x2B, 0x01, 0x23, 0x13, 0x01, 0x26, 0xCD, 0x00, 0x32, 0x8E, 0x01, 0x26, 0xDC,
+    0x65, 0x25, 0x31, 0x32, 0x37, 0x48, 0x00, 0x61, 0xC1, 0x01, 0x26, 0xF1, 0x01, 0x27, 0x40, 0x01,
+    0x27, 0x07, 0x01, 0x26, 0xDA, 0x62, 0x25, 0x35, 0x01, 0x27, 0x3C, 0x01, 0x26, 0xC4, 0x62, 0x31,
+    0x39, 0x01, 0x27, 0x5D, 0x01, 0x27, 0x5D, 0x62, 0x2D, 0x31, 0x01, 0x27, 0x66, 0x01, 0x27, 0x5D,
+    0x64, 0x21, 0x2D, 0x48, 0x49, 0x01, 0x27, 0x70, 0x01, 0x26, 0xB5, 0x01, 0x27, 0x0A, 0x01, 0x27,
+    0x1B, 0x62, 0x07, 0x31, 0x01, 0x27, 0x81, 0x00, 0xCC, 0x78, 0x62, 0x32, 0x39, 0x01, 0x26, 0x85,
+    0x01, 0x23, 0x72, 0x62, 0x07, 0x27, 0x01, 0x27, 0x93, 0x01, 0x27, 0x89, 0x67, 0x19, 0x21, 0x22,
+    0x25, 0x32, 0x34, 0x35, 0x01, 0x27, 0x83, 0x01, 0x27, 0x4D, 0x01, 0x26, 0xD6, 0x00, 0x00, 0x09,
+    0x01, 0x23, 0x84, 0x01, 0x27, 0x63, 0x01, 0x23, 0x84, 0x65, 0x01, 0x02, 0x15, 0x18, 0x2B, 0x01,
+    0x27, 0x6A, 0x01, 0x26, 0xFE, 0x01, 0x0F, 0x7D, 0x01, 0x27, 0x64, 0x00, 0x99, 0x76, 0x64, 0x15,
+    0x16, 0x1B, 0x2B, 0x01, 0x27, 0xCD, 0x01, 0x26, 0xC9, 0x01, 0x27, 0xCE, 0x01, 0x27, 0xCE, 0x66,
+    0x0B, 0x14, 0x1B, 0x21, 0x22, 0x25, 0x01, 0x27, 0x4E, 0x01, 0x27, 0x90, 0x01, 0x23, 0x55, 0x01,
+    0x27, 0x4E, 0x01, 0x27, 0xA6, 0x01, 0x27, 0xDE, 0x65, 0x01, 0x1C, 0x1F, 0x21, 0x25, 0x01, 0x27,
+    0x67, 0x01, 0x27, 0x67, 0x01, 0x27, 0xF8, 0x01, 0x27, 0x79, 0x01, 0x27, 0x67, 0xFA, 0x01, 0x02,
+    0x04, 0x08, 0x0A, 0x0B, 0x14, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x25,
+    0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x00, 0x01, 0x23, 0x00, 0x01, 0x16, 0x00, 0x01,
+    0x0D, 0x01, 0x27, 0xFD, 0x00, 0x00, 0xF4, 0x01, 0x27, 0x01, 0x01, 0x1D, 0xCD, 0x01, 0x23, 0xFF,
+    0x00, 0x00, 0xEB, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xCD, 0x00, 0xE1, 0x82, 0x00, 0x00, 0xB8, 0x00,
+    0x00, 0xAF, 0x01, 0x25, 0xC1, 0x01, 0x27, 0xB8, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x9D, 0x00, 0x00,
+    0x8C, 0x00, 0x00, 0x83, 0x00, 0x00, 0x71, 0x01, 0x25, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x2E, 0x00, 0x00, 0x15, 0x62, 0x2D, 0x32, 0x01, 0x28, 0x3D, 0x01, 0x16, 0xD5, 0x41,
+    0x0A, 0xFD, 0x4D, 0x21, 0x40, 0x04, 0x42, 0x34, 0x35, 0xC1, 0x3D, 0x00, 0x03, 0x62, 0x30, 0x48,
+    0x01, 0x28, 0x8D, 0x01, 0x27, 0x97, 0x62, 0x21, 0x25, 0x01, 0x28, 0x96, 0x01, 0x21, 0xA8, 0x61,
+    0x22, 0x01, 0x03, 0x94, 0x21, 0x34, 0x05, 0xE4, 0x04, 0x15, 0x25, 0x44, 0x00, 0x00, 0x11, 0x01,
+    0x27, 0x9E, 0x00, 0x00, 0x03, 0x00, 0xF6, 0x72, 0x61, 0x23, 0x01, 0x27, 0xB6, 0x21, 0x4C, 0x05,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x18, 0x03, 0x41, 0x04, 0x03, 0x7C, 0xE1, 0x17, 0x01,
+    0x28, 0xC0, 0x6D, 0x01, 0x02, 0x0A, 0x0B, 0x15, 0x17, 0x19, 0x1A, 0x2D, 0x40, 0x42, 0x44, 0x48,
+    0x00, 0x00, 0xC5, 0x01, 0x25, 0x67, 0x01, 0x28, 0xB9, 0x00, 0x00, 0x5C, 0x01, 0x28, 0x6C, 0x00,
+    0x00, 0x4C, 0x00, 0x00, 0x45, 0x00, 0x00, 0x2B, 0x00, 0x23, 0x98, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x09, 0x01, 0x07, 0x21, 0x00, 0x00, 0x05, 0xE2, 0x2D, 0x40, 0x01, 0x0E, 0x99, 0x00, 0x32, 0xBC,
+    0xC1, 0x40, 0xC7, 0x53, 0x62, 0x1A, 0x2A, 0x01, 0x0A, 0x7E, 0x00, 0xEF, 0x61, 0x23, 0x01, 0x04,
+    0x1A, 0x16, 0x0D, 0x09, 0x21, 0x2D, 0x07, 0xE2, 0x08, 0x1F, 0x01, 0x27, 0x18, 0x01, 0x24, 0x65,
+    0xE2, 0x04, 0x41, 0x01, 0x22, 0x42, 0x01, 0x29, 0x1D, 0x62, 0x07, 0x21, 0x00, 0x00, 0x09, 0x01,
+    0x29, 0x39, 0xE1, 0x2B, 0x01, 0x29, 0x09, 0xC1, 0x08, 0xFC, 0xA5, 0xE5, 0x07, 0x19, 0x22, 0x25,
+    0x41, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x00, 0xED, 0x24, 0x01, 0x21, 0x69, 0x01, 0x0F, 0x47,
+    0xE5, 0x07, 0x0A, 0x19, 0x21, 0x2A, 0x01, 0x29, 0x60, 0x01, 0x24, 0x9E, 0x01, 0x29, 0x60, 0x01,
+    0x29, 0x60, 0x01, 0x13, 0x3D, 0xE2, 0x25, 0x2A, 0x01, 0x29, 0x0F, 0x01, 0x28, 0x73, 0x68, 0x07,
+    0x19, 0x21, 0x27, 0x2D, 0x30, 0x32, 0x33, 0x01, 0x29, 0x7E, 0x01, 0x29, 0x7E, 0x00, 0x00, 0x57,
+    0x00, 0x00, 0x45, 0x00, 0x00, 0x33, 0x01, 0x29, 0x7E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x09, 0x61,
+    0x25, 0x01, 0x24, 0xA6, 0x21, 0x40, 0x05, 0xE3, 0x1E, 0x2B, 0x40, 0x01, 0x22, 0x6E, 0x01, 0x20,
+    0x55, 0x00, 0x97, 0x85, 0xC1, 0x25, 0xFE, 0x49, 0x62, 0x07, 0x19, 0x01, 0x29, 0xB8, 0x01, 0x04,
+    0x24, 0xE2, 0x1B, 0x27, 0x01, 0x29, 0xC1, 0x01, 0x29, 0xB7, 0xA1, 0x21, 0x09, 0x61, 0x21, 0x01,
+    0x28, 0xC1, 0xA1, 0x2A, 0x05, 0xE4, 0x07, 0x15, 0x19, 0x22, 0x00, 0x00, 0x03, 0x01, 0x25, 0x13,
+    0x01, 0x29, 0xD5, 0x01, 0x29, 0xD5, 0xE3, 0x04, 0x22, 0x41, 0x01, 0x27, 0x56, 0x01, 0x16, 0xF8,
+    0x00, 0xEE, 0xAA, 0x27, 0x07, 0x19, 0x21, 0x27, 0x2D, 0x32, 0x33, 0x4F, 0x4C, 0x3F, 0x3B, 0x29,
+    0x1E, 0x0D, 0x7D, 0x01, 0x04, 0x06, 0x07, 0x14, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x25, 0x27,
+    0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x47, 0x48, 0x49,
+    0x00, 0x0F, 0x20, 0x00, 0x0F, 0x17, 0x00, 0x0F, 0x0C, 0x00, 0x0E, 0xA3, 0x00, 0x0E, 0x52, 0x00,
+    0x0E, 0x49, 0x00, 0x0E, 0x3C, 0x01, 0x22, 0x38, 0x00, 0x0E, 0x23, 0x00, 0x0D, 0xEA, 0x00, 0x0D,
+    0xAD, 0x00, 0x0D, 0xA0, 0x00, 0x0D, 0x81, 0x00, 0xEA, 0xF2, 0x00, 0x0D, 0x5B, 0x00, 0x0C, 0x70,
+    0x00, 0x0A, 0xED, 0x00, 0x09, 0x47, 0x00, 0x07, 0xBF, 0x00, 0x06, 0x6A, 0x00, 0x04, 0x88, 0x00,
+    0x04, 0x3A, 0x00, 0x04, 0x05, 0x00, 0x03, 0xDB, 0x00, 0x03, 0x55, 0x00, 0x01, 0x30, 0x00, 0x00,
+    0xDE, 0x00, 0x00, 0x84, 0x00, 0x00, 0x0F, 0xE2, 0x30, 0x38, 0x01, 0x2A, 0x77, 0x01, 0x2A, 0x19,
+    0x65, 0x15, 0x1A, 0x25, 0x32, 0x4C, 0x01, 0x2A, 0x80, 0x01, 0x2A, 0x80, 0x01, 0x28, 0x71, 0x01,
+    0x2A, 0x3A, 0x01, 0x2A, 0x80, 0x61, 0x1B, 0x01, 0x25, 0x6A, 0xE2, 0x1B, 0x40, 0x01, 0x25, 0x6F,
+    0x00, 0x00, 0x05, 0x21, 0x23, 0x09, 0x61, 0x27, 0x01, 0x1B, 0x02, 0xA1, 0x2A, 0x05, 0x63, 0x01,
+    0x32, 0x4C, 0x01, 0x2A, 0x68, 0x01, 0x2A, 0xAE, 0x00, 0x00, 0x03, 0x41, 0x2D, 0x57, 0xE9, 0x21,
+    0x0D, 0x04, 0x21, 0x31, 0x03, 0x21, 0x27, 0x03, 0xA1, 0x02, 0x03, 0x21, 0x4C, 0x03, 0x62, 0x07,
+    0x25, 0x01, 0x10, 0x60, 0x00, 0x9C, 0x8B, 0x61, 0x2B, 0x01, 0x1F, 0x04, 0xEC, 0x01, 0x08, 0x19,
+    0x1E, 0x23, 0x25, 0x27, 0x28, 0x29, 0x40, 0x41, 0x43, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x39, 0x01,
+    0x20, 0x9C, 0x01, 0x20, 0x2E, 0x01, 0x2A, 0x16, 0x00, 0x79, 0x74, 0x01, 0x28, 0xB9, 0x00, 0x00,
+    0x2E, 0x00, 0x00, 0x11, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x01, 0x2A, 0xA3, 0xC1, 0x40, 0xC0,
+    0x7A, 0x63, 0x19, 0x30, 0x35, 0x01, 0x27, 0xA6, 0x01, 0x2B, 0x11, 0x00, 0x00, 0x04, 0xE3, 0x18,
+    0x30, 0x32, 0x01, 0x10, 0x2A, 0x01, 0x2B, 0x1E, 0x00, 0x6A, 0x2E, 0x21, 0x23, 0x0D, 0x62, 0x30,
+    0x34, 0x01, 0x2B, 0x2E, 0x00, 0x00, 0x03, 0x63, 0x30, 0x32, 0x38, 0x01, 0x2B, 0x37, 0x01, 0x2A,
+    0xEE, 0x00, 0x95, 0x32, 0xE2, 0x0A, 0x22, 0x01, 0x2A, 0xDE, 0x01, 0x28, 0x82, 0x62, 0x0A, 0x1E,
+    0x00, 0x00, 0x09, 0x01, 0x2B, 0x4C, 0x64, 0x1A, 0x1E, 0x30, 0x34, 0x01, 0x2A, 0x9E, 0x01, 0x0C,
+    0x23, 0x01, 0x2B, 0x56, 0x00, 0x00, 0x09, 0x61, 0x0D, 0x01, 0x0A, 0xB9, 0x41, 0x19, 0xB6, 0xF0,
+    0x64, 0x19, 0x30, 0x31, 0x32, 0x01, 0x28, 0x05, 0x01, 0x2B, 0x70, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x04, 0x62, 0x38, 0x39, 0x01, 0x19, 0xE0, 0x01, 0x2B, 0x81, 0x41, 0x17, 0xA0, 0xF6, 0x21, 0x38,
+    0x04, 0x62, 0x1B, 0x2A, 0x01, 0x06, 0xB5, 0x01, 0x2B, 0x91, 0xE6, 0x14, 0x19, 0x23, 0x25, 0x27,
+    0x28, 0x01, 0x25, 0xE8, 0x01, 0x27, 0x75, 0x01, 0x22, 0x4C, 0x00, 0x58, 0x01, 0x01, 0x10, 0x75,
+    0x01, 0x10, 0xAA, 0x62, 0x14, 0x1E, 0x01, 0x2B, 0x4D, 0x01, 0x2B, 0xB2, 0xE8, 0x08, 0x20, 0x28,
+    0x2A, 0x2D, 0x31, 0x32, 0x34, 0x00, 0xD0, 0x6C, 0x00, 0x23, 0xC0, 0x01, 0x19, 0x9E, 0x01, 0x2B,
+    0x9A, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x22, 0x00, 0x00, 0x09, 0x62, 0x19, 0x38,
+    0x01, 0x28, 0x72, 0x01, 0x2B, 0xDD, 0x63, 0x04, 0x21, 0x2A, 0x00, 0x92, 0x8D, 0x00, 0x91, 0xD3,
+    0x01, 0x19, 0x7E, 0x62, 0x06, 0x18, 0x01, 0x2B, 0x00, 0x01, 0x17, 0x2D, 0x22, 0x31, 0x32, 0x16,
+    0x09, 0x61, 0x27, 0x01, 0x2A, 0xBD, 0x21, 0x32, 0x05, 0x21, 0x2B, 0x03, 0x61, 0x24, 0x01, 0x07,
+    0x30, 0x62, 0x01, 0x15, 0x01, 0x27, 0xEC, 0x01, 0x2C, 0x11, 0x21, 0x38, 0x09, 0xE9, 0x01, 0x04,
+    0x19, 0x1E, 0x22, 0x28, 0x30, 0x35, 0x36, 0x01, 0x11, 0x29, 0x00, 0xF6, 0xC3, 0x01, 0x2B, 0xB7,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x00, 0x8F, 0x0E, 0x01, 0x2C, 0x1D, 0x01, 0x2C, 0x1D, 0x01,
+    0x2C, 0x1C, 0xE2, 0x01, 0x19, 0x01, 0x2C, 0x42, 0x01, 0x28, 0xD7, 0x65, 0x04, 0x0A, 0x13, 0x18,
+    0x29, 0x01, 0x17, 0x9D, 0x01, 0x17, 0x9D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x09, 0x01, 0x1A, 0x9C,
+    0x61, 0x0D, 0x01, 0x2C, 0x47, 0x21, 0x0D, 0x05, 0x62, 0x30, 0x4C, 0x01, 0x2C, 0x68, 0x01, 0x2C,
+    0x68, 0x62, 0x01, 0x2B, 0x01, 0x29, 0x06, 0x00, 0x00, 0x09, 0x62, 0x14, 0x21, 0x01, 0x2A, 0x6B,
+    0x01, 0x29, 0x0F, 0x62, 0x13, 0x15, 0x01, 0x2C, 0x83, 0x00, 0x00, 0x09, 0x6E, 0x01, 0x07, 0x08,
+    0x13, 0x14, 0x17, 0x1E, 0x21, 0x23, 0x27, 0x31, 0x32, 0x38, 0x39, 0x01, 0x2A, 0x62, 0x01, 0x19,
+    0xC6, 0x01, 0x2C, 0x40, 0x01, 0x29, 0x21, 0x00, 0xD2, 0x38, 0x01, 0x2C, 0x31, 0x00, 0xE8, 0x84,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x41, 0x01, 0x2B, 0x48, 0x00, 0x00, 0x27, 0x00, 0x00, 0x1B, 0x00,
+    0x00, 0x09, 0x01, 0x29, 0x74, 0x62, 0x20, 0x25, 0x01, 0x2C, 0xC5, 0x01, 0x2C, 0xC5, 0x62, 0x01,
+    0x29, 0x01, 0x2C, 0xCE, 0x00, 0x00, 0x09, 0x62, 0x19, 0x4C, 0x01, 0x2C, 0xBB, 0x01, 0x2C, 0xD7,
+    0x21, 0x0A, 0x09, 0x63, 0x0A, 0x0D, 0x22, 0x01, 0x2C, 0xE3, 0x00, 0x00, 0x03, 0x01, 0x2C, 0xE3,
+    0x63, 0x31, 0x32, 0x35, 0x00, 0x00, 0x0D, 0x00, 0x8D, 0xF4, 0x01, 0x2C, 0xF0, 0x62, 0x30, 0x34,
+    0x01, 0x2C, 0xFD, 0x01, 0x2C, 0xC4, 0x41, 0x31, 0xCB, 0x65, 0x61, 0x34, 0x01, 0x13, 0x47, 0x41,
+    0x27, 0xEF, 0xA6, 0x21, 0x38, 0x04, 0x21, 0x29, 0x03, 0x21, 0x34, 0x03, 0x63, 0x14, 0x27, 0x4C,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x03, 0x01, 0x2D, 0x1C, 0x21, 0x15, 0x0D, 0x21, 0x19, 0x03, 0x61,
+    0x18, 0x01, 0x2C, 0xC6, 0xE3, 0x18, 0x19, 0x21, 0x01, 0x2C, 0xCE, 0x00, 0x00, 0x05, 0x00, 0xF7,
+    0xDA, 0x69, 0x19, 0x20, 0x25, 0x27, 0x30, 0x31, 0x32, 0x35, 0x38, 0x01, 0x29, 0xD6, 0x01, 0x2A,
+    0x48, 0x00, 0xA0, 0xF4, 0x00, 0x00, 0x3B, 0x01, 0x2D, 0x41, 0x00, 0x00, 0x15, 0x01, 0x2D, 0x41,
+    0x01, 0x2D, 0x41, 0x00, 0x00, 0x0D, 0xE1, 0x41, 0x01, 0x0C, 0x05, 0x61, 0x07, 0x01, 0x2B, 0x87,
+    0x21, 0x34, 0x05, 0xE1, 0x27, 0x01, 0x2B, 0x49, 0x61, 0x1F, 0x01, 0x08, 0x3C, 0x21, 0x40, 0x05,
+    0xE2, 0x0B, 0x2D, 0x01, 0x2C, 0xBA, 0x00, 0xC2, 0xAF, 0x61, 0x23, 0x01, 0x0D, 0x4F, 0x63, 0x0B,
+    0x21, 0x41, 0x01, 0x2D, 0x39, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x62, 0x35, 0x4C, 0x01, 0x2D,
+    0x0A, 0x00, 0x00, 0x0D, 0x61, 0x35, 0x01, 0x2B, 0xA6, 0x21, 0x23, 0x05, 0x21, 0x15, 0x03, 0x21,
+    0x2A, 0x03, 0x21, 0x4C, 0x03, 0xC1, 0x1A, 0xEE, 0x0C, 0x21, 0x4C, 0x04, 0x21, 0x22, 0x03, 0x62,
+    0x1B, 0x25, 0x01, 0x10, 0x65, 0x00, 0x00, 0x03, 0x41, 0x2D, 0x4F, 0x0D, 0x21, 0x40, 0x04, 0x21,
+    0x04, 0x03, 0x67, 0x15, 0x17, 0x25, 0x2A, 0x38, 0x40, 0x4C, 0x01, 0x2D, 0x6C, 0x01, 0x08, 0xAA,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x26, 0x01, 0x22, 0x5E, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x61,
+    0x4A, 0x01, 0x18, 0x79, 0x21, 0x39, 0x05, 0x21, 0x23, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0xEA, 0x01, 0x0A, 0x14, 0x19, 0x1F, 0x22,
+    0x23, 0x25, 0x40, 0x41, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x99, 0x00, 0x00, 0x96, 0x01, 0x2E, 0x09,
+    0x00, 0x00, 0x8C, 0x01, 0x08, 0xE1, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x37, 0x00, 0x00, 0x03, 0x01,
+    0x2D, 0x04, 0x63, 0x34, 0x35, 0x38, 0x01, 0x2D, 0x77, 0x01, 0x1B, 0xCA, 0x01, 0x2E, 0x32, 0xE2,
+    0x04, 0x0B, 0x00, 0x00, 0x0D, 0x01, 0x0C, 0xC6, 0x62, 0x32, 0x34, 0x01, 0x2E, 0x48, 0x01, 0x2E,
+    0x0F, 0x61, 0x1E, 0x01, 0x29, 0x93, 0x21, 0x22, 0x05, 0x21, 0x32, 0x03, 0xE1, 0x2B, 0x01, 0x27,
+    0xBA, 0x21, 0x07, 0x05, 0x22, 0x23, 0x2D, 0x0B, 0x03, 0x41, 0x40, 0xBE, 0xA8, 0x62, 0x2D, 0x33,
+    0x01, 0x2D, 0xB2, 0x00, 0x00, 0x04, 0x21, 0x49, 0x09, 0x41, 0x1E, 0xFB, 0x3B, 0x61, 0x2B, 0x01,
+    0x06, 0x44, 0x21, 0x21, 0x05, 0x22, 0x30, 0x32, 0x0C, 0x03, 0x63, 0x14, 0x27, 0x2B, 0x00, 0xEA,
+    0x82, 0x01, 0x2E, 0x80, 0x00, 0xC0, 0x1B, 0xEA, 0x01, 0x0A, 0x17, 0x19, 0x27, 0x28, 0x2A, 0x40,
+    0x43, 0x44, 0x01, 0x2E, 0x7B, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x33, 0x00, 0x00, 0x21, 0x01, 0x2E,
+    0x5E, 0x01, 0x2B, 0x2C, 0x00, 0x00, 0x12, 0x00, 0x00, 0x0D, 0x00, 0xFC, 0x92, 0x00, 0xFB, 0x62,
+    0x63, 0x01, 0x25, 0x4C, 0x01, 0x2E, 0xC0, 0x01, 0x2B, 0x55, 0x01, 0x2E, 0xC0, 0x63, 0x08, 0x09,
+    0x19, 0x01, 0x2B, 0x62, 0x00, 0x00, 0x0D, 0x00, 0x02, 0x65, 0xE4, 0x1E, 0x30, 0x34, 0x35, 0x01,
+    0x2E, 0x7C, 0x01, 0x2E, 0xDA, 0x01, 0x09, 0x70, 0x01, 0x2E, 0xDA, 0xE4, 0x0A, 0x0C, 0x1E, 0x23,
+    0x01, 0x2B, 0x80, 0x01, 0x2E, 0xCF, 0x00, 0x99, 0x12, 0x00, 0x00, 0x11, 0x62, 0x01, 0x19, 0x01,
+    0x2E, 0xFC, 0x01, 0x2B, 0x91, 0x62, 0x08, 0x0C, 0x00, 0x00, 0x09, 0x01, 0x2E, 0xE9, 0xE2, 0x01,
+    0x0E, 0x01, 0x2B, 0xA3, 0x01, 0x1A, 0x48, 0x61, 0x2A, 0x01, 0x2D, 0xDF, 0x21, 0x07, 0x05, 0x63,
+    0x08, 0x0F, 0x2A, 0x01, 0x2E, 0xD3, 0x01, 0x1A, 0x59, 0x00, 0x00, 0x03, 0xE1, 0x19, 0x01, 0x1E,
+    0xB3, 0xE4, 0x18, 0x27, 0x30, 0x32, 0x01, 0x14, 0x3D, 0x00, 0xE3, 0x66, 0x00, 0x73, 0x28, 0x00,
+    0x00, 0x05, 0x42, 0x01, 0x19, 0xA2, 0xF5, 0x00, 0x11, 0xE4, 0x0F, 0x13, 0x19, 0x42, 0x01, 0x2F,
+    0x2D, 0x01, 0x2B, 0xDE, 0x01, 0x2E, 0xE3, 0x01, 0x10, 0x47, 0x62, 0x32, 0x49, 0x01, 0x2F, 0x50,
+    0x01, 0x29, 0x3B, 0x61, 0x15, 0x01, 0x13, 0xF4, 0x21, 0x19, 0x05, 0x61, 0x1E, 0x01, 0x2F, 0x61,
+    0x21, 0x41, 0x05, 0x23, 0x25, 0x31, 0x33, 0x19, 0x0B, 0x03, 0x41, 0x2B, 0xA2, 0x0F, 0x42, 0x23,
+    0x24, 0x14, 0x93, 0x00, 0x04, 0x41, 0x01, 0x9E, 0x2B, 0x21, 0x32, 0x04, 0x41, 0x20, 0xD5, 0x04,
+    0x21, 0x21, 0x04, 0x41, 0x30, 0x70, 0x57, 0x41, 0x32, 0xA6, 0x87, 0x21, 0x19, 0x04, 0x21, 0x07,
+    0x03, 0x41, 0x07, 0x0E, 0x65, 0x41, 0x25, 0x9E, 0x3D, 0x21, 0x07, 0x04, 0x21, 0x48, 0x03, 0x23,
+    0x2D, 0x32, 0x38, 0x11, 0x0E, 0x03, 0x61, 0x34, 0x01, 0x0A, 0x4C, 0x21, 0x2D, 0x05, 0x21, 0x23,
+    0x03, 0x61, 0x19, 0x01, 0x25, 0x81, 0x21, 0x22, 0x05, 0x21, 0x2D, 0x03, 0x22, 0x04, 0x49, 0x0E,
+    0x03, 0x61, 0x2A, 0x01, 0x28, 0x2A, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0x21, 0x07, 0x1B, 0x21,
+    0x49, 0x03, 0x21, 0x36, 0x03, 0x21, 0x1C, 0x03, 0x21, 0x33, 0x03, 0x21, 0x49, 0x03, 0x41, 0x30,
+    0xA3, 0xC4, 0x65, 0x01, 0x19, 0x27, 0x2A, 0x2B, 0x00, 0x00, 0x19, 0x00, 0x00, 0x07, 0x01, 0x2E,
+    0xE9, 0x00, 0x00, 0x04, 0x00, 0x82, 0xC3, 0x21, 0x07, 0x15, 0x41, 0x17, 0x7F, 0x3D, 0x21, 0x07,
+    0x04, 0x61, 0x23, 0x01, 0x24, 0x01, 0x21, 0x0D, 0x05, 0x23, 0x32, 0x36, 0x38, 0x12, 0x0B, 0x03,
+    0x41, 0x17, 0xFC, 0x46, 0x21, 0x01, 0x04, 0x62, 0x23, 0x32, 0x01, 0x30, 0x26, 0x00, 0x00, 0x03,
+    0x41, 0x1B, 0x59, 0x96, 0x21, 0x07, 0x04, 0x21, 0x27, 0x03, 0x21, 0x48, 0x03, 0x21, 0x23, 0x03,
+    0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x61, 0x01, 0x01, 0x14, 0xDA, 0x21, 0x34, 0x05, 0x21, 0x15,
+    0x03, 0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0x21, 0x0C, 0x03, 0x21, 0x0A, 0x03, 0x21, 0x31, 0x03,
+    0x41, 0x40, 0x75, 0xEB, 0x21, 0x32, 0x04, 0x21, 0x25, 0x03, 0x42, 0x1B, 0x1E, 0x00, 0x03, 0x0F,
+    0x24, 0x41, 0x19, 0x0E, 0xF9, 0x22, 0x14, 0x19, 0x0B, 0x04, 0x21, 0x32, 0x05, 0x41, 0x01, 0x2F,
+    0xCC, 0x21, 0x42, 0x04, 0x21, 0x23, 0x03, 0x61, 0x01, 0x01, 0x2B, 0x94, 0x21, 0x4C, 0x05, 0x62,
+    0x02, 0x06, 0x00, 0x00, 0x03, 0x01, 0x2E, 0x0F, 0x21, 0x07, 0x09, 0x61, 0x2A, 0x01, 0x05, 0x30,
+    0x45, 0x21, 0x31, 0x32, 0x34, 0x35, 0x00, 0x1C, 0x00, 0x08, 0x00, 0x8F, 0x97, 0x3A, 0x00, 0x05,
+    0x62, 0x19, 0x25, 0x01, 0x2E, 0x8D, 0x01, 0x28, 0xCE, 0x41, 0x25, 0xEC, 0xB1, 0x61, 0x2B, 0x01,
+    0x26, 0x26, 0x21, 0x07, 0x05, 0x21, 0x34, 0x03, 0x41, 0x38, 0x98, 0xA1, 0x21, 0x2A, 0x04, 0x21,
+    0x27, 0x03, 0x44, 0x09, 0x0A, 0x17, 0x1E, 0x00, 0x19, 0x00, 0x0D, 0x00, 0x03, 0xFA, 0x5A, 0x41,
+    0x40, 0x9B, 0x02, 0x21, 0x14, 0x04, 0x21, 0x23, 0x03, 0x42, 0x1A, 0x1B, 0xF8, 0x4B, 0x00, 0x03,
+    0xF7, 0x01, 0x04, 0x08, 0x0A, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x21, 0x22, 0x23,
+    0x25, 0x27, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x43, 0x00, 0x01, 0x7D, 0x00, 0x01, 0x72, 0x00, 0x01,
+    0x67, 0x00, 0x01, 0x60, 0x00, 0xE7, 0x77, 0x00, 0x01, 0x5D, 0x00, 0x01, 0x41, 0x00, 0x01, 0x24,
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0xC9, 0x01, 0x30, 0x92, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x93, 0x01,
+    0x30, 0xE3, 0x01, 0x0F, 0x8F, 0x00, 0x00, 0x76, 0x01, 0x30, 0x8A, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x1E, 0x00, 0xBA, 0xD8, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x07, 0x41, 0x2A, 0xD4,
+    0x0C, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xE4, 0x14, 0x19, 0x1B, 0x27, 0x01, 0x2C, 0x11, 0x00,
+    0xFB, 0x98, 0x00, 0x00, 0x03, 0x00, 0xA4, 0xE4, 0x62, 0x38, 0x4C, 0x00, 0x00, 0x11, 0x01, 0x31,
+    0x68, 0x62, 0x14, 0x30, 0x01, 0x31, 0x2B, 0x01, 0x31, 0x71, 0xE6, 0x15, 0x16, 0x19, 0x23, 0x2A,
+    0x34, 0x01, 0x2E, 0xB8, 0x00, 0x00, 0x12, 0x01, 0x2E, 0x0F, 0x01, 0x31, 0x7A, 0x00, 0x00, 0x09,
+    0x01, 0x31, 0x7A, 0x41, 0x31, 0xED, 0xC9, 0x62, 0x31, 0x4C, 0x01, 0x30, 0x92, 0x01, 0x31, 0x97,
+    0xE2, 0x32, 0x35, 0x01, 0x31, 0xA0, 0x01, 0x1F, 0x38, 0x41, 0x31, 0x8B, 0xC8, 0xC2, 0x2B, 0x32,
+    0x00, 0x04, 0x70, 0xBD, 0x64, 0x19, 0x22, 0x32, 0x34, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0x01,
+    0x31, 0xB4, 0x01, 0x31, 0xB4, 0x41, 0x1F, 0xE9, 0x50, 0x21, 0x2D, 0x04, 0x62, 0x14, 0x19, 0x00,
+    0x00, 0x03, 0x01, 0x31, 0x66, 0xEA, 0x04, 0x08, 0x14, 0x15, 0x17, 0x1E, 0x1F, 0x25, 0x40, 0x42,
+    0x00, 0xBE, 0xF6, 0x01, 0x2F, 0xC6, 0x00, 0x00, 0x42, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x21, 0x01,
+    0x18, 0x49, 0x01, 0x31, 0xBC, 0x01, 0x2D, 0xC7, 0x00, 0x00, 0x09, 0x00, 0xAD, 0xBF, 0x61, 0x1B,
+    0x01, 0x2E, 0x93, 0x62, 0x20, 0x35, 0x01, 0x32, 0x03, 0x01, 0x32, 0x03, 0x61, 0x15, 0x01, 0x30,
+    0xE7, 0x21, 0x47, 0x05, 0x21, 0x25, 0x03, 0x65, 0x01, 0x04, 0x22, 0x25, 0x40, 0x01, 0x31, 0xFB,
+    0x01, 0x2F, 0x33, 0x01, 0x31, 0xFB, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x62, 0x30, 0x32, 0x01,
+    0x32, 0x2C, 0x01, 0x02, 0x53, 0x61, 0x2A, 0x01, 0x30, 0x4B, 0xE5, 0x14, 0x15, 0x19, 0x2A, 0x42,
+    0x01, 0x2F, 0x56, 0x01, 0x31, 0x47, 0x00, 0x05, 0xD2, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x75,
+    0x01, 0x04, 0x07, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x12, 0x13, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B,
+    0x21, 0x22, 0x25, 0x27, 0x2A, 0x01, 0x02, 0xD7, 0x00, 0x04, 0x10, 0x00, 0x03, 0xB8, 0x00, 0x03,
+    0x82, 0x00, 0x03, 0x64, 0x00, 0x03, 0x4A, 0x00, 0x03, 0x41, 0x00, 0x03, 0x30, 0x00, 0x03, 0x0D,
+    0x00, 0x03, 0x06, 0x00, 0x01, 0x5F, 0x00, 0x00, 0xD5, 0x01, 0x27, 0xE5, 0x00, 0x00, 0x7A, 0x01,
+    0x0C, 0xBB, 0x00, 0x00, 0x51, 0x00, 0x25, 0x83, 0x01, 0x32, 0x4F, 0x00, 0x00, 0x38, 0x01, 0x32,
+    0x4F, 0x00, 0x00, 0x15, 0xE2, 0x2A, 0x30, 0x00, 0xDD, 0x2A, 0x01, 0x32, 0xA4, 0xE2, 0x22, 0x23,
+    0x00, 0x00, 0x09, 0x01, 0x32, 0x47, 0x63, 0x27, 0x32, 0x37, 0x01, 0x31, 0xFB, 0x01, 0x32, 0x67,
+    0x01, 0x32, 0x61, 0xEA, 0x02, 0x15, 0x17, 0x21, 0x22, 0x27, 0x41, 0x42, 0x43, 0x44, 0x01, 0x32,
+    0x6B, 0x00, 0xA9, 0x15, 0x01, 0x30, 0x33, 0x00, 0x00, 0x0D, 0x01, 0x32, 0x5D, 0x01, 0x30, 0x99,
+    0x00, 0xFF, 0xCF, 0x01, 0x2F, 0xB5, 0x01, 0x30, 0x92, 0x00, 0x40, 0x90, 0xE2, 0x25, 0x44, 0x01,
+    0x32, 0xEC, 0x01, 0x32, 0xEC, 0x62, 0x01, 0x32, 0x01, 0x32, 0xF5, 0x00, 0x00, 0x09, 0x61, 0x0A,
+    0x01, 0x1E, 0x50, 0x62, 0x34, 0x35, 0x00, 0x00, 0x05, 0x01, 0x33, 0x03, 0xC1, 0x38, 0xF4, 0x77,
+    0xE4, 0x20, 0x30, 0x32, 0x34, 0x01, 0x17, 0x8D, 0x01, 0x33, 0x10, 0x01, 0x33, 0x10, 0x00, 0x9B,
+    0x7C, 0xE2, 0x01, 0x4C, 0x01, 0x32, 0xDB, 0x01, 0x33, 0x21, 0x62, 0x15, 0x19, 0x01, 0x33, 0x2A,
+    0x01, 0x33, 0x2A, 0xE6, 0x01, 0x19, 0x22, 0x28, 0x34, 0x35, 0x01, 0x33, 0x33, 0x01, 0x33, 0x33,
+    0x00, 0x00, 0x12, 0x00, 0xC1, 0x4D, 0x00, 0x00, 0x09, 0x01, 0x33, 0x33, 0xE2, 0x19, 0x34, 0x00,
+    0x96, 0xF6, 0x01, 0x0D, 0xE2, 0x41, 0x14, 0x83, 0x0A, 0x62, 0x0A, 0x25, 0x01, 0x33, 0x59, 0x01,
+    0x32, 0xF3, 0xE4, 0x0B, 0x23, 0x32, 0x34, 0x01, 0x1F, 0x94, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D,
+    0x00, 0x00, 0x09, 0xC2, 0x2B, 0x41, 0xAD, 0x23, 0x26, 0xC1, 0x61, 0x17, 0x01, 0x30, 0xFD, 0xA1,
+    0x1B, 0x05, 0x63, 0x30, 0x34, 0x35, 0x01, 0x33, 0x82, 0x01, 0x1C, 0x5D, 0x00, 0x00, 0x03, 0xE3,
+    0x19, 0x30, 0x41, 0x01, 0x33, 0x8F, 0x01, 0x33, 0x8F, 0x01, 0x00, 0xB1, 0xE5, 0x27, 0x2A, 0x30,
+    0x32, 0x38, 0x01, 0x27, 0x8C, 0x01, 0x30, 0x31, 0x01, 0x33, 0x9C, 0x00, 0x9D, 0x97, 0x01, 0x33,
+    0x9C, 0x41, 0x32, 0x7A, 0x8B, 0xC1, 0x20, 0xFA, 0xDB, 0x61, 0x23, 0x01, 0x1B, 0x05, 0x21, 0x33,
+    0x05, 0x21, 0x0A, 0x03, 0xE5, 0x08, 0x0A, 0x17, 0x18, 0x19, 0x01, 0x33, 0x7E, 0x00, 0x00, 0x0F,
+    0x01, 0x33, 0xC4, 0x01, 0x33, 0x7E, 0x00, 0x00, 0x03, 0x41, 0x30, 0x63, 0x6F, 0x21, 0x23, 0x04,
+    0xE2, 0x1B, 0x35, 0x00, 0x00, 0x03, 0x01, 0x33, 0xE0, 0x21, 0x13, 0x09, 0xE6, 0x13, 0x2A, 0x30,
+    0x34, 0x35, 0x38, 0x01, 0x33, 0x3A, 0x00, 0x00, 0x3B, 0x01, 0x33, 0xEC, 0x00, 0x00, 0x28, 0x00,
+    0xE6, 0x30, 0x00, 0x00, 0x03, 0x61, 0x0A, 0x01, 0x08, 0x68, 0x21, 0x35, 0x05, 0xE5, 0x18, 0x27,
+    0x34, 0x38, 0x4C, 0x01, 0x1F, 0x47, 0x00, 0x00, 0x03, 0x01, 0x22, 0x6C, 0x01, 0x22, 0x6C, 0x01,
+    0x33, 0x08, 0x62, 0x31, 0x32, 0x01, 0x30, 0x0A, 0x01, 0x32, 0x13, 0x61, 0x27, 0x01, 0x33, 0x26,
+    0xA2, 0x27, 0x41, 0x0E, 0x05, 0x65, 0x19, 0x1E, 0x30, 0x34, 0x35, 0x00, 0x6E, 0xB6, 0x01, 0x34,
+    0x35, 0x01, 0x34, 0x35, 0x01, 0x33, 0xFC, 0x01, 0x34, 0x35, 0x63, 0x19, 0x30, 0x34, 0x01, 0x30,
+    0xDF, 0x01, 0x34, 0x4A, 0x01, 0x08, 0xAD, 0xC1, 0x21, 0xFA, 0x87, 0x41, 0x44, 0x26, 0x46, 0x21,
+    0x19, 0x04, 0x42, 0x19, 0x25, 0x1C, 0xB3, 0x00, 0x03, 0x62, 0x21, 0x22, 0x01, 0x34, 0x23, 0x01,
+    0x34, 0x69, 0xF5, 0x01, 0x07, 0x08, 0x0E, 0x13, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x22,
+    0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2C, 0x40, 0x42, 0x00, 0x01, 0xC5, 0x00, 0x01, 0xAF, 0x00, 0x01,
+    0x7D, 0x01, 0x19, 0x9C, 0x00, 0x01, 0x6F, 0x00, 0x01, 0x66, 0x00, 0x01, 0x62, 0x00, 0x01, 0x3F,
+    0x00, 0x01, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xD6, 0x00,
+    0x00, 0x86, 0x00, 0x00, 0x65, 0x00, 0x00, 0x42, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x1B, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x62, 0x23, 0x40, 0x01, 0x33, 0xC8, 0x00, 0xF1, 0xA3,
+    0x21, 0x2D, 0x09, 0x62, 0x21, 0x31, 0x01, 0x34, 0xD3, 0x01, 0x34, 0x18, 0x62, 0x23, 0x25, 0x01,
+    0x29, 0xFD, 0x01, 0x34, 0xDC, 0x21, 0x32, 0x09, 0xA1, 0x01, 0x03, 0xA2, 0x01, 0x34, 0x06, 0x03,
+    0x21, 0x15, 0x05, 0xC1, 0x08, 0xC7, 0xD6, 0x63, 0x15, 0x1B, 0x22, 0x00, 0xC9, 0xE3, 0x01, 0x34,
+    0xF7, 0x01, 0x34, 0xF7, 0x61, 0x02, 0x01, 0x34, 0xF1, 0xE9, 0x08, 0x15, 0x23, 0x24, 0x25, 0x2A,
+    0x31, 0x32, 0x40, 0x01, 0x31, 0x9E, 0x00, 0x00, 0x39, 0x00, 0x00, 0x36, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x16, 0x01, 0x12, 0x31, 0x00, 0x00, 0x12, 0x01, 0x19, 0xAF, 0x00, 0x00, 0x05, 0x41, 0x2D,
+    0xF2, 0x06, 0x62, 0x15, 0x2B, 0x00, 0x00, 0x04, 0x01, 0x31, 0xC7, 0x63, 0x19, 0x32, 0x40, 0x01,
+    0x31, 0xD0, 0x00, 0x94, 0x63, 0x00, 0x55, 0x4F, 0xE1, 0x27, 0x01, 0x2F, 0x96, 0x62, 0x02, 0x29,
+    0x01, 0x2A, 0x6E, 0x01, 0x2A, 0x6E, 0x62, 0x01, 0x22, 0x00, 0x00, 0x09, 0x01, 0x35, 0x56, 0x62,
+    0x0D, 0x4C, 0x00, 0xE0, 0x8A, 0x01, 0x35, 0x5F, 0xA1, 0x13, 0x09, 0x21, 0x23, 0x03, 0x41, 0x08,
+    0xE0, 0xD8, 0x21, 0x34, 0x04, 0xE2, 0x01, 0x0A, 0x01, 0x34, 0x3D, 0x01, 0x19, 0xF2, 0xA1, 0x23,
+    0x09, 0xE3, 0x01, 0x15, 0x19, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0x35, 0x81, 0x62, 0x13,
+    0x23, 0x01, 0x35, 0x8E, 0x01, 0x24, 0xDA, 0x69, 0x09, 0x15, 0x22, 0x23, 0x25, 0x31, 0x32, 0x34,
+    0x38, 0x00, 0xCA, 0x6B, 0x01, 0x35, 0x51, 0x00, 0xF3, 0xF2, 0x00, 0x6B, 0x75, 0x01, 0x35, 0x97,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0xE2, 0x14, 0x25, 0x01,
+    0x35, 0x56, 0x01, 0x34, 0x25, 0x62, 0x32, 0x38, 0x01, 0x35, 0xC5, 0x00, 0x00, 0x09, 0x62, 0x22,
+    0x48, 0x01, 0x35, 0xCE, 0x01, 0x35, 0x95, 0xE5, 0x01, 0x0A, 0x18, 0x19, 0x42, 0x01, 0x34, 0x9F,
+    0x01, 0x32, 0xA0, 0x01, 0x35, 0x91, 0x01, 0x05, 0xFE, 0x01, 0x33, 0xD9, 0x67, 0x0A, 0x0D, 0x19,
+    0x22, 0x31, 0x32, 0x34, 0x00, 0x00, 0x27, 0x01, 0x32, 0x81, 0x01, 0x26, 0x12, 0x01, 0x35, 0xEC,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x15, 0x01, 0x32, 0xDE, 0xE1, 0x0A, 0x01, 0x35, 0xD0, 0x63, 0x31,
+    0x32, 0x39, 0x01, 0x11, 0x32, 0x01, 0x25, 0x5A, 0x00, 0x00, 0x05, 0x21, 0x0D, 0x0D, 0x61, 0x39,
+    0x01, 0x00, 0xC0, 0x61, 0x2B, 0x01, 0x33, 0x3F, 0xC1, 0x35, 0xE2, 0x82, 0x63, 0x01, 0x16, 0x32,
+    0x01, 0x36, 0x2C, 0x01, 0x34, 0xF4, 0x00, 0xA3, 0xD0, 0x63, 0x23, 0x25, 0x32, 0x01, 0x36, 0x39,
+    0x01, 0x36, 0x39, 0x01, 0x35, 0xF3, 0x41, 0x22, 0xE5, 0x64, 0x21, 0x32, 0x04, 0x41, 0x27, 0xE5,
+    0x6B, 0x21, 0x35, 0x04, 0x41, 0x38, 0xD0, 0xE5, 0x21, 0x22, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23,
+    0x03, 0xA3, 0x01, 0x0A, 0x1B, 0x17, 0x10, 0x03, 0x21, 0x4C, 0x07, 0x21, 0x23, 0x03, 0x21, 0x15,
+    0x03, 0x21, 0x2A, 0x03, 0x21, 0x32, 0x03, 0xE8, 0x01, 0x04, 0x17, 0x19, 0x25, 0x28, 0x2A, 0x40,
+    0x00, 0x00, 0x3E, 0x00, 0x56, 0x0E, 0x01, 0x36, 0x1C, 0x00, 0xC4, 0x1D, 0x01, 0x1A, 0xF4, 0x00,
+    0x00, 0x03, 0x00, 0xF9, 0x37, 0x01, 0x07, 0xEA, 0xE5, 0x10, 0x30, 0x32, 0x38, 0x4C, 0x01, 0x06,
+    0xBB, 0x01, 0x36, 0x98, 0x00, 0x00, 0x21, 0x00, 0xE6, 0x30, 0x01, 0x36, 0x98, 0x62, 0x23, 0x25,
+    0x01, 0x2B, 0xCE, 0x01, 0x2C, 0x43, 0x66, 0x18, 0x22, 0x27, 0x32, 0x34, 0x39, 0x01, 0x33, 0x4B,
+    0x00, 0x00, 0x1E, 0x00, 0xF4, 0xD1, 0x00, 0x00, 0x09, 0x01, 0x33, 0xA8, 0x01, 0x18, 0x1C, 0xE1,
+    0x1B, 0x01, 0x06, 0xF6, 0xE5, 0x27, 0x32, 0x35, 0x38, 0x39, 0x01, 0x36, 0x6E, 0x01, 0x1D, 0x65,
+    0x01, 0x36, 0xD4, 0x01, 0x1D, 0x48, 0x00, 0x00, 0x05, 0x41, 0x27, 0x11, 0x25, 0x21, 0x4C, 0x04,
+    0x62, 0x19, 0x22, 0x00, 0xB5, 0xF8, 0x01, 0x36, 0xF0, 0xE2, 0x01, 0x20, 0x01, 0x1C, 0x05, 0x01,
+    0x1B, 0x76, 0x63, 0x17, 0x22, 0x28, 0x01, 0x36, 0x3C, 0x01, 0x37, 0x01, 0x00, 0x00, 0x09, 0x41,
+    0x22, 0xEF, 0xCC, 0xE2, 0x09, 0x19, 0x01, 0x1B, 0x90, 0x00, 0x00, 0x04, 0x61, 0x32, 0x01, 0x0D,
+    0x9B, 0x64, 0x08, 0x15, 0x1A, 0x1B, 0x00, 0x00, 0x0E, 0x01, 0x37, 0x21, 0x01, 0x34, 0x0F, 0x00,
+    0x00, 0x05, 0x62, 0x2A, 0x4C, 0x01, 0x37, 0x16, 0x00, 0xB9, 0x1E, 0x21, 0x27, 0x09, 0x21, 0x14,
+    0x03, 0xE7, 0x14, 0x22, 0x31, 0x32, 0x34, 0x40, 0x42, 0x00, 0x00, 0x54, 0x01, 0x37, 0x41, 0x00,
+    0x00, 0x51, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x00, 0xF9, 0xE6, 0x00, 0x00, 0x03, 0x64, 0x31,
+    0x32, 0x38, 0x39, 0x01, 0x12, 0x82, 0x01, 0x37, 0x5D, 0x00, 0xE7, 0x25, 0x00, 0xE7, 0x25, 0x41,
+    0x34, 0x08, 0x58, 0x64, 0x01, 0x15, 0x25, 0x27, 0x01, 0x36, 0x3B, 0x00, 0x00, 0x04, 0x00, 0x1A,
+    0x41, 0x01, 0x1C, 0x4E, 0x62, 0x30, 0x34, 0x00, 0x00, 0x11, 0x01, 0x34, 0x76, 0x62, 0x1B, 0x2A,
+    0x01, 0x37, 0x8D, 0x01, 0x37, 0x8D, 0x21, 0x32, 0x09, 0x62, 0x01, 0x19, 0x01, 0x34, 0xA0, 0x01,
+    0x37, 0x33, 0x21, 0x2A, 0x09, 0x62, 0x01, 0x2A, 0x01, 0x26, 0xE4, 0x00, 0x00, 0x03, 0x67, 0x01,
+    0x0F, 0x23, 0x25, 0x27, 0x31, 0x42, 0x01, 0x36, 0x76, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2A, 0x00,
+    0x00, 0x18, 0x01, 0x1C, 0x89, 0x00, 0x00, 0x09, 0x01, 0x16, 0xD7, 0x41, 0x31, 0x80, 0x7F, 0x21,
+    0x17, 0x04, 0x21, 0x18, 0x03, 0x63, 0x32, 0x34, 0x38, 0x01, 0x27, 0x10, 0x00, 0x00, 0x03, 0x00,
+    0xEC, 0xF1, 0xE1, 0x15, 0x01, 0x19, 0x15, 0x63, 0x07, 0x0A, 0x15, 0x01, 0x25, 0x21, 0x01, 0x37,
+    0xE7, 0x01, 0x13, 0x0B, 0x61, 0x2A, 0x01, 0x15, 0x1C, 0x21, 0x07, 0x05, 0x21, 0x31, 0x03, 0xA1,
+    0x23, 0x03, 0x21, 0x35, 0x03, 0x62, 0x14, 0x35, 0x00, 0x00, 0x03, 0x01, 0x38, 0x05, 0xE6, 0x04,
+    0x0A, 0x14, 0x27, 0x29, 0x2A, 0x01, 0x38, 0x0E, 0x01, 0x38, 0x0E, 0x01, 0x37, 0xA8, 0x00, 0x00,
+    0x09, 0x01, 0x38, 0x0E, 0x01, 0x38, 0x0E, 0x44, 0x27, 0x31, 0x32, 0x39, 0x00, 0x45, 0x00, 0x40,
+    0x00, 0x19, 0x77, 0xF4, 0xE2, 0x31, 0x32, 0x01, 0x38, 0x33, 0x01, 0x38, 0x33, 0x61, 0x2A, 0x01,
+    0x37, 0xD7, 0x62, 0x07, 0x15, 0x00, 0x00, 0x05, 0x01, 0x23, 0x7C, 0x41, 0x19, 0x7C, 0x42, 0xE2,
+    0x15, 0x22, 0x01, 0x23, 0x89, 0x01, 0x1C, 0xE3, 0x62, 0x02, 0x15, 0x01, 0x38, 0x58, 0x00, 0x00,
+    0x09, 0x61, 0x14, 0x01, 0x37, 0x5F, 0x21, 0x25, 0x05, 0x21, 0x34, 0x03, 0x21, 0x1A, 0x03, 0x66,
+    0x19, 0x25, 0x31, 0x32, 0x38, 0x40, 0x01, 0x38, 0x6F, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x2D, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x17, 0x00, 0x00, 0x03, 0x62, 0x0A, 0x15, 0x01, 0x38, 0x88, 0x00, 0xCD,
+    0x74, 0x62, 0x04, 0x21, 0x01, 0x35, 0x26, 0x01, 0x38, 0x91, 0x62, 0x20, 0x30, 0x00, 0xF7, 0xA8,
+    0x01, 0x38, 0x9A, 0x21, 0x22, 0x09, 0x62, 0x01, 0x4C, 0x01, 0x38, 0xA6, 0x01, 0x38, 0xA6, 0x21,
+    0x2B, 0x09, 0x62, 0x18, 0x2C, 0x01, 0x38, 0xB2, 0x00, 0x00, 0x03, 0xE8, 0x15, 0x21, 0x27, 0x31,
+    0x32, 0x34, 0x38, 0x39, 0x01, 0x35, 0x50, 0x01, 0x23, 0x90, 0x01, 0x35, 0x50, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x2A, 0x00, 0x00, 0x18, 0x00, 0x00, 0x09, 0x01, 0x38, 0xA8, 0x41, 0x2D, 0xF6, 0xF7,
+    0x21, 0x34, 0x04, 0x62, 0x32, 0x48, 0x01, 0x38, 0xE3, 0x01, 0x38, 0x7D, 0x62, 0x19, 0x22, 0x01,
+    0x37, 0x55, 0x01, 0x38, 0xEC, 0x41, 0x31, 0x16, 0xE9, 0xE1, 0x34, 0x01, 0x0D, 0x5C, 0x65, 0x14,
+    0x1B, 0x27, 0x28, 0x2A, 0x01, 0x38, 0xFE, 0x01, 0x38, 0xFE, 0x00, 0x00, 0x09, 0x01, 0x38, 0xFE,
+    0x00, 0x00, 0x05, 0x61, 0x21, 0x01, 0x34, 0xEE, 0x62, 0x44, 0x47, 0x00, 0x00, 0x05, 0x01, 0x36,
+    0xE7, 0x21, 0x25, 0x09, 0x66, 0x19, 0x22, 0x25, 0x31, 0x32, 0x40, 0x00, 0x00, 0x44, 0x01, 0x39,
+    0x24, 0x00, 0x00, 0x41, 0x00, 0x00, 0x38, 0x00, 0x00, 0x26, 0x00, 0x00, 0x03, 0x62, 0x13, 0x30,
+    0x01, 0x39, 0x21, 0x01, 0x39, 0x3D, 0xE2, 0x32, 0x4C, 0x01, 0x38, 0x0B, 0x01, 0x39, 0x46, 0x21,
+    0x19, 0x09, 0x63, 0x0F, 0x12, 0x19, 0x01, 0x39, 0x52, 0x00, 0x00, 0x03, 0x01, 0x39, 0x52, 0xE3,
+    0x21, 0x30, 0x4C, 0x00, 0xE1, 0x06, 0x01, 0x39, 0x5F, 0x01, 0x39, 0x5F, 0x62, 0x17, 0x2B, 0x01,
+    0x39, 0x6C, 0x00, 0x00, 0x0D, 0x63, 0x08, 0x15, 0x18, 0x01, 0x39, 0x75, 0x01, 0x39, 0x75, 0x01,
+    0x39, 0x75, 0xA4, 0x23, 0x31, 0x32, 0x34, 0x45, 0x30, 0x16, 0x0D, 0xC1, 0x23, 0xFD, 0x06, 0x21,
+    0x23, 0x04, 0xE3, 0x01, 0x30, 0x32, 0x00, 0x00, 0x03, 0x01, 0x39, 0x92, 0x01, 0x26, 0x74, 0x63,
+    0x02, 0x07, 0x25, 0x00, 0x70, 0x0C, 0x01, 0x26, 0xD9, 0x01, 0x39, 0x9F, 0x45, 0x23, 0x27, 0x31,
+    0x32, 0x38, 0xF8, 0x07, 0x00, 0x1A, 0xE9, 0x58, 0x00, 0x0D, 0x57, 0xA3, 0x62, 0x01, 0x22, 0x01,
+    0x35, 0x97, 0x01, 0x39, 0xBC, 0x65, 0x13, 0x18, 0x31, 0x32, 0x38, 0x01, 0x36, 0xE1, 0x01, 0x39,
+    0x7F, 0x00, 0x00, 0x09, 0x01, 0x29, 0x11, 0x00, 0x0C, 0xB6, 0x41, 0x19, 0xA7, 0x61, 0x21, 0x2D,
+    0x04, 0x62, 0x2D, 0x32, 0x01, 0x37, 0xD2, 0x01, 0x39, 0x9B, 0x41, 0x0A, 0xD3, 0x0B, 0x21, 0x23,
+    0x04, 0x41, 0x38, 0x9F, 0x7B, 0xE2, 0x27, 0x41, 0x01, 0x28, 0x24, 0x00, 0xE7, 0x62, 0x21, 0x35,
+    0x09, 0x21, 0x0D, 0x03, 0x63, 0x0A, 0x0D, 0x22, 0x01, 0x38, 0x8C, 0x00, 0x00, 0x03, 0x01, 0x3A,
+    0x04, 0xE3, 0x1A, 0x30, 0x32, 0x00, 0x43, 0x1F, 0x01, 0x3A, 0x11, 0x01, 0x3A, 0x11, 0x41, 0x22,
+    0x29, 0x8B, 0x21, 0x19, 0x04, 0x62, 0x31, 0x32, 0x01, 0x1D, 0x49, 0x00, 0x00, 0x03, 0x67, 0x02,
+    0x21, 0x22, 0x23, 0x25, 0x2A, 0x2B, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x09, 0x01, 0x39, 0x2C, 0x00,
+    0x4A, 0xE0, 0x01, 0x3A, 0x2E, 0x01, 0x36, 0xC3, 0x01, 0x16, 0x0B, 0x41, 0x21, 0xA2, 0xA0, 0x21,
+    0x32, 0x04, 0x21, 0x04, 0x03, 0x62, 0x08, 0x4C, 0x01, 0x17, 0x7D, 0x01, 0x3A, 0x55, 0x41, 0x29,
+    0xE3, 0x0D, 0xA1, 0x01, 0x04, 0x22, 0x34, 0x4C, 0x10, 0x03, 0x21, 0x18, 0x05, 0x22, 0x07, 0x17,
+    0x1B, 0x03, 0x6D, 0x01, 0x04, 0x14, 0x21, 0x22, 0x23, 0x24, 0x2A, 0x31, 0x32, 0x34, 0x38, 0x39,
+    0x01, 0x1B, 0xDC, 0x00, 0x00, 0x94, 0x00, 0x00, 0x91, 0x01, 0x3A, 0x72, 0x01, 0x3A, 0x72, 0x00,
+    0x00, 0x84, 0x01, 0x37, 0x64, 0x00, 0x00, 0x81, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x44, 0x00, 0xFD,
+    0xDC, 0x00, 0x00, 0x05, 0x01, 0x39, 0xBD, 0x62, 0x22, 0x23, 0x01, 0x1D, 0x11, 0x00, 0x79, 0x9A,
+    0x41, 0x2A, 0x75, 0x31, 0x21, 0x07, 0x04, 0x65, 0x04, 0x07, 0x25, 0x32, 0x34, 0x01, 0x3A, 0xB7,
+    0x01, 0x27, 0xF1, 0x01, 0x1D, 0x1D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x42, 0x31, 0x32, 0xDD,
+    0x8B, 0x45, 0xA7, 0x61, 0x23, 0x01, 0x39, 0x1B, 0x21, 0x22, 0x05, 0x21, 0x35, 0x03, 0xC1, 0x2A,
+    0xE5, 0x64, 0x61, 0x28, 0x01, 0x24, 0xE7, 0x64, 0x27, 0x28, 0x2D, 0x42, 0x01, 0x16, 0xE8, 0x00,
+    0x00, 0x09, 0x01, 0x36, 0xBB, 0x00, 0x00, 0x05, 0x61, 0x22, 0x01, 0x19, 0xAC, 0x62, 0x01, 0x35,
+    0x01, 0x3A, 0xFD, 0x00, 0x00, 0x05, 0x41, 0x22, 0x6C, 0x19, 0x21, 0x31, 0x04, 0xE3, 0x01, 0x0A,
+    0x13, 0x01, 0x39, 0xD5, 0x00, 0x00, 0x03, 0x01, 0x3A, 0xF1, 0x21, 0x29, 0x0D, 0x6B, 0x04, 0x0A,
+    0x17, 0x19, 0x22, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x00, 0xDC, 0xF0, 0x00, 0x00, 0x42, 0x00,
+    0x00, 0x36, 0x01, 0x38, 0x0F, 0x01, 0x3A, 0xE4, 0x01, 0x15, 0xB3, 0x01, 0x3B, 0x0A, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x03, 0x01, 0x39, 0x1F, 0x00, 0x02, 0xE0, 0x64, 0x04, 0x08, 0x12, 0x18, 0x01,
+    0x3B, 0x4A, 0x00, 0xCD, 0x71, 0x01, 0x3B, 0x4A, 0x00, 0xCD, 0x71, 0x63, 0x01, 0x08, 0x21, 0x01,
+    0x3B, 0x5B, 0x01, 0x0B, 0x82, 0x01, 0x3B, 0x5B, 0x65, 0x19, 0x21, 0x22, 0x23, 0x25, 0x01, 0x39,
+    0x7E, 0x00, 0x9B, 0x51, 0x01, 0x28, 0x7E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0D, 0x61, 0x1B, 0x01,
+    0x0F, 0x76, 0xA1, 0x40, 0x05, 0x62, 0x07, 0x19, 0x00, 0x00, 0x03, 0x01, 0x3B, 0x85, 0xFF, 0x20,
+    0x01, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0D, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1E, 0x20, 0x21, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x40, 0x42, 0x44, 0x48,
+    0x00, 0x06, 0x85, 0x00, 0x06, 0x5C, 0x00, 0x06, 0x53, 0x00, 0x06, 0x46, 0x00, 0x05, 0xF7, 0x00,
+    0x05, 0xA2, 0x00, 0x05, 0x73, 0x00, 0x05, 0x70, 0x00, 0x05, 0x6B, 0x00, 0x05, 0x66, 0x00, 0x05,
+    0x62, 0x01, 0x3A, 0xC8, 0x00, 0x04, 0xD8, 0x00, 0x04, 0xBA, 0x00, 0x04, 0x4D, 0x00, 0x04, 0x30,
+    0x00, 0x03, 0xE0, 0x00, 0x03, 0xB9, 0x00, 0x03, 0x67, 0x00, 0x03, 0x1F, 0x00, 0x02, 0xD3, 0x00,
+    0x02, 0x6A, 0x00, 0x02, 0x0C, 0x00, 0x01, 0xE2, 0x00, 0x01, 0xC9, 0x00, 0x01, 0x1C, 0x00, 0x00,
+    0xD7, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x71, 0x00, 0x00, 0x26, 0x01, 0x3B, 0x30, 0x00, 0x00, 0x09,
+    0x41, 0x35, 0x01, 0x18, 0x21, 0x27, 0x04, 0x21, 0x40, 0x03, 0x62, 0x39, 0x48, 0x00, 0x00, 0x03,
+    0x01, 0x3B, 0xB4, 0x62, 0x17, 0x42, 0x00, 0xAC, 0xFD, 0x01, 0x3B, 0xCE, 0x21, 0x35, 0x09, 0xE5,
+    0x01, 0x0A, 0x1A, 0x2A, 0x30, 0x01, 0x21, 0x3B, 0x01, 0x3B, 0xF6, 0x01, 0x18, 0x26, 0x01, 0x1F,
+    0x2A, 0x01, 0x3C, 0x2F, 0x62, 0x27, 0x41, 0x01, 0x3B, 0x42, 0x00, 0x08, 0x19, 0xED, 0x04, 0x08,
+    0x0A, 0x0B, 0x13, 0x14, 0x15, 0x19, 0x23, 0x2A, 0x42, 0x48, 0x49, 0x01, 0x3C, 0x4D, 0x01, 0x27,
+    0x87, 0x01, 0x10, 0xB0, 0x00, 0x00, 0x33, 0x01, 0x3B, 0xE7, 0x00, 0x00, 0x21, 0x01, 0x3C, 0x4D,
+    0x00, 0xFA, 0x68, 0x00, 0x00, 0x1E, 0x01, 0x38, 0xE2, 0x00, 0xFA, 0x64, 0x00, 0x00, 0x09, 0x01,
+    0x3B, 0xFE, 0x61, 0x0A, 0x01, 0x39, 0x9A, 0x21, 0x32, 0x05, 0x62, 0x20, 0x21, 0x01, 0x3C, 0x24,
+    0x00, 0x00, 0x03, 0xE2, 0x1A, 0x2A, 0x01, 0x3B, 0xDB, 0x00, 0x00, 0x09, 0xE2, 0x32, 0x34, 0x01,
+    0x18, 0x4C, 0x00, 0x00, 0x09, 0x61, 0x32, 0x01, 0x1B, 0x7D, 0x61, 0x35, 0x01, 0x1B, 0x5E, 0x62,
+    0x21, 0x44, 0x01, 0x3C, 0xAF, 0x00, 0x03, 0x9C, 0x21, 0x23, 0x09, 0x21, 0x1F, 0x03, 0x23, 0x04,
+    0x1F, 0x41, 0x19, 0x14, 0x03, 0x41, 0x19, 0x0F, 0x52, 0x63, 0x07, 0x19, 0x22, 0x01, 0x3C, 0xC9,
+    0x01, 0x20, 0x48, 0x01, 0x3C, 0xC9, 0x67, 0x10, 0x12, 0x14, 0x1A, 0x25, 0x48, 0x49, 0x01, 0x28,
+    0x10, 0x00, 0x00, 0x3A, 0x01, 0x3C, 0xD6, 0x01, 0x3C, 0xD6, 0x00, 0x00, 0x18, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x0D, 0xE1, 0x27, 0x01, 0x24, 0x3F, 0x65, 0x14, 0x1A, 0x2A, 0x48, 0x49, 0x01, 0x32,
+    0x46, 0x00, 0x00, 0x05, 0x01, 0x03, 0xA7, 0x00, 0xB6, 0xA8, 0x01, 0x3C, 0xF8, 0x61, 0x19, 0x01,
+    0x1E, 0x25, 0x63, 0x01, 0x14, 0x15, 0x01, 0x21, 0xED, 0x01, 0x3B, 0x03, 0x00, 0xA7, 0x0D, 0x42,
+    0x19, 0x23, 0x11, 0x95, 0x00, 0x0D, 0x62, 0x07, 0x19, 0x00, 0xE4, 0x85, 0x01, 0x3D, 0x26, 0xE2,
+    0x15, 0x32, 0x01, 0x3C, 0xC9, 0x01, 0x3D, 0x2E, 0xE7, 0x01, 0x02, 0x07, 0x17, 0x19, 0x22, 0x27,
+    0x01, 0x3C, 0x00, 0x01, 0x3C, 0xDD, 0x01, 0x3D, 0x38, 0x01, 0x3C, 0x39, 0x01, 0x3D, 0x38, 0x00,
+    0x00, 0x09, 0x00, 0xD5, 0x3D, 0x22, 0x2D, 0x32, 0x2F, 0x1D, 0x61, 0x2B, 0x01, 0x0F, 0xB3, 0xE4,
+    0x07, 0x22, 0x27, 0x40, 0x01, 0x3D, 0x5F, 0x01, 0x3D, 0x5F, 0x00, 0xD2, 0xB3, 0x00, 0x00, 0x05,
+    0x21, 0x32, 0x11, 0x7F, 0x1F, 0x01, 0x07, 0x08, 0x0A, 0x0E, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19,
+    0x1B, 0x22, 0x23, 0x24, 0x25, 0x28, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x38, 0x39,
+    0x40, 0x42, 0x48, 0x49, 0x00, 0x12, 0xFC, 0x00, 0x12, 0x97, 0x00, 0x12, 0x62, 0x00, 0x12, 0x45,
+    0x00, 0x12, 0x3C, 0x00, 0x12, 0x1D, 0x01, 0x3C, 0xAD, 0x01, 0x3A, 0x08, 0x00, 0x12, 0x03, 0x00,
+    0x11, 0xF2, 0x00, 0x11, 0xB7, 0x00, 0x11, 0x96, 0x00, 0x11, 0x77, 0x00, 0x10, 0xE7, 0x00, 0x10,
+    0xA5, 0x00, 0x10, 0x83, 0x00, 0x10, 0x76, 0x00, 0x10, 0x32, 0x00, 0x77, 0xF4, 0x00, 0x0F, 0x6A,
+    0x01, 0x3D, 0x73, 0x00, 0x0B, 0x24, 0x00, 0x09, 0x01, 0x00, 0x01, 0xE5, 0x00, 0x01, 0x26, 0x00,
+    0x00, 0x9D, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x66, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x03, 0xE3, 0x15, 0x34, 0x35, 0x01, 0x3D, 0xD5, 0x01, 0x3D, 0xF1, 0x01, 0x3D, 0xF1, 0x21, 0x19,
+    0x0D, 0xE4, 0x01, 0x0F, 0x25, 0x38, 0x00, 0xE5, 0x93, 0x01, 0x3E, 0x01, 0x01, 0x3E, 0x01, 0x00,
+    0x00, 0x03, 0x61, 0x06, 0x01, 0x12, 0x75, 0xE6, 0x01, 0x1A, 0x1B, 0x1E, 0x27, 0x31, 0x01, 0x3E,
+    0x17, 0x01, 0x20, 0x28, 0x00, 0xCD, 0xDA, 0x00, 0xB5, 0x50, 0x00, 0xB5, 0x50, 0x00, 0x00, 0x05,
+    0x41, 0x34, 0x35, 0x70, 0x41, 0x21, 0xF2, 0xD8, 0x62, 0x19, 0x32, 0x01, 0x3A, 0xCD, 0x00, 0x00,
+    0x04, 0x61, 0x01, 0x01, 0x3D, 0xD8, 0x62, 0x39, 0x4C, 0x01, 0x3E, 0x46, 0x01, 0x3E, 0x46, 0x21,
+    0x22, 0x09, 0xE1, 0x18, 0x01, 0x3D, 0xEC, 0x65, 0x13, 0x16, 0x17, 0x19, 0x22, 0x00, 0x00, 0x08,
+    0x01, 0x0E, 0x7E, 0x00, 0x00, 0x05, 0x01, 0x2B, 0xEF, 0x01, 0x3E, 0x57, 0x62, 0x17, 0x18, 0x00,
+    0xF3, 0x88, 0x01, 0x3E, 0x6C, 0x21, 0x38, 0x09, 0x65, 0x17, 0x1E, 0x22, 0x27, 0x2A, 0x00, 0xF3,
+    0x94, 0x01, 0x34, 0xEC, 0x00, 0x00, 0x03, 0x01, 0x29, 0x4D, 0x01, 0x34, 0x0E, 0x62, 0x31, 0x32,
+    0x01, 0x3D, 0x38, 0x00, 0xF4, 0x06, 0x61, 0x12, 0x01, 0x3E, 0x96, 0x21, 0x23, 0x05, 0x21, 0x42,
+    0x03, 0x21, 0x34, 0x03, 0x62, 0x27, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x3E, 0xA4, 0x21, 0x23, 0x09,
+    0x21, 0x17, 0x03, 0x21, 0x19, 0x03, 0xC2, 0x1E, 0x34, 0xDD, 0xDD, 0x00, 0x03, 0x21, 0x23, 0x07,
+    0x62, 0x04, 0x27, 0x00, 0x00, 0x03, 0x01, 0x3E, 0x62, 0x62, 0x22, 0x40, 0x01, 0x2A, 0xFB, 0x00,
+    0x27, 0xA6, 0x21, 0x0D, 0x09, 0x21, 0x38, 0x03, 0x62, 0x01, 0x19, 0x01, 0x2E, 0x17, 0x01, 0x3A,
+    0xB3, 0x21, 0x31, 0x09, 0x21, 0x08, 0x03, 0x21, 0x30, 0x03, 0x62, 0x17, 0x23, 0x01, 0x3C, 0x6D,
+    0x00, 0x00, 0x03, 0x62, 0x23, 0x34, 0x00, 0x40, 0xB8, 0x01, 0x23, 0x6C, 0x42, 0x18, 0x42, 0xA9,
+    0xF7, 0x5B, 0x4C, 0x21, 0x32, 0x07, 0x21, 0x2B, 0x03, 0x61, 0x14, 0x01, 0x23, 0x9D, 0x21, 0x2A,
+    0x05, 0x21, 0x32, 0x03, 0x21, 0x28, 0x03, 0x21, 0x19, 0x03, 0x21, 0x15, 0x03, 0x62, 0x31, 0x32,
+    0x00, 0x00, 0x03, 0x01, 0x1C, 0x05, 0x62, 0x08, 0x44, 0x00, 0xCA, 0x42, 0x01, 0x3E, 0xC8, 0x62,
+    0x23, 0x34, 0x01, 0x3E, 0xC9, 0x00, 0x00, 0x09, 0x41, 0x42, 0x36, 0x92, 0x21, 0x20, 0x04, 0x21,
+    0x38, 0x03, 0x61, 0x01, 0x01, 0x1B, 0x43, 0xA1, 0x40, 0x05, 0x21, 0x30, 0x03, 0x61, 0x17, 0x01,
+    0x3E, 0x41, 0x21, 0x22, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x49, 0x03, 0x21, 0x40, 0x19, 0x41, 0x19,
+    0xD8, 0xE7, 0x21, 0x0A, 0x04, 0x63, 0x02, 0x14, 0x1E, 0x01, 0x3F, 0x65, 0x01, 0x23, 0xF9, 0x00,
+    0xE7, 0x6B, 0x68, 0x07, 0x23, 0x27, 0x30, 0x31, 0x32, 0x33, 0x38, 0x00, 0xE5, 0x4D, 0x00, 0x00,
+    0x1A, 0x00, 0x6C, 0xCA, 0x00, 0x00, 0x17, 0x00, 0x00, 0x10, 0x01, 0x2E, 0xF9, 0x00, 0xCC, 0x42,
+    0x00, 0x00, 0x0D, 0x62, 0x01, 0x21, 0x00, 0xB6, 0x3A, 0x01, 0x35, 0x48, 0x42, 0x22, 0x31, 0x69,
+    0xED, 0x00, 0x09, 0x61, 0x43, 0x01, 0x32, 0x3B, 0x21, 0x07, 0x05, 0x21, 0x22, 0x03, 0x21, 0x35,
+    0x03, 0x41, 0x07, 0xE2, 0x58, 0x21, 0x2D, 0x04, 0x21, 0x37, 0x03, 0x64, 0x0A, 0x17, 0x21, 0x2D,
+    0x00, 0x00, 0x0D, 0x01, 0x3C, 0x88, 0x00, 0x00, 0x03, 0x00, 0xD0, 0x66, 0xEF, 0x08, 0x15, 0x18,
+    0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x27, 0x28, 0x29, 0x2A, 0x2D, 0x40, 0x01, 0x1A, 0x5F, 0x00,
+    0xD2, 0x89, 0x00, 0x01, 0x3F, 0x00, 0x01, 0x0C, 0x00, 0x00, 0xF7, 0x00, 0x00, 0xE2, 0x00, 0x00,
+    0xD9, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x82,
+    0x00, 0x00, 0x5A, 0x00, 0x00, 0x30, 0x00, 0x00, 0x11, 0xE8, 0x20, 0x21, 0x23, 0x27, 0x31, 0x32,
+    0x35, 0x38, 0x01, 0x40, 0x09, 0x01, 0x2A, 0xDE, 0x00, 0x01, 0xC8, 0x01, 0x2A, 0xDE, 0x00, 0x01,
+    0xB2, 0x00, 0x01, 0x91, 0x00, 0x00, 0x3D, 0x00, 0xD4, 0xF1, 0x41, 0x04, 0x1C, 0x0F, 0x62, 0x04,
+    0x07, 0x01, 0x25, 0xAA, 0x00, 0x00, 0x04, 0x62, 0x0E, 0x32, 0x01, 0x40, 0x1B, 0x01, 0x40, 0x37,
+    0x21, 0x29, 0x09, 0x63, 0x20, 0x31, 0x34, 0x01, 0x40, 0x43, 0x01, 0x3D, 0x2B, 0x00, 0x00, 0x03,
+    0x61, 0x38, 0x01, 0x40, 0x0A, 0x61, 0x2A, 0x01, 0x26, 0xE6, 0xC3, 0x28, 0x31, 0x32, 0x00, 0x0A,
+    0x00, 0x05, 0xC2, 0x46, 0xE2, 0x18, 0x19, 0x01, 0x40, 0x1E, 0x01, 0x40, 0x64, 0x62, 0x18, 0x34,
+    0x01, 0x40, 0x27, 0x00, 0x00, 0x09, 0xE2, 0x01, 0x04, 0x01, 0x39, 0x88, 0x01, 0x0A, 0x3A, 0xA1,
+    0x01, 0x09, 0xC1, 0x19, 0x8F, 0x53, 0xE2, 0x28, 0x2A, 0x01, 0x3E, 0xD4, 0x01, 0x3D, 0x56, 0xE2,
+    0x19, 0x4C, 0x01, 0x40, 0x29, 0x00, 0x00, 0x09, 0x22, 0x32, 0x34, 0x16, 0x09, 0xE3, 0x20, 0x30,
+    0x4C, 0x00, 0xFF, 0xAB, 0x01, 0x40, 0x9D, 0x01, 0x40, 0x9D, 0xE1, 0x32, 0x01, 0x23, 0xF2, 0x64,
+    0x14, 0x15, 0x22, 0x23, 0x00, 0x00, 0x17, 0x01, 0x2B, 0xE9, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05,
+    0x63, 0x23, 0x32, 0x38, 0x01, 0x40, 0xC0, 0x01, 0x40, 0xC0, 0x01, 0x40, 0xC0, 0x21, 0x01, 0x0D,
+    0x61, 0x18, 0x01, 0x10, 0xF7, 0x62, 0x30, 0x35, 0x01, 0x40, 0xD5, 0x01, 0x2E, 0x6D, 0x21, 0x19,
+    0x09, 0x21, 0x2A, 0x03, 0x61, 0x25, 0x01, 0x2F, 0x10, 0x21, 0x39, 0x05, 0x62, 0x21, 0x4C, 0x00,
+    0x00, 0x03, 0x01, 0x40, 0xEC, 0x21, 0x17, 0x09, 0xE3, 0x01, 0x28, 0x41, 0x01, 0x26, 0x04, 0x01,
+    0x2E, 0xDA, 0x00, 0xEE, 0x65, 0xE2, 0x01, 0x22, 0x01, 0x40, 0x3F, 0x00, 0x00, 0x0D, 0x62, 0x14,
+    0x15, 0x01, 0x40, 0xC8, 0x00, 0xA0, 0xFF, 0x69, 0x01, 0x07, 0x15, 0x17, 0x19, 0x1E, 0x22, 0x25,
+    0x2A, 0x00, 0x00, 0x68, 0x00, 0x00, 0x4A, 0x00, 0xCE, 0x38, 0x00, 0x00, 0x47, 0x00, 0x00, 0x36,
+    0x00, 0x00, 0x22, 0x01, 0x2F, 0x4D, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x41, 0x17, 0xF6, 0x58,
+    0x21, 0x38, 0x04, 0x61, 0x38, 0x01, 0x15, 0xA6, 0xE3, 0x1E, 0x21, 0x30, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x05, 0x01, 0x41, 0x48, 0xE2, 0x15, 0x22, 0x01, 0x3D, 0xEA, 0x00, 0x00, 0x0D, 0xC1, 0x23,
+    0x8F, 0x6B, 0xE3, 0x23, 0x34, 0x4C, 0x01, 0x2E, 0x44, 0x01, 0x37, 0xD6, 0x01, 0x41, 0x62, 0x21,
+    0x15, 0x0D, 0x41, 0x30, 0x14, 0x63, 0x21, 0x29, 0x04, 0x21, 0x34, 0x03, 0xE2, 0x27, 0x39, 0x00,
+    0x00, 0x03, 0x01, 0x41, 0x1E, 0x62, 0x17, 0x34, 0x00, 0x00, 0x09, 0x01, 0x2F, 0xE4, 0x41, 0x01,
+    0x94, 0x84, 0x21, 0x31, 0x04, 0x21, 0x25, 0x03, 0x61, 0x18, 0x01, 0x2F, 0x77, 0x21, 0x38, 0x05,
+    0xE2, 0x25, 0x41, 0x01, 0x3D, 0x92, 0x01, 0x11, 0x11, 0x61, 0x30, 0x01, 0x0C, 0x0C, 0x21, 0x4A,
+    0x05, 0x21, 0x1B, 0x03, 0x21, 0x41, 0x03, 0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x21, 0x08, 0x03,
+    0xE6, 0x2A, 0x2B, 0x2D, 0x32, 0x40, 0x42, 0x00, 0xE4, 0xEA, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x01, 0x27, 0xFD, 0x41, 0x32, 0x8E, 0x3B, 0xE2, 0x32, 0x4C,
+    0x00, 0x8E, 0x3F, 0x01, 0x41, 0xDD, 0x21, 0x23, 0x09, 0x61, 0x20, 0x01, 0x41, 0xE8, 0x21, 0x21,
+    0x05, 0x21, 0x31, 0x03, 0x21, 0x16, 0x03, 0x21, 0x1B, 0x03, 0xE6, 0x08, 0x30, 0x32, 0x35, 0x39,
+    0x4C, 0x01, 0x41, 0xAE, 0x01, 0x41, 0xFA, 0x00, 0x8E, 0x5C, 0x01, 0x41, 0x3F, 0x00, 0x00, 0x03,
+    0x01, 0x41, 0xFA, 0x65, 0x01, 0x14, 0x15, 0x19, 0x4C, 0x01, 0x42, 0x13, 0x00, 0x00, 0x3A, 0x00,
+    0x00, 0x2D, 0x00, 0x00, 0x19, 0x01, 0x41, 0xDA, 0x6C, 0x01, 0x0E, 0x10, 0x13, 0x15, 0x19, 0x1B,
+    0x1E, 0x23, 0x25, 0x28, 0x2A, 0x00, 0x00, 0xD3, 0x01, 0x42, 0x27, 0x01, 0x2C, 0xAB, 0x01, 0x42,
+    0x28, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xB9, 0x01, 0x42, 0x28, 0x01, 0x41, 0xE2, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x68, 0x00, 0x15, 0x19, 0x00, 0x00, 0x15, 0x62, 0x29, 0x32, 0x01, 0x42, 0x58, 0x01,
+    0x42, 0x13, 0x62, 0x23, 0x32, 0x00, 0x59, 0x0F, 0x01, 0x42, 0x62, 0x61, 0x34, 0x01, 0x28, 0xDF,
+    0x61, 0x32, 0x01, 0x3F, 0x2C, 0x61, 0x31, 0x01, 0x22, 0x3B, 0x41, 0x19, 0x29, 0xC4, 0x21, 0x21,
+    0x04, 0x21, 0x23, 0x03, 0x21, 0x23, 0x03, 0xA1, 0x18, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x29, 0x03,
+    0x21, 0x07, 0x03, 0x41, 0x01, 0xB9, 0x3A, 0x21, 0x31, 0x04, 0x61, 0x0A, 0x01, 0x1D, 0xBE, 0xEA,
+    0x0A, 0x16, 0x19, 0x1E, 0x21, 0x23, 0x27, 0x2A, 0x2D, 0x42, 0x01, 0x27, 0x1C, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2A, 0x00, 0x00, 0x0F, 0x00, 0xEA, 0x46, 0x01, 0x1A, 0xBA, 0x00, 0xE5, 0x49, 0x00,
+    0xED, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0xE3, 0x30, 0x32, 0x34, 0x01, 0x42, 0xC8, 0x01,
+    0x42, 0xC8, 0x00, 0x00, 0x29, 0x63, 0x23, 0x32, 0x34, 0x01, 0x2D, 0xC7, 0x01, 0x42, 0x8F, 0x01,
+    0x40, 0xA4, 0xE8, 0x01, 0x27, 0x28, 0x30, 0x32, 0x34, 0x35, 0x4C, 0x00, 0x00, 0x0D, 0x01, 0x31,
+    0x11, 0x00, 0xF6, 0xD7, 0x01, 0x42, 0xE2, 0x01, 0x42, 0x99, 0x01, 0x42, 0xA9, 0x01, 0x42, 0xE2,
+    0x01, 0x42, 0xE2, 0xE1, 0x19, 0x01, 0x22, 0xC9, 0x22, 0x1B, 0x32, 0x26, 0x05, 0x41, 0x36, 0xE5,
+    0xCC, 0x61, 0x25, 0x01, 0x1D, 0xE9, 0x21, 0x44, 0x05, 0xE5, 0x25, 0x30, 0x34, 0x40, 0x42, 0x00,
+    0x00, 0x0C, 0x01, 0x43, 0x19, 0x00, 0x00, 0x03, 0x00, 0x56, 0x38, 0x00, 0x7C, 0x0E, 0x62, 0x35,
+    0x38, 0x01, 0x29, 0xA2, 0x01, 0x43, 0x2E, 0x61, 0x29, 0x01, 0x30, 0xCF, 0x21, 0x34, 0x05, 0x21,
+    0x28, 0x03, 0x21, 0x38, 0x03, 0x21, 0x19, 0x03, 0x62, 0x32, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x43,
+    0x48, 0x63, 0x0E, 0x0F, 0x22, 0x01, 0x2E, 0x8B, 0x01, 0x43, 0x35, 0x00, 0x00, 0x09, 0x41, 0x23,
+    0x0F, 0xA5, 0x6D, 0x01, 0x02, 0x04, 0x07, 0x15, 0x16, 0x1E, 0x23, 0x25, 0x27, 0x28, 0x29, 0x42,
+    0x00, 0x01, 0x09, 0x00, 0x01, 0x00, 0x01, 0x28, 0xDE, 0x00, 0x32, 0x07, 0x01, 0x43, 0x62, 0x01,
+    0x42, 0x9C, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x49, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0xE3, 0x20, 0x34, 0x35, 0x01, 0x0A, 0xBD, 0x01, 0x43,
+    0x5E, 0x01, 0x43, 0x97, 0x21, 0x23, 0x0D, 0xE2, 0x01, 0x25, 0x01, 0x29, 0x23, 0x01, 0x43, 0xA7,
+    0x61, 0x29, 0x01, 0x40, 0x45, 0xE2, 0x27, 0x2D, 0x01, 0x06, 0x4C, 0x01, 0x43, 0x66, 0x24, 0x02,
+    0x15, 0x23, 0x25, 0x1A, 0x17, 0x0E, 0x09, 0x41, 0x34, 0x4F, 0x23, 0xE5, 0x18, 0x19, 0x20, 0x27,
+    0x2A, 0x01, 0x42, 0x8D, 0x00, 0x00, 0x04, 0x01, 0x43, 0xA6, 0x01, 0x31, 0xFA, 0x00, 0xE5, 0x95,
+    0x21, 0x32, 0x15, 0xA1, 0x29, 0x03, 0x21, 0x01, 0x03, 0xE1, 0x31, 0x01, 0x41, 0xDA, 0x63, 0x23,
+    0x25, 0x30, 0x01, 0x34, 0x81, 0x00, 0x00, 0x05, 0x01, 0x43, 0xEE, 0x61, 0x2A, 0x01, 0x25, 0x95,
+    0x62, 0x15, 0x2A, 0x01, 0x43, 0x97, 0x01, 0x44, 0x00, 0x64, 0x07, 0x31, 0x32, 0x34, 0x01, 0x41,
+    0x40, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x01, 0x43, 0x54, 0xE8, 0x01, 0x19, 0x21, 0x23, 0x27,
+    0x2D, 0x32, 0x40, 0x01, 0x43, 0xD4, 0x00, 0x92, 0x2A, 0x00, 0x00, 0x11, 0x01, 0x44, 0x1A, 0x01,
+    0x32, 0x49, 0x00, 0x01, 0x83, 0x00, 0xE6, 0xD9, 0x00, 0xE5, 0xEA, 0x62, 0x01, 0x23, 0x01, 0x43,
+    0xF5, 0x01, 0x33, 0x73, 0xA1, 0x32, 0x09, 0x62, 0x01, 0x35, 0x00, 0x00, 0x03, 0x01, 0x44, 0x47,
+    0x67, 0x01, 0x08, 0x17, 0x19, 0x20, 0x25, 0x29, 0x00, 0x00, 0x62, 0x01, 0x2F, 0x8A, 0x00, 0xF9,
+    0x6C, 0x01, 0x44, 0x50, 0x00, 0x00, 0x36, 0x00, 0x00, 0x09, 0x00, 0x54, 0xBA, 0x41, 0x23, 0x89,
+    0xF8, 0x62, 0x25, 0x32, 0x01, 0x44, 0x64, 0x00, 0x00, 0x04, 0x61, 0x21, 0x01, 0x24, 0xF1, 0x21,
+    0x38, 0x05, 0x41, 0x34, 0xFF, 0xFD, 0x62, 0x31, 0x39, 0x00, 0xFD, 0x50, 0x01, 0x43, 0xD1, 0x61,
+    0x27, 0x01, 0x25, 0x06, 0x21, 0x32, 0x05, 0x21, 0x22, 0x03, 0xA5, 0x01, 0x0A, 0x27, 0x2A, 0x40,
+    0x29, 0x1B, 0x18, 0x14, 0x03, 0xA1, 0x4C, 0x0B, 0x21, 0x22, 0x03, 0x64, 0x01, 0x17, 0x19, 0x25,
+    0x01, 0x44, 0x65, 0x01, 0x44, 0x65, 0x00, 0x00, 0x03, 0x01, 0x1C, 0xC2, 0x76, 0x01, 0x07, 0x08,
+    0x14, 0x15, 0x19, 0x1E, 0x22, 0x23, 0x24, 0x25, 0x27, 0x28, 0x2A, 0x2D, 0x31, 0x32, 0x34, 0x35,
+    0x36, 0x38, 0x39, 0x00, 0x06, 0xBB, 0x01, 0x33, 0x1B, 0x01, 0x43, 0xF6, 0x01, 0x44, 0xBB, 0x00,
+    0x06, 0xA5, 0x00, 0x06, 0x8C, 0x01, 0x44, 0xBC, 0x00, 0x06, 0x84, 0x00, 0x04, 0xB3, 0x00, 0x04,
+    0x8E, 0x00, 0x04, 0x79, 0x00, 0x04, 0x62, 0x00, 0x04, 0x4F, 0x01, 0x44, 0x56, 0x00, 0x04, 0x3D,
+    0x00, 0x03, 0xA5, 0x00, 0x02, 0x94, 0x00, 0x01, 0x5A, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xD6, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x11, 0xE2, 0x0F, 0x10, 0x01, 0x44, 0x4F, 0x01, 0x35, 0x3B, 0x65, 0x0E,
+    0x0F, 0x11, 0x13, 0x29, 0x01, 0x2A, 0x48, 0x01, 0x45, 0x1E, 0x01, 0x45, 0x1E, 0x01, 0x45, 0x1E,
+    0x00, 0x00, 0x09, 0x41, 0x42, 0xB9, 0xD4, 0x63, 0x21, 0x31, 0x34, 0x01, 0x44, 0xD1, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x04, 0xE1, 0x20, 0x01, 0x44, 0x0C, 0x64, 0x23, 0x31, 0x34, 0x35, 0x00, 0xEE,
+    0x09, 0x01, 0x43, 0x3A, 0x01, 0x07, 0xFF, 0x01, 0x45, 0x10, 0xE2, 0x19, 0x42, 0x01, 0x34, 0xE1,
+    0x01, 0x2B, 0x97, 0x41, 0x32, 0xD5, 0x26, 0x61, 0x1B, 0x01, 0x44, 0xF8, 0xA1, 0x40, 0x05, 0x21,
+    0x4C, 0x03, 0x62, 0x15, 0x23, 0x01, 0x35, 0x4F, 0x00, 0x00, 0x03, 0x62, 0x07, 0x14, 0x01, 0x32,
+    0xB5, 0x01, 0x45, 0x7B, 0x62, 0x19, 0x23, 0x01, 0x45, 0x84, 0x01, 0x24, 0xC9, 0x61, 0x39, 0x01,
+    0x2A, 0x7B, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x17, 0x03, 0x21, 0x40, 0x03, 0xE1, 0x0A,
+    0x01, 0x2A, 0x1B, 0x64, 0x13, 0x15, 0x19, 0x25, 0x01, 0x1E, 0x36, 0x00, 0x00, 0x08, 0x00, 0x92,
+    0x49, 0x00, 0x00, 0x05, 0x61, 0x15, 0x01, 0x0C, 0x01, 0x62, 0x15, 0x1B, 0x01, 0x0C, 0x06, 0x01,
+    0x45, 0xB9, 0x22, 0x49, 0x4A, 0x0E, 0x09, 0xEE, 0x0F, 0x19, 0x1B, 0x23, 0x25, 0x27, 0x2D, 0x31,
+    0x32, 0x34, 0x35, 0x38, 0x39, 0x4A, 0x00, 0x00, 0x83, 0x01, 0x43, 0x60, 0x01, 0x41, 0xC3, 0x00,
+    0x00, 0x7E, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x55, 0x00, 0x00, 0x4C, 0x00, 0xE5,
+    0x8A, 0x00, 0x00, 0x43, 0x00, 0xCC, 0x9F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x05, 0x01, 0x33, 0x9C,
+    0x61, 0x1B, 0x01, 0x41, 0xDB, 0x21, 0x34, 0x05, 0x61, 0x42, 0x01, 0x2A, 0xFA, 0x21, 0x23, 0x05,
+    0x21, 0x42, 0x03, 0x63, 0x23, 0x2D, 0x39, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x01, 0x45, 0xB5,
+    0xE1, 0x32, 0x01, 0x38, 0xF7, 0x62, 0x23, 0x32, 0x00, 0x00, 0x05, 0x01, 0x46, 0x25, 0x41, 0x07,
+    0x99, 0x24, 0x21, 0x32, 0x04, 0x21, 0x25, 0x03, 0xE2, 0x01, 0x42, 0x00, 0x00, 0x03, 0x01, 0x2C,
+    0x75, 0x21, 0x21, 0x09, 0xA1, 0x32, 0x03, 0x62, 0x23, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x46, 0x47,
+    0x41, 0x07, 0xD6, 0xFB, 0x21, 0x2A, 0x04, 0xA1, 0x40, 0x03, 0x41, 0x23, 0xBB, 0x01, 0x62, 0x31,
+    0x32, 0x01, 0x45, 0xA3, 0x00, 0x00, 0x04, 0x62, 0x04, 0x29, 0x00, 0xE8, 0x3A, 0x01, 0x46, 0x54,
+    0x61, 0x01, 0x01, 0x44, 0x3F, 0xEB, 0x01, 0x02, 0x04, 0x06, 0x1A, 0x27, 0x2A, 0x31, 0x40, 0x42,
+    0x48, 0x00, 0x00, 0x50, 0x01, 0x3E, 0x7A, 0x00, 0x00, 0x2E, 0x01, 0x46, 0x59, 0x00, 0x00, 0x1E,
+    0x00, 0x0E, 0x2A, 0x00, 0x00, 0x17, 0x01, 0x46, 0x26, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x01,
+    0x46, 0x0F, 0x61, 0x27, 0x01, 0x43, 0x94, 0x21, 0x4A, 0x05, 0xE1, 0x1B, 0x01, 0x34, 0x85, 0x21,
+    0x1A, 0x05, 0xEB, 0x01, 0x04, 0x0A, 0x19, 0x21, 0x31, 0x33, 0x35, 0x38, 0x39, 0x43, 0x01, 0x46,
+    0xB2, 0x01, 0x2A, 0xA4, 0x01, 0x40, 0x0C, 0x01, 0x46, 0xB2, 0x00, 0xFB, 0xAE, 0x00, 0x00, 0x03,
+    0x01, 0x46, 0xB2, 0x01, 0x46, 0xB2, 0x01, 0x11, 0x58, 0x01, 0x46, 0x9F, 0x01, 0x33, 0x94, 0x41,
+    0x32, 0xAC, 0xCC, 0x41, 0x19, 0x1E, 0x60, 0x62, 0x01, 0x07, 0x00, 0x74, 0x33, 0x01, 0x46, 0xE7,
+    0x41, 0x19, 0xE9, 0xAF, 0x21, 0x33, 0x04, 0xE2, 0x08, 0x27, 0x00, 0x00, 0x03, 0x01, 0x35, 0x26,
+    0x23, 0x2D, 0x34, 0x35, 0x1D, 0x19, 0x09, 0xC1, 0x42, 0x9D, 0xFF, 0x61, 0x23, 0x01, 0x44, 0xDA,
+    0x61, 0x23, 0x01, 0x0F, 0xC4, 0x23, 0x01, 0x40, 0x42, 0x0E, 0x0A, 0x05, 0x41, 0x41, 0xB4, 0xB1,
+    0x21, 0x4C, 0x04, 0x62, 0x17, 0x22, 0x00, 0x00, 0x03, 0x01, 0x47, 0x07, 0x64, 0x19, 0x1E, 0x1F,
+    0x21, 0x00, 0x00, 0x09, 0x01, 0x44, 0xC5, 0x00, 0x9E, 0xC2, 0x00, 0xFC, 0x28, 0x63, 0x07, 0x1F,
+    0x23, 0x01, 0x34, 0x77, 0x00, 0x9E, 0xD3, 0x01, 0x09, 0x02, 0x61, 0x04, 0x01, 0x25, 0xFE, 0x21,
+    0x42, 0x05, 0x62, 0x34, 0x44, 0x00, 0x00, 0x03, 0x01, 0x3A, 0x29, 0x61, 0x0D, 0x01, 0x43, 0xF0,
+    0x21, 0x0D, 0x05, 0x21, 0x31, 0x03, 0x21, 0x0A, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x21, 0x03, 0x21,
+    0x31, 0x03, 0x41, 0x01, 0x1E, 0x62, 0xE4, 0x1A, 0x25, 0x2A, 0x4A, 0x00, 0x00, 0x24, 0x01, 0x04,
+    0x96, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x61, 0x1F, 0x01, 0x26, 0x3B, 0xE3, 0x21, 0x40, 0x44,
+    0x01, 0x47, 0x8C, 0x00, 0x00, 0x05, 0x01, 0x0E, 0x3F, 0xE2, 0x1B, 0x25, 0x01, 0x47, 0x99, 0x01,
+    0x47, 0x99, 0x61, 0x2D, 0x01, 0x34, 0xB8, 0x6B, 0x21, 0x23, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36,
+    0x39, 0x47, 0x4A, 0x00, 0x00, 0xC8, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x92, 0x00, 0x00, 0x7B, 0x00,
+    0x00, 0x6A, 0x00, 0x00, 0x31, 0x00, 0x00, 0x1B, 0x01, 0x47, 0xA6, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x05, 0x01, 0x3D, 0x67, 0xE3, 0x17, 0x1A, 0x21, 0x01, 0x2D, 0x66, 0x01, 0x44, 0xBC, 0x00, 0xEC,
+    0x76, 0x41, 0x27, 0x77, 0x77, 0x21, 0x32, 0x04, 0x21, 0x2A, 0x03, 0xE5, 0x01, 0x20, 0x30, 0x35,
+    0x40, 0x00, 0xD3, 0x07, 0x01, 0x06, 0xF9, 0x01, 0x47, 0xEB, 0x01, 0x47, 0xEB, 0x00, 0x00, 0x03,
+    0xC1, 0x27, 0x03, 0x7E, 0x21, 0x19, 0x04, 0x62, 0x01, 0x31, 0x01, 0x48, 0x07, 0x00, 0x00, 0x03,
+    0x62, 0x32, 0x34, 0x01, 0x48, 0x10, 0x01, 0x48, 0x0F, 0x61, 0x01, 0x01, 0x0B, 0x8D, 0x21, 0x22,
+    0x05, 0x21, 0x15, 0x03, 0x22, 0x19, 0x31, 0x14, 0x03, 0x66, 0x19, 0x1A, 0x1B, 0x1E, 0x25, 0x27,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x22, 0x00, 0x00, 0x05, 0x01, 0x47, 0xE3, 0x01, 0x48, 0x29, 0x00,
+    0x82, 0xF2, 0x61, 0x18, 0x01, 0x47, 0x07, 0x21, 0x17, 0x05, 0x63, 0x28, 0x38, 0x4C, 0x01, 0x36,
+    0x2C, 0x00, 0x00, 0x03, 0x00, 0xE6, 0xFD, 0xE2, 0x22, 0x34, 0x00, 0x00, 0x0D, 0x01, 0x29, 0x11,
+    0x62, 0x15, 0x23, 0x00, 0x00, 0x09, 0x01, 0x48, 0x60, 0x68, 0x19, 0x1A, 0x25, 0x27, 0x32, 0x34,
+    0x38, 0x39, 0x01, 0x48, 0x69, 0x00, 0xD8, 0xC4, 0x00, 0x00, 0x95, 0x00, 0x58, 0xD3, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x09, 0x01, 0x48, 0x0B, 0x01, 0x48, 0x56, 0x61, 0x1E, 0x01, 0x2E, 0xFE, 0x21,
+    0x07, 0x05, 0x63, 0x34, 0x36, 0x38, 0x00, 0x00, 0x03, 0x01, 0x48, 0x88, 0x01, 0x46, 0x83, 0x62,
+    0x19, 0x38, 0x01, 0x48, 0x9F, 0x01, 0x2B, 0x09, 0x63, 0x19, 0x23, 0x34, 0x01, 0x48, 0x42, 0x01,
+    0x2C, 0x93, 0x01, 0x48, 0x23, 0x62, 0x22, 0x34, 0x01, 0x48, 0x4F, 0x01, 0x48, 0xB5, 0xE1, 0x40,
+    0x01, 0x3E, 0x7E, 0x62, 0x02, 0x14, 0x01, 0x48, 0xC3, 0x01, 0x48, 0xC3, 0xA1, 0x44, 0x09, 0x63,
+    0x07, 0x1A, 0x21, 0x00, 0x00, 0x03, 0x01, 0x48, 0xCF, 0x01, 0x48, 0xCF, 0xE3, 0x07, 0x2A, 0x40,
+    0x01, 0x48, 0x76, 0x01, 0x0D, 0xA4, 0x00, 0x3A, 0xD2, 0x63, 0x14, 0x1A, 0x48, 0x01, 0x16, 0x28,
+    0x00, 0x00, 0x0D, 0x01, 0x48, 0xB0, 0x62, 0x01, 0x31, 0x01, 0x48, 0xF6, 0x01, 0x48, 0xBD, 0x41,
+    0x22, 0xBE, 0x43, 0x21, 0x31, 0x04, 0x61, 0x1B, 0x01, 0x35, 0x38, 0x21, 0x07, 0x05, 0x21, 0x34,
+    0x03, 0x41, 0x32, 0xBC, 0xA2, 0x21, 0x25, 0x04, 0x21, 0x0A, 0x03, 0x21, 0x20, 0x03, 0x21, 0x38,
+    0x03, 0xE6, 0x0A, 0x1A, 0x22, 0x23, 0x28, 0x44, 0x00, 0x00, 0x1E, 0x00, 0x31, 0xCF, 0x00, 0x00,
+    0x13, 0x01, 0x45, 0x09, 0x00, 0x00, 0x03, 0x00, 0xEF, 0x2F, 0x65, 0x14, 0x19, 0x1A, 0x21, 0x22,
+    0x01, 0x49, 0x39, 0x01, 0x49, 0x3A, 0x00, 0x00, 0x44, 0x00, 0x00, 0x19, 0x01, 0x46, 0x56, 0x64,
+    0x01, 0x17, 0x18, 0x21, 0x01, 0x49, 0x4F, 0x01, 0x49, 0x4F, 0x01, 0x49, 0x4F, 0x01, 0x49, 0x4F,
+    0x61, 0x19, 0x01, 0x49, 0x05, 0xC2, 0x2A, 0x40, 0x00, 0x05, 0xE7, 0xA8, 0x64, 0x01, 0x02, 0x15,
+    0x48, 0x00, 0x00, 0x07, 0x01, 0x49, 0x6C, 0x01, 0x49, 0x6C, 0x01, 0x49, 0x33, 0x62, 0x28, 0x48,
+    0x01, 0x49, 0x7D, 0x01, 0x14, 0x55, 0x62, 0x14, 0x17, 0x01, 0x49, 0x85, 0x00, 0x00, 0x09, 0xEF,
+    0x01, 0x17, 0x18, 0x19, 0x21, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x38, 0x40, 0x41, 0x43, 0x01,
+    0x30, 0x03, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xDA, 0x00, 0xFA, 0xF2, 0x00, 0x00, 0xD1, 0x01, 0x49,
+    0x56, 0x00, 0x00, 0xC0, 0x01, 0x49, 0x8F, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x55, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x09, 0x00, 0x79, 0xB0, 0x01, 0x47, 0x5E, 0x61, 0x22, 0x01, 0x17,
+    0x0B, 0xE9, 0x07, 0x08, 0x15, 0x16, 0x1B, 0x31, 0x32, 0x39, 0x40, 0x01, 0x49, 0xD1, 0x01, 0x49,
+    0xD1, 0x01, 0x49, 0x6B, 0x01, 0x49, 0xD1, 0x00, 0x16, 0x18, 0x01, 0x49, 0x98, 0x00, 0x00, 0x05,
+    0x01, 0x49, 0x40, 0x00, 0x2D, 0xC6, 0xC1, 0x1F, 0xA8, 0xCE, 0x21, 0x07, 0x04, 0x21, 0x34, 0x03,
+    0x61, 0x21, 0x01, 0x28, 0x87, 0x21, 0x39, 0x05, 0x61, 0x14, 0x01, 0x08, 0x23, 0x62, 0x32, 0x4C,
+    0x00, 0x00, 0x05, 0x01, 0x46, 0xFF, 0x22, 0x14, 0x23, 0x11, 0x09, 0x41, 0x01, 0xE8, 0x7A, 0x62,
+    0x22, 0x40, 0x01, 0x4A, 0x1F, 0x00, 0x00, 0x04, 0x41, 0x4C, 0x67, 0xA1, 0x21, 0x23, 0x04, 0x21,
+    0x2D, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x40, 0x03, 0x21, 0x2A, 0x03, 0x63, 0x15, 0x23, 0x40, 0x00,
+    0x00, 0x03, 0x01, 0x27, 0x63, 0x01, 0x2C, 0xFB, 0x65, 0x23, 0x2D, 0x32, 0x34, 0x35, 0x00, 0x00,
+    0x4B, 0x00, 0x00, 0x32, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0D, 0x01, 0x2D, 0x90, 0x62, 0x01, 0x49,
+    0x01, 0x4A, 0x5D, 0x01, 0x4A, 0x24, 0x62, 0x31, 0x32, 0x00, 0x00, 0x09, 0x01, 0x46, 0x4E, 0x41,
+    0x25, 0xE2, 0xD1, 0x21, 0x40, 0x04, 0x62, 0x32, 0x35, 0x00, 0x00, 0x03, 0x01, 0x4A, 0x3D, 0x61,
+    0x14, 0x01, 0x2A, 0xD9, 0x21, 0x32, 0x05, 0x21, 0x0A, 0x03, 0x21, 0x32, 0x03, 0xC1, 0x31, 0xED,
+    0x3B, 0xE2, 0x01, 0x30, 0x00, 0xD5, 0xAD, 0x01, 0x4A, 0x91, 0xE6, 0x01, 0x04, 0x08, 0x1A, 0x1E,
+    0x27, 0x00, 0x00, 0x10, 0x01, 0x4A, 0x9A, 0x01, 0x49, 0x62, 0x01, 0x15, 0x40, 0x00, 0x00, 0x0D,
+    0x00, 0x00, 0x09, 0x21, 0x32, 0x19, 0xC1, 0x40, 0xEA, 0x4E, 0x21, 0x23, 0x04, 0x21, 0x32, 0x03,
+    0x61, 0x40, 0x01, 0x4A, 0x87, 0x64, 0x1A, 0x27, 0x30, 0x34, 0x01, 0x4A, 0xC5, 0x01, 0x4A, 0x7F,
+    0x00, 0x00, 0x05, 0x01, 0x4A, 0x76, 0x63, 0x23, 0x32, 0x34, 0x01, 0x14, 0xFF, 0x01, 0x49, 0x24,
+    0x01, 0x47, 0xC8, 0xE2, 0x28, 0x30, 0x01, 0x26, 0x76, 0x01, 0x4A, 0xE3, 0x63, 0x2D, 0x31, 0x32,
+    0x01, 0x4A, 0xEB, 0x01, 0x4A, 0x31, 0x01, 0x3A, 0x31, 0x61, 0x32, 0x01, 0x26, 0x62, 0x21, 0x23,
+    0x05, 0x21, 0x34, 0x03, 0x21, 0x18, 0x03, 0x21, 0x17, 0x03, 0x21, 0x34, 0x03, 0x21, 0x2A, 0x03,
+    0x21, 0x32, 0x03, 0x21, 0x0D, 0x03, 0x42, 0x32, 0x4C, 0x00, 0x03, 0x8F, 0x0D, 0x21, 0x13, 0x07,
+    0x21, 0x23, 0x03, 0x63, 0x31, 0x38, 0x39, 0x01, 0x26, 0x47, 0x01, 0x2E, 0x47, 0x00, 0x00, 0x03,
+    0x61, 0x16, 0x01, 0x49, 0xB8, 0x21, 0x23, 0x05, 0x62, 0x30, 0x32, 0x01, 0x15, 0xDE, 0x00, 0x00,
+    0x03, 0x64, 0x23, 0x24, 0x2D, 0x31, 0x00, 0x00, 0x09, 0x01, 0x15, 0xE7, 0x01, 0x4B, 0x37, 0x01,
+    0x4B, 0x40, 0xE1, 0x28, 0x01, 0x4B, 0x36, 0x63, 0x07, 0x25, 0x32, 0x00, 0x00, 0x05, 0x01, 0x4B,
+    0x57, 0x01, 0x38, 0x39, 0x62, 0x1E, 0x32, 0x01, 0x4B, 0x64, 0x01, 0x4B, 0x1E, 0xC1, 0x34, 0xC6,
+    0x9D, 0x41, 0x34, 0xC6, 0xA1, 0x21, 0x15, 0x04, 0x21, 0x25, 0xC2, 0x64, 0x15, 0x32, 0x38, 0x39,
+    0x00, 0x00, 0x0E, 0x01, 0x4A, 0xC6, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x62, 0x28, 0x2D, 0x01,
+    0x4B, 0x8C, 0x01, 0x49, 0x7D, 0xE2, 0x19, 0x20, 0x01, 0x48, 0x2A, 0x01, 0x0A, 0xA3, 0x21, 0x16,
+    0x09, 0xE5, 0x14, 0x20, 0x23, 0x2A, 0x39, 0x01, 0x4B, 0xA1, 0x01, 0x12, 0xC7, 0x00, 0x00, 0x03,
+    0x01, 0x4B, 0xA1, 0x01, 0x4B, 0x22, 0x63, 0x14, 0x15, 0x17, 0x01, 0x4A, 0xF0, 0x01, 0x36, 0xF0,
+    0x01, 0x30, 0x33, 0x63, 0x31, 0x32, 0x34, 0x01, 0x4B, 0x08, 0x01, 0x36, 0x46, 0x00, 0x7B, 0x59,
+    0x64, 0x31, 0x38, 0x39, 0x48, 0x01, 0x4B, 0xCF, 0x01, 0x4A, 0x48, 0x01, 0x4B, 0x3F, 0x01, 0x3F,
+    0xFD, 0xE4, 0x07, 0x08, 0x25, 0x49, 0x01, 0x4B, 0xE1, 0x01, 0x2A, 0x68, 0x01, 0x12, 0x90, 0x01,
+    0x4B, 0xD4, 0x67, 0x04, 0x07, 0x0A, 0x0D, 0x15, 0x19, 0x22, 0x01, 0x2D, 0x58, 0x00, 0x70, 0xDF,
+    0x01, 0x2F, 0x71, 0x01, 0x4A, 0xA0, 0x01, 0x4B, 0xF2, 0x00, 0x98, 0x98, 0x01, 0x4B, 0xF2, 0xE2,
+    0x04, 0x09, 0x01, 0x27, 0x33, 0x00, 0x09, 0x9A, 0x41, 0x23, 0x5C, 0x4D, 0x21, 0x18, 0x04, 0x21,
+    0x19, 0x03, 0x21, 0x31, 0x03, 0xE9, 0x04, 0x08, 0x0A, 0x17, 0x18, 0x19, 0x1A, 0x1E, 0x2A, 0x01,
+    0x4A, 0x16, 0x01, 0x4A, 0xED, 0x01, 0x49, 0x3D, 0x01, 0x4B, 0xCA, 0x01, 0x37, 0x5F, 0x00, 0x00,
+    0x16, 0x01, 0x06, 0xAA, 0x00, 0x00, 0x03, 0x01, 0x4C, 0x25, 0xC1, 0x40, 0xC7, 0x2D, 0xC2, 0x2A,
+    0x34, 0xF3, 0xE0, 0x00, 0x04, 0x62, 0x42, 0x4C, 0x00, 0x09, 0xBB, 0x01, 0x4C, 0x55, 0x62, 0x34,
+    0x4C, 0x00, 0x00, 0x09, 0x01, 0x4C, 0x5E, 0x42, 0x0B, 0x18, 0xC2, 0x8A, 0x00, 0x09, 0x63, 0x07,
+    0x15, 0x17, 0x01, 0x4C, 0x6E, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0xE2, 0x1B, 0x23, 0x01, 0x4C,
+    0x7B, 0x01, 0x4C, 0x7B, 0x41, 0x23, 0x8A, 0xF5, 0x62, 0x07, 0x32, 0x00, 0xF2, 0x63, 0x01, 0x3C,
+    0x0F, 0xE3, 0x1B, 0x28, 0x2A, 0x00, 0x00, 0x0D, 0x01, 0x3A, 0x73, 0x00, 0x00, 0x09, 0x62, 0x23,
+    0x31, 0x00, 0x00, 0x0D, 0x01, 0x4B, 0xE3, 0xE1, 0x44, 0x01, 0x42, 0x5C, 0xE2, 0x19, 0x4C, 0x00,
+    0x8D, 0x91, 0x01, 0x4C, 0xAC, 0x66, 0x01, 0x0F, 0x14, 0x17, 0x19, 0x2B, 0x01, 0x4C, 0xB5, 0x00,
+    0xB7, 0x7F, 0x01, 0x4C, 0xB5, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x41, 0x19,
+    0x77, 0x64, 0x21, 0x48, 0x04, 0x21, 0x34, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23,
+    0x03, 0x41, 0x1E, 0x8B, 0x66, 0x21, 0x32, 0x04, 0x21, 0x49, 0x03, 0x21, 0x08, 0x03, 0xA2, 0x1E,
+    0x40, 0x10, 0x03, 0x21, 0x08, 0x05, 0x21, 0x47, 0x03, 0x64, 0x0D, 0x14, 0x1E, 0x2A, 0x01, 0x4C,
+    0x74, 0x00, 0x00, 0x03, 0x01, 0x30, 0x41, 0x00, 0x87, 0x94, 0x62, 0x19, 0x34, 0x01, 0x4C, 0xEE,
+    0x01, 0x4D, 0x0A, 0x21, 0x18, 0x09, 0x62, 0x04, 0x0A, 0x01, 0x4D, 0x16, 0x00, 0xDF, 0x3D, 0x64,
+    0x1E, 0x20, 0x21, 0x22, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x01, 0x4B, 0x21, 0x01, 0x3A, 0x35,
+    0x61, 0x2A, 0x01, 0x24, 0xF7, 0x21, 0x40, 0x05, 0x21, 0x33, 0x03, 0xFF, 0x21, 0x01, 0x04, 0x08,
+    0x0A, 0x0D, 0x13, 0x14, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x27, 0x28, 0x2A, 0x2B, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x38, 0x40, 0x42, 0x43, 0x48, 0x00, 0x02,
+    0x7E, 0x00, 0x02, 0x76, 0x00, 0x02, 0x65, 0x01, 0x4B, 0x11, 0x01, 0x4C, 0xD5, 0x00, 0x02, 0x58,
+    0x01, 0x04, 0xC6, 0x01, 0x4A, 0x42, 0x01, 0x49, 0x23, 0x00, 0x02, 0x4F, 0x00, 0x02, 0x18, 0x00,
+    0x01, 0xFA, 0x00, 0x85, 0xB7, 0x00, 0x01, 0xE4, 0x00, 0x01, 0xD7, 0x00, 0x01, 0xC0, 0x00, 0x01,
+    0xAF, 0x00, 0x01, 0x9A, 0x00, 0x01, 0x85, 0x00, 0x01, 0x78, 0x01, 0x4B, 0x89, 0x00, 0x01, 0x6B,
+    0x00, 0x71, 0x62, 0x00, 0x01, 0x5A, 0x00, 0x01, 0x49, 0x00, 0x01, 0x16, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x86, 0x00, 0x00, 0x42, 0x00, 0x00, 0x1C, 0x00, 0xD9, 0x1B, 0x00, 0x00,
+    0x03, 0x61, 0x22, 0x01, 0x4C, 0xB5, 0xA1, 0x2A, 0x05, 0x62, 0x1E, 0x20, 0x01, 0x4D, 0x83, 0x01,
+    0x4D, 0xB0, 0x61, 0x42, 0x01, 0x4D, 0x50, 0x21, 0x2A, 0x05, 0x21, 0x31, 0x03, 0x61, 0x0A, 0x01,
+    0x36, 0xAD, 0x21, 0x0A, 0x05, 0x21, 0x34, 0x03, 0xC4, 0x08, 0x1F, 0x2A, 0x40, 0x00, 0x0E, 0x00,
+    0x03, 0xE6, 0x04, 0x9B, 0x00, 0x62, 0x21, 0x22, 0x00, 0x00, 0x0D, 0x01, 0x4D, 0xF5, 0x62, 0x27,
+    0x49, 0x01, 0x4D, 0xFE, 0x01, 0x4C, 0xF9, 0x62, 0x21, 0x48, 0x00, 0x00, 0x3E, 0x01, 0x4D, 0xCE,
+    0x69, 0x14, 0x19, 0x1A, 0x21, 0x2D, 0x31, 0x32, 0x34, 0x38, 0x00, 0x00, 0x4A, 0x01, 0x4A, 0xA5,
+    0x01, 0x4E, 0x10, 0x00, 0x00, 0x47, 0x01, 0x47, 0x86, 0x01, 0x19, 0x2D, 0x00, 0x00, 0x1B, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x09, 0x61, 0x04, 0x01, 0x0E, 0xE9, 0xE4, 0x04, 0x15, 0x30, 0x32, 0x01,
+    0x0E, 0xEE, 0x00, 0x8F, 0xC1, 0x01, 0x4E, 0x3A, 0x00, 0x00, 0x05, 0x63, 0x31, 0x36, 0x37, 0x01,
+    0x4E, 0x4A, 0x01, 0x49, 0xF9, 0x01, 0x49, 0xF9, 0x62, 0x30, 0x31, 0x01, 0x4E, 0x58, 0x01, 0x4E,
+    0x57, 0x62, 0x30, 0x36, 0x01, 0x4E, 0x61, 0x01, 0x4E, 0x57, 0x63, 0x30, 0x31, 0x39, 0x01, 0x4E,
+    0x6A, 0x00, 0x07, 0x0A, 0x01, 0x4E, 0x6A, 0x62, 0x1A, 0x4C, 0x01, 0x4C, 0xC2, 0x01, 0x4E, 0x77,
+    0x41, 0x32, 0x95, 0x3C, 0x63, 0x01, 0x07, 0x27, 0x01, 0x4E, 0x3E, 0x01, 0x3B, 0xBE, 0x00, 0x8D,
+    0x98, 0xE5, 0x04, 0x19, 0x22, 0x2A, 0x32, 0x01, 0x3D, 0xD9, 0x01, 0x45, 0x43, 0x01, 0x4E, 0x2B,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x0D, 0x61, 0x0A, 0x01, 0x31, 0xCA, 0x62, 0x1E, 0x2A, 0x00, 0x00,
+    0x05, 0x01, 0x04, 0x4D, 0xE5, 0x04, 0x1E, 0x27, 0x2B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x23,
+    0x01, 0x4E, 0xAA, 0x01, 0x4E, 0x4E, 0x00, 0x00, 0x09, 0x66, 0x19, 0x21, 0x2D, 0x30, 0x34, 0x49,
+    0x01, 0x4E, 0xC9, 0x01, 0x4E, 0xC9, 0x01, 0x41, 0xFD, 0x01, 0x4E, 0xC9, 0x01, 0x4E, 0x7A, 0x01,
+    0x4C, 0x9F, 0x64, 0x07, 0x1B, 0x21, 0x25, 0x00, 0x4F, 0x1F, 0x01, 0x4E, 0xE2, 0x01, 0x4E, 0xE2,
+    0x00, 0x4F, 0x1F, 0xE5, 0x01, 0x14, 0x1A, 0x2D, 0x41, 0x01, 0x4E, 0x9E, 0x01, 0x4B, 0x88, 0x01,
+    0x4D, 0x3E, 0x01, 0x44, 0x45, 0x01, 0x39, 0xAA, 0xE5, 0x01, 0x18, 0x27, 0x28, 0x30, 0x01, 0x4C,
+    0xD3, 0x00, 0xBA, 0x03, 0x01, 0x3D, 0x37, 0x01, 0x3C, 0xEA, 0x01, 0x4F, 0x08, 0x61, 0x24, 0x01,
+    0x4B, 0x05, 0x63, 0x23, 0x2A, 0x49, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x05, 0x01, 0x4F, 0x22, 0x61,
+    0x19, 0x01, 0x4F, 0x2E, 0x65, 0x01, 0x07, 0x1B, 0x2A, 0x42, 0x01, 0x4F, 0x34, 0x01, 0x4F, 0x34,
+    0x01, 0x4F, 0x34, 0x01, 0x35, 0xA8, 0x00, 0x00, 0x05, 0x63, 0x19, 0x1E, 0x25, 0x01, 0x36, 0xC3,
+    0x00, 0x00, 0xA3, 0x01, 0x4D, 0xC1, 0x61, 0x17, 0x01, 0x4B, 0x3E, 0x62, 0x04, 0x1E, 0x01, 0x4F,
+    0x3F, 0x01, 0x4F, 0x3F, 0x21, 0x23, 0x09, 0x21, 0x23, 0x03, 0xE2, 0x04, 0x2A, 0x01, 0x47, 0x49,
+    0x00, 0x00, 0x03, 0x61, 0x2A, 0x01, 0x30, 0xD5, 0x21, 0x40, 0x05, 0x22, 0x07, 0x27, 0x11, 0x03,
+    0x42, 0x2D, 0x32, 0x7E, 0x1A, 0x00, 0x05, 0x78, 0x01, 0x07, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x19,
+    0x1A, 0x20, 0x23, 0x25, 0x27, 0x30, 0x31, 0x32, 0x34, 0x35, 0x38, 0x40, 0x41, 0x44, 0x48, 0x49,
+    0x01, 0x4F, 0x87, 0x01, 0x4F, 0x87, 0x01, 0x4C, 0x1C, 0x00, 0x01, 0x4D, 0x00, 0x01, 0x3C, 0x00,
+    0x01, 0x2F, 0x00, 0x01, 0x26, 0x01, 0x24, 0x1C, 0x01, 0x4B, 0x6F, 0x00, 0x01, 0x1D, 0x00, 0x00,
+    0xD3, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x94, 0x01, 0x4A, 0xFD, 0x01, 0x32, 0xAB,
+    0x01, 0x4C, 0x79, 0x00, 0x00, 0x65, 0x00, 0x00, 0x53, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x31, 0x01,
+    0x4F, 0x4E, 0x01, 0x48, 0x8B, 0x00, 0x00, 0x07, 0x62, 0x0E, 0x0F, 0x01, 0x4F, 0x22, 0x01, 0x4F,
+    0xCC, 0x64, 0x01, 0x04, 0x15, 0x29, 0x01, 0x4F, 0xF1, 0x01, 0x35, 0x6D, 0x01, 0x4F, 0xF1, 0x00,
+    0x00, 0x09, 0xC1, 0x44, 0x58, 0xF4, 0x61, 0x25, 0x01, 0x31, 0x68, 0x62, 0x01, 0x15, 0x00, 0x00,
+    0x05, 0x01, 0x4F, 0x8C, 0xA1, 0x40, 0x09, 0xE1, 0x44, 0x01, 0x4F, 0xC8, 0x65, 0x01, 0x14, 0x1A,
+    0x21, 0x27, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0x01, 0x50, 0x1C, 0x01, 0x50, 0x1C, 0x01, 0x50,
+    0x1C, 0xE6, 0x01, 0x07, 0x14, 0x15, 0x1A, 0x22, 0x01, 0x50, 0x31, 0x01, 0x50, 0x31, 0x01, 0x50,
+    0x31, 0x01, 0x4F, 0x2F, 0x01, 0x50, 0x31, 0x01, 0x50, 0x31, 0x65, 0x07, 0x14, 0x1B, 0x21, 0x25,
+    0x01, 0x50, 0x4A, 0x01, 0x50, 0x4A, 0x01, 0x50, 0x4A, 0x01, 0x50, 0x4A, 0x01, 0x50, 0x4A, 0x64,
+    0x14, 0x15, 0x1A, 0x21, 0x01, 0x50, 0x5F, 0x01, 0x50, 0x5F, 0x01, 0x50, 0x5F, 0x01, 0x46, 0x14,
+    0xEC, 0x14, 0x1A, 0x27, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x36, 0x38, 0x47, 0x49, 0x01, 0x50, 0x70,
+    0x00, 0x00, 0x6E, 0x01, 0x45, 0x7C, 0x01, 0x45, 0xCC, 0x01, 0x50, 0x70, 0x00, 0x00, 0x54, 0x00,
+    0x00, 0x3F, 0x00, 0x00, 0x26, 0x01, 0x47, 0xD8, 0x00, 0x00, 0x11, 0x01, 0x3E, 0x45, 0x01, 0x50,
+    0x63, 0x61, 0x08, 0x01, 0x50, 0x55, 0x21, 0x38, 0x05, 0x21, 0x15, 0x03, 0x41, 0x38, 0x18, 0xB8,
+    0x41, 0x30, 0xA9, 0xDC, 0x61, 0x1E, 0x01, 0x25, 0x13, 0x21, 0x21, 0x05, 0x21, 0x38, 0x03, 0x61,
+    0x23, 0x01, 0x35, 0x32, 0x21, 0x0D, 0x05, 0x21, 0x32, 0x03, 0x21, 0x14, 0x1E, 0x21, 0x4C, 0x03,
+    0x21, 0x27, 0x03, 0x21, 0x15, 0x03, 0x41, 0x19, 0x70, 0x0C, 0x21, 0x31, 0x04, 0x21, 0x19, 0x03,
+    0x64, 0x22, 0x23, 0x31, 0x38, 0x01, 0x47, 0x92, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x03, 0x41, 0x21, 0x11, 0xA4, 0x21, 0x25, 0x04, 0x62, 0x17, 0x2B, 0x01, 0x50, 0xEE, 0x00, 0x00,
+    0x03, 0xF0, 0x08, 0x14, 0x1A, 0x1C, 0x1E, 0x21, 0x23, 0x25, 0x2A, 0x2B, 0x30, 0x32, 0x34, 0x35,
+    0x40, 0x41, 0x00, 0x00, 0x58, 0x00, 0x00, 0x55, 0x01, 0x4F, 0xF8, 0x00, 0xA4, 0x8D, 0x01, 0x32,
+    0x8C, 0x00, 0x00, 0x51, 0x00, 0x61, 0x36, 0x00, 0x00, 0x45, 0x00, 0x00, 0x21, 0x01, 0x28, 0xB7,
+    0x01, 0x51, 0x01, 0x01, 0x4F, 0xC6, 0x01, 0x4D, 0xF3, 0x00, 0xB7, 0x3A, 0x00, 0xDE, 0xF0, 0x00,
+    0x00, 0x09, 0xE3, 0x01, 0x23, 0x40, 0x01, 0x45, 0x32, 0x01, 0x4D, 0x34, 0x01, 0x1E, 0x52, 0xE2,
+    0x1E, 0x20, 0x01, 0x51, 0x09, 0x01, 0x51, 0x36, 0xE2, 0x07, 0x21, 0x01, 0x48, 0x0A, 0x00, 0x00,
+    0x09, 0xE4, 0x15, 0x32, 0x42, 0x4C, 0x01, 0x51, 0x61, 0x00, 0xEA, 0xEE, 0x01, 0x37, 0x9E, 0x01,
+    0x51, 0x61, 0x62, 0x04, 0x22, 0x00, 0x00, 0x11, 0x01, 0x51, 0x0C, 0xA1, 0x23, 0x09, 0xE1, 0x17,
+    0x01, 0x50, 0x3D, 0x21, 0x23, 0x05, 0x21, 0x32, 0x03, 0x61, 0x27, 0x01, 0x3F, 0x1D, 0x21, 0x40,
+    0x05, 0x21, 0x22, 0x03, 0x21, 0x27, 0x03, 0x21, 0x19, 0x03, 0x21, 0x33, 0x03, 0xA1, 0x2D, 0x03,
+    0x63, 0x01, 0x20, 0x4C, 0x00, 0x00, 0x1A, 0x01, 0x10, 0xAE, 0x00, 0x00, 0x03, 0x62, 0x34, 0x35,
+    0x00, 0x00, 0x0D, 0x01, 0x51, 0xAD, 0x42, 0x14, 0x15, 0x00, 0x09, 0xE6, 0x8A, 0x21, 0x2A, 0x07,
+    0x61, 0x34, 0x01, 0x41, 0x9D, 0xE1, 0x20, 0x01, 0x2D, 0x58, 0x62, 0x34, 0x35, 0x00, 0x00, 0x05,
+    0x01, 0x51, 0xCA, 0xEB, 0x04, 0x07, 0x0B, 0x14, 0x17, 0x1A, 0x1B, 0x21, 0x22, 0x2A, 0x2B, 0x01,
+    0x4E, 0xC5, 0x01, 0x51, 0xD3, 0x00, 0x00, 0x13, 0x00, 0xE6, 0xBF, 0x01, 0x51, 0xD3, 0x01, 0x51,
+    0xD3, 0x01, 0x48, 0x85, 0x00, 0x00, 0x09, 0x01, 0x1B, 0xF1, 0x01, 0x2D, 0x6D, 0x01, 0x4E, 0x68,
+    0x41, 0x2D, 0xB0, 0xA2, 0x21, 0x0B, 0x04, 0x21, 0x40, 0x03, 0x63, 0x07, 0x15, 0x2A, 0x01, 0x52,
+    0x0A, 0x00, 0xE4, 0xCE, 0x00, 0x00, 0x03, 0xE1, 0x40, 0x01, 0x16, 0xDB, 0x41, 0x32, 0xC1, 0xE7,
+    0x61, 0x14, 0x01, 0x1D, 0xC1, 0x61, 0x2A, 0x01, 0x51, 0x20, 0xA3, 0x2D, 0x41, 0x44, 0x0E, 0x0A,
+    0x05, 0x62, 0x07, 0x19, 0x00, 0x00, 0x07, 0x01, 0x52, 0x31, 0x21, 0x32, 0x09, 0x70, 0x01, 0x14,
+    0x19, 0x1A, 0x20, 0x21, 0x22, 0x23, 0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x48, 0x49, 0x00, 0xB5,
+    0x32, 0x01, 0x52, 0x3D, 0x00, 0x01, 0x3C, 0x01, 0x52, 0x3D, 0x01, 0x11, 0x4B, 0x00, 0x00, 0xFB,
+    0x00, 0x00, 0xE5, 0x00, 0x00, 0xC2, 0x01, 0x52, 0x2A, 0x01, 0x52, 0x3D, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x6A, 0x00, 0x00, 0x33, 0x00, 0x00, 0x26, 0x00, 0x00, 0x03, 0x01, 0x51, 0xE2, 0x41, 0x23,
+    0x96, 0x88, 0x41, 0x23, 0xC6, 0x35, 0x22, 0x32, 0x38, 0x08, 0x04, 0x62, 0x23, 0x32, 0x01, 0x47,
+    0xAC, 0x01, 0x52, 0x45, 0x41, 0x32, 0xCB, 0x63, 0x21, 0x0A, 0x04, 0x21, 0x30, 0x03, 0x21, 0x23,
+    0x03, 0x62, 0x23, 0x4C, 0x00, 0x62, 0xD6, 0x01, 0x52, 0xA1, 0x21, 0x18, 0x09, 0x21, 0x19, 0x03,
+    0x21, 0x31, 0x03, 0x61, 0x07, 0x01, 0x52, 0x58, 0x21, 0x07, 0x05, 0x21, 0x23, 0x03, 0xA1, 0x41,
+    0x03, 0x21, 0x1E, 0x03, 0x21, 0x32, 0x03, 0x61, 0x21, 0x01, 0x13, 0x52, 0x21, 0x40, 0x05, 0xE2,
+    0x2D, 0x2F, 0x00, 0x00, 0x03, 0x01, 0x52, 0xCF, 0x21, 0x10, 0x09, 0x21, 0x31, 0x03, 0x61, 0x31,
+    0x01, 0x2C, 0x6E, 0xE5, 0x02, 0x19, 0x27, 0x2A, 0x32, 0x01, 0x2B, 0xA1, 0x00, 0x00, 0x05, 0x00,
+    0xCA, 0x1C, 0x01, 0x4F, 0x78, 0x01, 0x52, 0xE3, 0x63, 0x0A, 0x21, 0x2A, 0x01, 0x52, 0xF8, 0x00,
+    0xC5, 0x8D, 0x00, 0x00, 0x15, 0xEE, 0x01, 0x08, 0x0A, 0x18, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x23,
+    0x27, 0x28, 0x31, 0x32, 0x00, 0x00, 0x7A, 0x01, 0x52, 0xBF, 0x00, 0x8B, 0x4F, 0x01, 0x38, 0x11,
+    0x01, 0x52, 0xAA, 0x00, 0x00, 0x67, 0x00, 0x00, 0x55, 0x00, 0x00, 0x41, 0x01, 0x36, 0x04, 0x00,
+    0x00, 0x2A, 0x00, 0xC2, 0xAE, 0x01, 0x33, 0x3B, 0x00, 0x00, 0x0D, 0x01, 0x52, 0x4A, 0x61, 0x19,
+    0x01, 0x46, 0x90, 0x21, 0x48, 0x05, 0x62, 0x23, 0x35, 0x01, 0x4F, 0xDB, 0x00, 0x00, 0x03, 0x61,
+    0x14, 0x01, 0x53, 0x36, 0xE5, 0x1C, 0x1E, 0x24, 0x43, 0x44, 0x01, 0x51, 0x45, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x05, 0x01, 0x51, 0x23, 0x01, 0x3F, 0xEC, 0x61, 0x25, 0x01, 0x46, 0xBB, 0x61, 0x2A,
+    0x01, 0x52, 0xDD, 0xE5, 0x04, 0x23, 0x41, 0x43, 0x44, 0x00, 0x00, 0x0A, 0x01, 0x1D, 0x37, 0x00,
+    0xBD, 0x56, 0x00, 0x00, 0x05, 0x01, 0x19, 0x03, 0xE3, 0x16, 0x2A, 0x44, 0x01, 0x4A, 0x3A, 0x01,
+    0x47, 0xB5, 0x01, 0x39, 0x84, 0x61, 0x25, 0x01, 0x53, 0x40, 0xE2, 0x14, 0x1C, 0x01, 0x37, 0x8C,
+    0x01, 0x51, 0x8B, 0xE6, 0x07, 0x14, 0x19, 0x1A, 0x1E, 0x22, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x30,
+    0x01, 0x53, 0xA3, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0xE2, 0x07, 0x23, 0x01,
+    0x53, 0xBC, 0x01, 0x50, 0x51, 0x64, 0x14, 0x2D, 0x32, 0x34, 0x01, 0x53, 0xC5, 0x01, 0x53, 0xC5,
+    0x00, 0x00, 0x09, 0x01, 0x53, 0x76, 0x62, 0x32, 0x49, 0x01, 0x36, 0xFA, 0x01, 0x53, 0x81, 0x62,
+    0x23, 0x49, 0x00, 0x00, 0x09, 0x01, 0x53, 0x84, 0x67, 0x21, 0x27, 0x31, 0x34, 0x36, 0x37, 0x38,
+    0x01, 0x53, 0xE8, 0x01, 0x53, 0xE7, 0x01, 0x53, 0xE7, 0x01, 0x4E, 0xEF, 0x01, 0x53, 0xDE, 0x01,
+    0x53, 0x93, 0x00, 0xDB, 0x0E, 0x64, 0x2D, 0x36, 0x37, 0x38, 0x01, 0x54, 0x05, 0x01, 0x54, 0x05,
+    0x01, 0x53, 0xB0, 0x01, 0x54, 0x05, 0x64, 0x01, 0x19, 0x36, 0x49, 0x01, 0x54, 0x16, 0x01, 0x54,
+    0x16, 0x01, 0x4C, 0x4C, 0x01, 0x2D, 0xAD, 0x61, 0x1A, 0x01, 0x4C, 0x06, 0x21, 0x30, 0x05, 0xA1,
+    0x2A, 0x03, 0x61, 0x1A, 0x01, 0x4C, 0xE6, 0x21, 0x30, 0x05, 0xA1, 0x2A, 0x03, 0x63, 0x01, 0x14,
+    0x49, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x01, 0x54, 0x04, 0xE1, 0x22, 0x01, 0x49, 0x5A, 0x21,
+    0x32, 0x05, 0x65, 0x30, 0x31, 0x34, 0x39, 0x49, 0x01, 0x54, 0x52, 0x00, 0x00, 0x15, 0x01, 0x4F,
+    0x59, 0x01, 0x54, 0x52, 0x00, 0x00, 0x03, 0x62, 0x31, 0x36, 0x00, 0x86, 0x76, 0x01, 0x50, 0x4F,
+    0x62, 0x27, 0x39, 0x01, 0x52, 0x46, 0x01, 0x53, 0xDF, 0xA1, 0x04, 0x09, 0x62, 0x19, 0x22, 0x00,
+    0x00, 0x03, 0x01, 0x54, 0x7C, 0x43, 0x23, 0x31, 0x32, 0x00, 0x1E, 0xDB, 0x6E, 0x00, 0x09, 0x61,
+    0x19, 0x01, 0x53, 0xFE, 0x21, 0x2B, 0x05, 0x62, 0x15, 0x41, 0x01, 0x51, 0x2C, 0x00, 0x00, 0x03,
+    0x21, 0x30, 0x09, 0x61, 0x30, 0x01, 0x52, 0x53, 0x21, 0x2A, 0x05, 0x21, 0x21, 0x03, 0x63, 0x32,
+    0x36, 0x49, 0x01, 0x54, 0xA4, 0x00, 0x00, 0x03, 0x01, 0x54, 0x59, 0x61, 0x49, 0x01, 0x4A, 0x0D,
+    0x21, 0x27, 0x05, 0x21, 0x30, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x14, 0x03, 0x21, 0x49, 0x03, 0x21,
+    0x35, 0x03, 0x63, 0x21, 0x27, 0x32, 0x01, 0x54, 0xD2, 0x01, 0x54, 0x17, 0x01, 0x54, 0xC8, 0x61,
+    0x2D, 0x01, 0x54, 0x70, 0x21, 0x40, 0x05, 0x21, 0x30, 0x03, 0x21, 0x2A, 0x03, 0x62, 0x14, 0x49,
+    0x00, 0x00, 0x03, 0x01, 0x54, 0xE3, 0x65, 0x32, 0x34, 0x36, 0x37, 0x49, 0x01, 0x52, 0x3E, 0x00,
+    0x00, 0x09, 0x01, 0x54, 0xF5, 0x01, 0x4D, 0xBD, 0x01, 0x54, 0x9B, 0x62, 0x30, 0x47, 0x01, 0x55,
+    0x0B, 0x01, 0x54, 0xBC, 0x62, 0x32, 0x47, 0x01, 0x52, 0x1B, 0x01, 0x54, 0xC5, 0x62, 0x2D, 0x49,
+    0x01, 0x54, 0xE4, 0x01, 0x4F, 0x6B, 0x62, 0x34, 0x37, 0x01, 0x2F, 0x50, 0x00, 0x00, 0x09, 0x63,
+    0x27, 0x2D, 0x49, 0x01, 0x55, 0x2F, 0x01, 0x51, 0xC4, 0x01, 0x55, 0x25, 0x68, 0x01, 0x14, 0x15,
+    0x17, 0x1E, 0x20, 0x21, 0x2D, 0x00, 0x00, 0x31, 0x00, 0x00, 0x28, 0x00, 0xFE, 0xBC, 0x00, 0x00,
+    0x16, 0x01, 0x4C, 0x4C, 0x01, 0x54, 0xD6, 0x01, 0x51, 0x5A, 0x00, 0x00, 0x0D, 0x61, 0x30, 0x01,
+    0x1C, 0x64, 0x63, 0x01, 0x1A, 0x25, 0x01, 0x55, 0x62, 0x01, 0x55, 0x58, 0x00, 0x00, 0x05, 0x61,
+    0x30, 0x01, 0x54, 0x63, 0x21, 0x2A, 0x05, 0x21, 0x14, 0x03, 0x64, 0x15, 0x1E, 0x21, 0x2D, 0x01,
+    0x55, 0x79, 0x01, 0x55, 0x79, 0x01, 0x55, 0x70, 0x00, 0x00, 0x03, 0x62, 0x08, 0x20, 0x01, 0x55,
+    0x8B, 0x01, 0x55, 0x0C, 0x62, 0x1A, 0x2D, 0x01, 0x55, 0x94, 0x01, 0x55, 0x94, 0xD1, 0x01, 0x04,
+    0x14, 0x15, 0x17, 0x1A, 0x1E, 0x23, 0x25, 0x27, 0x2A, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x01,
+    0xD8, 0x01, 0xBE, 0x01, 0xB5, 0x01, 0x98, 0x01, 0x87, 0x01, 0x4B, 0x01, 0x18, 0x00, 0xFD, 0x00,
+    0xEF, 0x00, 0xCE, 0x00, 0xCB, 0x00, 0xA7, 0x00, 0x61, 0x00, 0x3B, 0x00, 0x23, 0x00, 0x12, 0x00,
+    0x09, 0x62, 0x30, 0x32, 0x01, 0x55, 0xD1, 0x00, 0xC0, 0xE8, 0x62, 0x23, 0x35, 0x01, 0x55, 0x74,
+    0x01, 0x55, 0xDA, 0xE5, 0x01, 0x02, 0x0F, 0x27, 0x2B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01,
+    0x52, 0x78, 0x00, 0x1D, 0x00, 0x01, 0x1A, 0x61, 0x62, 0x15, 0x2A, 0x01, 0x53, 0xD5, 0x01, 0x55,
+    0x32, 0x62, 0x14, 0x1B, 0x01, 0x56, 0x01, 0x00, 0x24, 0x03, 0xE2, 0x23, 0x28, 0x01, 0x56, 0x0A,
+    0x01, 0x56, 0x0A, 0x45, 0x21, 0x23, 0x30, 0x31, 0x32, 0xDE, 0x9A, 0x6A, 0x59, 0x00, 0x1B, 0x00,
+    0x12, 0x00, 0x09, 0x62, 0x30, 0x34, 0x01, 0x25, 0x89, 0x01, 0x56, 0x22, 0x61, 0x12, 0x01, 0x26,
+    0x53, 0x21, 0x31, 0x05, 0xE8, 0x01, 0x15, 0x22, 0x25, 0x27, 0x30, 0x32, 0x4C, 0x01, 0x55, 0xEE,
+    0x01, 0x56, 0x34, 0x01, 0x55, 0xCE, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x01, 0x56, 0x34, 0x01,
+    0x55, 0xEE, 0x01, 0x51, 0x3E, 0xE4, 0x19, 0x27, 0x28, 0x2A, 0x01, 0x20, 0x96, 0x01, 0x44, 0x84,
+    0x01, 0x0A, 0x4A, 0x00, 0xF8, 0x1F, 0x61, 0x19, 0x01, 0x07, 0x23, 0x62, 0x15, 0x22, 0x01, 0x56,
+    0x05, 0x00, 0x00, 0x05, 0xE7, 0x0D, 0x21, 0x2B, 0x31, 0x32, 0x35, 0x4C, 0x01, 0x31, 0x94, 0x00,
+    0x00, 0x1F, 0x01, 0x53, 0x7B, 0x01, 0x56, 0x6A, 0x00, 0x00, 0x09, 0x00, 0xEB, 0x5C, 0x01, 0x56,
+    0x74, 0x41, 0x32, 0x8F, 0x82, 0x62, 0x13, 0x19, 0x00, 0xF8, 0x3C, 0x01, 0x39, 0x90, 0x61, 0x25,
+    0x01, 0x43, 0x80, 0x21, 0x40, 0x05, 0x21, 0x34, 0x03, 0x61, 0x2A, 0x01, 0x31, 0xCD, 0x21, 0x38,
+    0x05, 0x64, 0x0F, 0x17, 0x19, 0x27, 0x01, 0x41, 0xEB, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x01,
+    0x3B, 0x8C, 0x62, 0x16, 0x20, 0x01, 0x3D, 0x36, 0x01, 0x54, 0xC4, 0xE9, 0x01, 0x17, 0x19, 0x1B,
+    0x21, 0x23, 0x2A, 0x32, 0x40, 0x01, 0x3B, 0xD7, 0x01, 0x56, 0x70, 0x00, 0xBF, 0x49, 0x00, 0x00,
+    0x3A, 0x00, 0x00, 0x36, 0x01, 0x2E, 0xE6, 0x00, 0x86, 0x61, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x09,
+    0x61, 0x22, 0x01, 0x54, 0xC6, 0x21, 0x18, 0x05, 0x63, 0x23, 0x31, 0x32, 0x01, 0x56, 0xF8, 0x00,
+    0x00, 0x03, 0x00, 0x99, 0xAE, 0x65, 0x14, 0x19, 0x23, 0x32, 0x34, 0x01, 0x0B, 0xFD, 0x00, 0xC6,
+    0xCC, 0x01, 0x19, 0xC9, 0x00, 0x10, 0xAB, 0x01, 0x53, 0xD8, 0x41, 0x21, 0xDF, 0xA1, 0xA1, 0x34,
+    0x04, 0x21, 0x23, 0x03, 0x63, 0x23, 0x32, 0x34, 0x01, 0x54, 0x21, 0x00, 0x00, 0x03, 0x01, 0x54,
+    0x16, 0x41, 0x15, 0xE2, 0x49, 0x64, 0x04, 0x0A, 0x22, 0x35, 0x01, 0x53, 0xCA, 0x01, 0x57, 0x35,
+    0x01, 0x57, 0x35, 0x01, 0x56, 0xC9, 0x64, 0x01, 0x02, 0x04, 0x27, 0x00, 0x00, 0x15, 0x01, 0x57,
+    0x33, 0x00, 0xF9, 0x19, 0x00, 0x00, 0x11, 0x62, 0x02, 0x22, 0x01, 0x27, 0xBA, 0x00, 0x99, 0xC6,
+    0x49, 0x01, 0x02, 0x04, 0x06, 0x27, 0x2A, 0x2B, 0x40, 0x42, 0x01, 0x4D, 0x01, 0x2C, 0x00, 0xEC,
+    0x00, 0x95, 0x00, 0x68, 0x00, 0x5B, 0x00, 0x3C, 0x00, 0x1A, 0x00, 0x09, 0xE6, 0x01, 0x08, 0x0D,
+    0x18, 0x19, 0x1E, 0x00, 0xC7, 0x25, 0x01, 0x54, 0x11, 0x01, 0x02, 0xA7, 0x01, 0x3C, 0x88, 0x01,
+    0x21, 0xBD, 0x01, 0x21, 0xB9, 0xE2, 0x01, 0x38, 0x01, 0x57, 0x4F, 0x01, 0x57, 0x95, 0x21, 0x0C,
+    0x09, 0xE2, 0x0D, 0x34, 0x01, 0x02, 0xCC, 0x01, 0x57, 0xA1, 0x21, 0x15, 0x09, 0x21, 0x32, 0x03,
+    0x62, 0x32, 0x35, 0x00, 0xCA, 0x04, 0x01, 0x57, 0xB0, 0x61, 0x15, 0x01, 0x56, 0x41, 0x21, 0x08,
+    0x05, 0x68, 0x08, 0x0A, 0x0C, 0x0D, 0x1B, 0x25, 0x40, 0x42, 0x00, 0x7A, 0xED, 0x00, 0x00, 0x14,
+    0x01, 0x57, 0x5B, 0x00, 0x00, 0x11, 0x01, 0x33, 0x6A, 0x00, 0xFF, 0x45, 0x00, 0x00, 0x03, 0x01,
+    0x36, 0xEA, 0x63, 0x10, 0x11, 0x2B, 0x01, 0x57, 0x87, 0x01, 0x57, 0xC6, 0x01, 0x57, 0xC6, 0xE2,
+    0x08, 0x2A, 0x01, 0x56, 0xE3, 0x01, 0x4C, 0x18, 0x62, 0x07, 0x23, 0x00, 0xB2, 0x9B, 0x01, 0x00,
+    0x02, 0x64, 0x1A, 0x30, 0x32, 0x39, 0x00, 0x00, 0x09, 0x01, 0x58, 0x01, 0x00, 0xF6, 0xF3, 0x01,
+    0x58, 0x01, 0xE3, 0x32, 0x34, 0x38, 0x01, 0x58, 0x12, 0x01, 0x58, 0x12, 0x01, 0x58, 0x12, 0x63,
+    0x16, 0x23, 0x38, 0x01, 0x58, 0x1F, 0x01, 0x00, 0x29, 0x01, 0x34, 0x19, 0x62, 0x18, 0x1A, 0x00,
+    0xA7, 0x22, 0x01, 0x57, 0x2A, 0xE3, 0x27, 0x32, 0x4C, 0x00, 0x12, 0xD2, 0x00, 0x00, 0x09, 0x01,
+    0x58, 0x35, 0xE6, 0x1A, 0x27, 0x32, 0x41, 0x42, 0x4C, 0x01, 0x3D, 0xBE, 0x01, 0x46, 0x71, 0x01,
+    0x39, 0xA8, 0x01, 0x05, 0xAF, 0x01, 0x3E, 0x7F, 0x01, 0x58, 0x42, 0xE9, 0x01, 0x15, 0x16, 0x1A,
+    0x21, 0x22, 0x27, 0x2A, 0x2B, 0x01, 0x57, 0x23, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x49, 0x00, 0x00,
+    0x3C, 0x01, 0x55, 0x62, 0x00, 0x00, 0x26, 0x00, 0x00, 0x19, 0x01, 0x49, 0xCF, 0x01, 0x27, 0x2A,
+    0x62, 0x23, 0x32, 0x01, 0x3D, 0x90, 0x01, 0x58, 0x80, 0x62, 0x18, 0x28, 0x00, 0x00, 0x09, 0x01,
+    0x46, 0x6B, 0x41, 0x33, 0x29, 0x22, 0x62, 0x19, 0x1B, 0x01, 0x58, 0x96, 0x01, 0x58, 0x96, 0x62,
+    0x2D, 0x32, 0x01, 0x58, 0x66, 0x00, 0x00, 0x09, 0x41, 0x32, 0xF2, 0xED, 0x21, 0x1B, 0x04, 0x62,
+    0x32, 0x39, 0x01, 0x55, 0x7C, 0x01, 0x1F, 0xD9, 0x41, 0x42, 0x85, 0xA3, 0xE4, 0x20, 0x23, 0x2A,
+    0x2D, 0x00, 0x00, 0x0D, 0x00, 0xA9, 0x2D, 0x01, 0x0E, 0x6D, 0x00, 0x00, 0x04, 0x64, 0x15, 0x30,
+    0x34, 0x4C, 0x01, 0x44, 0x07, 0x00, 0x00, 0x21, 0x00, 0x00, 0x11, 0x01, 0x58, 0xCD, 0xE2, 0x30,
+    0x44, 0x01, 0x58, 0xDE, 0x01, 0x3B, 0xD5, 0x64, 0x23, 0x27, 0x31, 0x32, 0x01, 0x55, 0x7C, 0x00,
+    0x00, 0x09, 0x01, 0x55, 0xD9, 0x01, 0x58, 0xA1, 0x66, 0x19, 0x23, 0x30, 0x31, 0x32, 0x34, 0x00,
+    0xD2, 0x1F, 0x01, 0x56, 0xCE, 0x01, 0x58, 0xF8, 0x01, 0x58, 0xA9, 0x01, 0x58, 0xBF, 0x01, 0x45,
+    0xDA, 0x61, 0x27, 0x01, 0x45, 0xF3, 0x64, 0x1A, 0x27, 0x29, 0x40, 0x01, 0x56, 0x04, 0x01, 0x3D,
+    0xF1, 0x00, 0xC3, 0xE0, 0x00, 0x00, 0x05, 0x21, 0x34, 0x11, 0x41, 0x32, 0x78, 0x7E, 0x21, 0x48,
+    0x04, 0x61, 0x24, 0x01, 0x56, 0x23, 0x21, 0x01, 0x05, 0x62, 0x2A, 0x2B, 0x01, 0x59, 0x39, 0x01,
+    0x59, 0x39, 0x63, 0x02, 0x14, 0x17, 0x01, 0x58, 0xDC, 0x01, 0x59, 0x41, 0x00, 0x00, 0x09, 0x61,
+    0x14, 0x01, 0x35, 0x50, 0xED, 0x01, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x23, 0x25, 0x2A,
+    0x40, 0x42, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x87, 0x00, 0x00, 0x6D, 0x00, 0x00,
+    0x5C, 0x01, 0x58, 0xF9, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x26, 0x01, 0x51, 0x72, 0x01, 0x24, 0xFD,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0x62, 0x25, 0x30, 0x01, 0x4B, 0xA8, 0x01,
+    0x33, 0x90, 0xE5, 0x19, 0x1B, 0x2A, 0x40, 0x42, 0x01, 0x59, 0x91, 0x00, 0x00, 0x09, 0x01, 0x59,
+    0x59, 0x01, 0x52, 0xF7, 0x00, 0xB0, 0xCD, 0xE2, 0x19, 0x32, 0x01, 0x59, 0xA7, 0x01, 0x24, 0x7F,
+    0xE1, 0x28, 0x01, 0x59, 0xAF, 0x61, 0x22, 0x01, 0x47, 0xAB, 0x21, 0x30, 0x05, 0x41, 0x2B, 0x67,
+    0xF8, 0x68, 0x04, 0x14, 0x15, 0x17, 0x1B, 0x23, 0x2B, 0x40, 0x01, 0x4B, 0xE0, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x11, 0x01, 0x59, 0x88, 0x00, 0xCA, 0xF3, 0x00, 0x00, 0x07, 0x01, 0x11, 0x28, 0x00,
+    0x00, 0x04, 0x62, 0x30, 0x31, 0x01, 0x59, 0xE2, 0x00, 0x2D, 0x7D, 0x61, 0x2B, 0x01, 0x40, 0x5F,
+    0x21, 0x40, 0x05, 0x21, 0x1E, 0x03, 0xE3, 0x1E, 0x22, 0x40, 0x00, 0x00, 0x14, 0x01, 0x4F, 0xB6,
+    0x00, 0x00, 0x03, 0x62, 0x2A, 0x2B, 0x01, 0x56, 0xD3, 0x01, 0x58, 0xCB, 0x41, 0x01, 0x70, 0x27,
+    0x62, 0x20, 0x34, 0x01, 0x56, 0xDD, 0x00, 0x00, 0x04, 0x21, 0x22, 0x09, 0x22, 0x30, 0x32, 0x19,
+    0x03, 0x61, 0x0D, 0x01, 0x11, 0xE6, 0x21, 0x0D, 0x05, 0x66, 0x0A, 0x17, 0x22, 0x23, 0x31, 0x42,
+    0x00, 0x12, 0xC6, 0x00, 0xE1, 0x6D, 0x01, 0x18, 0x84, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01,
+    0x39, 0x52, 0x66, 0x19, 0x20, 0x21, 0x27, 0x44, 0x4C, 0x01, 0x5A, 0x26, 0x01, 0x19, 0x50, 0x01,
+    0x3D, 0x41, 0x01, 0x0E, 0x77, 0x01, 0x3D, 0x39, 0x01, 0x5A, 0x42, 0x21, 0x18, 0x19, 0x62, 0x17,
+    0x19, 0x01, 0x57, 0xF7, 0x00, 0x00, 0x03, 0x61, 0x18, 0x01, 0x56, 0xFC, 0x21, 0x17, 0x05, 0x64,
+    0x25, 0x31, 0x32, 0x38, 0x01, 0x5A, 0x6F, 0x00, 0x00, 0x11, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03,
+    0x62, 0x23, 0x29, 0x01, 0x57, 0x87, 0x01, 0x4F, 0xA1, 0x63, 0x27, 0x31, 0x32, 0x01, 0x57, 0x1E,
+    0x01, 0x57, 0x7B, 0x00, 0x00, 0x09, 0x61, 0x18, 0x01, 0x5A, 0x3B, 0x21, 0x1B, 0x05, 0x63, 0x19,
+    0x31, 0x32, 0x01, 0x5A, 0x38, 0x00, 0x00, 0x03, 0x00, 0x5A, 0x24, 0x61, 0x01, 0x01, 0x59, 0xCA,
+    0x21, 0x22, 0x05, 0x21, 0x35, 0x03, 0x21, 0x19, 0x03, 0x21, 0x17, 0x03, 0x42, 0x1E, 0x21, 0xB3,
+    0x78, 0x00, 0x03, 0x68, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x21, 0x24, 0x42, 0x01, 0x1F, 0x3D, 0x00,
+    0x00, 0x9A, 0x01, 0x18, 0xDE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x25, 0x01, 0x57,
+    0x96, 0x00, 0x00, 0x07, 0x42, 0x25, 0x40, 0x3D, 0xB2, 0xD4, 0xB2, 0xE1, 0x23, 0x01, 0x57, 0x80,
+    0x62, 0x30, 0x38, 0x01, 0x5A, 0xF0, 0x00, 0x00, 0x05, 0x63, 0x14, 0x15, 0x2A, 0x01, 0x5A, 0x33,
+    0x01, 0x5A, 0xF9, 0x00, 0x00, 0x09, 0xE1, 0x2A, 0x01, 0x58, 0xF7, 0x62, 0x07, 0x19, 0x00, 0x00,
+    0x05, 0x01, 0x5B, 0x0B, 0x76, 0x01, 0x02, 0x04, 0x07, 0x08, 0x0A, 0x0D, 0x10, 0x13, 0x14, 0x15,
+    0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x25, 0x2A, 0x48, 0x49, 0x00, 0x05, 0x31, 0x01, 0x45,
+    0x97, 0x01, 0x5B, 0x14, 0x00, 0x03, 0xB4, 0x00, 0x03, 0x98, 0x00, 0x03, 0x76, 0x00, 0x03, 0x53,
+    0x01, 0x46, 0x4E, 0x00, 0x03, 0x32, 0x00, 0x03, 0x25, 0x00, 0x02, 0xB9, 0x00, 0x02, 0x8B, 0x00,
+    0x01, 0xC0, 0x00, 0x01, 0x82, 0x00, 0x01, 0x53, 0x00, 0x01, 0x1E, 0x00, 0x00, 0x51, 0x01, 0x50,
+    0xAA, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x09, 0x01, 0x5A, 0xDB, 0xE1, 0x41, 0x01,
+    0x4B, 0x4D, 0xE5, 0x23, 0x25, 0x29, 0x31, 0x34, 0x01, 0x04, 0x2E, 0x00, 0x00, 0x05, 0x01, 0x41,
+    0x04, 0x00, 0x26, 0x04, 0x01, 0x5A, 0xB7, 0x63, 0x23, 0x39, 0x40, 0x01, 0x5B, 0x87, 0x01, 0x5B,
+    0x87, 0x01, 0x3F, 0x72, 0xE1, 0x2B, 0x01, 0x59, 0x04, 0xE1, 0x23, 0x01, 0x5B, 0x33, 0x61, 0x2A,
+    0x01, 0x02, 0xD4, 0x63, 0x23, 0x34, 0x38, 0x01, 0x5B, 0xA3, 0x00, 0x00, 0x05, 0x01, 0x5B, 0xA3,
+    0x61, 0x0A, 0x01, 0x51, 0x46, 0x21, 0x22, 0x05, 0x21, 0x42, 0x03, 0x21, 0x30, 0x03, 0x21, 0x23,
+    0x03, 0x62, 0x01, 0x42, 0x01, 0x5A, 0x89, 0x00, 0xB3, 0xC5, 0x21, 0x1B, 0x09, 0xE7, 0x0A, 0x1B,
+    0x20, 0x23, 0x2A, 0x30, 0x39, 0x01, 0x5B, 0x94, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x4A, 0x00, 0x6C,
+    0x02, 0x01, 0x11, 0x7E, 0x01, 0x5B, 0xCD, 0x00, 0x00, 0x03, 0x21, 0x13, 0x1D, 0x21, 0x23, 0x03,
+    0x61, 0x14, 0x01, 0x3D, 0xAE, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0xE3, 0x01, 0x0A, 0x1B, 0x01,
+    0x5A, 0xC3, 0x01, 0x5B, 0xC2, 0x00, 0x00, 0x03, 0x66, 0x01, 0x22, 0x23, 0x32, 0x34, 0x38, 0x01,
+    0x5C, 0x08, 0x01, 0x0C, 0xC5, 0x01, 0x5C, 0x08, 0x00, 0x00, 0x1B, 0x01, 0x58, 0xFA, 0x00, 0x00,
+    0x0D, 0xC1, 0x28, 0x18, 0xE5, 0xE2, 0x15, 0x38, 0x01, 0x2C, 0x95, 0x00, 0x00, 0x04, 0xE2, 0x2A,
+    0x32, 0x00, 0xC7, 0x25, 0x01, 0x5B, 0xF5, 0xE1, 0x44, 0x01, 0x26, 0xD2, 0x62, 0x32, 0x38, 0x01,
+    0x5C, 0x3C, 0x01, 0x5A, 0x2D, 0x62, 0x30, 0x32, 0x01, 0x4A, 0x7B, 0x01, 0x5C, 0x0C, 0x42, 0x23,
+    0x35, 0x00, 0x09, 0x09, 0x0B, 0xE1, 0x49, 0x01, 0x5C, 0x00, 0x62, 0x01, 0x34, 0x01, 0x13, 0xE5,
+    0x01, 0x58, 0x42, 0x62, 0x25, 0x32, 0x01, 0x5A, 0x40, 0x01, 0x50, 0x26, 0x61, 0x35, 0x01, 0x41,
+    0x75, 0x21, 0x04, 0x05, 0xE1, 0x2A, 0x01, 0x0A, 0x3E, 0x22, 0x04, 0x0D, 0x08, 0x05, 0x62, 0x19,
+    0x23, 0x00, 0xC2, 0xB7, 0x01, 0x59, 0x66, 0x64, 0x01, 0x15, 0x19, 0x20, 0x01, 0x5C, 0x87, 0x01,
+    0x5C, 0x87, 0x01, 0x5B, 0xC1, 0x01, 0x38, 0x1A, 0x66, 0x07, 0x13, 0x21, 0x27, 0x2A, 0x2B, 0x01,
+    0x5C, 0x32, 0x01, 0x5C, 0x52, 0x01, 0x5C, 0x32, 0x01, 0x5A, 0x9A, 0x01, 0x5C, 0x5F, 0x00, 0xED,
+    0x40, 0x62, 0x01, 0x04, 0x01, 0x5C, 0x32, 0x01, 0x5C, 0xB0, 0xF4, 0x02, 0x04, 0x07, 0x0A, 0x15,
+    0x17, 0x19, 0x1E, 0x23, 0x25, 0x2A, 0x2B, 0x31, 0x32, 0x34, 0x35, 0x40, 0x41, 0x42, 0x44, 0x00,
+    0x00, 0x7E, 0x01, 0x5C, 0x5F, 0x01, 0x13, 0x3A, 0x01, 0x31, 0x4F, 0x01, 0x5C, 0x54, 0x01, 0x5B,
+    0x79, 0x00, 0x58, 0x9D, 0x00, 0x00, 0x6C, 0x01, 0x49, 0x9C, 0x00, 0x00, 0x65, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x57, 0x00, 0x00, 0x41, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x33, 0x01, 0x5C, 0xBA, 0x00,
+    0x00, 0x22, 0x01, 0x1B, 0x02, 0x00, 0x00, 0x09, 0x01, 0x02, 0xC8, 0xC1, 0x1C, 0xB0, 0x97, 0x21,
+    0x33, 0x04, 0x21, 0x49, 0x03, 0x62, 0x31, 0x38, 0x01, 0x5C, 0x10, 0x01, 0x5B, 0x63, 0x61, 0x01,
+    0x01, 0x3C, 0x7A, 0x21, 0x32, 0x05, 0x62, 0x21, 0x31, 0x01, 0x5D, 0x26, 0x01, 0x59, 0x0E, 0x61,
+    0x19, 0x01, 0x55, 0x24, 0x63, 0x21, 0x34, 0x48, 0x01, 0x5C, 0xEE, 0x00, 0x00, 0x05, 0x01, 0x5D,
+    0x2A, 0xE1, 0x2B, 0x01, 0x5D, 0x25, 0x62, 0x0D, 0x13, 0x00, 0x00, 0x05, 0x01, 0x28, 0x1E, 0x63,
+    0x19, 0x2B, 0x2D, 0x01, 0x5C, 0x9A, 0x01, 0x5C, 0xE9, 0x01, 0x5D, 0x4E, 0x62, 0x08, 0x22, 0x01,
+    0x5D, 0x5C, 0x01, 0x5D, 0x5C, 0xF3, 0x0A, 0x0B, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1E, 0x1F, 0x22,
+    0x23, 0x25, 0x2A, 0x2D, 0x31, 0x40, 0x42, 0x43, 0x44, 0x01, 0x5D, 0x4C, 0x01, 0x2A, 0x27, 0x01,
+    0x42, 0xF7, 0x00, 0xD3, 0xB7, 0x00, 0x00, 0x53, 0x00, 0x00, 0x50, 0x00, 0x00, 0x42, 0x01, 0x5D,
+    0x0A, 0x01, 0x58, 0xA3, 0x01, 0x5D, 0x4C, 0x01, 0x49, 0x1C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x31,
+    0x00, 0x1A, 0xCE, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x16, 0x01, 0x59, 0xF6, 0x00, 0x00, 0x09, 0x01,
+    0x53, 0xED, 0xE2, 0x32, 0x34, 0x01, 0x5D, 0xB2, 0x01, 0x5D, 0x2D, 0x62, 0x0D, 0x1A, 0x01, 0x5D,
+    0xBB, 0x01, 0x5D, 0xBB, 0x64, 0x1A, 0x23, 0x31, 0x32, 0x01, 0x5D, 0xC4, 0x01, 0x05, 0xCE, 0x00,
+    0x00, 0x09, 0x01, 0x40, 0xE8, 0xE1, 0x0A, 0x01, 0x4E, 0x31, 0x62, 0x14, 0x19, 0x00, 0x00, 0x05,
+    0x01, 0x5D, 0xDA, 0x62, 0x31, 0x32, 0x00, 0x00, 0x09, 0x01, 0x00, 0xA2, 0x62, 0x32, 0x35, 0x01,
+    0x5A, 0xB9, 0x01, 0x5D, 0xEC, 0x61, 0x30, 0x01, 0x3E, 0x82, 0x62, 0x14, 0x15, 0x01, 0x5D, 0xFA,
+    0x01, 0x5D, 0xB4, 0x21, 0x31, 0x09, 0x65, 0x19, 0x31, 0x32, 0x34, 0x49, 0x01, 0x18, 0x32, 0x01,
+    0x5B, 0xF7, 0x01, 0x37, 0x52, 0x01, 0x5D, 0xCD, 0x01, 0x5B, 0xF7, 0xE2, 0x1E, 0x41, 0x01, 0x5D,
+    0xB5, 0x01, 0x5D, 0xE2, 0x61, 0x04, 0x01, 0x1A, 0x88, 0x21, 0x33, 0x05, 0xE2, 0x2A, 0x30, 0x00,
+    0x00, 0x03, 0x01, 0x5E, 0x2C, 0x21, 0x16, 0x09, 0x63, 0x15, 0x17, 0x21, 0x00, 0x00, 0x03, 0x01,
+    0x5B, 0xD1, 0x01, 0x13, 0x34, 0x41, 0x35, 0xDA, 0xA2, 0x42, 0x13, 0x19, 0x00, 0x04, 0xC0, 0xDA,
+    0x41, 0x18, 0xC9, 0x4B, 0x21, 0x01, 0x04, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0xF6, 0x04, 0x15,
+    0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x35,
+    0x39, 0x40, 0x44, 0x4C, 0x01, 0x29, 0x03, 0x01, 0x5D, 0xF4, 0x01, 0x5D, 0x97, 0x00, 0x00, 0xAB,
+    0x00, 0xA7, 0x26, 0x00, 0x00, 0x99, 0x00, 0xE3, 0x16, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x71, 0x00,
+    0x00, 0x68, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x57, 0x01, 0x04, 0x09, 0x01, 0x5E, 0x0E, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x25, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x01, 0x5E, 0x4A, 0x01, 0x30, 0x36,
+    0x01, 0x2A, 0xE2, 0x01, 0x5E, 0x5C, 0xE2, 0x01, 0x19, 0x01, 0x5E, 0x50, 0x01, 0x5D, 0xF0, 0x64,
+    0x30, 0x34, 0x35, 0x39, 0x00, 0x3D, 0x36, 0x00, 0x00, 0x09, 0x01, 0x48, 0xB9, 0x01, 0x5E, 0xBF,
+    0x62, 0x01, 0x15, 0x01, 0x5E, 0x6A, 0x00, 0xF1, 0x5B, 0x62, 0x01, 0x2A, 0x01, 0x5E, 0x48, 0x01,
+    0x5E, 0x5A, 0xE6, 0x01, 0x19, 0x23, 0x34, 0x41, 0x44, 0x01, 0x5E, 0xE2, 0x01, 0x5B, 0x77, 0x01,
+    0x4B, 0xC4, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01, 0x24, 0x72, 0x63, 0x19, 0x21, 0x4C, 0x01,
+    0x5C, 0x39, 0x01, 0x5E, 0xFB, 0x01, 0x5E, 0xC2, 0x62, 0x35, 0x48, 0x01, 0x5F, 0x08, 0x01, 0x5C,
+    0xDE, 0x62, 0x15, 0x2A, 0x01, 0x5B, 0xF9, 0x01, 0x5F, 0x11, 0x22, 0x23, 0x31, 0x12, 0x09, 0x61,
+    0x38, 0x01, 0x45, 0x93, 0x62, 0x01, 0x2B, 0x01, 0x5F, 0x24, 0x01, 0x14, 0x9D, 0x61, 0x2B, 0x01,
+    0x5B, 0x29, 0x62, 0x17, 0x23, 0x01, 0x5F, 0x32, 0x01, 0x42, 0x7A, 0x61, 0x16, 0x01, 0x5E, 0x80,
+    0xFA, 0x01, 0x02, 0x04, 0x07, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2C, 0x40, 0x41, 0x42, 0x44, 0x00, 0x03, 0xCE, 0x01, 0x5E,
+    0xDA, 0x00, 0x03, 0xB9, 0x00, 0x03, 0xAC, 0x01, 0x5F, 0x3F, 0x01, 0x5C, 0x58, 0x01, 0x4F, 0x66,
+    0x01, 0x5F, 0x40, 0x00, 0x03, 0xA7, 0x00, 0x03, 0x9D, 0x00, 0x03, 0x38, 0x00, 0x03, 0x1B, 0x00,
+    0x03, 0x12, 0x00, 0x03, 0x09, 0x00, 0x02, 0x86, 0x00, 0x01, 0xDB, 0x00, 0x00, 0xE3, 0x00, 0x00,
+    0x81, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x45, 0x00, 0x00, 0x26, 0x00, 0x00, 0x21, 0x00, 0x00, 0x1C,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x41, 0x07, 0xC6, 0x50, 0xE2, 0x07, 0x2A,
+    0x01, 0x5F, 0x52, 0x00, 0x00, 0x04, 0x21, 0x01, 0x09, 0x65, 0x27, 0x2D, 0x31, 0x32, 0x36, 0x01,
+    0x52, 0xED, 0x01, 0x5F, 0xAF, 0x00, 0x00, 0x03, 0x01, 0x5F, 0x80, 0x01, 0x57, 0x21, 0x61, 0x19,
+    0x01, 0x53, 0xFB, 0x21, 0x33, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x14, 0x03, 0x62, 0x2D, 0x31, 0x01,
+    0x5F, 0xDB, 0x00, 0x00, 0x03, 0x62, 0x25, 0x2B, 0x01, 0x5F, 0x90, 0x00, 0xD0, 0x45, 0x62, 0x30,
+    0x31, 0x00, 0x00, 0x09, 0x01, 0x58, 0xB5, 0x61, 0x40, 0x01, 0x4F, 0x9C, 0x21, 0x17, 0x05, 0x21,
+    0x40, 0x03, 0x21, 0x25, 0x03, 0x61, 0x23, 0x01, 0x5E, 0xFC, 0xA1, 0x04, 0x05, 0x21, 0x19, 0x03,
+    0x65, 0x07, 0x25, 0x2B, 0x40, 0x42, 0x01, 0x5F, 0xAA, 0x01, 0x5F, 0xBB, 0x01, 0x5F, 0xAA, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x03, 0x21, 0x30, 0x15, 0x64, 0x08, 0x21, 0x22, 0x25, 0x01, 0x60, 0x28,
+    0x01, 0x60, 0x28, 0x01, 0x60, 0x28, 0x01, 0x60, 0x28, 0x61, 0x35, 0x01, 0x49, 0x14, 0x21, 0x23,
+    0x05, 0x21, 0x28, 0x03, 0x21, 0x35, 0x03, 0xC2, 0x14, 0x23, 0x00, 0x03, 0xB0, 0xB8, 0x62, 0x01,
+    0x0D, 0x01, 0x60, 0x4E, 0x00, 0x00, 0x07, 0x66, 0x14, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x01, 0x60,
+    0x57, 0x00, 0x00, 0x2F, 0x01, 0x57, 0xBF, 0x01, 0x5C, 0x3F, 0x00, 0x00, 0x09, 0x01, 0x60, 0x08,
+    0x63, 0x31, 0x32, 0x35, 0x01, 0x60, 0x6F, 0x01, 0x60, 0x37, 0x01, 0x60, 0x70, 0x62, 0x32, 0x48,
+    0x01, 0x60, 0x7D, 0x01, 0x5A, 0xCB, 0x62, 0x27, 0x31, 0x01, 0x60, 0x37, 0x01, 0x5C, 0x6E, 0x62,
+    0x23, 0x32, 0x00, 0x00, 0x09, 0x01, 0x60, 0x8F, 0x62, 0x2D, 0x32, 0x01, 0x5F, 0xDD, 0x01, 0x60,
+    0x8E, 0x62, 0x32, 0x35, 0x01, 0x60, 0xA1, 0x01, 0x5D, 0x2B, 0xE1, 0x23, 0x01, 0x60, 0x94, 0x21,
+    0x08, 0x05, 0x63, 0x32, 0x34, 0x47, 0x01, 0x60, 0xB2, 0x01, 0x60, 0xA8, 0x00, 0x00, 0x03, 0x62,
+    0x19, 0x23, 0x01, 0x5D, 0x4C, 0x01, 0x60, 0x2E, 0x65, 0x19, 0x20, 0x23, 0x2A, 0x2B, 0x00, 0x00,
+    0x27, 0x01, 0x60, 0x62, 0x00, 0x00, 0x16, 0x01, 0x4D, 0x96, 0x00, 0x00, 0x09, 0x62, 0x14, 0x25,
+    0x01, 0x60, 0xD3, 0x01, 0x60, 0xD3, 0xE1, 0x17, 0x01, 0x48, 0x32, 0x21, 0x07, 0x05, 0x21, 0x23,
+    0x03, 0xEF, 0x04, 0x0B, 0x17, 0x19, 0x1A, 0x1B, 0x21, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41,
+    0x42, 0x01, 0x1D, 0x55, 0x01, 0x51, 0x4D, 0x01, 0x53, 0x10, 0x00, 0x01, 0x38, 0x00, 0x01, 0x15,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x81, 0x00, 0x00, 0x74, 0x00,
+    0x00, 0x62, 0x00, 0x00, 0x59, 0x00, 0x00, 0x29, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x63, 0x32,
+    0x34, 0x4C, 0x00, 0xD9, 0x33, 0x01, 0x5F, 0x1F, 0x01, 0x61, 0x2E, 0x21, 0x02, 0x0D, 0xE1, 0x19,
+    0x01, 0x60, 0xE0, 0x64, 0x23, 0x32, 0x35, 0x40, 0x01, 0x51, 0x69, 0x00, 0x00, 0x05, 0x01, 0x61,
+    0x43, 0x01, 0x45, 0x2E, 0x61, 0x1B, 0x01, 0x60, 0x61, 0x65, 0x25, 0x32, 0x35, 0x42, 0x4C, 0x01,
+    0x60, 0x93, 0x01, 0x45, 0xFF, 0x01, 0x61, 0x59, 0x00, 0x00, 0x05, 0x01, 0x61, 0x59, 0x41, 0x2A,
+    0x9E, 0xC6, 0x21, 0x32, 0x04, 0x21, 0x23, 0x03, 0x62, 0x32, 0x39, 0x00, 0x00, 0x03, 0x01, 0x60,
+    0xE7, 0x61, 0x0D, 0x01, 0x3E, 0x0A, 0x21, 0x31, 0x05, 0x61, 0x32, 0x01, 0x13, 0xCD, 0x62, 0x04,
+    0x2A, 0x01, 0x5F, 0x7F, 0x01, 0x57, 0x24, 0xE6, 0x19, 0x1A, 0x23, 0x25, 0x32, 0x4C, 0x01, 0x43,
+    0xA8, 0x00, 0x00, 0x11, 0x00, 0x00, 0x0E, 0x01, 0x58, 0x0B, 0x00, 0x00, 0x09, 0x01, 0x5F, 0xDF,
+    0xE5, 0x02, 0x04, 0x2A, 0x2B, 0x42, 0x01, 0x61, 0x6A, 0x00, 0x00, 0x57, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x19, 0x01, 0x5E, 0xA2, 0xE2, 0x19, 0x4C, 0x01, 0x61, 0xA9, 0x01, 0x61, 0xC5, 0x21, 0x08,
+    0x09, 0x62, 0x16, 0x32, 0x01, 0x61, 0xD1, 0x01, 0x5F, 0xC2, 0xA1, 0x23, 0x09, 0x41, 0x01, 0xBE,
+    0x8D, 0x21, 0x2D, 0x04, 0x21, 0x19, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x32, 0x03, 0x21, 0x20, 0x03,
+    0xE3, 0x0A, 0x2A, 0x4C, 0x01, 0x46, 0x6D, 0x00, 0x00, 0x03, 0x01, 0x61, 0xF0, 0xA2, 0x32, 0x34,
+    0x23, 0x0D, 0x21, 0x18, 0x05, 0x62, 0x23, 0x27, 0x01, 0x2E, 0xEE, 0x01, 0x61, 0x3F, 0x62, 0x1E,
+    0x38, 0x01, 0x62, 0x0E, 0x01, 0x43, 0x74, 0x62, 0x2D, 0x38, 0x01, 0x61, 0xC8, 0x01, 0x60, 0x8F,
+    0x63, 0x17, 0x18, 0x2B, 0x01, 0x61, 0xBA, 0x00, 0xC9, 0xD3, 0x01, 0x5F, 0xD0, 0x62, 0x16, 0x2B,
+    0x01, 0x61, 0x9C, 0x01, 0x56, 0xB5, 0xEC, 0x04, 0x17, 0x18, 0x1A, 0x2A, 0x30, 0x32, 0x35, 0x40,
+    0x41, 0x43, 0x44, 0x01, 0x5D, 0x74, 0x00, 0x00, 0x31, 0x00, 0x00, 0x28, 0x01, 0x61, 0xFD, 0x00,
+    0x00, 0x1F, 0x01, 0x62, 0x36, 0x01, 0x61, 0xE7, 0x01, 0x62, 0x36, 0x00, 0x00, 0x16, 0x01, 0x30,
+    0x25, 0x01, 0x34, 0x04, 0x00, 0x00, 0x09, 0xE2, 0x01, 0x40, 0x01, 0x62, 0x67, 0x01, 0x43, 0x69,
+    0xE2, 0x30, 0x34, 0x01, 0x62, 0x70, 0x00, 0x00, 0x09, 0xE1, 0x34, 0x01, 0x50, 0xD8, 0x63, 0x01,
+    0x30, 0x32, 0x01, 0x62, 0x7E, 0x01, 0x62, 0x7E, 0x01, 0x62, 0x7E, 0x63, 0x23, 0x2B, 0x48, 0x01,
+    0x5F, 0xA7, 0x00, 0x00, 0x0D, 0x01, 0x4B, 0x34, 0x62, 0x01, 0x19, 0x01, 0x62, 0x32, 0x00, 0x00,
+    0x0D, 0x62, 0x23, 0x25, 0x00, 0xBF, 0x69, 0x01, 0x62, 0xA0, 0xE1, 0x02, 0x01, 0x61, 0x9E, 0x62,
+    0x07, 0x27, 0x00, 0x00, 0x05, 0x01, 0x62, 0xAF, 0x61, 0x31, 0x01, 0x02, 0x92, 0x21, 0x15, 0x05,
+    0xA1, 0x34, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x35, 0x03, 0x61, 0x19, 0x01, 0x60, 0x35, 0x21, 0x0A,
+    0x05, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0xE4, 0x0A, 0x1E, 0x25, 0x43, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x03, 0x01, 0x60, 0xC8, 0x01, 0x60, 0xA6, 0x21, 0x19, 0x11, 0xF7, 0x01, 0x02, 0x04, 0x07,
+    0x0A, 0x0D, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x25, 0x27, 0x2B, 0x40,
+    0x42, 0x48, 0x49, 0x00, 0x01, 0xB0, 0x00, 0x01, 0xA8, 0x01, 0x48, 0x67, 0x00, 0x01, 0x3B, 0x01,
+    0x62, 0x8D, 0x00, 0x01, 0x1D, 0x01, 0x62, 0xEB, 0x01, 0x3D, 0xAF, 0x00, 0x00, 0xE9, 0x01, 0x4D,
+    0x6E, 0x00, 0x00, 0xB5, 0x01, 0x62, 0xEB, 0x00, 0x30, 0xED, 0x01, 0x33, 0x12, 0x01, 0x19, 0xD5,
+    0x00, 0x00, 0x7B, 0x01, 0x62, 0x85, 0x00, 0x00, 0x72, 0x01, 0x61, 0x73, 0x00, 0x00, 0x53, 0x00,
+    0x00, 0x4A, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x64, 0x23, 0x31, 0x32, 0x38, 0x01, 0x4D, 0x25,
+    0x01, 0x63, 0x0F, 0x01, 0x63, 0x48, 0x01, 0x63, 0x0F, 0xE2, 0x25, 0x49, 0x01, 0x63, 0x59, 0x01,
+    0x63, 0x20, 0x41, 0x33, 0xF1, 0x4D, 0x21, 0x49, 0x04, 0x65, 0x2D, 0x30, 0x31, 0x32, 0x38, 0x01,
+    0x63, 0x69, 0x01, 0x63, 0x69, 0x01, 0x63, 0x30, 0x01, 0x63, 0x69, 0x01, 0x63, 0x68, 0x62, 0x32,
+    0x49, 0x01, 0x61, 0x80, 0x01, 0x63, 0x18, 0xE3, 0x19, 0x23, 0x4C, 0x00, 0x00, 0x09, 0x01, 0x3B,
+    0xA2, 0x01, 0x63, 0x87, 0x61, 0x15, 0x01, 0x61, 0xAA, 0x41, 0x0A, 0x24, 0x47, 0xE4, 0x1A, 0x1E,
+    0x40, 0x44, 0x01, 0x61, 0x9F, 0x00, 0xA2, 0x22, 0x00, 0xF4, 0x42, 0x00, 0x00, 0x04, 0xF4, 0x01,
+    0x02, 0x04, 0x06, 0x08, 0x0A, 0x14, 0x15, 0x19, 0x1C, 0x1D, 0x21, 0x25, 0x27, 0x2A, 0x2B, 0x42,
+    0x44, 0x48, 0x49, 0x00, 0x00, 0x66, 0x01, 0x63, 0x9E, 0x00, 0xE8, 0x23, 0x01, 0x63, 0xAE, 0x01,
+    0x3D, 0x2B, 0x01, 0x59, 0x47, 0x00, 0x97, 0xA0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x48, 0x00, 0xB7,
+    0x3A, 0x01, 0x63, 0x5C, 0x01, 0x63, 0x48, 0x01, 0x61, 0x9F, 0x01, 0x24, 0x9E, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x1A, 0x01, 0x4E, 0x38, 0x00, 0x00, 0x11, 0x01, 0x63, 0xAE, 0xE1,
+    0x2B, 0x01, 0x2C, 0x72, 0x62, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01, 0x64, 0x04, 0x62, 0x27, 0x32,
+    0x01, 0x63, 0xD4, 0x01, 0x59, 0x19, 0xE6, 0x04, 0x17, 0x1E, 0x2A, 0x2B, 0x44, 0x01, 0x5C, 0xDD,
+    0x01, 0x58, 0x06, 0x01, 0x60, 0xFA, 0x00, 0x00, 0x09, 0x01, 0x1C, 0x8B, 0x01, 0x64, 0x03, 0xE2,
+    0x21, 0x2A, 0x01, 0x44, 0x9F, 0x01, 0x62, 0xF7, 0x21, 0x2D, 0x09, 0x22, 0x1A, 0x48, 0x25, 0x03,
+    0x61, 0x0D, 0x01, 0x40, 0x1D, 0x21, 0x0D, 0x05, 0x61, 0x32, 0x01, 0x1E, 0x46, 0x21, 0x22, 0x05,
+    0x21, 0x49, 0x03, 0xE9, 0x02, 0x07, 0x14, 0x23, 0x31, 0x33, 0x35, 0x41, 0x43, 0x01, 0x64, 0x37,
+    0x01, 0x5C, 0x32, 0x01, 0x5F, 0x0D, 0x01, 0x08, 0x1C, 0x00, 0x00, 0x0E, 0x01, 0x64, 0x53, 0x00,
+    0x00, 0x03, 0x00, 0xEE, 0x3B, 0x01, 0x51, 0x35, 0x41, 0x0F, 0xCA, 0x02, 0x42, 0x32, 0x34, 0x00,
+    0x04, 0xDD, 0xEA, 0x62, 0x31, 0x32, 0x01, 0x64, 0x61, 0x01, 0x61, 0x50, 0x41, 0x27, 0x78, 0x0B,
+    0x21, 0x48, 0x04, 0x64, 0x21, 0x27, 0x31, 0x32, 0x01, 0x64, 0x93, 0x00, 0x91, 0xEB, 0x01, 0x57,
+    0x6A, 0x01, 0x54, 0x1A, 0xE3, 0x20, 0x23, 0x27, 0x00, 0xAB, 0x55, 0x01, 0x45, 0xB8, 0x01, 0x2F,
+    0x4A, 0xE2, 0x27, 0x32, 0x01, 0x00, 0x14, 0x01, 0x64, 0x53, 0x21, 0x21, 0x09, 0xED, 0x15, 0x19,
+    0x20, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x32, 0x34, 0x35, 0x38, 0x43, 0x01, 0x64, 0x57, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x2D, 0x01, 0x40, 0xA0, 0x01, 0x52, 0xEC, 0x01, 0x44, 0xF3,
+    0x00, 0x00, 0x2A, 0x00, 0x00, 0x19, 0x01, 0x64, 0x84, 0x01, 0x64, 0xBD, 0x00, 0x00, 0x03, 0x01,
+    0x62, 0x8C, 0x41, 0x27, 0x92, 0x4A, 0xE3, 0x23, 0x2A, 0x4C, 0x01, 0x51, 0xD8, 0x00, 0x00, 0x04,
+    0x01, 0x64, 0xF6, 0x21, 0x18, 0x0D, 0x62, 0x32, 0x4C, 0x01, 0x49, 0x9E, 0x01, 0x65, 0x06, 0x21,
+    0x18, 0x09, 0x21, 0x19, 0x03, 0x44, 0x15, 0x19, 0x31, 0x34, 0xFA, 0x01, 0x00, 0x12, 0x00, 0x03,
+    0xFE, 0x24, 0xE1, 0x32, 0x01, 0x64, 0xD9, 0x62, 0x01, 0x2A, 0x00, 0x00, 0x05, 0x01, 0x61, 0x45,
+    0xE1, 0x15, 0x01, 0x46, 0x96, 0x64, 0x23, 0x2B, 0x30, 0x34, 0x01, 0x42, 0x5D, 0x00, 0xE2, 0x24,
+    0x01, 0x65, 0x35, 0x00, 0x00, 0x05, 0xE1, 0x14, 0x01, 0x64, 0xE0, 0x62, 0x19, 0x32, 0x01, 0x65,
+    0x4B, 0x00, 0x00, 0x05, 0xE3, 0x0D, 0x15, 0x19, 0x00, 0x75, 0x21, 0x01, 0x64, 0xEE, 0x01, 0x2F,
+    0x95, 0xE2, 0x2B, 0x34, 0x01, 0x64, 0xFB, 0x00, 0x2D, 0x24, 0x62, 0x19, 0x34, 0x01, 0x65, 0x6A,
+    0x01, 0x65, 0x1B, 0x61, 0x34, 0x01, 0x28, 0xDD, 0x21, 0x23, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x40,
+    0x03, 0x21, 0x30, 0x03, 0x21, 0x23, 0x03, 0x61, 0x32, 0x01, 0x55, 0x0E, 0xED, 0x01, 0x02, 0x04,
+    0x08, 0x17, 0x19, 0x1B, 0x20, 0x27, 0x2A, 0x32, 0x41, 0x43, 0x01, 0x1A, 0x3E, 0x01, 0x32, 0x2B,
+    0x00, 0x00, 0x22, 0x01, 0x42, 0xB4, 0x00, 0xF2, 0x60, 0x01, 0x63, 0xDA, 0x00, 0x00, 0x08, 0x01,
+    0x13, 0x3C, 0x00, 0xD9, 0x19, 0x00, 0x00, 0x05, 0x01, 0x65, 0x8C, 0x00, 0xE9, 0xFD, 0x01, 0x63,
+    0x5B, 0xE4, 0x01, 0x15, 0x32, 0x34, 0x01, 0x12, 0xEB, 0x01, 0x62, 0x56, 0x01, 0x65, 0xC1, 0x01,
+    0x65, 0xC1, 0x62, 0x23, 0x27, 0x01, 0x5C, 0x84, 0x01, 0x4A, 0xAD, 0x61, 0x09, 0x01, 0x4A, 0x58,
+    0x21, 0x08, 0x05, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0xA1, 0x27, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x32, 0x03, 0xE3, 0x1E, 0x27, 0x2A, 0x01, 0x65, 0xAF, 0x00, 0x78, 0x09, 0x00,
+    0x00, 0x03, 0xE3, 0x32, 0x34, 0x4C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0D, 0x01, 0x66, 0x02, 0x62,
+    0x18, 0x31, 0x00, 0x00, 0x0D, 0x01, 0x52, 0x9B, 0x61, 0x2A, 0x01, 0x49, 0x97, 0xE3, 0x23, 0x27,
+    0x2A, 0x00, 0x00, 0x05, 0x01, 0x4A, 0xF8, 0x01, 0x65, 0x57, 0x62, 0x32, 0x35, 0x00, 0x00, 0x0D,
+    0x01, 0x66, 0x2A, 0xE2, 0x20, 0x28, 0x01, 0x25, 0x41, 0x01, 0x54, 0x15, 0xA1, 0x22, 0x09, 0xE4,
+    0x1E, 0x28, 0x35, 0x42, 0x01, 0x30, 0x7C, 0x00, 0xFA, 0x55, 0x00, 0x00, 0x03, 0x01, 0x46, 0x78,
+    0x21, 0x23, 0x11, 0x62, 0x02, 0x19, 0x01, 0x66, 0x53, 0x01, 0x46, 0x1D, 0x43, 0x17, 0x31, 0x34,
+    0x00, 0x0C, 0x00, 0x09, 0x95, 0xF2, 0x63, 0x14, 0x23, 0x34, 0x01, 0x65, 0xA0, 0x01, 0x0E, 0x70,
+    0x01, 0x66, 0x2D, 0x61, 0x32, 0x01, 0x45, 0xF1, 0x62, 0x31, 0x38, 0x00, 0xF0, 0x1C, 0x01, 0x64,
+    0xC6, 0x41, 0x32, 0x0A, 0xD1, 0xE4, 0x1A, 0x20, 0x23, 0x28, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04,
+    0x01, 0x3E, 0xA0, 0x01, 0x64, 0xD3, 0x21, 0x13, 0x11, 0x21, 0x23, 0x03, 0x62, 0x15, 0x28, 0x01,
+    0x66, 0x56, 0x00, 0xFA, 0x9D, 0x63, 0x1E, 0x23, 0x34, 0x01, 0x29, 0x3C, 0x00, 0x00, 0x0C, 0x00,
+    0x00, 0x09, 0xE1, 0x07, 0x01, 0x55, 0xF1, 0xE3, 0x1E, 0x23, 0x29, 0x00, 0x00, 0x05, 0x01, 0x14,
+    0x64, 0x01, 0x43, 0xDF, 0xE3, 0x23, 0x31, 0x32, 0x01, 0x66, 0xC4, 0x01, 0x53, 0xDA, 0x00, 0x00,
+    0x0D, 0xE3, 0x30, 0x31, 0x32, 0x01, 0x66, 0xD1, 0x01, 0x53, 0xB3, 0x01, 0x66, 0xD1, 0x62, 0x15,
+    0x25, 0x01, 0x66, 0x75, 0x01, 0x66, 0x18, 0xE7, 0x02, 0x17, 0x19, 0x22, 0x2B, 0x30, 0x32, 0x01,
+    0x61, 0x35, 0x01, 0x64, 0x6A, 0x00, 0x00, 0x16, 0x01, 0x33, 0xA9, 0x01, 0x65, 0xDE, 0x01, 0x66,
+    0xE7, 0x00, 0x00, 0x09, 0x62, 0x14, 0x16, 0x01, 0x66, 0x3E, 0x01, 0x67, 0x04, 0x61, 0x19, 0x01,
+    0x49, 0x1E, 0x21, 0x2B, 0x05, 0x21, 0x35, 0x03, 0x61, 0x27, 0x01, 0x31, 0xBE, 0x62, 0x15, 0x2A,
+    0x01, 0x52, 0x57, 0x00, 0x00, 0x05, 0x41, 0x32, 0x6A, 0xDC, 0x21, 0x19, 0x04, 0x21, 0x04, 0x03,
+    0x41, 0x4C, 0xCE, 0x89, 0x21, 0x23, 0x04, 0x21, 0x0E, 0x03, 0xE4, 0x07, 0x23, 0x25, 0x29, 0x00,
+    0x00, 0x0D, 0x01, 0x56, 0x72, 0x01, 0x4B, 0xB7, 0x00, 0x00, 0x03, 0x62, 0x17, 0x31, 0x01, 0x66,
+    0x58, 0x01, 0x65, 0x3C, 0x61, 0x32, 0x01, 0x4B, 0xFA, 0xEA, 0x01, 0x04, 0x07, 0x19, 0x21, 0x30,
+    0x31, 0x32, 0x38, 0x40, 0x00, 0x00, 0x05, 0x01, 0x18, 0xD2, 0x01, 0x67, 0x59, 0x01, 0x67, 0x59,
+    0x00, 0xD0, 0x92, 0x01, 0x67, 0x59, 0x01, 0x67, 0x20, 0x01, 0x67, 0x59, 0x01, 0x18, 0xB9, 0x01,
+    0x09, 0x29, 0x62, 0x19, 0x28, 0x01, 0x42, 0x1C, 0x01, 0x67, 0x82, 0x21, 0x22, 0x09, 0x64, 0x19,
+    0x22, 0x40, 0x42, 0x00, 0x00, 0x43, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x01, 0x66, 0xD3, 0x61,
+    0x23, 0x01, 0x40, 0x11, 0x21, 0x38, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x22, 0x03, 0x21, 0x48, 0x03,
+    0xEE, 0x04, 0x07, 0x1A, 0x20, 0x27, 0x28, 0x2A, 0x31, 0x32, 0x34, 0x35, 0x38, 0x40, 0x42, 0x01,
+    0x64, 0xA2, 0x01, 0x54, 0xEA, 0x00, 0x00, 0xAC, 0x00, 0x09, 0xC4, 0x01, 0x1B, 0xE5, 0x01, 0x43,
+    0x43, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x93, 0x00, 0x00, 0x76, 0x00, 0x00, 0x22, 0x01, 0x55, 0x48,
+    0x00, 0x00, 0x03, 0x01, 0x41, 0x17, 0x01, 0x4D, 0xED, 0x61, 0x15, 0x01, 0x1E, 0x70, 0x62, 0x35,
+    0x39, 0x01, 0x66, 0x3C, 0x01, 0x50, 0x97, 0x41, 0x07, 0x91, 0x20, 0x62, 0x34, 0x39, 0x00, 0x00,
+    0x04, 0x01, 0x2F, 0x25, 0xE8, 0x04, 0x1B, 0x1E, 0x20, 0x21, 0x27, 0x2A, 0x32, 0x00, 0x00, 0x16,
+    0x00, 0x91, 0x6A, 0x01, 0x4B, 0x21, 0x00, 0x00, 0x09, 0x01, 0x47, 0x82, 0x01, 0x4C, 0xD1, 0x00,
+    0x03, 0x12, 0x01, 0x4C, 0x9C, 0x21, 0x13, 0x21, 0x21, 0x23, 0x03, 0x61, 0x14, 0x01, 0x15, 0x2F,
+    0xA1, 0x19, 0x05, 0x21, 0x32, 0x03, 0x63, 0x0A, 0x19, 0x21, 0x00, 0x00, 0x03, 0x01, 0x4C, 0xB3,
+    0x01, 0x67, 0xD8, 0xE4, 0x20, 0x23, 0x32, 0x34, 0x01, 0x27, 0x51, 0x00, 0x00, 0x1B, 0x01, 0x68,
+    0x0A, 0x00, 0x00, 0x0D, 0x62, 0x31, 0x35, 0x01, 0x65, 0x46, 0x01, 0x67, 0xC3, 0x41, 0x48, 0xC4,
+    0x3E, 0x63, 0x19, 0x23, 0x24, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0x01, 0x66, 0x63, 0x62, 0x18,
+    0x23, 0x01, 0x68, 0x6E, 0x01, 0x65, 0x8A, 0x61, 0x07, 0x01, 0x36, 0x6F, 0x21, 0x31, 0x05, 0xA1,
+    0x27, 0x03, 0x21, 0x32, 0x03, 0x21, 0x48, 0x03, 0x21, 0x23, 0x03, 0x63, 0x21, 0x23, 0x2B, 0x00,
+    0x00, 0x1D, 0x01, 0x43, 0x21, 0x00, 0x00, 0x03, 0x62, 0x02, 0x19, 0x00, 0xD8, 0x6D, 0x01, 0x68,
+    0x97, 0x61, 0x32, 0x01, 0x33, 0x47, 0x61, 0x01, 0x01, 0x4E, 0xE3, 0x22, 0x1B, 0x42, 0x0A, 0x05,
+    0x21, 0x07, 0x05, 0x21, 0x2B, 0x03, 0xFC, 0x01, 0x02, 0x04, 0x07, 0x08, 0x0A, 0x0D, 0x13, 0x14,
+    0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x2B, 0x40,
+    0x42, 0x44, 0x48, 0x00, 0x04, 0x63, 0x00, 0x03, 0xF9, 0x00, 0x03, 0xA1, 0x00, 0x03, 0x8F, 0x00,
+    0x03, 0x81, 0x00, 0x03, 0x6B, 0x00, 0x03, 0x62, 0x00, 0x03, 0x55, 0x00, 0x03, 0x2A, 0x00, 0x02,
+    0xF5, 0x00, 0x02, 0xA7, 0x00, 0x02, 0x8C, 0x00, 0x02, 0x5A, 0x00, 0x02, 0x50, 0x00, 0x02, 0x43,
+    0x00, 0x02, 0x11, 0x00, 0x01, 0xF2, 0x00, 0x01, 0xCF, 0x00, 0x01, 0x06, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x73, 0x00, 0x79, 0x20, 0x01, 0x68, 0x5B, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x03, 0x01, 0x66, 0xA7, 0x62, 0x38, 0x48, 0x01, 0x68, 0xD8, 0x01, 0x69, 0x1D,
+    0x62, 0x19, 0x21, 0x01, 0x4E, 0xC2, 0x01, 0x64, 0xDE, 0xE3, 0x04, 0x2A, 0x40, 0x01, 0x66, 0xA9,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xE1, 0x1A, 0x01, 0x68, 0x8E, 0x63, 0x01, 0x19, 0x34, 0x01,
+    0x65, 0xE0, 0x01, 0x65, 0xE0, 0x00, 0x00, 0x05, 0xE4, 0x01, 0x1A, 0x28, 0x41, 0x01, 0x4E, 0x64,
+    0x01, 0x68, 0xA0, 0x01, 0x57, 0x3A, 0x01, 0x16, 0xC5, 0xC2, 0x23, 0x34, 0x1E, 0xB3, 0x00, 0x11,
+    0xE2, 0x22, 0x34, 0x01, 0x5A, 0x03, 0x01, 0x69, 0x70, 0xE4, 0x02, 0x23, 0x2A, 0x2B, 0x01, 0x69,
+    0x24, 0x01, 0x33, 0x3D, 0x01, 0x67, 0x6A, 0x01, 0x69, 0x13, 0xEF, 0x01, 0x07, 0x08, 0x0D, 0x14,
+    0x15, 0x17, 0x19, 0x1A, 0x1B, 0x23, 0x2A, 0x40, 0x48, 0x49, 0x01, 0x59, 0x33, 0x00, 0x00, 0x51,
+    0x00, 0x00, 0x3F, 0x01, 0x10, 0x82, 0x01, 0x69, 0x8A, 0x00, 0x00, 0x21, 0x01, 0x69, 0x8A, 0x00,
+    0x68, 0x62, 0x01, 0x69, 0x8A, 0x01, 0x61, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x68, 0xC4, 0x01, 0x35,
+    0x69, 0x00, 0x00, 0x11, 0x01, 0x69, 0x8A, 0xC1, 0x19, 0x7C, 0x80, 0x62, 0x15, 0x25, 0x00, 0x00,
+    0x04, 0x01, 0x69, 0xCB, 0x61, 0x34, 0x01, 0x16, 0x2E, 0x21, 0x23, 0x05, 0x63, 0x22, 0x2D, 0x47,
+    0x01, 0x69, 0xC0, 0x00, 0x00, 0x03, 0x01, 0x69, 0xDB, 0x61, 0x04, 0x01, 0x69, 0xD6, 0x21, 0x42,
+    0x05, 0x21, 0x2A, 0x03, 0x21, 0x23, 0x03, 0x21, 0x17, 0x03, 0xE2, 0x15, 0x42, 0x01, 0x44, 0xD5,
+    0x00, 0x00, 0x03, 0x41, 0x0A, 0xCF, 0x2D, 0x21, 0x14, 0x04, 0x61, 0x4C, 0x01, 0x30, 0xB9, 0x21,
+    0x23, 0x05, 0x21, 0x32, 0x03, 0x21, 0x0B, 0x03, 0x64, 0x01, 0x19, 0x23, 0x2A, 0x00, 0x00, 0x1E,
+    0x01, 0x6A, 0x18, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x23, 0x01, 0x15, 0x1B, 0x5E, 0x4D, 0x11,
+    0xE1, 0x40, 0x01, 0x1A, 0xA3, 0x21, 0x19, 0x05, 0x61, 0x1E, 0x01, 0x32, 0xEC, 0x21, 0x42, 0x05,
+    0x62, 0x32, 0x4C, 0x01, 0x30, 0x4F, 0x01, 0x6A, 0x40, 0x63, 0x14, 0x25, 0x44, 0x00, 0x00, 0x09,
+    0x01, 0x37, 0x24, 0x01, 0x5D, 0x20, 0x21, 0x19, 0x0D, 0x65, 0x01, 0x04, 0x15, 0x1B, 0x25, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x01, 0x68, 0x4A, 0x01, 0x6A, 0x4F, 0x61, 0x34,
+    0x01, 0x06, 0x60, 0x42, 0x1B, 0x40, 0x00, 0x05, 0x64, 0x90, 0x62, 0x04, 0x4C, 0x01, 0x6A, 0x7A,
+    0x01, 0x6A, 0x7A, 0x21, 0x23, 0x09, 0x62, 0x18, 0x2A, 0x01, 0x6A, 0x2B, 0x01, 0x6A, 0x40, 0x42,
+    0x40, 0x41, 0x46, 0x3B, 0xE6, 0x79, 0x66, 0x01, 0x04, 0x15, 0x21, 0x23, 0x25, 0x00, 0x00, 0x23,
+    0x01, 0x6A, 0x83, 0x00, 0x00, 0x13, 0x00, 0x00, 0x10, 0x01, 0x4D, 0xDE, 0x00, 0x00, 0x07, 0xC1,
+    0x0A, 0xCF, 0xD9, 0x21, 0x4C, 0x04, 0x21, 0x25, 0x03, 0x61, 0x25, 0x01, 0x45, 0x98, 0x21, 0x25,
+    0x05, 0x21, 0x34, 0x03, 0x21, 0x23, 0x03, 0x64, 0x15, 0x1A, 0x1B, 0x25, 0x00, 0x00, 0x11, 0x01,
+    0x6A, 0xC7, 0x00, 0x00, 0x03, 0x01, 0x5A, 0xAE, 0x61, 0x14, 0x01, 0x4E, 0x20, 0xE4, 0x14, 0x15,
+    0x25, 0x40, 0x01, 0x60, 0x9D, 0x01, 0x69, 0xD4, 0x01, 0x63, 0xEF, 0x00, 0x00, 0x05, 0xE2, 0x25,
+    0x2A, 0x01, 0x6A, 0x9F, 0x01, 0x6A, 0x9C, 0x62, 0x19, 0x22, 0x00, 0x00, 0x09, 0x01, 0x6A, 0xF7,
+    0xE1, 0x14, 0x01, 0x4E, 0xF2, 0xE3, 0x07, 0x19, 0x41, 0x00, 0x00, 0x05, 0x01, 0x6B, 0x05, 0x00,
+    0x36, 0xDA, 0x61, 0x2B, 0x01, 0x27, 0x61, 0xE5, 0x19, 0x22, 0x2B, 0x40, 0x44, 0x01, 0x6B, 0x17,
+    0x01, 0x6B, 0x17, 0x01, 0x69, 0x65, 0x00, 0x00, 0x05, 0x01, 0x35, 0x08, 0x65, 0x07, 0x27, 0x2D,
+    0x32, 0x33, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x35, 0x00, 0x00, 0x27, 0x00, 0x00, 0x15, 0x01, 0x6B,
+    0x2C, 0xE1, 0x15, 0x01, 0x49, 0xC8, 0xE4, 0x15, 0x17, 0x1B, 0x1F, 0x01, 0x64, 0x58, 0x01, 0x5D,
+    0x65, 0x01, 0x41, 0x41, 0x01, 0x44, 0xC3, 0x65, 0x19, 0x21, 0x27, 0x2D, 0x32, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x11, 0x00, 0xF7, 0xF9, 0x01, 0x5F, 0xC5, 0x01, 0x5F, 0xB8, 0x7F, 0x2A, 0x01, 0x02,
+    0x04, 0x07, 0x08, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x40, 0x41, 0x42, 0x44, 0x48, 0x49, 0x00, 0x25, 0xA5, 0x01, 0x68, 0x01, 0x00, 0x25,
+    0x59, 0x00, 0x24, 0xF7, 0x00, 0x24, 0xC5, 0x01, 0x6B, 0x4D, 0x00, 0x24, 0xBA, 0x00, 0x23, 0xC5,
+    0x00, 0x23, 0x03, 0x00, 0x22, 0xDA, 0x00, 0x22, 0xCD, 0x00, 0x21, 0xDD, 0x00, 0x21, 0x9B, 0x00,
+    0x21, 0x24, 0x00, 0x21, 0x06, 0x00, 0x20, 0xF6, 0x00, 0x20, 0xB9, 0x00, 0x1E, 0x31, 0x00, 0x1D,
+    0x5C, 0x00, 0x1B, 0xE5, 0x00, 0x1B, 0x7B, 0x00, 0x1A, 0xFC, 0x00, 0x19, 0x2F, 0x00, 0x18, 0xE6,
+    0x00, 0x18, 0x67, 0x00, 0x17, 0xC9, 0x00, 0x15, 0xCF, 0x00, 0x10, 0x58, 0x00, 0x0C, 0x2C, 0x00,
+    0x0A, 0x7B, 0x00, 0x08, 0x81, 0x00, 0x07, 0xBE, 0x00, 0x07, 0x68, 0x00, 0x07, 0x31, 0x00, 0x02,
+    0xB6, 0x00, 0x01, 0xE2, 0x00, 0x01, 0x43, 0x00, 0x01, 0x13, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xA5,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x15, 0x61, 0x27, 0x01, 0x3D, 0x19, 0xE5, 0x04, 0x1A, 0x25, 0x2B,
+    0x42, 0x00, 0x00, 0x05, 0x01, 0x6A, 0x1D, 0x01, 0x63, 0xF6, 0x01, 0x6B, 0x19, 0x01, 0x52, 0x17,
+    0x61, 0x2D, 0x01, 0x59, 0x93, 0x21, 0x4C, 0x05, 0x62, 0x16, 0x32, 0x01, 0x6C, 0x38, 0x01, 0x4F,
+    0x80, 0xE4, 0x04, 0x1A, 0x23, 0x4C, 0x01, 0x47, 0x65, 0x01, 0x4E, 0x52, 0x00, 0x00, 0x09, 0x01,
+    0x6C, 0x41, 0xE1, 0x40, 0x01, 0x22, 0x9A, 0xE4, 0x01, 0x14, 0x19, 0x22, 0x01, 0x6C, 0x57, 0x01,
+    0x6C, 0x57, 0x01, 0x6C, 0x57, 0x00, 0x00, 0x05, 0x62, 0x01, 0x1A, 0x01, 0x46, 0xD4, 0x01, 0x30,
+    0x41, 0x63, 0x01, 0x07, 0x21, 0x01, 0x6C, 0x71, 0x01, 0x46, 0xDD, 0x01, 0x6C, 0x71, 0x61, 0x01,
+    0x01, 0x46, 0xEA, 0x61, 0x07, 0x01, 0x68, 0xA1, 0x21, 0x2B, 0x05, 0x61, 0x07, 0x01, 0x67, 0x60,
+    0x21, 0x2B, 0x05, 0x64, 0x07, 0x14, 0x1A, 0x48, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x01, 0x6C,
+    0x93, 0x01, 0x6B, 0xD8, 0x63, 0x07, 0x21, 0x22, 0x01, 0x30, 0x7D, 0x01, 0x6C, 0xA4, 0x01, 0x6C,
+    0xA4, 0x62, 0x2D, 0x32, 0x00, 0x00, 0x0D, 0x01, 0x51, 0x3F, 0xEB, 0x01, 0x29, 0x2A, 0x2D, 0x31,
+    0x32, 0x33, 0x34, 0x36, 0x38, 0x48, 0x01, 0x47, 0x26, 0x00, 0x00, 0x85, 0x00, 0x00, 0x79, 0x00,
+    0x00, 0x63, 0x00, 0x00, 0x52, 0x01, 0x6B, 0xFF, 0x01, 0x6C, 0xBA, 0x00, 0x00, 0x49, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0x27, 0x00, 0x00, 0x09, 0x61, 0x23, 0x01, 0x4F, 0x4D, 0xA1, 0x1D, 0x05, 0x21,
+    0x32, 0x03, 0x62, 0x34, 0x49, 0x01, 0x40, 0xC0, 0x00, 0x00, 0x03, 0xE1, 0x2B, 0x01, 0x6C, 0x3D,
+    0x62, 0x22, 0x31, 0x01, 0x6D, 0x00, 0x01, 0x6C, 0x45, 0x62, 0x01, 0x14, 0x00, 0xEE, 0x7D, 0x01,
+    0x6D, 0x09, 0x41, 0x07, 0xD5, 0x9A, 0x62, 0x35, 0x38, 0x01, 0x6C, 0x85, 0x00, 0x00, 0x04, 0x41,
+    0x2B, 0xF1, 0xCE, 0x21, 0x32, 0x04, 0x62, 0x2D, 0x34, 0x01, 0x6D, 0x25, 0x01, 0x6D, 0x25, 0x41,
+    0x33, 0xC0, 0x2E, 0xE2, 0x25, 0x41, 0x00, 0x00, 0x04, 0x01, 0x3C, 0xA4, 0x21, 0x27, 0x09, 0x21,
+    0x31, 0x03, 0x41, 0x27, 0xD1, 0x4D, 0x21, 0x31, 0x04, 0x41, 0x2D, 0xDB, 0xDA, 0x41, 0x1B, 0x19,
+    0xE4, 0x21, 0x32, 0x04, 0x21, 0x49, 0x03, 0x62, 0x0D, 0x32, 0x00, 0x00, 0x03, 0x01, 0x6D, 0x1E,
+    0x62, 0x23, 0x2A, 0x01, 0x6B, 0x14, 0x01, 0x6B, 0x14, 0x63, 0x02, 0x04, 0x0B, 0x01, 0x6B, 0x5A,
+    0x01, 0x6D, 0x69, 0x01, 0x6D, 0x5F, 0x62, 0x19, 0x2B, 0x01, 0x6D, 0x76, 0x01, 0x3B, 0x75, 0xEF,
+    0x01, 0x02, 0x04, 0x08, 0x09, 0x1A, 0x1E, 0x27, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x5C, 0x01, 0x6B, 0x55, 0x00, 0x00, 0x59, 0x01, 0x6D, 0x72, 0x00, 0x00,
+    0x40, 0x01, 0x63, 0x3F, 0x00, 0x00, 0x39, 0x00, 0x00, 0x36, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x16, 0x01, 0x32, 0x43, 0x00, 0x00, 0x09, 0x01, 0x3A, 0x4A, 0xE1, 0x01, 0x01, 0x6D,
+    0x67, 0xE3, 0x01, 0x07, 0x19, 0x01, 0x6D, 0xC1, 0x00, 0x00, 0x42, 0x00, 0x00, 0x05, 0xE2, 0x2D,
+    0x43, 0x01, 0x6D, 0xCD, 0x01, 0x6B, 0x9D, 0x61, 0x21, 0x01, 0x08, 0xDB, 0x21, 0x34, 0x05, 0x61,
+    0x17, 0x01, 0x6D, 0xD2, 0x21, 0x19, 0x05, 0x21, 0x34, 0x03, 0x21, 0x14, 0x03, 0xA2, 0x1E, 0x40,
+    0x11, 0x03, 0x21, 0x2D, 0x05, 0x21, 0x37, 0x03, 0xA1, 0x2A, 0x03, 0x64, 0x01, 0x07, 0x1A, 0x48,
+    0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0x01, 0x6D, 0xFB, 0x01, 0x6D, 0xC2, 0xE7, 0x14, 0x15, 0x19,
+    0x1A, 0x21, 0x27, 0x2B, 0x01, 0x6E, 0x0C, 0x01, 0x6D, 0xA6, 0x01, 0x6E, 0x0C, 0x01, 0x6E, 0x0C,
+    0x01, 0x6E, 0x0C, 0x01, 0x3B, 0x4B, 0x01, 0x6D, 0xF3, 0x41, 0x49, 0xB1, 0x2B, 0x21, 0x35, 0x04,
+    0x21, 0x25, 0x03, 0xE3, 0x0B, 0x40, 0x43, 0x01, 0x4D, 0x93, 0x00, 0x00, 0x03, 0x01, 0x6C, 0x02,
+    0xE2, 0x1A, 0x49, 0x01, 0x6E, 0x40, 0x01, 0x6E, 0x40, 0xE4, 0x19, 0x1A, 0x21, 0x48, 0x01, 0x6E,
+    0x49, 0x01, 0x6E, 0x49, 0x01, 0x6D, 0xEE, 0x01, 0x28, 0xDF, 0x41, 0x41, 0x19, 0xCB, 0x21, 0x22,
+    0x04, 0x21, 0x2D, 0x03, 0x41, 0x23, 0xCF, 0x0E, 0x21, 0x32, 0x04, 0xE2, 0x01, 0x14, 0x01, 0x4B,
+    0x93, 0x00, 0x00, 0x03, 0x62, 0x07, 0x22, 0x01, 0x6E, 0x74, 0x00, 0x00, 0x09, 0x63, 0x27, 0x2D,
+    0x32, 0x00, 0x00, 0x09, 0x01, 0x1F, 0x3E, 0x01, 0x62, 0xDE, 0x62, 0x32, 0x48, 0x01, 0x6E, 0x8A,
+    0x01, 0x6E, 0x7D, 0x41, 0x30, 0xF5, 0x29, 0x21, 0x23, 0x04, 0xEA, 0x01, 0x02, 0x07, 0x15, 0x17,
+    0x1C, 0x1E, 0x2D, 0x41, 0x44, 0x01, 0x6E, 0x96, 0x01, 0x6E, 0x34, 0x01, 0x6E, 0x45, 0x00, 0x00,
+    0x10, 0x01, 0x6D, 0x9B, 0x01, 0x6E, 0x34, 0x00, 0x00, 0x03, 0x01, 0x6E, 0x99, 0x01, 0x6E, 0x90,
+    0x01, 0x59, 0x24, 0x21, 0x32, 0x29, 0xEE, 0x17, 0x27, 0x2D, 0x31, 0x32, 0x33, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x47, 0x48, 0x49, 0x01, 0x6E, 0xB9, 0x00, 0x01, 0xBD, 0x00, 0x01, 0x05, 0x00, 0x00,
+    0xCB, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x93, 0x00, 0x00, 0x86, 0x01, 0x67, 0xF9, 0x01, 0x6E, 0x77,
+    0x00, 0x00, 0x7D, 0x01, 0x3B, 0xFD, 0x00, 0x00, 0x65, 0x00, 0x00, 0x49, 0x00, 0x00, 0x03, 0xE1,
+    0x21, 0x01, 0x04, 0x53, 0x62, 0x31, 0x39, 0x01, 0x6D, 0xFF, 0x01, 0x6E, 0xB5, 0x62, 0x01, 0x38,
+    0x01, 0x6F, 0x0D, 0x01, 0x6F, 0x03, 0xE8, 0x01, 0x08, 0x15, 0x1A, 0x1E, 0x23, 0x2D, 0x40, 0x01,
+    0x6E, 0x14, 0x01, 0x6E, 0xC7, 0x00, 0x00, 0x12, 0x01, 0x28, 0x8F, 0x00, 0x00, 0x09, 0x01, 0x6F,
+    0x00, 0x01, 0x08, 0x9F, 0x01, 0x40, 0x89, 0xE1, 0x40, 0x01, 0x32, 0x61, 0x62, 0x01, 0x14, 0x00,
+    0x00, 0x05, 0x01, 0x6F, 0x3C, 0x61, 0x21, 0x01, 0x6F, 0x38, 0xE2, 0x2B, 0x43, 0x00, 0x00, 0x05,
+    0x01, 0x6D, 0x19, 0xE1, 0x49, 0x01, 0x6F, 0x46, 0xA1, 0x02, 0x05, 0x61, 0x25, 0x01, 0x57, 0x6B,
+    0x62, 0x17, 0x2B, 0x01, 0x6E, 0xDB, 0x00, 0x00, 0x05, 0xEC, 0x01, 0x07, 0x0A, 0x14, 0x15, 0x19,
+    0x1A, 0x1C, 0x22, 0x25, 0x40, 0x44, 0x01, 0x6F, 0x69, 0x00, 0x00, 0x1F, 0x01, 0x4C, 0x91, 0x01,
+    0x6F, 0x50, 0x01, 0x54, 0xE5, 0x00, 0x00, 0x11, 0x01, 0x6F, 0x69, 0x01, 0x6E, 0xA3, 0x01, 0x6F,
+    0x69, 0x01, 0x68, 0x7B, 0x00, 0x00, 0x09, 0x01, 0x4F, 0xC7, 0xE1, 0x2B, 0x01, 0x65, 0xBA, 0x66,
+    0x01, 0x14, 0x19, 0x1A, 0x48, 0x49, 0x00, 0x00, 0x05, 0x01, 0x6F, 0x9F, 0x01, 0x6F, 0x9F, 0x01,
+    0x6F, 0x9F, 0x01, 0x6F, 0x66, 0x01, 0x6F, 0x66, 0xE2, 0x2A, 0x2E, 0x01, 0x6F, 0xAE, 0x01, 0x4E,
+    0xFD, 0x61, 0x08, 0x01, 0x65, 0x81, 0x21, 0x07, 0x05, 0x21, 0x49, 0x03, 0x21, 0x34, 0x03, 0x62,
+    0x25, 0x2B, 0x01, 0x6E, 0x47, 0x01, 0x25, 0x48, 0xE6, 0x01, 0x04, 0x15, 0x22, 0x40, 0x43, 0x01,
+    0x6F, 0xD8, 0x00, 0xE9, 0x88, 0x01, 0x6F, 0x72, 0x01, 0x6F, 0x72, 0x00, 0x00, 0x09, 0x01, 0x6D,
+    0xA7, 0xEA, 0x01, 0x07, 0x08, 0x14, 0x1A, 0x1B, 0x22, 0x23, 0x43, 0x44, 0x00, 0x00, 0x39, 0x01,
+    0x3D, 0x30, 0x00, 0x00, 0x25, 0x01, 0x6F, 0xF1, 0x01, 0x6B, 0x2F, 0x01, 0x6D, 0x61, 0x00, 0x00,
+    0x19, 0x01, 0x6D, 0x61, 0x01, 0x6F, 0xB8, 0x01, 0x5C, 0x89, 0xE1, 0x40, 0x01, 0x62, 0xB2, 0x21,
+    0x19, 0x05, 0x21, 0x48, 0x03, 0xE1, 0x40, 0x01, 0x6F, 0xB3, 0xE1, 0x2B, 0x01, 0x43, 0xC5, 0x64,
+    0x14, 0x19, 0x1A, 0x48, 0x01, 0x70, 0x2F, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0x6F, 0x74,
+    0x62, 0x22, 0x31, 0x01, 0x6F, 0x34, 0x01, 0x70, 0x07, 0x63, 0x14, 0x19, 0x2E, 0x01, 0x70, 0x3F,
+    0x01, 0x6E, 0x3A, 0x01, 0x6E, 0x3A, 0xE1, 0x1A, 0x01, 0x6C, 0x78, 0xE7, 0x19, 0x1B, 0x22, 0x2A,
+    0x2B, 0x41, 0x48, 0x01, 0x4F, 0xBB, 0x01, 0x6D, 0xCB, 0x01, 0x70, 0x06, 0x00, 0x6E, 0x68, 0x00,
+    0x00, 0x1B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0xC1, 0x2B, 0x46, 0xAB, 0xC1, 0x41, 0xA0, 0x4E,
+    0xE3, 0x07, 0x19, 0x21, 0x01, 0x70, 0x80, 0x01, 0x70, 0x80, 0x00, 0x00, 0x04, 0x64, 0x19, 0x2D,
+    0x32, 0x33, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0D, 0x01, 0x70, 0x8D, 0x01, 0x70, 0x8D, 0x41, 0x07,
+    0xC4, 0xD7, 0x21, 0x25, 0x04, 0x21, 0x1B, 0x03, 0xA1, 0x41, 0x03, 0x62, 0x2D, 0x32, 0x00, 0x00,
+    0x03, 0x01, 0x21, 0x6C, 0x6E, 0x01, 0x14, 0x27, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x48, 0x49, 0x00, 0x01, 0xB5, 0x00, 0x01, 0x9E, 0x00, 0x01, 0x78, 0x00, 0x01, 0x4B, 0x00,
+    0x01, 0x15, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x92, 0x01, 0x5A, 0xAE, 0x01, 0x70, 0xB3, 0x00, 0xFF,
+    0xC9, 0x00, 0x00, 0x85, 0x00, 0x00, 0x59, 0x00, 0x00, 0x27, 0x00, 0x00, 0x09, 0xE1, 0x42, 0x01,
+    0x3E, 0xB8, 0x63, 0x01, 0x19, 0x1A, 0x01, 0x70, 0xF2, 0x00, 0x00, 0x05, 0x01, 0x70, 0xF2, 0x61,
+    0x2D, 0x01, 0x56, 0x91, 0xA1, 0x40, 0x05, 0x65, 0x01, 0x07, 0x14, 0x19, 0x22, 0x00, 0x00, 0x03,
+    0x01, 0x71, 0x07, 0x01, 0x71, 0x07, 0x01, 0x71, 0x07, 0x01, 0x71, 0x07, 0x66, 0x01, 0x07, 0x14,
+    0x19, 0x1A, 0x48, 0x00, 0x17, 0x6C, 0x01, 0x71, 0x1C, 0x01, 0x71, 0x1C, 0x01, 0x71, 0x1C, 0x01,
+    0x71, 0x1C, 0x01, 0x71, 0x12, 0x41, 0x44, 0x71, 0xCD, 0x61, 0x33, 0x01, 0x36, 0xEF, 0x21, 0x49,
+    0x05, 0xA1, 0x19, 0x03, 0x66, 0x01, 0x07, 0x14, 0x1A, 0x21, 0x27, 0x00, 0x00, 0x0F, 0x01, 0x71,
+    0x44, 0x00, 0x00, 0x03, 0x01, 0x71, 0x44, 0x01, 0x71, 0x44, 0x01, 0x71, 0x44, 0x61, 0x40, 0x01,
+    0x71, 0x4A, 0x65, 0x01, 0x19, 0x1A, 0x21, 0x48, 0x01, 0x71, 0x62, 0x01, 0x71, 0x62, 0x00, 0x7C,
+    0xB4, 0x01, 0x4B, 0xCE, 0x01, 0x71, 0x58, 0x61, 0x22, 0x01, 0x6E, 0x8F, 0x21, 0x2B, 0x05, 0x61,
+    0x22, 0x01, 0x2D, 0x77, 0x21, 0x2B, 0x05, 0xE5, 0x01, 0x14, 0x1A, 0x21, 0x48, 0x00, 0x00, 0x0B,
+    0x01, 0x71, 0x87, 0x01, 0x4B, 0xF3, 0x00, 0x00, 0x03, 0x01, 0x71, 0x4E, 0x61, 0x01, 0x01, 0x5F,
+    0xD2, 0x61, 0x22, 0x01, 0x59, 0xB1, 0x21, 0x2B, 0x05, 0x21, 0x41, 0x03, 0x21, 0x07, 0x03, 0x21,
+    0x2D, 0x03, 0x64, 0x07, 0x19, 0x21, 0x22, 0x01, 0x4C, 0x1E, 0x01, 0x71, 0xB2, 0x01, 0x71, 0xB2,
+    0x01, 0x71, 0xB2, 0xE1, 0x19, 0x01, 0x6F, 0xB4, 0x64, 0x07, 0x27, 0x2D, 0x32, 0x01, 0x71, 0xC8,
+    0x01, 0x71, 0x8F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x05, 0x6E, 0x01, 0x14, 0x27, 0x2D, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x38, 0x39, 0x47, 0x48, 0x49, 0x01, 0x4C, 0x45, 0x01, 0x71, 0xD9, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x95, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x77,
+    0x01, 0x5B, 0xD3, 0x00, 0x00, 0x52, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x11, 0x01,
+    0x55, 0xCB, 0x62, 0x32, 0x35, 0x01, 0x71, 0xB4, 0x01, 0x72, 0x12, 0xE2, 0x01, 0x22, 0x01, 0x72,
+    0x1B, 0x01, 0x35, 0xF4, 0x62, 0x1A, 0x2A, 0x01, 0x35, 0xFD, 0x01, 0x71, 0x1F, 0xE1, 0x01, 0x01,
+    0x71, 0x67, 0xE3, 0x13, 0x15, 0x48, 0x01, 0x6E, 0xC7, 0x00, 0x00, 0x05, 0x00, 0xE7, 0x0A, 0x62,
+    0x14, 0x48, 0x01, 0x72, 0x3F, 0x01, 0x72, 0x3F, 0x63, 0x23, 0x2B, 0x46, 0x01, 0x26, 0xFA, 0x00,
+    0x5B, 0x3E, 0x01, 0x72, 0x48, 0x62, 0x1A, 0x48, 0x00, 0x00, 0x0D, 0x01, 0x70, 0x46, 0xE1, 0x2B,
+    0x01, 0x71, 0xF5, 0x61, 0x21, 0x01, 0x5A, 0x46, 0x21, 0x2D, 0x05, 0x6E, 0x04, 0x13, 0x14, 0x1A,
+    0x23, 0x2D, 0x31, 0x32, 0x34, 0x35, 0x37, 0x38, 0x39, 0x47, 0x01, 0x61, 0xB3, 0x01, 0x72, 0x6B,
+    0x00, 0x00, 0x59, 0x01, 0x36, 0x44, 0x01, 0x52, 0xA8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x47, 0x01,
+    0x72, 0x6B, 0x00, 0x00, 0x39, 0x00, 0x00, 0x2C, 0x01, 0x72, 0x16, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0x0D, 0x00, 0x00, 0x03, 0x62, 0x22, 0x31, 0x01, 0x63, 0x37, 0x01, 0x71, 0xE9, 0x61, 0x23, 0x01,
+    0x61, 0xEC, 0x21, 0x23, 0x05, 0x61, 0x2B, 0x01, 0x72, 0x66, 0x44, 0x17, 0x29, 0x2B, 0x42, 0x00,
+    0x16, 0x88, 0xFD, 0x00, 0x08, 0x00, 0x05, 0x62, 0x21, 0x37, 0x01, 0x72, 0xC7, 0x01, 0x70, 0xB8,
+    0xE4, 0x01, 0x15, 0x25, 0x43, 0x01, 0x72, 0x72, 0x01, 0x72, 0x6A, 0x00, 0x00, 0x09, 0x01, 0x45,
+    0x42, 0xE3, 0x15, 0x1D, 0x21, 0x01, 0x72, 0x7B, 0x01, 0x72, 0xDD, 0x01, 0x70, 0x64, 0xE2, 0x25,
+    0x2D, 0x01, 0x70, 0xDF, 0x00, 0xDD, 0x1D, 0xE2, 0x25, 0x40, 0x00, 0x15, 0x02, 0x01, 0x44, 0xCC,
+    0xE4, 0x01, 0x14, 0x19, 0x21, 0x01, 0x73, 0x00, 0x00, 0x00, 0x12, 0x01, 0x73, 0x00, 0x00, 0x00,
+    0x09, 0x41, 0x32, 0x92, 0xDF, 0x21, 0x25, 0x04, 0xA1, 0x1E, 0x03, 0x21, 0x48, 0x03, 0x62, 0x35,
+    0x39, 0x00, 0x00, 0x03, 0x01, 0x72, 0x69, 0xE3, 0x15, 0x2A, 0x40, 0x01, 0x72, 0xD2, 0x00, 0x00,
+    0x09, 0x01, 0x27, 0x4A, 0xE2, 0x04, 0x2A, 0x01, 0x61, 0x85, 0x01, 0x67, 0x61, 0xE3, 0x15, 0x19,
+    0x43, 0x01, 0x61, 0x8E, 0x01, 0x73, 0x3C, 0x01, 0x73, 0x04, 0x66, 0x01, 0x07, 0x14, 0x1A, 0x27,
+    0x48, 0x00, 0x00, 0x23, 0x00, 0x00, 0x16, 0x01, 0x4D, 0xB6, 0x00, 0x00, 0x0D, 0x01, 0x73, 0x4A,
+    0x01, 0x6C, 0xC0, 0xE1, 0x08, 0x01, 0x6C, 0x75, 0xE8, 0x01, 0x17, 0x19, 0x1A, 0x21, 0x22, 0x27,
+    0x2B, 0x01, 0x40, 0xA7, 0x01, 0x73, 0x68, 0x00, 0x82, 0xB6, 0x00, 0x00, 0x05, 0x01, 0x73, 0x68,
+    0x01, 0x73, 0x68, 0x01, 0x73, 0x68, 0x01, 0x73, 0x0A, 0x66, 0x01, 0x17, 0x19, 0x21, 0x27, 0x48,
+    0x01, 0x73, 0x89, 0x01, 0x73, 0x89, 0x01, 0x73, 0x89, 0x01, 0x73, 0x89, 0x01, 0x73, 0x89, 0x01,
+    0x58, 0x17, 0xE4, 0x01, 0x1A, 0x2E, 0x42, 0x01, 0x73, 0xA2, 0x01, 0x73, 0xA2, 0x01, 0x48, 0x7A,
+    0x01, 0x73, 0xA1, 0x62, 0x2D, 0x35, 0x01, 0x73, 0xB3, 0x01, 0x73, 0xB3, 0xA1, 0x1E, 0x09, 0x65,
+    0x01, 0x14, 0x19, 0x1A, 0x21, 0x01, 0x5B, 0x78, 0x01, 0x73, 0xBF, 0x01, 0x37, 0x98, 0x01, 0x73,
+    0xBF, 0x00, 0x00, 0x03, 0xE2, 0x2A, 0x40, 0x01, 0x4D, 0x51, 0x01, 0x25, 0x5B, 0x63, 0x19, 0x21,
+    0x2D, 0x01, 0x73, 0xDD, 0x00, 0x00, 0x09, 0x01, 0x5A, 0x6E, 0xF1, 0x07, 0x14, 0x19, 0x1A, 0x27,
+    0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x37, 0x38, 0x39, 0x47, 0x48, 0x49, 0x00, 0x01, 0x1A, 0x01,
+    0x73, 0xEA, 0x01, 0x73, 0xEA, 0x00, 0x01, 0x09, 0x01, 0x68, 0x58, 0x00, 0x00, 0xEA, 0x01, 0x73,
+    0xEA, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x82, 0x00, 0x00, 0x61, 0x00, 0x00, 0x48, 0x01, 0x6F, 0xD2,
+    0x00, 0x00, 0x2B, 0x01, 0x73, 0x59, 0x01, 0x6E, 0x38, 0x00, 0x00, 0x0D, 0x01, 0x73, 0x84, 0xE1,
+    0x23, 0x01, 0x40, 0x55, 0x64, 0x07, 0x14, 0x27, 0x48, 0x01, 0x74, 0x34, 0x01, 0x74, 0x34, 0x00,
+    0x00, 0x05, 0x01, 0x73, 0xFB, 0x61, 0x41, 0x01, 0x6C, 0x63, 0x21, 0x30, 0x05, 0xE4, 0x23, 0x2B,
+    0x40, 0x44, 0x00, 0x00, 0x03, 0x01, 0x27, 0x1C, 0x00, 0x24, 0xDA, 0x01, 0x15, 0xCA, 0xE5, 0x01,
+    0x14, 0x19, 0x21, 0x22, 0x01, 0x74, 0x5E, 0x00, 0x00, 0x11, 0x01, 0x74, 0x5E, 0x01, 0x74, 0x5E,
+    0x01, 0x74, 0x5E, 0xE2, 0x14, 0x48, 0x01, 0x74, 0x73, 0x01, 0x74, 0x73, 0x41, 0x2B, 0xF2, 0x5C,
+    0x62, 0x14, 0x21, 0x00, 0x00, 0x04, 0x01, 0x74, 0x80, 0x61, 0x22, 0x01, 0x4E, 0xF5, 0x21, 0x2D,
+    0x05, 0x41, 0x32, 0x8B, 0xB3, 0x71, 0x07, 0x14, 0x19, 0x22, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x37, 0x38, 0x39, 0x47, 0x48, 0x49, 0x01, 0x27, 0xDF, 0x01, 0x74, 0x95, 0x01, 0x74, 0x95,
+    0x01, 0x74, 0x95, 0x01, 0x5D, 0xC1, 0x01, 0x74, 0x95, 0x00, 0x00, 0x61, 0x00, 0x00, 0x37, 0x01,
+    0x74, 0x95, 0x01, 0x19, 0x8C, 0x00, 0x00, 0x22, 0x01, 0x74, 0x40, 0x00, 0x00, 0x15, 0x01, 0x74,
+    0x46, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x01, 0x74, 0x2F, 0x61, 0x32, 0x01, 0x0C, 0xAA, 0x21,
+    0x49, 0x05, 0x21, 0x04, 0x03, 0x21, 0x23, 0x03, 0xE2, 0x0B, 0x32, 0x01, 0x74, 0x96, 0x00, 0x00,
+    0x03, 0x62, 0x2D, 0x33, 0x01, 0x74, 0x36, 0x01, 0x74, 0xF1, 0xE4, 0x02, 0x22, 0x2B, 0x41, 0x01,
+    0x58, 0xEC, 0x01, 0x67, 0x19, 0x01, 0x69, 0x27, 0x01, 0x44, 0x6B, 0x41, 0x07, 0xED, 0xDA, 0x21,
+    0x48, 0x04, 0x21, 0x2B, 0x03, 0x21, 0x41, 0x03, 0x21, 0x14, 0x03, 0x21, 0x38, 0x03, 0x62, 0x21,
+    0x38, 0x00, 0x00, 0x03, 0x01, 0x60, 0xDC, 0xEB, 0x01, 0x04, 0x07, 0x19, 0x1A, 0x1E, 0x21, 0x22,
+    0x27, 0x2A, 0x44, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x36, 0x01, 0x75, 0x27, 0x01, 0x75, 0x27, 0x01,
+    0x75, 0x27, 0x01, 0x4E, 0xA4, 0x00, 0x00, 0x2D, 0x01, 0x75, 0x27, 0x01, 0x73, 0x04, 0x00, 0x00,
+    0x09, 0x01, 0x74, 0x72, 0x62, 0x23, 0x2B, 0x01, 0x75, 0x53, 0x01, 0x6E, 0x1B, 0xE3, 0x22, 0x2B,
+    0x41, 0x01, 0x74, 0x97, 0x01, 0x73, 0x33, 0x00, 0x00, 0x09, 0xE9, 0x04, 0x21, 0x25, 0x2B, 0x2D,
+    0x40, 0x41, 0x42, 0x43, 0x01, 0x75, 0x15, 0x01, 0x49, 0xFF, 0x01, 0x6E, 0x7C, 0x01, 0x58, 0x8A,
+    0x01, 0x75, 0x69, 0x01, 0x14, 0x5C, 0x01, 0x67, 0x62, 0x01, 0x6B, 0xF2, 0x01, 0x73, 0x39, 0x61,
+    0x0D, 0x01, 0x03, 0xB7, 0x63, 0x23, 0x32, 0x34, 0x01, 0x5A, 0xA4, 0x01, 0x75, 0x4E, 0x01, 0x73,
+    0x63, 0x62, 0x34, 0x36, 0x01, 0x03, 0xBF, 0x01, 0x55, 0xDA, 0x41, 0x31, 0x86, 0xAB, 0x63, 0x08,
+    0x20, 0x25, 0x01, 0x40, 0x4C, 0x01, 0x63, 0x8D, 0x00, 0x00, 0x04, 0xE9, 0x01, 0x1A, 0x1E, 0x28,
+    0x32, 0x34, 0x35, 0x40, 0x4C, 0x00, 0x00, 0x27, 0x01, 0x5A, 0x96, 0x01, 0x4E, 0x79, 0x00, 0x00,
+    0x1A, 0x00, 0x00, 0x0D, 0x01, 0x4A, 0x1E, 0x01, 0x75, 0xBB, 0x00, 0xDE, 0x55, 0x01, 0x75, 0xBB,
+    0xA1, 0x16, 0x25, 0xE3, 0x04, 0x15, 0x40, 0x01, 0x75, 0x7D, 0x00, 0x7B, 0xC8, 0x01, 0x14, 0xD5,
+    0xC1, 0x40, 0xA5, 0xA6, 0x62, 0x32, 0x49, 0x01, 0x75, 0xA5, 0x01, 0x75, 0x9F, 0x62, 0x34, 0x48,
+    0x01, 0x75, 0xAE, 0x01, 0x6F, 0x0F, 0x62, 0x30, 0x48, 0x00, 0xB6, 0xCA, 0x01, 0x75, 0xB1, 0x63,
+    0x21, 0x2D, 0x49, 0x01, 0x76, 0x0F, 0x01, 0x6E, 0x45, 0x01, 0x6F, 0x21, 0x64, 0x25, 0x32, 0x35,
+    0x48, 0x01, 0x75, 0x56, 0x01, 0x76, 0x1B, 0x01, 0x76, 0x1C, 0x01, 0x75, 0xB6, 0x62, 0x2D, 0x48,
+    0x01, 0x76, 0x2D, 0x01, 0x75, 0xD8, 0x41, 0x42, 0x46, 0xCB, 0x63, 0x21, 0x33, 0x34, 0x01, 0x76,
+    0x3A, 0x00, 0x00, 0x04, 0x01, 0x76, 0x30, 0x63, 0x2D, 0x32, 0x39, 0x01, 0x76, 0x47, 0x01, 0x76,
+    0x46, 0x01, 0x76, 0x47, 0x65, 0x14, 0x19, 0x21, 0x32, 0x34, 0x01, 0x76, 0x54, 0x01, 0x71, 0x92,
+    0x00, 0x00, 0x0D, 0x01, 0x76, 0x05, 0x01, 0x76, 0x1B, 0x62, 0x01, 0x2D, 0x01, 0x76, 0x69, 0x01,
+    0x76, 0x68, 0x62, 0x09, 0x23, 0x01, 0x57, 0xD4, 0x01, 0x5D, 0xEC, 0x62, 0x02, 0x08, 0x01, 0x76,
+    0x42, 0x01, 0x76, 0x7A, 0x63, 0x17, 0x21, 0x2A, 0x01, 0x76, 0x3E, 0x01, 0x76, 0x05, 0x01, 0x76,
+    0x05, 0xF6, 0x02, 0x04, 0x07, 0x0B, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x25,
+    0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x94, 0x01, 0x50,
+    0x28, 0x01, 0x45, 0xD0, 0x00, 0x00, 0x8B, 0x01, 0x6C, 0x51, 0x01, 0x75, 0xCB, 0x00, 0x00, 0x82,
+    0x01, 0x0A, 0x5D, 0x00, 0x00, 0x75, 0x01, 0x75, 0x8F, 0x01, 0x75, 0x8F, 0x00, 0x00, 0x64, 0x00,
+    0x00, 0x57, 0x01, 0x19, 0xBB, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1F, 0x01, 0x68,
+    0x89, 0x00, 0x00, 0x16, 0x01, 0x74, 0x60, 0x00, 0x00, 0x0D, 0x61, 0x2A, 0x01, 0x24, 0x14, 0x42,
+    0x19, 0x40, 0xE0, 0xBD, 0x00, 0x05, 0x62, 0x34, 0x35, 0x00, 0x00, 0x07, 0x01, 0x76, 0xF6, 0xC2,
+    0x14, 0x15, 0x00, 0x09, 0x4A, 0x97, 0x6E, 0x01, 0x07, 0x08, 0x0A, 0x0F, 0x14, 0x15, 0x19, 0x1A,
+    0x22, 0x27, 0x2A, 0x48, 0x49, 0x00, 0x01, 0x9C, 0x01, 0x63, 0xE8, 0x00, 0x01, 0x77, 0x01, 0x77,
+    0x06, 0x00, 0x81, 0xA9, 0x01, 0x77, 0x06, 0x00, 0x01, 0x26, 0x00, 0x01, 0x23, 0x00, 0x01, 0x16,
+    0x01, 0x77, 0x06, 0x00, 0x00, 0x75, 0x00, 0x00, 0x07, 0x01, 0x76, 0xCD, 0x01, 0x76, 0xCD, 0xE2,
+    0x27, 0x34, 0x01, 0x74, 0xAF, 0x01, 0x77, 0x06, 0x41, 0x32, 0xD5, 0x28, 0x62, 0x16, 0x1E, 0x01,
+    0x76, 0x47, 0x01, 0x77, 0x13, 0x62, 0x01, 0x2B, 0x01, 0x76, 0xC4, 0x01, 0x76, 0xF7, 0xEA, 0x02,
+    0x04, 0x14, 0x19, 0x1B, 0x22, 0x2B, 0x40, 0x41, 0x44, 0x01, 0x6B, 0x4E, 0x01, 0x77, 0x06, 0x01,
+    0x77, 0x54, 0x01, 0x58, 0x8E, 0x01, 0x6F, 0x63, 0x00, 0x00, 0x16, 0x01, 0x1D, 0x0A, 0x00, 0xF1,
+    0x2C, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xE2, 0x01, 0x43, 0x01, 0x77, 0x87, 0x01, 0x45, 0x82,
+    0xE1, 0x40, 0x01, 0x45, 0x7F, 0xE2, 0x23, 0x34, 0x01, 0x6D, 0x55, 0x00, 0xA9, 0xF9, 0xE6, 0x01,
+    0x02, 0x15, 0x19, 0x2B, 0x43, 0x01, 0x76, 0x9C, 0x01, 0x6C, 0xF0, 0x01, 0x76, 0x95, 0x01, 0x74,
+    0x33, 0x01, 0x76, 0x95, 0x01, 0x75, 0x6D, 0x61, 0x21, 0x01, 0x47, 0xA1, 0x21, 0x27, 0x05, 0x21,
+    0x48, 0x03, 0xE3, 0x23, 0x34, 0x37, 0x00, 0x00, 0x03, 0x01, 0x5E, 0x53, 0x01, 0x77, 0x6D, 0xE1,
+    0x19, 0x01, 0x72, 0x1D, 0xE3, 0x01, 0x22, 0x39, 0x01, 0x77, 0xD4, 0x01, 0x74, 0x69, 0x01, 0x77,
+    0x43, 0x62, 0x07, 0x2B, 0x01, 0x5D, 0x73, 0x01, 0x2D, 0x5A, 0xEF, 0x01, 0x04, 0x07, 0x0D, 0x14,
+    0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x40, 0x44, 0x00, 0x00, 0xAB, 0x00, 0xF1, 0x9A,
+    0x00, 0x00, 0x8C, 0x01, 0x77, 0xEA, 0x00, 0x00, 0x63, 0x01, 0x77, 0xEA, 0x00, 0x00, 0x5A, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x28, 0x01, 0x13, 0x4D, 0x00, 0x00, 0x1B, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x09, 0x01, 0x6A, 0x86, 0x63, 0x04, 0x2A, 0x2B, 0x01, 0x75, 0x43, 0x01, 0x77,
+    0xC1, 0x01, 0x6D, 0x37, 0x62, 0x19, 0x31, 0x01, 0x6C, 0x61, 0x01, 0x70, 0xFB, 0x61, 0x34, 0x01,
+    0x0B, 0x18, 0x61, 0x01, 0x01, 0x72, 0x90, 0x21, 0x30, 0x05, 0x61, 0x33, 0x01, 0x4C, 0x03, 0x21,
+    0x49, 0x05, 0x62, 0x32, 0x49, 0x01, 0x78, 0x19, 0x01, 0x74, 0x44, 0x61, 0x1A, 0x01, 0x2D, 0x0D,
+    0x61, 0x19, 0x01, 0x45, 0xC6, 0x61, 0x04, 0x01, 0x4C, 0xC8, 0x21, 0x31, 0x05, 0x41, 0x01, 0xD9,
+    0xA4, 0x21, 0x47, 0x04, 0x21, 0x25, 0x03, 0x21, 0x2B, 0x03, 0x62, 0x1B, 0x25, 0x01, 0x78, 0x34,
+    0x01, 0x78, 0x70, 0xED, 0x07, 0x0A, 0x14, 0x15, 0x17, 0x19, 0x1B, 0x22, 0x2A, 0x2B, 0x2D, 0x40,
+    0x41, 0x01, 0x6E, 0x43, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x46, 0x00, 0x00, 0x3C, 0x00, 0xE7, 0x7D,
+    0x00, 0x00, 0x34, 0x01, 0x73, 0xC5, 0x00, 0x00, 0x31, 0x00, 0x00, 0x28, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x19, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x41, 0x19, 0xC5, 0x5E, 0x21, 0x32, 0x04, 0xE3,
+    0x15, 0x19, 0x2A, 0x01, 0x78, 0xBF, 0x01, 0x78, 0xBF, 0x01, 0x78, 0xBF, 0x62, 0x31, 0x32, 0x01,
+    0x75, 0xBE, 0x00, 0x00, 0x0D, 0xE5, 0x1E, 0x27, 0x30, 0x32, 0x40, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x09, 0x01, 0x78, 0xD5, 0x01, 0x12, 0x62, 0x00, 0xA5, 0x31, 0xC1, 0x1A, 0xED, 0x95, 0x21, 0x0D,
+    0x04, 0x62, 0x31, 0x34, 0x00, 0x00, 0x03, 0x01, 0x78, 0xF1, 0xE1, 0x42, 0x01, 0x42, 0x2D, 0x61,
+    0x2B, 0x01, 0x6E, 0x0F, 0x21, 0x07, 0x05, 0x69, 0x07, 0x14, 0x15, 0x19, 0x21, 0x23, 0x27, 0x48,
+    0x49, 0x00, 0x00, 0xE0, 0x01, 0x79, 0x07, 0x01, 0x78, 0x55, 0x00, 0x00, 0x84, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01, 0x5D, 0x95, 0xE1, 0x22, 0x01, 0x78,
+    0xD1, 0x61, 0x44, 0x01, 0x75, 0x19, 0xE3, 0x0A, 0x2A, 0x2B, 0x01, 0x52, 0xB3, 0x00, 0x00, 0x05,
+    0x01, 0x45, 0x5C, 0xE5, 0x14, 0x15, 0x19, 0x1A, 0x40, 0x01, 0x79, 0x43, 0x01, 0x78, 0xDD, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x0D, 0x01, 0x0C, 0xA8, 0xE2, 0x07, 0x48, 0x00, 0xFB, 0x44, 0x01, 0x79,
+    0x4E, 0x65, 0x14, 0x19, 0x2D, 0x48, 0x49, 0x01, 0x79, 0x61, 0x01, 0x79, 0x61, 0x01, 0x79, 0x61,
+    0x01, 0x79, 0x28, 0x01, 0x79, 0x0C, 0x62, 0x02, 0x2B, 0x01, 0x79, 0x10, 0x01, 0x78, 0x71, 0xE3,
+    0x1B, 0x1C, 0x40, 0x01, 0x79, 0x7B, 0x01, 0x79, 0x19, 0x00, 0x00, 0x09, 0x61, 0x2E, 0x01, 0x79,
+    0x26, 0x62, 0x19, 0x21, 0x01, 0x63, 0x0B, 0x01, 0x79, 0x91, 0x68, 0x07, 0x15, 0x19, 0x1A, 0x22,
+    0x23, 0x48, 0x49, 0x01, 0x79, 0x9A, 0x00, 0xA0, 0x5D, 0x01, 0x63, 0x49, 0x00, 0x00, 0x1B, 0x00,
+    0x00, 0x0E, 0x01, 0x54, 0x79, 0x01, 0x79, 0x61, 0x00, 0x00, 0x09, 0x62, 0x25, 0x35, 0x01, 0x70,
+    0x6D, 0x01, 0x79, 0x2A, 0x62, 0x2D, 0x49, 0x01, 0x79, 0xBA, 0x01, 0x79, 0xB7, 0x63, 0x34, 0x36,
+    0x39, 0x01, 0x79, 0xCD, 0x01, 0x79, 0xC3, 0x01, 0x75, 0xB5, 0x62, 0x1A, 0x2A, 0x01, 0x79, 0x74,
+    0x01, 0x77, 0x8E, 0x62, 0x27, 0x2B, 0x01, 0x79, 0xE3, 0x01, 0x79, 0xE3, 0xE1, 0x2B, 0x01, 0x78,
+    0xED, 0xEB, 0x01, 0x09, 0x0A, 0x14, 0x15, 0x1C, 0x23, 0x2B, 0x40, 0x44, 0x48, 0x01, 0x2A, 0x0B,
+    0x00, 0x00, 0x36, 0x00, 0x00, 0x2D, 0x01, 0x79, 0xF1, 0x00, 0x00, 0x24, 0x01, 0x50, 0x1D, 0x01,
+    0x47, 0xFF, 0x01, 0x1F, 0x9D, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x41, 0x22,
+    0xD6, 0xE6, 0xE1, 0x14, 0x01, 0x79, 0x16, 0xE1, 0x43, 0x01, 0x79, 0x6C, 0x62, 0x07, 0x22, 0x00,
+    0x00, 0x05, 0x01, 0x7A, 0x2C, 0xE4, 0x15, 0x19, 0x2B, 0x41, 0x01, 0x79, 0x2C, 0x01, 0x7A, 0x35,
+    0x00, 0xAE, 0x99, 0x01, 0x19, 0x27, 0xE1, 0x40, 0x01, 0x19, 0x38, 0xE5, 0x01, 0x07, 0x19, 0x21,
+    0x25, 0x01, 0x5F, 0xDD, 0x00, 0x00, 0x05, 0x01, 0x7A, 0x4B, 0x01, 0x7A, 0x4B, 0x01, 0x7A, 0x41,
+    0x24, 0x21, 0x27, 0x2D, 0x32, 0x3E, 0x34, 0x2B, 0x15, 0x61, 0x17, 0x01, 0x79, 0x67, 0x21, 0x1A,
+    0x05, 0x21, 0x31, 0x03, 0x61, 0x21, 0x01, 0x3D, 0xA5, 0xE5, 0x02, 0x17, 0x22, 0x40, 0x41, 0x01,
+    0x54, 0x99, 0x00, 0x00, 0x08, 0x01, 0x6E, 0x69, 0x00, 0x00, 0x05, 0x00, 0xF4, 0xB5, 0x63, 0x07,
+    0x19, 0x22, 0x01, 0x7A, 0x8E, 0x01, 0x54, 0xFA, 0x00, 0x00, 0x15, 0xE2, 0x19, 0x40, 0x01, 0x59,
+    0xFB, 0x00, 0xD9, 0x4A, 0xC1, 0x25, 0xC9, 0x3C, 0xE3, 0x07, 0x21, 0x22, 0x00, 0x00, 0x0D, 0x00,
+    0x00, 0x04, 0x01, 0x7A, 0xA8, 0xE1, 0x09, 0x01, 0x79, 0xFD, 0xE1, 0x2B, 0x01, 0x5D, 0xDA, 0xE3,
+    0x07, 0x21, 0x27, 0x00, 0x00, 0x0A, 0x01, 0x7A, 0xBF, 0x00, 0x00, 0x05, 0xE1, 0x2B, 0x01, 0x54,
+    0x49, 0x24, 0x27, 0x2D, 0x32, 0x33, 0x43, 0x29, 0x12, 0x05, 0x7C, 0x01, 0x07, 0x0D, 0x14, 0x15,
+    0x17, 0x19, 0x21, 0x22, 0x23, 0x24, 0x25, 0x27, 0x2A, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x42, 0x48, 0x49, 0x00, 0x0E, 0xBF, 0x00, 0x0E, 0x20, 0x00, 0x0D, 0xE8,
+    0x00, 0x0D, 0xDF, 0x01, 0x77, 0x6F, 0x00, 0x0D, 0xDA, 0x00, 0x0C, 0x14, 0x00, 0x0A, 0x26, 0x00,
+    0x09, 0x01, 0x00, 0x08, 0x6F, 0x00, 0x08, 0x20, 0x00, 0x06, 0xF0, 0x00, 0x06, 0x45, 0x01, 0x7A,
+    0xA1, 0x00, 0x05, 0xB3, 0x00, 0x05, 0x7D, 0x00, 0x03, 0xD4, 0x00, 0x02, 0xF0, 0x01, 0x7A, 0xDA,
+    0x00, 0x01, 0xD3, 0x00, 0x01, 0x97, 0x00, 0x01, 0x82, 0x00, 0x01, 0x79, 0x00, 0x01, 0x40, 0x00,
+    0x00, 0xE9, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x09, 0x62, 0x0D, 0x49, 0x01, 0x5A,
+    0x9D, 0x01, 0x7B, 0x41, 0x21, 0x31, 0x09, 0x41, 0x01, 0xEB, 0x04, 0x21, 0x21, 0x04, 0x64, 0x13,
+    0x23, 0x27, 0x48, 0x01, 0x48, 0x39, 0x00, 0x00, 0x03, 0x01, 0x77, 0x46, 0x01, 0x7A, 0x52, 0x61,
+    0x34, 0x01, 0x65, 0xF2, 0x21, 0x1B, 0x05, 0x21, 0x1B, 0x03, 0x62, 0x15, 0x25, 0x01, 0x78, 0xEA,
+    0x01, 0x7B, 0x14, 0xEC, 0x04, 0x15, 0x17, 0x19, 0x23, 0x2B, 0x31, 0x38, 0x40, 0x41, 0x42, 0x44,
+    0x01, 0x52, 0x79, 0x00, 0x00, 0x2F, 0x01, 0x1F, 0x31, 0x01, 0x5D, 0x41, 0x00, 0x00, 0x25, 0x01,
+    0x55, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x68, 0x8B, 0x00, 0x00, 0x09, 0x01, 0x4B, 0x69, 0x00, 0x8D,
+    0x89, 0x01, 0x79, 0x2D, 0x62, 0x18, 0x23, 0x01, 0x7B, 0xB4, 0x01, 0x7B, 0xB4, 0x62, 0x15, 0x32,
+    0x01, 0x66, 0xF7, 0x00, 0x00, 0x09, 0x62, 0x19, 0x23, 0x01, 0x5E, 0xC1, 0x00, 0xF3, 0x03, 0xC1,
+    0x35, 0x77, 0xB6, 0x21, 0x25, 0x04, 0xC1, 0x01, 0x9F, 0x02, 0xE8, 0x0A, 0x1E, 0x21, 0x23, 0x27,
+    0x32, 0x38, 0x4C, 0x00, 0xB4, 0x24, 0x01, 0x5C, 0x84, 0x00, 0x00, 0x14, 0x01, 0x6B, 0x12, 0x01,
+    0x6A, 0x09, 0x01, 0x5C, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0xE5, 0x01, 0x04, 0x28, 0x2D,
+    0x38, 0x01, 0x7B, 0xDF, 0x00, 0x00, 0x21, 0x01, 0x79, 0x39, 0x01, 0x09, 0xBF, 0x01, 0x77, 0xA9,
+    0x62, 0x15, 0x44, 0x01, 0x7B, 0xAA, 0x01, 0x46, 0xAB, 0x63, 0x15, 0x19, 0x23, 0x01, 0x57, 0x3D,
+    0x00, 0x00, 0x09, 0x01, 0x79, 0x20, 0x63, 0x23, 0x25, 0x34, 0x01, 0x7C, 0x26, 0x01, 0x6A, 0x77,
+    0x00, 0x00, 0x0D, 0x62, 0x19, 0x23, 0x01, 0x6C, 0x59, 0x01, 0x7C, 0x33, 0xE2, 0x32, 0x34, 0x01,
+    0x7C, 0x3C, 0x00, 0x00, 0x09, 0x63, 0x34, 0x38, 0x39, 0x01, 0x7C, 0x45, 0x01, 0x7C, 0x45, 0x01,
+    0x7C, 0x45, 0x62, 0x22, 0x2D, 0x01, 0x7C, 0x4E, 0x01, 0x7A, 0x43, 0x63, 0x23, 0x27, 0x31, 0x01,
+    0x7C, 0x5B, 0x01, 0x7C, 0x15, 0x01, 0x7B, 0xA0, 0x62, 0x17, 0x23, 0x01, 0x79, 0x35, 0x01, 0x7C,
+    0x67, 0xE3, 0x16, 0x28, 0x40, 0x01, 0x7B, 0xAB, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0xE2, 0x01,
+    0x20, 0x01, 0x61, 0xFA, 0x01, 0x79, 0x4B, 0x21, 0x15, 0x09, 0x41, 0x25, 0x74, 0x1D, 0xE8, 0x17,
+    0x19, 0x2A, 0x2D, 0x34, 0x35, 0x38, 0x43, 0x01, 0x7C, 0x55, 0x01, 0x7A, 0x7F, 0x01, 0x7C, 0x75,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x01, 0x7A, 0x5D, 0xE5,
+    0x0A, 0x21, 0x23, 0x2A, 0x40, 0x01, 0x79, 0x9D, 0x01, 0x4C, 0xD2, 0x01, 0x54, 0xCA, 0x01, 0x7B,
+    0x77, 0x01, 0x78, 0xAB, 0x21, 0x34, 0x15, 0x61, 0x32, 0x01, 0x7A, 0x47, 0x21, 0x19, 0x05, 0x21,
+    0x19, 0x03, 0x21, 0x34, 0x03, 0x41, 0x23, 0xB3, 0x53, 0x21, 0x38, 0x04, 0x41, 0x23, 0xA3, 0x8B,
+    0xE5, 0x21, 0x23, 0x27, 0x2A, 0x32, 0x01, 0x61, 0xBB, 0x01, 0x72, 0x01, 0x01, 0x7B, 0xA8, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x04, 0x61, 0x15, 0x01, 0x58, 0x19, 0x62, 0x32, 0x38, 0x01, 0x7C, 0x45,
+    0x00, 0x00, 0x05, 0xEA, 0x01, 0x04, 0x0F, 0x1A, 0x1B, 0x21, 0x23, 0x27, 0x28, 0x29, 0x00, 0x00,
+    0x23, 0x01, 0x71, 0x8B, 0x00, 0xE7, 0xCD, 0x00, 0x6B, 0x81, 0x00, 0x20, 0xCC, 0x00, 0x00, 0x09,
+    0x01, 0x55, 0x1E, 0x01, 0x61, 0xDE, 0x01, 0x32, 0x58, 0x00, 0xE7, 0xCD, 0x63, 0x23, 0x34, 0x36,
+    0x01, 0x62, 0x3C, 0x00, 0x00, 0x29, 0x01, 0x7D, 0x2B, 0x63, 0x13, 0x40, 0x4C, 0x01, 0x79, 0xCE,
+    0x00, 0xE5, 0xD3, 0x01, 0x7D, 0x39, 0x21, 0x04, 0x0D, 0x62, 0x06, 0x16, 0x01, 0x7D, 0x49, 0x01,
+    0x7D, 0x49, 0x21, 0x23, 0x09, 0x62, 0x15, 0x16, 0x01, 0x7C, 0xEF, 0x01, 0x7D, 0x55, 0x61, 0x2A,
+    0x01, 0x24, 0xF0, 0x21, 0x02, 0x05, 0x21, 0x38, 0x03, 0xA1, 0x2A, 0x03, 0xE3, 0x19, 0x23, 0x4C,
+    0x01, 0x5E, 0x9C, 0x01, 0x7D, 0x6C, 0x00, 0x00, 0x03, 0x21, 0x15, 0x0D, 0x64, 0x0D, 0x15, 0x19,
+    0x21, 0x01, 0x7D, 0x7C, 0x00, 0x00, 0x27, 0x00, 0x00, 0x03, 0x01, 0x7D, 0x7C, 0x62, 0x15, 0x32,
+    0x00, 0x6F, 0x6D, 0x01, 0x1D, 0x29, 0x61, 0x1B, 0x01, 0x48, 0x2D, 0x21, 0x34, 0x05, 0x62, 0x31,
+    0x34, 0x01, 0x7C, 0xE3, 0x01, 0x6B, 0xFD, 0xE3, 0x0A, 0x18, 0x30, 0x01, 0x7D, 0x6E, 0x01, 0x62,
+    0xB3, 0x01, 0x7D, 0xA7, 0x21, 0x22, 0x0D, 0x62, 0x31, 0x47, 0x01, 0x7C, 0xFC, 0x01, 0x73, 0x77,
+    0x69, 0x01, 0x04, 0x08, 0x16, 0x17, 0x18, 0x21, 0x23, 0x25, 0x01, 0x6E, 0x35, 0x00, 0x00, 0x33,
+    0x01, 0x7C, 0x88, 0x01, 0x6C, 0x11, 0x01, 0x7D, 0x7A, 0x00, 0x00, 0x25, 0x00, 0x00, 0x22, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x09, 0x62, 0x31, 0x32, 0x01, 0x7D, 0xDB, 0x01, 0x7D, 0xE5, 0xE2, 0x01,
+    0x08, 0x01, 0x62, 0xFA, 0x00, 0x00, 0x09, 0x62, 0x15, 0x21, 0x01, 0x7D, 0xF7, 0x01, 0x7D, 0xF7,
+    0x45, 0x08, 0x22, 0x25, 0x27, 0x29, 0x00, 0x12, 0x00, 0x09, 0xF5, 0xCC, 0xF2, 0x6F, 0x94, 0x43,
+    0xE1, 0x31, 0x01, 0x41, 0x7A, 0x62, 0x01, 0x08, 0x00, 0x00, 0x05, 0x01, 0x7E, 0x15, 0x61, 0x21,
+    0x01, 0x7C, 0xE3, 0xE2, 0x21, 0x23, 0x01, 0x7E, 0x23, 0x00, 0x00, 0x05, 0x62, 0x0A, 0x23, 0x01,
+    0x73, 0x7E, 0x01, 0x7E, 0x2C, 0x63, 0x23, 0x32, 0x39, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01,
+    0x7D, 0xD7, 0xE3, 0x19, 0x32, 0x34, 0x01, 0x7E, 0x42, 0x01, 0x2D, 0xDA, 0x01, 0x7B, 0x34, 0x41,
+    0x25, 0xBC, 0xC0, 0x21, 0x38, 0x04, 0x21, 0x15, 0x03, 0x21, 0x15, 0x03, 0x62, 0x15, 0x42, 0x01,
+    0x7E, 0x5C, 0x00, 0x00, 0x03, 0x21, 0x32, 0x09, 0x61, 0x34, 0x01, 0x7D, 0x13, 0x21, 0x23, 0x05,
+    0x62, 0x07, 0x31, 0x01, 0x32, 0xA9, 0x01, 0x7C, 0x05, 0x62, 0x23, 0x34, 0x01, 0x6C, 0xAF, 0x01,
+    0x6C, 0xAF, 0x63, 0x04, 0x1E, 0x29, 0x01, 0x7E, 0x82, 0x01, 0x7E, 0x82, 0x01, 0x7E, 0x82, 0x22,
+    0x23, 0x32, 0x16, 0x0D, 0x61, 0x18, 0x01, 0x7E, 0x5B, 0x21, 0x0A, 0x05, 0x21, 0x32, 0x03, 0xA1,
+    0x23, 0x03, 0x62, 0x15, 0x19, 0x01, 0x7E, 0x39, 0x00, 0x00, 0x03, 0xE1, 0x01, 0x01, 0x58, 0xB2,
+    0x21, 0x25, 0x05, 0x63, 0x31, 0x32, 0x39, 0x01, 0x59, 0xD7, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03,
+    0x62, 0x19, 0x4C, 0x01, 0x49, 0x01, 0x01, 0x7E, 0xC0, 0x21, 0x29, 0x09, 0x21, 0x01, 0x03, 0x63,
+    0x31, 0x32, 0x39, 0x00, 0x00, 0x03, 0x01, 0x62, 0x17, 0x01, 0x7E, 0xBC, 0x62, 0x28, 0x29, 0x01,
+    0x7E, 0xC0, 0x01, 0x7E, 0xC0, 0x63, 0x07, 0x31, 0x32, 0x00, 0x00, 0x09, 0x01, 0x7B, 0xD7, 0x01,
+    0x7B, 0xD7, 0x41, 0x23, 0xCC, 0xFF, 0x63, 0x01, 0x15, 0x19, 0x01, 0x7E, 0xF6, 0x00, 0x00, 0x04,
+    0x01, 0x7E, 0xDA, 0x21, 0x2A, 0x0D, 0x41, 0x29, 0x95, 0x49, 0x22, 0x32, 0x34, 0x07, 0x04, 0x62,
+    0x0D, 0x22, 0x01, 0x7D, 0xBD, 0x01, 0x7F, 0x0F, 0x62, 0x27, 0x2A, 0x01, 0x4B, 0xEF, 0x01, 0x53,
+    0x7B, 0x65, 0x15, 0x19, 0x23, 0x31, 0x32, 0x01, 0x6A, 0x5B, 0x00, 0xD7, 0xDD, 0x01, 0x7C, 0x1E,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x62, 0x04, 0x16, 0x01, 0x21, 0x09, 0x01, 0x65, 0xAA, 0x64,
+    0x1E, 0x21, 0x22, 0x25, 0x01, 0x34, 0x5B, 0x00, 0xEF, 0x06, 0x01, 0x6C, 0x55, 0x01, 0x7D, 0x30,
+    0xF1, 0x01, 0x08, 0x0A, 0x0D, 0x15, 0x17, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x23, 0x27, 0x28, 0x2A,
+    0x40, 0x42, 0x00, 0x01, 0x1B, 0x01, 0x7F, 0x0A, 0x00, 0x01, 0x0E, 0x00, 0x00, 0xEB, 0x01, 0x7F,
+    0x0A, 0x01, 0x64, 0xE2, 0x00, 0xEA, 0x43, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC1,
+    0x00, 0x00, 0x9D, 0x00, 0x00, 0x81, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x46, 0x00, 0x00, 0x2F, 0x00,
+    0x00, 0x1A, 0x00, 0x00, 0x11, 0x6D, 0x07, 0x18, 0x22, 0x23, 0x25, 0x27, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x38, 0x00, 0x02, 0x4F, 0x01, 0x7E, 0x5A, 0x01, 0x7C, 0x2A, 0x00, 0x02, 0x43, 0x01,
+    0x7F, 0x95, 0x00, 0xFA, 0xFB, 0x00, 0x02, 0x19, 0x00, 0x01, 0xD5, 0x01, 0x7F, 0x95, 0x00, 0x01,
+    0x95, 0x00, 0x01, 0x80, 0x00, 0xB1, 0xA4, 0x00, 0x00, 0x45, 0x63, 0x27, 0x38, 0x49, 0x01, 0x7F,
+    0x6C, 0x01, 0x7B, 0x78, 0x01, 0x63, 0xBC, 0xE2, 0x20, 0x21, 0x01, 0x46, 0xFD, 0x01, 0x35, 0x88,
+    0x21, 0x22, 0x09, 0xE4, 0x23, 0x2D, 0x32, 0x40, 0x01, 0x7D, 0xD4, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x03, 0x01, 0x25, 0xF1, 0x61, 0x32, 0x01, 0x7F, 0x88, 0x62, 0x07, 0x32, 0x01, 0x7D, 0x30, 0x01,
+    0x7F, 0xC0, 0xE4, 0x20, 0x21, 0x31, 0x32, 0x01, 0x61, 0x32, 0x01, 0x2B, 0x2D, 0x01, 0x6F, 0x4E,
+    0x01, 0x6E, 0x65, 0x61, 0x35, 0x01, 0x66, 0xA4, 0x21, 0x08, 0x05, 0x61, 0x34, 0x01, 0x5F, 0xF6,
+    0x21, 0x0B, 0x05, 0x21, 0x2A, 0x03, 0x69, 0x01, 0x08, 0x21, 0x22, 0x23, 0x27, 0x2B, 0x32, 0x34,
+    0x01, 0x7E, 0xEE, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2D, 0x01, 0x7F, 0xA1, 0x00, 0x00, 0x24, 0x01,
+    0x62, 0x37, 0x01, 0x7E, 0xEE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x41, 0x15, 0xB5, 0x9B, 0x21,
+    0x4C, 0x04, 0x21, 0x23, 0x03, 0x63, 0x1E, 0x22, 0x32, 0x01, 0x7C, 0xEA, 0x01, 0x7D, 0x22, 0x00,
+    0x00, 0x03, 0xE2, 0x17, 0x42, 0x01, 0x80, 0x07, 0x01, 0x51, 0x9D, 0x62, 0x1E, 0x22, 0x01, 0x7F,
+    0x95, 0x00, 0x00, 0x09, 0x61, 0x22, 0x01, 0x26, 0x48, 0x64, 0x19, 0x31, 0x32, 0x34, 0x01, 0x80,
+    0x79, 0x00, 0x00, 0x05, 0x01, 0x7D, 0x6B, 0x01, 0x7D, 0x6B, 0x62, 0x23, 0x32, 0x01, 0x65, 0x9A,
+    0x01, 0x80, 0x51, 0x62, 0x19, 0x4C, 0x00, 0xBF, 0x04, 0x01, 0x80, 0x93, 0x21, 0x17, 0x09, 0x62,
+    0x19, 0x22, 0x00, 0x00, 0x03, 0x01, 0x80, 0x9F, 0x62, 0x31, 0x34, 0x00, 0x00, 0x09, 0x01, 0x7F,
+    0x67, 0x61, 0x0A, 0x01, 0x7F, 0x5F, 0x62, 0x31, 0x32, 0x00, 0x00, 0x05, 0x01, 0x7F, 0xFB, 0x21,
+    0x23, 0x09, 0x61, 0x2D, 0x01, 0x0E, 0x7F, 0x21, 0x32, 0x05, 0x63, 0x2B, 0x32, 0x38, 0x00, 0x00,
+    0x03, 0x01, 0x50, 0xF1, 0x01, 0x7F, 0x42, 0x66, 0x14, 0x21, 0x31, 0x32, 0x38, 0x39, 0x01, 0x80,
+    0x11, 0x01, 0x6E, 0x6F, 0x01, 0x70, 0x12, 0x01, 0x7E, 0xC8, 0x00, 0x02, 0xE0, 0x01, 0x80, 0xC4,
+    0x41, 0x2A, 0xEB, 0xA4, 0x21, 0x15, 0x04, 0x21, 0x34, 0x03, 0x21, 0x02, 0x03, 0x21, 0x01, 0x03,
+    0x21, 0x31, 0x03, 0x61, 0x17, 0x01, 0x13, 0x2A, 0x62, 0x31, 0x32, 0x01, 0x60, 0xCE, 0x00, 0x00,
+    0x05, 0x63, 0x31, 0x32, 0x42, 0x01, 0x80, 0x56, 0x01, 0x5F, 0x91, 0x00, 0xC9, 0xCF, 0x62, 0x15,
+    0x17, 0x01, 0x81, 0x1E, 0x01, 0x7D, 0xF4, 0x43, 0x21, 0x31, 0x34, 0x00, 0x16, 0xC9, 0xDE, 0x00,
+    0x09, 0x41, 0x29, 0xE6, 0xBB, 0x61, 0x1B, 0x01, 0x76, 0xCB, 0x63, 0x19, 0x25, 0x29, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x05, 0x01, 0x81, 0x39, 0xF0, 0x06, 0x08, 0x0A, 0x0D, 0x13, 0x18, 0x19, 0x1A,
+    0x1B, 0x21, 0x23, 0x25, 0x27, 0x2A, 0x40, 0x44, 0x01, 0x7E, 0x35, 0x01, 0x2C, 0xB1, 0x00, 0x00,
+    0xCE, 0x01, 0x7F, 0xF5, 0x01, 0x20, 0x39, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x9F, 0x01, 0x66, 0xC3,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x70, 0x00, 0x00, 0x47, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x0D, 0x00, 0xE3, 0xD5, 0x64, 0x27, 0x31, 0x34, 0x39, 0x01, 0x81, 0x88,
+    0x00, 0x01, 0x1D, 0x00, 0x00, 0x41, 0x01, 0x7E, 0x7A, 0xE2, 0x1A, 0x30, 0x01, 0x7F, 0x9B, 0x01,
+    0x81, 0x99, 0x41, 0x38, 0x3E, 0x6B, 0x61, 0x19, 0x01, 0x7A, 0xB8, 0x21, 0x30, 0x05, 0x62, 0x31,
+    0x32, 0x00, 0xE7, 0x61, 0x01, 0x64, 0xF6, 0x61, 0x34, 0x01, 0x24, 0x5E, 0xE1, 0x27, 0x01, 0x4C,
+    0x62, 0xE6, 0x1A, 0x1E, 0x23, 0x27, 0x32, 0x34, 0x01, 0x4C, 0x67, 0x01, 0x5A, 0x7F, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0x5C, 0x57, 0xE3, 0x1A, 0x22, 0x23, 0x01, 0x7F,
+    0xDC, 0x01, 0x81, 0xC1, 0x01, 0x6E, 0xBC, 0x21, 0x15, 0x0D, 0x61, 0x08, 0x01, 0x7E, 0x7F, 0x62,
+    0x08, 0x15, 0x00, 0x00, 0x05, 0x01, 0x81, 0xA9, 0x62, 0x15, 0x27, 0x01, 0x6F, 0x90, 0x01, 0x65,
+    0x69, 0xF2, 0x01, 0x04, 0x15, 0x19, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x24, 0x2B, 0x31, 0x32,
+    0x34, 0x35, 0x40, 0x42, 0x01, 0x70, 0xEB, 0x00, 0xFB, 0xB1, 0x00, 0x00, 0x68, 0x00, 0x00, 0x5F,
+    0x01, 0x81, 0xFD, 0x00, 0x00, 0x56, 0x01, 0x49, 0x27, 0x01, 0x7F, 0xB5, 0x01, 0x2E, 0xC5, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x1A, 0x01, 0x13, 0xEE, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01, 0x81,
+    0x4C, 0x01, 0x0A, 0x1A, 0x01, 0x65, 0xEC, 0x01, 0x62, 0xFF, 0x62, 0x17, 0x18, 0x01, 0x7F, 0xE3,
+    0x01, 0x70, 0x80, 0x62, 0x08, 0x22, 0x01, 0x37, 0xF5, 0x01, 0x30, 0xA7, 0xE4, 0x04, 0x14, 0x40,
+    0x44, 0x01, 0x82, 0x52, 0x01, 0x81, 0x96, 0x00, 0x00, 0x09, 0x01, 0x6C, 0xE6, 0x21, 0x48, 0x11,
+    0xE1, 0x44, 0x01, 0x82, 0x2A, 0xA1, 0x07, 0x05, 0x21, 0x32, 0x03, 0x64, 0x32, 0x38, 0x39, 0x48,
+    0x01, 0x82, 0x7A, 0x00, 0x00, 0x31, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xE2, 0x23, 0x38, 0x01,
+    0x82, 0x8C, 0x01, 0x82, 0x53, 0x61, 0x34, 0x01, 0x77, 0x1D, 0xE1, 0x30, 0x01, 0x2F, 0xC4, 0x41,
+    0x23, 0x52, 0x6F, 0x22, 0x23, 0x32, 0x09, 0x04, 0x41, 0x24, 0xC9, 0x64, 0x21, 0x19, 0x04, 0x21,
+    0x1E, 0x03, 0x41, 0x31, 0x27, 0x02, 0x21, 0x20, 0x04, 0x21, 0x34, 0x03, 0x61, 0x34, 0x01, 0x6C,
+    0xC1, 0x21, 0x18, 0x05, 0xE8, 0x01, 0x19, 0x1A, 0x1B, 0x21, 0x23, 0x27, 0x32, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x15, 0x01, 0x80, 0xC6, 0x00, 0x27, 0x06, 0x01, 0x65, 0xC3, 0x01, 0x6F, 0xA6, 0x00,
+    0x00, 0x0B, 0x00, 0x00, 0x03, 0x66, 0x04, 0x06, 0x08, 0x13, 0x16, 0x18, 0x01, 0x82, 0xE5, 0x01,
+    0x6E, 0x37, 0x01, 0x78, 0x7B, 0x01, 0x7F, 0xB2, 0x00, 0x00, 0x21, 0x00, 0xFA, 0xEA, 0xE1, 0x15,
+    0x01, 0x73, 0x91, 0x63, 0x07, 0x15, 0x19, 0x01, 0x83, 0x03, 0x01, 0x83, 0x03, 0x00, 0x00, 0x05,
+    0x62, 0x30, 0x31, 0x01, 0x83, 0x10, 0x00, 0x00, 0x0D, 0xE1, 0x1B, 0x01, 0x3D, 0x3F, 0x62, 0x0D,
+    0x13, 0x00, 0x00, 0x05, 0x01, 0x70, 0xB6, 0xE6, 0x01, 0x1A, 0x1C, 0x21, 0x2A, 0x30, 0x01, 0x7F,
+    0xBC, 0x00, 0xF7, 0xC0, 0x01, 0x82, 0xC9, 0x01, 0x2D, 0xE6, 0x00, 0xED, 0x52, 0x01, 0x83, 0x27,
+    0x61, 0x15, 0x01, 0x5E, 0x04, 0x21, 0x40, 0x05, 0x21, 0x15, 0x03, 0x21, 0x42, 0x03, 0xE4, 0x19,
+    0x22, 0x2A, 0x40, 0x01, 0x83, 0x4E, 0x00, 0x00, 0x27, 0x00, 0x00, 0x03, 0x01, 0x33, 0xC1, 0x41,
+    0x23, 0x53, 0xA9, 0x21, 0x21, 0x04, 0x21, 0x31, 0x03, 0xA1, 0x2D, 0x03, 0x41, 0x13, 0xF3, 0x41,
+    0xE3, 0x13, 0x42, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x01, 0x81, 0x61, 0x41, 0x07, 0xBC,
+    0x43, 0x21, 0x27, 0x04, 0xA1, 0x14, 0x03, 0x21, 0x21, 0x03, 0x62, 0x2D, 0x32, 0x01, 0x82, 0xCF,
+    0x00, 0x00, 0x03, 0xF0, 0x0A, 0x13, 0x14, 0x18, 0x19, 0x1E, 0x23, 0x2A, 0x2B, 0x31, 0x32, 0x34,
+    0x38, 0x39, 0x44, 0x48, 0x00, 0x01, 0x07, 0x01, 0x83, 0x93, 0x01, 0x82, 0xCD, 0x01, 0x83, 0x38,
+    0x01, 0x28, 0x2D, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xAE, 0x01, 0x81, 0x16, 0x00, 0x00, 0x83, 0x00,
+    0x00, 0x75, 0x01, 0x4E, 0x39, 0x00, 0x00, 0x45, 0x00, 0x00, 0x23, 0x01, 0x83, 0x80, 0x01, 0x81,
+    0x95, 0x00, 0x00, 0x09, 0x63, 0x15, 0x23, 0x32, 0x01, 0x83, 0xD4, 0x01, 0x78, 0xF5, 0x01, 0x83,
+    0x8E, 0x21, 0x01, 0x0D, 0x61, 0x21, 0x01, 0x3A, 0x6B, 0x61, 0x15, 0x01, 0x82, 0xF3, 0x21, 0x2A,
+    0x05, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x61, 0x0A, 0x01, 0x83, 0x31, 0x62, 0x07, 0x0A, 0x01,
+    0x82, 0xC1, 0x00, 0x00, 0x05, 0x61, 0x09, 0x01, 0x5A, 0x31, 0x21, 0x07, 0x05, 0x21, 0x48, 0x03,
+    0x61, 0x09, 0x01, 0x78, 0xBE, 0x21, 0x07, 0x05, 0x61, 0x09, 0x01, 0x74, 0x74, 0x21, 0x07, 0x05,
+    0x22, 0x2D, 0x32, 0x0B, 0x03, 0x69, 0x07, 0x27, 0x2B, 0x2D, 0x31, 0x34, 0x36, 0x40, 0x48, 0x00,
+    0x00, 0x44, 0x01, 0x83, 0xEC, 0x00, 0x00, 0x41, 0x00, 0x00, 0x31, 0x00, 0x00, 0x29, 0x01, 0x26,
+    0xE4, 0x00, 0x00, 0x18, 0x01, 0x7C, 0x43, 0x00, 0x00, 0x05, 0xE1, 0x32, 0x01, 0x83, 0xC5, 0x62,
+    0x31, 0x32, 0x01, 0x83, 0x94, 0x01, 0x81, 0x41, 0x62, 0x2D, 0x32, 0x01, 0x83, 0x9D, 0x01, 0x84,
+    0x57, 0xA1, 0x25, 0x09, 0x62, 0x07, 0x2D, 0x01, 0x81, 0x9B, 0x01, 0x7D, 0x76, 0xE2, 0x1E, 0x27,
+    0x01, 0x84, 0x27, 0x01, 0x81, 0x02, 0x62, 0x22, 0x2A, 0x01, 0x54, 0xE6, 0x01, 0x82, 0xDF, 0x61,
+    0x08, 0x01, 0x83, 0xB9, 0x63, 0x08, 0x0A, 0x0D, 0x01, 0x83, 0xBE, 0x01, 0x61, 0x6C, 0x00, 0x58,
+    0x24, 0x70, 0x01, 0x08, 0x0A, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x25, 0x2A, 0x2B, 0x31, 0x32,
+    0x34, 0x35, 0x00, 0x00, 0x47, 0x01, 0x84, 0x4B, 0x00, 0x00, 0x42, 0x01, 0x14, 0xEC, 0x01, 0x83,
+    0x59, 0x00, 0x00, 0x30, 0x01, 0x84, 0x91, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x24, 0x01, 0x84, 0x91,
+    0x01, 0x84, 0x36, 0x01, 0x83, 0x59, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x0D, 0x00,
+    0x95, 0x25, 0x61, 0x02, 0x01, 0x84, 0x17, 0x21, 0x44, 0x05, 0x61, 0x35, 0x01, 0x34, 0xD8, 0x62,
+    0x15, 0x32, 0x01, 0x84, 0x99, 0x01, 0x84, 0x2A, 0x62, 0x01, 0x21, 0x01, 0x83, 0xB0, 0x00, 0x00,
+    0x09, 0x61, 0x1E, 0x01, 0x01, 0x28, 0x41, 0x34, 0x2D, 0xDC, 0x21, 0x23, 0x04, 0x21, 0x32, 0x03,
+    0x42, 0x01, 0x2B, 0x2D, 0xE6, 0x00, 0x03, 0x41, 0x2B, 0xD5, 0x0B, 0x21, 0x14, 0x04, 0xE3, 0x01,
+    0x0D, 0x41, 0x01, 0x6A, 0x1A, 0x01, 0x84, 0x48, 0x00, 0x00, 0x03, 0x63, 0x07, 0x0D, 0x15, 0x00,
+    0x00, 0x1B, 0x00, 0x00, 0x0D, 0x01, 0x72, 0xB3, 0x62, 0x23, 0x38, 0x01, 0x85, 0x28, 0x01, 0x85,
+    0x28, 0xA1, 0x18, 0x09, 0x41, 0x35, 0xD5, 0x3F, 0xE2, 0x01, 0x35, 0x01, 0x83, 0x0E, 0x01, 0x85,
+    0x38, 0xE5, 0x08, 0x19, 0x20, 0x23, 0x40, 0x01, 0x70, 0x7B, 0x00, 0x00, 0x0D, 0x01, 0x85, 0x41,
+    0x00, 0x00, 0x09, 0x01, 0x69, 0x2C, 0x62, 0x0D, 0x23, 0x01, 0x85, 0x56, 0x01, 0x85, 0x56, 0x6B,
+    0x07, 0x19, 0x20, 0x21, 0x23, 0x31, 0x32, 0x34, 0x35, 0x38, 0x39, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x85, 0x01, 0x85, 0x5F, 0x00, 0x00, 0x77, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x44, 0x00, 0x00, 0x2E,
+    0x01, 0x34, 0xF7, 0x01, 0x1A, 0x47, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x09, 0x61, 0x42, 0x01, 0x66,
+    0x8A, 0x21, 0x01, 0x05, 0xA1, 0x15, 0x03, 0x21, 0x32, 0x03, 0xC2, 0x07, 0x27, 0x4D, 0x5D, 0x00,
+    0x03, 0x42, 0x31, 0x34, 0x96, 0xA2, 0x00, 0x07, 0x62, 0x08, 0x14, 0x01, 0x85, 0x6F, 0x01, 0x48,
+    0xB2, 0x21, 0x40, 0x09, 0x21, 0x34, 0x03, 0x62, 0x2D, 0x34, 0x01, 0x85, 0xB6, 0x01, 0x81, 0x9F,
+    0x62, 0x2A, 0x31, 0x01, 0x85, 0xC0, 0x01, 0x81, 0xA8, 0x62, 0x32, 0x39, 0x01, 0x85, 0x0E, 0x01,
+    0x85, 0xC8, 0x63, 0x02, 0x1A, 0x23, 0x01, 0x85, 0xD1, 0x01, 0x81, 0xBA, 0x01, 0x85, 0xC8, 0x62,
+    0x02, 0x23, 0x01, 0x85, 0xA6, 0x01, 0x85, 0xD5, 0x62, 0x0B, 0x1F, 0x01, 0x75, 0xCF, 0x01, 0x85,
+    0xE8, 0xF0, 0x07, 0x0B, 0x0D, 0x14, 0x15, 0x17, 0x1A, 0x1B, 0x1D, 0x23, 0x25, 0x27, 0x31, 0x41,
+    0x42, 0x44, 0x01, 0x85, 0x96, 0x00, 0x00, 0x3D, 0x01, 0x85, 0x8B, 0x00, 0x00, 0x3A, 0x01, 0x84,
+    0xE8, 0x00, 0xE8, 0x50, 0x01, 0x00, 0xD4, 0x01, 0x85, 0xED, 0x01, 0x85, 0x2B, 0x00, 0x00, 0x31,
+    0x00, 0x00, 0x28, 0x01, 0x83, 0xCE, 0x00, 0xDB, 0x22, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x09, 0xE3, 0x34, 0x41, 0x46, 0x01, 0x32, 0x8C, 0x01, 0x7A, 0x22, 0x01, 0x86, 0x32, 0x41,
+    0x17, 0x3F, 0x2F, 0x42, 0x15, 0x40, 0x84, 0xD2, 0x00, 0x04, 0x62, 0x2D, 0x4C, 0x01, 0x86, 0x11,
+    0x01, 0x86, 0x4A, 0x61, 0x32, 0x01, 0x76, 0x36, 0x21, 0x21, 0x05, 0x21, 0x35, 0x03, 0x64, 0x0A,
+    0x0B, 0x14, 0x44, 0x01, 0x69, 0x0B, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x01, 0x43, 0x12, 0x41,
+    0x34, 0xEA, 0xB9, 0x61, 0x47, 0x01, 0x21, 0x04, 0x21, 0x08, 0x05, 0x63, 0x0A, 0x15, 0x40, 0x01,
+    0x85, 0x79, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0xE2, 0x0A, 0x1F, 0x01, 0x69, 0x35, 0x01, 0x79,
+    0x91, 0x61, 0x32, 0x01, 0x64, 0xDC, 0xE6, 0x0A, 0x0B, 0x1F, 0x2A, 0x2D, 0x44, 0x01, 0x7E, 0x75,
+    0x01, 0x7E, 0x75, 0x00, 0x00, 0x05, 0x01, 0x6C, 0x28, 0x01, 0x86, 0x47, 0x01, 0x82, 0x7E, 0x41,
+    0x34, 0xBB, 0xFF, 0x61, 0x0B, 0x01, 0x4F, 0x67, 0x41, 0x04, 0x30, 0x1A, 0x21, 0x40, 0x04, 0x21,
+    0x17, 0x03, 0x66, 0x01, 0x1E, 0x40, 0x41, 0x42, 0x44, 0x01, 0x5B, 0x25, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x0F, 0x01, 0x02, 0xAC, 0x00, 0x00, 0x03, 0x01, 0x4D, 0x75, 0x42, 0x32, 0x4C, 0x70, 0xD2,
+    0x00, 0x19, 0x61, 0x1A, 0x01, 0x4A, 0x53, 0x62, 0x23, 0x34, 0x01, 0x6C, 0x63, 0x01, 0x86, 0xAE,
+    0x62, 0x35, 0x40, 0x01, 0x86, 0x35, 0x01, 0x4D, 0xAA, 0x21, 0x23, 0x09, 0x62, 0x15, 0x21, 0x00,
+    0x00, 0x03, 0x01, 0x5B, 0xCA, 0x64, 0x0B, 0x15, 0x40, 0x42, 0x01, 0x86, 0x06, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x09, 0x01, 0x86, 0xA7, 0x62, 0x07, 0x0B, 0x01, 0x6C, 0xA8, 0x01, 0x6E, 0x90, 0x61,
+    0x08, 0x01, 0x82, 0xFA, 0xCC, 0x01, 0x14, 0x15, 0x19, 0x1B, 0x1F, 0x21, 0x23, 0x25, 0x2A, 0x40,
+    0x44, 0x01, 0x33, 0x00, 0xF2, 0x00, 0xE1, 0x00, 0xC6, 0x00, 0xA9, 0x00, 0x9C, 0x00, 0x8E, 0x00,
+    0x49, 0x00, 0x42, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x05, 0x41, 0x32, 0x8F, 0x46, 0x21, 0x21, 0x04,
+    0x21, 0x32, 0x03, 0x62, 0x23, 0x27, 0x01, 0x6B, 0x41, 0x00, 0x00, 0x03, 0x61, 0x42, 0x01, 0x81,
+    0xAA, 0x21, 0x34, 0x05, 0x21, 0x0B, 0x03, 0x21, 0x19, 0x03, 0x63, 0x2D, 0x38, 0x39, 0x00, 0x82,
+    0x0B, 0x00, 0x00, 0x03, 0x01, 0x83, 0x3E, 0x61, 0x32, 0x01, 0x1A, 0x2A, 0x21, 0x19, 0x05, 0x21,
+    0x35, 0x03, 0x41, 0x25, 0xDC, 0x3A, 0x64, 0x23, 0x31, 0x38, 0x39, 0x00, 0x00, 0x07, 0x01, 0x87,
+    0x85, 0x01, 0x87, 0x7C, 0x00, 0x00, 0x04, 0x41, 0x44, 0x4E, 0x84, 0x21, 0x32, 0x04, 0x21, 0x04,
+    0x03, 0x21, 0x32, 0x03, 0x62, 0x42, 0x44, 0x00, 0x00, 0xE5, 0x01, 0x4E, 0x57, 0x21, 0x4C, 0x09,
+    0x21, 0x23, 0x03, 0x62, 0x15, 0x21, 0x01, 0x87, 0x97, 0x01, 0x87, 0x97, 0x21, 0x0B, 0x09, 0x21,
+    0x44, 0x03, 0x62, 0x25, 0x40, 0x00, 0x00, 0x03, 0x01, 0x66, 0x0A, 0x65, 0x2D, 0x30, 0x31, 0x32,
+    0x35, 0x00, 0x00, 0x1B, 0x01, 0x87, 0xCB, 0x01, 0x80, 0x92, 0x00, 0x00, 0x09, 0x01, 0x87, 0x4C,
+    0x61, 0x32, 0x01, 0x4E, 0x8F, 0x61, 0x4C, 0x01, 0x67, 0x26, 0x21, 0x23, 0x05, 0x62, 0x2D, 0x35,
+    0x00, 0x00, 0x03, 0x01, 0x10, 0x06, 0x41, 0x42, 0x95, 0xA1, 0x61, 0x23, 0x01, 0x3E, 0x7A, 0x21,
+    0x2D, 0x05, 0x21, 0x32, 0x03, 0x22, 0x32, 0x49, 0x0F, 0x03, 0x61, 0x17, 0x01, 0x6A, 0xB7, 0x21,
+    0x40, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x32, 0x03, 0x61, 0x1A, 0x01, 0x6D, 0x03, 0x22, 0x1A, 0x41,
+    0x08, 0x05, 0x41, 0x25, 0xD4, 0xAD, 0x21, 0x2D, 0x04, 0x21, 0x21, 0x03, 0x22, 0x48, 0x49, 0x03,
+    0x03, 0x62, 0x19, 0x40, 0x01, 0x63, 0x10, 0x01, 0x5C, 0xFB, 0x21, 0x34, 0x09, 0x62, 0x21, 0x44,
+    0x00, 0x00, 0x03, 0x01, 0x7B, 0x14, 0x65, 0x2D, 0x31, 0x32, 0x38, 0x39, 0x01, 0x87, 0x53, 0x01,
+    0x86, 0x37, 0x00, 0x00, 0x29, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x09, 0x41, 0x34, 0xFB, 0xFC, 0x21,
+    0x17, 0x04, 0x61, 0x34, 0x01, 0x21, 0x19, 0x21, 0x23, 0x05, 0x61, 0x14, 0x01, 0x84, 0x41, 0x21,
+    0x44, 0x05, 0x21, 0x19, 0x03, 0x21, 0x32, 0x03, 0x21, 0x0B, 0x03, 0x41, 0x32, 0x66, 0x59, 0x21,
+    0x0B, 0x04, 0x21, 0x01, 0x03, 0x22, 0x01, 0x47, 0x0D, 0x03, 0x41, 0x39, 0x90, 0x87, 0x21, 0x08,
+    0x04, 0x21, 0x19, 0x03, 0x67, 0x01, 0x04, 0x0B, 0x18, 0x21, 0x25, 0x27, 0x01, 0x85, 0x86, 0x01,
+    0x5D, 0x6C, 0x00, 0x00, 0x35, 0x01, 0x4A, 0xEA, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x03, 0x61, 0x2A, 0x01, 0x77, 0x10, 0x62, 0x08, 0x25, 0x01, 0x88, 0xB6, 0x00, 0x00, 0x05, 0x62,
+    0x23, 0x2B, 0x01, 0x88, 0xBF, 0x01, 0x6E, 0xBB, 0x71, 0x04, 0x08, 0x0B, 0x14, 0x15, 0x17, 0x19,
+    0x1E, 0x21, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x44, 0x00, 0x01, 0x75, 0x01, 0x67, 0x4F,
+    0x00, 0x01, 0x5E, 0x00, 0x01, 0x42, 0x01, 0x80, 0xA7, 0x00, 0x01, 0x27, 0x00, 0x00, 0xFD, 0x00,
+    0x00, 0xE8, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x82, 0x01, 0x88, 0x62, 0x01, 0x86,
+    0xB9, 0x01, 0x5D, 0xA0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x62, 0x18, 0x1A,
+    0x01, 0x88, 0x47, 0x01, 0x43, 0x92, 0x21, 0x34, 0x09, 0xE3, 0x27, 0x2A, 0x30, 0x00, 0x00, 0x03,
+    0x00, 0xF3, 0xCD, 0x01, 0x89, 0x19, 0xA1, 0x23, 0x0D, 0x61, 0x20, 0x01, 0x78, 0x75, 0x21, 0x2A,
+    0x05, 0xA1, 0x42, 0x03, 0x62, 0x23, 0x30, 0x00, 0x00, 0x03, 0x01, 0x89, 0x34, 0x61, 0x2A, 0x01,
+    0x85, 0x25, 0xE1, 0x20, 0x01, 0x89, 0x42, 0x21, 0x02, 0x05, 0xE6, 0x01, 0x02, 0x29, 0x2D, 0x40,
+    0x42, 0x01, 0x85, 0xDF, 0x00, 0x00, 0x24, 0x00, 0x00, 0x16, 0x01, 0x7D, 0x73, 0x00, 0x00, 0x0D,
+    0x00, 0x00, 0x03, 0x63, 0x30, 0x34, 0x35, 0x01, 0x89, 0x63, 0x01, 0x89, 0x63, 0x01, 0x89, 0x63,
+    0x61, 0x2B, 0x01, 0x6C, 0xE1, 0x21, 0x40, 0x05, 0x41, 0x0A, 0xF7, 0x76, 0x21, 0x32, 0x04, 0x41,
+    0x13, 0xF7, 0x7D, 0x21, 0x21, 0x04, 0xE4, 0x0A, 0x21, 0x23, 0x2A, 0x01, 0x74, 0x65, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x03, 0x63, 0x04, 0x19, 0x23, 0x00, 0x00, 0x34, 0x01, 0x36,
+    0x1F, 0x00, 0x00, 0x11, 0xE2, 0x1A, 0x23, 0x01, 0x89, 0xA4, 0x01, 0x89, 0x3E, 0x62, 0x23, 0x28,
+    0x01, 0x89, 0xAD, 0x01, 0x89, 0xAD, 0x68, 0x19, 0x24, 0x27, 0x30, 0x32, 0x38, 0x39, 0x4C, 0x01,
+    0x86, 0x4B, 0x01, 0x65, 0xB7, 0x01, 0x89, 0x67, 0x01, 0x50, 0xFE, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x09, 0x01, 0x89, 0x70, 0x01, 0x89, 0xB6, 0x63, 0x13, 0x32, 0x38, 0x00, 0xC4, 0x58, 0x00, 0xE2,
+    0x18, 0x01, 0x4D, 0x41, 0x61, 0x07, 0x01, 0x85, 0xBF, 0x21, 0x31, 0x05, 0x21, 0x19, 0x03, 0x21,
+    0x39, 0x03, 0x21, 0x14, 0x03, 0x62, 0x35, 0x36, 0x00, 0x00, 0x03, 0x01, 0x89, 0xEB, 0x61, 0x38,
+    0x01, 0x13, 0xA2, 0xE4, 0x01, 0x15, 0x19, 0x32, 0x00, 0x00, 0x05, 0x01, 0x15, 0x44, 0x01, 0x89,
+    0x9D, 0x01, 0x8A, 0x03, 0x61, 0x01, 0x01, 0x82, 0x19, 0xE9, 0x01, 0x04, 0x06, 0x17, 0x19, 0x23,
+    0x28, 0x2A, 0x42, 0x00, 0x00, 0x63, 0x00, 0x00, 0x42, 0x01, 0x87, 0x07, 0x00, 0xF9, 0x13, 0x01,
+    0x69, 0x79, 0x00, 0x00, 0x24, 0x01, 0x03, 0x9D, 0x00, 0x00, 0x16, 0x00, 0x00, 0x05, 0x62, 0x19,
+    0x22, 0x01, 0x86, 0x19, 0x01, 0x8A, 0x3E, 0x63, 0x31, 0x34, 0x38, 0x00, 0x00, 0x09, 0x01, 0x8A,
+    0x47, 0x01, 0x87, 0x39, 0x62, 0x1A, 0x30, 0x00, 0xFE, 0xED, 0x01, 0x8A, 0x54, 0x21, 0x22, 0x09,
+    0x62, 0x32, 0x34, 0x01, 0x8A, 0x60, 0x00, 0x00, 0x03, 0x21, 0x23, 0x09, 0x64, 0x01, 0x08, 0x09,
+    0x19, 0x01, 0x7C, 0x60, 0x00, 0x00, 0x25, 0x00, 0x00, 0x03, 0x01, 0x8A, 0x06, 0xE1, 0x2A, 0x01,
+    0x6E, 0xFA, 0x21, 0x32, 0x05, 0x21, 0x0C, 0x03, 0x63, 0x19, 0x25, 0x31, 0x01, 0x87, 0x1D, 0x01,
+    0x89, 0xC2, 0x01, 0x8A, 0x4F, 0x61, 0x0A, 0x01, 0x40, 0x3B, 0xE7, 0x02, 0x0A, 0x0D, 0x1B, 0x21,
+    0x23, 0x40, 0x01, 0x83, 0x16, 0x00, 0x00, 0x12, 0x01, 0x87, 0x2F, 0x01, 0x66, 0x43, 0x01, 0x6A,
+    0x18, 0x01, 0x8A, 0x84, 0x00, 0x00, 0x05, 0xE2, 0x10, 0x19, 0x01, 0x87, 0xBE, 0x01, 0x8A, 0x51,
+    0x61, 0x0D, 0x01, 0x5C, 0x0D, 0x21, 0x34, 0x05, 0xA1, 0x21, 0x03, 0xE5, 0x17, 0x21, 0x28, 0x2C,
+    0x34, 0x01, 0x7D, 0xD4, 0x01, 0x8A, 0xCB, 0x01, 0x8A, 0xCA, 0x01, 0x77, 0xAD, 0x00, 0x00, 0x03,
+    0x62, 0x13, 0x32, 0x01, 0x2C, 0x87, 0x01, 0x77, 0xC2, 0x41, 0x31, 0x0D, 0xF4, 0xE4, 0x08, 0x20,
+    0x21, 0x23, 0x01, 0x65, 0x80, 0x01, 0x6C, 0x1D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xE3, 0x0A,
+    0x30, 0x32, 0x01, 0x87, 0x93, 0x01, 0x8A, 0xFE, 0x01, 0x89, 0xC3, 0x62, 0x11, 0x13, 0x00, 0x00,
+    0x0D, 0x01, 0x87, 0xD8, 0x62, 0x08, 0x2D, 0x01, 0x8B, 0x14, 0x01, 0x8B, 0x14, 0xE4, 0x09, 0x23,
+    0x25, 0x41, 0x01, 0x57, 0xBC, 0x01, 0x8B, 0x07, 0x01, 0x89, 0x0E, 0x00, 0x00, 0x09, 0x61, 0x1B,
+    0x01, 0x2A, 0xDB, 0x21, 0x27, 0x05, 0x21, 0x35, 0x03, 0xC1, 0x18, 0x0D, 0x9E, 0x63, 0x0A, 0x30,
+    0x32, 0x00, 0x00, 0x07, 0x01, 0x8B, 0x3D, 0x00, 0x00, 0x04, 0x61, 0x47, 0x01, 0x8A, 0x45, 0x21,
+    0x23, 0x05, 0xE2, 0x2A, 0x40, 0x01, 0x7F, 0x7B, 0x00, 0x00, 0x03, 0x62, 0x0A, 0x32, 0x01, 0x87,
+    0xF0, 0x00, 0x00, 0x09, 0x41, 0x32, 0xF0, 0xEA, 0x21, 0x1A, 0x04, 0x21, 0x34, 0x03, 0x21, 0x19,
+    0x03, 0x21, 0x34, 0x03, 0x61, 0x19, 0x01, 0x32, 0xF5, 0xEB, 0x04, 0x0A, 0x15, 0x16, 0x19, 0x20,
+    0x23, 0x25, 0x27, 0x2B, 0x42, 0x01, 0x8B, 0x27, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3C, 0x00, 0x5F,
+    0x11, 0x01, 0x6F, 0xF6, 0x01, 0x4A, 0x87, 0x00, 0x00, 0x1E, 0x01, 0x8B, 0x27, 0x00, 0x00, 0x08,
+    0x01, 0x68, 0xA1, 0x00, 0x00, 0x05, 0x62, 0x15, 0x39, 0x01, 0x8B, 0xA6, 0x01, 0x8B, 0xA6, 0xA1,
+    0x04, 0x09, 0x62, 0x17, 0x18, 0x01, 0x8B, 0x4C, 0x00, 0x00, 0x03, 0x62, 0x22, 0x28, 0x01, 0x8B,
+    0xBB, 0x01, 0x70, 0x38, 0x21, 0x32, 0x09, 0x21, 0x22, 0x03, 0xE1, 0x2D, 0x01, 0x78, 0xAC, 0x61,
+    0x4C, 0x01, 0x8B, 0x66, 0x21, 0x23, 0x05, 0x65, 0x01, 0x23, 0x2D, 0x31, 0x32, 0x01, 0x8B, 0xD7,
+    0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01, 0x87, 0xBF, 0x01, 0x5F, 0x90, 0xE3, 0x23, 0x32, 0x34,
+    0x01, 0x8B, 0xEC, 0x01, 0x8B, 0x8E, 0x00, 0xFB, 0x99, 0x62, 0x38, 0x39, 0x00, 0xC1, 0xD7, 0x01,
+    0x8B, 0xF9, 0xE3, 0x18, 0x20, 0x32, 0x01, 0x8B, 0xA7, 0x01, 0x6D, 0x32, 0x01, 0x3C, 0xC3, 0x62,
+    0x01, 0x21, 0x01, 0x8C, 0x0F, 0x01, 0x88, 0xA4, 0xE5, 0x01, 0x04, 0x23, 0x30, 0x34, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x16, 0x01, 0x8C, 0x18, 0x00, 0x00, 0x09, 0xE2, 0x01, 0x1E,
+    0x01, 0x8A, 0xF5, 0x01, 0x71, 0xA9, 0x62, 0x22, 0x48, 0x01, 0x8C, 0x36, 0x01, 0x8B, 0xD0, 0x63,
+    0x14, 0x15, 0x27, 0x01, 0x6E, 0xEC, 0x01, 0x8C, 0x3F, 0x01, 0x79, 0x21, 0xE8, 0x14, 0x15, 0x17,
+    0x18, 0x19, 0x27, 0x40, 0x42, 0x00, 0x00, 0x75, 0x00, 0x00, 0x34, 0x01, 0x89, 0x68, 0x00, 0x00,
+    0x1F, 0x00, 0xC6, 0xCD, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x01, 0x45, 0x59, 0xE4, 0x08, 0x1B,
+    0x2D, 0x40, 0x01, 0x8C, 0x34, 0x01, 0x8C, 0x60, 0x01, 0x8A, 0x43, 0x01, 0x37, 0xD7, 0x62, 0x30,
+    0x32, 0x01, 0x8C, 0x7E, 0x01, 0x8C, 0x38, 0x61, 0x04, 0x01, 0x7A, 0x1F, 0x21, 0x32, 0x05, 0x63,
+    0x30, 0x32, 0x35, 0x00, 0xC3, 0x21, 0x01, 0x71, 0x08, 0x01, 0x7A, 0x27, 0x61, 0x23, 0x01, 0x46,
+    0x43, 0x61, 0x25, 0x01, 0x8B, 0x7C, 0x21, 0x2D, 0x05, 0xA1, 0x27, 0x03, 0x21, 0x4C, 0x03, 0x21,
+    0x23, 0x03, 0x62, 0x2B, 0x2D, 0x01, 0x77, 0xEC, 0x00, 0x00, 0x03, 0x62, 0x14, 0x1B, 0x01, 0x89,
+    0xAD, 0x00, 0x00, 0x09, 0xE9, 0x01, 0x1B, 0x20, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x40, 0x00, 0x00,
+    0x46, 0x01, 0x89, 0x59, 0x00, 0x00, 0x38, 0x01, 0x34, 0x6B, 0x01, 0x8C, 0x3F, 0x00, 0x00, 0x35,
+    0x01, 0x34, 0x48, 0x00, 0x00, 0x28, 0x00, 0x00, 0x09, 0x62, 0x19, 0x2A, 0x01, 0x8C, 0xE9, 0x01,
+    0x8C, 0xE9, 0x21, 0x32, 0x09, 0x62, 0x01, 0x14, 0x01, 0x66, 0xFC, 0x00, 0xD6, 0x3D, 0x64, 0x1E,
+    0x20, 0x40, 0x42, 0x01, 0x0B, 0xC9, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x01, 0x1E, 0xCC, 0x61,
+    0x34, 0x01, 0x4B, 0xA3, 0x21, 0x19, 0x05, 0x21, 0x32, 0x03, 0x21, 0x01, 0x03, 0x62, 0x31, 0x32,
+    0x01, 0x8C, 0xE4, 0x01, 0x8D, 0x1D, 0xE2, 0x0A, 0x17, 0x01, 0x8D, 0x26, 0x01, 0x8D, 0x26, 0xE6,
+    0x23, 0x24, 0x27, 0x32, 0x34, 0x38, 0x01, 0x8D, 0x2F, 0x01, 0x7C, 0x6A, 0x00, 0x00, 0x12, 0x01,
+    0x3C, 0xC7, 0x01, 0x8C, 0xD1, 0x00, 0x00, 0x09, 0x61, 0x4C, 0x01, 0x4E, 0x49, 0x21, 0x23, 0x05,
+    0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0x21, 0x40, 0x03, 0xE3, 0x1E, 0x21, 0x2A, 0x00, 0x00, 0x2A,
+    0x01, 0x8C, 0x57, 0x00, 0x00, 0x03, 0x63, 0x30, 0x32, 0x35, 0x01, 0x8D, 0x66, 0x01, 0x6E, 0xCC,
+    0x01, 0x8D, 0x66, 0x42, 0x01, 0x22, 0x00, 0x0D, 0x98, 0xF4, 0x61, 0x40, 0x01, 0x2B, 0xB9, 0x21,
+    0x2D, 0x05, 0x21, 0x42, 0x03, 0x21, 0x27, 0x03, 0xA1, 0x44, 0x03, 0x21, 0x32, 0x03, 0x21, 0x23,
+    0x03, 0x62, 0x31, 0x32, 0x01, 0x85, 0x6C, 0x01, 0x6D, 0x6C, 0x41, 0x2D, 0xC6, 0x2F, 0x21, 0x32,
+    0x04, 0x65, 0x08, 0x15, 0x1A, 0x21, 0x25, 0x01, 0x4A, 0x76, 0x00, 0x00, 0x13, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x03, 0x01, 0x89, 0x93, 0xE2, 0x19, 0x34, 0x01, 0x59, 0x5F, 0x00, 0xF3, 0xBB, 0x61,
+    0x08, 0x01, 0x5A, 0x96, 0x64, 0x08, 0x14, 0x27, 0x40, 0x00, 0x9D, 0x51, 0x01, 0x8D, 0x7E, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x05, 0x62, 0x07, 0x27, 0x01, 0x7B, 0x0F, 0x00, 0xCC, 0xE9, 0xE2, 0x21,
+    0x32, 0x01, 0x8A, 0x73, 0x00, 0x00, 0x09, 0x21, 0x0E, 0x09, 0x61, 0x0A, 0x01, 0x4A, 0x4E, 0x21,
+    0x21, 0x05, 0x21, 0x31, 0x03, 0xE1, 0x04, 0x01, 0x8A, 0xE7, 0x62, 0x07, 0x23, 0x00, 0x00, 0x05,
+    0x01, 0x8D, 0xFA, 0xE2, 0x0A, 0x18, 0x01, 0x8D, 0xA5, 0x01, 0x79, 0x2C, 0x63, 0x30, 0x32, 0x38,
+    0x01, 0x8E, 0x0C, 0x01, 0x70, 0x76, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0x51, 0x23, 0x21, 0x0B,
+    0x05, 0xE5, 0x0A, 0x14, 0x19, 0x2A, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x27, 0x01, 0x8D, 0x5B,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0x62, 0x22, 0x42, 0x01, 0x8D, 0x37, 0x01, 0x74, 0x32, 0x63,
+    0x01, 0x07, 0x19, 0x01, 0x8E, 0x3F, 0x00, 0x00, 0x09, 0x01, 0x8E, 0x3F, 0x7D, 0x01, 0x04, 0x07,
+    0x08, 0x0A, 0x0D, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x1F,
+    0x21, 0x22, 0x25, 0x28, 0x29, 0x2A, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x05, 0x02, 0x00, 0x04, 0xB5,
+    0x00, 0x04, 0x33, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC7, 0x00, 0x03, 0xB2, 0x00, 0x03, 0x95, 0x00,
+    0x03, 0x81, 0x00, 0x03, 0x5F, 0x00, 0x03, 0x41, 0x00, 0x03, 0x2F, 0x00, 0x02, 0xD3, 0x00, 0x02,
+    0x9A, 0x00, 0x02, 0x85, 0x00, 0x02, 0x00, 0x00, 0x01, 0xDF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x4E,
+    0x00, 0x01, 0x32, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xD9, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0x65, 0x00, 0x00, 0x2B, 0x01, 0x8D, 0x47, 0x00, 0x00, 0x0D, 0x01, 0x1D, 0xF4, 0x01, 0x8E,
+    0x13, 0x61, 0x2E, 0x01, 0x8D, 0xBF, 0xA1, 0x35, 0x05, 0x41, 0x1B, 0xFE, 0x6F, 0xE2, 0x22, 0x2D,
+    0x01, 0x8E, 0x72, 0x00, 0x8B, 0xE0, 0x62, 0x23, 0x28, 0x01, 0x8E, 0xD6, 0x00, 0x00, 0x09, 0x65,
+    0x23, 0x31, 0x32, 0x39, 0x49, 0x00, 0x00, 0x19, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0x01, 0x8E,
+    0x81, 0x01, 0x8E, 0x79, 0x41, 0x32, 0x5B, 0xCA, 0x21, 0x22, 0x04, 0x61, 0x15, 0x01, 0x31, 0x71,
+    0x21, 0x19, 0x05, 0xE1, 0x2A, 0x01, 0x30, 0xCD, 0x21, 0x23, 0x05, 0x61, 0x19, 0x01, 0x7C, 0xA3,
+    0x64, 0x21, 0x31, 0x32, 0x40, 0x01, 0x8F, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x05, 0x61, 0x19, 0x01, 0x8F, 0x14, 0x21, 0x02, 0x05, 0x61, 0x25, 0x01, 0x82, 0x2E, 0xE1, 0x27,
+    0x01, 0x8E, 0x76, 0x21, 0x22, 0x05, 0x21, 0x34, 0x03, 0x61, 0x23, 0x01, 0x8C, 0x21, 0x21, 0x32,
+    0x05, 0x21, 0x21, 0x03, 0x21, 0x32, 0x03, 0xE2, 0x22, 0x35, 0x01, 0x8F, 0x2B, 0x01, 0x8F, 0x47,
+    0x62, 0x14, 0x23, 0x01, 0x8F, 0x50, 0x00, 0x00, 0x09, 0xE9, 0x01, 0x13, 0x21, 0x23, 0x2A, 0x2B,
+    0x2D, 0x32, 0x34, 0x00, 0x00, 0x30, 0x01, 0x32, 0x14, 0x01, 0x75, 0xEA, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x15, 0x01, 0x72, 0x79, 0x01, 0x8F, 0x4F, 0x00, 0x00, 0x09, 0x01, 0x7E, 0xA5, 0xE2, 0x23,
+    0x2A, 0x01, 0x8D, 0x6F, 0x01, 0x35, 0x55, 0x21, 0x23, 0x09, 0xE3, 0x01, 0x28, 0x2A, 0x00, 0x00,
+    0x03, 0x01, 0x5B, 0x33, 0x01, 0x8C, 0x5A, 0x21, 0x32, 0x0D, 0xE2, 0x19, 0x44, 0x01, 0x8F, 0x9A,
+    0x01, 0x03, 0x00, 0xE3, 0x01, 0x28, 0x30, 0x01, 0x8F, 0xA3, 0x01, 0x6F, 0xD9, 0x01, 0x8F, 0xA3,
+    0x62, 0x1E, 0x27, 0x01, 0x8F, 0xB0, 0x00, 0x00, 0x0D, 0x64, 0x0D, 0x27, 0x32, 0x35, 0x00, 0x00,
+    0x22, 0x01, 0x8C, 0x4E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x09, 0xE1, 0x2A, 0x01, 0x8C, 0x9A, 0x21,
+    0x32, 0x05, 0x61, 0x0D, 0x01, 0x3A, 0xF9, 0x21, 0x31, 0x05, 0xA1, 0x2A, 0x03, 0x21, 0x34, 0x03,
+    0x21, 0x15, 0x03, 0xE4, 0x08, 0x19, 0x1B, 0x40, 0x01, 0x8F, 0x97, 0x01, 0x4A, 0xFB, 0x00, 0x34,
+    0x25, 0x01, 0x61, 0x56, 0x22, 0x31, 0x32, 0x14, 0x11, 0x62, 0x23, 0x25, 0x01, 0x8F, 0xF9, 0x01,
+    0x7D, 0x91, 0xE2, 0x38, 0x39, 0x00, 0x00, 0x09, 0x01, 0x8F, 0xBC, 0xE3, 0x20, 0x31, 0x32, 0x01,
+    0x4F, 0x19, 0x01, 0x8F, 0xD2, 0x01, 0x90, 0x0B, 0x21, 0x21, 0x0D, 0x62, 0x13, 0x4C, 0x01, 0x8F,
+    0xFF, 0x01, 0x90, 0x1B, 0x21, 0x1E, 0x09, 0x21, 0x23, 0x03, 0x21, 0x23, 0x03, 0x62, 0x15, 0x19,
+    0x01, 0x8F, 0xC7, 0x01, 0x90, 0x2D, 0xC1, 0x15, 0xF6, 0x6F, 0x65, 0x23, 0x32, 0x34, 0x35, 0x36,
+    0x00, 0xD6, 0xCD, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0x01, 0x71, 0x59, 0x01, 0x90, 0x39, 0x62,
+    0x23, 0x32, 0x01, 0x75, 0x5F, 0x01, 0x87, 0x8E, 0xE1, 0x17, 0x01, 0x90, 0x3C, 0x62, 0x19, 0x21,
+    0x01, 0x70, 0x27, 0x01, 0x90, 0x5D, 0xE7, 0x01, 0x19, 0x30, 0x31, 0x33, 0x34, 0x38, 0x01, 0x90,
+    0x66, 0x00, 0x00, 0x0E, 0x01, 0x90, 0x66, 0x00, 0x00, 0x09, 0x01, 0x90, 0x66, 0x00, 0xC2, 0xA1,
+    0x01, 0x3F, 0x84, 0x62, 0x15, 0x19, 0x01, 0x7B, 0xBD, 0x01, 0x90, 0x83, 0x61, 0x14, 0x01, 0x49,
+    0x6D, 0xE3, 0x31, 0x34, 0x41, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x01, 0x1A, 0x79, 0x63, 0x13,
+    0x30, 0x32, 0x00, 0x9C, 0x18, 0x01, 0x90, 0x9E, 0x01, 0x90, 0x65, 0x63, 0x31, 0x32, 0x34, 0x01,
+    0x90, 0x5C, 0x01, 0x45, 0xC7, 0x01, 0x90, 0x4D, 0x63, 0x01, 0x15, 0x23, 0x00, 0x03, 0xA1, 0x01,
+    0x8B, 0xF6, 0x01, 0x51, 0xA8, 0x41, 0x34, 0x40, 0x06, 0xE3, 0x01, 0x20, 0x2A, 0x01, 0x90, 0x83,
+    0x00, 0x00, 0x04, 0x01, 0x90, 0xC9, 0x63, 0x23, 0x31, 0x32, 0x01, 0x85, 0xF7, 0x01, 0x8D, 0xA3,
+    0x00, 0x00, 0x0D, 0xE3, 0x25, 0x31, 0x34, 0x01, 0x90, 0xE2, 0x01, 0x90, 0x28, 0x00, 0x7F, 0xDD,
+    0x63, 0x14, 0x15, 0x19, 0x01, 0x90, 0xF0, 0x01, 0x90, 0xF0, 0x01, 0x90, 0xF0, 0x41, 0x27, 0x7B,
+    0x68, 0xE3, 0x28, 0x40, 0x41, 0x01, 0x7E, 0xE3, 0x00, 0x00, 0x04, 0x01, 0x3E, 0x6E, 0xE3, 0x02,
+    0x18, 0x23, 0x01, 0x75, 0x8B, 0x01, 0x91, 0x0E, 0x00, 0x00, 0x0D, 0xE5, 0x15, 0x19, 0x31, 0x32,
+    0x38, 0x00, 0xCC, 0x2D, 0x01, 0x91, 0x1B, 0x00, 0x00, 0x2B, 0x01, 0x90, 0xE2, 0x00, 0x00, 0x0D,
+    0xE5, 0x0A, 0x18, 0x1B, 0x30, 0x31, 0x01, 0x0A, 0x76, 0x01, 0x76, 0x3C, 0x01, 0x4B, 0x56, 0x00,
+    0xCA, 0x4E, 0x01, 0x90, 0xF7, 0x62, 0x02, 0x29, 0x01, 0x90, 0xDF, 0x01, 0x91, 0x29, 0xE2, 0x01,
+    0x1A, 0x01, 0x90, 0x6D, 0x01, 0x8F, 0x50, 0x21, 0x20, 0x09, 0x65, 0x01, 0x0D, 0x15, 0x21, 0x25,
+    0x00, 0x00, 0x15, 0x01, 0x91, 0x5A, 0x01, 0x7C, 0x94, 0x00, 0x00, 0x03, 0x01, 0x91, 0x5A, 0xE1,
+    0x34, 0x01, 0x91, 0x6E, 0x63, 0x18, 0x21, 0x40, 0x01, 0x8F, 0xFC, 0x00, 0x00, 0x05, 0x01, 0x2B,
+    0x86, 0x41, 0x4C, 0x56, 0xA3, 0xA1, 0x22, 0x04, 0x41, 0x27, 0xC6, 0xD8, 0x63, 0x15, 0x2D, 0x34,
+    0x01, 0x8E, 0xA4, 0x01, 0x91, 0x53, 0x00, 0x00, 0x04, 0x41, 0x19, 0xF5, 0xA4, 0x62, 0x15, 0x31,
+    0x01, 0x8E, 0xB5, 0x00, 0x00, 0x04, 0x61, 0x0B, 0x01, 0x70, 0x5A, 0x21, 0x42, 0x05, 0x21, 0x14,
+    0x03, 0x21, 0x27, 0x03, 0x21, 0x40, 0x03, 0x61, 0x34, 0x01, 0x90, 0x3F, 0x61, 0x44, 0x01, 0x4E,
+    0xD4, 0x21, 0x17, 0x05, 0x63, 0x15, 0x42, 0x44, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01, 0x58,
+    0x77, 0x21, 0x19, 0x0D, 0x62, 0x2D, 0x34, 0x01, 0x91, 0x76, 0x01, 0x82, 0x42, 0x62, 0x1E, 0x25,
+    0x01, 0x8D, 0xB1, 0x01, 0x8D, 0xB8, 0x21, 0x44, 0x09, 0x21, 0x19, 0x03, 0x22, 0x19, 0x42, 0x18,
+    0x03, 0x63, 0x08, 0x0B, 0x23, 0x00, 0x00, 0x20, 0x00, 0x00, 0x05, 0x01, 0x7F, 0x89, 0x66, 0x01,
+    0x04, 0x15, 0x1F, 0x21, 0x40, 0x00, 0x00, 0x72, 0x00, 0x00, 0x61, 0x01, 0x91, 0xFE, 0x00, 0x00,
+    0x4A, 0x01, 0x91, 0xFE, 0x00, 0x00, 0x0D, 0x6C, 0x14, 0x17, 0x1A, 0x21, 0x22, 0x30, 0x31, 0x32,
+    0x35, 0x38, 0x39, 0x4C, 0x01, 0x91, 0x51, 0x01, 0x91, 0xAE, 0x01, 0x58, 0x47, 0x01, 0x87, 0x38,
+    0x00, 0x00, 0xE7, 0x01, 0x92, 0x17, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x92, 0x01,
+    0x90, 0x08, 0x01, 0x92, 0x17, 0x00, 0x00, 0x19, 0x41, 0x19, 0x65, 0xE0, 0x63, 0x01, 0x22, 0x27,
+    0x01, 0x39, 0xD7, 0x01, 0x92, 0x4C, 0x01, 0x92, 0x4C, 0x61, 0x0A, 0x01, 0x91, 0xEA, 0x21, 0x40,
+    0x05, 0xA1, 0x27, 0x03, 0x64, 0x1B, 0x30, 0x31, 0x34, 0x00, 0x00, 0x1C, 0x01, 0x87, 0xB2, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x03, 0x62, 0x2A, 0x2B, 0x01, 0x92, 0x75, 0x01, 0x8F, 0x0A, 0x63, 0x15,
+    0x18, 0x42, 0x01, 0x92, 0x7E, 0x01, 0x92, 0x7E, 0x01, 0x7F, 0x60, 0xE3, 0x23, 0x32, 0x38, 0x01,
+    0x87, 0xAC, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x61, 0x21, 0x01, 0x0A, 0x9D, 0x41, 0x23, 0xC5,
+    0x1D, 0x64, 0x23, 0x31, 0x34, 0x38, 0x00, 0x00, 0x09, 0x01, 0x91, 0xE6, 0x00, 0x00, 0x04, 0x01,
+    0x92, 0xA1, 0xE1, 0x12, 0x01, 0x92, 0xB2, 0x21, 0x32, 0x05, 0xE2, 0x30, 0x4C, 0x01, 0x92, 0xBA,
+    0x01, 0x92, 0xBA, 0xE2, 0x1A, 0x4C, 0x00, 0x9B, 0xD1, 0x01, 0x92, 0xC3, 0x21, 0x2B, 0x09, 0xA1,
+    0x2C, 0x03, 0x65, 0x19, 0x31, 0x32, 0x34, 0x39, 0x00, 0x00, 0x18, 0x01, 0x75, 0xF6, 0x00, 0x00,
+    0x03, 0x01, 0x92, 0x99, 0x01, 0x92, 0x8C, 0xE1, 0x31, 0x01, 0x8E, 0xCF, 0x66, 0x19, 0x21, 0x23,
+    0x25, 0x32, 0x38, 0x00, 0xB7, 0x95, 0x01, 0x92, 0xEC, 0x00, 0x00, 0x05, 0x01, 0x90, 0x5C, 0x01,
+    0x92, 0xA6, 0x01, 0x5D, 0x92, 0x61, 0x48, 0x01, 0x92, 0x99, 0x21, 0x35, 0x05, 0x62, 0x04, 0x28,
+    0x01, 0x93, 0x0D, 0x01, 0x93, 0x0D, 0x21, 0x22, 0x79, 0x21, 0x35, 0x03, 0x6B, 0x02, 0x08, 0x0A,
+    0x0B, 0x14, 0x17, 0x1E, 0x21, 0x27, 0x28, 0x2B, 0x00, 0xD7, 0x8C, 0x01, 0x92, 0xAD, 0x00, 0x00,
+    0x12, 0x01, 0x92, 0xAD, 0x01, 0x3C, 0x9C, 0x01, 0x92, 0x97, 0x01, 0x92, 0x97, 0x01, 0x92, 0xE3,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0x90, 0x0E, 0x62, 0x04, 0x2A, 0x01, 0x59, 0xF5, 0x01,
+    0x8F, 0xDE, 0x61, 0x2D, 0x01, 0x93, 0x45, 0x21, 0x1A, 0x05, 0xFF, 0x24, 0x01, 0x02, 0x04, 0x06,
+    0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x40, 0x41, 0x42, 0x44,
+    0x00, 0x04, 0x7B, 0x00, 0x04, 0x62, 0x00, 0x04, 0x4A, 0x01, 0x90, 0x48, 0x00, 0x04, 0x34, 0x00,
+    0x04, 0x01, 0x00, 0x03, 0xA1, 0x01, 0x4E, 0x54, 0x00, 0x03, 0x8B, 0x01, 0x6E, 0x4F, 0x00, 0x03,
+    0x66, 0x00, 0x03, 0x58, 0x00, 0x03, 0x42, 0x00, 0x03, 0x30, 0x00, 0x03, 0x20, 0x00, 0x03, 0x0B,
+    0x00, 0x02, 0xF4, 0x00, 0x02, 0xC9, 0x00, 0x02, 0xBC, 0x00, 0x02, 0xAF, 0x00, 0x02, 0xA2, 0x00,
+    0x02, 0x84, 0x00, 0x02, 0x77, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x43, 0x00, 0x00, 0xF6, 0x00, 0x00,
+    0xCF, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x88, 0x00, 0x00, 0x6E, 0x00, 0xF4, 0x5E,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x11, 0x01, 0x79, 0x97, 0x00, 0x00, 0x03, 0x61, 0x23, 0x01, 0x61,
+    0xEF, 0x61, 0x2A, 0x01, 0x39, 0xC8, 0xE3, 0x1C, 0x27, 0x28, 0x01, 0x93, 0x98, 0x01, 0x81, 0x87,
+    0x00, 0xF6, 0xE7, 0x22, 0x19, 0x22, 0x12, 0x0D, 0x62, 0x08, 0x16, 0x00, 0xA8, 0xB1, 0x01, 0x94,
+    0x08, 0x66, 0x14, 0x19, 0x23, 0x27, 0x32, 0x34, 0x01, 0x94, 0x11, 0x01, 0x8F, 0xEC, 0x00, 0x00,
+    0x25, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x01, 0x57, 0x7B, 0x64, 0x19, 0x23, 0x30, 0x31, 0x01,
+    0x94, 0x2A, 0x01, 0x94, 0x1D, 0x00, 0x12, 0x84, 0x01, 0x93, 0xF1, 0x64, 0x23, 0x24, 0x2B, 0x32,
+    0x01, 0x94, 0x3B, 0x01, 0x91, 0x2D, 0x01, 0x71, 0x63, 0x01, 0x45, 0x94, 0x61, 0x20, 0x01, 0x93,
+    0xF7, 0xEB, 0x19, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x2D, 0x40, 0x41, 0x44, 0x00, 0x00, 0x40,
+    0x01, 0x04, 0xB1, 0x00, 0x00, 0x27, 0x00, 0x00, 0x16, 0x01, 0x88, 0x7E, 0x01, 0x61, 0x13, 0x01,
+    0x93, 0xEB, 0x01, 0x61, 0x73, 0x00, 0x00, 0x05, 0x01, 0x63, 0xC2, 0x01, 0x91, 0x1E, 0x61, 0x08,
+    0x01, 0x2B, 0x71, 0xA1, 0x40, 0x05, 0x21, 0x4C, 0x03, 0xE3, 0x04, 0x2D, 0x41, 0x00, 0x00, 0x03,
+    0x01, 0x94, 0x43, 0x01, 0x8C, 0xE2, 0x62, 0x23, 0x32, 0x01, 0x20, 0x1A, 0x01, 0x94, 0x96, 0x21,
+    0x09, 0x09, 0xE1, 0x32, 0x01, 0x04, 0x6D, 0x21, 0x10, 0x05, 0x61, 0x07, 0x01, 0x72, 0xF5, 0x21,
+    0x34, 0x05, 0xE3, 0x14, 0x2D, 0x42, 0x00, 0x00, 0x03, 0x01, 0x88, 0xA2, 0x00, 0xA6, 0xB8, 0x61,
+    0x1A, 0x01, 0x69, 0x8D, 0x21, 0x40, 0x05, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x62, 0x23, 0x2D,
+    0x01, 0x69, 0x9B, 0x00, 0x00, 0x03, 0x21, 0x17, 0x09, 0x63, 0x16, 0x32, 0x40, 0x01, 0x94, 0x13,
+    0x01, 0x2E, 0x04, 0x00, 0x00, 0x03, 0xE2, 0x1E, 0x24, 0x01, 0x94, 0x88, 0x01, 0x91, 0xB9, 0x21,
+    0x34, 0x09, 0x62, 0x18, 0x30, 0x00, 0x00, 0x03, 0x01, 0x7A, 0x1C, 0x61, 0x39, 0x01, 0x27, 0xAE,
+    0x41, 0x42, 0xF6, 0x66, 0x21, 0x34, 0x04, 0x41, 0x0A, 0xB6, 0xC2, 0x62, 0x2B, 0x40, 0x01, 0x93,
+    0xD3, 0x00, 0x00, 0x04, 0x62, 0x07, 0x34, 0x01, 0x49, 0x4D, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01,
+    0x2C, 0x10, 0xE2, 0x23, 0x40, 0x01, 0x8B, 0xD4, 0x00, 0x00, 0x05, 0x61, 0x07, 0x01, 0x91, 0xE7,
+    0x21, 0x31, 0x05, 0x62, 0x2A, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x95, 0x33, 0xA1, 0x22, 0x09, 0xE6,
+    0x18, 0x1E, 0x27, 0x32, 0x35, 0x4C, 0x01, 0x3A, 0xEB, 0x01, 0x84, 0x71, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x1D, 0x00, 0x00, 0x03, 0x01, 0x93, 0x87, 0x61, 0x21, 0x01, 0x7B, 0xCC, 0x66, 0x19, 0x1C,
+    0x23, 0x32, 0x38, 0x4C, 0x01, 0x70, 0x21, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x05,
+    0x01, 0x95, 0x5D, 0x01, 0x95, 0x5D, 0x61, 0x40, 0x01, 0x6F, 0x7D, 0x21, 0x32, 0x05, 0x41, 0x4C,
+    0x88, 0xB2, 0x21, 0x23, 0x04, 0x22, 0x23, 0x2D, 0x0A, 0x03, 0x61, 0x1B, 0x01, 0x2E, 0x5E, 0xA1,
+    0x42, 0x05, 0x62, 0x32, 0x41, 0x00, 0x00, 0x03, 0x01, 0x65, 0x03, 0x61, 0x1E, 0x01, 0x2E, 0x6F,
+    0x21, 0x42, 0x05, 0x21, 0x19, 0x03, 0xE3, 0x19, 0x21, 0x41, 0x00, 0x00, 0x14, 0x01, 0x95, 0xA6,
+    0x00, 0x00, 0x03, 0x21, 0x22, 0x0D, 0x21, 0x35, 0x03, 0x62, 0x19, 0x1F, 0x01, 0x2C, 0xAC, 0x01,
+    0x82, 0x9B, 0xA1, 0x40, 0x09, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x63, 0x19,
+    0x1A, 0x1F, 0x01, 0x2C, 0xC1, 0x01, 0x6A, 0x9C, 0x01, 0x82, 0xB0, 0x21, 0x40, 0x0D, 0x21, 0x4C,
+    0x03, 0x21, 0x23, 0x03, 0x62, 0x25, 0x2D, 0x01, 0x95, 0xE4, 0x00, 0x00, 0x03, 0x23, 0x14, 0x15,
+    0x17, 0x37, 0x22, 0x09, 0x61, 0x40, 0x01, 0x15, 0x0E, 0x21, 0x35, 0x05, 0x21, 0x19, 0x03, 0x21,
+    0x14, 0x03, 0xEA, 0x0B, 0x14, 0x17, 0x18, 0x19, 0x1E, 0x1F, 0x31, 0x40, 0x42, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0xA5, 0x01, 0x8B, 0x98, 0x01, 0x95, 0xE6, 0x01, 0x54, 0x5D, 0x00,
+    0x00, 0x7D, 0x01, 0x95, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0x61, 0x22, 0x01, 0x95, 0xCD,
+    0x21, 0x35, 0x05, 0x21, 0x23, 0x03, 0x21, 0x40, 0x03, 0x62, 0x2D, 0x35, 0x01, 0x71, 0x3E, 0x00,
+    0x00, 0x03, 0x61, 0x25, 0x01, 0x59, 0x4C, 0x61, 0x21, 0x01, 0x94, 0x16, 0x44, 0x1A, 0x1E, 0x31,
+    0x40, 0xF7, 0x2B, 0x00, 0x13, 0x00, 0x0A, 0x00, 0x05, 0x61, 0x32, 0x01, 0x0E, 0x25, 0x62, 0x22,
+    0x40, 0x00, 0x00, 0x05, 0x01, 0x46, 0xD1, 0x62, 0x31, 0x34, 0x01, 0x96, 0x66, 0x00, 0x00, 0x09,
+    0x41, 0x2D, 0xD3, 0x6C, 0x21, 0x19, 0x04, 0x21, 0x34, 0x03, 0x61, 0x21, 0x01, 0x75, 0x2E, 0x64,
+    0x25, 0x39, 0x40, 0x44, 0x00, 0x00, 0x08, 0x01, 0x96, 0x7F, 0x00, 0x00, 0x05, 0x01, 0x5F, 0x37,
+    0x61, 0x35, 0x01, 0x71, 0xE0, 0x61, 0x0F, 0x01, 0x24, 0xBD, 0x61, 0x1A, 0x01, 0x87, 0x0F, 0x21,
+    0x19, 0x05, 0x62, 0x23, 0x31, 0x01, 0x95, 0xDC, 0x00, 0x00, 0x03, 0x61, 0x40, 0x01, 0x57, 0x02,
+    0xE3, 0x22, 0x30, 0x32, 0x01, 0x96, 0x2B, 0x01, 0x96, 0xB0, 0x00, 0xC0, 0x45, 0x21, 0x22, 0x0D,
+    0xE4, 0x20, 0x30, 0x32, 0x34, 0x01, 0x55, 0xCE, 0x01, 0x96, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00,
+    0x03, 0xE1, 0x32, 0x01, 0x77, 0x9B, 0x21, 0x21, 0x05, 0x21, 0x32, 0x03, 0x61, 0x01, 0x01, 0x78,
+    0xE9, 0xE7, 0x15, 0x23, 0x25, 0x2A, 0x34, 0x35, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x08, 0x01, 0x96, 0x7B, 0x01, 0x96, 0xE1, 0x01, 0x96, 0xE1, 0x00, 0x00, 0x05, 0x61, 0x25,
+    0x01, 0x46, 0x3B, 0x21, 0x2B, 0x05, 0x21, 0x40, 0x03, 0x21, 0x34, 0x03, 0x21, 0x2D, 0x03, 0x21,
+    0x01, 0x03, 0x21, 0x31, 0x03, 0x63, 0x21, 0x23, 0x25, 0x01, 0x4D, 0x95, 0x01, 0x4D, 0x9C, 0x00,
+    0x00, 0x03, 0x41, 0x19, 0xAF, 0x59, 0x21, 0x2D, 0x04, 0x21, 0x23, 0x03, 0x63, 0x15, 0x17, 0x42,
+    0x00, 0xF6, 0x7E, 0x00, 0x00, 0x03, 0x01, 0x55, 0xD5, 0x21, 0x01, 0x0D, 0x21, 0x47, 0x03, 0x64,
+    0x0B, 0x17, 0x25, 0x2B, 0x01, 0x95, 0x5B, 0x01, 0x79, 0xEC, 0x00, 0x00, 0x03, 0x01, 0x95, 0xC7,
+    0x61, 0x21, 0x01, 0x64, 0x8F, 0x77, 0x01, 0x07, 0x08, 0x09, 0x0A, 0x0F, 0x10, 0x13, 0x14, 0x15,
+    0x17, 0x19, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x40, 0x48, 0x01, 0x97, 0x55,
+    0x00, 0x02, 0xCC, 0x00, 0x02, 0xB6, 0x01, 0x96, 0x53, 0x01, 0x85, 0x8B, 0x00, 0x02, 0xAE, 0x01,
+    0x96, 0x7F, 0x01, 0x97, 0x55, 0x00, 0x02, 0xA3, 0x00, 0x02, 0x7C, 0x00, 0x02, 0x63, 0x00, 0x01,
+    0x53, 0x00, 0x01, 0x09, 0x00, 0x51, 0x50, 0x00, 0x00, 0xEE, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xC5,
+    0x00, 0xE0, 0x88, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x40, 0x00, 0x00, 0x16, 0x00,
+    0x00, 0x05, 0xE4, 0x0A, 0x32, 0x49, 0x4B, 0x01, 0x6C, 0x47, 0x01, 0x97, 0xB2, 0x01, 0x97, 0x5D,
+    0x01, 0x81, 0x81, 0x61, 0x34, 0x01, 0x59, 0x27, 0x21, 0x21, 0x05, 0x21, 0x40, 0x03, 0x21, 0x21,
+    0x03, 0x21, 0x2D, 0x03, 0x62, 0x34, 0x39, 0x01, 0x93, 0xA8, 0x01, 0x97, 0x55, 0x41, 0x44, 0x10,
+    0xBE, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0x41, 0x07, 0xC8, 0x64, 0x21, 0x38, 0x04, 0x21, 0x15,
+    0x03, 0x21, 0x07, 0x03, 0x63, 0x32, 0x38, 0x39, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x01, 0x97,
+    0xBB, 0x61, 0x17, 0x01, 0x93, 0xD8, 0x21, 0x44, 0x05, 0x63, 0x21, 0x34, 0x38, 0x01, 0x98, 0x09,
+    0x00, 0x00, 0x03, 0x01, 0x93, 0x10, 0x61, 0x18, 0x01, 0x34, 0x04, 0x21, 0x40, 0x05, 0x21, 0x27,
+    0x03, 0x61, 0x41, 0x01, 0x89, 0xAC, 0x21, 0x22, 0x05, 0x21, 0x38, 0x03, 0x21, 0x09, 0x03, 0x21,
+    0x22, 0x03, 0x62, 0x48, 0x49, 0x00, 0x00, 0x03, 0x01, 0x96, 0x23, 0x63, 0x2D, 0x34, 0x38, 0x01,
+    0x98, 0x31, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x09, 0x61, 0x43, 0x01, 0x85, 0x2A, 0x21, 0x35, 0x05,
+    0x21, 0x2D, 0x03, 0x21, 0x01, 0x03, 0xE3, 0x1B, 0x32, 0x38, 0x01, 0x98, 0x56, 0x01, 0x7E, 0xE7,
+    0x00, 0x00, 0x03, 0x62, 0x23, 0x25, 0x01, 0x90, 0xBC, 0x01, 0x97, 0x9D, 0x62, 0x47, 0x49, 0x01,
+    0x98, 0x1D, 0x01, 0x98, 0x06, 0x61, 0x25, 0x01, 0x89, 0x08, 0x61, 0x17, 0x01, 0x73, 0x55, 0x21,
+    0x01, 0x05, 0x61, 0x02, 0x01, 0x95, 0x17, 0x21, 0x30, 0x05, 0x21, 0x02, 0x03, 0x21, 0x40, 0x03,
+    0x21, 0x30, 0x03, 0x62, 0x25, 0x47, 0x00, 0x00, 0x03, 0x01, 0x98, 0x5A, 0x6B, 0x01, 0x08, 0x14,
+    0x15, 0x17, 0x1B, 0x1E, 0x21, 0x25, 0x27, 0x2B, 0x01, 0x93, 0xA3, 0x01, 0x98, 0x2D, 0x01, 0x77,
+    0x50, 0x01, 0x98, 0x44, 0x01, 0x7B, 0x49, 0x00, 0x00, 0x30, 0x01, 0x98, 0x36, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x1D, 0x01, 0x8B, 0x73, 0x00, 0x00, 0x09, 0xE2, 0x48, 0x49, 0x01, 0x98, 0xC9, 0x01,
+    0x98, 0xC9, 0x64, 0x01, 0x1B, 0x25, 0x2D, 0x00, 0x00, 0x09, 0x01, 0x95, 0x67, 0x01, 0x94, 0x48,
+    0x01, 0x94, 0x80, 0x62, 0x49, 0x4A, 0x01, 0x98, 0xD9, 0x01, 0x95, 0x78, 0x61, 0x02, 0x01, 0x7F,
+    0x29, 0x21, 0x40, 0x05, 0x21, 0x01, 0x03, 0x21, 0x25, 0x03, 0x21, 0x02, 0x03, 0x21, 0x42, 0x03,
+    0x21, 0x01, 0x03, 0x21, 0x25, 0x03, 0x66, 0x01, 0x15, 0x19, 0x1B, 0x25, 0x2B, 0x00, 0x00, 0x23,
+    0x01, 0x98, 0x87, 0x01, 0x99, 0x06, 0x01, 0x98, 0xFC, 0x01, 0x98, 0xFC, 0x00, 0x00, 0x03, 0xE1,
+    0x2D, 0x01, 0x19, 0x73, 0xF7, 0x01, 0x04, 0x08, 0x09, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x21, 0x22,
+    0x23, 0x25, 0x28, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x01, 0x72, 0x00,
+    0x01, 0x53, 0x00, 0x01, 0x50, 0x01, 0x98, 0x22, 0x01, 0x7E, 0xA0, 0x01, 0x89, 0x80, 0x01, 0x6D,
+    0xB9, 0x00, 0x01, 0x30, 0x00, 0xEC, 0xB0, 0x01, 0x99, 0x0B, 0x00, 0x53, 0x1F, 0x00, 0x01, 0x1B,
+    0x00, 0x00, 0xE9, 0x01, 0x02, 0x39, 0x00, 0x00, 0xCE, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0x52, 0x00, 0x00, 0x1E, 0x01, 0x99, 0x24, 0x01, 0x99, 0x24, 0x01, 0x98, 0xD5, 0x00, 0x00,
+    0x05, 0xE2, 0x17, 0x2D, 0x01, 0x65, 0x2A, 0x01, 0x72, 0xFE, 0xE3, 0x21, 0x23, 0x2D, 0x01, 0x98,
+    0x8B, 0x01, 0x6D, 0x3C, 0x01, 0x99, 0x2C, 0xE2, 0x2D, 0x43, 0x01, 0x99, 0x45, 0x01, 0x97, 0x66,
+    0x61, 0x1A, 0x01, 0x99, 0x45, 0x21, 0x32, 0x05, 0x21, 0x1A, 0x03, 0x61, 0x48, 0x01, 0x99, 0x5C,
+    0x21, 0x36, 0x05, 0x21, 0x17, 0x03, 0x62, 0x07, 0x14, 0x01, 0x99, 0xB6, 0x00, 0x00, 0x03, 0xE8,
+    0x01, 0x07, 0x14, 0x19, 0x21, 0x48, 0x49, 0x4A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x35, 0x00, 0x00,
+    0x28, 0x01, 0x99, 0xBF, 0x00, 0x00, 0x17, 0x01, 0x99, 0xB5, 0x00, 0x00, 0x09, 0x01, 0x99, 0xBE,
+    0xE1, 0x2D, 0x01, 0x8F, 0x32, 0xE1, 0x2D, 0x01, 0x99, 0x90, 0x64, 0x14, 0x2D, 0x48, 0x49, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0x99, 0xB1, 0x01, 0x38, 0xF7, 0x41, 0x32, 0xEA, 0x06, 0x61,
+    0x23, 0x01, 0x42, 0xBB, 0x21, 0x01, 0x05, 0xE5, 0x01, 0x09, 0x24, 0x25, 0x2D, 0x00, 0x00, 0x0C,
+    0x00, 0x00, 0x03, 0x00, 0x1B, 0x01, 0x01, 0x99, 0xA1, 0x01, 0x27, 0xCB, 0x61, 0x32, 0x01, 0x97,
+    0x1F, 0x61, 0x09, 0x01, 0x98, 0x23, 0xE4, 0x08, 0x09, 0x32, 0x40, 0x00, 0x00, 0x0A, 0x01, 0x97,
+    0x42, 0x01, 0x99, 0xD7, 0x00, 0x00, 0x05, 0x61, 0x39, 0x01, 0x99, 0xCE, 0x21, 0x1A, 0x05, 0x21,
+    0x21, 0x03, 0x61, 0x1A, 0x01, 0x0D, 0x12, 0x22, 0x38, 0x40, 0x08, 0x05, 0x61, 0x01, 0x01, 0x42,
+    0x52, 0x21, 0x32, 0x05, 0x41, 0x10, 0xD8, 0xC5, 0xE4, 0x20, 0x30, 0x32, 0x34, 0x01, 0x61, 0x7E,
+    0x01, 0x9A, 0x58, 0x01, 0x99, 0x1D, 0x01, 0x87, 0x3A, 0xC1, 0x42, 0xF3, 0xC4, 0x22, 0x2B, 0x32,
+    0x15, 0x04, 0xE6, 0x01, 0x04, 0x22, 0x28, 0x2A, 0x40, 0x01, 0x25, 0x8E, 0x01, 0x75, 0x96, 0x01,
+    0x99, 0xED, 0x01, 0x7A, 0xA8, 0x01, 0x50, 0x23, 0x00, 0x7A, 0xED, 0xE1, 0x18, 0x01, 0x5D, 0xFC,
+    0xE5, 0x21, 0x23, 0x2B, 0x2D, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x05, 0x01, 0x5F, 0x58, 0x01,
+    0x64, 0x54, 0x01, 0x99, 0x6B, 0x41, 0x34, 0xF4, 0xC4, 0x63, 0x14, 0x32, 0x34, 0x00, 0x00, 0x04,
+    0x01, 0x9A, 0xA9, 0x01, 0x9A, 0xA9, 0xC1, 0x28, 0xFD, 0xA7, 0x21, 0x21, 0x04, 0x21, 0x23, 0x03,
+    0x21, 0x23, 0x03, 0xE2, 0x01, 0x30, 0x00, 0x00, 0x03, 0x01, 0x9A, 0xC3, 0x21, 0x2B, 0x09, 0x42,
+    0x32, 0x48, 0x00, 0x03, 0x95, 0x92, 0x61, 0x21, 0x01, 0x89, 0x02, 0x21, 0x22, 0x05, 0x21, 0x34,
+    0x03, 0xA1, 0x19, 0x03, 0x68, 0x14, 0x15, 0x1A, 0x1E, 0x23, 0x25, 0x2A, 0x38, 0x00, 0xE1, 0xC5,
+    0x01, 0x04, 0xDF, 0x01, 0x9A, 0x86, 0x01, 0x95, 0xB9, 0x00, 0x00, 0x3B, 0x01, 0x84, 0xC1, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x03, 0xE3, 0x20, 0x27, 0x28, 0x01, 0x7F, 0x82, 0x01, 0x89, 0x34, 0x01,
+    0x88, 0xE7, 0x62, 0x23, 0x31, 0x01, 0x90, 0x33, 0x01, 0x98, 0xE1, 0x62, 0x15, 0x19, 0x01, 0x9A,
+    0xD5, 0x01, 0x9B, 0x1B, 0x21, 0x32, 0x09, 0x62, 0x19, 0x23, 0x01, 0x9A, 0x61, 0x01, 0x91, 0xD9,
+    0x21, 0x32, 0x09, 0xE2, 0x18, 0x23, 0x00, 0x00, 0x03, 0x01, 0x00, 0xE2, 0x62, 0x0A, 0x22, 0x01,
+    0x9B, 0x3C, 0x00, 0x00, 0x09, 0x63, 0x19, 0x23, 0x2B, 0x01, 0x9B, 0x45, 0x01, 0x9B, 0x45, 0x01,
+    0x89, 0x24, 0x41, 0x23, 0xF5, 0x04, 0x21, 0x1E, 0x04, 0x21, 0x21, 0x03, 0xEB, 0x01, 0x17, 0x18,
+    0x1A, 0x22, 0x23, 0x25, 0x31, 0x32, 0x34, 0x38, 0x00, 0x00, 0x57, 0x01, 0x92, 0x0E, 0x00, 0x00,
+    0x4A, 0x00, 0x00, 0x38, 0x01, 0x9B, 0x01, 0x01, 0x9B, 0x5C, 0x01, 0x98, 0xDF, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x17, 0x01, 0x9A, 0xD7, 0x00, 0x00, 0x03, 0x62, 0x31, 0x32, 0x01, 0x01, 0x3C, 0x01,
+    0x02, 0xDE, 0xA1, 0x23, 0x09, 0xE2, 0x20, 0x40, 0x01, 0x80, 0x12, 0x01, 0x51, 0x0A, 0x21, 0x34,
+    0x09, 0x21, 0x15, 0x03, 0xE1, 0x27, 0x01, 0x9B, 0x88, 0x63, 0x17, 0x22, 0x2A, 0x00, 0x00, 0x05,
+    0x01, 0x9B, 0xA9, 0x00, 0xF4, 0x52, 0xE6, 0x25, 0x2D, 0x30, 0x31, 0x32, 0x4A, 0x00, 0x00, 0x24,
+    0x01, 0x96, 0x70, 0x01, 0x9B, 0xB6, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0D, 0x01, 0x98, 0x4B, 0x62,
+    0x13, 0x21, 0x01, 0x9B, 0xB3, 0x01, 0x9B, 0xCF, 0x41, 0x23, 0x8E, 0x87, 0x43, 0x23, 0x32, 0x34,
+    0x00, 0x0D, 0x00, 0x04, 0x45, 0x39, 0x41, 0x20, 0x63, 0x40, 0x21, 0x21, 0x04, 0x21, 0x31, 0x03,
+    0x63, 0x21, 0x32, 0x39, 0x01, 0x9B, 0xF0, 0x01, 0x9B, 0xB7, 0x01, 0x98, 0xE2, 0x63, 0x31, 0x32,
+    0x34, 0x01, 0x9B, 0x42, 0x01, 0x98, 0x8E, 0x01, 0x0F, 0x8E, 0x62, 0x31, 0x32, 0x01, 0x9B, 0x4F,
+    0x01, 0x82, 0x9B, 0x62, 0x01, 0x0A, 0x01, 0x9B, 0xCD, 0x01, 0x9C, 0x13, 0x62, 0x32, 0x34, 0x00,
+    0x00, 0x09, 0x01, 0x3F, 0xE5, 0x41, 0x1B, 0xBB, 0x5B, 0x21, 0x21, 0x04, 0x64, 0x07, 0x21, 0x23,
+    0x31, 0x01, 0x89, 0x66, 0x01, 0x47, 0xF8, 0x01, 0x7D, 0x2A, 0x00, 0x00, 0x03, 0x41, 0x22, 0x6F,
+    0xD5, 0x21, 0x32, 0x04, 0x21, 0x0C, 0x03, 0x41, 0x32, 0x6D, 0x4B, 0x21, 0x10, 0x04, 0xC1, 0x31,
+    0xB2, 0xE3, 0x21, 0x27, 0x04, 0x23, 0x0A, 0x0F, 0x17, 0x11, 0x0A, 0x03, 0x62, 0x13, 0x17, 0x01,
+    0x9C, 0x5C, 0x01, 0x9C, 0x01, 0x61, 0x01, 0x01, 0x91, 0xFB, 0x63, 0x20, 0x22, 0x25, 0x01, 0x89,
+    0x80, 0x01, 0x89, 0x80, 0x00, 0x00, 0x05, 0xF0, 0x01, 0x08, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x21,
+    0x23, 0x2A, 0x2E, 0x31, 0x32, 0x40, 0x42, 0x44, 0x00, 0x00, 0x9B, 0x01, 0x9B, 0x3F, 0x00, 0x00,
+    0x8A, 0x00, 0x00, 0x87, 0x01, 0x87, 0xB1, 0x00, 0x00, 0x7A, 0x01, 0x9C, 0x19, 0x00, 0x00, 0x6D,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x4B, 0x01, 0x91, 0xC9, 0x00, 0x00, 0x22, 0x00, 0x00, 0x1B, 0x01,
+    0x56, 0xA7, 0x00, 0x00, 0x0D, 0x01, 0x68, 0xFC, 0xE2, 0x22, 0x42, 0x01, 0x64, 0x59, 0x01, 0x7B,
+    0xE1, 0x61, 0x15, 0x01, 0x9A, 0x9E, 0x21, 0x38, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x07, 0x03, 0xE8,
+    0x04, 0x13, 0x1E, 0x2A, 0x30, 0x31, 0x32, 0x38, 0x01, 0x9C, 0xCF, 0x01, 0x9C, 0xCF, 0x01, 0x9C,
+    0x09, 0x01, 0x9C, 0xCF, 0x01, 0x9C, 0xCF, 0x00, 0x00, 0x03, 0x01, 0x9C, 0xCF, 0x01, 0x9C, 0xCF,
+    0x65, 0x1B, 0x32, 0x34, 0x39, 0x42, 0x00, 0xD8, 0x02, 0x00, 0xD1, 0x54, 0x01, 0x9C, 0xA1, 0x01,
+    0x9C, 0xEF, 0x01, 0x8C, 0x6A, 0xE2, 0x01, 0x35, 0x01, 0x9C, 0xBF, 0x01, 0x8A, 0x9D, 0x63, 0x13,
+    0x21, 0x32, 0x00, 0x00, 0x09, 0x01, 0x9D, 0x0E, 0x01, 0x9D, 0x0E, 0xE2, 0x20, 0x21, 0x01, 0x9D,
+    0x1B, 0x01, 0x9D, 0x1B, 0x64, 0x20, 0x27, 0x32, 0x38, 0x01, 0x9D, 0x24, 0x01, 0x99, 0xB9, 0x01,
+    0x9D, 0x24, 0x00, 0x00, 0x09, 0x62, 0x23, 0x25, 0x01, 0x8F, 0x54, 0x01, 0x99, 0x1D, 0x62, 0x01,
+    0x28, 0x01, 0x99, 0xD3, 0x01, 0x9D, 0x3E, 0x61, 0x01, 0x01, 0x6A, 0x57, 0x62, 0x15, 0x21, 0x01,
+    0x9A, 0x68, 0x01, 0x9C, 0xBB, 0x23, 0x17, 0x1A, 0x2B, 0x17, 0x0E, 0x09, 0x64, 0x06, 0x1A, 0x21,
+    0x25, 0x01, 0x79, 0x5D, 0x00, 0xB9, 0x67, 0x01, 0x40, 0x1B, 0x01, 0x9D, 0x5B, 0x41, 0x23, 0x02,
+    0xB7, 0x62, 0x19, 0x22, 0x00, 0xCA, 0x9C, 0x01, 0x9D, 0x71, 0xE3, 0x0A, 0x1C, 0x2A, 0x01, 0x9D,
+    0x61, 0x01, 0x9D, 0x6D, 0x01, 0x9B, 0x6B, 0xE1, 0x2D, 0x01, 0x2A, 0x5B, 0x63, 0x07, 0x21, 0x22,
+    0x01, 0x18, 0x43, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0xFF, 0x1F, 0x01, 0x04, 0x08, 0x0A, 0x0B,
+    0x0C, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29,
+    0x2A, 0x2B, 0x2C, 0x40, 0x41, 0x42, 0x44, 0x48, 0x49, 0x4A, 0x00, 0x03, 0x92, 0x01, 0x69, 0xFF,
+    0x00, 0x03, 0x73, 0x01, 0x9A, 0xB5, 0x00, 0x03, 0x52, 0x00, 0x03, 0x48, 0x00, 0x03, 0x45, 0x00,
+    0x03, 0x2C, 0x00, 0x03, 0x09, 0x00, 0x02, 0xB5, 0x00, 0x02, 0x3D, 0x01, 0x07, 0xC4, 0x00, 0x01,
+    0xE3, 0x00, 0x01, 0x22, 0x01, 0x82, 0x16, 0x01, 0x40, 0x58, 0x00, 0x00, 0xE1, 0x00, 0x00, 0xCA,
+    0x00, 0x00, 0xA9, 0x01, 0x9A, 0x2E, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x75, 0x00, 0x00, 0x64, 0x01,
+    0x9C, 0x61, 0x00, 0x00, 0x44, 0x00, 0xDE, 0x19, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2C, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x0D, 0x01, 0x9C, 0xDE, 0x41, 0x2D, 0x86, 0x68, 0x21, 0x27, 0x04, 0x61, 0x39,
+    0x01, 0x72, 0xE5, 0x61, 0x19, 0x01, 0x65, 0x63, 0x61, 0x01, 0x01, 0x36, 0xDF, 0x64, 0x17, 0x1A,
+    0x1E, 0x2E, 0x01, 0x38, 0x10, 0x01, 0x72, 0xFB, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x23, 0x04,
+    0x2D, 0x40, 0x23, 0x20, 0x11, 0x21, 0x25, 0x07, 0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x62, 0x32,
+    0x38, 0x01, 0x67, 0x02, 0x01, 0x9E, 0x4E, 0x61, 0x32, 0x01, 0x64, 0xA8, 0x21, 0x1A, 0x05, 0x21,
+    0x19, 0x03, 0x21, 0x32, 0x03, 0x41, 0x23, 0xA8, 0x16, 0x21, 0x42, 0x04, 0x21, 0x32, 0x03, 0x61,
+    0x01, 0x01, 0x9E, 0x56, 0x21, 0x39, 0x05, 0x21, 0x14, 0x03, 0x21, 0x32, 0x03, 0x21, 0x01, 0x03,
+    0x21, 0x32, 0x03, 0x41, 0x07, 0xB3, 0x5D, 0x21, 0x2D, 0x04, 0xE3, 0x17, 0x19, 0x25, 0x00, 0x00,
+    0x03, 0x01, 0x7D, 0xEA, 0x01, 0x9A, 0x7C, 0xE1, 0x2D, 0x01, 0x80, 0x01, 0x61, 0x2D, 0x01, 0x99,
+    0x0A, 0xEC, 0x10, 0x14, 0x19, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2D, 0x48, 0x49, 0x4B, 0x01, 0x9E,
+    0xA1, 0x01, 0x9E, 0xA1, 0x00, 0x00, 0x56, 0x01, 0x9E, 0xA1, 0x01, 0x9E, 0xA1, 0x00, 0x00, 0x53,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x35, 0x00, 0x00, 0x21, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0A, 0x00,
+    0x00, 0x05, 0x61, 0x25, 0x01, 0x90, 0xE6, 0xE2, 0x04, 0x1B, 0x01, 0x8E, 0x1F, 0x00, 0x6D, 0x83,
+    0x41, 0x19, 0x8D, 0x2A, 0x21, 0x2D, 0x04, 0x22, 0x01, 0x08, 0x10, 0x03, 0x61, 0x2B, 0x01, 0x8A,
+    0x26, 0x62, 0x31, 0x32, 0x01, 0x9E, 0xB8, 0x01, 0x30, 0x7B, 0x21, 0x01, 0x09, 0x21, 0x34, 0x03,
+    0x21, 0x23, 0x03, 0x61, 0x02, 0x01, 0x9C, 0x0A, 0xE2, 0x01, 0x02, 0x00, 0x00, 0x05, 0x01, 0x9F,
+    0x08, 0x46, 0x08, 0x19, 0x1B, 0x21, 0x27, 0x2A, 0x00, 0x3F, 0x00, 0x2A, 0x00, 0x25, 0x00, 0x11,
+    0x1A, 0x92, 0x00, 0x09, 0x61, 0x1B, 0x01, 0x65, 0x71, 0x21, 0x14, 0x05, 0x62, 0x0A, 0x14, 0x01,
+    0x9E, 0xC6, 0x01, 0x9C, 0x1A, 0x62, 0x20, 0x2B, 0x01, 0x9B, 0xCA, 0x01, 0x9B, 0xCA, 0x61, 0x2A,
+    0x01, 0x34, 0xBB, 0x66, 0x06, 0x13, 0x19, 0x25, 0x28, 0x2B, 0x00, 0x5B, 0x93, 0x01, 0x0F, 0x18,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x0E, 0x01, 0x9F, 0x42, 0x00, 0x00, 0x05, 0x41, 0x40, 0x18, 0xE4,
+    0x62, 0x1A, 0x1E, 0x00, 0x00, 0x04, 0x01, 0x62, 0x6A, 0x21, 0x2D, 0x09, 0x62, 0x38, 0x49, 0x01,
+    0x82, 0xB4, 0x01, 0x97, 0x4B, 0x62, 0x31, 0x39, 0x01, 0x9F, 0x26, 0x01, 0x9F, 0x75, 0x41, 0x42,
+    0xF8, 0xD9, 0x21, 0x38, 0x04, 0x21, 0x19, 0x03, 0x61, 0x1E, 0x01, 0x66, 0x42, 0xE7, 0x02, 0x19,
+    0x2B, 0x2D, 0x40, 0x41, 0x43, 0x01, 0x9F, 0x8D, 0x00, 0x00, 0x21, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x05, 0x01, 0x9F, 0x38, 0x01, 0x9D, 0x5C, 0x64, 0x07, 0x19, 0x21, 0x22, 0x01,
+    0x9F, 0xAA, 0x00, 0x00, 0x1D, 0x01, 0x9F, 0xAA, 0x01, 0x9F, 0xAA, 0x61, 0x2B, 0x01, 0x76, 0x05,
+    0x21, 0x07, 0x05, 0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x61, 0x1A, 0x01, 0x7F, 0x25, 0x21, 0x32,
+    0x05, 0xE3, 0x17, 0x25, 0x2D, 0x01, 0x9E, 0xC5, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xE1, 0x25,
+    0x01, 0x6B, 0x87, 0xE3, 0x07, 0x19, 0x27, 0x00, 0x00, 0x12, 0x01, 0x9F, 0xE3, 0x00, 0x00, 0x05,
+    0x64, 0x27, 0x2D, 0x32, 0x33, 0x01, 0x9D, 0xE1, 0x00, 0x00, 0x46, 0x00, 0x00, 0x0D, 0x01, 0x9F,
+    0xF0, 0xE1, 0x1E, 0x01, 0x9F, 0x3B, 0x62, 0x01, 0x19, 0x01, 0xA0, 0x06, 0x00, 0x00, 0x05, 0x61,
+    0x2D, 0x01, 0x98, 0xD6, 0xE3, 0x27, 0x2D, 0x41, 0x01, 0x9A, 0x62, 0x01, 0x94, 0x04, 0x00, 0x00,
+    0x05, 0xE2, 0x04, 0x2D, 0x00, 0xEE, 0xB9, 0x01, 0xA0, 0x20, 0xE2, 0x2A, 0x2D, 0x01, 0x95, 0x3A,
+    0x01, 0x88, 0xFA, 0x61, 0x2D, 0x01, 0x9F, 0xB4, 0xA4, 0x19, 0x21, 0x22, 0x41, 0x24, 0x17, 0x0E,
+    0x05, 0xE2, 0x27, 0x2D, 0x01, 0xA0, 0x31, 0x01, 0x9C, 0x5F, 0xE4, 0x07, 0x0B, 0x22, 0x27, 0x00,
+    0x00, 0x09, 0x01, 0x9D, 0xBA, 0x01, 0xA0, 0x4A, 0x01, 0xA0, 0x4A, 0x41, 0x2D, 0xF3, 0xE7, 0x66,
+    0x19, 0x21, 0x27, 0x2D, 0x32, 0x33, 0x01, 0xA0, 0x5F, 0x01, 0xA0, 0x5F, 0x00, 0x00, 0x59, 0x00,
+    0x00, 0x27, 0x00, 0x00, 0x15, 0x00, 0x00, 0x04, 0x62, 0x2D, 0x30, 0x01, 0xA0, 0x29, 0x01, 0xA0,
+    0x78, 0xE2, 0x07, 0x22, 0x01, 0xA0, 0x81, 0x01, 0xA0, 0x81, 0x21, 0x2D, 0x09, 0x7F, 0x2A, 0x01,
+    0x04, 0x07, 0x08, 0x0A, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21,
+    0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x40, 0x41, 0x42, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x25, 0x0A, 0x00, 0x24, 0xD0, 0x00,
+    0x24, 0x92, 0x00, 0x24, 0x67, 0x00, 0x24, 0x51, 0x01, 0x4D, 0xB7, 0x00, 0x24, 0x48, 0x00, 0x23,
+    0xFF, 0x00, 0x23, 0xC9, 0x00, 0x23, 0xBB, 0x00, 0x23, 0x61, 0x00, 0x20, 0xF8, 0x00, 0x20, 0xAA,
+    0x00, 0x20, 0x67, 0x00, 0x20, 0x38, 0x00, 0x1F, 0x05, 0x00, 0x1E, 0x8C, 0x00, 0x1E, 0x12, 0x00,
+    0x1C, 0xFA, 0x00, 0x1C, 0x68, 0x00, 0x1B, 0xFC, 0x00, 0x1B, 0x2E, 0x00, 0x1A, 0xEC, 0x00, 0x19,
+    0x69, 0x00, 0x17, 0xC5, 0x00, 0x12, 0x41, 0x00, 0x0D, 0x33, 0x00, 0x0C, 0x3C, 0x00, 0x09, 0x38,
+    0x00, 0x07, 0x69, 0x00, 0x06, 0xCE, 0x00, 0x06, 0xA3, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xEC, 0x00,
+    0x01, 0x7C, 0x00, 0x01, 0x64, 0x00, 0x01, 0x4A, 0x00, 0x01, 0x24, 0x00, 0x00, 0x9D, 0x00, 0x00,
+    0x2E, 0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0x41, 0x01, 0xD5, 0x58, 0x21, 0x40, 0x04, 0x63, 0x0B,
+    0x42, 0x44, 0x01, 0x20, 0xD5, 0x01, 0x40, 0x30, 0x01, 0x21, 0x49, 0x61, 0x14, 0x01, 0x62, 0xB6,
+    0x21, 0x40, 0x05, 0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0x21, 0x19, 0x03, 0x21, 0x4C, 0x03, 0x21,
+    0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0xE2, 0x19, 0x40, 0x01, 0x23, 0xA0, 0x00, 0x00,
+    0x03, 0xE1, 0x2E, 0x01, 0x88, 0xBD, 0x23, 0x07, 0x19, 0x1A, 0x38, 0x0E, 0x05, 0x61, 0x01, 0x01,
+    0x85, 0x14, 0x62, 0x01, 0x44, 0x01, 0x82, 0xEC, 0x00, 0x00, 0x05, 0x41, 0x40, 0x27, 0xFF, 0xE1,
+    0x14, 0x01, 0x97, 0x4F, 0x61, 0x23, 0x01, 0x5F, 0xAF, 0x21, 0x39, 0x05, 0x61, 0x39, 0x01, 0x83,
+    0x27, 0x21, 0x25, 0x05, 0x62, 0x14, 0x19, 0x01, 0xA1, 0xA4, 0x00, 0x00, 0x03, 0x63, 0x0A, 0x14,
+    0x42, 0x01, 0xA1, 0x94, 0x00, 0x00, 0x14, 0x00, 0x00, 0x09, 0x62, 0x19, 0x44, 0x01, 0xA1, 0x9E,
+    0x01, 0x94, 0x91, 0x62, 0x19, 0x42, 0x00, 0xC1, 0x78, 0x01, 0x0F, 0x58, 0x21, 0x4C, 0x09, 0x41,
+    0x27, 0xC7, 0xDE, 0x21, 0x35, 0x04, 0x61, 0x27, 0x01, 0x80, 0x5D, 0x64, 0x25, 0x31, 0x34, 0x41,
+    0x00, 0x00, 0x08, 0x00, 0x9C, 0xA6, 0x00, 0x00, 0x05, 0x01, 0x91, 0xBB, 0x69, 0x01, 0x07, 0x14,
+    0x15, 0x19, 0x22, 0x23, 0x25, 0x2A, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x61, 0x01, 0xA1, 0xEC, 0x00,
+    0x00, 0x5D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x32, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11, 0x01, 0xA1,
+    0xEC, 0x61, 0x2E, 0x01, 0xA1, 0x92, 0xE2, 0x2E, 0x44, 0x01, 0x2E, 0xEA, 0x00, 0x00, 0x05, 0x62,
+    0x01, 0x40, 0x01, 0x4F, 0xB1, 0x01, 0xA1, 0xC1, 0x61, 0x42, 0x01, 0x88, 0x24, 0x61, 0x19, 0x01,
+    0x24, 0x69, 0x66, 0x01, 0x07, 0x21, 0x25, 0x48, 0x49, 0x01, 0xA2, 0x32, 0x00, 0x00, 0x13, 0x01,
+    0xA2, 0x32, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0xA1, 0x2D, 0x61, 0x34, 0x01, 0xA0, 0x99,
+    0x62, 0x04, 0x40, 0x00, 0x00, 0x05, 0x01, 0xA2, 0x0A, 0x62, 0x01, 0x04, 0x01, 0xA2, 0x3D, 0x01,
+    0xA2, 0x3D, 0x21, 0x2A, 0x09, 0x21, 0x34, 0x03, 0xE2, 0x14, 0x41, 0x00, 0x00, 0x03, 0x01, 0x3F,
+    0x21, 0x61, 0x1F, 0x01, 0x68, 0x7D, 0x22, 0x14, 0x15, 0x0E, 0x05, 0x22, 0x32, 0x4C, 0x2B, 0x05,
+    0x61, 0x22, 0x01, 0x80, 0xCB, 0x21, 0x2D, 0x05, 0x62, 0x25, 0x4C, 0x00, 0x00, 0x03, 0x01, 0x8D,
+    0x12, 0x62, 0x19, 0x22, 0x01, 0xA2, 0x2B, 0x01, 0xA2, 0x91, 0x21, 0x32, 0x09, 0x61, 0x4C, 0x01,
+    0x77, 0x64, 0x21, 0x25, 0xCC, 0xE9, 0x19, 0x1B, 0x21, 0x23, 0x25, 0x27, 0x2B, 0x40, 0x42, 0x01,
+    0x9E, 0x97, 0x01, 0xA0, 0x15, 0x01, 0xA2, 0xA5, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x1D, 0x00, 0x00,
+    0x0B, 0x00, 0x00, 0x08, 0x01, 0x8A, 0x8E, 0x00, 0x00, 0x03, 0x61, 0x14, 0x01, 0x81, 0x7E, 0x21,
+    0x40, 0x05, 0x61, 0x21, 0x01, 0x60, 0xED, 0x21, 0x15, 0x05, 0x21, 0x40, 0x03, 0x21, 0x1B, 0x03,
+    0xA1, 0x42, 0x03, 0x21, 0x1B, 0x03, 0x62, 0x1B, 0x42, 0x01, 0x84, 0x50, 0x00, 0x00, 0x03, 0x62,
+    0x21, 0x41, 0x01, 0x61, 0x0A, 0x01, 0x68, 0xD3, 0x61, 0x2D, 0x01, 0x9A, 0xFD, 0x21, 0x42, 0x05,
+    0x21, 0x34, 0x03, 0x21, 0x19, 0x03, 0x21, 0x1B, 0x03, 0x62, 0x17, 0x41, 0x01, 0x5F, 0xDE, 0x00,
+    0x00, 0x03, 0xE6, 0x14, 0x15, 0x19, 0x1B, 0x27, 0x2A, 0x00, 0x00, 0x43, 0x01, 0xA3, 0x12, 0x00,
+    0x4F, 0xC3, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x23, 0x00, 0x00, 0x09, 0x41, 0x17, 0x9E, 0x5A, 0x21,
+    0x42, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x42, 0x03, 0x21, 0x34, 0x03, 0x65, 0x1A, 0x21, 0x25, 0x40,
+    0x42, 0x01, 0x30, 0x5C, 0x00, 0x1B, 0x5B, 0x00, 0x00, 0x03, 0x01, 0x11, 0x13, 0x01, 0x71, 0x2A,
+    0x62, 0x32, 0x49, 0x01, 0x86, 0x74, 0x01, 0x87, 0x42, 0x61, 0x2B, 0x01, 0x5F, 0x51, 0xE4, 0x2B,
+    0x2E, 0x40, 0x42, 0x00, 0x00, 0x0E, 0x01, 0x7C, 0xDB, 0x00, 0x00, 0x05, 0x01, 0x99, 0xE6, 0xE1,
+    0x2E, 0x01, 0xA3, 0x1D, 0xE5, 0x01, 0x14, 0x21, 0x22, 0x48, 0x00, 0x00, 0x16, 0x00, 0x00, 0x05,
+    0x01, 0xA3, 0x74, 0x01, 0xA3, 0x74, 0x01, 0x5E, 0x0A, 0xE1, 0x2E, 0x01, 0x98, 0xDB, 0x64, 0x14,
+    0x2D, 0x48, 0x49, 0x00, 0x00, 0x05, 0x01, 0xA3, 0x8E, 0x01, 0xA3, 0x39, 0x01, 0xA3, 0x39, 0x41,
+    0x2E, 0xD9, 0x9E, 0x21, 0x25, 0x04, 0x21, 0x40, 0x03, 0x63, 0x14, 0x1A, 0x22, 0x01, 0xA3, 0xA9,
+    0x01, 0xA3, 0xA9, 0x00, 0x00, 0x03, 0x64, 0x01, 0x21, 0x25, 0x49, 0x01, 0xA3, 0xB6, 0x01, 0xA3,
+    0xB6, 0x01, 0xA3, 0x50, 0x01, 0xA3, 0xB6, 0x62, 0x01, 0x40, 0x01, 0xA3, 0xBD, 0x01, 0x61, 0xDE,
+    0xE1, 0x14, 0x01, 0xA3, 0xC6, 0xA2, 0x07, 0x21, 0x0E, 0x05, 0x61, 0x2E, 0x01, 0xA1, 0x4A, 0x64,
+    0x27, 0x2D, 0x30, 0x32, 0x01, 0xA3, 0x24, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0xA3, 0xDF,
+    0xC1, 0x44, 0x01, 0xDF, 0x62, 0x2D, 0x32, 0x01, 0xA3, 0xF4, 0x00, 0x00, 0x04, 0x4E, 0x01, 0x27,
+    0x2D, 0x30, 0x31, 0x32, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x48, 0x49, 0x02, 0xC2, 0x02, 0x87,
+    0x02, 0x11, 0x01, 0xE7, 0x01, 0xCB, 0x01, 0x58, 0x00, 0xEB, 0x00, 0xC2, 0x00, 0x89, 0x00, 0x6F,
+    0x00, 0x54, 0x00, 0x47, 0x00, 0x1E, 0x00, 0x09, 0x61, 0x13, 0x01, 0x12, 0x13, 0x62, 0x1E, 0x25,
+    0x00, 0x00, 0x05, 0x01, 0x12, 0x18, 0x41, 0x40, 0x45, 0x09, 0x21, 0x30, 0x04, 0xA1, 0x21, 0x03,
+    0x61, 0x02, 0x01, 0xA4, 0x36, 0x62, 0x01, 0x40, 0x01, 0xA0, 0x37, 0x00, 0x00, 0x05, 0xC1, 0x2D,
+    0xF2, 0x5B, 0x62, 0x34, 0x4C, 0x00, 0x00, 0x04, 0x01, 0xA4, 0x52, 0xE1, 0x19, 0x01, 0x59, 0x11,
+    0x62, 0x38, 0x40, 0x00, 0x00, 0x05, 0x01, 0x3F, 0xF0, 0xE1, 0x2A, 0x01, 0xA4, 0x4D, 0xE3, 0x25,
+    0x39, 0x4C, 0x01, 0xA4, 0x08, 0x01, 0xA4, 0x28, 0x01, 0xA4, 0x6E, 0xE1, 0x32, 0x01, 0xA2, 0xE4,
+    0x63, 0x01, 0x19, 0x48, 0x01, 0xA4, 0x80, 0x01, 0xA4, 0x80, 0x01, 0xA4, 0x47, 0x67, 0x01, 0x07,
+    0x14, 0x19, 0x1A, 0x21, 0x27, 0x01, 0xA4, 0x8D, 0x01, 0x20, 0xFB, 0x01, 0xA4, 0x8D, 0x01, 0xA4,
+    0x8D, 0x01, 0xA4, 0x8D, 0x01, 0xA4, 0x8D, 0x01, 0xA4, 0x8D, 0x62, 0x22, 0x49, 0x00, 0x00, 0x1D,
+    0x01, 0x8C, 0x20, 0x41, 0x2E, 0x1E, 0x60, 0x6A, 0x07, 0x14, 0x19, 0x2D, 0x32, 0x34, 0x35, 0x40,
+    0x47, 0x48, 0x01, 0x71, 0xF6, 0x01, 0xA4, 0xB7, 0x00, 0x00, 0x3C, 0x01, 0xA1, 0x4C, 0x01, 0xA1,
+    0x4C, 0x00, 0x00, 0x37, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0x01, 0xA1, 0xFF, 0x01, 0xA4, 0x62,
+    0x63, 0x07, 0x14, 0x27, 0x01, 0xA4, 0xE0, 0x01, 0xA4, 0xE0, 0x01, 0xA4, 0xE0, 0x61, 0x22, 0x01,
+    0x9F, 0x42, 0x63, 0x22, 0x48, 0x49, 0x00, 0x00, 0x12, 0x01, 0xA4, 0x37, 0x00, 0x00, 0x05, 0xE1,
+    0x23, 0x01, 0xA4, 0xB0, 0x61, 0x01, 0x01, 0x80, 0x28, 0x21, 0x23, 0x05, 0x62, 0x07, 0x1A, 0x01,
+    0x8A, 0x9E, 0x01, 0xA2, 0x20, 0xE7, 0x01, 0x08, 0x14, 0x1B, 0x2B, 0x40, 0x41, 0x00, 0x00, 0x16,
+    0x01, 0x72, 0x7B, 0x01, 0x95, 0x71, 0x00, 0x00, 0x0C, 0x01, 0x8A, 0xA7, 0x00, 0x00, 0x09, 0x01,
+    0x6F, 0x78, 0x61, 0x2D, 0x01, 0x8B, 0xC3, 0x63, 0x2D, 0x48, 0x49, 0x00, 0x00, 0x22, 0x01, 0x9F,
+    0x85, 0x00, 0x00, 0x05, 0x61, 0x1C, 0x01, 0xA3, 0x35, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0xE2,
+    0x01, 0x2F, 0x00, 0x00, 0x03, 0x01, 0xA5, 0x4F, 0x21, 0x32, 0x09, 0x67, 0x28, 0x2D, 0x32, 0x35,
+    0x37, 0x47, 0x49, 0x01, 0xA5, 0x5B, 0x01, 0xA5, 0x5B, 0x01, 0xA2, 0x62, 0x00, 0x00, 0x69, 0x00,
+    0x00, 0x24, 0x01, 0xA5, 0x0C, 0x00, 0x00, 0x03, 0x62, 0x31, 0x35, 0x00, 0xB7, 0x93, 0x01, 0xA5,
+    0x0C, 0xE1, 0x01, 0x01, 0x4D, 0x13, 0x61, 0x19, 0x01, 0x52, 0x0E, 0xE5, 0x1E, 0x23, 0x32, 0x34,
+    0x35, 0x01, 0xA5, 0x8B, 0x01, 0x8B, 0x1D, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0xA5, 0x8B,
+    0xE4, 0x01, 0x27, 0x28, 0x2A, 0x01, 0x90, 0x8E, 0x01, 0x19, 0x2D, 0x01, 0x93, 0x82, 0x01, 0x5E,
+    0x6A, 0x21, 0x23, 0x11, 0xE2, 0x28, 0x2A, 0x01, 0x98, 0x87, 0x01, 0x4D, 0x46, 0x63, 0x13, 0x19,
+    0x23, 0x01, 0xA5, 0xBD, 0x01, 0xA5, 0xBD, 0x01, 0xA5, 0xBD, 0xA1, 0x22, 0x0D, 0x64, 0x15, 0x21,
+    0x32, 0x35, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x19, 0x01, 0xA5, 0xCD, 0x00, 0x00, 0x03, 0xE3, 0x23,
+    0x32, 0x35, 0x01, 0x96, 0x04, 0x01, 0xA5, 0xDE, 0x01, 0xA5, 0xDE, 0xE1, 0x19, 0x01, 0x46, 0x32,
+    0x21, 0x4C, 0x05, 0x63, 0x23, 0x34, 0x44, 0x00, 0x00, 0x03, 0x01, 0x82, 0xDB, 0x01, 0x6C, 0xA6,
+    0x61, 0x34, 0x01, 0x8B, 0x8A, 0x62, 0x31, 0x34, 0x01, 0xA5, 0xB6, 0x01, 0xA5, 0xCC, 0x61, 0x35,
+    0x01, 0x37, 0x98, 0x21, 0x25, 0x05, 0x61, 0x30, 0x01, 0x26, 0x1A, 0x61, 0x19, 0x01, 0xA4, 0xF6,
+    0x21, 0x31, 0x05, 0x61, 0x0A, 0x01, 0xA4, 0x00, 0x42, 0x21, 0x35, 0xDC, 0x27, 0x00, 0x05, 0xE6,
+    0x04, 0x15, 0x1E, 0x22, 0x25, 0x2A, 0x01, 0xA5, 0xC9, 0x01, 0xA2, 0xC4, 0x00, 0x00, 0x19, 0x01,
+    0x8A, 0x21, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x61, 0x2B, 0x01, 0x9E, 0x4D, 0x61, 0x28, 0x01,
+    0xA5, 0x92, 0xE9, 0x15, 0x17, 0x1A, 0x21, 0x25, 0x2B, 0x30, 0x40, 0x44, 0x01, 0xA6, 0x36, 0x01,
+    0xA6, 0x2D, 0x00, 0x00, 0x52, 0x01, 0xA5, 0x1A, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x3F, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x65, 0x07, 0x14, 0x19, 0x1A, 0x49, 0x01, 0xA6, 0x77,
+    0x00, 0xEA, 0x6E, 0x01, 0xA6, 0x77, 0x01, 0xA6, 0x77, 0x01, 0xA6, 0x6D, 0x61, 0x23, 0x01, 0xA2,
+    0xAE, 0xA1, 0x04, 0x05, 0xE8, 0x04, 0x0A, 0x19, 0x1B, 0x20, 0x22, 0x28, 0x4C, 0x01, 0x95, 0xDC,
+    0x01, 0x8B, 0x11, 0x01, 0x70, 0xD5, 0x01, 0x46, 0x41, 0x01, 0x6D, 0xBA, 0x01, 0xA6, 0x0F, 0x01,
+    0x82, 0x27, 0x01, 0xA6, 0x94, 0x21, 0x34, 0x21, 0x62, 0x15, 0x4C, 0x00, 0x00, 0x03, 0x01, 0xA6,
+    0xB8, 0xE5, 0x07, 0x08, 0x14, 0x19, 0x23, 0x01, 0xA6, 0xC1, 0x00, 0x00, 0x30, 0x01, 0xA6, 0xC1,
+    0x01, 0xA6, 0xC1, 0x00, 0x00, 0x09, 0xE1, 0x02, 0x01, 0x9A, 0x28, 0x62, 0x07, 0x27, 0x01, 0xA6,
+    0xDB, 0x00, 0x00, 0x05, 0x21, 0x22, 0x09, 0x62, 0x2D, 0x44, 0x01, 0xA1, 0x55, 0x01, 0x4E, 0x17,
+    0x62, 0x21, 0x27, 0x00, 0x00, 0x09, 0x01, 0xA6, 0xF0, 0x21, 0x22, 0x09, 0x62, 0x27, 0x30, 0x01,
+    0xA6, 0xFC, 0x01, 0xA6, 0xFC, 0x21, 0x22, 0x09, 0x65, 0x22, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x00,
+    0x47, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0xA3, 0x92, 0xE1, 0x01, 0x01,
+    0x97, 0x92, 0x21, 0x2D, 0x05, 0x62, 0x2D, 0x49, 0x01, 0xA0, 0xD6, 0x00, 0x00, 0x03, 0xE1, 0x0A,
+    0x01, 0x9B, 0x5B, 0xE2, 0x07, 0x15, 0x01, 0xA0, 0x45, 0x01, 0xA7, 0x32, 0x64, 0x07, 0x08, 0x14,
+    0x1A, 0x00, 0x00, 0x0E, 0x01, 0xA7, 0x3C, 0x01, 0xA7, 0x3C, 0x00, 0x00, 0x09, 0xE1, 0x01, 0x01,
+    0x35, 0x11, 0xE3, 0x07, 0x19, 0x32, 0x00, 0x00, 0x05, 0x01, 0xA7, 0x52, 0x01, 0xA7, 0x52, 0xE1,
+    0x01, 0x01, 0xA7, 0x4F, 0x61, 0x25, 0x01, 0x7B, 0x5D, 0xE2, 0x2D, 0x40, 0x01, 0x88, 0xD3, 0x00,
+    0x00, 0x05, 0x64, 0x01, 0x07, 0x2D, 0x32, 0x01, 0xA5, 0x4F, 0x00, 0x00, 0x13, 0x01, 0xA7, 0x72,
+    0x00, 0x00, 0x09, 0xE1, 0x2E, 0x01, 0xA1, 0x64, 0xE2, 0x01, 0x32, 0x00, 0x00, 0x05, 0x01, 0x87,
+    0x52, 0xE2, 0x07, 0x32, 0x01, 0xA7, 0x91, 0x01, 0xA7, 0x91, 0xFF, 0x1F, 0x01, 0x07, 0x08, 0x0A,
+    0x13, 0x14, 0x15, 0x17, 0x19, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2D, 0x30, 0x32,
+    0x34, 0x35, 0x37, 0x38, 0x40, 0x44, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x03, 0x5D, 0x00, 0x03,
+    0x55, 0x00, 0x03, 0x48, 0x01, 0xA7, 0x34, 0x01, 0xA7, 0x7B, 0x01, 0xA7, 0x9A, 0x00, 0x03, 0x3A,
+    0x01, 0x99, 0xB9, 0x01, 0x82, 0x06, 0x00, 0x03, 0x31, 0x00, 0x03, 0x2C, 0x00, 0x02, 0xE3, 0x00,
+    0x02, 0x3F, 0x00, 0x02, 0x22, 0x00, 0x02, 0x0F, 0x00, 0x01, 0xCD, 0x00, 0x01, 0xBC, 0x00, 0x01,
+    0xA7, 0x01, 0x78, 0x22, 0x00, 0x01, 0x48, 0x00, 0x01, 0x23, 0x00, 0x00, 0x92, 0x00, 0x00, 0x75,
+    0x01, 0xA4, 0x8C, 0x01, 0xA7, 0x54, 0x01, 0xA7, 0x3C, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x48, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xE1, 0x41, 0x01, 0x6C, 0xDC, 0xE3, 0x07, 0x22,
+    0x47, 0x01, 0xA8, 0x1D, 0x01, 0xA8, 0x1D, 0x01, 0xA7, 0xCE, 0x61, 0x1A, 0x01, 0x9C, 0x57, 0x21,
+    0x02, 0x05, 0x62, 0x08, 0x15, 0x00, 0x00, 0x03, 0x01, 0xA8, 0x32, 0x21, 0x47, 0x09, 0xE1, 0x32,
+    0x01, 0x6B, 0xA8, 0x41, 0x34, 0x7D, 0x88, 0x21, 0x23, 0x04, 0x21, 0x34, 0x03, 0x21, 0x2A, 0x03,
+    0x61, 0x02, 0x01, 0x9A, 0xEC, 0x21, 0x41, 0x05, 0x62, 0x07, 0x14, 0x01, 0xA8, 0x58, 0x00, 0x00,
+    0x03, 0xE8, 0x17, 0x23, 0x30, 0x32, 0x37, 0x47, 0x48, 0x49, 0x01, 0x6A, 0xF8, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x14, 0x01, 0xA8, 0x61, 0x01, 0xA0, 0xBA, 0x00, 0x00, 0x09, 0x01, 0x9A, 0xE7, 0x01,
+    0xA8, 0x28, 0xE6, 0x01, 0x15, 0x34, 0x37, 0x48, 0x49, 0x01, 0xA8, 0x82, 0x01, 0xA6, 0x58, 0x01,
+    0x30, 0x74, 0x01, 0x7B, 0xE0, 0x01, 0x9B, 0xEE, 0x01, 0x79, 0x4B, 0x61, 0x2D, 0x01, 0xA5, 0x30,
+    0x64, 0x07, 0x2D, 0x30, 0x32, 0x01, 0xA8, 0xA0, 0x01, 0xA5, 0x35, 0x01, 0xA8, 0xA0, 0x01, 0xA5,
+    0xA7, 0x63, 0x15, 0x21, 0x35, 0x01, 0xA8, 0x6B, 0x01, 0xA8, 0xB1, 0x01, 0x9B, 0x7E, 0x61, 0x22,
+    0x01, 0x85, 0x40, 0x21, 0x31, 0x05, 0x61, 0x19, 0x01, 0x56, 0x81, 0x21, 0x34, 0x05, 0x61, 0x21,
+    0x01, 0xA4, 0xEC, 0xE7, 0x0A, 0x14, 0x1E, 0x21, 0x22, 0x27, 0x2A, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x08, 0x01, 0x12, 0xB6, 0x01, 0xA8, 0x7E, 0x01, 0x9D, 0xE3, 0x01, 0xA8, 0xC9, 0x00, 0x00, 0x05,
+    0x61, 0x48, 0x01, 0x97, 0x4F, 0x21, 0x02, 0x05, 0xA1, 0x44, 0x03, 0x65, 0x07, 0x14, 0x19, 0x21,
+    0x27, 0x01, 0xA8, 0xFB, 0x01, 0xA8, 0xFB, 0x01, 0xA8, 0xFB, 0x01, 0xA8, 0xFB, 0x00, 0x00, 0x03,
+    0x61, 0x38, 0x01, 0x5E, 0x42, 0x21, 0x19, 0x05, 0xA1, 0x2B, 0x03, 0x21, 0x27, 0x03, 0x21, 0x22,
+    0x03, 0x63, 0x22, 0x48, 0x49, 0x00, 0x00, 0x26, 0x01, 0xA8, 0x66, 0x00, 0x00, 0x03, 0x62, 0x07,
+    0x19, 0x00, 0xD7, 0x08, 0x01, 0xA9, 0x2E, 0x21, 0x2D, 0x09, 0x62, 0x2D, 0x48, 0x01, 0xA9, 0x3A,
+    0x00, 0x00, 0x03, 0xE1, 0x02, 0x01, 0xA8, 0xF1, 0x65, 0x07, 0x0D, 0x14, 0x19, 0x21, 0x01, 0xA9,
+    0x48, 0x01, 0x76, 0x87, 0x01, 0xA9, 0x48, 0x01, 0xA9, 0x48, 0x00, 0x00, 0x05, 0xE1, 0x25, 0x01,
+    0xA8, 0xF7, 0x63, 0x07, 0x19, 0x32, 0x01, 0xA9, 0x62, 0x01, 0xA9, 0x62, 0x00, 0x00, 0x05, 0xE9,
+    0x02, 0x04, 0x17, 0x1B, 0x1C, 0x22, 0x2B, 0x43, 0x44, 0x01, 0xA9, 0x09, 0x01, 0xA9, 0x1A, 0x01,
+    0xA8, 0xA9, 0x01, 0xA9, 0x6E, 0x01, 0xA8, 0xA9, 0x01, 0xA9, 0x09, 0x01, 0x2C, 0x80, 0x01, 0xA7,
+    0x3E, 0x01, 0xA9, 0x5C, 0xE2, 0x21, 0x32, 0x01, 0xA9, 0x94, 0x00, 0x00, 0x25, 0xF5, 0x01, 0x08,
+    0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2C, 0x30, 0x32, 0x34, 0x35, 0x37,
+    0x47, 0x48, 0x49, 0x01, 0xA9, 0x9D, 0x01, 0xA9, 0x57, 0x01, 0xA9, 0x37, 0x00, 0x01, 0x85, 0x00,
+    0x01, 0x80, 0x00, 0x01, 0x62, 0x00, 0x01, 0x3C, 0x00, 0x01, 0x1B, 0x00, 0x01, 0x02, 0x00, 0x00,
+    0xFD, 0x01, 0xA9, 0x9D, 0x00, 0x00, 0xEC, 0x01, 0xA6, 0x32, 0x00, 0x11, 0x1B, 0x00, 0x00, 0xCA,
+    0x01, 0xA9, 0x64, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x63, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3B, 0x00,
+    0x00, 0x09, 0x61, 0x09, 0x01, 0xA9, 0xF2, 0x61, 0x01, 0x01, 0x5A, 0xB1, 0x21, 0x31, 0x05, 0xE2,
+    0x17, 0x22, 0x00, 0x00, 0x03, 0x01, 0xA9, 0x99, 0x61, 0x23, 0x01, 0xA8, 0x24, 0x63, 0x17, 0x1A,
+    0x27, 0x01, 0x02, 0xA5, 0x00, 0x00, 0x05, 0x01, 0x70, 0x19, 0x21, 0x40, 0x0D, 0x61, 0x04, 0x01,
+    0x6A, 0x74, 0xE3, 0x19, 0x20, 0x2D, 0x01, 0x76, 0xF0, 0x01, 0xA9, 0xFD, 0x01, 0x76, 0xF0, 0x22,
+    0x34, 0x35, 0x12, 0x0D, 0xE4, 0x0A, 0x15, 0x1B, 0x21, 0x01, 0x8F, 0xC6, 0x01, 0xA9, 0x2B, 0x01,
+    0xAA, 0x30, 0x01, 0xA7, 0xE8, 0x61, 0x40, 0x01, 0x8C, 0xF2, 0x21, 0x34, 0x05, 0x21, 0x0B, 0x03,
+    0x21, 0x07, 0x03, 0x21, 0x2D, 0x03, 0xA1, 0x1F, 0x03, 0x21, 0x15, 0x03, 0x21, 0x34, 0x03, 0xE2,
+    0x2B, 0x30, 0x01, 0x89, 0xDD, 0x01, 0x75, 0x37, 0x61, 0x22, 0x01, 0x4F, 0x5F, 0x41, 0x23, 0xC0,
+    0x88, 0x21, 0x01, 0x04, 0x21, 0x31, 0x03, 0xE3, 0x08, 0x23, 0x27, 0x00, 0x00, 0x03, 0x00, 0xBA,
+    0xAC, 0x01, 0x1B, 0x73, 0x61, 0x41, 0x01, 0x6F, 0x36, 0x21, 0x1A, 0x05, 0x21, 0x27, 0x03, 0x62,
+    0x31, 0x49, 0x01, 0xA5, 0x96, 0x01, 0xAA, 0x56, 0x61, 0x40, 0x01, 0x17, 0x91, 0x21, 0x19, 0x05,
+    0x21, 0x34, 0x03, 0x21, 0x14, 0x03, 0x21, 0x19, 0x03, 0x21, 0x49, 0x03, 0x21, 0x31, 0x03, 0x62,
+    0x32, 0x48, 0x01, 0xAA, 0xA5, 0x01, 0xA4, 0xFD, 0x41, 0x32, 0x66, 0x4B, 0xA1, 0x01, 0x04, 0x21,
+    0x22, 0x03, 0x21, 0x32, 0x03, 0x21, 0x21, 0x03, 0x61, 0x04, 0x01, 0xAA, 0x5F, 0xEA, 0x01, 0x04,
+    0x08, 0x15, 0x1B, 0x1E, 0x22, 0x23, 0x2B, 0x40, 0x01, 0xAA, 0x6F, 0x00, 0x00, 0x41, 0x01, 0xAA,
+    0x81, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x21, 0x00, 0x3C, 0xF1, 0x01, 0x9D, 0xA4, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0x21, 0x07, 0x29, 0x21, 0x2D, 0x03, 0x22, 0x2D, 0x48, 0x85,
+    0x03, 0x41, 0x23, 0xEB, 0xF1, 0xE3, 0x02, 0x04, 0x40, 0x00, 0x00, 0x04, 0x01, 0x94, 0xB0, 0x01,
+    0x2B, 0x61, 0x62, 0x07, 0x32, 0x00, 0x00, 0x0D, 0x01, 0xAB, 0x12, 0x67, 0x07, 0x14, 0x19, 0x32,
+    0x35, 0x37, 0x48, 0x01, 0xAB, 0x1B, 0x00, 0x00, 0xBF, 0x01, 0xAB, 0x1B, 0x00, 0x00, 0xBC, 0x00,
+    0x00, 0xB3, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x09, 0x61, 0x25, 0x01, 0x57, 0xFC, 0x21, 0x04, 0x05,
+    0x21, 0x40, 0x03, 0x62, 0x1A, 0x49, 0x00, 0x00, 0x03, 0x01, 0xA9, 0x34, 0x61, 0x22, 0x01, 0xA8,
+    0x7C, 0x41, 0x1A, 0xA8, 0xAC, 0xE2, 0x17, 0x44, 0x01, 0xAA, 0x56, 0x01, 0x4C, 0xD2, 0x21, 0x19,
+    0x09, 0x21, 0x2D, 0x03, 0x22, 0x2D, 0x48, 0x13, 0x03, 0x63, 0x07, 0x19, 0x32, 0x01, 0xAB, 0x69,
+    0x01, 0xAB, 0x69, 0x01, 0xAB, 0x69, 0x66, 0x21, 0x34, 0x35, 0x37, 0x47, 0x49, 0x01, 0xAB, 0x76,
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x12, 0x01, 0xAB, 0x27, 0x00, 0x00, 0x0D, 0x61,
+    0x27, 0x01, 0xAB, 0x7F, 0xA1, 0x04, 0x05, 0x21, 0x07, 0x03, 0x21, 0x49, 0x03, 0xE1, 0x2A, 0x01,
+    0x6A, 0x35, 0x41, 0x29, 0xBF, 0x10, 0x21, 0x23, 0x04, 0x21, 0x28, 0x03, 0xE6, 0x27, 0x28, 0x2A,
+    0x30, 0x32, 0x40, 0x00, 0x11, 0x07, 0x01, 0x99, 0x8E, 0x01, 0x6A, 0x44, 0x00, 0x00, 0x0F, 0x01,
+    0xAB, 0xAC, 0x00, 0x00, 0x03, 0x61, 0x39, 0x01, 0x72, 0x74, 0x63, 0x04, 0x0B, 0x19, 0x01, 0x1A,
+    0x66, 0x01, 0x8E, 0x77, 0x01, 0xAB, 0x6C, 0x64, 0x01, 0x0B, 0x1F, 0x40, 0x00, 0x1E, 0xC8, 0x00,
+    0x00, 0x12, 0x01, 0x9C, 0x0A, 0x00, 0x00, 0x0D, 0x21, 0x4C, 0x11, 0xE1, 0x02, 0x01, 0x91, 0x7D,
+    0xA1, 0x40, 0x05, 0x22, 0x23, 0x30, 0x0B, 0x03, 0x61, 0x4C, 0x01, 0x72, 0x45, 0xE4, 0x19, 0x23,
+    0x30, 0x44, 0x00, 0x00, 0x05, 0x01, 0xA8, 0xCA, 0x01, 0xAB, 0xFD, 0x01, 0xAB, 0xA8, 0x61, 0x23,
+    0x01, 0x96, 0x94, 0x61, 0x04, 0x01, 0xA4, 0xDA, 0xA1, 0x41, 0x05, 0xE1, 0x23, 0x01, 0xAB, 0x55,
+    0x67, 0x07, 0x14, 0x19, 0x1F, 0x21, 0x23, 0x27, 0x01, 0xAC, 0x20, 0x00, 0x00, 0x08, 0x01, 0x8F,
+    0x9F, 0x01, 0xAC, 0x20, 0x01, 0xAC, 0x20, 0x01, 0xAC, 0x20, 0x00, 0x00, 0x05, 0x62, 0x21, 0x27,
+    0x01, 0xAC, 0x3D, 0x01, 0x78, 0xCE, 0x21, 0x22, 0x09, 0x61, 0x22, 0x01, 0x4C, 0x0C, 0x23, 0x22,
+    0x48, 0x49, 0x2E, 0x08, 0x05, 0x62, 0x2D, 0x49, 0x01, 0xAC, 0x4B, 0x01, 0xAC, 0x00, 0x61, 0x1A,
+    0x01, 0x87, 0x22, 0x62, 0x19, 0x44, 0x01, 0xAC, 0x63, 0x01, 0x9F, 0x3A, 0x21, 0x34, 0x09, 0x21,
+    0x25, 0x03, 0x21, 0x2D, 0x03, 0x61, 0x42, 0x01, 0x83, 0x46, 0x62, 0x19, 0x21, 0x00, 0x00, 0x05,
+    0x01, 0xAC, 0x7A, 0x65, 0x01, 0x07, 0x19, 0x32, 0x40, 0x01, 0xAC, 0x83, 0x01, 0xAC, 0x83, 0x01,
+    0xAC, 0x83, 0x01, 0x44, 0x11, 0x01, 0xAC, 0x01, 0x77, 0x04, 0x08, 0x13, 0x14, 0x19, 0x1A, 0x1B,
+    0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42, 0x47, 0x49,
+    0x01, 0x8B, 0xDD, 0x00, 0x02, 0xA6, 0x00, 0xE3, 0xFC, 0x01, 0xAC, 0x98, 0x00, 0x02, 0x99, 0x01,
+    0x92, 0x2A, 0x00, 0x02, 0x7E, 0x00, 0x02, 0x69, 0x00, 0x02, 0x64, 0x00, 0x01, 0x7D, 0x00, 0x01,
+    0x22, 0x00, 0x00, 0xFE, 0x01, 0xAC, 0x98, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x9B,
+    0x00, 0x00, 0x8A, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x26, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x15, 0xE1, 0x07, 0x01, 0xA9, 0x8A, 0x21, 0x30, 0x05, 0x62, 0x31, 0x37,
+    0x01, 0xAB, 0xF8, 0x01, 0xAC, 0xAE, 0xE3, 0x21, 0x30, 0x46, 0x00, 0x00, 0x09, 0x01, 0xAD, 0x06,
+    0x01, 0xAD, 0x06, 0x61, 0x19, 0x01, 0x38, 0x00, 0x62, 0x31, 0x35, 0x00, 0x00, 0x05, 0x01, 0xAD,
+    0x18, 0x61, 0x4C, 0x01, 0x68, 0x1F, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0x62,
+    0x14, 0x40, 0x01, 0xAD, 0x2F, 0x00, 0x00, 0x03, 0x61, 0x23, 0x01, 0x80, 0xF1, 0x21, 0x2D, 0x05,
+    0x62, 0x1F, 0x22, 0x01, 0xAC, 0xE8, 0x00, 0x00, 0x03, 0x41, 0x33, 0x8C, 0x18, 0x21, 0x01, 0x04,
+    0x21, 0x49, 0x03, 0x21, 0x14, 0x03, 0xE7, 0x1B, 0x1C, 0x1D, 0x2A, 0x40, 0x41, 0x44, 0x00, 0x00,
+    0x3E, 0x01, 0x9A, 0xB9, 0x01, 0x7A, 0xBC, 0x00, 0x00, 0x27, 0x00, 0x00, 0x16, 0x01, 0xAD, 0x43,
+    0x00, 0x00, 0x03, 0x21, 0x19, 0x1D, 0x41, 0x35, 0xF0, 0x78, 0x62, 0x0A, 0x2B, 0x00, 0x00, 0x04,
+    0x01, 0xA6, 0xDF, 0xE2, 0x01, 0x40, 0x01, 0x9C, 0xAA, 0x00, 0x00, 0x09, 0x21, 0x1A, 0x09, 0xE3,
+    0x07, 0x19, 0x2B, 0x01, 0xAD, 0x8F, 0x01, 0xAD, 0x8F, 0x01, 0xAD, 0x76, 0x21, 0x22, 0x0D, 0x63,
+    0x22, 0x48, 0x49, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x01, 0x95, 0x15, 0x64, 0x01, 0x14, 0x19,
+    0x1A, 0x01, 0xAD, 0xAC, 0x01, 0xAD, 0xAC, 0x01, 0xAD, 0xAC, 0x01, 0xAD, 0xAC, 0xE2, 0x07, 0x44,
+    0x01, 0xA6, 0xCF, 0x01, 0xAC, 0x35, 0x62, 0x07, 0x19, 0x01, 0xAD, 0xC6, 0x00, 0x00, 0x09, 0x21,
+    0x2D, 0x09, 0x43, 0x2D, 0x48, 0x49, 0x00, 0x26, 0x00, 0x03, 0xA3, 0x50, 0x6A, 0x01, 0x22, 0x2D,
+    0x32, 0x34, 0x35, 0x37, 0x47, 0x48, 0x49, 0x01, 0xAD, 0xDC, 0x01, 0xAD, 0xDC, 0x00, 0x00, 0xE2,
+    0x00, 0x00, 0xD6, 0x00, 0x00, 0x69, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0A, 0x01, 0xAD, 0xA3, 0x01,
+    0xAD, 0x76, 0x01, 0x9C, 0x2D, 0x41, 0x22, 0xCC, 0xB2, 0xA1, 0x35, 0x04, 0x41, 0x33, 0xD6, 0xBA,
+    0xE1, 0x23, 0x01, 0x8F, 0x24, 0x21, 0x32, 0x05, 0xE6, 0x04, 0x08, 0x19, 0x20, 0x2A, 0x34, 0x01,
+    0x89, 0x3C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x01, 0x1C, 0x1A, 0x01, 0xAB, 0x30, 0x01, 0xAD,
+    0x5D, 0x62, 0x1A, 0x31, 0x01, 0xAE, 0x31, 0x01, 0xAD, 0xE2, 0x41, 0x25, 0x67, 0x1E, 0x21, 0x34,
+    0x04, 0x61, 0x23, 0x01, 0x93, 0xBD, 0x21, 0x2D, 0x05, 0x22, 0x15, 0x19, 0x0B, 0x03, 0xE3, 0x08,
+    0x40, 0x43, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x01, 0xAC, 0x1D, 0x61, 0x2A, 0x01, 0x6B, 0xF7,
+    0x21, 0x4C, 0x05, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0x21, 0x40, 0x03, 0xE2,
+    0x0B, 0x2A, 0x01, 0x24, 0x92, 0x01, 0xAE, 0x53, 0x61, 0x0A, 0x01, 0x1A, 0x1D, 0x21, 0x30, 0x05,
+    0x21, 0x23, 0x03, 0xA1, 0x1B, 0x03, 0x21, 0x07, 0x03, 0x21, 0x38, 0x03, 0x21, 0x23, 0x03, 0x62,
+    0x23, 0x31, 0x01, 0xAE, 0x8F, 0x01, 0x4D, 0xBA, 0x61, 0x31, 0x01, 0xAB, 0x80, 0xEB, 0x01, 0x17,
+    0x19, 0x1C, 0x1E, 0x23, 0x27, 0x28, 0x2A, 0x40, 0x43, 0x00, 0x00, 0x11, 0x01, 0x7B, 0x82, 0x01,
+    0x9E, 0x24, 0x01, 0xAE, 0x3F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x01, 0x93, 0x1A, 0x01, 0x11,
+    0x8E, 0x01, 0x64, 0x4E, 0x01, 0x62, 0xC0, 0x01, 0xAC, 0x6C, 0x62, 0x0D, 0x14, 0x00, 0x00, 0x2D,
+    0x01, 0xAE, 0xCA, 0x64, 0x08, 0x32, 0x34, 0x35, 0x01, 0xAE, 0x6D, 0x01, 0x7B, 0x5C, 0x00, 0x00,
+    0x09, 0x01, 0xAB, 0x5D, 0x61, 0x0E, 0x01, 0xAE, 0x7E, 0x62, 0x21, 0x23, 0x01, 0x83, 0xB0, 0x01,
+    0x83, 0xB0, 0xE2, 0x0B, 0x40, 0x01, 0xAE, 0x2C, 0x00, 0x00, 0x09, 0x62, 0x31, 0x4C, 0x01, 0x0D,
+    0xD7, 0x00, 0x00, 0x09, 0xE2, 0x23, 0x30, 0x00, 0x00, 0x09, 0x01, 0xAF, 0x04, 0xE1, 0x08, 0x01,
+    0xAF, 0x03, 0xA1, 0x30, 0x05, 0x64, 0x14, 0x21, 0x23, 0x48, 0x01, 0xAF, 0x15, 0x01, 0xAF, 0x15,
+    0x01, 0x75, 0xB7, 0x01, 0xA8, 0x8B, 0x61, 0x44, 0x01, 0xAE, 0xED, 0xA1, 0x30, 0x05, 0x66, 0x07,
+    0x14, 0x19, 0x21, 0x23, 0x27, 0x01, 0xAF, 0x2E, 0x01, 0xAF, 0x2E, 0x01, 0xAF, 0x2E, 0x01, 0xAF,
+    0x2E, 0x00, 0x00, 0x03, 0x01, 0xAF, 0x2E, 0x61, 0x4A, 0x01, 0x93, 0x39, 0xA1, 0x08, 0x05, 0x62,
+    0x1A, 0x27, 0x01, 0xAF, 0x4F, 0x00, 0x00, 0x03, 0x21, 0x22, 0x09, 0x61, 0x08, 0x01, 0xA7, 0xD0,
+    0x21, 0x40, 0x05, 0x62, 0x19, 0x21, 0x01, 0xAF, 0x63, 0x00, 0x00, 0x03, 0x21, 0x22, 0x09, 0x23,
+    0x22, 0x4A, 0x4B, 0x41, 0x17, 0x03, 0xE2, 0x1B, 0x2A, 0x01, 0xAF, 0x3D, 0x01, 0xAD, 0x67, 0x63,
+    0x2D, 0x48, 0x49, 0x00, 0x00, 0x09, 0x01, 0xA9, 0xCD, 0x01, 0xAB, 0x71, 0x62, 0x14, 0x1A, 0x01,
+    0xAF, 0x8C, 0x01, 0x7C, 0xCB, 0x63, 0x07, 0x2D, 0x32, 0x01, 0xAF, 0x95, 0x01, 0xAF, 0x95, 0x01,
+    0xAF, 0x95, 0x63, 0x2D, 0x32, 0x49, 0x01, 0xAF, 0x98, 0x01, 0xAF, 0xA2, 0x01, 0xAF, 0x3C, 0xC2,
+    0x27, 0x2A, 0xE9, 0x6B, 0xAC, 0xA8, 0x21, 0x32, 0x07, 0x21, 0x22, 0x03, 0x21, 0x30, 0x03, 0x21,
+    0x23, 0x03, 0xE8, 0x01, 0x02, 0x04, 0x0A, 0x1E, 0x21, 0x22, 0x2D, 0x01, 0xAF, 0xA9, 0x00, 0x00,
+    0x20, 0x00, 0xB9, 0x34, 0x01, 0x79, 0x86, 0x00, 0x00, 0x03, 0x01, 0xA0, 0x37, 0x01, 0xAF, 0x3D,
+    0x01, 0xA6, 0x74, 0x21, 0x32, 0x21, 0xE5, 0x01, 0x07, 0x15, 0x2A, 0x32, 0x01, 0xAF, 0xE6, 0x01,
+    0xAF, 0xE6, 0x01, 0xAF, 0xE6, 0x01, 0xAE, 0xDD, 0x01, 0xAF, 0xE6, 0x62, 0x07, 0x2D, 0x01, 0xAF,
+    0xFB, 0x01, 0xAF, 0xFB, 0xF4, 0x14, 0x15, 0x19, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x29, 0x2D, 0x32,
+    0x34, 0x35, 0x37, 0x44, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x01, 0xFB, 0x00, 0x01, 0xEC, 0x00,
+    0x01, 0xB6, 0x00, 0x01, 0x98, 0x00, 0x01, 0x95, 0x00, 0x01, 0x31, 0x01, 0x95, 0x79, 0x01, 0x9C,
+    0xD2, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x95,
+    0x00, 0x00, 0x85, 0x01, 0x94, 0xF6, 0x00, 0x00, 0x78, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x09, 0xE4, 0x0A, 0x1E, 0x40, 0x46, 0x01, 0xAF, 0xEF, 0x01, 0x90, 0x44,
+    0x01, 0x7C, 0xDA, 0x01, 0xB0, 0x55, 0x41, 0x40, 0x90, 0xE1, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03,
+    0xA1, 0x1E, 0x03, 0x21, 0x21, 0x03, 0x63, 0x07, 0x1A, 0x27, 0x01, 0xB0, 0x76, 0x01, 0xB0, 0x76,
+    0x01, 0xB0, 0x76, 0x62, 0x22, 0x48, 0x00, 0x00, 0x0D, 0x01, 0xAF, 0xC8, 0x65, 0x22, 0x27, 0x32,
+    0x34, 0x35, 0x01, 0xB0, 0x8C, 0x01, 0xB0, 0x8C, 0x01, 0xB0, 0x8C, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x09, 0x61, 0x22, 0x01, 0xAA, 0x17, 0x21, 0x35, 0x05, 0xE1, 0x41, 0x01, 0x57, 0xB3, 0x21, 0x30,
+    0x05, 0x61, 0x4A, 0x01, 0xAA, 0x92, 0x61, 0x09, 0x01, 0xB0, 0x67, 0xE3, 0x01, 0x30, 0x42, 0x00,
+    0x00, 0x0A, 0x01, 0x8B, 0x27, 0x00, 0x00, 0x05, 0x63, 0x14, 0x1A, 0x48, 0x01, 0xB0, 0xC8, 0x01,
+    0xB0, 0xC8, 0x01, 0xAE, 0xB9, 0x61, 0x25, 0x01, 0xAF, 0xD3, 0xA1, 0x1E, 0x05, 0xE1, 0x09, 0x01,
+    0x80, 0x1C, 0x64, 0x07, 0x14, 0x1A, 0x27, 0x01, 0xB0, 0xE2, 0x01, 0xB0, 0xE2, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x05, 0x62, 0x22, 0x48, 0x00, 0x00, 0x11, 0x01, 0x98, 0x69, 0x62, 0x2D, 0x48, 0x01,
+    0xB0, 0xC3, 0x00, 0x3C, 0x6E, 0xF0, 0x01, 0x14, 0x17, 0x19, 0x1E, 0x22, 0x25, 0x27, 0x2D, 0x32,
+    0x34, 0x35, 0x37, 0x42, 0x44, 0x48, 0x01, 0xB1, 0x05, 0x01, 0xB1, 0x05, 0x01, 0xB1, 0x05, 0x01,
+    0xB0, 0x96, 0x01, 0x98, 0x7F, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x79, 0x00, 0x00, 0x5F, 0x00, 0x00,
+    0x57, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01, 0xB1, 0x04,
+    0x00, 0x07, 0x13, 0x01, 0xB0, 0xFB, 0x61, 0x40, 0x01, 0x7A, 0xCE, 0xE1, 0x0A, 0x01, 0xAF, 0x3C,
+    0x62, 0x32, 0x34, 0x01, 0xAE, 0x57, 0x01, 0xB1, 0x01, 0x66, 0x07, 0x1F, 0x22, 0x25, 0x35, 0x41,
+    0x01, 0xB1, 0x59, 0x01, 0xB1, 0x3D, 0x01, 0xB1, 0x59, 0x01, 0xB1, 0x3D, 0x01, 0xAD, 0xE3, 0x01,
+    0x74, 0x86, 0xE4, 0x19, 0x20, 0x23, 0x32, 0x01, 0xB0, 0xAC, 0x01, 0x85, 0xCE, 0x01, 0x89, 0x8D,
+    0x01, 0xB1, 0x72, 0x21, 0x10, 0x11, 0x61, 0x34, 0x01, 0x7A, 0x3A, 0x21, 0x0B, 0x05, 0x61, 0x32,
+    0x01, 0x02, 0xE3, 0x63, 0x1A, 0x21, 0x40, 0x01, 0xB1, 0x2D, 0x00, 0x00, 0x05, 0x01, 0x5D, 0x5F,
+    0x62, 0x32, 0x4C, 0x01, 0xAF, 0xBC, 0x00, 0x00, 0x0D, 0xA1, 0x23, 0x09, 0x61, 0x4C, 0x01, 0x42,
+    0x07, 0x62, 0x19, 0x4C, 0x00, 0x00, 0x05, 0x01, 0xB1, 0xB1, 0x21, 0x27, 0x09, 0x62, 0x23, 0x25,
+    0x01, 0xB1, 0x62, 0x01, 0xB1, 0xBD, 0x41, 0x23, 0x22, 0x8D, 0x62, 0x22, 0x48, 0x01, 0xB0, 0xC5,
+    0x01, 0x99, 0x40, 0x21, 0x35, 0x09, 0x21, 0x14, 0x03, 0x61, 0x23, 0x01, 0x99, 0x53, 0x21, 0x40,
+    0x05, 0x21, 0x1E, 0x03, 0xE6, 0x01, 0x0B, 0x21, 0x2D, 0x40, 0x44, 0x00, 0x00, 0x27, 0x01, 0x85,
+    0x42, 0x01, 0xAF, 0x67, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xE1, 0x0A, 0x01,
+    0xB1, 0xE4, 0x65, 0x07, 0x0D, 0x14, 0x23, 0x49, 0x00, 0x00, 0x1E, 0x01, 0xB2, 0x02, 0x00, 0x00,
+    0x05, 0x01, 0x8D, 0x0B, 0x01, 0xAE, 0xF4, 0xE9, 0x01, 0x02, 0x04, 0x14, 0x21, 0x22, 0x23, 0x41,
+    0x43, 0x01, 0xAB, 0x75, 0x01, 0xB1, 0x0B, 0x01, 0x8F, 0x1A, 0x01, 0x96, 0x09, 0x01, 0xA6, 0x40,
+    0x01, 0x9E, 0x49, 0x01, 0xAF, 0xED, 0x01, 0x8E, 0x99, 0x01, 0xA4, 0xAF, 0xE2, 0x43, 0x4C, 0x01,
+    0x80, 0x37, 0x01, 0xB2, 0x3C, 0xE4, 0x07, 0x1A, 0x23, 0x27, 0x00, 0x00, 0x2E, 0x01, 0xB2, 0x45,
+    0x00, 0x00, 0x09, 0x01, 0xB2, 0x45, 0xE1, 0x0A, 0x01, 0x95, 0x76, 0x63, 0x19, 0x21, 0x27, 0x01,
+    0xB2, 0x5B, 0x01, 0xB2, 0x5B, 0x00, 0x00, 0x05, 0x21, 0x22, 0x0D, 0x63, 0x22, 0x48, 0x49, 0x00,
+    0x00, 0x26, 0x00, 0x00, 0x03, 0x01, 0xB1, 0xB0, 0x63, 0x01, 0x14, 0x19, 0x01, 0xB2, 0x78, 0x01,
+    0xB2, 0x78, 0x01, 0xB2, 0x78, 0x61, 0x1E, 0x01, 0x6D, 0x83, 0xE3, 0x07, 0x21, 0x40, 0x01, 0xB2,
+    0x8A, 0x00, 0x77, 0xAC, 0x00, 0x00, 0x05, 0x21, 0x2D, 0x0D, 0x61, 0x21, 0x01, 0x8C, 0x17, 0xA1,
+    0x2B, 0x05, 0x21, 0x2D, 0x03, 0x23, 0x2D, 0x48, 0x49, 0x2D, 0x0E, 0x03, 0x41, 0x40, 0x1B, 0xD0,
+    0x21, 0x30, 0x04, 0x21, 0x27, 0x03, 0x21, 0x25, 0x03, 0x21, 0x42, 0x03, 0x21, 0x2A, 0x03, 0x21,
+    0x01, 0x03, 0x21, 0x42, 0x03, 0x63, 0x01, 0x04, 0x14, 0x00, 0x00, 0x03, 0x01, 0xB2, 0xC5, 0x01,
+    0xB2, 0xC5, 0xE1, 0x27, 0x01, 0xA4, 0xF1, 0x62, 0x07, 0x32, 0x00, 0x00, 0x05, 0x01, 0xB2, 0xD7,
+    0x73, 0x07, 0x14, 0x15, 0x19, 0x1F, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x2D, 0x32, 0x34, 0x35,
+    0x37, 0x47, 0x48, 0x49, 0x00, 0x01, 0x9A, 0x01, 0xB2, 0xE0, 0x01, 0xA2, 0xBD, 0x01, 0xB2, 0xE0,
+    0x01, 0xB2, 0xE0, 0x00, 0x01, 0x95, 0x00, 0x01, 0x90, 0x00, 0x01, 0x87, 0x01, 0xB2, 0xD6, 0x00,
+    0x01, 0x5D, 0x00, 0x01, 0x55, 0x00, 0x01, 0x37, 0x00, 0x01, 0x26, 0x00, 0x00, 0xDE, 0x00, 0x00,
+    0x75, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x1B, 0x01, 0xA5, 0x66, 0x00, 0x00, 0x09, 0x62, 0x35, 0x4C,
+    0x01, 0xB2, 0x9C, 0x01, 0xB3, 0x2D, 0x64, 0x0A, 0x0B, 0x32, 0x40, 0x01, 0xB2, 0x34, 0x00, 0x00,
+    0x09, 0x01, 0xB3, 0x36, 0x01, 0x75, 0x12, 0x61, 0x2B, 0x01, 0xB2, 0x25, 0x61, 0x39, 0x01, 0xB1,
+    0x9A, 0x62, 0x01, 0x21, 0x01, 0x8D, 0x58, 0x01, 0xB2, 0x9C, 0x63, 0x01, 0x25, 0x40, 0x01, 0x8E,
+    0x35, 0x01, 0x96, 0x59, 0x00, 0x00, 0x09, 0x61, 0x1F, 0x01, 0x96, 0x14, 0x21, 0x40, 0x05, 0x21,
+    0x15, 0x03, 0x21, 0x42, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x34, 0x03, 0x41, 0x1A, 0x1D, 0x48, 0x21,
+    0x40, 0x04, 0x22, 0x23, 0x32, 0x0A, 0x03, 0x41, 0x2B, 0xE8, 0x1E, 0x21, 0x2D, 0x04, 0x41, 0x39,
+    0x1D, 0x9A, 0x61, 0x0B, 0x01, 0xA6, 0x69, 0x21, 0x40, 0x05, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03,
+    0x62, 0x19, 0x35, 0x01, 0xB3, 0x3A, 0x01, 0x71, 0x32, 0x21, 0x25, 0x09, 0x21, 0x40, 0x03, 0x21,
+    0x2E, 0x03, 0x61, 0x18, 0x01, 0xA3, 0xE5, 0x21, 0x15, 0x05, 0x21, 0x21, 0x03, 0x61, 0x0B, 0x01,
+    0x9E, 0x47, 0x21, 0x40, 0x05, 0x42, 0x18, 0x22, 0x10, 0xF3, 0x00, 0x03, 0xE9, 0x04, 0x08, 0x1E,
+    0x25, 0x27, 0x2B, 0x40, 0x41, 0x42, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x41, 0x01, 0x74, 0x23, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF0, 0xC1, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x07, 0x22, 0x34, 0x4C, 0x97, 0x25, 0x62, 0x23, 0x4C, 0x01, 0x71, 0xEB, 0x01, 0xB3, 0xF6, 0x41,
+    0x17, 0x94, 0xA5, 0x62, 0x34, 0x4C, 0x00, 0x00, 0x04, 0x01, 0xB4, 0x03, 0x61, 0x25, 0x01, 0x9E,
+    0x92, 0x21, 0x32, 0x05, 0xA1, 0x2E, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03,
+    0x62, 0x0B, 0x15, 0x01, 0x96, 0xCD, 0x00, 0x00, 0x03, 0xA5, 0x08, 0x15, 0x17, 0x2A, 0x40, 0xDD,
+    0x38, 0x33, 0x26, 0x09, 0x41, 0x01, 0xDB, 0xD6, 0x21, 0x30, 0x04, 0x21, 0x23, 0x03, 0xA1, 0x15,
+    0x03, 0x21, 0x01, 0x03, 0x21, 0x31, 0x03, 0xE1, 0x15, 0x01, 0x95, 0xB1, 0x61, 0x04, 0x01, 0x0E,
+    0xFA, 0x61, 0x19, 0x01, 0x74, 0xA8, 0x21, 0x1F, 0x05, 0x22, 0x42, 0x44, 0x0D, 0x03, 0x21, 0x34,
+    0x05, 0x61, 0x2A, 0x01, 0x92, 0xAC, 0x61, 0x35, 0x01, 0xB0, 0x3A, 0x21, 0x08, 0x05, 0x21, 0x4C,
+    0x03, 0xE3, 0x21, 0x23, 0x30, 0x01, 0x7A, 0xA1, 0x00, 0x00, 0x03, 0x01, 0xB4, 0x71, 0x61, 0x1F,
+    0x01, 0x93, 0xC3, 0x64, 0x31, 0x32, 0x34, 0x38, 0x00, 0x00, 0x22, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x05, 0x01, 0xA9, 0x0F, 0x62, 0x25, 0x42, 0x01, 0x7B, 0x5B, 0x00, 0x5D, 0xF6, 0x61, 0x22, 0x01,
+    0x57, 0x3C, 0x21, 0x34, 0x05, 0x21, 0x15, 0x03, 0x21, 0x38, 0x03, 0x61, 0x21, 0x01, 0x57, 0x4A,
+    0x21, 0x10, 0x05, 0xA2, 0x17, 0x1B, 0x0B, 0x03, 0x22, 0x39, 0x4C, 0x24, 0x05, 0x61, 0x40, 0x01,
+    0x05, 0x9A, 0x61, 0x0B, 0x01, 0x61, 0x1F, 0xE4, 0x25, 0x2A, 0x35, 0x40, 0x00, 0x00, 0x0F, 0x01,
+    0xB4, 0xAB, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x62, 0x2D, 0x34, 0x01, 0xB4, 0x9F, 0x01, 0xB2,
+    0xDA, 0x61, 0x40, 0x01, 0x27, 0x31, 0x21, 0x34, 0x05, 0x21, 0x1F, 0x03, 0x21, 0x34, 0x03, 0x61,
+    0x27, 0x01, 0xA4, 0xD2, 0x21, 0x32, 0x05, 0x61, 0x17, 0x01, 0x93, 0x7E, 0x21, 0x19, 0x05, 0x62,
+    0x1E, 0x27, 0x00, 0x00, 0x03, 0x01, 0xA2, 0x97, 0x61, 0x04, 0x01, 0x89, 0xCF, 0x61, 0x23, 0x01,
+    0x77, 0x67, 0x21, 0x1E, 0x05, 0xE7, 0x04, 0x15, 0x23, 0x27, 0x40, 0x42, 0x44, 0x00, 0x00, 0x3D,
+    0x00, 0x00, 0x29, 0x00, 0x00, 0x21, 0x01, 0x96, 0x56, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x00,
+    0x00, 0x03, 0x21, 0x4C, 0x1D, 0xE1, 0x0B, 0x01, 0xB1, 0xCA, 0xE3, 0x23, 0x30, 0x39, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x05, 0x01, 0xB4, 0xDC, 0x61, 0x1B, 0x01, 0x7B, 0x50, 0x21, 0x21, 0x05, 0x21,
+    0x18, 0x03, 0xE3, 0x27, 0x30, 0x41, 0x01, 0xB3, 0xDA, 0x01, 0xB5, 0x52, 0x00, 0x00, 0x03, 0x62,
+    0x25, 0x27, 0x01, 0x4C, 0x52, 0x01, 0x98, 0x0C, 0x21, 0x40, 0x09, 0x21, 0x1F, 0x03, 0x21, 0x4C,
+    0x03, 0x63, 0x07, 0x23, 0x49, 0x01, 0xB5, 0x71, 0x00, 0x00, 0x03, 0x01, 0xB5, 0x67, 0x41, 0x25,
+    0x2E, 0x22, 0x21, 0x40, 0x04, 0x21, 0x32, 0x03, 0x65, 0x19, 0x1A, 0x21, 0x23, 0x27, 0x01, 0xB5,
+    0x88, 0x01, 0xB5, 0x88, 0x01, 0x55, 0xCF, 0x00, 0x00, 0x03, 0x01, 0xB5, 0x88, 0x41, 0x44, 0x13,
+    0x8C, 0x63, 0x07, 0x19, 0x27, 0x00, 0x00, 0x04, 0x01, 0xB5, 0xA1, 0x01, 0xB5, 0xA1, 0x21, 0x22,
+    0x0D, 0x22, 0x22, 0x48, 0x29, 0x03, 0x61, 0x01, 0x01, 0x73, 0xAB, 0x62, 0x2A, 0x44, 0x01, 0x7C,
+    0x6A, 0x01, 0xA8, 0x92, 0x64, 0x0A, 0x19, 0x1A, 0x25, 0x01, 0x14, 0xCB, 0x00, 0x00, 0x0E, 0x01,
+    0x90, 0x88, 0x00, 0x00, 0x09, 0x61, 0x04, 0x01, 0xA8, 0xAC, 0xC2, 0x0B, 0x40, 0x02, 0xAD, 0xEB,
+    0x2E, 0xE1, 0x25, 0x01, 0x97, 0x4B, 0x61, 0x4C, 0x01, 0x99, 0x2E, 0x21, 0x23, 0x05, 0x21, 0x2D,
+    0x03, 0x21, 0x22, 0x03, 0x21, 0x4C, 0x03, 0x62, 0x0B, 0x15, 0x01, 0x98, 0xA4, 0x01, 0x98, 0xA4,
+    0xC3, 0x15, 0x17, 0x40, 0x00, 0x0C, 0xBB, 0xC3, 0x00, 0x09, 0x23, 0x01, 0x07, 0x19, 0x30, 0x29,
+    0x0A, 0x61, 0x35, 0x01, 0xA5, 0xCF, 0xA1, 0x08, 0x05, 0x63, 0x07, 0x19, 0x2D, 0x00, 0x00, 0x03,
+    0x01, 0xB6, 0x19, 0x01, 0xB6, 0x19, 0x61, 0x0B, 0x01, 0x97, 0x90, 0x62, 0x07, 0x32, 0x01, 0xB6,
+    0x2B, 0x00, 0x00, 0x05, 0xF7, 0x01, 0x07, 0x0B, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1F, 0x21, 0x23,
+    0x25, 0x2A, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x40, 0x41, 0x47, 0x48, 0x49, 0x00, 0x02, 0xFE, 0x00,
+    0x02, 0xED, 0x01, 0xB4, 0x11, 0x01, 0xB6, 0x34, 0x01, 0xB6, 0x34, 0x00, 0x02, 0x0B, 0x01, 0xB6,
+    0x1B, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xED, 0x00, 0x01, 0xD6, 0x00, 0x01, 0xB1, 0x00, 0x01, 0x6D,
+    0x01, 0x79, 0x3E, 0x00, 0x00, 0xFA, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x83, 0x01,
+    0xAA, 0xE2, 0x00, 0x00, 0x70, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x1B, 0x00, 0x00,
+    0x09, 0xE1, 0x40, 0x01, 0xAE, 0x70, 0x21, 0x2D, 0x05, 0x61, 0x17, 0x01, 0x7F, 0x33, 0x21, 0x42,
+    0x05, 0x21, 0x4C, 0x03, 0xA1, 0x0B, 0x03, 0xE3, 0x01, 0x25, 0x40, 0x01, 0x91, 0x82, 0x01, 0x99,
+    0xA6, 0x00, 0xBC, 0x2F, 0x61, 0x40, 0x01, 0x50, 0x2B, 0x21, 0x4C, 0x05, 0x21, 0x23, 0x03, 0x21,
+    0x2D, 0x03, 0x21, 0x04, 0x03, 0x63, 0x04, 0x32, 0x40, 0x01, 0x99, 0x72, 0x00, 0x00, 0x1E, 0x00,
+    0x00, 0x03, 0x61, 0x38, 0x01, 0x13, 0x9A, 0xE4, 0x19, 0x2D, 0x30, 0x32, 0x01, 0xB6, 0xBB, 0x00,
+    0x00, 0x05, 0x01, 0xB6, 0xD7, 0x00, 0x76, 0x55, 0x21, 0x34, 0x41, 0xE2, 0x0B, 0x44, 0x01, 0xB6,
+    0x25, 0x01, 0x73, 0x9F, 0x62, 0x2D, 0x34, 0x01, 0xB6, 0x96, 0x01, 0x78, 0x8D, 0x61, 0x32, 0x01,
+    0x16, 0x2F, 0xE4, 0x15, 0x17, 0x21, 0x40, 0x01, 0xB4, 0xD8, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05,
+    0x01, 0x4F, 0x90, 0x61, 0x2D, 0x01, 0x90, 0xA3, 0x62, 0x19, 0x31, 0x01, 0xB7, 0x18, 0x01, 0x47,
+    0x61, 0x64, 0x15, 0x25, 0x32, 0x34, 0x01, 0xB2, 0x5F, 0x01, 0xB7, 0x05, 0x01, 0x53, 0xD6, 0x01,
+    0xB7, 0x21, 0x61, 0x17, 0x01, 0x4B, 0x68, 0x21, 0x4C, 0x05, 0x21, 0x01, 0x03, 0x61, 0x2D, 0x01,
+    0x7D, 0xD8, 0xA1, 0x21, 0x05, 0x21, 0x30, 0x03, 0xE2, 0x2A, 0x30, 0x01, 0x70, 0xB9, 0x01, 0xB7,
+    0x48, 0xE3, 0x19, 0x23, 0x2B, 0x01, 0xB6, 0xEB, 0x01, 0xB4, 0x39, 0x01, 0xB7, 0x18, 0x61, 0x1A,
+    0x01, 0x32, 0x41, 0x21, 0x07, 0x05, 0x21, 0x32, 0x03, 0x21, 0x19, 0x03, 0x21, 0x07, 0x03, 0x21,
+    0x32, 0x03, 0xE2, 0x17, 0x1A, 0x01, 0xA7, 0x98, 0x00, 0x00, 0x03, 0x63, 0x19, 0x21, 0x48, 0x00,
+    0x00, 0x2A, 0x00, 0x00, 0x09, 0x01, 0xB7, 0x42, 0x62, 0x35, 0x4C, 0x01, 0xA5, 0x20, 0x01, 0xB7,
+    0x88, 0xE3, 0x14, 0x16, 0x31, 0x01, 0x49, 0xB4, 0x00, 0x00, 0x09, 0x01, 0x47, 0xDA, 0xE5, 0x07,
+    0x14, 0x23, 0x27, 0x30, 0x01, 0xB7, 0x9E, 0x01, 0xB7, 0x9E, 0x00, 0x00, 0x0D, 0x00, 0xEB, 0xB3,
+    0x01, 0xB7, 0x9E, 0x64, 0x22, 0x48, 0x49, 0x4B, 0x00, 0x00, 0x15, 0x01, 0x9F, 0x29, 0x01, 0xB6,
+    0xF8, 0x01, 0x9F, 0x29, 0xE1, 0x14, 0x01, 0x9D, 0x40, 0x64, 0x01, 0x14, 0x19, 0x22, 0x01, 0xB7,
+    0xC9, 0x00, 0x00, 0x05, 0x01, 0xB7, 0xC9, 0x01, 0xB7, 0xC9, 0x61, 0x2D, 0x01, 0xB2, 0x2F, 0x22,
+    0x2D, 0x48, 0x16, 0x05, 0xE2, 0x0A, 0x1E, 0x01, 0x9C, 0x61, 0x01, 0xB7, 0x86, 0x21, 0x0A, 0x09,
+    0x63, 0x01, 0x08, 0x14, 0x01, 0x9B, 0x6F, 0x01, 0xB7, 0xF0, 0x01, 0xB7, 0xF0, 0xE2, 0x19, 0x32,
+    0x00, 0x72, 0x5F, 0x01, 0xB7, 0xFD, 0x62, 0x07, 0x32, 0x01, 0xB8, 0x06, 0x01, 0xA1, 0x80, 0xE1,
+    0x14, 0x01, 0x9F, 0xD3, 0x21, 0x2D, 0x05, 0x79, 0x01, 0x04, 0x0A, 0x0B, 0x14, 0x15, 0x17, 0x19,
+    0x1A, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x42, 0x47, 0x48, 0x49,
+    0x4B, 0x00, 0x01, 0x73, 0x00, 0x01, 0x52, 0x00, 0x01, 0x40, 0x00, 0x01, 0x2F, 0x00, 0x01, 0x2C,
+    0x01, 0xB3, 0x55, 0x01, 0xB8, 0x17, 0x00, 0x01, 0x15, 0x01, 0x95, 0x3F, 0x00, 0x01, 0x04, 0x01,
+    0xB7, 0xFB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF6, 0x01, 0xB2, 0xEC, 0x00, 0x00, 0xDD, 0x00, 0x00,
+    0xD2, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x64, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2A,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x61, 0x25, 0x01, 0x52,
+    0xC1, 0x21, 0x31, 0x05, 0x21, 0x01, 0x03, 0x21, 0x34, 0x03, 0x21, 0x0B, 0x03, 0xA1, 0x39, 0x03,
+    0x61, 0x13, 0x01, 0x94, 0x1D, 0x21, 0x27, 0x05, 0xA1, 0x30, 0x03, 0x61, 0x1A, 0x01, 0xB7, 0xA5,
+    0x21, 0x21, 0x05, 0x21, 0x34, 0x03, 0x63, 0x14, 0x1A, 0x21, 0x01, 0xB8, 0xA6, 0x01, 0xB8, 0xA6,
+    0x00, 0x67, 0x28, 0x21, 0x22, 0x0D, 0x65, 0x19, 0x34, 0x35, 0x47, 0x48, 0x01, 0xA1, 0xE6, 0x01,
+    0xB8, 0xAC, 0x00, 0x00, 0x03, 0x01, 0xB8, 0x67, 0x01, 0xB8, 0xB6, 0x62, 0x30, 0x34, 0x01, 0xB8,
+    0xCB, 0x01, 0xB8, 0x7C, 0x61, 0x23, 0x01, 0xB8, 0x79, 0x21, 0x30, 0x05, 0x41, 0x21, 0x2B, 0xC8,
+    0x62, 0x35, 0x40, 0x01, 0xB8, 0xE0, 0x00, 0x00, 0x04, 0xA1, 0x01, 0x09, 0x21, 0x4C, 0x03, 0x62,
+    0x23, 0x30, 0x00, 0x00, 0x03, 0x01, 0xB8, 0xEF, 0xE2, 0x09, 0x15, 0x01, 0xB8, 0xF4, 0x01, 0xB8,
+    0x92, 0x61, 0x39, 0x01, 0xB4, 0xE9, 0x61, 0x41, 0x01, 0xA1, 0xE1, 0xE7, 0x1B, 0x1C, 0x1F, 0x23,
+    0x2A, 0x30, 0x44, 0x01, 0xB4, 0x4D, 0x01, 0xB5, 0x29, 0x01, 0x6D, 0xBD, 0x01, 0x85, 0xAA, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0xA3, 0x95, 0xE1, 0x42, 0x01, 0xB6, 0x1A, 0x64, 0x1A, 0x21,
+    0x23, 0x48, 0x00, 0x00, 0x05, 0x01, 0xB9, 0x2D, 0x01, 0x5D, 0x4D, 0x01, 0xB9, 0x23, 0x64, 0x07,
+    0x19, 0x1A, 0x27, 0x01, 0xB9, 0x3E, 0x01, 0xB9, 0x3E, 0x01, 0xB9, 0x3E, 0x01, 0xB9, 0x3E, 0x65,
+    0x22, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x00, 0x11, 0x00, 0x0D, 0x06, 0x00, 0xBD, 0xE2, 0x01, 0xB1,
+    0xCB, 0x01, 0xB1, 0xCB, 0x62, 0x2D, 0x49, 0x01, 0xB9, 0x2B, 0x01, 0xB9, 0x0F, 0x61, 0x19, 0x01,
+    0x2B, 0xFB, 0x41, 0x0A, 0x5B, 0x22, 0xE7, 0x15, 0x17, 0x1A, 0x22, 0x2B, 0x2D, 0x43, 0x01, 0xB9,
+    0x10, 0x01, 0xB8, 0xB0, 0x01, 0x9B, 0x87, 0x01, 0xB8, 0xF1, 0x01, 0xB9, 0x5D, 0x01, 0xB9, 0x75,
+    0x01, 0xB7, 0x45, 0x63, 0x07, 0x19, 0x21, 0x01, 0xB9, 0x93, 0x01, 0x99, 0x5D, 0x00, 0x00, 0x1D,
+    0xE3, 0x14, 0x19, 0x2B, 0x01, 0xB2, 0xB2, 0x01, 0xB9, 0x3A, 0x01, 0xB9, 0x9F, 0x63, 0x07, 0x2D,
+    0x32, 0x01, 0xB9, 0xAD, 0x01, 0xB9, 0xAD, 0x00, 0x00, 0x0D, 0xE1, 0x23, 0x01, 0xB2, 0xCC, 0xE1,
+    0x22, 0x01, 0x9B, 0x29, 0x21, 0x49, 0x05, 0x21, 0x39, 0x03, 0x62, 0x08, 0x2A, 0x01, 0x8D, 0xC3,
+    0x00, 0x0C, 0x54, 0xE6, 0x17, 0x23, 0x2A, 0x2B, 0x2E, 0x40, 0x01, 0x8D, 0x85, 0x01, 0xAB, 0xF2,
+    0x01, 0xAD, 0xFC, 0x00, 0x00, 0x0C, 0x01, 0xB3, 0xB4, 0x00, 0x00, 0x09, 0x22, 0x19, 0x32, 0x32,
+    0x19, 0x63, 0x01, 0x30, 0x32, 0x01, 0xB9, 0xF1, 0x01, 0xB9, 0xF1, 0x01, 0xB6, 0x86, 0xF6, 0x01,
+    0x0A, 0x15, 0x19, 0x22, 0x23, 0x25, 0x27, 0x2B, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x01, 0x71, 0x00, 0x01, 0x66, 0x01, 0xB9, 0x95, 0x00, 0x01,
+    0x5B, 0x01, 0xB9, 0xFE, 0x00, 0x01, 0x48, 0x00, 0x01, 0x33, 0x01, 0xA6, 0xCC, 0x00, 0x01, 0x25,
+    0x00, 0x01, 0x0F, 0x00, 0x01, 0x06, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x9A, 0x00, 0x00, 0x91, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x51, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x0D, 0x01, 0xB9, 0x98, 0x61, 0x07, 0x01, 0x72, 0x20, 0x21, 0x31, 0x05, 0xE3,
+    0x08, 0x22, 0x2A, 0x01, 0x97, 0x87, 0x01, 0xB6, 0xF4, 0x00, 0x00, 0x03, 0x61, 0x16, 0x01, 0xA0,
+    0xE0, 0x21, 0x40, 0x05, 0x21, 0x38, 0x03, 0x21, 0x19, 0x03, 0xE5, 0x15, 0x27, 0x30, 0x32, 0x35,
+    0x01, 0xAC, 0x72, 0x01, 0x9C, 0x8B, 0x01, 0xBA, 0x7A, 0x00, 0x00, 0x03, 0x01, 0xBA, 0x7A, 0x62,
+    0x01, 0x07, 0x01, 0xBA, 0x8F, 0x00, 0x3F, 0xDA, 0x61, 0x16, 0x01, 0x89, 0xD3, 0x21, 0x01, 0x05,
+    0x21, 0x2D, 0x03, 0x61, 0x16, 0x01, 0xBA, 0x45, 0xA3, 0x34, 0x37, 0x44, 0x19, 0x08, 0x05, 0x62,
+    0x27, 0x38, 0x01, 0xBA, 0xAE, 0x01, 0xB1, 0xA6, 0x62, 0x22, 0x25, 0x01, 0xBA, 0x9C, 0x01, 0xB7,
+    0x92, 0x21, 0x25, 0x09, 0x21, 0x31, 0x03, 0xE5, 0x04, 0x14, 0x21, 0x27, 0x30, 0x01, 0xB9, 0xC5,
+    0x01, 0xBA, 0x6C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x01, 0xBA, 0xC7, 0x61, 0x17, 0x01, 0xB6,
+    0xFA, 0xA1, 0x40, 0x05, 0x64, 0x01, 0x07, 0x14, 0x19, 0x01, 0xBA, 0xE4, 0x01, 0xBA, 0xE4, 0x00,
+    0x00, 0x03, 0x01, 0xBA, 0xE4, 0x61, 0x22, 0x01, 0xBA, 0xB9, 0x62, 0x2D, 0x48, 0x01, 0xB1, 0x6E,
+    0x01, 0xB5, 0x48, 0xE1, 0x41, 0x01, 0xB8, 0xAD, 0x21, 0x32, 0x05, 0x6E, 0x01, 0x19, 0x21, 0x22,
+    0x23, 0x25, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x48, 0x49, 0x01, 0xB7, 0x29, 0x01, 0xBB, 0x0B,
+    0x01, 0xA0, 0x9D, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x91, 0x00, 0x00, 0x63, 0x01, 0xB7, 0xA0, 0x01,
+    0x7E, 0xE4, 0x00, 0x00, 0x44, 0x00, 0x00, 0x27, 0x00, 0x00, 0x16, 0x00, 0x00, 0x11, 0x01, 0xBA,
+    0xB6, 0x00, 0x00, 0x03, 0x62, 0x31, 0x4C, 0x01, 0xA8, 0x26, 0x01, 0xBB, 0x44, 0x21, 0x0B, 0x09,
+    0x61, 0x40, 0x01, 0x9C, 0x52, 0x21, 0x07, 0x05, 0x21, 0x38, 0x03, 0x21, 0x23, 0x03, 0x61, 0x30,
+    0x01, 0x5E, 0x05, 0x21, 0x08, 0x05, 0x21, 0x08, 0x03, 0x21, 0x31, 0x03, 0x41, 0x23, 0x3F, 0xFD,
+    0x21, 0x38, 0x04, 0x21, 0x2A, 0x03, 0x21, 0x22, 0x03, 0x21, 0x17, 0x03, 0xE4, 0x01, 0x27, 0x2A,
+    0x44, 0x00, 0x00, 0x21, 0x01, 0xA9, 0xAB, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x21, 0x04, 0x11,
+    0x62, 0x0A, 0x0B, 0x01, 0x90, 0x5E, 0x01, 0x90, 0x5E, 0x21, 0x40, 0x09, 0x22, 0x34, 0x35, 0x0F,
+    0x03, 0x41, 0x25, 0xFF, 0x51, 0x62, 0x2F, 0x42, 0x01, 0xBB, 0xA5, 0x00, 0x00, 0x04, 0x62, 0x19,
+    0x2D, 0x00, 0x00, 0x09, 0x01, 0x4B, 0xE2, 0x63, 0x19, 0x23, 0x42, 0x00, 0x00, 0x1B, 0x01, 0xBA,
+    0xAE, 0x00, 0x00, 0x09, 0x41, 0x34, 0x33, 0x55, 0x21, 0x2E, 0x04, 0x21, 0x32, 0x03, 0x21, 0x23,
+    0x03, 0x61, 0x2A, 0x01, 0x5C, 0x18, 0x21, 0x19, 0x05, 0x61, 0x19, 0x01, 0x82, 0x85, 0x65, 0x19,
+    0x2A, 0x2D, 0x40, 0x41, 0x01, 0x9D, 0x1F, 0x01, 0xBB, 0xC2, 0x01, 0xB7, 0xB2, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x05, 0xE1, 0x39, 0x01, 0xBB, 0xBA, 0x62, 0x32, 0x34, 0x00, 0x38, 0x99, 0x01, 0xBA,
+    0x61, 0x61, 0x22, 0x01, 0x96, 0x2F, 0x62, 0x21, 0x32, 0x01, 0xBC, 0x06, 0x00, 0x00, 0x05, 0x21,
+    0x22, 0x09, 0x63, 0x21, 0x32, 0x34, 0x01, 0xBC, 0x12, 0x01, 0xBA, 0x60, 0x00, 0x00, 0x03, 0x62,
+    0x21, 0x32, 0x01, 0xBC, 0x1F, 0x01, 0xBC, 0x1F, 0x61, 0x32, 0x01, 0xAA, 0x03, 0x22, 0x19, 0x22,
+    0x0E, 0x05, 0xE2, 0x14, 0x40, 0x01, 0xBB, 0xCC, 0x01, 0x88, 0x11, 0x61, 0x35, 0x01, 0xB4, 0x40,
+    0x41, 0x34, 0x38, 0xE1, 0x61, 0x16, 0x01, 0x99, 0x6C, 0x61, 0x2A, 0x01, 0x87, 0xEE, 0x21, 0x31,
+    0x05, 0xE2, 0x01, 0x23, 0x01, 0xBC, 0x0B, 0x01, 0xAB, 0x89, 0x41, 0x32, 0xE9, 0x88, 0x21, 0x19,
+    0x04, 0x62, 0x08, 0x2A, 0x01, 0xB7, 0x9F, 0x00, 0x00, 0x03, 0x61, 0x19, 0x01, 0x0A, 0x7A, 0x21,
+    0x30, 0x05, 0x21, 0x32, 0x03, 0x21, 0x23, 0x03, 0x21, 0x40, 0x03, 0x21, 0x1E, 0x03, 0xF2, 0x14,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x32, 0x34, 0x35, 0x40,
+    0x44, 0x01, 0xBC, 0x18, 0x01, 0x69, 0xA8, 0x00, 0x00, 0x86, 0x00, 0x00, 0x6C, 0x01, 0x87, 0x24,
+    0x01, 0xB9, 0xF7, 0x00, 0x00, 0x51, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x43, 0x01, 0xAA, 0xAD, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x30, 0x00, 0x00, 0x2D, 0x01, 0x26, 0x48, 0x01, 0xBC,
+    0x7E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0x61, 0x25, 0x01, 0x06, 0x0F, 0x21, 0x1E, 0x05, 0xE1,
+    0x49, 0x01, 0xBC, 0xCF, 0x21, 0x1B, 0x05, 0x43, 0x1B, 0x40, 0x42, 0x5D, 0xB8, 0x00, 0x0B, 0x00,
+    0x03, 0x61, 0x14, 0x01, 0x9E, 0x4B, 0x21, 0x34, 0x05, 0x61, 0x34, 0x01, 0x7F, 0xF3, 0x41, 0x32,
+    0xA7, 0xD0, 0xE4, 0x08, 0x14, 0x21, 0x40, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04,
+    0x01, 0x7E, 0xA4, 0xE1, 0x40, 0x01, 0x7F, 0xA8, 0x61, 0x21, 0x01, 0x85, 0xBC, 0x64, 0x14, 0x19,
+    0x34, 0x42, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x0A, 0x01, 0xBC, 0xBE, 0x00, 0x00, 0x05, 0x61, 0x39,
+    0x01, 0x56, 0xFD, 0x62, 0x04, 0x25, 0x01, 0xB5, 0x02, 0x00, 0x00, 0x05, 0x62, 0x31, 0x39, 0x01,
+    0xBD, 0x0A, 0x01, 0xBA, 0x1E, 0x62, 0x23, 0x34, 0x01, 0xA2, 0x45, 0x01, 0xBB, 0x9E, 0x62, 0x30,
+    0x34, 0x01, 0xBD, 0x3E, 0x01, 0xB5, 0xBA, 0x63, 0x30, 0x31, 0x39, 0x01, 0xBD, 0x47, 0x01, 0x22,
+    0xFA, 0x01, 0xBD, 0x34, 0x62, 0x16, 0x38, 0x01, 0xBC, 0xF9, 0x01, 0x25, 0x2D, 0x62, 0x23, 0x25,
+    0x00, 0x84, 0x68, 0x01, 0xA1, 0xDA, 0xEF, 0x14, 0x17, 0x18, 0x19, 0x23, 0x27, 0x28, 0x29, 0x2A,
+    0x2D, 0x30, 0x31, 0x32, 0x35, 0x42, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x31, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x1F, 0x01, 0xAB, 0x95, 0x01, 0xBD, 0x66, 0x01, 0xBD, 0x66, 0x00, 0x00,
+    0x12, 0x01, 0xBD, 0x66, 0x01, 0xBD, 0x66, 0x01, 0x5E, 0x3E, 0x00, 0x00, 0x09, 0x01, 0xBD, 0x66,
+    0x01, 0xA3, 0xA3, 0xE1, 0x32, 0x01, 0xBD, 0x45, 0x62, 0x31, 0x32, 0x01, 0x1E, 0x60, 0x01, 0xBD,
+    0x4A, 0x61, 0x20, 0x01, 0x04, 0x62, 0xE6, 0x01, 0x19, 0x1A, 0x21, 0x30, 0x32, 0x00, 0x00, 0x13,
+    0x01, 0xBA, 0xF4, 0x00, 0x00, 0x0E, 0x01, 0x84, 0x1B, 0x01, 0xBD, 0xB6, 0x00, 0x00, 0x05, 0x61,
+    0x01, 0x01, 0x83, 0x85, 0x21, 0x32, 0x05, 0xA1, 0x1F, 0x03, 0xE2, 0x27, 0x4C, 0x01, 0x39, 0x32,
+    0x00, 0x00, 0x03, 0x63, 0x19, 0x1A, 0x23, 0x01, 0xBA, 0xD5, 0x01, 0x92, 0xB1, 0x01, 0xAA, 0xC5,
+    0x61, 0x21, 0x01, 0x0F, 0x50, 0x62, 0x1A, 0x21, 0x01, 0xBD, 0xF5, 0x00, 0x00, 0x05, 0x43, 0x04,
+    0x40, 0x42, 0x27, 0x8E, 0x00, 0x1B, 0x00, 0x09, 0x21, 0x4C, 0x0A, 0x65, 0x0D, 0x14, 0x21, 0x23,
+    0x30, 0x01, 0xBE, 0x0B, 0x01, 0x9E, 0x65, 0x01, 0xBE, 0x0B, 0x00, 0x00, 0x03, 0x00, 0xAF, 0x02,
+    0xE3, 0x19, 0x30, 0x40, 0x01, 0xBE, 0x04, 0x01, 0x88, 0xF8, 0x01, 0x56, 0xAE, 0xE1, 0x17, 0x01,
+    0xB9, 0x6F, 0x67, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x48, 0x49, 0x01, 0xBE, 0x32, 0x01, 0xBE, 0x32,
+    0x00, 0x00, 0x05, 0x01, 0xBE, 0x32, 0x01, 0xBE, 0x32, 0x01, 0xBE, 0x28, 0x01, 0xBC, 0x23, 0x61,
+    0x34, 0x01, 0x17, 0x0B, 0x21, 0x19, 0x05, 0x21, 0x25, 0x03, 0x21, 0x39, 0x03, 0x21, 0x21, 0x03,
+    0x21, 0x32, 0x03, 0x21, 0x49, 0x03, 0x61, 0x49, 0x01, 0xBA, 0xF0, 0x21, 0x35, 0x05, 0x21, 0x0B,
+    0x03, 0xE4, 0x16, 0x1F, 0x40, 0x44, 0x00, 0x99, 0x6A, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x01,
+    0xBC, 0xE9, 0x61, 0x21, 0x01, 0x05, 0x3E, 0x21, 0x27, 0x05, 0x21, 0x48, 0x03, 0xA1, 0x23, 0x03,
+    0xE1, 0x06, 0x01, 0xBE, 0x90, 0x66, 0x07, 0x19, 0x1A, 0x21, 0x23, 0x27, 0x01, 0xBE, 0x95, 0x00,
+    0x00, 0x24, 0x01, 0xBE, 0x95, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0x01, 0xBE, 0x95, 0x61, 0x22,
+    0x01, 0xA3, 0x3C, 0x63, 0x22, 0x48, 0x49, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x05, 0x01, 0xBE, 0x47,
+    0xE2, 0x01, 0x19, 0x01, 0xBE, 0xC0, 0x01, 0xBE, 0xC0, 0x63, 0x2D, 0x48, 0x49, 0x00, 0x00, 0x09,
+    0x01, 0xBE, 0x74, 0x01, 0xBE, 0x74, 0x65, 0x01, 0x04, 0x27, 0x2A, 0x42, 0x00, 0xE0, 0x28, 0x01,
+    0xB6, 0xB5, 0x00, 0x01, 0xED, 0x00, 0x54, 0xE8, 0x01, 0xAC, 0xA7, 0xE2, 0x23, 0x27, 0x01, 0xBE,
+    0xCF, 0x01, 0xBD, 0xF8, 0x21, 0x28, 0x09, 0x63, 0x1A, 0x25, 0x27, 0x01, 0x99, 0xBB, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x03, 0x62, 0x01, 0x08, 0x01, 0x99, 0xDC, 0x01, 0xBF, 0x04, 0xE4, 0x01, 0x19,
+    0x43, 0x44, 0x01, 0xB1, 0x2C, 0x01, 0x84, 0xCB, 0x01, 0xBE, 0xBE, 0x01, 0xBE, 0xC7, 0xE3, 0x2B,
+    0x2D, 0x32, 0x01, 0xBF, 0x02, 0x01, 0xBF, 0x1E, 0x00, 0x00, 0x11, 0x61, 0x15, 0x01, 0xBA, 0x32,
+    0xA1, 0x40, 0x05, 0x63, 0x07, 0x2D, 0x32, 0x00, 0x00, 0x03, 0x01, 0xBF, 0x33, 0x01, 0xBF, 0x33,
+    0xF8, 0x01, 0x04, 0x07, 0x17, 0x19, 0x1B, 0x1E, 0x21, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2D,
+    0x32, 0x34, 0x35, 0x37, 0x40, 0x42, 0x47, 0x48, 0x49, 0x00, 0x03, 0xF3, 0x00, 0x03, 0x89, 0x01,
+    0xBF, 0x40, 0x00, 0x03, 0x72, 0x00, 0x03, 0x62, 0x00, 0x03, 0x4D, 0x00, 0x02, 0xC2, 0x00, 0x02,
+    0x69, 0x00, 0x02, 0x33, 0x00, 0x02, 0x1D, 0x00, 0x01, 0xDA, 0x00, 0x01, 0x8A, 0x01, 0x80, 0x7D,
+    0x00, 0x01, 0x66, 0x00, 0x01, 0x35, 0x00, 0x01, 0x20, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x8D, 0x00,
+    0x00, 0x77, 0x00, 0x00, 0x49, 0x01, 0xBC, 0x0D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x0D, 0x61, 0x19, 0x01, 0x39, 0x09, 0x21, 0x27, 0x05, 0xA1, 0x2A, 0x03, 0x62, 0x23, 0x40, 0x00,
+    0x00, 0x03, 0x01, 0x85, 0xFD, 0x21, 0x22, 0x09, 0x64, 0x19, 0x23, 0x2D, 0x35, 0x01, 0xBC, 0xD4,
+    0x01, 0xBF, 0x69, 0x01, 0xBF, 0xB8, 0x00, 0x00, 0x03, 0x62, 0x30, 0x31, 0x01, 0xBF, 0xC9, 0x01,
+    0xBD, 0xBA, 0x63, 0x02, 0x23, 0x32, 0x00, 0x00, 0x09, 0x01, 0x9F, 0x17, 0x01, 0x88, 0x36, 0x61,
+    0x19, 0x01, 0xA2, 0x9B, 0x21, 0x48, 0x05, 0x21, 0x31, 0x03, 0x41, 0x40, 0x56, 0x01, 0x41, 0x2D,
+    0xAA, 0xD0, 0x21, 0x27, 0x04, 0xE5, 0x1A, 0x23, 0x2A, 0x34, 0x40, 0x01, 0x80, 0x4C, 0x01, 0xBF,
+    0xF5, 0x00, 0x00, 0x0B, 0x01, 0x12, 0xC3, 0x00, 0x00, 0x03, 0x61, 0x27, 0x01, 0xB8, 0x0F, 0x21,
+    0x34, 0x05, 0x63, 0x08, 0x17, 0x32, 0x01, 0xBB, 0x54, 0x00, 0x21, 0xF4, 0x01, 0xBF, 0xB4, 0xE1,
+    0x15, 0x01, 0xA5, 0x5A, 0x21, 0x34, 0x05, 0xE1, 0x43, 0x01, 0xAD, 0x09, 0x62, 0x14, 0x16, 0x01,
+    0xC0, 0x2C, 0x01, 0xC0, 0x2C, 0x21, 0x32, 0x09, 0x64, 0x04, 0x19, 0x21, 0x40, 0x01, 0xAF, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0xFE, 0x18, 0x01, 0x7A, 0x68, 0x61, 0x40, 0x01, 0xA6, 0x45, 0x21, 0x4C,
+    0x05, 0x21, 0x17, 0x03, 0x61, 0x23, 0x01, 0xC0, 0x47, 0x21, 0x1B, 0x05, 0x21, 0x30, 0x03, 0xA1,
+    0x21, 0x03, 0x63, 0x19, 0x1A, 0x48, 0x00, 0x00, 0x03, 0x01, 0x9A, 0xCE, 0x01, 0xC0, 0x29, 0xE1,
+    0x22, 0x01, 0x68, 0x01, 0xE4, 0x07, 0x19, 0x21, 0x23, 0x01, 0xC0, 0x74, 0x01, 0xC0, 0x74, 0x00,
+    0x00, 0x05, 0x01, 0xC0, 0x74, 0x21, 0x22, 0x11, 0xE1, 0x08, 0x01, 0xC0, 0x84, 0x21, 0x07, 0x05,
+    0x21, 0x2D, 0x03, 0x61, 0x40, 0x01, 0x95, 0x67, 0x21, 0x21, 0x05, 0x21, 0x32, 0x03, 0x21, 0x49,
+    0x03, 0x21, 0x25, 0x03, 0x61, 0x1C, 0x01, 0xB0, 0xD7, 0x21, 0x38, 0x05, 0x61, 0x2A, 0x01, 0xA2,
+    0xBD, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0x61, 0x15, 0x01, 0x8C, 0xDD, 0x21, 0x14, 0x05, 0x21,
+    0x37, 0x03, 0xA4, 0x01, 0x1A, 0x1B, 0x22, 0x21, 0x19, 0x0E, 0x03, 0x21, 0x2D, 0x09, 0x21, 0x48,
+    0x03, 0x21, 0x37, 0x03, 0x21, 0x22, 0x03, 0xE3, 0x17, 0x2B, 0x40, 0x01, 0xBF, 0xD8, 0x01, 0xC0,
+    0x71, 0x00, 0x00, 0x03, 0x21, 0x2D, 0x0D, 0x63, 0x2D, 0x48, 0x49, 0x01, 0xB5, 0x48, 0x00, 0x00,
+    0x57, 0x00, 0x00, 0x03, 0x62, 0x08, 0x18, 0x01, 0xA3, 0xA1, 0x00, 0x6E, 0xF4, 0x41, 0x23, 0x38,
+    0x4C, 0x21, 0x1A, 0x04, 0x61, 0x1F, 0x01, 0xBC, 0xDB, 0x61, 0x34, 0x01, 0x20, 0x3B, 0x21, 0x27,
+    0x05, 0xA1, 0x40, 0x03, 0x21, 0x15, 0x03, 0x62, 0x07, 0x32, 0x01, 0xC1, 0x17, 0x01, 0x15, 0x50,
+    0x79, 0x01, 0x04, 0x0A, 0x15, 0x1A, 0x1B, 0x1F, 0x21, 0x22, 0x23, 0x27, 0x29, 0x2A, 0x2D, 0x32,
+    0x34, 0x35, 0x37, 0x40, 0x41, 0x42, 0x44, 0x47, 0x48, 0x49, 0x00, 0x01, 0x4E, 0x01, 0xAD, 0xC2,
+    0x00, 0x01, 0x39, 0x00, 0x01, 0x2B, 0x00, 0x01, 0x11, 0x00, 0x01, 0x0E, 0x00, 0x38, 0xC5, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xE8, 0x01, 0xBF, 0x85, 0x01, 0xA3, 0x31, 0x00, 0x00,
+    0xCF, 0x01, 0xC1, 0x20, 0x01, 0x60, 0xE3, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x39,
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x1F, 0x00, 0x3A, 0xE1, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00,
+    0x00, 0x09, 0x01, 0x60, 0x2D, 0x61, 0x07, 0x01, 0x82, 0x09, 0x21, 0x49, 0x05, 0x21, 0x34, 0x03,
+    0x62, 0x01, 0x2D, 0x00, 0x00, 0x03, 0x01, 0xC1, 0x57, 0x61, 0x01, 0x01, 0x81, 0xF0, 0x41, 0x22,
+    0x5B, 0x2B, 0x21, 0x25, 0x04, 0x61, 0x21, 0x01, 0xB0, 0xEA, 0xA2, 0x31, 0x32, 0x08, 0x05, 0x61,
+    0x1E, 0x01, 0xBE, 0xA1, 0x21, 0x23, 0x05, 0x21, 0x23, 0x03, 0x62, 0x23, 0x25, 0x01, 0x69, 0xC4,
+    0x01, 0xC1, 0xBA, 0x61, 0x1E, 0x01, 0xA4, 0xC2, 0x41, 0x0A, 0x05, 0x6E, 0x21, 0x32, 0x04, 0x62,
+    0x15, 0x19, 0x01, 0xC1, 0x89, 0x01, 0x9C, 0x69, 0xE4, 0x1A, 0x23, 0x32, 0x34, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x0C, 0x01, 0xC1, 0x53, 0x00, 0x00, 0x09, 0x62, 0x01, 0x35, 0x01, 0xC1, 0xE9, 0x01,
+    0xC1, 0x8B, 0x62, 0x1B, 0x4C, 0x00, 0x65, 0xFA, 0x01, 0xC1, 0xF2, 0x21, 0x04, 0x09, 0xA1, 0x07,
+    0x03, 0x61, 0x1E, 0x01, 0xAE, 0xE3, 0xEB, 0x01, 0x04, 0x18, 0x1A, 0x1E, 0x21, 0x23, 0x27, 0x28,
+    0x32, 0x40, 0x00, 0x00, 0x5C, 0x01, 0x8E, 0xEF, 0x01, 0xA7, 0x12, 0x00, 0x00, 0x4F, 0x00, 0x00,
+    0x4C, 0x00, 0x00, 0x2E, 0x00, 0xCA, 0xAD, 0x01, 0x6A, 0x0C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x05, 0x64, 0x08, 0x0D, 0x1E, 0x27, 0x00, 0x00, 0x2D, 0x01, 0xC1, 0xCD, 0x01, 0xB7,
+    0x85, 0x01, 0x85, 0xA4, 0x63, 0x07, 0x32, 0x49, 0x01, 0xC2, 0x44, 0x01, 0xC2, 0x44, 0x01, 0xC1,
+    0xDE, 0x62, 0x34, 0x4C, 0x01, 0xC2, 0x18, 0x01, 0xC2, 0x51, 0xE2, 0x0B, 0x17, 0x00, 0x00, 0x09,
+    0x01, 0x38, 0x7D, 0x61, 0x27, 0x01, 0x54, 0xA9, 0xE1, 0x40, 0x01, 0x30, 0x40, 0x62, 0x07, 0x25,
+    0x01, 0xC2, 0x6D, 0x00, 0x00, 0x05, 0x67, 0x01, 0x04, 0x25, 0x32, 0x34, 0x35, 0x38, 0x01, 0xC2,
+    0x76, 0x01, 0xC2, 0x76, 0x01, 0x9B, 0x2D, 0x00, 0x00, 0x13, 0x00, 0x00, 0x09, 0x01, 0xC2, 0x0A,
+    0x01, 0xBF, 0x68, 0x61, 0x31, 0x01, 0x84, 0x2C, 0x62, 0x22, 0x48, 0x01, 0xC0, 0x89, 0x01, 0xBB,
+    0x14, 0x21, 0x35, 0x09, 0x62, 0x01, 0x22, 0x01, 0x9C, 0xAB, 0x00, 0x00, 0x03, 0x65, 0x1F, 0x2D,
+    0x34, 0x40, 0x47, 0x00, 0x00, 0x1A, 0x01, 0xC2, 0xAD, 0x01, 0x84, 0x18, 0x00, 0x00, 0x09, 0x01,
+    0xC0, 0x9E, 0xE2, 0x1A, 0x34, 0x01, 0x83, 0x19, 0x01, 0xAF, 0xD8, 0x61, 0x21, 0x01, 0x4F, 0xB7,
+    0x21, 0x32, 0x05, 0x61, 0x40, 0x01, 0x30, 0xAB, 0x21, 0x35, 0x05, 0x41, 0x14, 0xCA, 0xC0, 0x21,
+    0x39, 0x04, 0xE5, 0x01, 0x04, 0x19, 0x21, 0x25, 0x00, 0x00, 0x12, 0x00, 0x00, 0x0A, 0x01, 0xC2,
+    0xE2, 0x00, 0x00, 0x03, 0x01, 0xA8, 0x74, 0x21, 0x4C, 0x15, 0x41, 0x4C, 0x3B, 0x63, 0xE1, 0x1A,
+    0x01, 0xBF, 0x93, 0x23, 0x23, 0x2B, 0x30, 0x0C, 0x09, 0x05, 0xE2, 0x25, 0x41, 0x01, 0x66, 0xD3,
+    0x01, 0xAF, 0xEC, 0xE8, 0x15, 0x1A, 0x21, 0x23, 0x30, 0x41, 0x43, 0x44, 0x01, 0xC2, 0x0A, 0x01,
+    0xC3, 0x06, 0x01, 0xC0, 0xC7, 0x01, 0x6E, 0x3E, 0x00, 0x00, 0x09, 0x01, 0xB5, 0x0B, 0x01, 0xC0,
+    0xE2, 0x01, 0xAF, 0xAB, 0xE1, 0x42, 0x01, 0x8C, 0xBC, 0x61, 0x14, 0x01, 0xB0, 0xD1, 0x21, 0x40,
+    0x05, 0x62, 0x01, 0x18, 0x01, 0xC3, 0x41, 0x00, 0x00, 0x03, 0x21, 0x4C, 0x09, 0x64, 0x01, 0x23,
+    0x48, 0x49, 0x00, 0x00, 0x19, 0x00, 0x00, 0x03, 0x01, 0xC3, 0x43, 0x01, 0xC1, 0x3E, 0x61, 0x1A,
+    0x01, 0xC2, 0xEF, 0xA1, 0x40, 0x05, 0x64, 0x01, 0x14, 0x19, 0x23, 0x01, 0xC3, 0x66, 0x00, 0x00,
+    0x03, 0x01, 0xC3, 0x66, 0x01, 0xC3, 0x4A, 0x63, 0x22, 0x48, 0x49, 0x00, 0x00, 0x11, 0x01, 0xC0,
+    0x01, 0x00, 0x17, 0x2E, 0x63, 0x2D, 0x48, 0x49, 0x01, 0xAA, 0x15, 0x01, 0xC3, 0x2F, 0x00, 0x0B,
+    0xAA, 0x41, 0x2A, 0x2D, 0x9D, 0x21, 0x38, 0x04, 0x21, 0x23, 0x03, 0x21, 0x25, 0x03, 0x62, 0x15,
+    0x2A, 0x01, 0x15, 0x57, 0x00, 0xFE, 0x39, 0xA1, 0x40, 0x09, 0x21, 0x14, 0x03, 0x61, 0x17, 0x01,
+    0xB2, 0xCD, 0xA1, 0x40, 0x05, 0x21, 0x21, 0x03, 0x21, 0x48, 0x03, 0xC1, 0x40, 0x93, 0x9B, 0x21,
+    0x2D, 0x04, 0x22, 0x34, 0x48, 0x0A, 0x03, 0x21, 0x23, 0x05, 0xA1, 0x40, 0x03, 0xE2, 0x2D, 0x32,
+    0x00, 0x00, 0x03, 0x01, 0xC2, 0xA5, 0x75, 0x04, 0x07, 0x0D, 0x13, 0x15, 0x19, 0x1A, 0x23, 0x25,
+    0x2A, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x42, 0x47, 0x48, 0x49, 0x4A, 0x00, 0x02, 0x46, 0x00,
+    0x02, 0x3D, 0x00, 0x01, 0xA3, 0x01, 0xC1, 0xA5, 0x00, 0x01, 0x92, 0x00, 0x01, 0x7C, 0x01, 0xA5,
+    0x40, 0x00, 0x01, 0x60, 0x00, 0x01, 0x29, 0x00, 0x01, 0x14, 0x00, 0x00, 0xD3, 0x01, 0xC3, 0xD6,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x89, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x52, 0x00, 0x00, 0x3B, 0x00,
+    0x00, 0x2C, 0x01, 0xC3, 0xCC, 0x00, 0x00, 0x09, 0x01, 0xBE, 0x41, 0xE1, 0x02, 0x01, 0xC4, 0x0F,
+    0xC1, 0x21, 0xCC, 0xE5, 0xE3, 0x1E, 0x2D, 0x32, 0x01, 0xC3, 0x12, 0x01, 0xC4, 0x2A, 0x00, 0x00,
+    0x04, 0x63, 0x22, 0x35, 0x4C, 0x01, 0xA9, 0xBD, 0x01, 0xC4, 0x41, 0x01, 0xC4, 0x41, 0x61, 0x35,
+    0x01, 0xA4, 0x81, 0x62, 0x14, 0x17, 0x00, 0x00, 0x05, 0x01, 0xA8, 0xD0, 0xE2, 0x24, 0x2A, 0x00,
+    0x00, 0x09, 0x01, 0x6B, 0xEE, 0x65, 0x07, 0x0D, 0x1A, 0x27, 0x30, 0x01, 0xC4, 0x65, 0x01, 0xC4,
+    0x65, 0x01, 0xC4, 0x65, 0x01, 0xC4, 0x65, 0x01, 0xC4, 0x65, 0x63, 0x22, 0x49, 0x4A, 0x00, 0x00,
+    0x15, 0x00, 0x05, 0xCC, 0x01, 0xAE, 0xFD, 0x62, 0x48, 0x49, 0x01, 0xC3, 0x7B, 0x01, 0xC0, 0x79,
+    0xEA, 0x15, 0x21, 0x22, 0x2D, 0x32, 0x35, 0x37, 0x39, 0x47, 0x48, 0x01, 0xC4, 0x90, 0x00, 0x00,
+    0x34, 0x01, 0xC4, 0x90, 0x01, 0xC1, 0x97, 0x01, 0xC1, 0x97, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09,
+    0x01, 0xC4, 0x90, 0x01, 0xC4, 0x86, 0x01, 0xC4, 0x2A, 0xE1, 0x41, 0x01, 0x57, 0x8E, 0x62, 0x19,
+    0x27, 0x00, 0x00, 0x05, 0x01, 0xC4, 0xBE, 0x21, 0x22, 0x09, 0x62, 0x48, 0x49, 0x00, 0x00, 0x03,
+    0x01, 0xC4, 0x0F, 0x62, 0x2D, 0x49, 0x00, 0xEA, 0x82, 0x01, 0xC3, 0xC7, 0xE1, 0x1B, 0x01, 0x8A,
+    0x3A, 0x62, 0x07, 0x32, 0x00, 0x00, 0x05, 0x01, 0xC4, 0xE1, 0xE7, 0x0D, 0x27, 0x32, 0x35, 0x37,
+    0x48, 0x49, 0x01, 0xB9, 0x17, 0x01, 0xC4, 0xEA, 0x01, 0xC1, 0xF1, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x09, 0x01, 0xC4, 0x84, 0xE2, 0x25, 0x31, 0x01, 0xC5, 0x07, 0x01, 0xB1, 0xE9,
+    0x63, 0x01, 0x25, 0x38, 0x01, 0xC3, 0xD8, 0x01, 0xC5, 0x10, 0x01, 0xA8, 0x34, 0x63, 0x19, 0x35,
+    0x47, 0x01, 0xC0, 0xF8, 0x01, 0xC4, 0x62, 0x01, 0xB7, 0xF4, 0x21, 0x0B, 0x0D, 0x61, 0x23, 0x01,
+    0x24, 0x1A, 0x21, 0x15, 0x05, 0xA2, 0x40, 0x42, 0x0B, 0x03, 0x21, 0x4C, 0x05, 0x21, 0x23, 0x03,
+    0xE1, 0x1B, 0x01, 0xC1, 0xD5, 0xE1, 0x40, 0x01, 0x99, 0xEE, 0x61, 0x2B, 0x01, 0x76, 0x9F, 0x62,
+    0x23, 0x25, 0x00, 0x00, 0x05, 0x01, 0xC5, 0x4F, 0xE3, 0x30, 0x40, 0x42, 0x00, 0x00, 0x13, 0x01,
+    0x5F, 0x9D, 0x00, 0x00, 0x09, 0xE2, 0x2D, 0x42, 0x01, 0xC5, 0x64, 0x01, 0x8A, 0xCE, 0x66, 0x01,
+    0x07, 0x14, 0x1A, 0x48, 0x4A, 0x01, 0xC5, 0x6E, 0x01, 0x9F, 0xDA, 0x00, 0x00, 0x09, 0x01, 0xC5,
+    0x6E, 0x01, 0xC5, 0x35, 0x01, 0xC1, 0x56, 0xE5, 0x01, 0x07, 0x19, 0x27, 0x30, 0x01, 0xC5, 0x87,
+    0x01, 0x32, 0x72, 0x01, 0xA4, 0x5F, 0x01, 0xC5, 0x87, 0x01, 0xC5, 0x87, 0x61, 0x22, 0x01, 0xB7,
+    0xB0, 0x64, 0x22, 0x48, 0x49, 0x4A, 0x00, 0x00, 0x1A, 0x01, 0xBE, 0x1D, 0x01, 0xAD, 0x17, 0x00,
+    0x00, 0x05, 0x62, 0x01, 0x22, 0x01, 0xC5, 0xB2, 0x01, 0x8C, 0xB9, 0x63, 0x2D, 0x48, 0x49, 0x00,
+    0x00, 0x09, 0x01, 0xC1, 0xAD, 0x01, 0xC0, 0x09, 0xE2, 0x16, 0x1C, 0x01, 0xC1, 0xB0, 0x01, 0xC5,
+    0x02, 0xE1, 0x32, 0x01, 0xC5, 0x8B, 0xE5, 0x01, 0x15, 0x2A, 0x43, 0x44, 0x00, 0x00, 0x05, 0x01,
+    0xBE, 0x9D, 0x01, 0x7B, 0x87, 0x01, 0x39, 0xE0, 0x01, 0xC5, 0x90, 0x22, 0x14, 0x19, 0x23, 0x15,
+    0xE2, 0x01, 0x2B, 0x01, 0x2A, 0x7A, 0x01, 0xC5, 0xD7, 0x62, 0x07, 0x32, 0x01, 0xC5, 0xF9, 0x00,
+    0x00, 0x09, 0xC1, 0x1B, 0x94, 0xAE, 0xE2, 0x07, 0x32, 0x01, 0xC6, 0x06, 0x00, 0x00, 0x04, 0x62,
+    0x01, 0x32, 0x01, 0xC6, 0x0F, 0x01, 0xC6, 0x0F, 0x41, 0x2B, 0x72, 0x83, 0xA1, 0x40, 0x04, 0xE1,
+    0x2E, 0x01, 0x9A, 0xF7, 0xE3, 0x07, 0x2D, 0x32, 0x01, 0xC6, 0x24, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x05, 0x73, 0x01, 0x15, 0x22, 0x23, 0x25, 0x28, 0x2A, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x02, 0x06, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x01,
+    0xA1, 0x00, 0x01, 0x47, 0x00, 0x01, 0x2A, 0x00, 0x01, 0x21, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF1,
+    0x00, 0x00, 0xD9, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x90, 0x00, 0x00, 0x76, 0x01, 0xA8, 0xDA, 0x00,
+    0x00, 0x46, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x22, 0x00, 0x00, 0x0D, 0x61, 0x08,
+    0x01, 0xBD, 0xF4, 0x63, 0x34, 0x35, 0x47, 0x01, 0xC4, 0x74, 0x01, 0xC3, 0x0D, 0x00, 0x00, 0x05,
+    0xE3, 0x2D, 0x34, 0x41, 0x01, 0xC6, 0x90, 0x01, 0xC2, 0x78, 0x01, 0x93, 0x5B, 0xE1, 0x44, 0x01,
+    0x51, 0x8A, 0xE7, 0x2D, 0x30, 0x32, 0x35, 0x47, 0x48, 0x49, 0x00, 0x00, 0x05, 0x01, 0xC6, 0xA2,
+    0x01, 0xC3, 0x37, 0x01, 0xC3, 0x2C, 0x01, 0xC6, 0x53, 0x01, 0xC6, 0xA2, 0x01, 0xC6, 0xA2, 0x62,
+    0x34, 0x40, 0x01, 0x0B, 0x68, 0x01, 0x8F, 0x32, 0xE3, 0x02, 0x2B, 0x30, 0x01, 0xC6, 0x8F, 0x01,
+    0xC5, 0xBF, 0x01, 0xC6, 0xC8, 0x62, 0x19, 0x49, 0x01, 0xC6, 0xD5, 0x01, 0xC6, 0xCB, 0xE2, 0x08,
+    0x19, 0x01, 0xA9, 0xDD, 0x01, 0xBB, 0xEE, 0xE3, 0x01, 0x14, 0x19, 0x00, 0x00, 0x09, 0x01, 0xC6,
+    0xE7, 0x01, 0xC6, 0xE7, 0x42, 0x2D, 0x48, 0x00, 0x0D, 0x21, 0xC2, 0xE1, 0x1C, 0x01, 0xC6, 0xF1,
+    0x21, 0x32, 0x05, 0xEF, 0x07, 0x0A, 0x14, 0x19, 0x22, 0x25, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37,
+    0x47, 0x48, 0x49, 0x01, 0xC7, 0x03, 0x01, 0x7C, 0xA9, 0x00, 0x00, 0x80, 0x00, 0x35, 0x94, 0x00,
+    0x00, 0x73, 0x00, 0x00, 0x61, 0x00, 0x00, 0x44, 0x01, 0xC7, 0x03, 0x00, 0x00, 0x3B, 0x00, 0x00,
+    0x2E, 0x01, 0xC6, 0x97, 0x00, 0x00, 0x0F, 0x01, 0xC6, 0xB4, 0x01, 0xB9, 0x89, 0x00, 0x00, 0x03,
+    0xE2, 0x01, 0x07, 0x01, 0xC7, 0x40, 0x01, 0xC7, 0x40, 0x62, 0x2D, 0x48, 0x00, 0x00, 0x09, 0x01,
+    0xC1, 0x97, 0x62, 0x37, 0x49, 0x00, 0x00, 0x09, 0x01, 0xC6, 0xEC, 0x61, 0x06, 0x01, 0xC4, 0x49,
+    0x61, 0x25, 0x01, 0x54, 0x34, 0x62, 0x38, 0x39, 0x01, 0xC5, 0xB3, 0x01, 0xB5, 0x44, 0x61, 0x36,
+    0x01, 0x2A, 0xB8, 0x62, 0x19, 0x22, 0x00, 0x84, 0xFE, 0x01, 0x06, 0x87, 0x62, 0x01, 0x27, 0x01,
+    0xB7, 0x25, 0x01, 0xAA, 0xC4, 0xE7, 0x04, 0x14, 0x1A, 0x23, 0x2B, 0x32, 0x40, 0x00, 0x00, 0x25,
+    0x01, 0xC7, 0x1F, 0x00, 0x00, 0x20, 0x01, 0x2D, 0x34, 0x00, 0x00, 0x17, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x09, 0x22, 0x0C, 0x23, 0x47, 0x1D, 0xE3, 0x19, 0x32, 0x38, 0x01, 0xC7, 0x41, 0x01, 0xC6,
+    0xEC, 0x01, 0xB1, 0xAC, 0x61, 0x27, 0x01, 0xAD, 0x46, 0x61, 0x32, 0x01, 0xA7, 0x94, 0x21, 0x27,
+    0x05, 0x21, 0x25, 0x03, 0x21, 0x34, 0x03, 0x61, 0x4C, 0x01, 0x8D, 0xA7, 0x61, 0x25, 0x01, 0x5A,
+    0x7F, 0x21, 0x34, 0x05, 0x61, 0x39, 0x01, 0xAE, 0xDB, 0x21, 0x0B, 0x05, 0x63, 0x0B, 0x19, 0x44,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x01, 0xBA, 0xB3, 0x62, 0x34, 0x35, 0x00, 0x00, 0x0D, 0x01,
+    0xC7, 0xE9, 0x61, 0x47, 0x01, 0xB7, 0xD5, 0x21, 0x23, 0x05, 0x62, 0x17, 0x1F, 0x01, 0x9C, 0xC8,
+    0x00, 0x00, 0x03, 0x66, 0x01, 0x0B, 0x15, 0x19, 0x35, 0x40, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x1A, 0x01, 0xBE, 0x56, 0x00, 0x00, 0x09, 0x61, 0x34, 0x01, 0x25,
+    0x7A, 0x21, 0x14, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x42, 0x03, 0x21, 0x35, 0x03, 0x61, 0x14, 0x01,
+    0xA7, 0xF3, 0x21, 0x40, 0x05, 0x21, 0x34, 0x03, 0xE3, 0x17, 0x2A, 0x34, 0x01, 0xC6, 0x03, 0x00,
+    0x00, 0x03, 0x00, 0xB0, 0x89, 0xE1, 0x2D, 0x01, 0xC5, 0x37, 0x63, 0x14, 0x28, 0x40, 0x00, 0x00,
+    0x05, 0x01, 0xC8, 0x4A, 0x00, 0x41, 0x92, 0x64, 0x01, 0x07, 0x1A, 0x27, 0x01, 0xC8, 0x57, 0x01,
+    0xC8, 0x57, 0x01, 0xC8, 0x57, 0x01, 0xC8, 0x57, 0x21, 0x22, 0x11, 0x62, 0x2D, 0x48, 0x01, 0xC8,
+    0x61, 0x01, 0xC8, 0x16, 0x67, 0x07, 0x0B, 0x2A, 0x32, 0x34, 0x35, 0x37, 0x01, 0xC8, 0x74, 0x00,
+    0x00, 0x4A, 0x00, 0x00, 0x3C, 0x01, 0xC5, 0x7B, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x09, 0x61, 0x1A, 0x01, 0xC4, 0x83, 0x21, 0x4C, 0x05, 0x61, 0x1E, 0x01, 0x5B, 0x4C, 0xA1, 0x40,
+    0x05, 0xE1, 0x08, 0x01, 0xA5, 0xC9, 0x63, 0x07, 0x14, 0x19, 0x01, 0xC8, 0xA6, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x05, 0x63, 0x22, 0x48, 0x49, 0x01, 0xC8, 0xB3, 0x01, 0xC5, 0x3D, 0x01, 0xC7, 0xF8,
+    0xE9, 0x07, 0x17, 0x21, 0x22, 0x2A, 0x32, 0x34, 0x35, 0x47, 0x01, 0xC8, 0xC0, 0x01, 0xC8, 0xC0,
+    0x01, 0xC8, 0xC0, 0x00, 0x00, 0x2A, 0x01, 0xC8, 0xC0, 0x01, 0xC5, 0xC7, 0x00, 0x00, 0x1A, 0x00,
+    0x00, 0x0D, 0x01, 0xC8, 0x71, 0xE1, 0x25, 0x01, 0xBE, 0x37, 0x61, 0x2A, 0x01, 0x63, 0x77, 0x21,
+    0x1F, 0x05, 0x41, 0x19, 0xE9, 0xB1, 0x21, 0x40, 0x04, 0x21, 0x32, 0x03, 0x41, 0x34, 0x5F, 0x0B,
+    0x61, 0x04, 0x01, 0x91, 0x64, 0x21, 0x1B, 0x05, 0x21, 0x40, 0x03, 0x61, 0x01, 0x01, 0xA8, 0xD5,
+    0x21, 0x1F, 0x05, 0x61, 0x25, 0x01, 0x8D, 0xB8, 0x21, 0x25, 0x05, 0x21, 0x19, 0x03, 0x21, 0x41,
+    0x03, 0x21, 0x0B, 0x03, 0x67, 0x1F, 0x21, 0x23, 0x2A, 0x40, 0x42, 0x44, 0x01, 0x87, 0xD1, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x01, 0x8F,
+    0xD7, 0x22, 0x2D, 0x4C, 0x52, 0x1D, 0x62, 0x23, 0x34, 0x00, 0x00, 0x05, 0x01, 0xAC, 0x6A, 0x61,
+    0x27, 0x01, 0x87, 0x36, 0xE4, 0x1E, 0x27, 0x30, 0x40, 0x01, 0xAE, 0xD0, 0x01, 0x59, 0x88, 0x01,
+    0xC9, 0x54, 0x00, 0x00, 0x05, 0xE4, 0x17, 0x1B, 0x1E, 0x2A, 0x01, 0x96, 0x4A, 0x01, 0xC9, 0x0A,
+    0x01, 0xC4, 0xA7, 0x01, 0xAE, 0xF7, 0x62, 0x07, 0x21, 0x01, 0xC9, 0x76, 0x00, 0x00, 0x11, 0x64,
+    0x01, 0x07, 0x25, 0x48, 0x01, 0xC9, 0x7F, 0x01, 0xC9, 0x7F, 0x01, 0xC9, 0x7F, 0x00, 0x00, 0x09,
+    0x65, 0x07, 0x19, 0x1A, 0x23, 0x27, 0x01, 0xC9, 0x90, 0x01, 0xC9, 0x90, 0x01, 0xC9, 0x90, 0x01,
+    0xC9, 0x90, 0x01, 0xC9, 0x90, 0x41, 0x22, 0xE0, 0xC7, 0x22, 0x22, 0x49, 0x19, 0x04, 0x41, 0x48,
+    0x24, 0x7C, 0x61, 0x17, 0x01, 0xBA, 0x27, 0x65, 0x01, 0x07, 0x08, 0x0D, 0x14, 0x01, 0xC9, 0xB7,
+    0x01, 0xC9, 0xB7, 0x01, 0xC9, 0xB7, 0x01, 0xC9, 0xB7, 0x00, 0x00, 0x05, 0x61, 0x1E, 0x01, 0x80,
+    0x53, 0x63, 0x07, 0x19, 0x2D, 0x01, 0xC9, 0xD1, 0x00, 0x00, 0x05, 0x01, 0xC9, 0xD1, 0x63, 0x19,
+    0x22, 0x2D, 0x01, 0xA9, 0xA8, 0x01, 0xC9, 0xDE, 0x01, 0xC9, 0xDE, 0xF8, 0x01, 0x04, 0x08, 0x0A,
+    0x13, 0x14, 0x15, 0x17, 0x19, 0x23, 0x25, 0x28, 0x2A, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x42,
+    0x44, 0x47, 0x48, 0x49, 0x01, 0xC9, 0x85, 0x01, 0xC6, 0x80, 0x01, 0xC9, 0xEB, 0x00, 0x02, 0x49,
+    0x01, 0xC9, 0x25, 0x01, 0xC9, 0x90, 0x01, 0xC9, 0xA5, 0x00, 0x02, 0x44, 0x00, 0x01, 0xE8, 0x00,
+    0x01, 0x77, 0x00, 0x01, 0x2B, 0x01, 0xC9, 0xEB, 0x00, 0x01, 0x06, 0x00, 0x00, 0xA5, 0x01, 0xC9,
+    0xEB, 0x00, 0x00, 0x97, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x42, 0x00, 0x00, 0x3D, 0x01, 0xC7, 0xED,
+    0x01, 0x3D, 0x51, 0x00, 0x00, 0x34, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0D, 0x41, 0x14, 0xD0, 0x0B,
+    0xA1, 0x40, 0x04, 0x61, 0x34, 0x01, 0xC7, 0x20, 0x21, 0x0A, 0x05, 0x21, 0x4C, 0x03, 0x21, 0x14,
+    0x03, 0x61, 0x1F, 0x01, 0x39, 0x5B, 0x21, 0x4C, 0x05, 0x21, 0x0B, 0x03, 0x21, 0x19, 0x03, 0x65,
+    0x0A, 0x19, 0x21, 0x2A, 0x47, 0x01, 0xCA, 0x6F, 0x00, 0x00, 0x11, 0x01, 0xCA, 0x6F, 0x01, 0xCA,
+    0x6F, 0x00, 0x00, 0x03, 0x62, 0x17, 0x23, 0x01, 0x91, 0x4B, 0x01, 0xCA, 0x68, 0x21, 0x32, 0x09,
+    0x21, 0x1B, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x4C, 0x03, 0xA1, 0x14, 0x03, 0x61, 0x34, 0x01, 0x88,
+    0x7F, 0xA1, 0x15, 0x05, 0x41, 0x32, 0xFF, 0x37, 0x21, 0x21, 0x04, 0x21, 0x4C, 0x03, 0x61, 0x42,
+    0x01, 0xCA, 0x9B, 0x21, 0x14, 0x05, 0x21, 0x42, 0x03, 0x21, 0x19, 0x03, 0x62, 0x31, 0x34, 0x00,
+    0x00, 0x03, 0x01, 0x3B, 0xF8, 0x62, 0x1A, 0x21, 0x01, 0x63, 0x27, 0x01, 0x9F, 0x93, 0xE3, 0x19,
+    0x23, 0x40, 0x00, 0x00, 0x12, 0x01, 0xC9, 0xCF, 0x00, 0x00, 0x09, 0x21, 0x4C, 0x0D, 0xE1, 0x1F,
+    0x01, 0xC7, 0x73, 0x22, 0x23, 0x30, 0x08, 0x05, 0x61, 0x14, 0x01, 0x8D, 0xF2, 0x21, 0x40, 0x05,
+    0x21, 0x4C, 0x03, 0x21, 0x27, 0x03, 0x62, 0x19, 0x23, 0x01, 0xCA, 0xF6, 0x00, 0xFF, 0x8D, 0x61,
+    0x22, 0x01, 0x28, 0xDF, 0x62, 0x22, 0x49, 0x01, 0xCA, 0xB5, 0x00, 0x00, 0x05, 0xE3, 0x07, 0x19,
+    0x22, 0x01, 0xCB, 0x0D, 0x01, 0xCB, 0x0D, 0x01, 0xCB, 0x0D, 0xC1, 0x07, 0x9B, 0xEE, 0x21, 0x2D,
+    0x04, 0x43, 0x2D, 0x48, 0x49, 0x00, 0x14, 0x00, 0x03, 0x2A, 0x97, 0x61, 0x23, 0x01, 0x66, 0x8E,
+    0x21, 0x4C, 0x05, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x27, 0x03, 0x63, 0x19, 0x22, 0x2D,
+    0x01, 0xCB, 0x3C, 0x01, 0xCB, 0x3C, 0x01, 0xCB, 0x3C, 0x6F, 0x14, 0x21, 0x23, 0x25, 0x2A, 0x2B,
+    0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40, 0x47, 0x49, 0x00, 0x00, 0xF9, 0x01, 0x89, 0x64, 0x00,
+    0x00, 0xDA, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x6B, 0x00, 0x00, 0x56, 0x00, 0x00, 0x53, 0x00, 0x00, 0x45, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10,
+    0x01, 0xCA, 0xFA, 0x00, 0x00, 0x0D, 0xE2, 0x20, 0x38, 0x01, 0xB0, 0x03, 0x01, 0xB5, 0x8B, 0x63,
+    0x27, 0x34, 0x35, 0x01, 0xCB, 0x8F, 0x01, 0xCB, 0x8F, 0x01, 0xCB, 0x8F, 0x61, 0x29, 0x01, 0x7F,
+    0x26, 0x21, 0x01, 0x05, 0x21, 0x24, 0x03, 0x61, 0x2B, 0x01, 0x31, 0x31, 0x21, 0x32, 0x05, 0x21,
+    0x2A, 0x03, 0x21, 0x15, 0x03, 0x21, 0x38, 0x03, 0x62, 0x04, 0x27, 0x01, 0x6B, 0x54, 0x01, 0xAF,
+    0x00, 0xE6, 0x01, 0x1E, 0x27, 0x28, 0x2D, 0x40, 0x01, 0xB6, 0xAF, 0x00, 0x00, 0x1D, 0x01, 0xB9,
+    0xF0, 0x01, 0xB9, 0xA3, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x21, 0x0A, 0x19, 0x21, 0x31, 0x03,
+    0x65, 0x01, 0x15, 0x17, 0x23, 0x2A, 0x01, 0xC8, 0x75, 0x01, 0xCB, 0x77, 0x00, 0x00, 0x5A, 0x00,
+    0x00, 0x51, 0x00, 0x00, 0x03, 0x62, 0x0B, 0x4C, 0x01, 0xCB, 0xD9, 0x01, 0xCB, 0xF5, 0x21, 0x15,
+    0x09, 0x21, 0x23, 0x03, 0x21, 0x34, 0x03, 0x21, 0x2E, 0x03, 0xE2, 0x40, 0x44, 0x00, 0x00, 0x03,
+    0x01, 0xA8, 0x1B, 0x62, 0x01, 0x30, 0x01, 0xC8, 0xA8, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0x92,
+    0x4C, 0x21, 0x32, 0x05, 0xE2, 0x04, 0x2D, 0x00, 0x00, 0x03, 0x01, 0x61, 0x53, 0xE7, 0x09, 0x1E,
+    0x21, 0x2A, 0x32, 0x34, 0x35, 0x01, 0xCA, 0x03, 0x01, 0xCB, 0xDB, 0x01, 0xCC, 0x29, 0x00, 0x67,
+    0x3B, 0x01, 0xCC, 0x2D, 0x01, 0xA6, 0xC3, 0x01, 0xCC, 0x2D, 0x61, 0x31, 0x01, 0x69, 0x03, 0x61,
+    0x4C, 0x01, 0x4D, 0xE2, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0x21, 0x40, 0x03,
+    0xE2, 0x34, 0x40, 0x00, 0x00, 0x03, 0x01, 0x7C, 0x0C, 0x61, 0x01, 0x01, 0xB5, 0x99, 0xA1, 0x34,
+    0x05, 0x62, 0x15, 0x23, 0x01, 0xCC, 0x0B, 0x00, 0x00, 0x03, 0x61, 0x2D, 0x01, 0xA5, 0x31, 0x21,
+    0x2E, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x01, 0x03, 0x21, 0x25, 0x03, 0x21, 0x2D, 0x03, 0xA1, 0x41,
+    0x03, 0x62, 0x19, 0x25, 0x01, 0xCB, 0xCB, 0x00, 0x00, 0x03, 0xE2, 0x19, 0x34, 0x01, 0xCB, 0xD4,
+    0x00, 0x00, 0x09, 0xE3, 0x2D, 0x32, 0x35, 0x01, 0xCC, 0x54, 0x00, 0xDE, 0x00, 0x01, 0xCC, 0xA3,
+    0x61, 0x27, 0x01, 0xA1, 0x7E, 0x21, 0x40, 0x05, 0x21, 0x35, 0x03, 0x21, 0x25, 0x03, 0x62, 0x14,
+    0x1F, 0x00, 0x00, 0x03, 0x01, 0xB1, 0xCE, 0xE5, 0x17, 0x1A, 0x2A, 0x39, 0x40, 0x01, 0x8D, 0x1E,
+    0x01, 0x92, 0xD3, 0x01, 0xCC, 0xAB, 0x01, 0xCC, 0xC7, 0x00, 0x00, 0x09, 0xE1, 0x04, 0x01, 0xBE,
+    0xD0, 0x21, 0x4C, 0x05, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1A, 0x03, 0x62, 0x23, 0x40,
+    0x01, 0xCC, 0x27, 0x00, 0x36, 0xBA, 0x21, 0x21, 0x09, 0x22, 0x40, 0x42, 0x0F, 0x03, 0xE1, 0x21,
+    0x01, 0xCC, 0x76, 0x63, 0x22, 0x31, 0x38, 0x01, 0xCD, 0x03, 0x01, 0xCC, 0x48, 0x00, 0x00, 0x05,
+    0x63, 0x2D, 0x48, 0x49, 0x01, 0xCD, 0x06, 0x01, 0xC9, 0x02, 0x01, 0xC9, 0x02, 0x61, 0x1A, 0x01,
+    0x01, 0xAD, 0xE7, 0x01, 0x27, 0x32, 0x37, 0x40, 0x47, 0x4C, 0x01, 0xCD, 0x22, 0x01, 0xA7, 0xE6,
+    0x01, 0xAB, 0xD6, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0x01, 0xCC, 0xD3, 0x01, 0xCD, 0x22, 0x41,
+    0x47, 0xEE, 0x2E, 0x21, 0x0B, 0x04, 0x21, 0x40, 0x03, 0x61, 0x14, 0x01, 0xCC, 0xDA, 0x62, 0x17,
+    0x40, 0x01, 0xCD, 0x4E, 0x00, 0x00, 0x05, 0x61, 0x27, 0x01, 0xCB, 0xA5, 0x21, 0x34, 0x05, 0x61,
+    0x34, 0x01, 0x57, 0x96, 0x21, 0x04, 0x05, 0x21, 0x48, 0x03, 0x21, 0x35, 0x03, 0x64, 0x04, 0x23,
+    0x25, 0x40, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x01, 0xB2, 0xFF, 0x01, 0xB9, 0x2B, 0x22, 0x34,
+    0x4C, 0x30, 0x11, 0x62, 0x23, 0x41, 0x00, 0x00, 0x05, 0x01, 0xBF, 0x7B, 0x41, 0x4C, 0xEA, 0x79,
+    0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x4C, 0x03, 0x62, 0x31, 0x32, 0x01,
+    0xBC, 0x62, 0x01, 0xCC, 0xE1, 0xEA, 0x14, 0x17, 0x21, 0x22, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x30,
+    0x01, 0xC8, 0x5F, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x01, 0xCD, 0x20, 0x01, 0xCC, 0xDF, 0x01,
+    0xCC, 0xDF, 0x01, 0xCD, 0x89, 0x01, 0xCD, 0x89, 0x01, 0xCC, 0xDF, 0x01, 0xCD, 0xA5, 0x63, 0x07,
+    0x19, 0x25, 0x01, 0xCD, 0xCE, 0x01, 0xCD, 0xCE, 0x01, 0xCD, 0xCE, 0xE1, 0x21, 0x01, 0xCC, 0xCF,
+    0x61, 0x21, 0x01, 0x67, 0x33, 0x21, 0x4C, 0x05, 0xA2, 0x07, 0x23, 0x0D, 0x03, 0x63, 0x22, 0x48,
+    0x49, 0x00, 0x00, 0x05, 0x01, 0xCA, 0x77, 0x01, 0xCD, 0x81, 0x41, 0x32, 0xE3, 0x35, 0x21, 0x20,
+    0x04, 0x21, 0x14, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x25, 0x03, 0x21, 0x1B, 0x03, 0x21, 0x32, 0x03,
+    0x62, 0x2D, 0x48, 0x01, 0xCE, 0x06, 0x00, 0x00, 0x03, 0xE4, 0x17, 0x19, 0x2A, 0x41, 0x00, 0x00,
+    0x09, 0x01, 0x3B, 0x2A, 0x01, 0x25, 0x87, 0x01, 0xB8, 0xD0, 0xE3, 0x01, 0x07, 0x1A, 0x01, 0xCE,
+    0x2A, 0x00, 0x00, 0x11, 0x01, 0xCE, 0x2A, 0xE2, 0x22, 0x44, 0x01, 0xCE, 0x37, 0x01, 0xCD, 0xF1,
+    0x21, 0x2D, 0x09, 0x22, 0x2D, 0x48, 0x19, 0x03, 0xC1, 0x23, 0x38, 0xB9, 0x63, 0x17, 0x22, 0x25,
+    0x00, 0x00, 0x04, 0x01, 0xCE, 0x4C, 0x00, 0x11, 0x6B, 0x61, 0x01, 0x01, 0xB0, 0xE2, 0x21, 0x42,
+    0x05, 0x21, 0x34, 0x03, 0xA1, 0x0B, 0x03, 0xE1, 0x14, 0x01, 0xBE, 0x8D, 0x63, 0x01, 0x07, 0x14,
+    0x00, 0x00, 0x08, 0x01, 0xCE, 0x6C, 0x00, 0x00, 0x05, 0xE2, 0x17, 0x2A, 0x01, 0xCE, 0x5D, 0x01,
+    0xCE, 0x5D, 0x63, 0x19, 0x21, 0x32, 0x01, 0xCE, 0x82, 0x01, 0xCE, 0x82, 0x00, 0x00, 0x09, 0xFE,
+    0x01, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x21, 0x22, 0x23, 0x25,
+    0x29, 0x2A, 0x2B, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42, 0x47, 0x48, 0x49, 0x00, 0x02,
+    0x7C, 0x01, 0xC6, 0x94, 0x00, 0x02, 0x6B, 0x00, 0x02, 0x62, 0x01, 0xCB, 0xA7, 0x00, 0x02, 0x45,
+    0x00, 0x02, 0x2F, 0x00, 0x02, 0x1E, 0x01, 0x9D, 0xCE, 0x00, 0x01, 0xF5, 0x00, 0x01, 0xEC, 0x00,
+    0x01, 0xC8, 0x00, 0x01, 0x96, 0x01, 0xCE, 0x8F, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x6D, 0x00, 0xF5,
+    0x52, 0x00, 0x01, 0x49, 0x01, 0xB5, 0x20, 0x00, 0x01, 0x0C, 0x01, 0xCE, 0x8F, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0xC1, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x4C, 0x01, 0x3F, 0xCF, 0x00, 0x00, 0x43, 0x00,
+    0x00, 0x23, 0x01, 0xC1, 0x15, 0x00, 0x00, 0x0D, 0x41, 0x40, 0xF6, 0xC0, 0x21, 0x32, 0x04, 0x21,
+    0x0B, 0x03, 0x21, 0x39, 0x03, 0x41, 0x2A, 0xD1, 0xDF, 0x21, 0x48, 0x04, 0x21, 0x25, 0x03, 0xA1,
+    0x42, 0x03, 0x41, 0x4C, 0x0B, 0xE4, 0x21, 0x23, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0xA1,
+    0x40, 0x03, 0x61, 0x19, 0x01, 0x84, 0xF2, 0x62, 0x19, 0x31, 0x01, 0xCE, 0x71, 0x00, 0x00, 0x05,
+    0x21, 0x21, 0x09, 0xE3, 0x23, 0x27, 0x30, 0x00, 0x00, 0x03, 0x01, 0xCF, 0x43, 0x01, 0xCF, 0x43,
+    0xE1, 0x34, 0x01, 0xB2, 0x98, 0xA1, 0x19, 0x05, 0x21, 0x32, 0x03, 0x61, 0x32, 0x01, 0x7F, 0x07,
+    0x62, 0x31, 0x32, 0x01, 0xBE, 0x9B, 0x01, 0xB2, 0xA8, 0xE9, 0x0A, 0x19, 0x1E, 0x21, 0x22, 0x23,
+    0x25, 0x40, 0x4C, 0x01, 0xCF, 0x30, 0x01, 0xCF, 0x69, 0x00, 0x00, 0x11, 0x00, 0x00, 0x0E, 0x01,
+    0xC3, 0x59, 0x00, 0x00, 0x09, 0x01, 0x76, 0xED, 0x01, 0xB3, 0x54, 0x01, 0xCF, 0x69, 0xE3, 0x27,
+    0x2E, 0x30, 0x00, 0x00, 0x25, 0x01, 0xCE, 0x8C, 0x01, 0xCF, 0x8E, 0xE1, 0x22, 0x01, 0xCF, 0x46,
+    0x61, 0x22, 0x01, 0xCF, 0x48, 0xA1, 0x40, 0x05, 0x21, 0x19, 0x03, 0x65, 0x07, 0x19, 0x1A, 0x48,
+    0x49, 0x01, 0xCF, 0xAB, 0x00, 0x00, 0x10, 0x01, 0xAA, 0x17, 0x00, 0x00, 0x03, 0x01, 0xCD, 0x9C,
+    0xE4, 0x19, 0x1A, 0x27, 0x43, 0x01, 0xCF, 0xC0, 0x01, 0xCF, 0xC0, 0x01, 0xA3, 0x99, 0x01, 0xCF,
+    0x71, 0x61, 0x22, 0x01, 0xCF, 0x62, 0xE2, 0x19, 0x40, 0x01, 0x74, 0x70, 0x00, 0x00, 0x05, 0x63,
+    0x07, 0x21, 0x27, 0x01, 0xCF, 0xDF, 0x00, 0x00, 0x09, 0x01, 0xCF, 0xDF, 0x21, 0x22, 0x0D, 0x22,
+    0x22, 0x48, 0x2F, 0x03, 0xE3, 0x01, 0x07, 0x19, 0x01, 0xCF, 0xF4, 0x01, 0xCF, 0xF4, 0x01, 0xCF,
+    0xF4, 0xE1, 0x01, 0x01, 0x3E, 0xFB, 0xE2, 0x07, 0x19, 0x00, 0x00, 0x05, 0x01, 0xD0, 0x06, 0x21,
+    0x2D, 0x09, 0x43, 0x2D, 0x48, 0x49, 0x00, 0x1E, 0x18, 0x38, 0x00, 0x03, 0xE1, 0x42, 0x01, 0xBA,
+    0xA6, 0x21, 0x32, 0x05, 0xE5, 0x08, 0x15, 0x2B, 0x2D, 0x43, 0x01, 0xB3, 0x23, 0x00, 0x00, 0x03,
+    0x01, 0xD0, 0x0B, 0x00, 0xDF, 0xF1, 0x01, 0xCD, 0xF3, 0x63, 0x14, 0x19, 0x1A, 0x01, 0xD0, 0x39,
+    0x00, 0x00, 0x15, 0x01, 0x49, 0x49, 0xE2, 0x22, 0x32, 0x01, 0xD0, 0x46, 0x01, 0xD0, 0x46, 0x71,
+    0x07, 0x0B, 0x19, 0x20, 0x23, 0x25, 0x2A, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x40, 0x46, 0x47, 0x48,
+    0x49, 0x01, 0xD0, 0x4F, 0x01, 0xD0, 0x36, 0x01, 0xD0, 0x4F, 0x01, 0x06, 0x4E, 0x00, 0x01, 0x3D,
+    0x00, 0x01, 0x30, 0x00, 0x01, 0x20, 0x00, 0x01, 0x0C, 0x00, 0x00, 0xC1, 0x00, 0x00, 0xA4, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x3D, 0x01, 0x3D, 0xE4, 0x01, 0xD0, 0x4F, 0x00, 0x00, 0x16, 0x01, 0xCF,
+    0xFA, 0x00, 0x00, 0x09, 0x61, 0x2A, 0x01, 0xCC, 0x93, 0x21, 0x34, 0x05, 0x21, 0x23, 0x03, 0x61,
+    0x34, 0x01, 0x72, 0x6C, 0xA2, 0x1A, 0x27, 0x08, 0x05, 0x21, 0x15, 0x05, 0x21, 0x34, 0x03, 0x21,
+    0x13, 0x03, 0xA1, 0x04, 0x03, 0xA1, 0x32, 0x03, 0x61, 0x04, 0x01, 0x96, 0xC4, 0x62, 0x38, 0x39,
+    0x01, 0xC7, 0x31, 0x00, 0xA1, 0x91, 0x64, 0x14, 0x2D, 0x32, 0x49, 0x01, 0xBC, 0x00, 0x01, 0xD0,
+    0x8D, 0x01, 0xCF, 0xD3, 0x01, 0xCF, 0xD0, 0xE1, 0x15, 0x01, 0xC9, 0x8B, 0x61, 0x1A, 0x01, 0x38,
+    0x93, 0x21, 0x42, 0x05, 0x61, 0x49, 0x01, 0x47, 0xC9, 0x21, 0x23, 0x05, 0x21, 0x40, 0x03, 0x21,
+    0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0x21, 0x40, 0x03, 0x62, 0x14,
+    0x31, 0x01, 0xD0, 0x38, 0x01, 0xAC, 0x22, 0x41, 0x2D, 0x47, 0x23, 0x21, 0x23, 0x04, 0x62, 0x2D,
+    0x4C, 0x01, 0x27, 0x63, 0x00, 0x00, 0x03, 0x21, 0x23, 0x09, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03,
+    0x21, 0x40, 0x03, 0x41, 0x19, 0x83, 0x62, 0xA1, 0x38, 0x04, 0xE2, 0x17, 0x23, 0x01, 0xCF, 0xB2,
+    0x01, 0xCE, 0x9A, 0x65, 0x07, 0x14, 0x21, 0x48, 0x49, 0x00, 0x00, 0x09, 0x01, 0xD1, 0x33, 0x01,
+    0xD1, 0x33, 0x01, 0xCF, 0x24, 0x01, 0xCF, 0x24, 0xE3, 0x23, 0x27, 0x46, 0x01, 0xC6, 0x58, 0x01,
+    0x10, 0x5C, 0x01, 0xD1, 0x48, 0x62, 0x34, 0x4C, 0x01, 0xBE, 0x6B, 0x01, 0xD1, 0x55, 0x21, 0x15,
+    0x09, 0xE3, 0x0B, 0x15, 0x2A, 0x01, 0x12, 0x51, 0x01, 0xB2, 0xCB, 0x00, 0x00, 0x03, 0x21, 0x34,
+    0x0D, 0x21, 0x25, 0x03, 0x68, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x25, 0x27, 0x01, 0xD1, 0x74,
+    0x01, 0xAB, 0xE0, 0x01, 0xD1, 0x74, 0x01, 0xD1, 0x74, 0x00, 0x00, 0x2C, 0x01, 0xD1, 0x74, 0x00,
+    0x00, 0x03, 0x01, 0xD1, 0x74, 0xE3, 0x21, 0x23, 0x27, 0x01, 0xD1, 0x95, 0x01, 0xC6, 0xE7, 0x00,
+    0xBA, 0x90, 0x21, 0x22, 0x0D, 0x62, 0x27, 0x46, 0x01, 0xCD, 0xA1, 0x01, 0xD1, 0xA5, 0x21, 0x22,
+    0x09, 0x23, 0x22, 0x48, 0x49, 0x3D, 0x0F, 0x03, 0xE2, 0x22, 0x2D, 0x01, 0xD1, 0x33, 0x01, 0x48,
+    0x63, 0xE2, 0x41, 0x44, 0x01, 0xBC, 0x78, 0x01, 0xB2, 0x1F, 0xE5, 0x01, 0x07, 0x14, 0x19, 0x23,
+    0x01, 0xD1, 0xCA, 0x00, 0x00, 0x12, 0x01, 0xD1, 0xCA, 0x00, 0x00, 0x09, 0x01, 0xCD, 0xB2, 0xE4,
+    0x07, 0x19, 0x22, 0x23, 0x01, 0xD1, 0xDF, 0x01, 0xD1, 0xDF, 0x01, 0xD1, 0xDF, 0x01, 0xCF, 0xBC,
+    0x21, 0x2D, 0x11, 0x43, 0x2D, 0x48, 0x49, 0x00, 0x29, 0x31, 0x69, 0x00, 0x03, 0x63, 0x19, 0x21,
+    0x25, 0x01, 0xD1, 0xFD, 0x01, 0xD1, 0xFD, 0x01, 0xD1, 0xFD, 0x21, 0x22, 0x0D, 0x21, 0x35, 0x03,
+    0x21, 0x14, 0x03, 0x63, 0x01, 0x07, 0x27, 0x00, 0x01, 0x5B, 0x01, 0xD2, 0x13, 0x01, 0xD2, 0x13,
+    0x62, 0x31, 0x48, 0x01, 0xD1, 0xD1, 0x01, 0xCF, 0xF6, 0xC2, 0x23, 0x40, 0x00, 0x09, 0xD6, 0xDE,
+    0xE1, 0x23, 0x01, 0xA5, 0x8E, 0xE5, 0x07, 0x23, 0x27, 0x2D, 0x32, 0x00, 0x00, 0x0C, 0x01, 0xBF,
+    0x98, 0x01, 0xD2, 0x35, 0x01, 0xD2, 0x35, 0x00, 0x00, 0x05, 0x64, 0x07, 0x19, 0x2D, 0x32, 0x01,
+    0xD2, 0x4A, 0x00, 0x41, 0xF2, 0x01, 0xD2, 0x4A, 0x01, 0x9F, 0x89, 0x78, 0x02, 0x04, 0x0B, 0x13,
+    0x14, 0x15, 0x17, 0x19, 0x1F, 0x22, 0x23, 0x27, 0x2A, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42,
+    0x44, 0x47, 0x48, 0x49, 0x00, 0x01, 0xA6, 0x00, 0x01, 0xA3, 0x01, 0xB7, 0xED, 0x00, 0x01, 0x9E,
+    0x00, 0x01, 0x95, 0x00, 0x40, 0xA4, 0x00, 0x01, 0x84, 0x00, 0x01, 0x7A, 0x00, 0x01, 0x60, 0x01,
+    0xD1, 0x4F, 0x01, 0xC6, 0x88, 0x00, 0x01, 0x5D, 0x00, 0x01, 0x3B, 0x00, 0x01, 0x34, 0x01, 0xCF,
+    0x62, 0x00, 0x01, 0x28, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x68, 0x00, 0x00, 0x4B, 0x01, 0xB5, 0xA3,
+    0x01, 0xD2, 0x15, 0x00, 0x00, 0x48, 0x00, 0x00, 0x26, 0x00, 0x00, 0x11, 0xE1, 0x27, 0x01, 0xD2,
+    0x6A, 0x61, 0x33, 0x01, 0x43, 0x21, 0x21, 0x01, 0x05, 0x21, 0x49, 0x03, 0x21, 0x35, 0x03, 0x61,
+    0x33, 0x01, 0xBF, 0x48, 0x61, 0x32, 0x01, 0x65, 0x5F, 0x21, 0x01, 0x05, 0x21, 0x34, 0x03, 0x62,
+    0x02, 0x38, 0x01, 0xD2, 0xDF, 0x01, 0xD1, 0xA4, 0xA2, 0x18, 0x19, 0x0C, 0x09, 0xEA, 0x01, 0x04,
+    0x08, 0x0A, 0x19, 0x1C, 0x22, 0x25, 0x32, 0x42, 0x01, 0xCF, 0x82, 0x00, 0xEF, 0xEA, 0x00, 0x73,
+    0x1A, 0x00, 0x00, 0x21, 0x01, 0xCF, 0x82, 0x01, 0xD2, 0x87, 0x01, 0xCF, 0x82, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x05, 0x01, 0x5C, 0xD5, 0x41, 0x40, 0xF5, 0x60, 0xE1, 0x11, 0x01, 0xD0, 0x36, 0xE3,
+    0x19, 0x2A, 0x40, 0x01, 0xCE, 0x61, 0x01, 0x7E, 0xB3, 0x01, 0x8B, 0x98, 0x21, 0x4C, 0x0D, 0xE3,
+    0x08, 0x0B, 0x2A, 0x01, 0xD3, 0x25, 0x01, 0xD3, 0x13, 0x00, 0x00, 0x03, 0x62, 0x07, 0x32, 0x01,
+    0xD3, 0x3C, 0x01, 0x02, 0xBE, 0xE2, 0x01, 0x19, 0x01, 0xD2, 0xFF, 0x01, 0xD3, 0x29, 0x61, 0x23,
+    0x01, 0xB1, 0x99, 0x21, 0x04, 0x05, 0x62, 0x42, 0x44, 0x00, 0x00, 0x03, 0x01, 0x9C, 0x0E, 0x21,
+    0x14, 0x09, 0x21, 0x42, 0x03, 0x21, 0x34, 0x03, 0x62, 0x19, 0x2D, 0x01, 0xB2, 0xAD, 0x01, 0xD3,
+    0x2F, 0xC1, 0x4C, 0xA5, 0xA5, 0x41, 0x42, 0x7C, 0xD7, 0xE2, 0x07, 0x39, 0x01, 0xD3, 0x79, 0x00,
+    0x00, 0x04, 0xE1, 0x19, 0x01, 0xB7, 0xFF, 0x61, 0x0F, 0x01, 0xD0, 0xA3, 0x63, 0x22, 0x25, 0x30,
+    0x01, 0xD0, 0x21, 0x00, 0x55, 0xA7, 0x01, 0xD3, 0x8C, 0x61, 0x25, 0x01, 0x94, 0x75, 0x21, 0x40,
+    0x05, 0x21, 0x17, 0x03, 0x21, 0x40, 0x03, 0x21, 0x32, 0x03, 0x41, 0x17, 0x2B, 0x0F, 0xA1, 0x40,
+    0x04, 0xE4, 0x0A, 0x21, 0x30, 0x42, 0x00, 0x00, 0x0A, 0x01, 0xD3, 0x56, 0x00, 0x00, 0x03, 0x01,
+    0x04, 0xFA, 0xC1, 0x40, 0xC4, 0xB9, 0x61, 0x4C, 0x01, 0xD1, 0x95, 0xE5, 0x01, 0x02, 0x19, 0x30,
+    0x46, 0x01, 0xB8, 0x48, 0x01, 0x45, 0xC1, 0x00, 0x00, 0x05, 0x01, 0xD3, 0xCB, 0x01, 0xD3, 0xCB,
+    0x41, 0x01, 0xF3, 0x16, 0x21, 0x19, 0x04, 0x61, 0x25, 0x01, 0xA0, 0x0D, 0x21, 0x40, 0x05, 0x61,
+    0x07, 0x01, 0x6E, 0x7C, 0x21, 0x34, 0x05, 0x21, 0x25, 0x03, 0x61, 0x38, 0x01, 0x33, 0x7D, 0xE3,
+    0x1B, 0x1E, 0x2D, 0x01, 0xD2, 0xA7, 0x01, 0x73, 0x26, 0x00, 0x00, 0x05, 0x66, 0x01, 0x07, 0x19,
+    0x25, 0x28, 0x49, 0x00, 0x78, 0x73, 0x00, 0x00, 0x28, 0x00, 0x00, 0x20, 0x00, 0x00, 0x15, 0x00,
+    0x00, 0x0D, 0x01, 0xD4, 0x02, 0x61, 0x04, 0x01, 0xB9, 0x9A, 0x61, 0x48, 0x01, 0xB3, 0x86, 0x21,
+    0x21, 0x05, 0xE3, 0x04, 0x40, 0x41, 0x01, 0xB6, 0x10, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0xE5,
+    0x07, 0x19, 0x1A, 0x21, 0x27, 0x01, 0x77, 0xA8, 0x01, 0xD4, 0x3F, 0x00, 0x00, 0x0D, 0x01, 0xD4,
+    0x3F, 0x01, 0xD4, 0x3F, 0x61, 0x22, 0x01, 0x7E, 0xC7, 0x43, 0x22, 0x48, 0x49, 0x00, 0x1A, 0x00,
+    0x05, 0x15, 0xAB, 0xE1, 0x2A, 0x01, 0x9C, 0x70, 0x64, 0x01, 0x07, 0x14, 0x19, 0x00, 0x00, 0x05,
+    0x01, 0xD4, 0x68, 0x01, 0xD4, 0x68, 0x01, 0xD4, 0x68, 0x64, 0x07, 0x19, 0x21, 0x22, 0x01, 0xD4,
+    0x79, 0x00, 0xED, 0x35, 0x00, 0x14, 0x52, 0x01, 0xD4, 0x79, 0x21, 0x2D, 0x11, 0x63, 0x2D, 0x48,
+    0x49, 0x00, 0x00, 0x25, 0x00, 0x00, 0x03, 0x01, 0xD0, 0x7F, 0x61, 0x2D, 0x01, 0xD1, 0xCA, 0x63,
+    0x25, 0x2D, 0x34, 0x01, 0xD4, 0x9F, 0x01, 0xD3, 0xAC, 0x01, 0xD4, 0x41, 0x66, 0x0B, 0x15, 0x1A,
+    0x1B, 0x1E, 0x22, 0x00, 0x00, 0x12, 0x01, 0xD4, 0xAC, 0x00, 0x00, 0x0D, 0x01, 0xD4, 0xAC, 0x01,
+    0xD4, 0xAC, 0x01, 0xB7, 0x59, 0x61, 0x42, 0x01, 0x89, 0xE1, 0x41, 0x4C, 0xAF, 0xC3, 0x21, 0x14,
+    0x04, 0x21, 0x25, 0x03, 0x21, 0x1B, 0x03, 0xA1, 0x42, 0x03, 0x22, 0x0B, 0x2D, 0x15, 0x03, 0xE1,
+    0x25, 0x01, 0xC8, 0xCF, 0x66, 0x01, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x00, 0x6F, 0x9E, 0x01, 0xD4,
+    0xE4, 0x00, 0x00, 0x05, 0x01, 0xD4, 0xE4, 0x01, 0xD4, 0xE4, 0x01, 0xD4, 0xE4, 0xE3, 0x01, 0x04,
+    0x0A, 0x01, 0xD4, 0x9F, 0x01, 0xCE, 0x0F, 0x01, 0xD4, 0xE4, 0xE1, 0x40, 0x01, 0x65, 0xAF, 0x21,
+    0x4C, 0x05, 0x65, 0x19, 0x21, 0x2B, 0x2D, 0x32, 0x00, 0x00, 0x15, 0x01, 0xD5, 0x12, 0x00, 0x00,
+    0x03, 0x01, 0xD5, 0x12, 0x01, 0x89, 0xB6, 0x62, 0x07, 0x32, 0x01, 0xD5, 0x27, 0x00, 0x3A, 0xBE,
+    0x7E, 0x01, 0x02, 0x04, 0x11, 0x13, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23,
+    0x27, 0x28, 0x29, 0x2B, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42, 0x47, 0x48, 0x49, 0x00,
+    0x02, 0x74, 0x00, 0x02, 0x43, 0x00, 0x02, 0x1A, 0x01, 0xB6, 0xD7, 0x00, 0x02, 0x16, 0x00, 0xCF,
+    0xE8, 0x01, 0xC5, 0x56, 0x01, 0xD5, 0x30, 0x00, 0x02, 0x01, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xEB,
+    0x00, 0x01, 0xCB, 0x00, 0x01, 0xC8, 0x00, 0x01, 0xBF, 0x01, 0xB4, 0x75, 0x00, 0x01, 0xB7, 0x00,
+    0x01, 0xAE, 0x00, 0x01, 0xA9, 0x00, 0x01, 0xA4, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x6E, 0x00, 0x01,
+    0x65, 0x00, 0x01, 0x24, 0x00, 0x00, 0xD7, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x84, 0x00, 0x00, 0x56,
+    0x00, 0x00, 0x4C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x09, 0xE3, 0x34, 0x35, 0x40, 0x01, 0xD5, 0x70,
+    0x01, 0xD5, 0xA9, 0x01, 0x9B, 0xFA, 0xE1, 0x21, 0x01, 0x80, 0x75, 0xE3, 0x01, 0x20, 0x28, 0x01,
+    0xBA, 0xC7, 0x01, 0xD5, 0x96, 0x01, 0xC3, 0x9D, 0x62, 0x19, 0x34, 0x00, 0xA9, 0x60, 0x01, 0xBE,
+    0xA3, 0x63, 0x30, 0x34, 0x38, 0x01, 0xD5, 0xD1, 0x01, 0xCC, 0x45, 0x01, 0xD5, 0xD1, 0x62, 0x23,
+    0x25, 0x01, 0xD5, 0xC2, 0x01, 0xD5, 0xDE, 0x63, 0x19, 0x23, 0x32, 0x01, 0xD5, 0xCB, 0x01, 0xD5,
+    0xE7, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0xC3, 0xDD, 0x61, 0x04, 0x01, 0x2F, 0xFA, 0x41, 0x15,
+    0xA9, 0x96, 0x22, 0x07, 0x19, 0x09, 0x04, 0xE7, 0x04, 0x19, 0x21, 0x22, 0x32, 0x34, 0x35, 0x01,
+    0xD5, 0xEE, 0x01, 0xD5, 0xA1, 0x00, 0x00, 0x13, 0x01, 0xD5, 0xEB, 0x00, 0x00, 0x05, 0x01, 0xD6,
+    0x07, 0x01, 0xD6, 0x07, 0xE3, 0x04, 0x34, 0x44, 0x01, 0xC2, 0x56, 0x01, 0xC3, 0x06, 0x01, 0xA0,
+    0xBF, 0x63, 0x30, 0x31, 0x32, 0x01, 0xD6, 0x31, 0x01, 0xD3, 0x23, 0x01, 0xAC, 0xB0, 0xE2, 0x21,
+    0x35, 0x01, 0xB5, 0xBC, 0x01, 0xD6, 0x3E, 0x41, 0x4C, 0xCD, 0x4C, 0x21, 0x23, 0x04, 0x21, 0x2D,
+    0x03, 0x21, 0x15, 0x03, 0x65, 0x25, 0x2A, 0x32, 0x40, 0x42, 0x00, 0xA8, 0xE4, 0x01, 0xD6, 0x38,
+    0x01, 0xD6, 0x54, 0x00, 0x00, 0x03, 0x01, 0xD6, 0x53, 0x61, 0x31, 0x01, 0xC5, 0xB5, 0x62, 0x21,
+    0x22, 0x01, 0xD6, 0x52, 0x01, 0xD3, 0xAC, 0x62, 0x01, 0x27, 0x01, 0xBB, 0x83, 0x00, 0x00, 0x0E,
+    0x63, 0x30, 0x31, 0x38, 0x01, 0xD6, 0x80, 0x01, 0x6B, 0xA7, 0x00, 0x00, 0x09, 0x61, 0x23, 0x01,
+    0x51, 0xF3, 0x67, 0x19, 0x20, 0x21, 0x27, 0x2A, 0x32, 0x34, 0x01, 0xD6, 0x76, 0x01, 0xD6, 0x79,
+    0x00, 0xAA, 0x2A, 0x00, 0x00, 0x29, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0x01, 0xAA, 0x6B, 0x62,
+    0x07, 0x1B, 0x01, 0xC3, 0xE9, 0x01, 0xB1, 0xD3, 0xE1, 0x21, 0x01, 0x7B, 0x5A, 0xA1, 0x2A, 0x05,
+    0xE2, 0x22, 0x2A, 0x00, 0x00, 0x03, 0x01, 0xD6, 0xC0, 0x64, 0x19, 0x30, 0x31, 0x32, 0x01, 0xD6,
+    0xC9, 0x01, 0xD6, 0xC9, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0xA6, 0xC0, 0x21,
+    0x31, 0x05, 0x21, 0x27, 0x03, 0x21, 0x30, 0x03, 0xA1, 0x15, 0x03, 0x21, 0x22, 0x03, 0x21, 0x35,
+    0x03, 0x21, 0x19, 0x03, 0x63, 0x19, 0x25, 0x40, 0x01, 0xD6, 0xF4, 0x01, 0xD6, 0xF4, 0x00, 0x00,
+    0x03, 0x21, 0x34, 0x0D, 0x41, 0x34, 0x2C, 0xE7, 0x61, 0x27, 0x01, 0x9F, 0xBC, 0x21, 0x34, 0x05,
+    0x21, 0x04, 0x03, 0x62, 0x2D, 0x34, 0x01, 0xC9, 0xEA, 0x00, 0x00, 0x03, 0x61, 0x19, 0x01, 0x94,
+    0xAA, 0xE5, 0x08, 0x0A, 0x15, 0x21, 0x40, 0x00, 0x00, 0x20, 0x01, 0x66, 0x2F, 0x00, 0x00, 0x1D,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x21, 0x4C, 0x15, 0x21, 0x23, 0x03, 0x61, 0x15, 0x01, 0x9A,
+    0x46, 0x21, 0x40, 0x05, 0x61, 0x25, 0x01, 0x3E, 0xFB, 0x21, 0x1F, 0x05, 0x22, 0x2A, 0x42, 0x0B,
+    0x03, 0x65, 0x01, 0x04, 0x14, 0x15, 0x1A, 0x00, 0x00, 0x05, 0x01, 0xD7, 0x51, 0x01, 0xD7, 0x51,
+    0x01, 0xB5, 0x9C, 0x01, 0xD7, 0x51, 0x21, 0x4C, 0x15, 0x61, 0x17, 0x01, 0xB1, 0x70, 0xA1, 0x40,
+    0x05, 0x21, 0x4C, 0x03, 0x21, 0x14, 0x03, 0xE1, 0x27, 0x01, 0xD7, 0x67, 0x21, 0x07, 0x05, 0x64,
+    0x01, 0x23, 0x25, 0x49, 0x01, 0xD7, 0x7F, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x61, 0x40, 0x01, 0x13, 0x84, 0x21, 0x32, 0x05, 0x21, 0x48, 0x03, 0x61, 0x01, 0x01, 0x8D, 0x14,
+    0xE5, 0x08, 0x0A, 0x1B, 0x2A, 0x40, 0x00, 0xC9, 0x83, 0x01, 0xBC, 0x1D, 0x00, 0x00, 0x08, 0x01,
+    0xBE, 0x14, 0x00, 0x00, 0x05, 0x61, 0x21, 0x01, 0x69, 0x3F, 0x21, 0x32, 0x05, 0x21, 0x19, 0x03,
+    0x64, 0x07, 0x14, 0x19, 0x23, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x01, 0xB6, 0xF4, 0x01, 0xD7,
+    0xC0, 0x42, 0x22, 0x48, 0x00, 0x11, 0x2B, 0x88, 0x41, 0x40, 0x34, 0xE0, 0x21, 0x38, 0x04, 0x62,
+    0x0B, 0x40, 0x00, 0x00, 0x03, 0x01, 0x88, 0x52, 0x63, 0x19, 0x1F, 0x25, 0x00, 0x00, 0x09, 0x01,
+    0xBA, 0x95, 0x01, 0x78, 0x2B, 0x61, 0x14, 0x01, 0xBD, 0x05, 0x21, 0x42, 0x05, 0x62, 0x23, 0x25,
+    0x01, 0xA2, 0x3A, 0x00, 0x00, 0x03, 0x61, 0x27, 0x01, 0xB9, 0x47, 0x21, 0x4C, 0x05, 0x21, 0x23,
+    0x03, 0x21, 0x2D, 0x03, 0x62, 0x0B, 0x1E, 0x00, 0x00, 0x03, 0x01, 0xD5, 0xE3, 0xE2, 0x40, 0x44,
+    0x00, 0x00, 0x09, 0x01, 0xB6, 0x6C, 0x21, 0x1A, 0x09, 0xE3, 0x19, 0x22, 0x32, 0x01, 0xD8, 0x29,
+    0x01, 0xD8, 0x29, 0x01, 0xD8, 0x29, 0x7D, 0x01, 0x04, 0x08, 0x0A, 0x10, 0x13, 0x15, 0x17, 0x18,
+    0x19, 0x1A, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2C, 0x2D, 0x34, 0x35, 0x40, 0x42,
+    0x44, 0x47, 0x48, 0x49, 0x01, 0xD8, 0x36, 0x00, 0x02, 0x8D, 0x00, 0x02, 0x80, 0x00, 0x02, 0x7B,
+    0x00, 0x02, 0x6E, 0x00, 0x02, 0x65, 0x00, 0x02, 0x4F, 0x00, 0x02, 0x2F, 0x01, 0xD4, 0xCB, 0x00,
+    0x02, 0x12, 0x01, 0x50, 0xC8, 0x01, 0xD8, 0x36, 0x00, 0x02, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x01,
+    0xE2, 0x00, 0x01, 0xCD, 0x00, 0x01, 0xC8, 0x00, 0x01, 0xA4, 0x00, 0x01, 0x6D, 0x01, 0xD5, 0x52,
+    0x00, 0x00, 0xFD, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x65, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x39, 0x01,
+    0x4B, 0x9C, 0x00, 0x00, 0x10, 0x01, 0xD7, 0xE1, 0x00, 0x00, 0x0D, 0x63, 0x23, 0x32, 0x34, 0x01,
+    0xD8, 0xAB, 0x01, 0xD8, 0x65, 0x01, 0xD6, 0x7A, 0x62, 0x32, 0x34, 0x01, 0xC6, 0x9D, 0x01, 0x92,
+    0x25, 0xE4, 0x01, 0x28, 0x35, 0x4C, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0x01, 0x8E, 0x81, 0x01,
+    0xD8, 0xC1, 0x21, 0x10, 0x11, 0x63, 0x13, 0x29, 0x49, 0x01, 0xD8, 0x0F, 0x00, 0x00, 0x03, 0x01,
+    0xD8, 0x6F, 0x61, 0x35, 0x01, 0xA9, 0x45, 0xE5, 0x07, 0x09, 0x23, 0x34, 0x35, 0x01, 0xD8, 0xE7,
+    0x01, 0xD8, 0x2F, 0x01, 0xD8, 0xE7, 0x01, 0xA9, 0x4A, 0x01, 0xA9, 0x4A, 0x61, 0x15, 0x01, 0xA9,
+    0x5F, 0x64, 0x14, 0x15, 0x32, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1A, 0x01, 0xD8, 0xA3, 0x00,
+    0x00, 0x05, 0x62, 0x34, 0x48, 0x01, 0xD4, 0xFA, 0x01, 0xCD, 0x3F, 0xA1, 0x2A, 0x09, 0x62, 0x22,
+    0x4C, 0x01, 0xD5, 0xB3, 0x01, 0xD9, 0x1E, 0x61, 0x08, 0x01, 0xD8, 0x6C, 0x63, 0x08, 0x23, 0x44,
+    0x01, 0xD9, 0x2C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x67, 0x23, 0x25, 0x27, 0x29, 0x32, 0x34,
+    0x35, 0x00, 0x00, 0x64, 0x01, 0xB5, 0x3A, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0D,
+    0x01, 0xD9, 0x38, 0x01, 0xCC, 0x06, 0xE2, 0x02, 0x2A, 0x01, 0xD9, 0x56, 0x01, 0xA1, 0x63, 0xE1,
+    0x47, 0x01, 0xD7, 0x2E, 0x61, 0x23, 0x01, 0x48, 0x82, 0x21, 0x22, 0x05, 0x21, 0x35, 0x03, 0x61,
+    0x04, 0x01, 0x94, 0x83, 0x62, 0x34, 0x35, 0x01, 0xD7, 0x61, 0x01, 0xD9, 0x74, 0x62, 0x31, 0x48,
+    0x01, 0xC8, 0xB8, 0x01, 0xA6, 0x9F, 0x41, 0x40, 0x6E, 0xAE, 0x21, 0x4C, 0x04, 0x21, 0x34, 0x03,
+    0x21, 0x14, 0x03, 0x21, 0x29, 0x03, 0x63, 0x19, 0x24, 0x31, 0x01, 0xD6, 0x2B, 0x00, 0x00, 0x03,
+    0x01, 0x84, 0x1F, 0xE9, 0x07, 0x08, 0x17, 0x18, 0x19, 0x1A, 0x23, 0x2A, 0x30, 0x00, 0x00, 0x34,
+    0x01, 0xB4, 0x36, 0x01, 0xAB, 0xEE, 0x01, 0xD8, 0x65, 0x00, 0x00, 0x2F, 0x01, 0xA4, 0x49, 0x00,
+    0x00, 0x26, 0x00, 0x00, 0x0D, 0x01, 0xD9, 0xA3, 0x62, 0x14, 0x4C, 0x01, 0xD9, 0xC8, 0x01, 0xD9,
+    0xC8, 0xA1, 0x22, 0x09, 0x63, 0x07, 0x2B, 0x32, 0x01, 0xD9, 0xD4, 0x01, 0xD7, 0x12, 0x01, 0xD9,
+    0xD4, 0xE7, 0x07, 0x2B, 0x2D, 0x30, 0x32, 0x35, 0x48, 0x01, 0xD9, 0xE1, 0x01, 0xC8, 0x32, 0x01,
+    0xD9, 0xE1, 0x01, 0xD9, 0xE1, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x62, 0x22,
+    0x35, 0x01, 0xD9, 0xFE, 0x01, 0xD6, 0x88, 0xE1, 0x19, 0x01, 0x87, 0x99, 0x21, 0x19, 0x05, 0x21,
+    0x22, 0x03, 0x41, 0x19, 0xF9, 0xF7, 0x21, 0x2D, 0x04, 0x66, 0x2B, 0x2D, 0x32, 0x35, 0x37, 0x47,
+    0x01, 0xD6, 0xAE, 0x01, 0xA7, 0x58, 0x01, 0xDA, 0x19, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x03, 0x01,
+    0xD9, 0xCA, 0xE3, 0x07, 0x21, 0x2A, 0x01, 0xD0, 0xE4, 0x01, 0xBD, 0x31, 0x01, 0x8F, 0xE3, 0x63,
+    0x14, 0x1F, 0x21, 0x01, 0xDA, 0x3F, 0x01, 0xCA, 0xD2, 0x00, 0x00, 0x0D, 0xE3, 0x19, 0x20, 0x40,
+    0x01, 0xA4, 0x8D, 0x01, 0x99, 0x5A, 0x01, 0x27, 0x64, 0x63, 0x34, 0x35, 0x47, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x0D, 0x01, 0xD8, 0x28, 0x61, 0x2A, 0x01, 0xA9, 0xA1, 0x21, 0x01, 0x05, 0x21, 0x2D,
+    0x03, 0xE5, 0x14, 0x20, 0x32, 0x35, 0x37, 0x01, 0xDA, 0x71, 0x01, 0xA1, 0x97, 0x01, 0xDA, 0x71,
+    0x01, 0xC1, 0x61, 0x00, 0x00, 0x03, 0x61, 0x32, 0x01, 0x8B, 0xDF, 0x21, 0x21, 0x05, 0xA1, 0x32,
+    0x03, 0x61, 0x40, 0x01, 0x7F, 0x14, 0x21, 0x23, 0x05, 0xE1, 0x1E, 0x01, 0xDA, 0x99, 0x65, 0x01,
+    0x15, 0x19, 0x22, 0x35, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x01, 0x15, 0x1F, 0x00, 0x00, 0x05,
+    0x01, 0xDA, 0x32, 0x61, 0x27, 0x01, 0xA3, 0x80, 0x61, 0x40, 0x01, 0x55, 0x9B, 0x22, 0x23, 0x30,
+    0x0A, 0x05, 0x63, 0x20, 0x35, 0x4C, 0x01, 0xC8, 0x5A, 0x01, 0xDA, 0xC2, 0x01, 0xDA, 0xC2, 0x62,
+    0x34, 0x35, 0x01, 0xD7, 0xC1, 0x01, 0xC8, 0x67, 0x63, 0x30, 0x32, 0x35, 0x01, 0xDA, 0xD8, 0x01,
+    0xDA, 0xD8, 0x01, 0xC8, 0x70, 0xE2, 0x04, 0x1E, 0x01, 0xC8, 0x7D, 0x01, 0xDA, 0xE5, 0x21, 0x32,
+    0x09, 0xE6, 0x04, 0x13, 0x19, 0x20, 0x23, 0x25, 0x01, 0xD8, 0x86, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x03, 0x01, 0xC7, 0xD3, 0x01, 0x82, 0x75, 0x63, 0x21, 0x24, 0x32, 0x01, 0xDA,
+    0xB5, 0x01, 0xD9, 0x0C, 0x01, 0xDA, 0xD1, 0xE7, 0x0A, 0x23, 0x27, 0x2B, 0x30, 0x40, 0x44, 0x01,
+    0xBC, 0x81, 0x00, 0x00, 0x55, 0x00, 0x00, 0x26, 0x00, 0x00, 0x0D, 0x01, 0xDB, 0x17, 0x01, 0xD0,
+    0xD7, 0x01, 0x95, 0xE0, 0x61, 0x2A, 0x01, 0xDB, 0x27, 0x62, 0x08, 0x1F, 0x01, 0xDB, 0x39, 0x01,
+    0xDB, 0x39, 0x21, 0x4C, 0x09, 0x63, 0x07, 0x23, 0x28, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x01,
+    0x04, 0x4F, 0xE2, 0x2A, 0x32, 0x01, 0xDA, 0x8C, 0x01, 0xDA, 0x97, 0xEB, 0x01, 0x04, 0x07, 0x08,
+    0x14, 0x17, 0x1A, 0x1C, 0x21, 0x27, 0x43, 0x01, 0xDA, 0xFD, 0x01, 0xDB, 0x22, 0x01, 0xDB, 0x5B,
+    0x01, 0x6E, 0x3E, 0x00, 0x00, 0x09, 0x01, 0xDA, 0x95, 0x01, 0xC1, 0xEC, 0x01, 0xDA, 0x95, 0x01,
+    0xDB, 0x5B, 0x01, 0xDB, 0x5B, 0x01, 0xD9, 0x2A, 0xE1, 0x17, 0x01, 0xD9, 0x5E, 0xE3, 0x07, 0x21,
+    0x27, 0x00, 0x00, 0x05, 0x01, 0xDB, 0x8D, 0x01, 0xDB, 0x8D, 0x21, 0x22, 0x0D, 0xE1, 0x2A, 0x01,
+    0xD5, 0xEB, 0x63, 0x19, 0x21, 0x27, 0x01, 0xDB, 0xA2, 0x00, 0x00, 0x05, 0x01, 0xDB, 0xA2, 0x21,
+    0x22, 0x0D, 0x23, 0x22, 0x48, 0x49, 0x57, 0x18, 0x03, 0x61, 0x14, 0x01, 0x6D, 0xDC, 0x21, 0x30,
+    0x05, 0xE2, 0x23, 0x44, 0x00, 0x00, 0x03, 0x01, 0xC8, 0xA3, 0xE5, 0x01, 0x14, 0x1B, 0x43, 0x44,
+    0x00, 0x00, 0x09, 0x01, 0xD4, 0xDC, 0x01, 0xD9, 0x3A, 0x01, 0xA9, 0xC5, 0x01, 0xC6, 0x54, 0x61,
+    0x17, 0x01, 0xC0, 0xEF, 0xE2, 0x17, 0x42, 0x01, 0xC0, 0x7C, 0x00, 0x00, 0x05, 0xA1, 0x21, 0x09,
+    0x21, 0x2D, 0x03, 0xE1, 0x1C, 0x01, 0xD7, 0x31, 0x21, 0x2D, 0x05, 0x23, 0x2D, 0x48, 0x49, 0x31,
+    0x0B, 0x03, 0x61, 0x04, 0x01, 0x8E, 0xC1, 0xA1, 0x40, 0x05, 0x62, 0x07, 0x19, 0x00, 0x00, 0x03,
+    0x01, 0xDC, 0x0A, 0x61, 0x17, 0x01, 0xDB, 0x14, 0x21, 0x19, 0x05, 0x21, 0x31, 0x03, 0x61, 0x4C,
+    0x01, 0x9B, 0xA0, 0x21, 0x22, 0x05, 0x21, 0x19, 0x03, 0x21, 0x39, 0x03, 0xE1, 0x41, 0x01, 0xC6,
+    0xE3, 0x21, 0x22, 0x05, 0xE5, 0x1C, 0x27, 0x28, 0x40, 0x43, 0x01, 0xDA, 0x25, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x0B, 0x01, 0xA2, 0x91, 0x00, 0x00, 0x03, 0x63, 0x07, 0x19, 0x32, 0x01, 0xDC, 0x49,
+    0x00, 0x00, 0x15, 0x01, 0xDC, 0x49, 0xFD, 0x01, 0x02, 0x04, 0x07, 0x09, 0x0F, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x19, 0x1A, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x32, 0x34, 0x35, 0x37,
+    0x40, 0x42, 0x47, 0x49, 0x00, 0x03, 0x00, 0x01, 0xDC, 0x56, 0x01, 0x56, 0x06, 0x01, 0x6D, 0x01,
+    0x01, 0xD0, 0x83, 0x01, 0x8D, 0x8B, 0x01, 0xDB, 0x90, 0x00, 0x02, 0xF7, 0x00, 0xDB, 0x2E, 0x00,
+    0x02, 0xEA, 0x01, 0xDC, 0x56, 0x00, 0x02, 0x75, 0x00, 0x02, 0x58, 0x01, 0xC7, 0xA8, 0x01, 0xDB,
+    0xF0, 0x00, 0x02, 0x3D, 0x01, 0xDC, 0x56, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xE5, 0x00, 0x01, 0xB8,
+    0x00, 0x01, 0x99, 0x00, 0x01, 0x3F, 0x00, 0x01, 0x11, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x5B, 0x00,
+    0xCE, 0x4C, 0x01, 0x08, 0x05, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x0D, 0x62, 0x2D, 0x48, 0x01, 0xDC,
+    0xCA, 0x01, 0xDC, 0x76, 0xE4, 0x32, 0x37, 0x48, 0x49, 0x01, 0xDC, 0xD4, 0x00, 0x00, 0x09, 0x01,
+    0xDC, 0xCA, 0x01, 0xDC, 0x6E, 0xE1, 0x32, 0x01, 0xCA, 0xC4, 0x61, 0x27, 0x01, 0x50, 0x77, 0x21,
+    0x14, 0x05, 0x21, 0x38, 0x03, 0xE3, 0x01, 0x1C, 0x2A, 0x00, 0x00, 0x10, 0x01, 0xDC, 0x97, 0x00,
+    0x00, 0x03, 0x62, 0x34, 0x38, 0x01, 0xDD, 0x02, 0x00, 0x00, 0x0D, 0xE1, 0x2B, 0x01, 0xAD, 0x32,
+    0x21, 0x30, 0x05, 0x61, 0x30, 0x01, 0xB7, 0x7F, 0x62, 0x22, 0x48, 0x01, 0x3B, 0x02, 0x01, 0xC4,
+    0x8E, 0x62, 0x2D, 0x48, 0x01, 0xDD, 0x21, 0x01, 0xD9, 0x13, 0x61, 0x19, 0x01, 0xB3, 0x21, 0x21,
+    0x2B, 0x05, 0xA1, 0x40, 0x03, 0xE1, 0x41, 0x01, 0x47, 0x18, 0x22, 0x14, 0x1A, 0x08, 0x05, 0x67,
+    0x2D, 0x32, 0x35, 0x37, 0x47, 0x48, 0x49, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x05, 0x00, 0x2D, 0x44, 0x01, 0xDC, 0xD9, 0xE2, 0x22, 0x30, 0x01,
+    0xDC, 0x5A, 0x01, 0xDD, 0x5C, 0x63, 0x07, 0x14, 0x19, 0x01, 0xDD, 0x65, 0x01, 0xDD, 0x65, 0x01,
+    0xDD, 0x65, 0x21, 0x2D, 0x0D, 0xE2, 0x07, 0x2D, 0x01, 0xDD, 0x75, 0x01, 0xDD, 0x75, 0xE7, 0x27,
+    0x31, 0x32, 0x35, 0x37, 0x47, 0x48, 0x01, 0xA8, 0x24, 0x00, 0xD9, 0x5D, 0x00, 0x00, 0x22, 0x00,
+    0x2B, 0xB4, 0x00, 0x00, 0x0C, 0x01, 0xD6, 0xF4, 0x00, 0x00, 0x09, 0xE1, 0x30, 0x01, 0xB8, 0x07,
+    0x63, 0x07, 0x19, 0x1A, 0x01, 0xDD, 0xA0, 0x01, 0xDD, 0xA0, 0x01, 0xB8, 0x0C, 0x62, 0x22, 0x48,
+    0x01, 0xBB, 0x7B, 0x01, 0xC5, 0x23, 0xE8, 0x07, 0x32, 0x34, 0x35, 0x37, 0x40, 0x48, 0x49, 0x01,
+    0xDD, 0xB6, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0x00, 0x00, 0xEB, 0x01, 0xDD,
+    0xB5, 0x01, 0xC7, 0x85, 0x01, 0xDD, 0x50, 0x61, 0x0D, 0x01, 0xDA, 0xEF, 0x21, 0x0D, 0x05, 0xE1,
+    0x30, 0x01, 0xA1, 0xB8, 0x63, 0x31, 0x32, 0x35, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0x01, 0xBD,
+    0xFB, 0x61, 0x2B, 0x01, 0xC4, 0x2E, 0xA1, 0x41, 0x05, 0xE1, 0x41, 0x01, 0x13, 0xC9, 0xA1, 0x30,
+    0x05, 0x62, 0x22, 0x48, 0x01, 0xCC, 0xC7, 0x01, 0xD6, 0x7D, 0x62, 0x02, 0x1F, 0x01, 0x8C, 0x5E,
+    0x01, 0xDB, 0xBE, 0xE6, 0x01, 0x07, 0x1A, 0x21, 0x40, 0x41, 0x01, 0xDE, 0x13, 0x01, 0xDE, 0x13,
+    0x01, 0xDE, 0x13, 0x01, 0xDE, 0x13, 0x00, 0x00, 0x09, 0x01, 0xBC, 0x3A, 0x62, 0x2D, 0x48, 0x00,
+    0x00, 0x19, 0x01, 0xD6, 0x0B, 0x61, 0x2A, 0x01, 0x77, 0x24, 0x21, 0x19, 0x05, 0x21, 0x47, 0x03,
+    0x21, 0x1B, 0x03, 0x21, 0x40, 0x03, 0x21, 0x48, 0x03, 0x21, 0x21, 0x03, 0xA1, 0x44, 0x03, 0x21,
+    0x32, 0x03, 0x21, 0x49, 0x03, 0x21, 0x25, 0x03, 0xE2, 0x01, 0x1E, 0x00, 0x00, 0x03, 0x01, 0xAB,
+    0xBE, 0x21, 0x01, 0x09, 0xE2, 0x01, 0x25, 0x01, 0xDE, 0x0F, 0x01, 0xDC, 0xCD, 0xA1, 0x32, 0x09,
+    0x6A, 0x19, 0x27, 0x2D, 0x32, 0x34, 0x35, 0x37, 0x47, 0x48, 0x49, 0x01, 0xDE, 0x70, 0x00, 0x00,
+    0x7A, 0x01, 0xDE, 0x70, 0x00, 0x00, 0x72, 0x01, 0xDE, 0x66, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0xDE, 0x0A, 0xE1, 0x2B, 0x01, 0xAF, 0x09, 0x21, 0x30,
+    0x05, 0xE6, 0x07, 0x17, 0x22, 0x2D, 0x35, 0x48, 0x01, 0xDE, 0xA1, 0x01, 0x82, 0x4F, 0x01, 0xDE,
+    0xA1, 0x00, 0x00, 0x03, 0x01, 0xC5, 0x91, 0x01, 0xDE, 0xA1, 0xE3, 0x19, 0x30, 0x44, 0x01, 0xBE,
+    0x1A, 0x01, 0xDE, 0xBA, 0x01, 0xCB, 0x52, 0x62, 0x19, 0x21, 0x01, 0xDE, 0xC7, 0x00, 0x64, 0x0D,
+    0xE1, 0x41, 0x01, 0x7B, 0x08, 0x21, 0x27, 0x05, 0x21, 0x22, 0x03, 0xC1, 0x42, 0x6C, 0x26, 0xE2,
+    0x19, 0x21, 0x01, 0xDE, 0xDF, 0x00, 0x00, 0x04, 0x21, 0x22, 0x09, 0x63, 0x22, 0x48, 0x49, 0x01,
+    0xD8, 0x61, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x21, 0x14, 0x28, 0x62, 0x2D, 0x48, 0x00, 0x00,
+    0x03, 0x01, 0xDE, 0xA6, 0xE3, 0x19, 0x1A, 0x42, 0x01, 0xDF, 0x04, 0x01, 0xDF, 0x04, 0x01, 0xDF,
+    0x04, 0xE3, 0x08, 0x14, 0x43, 0x01, 0xDB, 0xA6, 0x01, 0xDE, 0x4B, 0x01, 0xDC, 0xE0, 0x64, 0x08,
+    0x14, 0x19, 0x1A, 0x01, 0xDF, 0x1E, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0D, 0x01, 0xDF, 0x1E, 0xC1,
+    0x40, 0x3B, 0xD6, 0xE2, 0x2D, 0x32, 0x00, 0x00, 0x04, 0x01, 0xDF, 0x33, 0x61, 0x07, 0x01, 0x3E,
+    0x9F, 0xF1, 0x07, 0x15, 0x19, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37,
+    0x47, 0x48, 0x49, 0x00, 0x02, 0x6D, 0x00, 0x02, 0x3F, 0x00, 0x02, 0x02, 0x00, 0x01, 0xC3, 0x00,
+    0x01, 0x8B, 0x00, 0x01, 0x5D, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xA0, 0x01, 0xDB, 0xD6, 0x01, 0xDF,
+    0x41, 0x00, 0x00, 0x87, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x56, 0x00, 0x00, 0x46, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x62, 0x19, 0x31, 0x01, 0xDF, 0x86, 0x01, 0xDE, 0xCB, 0x61,
+    0x40, 0x01, 0xAA, 0x31, 0x62, 0x04, 0x1E, 0x01, 0xDE, 0xCE, 0x01, 0xDF, 0x94, 0x62, 0x1E, 0x32,
+    0x01, 0xDF, 0x9D, 0x00, 0x00, 0x09, 0xE1, 0x31, 0x01, 0xDE, 0xEB, 0x61, 0x30, 0x01, 0x85, 0x4D,
+    0x21, 0x23, 0x05, 0x21, 0x1B, 0x03, 0x21, 0x16, 0x03, 0x65, 0x23, 0x2A, 0x30, 0x32, 0x39, 0x00,
+    0x00, 0x03, 0x01, 0xDF, 0xB9, 0x01, 0xDF, 0xB9, 0x01, 0xC3, 0x01, 0x01, 0xDF, 0xA6, 0xE2, 0x32,
+    0x34, 0x01, 0xDF, 0x88, 0x01, 0xDC, 0xA1, 0x42, 0x23, 0x2A, 0x56, 0x5B, 0x56, 0x54, 0x21, 0x23,
+    0x07, 0x21, 0x04, 0x03, 0x62, 0x31, 0x38, 0x00, 0x00, 0x03, 0x01, 0xDF, 0xE4, 0x61, 0x04, 0x01,
+    0xDE, 0xC8, 0x62, 0x02, 0x17, 0x00, 0x90, 0xC3, 0x01, 0xDF, 0x6D, 0xF2, 0x08, 0x09, 0x0A, 0x0B,
+    0x19, 0x1E, 0x20, 0x21, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2D, 0x31, 0x32, 0x40, 0x42, 0x01, 0xBD,
+    0x23, 0x00, 0x9D, 0x86, 0x00, 0x00, 0x75, 0x00, 0x00, 0x6C, 0x01, 0xC4, 0x78, 0x01, 0xAA, 0x38,
+    0x00, 0x00, 0x5E, 0x00, 0x00, 0x55, 0x00, 0x00, 0x42, 0x01, 0x87, 0x7F, 0x01, 0x7B, 0xFA, 0x01,
+    0xDF, 0xFA, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0E, 0x00, 0x54, 0xC2, 0x00, 0x00,
+    0x09, 0x01, 0xB1, 0x36, 0x61, 0x30, 0x01, 0xC6, 0xB8, 0x21, 0x1A, 0x05, 0x63, 0x0A, 0x19, 0x40,
+    0x01, 0xDF, 0x4A, 0x00, 0x00, 0x03, 0x01, 0xA6, 0x9D, 0x62, 0x2A, 0x34, 0x01, 0xE0, 0x3D, 0x00,
+    0x00, 0x0D, 0x61, 0x31, 0x01, 0x91, 0xD4, 0x21, 0x17, 0x05, 0x41, 0x25, 0x13, 0xDC, 0x61, 0x2D,
+    0x01, 0xC8, 0x5B, 0x21, 0x40, 0x05, 0x22, 0x34, 0x35, 0x0C, 0x03, 0x41, 0x2D, 0xDA, 0x94, 0x21,
+    0x42, 0x04, 0x21, 0x34, 0x03, 0xE2, 0x1B, 0x32, 0x00, 0xAF, 0x31, 0x01, 0xDF, 0xCA, 0x61, 0x32,
+    0x01, 0x57, 0x73, 0x21, 0x23, 0x05, 0x41, 0x15, 0x58, 0xB6, 0x61, 0x0B, 0x01, 0xDE, 0x06, 0xE5,
+    0x01, 0x15, 0x17, 0x2A, 0x44, 0x00, 0x00, 0x1A, 0x01, 0xDF, 0x96, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x05, 0x41, 0x2D, 0x59, 0x1D, 0x62, 0x0B, 0x2A, 0x00, 0x00, 0x04, 0x01, 0xDF,
+    0xB6, 0x61, 0x14, 0x01, 0xDD, 0xB3, 0x21, 0x42, 0x05, 0x21, 0x34, 0x03, 0x62, 0x1A, 0x2D, 0x01,
+    0xA9, 0x80, 0x01, 0xC4, 0x14, 0xE2, 0x2D, 0x42, 0x01, 0xE0, 0x8F, 0x00, 0x00, 0x09, 0x41, 0x27,
+    0x0A, 0x75, 0x61, 0x23, 0x01, 0xB6, 0xDD, 0x21, 0x2D, 0x05, 0x21, 0x14, 0x03, 0x22, 0x32, 0x47,
+    0x0F, 0x03, 0x61, 0x34, 0x01, 0xA2, 0x5D, 0x61, 0x21, 0x01, 0x9E, 0x85, 0x21, 0x40, 0x05, 0x65,
+    0x0B, 0x1A, 0x25, 0x2A, 0x32, 0x01, 0x7C, 0xF4, 0x01, 0xE0, 0x99, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x03, 0x01, 0xE0, 0xFF, 0x62, 0x27, 0x2D, 0x01, 0xE0, 0x59, 0x01, 0xE1, 0x14, 0xE4, 0x19, 0x23,
+    0x2D, 0x41, 0x00, 0xEA, 0x8F, 0x00, 0x4C, 0x56, 0x00, 0x00, 0x09, 0x01, 0xD0, 0xFD, 0x62, 0x2D,
+    0x43, 0x01, 0xDD, 0xC3, 0x01, 0xDE, 0xFD, 0x62, 0x19, 0x31, 0x01, 0xDD, 0xCC, 0x01, 0xE0, 0x7C,
+    0x62, 0x0B, 0x1E, 0x00, 0xCB, 0xAF, 0x01, 0x9F, 0x9B, 0x62, 0x32, 0x4C, 0x01, 0xE0, 0x8E, 0x00,
+    0x00, 0x09, 0x61, 0x1E, 0x01, 0x9F, 0xAD, 0x62, 0x32, 0x4C, 0x01, 0xE1, 0x11, 0x00, 0x00, 0x05,
+    0x61, 0x25, 0x01, 0xE0, 0xA5, 0xEC, 0x01, 0x07, 0x0A, 0x15, 0x17, 0x1C, 0x23, 0x25, 0x2C, 0x40,
+    0x41, 0x43, 0x01, 0xE0, 0x2D, 0x01, 0xE1, 0x0A, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x0E, 0x01, 0xDC, 0x3A, 0x01, 0xCE, 0x47, 0x01, 0xDD, 0xFA, 0x01, 0xE0, 0x2D, 0x00, 0x00, 0x05,
+    0x01, 0x65, 0xD6, 0x01, 0x05, 0xE7, 0x61, 0x01, 0x01, 0xD5, 0x8A, 0xA1, 0x40, 0x05, 0x63, 0x01,
+    0x1A, 0x49, 0x00, 0x00, 0x03, 0x01, 0xE1, 0x9E, 0x01, 0xE1, 0x65, 0xE1, 0x1E, 0x01, 0xBD, 0x31,
+    0x63, 0x19, 0x21, 0x27, 0x01, 0xE1, 0xB0, 0x00, 0x00, 0x05, 0x01, 0xE1, 0xB0, 0x21, 0x22, 0x0D,
+    0x61, 0x4A, 0x01, 0xE1, 0x87, 0x21, 0x38, 0x05, 0x61, 0x1F, 0x01, 0xDA, 0x3D, 0x22, 0x08, 0x40,
+    0x08, 0x05, 0x63, 0x07, 0x21, 0x27, 0x01, 0xE1, 0xD2, 0x00, 0x00, 0x05, 0x01, 0xE1, 0xD2, 0x21,
+    0x22, 0x0D, 0xA1, 0x08, 0x1D, 0x62, 0x14, 0x21, 0x01, 0xE1, 0xE5, 0x00, 0x00, 0x03, 0x21, 0x22,
+    0x09, 0x44, 0x22, 0x48, 0x49, 0x4A, 0x04, 0x8C, 0x00, 0x34, 0x00, 0x12, 0x00, 0x03, 0x63, 0x14,
+    0x19, 0x21, 0x01, 0xE1, 0xFE, 0x01, 0xE1, 0xFE, 0x01, 0xE1, 0xFE, 0x61, 0x1F, 0x01, 0xB6, 0xE3,
+    0xE6, 0x07, 0x19, 0x21, 0x22, 0x2A, 0x40, 0x01, 0xE2, 0x10, 0x01, 0xE2, 0x10, 0x01, 0xE2, 0x10,
+    0x01, 0xE2, 0x10, 0x01, 0x97, 0xC1, 0x00, 0x00, 0x05, 0x21, 0x2D, 0x19, 0x64, 0x2D, 0x48, 0x49,
+    0x4A, 0x00, 0x00, 0x2E, 0x01, 0xDE, 0x1E, 0x00, 0x00, 0x03, 0x01, 0xD7, 0xEC, 0x61, 0x01, 0x01,
+    0xA3, 0x81, 0x21, 0x40, 0x05, 0x21, 0x19, 0x03, 0x21, 0x22, 0x03, 0x62, 0x22, 0x48, 0x01, 0xE2,
+    0x4B, 0x00, 0x00, 0x03, 0x21, 0x35, 0x09, 0x61, 0x22, 0x01, 0xB8, 0xD6, 0x21, 0x35, 0x05, 0x62,
+    0x19, 0x23, 0x01, 0xE2, 0x5F, 0x00, 0x00, 0x03, 0x62, 0x31, 0x35, 0x01, 0x41, 0x44, 0x01, 0xE2,
+    0x68, 0x21, 0x23, 0x09, 0x21, 0x2D, 0x03, 0x61, 0x48, 0x01, 0xD5, 0x4E, 0x67, 0x04, 0x0A, 0x0B,
+    0x14, 0x18, 0x21, 0x22, 0x01, 0xC5, 0x29, 0x00, 0x00, 0x28, 0x01, 0xC4, 0x89, 0x00, 0x00, 0x1D,
+    0x01, 0xA4, 0xD2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05, 0x61, 0x23, 0x01, 0xC5, 0x46, 0x21, 0x40,
+    0x05, 0x21, 0x2D, 0x03, 0x62, 0x25, 0x2D, 0x00, 0x00, 0x03, 0x01, 0xBD, 0xA9, 0x61, 0x1E, 0x01,
+    0xAB, 0x47, 0xA2, 0x1E, 0x40, 0x0E, 0x05, 0x21, 0x4C, 0x05, 0x21, 0x0B, 0x03, 0x41, 0x30, 0xE8,
+    0x76, 0xE2, 0x15, 0x2D, 0x00, 0x00, 0x04, 0x01, 0xB6, 0x73, 0x61, 0x23, 0x01, 0xBD, 0xA2, 0x21,
+    0x1E, 0x05, 0x62, 0x40, 0x44, 0x01, 0xA1, 0x7B, 0x00, 0x00, 0x03, 0x21, 0x4C, 0x09, 0x21, 0x23,
+    0x03, 0x21, 0x2D, 0x03, 0x21, 0x15, 0x03, 0xE2, 0x14, 0x40, 0x01, 0xE2, 0xCE, 0x00, 0x00, 0x03,
+    0x41, 0x1A, 0x79, 0x17, 0x65, 0x01, 0x07, 0x14, 0x19, 0x21, 0x00, 0x00, 0x3A, 0x01, 0xE2, 0xF4,
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04, 0x62, 0x22, 0x2D, 0x01, 0xE3, 0x09, 0x01,
+    0xE3, 0x09, 0x61, 0x40, 0x01, 0xAC, 0x45, 0x21, 0x30, 0x05, 0x61, 0x2E, 0x01, 0xE2, 0xC5, 0xA2,
+    0x23, 0x40, 0x08, 0x05, 0xE3, 0x01, 0x2D, 0x40, 0x01, 0xE2, 0xBE, 0x00, 0x00, 0x05, 0x01, 0xE0,
+    0x16, 0x64, 0x01, 0x22, 0x27, 0x30, 0x01, 0xE3, 0x31, 0x01, 0xE3, 0x31, 0x01, 0xE3, 0x31, 0x01,
+    0xE3, 0x31, 0xFD, 0x01, 0x07, 0x0A, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1B, 0x1E, 0x21, 0x22, 0x23,
+    0x25, 0x27, 0x2C, 0x2D, 0x30, 0x32, 0x34, 0x35, 0x37, 0x40, 0x41, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x00, 0x03, 0x47, 0x01, 0xE3, 0x42, 0x01, 0xE2, 0x79, 0x00, 0x02, 0xE9, 0x00, 0x02, 0xDB, 0x00,
+    0x02, 0xCC, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xA3, 0x00, 0x02, 0x8A, 0x00, 0x02, 0x79, 0x00, 0x02,
+    0x6D, 0x01, 0xE3, 0x42, 0x00, 0x02, 0x55, 0x00, 0x02, 0x43, 0x01, 0x19, 0xC4, 0x00, 0x1D, 0x33,
+    0x00, 0x02, 0x25, 0x00, 0x02, 0x14, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xA4, 0x00, 0x01, 0x51, 0x00,
+    0x01, 0x16, 0x00, 0x00, 0xC6, 0x00, 0xFB, 0xA3, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x39, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x11, 0x00, 0x42, 0xC1, 0x63, 0x01, 0x25, 0x40, 0x01, 0xBE, 0x92, 0x01, 0xC6,
+    0xB6, 0x00, 0xE9, 0x3F, 0x21, 0x15, 0x0D, 0x62, 0x15, 0x42, 0x01, 0xE2, 0xD1, 0x00, 0x00, 0x03,
+    0xE1, 0x0B, 0x01, 0xDD, 0xB1, 0x61, 0x1F, 0x01, 0xDF, 0xB0, 0x21, 0x44, 0x05, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x21, 0x03, 0x21, 0x35, 0x03, 0x61, 0x07, 0x01, 0x7A,
+    0x7D, 0x21, 0x34, 0x05, 0x41, 0x2D, 0x44, 0xD0, 0x21, 0x04, 0x04, 0x22, 0x0B, 0x34, 0x0A, 0x03,
+    0x41, 0x17, 0x4F, 0x51, 0x41, 0x27, 0x52, 0x4D, 0x21, 0x01, 0x04, 0x21, 0x42, 0x03, 0x21, 0x0B,
+    0x03, 0x41, 0x42, 0x4E, 0x87, 0x21, 0x21, 0x04, 0x63, 0x0B, 0x40, 0x42, 0x01, 0x33, 0xCD, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x03, 0x21, 0x4C, 0x0D, 0xA1, 0x23, 0x03, 0x61, 0x19, 0x01, 0x7C, 0x8D,
+    0x21, 0x40, 0x05, 0x62, 0x1A, 0x23, 0x00, 0x00, 0x03, 0x01, 0xBF, 0x07, 0x63, 0x19, 0x1A, 0x27,
+    0x01, 0xE4, 0x3C, 0x01, 0xE4, 0x3C, 0x01, 0xE4, 0x3C, 0x21, 0x22, 0x0D, 0x62, 0x22, 0x49, 0x01,
+    0xE4, 0x4C, 0x00, 0x00, 0x03, 0x61, 0x2D, 0x01, 0xDC, 0x8B, 0x61, 0x4C, 0x01, 0x7E, 0xE7, 0x21,
+    0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x1A, 0x03, 0x21, 0x40, 0x03, 0x21, 0x19, 0x03, 0x62, 0x14,
+    0x25, 0x00, 0x00, 0x03, 0x01, 0xE2, 0xF6, 0x61, 0x1A, 0x01, 0xCA, 0x09, 0x21, 0x25, 0x05, 0x21,
+    0x01, 0x03, 0x21, 0x42, 0x03, 0x63, 0x21, 0x23, 0x25, 0x00, 0x00, 0x03, 0x01, 0xC3, 0x08, 0x01,
+    0xE4, 0x85, 0x63, 0x22, 0x27, 0x2D, 0x01, 0xE4, 0x92, 0x01, 0xE4, 0x92, 0x01, 0xE4, 0x92, 0xF0,
+    0x01, 0x07, 0x21, 0x22, 0x25, 0x2A, 0x2D, 0x2E, 0x32, 0x34, 0x35, 0x37, 0x40, 0x42, 0x44, 0x49,
+    0x00, 0x00, 0xD8, 0x00, 0x00, 0xCF, 0x00, 0x00, 0xB6, 0x01, 0xE4, 0x9F, 0x00, 0x00, 0xA4, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x77, 0x01, 0xE4, 0x39, 0x01, 0xE4, 0x9F, 0x00, 0x00, 0x6C, 0x00, 0x00,
+    0x53, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x31, 0x00, 0x00, 0x1A, 0x01, 0xAD, 0x57, 0x00, 0x00, 0x0D,
+    0x7F, 0x23, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27,
+    0x28, 0x2A, 0x2B, 0x2D, 0x2E, 0x00, 0x3D, 0x46, 0x00, 0x3B, 0x43, 0x00, 0x38, 0x48, 0x00, 0x51,
+    0xD6, 0x00, 0x37, 0x04, 0x00, 0x34, 0xDC, 0x00, 0x33, 0xDB, 0x00, 0x32, 0x00, 0x00, 0x2E, 0xAC,
+    0x00, 0x2E, 0x4A, 0x01, 0xE2, 0x50, 0x01, 0xE4, 0x9A, 0x00, 0x2C, 0xC9, 0x00, 0x2A, 0xE2, 0x00,
+    0x29, 0xD5, 0x00, 0x25, 0xA0, 0x00, 0x25, 0x28, 0x00, 0x23, 0xC0, 0x00, 0x21, 0x0A, 0x00, 0x1E,
+    0xAF, 0x00, 0x1D, 0xDD, 0x00, 0x1D, 0x8E, 0x00, 0x1A, 0xF5, 0x00, 0x19, 0x97, 0x00, 0x19, 0x00,
+    0x00, 0x16, 0x51, 0x00, 0x14, 0x91, 0x00, 0x12, 0x85, 0x00, 0x0F, 0xB0, 0x00, 0x0C, 0xAA, 0x00,
+    0x0B, 0xA7, 0x00, 0x08, 0x8A, 0x00, 0x05, 0x9F, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x41, 0xE6, 0x02,
+    0x08, 0x1A, 0x2A, 0x41, 0x44, 0x01, 0xE3, 0x5F, 0x01, 0xB2, 0xD4, 0x01, 0x9E, 0xDF, 0x01, 0xDD,
+    0x49, 0x01, 0x0E, 0x1C, 0x01, 0xE5, 0x1F, 0xE2, 0x21, 0x40, 0x01, 0xE5, 0x21, 0x01, 0x7F, 0x99,
+    0x61, 0x32, 0x01, 0x07, 0xBF, 0x61, 0x2E, 0x01, 0x07, 0x2A, 0x21, 0x32, 0x05, 0x22, 0x04, 0x1A,
+    0x0D, 0x03, 0x21, 0x4C, 0x05, 0x62, 0x14, 0x34, 0x00, 0x00, 0x03, 0x01, 0xE2, 0x97, 0x68, 0x01,
+    0x19, 0x1A, 0x21, 0x30, 0x44, 0x47, 0x48, 0x01, 0xE5, 0xAE, 0x00, 0x00, 0x09, 0x01, 0xE5, 0xAE,
+    0x01, 0xD5, 0x53, 0x01, 0xE5, 0xAE, 0x00, 0x01, 0xD9, 0x01, 0xE5, 0x75, 0x01, 0xCA, 0x3C, 0xE9,
+    0x07, 0x19, 0x1A, 0x25, 0x30, 0x34, 0x40, 0x48, 0x49, 0x01, 0xE5, 0xCF, 0x01, 0xE5, 0xCF, 0x01,
+    0xE5, 0xCF, 0x01, 0xE0, 0x1D, 0x01, 0xE5, 0xCF, 0x01, 0xE4, 0xAD, 0x01, 0x53, 0xA7, 0x01, 0xE5,
+    0xCF, 0x01, 0x43, 0xB9, 0xE1, 0x48, 0x01, 0xDF, 0x6A, 0xE2, 0x14, 0x23, 0x01, 0xDF, 0x0B, 0x01,
+    0xE1, 0xEB, 0x61, 0x25, 0x01, 0xA8, 0x41, 0x21, 0x14, 0x05, 0xE2, 0x04, 0x41, 0x01, 0xE1, 0xFC,
+    0x01, 0xD9, 0x01, 0x61, 0x2D, 0x01, 0x2C, 0xA9, 0x21, 0x07, 0x05, 0x21, 0x2D, 0x03, 0xE3, 0x08,
+    0x17, 0x41, 0x00, 0xD8, 0x01, 0x00, 0x00, 0x03, 0x01, 0xD0, 0xD5, 0xE3, 0x07, 0x19, 0x41, 0x00,
+    0x00, 0x21, 0x00, 0x00, 0x0D, 0x01, 0x70, 0x13, 0x61, 0x25, 0x01, 0xE5, 0xE0, 0xA1, 0x04, 0x05,
+    0xE1, 0x37, 0x01, 0xE5, 0xEB, 0x61, 0x1E, 0x01, 0x10, 0xDB, 0x61, 0x07, 0x01, 0xE6, 0x01, 0x21,
+    0x31, 0x05, 0xE5, 0x15, 0x19, 0x1C, 0x21, 0x2B, 0x01, 0xE5, 0xEC, 0x00, 0x00, 0x0D, 0x01, 0x72,
+    0x63, 0x00, 0x00, 0x03, 0x01, 0xE6, 0x39, 0xE9, 0x02, 0x07, 0x15, 0x1A, 0x1D, 0x21, 0x25, 0x27,
+    0x44, 0x01, 0xE6, 0x15, 0x00, 0x00, 0x2A, 0x01, 0xE5, 0x5E, 0x01, 0xE6, 0x2E, 0x01, 0xE5, 0x65,
+    0x00, 0x00, 0x27, 0x01, 0xDF, 0x79, 0x00, 0x00, 0x15, 0x01, 0xE4, 0xDF, 0x63, 0x07, 0x1B, 0x2A,
+    0x01, 0xE6, 0x8C, 0x01, 0xE6, 0x8C, 0x01, 0xBC, 0x70, 0xEE, 0x07, 0x14, 0x19, 0x21, 0x23, 0x25,
+    0x27, 0x30, 0x41, 0x42, 0x47, 0x48, 0x49, 0x4A, 0x00, 0x01, 0x2B, 0x01, 0xDF, 0xAB, 0x01, 0xE3,
+    0xA0, 0x00, 0x01, 0x12, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA0,
+    0x01, 0xCC, 0x23, 0x00, 0x00, 0x92, 0x01, 0xE3, 0x8B, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x32, 0x00,
+    0x00, 0x0D, 0xE2, 0x47, 0x48, 0x01, 0xE2, 0xBA, 0x01, 0xE5, 0xCD, 0x64, 0x01, 0x07, 0x19, 0x30,
+    0x01, 0xE6, 0xDB, 0x01, 0xE6, 0xDB, 0x00, 0xFF, 0x97, 0x01, 0xE6, 0xDB, 0x61, 0x01, 0x01, 0xB0,
+    0x0E, 0xC2, 0x01, 0x41, 0xC5, 0xAB, 0x00, 0x05, 0x21, 0x07, 0x07, 0x61, 0x07, 0x01, 0xD2, 0xD9,
+    0xE9, 0x01, 0x19, 0x21, 0x22, 0x25, 0x27, 0x47, 0x48, 0x49, 0x01, 0xE7, 0x00, 0x01, 0xE1, 0x55,
+    0x00, 0x00, 0x2E, 0x01, 0x8B, 0xE6, 0x01, 0xE6, 0x0D, 0x00, 0x00, 0x25, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x05, 0x01, 0xE0, 0x76, 0x62, 0x0A, 0x21, 0x01, 0xA4, 0xB3, 0x01, 0xA4, 0xB3, 0xA1, 0x40,
+    0x09, 0x41, 0x2D, 0x5B, 0x5D, 0x62, 0x0B, 0x1A, 0x01, 0xC1, 0xF9, 0x00, 0x00, 0x04, 0xE4, 0x0B,
+    0x2D, 0x32, 0x40, 0x01, 0xA5, 0x59, 0x01, 0xE7, 0x3D, 0x01, 0xE5, 0xA7, 0x00, 0x00, 0x09, 0xE2,
+    0x2B, 0x32, 0x01, 0xB3, 0xC6, 0x01, 0xC5, 0x9A, 0x61, 0x15, 0x01, 0xA7, 0xAF, 0x21, 0x34, 0x05,
+    0x62, 0x0B, 0x1B, 0x01, 0xD7, 0xD5, 0x00, 0x00, 0x03, 0x61, 0x1B, 0x01, 0x88, 0x41, 0xE2, 0x1B,
+    0x40, 0x01, 0xA5, 0x89, 0x00, 0x00, 0x05, 0x41, 0x40, 0x24, 0x19, 0x21, 0x1A, 0x04, 0x68, 0x01,
+    0x07, 0x2D, 0x30, 0x34, 0x47, 0x48, 0x4C, 0x01, 0xE7, 0x7E, 0x01, 0xE7, 0x7E, 0x01, 0xE5, 0x80,
+    0x01, 0xE7, 0x7E, 0x00, 0x00, 0x03, 0x01, 0xE7, 0x7D, 0x01, 0xE7, 0x7E, 0x01, 0xE7, 0x7E, 0x62,
+    0x23, 0x25, 0x01, 0xA5, 0xBA, 0x01, 0xA5, 0xBA, 0x21, 0x39, 0x09, 0x61, 0x19, 0x01, 0xE5, 0xAD,
+    0x21, 0x40, 0x05, 0x21, 0x34, 0x03, 0x41, 0x19, 0xEC, 0x45, 0x21, 0x40, 0x04, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x1F, 0x03, 0x61, 0x1A, 0x01, 0xD7, 0xB0, 0x21, 0x44,
+    0x05, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x61, 0x25, 0x01, 0xD4, 0xBF, 0x21,
+    0x04, 0x05, 0x21, 0x0B, 0x03, 0xA2, 0x04, 0x44, 0x0E, 0x03, 0x21, 0x21, 0x05, 0x21, 0x22, 0x03,
+    0x21, 0x35, 0x03, 0x21, 0x0B, 0x03, 0x61, 0x04, 0x01, 0xBE, 0x86, 0x21, 0x27, 0x05, 0xE1, 0x04,
+    0x01, 0xAC, 0x7C, 0x21, 0x27, 0x05, 0x6A, 0x04, 0x07, 0x19, 0x23, 0x2D, 0x34, 0x40, 0x44, 0x48,
+    0x49, 0x00, 0x00, 0x5E, 0x01, 0xB5, 0x45, 0x01, 0xE8, 0x06, 0x00, 0x00, 0x53, 0x01, 0xE6, 0x54,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x13, 0x01, 0xC6, 0x55, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xE2,
+    0x01, 0x49, 0x01, 0xE8, 0x2F, 0x01, 0xE1, 0xA5, 0x61, 0x4C, 0x01, 0xE4, 0x0C, 0x21, 0x23, 0x05,
+    0x21, 0x2D, 0x03, 0x21, 0x17, 0x03, 0x21, 0x40, 0x03, 0x21, 0x34, 0x03, 0x42, 0x0B, 0x40, 0x00,
+    0x03, 0xA2, 0xE5, 0x61, 0x04, 0x01, 0xE7, 0xD4, 0xA1, 0x44, 0x05, 0x61, 0x23, 0x01, 0xE3, 0x9D,
+    0x21, 0x2D, 0x05, 0x21, 0x21, 0x03, 0x63, 0x01, 0x15, 0x2A, 0x01, 0xE8, 0x08, 0x01, 0xE8, 0x20,
+    0x01, 0xE8, 0x17, 0x61, 0x19, 0x01, 0x79, 0xF6, 0x21, 0x25, 0x05, 0x21, 0x44, 0x03, 0x62, 0x17,
+    0x23, 0x01, 0xE8, 0x2F, 0x00, 0x00, 0x03, 0x61, 0x4C, 0x01, 0x3C, 0xC0, 0x21, 0x1B, 0x05, 0xE2,
+    0x19, 0x21, 0x01, 0xBE, 0xEB, 0x00, 0x00, 0x03, 0xF1, 0x0A, 0x14, 0x19, 0x1A, 0x1B, 0x1D, 0x21,
+    0x23, 0x25, 0x27, 0x2A, 0x30, 0x40, 0x41, 0x42, 0x48, 0x49, 0x00, 0x01, 0x6A, 0x01, 0x45, 0xF6,
+    0x00, 0x01, 0x5A, 0x00, 0x01, 0x49, 0x00, 0x01, 0x38, 0x01, 0xE4, 0x8A, 0x00, 0x01, 0x2A, 0x00,
+    0x01, 0x1A, 0x00, 0x00, 0x92, 0x00, 0x00, 0x69, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x32, 0x00, 0x00, 0x1A, 0x01, 0xCF, 0x29, 0x00, 0x00, 0x09, 0xE2, 0x07, 0x19,
+    0x01, 0x80, 0xE2, 0x01, 0xC3, 0x49, 0xE3, 0x30, 0x48, 0x49, 0x01, 0xE8, 0xE6, 0x00, 0x00, 0x09,
+    0x01, 0xE6, 0xD7, 0xE2, 0x31, 0x41, 0x01, 0xE8, 0xBA, 0x01, 0x9A, 0xA7, 0x61, 0x19, 0x01, 0xC3,
+    0x2A, 0x21, 0x2D, 0x05, 0x62, 0x39, 0x49, 0x01, 0xE8, 0xF1, 0x00, 0x00, 0x03, 0xE2, 0x23, 0x25,
+    0x00, 0x00, 0x09, 0x01, 0xE3, 0x5B, 0x62, 0x19, 0x31, 0x01, 0xE9, 0x16, 0x01, 0xE8, 0xDD, 0x61,
+    0x41, 0x01, 0x9B, 0xCA, 0x61, 0x2D, 0x01, 0xC6, 0x4C, 0x21, 0x39, 0x05, 0x61, 0x40, 0x01, 0x3D,
+    0xEF, 0x61, 0x2A, 0x01, 0xE8, 0x2F, 0x21, 0x01, 0x05, 0x61, 0x38, 0x01, 0xE8, 0x84, 0xE3, 0x08,
+    0x1A, 0x43, 0x01, 0xC3, 0xD1, 0x00, 0x00, 0x05, 0x01, 0xD6, 0x20, 0x62, 0x21, 0x27, 0x00, 0x00,
+    0x0D, 0x01, 0xE9, 0x4B, 0x61, 0x2A, 0x01, 0x93, 0xDA, 0x21, 0x34, 0x05, 0x21, 0x23, 0x03, 0x21,
+    0x34, 0x03, 0xC2, 0x27, 0x28, 0x93, 0x31, 0x00, 0x03, 0xE4, 0x07, 0x19, 0x27, 0x2B, 0x00, 0x00,
+    0x07, 0x01, 0xE9, 0x69, 0x01, 0xE9, 0x69, 0x01, 0xDD, 0xF5, 0x41, 0x2B, 0xB5, 0x4F, 0xA1, 0x41,
+    0x04, 0xA1, 0x27, 0x03, 0xF0, 0x01, 0x07, 0x08, 0x14, 0x15, 0x1A, 0x23, 0x25, 0x27, 0x2A, 0x30,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x00, 0x91, 0x00, 0x00, 0x77, 0x00, 0x00, 0x6E, 0x00, 0x00,
+    0x65, 0x01, 0xE9, 0x3E, 0x01, 0xE9, 0x84, 0x00, 0x22, 0x44, 0x00, 0x00, 0x5B, 0x01, 0xE9, 0x84,
+    0x00, 0x00, 0x58, 0x01, 0xE9, 0x84, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x39, 0x00, 0x00, 0x1B, 0x01,
+    0xE9, 0x35, 0x00, 0x00, 0x03, 0xC1, 0x19, 0xD1, 0x0F, 0x21, 0x21, 0x04, 0x63, 0x1A, 0x30, 0x49,
+    0x01, 0xE9, 0xCC, 0x01, 0xE9, 0xCC, 0x00, 0x00, 0x03, 0xE1, 0x41, 0x01, 0x7F, 0xEE, 0xE8, 0x01,
+    0x07, 0x1A, 0x25, 0x27, 0x30, 0x42, 0x48, 0x01, 0xE9, 0xDE, 0x01, 0xE9, 0xDE, 0x01, 0xE9, 0x80,
+    0x00, 0x00, 0x12, 0x01, 0xE9, 0xDE, 0x00, 0x00, 0x05, 0x01, 0x0D, 0x49, 0x01, 0xE4, 0x33, 0x61,
+    0x35, 0x01, 0xD1, 0x06, 0x21, 0x23, 0x05, 0x62, 0x01, 0x21, 0x00, 0x00, 0x03, 0x01, 0xE9, 0xA1,
+    0x62, 0x0D, 0x35, 0x01, 0xEA, 0x10, 0x01, 0x1E, 0x35, 0x21, 0x1B, 0x09, 0x64, 0x1B, 0x1E, 0x20,
+    0x40, 0x01, 0xEA, 0x00, 0x01, 0xEA, 0x03, 0x01, 0xEA, 0x03, 0x00, 0x00, 0x03, 0x62, 0x07, 0x4C,
+    0x01, 0xEA, 0x2D, 0x01, 0xEA, 0x2D, 0x62, 0x40, 0x48, 0x01, 0xCC, 0xF6, 0x01, 0xE8, 0x27, 0x61,
+    0x0B, 0x01, 0xA8, 0x3E, 0x61, 0x18, 0x01, 0xE8, 0x35, 0xE2, 0x07, 0x21, 0x01, 0xEA, 0x49, 0x00,
+    0x21, 0xA8, 0xEA, 0x07, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x2A, 0x30, 0x41, 0x48, 0x00, 0x00, 0x4B,
+    0x01, 0xCD, 0x0E, 0x00, 0x39, 0xA1, 0x00, 0x00, 0x36, 0x00, 0x00, 0x25, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x13, 0x01, 0xEA, 0x52, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0xCC, 0x55,
+    0x21, 0x21, 0x05, 0x21, 0x40, 0x03, 0x21, 0x32, 0x03, 0x62, 0x23, 0x32, 0x00, 0x00, 0x03, 0x01,
+    0x5E, 0x2A, 0x61, 0x19, 0x01, 0xA8, 0x91, 0x21, 0x2D, 0x05, 0x21, 0x14, 0x03, 0x21, 0x40, 0x03,
+    0x21, 0x4C, 0x03, 0xE3, 0x0A, 0x15, 0x41, 0x01, 0xE9, 0xA1, 0x00, 0x00, 0x03, 0x01, 0x86, 0xC6,
+    0x61, 0x40, 0x01, 0x21, 0x2E, 0x41, 0x35, 0x32, 0x1A, 0x61, 0x27, 0x01, 0xC6, 0x46, 0x21, 0x4C,
+    0x05, 0x61, 0x39, 0x01, 0xAC, 0x2C, 0x21, 0x23, 0x05, 0x21, 0x04, 0x03, 0x21, 0x32, 0x03, 0x61,
+    0x15, 0x01, 0x83, 0xDE, 0x24, 0x0B, 0x14, 0x15, 0x42, 0x1F, 0x16, 0x08, 0x05, 0x61, 0x1F, 0x01,
+    0xE9, 0xEA, 0x21, 0x44, 0x05, 0x62, 0x1A, 0x1B, 0x01, 0xCC, 0xF2, 0x01, 0xC5, 0xA9, 0xA1, 0x40,
+    0x09, 0x41, 0x0B, 0xD3, 0x42, 0xA1, 0x42, 0x04, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x21, 0x23,
+    0x03, 0x21, 0x32, 0x03, 0x21, 0x04, 0x03, 0x21, 0x01, 0x03, 0xEF, 0x04, 0x07, 0x14, 0x17, 0x19,
+    0x1A, 0x1B, 0x1F, 0x21, 0x22, 0x25, 0x27, 0x30, 0x47, 0x48, 0x00, 0x00, 0x81, 0x00, 0x00, 0x67,
+    0x01, 0xC5, 0x76, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x36, 0x01, 0xEB, 0x0A, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x1C, 0x01, 0xE5, 0xDF, 0x01, 0x29, 0xF0, 0x01, 0xEB, 0x0A, 0x01, 0xEB,
+    0x0A, 0x00, 0x00, 0x03, 0x01, 0x8A, 0xCD, 0xE4, 0x07, 0x14, 0x2B, 0x41, 0x01, 0xEA, 0xE1, 0x01,
+    0xEA, 0x45, 0x01, 0xE8, 0xB7, 0x01, 0xC2, 0x18, 0xE2, 0x32, 0x34, 0x01, 0xEA, 0xFA, 0x01, 0xE4,
+    0x1F, 0x61, 0x30, 0x01, 0x89, 0x51, 0x61, 0x23, 0x01, 0x39, 0x7A, 0x21, 0x19, 0x05, 0xE3, 0x15,
+    0x40, 0x44, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01, 0xEA, 0xB9, 0x61, 0x14, 0x01, 0xE5, 0xED,
+    0xA1, 0x41, 0x05, 0x61, 0x01, 0x01, 0xAF, 0x5C, 0xE2, 0x19, 0x27, 0x01, 0xEB, 0x88, 0x01, 0xC5,
+    0xF4, 0xE9, 0x01, 0x07, 0x14, 0x19, 0x22, 0x2B, 0x30, 0x47, 0x48, 0x00, 0x00, 0x4A, 0x01, 0x72,
+    0x69, 0x00, 0x00, 0x39, 0x00, 0x00, 0x23, 0x01, 0xEA, 0x8F, 0x01, 0x3B, 0x95, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x62, 0x15, 0x22, 0x01, 0xEB, 0x7D, 0x01, 0xEB, 0xB5, 0xE9,
+    0x04, 0x09, 0x14, 0x17, 0x1D, 0x1E, 0x21, 0x2B, 0x41, 0x01, 0xEB, 0x6A, 0x01, 0xEB, 0x64, 0x01,
+    0xDD, 0xDE, 0x01, 0x80, 0xEE, 0x01, 0x8E, 0xE9, 0x01, 0xEB, 0x64, 0x01, 0xEA, 0xBD, 0x01, 0xC5,
+    0x3C, 0x00, 0x00, 0x09, 0xE4, 0x01, 0x40, 0x42, 0x44, 0x01, 0x3B, 0xE8, 0x01, 0xE9, 0xD5, 0x01,
+    0xE9, 0xD5, 0x01, 0xCC, 0x42, 0xE3, 0x07, 0x27, 0x30, 0x01, 0xE6, 0x43, 0x01, 0xEB, 0xEB, 0x01,
+    0xEB, 0xF5, 0x41, 0x2E, 0x30, 0x31, 0x21, 0x41, 0x04, 0x62, 0x32, 0x34, 0x00, 0x00, 0x03, 0x01,
+    0xEB, 0xD0, 0x21, 0x25, 0x09, 0xE3, 0x07, 0x25, 0x46, 0x01, 0xB8, 0x70, 0x01, 0xE8, 0xAA, 0x01,
+    0xEC, 0x15, 0x61, 0x34, 0x01, 0x6D, 0x40, 0xE1, 0x04, 0x01, 0xEC, 0x0E, 0xE3, 0x08, 0x21, 0x27,
+    0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0x01, 0xEC, 0x2C, 0x61, 0x15, 0x01, 0xE6, 0xAB, 0x21, 0x41,
+    0x05, 0x61, 0x2D, 0x01, 0xCE, 0x4E, 0x21, 0x40, 0x05, 0x22, 0x14, 0x30, 0x0B, 0x03, 0x6A, 0x01,
+    0x07, 0x14, 0x19, 0x23, 0x25, 0x30, 0x48, 0x49, 0x4A, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x6A, 0x01,
+    0xEC, 0x4E, 0x01, 0xEC, 0x4E, 0x00, 0x00, 0x59, 0x00, 0x00, 0x3C, 0x01, 0xEC, 0x4E, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x22, 0x00, 0x00, 0x05, 0x62, 0x20, 0x40, 0x01, 0xAB, 0x85, 0x01, 0xC5, 0xDE,
+    0x21, 0x01, 0x09, 0x21, 0x36, 0x03, 0x21, 0x17, 0x03, 0x21, 0x19, 0x03, 0x21, 0x31, 0x03, 0xA1,
+    0x1A, 0x03, 0xE1, 0x1E, 0x01, 0xEC, 0x91, 0xE1, 0x23, 0x01, 0x9A, 0x44, 0x21, 0x4C, 0x05, 0x21,
+    0x13, 0x03, 0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0xE2, 0x01, 0x44, 0x00, 0x00, 0x03, 0x01, 0xEB,
+    0x20, 0x62, 0x07, 0x1A, 0x00, 0x00, 0x09, 0x01, 0xEC, 0xB1, 0xE7, 0x01, 0x07, 0x19, 0x1A, 0x21,
+    0x25, 0x27, 0x01, 0xEC, 0xBA, 0x01, 0xEC, 0xBA, 0x01, 0xEC, 0xBA, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x09, 0x01, 0xEC, 0xBA, 0x62, 0x01, 0x04, 0x01, 0xEC, 0xD7, 0x01, 0xAF, 0x31,
+    0x21, 0x34, 0x09, 0x21, 0x15, 0x03, 0xE3, 0x17, 0x42, 0x43, 0x01, 0xE6, 0xC7, 0x01, 0xEC, 0xE5,
+    0x01, 0xEA, 0xB5, 0x41, 0x40, 0x37, 0x1E, 0x62, 0x25, 0x44, 0x01, 0xC7, 0xD6, 0x01, 0xB5, 0xAF,
+    0x62, 0x32, 0x35, 0x00, 0x00, 0x09, 0x01, 0xEC, 0x6F, 0x61, 0x08, 0x01, 0xDF, 0xE0, 0xE4, 0x04,
+    0x0B, 0x17, 0x40, 0x01, 0xDC, 0x56, 0x00, 0x25, 0x55, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x63,
+    0x2D, 0x36, 0x49, 0x01, 0xEC, 0xE6, 0x01, 0xEB, 0x10, 0x01, 0xE7, 0x6D, 0xE3, 0x0B, 0x40, 0x41,
+    0x00, 0x00, 0x0D, 0x01, 0xB3, 0x7D, 0x01, 0xA3, 0xF5, 0x62, 0x01, 0x40, 0x00, 0x00, 0x0D, 0x01,
+    0x7D, 0xC2, 0x61, 0x21, 0x01, 0xCD, 0x1D, 0x62, 0x21, 0x40, 0x01, 0xEC, 0x45, 0x00, 0x00, 0x05,
+    0xC1, 0x0B, 0x3A, 0x23, 0x61, 0x4C, 0x01, 0xCC, 0xB0, 0x62, 0x01, 0x04, 0x00, 0x00, 0x05, 0x01,
+    0xED, 0x3D, 0x22, 0x01, 0x07, 0x12, 0x09, 0xE2, 0x07, 0x19, 0x01, 0xED, 0x67, 0x00, 0x44, 0x0A,
+    0xE3, 0x07, 0x08, 0x46, 0x01, 0xED, 0x70, 0x01, 0x02, 0x79, 0x01, 0xED, 0x70, 0x6D, 0x04, 0x07,
+    0x0A, 0x15, 0x19, 0x1A, 0x23, 0x25, 0x2A, 0x30, 0x47, 0x48, 0x49, 0x00, 0x00, 0x9A, 0x00, 0x00,
+    0x97, 0x00, 0x00, 0x8A, 0x01, 0xDB, 0x15, 0x00, 0x00, 0x6F, 0x01, 0xED, 0x7D, 0x00, 0x00, 0x44,
+    0x00, 0x2A, 0xAA, 0x00, 0x00, 0x36, 0x00, 0x53, 0x14, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x16, 0x00,
+    0x00, 0x0D, 0x61, 0x0B, 0x01, 0xCC, 0xF7, 0x61, 0x2B, 0x01, 0xE8, 0xF5, 0x21, 0x48, 0x05, 0x62,
+    0x32, 0x35, 0x01, 0xED, 0xB5, 0x00, 0x00, 0x03, 0xE4, 0x04, 0x17, 0x1B, 0x23, 0x01, 0xE8, 0x9D,
+    0x00, 0x00, 0x09, 0x01, 0xEB, 0x38, 0x01, 0xE9, 0xB0, 0x62, 0x31, 0x33, 0x01, 0xED, 0x8A, 0x01,
+    0xED, 0xD9, 0x62, 0x19, 0x2B, 0x01, 0xEC, 0xDD, 0x01, 0xED, 0xA9, 0xA2, 0x19, 0x41, 0x12, 0x09,
+    0x61, 0x19, 0x01, 0xED, 0x9E, 0x61, 0x1F, 0x01, 0xE6, 0xBC, 0xE3, 0x02, 0x2D, 0x41, 0x00, 0x00,
+    0x0A, 0x01, 0xED, 0xC1, 0x00, 0x00, 0x05, 0xE7, 0x07, 0x0A, 0x19, 0x27, 0x30, 0x41, 0x43, 0x01,
+    0xEE, 0x07, 0x01, 0xED, 0xB5, 0x00, 0x00, 0x0D, 0x01, 0xEE, 0x07, 0x01, 0xEE, 0x07, 0x01, 0x68,
+    0x83, 0x01, 0xEB, 0xD6, 0x67, 0x01, 0x0A, 0x1A, 0x21, 0x27, 0x30, 0x48, 0x00, 0x00, 0x72, 0x00,
+    0xC9, 0x1D, 0x01, 0xEE, 0x24, 0x01, 0xEE, 0x24, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x39, 0x00, 0x00,
+    0x1D, 0xE1, 0x41, 0x01, 0x78, 0x29, 0x41, 0x23, 0x39, 0x52, 0x61, 0x2E, 0x01, 0xDE, 0x2D, 0xE5,
+    0x01, 0x17, 0x2D, 0x41, 0x44, 0x00, 0x00, 0x09, 0x01, 0xAB, 0x24, 0x01, 0x83, 0x7E, 0x00, 0x00,
+    0x05, 0x01, 0x5B, 0xE0, 0x61, 0x19, 0x01, 0xEC, 0x80, 0x21, 0x34, 0x05, 0x21, 0x21, 0x03, 0x61,
+    0x39, 0x01, 0xD1, 0xB7, 0x21, 0x23, 0x05, 0x21, 0x19, 0x03, 0x42, 0x31, 0x40, 0x00, 0x03, 0xD1,
+    0x88, 0x61, 0x27, 0x01, 0x5D, 0x4E, 0x21, 0x4C, 0x05, 0xE3, 0x14, 0x40, 0x42, 0x00, 0x00, 0x03,
+    0x01, 0xB1, 0x2E, 0x01, 0xEC, 0x58, 0x61, 0x16, 0x01, 0xE5, 0x48, 0x21, 0x33, 0x05, 0x21, 0x04,
+    0x03, 0x21, 0x2D, 0x03, 0x21, 0x49, 0x03, 0x21, 0x1A, 0x11, 0x21, 0x2D, 0x03, 0xE4, 0x02, 0x1A,
+    0x2A, 0x41, 0x00, 0x00, 0x09, 0x01, 0xEE, 0xA0, 0x00, 0x00, 0x03, 0x01, 0xBB, 0xB9, 0x61, 0x1F,
+    0x01, 0xD4, 0x50, 0xE2, 0x1F, 0x23, 0x01, 0xAD, 0x1E, 0x01, 0xEA, 0xE1, 0x63, 0x01, 0x19, 0x4C,
+    0x01, 0xEE, 0xCC, 0x01, 0xDE, 0xB3, 0x00, 0x00, 0x09, 0x41, 0x40, 0xE6, 0x92, 0x21, 0x04, 0x04,
+    0x21, 0x47, 0x03, 0xE4, 0x17, 0x1B, 0x2D, 0x41, 0x01, 0xEC, 0x53, 0x01, 0xEE, 0xDF, 0x01, 0xEE,
+    0xE2, 0x01, 0x95, 0xED, 0x61, 0x4C, 0x01, 0xB0, 0x8D, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x63,
+    0x18, 0x1A, 0x23, 0x00, 0x00, 0x03, 0x01, 0xD6, 0x79, 0x01, 0xC3, 0xCD, 0x41, 0x15, 0xE9, 0xB1,
+    0x21, 0x19, 0x04, 0x21, 0x23, 0x03, 0x62, 0x15, 0x23, 0x01, 0xE9, 0x88, 0x01, 0xEA, 0xF1, 0x61,
+    0x15, 0x01, 0xD0, 0x60, 0x62, 0x1A, 0x1E, 0x01, 0xEF, 0x24, 0x00, 0x00, 0x05, 0xF3, 0x01, 0x04,
+    0x07, 0x14, 0x15, 0x19, 0x1A, 0x1F, 0x21, 0x23, 0x25, 0x2B, 0x30, 0x40, 0x41, 0x44, 0x47, 0x48,
+    0x49, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xDE, 0x00, 0x4C, 0xD4, 0x00, 0x00, 0xC1, 0x00, 0x00, 0xB3,
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x6F, 0x01, 0xEC, 0xE1, 0x00, 0x00, 0x61, 0x00,
+    0x00, 0x4D, 0x01, 0xE7, 0x32, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1A, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x09, 0x01, 0xEF, 0x23, 0x01, 0xEF, 0x2D, 0x61, 0x34, 0x01, 0xDF, 0xE8, 0x21,
+    0x1F, 0x05, 0x21, 0x34, 0x03, 0xE3, 0x1A, 0x1B, 0x23, 0x01, 0xED, 0x87, 0x01, 0xEF, 0x4C, 0x01,
+    0x73, 0xFA, 0x41, 0x35, 0xED, 0xB1, 0xE6, 0x25, 0x2A, 0x30, 0x48, 0x4A, 0x4B, 0x01, 0xEF, 0x96,
+    0x00, 0x00, 0x04, 0x01, 0xEF, 0x96, 0x01, 0xEF, 0x8C, 0x01, 0xEF, 0x47, 0x01, 0xEF, 0x96, 0x61,
+    0x23, 0x01, 0xE3, 0xDC, 0x61, 0x1C, 0x01, 0xEE, 0xB2, 0x21, 0x01, 0x05, 0x21, 0x1C, 0x03, 0x21,
+    0x1A, 0x03, 0x21, 0x1A, 0x03, 0x61, 0x15, 0x01, 0xE1, 0xBD, 0x21, 0x22, 0x05, 0x21, 0x14, 0x03,
+    0xA2, 0x41, 0x42, 0x0E, 0x03, 0x21, 0x19, 0x05, 0x21, 0x31, 0x03, 0xEB, 0x01, 0x07, 0x1B, 0x1C,
+    0x23, 0x30, 0x44, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0xEF, 0xDB, 0x00, 0x00, 0x45, 0x00, 0x00, 0x2C,
+    0x00, 0x00, 0x03, 0x01, 0xEF, 0xC5, 0x01, 0xEF, 0xDB, 0x01, 0xB9, 0xCC, 0x01, 0xEF, 0xD1, 0x01,
+    0xEF, 0xA2, 0x01, 0xEF, 0x8C, 0x01, 0xEF, 0xDB, 0xE2, 0x19, 0x1C, 0x01, 0xE6, 0xBA, 0x01, 0xEF,
+    0x42, 0xE5, 0x01, 0x07, 0x19, 0x1A, 0x49, 0x01, 0xF0, 0x11, 0x00, 0x00, 0x09, 0x01, 0xF0, 0x11,
+    0x01, 0xF0, 0x11, 0x01, 0xF0, 0x11, 0xE1, 0x2A, 0x01, 0xEF, 0xD7, 0x63, 0x07, 0x19, 0x27, 0x00,
+    0x00, 0x05, 0x01, 0xF0, 0x2B, 0x01, 0xF0, 0x2B, 0x61, 0x08, 0x01, 0xDA, 0xB4, 0xE3, 0x01, 0x0B,
+    0x40, 0x01, 0x6F, 0x97, 0x01, 0xEC, 0xD2, 0x00, 0x00, 0x05, 0x64, 0x14, 0x1A, 0x27, 0x30, 0x01,
+    0xF0, 0x4A, 0x01, 0xF0, 0x4A, 0x01, 0xF0, 0x4A, 0x00, 0x00, 0x0D, 0xEB, 0x0B, 0x14, 0x17, 0x1A,
+    0x21, 0x23, 0x25, 0x30, 0x49, 0x4A, 0x4B, 0x00, 0x00, 0xD9, 0x00, 0x00, 0xD6, 0x01, 0xF0, 0x42,
+    0x01, 0xF0, 0x5B, 0x01, 0xF0, 0x5B, 0x00, 0x00, 0x80, 0x00, 0x00, 0x4A, 0x01, 0xF0, 0x5B, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x11, 0x01, 0xD4, 0xE9, 0xE2, 0x04, 0x25, 0x01, 0xF0, 0x33, 0x01, 0xEC,
+    0x7A, 0xE4, 0x01, 0x17, 0x1C, 0x20, 0x00, 0x2A, 0xC0, 0x01, 0xEF, 0x92, 0x01, 0xEE, 0x6E, 0x00,
+    0x97, 0xE2, 0xE1, 0x28, 0x01, 0xF0, 0x5C, 0xE3, 0x07, 0x30, 0x47, 0x00, 0x00, 0x05, 0x01, 0xF0,
+    0xA7, 0x01, 0xE4, 0x6A, 0x41, 0x19, 0xB1, 0x67, 0xA1, 0x34, 0x04, 0xE3, 0x14, 0x1E, 0x20, 0x00,
+    0x00, 0x03, 0x01, 0xF0, 0xBA, 0x01, 0xED, 0x88, 0x61, 0x07, 0x01, 0xF0, 0x37, 0xE5, 0x15, 0x19,
+    0x27, 0x2B, 0x41, 0x01, 0xF0, 0x94, 0x00, 0x00, 0x12, 0x01, 0xF0, 0xCD, 0x01, 0xE8, 0xD2, 0x00,
+    0x00, 0x05, 0x61, 0x27, 0x01, 0x0B, 0xCD, 0x67, 0x01, 0x07, 0x14, 0x19, 0x25, 0x48, 0x49, 0x01,
+    0xF0, 0xE7, 0x00, 0x00, 0x5F, 0x01, 0xF0, 0xE7, 0x00, 0x00, 0x56, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x1A, 0x00, 0x00, 0x05, 0xE1, 0x2B, 0x01, 0xE8, 0xE3, 0x63, 0x01, 0x07, 0x14, 0x00, 0x00, 0x05,
+    0x01, 0xF1, 0x09, 0x01, 0x77, 0xE1, 0xE1, 0x01, 0x01, 0xE9, 0xCA, 0xE1, 0x1E, 0x01, 0xEA, 0xFC,
+    0xE2, 0x1B, 0x28, 0x01, 0xEF, 0xC8, 0x01, 0xDF, 0x02, 0xE4, 0x28, 0x2A, 0x32, 0x4C, 0x01, 0xDF,
+    0x0B, 0x01, 0x20, 0xBF, 0x01, 0xF1, 0x29, 0x00, 0x00, 0x09, 0x61, 0x34, 0x01, 0x25, 0xCD, 0x21,
+    0x17, 0x05, 0x22, 0x22, 0x40, 0x19, 0x03, 0x62, 0x07, 0x0D, 0x01, 0xF1, 0x47, 0x01, 0xF1, 0x47,
+    0x21, 0x34, 0x09, 0x21, 0x0A, 0x03, 0x21, 0x40, 0x03, 0x62, 0x04, 0x15, 0x01, 0xB4, 0x8A, 0x01,
+    0xD4, 0x06, 0xE6, 0x01, 0x07, 0x0B, 0x14, 0x17, 0x40, 0x01, 0xF1, 0x62, 0x00, 0x00, 0x0C, 0x01,
+    0xF0, 0x63, 0x01, 0xEC, 0xA0, 0x01, 0xEF, 0xB0, 0x00, 0x00, 0x09, 0x41, 0x17, 0x10, 0x89, 0x61,
+    0x23, 0x01, 0xD5, 0x71, 0xA1, 0x1E, 0x05, 0x61, 0x1E, 0x01, 0xA5, 0x11, 0x21, 0x23, 0x05, 0x21,
+    0x23, 0x03, 0xE2, 0x1E, 0x2A, 0x01, 0x60, 0x8C, 0x00, 0x00, 0x03, 0xA1, 0x07, 0x09, 0xE6, 0x01,
+    0x04, 0x27, 0x48, 0x49, 0x4C, 0x01, 0xF1, 0x9E, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1A, 0x00, 0x00,
+    0x03, 0x01, 0xF0, 0x99, 0x01, 0xF1, 0x9E, 0x41, 0x2D, 0x6A, 0xFB, 0x21, 0x42, 0x04, 0x21, 0x34,
+    0x03, 0x41, 0x1F, 0xEC, 0x74, 0x61, 0x19, 0x01, 0xCC, 0xA4, 0x21, 0x34, 0x05, 0x41, 0x25, 0xDA,
+    0x1E, 0x68, 0x07, 0x08, 0x15, 0x17, 0x19, 0x21, 0x30, 0x40, 0x01, 0xF1, 0xD1, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0x01, 0xD9, 0xF1, 0x01, 0xF1, 0xD1, 0x01, 0xF1, 0xD1, 0x00,
+    0x00, 0x04, 0x61, 0x22, 0x01, 0xEF, 0x30, 0x41, 0x40, 0xAB, 0x87, 0x62, 0x01, 0x04, 0x01, 0xF1,
+    0xFB, 0x00, 0x00, 0x04, 0x62, 0x21, 0x31, 0x01, 0xF2, 0x04, 0x01, 0xF0, 0xFF, 0xE5, 0x1C, 0x1F,
+    0x23, 0x27, 0x41, 0x00, 0x00, 0x09, 0x01, 0xF1, 0x0B, 0x01, 0xBB, 0xD1, 0x01, 0xF2, 0x0D, 0x01,
+    0xE4, 0x05, 0xED, 0x04, 0x07, 0x17, 0x19, 0x23, 0x25, 0x27, 0x28, 0x30, 0x41, 0x47, 0x48, 0x49,
+    0x00, 0x01, 0x0C, 0x00, 0x01, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x84, 0x00,
+    0x00, 0x51, 0x01, 0xF2, 0x22, 0x00, 0x00, 0x30, 0x00, 0x57, 0xB9, 0x01, 0xC2, 0x08, 0x00, 0x00,
+    0x27, 0x01, 0xEB, 0x98, 0x00, 0x00, 0x15, 0x64, 0x0B, 0x17, 0x40, 0x42, 0x01, 0xF2, 0x3B, 0x01,
+    0xF2, 0x3B, 0x01, 0xB8, 0xA8, 0x01, 0x9E, 0xC7, 0xE3, 0x0B, 0x15, 0x19, 0x01, 0xF1, 0xA2, 0x00,
+    0xF9, 0xE0, 0x01, 0xEE, 0x86, 0x61, 0x34, 0x01, 0x00, 0x57, 0x61, 0x1F, 0x01, 0xCD, 0x7C, 0x21,
+    0x4C, 0x05, 0x62, 0x25, 0x4C, 0x01, 0x42, 0x37, 0x01, 0xF2, 0x82, 0x22, 0x01, 0x04, 0x0C, 0x09,
+    0x63, 0x07, 0x19, 0x4C, 0x00, 0x00, 0x05, 0x01, 0x8B, 0x47, 0x01, 0xF2, 0x90, 0x41, 0x14, 0x46,
+    0x8F, 0xA1, 0x44, 0x04, 0x64, 0x01, 0x0A, 0x15, 0x23, 0x01, 0xCD, 0x7C, 0x00, 0x00, 0x03, 0x01,
+    0xF2, 0xA4, 0x01, 0xF2, 0x88, 0x6B, 0x01, 0x07, 0x0A, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x30, 0x48,
+    0x49, 0x00, 0x00, 0x5E, 0x01, 0xF2, 0xB5, 0x01, 0xD5, 0x1B, 0x00, 0x00, 0x4D, 0x01, 0xF2, 0xB5,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x25, 0x00, 0x00, 0x11, 0x01, 0xF2, 0xB5, 0x01, 0xF2, 0xB5, 0x01,
+    0xF0, 0xA6, 0x41, 0x32, 0xCD, 0x95, 0x62, 0x0B, 0x17, 0x01, 0xEE, 0xC1, 0x01, 0xEE, 0xC1, 0x62,
+    0x40, 0x44, 0x01, 0x8B, 0xAA, 0x00, 0x00, 0x09, 0x62, 0x31, 0x35, 0x01, 0xF0, 0xE9, 0x00, 0x00,
+    0x09, 0x41, 0x34, 0x6B, 0x6A, 0xA3, 0x01, 0x19, 0x2E, 0x23, 0x0D, 0x04, 0x61, 0x2D, 0x01, 0xD6,
+    0x54, 0x21, 0x17, 0x05, 0x21, 0x19, 0x03, 0x21, 0x34, 0x03, 0x41, 0x40, 0xDD, 0x35, 0x21, 0x2D,
+    0x04, 0x21, 0x04, 0x03, 0x63, 0x2D, 0x40, 0x42, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x01, 0xE2,
+    0xAB, 0x61, 0x23, 0x01, 0xC2, 0x70, 0x21, 0x1E, 0x05, 0x62, 0x34, 0x35, 0x01, 0xF3, 0x00, 0x01,
+    0xE0, 0x1B, 0x61, 0x19, 0x01, 0xD1, 0x8D, 0x63, 0x19, 0x42, 0x44, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x05, 0x01, 0xE6, 0x1E, 0x22, 0x30, 0x32, 0x1E, 0x0D, 0xE5, 0x01, 0x14, 0x1B, 0x21, 0x25, 0x00,
+    0x00, 0x05, 0x01, 0xF2, 0xF3, 0x01, 0xE8, 0x07, 0x01, 0xF0, 0xDC, 0x01, 0xCC, 0xD6, 0x61, 0x0A,
+    0x01, 0xD1, 0xF5, 0x41, 0x34, 0x0A, 0x42, 0x61, 0x15, 0x01, 0xB9, 0xA7, 0x21, 0x21, 0x05, 0x21,
+    0x41, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x18, 0x03, 0x63, 0x0A,
+    0x2A, 0x40, 0x01, 0xF3, 0x72, 0x01, 0xF3, 0x72, 0x00, 0x00, 0x03, 0x61, 0x39, 0x01, 0xB0, 0x73,
+    0x61, 0x04, 0x01, 0x64, 0xDC, 0x21, 0x1F, 0x05, 0x21, 0x41, 0x03, 0x62, 0x08, 0x2D, 0x01, 0x14,
+    0x63, 0x01, 0xF2, 0xB8, 0x21, 0x19, 0x09, 0xE5, 0x08, 0x0A, 0x27, 0x39, 0x40, 0x00, 0x00, 0x1C,
+    0x01, 0xD6, 0x1D, 0x01, 0xF3, 0x59, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE1, 0x34, 0x01, 0xE3,
+    0xA9, 0x61, 0x1B, 0x01, 0xF3, 0x98, 0x21, 0x40, 0x05, 0xA1, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x21,
+    0x31, 0x03, 0xE4, 0x14, 0x1B, 0x27, 0x2A, 0x01, 0xEC, 0xF4, 0x01, 0xF3, 0x8D, 0x00, 0x00, 0x03,
+    0x01, 0xDB, 0x2E, 0x62, 0x07, 0x1A, 0x00, 0x00, 0x11, 0x01, 0xF3, 0xF3, 0xE5, 0x14, 0x19, 0x1B,
+    0x21, 0x40, 0x01, 0xD7, 0xEE, 0x01, 0xD3, 0x5C, 0x01, 0xF1, 0x6C, 0x01, 0xF2, 0xF0, 0x01, 0xCF,
+    0x4C, 0x61, 0x15, 0x01, 0xB6, 0x6B, 0x21, 0x0B, 0x05, 0x21, 0x40, 0x03, 0x21, 0x39, 0x03, 0x21,
+    0x0B, 0x03, 0x21, 0x32, 0x03, 0xA1, 0x0B, 0x03, 0x61, 0x21, 0x01, 0xCF, 0x07, 0x21, 0x34, 0x05,
+    0x21, 0x0B, 0x03, 0x61, 0x42, 0x01, 0xE3, 0xBA, 0x22, 0x01, 0x04, 0x08, 0x05, 0x62, 0x2D, 0x38,
+    0x01, 0xF4, 0x33, 0x00, 0xCD, 0x56, 0x63, 0x38, 0x39, 0x49, 0x01, 0xE3, 0x92, 0x01, 0xF3, 0xB5,
+    0x01, 0xF3, 0xE0, 0x62, 0x23, 0x31, 0x01, 0xB0, 0x4B, 0x01, 0xF4, 0x1A, 0x64, 0x30, 0x31, 0x32,
+    0x48, 0x01, 0xF4, 0x5C, 0x01, 0xF1, 0x29, 0x01, 0xF4, 0x5C, 0x01, 0xF3, 0xF6, 0xE3, 0x21, 0x22,
+    0x49, 0x01, 0xF4, 0x6D, 0x01, 0xED, 0x7F, 0x01, 0xED, 0x7F, 0x61, 0x15, 0x01, 0x10, 0xB6, 0x21,
+    0x32, 0x05, 0x21, 0x1F, 0x03, 0x62, 0x30, 0x34, 0x00, 0x00, 0x03, 0x01, 0xF4, 0x84, 0x21, 0x23,
+    0x09, 0x61, 0x21, 0x01, 0xE9, 0xE3, 0x63, 0x30, 0x34, 0x49, 0x00, 0x00, 0x05, 0x01, 0xF2, 0x87,
+    0x01, 0xF4, 0x30, 0x62, 0x19, 0x22, 0x01, 0xE9, 0xB3, 0x01, 0xF4, 0xA3, 0x21, 0x32, 0x09, 0x65,
+    0x23, 0x2D, 0x30, 0x32, 0x35, 0x01, 0xEE, 0x90, 0x01, 0xF4, 0x60, 0x01, 0x10, 0x6F, 0x01, 0xF3,
+    0xF4, 0x01, 0xF4, 0xAF, 0x61, 0x21, 0x01, 0x81, 0x98, 0x61, 0x2A, 0x01, 0xEF, 0x17, 0x21, 0x07,
+    0x05, 0x21, 0x2D, 0x03, 0x21, 0x48, 0x03, 0x62, 0x19, 0x21, 0x01, 0xC8, 0xD0, 0x01, 0xDC, 0x51,
+    0x63, 0x08, 0x15, 0x23, 0x01, 0xE9, 0x6C, 0x01, 0xF4, 0xD6, 0x01, 0xF4, 0xD6, 0xF6, 0x01, 0x04,
+    0x07, 0x08, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D,
+    0x2E, 0x40, 0x41, 0x43, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xA7, 0x01, 0xF4, 0x92, 0x00, 0x00, 0x9A,
+    0x01, 0xF2, 0xC3, 0x00, 0x00, 0x91, 0x00, 0x00, 0x80, 0x01, 0xF2, 0xEF, 0x01, 0xF1, 0x82, 0x00,
+    0x00, 0x5F, 0x01, 0xF4, 0x9E, 0x01, 0xF2, 0xC3, 0x00, 0x00, 0x57, 0x00, 0x00, 0x41, 0x01, 0xF4,
+    0x27, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x29, 0x01, 0xF2, 0xC3, 0x00, 0x00, 0x19, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x0D, 0x01, 0xF2, 0xBC, 0xE1, 0x48, 0x01, 0xF4, 0xE0, 0xE3, 0x19, 0x27, 0x41, 0x01,
+    0xF5, 0x4B, 0x00, 0x00, 0x05, 0x01, 0x79, 0xBC, 0x71, 0x01, 0x04, 0x07, 0x0A, 0x14, 0x15, 0x17,
+    0x19, 0x23, 0x25, 0x27, 0x2A, 0x30, 0x42, 0x47, 0x48, 0x49, 0x00, 0x02, 0x53, 0x00, 0x02, 0x34,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0xEA, 0x00, 0x01, 0xE5, 0x01, 0xD0, 0x30, 0x00, 0x01, 0xCA, 0x00,
+    0x01, 0xA1, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x65, 0x00, 0x01, 0x5C, 0x00, 0x01, 0x33, 0x01, 0xF5,
+    0x58, 0x01, 0xE4, 0xDF, 0x00, 0x01, 0x20, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x0D, 0xE1, 0x41, 0x01,
+    0xE0, 0x20, 0x61, 0x22, 0x01, 0xDC, 0x12, 0xE2, 0x22, 0x41, 0x01, 0xF5, 0x49, 0x00, 0x00, 0x05,
+    0xE2, 0x04, 0x22, 0x01, 0xF3, 0x86, 0x01, 0xF5, 0x52, 0xE2, 0x07, 0x41, 0x01, 0xF5, 0xB9, 0x01,
+    0xB3, 0xD0, 0x61, 0x14, 0x01, 0xE3, 0xEE, 0x21, 0x32, 0x05, 0xE1, 0x23, 0x01, 0xF3, 0xA0, 0xA2,
+    0x08, 0x1E, 0x08, 0x05, 0xE2, 0x07, 0x21, 0x01, 0xF5, 0xD4, 0x00, 0x00, 0x05, 0x69, 0x01, 0x07,
+    0x1A, 0x21, 0x30, 0x41, 0x47, 0x48, 0x49, 0x00, 0x00, 0x40, 0x00, 0x00, 0x36, 0x00, 0x00, 0x2D,
+    0x01, 0xF5, 0xDD, 0x01, 0xF5, 0xDD, 0x01, 0xE2, 0xBF, 0x01, 0xF1, 0xC5, 0x00, 0x00, 0x24, 0x00,
+    0x00, 0x09, 0x61, 0x04, 0x01, 0xF1, 0x44, 0x41, 0x19, 0xBB, 0x29, 0x21, 0x32, 0x04, 0x61, 0x14,
+    0x01, 0xC4, 0x1C, 0x21, 0x07, 0x05, 0x21, 0x36, 0x03, 0x61, 0x4C, 0x01, 0xBB, 0xEB, 0x21, 0x22,
+    0x05, 0x21, 0x19, 0x03, 0x21, 0x39, 0x03, 0x21, 0x28, 0x03, 0x21, 0x48, 0x03, 0x21, 0x39, 0x03,
+    0xE5, 0x07, 0x14, 0x21, 0x2A, 0x40, 0x00, 0x00, 0x25, 0x00, 0x00, 0x1A, 0x01, 0xF1, 0x6E, 0x00,
+    0x00, 0x03, 0x01, 0xD3, 0x0E, 0x62, 0x2D, 0x32, 0x01, 0xF6, 0x0C, 0x01, 0xF6, 0x45, 0x41, 0x4C,
+    0x11, 0xE6, 0x21, 0x2A, 0x04, 0x21, 0x25, 0x03, 0x21, 0x21, 0x03, 0xE3, 0x23, 0x40, 0x42, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x03, 0x01, 0x08, 0x61, 0x61, 0x40, 0x01, 0x00, 0x1D, 0x21, 0x01, 0x05,
+    0x61, 0x34, 0x01, 0xCA, 0x33, 0x21, 0x2B, 0x05, 0x21, 0x1A, 0x03, 0x21, 0x35, 0x03, 0x21, 0x25,
+    0x03, 0x61, 0x14, 0x01, 0xEF, 0x93, 0x21, 0x2D, 0x05, 0x62, 0x02, 0x2A, 0x01, 0xDA, 0x7B, 0x00,
+    0x00, 0x03, 0x21, 0x19, 0x09, 0x61, 0x1A, 0x01, 0xCB, 0x2A, 0x22, 0x34, 0x35, 0x08, 0x05, 0x41,
+    0x22, 0x8A, 0x6F, 0x21, 0x2D, 0x04, 0x21, 0x25, 0x03, 0x61, 0x19, 0x01, 0x49, 0xFB, 0x21, 0x31,
+    0x05, 0x61, 0x08, 0x01, 0xC4, 0x17, 0x21, 0x2D, 0x05, 0x21, 0x37, 0x03, 0x21, 0x25, 0x03, 0x41,
+    0x2B, 0x4D, 0xAA, 0x21, 0x27, 0x04, 0x21, 0x22, 0x03, 0x21, 0x49, 0x03, 0x21, 0x35, 0x03, 0x22,
+    0x01, 0x02, 0x13, 0x03, 0x61, 0x2B, 0x01, 0xDC, 0x66, 0x21, 0x22, 0x05, 0xE7, 0x01, 0x07, 0x14,
+    0x1E, 0x1F, 0x40, 0x43, 0x00, 0x00, 0x5E, 0x01, 0xF6, 0xDC, 0x00, 0x00, 0x42, 0x00, 0x00, 0x36,
+    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x41, 0x41, 0x4A, 0xE6, 0x63, 0x07, 0x19,
+    0x27, 0x01, 0xF6, 0xFD, 0x00, 0x00, 0x04, 0x01, 0xF6, 0xFD, 0xED, 0x01, 0x04, 0x07, 0x0B, 0x14,
+    0x1F, 0x21, 0x25, 0x30, 0x40, 0x47, 0x48, 0x49, 0x01, 0xD6, 0x3E, 0x00, 0x01, 0x08, 0x00, 0x00,
+    0xDA, 0x01, 0xDF, 0xDA, 0x01, 0xF7, 0x0A, 0x00, 0xC9, 0x8D, 0x00, 0x00, 0xAF, 0x01, 0xF5, 0xE8,
+    0x01, 0xF7, 0x0A, 0x01, 0xF0, 0x6F, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0D, 0xE2,
+    0x27, 0x42, 0x01, 0xEC, 0x91, 0x01, 0xD5, 0x87, 0x61, 0x40, 0x01, 0x95, 0x8B, 0x41, 0x32, 0x05,
+    0x88, 0xE3, 0x0B, 0x14, 0x17, 0x01, 0xF3, 0x6F, 0x01, 0xF7, 0x35, 0x00, 0x00, 0x04, 0x61, 0x14,
+    0x01, 0xF3, 0x32, 0x21, 0x42, 0x05, 0x21, 0x32, 0x03, 0xA1, 0x23, 0x03, 0x61, 0x1A, 0x01, 0xC0,
+    0x20, 0x21, 0x42, 0x05, 0x21, 0x23, 0x03, 0x21, 0x1E, 0x03, 0x21, 0x42, 0x03, 0x62, 0x01, 0x1A,
+    0x01, 0x11, 0xED, 0x01, 0xF7, 0x7D, 0xE2, 0x01, 0x44, 0x01, 0xF7, 0x86, 0x01, 0xF7, 0x73, 0xE2,
+    0x07, 0x27, 0x01, 0xF7, 0x8F, 0x00, 0x00, 0x09, 0xEB, 0x01, 0x04, 0x07, 0x15, 0x19, 0x1A, 0x21,
+    0x30, 0x47, 0x48, 0x49, 0x00, 0x00, 0x59, 0x00, 0x00, 0x50, 0x01, 0xF7, 0x98, 0x01, 0x05, 0x30,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1E, 0x01, 0xF7, 0x98, 0x00, 0x00, 0x1B, 0x01,
+    0x0E, 0xBA, 0x00, 0x00, 0x09, 0xE2, 0x25, 0x27, 0x01, 0x46, 0x5D, 0x01, 0xF7, 0xBB, 0x61, 0x39,
+    0x01, 0x88, 0x02, 0x61, 0x4A, 0x01, 0x99, 0xAD, 0x21, 0x01, 0x05, 0xE3, 0x04, 0x14, 0x42, 0x00,
+    0x00, 0x0D, 0x01, 0xF7, 0x75, 0x00, 0x00, 0x03, 0x61, 0x1E, 0x01, 0xF6, 0xF5, 0xA1, 0x44, 0x05,
+    0x62, 0x31, 0x32, 0x01, 0xF3, 0xD8, 0x01, 0x55, 0xD0, 0xA1, 0x27, 0x09, 0x61, 0x22, 0x01, 0xD7,
+    0xC2, 0x21, 0x35, 0x05, 0x21, 0x25, 0x03, 0xE2, 0x15, 0x44, 0x01, 0xF7, 0xA1, 0x01, 0xF7, 0x02,
+    0x62, 0x19, 0x27, 0x00, 0x00, 0x09, 0x01, 0xF8, 0x10, 0x6E, 0x01, 0x04, 0x07, 0x14, 0x15, 0x19,
+    0x1A, 0x21, 0x25, 0x27, 0x30, 0x40, 0x48, 0x49, 0x00, 0x7F, 0xD7, 0x01, 0x45, 0x93, 0x01, 0x4B,
+    0xE9, 0x00, 0x00, 0x54, 0x01, 0xF7, 0xD3, 0x00, 0x00, 0x3E, 0x00, 0x45, 0x47, 0x00, 0x00, 0x2C,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x20, 0x01, 0xF8, 0x19, 0x00, 0x00, 0x15, 0x00, 0x00, 0x09, 0x01,
+    0xF2, 0x6E, 0x61, 0x07, 0x01, 0x97, 0xEE, 0x21, 0x48, 0x05, 0x21, 0x31, 0x03, 0x62, 0x23, 0x36,
+    0x01, 0xF7, 0x97, 0x01, 0xD8, 0x96, 0x62, 0x23, 0x38, 0x01, 0xE7, 0xAE, 0x01, 0x68, 0x3B, 0xE7,
+    0x08, 0x14, 0x17, 0x21, 0x28, 0x2D, 0x41, 0x01, 0xD3, 0x02, 0x01, 0xDF, 0xBB, 0x01, 0xF7, 0x63,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0x01, 0x82, 0x57, 0xE1, 0x2D, 0x01, 0xEE,
+    0x4C, 0xA1, 0x07, 0x05, 0x61, 0x21, 0x01, 0xA4, 0xD8, 0x62, 0x01, 0x19, 0x01, 0xF8, 0x53, 0x01,
+    0x47, 0x6A, 0xE2, 0x32, 0x4C, 0x00, 0x00, 0x09, 0x01, 0xF8, 0xA2, 0xE6, 0x01, 0x07, 0x22, 0x23,
+    0x2A, 0x32, 0x01, 0xF8, 0x4D, 0x01, 0x90, 0xB0, 0x00, 0x00, 0x09, 0x01, 0xC2, 0x6F, 0x01, 0xAE,
+    0x5C, 0x01, 0xF8, 0xAB, 0xE2, 0x14, 0x2A, 0x01, 0xF1, 0xD6, 0x01, 0xF7, 0x8C, 0xE1, 0x02, 0x01,
+    0xF8, 0x94, 0x63, 0x01, 0x07, 0x30, 0x01, 0xF8, 0xD2, 0x00, 0x00, 0x05, 0x01, 0xF8, 0xD2, 0x62,
+    0x01, 0x49, 0x01, 0xF8, 0xDF, 0x01, 0xF8, 0xD5, 0x61, 0x07, 0x01, 0xC6, 0x27, 0x61, 0x07, 0x01,
+    0xC2, 0x5E, 0xE1, 0x21, 0x01, 0xF4, 0x30, 0xEF, 0x01, 0x07, 0x14, 0x15, 0x19, 0x1A, 0x21, 0x22,
+    0x23, 0x25, 0x27, 0x2D, 0x30, 0x48, 0x49, 0x01, 0xF8, 0xF7, 0x00, 0x00, 0x88, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x63, 0x00, 0x00, 0x4C, 0x01, 0xEF, 0x6B, 0x00, 0x00, 0x33, 0x00, 0x00, 0x25, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0A, 0x01, 0xF8, 0xF6, 0x01, 0xF8, 0xF7, 0x01, 0xF8,
+    0xF7, 0x00, 0x00, 0x05, 0xE2, 0x04, 0x1B, 0x01, 0xEE, 0xF4, 0x01, 0xF9, 0x30, 0xE3, 0x19, 0x41,
+    0x48, 0x01, 0xF9, 0x3D, 0x01, 0x32, 0x20, 0x01, 0xF3, 0x92, 0xE3, 0x07, 0x1A, 0x21, 0x01, 0xC6,
+    0x89, 0x01, 0xF9, 0x4A, 0x01, 0xF9, 0x4A, 0xE2, 0x30, 0x48, 0x01, 0xF9, 0x57, 0x01, 0x9D, 0x20,
+    0xE4, 0x07, 0x21, 0x30, 0x48, 0x01, 0xF9, 0x60, 0x01, 0xF9, 0x60, 0x01, 0xF9, 0x60, 0x01, 0xF3,
+    0xB5, 0xE1, 0x25, 0x01, 0xDC, 0x91, 0x61, 0x34, 0x01, 0x60, 0x10, 0x21, 0x2A, 0x05, 0xE3, 0x04,
+    0x07, 0x17, 0x01, 0xF7, 0x6F, 0x01, 0xF1, 0xD7, 0x01, 0xF8, 0x72, 0x41, 0x42, 0x1D, 0xAC, 0x21,
+    0x21, 0x04, 0x21, 0x2D, 0x03, 0x21, 0x48, 0x03, 0x21, 0x37, 0x03, 0x21, 0x2A, 0x03, 0xA1, 0x40,
+    0x03, 0xE2, 0x07, 0x43, 0x00, 0x00, 0x03, 0x01, 0xF9, 0x68, 0xE6, 0x01, 0x07, 0x19, 0x21, 0x30,
+    0x48, 0x00, 0x00, 0x39, 0x00, 0x00, 0x2F, 0x01, 0xF9, 0xAA, 0x00, 0x00, 0x2C, 0x01, 0xF9, 0xAA,
+    0x00, 0x00, 0x09, 0xE5, 0x01, 0x14, 0x19, 0x30, 0x48, 0x01, 0xF9, 0xC3, 0x01, 0xF9, 0xC3, 0x01,
+    0xF9, 0xC3, 0x01, 0xF9, 0xC3, 0x01, 0xF9, 0xB9, 0xE2, 0x07, 0x41, 0x01, 0xF9, 0xD8, 0x01, 0xAD,
+    0x26, 0xEB, 0x01, 0x07, 0x19, 0x1A, 0x21, 0x22, 0x25, 0x27, 0x30, 0x48, 0x49, 0x00, 0x00, 0xAD,
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x97, 0x01, 0xF9, 0xE1, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x81, 0x00,
+    0x00, 0x37, 0x00, 0x00, 0x1E, 0x01, 0xF9, 0xE1, 0x00, 0x00, 0x09, 0x01, 0xE5, 0x65, 0x61, 0x19,
+    0x01, 0xC2, 0xC2, 0x62, 0x40, 0x42, 0x01, 0xCE, 0xDD, 0x00, 0x00, 0x05, 0x21, 0x34, 0x09, 0xE3,
+    0x0B, 0x17, 0x44, 0x01, 0x49, 0xD4, 0x00, 0x00, 0x03, 0x00, 0xC1, 0x0C, 0x61, 0x35, 0x01, 0xD8,
+    0x77, 0x21, 0x25, 0x05, 0x61, 0x25, 0x01, 0x9A, 0x7B, 0x21, 0x34, 0x05, 0x62, 0x01, 0x04, 0x00,
+    0x00, 0x03, 0x01, 0x92, 0x9E, 0x22, 0x01, 0x40, 0x14, 0x09, 0x61, 0x1A, 0x01, 0xF9, 0xFB, 0x21,
+    0x41, 0x05, 0x21, 0x32, 0x03, 0x21, 0x01, 0x03, 0x61, 0x32, 0x01, 0x82, 0x71, 0x21, 0x1A, 0x05,
+    0x21, 0x32, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x2A, 0x03, 0x21, 0x34, 0x03, 0x61, 0x25, 0x01, 0xDC,
+    0xFC, 0x21, 0x31, 0x05, 0x21, 0x23, 0x03, 0x21, 0x34, 0x03, 0x61, 0x14, 0x01, 0xC3, 0x14, 0xE5,
+    0x14, 0x21, 0x27, 0x40, 0x46, 0x00, 0x00, 0x16, 0x00, 0x00, 0x08, 0x00, 0x19, 0xF1, 0x00, 0x00,
+    0x05, 0x01, 0xFA, 0x7F, 0x61, 0x34, 0x01, 0x93, 0x1E, 0x21, 0x1A, 0x05, 0x21, 0x34, 0x03, 0x21,
+    0x23, 0x03, 0x41, 0x15, 0xB2, 0x92, 0x21, 0x19, 0x04, 0x21, 0x25, 0x03, 0x22, 0x17, 0x41, 0x0D,
+    0x03, 0x62, 0x2D, 0x32, 0x01, 0xE7, 0x93, 0x01, 0xDF, 0x9F, 0x61, 0x39, 0x01, 0xD9, 0x05, 0x21,
+    0x25, 0x05, 0x64, 0x23, 0x32, 0x35, 0x4C, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x00, 0xD5, 0x75,
+    0x01, 0xFA, 0xC2, 0x61, 0x34, 0x01, 0x03, 0x7E, 0x21, 0x15, 0x05, 0x21, 0x01, 0x03, 0x21, 0x4C,
+    0x03, 0x21, 0x23, 0x03, 0x61, 0x2D, 0x01, 0xC5, 0x8A, 0x61, 0x32, 0x01, 0x5B, 0xC8, 0x61, 0x2A,
+    0x01, 0x91, 0xF8, 0x21, 0x34, 0x05, 0x21, 0x25, 0x03, 0x61, 0x15, 0x01, 0x5A, 0x4B, 0x21, 0x01,
+    0x05, 0x21, 0x47, 0x03, 0x21, 0x25, 0x03, 0x21, 0x40, 0x03, 0x21, 0x34, 0x03, 0x61, 0x21, 0x01,
+    0xCF, 0x70, 0x66, 0x1A, 0x1B, 0x25, 0x2D, 0x40, 0x42, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x29, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x08, 0x01, 0xAC, 0xCA, 0x00, 0x00, 0x05, 0x62, 0x01, 0x49, 0x01, 0xFA,
+    0x22, 0x01, 0xFB, 0x2B, 0x23, 0x32, 0x34, 0x35, 0x53, 0x22, 0x09, 0x62, 0x01, 0x21, 0x01, 0xF7,
+    0x0F, 0x01, 0xCF, 0x9E, 0x21, 0x42, 0x09, 0x21, 0x34, 0x03, 0x61, 0x21, 0x01, 0xBE, 0x54, 0x21,
+    0x40, 0x05, 0x41, 0x19, 0x17, 0x41, 0x61, 0x34, 0x01, 0xB9, 0x3D, 0x21, 0x1F, 0x05, 0x21, 0x17,
+    0x03, 0x41, 0x2E, 0x72, 0xF2, 0x27, 0x14, 0x15, 0x17, 0x34, 0x41, 0x42, 0x44, 0xA3, 0x31, 0x1E,
+    0x16, 0x13, 0x07, 0x04, 0xE3, 0x2D, 0x32, 0x41, 0x01, 0xF7, 0x92, 0x01, 0x9B, 0xEF, 0x01, 0x5D,
+    0xF3, 0x61, 0x40, 0x01, 0x93, 0x37, 0x21, 0x34, 0x05, 0x21, 0x25, 0x03, 0xE2, 0x1E, 0x40, 0x00,
+    0x00, 0x03, 0x01, 0x1C, 0xFC, 0x61, 0x1E, 0x01, 0x20, 0x37, 0x22, 0x1E, 0x40, 0x11, 0x05, 0xE2,
+    0x01, 0x43, 0x01, 0xF4, 0xFD, 0x01, 0xB9, 0xB6, 0x21, 0x32, 0x09, 0x21, 0x01, 0x03, 0x21, 0x34,
+    0x03, 0x21, 0x23, 0x03, 0x41, 0x34, 0x73, 0xBE, 0x21, 0x25, 0x04, 0x61, 0x34, 0x01, 0x26, 0x69,
+    0x62, 0x2A, 0x44, 0x00, 0xFE, 0x8A, 0x01, 0xEE, 0x97, 0x21, 0x19, 0x09, 0x21, 0x2D, 0x03, 0x21,
+    0x0B, 0x03, 0x61, 0x23, 0x01, 0xEE, 0xA9, 0x21, 0x41, 0x05, 0x67, 0x1A, 0x1F, 0x21, 0x30, 0x34,
+    0x41, 0x42, 0x00, 0x00, 0x22, 0x00, 0x00, 0x1F, 0x01, 0x4D, 0x3A, 0x00, 0x00, 0x0B, 0x00, 0x00,
+    0x03, 0x00, 0x9A, 0x86, 0x00, 0x0E, 0x98, 0x61, 0x0B, 0x01, 0xFA, 0x7F, 0x21, 0x42, 0x05, 0x63,
+    0x34, 0x48, 0x4C, 0x00, 0x00, 0x03, 0x01, 0xF9, 0xF0, 0x01, 0xFB, 0xFF, 0x61, 0x1A, 0x01, 0xEB,
+    0xB1, 0x21, 0x41, 0x05, 0x62, 0x08, 0x1A, 0x01, 0xB9, 0xA2, 0x01, 0xDB, 0xEF, 0x69, 0x01, 0x08,
+    0x1F, 0x21, 0x25, 0x30, 0x40, 0x42, 0x44, 0x00, 0x2F, 0x9B, 0x01, 0xB8, 0xF2, 0x01, 0xFB, 0xB7,
+    0x01, 0xE1, 0x05, 0x01, 0x94, 0xBC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x01, 0xBC, 0xB8, 0x01,
+    0xD8, 0x2E, 0x41, 0x32, 0x47, 0x4B, 0x61, 0x31, 0x01, 0xC4, 0xFE, 0x61, 0x17, 0x01, 0xDB, 0x90,
+    0x21, 0x2A, 0x05, 0x21, 0x1A, 0x03, 0x61, 0x1E, 0x01, 0x95, 0x65, 0x24, 0x17, 0x1F, 0x40, 0x44,
+    0x19, 0x15, 0x08, 0x05, 0x62, 0x27, 0x31, 0x01, 0xFB, 0xA9, 0x01, 0xFC, 0x15, 0x61, 0x17, 0x01,
+    0xBE, 0x02, 0x62, 0x21, 0x23, 0x00, 0x00, 0x05, 0x01, 0xFC, 0x1D, 0x61, 0x1A, 0x01, 0xC2, 0xAB,
+    0x62, 0x19, 0x23, 0x01, 0xFC, 0x31, 0x00, 0x00, 0x05, 0x41, 0x2E, 0xDC, 0xE1, 0x21, 0x44, 0x04,
+    0x21, 0x25, 0x03, 0x21, 0x0B, 0x03, 0x21, 0x40, 0x03, 0x41, 0x19, 0x0D, 0x7A, 0x21, 0x27, 0x04,
+    0x21, 0x41, 0x03, 0x63, 0x01, 0x04, 0x14, 0x00, 0x00, 0x0D, 0x01, 0xC5, 0x07, 0x00, 0x00, 0x03,
+    0x63, 0x07, 0x19, 0x27, 0x01, 0xFC, 0xB0, 0x01, 0xE6, 0x2A, 0x01, 0xFC, 0xB0, 0x61, 0x21, 0x01,
+    0xF7, 0xC4, 0x21, 0x41, 0x05, 0xE3, 0x07, 0x14, 0x21, 0x00, 0x00, 0x03, 0x01, 0xFC, 0xC5, 0x01,
+    0xFC, 0xC5, 0x62, 0x04, 0x14, 0x01, 0xBE, 0x76, 0x01, 0xFC, 0xD2, 0xF8, 0x01, 0x07, 0x0A, 0x14,
+    0x15, 0x19, 0x1A, 0x1B, 0x1E, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x40, 0x42, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x00, 0x02, 0xBC, 0x00, 0x02, 0x96, 0x00, 0x02, 0x86, 0x00, 0x02, 0x5C,
+    0x00, 0x02, 0x2F, 0x00, 0x01, 0x76, 0x00, 0x01, 0x67, 0x00, 0x01, 0x4F, 0x00, 0x01, 0x41, 0x00,
+    0x01, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x00, 0xDC, 0x00, 0x00, 0xBE, 0x01, 0xFC, 0xDB, 0x00, 0x00,
+    0x80, 0x01, 0x2D, 0x58, 0x00, 0x00, 0x77, 0x00, 0x00, 0x69, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x16, 0x00, 0x00, 0x09, 0x01, 0xFC, 0xDB, 0x41, 0x14, 0xCF, 0x83,
+    0x41, 0x49, 0xA1, 0xD3, 0x21, 0x35, 0x04, 0x21, 0x1B, 0x03, 0x41, 0x4C, 0x06, 0x02, 0x21, 0x23,
+    0x04, 0x21, 0x2D, 0x03, 0x21, 0x1A, 0x03, 0xA1, 0x40, 0x03, 0x41, 0x2A, 0xDD, 0xB2, 0x21, 0x34,
+    0x04, 0x21, 0x23, 0x03, 0x21, 0x4C, 0x03, 0xC1, 0x36, 0x1B, 0xA7, 0xA1, 0x01, 0x04, 0xE8, 0x01,
+    0x19, 0x1B, 0x1F, 0x21, 0x23, 0x30, 0x48, 0x00, 0x06, 0x26, 0x00, 0x00, 0x32, 0x00, 0x00, 0x27,
+    0x01, 0xD2, 0x35, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0A, 0x01, 0xFD, 0x6E, 0x00, 0x00, 0x03, 0x5C,
+    0x01, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x2B, 0x2D, 0x2E, 0x16, 0xF6, 0x16, 0x8F,
+    0x14, 0xF7, 0x14, 0xA9, 0x14, 0x0B, 0x13, 0xB1, 0x13, 0x3D, 0x12, 0x85, 0x11, 0xFE, 0x11, 0x41,
+    0x10, 0xD5, 0x10, 0x12, 0x0F, 0x6B, 0x0E, 0x62, 0x0D, 0x34, 0x0C, 0xA8, 0x0C, 0x86, 0x0B, 0x6D,
+    0x0A, 0xDA, 0x08, 0x37, 0x07, 0xB2, 0x06, 0x85, 0x05, 0xF7, 0x05, 0x76, 0x04, 0x98, 0x03, 0xAE,
+    0x00, 0xB4, 0x00, 0x21, 0x61, 0x25, 0x01, 0xEC, 0x35, 0x61, 0x01, 0x01, 0xFD, 0xE8, 0xE3, 0x19,
+    0x34, 0x40, 0x01, 0x7C, 0xB9, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x05, 0xE2, 0x01, 0x42, 0x01, 0xA3,
+    0x3D, 0x01, 0xFD, 0x79, 0xE2, 0x19, 0x32, 0x01, 0xFE, 0x04, 0x01, 0xFE, 0x04, 0x21, 0x08, 0x09,
+    0xE3, 0x2A, 0x2B, 0x32, 0x01, 0xFD, 0xBB, 0x01, 0xF5, 0xEF, 0x01, 0xEA, 0xF2, 0x41, 0x1A, 0xFD,
+    0xFC, 0x62, 0x32, 0x44, 0x00, 0x00, 0x04, 0x01, 0xFB, 0x13, 0x41, 0x34, 0x7C, 0x84, 0x62, 0x25,
+    0x38, 0x01, 0xFE, 0x2E, 0x01, 0xFC, 0x30, 0xE2, 0x18, 0x1E, 0x01, 0xFC, 0xFF, 0x01, 0xE4, 0xAB,
+    0xE2, 0x02, 0x32, 0x01, 0xFE, 0x40, 0x01, 0xFE, 0x40, 0x6D, 0x01, 0x07, 0x0D, 0x14, 0x15, 0x18,
+    0x1E, 0x21, 0x22, 0x28, 0x48, 0x49, 0x4B, 0x00, 0x00, 0x12, 0x01, 0xFE, 0x49, 0x01, 0xFC, 0x18,
+    0x01, 0xFE, 0x49, 0x01, 0x0B, 0x11, 0x00, 0x00, 0x09, 0x01, 0xFE, 0x49, 0x01, 0xFE, 0x49, 0x01,
+    0xFE, 0x49, 0x01, 0xFE, 0x49, 0x01, 0xFE, 0x3F, 0x01, 0xFE, 0x49, 0x01, 0xFE, 0x10, 0x67, 0x01,
+    0x07, 0x14, 0x19, 0x1A, 0x32, 0x4C, 0x01, 0x37, 0x13, 0x01, 0xFE, 0x7E, 0x01, 0xFE, 0x62, 0x01,
+    0xFE, 0x7E, 0x01, 0xBE, 0xD5, 0x01, 0xD0, 0xF0, 0x01, 0xFE, 0x7E, 0xE1, 0x25, 0x01, 0xD8, 0xC9,
+    0xE3, 0x21, 0x22, 0x35, 0x01, 0xFE, 0xA0, 0x01, 0xFE, 0xA0, 0x01, 0xEC, 0x38, 0x61, 0x21, 0x01,
+    0x58, 0x5F, 0xE5, 0x19, 0x31, 0x34, 0x35, 0x38, 0x01, 0xFE, 0xB2, 0x01, 0xE1, 0xFA, 0x01, 0xD9,
+    0x48, 0x01, 0xEC, 0x4A, 0x00, 0x00, 0x05, 0x63, 0x01, 0x23, 0x27, 0x01, 0xFE, 0xC7, 0x01, 0xB5,
+    0x4E, 0x01, 0xFE, 0x61, 0x63, 0x19, 0x23, 0x28, 0x01, 0xFE, 0xD4, 0x01, 0xFE, 0x6E, 0x01, 0xFE,
+    0xD4, 0x21, 0x21, 0x0D, 0x61, 0x42, 0x01, 0xEB, 0xC6, 0x21, 0x01, 0x05, 0x21, 0x42, 0x03, 0x63,
+    0x01, 0x0B, 0x23, 0x01, 0xFE, 0x70, 0x01, 0xFE, 0xEF, 0x00, 0x00, 0x03, 0x61, 0x41, 0x01, 0xF4,
+    0xBC, 0x63, 0x14, 0x25, 0x2A, 0x00, 0x00, 0x05, 0x01, 0xFF, 0x01, 0x01, 0xFE, 0x46, 0x61, 0x42,
+    0x01, 0xD5, 0xA5, 0xE2, 0x07, 0x40, 0x00, 0x00, 0x05, 0x01, 0x37, 0xF6, 0xFB, 0x01, 0x07, 0x0D,
+    0x0F, 0x10, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1B, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29,
+    0x2A, 0x2B, 0x40, 0x42, 0x44, 0x48, 0x49, 0x4B, 0x00, 0x01, 0x2E, 0x00, 0x01, 0x21, 0x00, 0x01,
+    0x0F, 0x01, 0xEA, 0x56, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x1C, 0x01, 0xFC, 0xF9, 0x00, 0x00, 0xFB,
+    0x01, 0xFE, 0xF7, 0x01, 0xC5, 0x4C, 0x01, 0xFF, 0x1C, 0x00, 0x00, 0xF2, 0x00, 0x00, 0xEE, 0x01,
+    0xFF, 0x1C, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x9E, 0x01, 0x9A, 0x7F, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1B,
+    0x01, 0x16, 0x3E, 0x00, 0x00, 0x09, 0x01, 0xE5, 0xAD, 0x61, 0x08, 0x01, 0xD4, 0x57, 0xA1, 0x40,
+    0x05, 0xE2, 0x07, 0x14, 0x01, 0xFF, 0x91, 0x01, 0xFF, 0x91, 0x64, 0x01, 0x07, 0x14, 0x48, 0x01,
+    0xFF, 0x9A, 0x01, 0xFF, 0x9A, 0x01, 0xFF, 0x9A, 0x01, 0xFF, 0x90, 0xE8, 0x01, 0x07, 0x14, 0x19,
+    0x21, 0x22, 0x25, 0x48, 0x01, 0xFF, 0xAB, 0x00, 0x00, 0x1D, 0x01, 0xFF, 0xAB, 0x01, 0xFA, 0x00,
+    0x00, 0x00, 0x1A, 0x00, 0x00, 0x11, 0x01, 0x85, 0x52, 0x01, 0xFF, 0xA1, 0xE4, 0x1B, 0x21, 0x2A,
+    0x42, 0x01, 0xCE, 0x9B, 0x01, 0xFB, 0x0A, 0x01, 0x8C, 0x98, 0x01, 0x1C, 0x1C, 0x61, 0x23, 0x01,
+    0x16, 0x66, 0xE4, 0x21, 0x2A, 0x2D, 0x32, 0x01, 0xFF, 0xE2, 0x01, 0xD7, 0xA9, 0x01, 0xFF, 0xA9,
+    0x01, 0x20, 0xD5, 0x62, 0x15, 0x44, 0x01, 0xFF, 0xD7, 0x01, 0xC6, 0xA6, 0x21, 0x25, 0x09, 0x63,
+    0x2D, 0x32, 0x38, 0x00, 0x00, 0x03, 0x01, 0xFF, 0xA1, 0x01, 0xFF, 0x4A, 0x61, 0x1C, 0x01, 0xE5,
+    0x36, 0xE4, 0x25, 0x31, 0x39, 0x48, 0x01, 0xFC, 0x03, 0x01, 0xFF, 0x56, 0x01, 0xFF, 0x5C, 0x01,
+    0xFF, 0xAB, 0xE2, 0x01, 0x2A, 0x01, 0xFE, 0xEA, 0x01, 0xD6, 0xDE, 0x61, 0x14, 0x01, 0xC8, 0xDF,
+    0x21, 0x42, 0x05, 0x21, 0x34, 0x03, 0x61, 0x0A, 0x01, 0xE2, 0x43, 0x21, 0x40, 0x05, 0x63, 0x0A,
+    0x21, 0x2D, 0x01, 0xE0, 0x08, 0x01, 0xD5, 0x0C, 0x00, 0x00, 0x03, 0x61, 0x42, 0x01, 0x96, 0x6E,
+    0x21, 0x21, 0x05, 0x6D, 0x01, 0x04, 0x07, 0x0B, 0x21, 0x2A, 0x31, 0x32, 0x33, 0x40, 0x42, 0x44,
+    0x48, 0x02, 0x00, 0x53, 0x01, 0x90, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x20, 0x02, 0x00, 0x53,
+    0x02, 0x00, 0x53, 0x01, 0xBD, 0xD4, 0x01, 0xE3, 0x9B, 0x02, 0x00, 0x53, 0x00, 0x00, 0x15, 0x00,
+    0x00, 0x03, 0x00, 0xC7, 0x40, 0x02, 0x00, 0x49, 0xE1, 0x40, 0x01, 0xC6, 0xBF, 0xE1, 0x19, 0x01,
+    0xE9, 0x5D, 0x62, 0x19, 0x21, 0x02, 0x00, 0x92, 0x01, 0x9A, 0xA0, 0x64, 0x1A, 0x40, 0x42, 0x44,
+    0x01, 0xBE, 0xB6, 0x01, 0x9A, 0xAD, 0x01, 0xFC, 0x83, 0x01, 0xDC, 0xAC, 0x21, 0x21, 0x11, 0xA4,
+    0x07, 0x19, 0x2D, 0x31, 0x27, 0x22, 0x1D, 0x03, 0x62, 0x15, 0x34, 0x02, 0x00, 0x52, 0x01, 0xCF,
+    0x1B, 0x61, 0x4C, 0x01, 0xC3, 0x97, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x1E, 0x03, 0x21,
+    0x40, 0x03, 0x61, 0x40, 0x01, 0xBE, 0x8F, 0x21, 0x34, 0x05, 0x21, 0x14, 0x03, 0x21, 0x4C, 0x03,
+    0x22, 0x1E, 0x23, 0x11, 0x03, 0x21, 0x2D, 0x05, 0x41, 0x41, 0x4B, 0x13, 0x61, 0x2E, 0x01, 0x1E,
+    0x65, 0x21, 0x40, 0x05, 0x21, 0x19, 0x03, 0x65, 0x04, 0x0B, 0x1B, 0x25, 0x27, 0x02, 0x00, 0xBE,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x01, 0xC1, 0x3E, 0x01, 0xBE, 0xDE, 0x62, 0x19, 0x2D, 0x01,
+    0xFC, 0xE7, 0x02, 0x00, 0x19, 0x21, 0x08, 0x09, 0x21, 0x40, 0x03, 0x21, 0x19, 0x03, 0x21, 0x17,
+    0x03, 0x62, 0x04, 0x19, 0x02, 0x01, 0x21, 0x02, 0x00, 0xBB, 0x61, 0x23, 0x01, 0x77, 0x42, 0x64,
+    0x01, 0x21, 0x23, 0x25, 0x01, 0xEE, 0x11, 0x01, 0x06, 0xE8, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05,
+    0x62, 0x0B, 0x1E, 0x01, 0xF6, 0xD6, 0x02, 0x00, 0xFA, 0x64, 0x01, 0x07, 0x0A, 0x14, 0x02, 0x01,
+    0x49, 0x02, 0x01, 0x49, 0x02, 0x01, 0x49, 0x02, 0x01, 0x49, 0xF6, 0x01, 0x04, 0x08, 0x0A, 0x0B,
+    0x14, 0x15, 0x18, 0x19, 0x1A, 0x1B, 0x21, 0x23, 0x25, 0x27, 0x2D, 0x40, 0x41, 0x42, 0x44, 0x48,
+    0x49, 0x00, 0x01, 0x8E, 0x01, 0x87, 0xF0, 0x02, 0x01, 0x14, 0x02, 0x01, 0x5A, 0x02, 0x00, 0x5B,
+    0x02, 0x01, 0x5A, 0x00, 0x01, 0x7D, 0x02, 0x00, 0xF4, 0x00, 0x01, 0x78, 0x00, 0x01, 0x5B, 0x00,
+    0x01, 0x4E, 0x00, 0x01, 0x49, 0x00, 0x01, 0x07, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xA2, 0x00, 0x00,
+    0x75, 0x00, 0x00, 0x63, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x1A, 0x01, 0xFA, 0xD0,
+    0x00, 0x00, 0x11, 0x61, 0x0A, 0x01, 0xB0, 0xF0, 0x21, 0x40, 0x05, 0x21, 0x19, 0x03, 0x21, 0x27,
+    0x03, 0xA1, 0x0A, 0x03, 0x21, 0x32, 0x03, 0xE4, 0x01, 0x13, 0x30, 0x34, 0x02, 0x01, 0xC7, 0x00,
+    0x00, 0x03, 0x02, 0x01, 0xC7, 0x01, 0x8F, 0x4A, 0x42, 0x23, 0x29, 0x29, 0xD2, 0x00, 0x11, 0xE1,
+    0x40, 0x01, 0xB9, 0x46, 0xE1, 0x40, 0x01, 0xB9, 0x5D, 0x61, 0x07, 0x02, 0x01, 0xB0, 0xA1, 0x40,
+    0x05, 0x62, 0x40, 0x46, 0x01, 0xFD, 0x63, 0x02, 0x01, 0xF1, 0xA1, 0x07, 0x09, 0xE6, 0x01, 0x07,
+    0x19, 0x40, 0x48, 0x49, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0x02, 0x01, 0xF3,
+    0x00, 0x00, 0x03, 0x02, 0x01, 0xF3, 0xE1, 0x42, 0x01, 0xCB, 0x34, 0xE3, 0x01, 0x19, 0x22, 0x02,
+    0x01, 0xFF, 0x01, 0xFF, 0x59, 0x02, 0x01, 0xFF, 0xE1, 0x23, 0x01, 0xF6, 0xB4, 0xE2, 0x15, 0x17,
+    0x02, 0x01, 0x67, 0x01, 0x97, 0x5C, 0xE2, 0x08, 0x41, 0x00, 0x19, 0x20, 0x02, 0x00, 0x05, 0x61,
+    0x36, 0x01, 0xF6, 0xCB, 0x21, 0x23, 0x05, 0x61, 0x08, 0x01, 0xFD, 0x4E, 0x22, 0x04, 0x41, 0x08,
+    0x05, 0x21, 0x07, 0x05, 0x21, 0x04, 0x10, 0x21, 0x07, 0x03, 0xEB, 0x01, 0x07, 0x17, 0x19, 0x21,
+    0x23, 0x25, 0x29, 0x48, 0x4A, 0x4B, 0x02, 0x02, 0x5A, 0x00, 0x00, 0x44, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0x2D, 0x01, 0x97, 0xDB, 0x02, 0x02, 0x5A, 0x00, 0x00, 0x24, 0x00, 0x00,
+    0x09, 0x02, 0x02, 0x59, 0x00, 0x00, 0x03, 0xE1, 0x40, 0x01, 0xAD, 0xF1, 0xE6, 0x07, 0x09, 0x15,
+    0x22, 0x28, 0x2B, 0x01, 0xF9, 0x3E, 0x02, 0x00, 0x62, 0x01, 0x8F, 0xAD, 0x02, 0x02, 0x82, 0x02,
+    0x00, 0xDA, 0x01, 0xD8, 0xD6, 0x62, 0x01, 0x1A, 0x02, 0x02, 0xA5, 0x01, 0xF2, 0x63, 0xE2, 0x07,
+    0x09, 0x00, 0x7E, 0x96, 0x01, 0xE6, 0xA0, 0xE8, 0x07, 0x14, 0x19, 0x1A, 0x21, 0x25, 0x40, 0x48,
+    0x01, 0xFC, 0xD5, 0x00, 0x00, 0x30, 0x02, 0x02, 0x68, 0x02, 0x02, 0xB7, 0x00, 0x00, 0x2B, 0x02,
+    0x02, 0xB6, 0x00, 0x00, 0x12, 0x00, 0x00, 0x09, 0xE2, 0x38, 0x42, 0x02, 0x02, 0x9F, 0x01, 0xE3,
+    0x4F, 0x61, 0x40, 0x01, 0xB8, 0x83, 0x21, 0x33, 0x05, 0x21, 0x08, 0x03, 0x21, 0x07, 0x03, 0xC2,
+    0x08, 0x23, 0x00, 0x03, 0x44, 0x65, 0x21, 0x22, 0x07, 0x21, 0x31, 0x03, 0xE2, 0x0A, 0x25, 0x00,
+    0x00, 0x03, 0x02, 0x02, 0xEF, 0x61, 0x42, 0x01, 0xCC, 0x8D, 0x62, 0x01, 0x36, 0x02, 0x03, 0x0A,
+    0x02, 0x03, 0x09, 0x61, 0x23, 0x01, 0x1F, 0x7E, 0xA1, 0x32, 0x05, 0x61, 0x2B, 0x02, 0x00, 0xF1,
+    0xE4, 0x01, 0x23, 0x27, 0x2A, 0x00, 0x00, 0x08, 0x01, 0xF0, 0x02, 0x01, 0xA5, 0xCA, 0x00, 0x00,
+    0x05, 0xE2, 0x01, 0x34, 0x02, 0x03, 0x31, 0x00, 0x00, 0x11, 0x61, 0x42, 0x01, 0xE8, 0x4A, 0xE1,
+    0x15, 0x01, 0xE4, 0x80, 0xE1, 0x23, 0x01, 0xC1, 0xF1, 0x21, 0x4C, 0x05, 0x6D, 0x01, 0x04, 0x07,
+    0x14, 0x15, 0x19, 0x1A, 0x21, 0x22, 0x23, 0x27, 0x40, 0x49, 0x00, 0x00, 0x74, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x42, 0x00, 0x00, 0x1B, 0x02, 0x03, 0x4C, 0x00, 0x32, 0x45, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x0D, 0x02, 0x01, 0x3D, 0x00, 0x00, 0x03, 0x00, 0x4F, 0xE5, 0x01, 0xF0,
+    0x62, 0x41, 0x14, 0x58, 0xE9, 0x21, 0x1C, 0x04, 0x62, 0x1F, 0x25, 0x02, 0x03, 0x88, 0x01, 0xFF,
+    0x63, 0xA2, 0x41, 0x44, 0x0C, 0x09, 0x21, 0x32, 0x05, 0xE3, 0x32, 0x34, 0x35, 0x02, 0x00, 0xC9,
+    0x01, 0xF0, 0xAF, 0x02, 0x03, 0x08, 0x62, 0x23, 0x2A, 0x00, 0xC7, 0x01, 0x01, 0x06, 0x70, 0x62,
+    0x25, 0x40, 0x00, 0xB1, 0xEF, 0x01, 0xCA, 0x69, 0xA1, 0x32, 0x09, 0xE2, 0x32, 0x39, 0x02, 0x03,
+    0xBB, 0x01, 0x92, 0xC6, 0x41, 0x2D, 0x02, 0xF2, 0x21, 0x1A, 0x04, 0x21, 0x4C, 0x03, 0x21, 0x23,
+    0x03, 0x21, 0x32, 0x03, 0x61, 0x40, 0x01, 0x1D, 0x12, 0x21, 0x25, 0x05, 0x21, 0x31, 0x03, 0xC3,
+    0x04, 0x0B, 0x44, 0x00, 0x0E, 0x00, 0x03, 0x1B, 0xFD, 0x21, 0x21, 0x0A, 0x21, 0x22, 0x03, 0x21,
+    0x35, 0x03, 0x61, 0x22, 0x02, 0x00, 0xE4, 0x21, 0x35, 0x05, 0x64, 0x0B, 0x14, 0x1F, 0x27, 0x02,
+    0x03, 0xFA, 0x00, 0x00, 0x0B, 0x01, 0xE6, 0x07, 0x00, 0x00, 0x03, 0x62, 0x15, 0x49, 0x02, 0x03,
+    0xA2, 0x02, 0x04, 0x0B, 0x62, 0x21, 0x48, 0x01, 0xFE, 0x62, 0x02, 0x04, 0x14, 0x22, 0x01, 0x25,
+    0x12, 0x09, 0x61, 0x2D, 0x01, 0xE6, 0xB2, 0x21, 0x40, 0x05, 0x21, 0x0B, 0x03, 0xE2, 0x07, 0x1E,
+    0x02, 0x04, 0x2D, 0x01, 0x77, 0xBA, 0xEC, 0x01, 0x14, 0x19, 0x1B, 0x1F, 0x21, 0x23, 0x25, 0x40,
+    0x42, 0x44, 0x48, 0x02, 0x04, 0x36, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x90, 0x02,
+    0x03, 0xD0, 0x00, 0x00, 0x7E, 0x02, 0x02, 0x27, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0xE2, 0x14, 0x31, 0x02, 0x03, 0xA1, 0x01, 0x4D, 0xAF,
+    0x41, 0x01, 0x77, 0x53, 0x21, 0x34, 0x04, 0x62, 0x19, 0x42, 0x00, 0x00, 0x03, 0x02, 0x04, 0x3E,
+    0xE3, 0x23, 0x34, 0x44, 0x02, 0x04, 0x80, 0x00, 0x00, 0x09, 0x01, 0xFA, 0x35, 0xE3, 0x15, 0x17,
+    0x2A, 0x01, 0xF6, 0x85, 0x02, 0x03, 0x8E, 0x02, 0x03, 0x55, 0x62, 0x21, 0x27, 0x02, 0x04, 0x61,
+    0x01, 0xE7, 0x47, 0x41, 0x25, 0x7D, 0x0C, 0xE2, 0x07, 0x40, 0x02, 0x04, 0xA7, 0x01, 0x99, 0x33,
+    0xEB, 0x01, 0x14, 0x19, 0x1B, 0x21, 0x22, 0x23, 0x40, 0x42, 0x48, 0x4A, 0x01, 0xF6, 0x20, 0x00,
+    0x02, 0x88, 0x00, 0x00, 0x49, 0x02, 0x04, 0xB0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x23, 0x01, 0xF3,
+    0xFC, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x02, 0x04, 0x9D, 0x41, 0x23, 0xFE,
+    0x7F, 0x62, 0x35, 0x40, 0x01, 0xEC, 0x57, 0x01, 0xFC, 0xE6, 0x62, 0x01, 0x1A, 0x00, 0x00, 0x09,
+    0x01, 0xA5, 0x65, 0xE5, 0x07, 0x15, 0x27, 0x2B, 0x42, 0x01, 0xDF, 0x5F, 0x01, 0xFD, 0x4C, 0x00,
+    0xBF, 0x90, 0x01, 0xCE, 0x7B, 0x01, 0x89, 0x4F, 0x61, 0x21, 0x01, 0xBB, 0x88, 0x21, 0x2B, 0x05,
+    0x21, 0x34, 0x03, 0xA1, 0x2D, 0x03, 0x62, 0x14, 0x30, 0x02, 0x05, 0x16, 0x00, 0x00, 0x03, 0x41,
+    0x40, 0x18, 0xE6, 0xEF, 0x01, 0x07, 0x08, 0x0E, 0x19, 0x1B, 0x21, 0x22, 0x23, 0x40, 0x42, 0x48,
+    0x49, 0x4A, 0x4B, 0x02, 0x05, 0x23, 0x01, 0xEB, 0x88, 0x01, 0xDF, 0xB6, 0x02, 0x05, 0x22, 0x01,
+    0xEE, 0x4F, 0x01, 0xC6, 0x13, 0x00, 0x00, 0x46, 0x02, 0x05, 0x23, 0x01, 0xF9, 0x3A, 0x00, 0x00,
+    0x39, 0x02, 0x05, 0x22, 0x02, 0x05, 0x19, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x04,
+    0xE1, 0x40, 0x01, 0x7D, 0x41, 0xE1, 0x19, 0x01, 0x43, 0xD6, 0x61, 0x49, 0x01, 0xD2, 0x8C, 0xE5,
+    0x07, 0x1A, 0x1B, 0x21, 0x2A, 0x00, 0x00, 0x0F, 0x02, 0x05, 0x6F, 0x01, 0xF9, 0x63, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x05, 0x61, 0x40, 0x02, 0x03, 0x9A, 0xE2, 0x40, 0x46, 0x01, 0x75, 0x09, 0x02,
+    0x05, 0x89, 0xE3, 0x34, 0x40, 0x42, 0x01, 0xF2, 0xA8, 0x01, 0xC8, 0x37, 0x01, 0x7F, 0x38, 0x61,
+    0x19, 0x01, 0xC3, 0xBA, 0x61, 0x19, 0x01, 0x3F, 0x6A, 0x21, 0x21, 0x05, 0xE9, 0x04, 0x17, 0x1E,
+    0x20, 0x21, 0x28, 0x2A, 0x2D, 0x40, 0x00, 0x00, 0x03, 0x01, 0x46, 0x84, 0x00, 0x97, 0xD0, 0x01,
+    0xC4, 0xBA, 0x02, 0x05, 0xAC, 0x01, 0xE1, 0x2B, 0x02, 0x04, 0x74, 0x00, 0x1B, 0x31, 0x01, 0x7F,
+    0x7A, 0x61, 0x42, 0x01, 0xD7, 0x0C, 0x21, 0x38, 0x05, 0xE3, 0x01, 0x19, 0x23, 0x02, 0x05, 0x93,
+    0x00, 0x00, 0x03, 0x01, 0xE6, 0xED, 0xE4, 0x08, 0x17, 0x32, 0x42, 0x01, 0xFE, 0xF8, 0x02, 0x05,
+    0xC1, 0x00, 0x00, 0x0D, 0x01, 0x29, 0x51, 0xE2, 0x30, 0x32, 0x02, 0x05, 0xF7, 0x01, 0x1C, 0x89,
+    0x61, 0x2C, 0x02, 0x02, 0x95, 0x61, 0x1E, 0x01, 0xC7, 0x70, 0x62, 0x17, 0x2A, 0x01, 0xE2, 0x0B,
+    0x02, 0x06, 0x0A, 0xF1, 0x01, 0x07, 0x13, 0x17, 0x18, 0x19, 0x1B, 0x21, 0x23, 0x25, 0x28, 0x29,
+    0x2A, 0x2B, 0x41, 0x42, 0x48, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8A, 0x02, 0x02, 0xA8, 0x01, 0xC6,
+    0x6A, 0x02, 0x06, 0x12, 0x00, 0x00, 0x81, 0x01, 0xEA, 0xEE, 0x00, 0x00, 0x74, 0x00, 0x00, 0x67,
+    0x02, 0x05, 0xAD, 0x02, 0x06, 0x12, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x09, 0x02, 0x06, 0x13, 0x63, 0x23, 0x27, 0x48, 0x02, 0x06, 0x1F, 0x02,
+    0x06, 0x1F, 0x02, 0x06, 0x58, 0x61, 0x35, 0x01, 0xCF, 0x19, 0x61, 0x2D, 0x01, 0xFB, 0xBC, 0x63,
+    0x30, 0x31, 0x39, 0x00, 0x00, 0x05, 0x02, 0x06, 0x65, 0x02, 0x06, 0x65, 0xE2, 0x2A, 0x44, 0x00,
+    0x00, 0x0D, 0x01, 0xE6, 0xDA, 0x61, 0x1E, 0x01, 0xAE, 0x8B, 0x61, 0x21, 0x01, 0xC5, 0xF5, 0x21,
+    0x34, 0x05, 0x21, 0x0B, 0x03, 0x21, 0x32, 0x03, 0x21, 0x22, 0x03, 0x21, 0x32, 0x03, 0x63, 0x01,
+    0x19, 0x1A, 0x01, 0xE8, 0xAB, 0x02, 0x06, 0x9E, 0x00, 0x43, 0xCB, 0x61, 0x4A, 0x01, 0xF7, 0x19,
+    0x21, 0x38, 0x05, 0xE2, 0x1A, 0x2A, 0x00, 0x00, 0x03, 0x02, 0x06, 0x97, 0x63, 0x15, 0x19, 0x21,
+    0x00, 0x00, 0x09, 0x02, 0x06, 0xBC, 0x02, 0x06, 0xBC, 0xE8, 0x0B, 0x19, 0x21, 0x23, 0x27, 0x40,
+    0x48, 0x49, 0x00, 0x00, 0x64, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x44, 0x01, 0x69, 0xC5, 0x00, 0x00,
+    0x2E, 0x00, 0x00, 0x2B, 0x02, 0x06, 0x90, 0x00, 0x00, 0x0D, 0x61, 0x23, 0x01, 0x1B, 0x30, 0xE3,
+    0x02, 0x21, 0x35, 0x00, 0x00, 0x05, 0x02, 0x04, 0xA3, 0x02, 0x06, 0x70, 0xE1, 0x31, 0x01, 0x13,
+    0xC4, 0x62, 0x31, 0x34, 0x01, 0xF3, 0xE3, 0x02, 0x06, 0xC8, 0xE2, 0x01, 0x04, 0x01, 0xEC, 0x86,
+    0x01, 0xD1, 0xB0, 0x21, 0x13, 0x09, 0x64, 0x01, 0x21, 0x2D, 0x32, 0x00, 0x0F, 0xCE, 0x01, 0xE5,
+    0x9D, 0x02, 0x06, 0xDD, 0x00, 0x00, 0x03, 0x41, 0x04, 0x0F, 0xDF, 0x62, 0x34, 0x47, 0x01, 0x14,
+    0xC3, 0x00, 0x00, 0x04, 0x62, 0x19, 0x48, 0x00, 0x6F, 0x57, 0x02, 0x07, 0x2A, 0x21, 0x34, 0x09,
+    0xC2, 0x0A, 0x25, 0x3A, 0xF6, 0x00, 0x03, 0x21, 0x4C, 0x07, 0x62, 0x01, 0x2E, 0x02, 0x06, 0x25,
+    0x02, 0x06, 0xEC, 0x61, 0x1A, 0x01, 0xF7, 0x11, 0x21, 0x40, 0x05, 0xF0, 0x01, 0x0A, 0x14, 0x15,
+    0x19, 0x1F, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x41, 0x42, 0x49, 0x4A, 0x4B, 0x00, 0x00, 0x6C, 0x01,
+    0xDB, 0xF0, 0x02, 0x07, 0x5A, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5A, 0x01, 0xE2, 0x5D, 0x01, 0x35,
+    0x3C, 0x00, 0x00, 0x45, 0x00, 0x00, 0x30, 0x00, 0x00, 0x14, 0x01, 0xCE, 0xC1, 0x01, 0xD6, 0xCC,
+    0x00, 0x00, 0x11, 0x02, 0x07, 0x5B, 0x00, 0x00, 0x03, 0x02, 0x07, 0x5B, 0xE3, 0x02, 0x2E, 0x33,
+    0x00, 0x00, 0xB2, 0x02, 0x07, 0x36, 0x02, 0x07, 0x9C, 0xE1, 0x25, 0x02, 0x07, 0x9C, 0x61, 0x1B,
+    0x02, 0x05, 0xB0, 0x61, 0x16, 0x01, 0xEC, 0xDD, 0x61, 0x4C, 0x01, 0x90, 0x25, 0x21, 0x0B, 0x05,
+    0x21, 0x01, 0x03, 0xE3, 0x1B, 0x31, 0x34, 0x00, 0x4E, 0xEF, 0x00, 0x00, 0x03, 0x01, 0x9E, 0xA3,
+    0x61, 0x01, 0x01, 0xF4, 0xB2, 0x21, 0x40, 0x05, 0x63, 0x2D, 0x35, 0x38, 0x02, 0x07, 0x9F, 0x02,
+    0x07, 0x9F, 0x00, 0x00, 0x03, 0xE1, 0x1B, 0x01, 0x76, 0xDF, 0x61, 0x14, 0x01, 0x7E, 0xCF, 0x21,
+    0x40, 0x05, 0x21, 0x34, 0x03, 0x62, 0x17, 0x40, 0x02, 0x07, 0xD9, 0x01, 0xCE, 0x46, 0x21, 0x04,
+    0x09, 0x61, 0x15, 0x01, 0xFA, 0xD8, 0x21, 0x41, 0x05, 0x21, 0x2A, 0x03, 0x64, 0x01, 0x08, 0x0B,
+    0x15, 0x01, 0xD0, 0xA6, 0x00, 0x00, 0x0E, 0x01, 0xC9, 0x87, 0x00, 0x00, 0x03, 0xE1, 0x40, 0x01,
+    0xCB, 0x1D, 0x21, 0x21, 0x05, 0x21, 0x23, 0x03, 0x21, 0x01, 0x03, 0x64, 0x0A, 0x15, 0x17, 0x40,
+    0x02, 0x07, 0x29, 0x02, 0x08, 0x2B, 0x02, 0x08, 0x2B, 0x01, 0xCE, 0x7C, 0x63, 0x15, 0x1F, 0x21,
+    0x00, 0x5E, 0x1F, 0x01, 0xC9, 0xB7, 0x00, 0x00, 0x11, 0x61, 0x1F, 0x01, 0xE1, 0x00, 0xE2, 0x41,
+    0x43, 0x01, 0xD7, 0x41, 0x01, 0xF5, 0x30, 0x21, 0x07, 0x09, 0xEA, 0x07, 0x14, 0x15, 0x22, 0x27,
+    0x40, 0x41, 0x42, 0x44, 0x48, 0x02, 0x08, 0x5A, 0x00, 0x00, 0x97, 0x00, 0x00, 0x82, 0x00, 0x00,
+    0x75, 0x00, 0x00, 0x68, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x32, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x03, 0x62, 0x2A, 0x42, 0x02, 0x08, 0x83, 0x02, 0x08, 0x2E, 0x41, 0x04, 0x3C, 0x70,
+    0x21, 0x17, 0x04, 0xA1, 0x40, 0x03, 0x63, 0x34, 0x35, 0x48, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x02, 0x08, 0x8C, 0x62, 0x01, 0x40, 0x00, 0xE2, 0xDF, 0x01, 0xCE, 0xF4, 0x61, 0x23, 0x01, 0xDC,
+    0x0A, 0x21, 0x33, 0x05, 0x21, 0x49, 0x03, 0xE2, 0x02, 0x19, 0x01, 0xBF, 0x37, 0x00, 0x00, 0x03,
+    0xA1, 0x07, 0x09, 0xE2, 0x07, 0x1B, 0x02, 0x08, 0xC3, 0x02, 0x08, 0x74, 0xE4, 0x01, 0x1B, 0x22,
+    0x30, 0x00, 0xDF, 0xBC, 0x02, 0x08, 0xCC, 0x01, 0x23, 0x31, 0x02, 0x08, 0xCC, 0xF0, 0x01, 0x07,
+    0x10, 0x14, 0x15, 0x19, 0x23, 0x25, 0x2A, 0x30, 0x40, 0x41, 0x42, 0x48, 0x49, 0x4A, 0x00, 0x01,
+    0x41, 0x00, 0x01, 0x34, 0x00, 0x01, 0x2F, 0x02, 0x08, 0xDC, 0x00, 0x01, 0x2A, 0x02, 0x08, 0xDD,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x47, 0x00, 0x00, 0x3A, 0x02, 0x08, 0xDD, 0x02, 0x08, 0xDC, 0x01,
+    0xF8, 0xBD, 0x02, 0x08, 0x7F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x11, 0xE2, 0x1C,
+    0x40, 0x02, 0x09, 0x11, 0x01, 0x39, 0x3F, 0xE1, 0x1E, 0x02, 0x05, 0xBC, 0x21, 0x1E, 0x05, 0x21,
+    0x31, 0x03, 0x21, 0x10, 0x03, 0x61, 0x1E, 0x01, 0x3F, 0x17, 0x21, 0x31, 0x05, 0x65, 0x01, 0x07,
+    0x19, 0x30, 0x48, 0x01, 0xEF, 0x73, 0x02, 0x09, 0x3D, 0x02, 0x09, 0x3D, 0x02, 0x09, 0x3D, 0x02,
+    0x09, 0x3D, 0xEA, 0x07, 0x0F, 0x10, 0x19, 0x1C, 0x22, 0x25, 0x2D, 0x30, 0x40, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x18, 0x02, 0x09, 0x52, 0x01, 0xEE, 0xE4, 0x02, 0x09, 0x52, 0x00,
+    0x00, 0x15, 0x02, 0x09, 0x19, 0x02, 0x09, 0x52, 0x01, 0x8D, 0xAE, 0xE1, 0x1E, 0x02, 0x07, 0x51,
+    0xE1, 0x1E, 0x02, 0x09, 0x73, 0x61, 0x0C, 0x01, 0xAC, 0x44, 0x41, 0x34, 0x0E, 0x91, 0x41, 0x31,
+    0xFB, 0x5A, 0x61, 0x20, 0x02, 0x08, 0x5A, 0x62, 0x21, 0x31, 0x00, 0x00, 0x05, 0x01, 0x46, 0xF3,
+    0x61, 0x1A, 0x01, 0x78, 0x27, 0x21, 0x31, 0x05, 0x21, 0x17, 0x03, 0x21, 0x30, 0x03, 0x62, 0x23,
+    0x31, 0x00, 0x00, 0x03, 0x02, 0x02, 0x75, 0x61, 0x21, 0x01, 0xE1, 0x69, 0x21, 0x32, 0x05, 0x61,
+    0x0D, 0x01, 0x42, 0x85, 0x21, 0x31, 0x05, 0x21, 0x23, 0x03, 0x21, 0x34, 0x03, 0xE7, 0x0A, 0x17,
+    0x19, 0x1B, 0x2A, 0x2B, 0x41, 0x01, 0xEE, 0x4A, 0x02, 0x08, 0xC1, 0x00, 0xF1, 0x17, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x01, 0xF4, 0x84, 0xE4, 0x0D, 0x1A, 0x2A, 0x4C, 0x01,
+    0xB5, 0x15, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x53, 0x00, 0x00, 0x1D, 0xE2, 0x32, 0x34, 0x01, 0xEE,
+    0x93, 0x00, 0x00, 0x11, 0x63, 0x23, 0x2D, 0x30, 0x02, 0x07, 0xDA, 0x02, 0x09, 0xFA, 0x02, 0x08,
+    0x8C, 0xE3, 0x17, 0x1E, 0x40, 0x00, 0x00, 0x0D, 0x01, 0x7D, 0x9E, 0x01, 0x32, 0xF9, 0x61, 0x4A,
+    0x01, 0xFE, 0x4B, 0xE2, 0x01, 0x21, 0x00, 0x00, 0x05, 0x01, 0x98, 0x4F, 0x41, 0x35, 0xE8, 0x0E,
+    0x61, 0x35, 0x01, 0xD1, 0x70, 0xE1, 0x14, 0x02, 0x0A, 0x34, 0x61, 0x0B, 0x01, 0xCB, 0xB5, 0x61,
+    0x17, 0x01, 0xCC, 0x7E, 0x21, 0x01, 0x05, 0x21, 0x17, 0x03, 0x21, 0x2D, 0x06, 0x21, 0x41, 0x03,
+    0x42, 0x15, 0x17, 0x60, 0x33, 0x00, 0x03, 0x68, 0x01, 0x07, 0x0B, 0x21, 0x30, 0x40, 0x41, 0x42,
+    0x02, 0x0A, 0x57, 0x02, 0x0A, 0x57, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x27, 0x00, 0x00, 0x22, 0x00,
+    0x00, 0x1D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0x62, 0x23, 0x25, 0x01, 0xEB, 0xB9, 0x01, 0xD1,
+    0x3F, 0x62, 0x2D, 0x2E, 0x01, 0x83, 0x13, 0x01, 0xD3, 0x35, 0x62, 0x0B, 0x40, 0x02, 0x09, 0xC4,
+    0x00, 0x00, 0x09, 0x61, 0x1E, 0x01, 0xD8, 0x5E, 0x62, 0x07, 0x40, 0x02, 0x0A, 0x98, 0x00, 0x00,
+    0x05, 0x69, 0x07, 0x19, 0x25, 0x30, 0x32, 0x34, 0x35, 0x48, 0x49, 0x02, 0x0A, 0xA1, 0x02, 0x0A,
+    0xA1, 0x02, 0x0A, 0x85, 0x02, 0x0A, 0xA1, 0x00, 0x00, 0x29, 0x01, 0xCD, 0x9D, 0x00, 0x00, 0x17,
+    0x02, 0x04, 0xF6, 0x00, 0x00, 0x09, 0x41, 0x40, 0x5E, 0x68, 0x21, 0x34, 0x04, 0x65, 0x15, 0x17,
+    0x1E, 0x2A, 0x34, 0x02, 0x0A, 0xB1, 0x02, 0x0A, 0xB1, 0x02, 0x0A, 0xCD, 0x00, 0x00, 0x03, 0x00,
+    0x56, 0xCE, 0x62, 0x0A, 0x2A, 0x02, 0x0A, 0xE2, 0x01, 0xA3, 0x99, 0x21, 0x17, 0x09, 0xF0, 0x01,
+    0x07, 0x0A, 0x0B, 0x14, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0x22, 0x23, 0x25, 0x2A, 0x41, 0x49, 0x00,
+    0x01, 0x73, 0x00, 0x01, 0x6E, 0x00, 0x01, 0x69, 0x00, 0x01, 0x64, 0x02, 0x0A, 0xEE, 0x01, 0xAE,
+    0x9C, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xDD, 0x02, 0x08, 0xC4, 0x02, 0x09, 0xEC, 0x00, 0x00, 0xCB,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x21, 0x00, 0x00, 0x03, 0x02, 0x0A, 0xB5, 0x62,
+    0x21, 0x2E, 0x02, 0x0A, 0xF6, 0x01, 0xFB, 0x12, 0x41, 0x21, 0xF6, 0xE8, 0x22, 0x41, 0x42, 0x0D,
+    0x04, 0x21, 0x4C, 0x05, 0x61, 0x21, 0x01, 0xA2, 0x27, 0x21, 0x07, 0x05, 0x21, 0x49, 0x03, 0x21,
+    0x34, 0x03, 0x21, 0x15, 0x03, 0x61, 0x1E, 0x02, 0x07, 0x30, 0x21, 0x44, 0x05, 0x21, 0x01, 0x03,
+    0xE2, 0x0B, 0x25, 0x02, 0x0A, 0x54, 0x01, 0xEE, 0x0D, 0x62, 0x04, 0x40, 0x00, 0x00, 0x09, 0x01,
+    0xCD, 0x1B, 0x64, 0x17, 0x40, 0x42, 0x4C, 0x00, 0x00, 0x20, 0x01, 0xCD, 0x24, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x09, 0x41, 0x19, 0x18, 0x0C, 0x61, 0x01, 0x01, 0x2C, 0xD9, 0x62, 0x15, 0x17, 0x02,
+    0x0B, 0x0D, 0x00, 0x00, 0x05, 0x67, 0x01, 0x19, 0x21, 0x23, 0x25, 0x40, 0x42, 0x01, 0xC9, 0xB0,
+    0x02, 0x0B, 0x95, 0x02, 0x0B, 0x95, 0x00, 0x00, 0x54, 0x00, 0x00, 0x23, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x09, 0xE5, 0x17, 0x20, 0x22, 0x34, 0x35, 0x01, 0xD8, 0x97, 0x02, 0x0B, 0x8D, 0x01, 0x94,
+    0x39, 0x02, 0x0B, 0x79, 0x02, 0x0B, 0xB2, 0xE2, 0x01, 0x2B, 0x01, 0x2E, 0xF3, 0x02, 0x0A, 0x8F,
+    0xE3, 0x30, 0x32, 0x4C, 0x02, 0x0B, 0xD0, 0x00, 0x00, 0x09, 0x02, 0x0B, 0xD0, 0x62, 0x01, 0x19,
+    0x02, 0x0B, 0xDD, 0x00, 0x00, 0x0D, 0x63, 0x04, 0x0A, 0x44, 0x00, 0x00, 0x34, 0x00, 0x00, 0x09,
+    0x01, 0xD6, 0xD8, 0x61, 0x2A, 0x01, 0x83, 0x76, 0x21, 0x34, 0x05, 0x21, 0x14, 0x03, 0x61, 0x04,
+    0x02, 0x0B, 0xFD, 0xE4, 0x02, 0x21, 0x32, 0x42, 0x02, 0x0B, 0xE7, 0x02, 0x0B, 0x01, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x05, 0xE2, 0x01, 0x30, 0x01, 0xF1, 0x20, 0x02, 0x0C, 0x14, 0x21, 0x22, 0x09,
+    0xE3, 0x01, 0x30, 0x35, 0x01, 0xF1, 0x2C, 0x02, 0x0C, 0x20, 0x00, 0x00, 0x03, 0x61, 0x23, 0x01,
+    0x75, 0x06, 0xA1, 0x04, 0x05, 0x61, 0x21, 0x01, 0x5B, 0x44, 0x21, 0x31, 0x05, 0x62, 0x34, 0x39,
+    0x01, 0x6D, 0x74, 0x00, 0x0E, 0x59, 0x61, 0x34, 0x01, 0x2C, 0x14, 0x62, 0x42, 0x44, 0x02, 0x0C,
+    0x4A, 0x01, 0xEA, 0x9A, 0x22, 0x25, 0x32, 0x0E, 0x09, 0x62, 0x32, 0x34, 0x02, 0x0B, 0x9E, 0x02,
+    0x0B, 0xFB, 0x61, 0x39, 0x01, 0xD7, 0x3A, 0x61, 0x01, 0x01, 0xAC, 0xE2, 0x21, 0x2D, 0x05, 0x63,
+    0x32, 0x35, 0x47, 0x02, 0x0C, 0x6F, 0x02, 0x0C, 0x6F, 0x00, 0x00, 0x03, 0x62, 0x19, 0x44, 0x01,
+    0xE7, 0x5B, 0x01, 0xFF, 0x53, 0x21, 0x35, 0x09, 0x21, 0x14, 0x03, 0x21, 0x1A, 0x03, 0x61, 0x01,
+    0x01, 0xF1, 0xB8, 0x64, 0x14, 0x34, 0x35, 0x38, 0x02, 0x0C, 0x77, 0x00, 0x00, 0x08, 0x02, 0x0C,
+    0x93, 0x00, 0x00, 0x05, 0x61, 0x32, 0x01, 0xCE, 0x65, 0x63, 0x30, 0x31, 0x32, 0x02, 0x0C, 0xA9,
+    0x02, 0x0A, 0x3E, 0x01, 0x23, 0x3B, 0x61, 0x21, 0x01, 0x18, 0xE8, 0x61, 0x27, 0x01, 0x82, 0xBA,
+    0x21, 0x2D, 0x05, 0x22, 0x31, 0x47, 0x0D, 0x03, 0x63, 0x25, 0x34, 0x47, 0x02, 0x0C, 0xC8, 0x02,
+    0x0C, 0x6A, 0x02, 0x0A, 0xB9, 0x62, 0x25, 0x47, 0x02, 0x0C, 0xD5, 0x02, 0x0C, 0x77, 0x61, 0x15,
+    0x01, 0x56, 0xC0, 0xA1, 0x19, 0x05, 0x62, 0x01, 0x2A, 0x02, 0x0C, 0xE6, 0x02, 0x0C, 0xE6, 0x66,
+    0x14, 0x15, 0x21, 0x23, 0x25, 0x2A, 0x00, 0x00, 0x27, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0C, 0x01,
+    0xF9, 0xD1, 0x00, 0xFC, 0x40, 0x00, 0x00, 0x09, 0x61, 0x23, 0x01, 0xFC, 0xEF, 0x21, 0x44, 0x05,
+    0x21, 0x32, 0x03, 0x21, 0x04, 0x03, 0x21, 0x01, 0x03, 0x21, 0x47, 0x03, 0x21, 0x0B, 0x03, 0x62,
+    0x04, 0x1E, 0x01, 0xF2, 0x2F, 0x01, 0x66, 0x4B, 0xA2, 0x41, 0x42, 0x0C, 0x09, 0x61, 0x44, 0x01,
+    0xFA, 0x43, 0xC1, 0x17, 0x0E, 0x4E, 0xA1, 0x42, 0x04, 0x23, 0x19, 0x25, 0x2B, 0x11, 0x0C, 0x03,
+    0x62, 0x19, 0x1A, 0x02, 0x0C, 0x85, 0x01, 0xE5, 0xF7, 0xE2, 0x07, 0x2B, 0x02, 0x0D, 0x49, 0x02,
+    0x0D, 0x2D, 0xF5, 0x01, 0x06, 0x07, 0x08, 0x0B, 0x14, 0x17, 0x19, 0x1A, 0x21, 0x23, 0x25, 0x2A,
+    0x2B, 0x2C, 0x2E, 0x40, 0x42, 0x44, 0x48, 0x49, 0x00, 0x01, 0x4F, 0x00, 0x01, 0x32, 0x00, 0x01,
+    0x20, 0x02, 0x0D, 0x19, 0x00, 0x01, 0x18, 0x00, 0x01, 0x15, 0x02, 0x0B, 0xDA, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xAE, 0x00,
+    0x00, 0xA9, 0x02, 0x0C, 0x8C, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x63, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x09, 0x02, 0x0D, 0x52, 0xE3, 0x15, 0x40, 0x42, 0x02, 0x0C, 0xB4, 0x02, 0x0A,
+    0x38, 0x01, 0x06, 0xA4, 0xE4, 0x22, 0x30, 0x34, 0x35, 0x02, 0x0A, 0x49, 0x02, 0x0D, 0xB4, 0x02,
+    0x0D, 0x7B, 0x02, 0x0D, 0xB4, 0xE2, 0x42, 0x43, 0x01, 0x0E, 0x5D, 0x02, 0x0D, 0x0A, 0x62, 0x01,
+    0x19, 0x02, 0x0D, 0xCE, 0x02, 0x0B, 0x0C, 0x61, 0x30, 0x01, 0xFC, 0x36, 0xC1, 0x1A, 0xFB, 0x11,
+    0x21, 0x19, 0x04, 0x64, 0x23, 0x32, 0x34, 0x35, 0x02, 0x0D, 0x7D, 0x02, 0x0D, 0xE3, 0x00, 0x00,
+    0x03, 0x02, 0x0D, 0xE3, 0xE4, 0x01, 0x22, 0x34, 0x35, 0x02, 0x0D, 0xF4, 0x01, 0xF1, 0xE6, 0x00,
+    0x0F, 0x10, 0x02, 0x0D, 0xF4, 0xE1, 0x40, 0x01, 0x07, 0x02, 0xEE, 0x01, 0x04, 0x07, 0x0A, 0x16,
+    0x17, 0x18, 0x19, 0x1E, 0x21, 0x40, 0x42, 0x48, 0x49, 0x00, 0x00, 0x63, 0x00, 0x00, 0x56, 0x00,
+    0x00, 0x45, 0x00, 0x00, 0x3C, 0x01, 0xA2, 0xDE, 0x00, 0x00, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00,
+    0x16, 0x01, 0xDE, 0x31, 0x02, 0x0E, 0x0A, 0x02, 0x0D, 0x4F, 0x01, 0xFA, 0xEC, 0x01, 0x82, 0xE2,
+    0x00, 0x00, 0x05, 0x41, 0x15, 0xE3, 0x36, 0x21, 0x34, 0x04, 0x41, 0x1B, 0x4D, 0x96, 0x21, 0x1A,
+    0x04, 0x21, 0x1A, 0x03, 0x21, 0x30, 0x03, 0x61, 0x32, 0x01, 0xC3, 0x73, 0xA1, 0x1E, 0x05, 0xC4,
+    0x08, 0x1B, 0x23, 0x32, 0x00, 0x18, 0x4D, 0xAB, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x2A, 0x55, 0x6B,
+    0x21, 0x32, 0x04, 0xA1, 0x22, 0x03, 0x21, 0x19, 0x03, 0x21, 0x32, 0x03, 0x62, 0x32, 0x49, 0x02,
+    0x0E, 0x7C, 0x01, 0x21, 0x39, 0x61, 0x4A, 0x02, 0x07, 0x01, 0x21, 0x35, 0x05, 0x61, 0x18, 0x01,
+    0xEB, 0xB5, 0x21, 0x32, 0x05, 0xA1, 0x2A, 0x03, 0x21, 0x19, 0x03, 0x21, 0x22, 0x03, 0x21, 0x35,
+    0x03, 0x22, 0x15, 0x23, 0x17, 0x03, 0x62, 0x23, 0x2A, 0x02, 0x0C, 0x97, 0x02, 0x0E, 0x9C, 0xEA,
+    0x01, 0x04, 0x07, 0x16, 0x18, 0x19, 0x23, 0x2B, 0x40, 0x41, 0x01, 0x5A, 0x15, 0x01, 0xCC, 0xA4,
+    0x00, 0x00, 0x36, 0x01, 0xC5, 0x36, 0x02, 0x0D, 0x77, 0x00, 0x00, 0x33, 0x02, 0x0B, 0x97, 0x01,
+    0xDB, 0x26, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x61, 0x2D, 0x01, 0xFE, 0xB5, 0x64, 0x2A, 0x34,
+    0x42, 0x44, 0x02, 0x0E, 0xC1, 0x00, 0x78, 0xE9, 0x01, 0x28, 0xF8, 0x00, 0x00, 0x05, 0xE1, 0x23,
+    0x02, 0x0D, 0xEF, 0x62, 0x32, 0x35, 0x00, 0x00, 0x05, 0x02, 0x0E, 0xF3, 0x41, 0x19, 0x25, 0xCB,
+    0x62, 0x2D, 0x34, 0x02, 0x0B, 0xF2, 0x00, 0x00, 0x04, 0x61, 0x17, 0x01, 0xCD, 0x90, 0x21, 0x32,
+    0x05, 0xA1, 0x04, 0x03, 0x21, 0x19, 0x03, 0x62, 0x19, 0x40, 0x01, 0xE9, 0xEF, 0x01, 0xEE, 0xF6,
+    0xE4, 0x21, 0x23, 0x31, 0x32, 0x01, 0xF3, 0x9D, 0x02, 0x0E, 0x1E, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x09, 0xE1, 0x13, 0x02, 0x0B, 0xC6, 0x62, 0x13, 0x15, 0x02, 0x0E, 0x70, 0x01, 0x53, 0x2D, 0x21,
+    0x34, 0x09, 0x65, 0x14, 0x15, 0x19, 0x21, 0x23, 0x01, 0xE4, 0x10, 0x01, 0xF1, 0xEF, 0x01, 0xF0,
+    0xA4, 0x01, 0xF1, 0xEF, 0x02, 0x0F, 0x42, 0x41, 0x21, 0x03, 0xD4, 0x62, 0x01, 0x14, 0x01, 0xEE,
+    0x0F, 0x00, 0x3C, 0x05, 0xF3, 0x04, 0x07, 0x08, 0x14, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x21, 0x22,
+    0x25, 0x29, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x48, 0x00, 0x01, 0x05, 0x00, 0x00, 0xB5, 0x01, 0xA1,
+    0x8B, 0x00, 0x00, 0x87, 0x00, 0x00, 0x71, 0x01, 0x4A, 0x76, 0x01, 0xF0, 0xCA, 0x00, 0x00, 0x64,
+    0x01, 0xDF, 0x8B, 0x00, 0x00, 0x44, 0x00, 0xB3, 0xCB, 0x02, 0x0F, 0x64, 0x00, 0x00, 0x33, 0x02,
+    0x0F, 0x64, 0x00, 0x00, 0x25, 0x00, 0x00, 0x22, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x02, 0x0F,
+    0x64, 0x61, 0x17, 0x02, 0x0F, 0x98, 0x21, 0x34, 0x05, 0x62, 0x19, 0x22, 0x01, 0xFD, 0xA2, 0x02,
+    0x0F, 0xB9, 0x62, 0x1A, 0x1B, 0x01, 0xDA, 0x68, 0x01, 0xDA, 0x59, 0x21, 0x34, 0x09, 0x61, 0x27,
+    0x02, 0x0F, 0x16, 0x21, 0x38, 0x05, 0x61, 0x19, 0x02, 0x0F, 0x4E, 0x21, 0x34, 0x05, 0xE5, 0x18,
+    0x19, 0x20, 0x21, 0x27, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x00, 0x8E, 0x27, 0x01, 0xF1, 0x1F,
+    0x00, 0x00, 0x03, 0xE2, 0x27, 0x4C, 0x02, 0x0F, 0x3B, 0x02, 0x0F, 0xF3, 0x21, 0x22, 0x09, 0x62,
+    0x18, 0x30, 0x01, 0xF5, 0x0B, 0x02, 0x0F, 0xFF, 0x21, 0x23, 0x09, 0x21, 0x15, 0x03, 0xEC, 0x17,
+    0x18, 0x19, 0x1A, 0x22, 0x27, 0x31, 0x32, 0x34, 0x35, 0x38, 0x40, 0x01, 0xB3, 0xBC, 0x01, 0xF5,
+    0x1A, 0x00, 0xFE, 0x58, 0x01, 0xF5, 0x8A, 0x00, 0xE3, 0xA6, 0x00, 0x00, 0x58, 0x00, 0x00, 0x55,
+    0x00, 0x00, 0x30, 0x01, 0xFA, 0x91, 0x00, 0x00, 0x12, 0x00, 0x00, 0x03, 0x01, 0x7A, 0x31, 0xE1,
+    0x42, 0x01, 0xDD, 0x4B, 0xE1, 0x25, 0x01, 0xFB, 0x7E, 0xE3, 0x30, 0x32, 0x40, 0x02, 0x10, 0x49,
+    0x02, 0x10, 0x49, 0x01, 0xCC, 0x98, 0x61, 0x38, 0x02, 0x10, 0x43, 0x62, 0x32, 0x34, 0x02, 0x10,
+    0x15, 0x02, 0x0E, 0x2A, 0xE1, 0x40, 0x01, 0xBB, 0x71, 0x64, 0x01, 0x30, 0x31, 0x34, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x05, 0x01, 0xF3, 0xB1, 0x02, 0x0D, 0x5B, 0x64, 0x01, 0x04, 0x21, 0x25, 0x02,
+    0x0F, 0xF5, 0x01, 0xD2, 0x1E, 0x02, 0x10, 0x7A, 0x02, 0x10, 0x7A, 0x64, 0x01, 0x15, 0x1F, 0x25,
+    0x02, 0x10, 0x0C, 0x02, 0x10, 0x8B, 0x01, 0x84, 0xD4, 0x02, 0x10, 0x8B, 0xE3, 0x07, 0x19, 0x40,
+    0x02, 0x10, 0x9C, 0x02, 0x10, 0x9C, 0x01, 0xDE, 0x67, 0x74, 0x01, 0x04, 0x07, 0x08, 0x0A, 0x13,
+    0x14, 0x15, 0x19, 0x1B, 0x20, 0x21, 0x25, 0x27, 0x2B, 0x30, 0x40, 0x42, 0x48, 0x49, 0x00, 0x00,
+    0x9B, 0x01, 0xCE, 0x9E, 0x02, 0x10, 0xA9, 0x01, 0xE0, 0xD0, 0x01, 0xF3, 0x0F, 0x02, 0x0D, 0x3E,
+    0x00, 0x00, 0x6A, 0x01, 0xCE, 0xC4, 0x00, 0x00, 0x65, 0x02, 0x0D, 0x3E, 0x02, 0x10, 0xA9, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x53, 0x02, 0x10, 0x8D, 0x00, 0x00, 0x40, 0x02, 0x10, 0xA9, 0x00, 0x00,
+    0x2F, 0x00, 0x00, 0x1E, 0x02, 0x0A, 0xFE, 0x00, 0x00, 0x0D, 0x61, 0x2A, 0x01, 0xCF, 0xF3, 0x21,
+    0x32, 0x05, 0x61, 0x04, 0x01, 0xEF, 0xDA, 0x65, 0x01, 0x17, 0x25, 0x38, 0x40, 0x02, 0x0C, 0x45,
+    0x02, 0x10, 0xEB, 0x00, 0x00, 0x08, 0x02, 0x0E, 0xF8, 0x00, 0x00, 0x05, 0x62, 0x22, 0x40, 0x02,
+    0x11, 0x1C, 0x01, 0x51, 0x9C, 0xE9, 0x01, 0x04, 0x17, 0x22, 0x25, 0x2A, 0x2B, 0x48, 0x49, 0x02,
+    0x0F, 0xED, 0x02, 0x11, 0x25, 0x02, 0x10, 0xCA, 0x00, 0xE3, 0xB2, 0x00, 0x00, 0x1E, 0x02, 0x10,
+    0xCA, 0x02, 0x0F, 0xED, 0x02, 0x0B, 0x7A, 0x00, 0x00, 0x09, 0x41, 0x32, 0xAC, 0xD2, 0xE2, 0x14,
+    0x25, 0x01, 0xA6, 0x81, 0x01, 0xF5, 0xCB, 0xE4, 0x19, 0x28, 0x32, 0x35, 0x00, 0x00, 0x0D, 0x01,
+    0x82, 0x53, 0x00, 0x00, 0x09, 0x02, 0x11, 0x57, 0x62, 0x19, 0x34, 0x02, 0x0D, 0xFD, 0x02, 0x11,
+    0x68, 0xE2, 0x32, 0x34, 0x02, 0x11, 0x71, 0x00, 0xDE, 0x47, 0x63, 0x13, 0x14, 0x15, 0x01, 0xFC,
+    0xB4, 0x02, 0x11, 0x14, 0x02, 0x11, 0x34, 0x68, 0x01, 0x08, 0x16, 0x18, 0x1C, 0x20, 0x23, 0x25,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x1F, 0x02, 0x0E, 0x1C, 0x01, 0xE1, 0xAE, 0x02, 0x0E, 0x1C, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x0D, 0x02, 0x11, 0x86, 0x61, 0x28, 0x01, 0x9F, 0xD4, 0x21, 0x11, 0x05,
+    0xE2, 0x31, 0x42, 0x02, 0x04, 0x87, 0x02, 0x03, 0x24, 0xE4, 0x11, 0x21, 0x34, 0x35, 0x02, 0x11,
+    0x9D, 0x01, 0xF6, 0x36, 0x02, 0x11, 0xB9, 0x02, 0x11, 0xB9, 0xE1, 0x1A, 0x02, 0x10, 0xC8, 0xE3,
+    0x01, 0x21, 0x32, 0x02, 0x11, 0xCF, 0x02, 0x11, 0xCF, 0x00, 0x00, 0x05, 0x61, 0x38, 0x01, 0xFF,
+    0xB4, 0x21, 0x2D, 0x05, 0x21, 0x19, 0x03, 0x21, 0x28, 0x03, 0x21, 0x31, 0x03, 0xE2, 0x16, 0x17,
+    0x01, 0xFD, 0x27, 0x00, 0x00, 0x03, 0xE4, 0x13, 0x32, 0x34, 0x35, 0x02, 0x11, 0xF6, 0x02, 0x11,
+    0xF6, 0x01, 0xF1, 0x74, 0x02, 0x11, 0xF6, 0x61, 0x13, 0x01, 0x3F, 0x38, 0x21, 0x32, 0x05, 0x21,
+    0x20, 0x03, 0xE4, 0x19, 0x21, 0x22, 0x32, 0x01, 0xD0, 0x2D, 0x02, 0x12, 0x12, 0x02, 0x11, 0xF6,
+    0x00, 0x00, 0x03, 0x62, 0x08, 0x48, 0x02, 0x12, 0x23, 0x02, 0x12, 0x19, 0x61, 0x20, 0x01, 0xF1,
+    0xAA, 0x70, 0x01, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1E, 0x20, 0x21, 0x23, 0x27, 0x2B, 0x2C,
+    0x40, 0x42, 0x00, 0x00, 0x81, 0x00, 0x00, 0x78, 0x00, 0x00, 0x62, 0x00, 0x00, 0x44, 0x01, 0xFF,
+    0xBA, 0x00, 0xE3, 0x35, 0x02, 0x12, 0x31, 0x02, 0x05, 0x3A, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x0E, 0x01, 0xBA, 0x37, 0x01, 0x91, 0xC8, 0x01, 0xFF, 0x13, 0x00, 0x00, 0x05, 0x01,
+    0xB5, 0x49, 0xE3, 0x01, 0x14, 0x48, 0x02, 0x12, 0x72, 0x02, 0x12, 0x72, 0x02, 0x12, 0x68, 0xE5,
+    0x14, 0x2B, 0x2E, 0x42, 0x48, 0x02, 0x12, 0x7F, 0x01, 0xEB, 0xFC, 0x01, 0xDE, 0x28, 0x02, 0x04,
+    0x77, 0x02, 0x0C, 0xD4, 0x61, 0x2B, 0x02, 0x0F, 0x25, 0x21, 0x40, 0x05, 0xE5, 0x01, 0x07, 0x2B,
+    0x44, 0x48, 0x00, 0x00, 0x03, 0x02, 0x12, 0x9C, 0x02, 0x06, 0xC9, 0x01, 0xCD, 0x65, 0x02, 0x12,
+    0x92, 0x61, 0x2B, 0x02, 0x04, 0xA9, 0x21, 0x40, 0x05, 0x61, 0x1E, 0x02, 0x12, 0x53, 0xE2, 0x08,
+    0x28, 0x01, 0xDD, 0x5C, 0x02, 0x00, 0xA0, 0xA3, 0x07, 0x30, 0x32, 0x11, 0x0E, 0x09, 0x41, 0x42,
+    0x10, 0x87, 0xE4, 0x07, 0x14, 0x19, 0x48, 0x00, 0x00, 0x04, 0x02, 0x12, 0xD2, 0x02, 0x12, 0xD2,
+    0x02, 0x12, 0xD2, 0x61, 0x2B, 0x01, 0xF1, 0x82, 0x21, 0x40, 0x05, 0xE6, 0x01, 0x07, 0x14, 0x15,
+    0x48, 0x49, 0x00, 0x00, 0x03, 0x02, 0x12, 0xEB, 0x02, 0x12, 0xEB, 0x02, 0x12, 0xEB, 0x02, 0x12,
+    0xEB, 0x02, 0x12, 0xEB, 0x69, 0x07, 0x14, 0x19, 0x21, 0x22, 0x23, 0x25, 0x27, 0x48, 0x02, 0x13,
+    0x04, 0x02, 0x13, 0x04, 0x00, 0x00, 0x92, 0x00, 0x00, 0x85, 0x00, 0x00, 0x68, 0x00, 0x00, 0x3D,
+    0x00, 0x00, 0x32, 0x00, 0x00, 0x19, 0x02, 0x13, 0x04, 0x61, 0x2E, 0x01, 0x4B, 0xDF, 0x21, 0x42,
+    0x05, 0x21, 0x32, 0x03, 0x61, 0x19, 0x01, 0x11, 0xC3, 0xE3, 0x25, 0x32, 0x34, 0x00, 0x00, 0x08,
+    0x02, 0x00, 0x1B, 0x00, 0x00, 0x05, 0x61, 0x15, 0x01, 0x2D, 0x7F, 0x21, 0x2D, 0x05, 0xE1, 0x0A,
+    0x02, 0x12, 0xF0, 0x61, 0x02, 0x01, 0xE2, 0xC4, 0x62, 0x01, 0x42, 0x02, 0x12, 0x20, 0x00, 0x00,
+    0x05, 0xE1, 0x42, 0x02, 0x0F, 0x53, 0x41, 0x1B, 0xE1, 0x68, 0x21, 0x31, 0x04, 0x21, 0x15, 0x03,
+    0xE2, 0x34, 0x40, 0x01, 0xD4, 0xE7, 0x02, 0x0D, 0xBE, 0xE1, 0x32, 0x02, 0x13, 0x40, 0x61, 0x2A,
+    0x02, 0x01, 0xCF, 0x61, 0x1E, 0x01, 0xDF, 0xA9, 0x62, 0x1B, 0x40, 0x00, 0x24, 0x0E, 0x01, 0x0D,
+    0xA5, 0x41, 0x01, 0x8C, 0xD5, 0x22, 0x21, 0x42, 0x0D, 0x04, 0x22, 0x30, 0x34, 0x17, 0x05, 0xE3,
+    0x0A, 0x20, 0x4C, 0x02, 0x10, 0x34, 0x01, 0xF8, 0x1C, 0x02, 0x13, 0x9F, 0x21, 0x10, 0x0D, 0x62,
+    0x16, 0x32, 0x00, 0xB3, 0x05, 0x02, 0x13, 0x76, 0xE1, 0x21, 0x01, 0x65, 0x18, 0x21, 0x21, 0x05,
+    0x63, 0x19, 0x31, 0x4C, 0x02, 0x13, 0x6B, 0x02, 0x13, 0xB6, 0x00, 0x00, 0x03, 0xE2, 0x34, 0x36,
+    0x02, 0x13, 0xCC, 0x02, 0x13, 0xCC, 0x21, 0x23, 0x09, 0x21, 0x32, 0x03, 0x61, 0x2E, 0x02, 0x13,
+    0xC3, 0x21, 0x32, 0x05, 0xC1, 0x0B, 0xFE, 0x53, 0x21, 0x19, 0x04, 0x21, 0x48, 0x03, 0x62, 0x0B,
+    0x2A, 0x01, 0xF5, 0x2F, 0x02, 0x13, 0xEE, 0x65, 0x1B, 0x1E, 0x25, 0x27, 0x2D, 0x02, 0x04, 0x65,
+    0x00, 0x00, 0x0C, 0x00, 0x55, 0x8C, 0x01, 0xF6, 0xA4, 0x00, 0x00, 0x09, 0x61, 0x2E, 0x01, 0xC0,
+    0x66, 0x62, 0x27, 0x48, 0x02, 0x13, 0xC2, 0x02, 0x13, 0xAB, 0xE3, 0x07, 0x2D, 0x42, 0x02, 0x14,
+    0x1A, 0x00, 0x00, 0x09, 0x01, 0x8B, 0xFB, 0x63, 0x16, 0x25, 0x2E, 0x02, 0x14, 0x1D, 0x02, 0x12,
+    0x18, 0x02, 0x14, 0x27, 0xE4, 0x01, 0x2D, 0x40, 0x42, 0x02, 0x14, 0x34, 0x01, 0xCD, 0xA5, 0x00,
+    0x74, 0x01, 0x00, 0x00, 0x0D, 0xFE, 0x01, 0x04, 0x06, 0x07, 0x0A, 0x10, 0x14, 0x15, 0x19, 0x1A,
+    0x1B, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x40, 0x42, 0x44,
+    0x48, 0x49, 0x4A, 0x4B, 0x00, 0x01, 0x0C, 0x00, 0x00, 0xFA, 0x00, 0x00, 0xF7, 0x00, 0x00, 0xED,
+    0x01, 0x4E, 0xC6, 0x02, 0x14, 0x45, 0x00, 0x00, 0xE4, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD5, 0x02,
+    0x04, 0x6B, 0x02, 0x13, 0xF0, 0x01, 0xD4, 0x9C, 0x01, 0x40, 0xA5, 0x00, 0x00, 0xCC, 0x02, 0x14,
+    0x45, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xAB, 0x01, 0xF6, 0x56, 0x00, 0x00, 0x99, 0x00, 0x00, 0x96,
+    0x00, 0x00, 0x85, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x64, 0x00, 0x00, 0x4E, 0x01, 0xAD, 0x62, 0x00,
+    0x00, 0x39, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x11, 0x02, 0x0E, 0x2D, 0x02, 0x14, 0x45, 0xE2, 0x2D,
+    0x2E, 0x02, 0x12, 0x72, 0x02, 0x14, 0xBA, 0x61, 0x32, 0x01, 0xEF, 0xCC, 0x61, 0x1E, 0x02, 0x12,
+    0x9B, 0xA1, 0x40, 0x05, 0x61, 0x15, 0x02, 0x01, 0xB6, 0x62, 0x15, 0x40, 0x02, 0x14, 0xBD, 0x00,
+    0x00, 0x05, 0x61, 0x47, 0x02, 0x14, 0x84, 0x21, 0x15, 0x05, 0x41, 0x19, 0x73, 0x49, 0xE8, 0x01,
+    0x1A, 0x21, 0x25, 0x2A, 0x30, 0x40, 0x42, 0x00, 0x00, 0x30, 0x00, 0x00, 0x27, 0x00, 0x00, 0x1D,
+    0x01, 0x72, 0x4C, 0x00, 0x00, 0x15, 0x02, 0x14, 0xEE, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x5F,
+    0x20, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2D,
+    0x2E, 0x15, 0xF3, 0x15, 0x64, 0x13, 0xB5, 0x13, 0x37, 0x13, 0x12, 0x12, 0xB5, 0x12, 0x58, 0x11,
+    0xC3, 0x10, 0xD9, 0x10, 0x5F, 0x0F, 0xEC, 0x0F, 0xA0, 0x0E, 0xFC, 0x0E, 0xB7, 0x0E, 0x46, 0x0D,
+    0xB4, 0x0C, 0x32, 0x0B, 0xBD, 0x0A, 0x21, 0x09, 0x7A, 0x09, 0x29, 0x07, 0xBD, 0x07, 0x05, 0x05,
+    0xAB, 0x04, 0x66, 0x03, 0xEA, 0x03, 0x88, 0x03, 0x62, 0x02, 0xDE, 0x02, 0x0B, 0x00, 0xCA, 0x00,
+    0x21, 0xE1, 0x48, 0x01, 0xDD, 0x22, 0x21, 0x23, 0x05, 0x62, 0x27, 0x2D, 0x02, 0x0C, 0x2B, 0x02,
+    0x15, 0x79, 0x62, 0x33, 0x35, 0x02, 0x15, 0x82, 0x02, 0x15, 0x82, 0x62, 0x32, 0x38, 0x02, 0x15,
+    0x52, 0x01, 0xF8, 0xAF, 0x62, 0x32, 0x37, 0x02, 0x15, 0x94, 0x02, 0x15, 0x3F, 0x61, 0x49, 0x01,
+    0x0A, 0xF6, 0x62, 0x32, 0x35, 0x02, 0x12, 0x37, 0x02, 0x14, 0xE7, 0x67, 0x14, 0x15, 0x1A, 0x1E,
+    0x22, 0x23, 0x2A, 0x02, 0x02, 0x79, 0x02, 0x10, 0x65, 0x02, 0x15, 0x45, 0x01, 0xF2, 0x34, 0x01,
+    0xC3, 0xFF, 0x00, 0x8A, 0x61, 0x00, 0x00, 0x09, 0x64, 0x02, 0x04, 0x15, 0x1B, 0x01, 0xFD, 0xD8,
+    0x02, 0x11, 0xB0, 0x02, 0x15, 0xC7, 0x02, 0x00, 0x83, 0xF6, 0x01, 0x02, 0x04, 0x07, 0x08, 0x0A,
+    0x14, 0x15, 0x16, 0x19, 0x1A, 0x1B, 0x1D, 0x21, 0x23, 0x25, 0x2A, 0x2B, 0x2D, 0x40, 0x41, 0x42,
+    0x02, 0x0F, 0x37, 0x01, 0xAB, 0x2D, 0x00, 0x00, 0x60, 0x01, 0xEE, 0x4B, 0x01, 0xE3, 0x3F, 0x01,
+    0xDE, 0x21, 0x00, 0x00, 0x57, 0x01, 0xE6, 0xDC, 0x01, 0xE9, 0x8B, 0x02, 0x0A, 0xE9, 0x00, 0x00,
+    0x4E, 0x01, 0xF5, 0x39, 0x01, 0xE1, 0xFF, 0x00, 0x00, 0x45, 0x00, 0x00, 0x3C, 0x02, 0x11, 0xCB,
+    0x01, 0xB9, 0x03, 0x02, 0x13, 0xAF, 0x02, 0x03, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x11, 0x02,
+    0x12, 0xCB, 0xE4, 0x1A, 0x2A, 0x43, 0x44, 0x02, 0x15, 0xF9, 0x02, 0x12, 0x24, 0x02, 0x12, 0x1A,
+    0x01, 0xED, 0x03, 0x62, 0x48, 0x49, 0x02, 0x16, 0x43, 0x00, 0x00, 0x11, 0xE3, 0x14, 0x16, 0x40,
+    0x01, 0xFB, 0xDE, 0x01, 0xE5, 0x8B, 0x01, 0xA1, 0xBE, 0x21, 0x49, 0x0D, 0xE3, 0x01, 0x2B, 0x44,
+    0x01, 0xFB, 0x6C, 0x01, 0xEE, 0x12, 0x01, 0xDB, 0xEC, 0xE1, 0x38, 0x02, 0x16, 0x30, 0x21, 0x19,
+    0x05, 0x62, 0x32, 0x33, 0x02, 0x16, 0x13, 0x02, 0x16, 0x71, 0x61, 0x2A, 0x02, 0x11, 0xF0, 0x21,
+    0x32, 0x05, 0x63, 0x23, 0x2D, 0x32, 0x00, 0x00, 0x03, 0x02, 0x16, 0x78, 0x02, 0x16, 0x24, 0x62,
+    0x2D, 0x38, 0x02, 0x16, 0x8E, 0x01, 0xF9, 0xB3, 0x63, 0x01, 0x23, 0x25, 0x02, 0x16, 0x98, 0x02,
+    0x14, 0x4C, 0x02, 0x06, 0xCB, 0x62, 0x30, 0x31, 0x02, 0x05, 0x04, 0x02, 0x12, 0x8D, 0x62, 0x2D,
+    0x31, 0x02, 0x16, 0xAE, 0x00, 0x04, 0x8B, 0x62, 0x19, 0x38, 0x02, 0x11, 0xF5, 0x02, 0x0F, 0x7E,
+    0x62, 0x07, 0x1A, 0x01, 0xFC, 0x52, 0x02, 0x13, 0xD8, 0x63, 0x02, 0x14, 0x17, 0x01, 0xFE, 0xD9,
+    0x02, 0x16, 0xBF, 0x02, 0x12, 0xC5, 0xF3, 0x02, 0x08, 0x0E, 0x14, 0x15, 0x17, 0x19, 0x1A, 0x1B,
+    0x1E, 0x23, 0x25, 0x2A, 0x2B, 0x40, 0x41, 0x42, 0x44, 0x49, 0x00, 0x00, 0x68, 0x02, 0x15, 0xCA,
+    0x01, 0xAC, 0x0D, 0x00, 0x00, 0x65, 0x00, 0x00, 0x54, 0x02, 0x15, 0xCA, 0x02, 0x16, 0xD2, 0x00,
+    0x00, 0x47, 0x00, 0x00, 0x3E, 0x02, 0x16, 0x84, 0x00, 0x00, 0x31, 0x02, 0x16, 0x70, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0D, 0x02, 0x13, 0xA3, 0x02, 0x03, 0x6E,
+    0x02, 0x16, 0xD6, 0xE4, 0x15, 0x1D, 0x2A, 0x43, 0x01, 0xE8, 0x26, 0x02, 0x16, 0x21, 0x01, 0xBA,
+    0x4D, 0x02, 0x14, 0xF2, 0x21, 0x48, 0x11, 0xE3, 0x1F, 0x22, 0x2B, 0x02, 0x12, 0x75, 0x02, 0x16,
+    0x2B, 0x01, 0xFC, 0xC9, 0x62, 0x1F, 0x2A, 0x02, 0x17, 0x44, 0x02, 0x16, 0xC5, 0xE3, 0x22, 0x43,
+    0x44, 0x02, 0x16, 0xE7, 0x02, 0x15, 0x1C, 0x00, 0x00, 0x09, 0xA1, 0x48, 0x0D, 0x61, 0x15, 0x02,
+    0x15, 0x33, 0xE3, 0x01, 0x17, 0x2B, 0x02, 0x16, 0x2A, 0x02, 0x14, 0xD2, 0x02, 0x16, 0xFC, 0x64,
+    0x0D, 0x21, 0x25, 0x49, 0x02, 0x16, 0xDE, 0x02, 0x16, 0xDE, 0x00, 0x00, 0x12, 0x00, 0x00, 0x0D,
+    0x6C, 0x01, 0x04, 0x08, 0x0A, 0x14, 0x15, 0x19, 0x1A, 0x1D, 0x22, 0x2A, 0x2B, 0x01, 0xE5, 0x4B,
+    0x00, 0x02, 0x0A, 0x00, 0x01, 0xA7, 0x00, 0x01, 0x3D, 0x02, 0x17, 0x80, 0x00, 0x01, 0x27, 0x00,
+    0x01, 0x24, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x49, 0x00, 0x00, 0x26, 0x00, 0x00,
+    0x11, 0xE4, 0x1E, 0x25, 0x28, 0x2A, 0x02, 0x17, 0xB1, 0x01, 0xFC, 0x8C, 0x01, 0xAA, 0x3C, 0x02,
+    0x17, 0x6B, 0x61, 0x04, 0x01, 0x0C, 0x7B, 0xE2, 0x42, 0x48, 0x00, 0x00, 0x05, 0x02, 0x17, 0xC7,
+    0x41, 0x19, 0x6B, 0xD8, 0x21, 0x32, 0x04, 0x21, 0x04, 0x03, 0x21, 0x40, 0x03, 0x21, 0x4C, 0x03,
+    0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x21, 0x01, 0x03, 0xE7, 0x01, 0x0A, 0x19, 0x1B, 0x1F, 0x42,
+    0x44, 0x02, 0x0F, 0xC8, 0x02, 0x17, 0xB0, 0x02, 0x17, 0x83, 0x02, 0x15, 0x59, 0x02, 0x13, 0x27,
+    0x01, 0xD1, 0x52, 0x01, 0xD2, 0xB2, 0xE1, 0x14, 0x02, 0x17, 0xEA, 0xEA, 0x14, 0x1E, 0x23, 0x25,
+    0x27, 0x40, 0x48, 0x49, 0x4A, 0x4B, 0x02, 0x17, 0xEF, 0x01, 0xD6, 0x00, 0x00, 0x00, 0x5A, 0x00,
+    0x00, 0x44, 0x01, 0x0E, 0x99, 0x00, 0x00, 0x25, 0x00, 0x00, 0x22, 0x02, 0x18, 0x0B, 0x00, 0x00,
+    0x05, 0x01, 0x56, 0xFE, 0x61, 0x14, 0x01, 0xA5, 0x6D, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0xE1,
+    0x40, 0x02, 0x18, 0x3F, 0x62, 0x48, 0x49, 0x02, 0x18, 0x44, 0x00, 0x00, 0x05, 0x61, 0x2B, 0x01,
+    0x88, 0xAD, 0x21, 0x19, 0x05, 0x62, 0x31, 0x37, 0x00, 0x00, 0x03, 0x02, 0x18, 0x00, 0xE6, 0x14,
+    0x19, 0x1B, 0x21, 0x2B, 0x41, 0x02, 0x17, 0x5C, 0x01, 0xF7, 0xBE, 0x02, 0x10, 0x63, 0x01, 0xEC,
+    0xF3, 0x01, 0xFD, 0xF0, 0x01, 0xCB, 0xAC, 0x61, 0x1A, 0x01, 0xE5, 0x99, 0x21, 0x14, 0x05, 0x62,
+    0x2D, 0x48, 0x00, 0x00, 0x03, 0x02, 0x18, 0x19, 0xE6, 0x01, 0x1B, 0x1E, 0x2B, 0x41, 0x43, 0x01,
+    0x56, 0xFD, 0x00, 0x00, 0x09, 0x01, 0x94, 0xBF, 0x02, 0x17, 0x7F, 0x01, 0xA2, 0x70, 0x02, 0x16,
+    0x57, 0xEA, 0x01, 0x02, 0x04, 0x23, 0x27, 0x29, 0x2A, 0x2B, 0x48, 0x49, 0x00, 0x00, 0x65, 0x02,
+    0x18, 0x49, 0x02, 0x10, 0xBF, 0x02, 0x18, 0x3B, 0x00, 0x00, 0x5D, 0x02, 0x17, 0xE6, 0x00, 0x00,
+    0x4C, 0x02, 0x18, 0x88, 0x00, 0x00, 0x43, 0x00, 0x00, 0x19, 0x62, 0x42, 0x49, 0x01, 0xB0, 0xCB,
+    0x02, 0x18, 0xCA, 0x61, 0x47, 0x02, 0x0B, 0xAA, 0x21, 0x2D, 0x05, 0x61, 0x21, 0x01, 0xDA, 0x52,
+    0x41, 0x2A, 0x38, 0x4A, 0x21, 0x19, 0x04, 0x21, 0x2D, 0x03, 0x63, 0x04, 0x0B, 0x41, 0x01, 0xDB,
+    0x1E, 0x00, 0x76, 0x65, 0x00, 0x00, 0x03, 0x21, 0x19, 0x0D, 0xE5, 0x04, 0x40, 0x41, 0x42, 0x49,
+    0x02, 0x10, 0xFF, 0x00, 0x00, 0x22, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x02, 0x18, 0xFA, 0x61,
+    0x17, 0x01, 0xE1, 0xC3, 0x21, 0x42, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x2D, 0x03, 0xE7, 0x22, 0x23,
+    0x25, 0x27, 0x41, 0x42, 0x49, 0x01, 0xB1, 0xBC, 0x00, 0x00, 0x53, 0x00, 0x00, 0x23, 0x00, 0xFC,
+    0x33, 0x00, 0x00, 0x03, 0x02, 0x18, 0xD7, 0x02, 0x19, 0x1D, 0xE2, 0x23, 0x49, 0x02, 0x19, 0x3A,
+    0x01, 0xF3, 0xA6, 0x63, 0x19, 0x40, 0x44, 0x02, 0x19, 0x43, 0x00, 0x6F, 0x51, 0x02, 0x18, 0xE5,
+    0xE4, 0x17, 0x27, 0x32, 0x40, 0x02, 0x0C, 0x59, 0x02, 0x18, 0xF5, 0x02, 0x19, 0x50, 0x01, 0xAE,
+    0xBD, 0xE4, 0x19, 0x22, 0x40, 0x42, 0x02, 0x15, 0xF6, 0x00, 0x00, 0x11, 0x02, 0x13, 0xAF, 0x02,
+    0x18, 0xA6, 0x61, 0x14, 0x01, 0xFA, 0xB3, 0x21, 0x32, 0x05, 0x21, 0x25, 0x03, 0x63, 0x31, 0x32,
+    0x4C, 0x02, 0x06, 0x5F, 0x01, 0xF8, 0x31, 0x02, 0x19, 0x7D, 0x62, 0x23, 0x31, 0x01, 0xD7, 0xA5,
+    0x02, 0x19, 0x51, 0x61, 0x44, 0x02, 0x09, 0x76, 0x21, 0x32, 0x05, 0x63, 0x2D, 0x31, 0x49, 0x02,
+    0x06, 0x7D, 0x02, 0x19, 0x88, 0x02, 0x19, 0x9B, 0x63, 0x01, 0x1A, 0x23, 0x01, 0xF4, 0x6C, 0x01,
+    0xFC, 0x55, 0x02, 0x19, 0x6F, 0xE1, 0x25, 0x02, 0x19, 0x7C, 0x61, 0x40, 0x01, 0xE8, 0xF5, 0x21,
+    0x34, 0x05, 0xA1, 0x21, 0x03, 0x22, 0x04, 0x25, 0x10, 0x03, 0x61, 0x07, 0x02, 0x07, 0x2D, 0xED,
+    0x04, 0x0A, 0x15, 0x19, 0x1A, 0x1B, 0x22, 0x23, 0x2A, 0x40, 0x42, 0x48, 0x49, 0x00, 0x00, 0x55,
+    0x02, 0x19, 0xB6, 0x02, 0x19, 0xB3, 0x00, 0x00, 0x52, 0x01, 0xD6, 0xA4, 0x00, 0x00, 0x45, 0x00,
+    0x00, 0x37, 0x00, 0x00, 0x34, 0x02, 0x19, 0xB3, 0x00, 0x00, 0x27, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x05, 0x02, 0x19, 0xCF, 0x63, 0x21, 0x42, 0x44, 0x02, 0x17, 0x1C, 0x02, 0x17, 0xF5, 0x00, 0xE0,
+    0xF1, 0x21, 0x32, 0x0D, 0x63, 0x27, 0x40, 0x4C, 0x02, 0x19, 0xF8, 0x01, 0xB2, 0xA2, 0x02, 0x04,
+    0x9E, 0x62, 0x40, 0x44, 0x01, 0xF8, 0x69, 0x01, 0xD7, 0xFC, 0x21, 0x1B, 0x09, 0x61, 0x2D, 0x01,
+    0xDB, 0xA4, 0x21, 0x47, 0x05, 0xA1, 0x1A, 0x03, 0x62, 0x01, 0x04, 0x00, 0x00, 0x03, 0x02, 0x1A,
+    0x38, 0x21, 0x2D, 0x09, 0x21, 0x47, 0x03, 0x63, 0x17, 0x25, 0x41, 0x00, 0x39, 0x93, 0x00, 0x00,
+    0x03, 0x01, 0x7C, 0xDC, 0x62, 0x19, 0x23, 0x02, 0x17, 0xC4, 0x01, 0xB6, 0x2B, 0x64, 0x2D, 0x30,
+    0x31, 0x32, 0x00, 0x00, 0x33, 0x00, 0x00, 0x16, 0x02, 0x19, 0xFF, 0x00, 0x00, 0x09, 0x61, 0x23,
+    0x01, 0xB5, 0xD8, 0x61, 0x23, 0x01, 0xB6, 0x4A, 0x21, 0x2D, 0x05, 0x22, 0x15, 0x17, 0x0D, 0x03,
+    0x61, 0x17, 0x01, 0xB6, 0xF3, 0x62, 0x40, 0x42, 0x01, 0xE0, 0xD6, 0x01, 0xC6, 0xF5, 0x22, 0x01,
+    0x04, 0x0E, 0x09, 0x22, 0x01, 0x47, 0x18, 0x05, 0x63, 0x08, 0x23, 0x2D, 0x01, 0x06, 0x48, 0x00,
+    0x00, 0x05, 0x01, 0xE3, 0x73, 0x62, 0x25, 0x2A, 0x02, 0x0A, 0x1B, 0x01, 0x6F, 0x68, 0x42, 0x0B,
+    0x2D, 0x0D, 0x95, 0x00, 0x09, 0x61, 0x2A, 0x02, 0x19, 0xBF, 0x21, 0x40, 0x05, 0x21, 0x19, 0x03,
+    0x62, 0x35, 0x48, 0x02, 0x04, 0xBA, 0x02, 0x1A, 0x5A, 0xE6, 0x01, 0x17, 0x22, 0x2A, 0x41, 0x43,
+    0x02, 0x19, 0x91, 0x00, 0x00, 0x09, 0x02, 0x00, 0x5B, 0x01, 0xF5, 0xED, 0x02, 0x18, 0x73, 0x02,
+    0x18, 0x98, 0xE8, 0x19, 0x21, 0x23, 0x2D, 0x40, 0x41, 0x42, 0x49, 0x00, 0x00, 0xD1, 0x01, 0x06,
+    0xA2, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x85, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x34, 0x00, 0x00, 0x25,
+    0x00, 0x00, 0x19, 0x41, 0x2D, 0x0D, 0xF6, 0x21, 0x0B, 0x04, 0x21, 0x40, 0x03, 0x21, 0x35, 0x03,
+    0x21, 0x25, 0x03, 0x62, 0x28, 0x34, 0x02, 0x1B, 0x13, 0x02, 0x17, 0xE0, 0x61, 0x34, 0x01, 0xA4,
+    0xA0, 0x63, 0x1E, 0x32, 0x39, 0x02, 0x1B, 0x21, 0x01, 0x40, 0x0E, 0x01, 0xE2, 0x4B, 0x62, 0x32,
+    0x34, 0x02, 0x08, 0x10, 0x02, 0x1A, 0x79, 0xE1, 0x19, 0x01, 0xFF, 0xCB, 0x21, 0x4C, 0x05, 0x21,
+    0x19, 0x03, 0x21, 0x15, 0x03, 0x62, 0x07, 0x31, 0x02, 0x08, 0x7F, 0x00, 0x00, 0x03, 0x41, 0x34,
+    0x7E, 0x07, 0x61, 0x1E, 0x02, 0x19, 0x54, 0x61, 0x15, 0x01, 0xDA, 0x08, 0xEE, 0x01, 0x15, 0x17,
+    0x1B, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x2A, 0x40, 0x42, 0x48, 0x00, 0x00, 0x4C, 0x02, 0x1A,
+    0xF3, 0x00, 0x00, 0x49, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x2E, 0x02, 0x1B, 0x5C,
+    0x00, 0x00, 0x17, 0x01, 0xC2, 0xE0, 0x01, 0x90, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0A, 0x02,
+    0x01, 0x99, 0x00, 0x00, 0x05, 0xE5, 0x04, 0x16, 0x25, 0x2A, 0x44, 0x01, 0xE5, 0x59, 0x02, 0x12,
+    0x47, 0x01, 0xD5, 0x06, 0x02, 0x0F, 0xC2, 0x02, 0x08, 0x2D, 0xE4, 0x01, 0x1D, 0x2B, 0x44, 0x02,
+    0x16, 0x54, 0x01, 0xB0, 0xFE, 0x01, 0xB9, 0x9A, 0x02, 0x06, 0x34, 0xE6, 0x1B, 0x23, 0x40, 0x48,
+    0x49, 0x4B, 0x02, 0x13, 0xC0, 0x00, 0x00, 0x5F, 0x00, 0x98, 0x7B, 0x00, 0x00, 0x26, 0x00, 0x00,
+    0x11, 0x02, 0x1B, 0xBB, 0xE2, 0x16, 0x1A, 0x02, 0x16, 0x22, 0x00, 0xFE, 0xA2, 0xE1, 0x01, 0x02,
+    0x16, 0x87, 0xE9, 0x01, 0x07, 0x14, 0x19, 0x22, 0x25, 0x41, 0x48, 0x49, 0x01, 0xBC, 0x4C, 0x02,
+    0x1B, 0xE2, 0x02, 0x18, 0x77, 0x02, 0x1B, 0x7C, 0x02, 0x1B, 0xE2, 0x02, 0x1B, 0xE2, 0x01, 0x63,
+    0xB7, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x05, 0x61, 0x35, 0x01, 0xE2, 0xB6, 0x21, 0x19, 0x05, 0x21,
+    0x01, 0x03, 0x21, 0x21, 0x03, 0x21, 0x41, 0x03, 0x21, 0x19, 0x03, 0x62, 0x42, 0x44, 0x00, 0x00,
+    0x03, 0x02, 0x0E, 0xF2, 0x41, 0x2D, 0x84, 0x47, 0x21, 0x2D, 0x04, 0x21, 0x19, 0x03, 0x22, 0x30,
+    0x31, 0x13, 0x03, 0x61, 0x32, 0x01, 0x9D, 0xB2, 0x62, 0x01, 0x10, 0x01, 0xFC, 0x92, 0x02, 0x1C,
+    0x38, 0x41, 0x21, 0xED, 0xD8, 0x22, 0x31, 0x48, 0x0D, 0x04, 0x61, 0x28, 0x01, 0x7F, 0x3B, 0x21,
+    0x23, 0x05, 0x21, 0x15, 0x03, 0x21, 0x34, 0x03, 0x21, 0x08, 0x03, 0x21, 0x34, 0x03, 0x61, 0x21,
+    0x01, 0x1C, 0x3D, 0x21, 0x14, 0x05, 0xE8, 0x14, 0x17, 0x18, 0x22, 0x23, 0x27, 0x2B, 0x44, 0x02,
+    0x15, 0x78, 0x02, 0x1C, 0x0B, 0x02, 0x01, 0x72, 0x00, 0x00, 0x33, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x0B, 0x01, 0xE5, 0xEE, 0x00, 0x00, 0x03, 0x61, 0x21, 0x01, 0x74, 0x1D, 0x62, 0x22, 0x31, 0x02,
+    0x0C, 0x73, 0x00, 0x00, 0x05, 0xE8, 0x07, 0x14, 0x17, 0x19, 0x1A, 0x2D, 0x42, 0x4C, 0x02, 0x13,
+    0x47, 0x00, 0x29, 0x94, 0x02, 0x1B, 0x89, 0x02, 0x11, 0xA5, 0x02, 0x1A, 0xE0, 0x00, 0x00, 0x09,
+    0x01, 0xFB, 0xBE, 0x02, 0x1C, 0x95, 0x62, 0x23, 0x40, 0x02, 0x19, 0xA8, 0x01, 0xF1, 0x80, 0x62,
+    0x17, 0x1B, 0x00, 0x00, 0x09, 0x02, 0x1C, 0xBF, 0xE9, 0x01, 0x17, 0x1F, 0x22, 0x23, 0x27, 0x40,
+    0x41, 0x49, 0x02, 0x1C, 0x73, 0x00, 0x00, 0x9A, 0x01, 0xE3, 0x8F, 0x00, 0x00, 0x62, 0x00, 0x00,
+    0x33, 0x02, 0x19, 0x5D, 0x00, 0x00, 0x09, 0x00, 0xEF, 0x3F, 0x02, 0x1C, 0xC8, 0x61, 0x04, 0x02,
+    0x0E, 0xE1, 0x21, 0x4C, 0x05, 0x61, 0x1A, 0x02, 0x1C, 0x2F, 0x63, 0x15, 0x23, 0x2D, 0x01, 0x11,
+    0xAF, 0x00, 0x00, 0x05, 0x00, 0x88, 0x36, 0xE5, 0x08, 0x15, 0x25, 0x40, 0x42, 0x01, 0xD9, 0xDC,
+    0x00, 0x00, 0x15, 0x00, 0x96, 0xBD, 0x01, 0x8E, 0x47, 0x00, 0x00, 0x0D, 0x61, 0x27, 0x01, 0xF5,
+    0xD3, 0x21, 0x31, 0x05, 0x21, 0x0A, 0x03, 0x21, 0x4C, 0x03, 0x21, 0x0B, 0x03, 0x62, 0x01, 0x04,
+    0x00, 0x00, 0x03, 0x01, 0xE0, 0x37, 0x62, 0x0B, 0x1A, 0x00, 0x00, 0x09, 0x01, 0xF7, 0xFA, 0x61,
+    0x27, 0x01, 0x93, 0x53, 0x62, 0x17, 0x2D, 0x00, 0x00, 0x05, 0x01, 0xE3, 0xF3, 0x67, 0x15, 0x19,
+    0x23, 0x2D, 0x40, 0x42, 0x48, 0x02, 0x1D, 0x31, 0x01, 0xCA, 0xDF, 0x01, 0xFD, 0x17, 0x01, 0xFC,
+    0x92, 0x00, 0x00, 0x17, 0x00, 0x00, 0x09, 0x01, 0xE1, 0x26, 0xE3, 0x01, 0x32, 0x34, 0x02, 0x1D,
+    0x04, 0x02, 0x1D, 0x0C, 0x02, 0x0B, 0xC9, 0x62, 0x23, 0x31, 0x01, 0xC5, 0x81, 0x02, 0x1C, 0xC2,
+    0x65, 0x1A, 0x20, 0x27, 0x32, 0x4C, 0x00, 0x00, 0x09, 0x02, 0x1D, 0x5B, 0x01, 0x98, 0xD8, 0x02,
+    0x1D, 0x37, 0x02, 0x1D, 0x80, 0x21, 0x22, 0x15, 0x21, 0x35, 0x03, 0x21, 0x13, 0x03, 0x63, 0x29,
+    0x2D, 0x40, 0x00, 0x00, 0x03, 0x02, 0x1D, 0x38, 0x01, 0x30, 0xBD, 0x62, 0x32, 0x48, 0x02, 0x1D,
+    0x5C, 0x02, 0x1D, 0xAB, 0x61, 0x32, 0x01, 0xFD, 0xDA, 0xE8, 0x17, 0x1B, 0x22, 0x23, 0x25, 0x28,
+    0x48, 0x4B, 0x01, 0xA5, 0x80, 0x02, 0x1D, 0x9D, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x1B, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x05, 0x02, 0x1D, 0xB9, 0x02, 0x1D, 0xB9, 0x61, 0x21, 0x01, 0xFE, 0x0D, 0x21,
+    0x14, 0x05, 0x21, 0x38, 0x03, 0xA1, 0x2D, 0x03, 0x61, 0x4C, 0x01, 0xFF, 0xC2, 0x21, 0x2B, 0x05,
+    0x21, 0x07, 0x03, 0x21, 0x34, 0x03, 0xE3, 0x1C, 0x2A, 0x40, 0x02, 0x1B, 0xD3, 0x00, 0x00, 0x03,
+    0x01, 0xAB, 0xE5, 0xA2, 0x17, 0x48, 0x1E, 0x0D, 0x61, 0x4A, 0x02, 0x13, 0xC8, 0x62, 0x2D, 0x49,
+    0x02, 0x1E, 0x0C, 0x02, 0x1D, 0xA7, 0x61, 0x32, 0x01, 0x01, 0x2C, 0x62, 0x31, 0x4C, 0x02, 0x1D,
+    0xF9, 0x02, 0x1E, 0x1B, 0x41, 0x01, 0xF8, 0xD7, 0x41, 0x23, 0x69, 0xBA, 0xE2, 0x1E, 0x2A, 0x02,
+    0x1D, 0xCE, 0x02, 0x1C, 0x1D, 0xF1, 0x08, 0x0A, 0x11, 0x17, 0x1A, 0x21, 0x27, 0x2A, 0x2D, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x39, 0x40, 0x48, 0x02, 0x01, 0x34, 0x02, 0x1D, 0xFC, 0x00, 0xE8, 0x17,
+    0x02, 0x1D, 0x6F, 0x01, 0xF1, 0xE7, 0x00, 0x00, 0x1F, 0x02, 0x1D, 0x33, 0x00, 0x00, 0x1A, 0x00,
+    0x00, 0x11, 0x02, 0x01, 0x7D, 0x00, 0x00, 0x0D, 0x02, 0x1E, 0x35, 0x02, 0x1D, 0xFC, 0x02, 0x1E,
+    0x35, 0x02, 0x1E, 0x35, 0x00, 0xD7, 0x93, 0x00, 0x00, 0x09, 0x61, 0x19, 0x01, 0x77, 0x2F, 0xE3,
+    0x2D, 0x34, 0x48, 0x02, 0x1B, 0x71, 0x00, 0x00, 0x05, 0x02, 0x1E, 0x7F, 0x62, 0x02, 0x25, 0x02,
+    0x1E, 0x8C, 0x02, 0x0E, 0xB2, 0x21, 0x32, 0x09, 0x62, 0x1E, 0x34, 0x02, 0x1E, 0x98, 0x01, 0xE2,
+    0x02, 0x62, 0x17, 0x32, 0x01, 0xF9, 0x7C, 0x02, 0x1B, 0x36, 0x63, 0x1E, 0x23, 0x28, 0x02, 0x19,
+    0x7F, 0x00, 0x00, 0x09, 0x01, 0xFA, 0xAB, 0x66, 0x04, 0x08, 0x1B, 0x1F, 0x21, 0x25, 0x01, 0xE0,
+    0xEB, 0x02, 0x14, 0x4D, 0x02, 0x1E, 0xB7, 0x00, 0x23, 0x61, 0x00, 0x3A, 0xD4, 0x00, 0x23, 0xFD,
+    0x62, 0x14, 0x23, 0x02, 0x1E, 0x8A, 0x00, 0x00, 0x19, 0xE2, 0x1B, 0x44, 0x00, 0x00, 0xD1, 0x02,
+    0x09, 0x63, 0xF4, 0x01, 0x04, 0x08, 0x0A, 0x11, 0x17, 0x19, 0x1A, 0x1B, 0x1E, 0x21, 0x23, 0x25,
+    0x28, 0x2A, 0x2B, 0x40, 0x42, 0x44, 0x48, 0x02, 0x1A, 0x20, 0x02, 0x1E, 0x7C, 0x02, 0x01, 0xE1,
+    0x02, 0x1E, 0xA9, 0x00, 0xE8, 0xC4, 0x02, 0x1E, 0x1C, 0x01, 0xFE, 0xAC, 0x01, 0xCE, 0x8A, 0x00,
+    0x00, 0xDA, 0x01, 0xC6, 0xE8, 0x00, 0x00, 0xD5, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x63, 0x00, 0x00,
+    0x4D, 0x00, 0x00, 0x4A, 0x02, 0x1D, 0xAA, 0x00, 0x00, 0x38, 0x00, 0x00, 0x12, 0x02, 0x1A, 0xB9,
+    0x00, 0x00, 0x09, 0x61, 0x41, 0x02, 0x0C, 0x15, 0x21, 0x30, 0x05, 0x21, 0x23, 0x03, 0xC2, 0x01,
+    0x2A, 0x00, 0x03, 0x62, 0xFA, 0x21, 0x32, 0x07, 0x21, 0x49, 0x03, 0x41, 0x27, 0x68, 0x0E, 0x21,
+    0x4C, 0x04, 0x62, 0x17, 0x4C, 0x02, 0x1F, 0x36, 0x02, 0x1F, 0x52, 0x62, 0x0A, 0x19, 0x01, 0xE2,
+    0x8C, 0x01, 0x96, 0x40, 0x41, 0x1A, 0xD8, 0x54, 0xEA, 0x09, 0x17, 0x18, 0x19, 0x1F, 0x23, 0x25,
+    0x40, 0x41, 0x42, 0x02, 0x1D, 0x3E, 0x02, 0x1F, 0x4C, 0x01, 0x8A, 0x63, 0x01, 0xDD, 0x5D, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x19, 0x00, 0x00, 0x16, 0x01, 0xAE, 0x8B, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x04, 0x61, 0x35, 0x01, 0x04, 0xA2, 0x21, 0x23, 0x05, 0x41, 0x35, 0x2D, 0xD4, 0x21, 0x14, 0x04,
+    0x21, 0x1A, 0x03, 0x62, 0x34, 0x4C, 0x00, 0x00, 0x03, 0x02, 0x1F, 0xA3, 0x62, 0x01, 0x19, 0x01,
+    0x70, 0x9F, 0x02, 0x02, 0x59, 0x41, 0x2D, 0x3B, 0xE0, 0x61, 0x34, 0x01, 0x76, 0xB5, 0x41, 0x2D,
+    0xB5, 0xAF, 0x63, 0x1E, 0x21, 0x27, 0x00, 0x00, 0x04, 0x02, 0x1F, 0x0D, 0x02, 0x0A, 0x4C, 0x62,
+    0x04, 0x25, 0x01, 0xDC, 0x83, 0x02, 0x1B, 0xAA, 0xE8, 0x01, 0x0B, 0x1F, 0x21, 0x25, 0x40, 0x42,
+    0x44, 0x01, 0xFA, 0xB3, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1F, 0x01, 0x71, 0x38, 0x02, 0x02, 0xD7,
+    0x00, 0x00, 0x16, 0x02, 0x0D, 0xA9, 0x00, 0x00, 0x09, 0x21, 0x23, 0x21, 0x62, 0x01, 0x04, 0x01,
+    0xDD, 0x23, 0x00, 0x00, 0x03, 0xE5, 0x17, 0x21, 0x23, 0x2A, 0x43, 0x02, 0x1F, 0x03, 0x02, 0x1F,
+    0x3F, 0x01, 0xE9, 0xC9, 0x01, 0xE9, 0xC9, 0x01, 0x25, 0x1C, 0x62, 0x07, 0x27, 0x02, 0x20, 0x1A,
+    0x02, 0x15, 0x6C, 0x62, 0x23, 0x32, 0x02, 0x1F, 0x5D, 0x02, 0x1F, 0x68, 0x61, 0x17, 0x02, 0x1F,
+    0xDA, 0x21, 0x23, 0x05, 0x21, 0x23, 0x03, 0x62, 0x14, 0x2D, 0x02, 0x20, 0x37, 0x02, 0x20, 0x37,
+    0x21, 0x37, 0x09, 0x62, 0x21, 0x32, 0x02, 0x20, 0x42, 0x02, 0x1F, 0x3E, 0x62, 0x2D, 0x39, 0x02,
+    0x1F, 0x91, 0x02, 0x20, 0x42, 0x62, 0x01, 0x14, 0x02, 0x1C, 0x03, 0x02, 0x20, 0x4B, 0x63, 0x17,
+    0x1E, 0x2D, 0x02, 0x20, 0x5E, 0x02, 0x20, 0x5E, 0x02, 0x20, 0x5E, 0x62, 0x1C, 0x25, 0x02, 0x1F,
+    0xDA, 0x02, 0x1F, 0xDA, 0xF0, 0x01, 0x14, 0x15, 0x19, 0x1A, 0x1C, 0x21, 0x22, 0x25, 0x27, 0x2A,
+    0x2D, 0x40, 0x41, 0x42, 0x44, 0x00, 0x00, 0x5A, 0x00, 0x32, 0x9B, 0x00, 0x00, 0x51, 0x01, 0xED,
+    0x96, 0x00, 0x00, 0x40, 0x02, 0x20, 0x22, 0x00, 0x00, 0x34, 0x00, 0x00, 0x31, 0x02, 0x1C, 0x66,
+    0x02, 0x20, 0x0E, 0x00, 0x00, 0x28, 0x02, 0x20, 0x22, 0x02, 0x16, 0x34, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x09, 0x69, 0x01, 0x04, 0x15, 0x22, 0x25, 0x40, 0x42, 0x48, 0x49, 0x02,
+    0x20, 0x4F, 0x01, 0x80, 0x07, 0x00, 0x01, 0x1F, 0x00, 0xEC, 0xFC, 0x00, 0x01, 0x12, 0x00, 0x01,
+    0x09, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x41, 0x62, 0x1E, 0x22, 0x02, 0x20, 0xDA,
+    0x02, 0x20, 0xDA, 0xE3, 0x14, 0x44, 0x48, 0x02, 0x20, 0x1D, 0x00, 0x00, 0x09, 0x02, 0x20, 0xE3,
+    0xE5, 0x1F, 0x22, 0x40, 0x48, 0x49, 0x02, 0x1F, 0xEE, 0x02, 0x20, 0xD4, 0x00, 0xF3, 0x78, 0x02,
+    0x20, 0xF0, 0x02, 0x20, 0xF0, 0x62, 0x15, 0x27, 0x02, 0x03, 0xB2, 0x02, 0x1F, 0x07, 0x21, 0x40,
+    0x09, 0x21, 0x4C, 0x03, 0x61, 0x48, 0x01, 0x18, 0x19, 0x21, 0x35, 0x05, 0x21, 0x27, 0x03, 0x21,
+    0x1F, 0x03, 0x21, 0x2E, 0x03, 0xE2, 0x40, 0x41, 0x00, 0x00, 0x03, 0x01, 0x8E, 0xBA, 0x21, 0x4C,
+    0x09, 0x62, 0x23, 0x35, 0x01, 0xCE, 0xC3, 0x01, 0xDE, 0x09, 0x61, 0x23, 0x01, 0xDA, 0xA7, 0x63,
+    0x0B, 0x1A, 0x25, 0x01, 0xE3, 0x95, 0x00, 0x00, 0x05, 0x02, 0x20, 0x84, 0x61, 0x25, 0x02, 0x0E,
+    0x62, 0x62, 0x22, 0x48, 0x02, 0x21, 0x47, 0x02, 0x20, 0x96, 0x21, 0x35, 0x09, 0x21, 0x25, 0x03,
+    0xE3, 0x01, 0x19, 0x40, 0x01, 0xDA, 0xD1, 0x02, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x6D, 0x17, 0x19,
+    0x1A, 0x1F, 0x21, 0x22, 0x25, 0x2D, 0x40, 0x41, 0x44, 0x48, 0x49, 0x00, 0x00, 0x5C, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x3C, 0x02, 0x21, 0x51, 0x01, 0x97, 0x90, 0x02, 0x21, 0x6D, 0x02, 0x21, 0x07,
+    0x02, 0x1B, 0xBB, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x21, 0x01, 0xEF, 0x38, 0x00, 0x00, 0x0D, 0x02,
+    0x21, 0x6D, 0x61, 0x13, 0x02, 0x03, 0x67, 0x62, 0x34, 0x39, 0x02, 0x21, 0x9D, 0x00, 0x00, 0x05,
+    0x62, 0x22, 0x4C, 0x02, 0x12, 0x43, 0x02, 0x21, 0xB0, 0x62, 0x40, 0x4C, 0x01, 0xEC, 0x54, 0x02,
+    0x21, 0xB9, 0x62, 0x01, 0x21, 0x02, 0x21, 0x7C, 0x02, 0x06, 0x3F, 0x21, 0x08, 0x09, 0x21, 0x31,
+    0x03, 0x62, 0x01, 0x27, 0x02, 0x0F, 0xB0, 0x00, 0x00, 0x03, 0x21, 0x32, 0x09, 0x61, 0x1A, 0x01,
+    0xE2, 0xC9, 0x63, 0x21, 0x25, 0x40, 0x02, 0x1E, 0x00, 0x02, 0x07, 0x74, 0x01, 0x46, 0x84, 0x21,
+    0x2D, 0x0D, 0xE5, 0x15, 0x22, 0x25, 0x2D, 0x43, 0x02, 0x20, 0xE9, 0x02, 0x21, 0x6D, 0x02, 0x1F,
+    0xC8, 0x01, 0xBB, 0x7B, 0x02, 0x1F, 0xC1, 0xEE, 0x01, 0x11, 0x17, 0x19, 0x1E, 0x22, 0x23, 0x27,
+    0x28, 0x29, 0x40, 0x42, 0x44, 0x49, 0x00, 0x00, 0x60, 0x00, 0xEB, 0xE9, 0x00, 0x00, 0x57, 0x00,
+    0x00, 0x4E, 0x01, 0xEC, 0x44, 0x00, 0x00, 0x2D, 0x01, 0xE0, 0x22, 0x01, 0xCA, 0x0D, 0x02, 0x21,
+    0x4C, 0x02, 0x0D, 0x28, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x18, 0x02, 0x0C, 0x91, 0x00, 0x00, 0x15,
+    0x62, 0x25, 0x27, 0x02, 0x22, 0x40, 0x02, 0x1E, 0xD5, 0xE3, 0x28, 0x32, 0x40, 0x02, 0x10, 0x2B,
+    0x01, 0xE9, 0xA8, 0x01, 0x35, 0x68, 0x61, 0x41, 0x02, 0x08, 0xBF, 0x21, 0x32, 0x05, 0x62, 0x02,
+    0x27, 0x01, 0xDB, 0xD3, 0x01, 0xCA, 0x64, 0x21, 0x38, 0x09, 0xA2, 0x15, 0x2A, 0x0F, 0x03, 0x61,
+    0x23, 0x02, 0x18, 0x2F, 0x62, 0x31, 0x34, 0x02, 0x22, 0x3B, 0x02, 0x1D, 0xEA, 0x61, 0x14, 0x02,
+    0x02, 0x8A, 0xE6, 0x01, 0x15, 0x28, 0x2D, 0x40, 0x44, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0E, 0x01,
+    0xEE, 0x2B, 0x02, 0x00, 0x12, 0x00, 0x00, 0x05, 0x02, 0x20, 0x2C, 0xE5, 0x22, 0x23, 0x27, 0x2B,
+    0x49, 0x00, 0x00, 0x52, 0x02, 0x22, 0x1C, 0x00, 0x00, 0x31, 0x02, 0x21, 0x92, 0x00, 0x00, 0x19,
+    0x61, 0x32, 0x01, 0x27, 0x65, 0x21, 0x25, 0x05, 0xE2, 0x17, 0x49, 0x02, 0x21, 0xAC, 0x02, 0x22,
+    0xB8, 0x63, 0x13, 0x31, 0x48, 0x02, 0x10, 0x59, 0x01, 0x00, 0xB5, 0x02, 0x22, 0xC1, 0xE1, 0x17,
+    0x01, 0x97, 0xF7, 0xE2, 0x19, 0x48, 0x02, 0x02, 0x33, 0x00, 0x00, 0x05, 0xEA, 0x0B, 0x19, 0x1B,
+    0x21, 0x23, 0x25, 0x27, 0x2B, 0x48, 0x49, 0x02, 0x21, 0xD0, 0x02, 0x22, 0xDC, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x09, 0x00, 0x66, 0x0D, 0x01, 0x9F, 0x77, 0x02,
+    0x22, 0xDC, 0x02, 0x22, 0xDC, 0x61, 0x42, 0x01, 0xA3, 0x10, 0x21, 0x32, 0x05, 0x61, 0x15, 0x01,
+    0xF7, 0xD4, 0x21, 0x44, 0x05, 0x21, 0x2A, 0x03, 0x21, 0x4C, 0x03, 0x41, 0x35, 0x42, 0xA8, 0x62,
+    0x23, 0x40, 0x02, 0x22, 0xB9, 0x02, 0x07, 0x0A, 0x61, 0x4C, 0x01, 0xB4, 0xB2, 0x21, 0x14, 0x05,
+    0x21, 0x19, 0x03, 0x21, 0x25, 0x03, 0x21, 0x41, 0x03, 0x64, 0x2D, 0x32, 0x34, 0x4C, 0x02, 0x23,
+    0x00, 0x00, 0x42, 0x5B, 0x02, 0x06, 0x81, 0x00, 0x00, 0x03, 0x61, 0x04, 0x01, 0xE4, 0xE3, 0x21,
+    0x42, 0x05, 0x21, 0x35, 0x03, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x61, 0x35, 0x02, 0x21, 0x4C,
+    0x21, 0x23, 0x05, 0x63, 0x01, 0x27, 0x39, 0x00, 0x00, 0x03, 0x01, 0x32, 0xF0, 0x01, 0xEE, 0x05,
+    0x41, 0x2D, 0x96, 0x87, 0x61, 0x42, 0x01, 0x3D, 0x9D, 0x61, 0x04, 0x01, 0xEC, 0x13, 0x21, 0x40,
+    0x05, 0x63, 0x14, 0x27, 0x40, 0x02, 0x02, 0x08, 0x02, 0x23, 0x1B, 0x01, 0xA5, 0x1E, 0x23, 0x0B,
+    0x14, 0x2D, 0x1A, 0x10, 0x0D, 0xEF, 0x04, 0x0B, 0x14, 0x17, 0x19, 0x1A, 0x1E, 0x22, 0x23, 0x27,
+    0x28, 0x29, 0x2D, 0x42, 0x49, 0x02, 0x1D, 0xE3, 0x02, 0x13, 0x72, 0x00, 0x00, 0x8B, 0x02, 0x22,
+    0xCF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7A, 0x02, 0x1F, 0x43, 0x00, 0x00, 0x76, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x3D, 0x00, 0x00, 0x32, 0x01, 0x25, 0x5A, 0x00, 0x00, 0x25, 0x00, 0x00, 0x07, 0x02,
+    0x23, 0x95, 0x62, 0x0B, 0x44, 0x01, 0xFC, 0x32, 0x01, 0xEC, 0x8A, 0x21, 0x32, 0x09, 0x41, 0x2A,
+    0x6E, 0xE7, 0x21, 0x4C, 0x04, 0x21, 0x23, 0x03, 0x21, 0x2D, 0x03, 0x62, 0x17, 0x1E, 0x02, 0x11,
+    0x01, 0x00, 0x00, 0x03, 0x41, 0x23, 0x66, 0x04, 0x61, 0x1A, 0x02, 0x1E, 0x46, 0x21, 0x4C, 0x05,
+    0x21, 0x23, 0x03, 0x21, 0x32, 0x03, 0x61, 0x19, 0x01, 0x75, 0x5B, 0x21, 0x34, 0x05, 0x61, 0x1F,
+    0x02, 0x13, 0xF5, 0x21, 0x44, 0x05, 0x21, 0x25, 0x03, 0x21, 0x31, 0x03, 0x61, 0x4C, 0x01, 0xE1,
+    0xE4, 0x21, 0x23, 0x05, 0x21, 0x2D, 0x03, 0x21, 0x1E, 0x03, 0xA2, 0x0B, 0x40, 0x11, 0x03, 0x21,
+    0x19, 0x05, 0x21, 0x08, 0x03, 0x64, 0x04, 0x0B, 0x21, 0x40, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2A,
+    0x01, 0x75, 0x95, 0x00, 0x00, 0x03, 0x21, 0x23, 0x11, 0x63, 0x01, 0x14, 0x25, 0x00, 0x00, 0x55,
+    0x00, 0x00, 0x03, 0x02, 0x24, 0x49, 0x66, 0x14, 0x15, 0x22, 0x40, 0x42, 0x44, 0x02, 0x23, 0xED,
+    0x02, 0x23, 0x90, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x0D, 0x02, 0x0E, 0xE0, 0x7E,
+    0x01, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x25, 0x27, 0x28, 0x2A, 0x2B, 0x2D, 0x2E, 0x00, 0x0C,
+    0x64, 0x00, 0x0B, 0xCE, 0x00, 0x0B, 0x52, 0x00, 0x67, 0xA0, 0x00, 0x0B, 0x35, 0x00, 0x0B, 0x2C,
+    0x00, 0x0B, 0x0E, 0x00, 0x0A, 0xA0, 0x00, 0x09, 0x8D, 0x00, 0x08, 0xB4, 0x00, 0x08, 0x8D, 0x00,
+    0x07, 0xA7, 0x00, 0x07, 0x68, 0x00, 0x07, 0x22, 0x00, 0x06, 0xB6, 0x00, 0x06, 0x6C, 0x02, 0x24,
+    0x6F, 0x00, 0x05, 0x8D, 0x00, 0x05, 0x07, 0x01, 0xBD, 0x7E, 0x00, 0x03, 0xBA, 0x00, 0x03, 0x8C,
+    0x00, 0x03, 0x7F, 0x00, 0x03, 0x02, 0x00, 0x02, 0x68, 0x00, 0x02, 0x2F, 0x00, 0x01, 0xD4, 0x00,
+    0x01, 0x93, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x19, 0x7F, 0x2E, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B,
+    0x2D, 0x2E, 0x2F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x01, 0xFA, 0x8A, 0x01, 0xF0, 0x5A, 0x01, 0xDD,
+    0x10, 0x01, 0xDC, 0x92, 0x01, 0xDA, 0xDF, 0x01, 0xCE, 0x07, 0x01, 0xCB, 0x5D, 0x01, 0xC2, 0x41,
+    0x01, 0xBA, 0xB7, 0x01, 0xBA, 0x6C, 0x01, 0xBA, 0x32, 0x01, 0xBA, 0x1F, 0x01, 0xB9, 0xCD, 0x01,
+    0xB9, 0xAB, 0x01, 0xB9, 0x99, 0x01, 0xB1, 0x5D, 0x01, 0xA2, 0x53, 0x01, 0x9E, 0xF7, 0x01, 0x91,
+    0x18, 0x01, 0x8D, 0xEF, 0x01, 0x80, 0x3F, 0x01, 0x6F, 0x3A, 0x01, 0x58, 0x86, 0x01, 0x54, 0x02,
+    0x01, 0x52, 0x9A, 0x01, 0x3F, 0xC1, 0x01, 0x3B, 0xE5, 0x01, 0x37, 0x3F, 0x01, 0x26, 0x25, 0x01,
+    0x1D, 0xBA, 0x01, 0x0B, 0x28, 0x01, 0x0A, 0x2F, 0x00, 0xFA, 0xE6, 0x00, 0xE7, 0x75, 0x00, 0xE0,
+    0x2C, 0x00, 0xDF, 0xB1, 0x00, 0xB9, 0x7C, 0x00, 0xAA, 0x0E, 0x00, 0x84, 0x5B, 0x00, 0x80, 0xEB,
+    0x00, 0x80, 0xBB, 0x00, 0x40, 0x08, 0x00, 0x27, 0x59, 0x00, 0x0F, 0xD9, 0x00, 0x0D, 0x68, 0x00,
+    0x00, 0x79,
+};
+
+constexpr SerializedWordTrie th_words_trie = {
+    0x224E8u,
+    th_words_trie_data,
+    sizeof(th_words_trie_data),
+};
@@ -8,55 +8,32 @@
 
 #include "../../Epub.h"
 #include "../Page.h"
+#include "../SectionAnchor.h"
 #include "../converters/ImageDecoderFactory.h"
 #include "../converters/ImageToFramebufferDecoder.h"
 #include "../htmlEntities.h"
-
-const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
-constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
+#include "ElementAttributes.h"
+#include "HtmlTagTable.h"
+#include "TextRunScanner.h"
 
 // Minimum file size (in bytes) to show indexing popup - smaller chapters don't benefit from it
 constexpr size_t MIN_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
 constexpr size_t PARSE_BUFFER_SIZE = 1024;
-
-const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
-constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
-
-const char* BOLD_TAGS[] = {"b", "strong"};
-constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
-
-const char* ITALIC_TAGS[] = {"i", "em"};
-constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
-
-const char* UNDERLINE_TAGS[] = {"u", "ins"};
-constexpr int NUM_UNDERLINE_TAGS = sizeof(UNDERLINE_TAGS) / sizeof(UNDERLINE_TAGS[0]);
-
-const char* IMAGE_TAGS[] = {"img"};
-constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
-
-const char* SKIP_TAGS[] = {"head"};
-constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+// Each progress update is a fast refresh of the popup's bar, so only report steps of at least this many percent and
+// no more often than this
+constexpr int PROGRESS_STEP_PERCENT = 5;
+constexpr uint32_t PROGRESS_INTERVAL_MS = 1000;
+// Caps on what a table may buffer for grid layout before it is flattened instead; the words dominate, at roughly
+// 40 bytes each with their styles
+constexpr size_t TABLE_MAX_WORDS = 512;
+constexpr size_t TABLE_MAX_CELLS = 256;
+constexpr int TABLE_MAX_COLUMNS = 8;
+
+using HtmlTagTable::HtmlTag;
+using HtmlTagTable::TagInfo;
 
 bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
 
-// given the start and end of a tag, check to see if it matches a known tag
-bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
-  for (int i = 0; i < possible_tag_count; i++) {
-    if (strcmp(tag_name, possible_tags[i]) == 0) {
-      return true;
-    }
-  }
-  return false;
-}
-
-const char* getAttribute(const XML_Char** atts, const char* attrName) {
-  if (!atts) return nullptr;
-  for (int i = 0; atts[i]; i += 2) {
-    if (strcmp(atts[i], attrName) == 0) return atts[i + 1];
-  }
-  return nullptr;
-}
-
 bool isInternalEpubLink(const char* href) {
   if (!href || href[0] == '\0') return false;
   if (strncmp(href, "http://", 7) == 0 || strncmp(href, "https://", 8) == 0) return false;
@@ -67,14 +44,6 @@ bool isInternalEpubLink(const char* href) {
   return true;
 }
 
-bool isHeaderOrBlock(const char* name) {
-  return matches(name, HEADER_TAGS, NUM_HEADER_TAGS) || matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS);
-}
-
-bool isTableStructuralTag(const char* name) {
-  return strcmp(name, "table") == 0 || strcmp(name, "tr") == 0 || strcmp(name, "td") == 0 || strcmp(name, "th") == 0;
-}
-
 // Update effective bold/italic/underline based on block style and inline style stack
 void ChapterHtmlSlimParser::updateEffectiveInlineStyle() {
   // Start with block-level styles
@@ -118,14 +87,25 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
 
   // flush the buffer
   partWordBuffer[partWordBufferIndex] = '\0';
-  currentTextBlock->addWord(partWordBuffer, fontStyle, false, nextWordContinues);
+  currentTextBlock->addWord(partWordBuffer, fontStyle, false, nextWordContinues, nextWordJoins);
   partWordBufferIndex = 0;
   nextWordContinues = false;
+  nextWordJoins = false;
 }
 
 // start a new text block if needed
 void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
   nextWordContinues = false;  // New block = new paragraph, no continuation
+  nextWordJoins = false;
+  // Block elements inside a buffered table cell start a new line of the cell
+  if (tableCellOpen) {
+    endTableCellParagraph();
+    return;
+  }
+  // Text between rows has no place in the grid
+  if (bufferingTable() && !tableCells.empty() && currentTextBlock && !currentTextBlock->isEmpty()) {
+    flattenTable();
+  }
   if (currentTextBlock) {
     // already have a text block running and it is empty - just reuse it
     if (currentTextBlock->isEmpty()) {
@@ -138,7 +118,7 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
 
     makePages();
   }
-  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
+  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle, widthCache));
   wordsExtractedInBlock = 0;
 }
 
@@ -151,16 +131,19 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  // Extract class and style attributes for CSS processing
-  std::string classAttr;
-  std::string styleAttr;
-  if (atts != nullptr) {
-    for (int i = 0; atts[i]; i += 2) {
-      if (strcmp(atts[i], "class") == 0) {
-        classAttr = atts[i + 1];
-      } else if (strcmp(atts[i], "style") == 0) {
-        styleAttr = atts[i + 1];
-      }
+  const TagInfo& tag = HtmlTagTable::lookup(name);
+  const ElementAttributes attrs(atts);
+
+  // Remember element ids (and legacy <a name>) so fragment links can jump to the page the element lands on
+  if (self->anchorFn) {
+    const char* id = attrs.id;
+    if (!id && tag.tag == HtmlTag::A) {
+      id = attrs.name;
+    }
+    if (id && id[0] != '\0') {
+      const int wordIndex =
+          self->wordsExtractedInBlock + (self->currentTextBlock ? static_cast<int>(self->currentTextBlock->size()) : 0);
+      self->pendingAnchors.push_back({wordIndex, SectionAnchor::hashId(id, strlen(id))});
     }
   }
 
@@ -168,81 +151,63 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   centeredBlockStyle.textAlignDefined = true;
   centeredBlockStyle.alignment = CssTextAlign::Center;
 
-  // Special handling for tables/cells: flatten into per-cell paragraphs with a prefixed header.
-  if (strcmp(name, "table") == 0) {
-    // skip nested tables
+  // Special handling for tables/cells: buffered and laid out as a grid when the table closes, see layoutTable()
+  if (tag.tag == HtmlTag::Table) {
+    if (self->partWordBufferIndex > 0) {
+      self->flushPartWordBuffer();
+    }
+    // Nested tables run on as text of the cell they sit in
     if (self->tableDepth > 0) {
       self->tableDepth += 1;
+      self->depth += 1;
       return;
     }
 
-    if (self->partWordBufferIndex > 0) {
-      self->flushPartWordBuffer();
-    }
+    // Text before the table in the same block is set above it
+    self->startNewTextBlock(self->tableCellBlockStyle(false));
     self->tableDepth += 1;
     self->tableRowIndex = 0;
     self->tableColIndex = 0;
+    self->tableFlattened = false;
     self->depth += 1;
     return;
   }
 
-  if (self->tableDepth == 1 && strcmp(name, "tr") == 0) {
+  if (self->tableDepth == 1 && tag.tag == HtmlTag::Tr) {
     self->tableRowIndex += 1;
     self->tableColIndex = 0;
     self->depth += 1;
     return;
   }
 
-  if (self->tableDepth == 1 && (strcmp(name, "td") == 0 || strcmp(name, "th") == 0)) {
+  if (self->tableDepth == 1 && (tag.tag == HtmlTag::Td || tag.tag == HtmlTag::Th)) {
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
     }
     self->tableColIndex += 1;
 
-    auto tableCellBlockStyle = BlockStyle();
-    tableCellBlockStyle.textAlignDefined = true;
-    const auto align = (self->paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None))
-                           ? CssTextAlign::Justify
-                           : static_cast<CssTextAlign>(self->paragraphAlignment);
-    tableCellBlockStyle.alignment = align;
-    self->startNewTextBlock(tableCellBlockStyle);
-
-    const std::string headerText =
-        "Tab Row " + std::to_string(self->tableRowIndex) + ", Cell " + std::to_string(self->tableColIndex) + ":";
-    StyleStackEntry headerStyle;
-    headerStyle.depth = self->depth;
-    headerStyle.hasBold = true;
-    headerStyle.bold = false;
-    headerStyle.hasItalic = true;
-    headerStyle.italic = true;
-    headerStyle.hasUnderline = true;
-    headerStyle.underline = false;
-    self->inlineStyleStack.push_back(headerStyle);
-    self->updateEffectiveInlineStyle();
-    self->characterData(userData, headerText.c_str(), static_cast<int>(headerText.length()));
-    if (self->partWordBufferIndex > 0) {
-      self->flushPartWordBuffer();
+    const bool header = tag.tag == HtmlTag::Th;
+    if (self->bufferingTable()) {
+      self->startTableCell(header);
+    } else {
+      self->startFlattenedTableCell(self->tableRowIndex, self->tableColIndex);
+    }
+    if (header) {
+      self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
     }
-    self->nextWordContinues = false;
-    self->inlineStyleStack.pop_back();
-    self->updateEffectiveInlineStyle();
 
     self->depth += 1;
     return;
   }
 
-  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
-    std::string src;
-    std::string alt;
+  if (tag.is(HtmlTagTable::TAG_IMAGE)) {
+    const char* src = attrs.src;
+    const char* alt = attrs.alt;
+    // Images go straight onto the page, so a table holding one can't wait for grid layout
+    if (self->bufferingTable() && self->imageRendering == 0 && src && src[0] != '\0') {
+      self->flattenTable();
+    }
     if (atts != nullptr) {
-      for (int i = 0; atts[i]; i += 2) {
-        if (strcmp(atts[i], "src") == 0) {
-          src = atts[i + 1];
-        } else if (strcmp(atts[i], "alt") == 0) {
-          alt = atts[i + 1];
-        }
-      }
-
       // imageRendering: 0=display, 1=placeholder (alt text only), 2=suppress entirely
       if (self->imageRendering == 2) {
         self->skipUntilDepth = self->depth;
@@ -250,8 +215,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
         return;
       }
 
-      if (!src.empty() && self->imageRendering != 1) {
-        LOG_DBG("EHP", "Found image: src=%s", src.c_str());
+      if (src && src[0] != '\0' && self->imageRendering != 1) {
+        LOG_DBG("EHP", "Found image: src=%s", src);
 
         {
           // Resolve the image path relative to the HTML file
@@ -286,10 +251,11 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
                 int displayWidth = 0;
                 int displayHeight = 0;
                 const float emSize = static_cast<float>(self->renderer.getFontAscenderSize(self->fontId));
-                CssStyle imgStyle = self->cssParser ? self->cssParser->resolveStyle("img", classAttr) : CssStyle{};
+                CssStyle imgStyle =
+                    self->cssParser ? self->cssParser->resolveStyle("img", attrs.cls ? attrs.cls : "") : CssStyle{};
                 // Merge inline style (e.g. style="height: 2em") so it overrides stylesheet rules
-                if (!styleAttr.empty()) {
-                  imgStyle.applyOver(CssParser::parseInlineStyle(styleAttr));
+                if (attrs.style && attrs.style[0] != '\0') {
+                  imgStyle.applyOver(CssParser::parseInlineStyle(attrs.style));
                 }
                 const bool hasCssHeight = imgStyle.hasImageHeight();
                 const bool hasCssWidth = imgStyle.hasImageWidth();
@@ -403,6 +369,11 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
                 }
                 self->currentPage->elements.push_back(pageImage);
                 self->currentPageNextY += displayHeight;
+                // Ids of the image or its wrapper land on the image's page
+                const int wordsInBlock =
+                    self->wordsExtractedInBlock +
+                    (self->currentTextBlock ? static_cast<int>(self->currentTextBlock->size()) : 0);
+                self->resolvePendingAnchors(wordsInBlock + 1);
 
                 self->depth += 1;
                 return;
@@ -418,12 +389,12 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
       }
 
       // Fallback to alt text if image processing fails
-      if (!alt.empty()) {
-        alt = "[Image: " + alt + "]";
+      if (alt && alt[0] != '\0') {
+        const std::string altText = "[Image: " + std::string(alt) + "]";
         self->startNewTextBlock(centeredBlockStyle);
         self->italicUntilDepth = std::min(self->italicUntilDepth, self->depth);
         self->depth += 1;
-        self->characterData(userData, alt.c_str(), alt.length());
+        self->characterData(userData, altText.c_str(), altText.length());
         // Skip any child content (skip until parent as we pre-advanced depth above)
         self->skipUntilDepth = self->depth - 1;
         return;
@@ -436,7 +407,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
   }
 
-  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) {
+  if (tag.is(HtmlTagTable::TAG_SKIP)) {
     // start skip
     self->skipUntilDepth = self->depth;
     self->depth += 1;
@@ -444,22 +415,17 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   }
 
   // Skip blocks with role="doc-pagebreak" and epub:type="pagebreak"
-  if (atts != nullptr) {
-    for (int i = 0; atts[i]; i += 2) {
-      if (strcmp(atts[i], "role") == 0 && strcmp(atts[i + 1], "doc-pagebreak") == 0 ||
-          strcmp(atts[i], "epub:type") == 0 && strcmp(atts[i + 1], "pagebreak") == 0) {
-        self->skipUntilDepth = self->depth;
-        self->depth += 1;
-        return;
-      }
-    }
+  if (attrs.pageBreak) {
+    self->skipUntilDepth = self->depth;
+    self->depth += 1;
+    return;
   }
 
   // Detect internal <a href="..."> links (footnotes, cross-references)
   // Note: <aside epub:type="footnote"> elements are rendered as normal content
   // without special handling. Links pointing to them are collected as footnotes.
-  if (strcmp(name, "a") == 0) {
-    const char* href = getAttribute(atts, "href");
+  if (tag.tag == HtmlTag::A) {
+    const char* href = attrs.href;
 
     bool isInternalLink = isInternalEpubLink(href);
 
@@ -503,10 +469,10 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   CssStyle cssStyle;
   if (self->cssParser) {
     // Get combined tag + class styles
-    cssStyle = self->cssParser->resolveStyle(name, classAttr);
+    cssStyle = self->cssParser->resolveStyle(name, attrs.cls ? attrs.cls : "");
     // Merge inline style (highest priority)
-    if (!styleAttr.empty()) {
-      CssStyle inlineStyle = CssParser::parseInlineStyle(styleAttr);
+    if (attrs.style && attrs.style[0] != '\0') {
+      CssStyle inlineStyle = CssParser::parseInlineStyle(attrs.style);
       cssStyle.applyOver(inlineStyle);
     }
   }
@@ -515,7 +481,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   const auto userAlignmentBlockStyle = BlockStyle::fromCssStyle(
       cssStyle, emSize, static_cast<CssTextAlign>(self->paragraphAlignment), self->viewportWidth);
 
-  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) {
+  if (tag.is(HtmlTagTable::TAG_HEADER)) {
     self->currentCssStyle = cssStyle;
     auto headerBlockStyle = BlockStyle::fromCssStyle(cssStyle, emSize, CssTextAlign::Center, self->viewportWidth);
     headerBlockStyle.textAlignDefined = true;
@@ -525,8 +491,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     self->startNewTextBlock(headerBlockStyle);
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) {
-    if (strcmp(name, "br") == 0) {
+  } else if (tag.is(HtmlTagTable::TAG_BLOCK)) {
+    if (tag.tag == HtmlTag::Br) {
       if (self->partWordBufferIndex > 0) {
         // flush word preceding <br/> to currentTextBlock before calling startNewTextBlock
         self->flushPartWordBuffer();
@@ -537,11 +503,11 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
       self->startNewTextBlock(userAlignmentBlockStyle);
       self->updateEffectiveInlineStyle();
 
-      if (strcmp(name, "li") == 0) {
+      if (tag.tag == HtmlTag::Li) {
         self->currentTextBlock->addWord("\xe2\x80\xa2", EpdFontFamily::REGULAR);
       }
     }
-  } else if (matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS)) {
+  } else if (tag.is(HtmlTagTable::TAG_UNDERLINE)) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -563,7 +529,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) {
+  } else if (tag.is(HtmlTagTable::TAG_BOLD)) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -585,7 +551,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) {
+  } else if (tag.is(HtmlTagTable::TAG_ITALIC)) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -607,7 +573,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (strcmp(name, "span") == 0 || !isHeaderOrBlock(name)) {
+  } else if (!tag.isHeaderOrBlock()) {
     // Handle span and other inline elements for CSS styling
     if (cssStyle.hasFontWeight() || cssStyle.hasFontStyle() || cssStyle.hasTextDecoration()) {
       // Flush buffer before style change so preceding text gets current style
@@ -641,11 +607,6 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char* s, const int len) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
-  // Skip content of nested table
-  if (self->tableDepth > 1) {
-    return;
-  }
-
   // Middle of skip
   if (self->skipUntilDepth < self->depth) {
     return;
@@ -664,92 +625,10 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     }
   }
 
-  for (int i = 0; i < len; i++) {
-    if (isWhitespace(s[i])) {
-      // Currently looking at whitespace, if there's anything in the partWordBuffer, flush it
-      if (self->partWordBufferIndex > 0) {
-        self->flushPartWordBuffer();
-      }
-      // Whitespace is a real word boundary — reset continuation state
-      self->nextWordContinues = false;
-      // Skip the whitespace char
-      continue;
-    }
-
-    // Detect U+00A0 (non-breaking space, UTF-8: 0xC2 0xA0) or
-    //        U+202F (narrow no-break space, UTF-8: 0xE2 0x80 0xAF).
-    //
-    // Both are rendered as a visible space but must never allow a line break around them.
-    // We split the no-break space into its own word token and link the surrounding words
-    // with continuation flags so the layout engine treats them as an indivisible group.
-    //
-    // Example: "200&#xA0;Quadratkilometer" or "200&#x202F;Quadratkilometer"
-    //   Input bytes:  "200\xC2\xA0Quadratkilometer"  (or 0xE2 0x80 0xAF for U+202F)
-    //   Tokens produced:
-    //     [0] "200"               continues=false
-    //     [1] " "                 continues=true   (attaches to "200", no gap)
-    //     [2] "Quadratkilometer"  continues=true   (attaches to " ", no gap)
-    //
-    //   The continuation flags prevent the line-breaker from inserting a line break
-    //   between "200" and "Quadratkilometer". However, "Quadratkilometer" is now a
-    //   standalone word for hyphenation purposes, so Liang patterns can produce
-    //   "200 Quadrat-" / "kilometer" instead of the unusable "200" / "Quadratkilometer".
-    if (static_cast<uint8_t>(s[i]) == 0xC2 && i + 1 < len && static_cast<uint8_t>(s[i + 1]) == 0xA0) {
-      if (self->partWordBufferIndex > 0) {
-        self->flushPartWordBuffer();
-      }
-
-      self->partWordBuffer[0] = ' ';
-      self->partWordBuffer[1] = '\0';
-      self->partWordBufferIndex = 1;
-      self->nextWordContinues = true;  // Attach space to previous word (no break).
-      self->flushPartWordBuffer();
-
-      self->nextWordContinues = true;  // Next real word attaches to this space (no break).
-
-      i++;  // Skip the second byte (0xA0)
-      continue;
-    }
-
-    // U+202F (narrow no-break space) — identical logic to U+00A0 above.
-    if (static_cast<uint8_t>(s[i]) == 0xE2 && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0x80 &&
-        static_cast<uint8_t>(s[i + 2]) == 0xAF) {
-      if (self->partWordBufferIndex > 0) {
-        self->flushPartWordBuffer();
-      }
+  TextRunScanner::appendWords(*self, s, len);
 
-      self->partWordBuffer[0] = ' ';
-      self->partWordBuffer[1] = '\0';
-      self->partWordBufferIndex = 1;
-      self->nextWordContinues = true;
-      self->flushPartWordBuffer();
-
-      self->nextWordContinues = true;
-
-      i += 2;  // Skip the remaining two bytes (0x80 0xAF)
-      continue;
-    }
-
-    // Skip Zero Width No-Break Space / BOM (U+FEFF) = 0xEF 0xBB 0xBF
-    const XML_Char FEFF_BYTE_1 = static_cast<XML_Char>(0xEF);
-    const XML_Char FEFF_BYTE_2 = static_cast<XML_Char>(0xBB);
-    const XML_Char FEFF_BYTE_3 = static_cast<XML_Char>(0xBF);
-
-    if (s[i] == FEFF_BYTE_1) {
-      // Check if the next two bytes complete the 3-byte sequence
-      if ((i + 2 < len) && (s[i + 1] == FEFF_BYTE_2) && (s[i + 2] == FEFF_BYTE_3)) {
-        // Sequence 0xEF 0xBB 0xBF found!
-        i += 2;    // Skip the next two bytes
-        continue;  // Move to the next iteration
-      }
-    }
-
-    // If we're about to run out of space, then cut the word off and start a new one
-    if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
-      self->flushPartWordBuffer();
-    }
-
-    self->partWordBuffer[self->partWordBufferIndex++] = s[i];
+  if (self->tableCellOpen && self->tableWordCount + self->currentTextBlock->size() > TABLE_MAX_WORDS) {
+    self->flattenTable();
   }
 
   // If we have > 750 words buffered up, perform the layout and consume out all but the last line
@@ -793,26 +672,18 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   const bool willClearUnderline = self->underlineUntilDepth == self->depth - 1;
 
   const bool styleWillChange = willPopStyleStack || willClearBold || willClearItalic || willClearUnderline;
-  const bool headerOrBlockTag = isHeaderOrBlock(name);
-  const bool tableStructuralTag = isTableStructuralTag(name);
-
-  if (self->tableDepth > 1 && strcmp(name, "table") == 0) {
-    // get rid of all text inside the nested table
-    self->partWordBufferIndex = 0;
-    self->tableDepth -= 1;
-    LOG_DBG("EHP", "nested table detected, get rid of its content");
-    return;
-  }
+  const TagInfo& tag = HtmlTagTable::lookup(name);
+  const bool headerOrBlockTag = tag.isHeaderOrBlock();
+  const bool tableStructuralTag = tag.is(HtmlTagTable::TAG_TABLE);
 
   // Flush buffer with current style BEFORE any style changes
   if (self->partWordBufferIndex > 0) {
     // Flush if style will change OR if we're closing a block/structural element
-    const bool isInlineTag =
-        !headerOrBlockTag && !tableStructuralTag && !matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS) && self->depth != 1;
-    const bool shouldFlush = styleWillChange || headerOrBlockTag || matches(name, BOLD_TAGS, NUM_BOLD_TAGS) ||
-                             matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) ||
-                             matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS) || tableStructuralTag ||
-                             matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS) || self->depth == 1;
+    const bool isInlineTag = tag.isInline() && !tag.is(HtmlTagTable::TAG_IMAGE) && self->depth != 1;
+    const bool shouldFlush =
+        styleWillChange || self->depth == 1 ||
+        tag.is(HtmlTagTable::TAG_HEADER | HtmlTagTable::TAG_BLOCK | HtmlTagTable::TAG_BOLD | HtmlTagTable::TAG_ITALIC |
+               HtmlTagTable::TAG_UNDERLINE | HtmlTagTable::TAG_TABLE | HtmlTagTable::TAG_IMAGE);
 
     if (shouldFlush) {
       self->flushPartWordBuffer();
@@ -845,18 +716,29 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
     self->skipUntilDepth = INT_MAX;
   }
 
-  if (self->tableDepth == 1 && (strcmp(name, "td") == 0 || strcmp(name, "th") == 0)) {
+  if (self->tableDepth > 1 && tag.tag == HtmlTag::Table) {
+    self->tableDepth -= 1;
+  } else if (self->tableDepth == 1 && (tag.tag == HtmlTag::Td || tag.tag == HtmlTag::Th)) {
+    if (self->tableCellOpen) {
+      self->endTableCell();
+      if (self->tableWordCount > TABLE_MAX_WORDS) {
+        self->flattenTable();
+      }
+    }
     self->nextWordContinues = false;
-  }
-
-  if (self->tableDepth == 1 && (strcmp(name, "tr") == 0)) {
+  } else if (self->tableDepth == 1 && tag.tag == HtmlTag::Tr) {
     self->nextWordContinues = false;
-  }
-
-  if (self->tableDepth == 1 && strcmp(name, "table") == 0) {
+  } else if (self->tableDepth == 1 && tag.tag == HtmlTag::Table) {
+    if (self->tableCellOpen) {
+      self->endTableCell();
+    }
+    if (self->bufferingTable()) {
+      self->layoutTable();
+    }
     self->tableDepth -= 1;
     self->tableRowIndex = 0;
     self->tableColIndex = 0;
+    self->tableFlattened = false;
     self->nextWordContinues = false;
   }
 
@@ -892,7 +774,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
     // Center) followed by an image-only <p> causes Center to persist through the chain
     // of empty block reuse into subsequent text paragraphs.
     // Margins/padding are preserved so parent element spacing still accumulates correctly.
-    if (self->currentTextBlock && self->currentTextBlock->isEmpty()) {
+    if (self->currentTextBlock && self->currentTextBlock->isEmpty() && !self->tableCellOpen) {
       auto style = self->currentTextBlock->getBlockStyle();
       style.textAlignDefined = false;
       style.alignment = (self->paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None))
@@ -932,9 +814,13 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   }
 
   // Get file size to decide whether to show indexing popup.
-  if (popupFn && file.size() >= MIN_SIZE_FOR_POPUP) {
+  const size_t fileSize = file.size();
+  const bool showsPopup = fileSize >= MIN_SIZE_FOR_POPUP;
+  if (popupFn && showsPopup) {
     popupFn();
   }
+  int reportedProgress = 0;
+  uint32_t lastProgressTime = millis();
 
   XML_SetUserData(parser, this);
   XML_SetElementHandler(parser, startElement, endElement);
@@ -978,6 +864,16 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       file.close();
       return false;
     }
+
+    // Bytes handed to expat against the uncompressed chapter size; the final 100% isn't worth a refresh
+    if (progressFn && showsPopup && !done) {
+      const int progress = static_cast<int>(static_cast<uint64_t>(file.position()) * 100 / fileSize);
+      if (progress - reportedProgress >= PROGRESS_STEP_PERCENT && millis() - lastProgressTime >= PROGRESS_INTERVAL_MS) {
+        progressFn(progress);
+        reportedProgress = progress;
+        lastProgressTime = millis();
+      }
+    }
   } while (!done);
   LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - chapterStartTime);
 
@@ -987,9 +883,15 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_ParserFree(parser);
   file.close();
 
+  // A table left open at the end of the file still gets its cells out
+  if (bufferingTable()) {
+    flattenTable();
+  }
+
   // Process last page if there is still text
   if (currentTextBlock) {
     makePages();
+    resolvePendingAnchors(INT_MAX);
     completePageFn(std::move(currentPage));
     currentPage.reset();
     currentTextBlock.reset();
@@ -1016,12 +918,24 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   }
   pendingFootnotes.erase(pendingFootnotes.begin(), footnoteIt);
 
+  // Anchors whose first word is on this line land on the current page
+  resolvePendingAnchors(wordsExtractedInBlock);
+
   // Apply horizontal left inset (margin + padding) as x position offset
   const int16_t xOffset = line->getBlockStyle().leftInset();
   currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
   currentPageNextY += lineHeight;
 }
 
+void ChapterHtmlSlimParser::resolvePendingAnchors(const int wordLimit) {
+  auto anchorIt = pendingAnchors.begin();
+  while (anchorIt != pendingAnchors.end() && anchorIt->first < wordLimit) {
+    anchorFn(anchorIt->second);
+    ++anchorIt;
+  }
+  pendingAnchors.erase(pendingAnchors.begin(), anchorIt);
+}
+
 void ChapterHtmlSlimParser::makePages() {
   if (!currentTextBlock) {
     LOG_ERR("EHP", "!! No text block to make pages for !!");
@@ -1063,6 +977,11 @@ void ChapterHtmlSlimParser::makePages() {
     pendingFootnotes.clear();
   }
 
+  // Anchors after the last word (e.g. the id of the element that starts the next block) belong to what comes next
+  for (auto& anchor : pendingAnchors) {
+    anchor.first = 0;
+  }
+
   // Apply bottom spacing after the paragraph (stored in pixels)
   if (blockStyle.marginBottom > 0) {
     currentPageNextY += blockStyle.marginBottom;
@@ -1076,3 +995,299 @@ void ChapterHtmlSlimParser::makePages() {
     currentPageNextY += lineHeight / 2;
   }
 }
+
+BlockStyle ChapterHtmlSlimParser::tableCellBlockStyle(const bool header) const {
+  BlockStyle style;
+  style.textAlignDefined = true;
+  style.alignment = header ? CssTextAlign::Center : CssTextAlign::Left;
+  style.textIndentDefined = true;  // no paragraph indent inside a cell
+  return style;
+}
+
+void ChapterHtmlSlimParser::startTableCell(const bool header) {
+  if (tableColIndex > TABLE_MAX_COLUMNS || tableCells.size() >= TABLE_MAX_CELLS) {
+    flattenTable();
+    startFlattenedTableCell(tableRowIndex, tableColIndex);
+    return;
+  }
+  // Text between the table start and its first cell (e.g. a caption) is set above the table
+  if (!currentTextBlock->isEmpty()) {
+    if (!tableCells.empty()) {
+      flattenTable();
+      startFlattenedTableCell(tableRowIndex, tableColIndex);
+      return;
+    }
+    makePages();
+  }
+  tableCells.push_back({{}, tableRowIndex, tableColIndex, header});
+  currentTextBlock.reset(
+      new ParsedText(extraParagraphSpacing, hyphenationEnabled, tableCellBlockStyle(header), widthCache));
+  wordsExtractedInBlock = 0;
+  tableCellOpen = true;
+}
+
+// Closes the open cell's current line of text; wordsExtractedInBlock counts the cell's words before the new one, so
+// ids and footnotes keep indexing the cell's words
+void ChapterHtmlSlimParser::endTableCellParagraph() {
+  if (currentTextBlock->isEmpty()) {
+    return;
+  }
+  TableCell& cell = tableCells.back();
+  tableWordCount += currentTextBlock->size();
+  wordsExtractedInBlock += static_cast<int>(currentTextBlock->size());
+  cell.paragraphs.push_back(std::move(currentTextBlock));
+  currentTextBlock.reset(
+      new ParsedText(extraParagraphSpacing, hyphenationEnabled, tableCellBlockStyle(cell.header), widthCache));
+}
+
+void ChapterHtmlSlimParser::endTableCell() {
+  endTableCellParagraph();
+  // Ids seen since the previous cell (including those on the <tr> and <td>) and the cell's footnotes stay with it
+  const auto cell = static_cast<uint16_t>(tableCells.size() - 1);
+  for (const auto& [word, idHash] : pendingAnchors) {
+    tableAnchors.push_back({cell, static_cast<uint16_t>(word), idHash});
+  }
+  for (const auto& [word, entry] : pendingFootnotes) {
+    tableFootnotes.push_back({cell, static_cast<uint16_t>(word), entry});
+  }
+  pendingAnchors.clear();
+  pendingFootnotes.clear();
+
+  currentTextBlock.reset(
+      new ParsedText(extraParagraphSpacing, hyphenationEnabled, tableCellBlockStyle(false), widthCache));
+  wordsExtractedInBlock = 0;
+  tableCellOpen = false;
+}
+
+void ChapterHtmlSlimParser::startFlattenedTableCell(const int row, const int column) {
+  auto style = BlockStyle();
+  style.textAlignDefined = true;
+  style.alignment = (paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None))
+                        ? CssTextAlign::Justify
+                        : static_cast<CssTextAlign>(paragraphAlignment);
+  startNewTextBlock(style);
+
+  currentTextBlock->addWord("Tab", EpdFontFamily::ITALIC);
+  currentTextBlock->addWord("Row", EpdFontFamily::ITALIC);
+  currentTextBlock->addWord(std::to_string(row) + ",", EpdFontFamily::ITALIC);
+  currentTextBlock->addWord("Cell", EpdFontFamily::ITALIC);
+  currentTextBlock->addWord(std::to_string(column) + ":", EpdFontFamily::ITALIC);
+}
+
+// Replays the buffered cells as flattened paragraphs; the rest of the table then flattens as it is parsed
+void ChapterHtmlSlimParser::flattenTable() {
+  LOG_DBG("EHP", "Table doesn't fit grid layout, flattening %u buffered cells",
+          static_cast<unsigned>(tableCells.size()));
+  tableFlattened = true;
+  // The open cell is replayed with the others, and the rest of its text runs on in its last paragraph
+  const bool cellOpen = tableCellOpen;
+  if (cellOpen) {
+    endTableCell();
+  }
+  // Text that followed the last cell, with the ids and footnotes in it
+  std::unique_ptr<ParsedText> pending = std::move(currentTextBlock);
+  const int pendingWords = static_cast<int>(pending->size());
+  auto anchorsAfter = std::move(pendingAnchors);
+  auto footnotesAfter = std::move(pendingFootnotes);
+  pendingAnchors.clear();
+  pendingFootnotes.clear();
+
+  // Hands a cell's ids and footnotes within its first `cellWords` words to the current block, whose words from
+  // `base` on are the cell's
+  size_t anchorIt = 0;
+  size_t footnoteIt = 0;
+  const auto replayMarks = [&](const size_t cell, const int cellWords, const int base) {
+    for (; anchorIt < tableAnchors.size() && tableAnchors[anchorIt].cell == cell &&
+           tableAnchors[anchorIt].word < cellWords;
+         anchorIt++) {
+      pendingAnchors.push_back({base + tableAnchors[anchorIt].word, tableAnchors[anchorIt].idHash});
+    }
+    for (; footnoteIt < tableFootnotes.size() && tableFootnotes[footnoteIt].cell == cell &&
+           tableFootnotes[footnoteIt].word <= cellWords;
+         footnoteIt++) {
+      pendingFootnotes.push_back({base + tableFootnotes[footnoteIt].word, tableFootnotes[footnoteIt].entry});
+    }
+  };
+
+  for (size_t c = 0; c < tableCells.size(); c++) {
+    auto& cell = tableCells[c];
+    startFlattenedTableCell(cell.row, cell.column);
+    const BlockStyle style = currentTextBlock->getBlockStyle();
+    int cellWords = 0;
+    for (size_t p = 0; p < cell.paragraphs.size(); p++) {
+      if (p > 0) {
+        startNewTextBlock(style);
+      }
+      const int base = wordsExtractedInBlock + static_cast<int>(currentTextBlock->size()) - cellWords;
+      cellWords += static_cast<int>(cell.paragraphs[p]->size());
+      replayMarks(c, p + 1 < cell.paragraphs.size() ? cellWords : INT_MAX, base);
+      currentTextBlock->appendWords(*cell.paragraphs[p]);
+    }
+    replayMarks(c, INT_MAX, wordsExtractedInBlock + static_cast<int>(currentTextBlock->size()) - cellWords);
+  }
+  tableCells.clear();
+  tableAnchors.clear();
+  tableFootnotes.clear();
+  tableWordCount = 0;
+
+  if (cellOpen) {
+    return;
+  }
+  if (!currentTextBlock) {
+    currentTextBlock = std::move(pending);
+  } else if (!pending->isEmpty()) {
+    startNewTextBlock(pending->getBlockStyle());
+    currentTextBlock->appendWords(*pending);
+  }
+  const int base = wordsExtractedInBlock + static_cast<int>(currentTextBlock->size()) - pendingWords;
+  for (const auto& [word, idHash] : anchorsAfter) {
+    pendingAnchors.push_back({base + word, idHash});
+  }
+  for (const auto& [word, entry] : footnotesAfter) {
+    pendingFootnotes.push_back({base + word, entry});
+  }
+}
+
+// Columns get their widest content when the table fits the viewport, otherwise their narrowest content plus a share
+// of the remaining width in proportion to how much wider they would like to be. Each row's cells are then broken
+// into lines at their column width and set side by side, with a rule between rows.
+void ChapterHtmlSlimParser::layoutTable() {
+  if (tableCells.empty()) {
+    return;
+  }
+
+  int columns = 0;
+  for (const auto& cell : tableCells) {
+    columns = std::max(columns, cell.column);
+  }
+  std::vector<int> minWidths(columns, 0);
+  std::vector<int> widths(columns, 0);
+  for (const auto& cell : tableCells) {
+    for (const auto& paragraph : cell.paragraphs) {
+      int minWidth, maxWidth;
+      paragraph->measureContentWidths(renderer, fontId, minWidth, maxWidth);
+      minWidths[cell.column - 1] = std::max(minWidths[cell.column - 1], minWidth);
+      widths[cell.column - 1] = std::max(widths[cell.column - 1], maxWidth);
+    }
+  }
+
+  // Two spaces between columns
+  const int columnGap = renderer.getSpaceWidth(fontId, EpdFontFamily::REGULAR) * 2;
+  const int available = viewportWidth - columnGap * (columns - 1);
+  int sumMin = 0;
+  int sumMax = 0;
+  for (int c = 0; c < columns; c++) {
+    sumMin += minWidths[c];
+    sumMax += widths[c];
+  }
+  if (sumMin > available) {
+    flattenTable();
+    return;
+  }
+  if (sumMax > available) {
+    const int spare = available - sumMin;
+    for (int c = 0; c < columns; c++) {
+      widths[c] = minWidths[c] + static_cast<int>(static_cast<int64_t>(widths[c] - minWidths[c]) * spare /
+                                                  (sumMax - sumMin));
+    }
+  }
+  std::vector<int16_t> columnX(columns, 0);
+  int tableWidth = 0;
+  for (int c = 0; c < columns; c++) {
+    columnX[c] = static_cast<int16_t>(tableWidth + (c > 0 ? columnGap : 0));
+    tableWidth = columnX[c] + widths[c];
+  }
+
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+  addTableRule(tableWidth);
+
+  std::vector<std::vector<std::shared_ptr<TextBlock>>> cellLines;
+  std::vector<int> cellWords;
+  size_t rowStart = 0;
+  while (rowStart < tableCells.size()) {
+    size_t rowEnd = rowStart;
+    while (rowEnd < tableCells.size() && tableCells[rowEnd].row == tableCells[rowStart].row) {
+      rowEnd++;
+    }
+
+    cellLines.assign(rowEnd - rowStart, {});
+    cellWords.assign(rowEnd - rowStart, 0);
+    size_t rowLineCount = 0;
+    for (size_t i = rowStart; i < rowEnd; i++) {
+      auto& lines = cellLines[i - rowStart];
+      for (const auto& paragraph : tableCells[i].paragraphs) {
+        paragraph->layoutAndExtractLines(
+            renderer, fontId, widths[tableCells[i].column - 1],
+            [&lines](const std::shared_ptr<TextBlock>& line) { lines.push_back(line); });
+      }
+      rowLineCount = std::max(rowLineCount, lines.size());
+    }
+
+    for (size_t line = 0; line < rowLineCount; line++) {
+      if (currentPageNextY + lineHeight > viewportHeight) {
+        completePageFn(std::move(currentPage));
+        currentPage.reset(new Page());
+        currentPageNextY = 0;
+      }
+      for (size_t i = rowStart; i < rowEnd; i++) {
+        const auto& lines = cellLines[i - rowStart];
+        if (line < lines.size()) {
+          currentPage->elements.push_back(
+              std::make_shared<PageLine>(lines[line], columnX[tableCells[i].column - 1], currentPageNextY));
+          cellWords[i - rowStart] += static_cast<int>(lines[line]->wordCount());
+          placeTableMarks(i, cellWords[i - rowStart]);
+        }
+      }
+      currentPageNextY += lineHeight;
+    }
+    // Ids after a cell's last word, or in a row with no text, stay with the row's last line
+    for (size_t i = rowStart; i < rowEnd; i++) {
+      placeTableMarks(i, INT_MAX);
+    }
+    if (rowLineCount > 0) {
+      addTableRule(tableWidth);
+    }
+    rowStart = rowEnd;
+  }
+
+  tableCells.clear();
+  tableAnchors.clear();
+  tableFootnotes.clear();
+  tableWordCount = 0;
+}
+
+// Ids of `cell` before word `wordLimit` and its footnotes up to that word land on the current page, the way
+// addLineToPage() places them for a paragraph
+void ChapterHtmlSlimParser::placeTableMarks(const size_t cell, const int wordLimit) {
+  auto anchorIt = std::find_if(tableAnchors.begin(), tableAnchors.end(),
+                               [cell](const TableAnchor& anchor) { return anchor.cell == cell; });
+  const auto anchorsStart = anchorIt;
+  for (; anchorIt != tableAnchors.end() && anchorIt->cell == cell && anchorIt->word < wordLimit; ++anchorIt) {
+    anchorFn(anchorIt->idHash);
+  }
+  tableAnchors.erase(anchorsStart, anchorIt);
+
+  auto footnoteIt = std::find_if(tableFootnotes.begin(), tableFootnotes.end(),
+                                 [cell](const TableFootnote& footnote) { return footnote.cell == cell; });
+  const auto footnotesStart = footnoteIt;
+  for (; footnoteIt != tableFootnotes.end() && footnoteIt->cell == cell && footnoteIt->word <= wordLimit;
+       ++footnoteIt) {
+    currentPage->addFootnote(footnoteIt->entry.number, footnoteIt->entry.href);
+  }
+  tableFootnotes.erase(footnotesStart, footnoteIt);
+}
+
+// A one pixel rule with a quarter line of space either side; dropped at the foot of a page, where the page end
+// separates the rows anyway
+void ChapterHtmlSlimParser::addTableRule(const int width) {
+  const int space = static_cast<int>(renderer.getLineHeight(fontId) * lineCompression) / 4;
+  if (currentPageNextY + space * 2 + 1 > viewportHeight) {
+    return;
+  }
+  currentPage->elements.push_back(std::make_shared<PageRule>(0, currentPageNextY + space, width, 1));
+  currentPageNextY += space * 2 + 1;
+}
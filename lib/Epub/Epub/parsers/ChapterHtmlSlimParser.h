@@ -13,10 +13,12 @@
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
+#include "TextRunScanner.h"
 
 class Page;
 class GfxRenderer;
 class Epub;
+class WordWidthCache;
 
 #define MAX_WORD_SIZE 200
 
@@ -26,6 +28,8 @@ class ChapterHtmlSlimParser {
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  // Percentage of the chapter file parsed, throttled so the popup's progress bar costs little indexing time
+  std::function<void(int percent)> progressFn;
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -36,6 +40,7 @@ class ChapterHtmlSlimParser {
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
+  bool nextWordJoins = false;      // true when next flushed word continues a word cut at MAX_WORD_SIZE (no space)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
@@ -47,6 +52,8 @@ class ChapterHtmlSlimParser {
   uint16_t viewportHeight;
   bool hyphenationEnabled;
   const CssParser* cssParser;
+  WordWidthCache* widthCache;  // optional, not owned
+  std::function<void(uint32_t)> anchorFn;  // receives id hashes as the page they land on is known
   bool embeddedStyle;
   uint8_t imageRendering;
   std::string contentBase;
@@ -69,6 +76,33 @@ class ChapterHtmlSlimParser {
   int tableRowIndex = 0;
   int tableColIndex = 0;
 
+  // Table layout: a table's cells are buffered until it closes, then set as columns sized from their measured
+  // content. Tables over the buffering caps, holding images, or too wide for the viewport even with every column at
+  // its narrowest are flattened into one "Tab Row N, Cell M:" paragraph per cell instead.
+  struct TableCell {
+    std::vector<std::unique_ptr<ParsedText>> paragraphs;  // <p>, <div> and <br> inside the cell start a new line
+    int row;
+    int column;
+    bool header;
+  };
+  // An id or footnote inside a buffered table, placed with the line its word lands on
+  struct TableAnchor {
+    uint16_t cell;
+    uint16_t word;  // index among the cell's words
+    uint32_t idHash;
+  };
+  struct TableFootnote {
+    uint16_t cell;
+    uint16_t word;
+    FootnoteEntry entry;
+  };
+  bool tableFlattened = false;
+  bool tableCellOpen = false;  // currentTextBlock is the open paragraph of tableCells.back(), not a paragraph
+  std::vector<TableCell> tableCells;
+  std::vector<TableAnchor> tableAnchors;
+  std::vector<TableFootnote> tableFootnotes;
+  size_t tableWordCount = 0;
+
   // Footnote link tracking
   bool insideFootnoteLink = false;
   int footnoteLinkDepth = -1;
@@ -77,16 +111,31 @@ class ChapterHtmlSlimParser {
   char currentFootnoteLinkHref[64] = {};
   std::vector<std::pair<int, FootnoteEntry>> pendingFootnotes;  // <wordIndex, entry>
   int wordsExtractedInBlock = 0;
+  std::vector<std::pair<int, uint32_t>> pendingAnchors;  // <wordIndex, id hash>
 
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
   void flushPartWordBuffer();
   void makePages();
+  void resolvePendingAnchors(int wordLimit);
+  bool bufferingTable() const { return tableDepth > 0 && !tableFlattened; }
+  BlockStyle tableCellBlockStyle(bool header) const;
+  void startTableCell(bool header);
+  void endTableCellParagraph();
+  void endTableCell();
+  void placeTableMarks(size_t cell, int wordLimit);
+  void startFlattenedTableCell(int row, int column);
+  void flattenTable();
+  void layoutTable();
+  void addTableRule(int width);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL defaultHandlerExpand(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
+  // characterData's word loop, which works on the word-buffer members above
+  template <typename Words>
+  friend void TextRunScanner::appendWords(Words& self, const char* s, int len);
 
  public:
   explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& filepath, GfxRenderer& renderer,
@@ -96,7 +145,10 @@ class ChapterHtmlSlimParser {
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const bool embeddedStyle, const std::string& contentBase,
                                  const std::string& imageBasePath, const uint8_t imageRendering = 0,
-                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr)
+                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr,
+                                 WordWidthCache* widthCache = nullptr,
+                                 const std::function<void(uint32_t anchorHash)>& anchorFn = nullptr,
+                                 const std::function<void(int percent)>& progressFn = nullptr)
 
       : epub(epub),
         filepath(filepath),
@@ -110,7 +162,10 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        progressFn(progressFn),
         cssParser(cssParser),
+        widthCache(widthCache),
+        anchorFn(anchorFn),
         embeddedStyle(embeddedStyle),
         imageRendering(imageRendering),
         contentBase(contentBase),
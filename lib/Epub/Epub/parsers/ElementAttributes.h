@@ -0,0 +1,58 @@
+#pragma once
+
+#include <expat.h>
+
+#include <cstring>
+
+// The attributes ChapterHtmlSlimParser::startElement looks at, collected in one pass. The pointers borrow expat's
+// buffers and are only valid until the handler returns.
+struct ElementAttributes {
+  const char* id = nullptr;
+  const char* name = nullptr;
+  const char* cls = nullptr;
+  const char* style = nullptr;
+  const char* src = nullptr;
+  const char* alt = nullptr;
+  const char* href = nullptr;
+  bool pageBreak = false;  // role="doc-pagebreak" or epub:type="pagebreak"
+
+  explicit ElementAttributes(const XML_Char** atts) {
+    if (!atts) return;
+    for (int i = 0; atts[i]; i += 2) {
+      const char* key = atts[i];
+      const char* value = atts[i + 1];
+      switch (key[0]) {
+        case 'a':
+          if (strcmp(key, "alt") == 0) alt = value;
+          break;
+        case 'c':
+          if (strcmp(key, "class") == 0) cls = value;
+          break;
+        case 'e':
+          if (strcmp(key, "epub:type") == 0 && strcmp(value, "pagebreak") == 0) pageBreak = true;
+          break;
+        case 'h':
+          if (strcmp(key, "href") == 0) href = value;
+          break;
+        case 'i':
+          if (strcmp(key, "id") == 0) id = value;
+          break;
+        case 'n':
+          if (strcmp(key, "name") == 0) name = value;
+          break;
+        case 'r':
+          if (strcmp(key, "role") == 0 && strcmp(value, "doc-pagebreak") == 0) pageBreak = true;
+          break;
+        case 's':
+          if (strcmp(key, "src") == 0) {
+            src = value;
+          } else if (strcmp(key, "style") == 0) {
+            style = value;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+};
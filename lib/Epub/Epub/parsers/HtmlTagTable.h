@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Element names ChapterHtmlSlimParser reacts to, resolved with one hash and one strcmp instead of a strcmp per
+// candidate list. The slot table is a perfect hash built at compile time: the FNV-1a seed is searched by the compiler
+// and a static_assert fails the build if a new tag makes the table collide.
+namespace HtmlTagTable {
+
+enum class HtmlTag : uint8_t {
+  Unknown,
+  H1,
+  H2,
+  H3,
+  H4,
+  H5,
+  H6,
+  P,
+  Li,
+  Div,
+  Br,
+  Blockquote,
+  B,
+  Strong,
+  I,
+  Em,
+  U,
+  Ins,
+  Img,
+  Head,
+  Table,
+  Tr,
+  Td,
+  Th,
+  A,
+  Span,
+};
+
+enum TagFlags : uint8_t {
+  TAG_HEADER = 1 << 0,
+  TAG_BLOCK = 1 << 1,
+  TAG_BOLD = 1 << 2,
+  TAG_ITALIC = 1 << 3,
+  TAG_UNDERLINE = 1 << 4,
+  TAG_IMAGE = 1 << 5,
+  TAG_SKIP = 1 << 6,
+  TAG_TABLE = 1 << 7,  // table, tr, td, th
+};
+
+struct TagInfo {
+  const char* name;
+  HtmlTag tag;
+  uint8_t flags;
+
+  bool is(const uint8_t flag) const { return (flags & flag) != 0; }
+  bool isHeaderOrBlock() const { return is(TAG_HEADER | TAG_BLOCK); }
+  // Everything that neither starts a paragraph nor belongs to a table's structure
+  bool isInline() const { return !is(TAG_HEADER | TAG_BLOCK | TAG_TABLE); }
+};
+
+constexpr TagInfo TAGS[] = {
+    {"h1", HtmlTag::H1, TAG_HEADER},
+    {"h2", HtmlTag::H2, TAG_HEADER},
+    {"h3", HtmlTag::H3, TAG_HEADER},
+    {"h4", HtmlTag::H4, TAG_HEADER},
+    {"h5", HtmlTag::H5, TAG_HEADER},
+    {"h6", HtmlTag::H6, TAG_HEADER},
+    {"p", HtmlTag::P, TAG_BLOCK},
+    {"li", HtmlTag::Li, TAG_BLOCK},
+    {"div", HtmlTag::Div, TAG_BLOCK},
+    {"br", HtmlTag::Br, TAG_BLOCK},
+    {"blockquote", HtmlTag::Blockquote, TAG_BLOCK},
+    {"b", HtmlTag::B, TAG_BOLD},
+    {"strong", HtmlTag::Strong, TAG_BOLD},
+    {"i", HtmlTag::I, TAG_ITALIC},
+    {"em", HtmlTag::Em, TAG_ITALIC},
+    {"u", HtmlTag::U, TAG_UNDERLINE},
+    {"ins", HtmlTag::Ins, TAG_UNDERLINE},
+    {"img", HtmlTag::Img, TAG_IMAGE},
+    {"head", HtmlTag::Head, TAG_SKIP},
+    {"table", HtmlTag::Table, TAG_TABLE},
+    {"tr", HtmlTag::Tr, TAG_TABLE},
+    {"td", HtmlTag::Td, TAG_TABLE},
+    {"th", HtmlTag::Th, TAG_TABLE},
+    {"a", HtmlTag::A, 0},
+    {"span", HtmlTag::Span, 0},
+};
+constexpr int TAG_COUNT = sizeof(TAGS) / sizeof(TAGS[0]);
+
+constexpr TagInfo UNKNOWN_TAG = {"", HtmlTag::Unknown, 0};
+
+constexpr size_t SLOT_COUNT = 128;  // power of two, about 5x the tag count so a seed is found quickly
+constexpr size_t MAX_TAG_LENGTH = 10;  // "blockquote"; longer names are unknown without hashing them
+
+constexpr uint32_t hashName(const char* s, const uint32_t seed) {
+  uint32_t hash = seed;
+  for (; *s; s++) {
+    hash ^= static_cast<uint8_t>(*s);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+constexpr bool seedIsPerfect(const uint32_t seed) {
+  bool used[SLOT_COUNT] = {};
+  for (const auto& info : TAGS) {
+    const size_t slot = hashName(info.name, seed) & (SLOT_COUNT - 1);
+    if (used[slot]) return false;
+    used[slot] = true;
+  }
+  return true;
+}
+
+constexpr uint32_t findSeed() {
+  for (uint32_t seed = 2166136261u; seed < 2166136261u + 4096; seed++) {
+    if (seedIsPerfect(seed)) return seed;
+  }
+  return 0;
+}
+
+constexpr uint32_t SEED = findSeed();
+static_assert(SEED != 0, "No collision-free seed for the HTML tag table, raise SLOT_COUNT");
+
+struct SlotTable {
+  int8_t index[SLOT_COUNT];  // position in TAGS, -1 for an empty slot
+};
+
+constexpr SlotTable buildSlots() {
+  SlotTable table = {};
+  for (auto& slot : table.index) slot = -1;
+  for (int i = 0; i < TAG_COUNT; i++) {
+    table.index[hashName(TAGS[i].name, SEED) & (SLOT_COUNT - 1)] = static_cast<int8_t>(i);
+  }
+  return table;
+}
+
+constexpr SlotTable SLOTS = buildSlots();
+
+inline const TagInfo& lookup(const char* name) {
+  uint32_t hash = SEED;
+  size_t len = 0;
+  for (const char* c = name; *c; c++) {
+    if (++len > MAX_TAG_LENGTH) return UNKNOWN_TAG;
+    hash ^= static_cast<uint8_t>(*c);
+    hash *= 16777619u;
+  }
+  const int index = SLOTS.index[hash & (SLOT_COUNT - 1)];
+  if (index < 0 || strcmp(TAGS[index].name, name) != 0) return UNKNOWN_TAG;
+  return TAGS[index];
+}
+
+}  // namespace HtmlTagTable
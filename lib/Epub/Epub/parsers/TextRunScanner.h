@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Word-at-a-time scan for the bytes ChapterHtmlSlimParser::characterData has to look at individually: XML whitespace
+// and the lead bytes of U+00A0 (0xC2 0xA0), U+202F (0xE2 0x80 0xAF) and U+FEFF (0xEF 0xBB 0xBF). Everything between
+// two such bytes is plain word text and can be copied as one run.
+namespace TextRunScanner {
+
+inline bool isSpecialByte(const uint8_t c) {
+  return c == ' ' || c == '\r' || c == '\n' || c == '\t' || c == 0xC2 || c == 0xE2 || c == 0xEF;
+}
+
+// Non-zero if any byte of `word` is below 0x21 or one of the three lead bytes. Exact as a yes/no answer; control
+// characters below 0x21 are false positives that the caller resolves byte by byte.
+inline uint32_t mayContainSpecial(const uint32_t word) {
+  constexpr uint32_t ONES = 0x01010101u;
+  constexpr uint32_t HIGHS = 0x80808080u;
+  const auto hasZeroByte = [](const uint32_t v) { return (v - ONES) & ~v & HIGHS; };
+  return ((word - ONES * 0x21) & ~word & HIGHS) | hasZeroByte(word ^ (ONES * 0xC2)) |
+         hasZeroByte(word ^ (ONES * 0xE2)) | hasZeroByte(word ^ (ONES * 0xEF));
+}
+
+// Index of the first special byte in s[start, len), or len if the rest is a plain run
+inline int findSpecial(const char* s, int start, const int len) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(s);
+  int i = start;
+
+  // Byte steps until the pointer is 4-byte aligned, so the word loads below are single aligned loads
+  while (i < len && (reinterpret_cast<uintptr_t>(bytes + i) & 3) != 0) {
+    if (isSpecialByte(bytes[i])) return i;
+    i++;
+  }
+
+  while (i + 4 <= len) {
+    uint32_t word;
+    memcpy(&word, bytes + i, sizeof(word));
+    if (mayContainSpecial(word)) {
+      for (const int end = i + 4; i < end; i++) {
+        if (isSpecialByte(bytes[i])) return i;
+      }
+      continue;  // only a control character, keep striding
+    }
+    i += 4;
+  }
+
+  for (; i < len; i++) {
+    if (isSpecialByte(bytes[i])) return i;
+  }
+  return len;
+}
+
+inline bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
+
+// The word loop of ChapterHtmlSlimParser::characterData: appends s[0, len) to the word being built and flushes a word
+// at whitespace, around no-break spaces and when the buffer is full. `Words` provides the parser's word-buffer members
+// (partWordBuffer, partWordBufferIndex, nextWordContinues, nextWordJoins) and flushPartWordBuffer(), so host tools
+// can run the same loop without the rest of the parser.
+template <typename Words>
+void appendWords(Words& self, const char* s, const int len) {
+  constexpr int maxWordSize = static_cast<int>(sizeof(Words::partWordBuffer)) - 1;
+
+  int i = 0;
+  while (i < len) {
+    // Copy the run of plain word bytes up to the next whitespace or possible special-sequence lead byte in bulk
+    const int runEnd = findSpecial(s, i, len);
+    while (i < runEnd) {
+      int count = std::min(runEnd - i, maxWordSize - self.partWordBufferIndex);
+      // Cut an overlong word (typically an unspaced CJK or Thai run) on a codepoint boundary, and join the next
+      // piece to it without a space
+      if (count < runEnd - i) {
+        int cut = count;
+        while (cut > 0 && (static_cast<uint8_t>(s[i + cut]) & 0xC0) == 0x80) {
+          cut--;
+        }
+        if (cut > 0 || self.partWordBufferIndex > 0) {
+          count = cut;
+        }
+      }
+      if (count == 0) {
+        self.flushPartWordBuffer();
+        self.nextWordJoins = true;
+        continue;
+      }
+      memcpy(self.partWordBuffer + self.partWordBufferIndex, s + i, count);
+      self.partWordBufferIndex += count;
+      i += count;
+    }
+    if (i >= len) {
+      break;
+    }
+
+    if (isWhitespace(s[i])) {
+      // Currently looking at whitespace, if there's anything in the partWordBuffer, flush it
+      if (self.partWordBufferIndex > 0) {
+        self.flushPartWordBuffer();
+      }
+      // Whitespace is a real word boundary — reset continuation state
+      self.nextWordContinues = false;
+      self.nextWordJoins = false;
+      // Skip the whitespace char
+      i++;
+      continue;
+    }
+
+    // Detect U+00A0 (non-breaking space, UTF-8: 0xC2 0xA0) or
+    //        U+202F (narrow no-break space, UTF-8: 0xE2 0x80 0xAF).
+    //
+    // Both are rendered as a visible space but must never allow a line break around them.
+    // We split the no-break space into its own word token and link the surrounding words
+    // with continuation flags so the layout engine treats them as an indivisible group.
+    //
+    // Example: "200&#xA0;Quadratkilometer" or "200&#x202F;Quadratkilometer"
+    //   Input bytes:  "200\xC2\xA0Quadratkilometer"  (or 0xE2 0x80 0xAF for U+202F)
+    //   Tokens produced:
+    //     [0] "200"               continues=false
+    //     [1] " "                 continues=true   (attaches to "200", no gap)
+    //     [2] "Quadratkilometer"  continues=true   (attaches to " ", no gap)
+    //
+    //   The continuation flags prevent the line-breaker from inserting a line break
+    //   between "200" and "Quadratkilometer". However, "Quadratkilometer" is now a
+    //   standalone word for hyphenation purposes, so Liang patterns can produce
+    //   "200 Quadrat-" / "kilometer" instead of the unusable "200" / "Quadratkilometer".
+    if (static_cast<uint8_t>(s[i]) == 0xC2 && i + 1 < len && static_cast<uint8_t>(s[i + 1]) == 0xA0) {
+      if (self.partWordBufferIndex > 0) {
+        self.flushPartWordBuffer();
+      }
+
+      self.partWordBuffer[0] = ' ';
+      self.partWordBuffer[1] = '\0';
+      self.partWordBufferIndex = 1;
+      self.nextWordContinues = true;  // Attach space to previous word (no break).
+      self.flushPartWordBuffer();
+
+      self.nextWordContinues = true;  // Next real word attaches to this space (no break).
+
+      i += 2;  // Skip both bytes (0xC2 0xA0)
+      continue;
+    }
+
+    // U+202F (narrow no-break space) — identical logic to U+00A0 above.
+    if (static_cast<uint8_t>(s[i]) == 0xE2 && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0x80 &&
+        static_cast<uint8_t>(s[i + 2]) == 0xAF) {
+      if (self.partWordBufferIndex > 0) {
+        self.flushPartWordBuffer();
+      }
+
+      self.partWordBuffer[0] = ' ';
+      self.partWordBuffer[1] = '\0';
+      self.partWordBufferIndex = 1;
+      self.nextWordContinues = true;
+      self.flushPartWordBuffer();
+
+      self.nextWordContinues = true;
+
+      i += 3;  // Skip all three bytes (0xE2 0x80 0xAF)
+      continue;
+    }
+
+    // Skip Zero Width No-Break Space / BOM (U+FEFF) = 0xEF 0xBB 0xBF
+    if (static_cast<uint8_t>(s[i]) == 0xEF && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0xBB &&
+        static_cast<uint8_t>(s[i + 2]) == 0xBF) {
+      i += 3;
+      continue;
+    }
+
+    // A lead byte that doesn't start one of the sequences above is ordinary word text
+    if (self.partWordBufferIndex >= maxWordSize) {
+      self.flushPartWordBuffer();
+      self.nextWordJoins = true;
+    }
+    self.partWordBuffer[self.partWordBufferIndex++] = s[i];
+    i++;
+  }
+}
+
+}  // namespace TextRunScanner
@@ -0,0 +1,309 @@
+#include "BookCacheIndex.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+constexpr char INDEX_FILE_NAME[] = "/cache_index.bin";
+constexpr char PROGRESS_FILE_NAME[] = "progress.bin";
+constexpr size_t MAX_RESERVED_ENTRIES = 256;
+
+using BookUsage = BookCacheIndex::BookUsage;
+
+// What each eviction pass removes from a book cache directory, cheapest to rebuild first
+enum class EvictionTier { IMAGES, SECTIONS, METADATA };
+
+struct Index {
+  std::vector<BookUsage> entries;
+  uint32_t accessClock = 0;
+};
+
+bool isBookCacheDir(const char* name) {
+  return strncmp(name, "epub_", 5) == 0 || strncmp(name, "xtc_", 4) == 0 || strncmp(name, "txt_", 4) == 0;
+}
+
+Index loadIndex(const std::string& cacheDir) {
+  Index index;
+  const std::string indexFile = cacheDir + INDEX_FILE_NAME;
+  if (!Storage.exists(indexFile.c_str())) {
+    return index;
+  }
+  FsFile file;
+  if (!Storage.openFileForRead("BCI", indexFile, file)) {
+    return index;
+  }
+  uint8_t version = 0;
+  uint16_t count = 0;
+  serialization::readPod(file, version);
+  if (version != INDEX_FILE_VERSION) {
+    LOG_DBG("BCI", "Ignoring cache index version %u", version);
+    return index;
+  }
+  serialization::readPod(file, index.accessClock);
+  serialization::readPod(file, count);
+  // Don't trust a count from the card with the up-front reservation; entries past it grow as the file yields them
+  index.entries.reserve(std::min<size_t>(count, MAX_RESERVED_ENTRIES));
+  for (uint16_t i = 0; i < count && file.available() > 0; i++) {
+    BookUsage entry;
+    serialization::readString(file, entry.dirName);
+    serialization::readString(file, entry.bookPath);
+    serialization::readPod(file, entry.bytes);
+    serialization::readPod(file, entry.lastAccess);
+    index.entries.push_back(std::move(entry));
+  }
+  return index;
+}
+
+void saveIndex(const std::string& cacheDir, const Index& index) {
+  FsFile file;
+  if (!Storage.openFileForWrite("BCI", cacheDir + INDEX_FILE_NAME, file)) {
+    return;
+  }
+  serialization::writePod(file, INDEX_FILE_VERSION);
+  serialization::writePod(file, index.accessClock);
+  serialization::writePod(file, static_cast<uint16_t>(index.entries.size()));
+  for (const auto& entry : index.entries) {
+    serialization::writeString(file, entry.dirName);
+    serialization::writeString(file, entry.bookPath);
+    serialization::writePod(file, entry.bytes);
+    serialization::writePod(file, entry.lastAccess);
+  }
+}
+
+std::vector<BookUsage>::iterator findEntry(Index& index, const std::string& dirName) {
+  return std::find_if(index.entries.begin(), index.entries.end(),
+                      [&dirName](const BookUsage& entry) { return entry.dirName == dirName; });
+}
+
+// Total size of the files below `path`
+uint64_t directorySize(const std::string& path) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return 0;
+  }
+  uint64_t total = 0;
+  char name[128];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      file.close();
+      total += directorySize(path + "/" + name);
+    } else {
+      total += file.fileSize();
+      file.close();
+    }
+  }
+  dir.close();
+  return total;
+}
+
+uint32_t measure(const std::string& bookDir) {
+  return static_cast<uint32_t>(std::min<uint64_t>(directorySize(bookDir), UINT32_MAX));
+}
+
+uint64_t removeFile(const std::string& path) {
+  FsFile file;
+  if (!Storage.openFileForRead("BCI", path, file)) {
+    return 0;
+  }
+  const uint64_t size = file.fileSize();
+  file.close();
+  return Storage.remove(path.c_str()) ? size : 0;
+}
+
+uint64_t removeDirectory(const std::string& path) {
+  const uint64_t size = directorySize(path);
+  return Storage.removeDir(path.c_str()) ? size : 0;
+}
+
+// Removes one tier of derived data from a book cache directory and returns the bytes freed
+uint64_t evictTier(const std::string& bookDir, const EvictionTier tier) {
+  if (tier == EvictionTier::SECTIONS) {
+    // EPUB section files, TXT page index
+    uint64_t freed = 0;
+    if (Storage.exists((bookDir + "/sections").c_str())) {
+      freed += removeDirectory(bookDir + "/sections");
+    }
+    if (Storage.exists((bookDir + "/index.bin").c_str())) {
+      freed += removeFile(bookDir + "/index.bin");
+    }
+    return freed;
+  }
+
+  // Collect first, then remove, so the directory isn't modified while it is being iterated
+  std::vector<std::string> names;
+  std::vector<bool> isDir;
+  auto dir = Storage.open(bookDir.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return 0;
+  }
+  char name[128];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool directory = file.isDirectory();
+    file.close();
+    if (tier == EvictionTier::IMAGES ? strncmp(name, "img_", 4) == 0 : strcmp(name, PROGRESS_FILE_NAME) != 0) {
+      names.emplace_back(name);
+      isDir.push_back(directory);
+    }
+  }
+  dir.close();
+
+  uint64_t freed = 0;
+  std::vector<long> spines;
+  for (size_t i = 0; i < names.size(); i++) {
+    const std::string path = bookDir + "/" + names[i];
+    freed += isDir[i] ? removeDirectory(path) : removeFile(path);
+    if (tier == EvictionTier::IMAGES) {
+      // "img_<spine>_<n>.<ext>" and its ".pxc" pixel cache: the section laid out around them goes too, as it would
+      // otherwise point at missing files
+      const long spine = strtol(names[i].c_str() + 4, nullptr, 10);
+      if (std::find(spines.begin(), spines.end(), spine) == spines.end()) {
+        spines.push_back(spine);
+      }
+    }
+  }
+  for (const long spine : spines) {
+    const std::string sectionFile = bookDir + "/sections/" + std::to_string(spine) + ".bin";
+    if (Storage.exists(sectionFile.c_str())) {
+      freed += removeFile(sectionFile);
+    }
+  }
+  return freed;
+}
+
+// Brings the index in line with the book cache directories actually present. Returns true if anything changed.
+bool syncWithDirectory(const std::string& cacheDir, Index& index) {
+  auto root = Storage.open(cacheDir.c_str());
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return false;
+  }
+  std::vector<std::string> present;
+  char name[128];
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (file.isDirectory() && isBookCacheDir(name)) {
+      present.emplace_back(name);
+    }
+    file.close();
+  }
+  root.close();
+
+  bool changed = false;
+  const auto removed = std::remove_if(index.entries.begin(), index.entries.end(), [&present](const BookUsage& entry) {
+    return std::find(present.begin(), present.end(), entry.dirName) == present.end();
+  });
+  if (removed != index.entries.end()) {
+    index.entries.erase(removed, index.entries.end());
+    changed = true;
+  }
+  for (const auto& dirName : present) {
+    if (findEntry(index, dirName) == index.entries.end()) {
+      index.entries.push_back({dirName, "", measure(cacheDir + "/" + dirName), 0});
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+void splitCachePath(const std::string& cachePath, std::string& cacheDir, std::string& dirName) {
+  const auto lastSlash = cachePath.find_last_of('/');
+  cacheDir = lastSlash == std::string::npos ? "" : cachePath.substr(0, lastSlash);
+  dirName = lastSlash == std::string::npos ? cachePath : cachePath.substr(lastSlash + 1);
+}
+
+}  // namespace
+
+void BookCacheIndex::touch(const std::string& cachePath, const std::string& bookPath) {
+  std::string cacheDir, dirName;
+  splitCachePath(cachePath, cacheDir, dirName);
+  Index index = loadIndex(cacheDir);
+
+  // The book read before this one has most likely grown since it was last measured
+  const auto previous =
+      std::max_element(index.entries.begin(), index.entries.end(),
+                       [](const BookUsage& a, const BookUsage& b) { return a.lastAccess < b.lastAccess; });
+  if (previous != index.entries.end() && previous->dirName != dirName) {
+    previous->bytes = measure(cacheDir + "/" + previous->dirName);
+  }
+
+  auto it = findEntry(index, dirName);
+  if (it == index.entries.end()) {
+    index.entries.push_back({dirName, "", 0, 0});
+    it = index.entries.end() - 1;
+  }
+  it->bookPath = bookPath;
+  it->bytes = measure(cachePath);
+  it->lastAccess = ++index.accessClock;
+  saveIndex(cacheDir, index);
+}
+
+uint64_t BookCacheIndex::enforceBudget(const std::string& cacheDir, const uint64_t budgetBytes,
+                                       const std::string& keepCachePath) {
+  if (budgetBytes == 0) {
+    return 0;
+  }
+  Index index = loadIndex(cacheDir);
+  const bool changed = syncWithDirectory(cacheDir, index);
+
+  uint64_t total = 0;
+  for (const auto& entry : index.entries) {
+    total += entry.bytes;
+  }
+  if (total <= budgetBytes) {
+    if (changed) {
+      saveIndex(cacheDir, index);
+    }
+    return 0;
+  }
+
+  std::string keepCacheDir, keepDirName;
+  splitCachePath(keepCachePath, keepCacheDir, keepDirName);
+  std::vector<BookUsage*> candidates;
+  for (auto& entry : index.entries) {
+    if (entry.dirName != keepDirName) {
+      candidates.push_back(&entry);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const BookUsage* a, const BookUsage* b) { return a->lastAccess < b->lastAccess; });
+
+  const uint32_t start = millis();
+  uint64_t freed = 0;
+  for (const auto tier : {EvictionTier::IMAGES, EvictionTier::SECTIONS, EvictionTier::METADATA}) {
+    for (auto* entry : candidates) {
+      if (total <= budgetBytes) {
+        break;
+      }
+      const uint64_t bookFreed = std::min<uint64_t>(evictTier(cacheDir + "/" + entry->dirName, tier), entry->bytes);
+      entry->bytes -= static_cast<uint32_t>(bookFreed);
+      total -= std::min(bookFreed, total);
+      freed += bookFreed;
+    }
+  }
+  saveIndex(cacheDir, index);
+
+  LOG_DBG("BCI", "Freed %llu bytes in %lu ms, cache now %llu of %llu bytes", static_cast<unsigned long long>(freed),
+          millis() - start, static_cast<unsigned long long>(total), static_cast<unsigned long long>(budgetBytes));
+  return freed;
+}
+
+std::vector<BookCacheIndex::BookUsage> BookCacheIndex::usage(const std::string& cacheDir) {
+  Index index = loadIndex(cacheDir);
+  if (syncWithDirectory(cacheDir, index)) {
+    saveIndex(cacheDir, index);
+  }
+  std::sort(index.entries.begin(), index.entries.end(),
+            [](const BookUsage& a, const BookUsage& b) { return a.lastAccess > b.lastAccess; });
+  return std::move(index.entries);
+}
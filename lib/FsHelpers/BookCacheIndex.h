@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Footprint and recency of every book cache directory under the cache root, kept in "<cacheDir>/cache_index.bin".
+ *
+ * Recency is a counter bumped on every book open rather than a timestamp, as the device has no reliable clock.
+ * Sizes are measured when a book is opened (along with the book that was open before it, which is the one that grew
+ * while being read) and when an unknown cache directory shows up, so listing usage rarely walks the card.
+ *
+ * enforceBudget() frees space from the least recently read books in three passes, cheapest to rebuild first:
+ * extracted images and pixel caches (together with the sections that reference them), then the remaining section and
+ * page index files, then book metadata, covers and thumbnails. Reading progress is never evicted.
+ */
+class BookCacheIndex {
+ public:
+  struct BookUsage {
+    std::string dirName;   // e.g. "epub_1f3a..."
+    std::string bookPath;  // empty for caches that haven't been opened since the index was created
+    uint32_t bytes;
+    uint32_t lastAccess;  // 0 = never opened since the index was created
+  };
+
+  // Marks the book cached at `cachePath` as the most recently read one and measures it.
+  static void touch(const std::string& cachePath, const std::string& bookPath);
+
+  /**
+   * Evicts derived data of the least recently read books until the total footprint is at most `budgetBytes`
+   * (0 = unlimited). The cache at `keepCachePath`, normally the book being opened, is left alone.
+   * Returns the number of bytes freed.
+   */
+  static uint64_t enforceBudget(const std::string& cacheDir, uint64_t budgetBytes, const std::string& keepCachePath);
+
+  // All book caches, most recently read first. Picks up and measures caches the index doesn't know yet.
+  static std::vector<BookUsage> usage(const std::string& cacheDir);
+};
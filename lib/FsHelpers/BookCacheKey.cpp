@@ -0,0 +1,234 @@
+#include "BookCacheKey.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr uint8_t KEY_FILE_VERSION = 2;
+constexpr char KEY_FILE_NAME[] = "/cache_keys.bin";
+
+struct KeyEntry {
+  std::string path;
+  uint32_t size;
+  uint64_t tailHash;  // of the last 1KB, re-checked before the remembered fingerprint is reused
+  uint64_t fingerprint;
+};
+
+// Most recently used entry last. Loaded once per cache directory.
+std::vector<KeyEntry> entries;
+std::string loadedCacheDir;
+bool loaded = false;
+
+uint64_t fnv1a(uint64_t hash, const uint8_t* data, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// Hash of the last SAMPLE_SIZE bytes (the whole file if it is smaller). For an EPUB that is the zip central directory
+// with the CRC of every entry, so a book edited in place without changing size still hashes differently.
+uint64_t hashTail(FsFile& file, const uint32_t size, uint8_t* buffer, const size_t sampleSize) {
+  const uint32_t offset = size > sampleSize ? size - sampleSize : 0;
+  uint64_t hash = 14695981039346656037ull;
+  if (file.seekSet(offset)) {
+    const int bytesRead = file.read(buffer, std::min<size_t>(sampleSize, size - offset));
+    if (bytesRead > 0) {
+      hash = fnv1a(hash, buffer, static_cast<size_t>(bytesRead));
+    }
+  }
+  return hash;
+}
+
+std::string toHex(const uint64_t value) {
+  static constexpr char DIGITS[] = "0123456789abcdef";
+  std::string hex(16, '0');
+  for (int i = 15, shift = 0; i >= 0; i--, shift += 4) {
+    hex[i] = DIGITS[(value >> shift) & 0xF];
+  }
+  return hex;
+}
+
+void loadEntries(const std::string& cacheDir) {
+  if (loaded && loadedCacheDir == cacheDir) {
+    return;
+  }
+  entries.clear();
+  loadedCacheDir = cacheDir;
+  loaded = true;
+
+  const std::string keyFile = cacheDir + KEY_FILE_NAME;
+  if (!Storage.exists(keyFile.c_str())) {
+    return;
+  }
+  FsFile file;
+  if (!Storage.openFileForRead("BCK", keyFile, file)) {
+    return;
+  }
+  uint8_t version = 0;
+  uint16_t count = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, count);
+  if (version != KEY_FILE_VERSION) {
+    LOG_DBG("BCK", "Ignoring cache key map version %u", version);
+    return;
+  }
+  // The map never holds more than MAX_ENTRIES, so a larger count means a corrupt file
+  if (count > BookCacheKey::MAX_ENTRIES) {
+    LOG_ERR("BCK", "Ignoring cache key map with %u entries", count);
+    return;
+  }
+  entries.reserve(count);
+  for (uint16_t i = 0; i < count && file.available() > 0; i++) {
+    KeyEntry entry;
+    serialization::readString(file, entry.path);
+    serialization::readPod(file, entry.size);
+    serialization::readPod(file, entry.tailHash);
+    serialization::readPod(file, entry.fingerprint);
+    entries.push_back(std::move(entry));
+  }
+}
+
+void saveEntries() {
+  FsFile file;
+  if (!Storage.openFileForWrite("BCK", loadedCacheDir + KEY_FILE_NAME, file)) {
+    return;
+  }
+  serialization::writePod(file, KEY_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint16_t>(entries.size()));
+  for (const auto& entry : entries) {
+    serialization::writeString(file, entry.path);
+    serialization::writePod(file, entry.size);
+    serialization::writePod(file, entry.tailHash);
+    serialization::writePod(file, entry.fingerprint);
+  }
+}
+
+std::vector<KeyEntry>::iterator findEntry(const std::string& path) {
+  return std::find_if(entries.begin(), entries.end(), [&path](const KeyEntry& entry) { return entry.path == path; });
+}
+
+// True when a remembered path other than `except` maps to `fingerprint`, i.e. another copy still uses its cache
+bool isShared(const uint64_t fingerprint, const std::string& except) {
+  return std::any_of(entries.begin(), entries.end(), [&](const KeyEntry& entry) {
+    return entry.fingerprint == fingerprint && entry.path != except;
+  });
+}
+
+std::string legacyCachePath(const std::string& bookPath, const std::string& cacheDir, const char* prefix) {
+  return cacheDir + "/" + prefix + std::to_string(std::hash<std::string>{}(bookPath));
+}
+
+}  // namespace
+
+std::string BookCacheKey::cachePath(const std::string& bookPath, const std::string& cacheDir, const char* prefix) {
+  loadEntries(cacheDir);
+  auto it = findEntry(bookPath);
+
+  FsFile file;
+  if (!Storage.exists(bookPath.c_str()) || !Storage.openFileForRead("BCK", bookPath, file)) {
+    return it != entries.end() ? cacheDir + "/" + prefix + toHex(it->fingerprint)
+                               : legacyCachePath(bookPath, cacheDir, prefix);
+  }
+
+  const uint32_t size = static_cast<uint32_t>(file.fileSize());
+  uint8_t buffer[SAMPLE_SIZE];
+  // Path and size alone would reuse the old key for a book replaced in place by an edit of the same size, so the
+  // fast path also re-reads the tail. The storage layer has no modification times to go by.
+  const uint64_t tailHash = hashTail(file, size, buffer, SAMPLE_SIZE);
+  if (it != entries.end() && it->size == size && it->tailHash == tailHash) {
+    // Keep recently opened books at the end so they outlive older entries
+    if (it != entries.end() - 1) {
+      std::rotate(it, it + 1, entries.end());
+      saveEntries();
+    }
+    return cacheDir + "/" + prefix + toHex(entries.back().fingerprint);
+  }
+
+  const uint32_t start = millis();
+  uint64_t fingerprint = fnv1a(14695981039346656037ull, reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+  for (int i = -1; i < SAMPLE_COUNT - 1; i++) {
+    const size_t offset = i < 0 ? 0 : SAMPLE_SIZE << (2 * i);
+    if (offset >= size || !file.seekSet(offset)) {
+      break;
+    }
+    const int bytesRead = file.read(buffer, std::min(SAMPLE_SIZE, size - offset));
+    if (bytesRead > 0) {
+      fingerprint = fnv1a(fingerprint, buffer, static_cast<size_t>(bytesRead));
+    }
+  }
+  if (size > SAMPLE_SIZE && file.seekSet(size - SAMPLE_SIZE)) {
+    const int bytesRead = file.read(buffer, SAMPLE_SIZE);
+    if (bytesRead > 0) {
+      fingerprint = fnv1a(fingerprint, buffer, static_cast<size_t>(bytesRead));
+    }
+  }
+  file.close();
+
+  const std::string path = cacheDir + "/" + prefix + toHex(fingerprint);
+  LOG_DBG("BCK", "Fingerprinted %s in %lu ms", bookPath.c_str(), millis() - start);
+
+  // Adopt a cache built before content keys existed instead of indexing the book again
+  const std::string legacyPath = legacyCachePath(bookPath, cacheDir, prefix);
+  if (!Storage.exists(path.c_str()) && Storage.exists(legacyPath.c_str())) {
+    Storage.rename(legacyPath.c_str(), path.c_str());
+  }
+
+  if (it != entries.end()) {
+    // The file at this path was replaced, so the cache of its previous contents would only take up space
+    const std::string stalePath = cacheDir + "/" + prefix + toHex(it->fingerprint);
+    if (it->fingerprint != fingerprint && !isShared(it->fingerprint, bookPath) && Storage.exists(stalePath.c_str())) {
+      Storage.removeDir(stalePath.c_str());
+    }
+    entries.erase(it);
+  }
+  if (entries.size() >= MAX_ENTRIES) {
+    entries.erase(entries.begin());
+  }
+  entries.push_back({bookPath, size, tailHash, fingerprint});
+  saveEntries();
+  return path;
+}
+
+void BookCacheKey::discard(const std::string& bookPath, const std::string& cacheDir, const char* prefix) {
+  loadEntries(cacheDir);
+  const auto it = findEntry(bookPath);
+  if (it == entries.end()) {
+    const std::string legacyPath = legacyCachePath(bookPath, cacheDir, prefix);
+    if (Storage.exists(legacyPath.c_str())) {
+      Storage.removeDir(legacyPath.c_str());
+    }
+    return;
+  }
+
+  const uint64_t fingerprint = it->fingerprint;
+  entries.erase(it);
+  saveEntries();
+  const std::string path = cacheDir + "/" + prefix + toHex(fingerprint);
+  if (isShared(fingerprint, bookPath)) {
+    LOG_DBG("BCK", "Keeping %s, another copy of %s uses it", path.c_str(), bookPath.c_str());
+  } else if (Storage.exists(path.c_str())) {
+    Storage.removeDir(path.c_str());
+  }
+}
+
+void BookCacheKey::rename(const std::string& oldPath, const std::string& newPath, const std::string& cacheDir) {
+  loadEntries(cacheDir);
+  const auto it = findEntry(oldPath);
+  if (it == entries.end()) {
+    return;
+  }
+  const auto stale = findEntry(newPath);
+  if (stale != entries.end()) {
+    entries.erase(stale);
+  }
+  findEntry(oldPath)->path = newPath;
+  saveEntries();
+}
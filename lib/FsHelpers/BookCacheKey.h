@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Cache directory naming for books.
+ *
+ * A book is cached under "<cacheDir>/<prefix><key>", where the key is a fingerprint of the file contents: the file
+ * size plus a 64-bit FNV-1a hash of 1KB samples taken at the KOReaderDocumentId offsets and of the last 1KB (for an
+ * EPUB that is the zip central directory, which carries the CRC of every entry). Renaming or moving a book keeps its
+ * key, so the metadata cache, sections and images survive; changed content gets a new key.
+ *
+ * Fingerprints are remembered per path in "<cacheDir>/cache_keys.bin" and reused while the file size and the hash of
+ * its last 1KB are unchanged, so opening a known book costs one sampled read instead of a dozen.
+ */
+class BookCacheKey {
+ public:
+  // Paths remembered in cache_keys.bin; the least recently opened one is forgotten first
+  static constexpr size_t MAX_ENTRIES = 64;
+
+  /**
+   * Cache directory for the book at `bookPath`, e.g. "/.crosspoint/epub_1f3a...".
+   * Falls back to the remembered fingerprint when the file can't be opened (it may have just been deleted) and to
+   * the legacy path hash when nothing is known about it. A cache directory left under the legacy path-hash name is
+   * renamed to the new key the first time the book is fingerprinted, and the cache of a file that was replaced at the
+   * same path is removed unless another remembered path still shares it.
+   */
+  static std::string cachePath(const std::string& bookPath, const std::string& cacheDir, const char* prefix);
+
+  /**
+   * Forgets `bookPath` and removes the cache of the contents last seen there, e.g. after the file was deleted or
+   * replaced. Copies of a book share one cache directory, so it is kept while another remembered path still maps to
+   * the same fingerprint. Nothing is fingerprinted: a path that isn't remembered only loses its legacy path-hash cache.
+   */
+  static void discard(const std::string& bookPath, const std::string& cacheDir, const char* prefix);
+
+  // Carries the remembered fingerprint over to the book's new path after a rename or move.
+  static void rename(const std::string& oldPath, const std::string& newPath, const std::string& cacheDir);
+
+ private:
+  static constexpr size_t SAMPLE_SIZE = 1024;
+  static constexpr int SAMPLE_COUNT = 12;  // same offsets as KOReaderDocumentId
+};
@@ -0,0 +1,129 @@
+#include "ProgressJournal.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Record layout, little-endian: marker "PJ", u16 reserved, u32 sequence, payload, u32 CRC-32 of everything before it
+constexpr uint8_t MARKER[2] = {'P', 'J'};
+constexpr size_t SEQUENCE_OFFSET = 4;
+constexpr size_t PAYLOAD_OFFSET = 8;
+constexpr size_t CRC_OFFSET = PAYLOAD_OFFSET + ProgressJournal::PAYLOAD_SIZE;
+static_assert(CRC_OFFSET + 4 == ProgressJournal::RECORD_SIZE, "Record fields must fill the record");
+// Shortest pre-journal progress.bin (TXT and XTC page, older EPUB spine and page)
+constexpr size_t LEGACY_MIN_SIZE = 4;
+
+uint32_t crc32(const uint8_t* data, const size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+uint32_t readU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+
+void writeU32(uint8_t* p, const uint32_t value) {
+  p[0] = value & 0xFF;
+  p[1] = (value >> 8) & 0xFF;
+  p[2] = (value >> 16) & 0xFF;
+  p[3] = (value >> 24) & 0xFF;
+}
+
+bool recordValid(const uint8_t* record) {
+  return record[0] == MARKER[0] && record[1] == MARKER[1] &&
+         readU32(record + CRC_OFFSET) == crc32(record, CRC_OFFSET);
+}
+
+}  // namespace
+
+bool ProgressJournal::load(const ReadFn read, void* ctx, const size_t size) {
+  memset(payload, 0, PAYLOAD_SIZE);
+  sequence = 0;
+  nextSlot = 0;
+  dirty = false;
+  uint8_t image[FILE_SIZE];
+  const size_t bytes = read(ctx, 0, image, std::min(size, FILE_SIZE));
+  fileSize = size;
+
+  bool found = false;
+  for (size_t slot = 0; slot < bytes / RECORD_SIZE; slot++) {
+    const uint8_t* record = image + slot * RECORD_SIZE;
+    if (!recordValid(record)) {
+      continue;
+    }
+    const uint32_t recordSequence = readU32(record + SEQUENCE_OFFSET);
+    if (!found || recordSequence > sequence) {
+      found = true;
+      sequence = recordSequence;
+      memcpy(payload, record + PAYLOAD_OFFSET, PAYLOAD_SIZE);
+      nextSlot = (slot + 1) % RECORD_COUNT;
+    }
+  }
+  if (found) {
+    return true;
+  }
+
+  // Pre-journal file: the bare payload, 4 or 6 bytes, followed by zero padding if the first flush was torn. A first
+  // record torn before its CRC landed starts with the marker instead, and is dropped rather than read as a position.
+  const bool marked = bytes >= 2 && image[0] == MARKER[0] && image[1] == MARKER[1];
+  if (bytes < LEGACY_MIN_SIZE || marked) {
+    return false;
+  }
+  // A torn flush can also leave garbage after the old payload. Only its first LEGACY_MIN_SIZE bytes are kept then,
+  // the flush never writes those.
+  const bool padded = std::all_of(image + std::min(bytes, PAYLOAD_SIZE), image + std::min(bytes, RECORD_SIZE),
+                                  [](const uint8_t b) { return b == 0; });
+  memcpy(payload, image, padded ? std::min(bytes, PAYLOAD_SIZE) : LEGACY_MIN_SIZE);
+  // Keep the old position intact until a record has been written after it
+  nextSlot = 1;
+  return true;
+}
+
+bool ProgressJournal::update(const uint8_t* newPayload) {
+  if (memcmp(payload, newPayload, PAYLOAD_SIZE) == 0) {
+    return false;
+  }
+  memcpy(payload, newPayload, PAYLOAD_SIZE);
+  dirty = true;
+  return true;
+}
+
+bool ProgressJournal::flush(const WriteFn write, void* ctx) {
+  if (!dirty) {
+    return true;
+  }
+
+  // Slots are filled in order, so the slot is at most one record past the end of the file. The gap after a
+  // pre-journal payload is zero-filled in the same write.
+  const size_t offset = nextSlot * RECORD_SIZE;
+  const size_t start = std::min(offset, fileSize);
+  uint8_t buffer[2 * RECORD_SIZE] = {};
+  uint8_t* record = buffer + (offset - start);
+  record[0] = MARKER[0];
+  record[1] = MARKER[1];
+  writeU32(record + SEQUENCE_OFFSET, sequence + 1);
+  memcpy(record + PAYLOAD_OFFSET, payload, PAYLOAD_SIZE);
+  writeU32(record + CRC_OFFSET, crc32(record, CRC_OFFSET));
+
+  const size_t len = offset - start + RECORD_SIZE;
+  if (write(ctx, start, buffer, len) != len) {
+    return false;
+  }
+  sequence++;
+  fileSize = std::max(fileSize, offset + RECORD_SIZE);
+  nextSlot = (nextSlot + 1) % RECORD_COUNT;
+  dirty = false;
+  return true;
+}
+
+void ProgressJournal::restart() {
+  sequence = 0;
+  nextSlot = 0;
+  fileSize = 0;
+  dirty = true;
+}
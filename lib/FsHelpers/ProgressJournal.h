@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Reading position of a book, kept in RAM and written behind to the book's progress.bin.
+ *
+ * progress.bin is a ring of RECORD_COUNT fixed-size records, each holding a sequence number, the reader's payload and
+ * a CRC-32. A flush overwrites the slot after the newest record, so a write torn by power loss only ever damages the
+ * record being written and load() falls back to the newest intact one. Once the ring has filled the file stays at
+ * FILE_SIZE bytes and is rewritten in place. Files from before the journal hold the bare payload and are still read;
+ * the first flush appends to them instead of overwriting the old position.
+ *
+ * Reads and writes go through callbacks, so this class doesn't depend on the storage layer.
+ */
+class ProgressJournal {
+ public:
+  static constexpr size_t PAYLOAD_SIZE = 8;
+  static constexpr size_t RECORD_SIZE = 20;
+  static constexpr size_t RECORD_COUNT = 25;
+  static constexpr size_t FILE_SIZE = RECORD_SIZE * RECORD_COUNT;  // fits in one SD sector
+
+  using ReadFn = size_t (*)(void* ctx, size_t offset, uint8_t* out, size_t len);
+  using WriteFn = size_t (*)(void* ctx, size_t offset, const uint8_t* data, size_t len);
+
+  // Reads the newest intact record, or the payload of a pre-journal file. Returns false and a zeroed payload if the
+  // file holds neither.
+  bool load(ReadFn read, void* ctx, size_t fileSize);
+
+  // Stages a position in RAM. Returns true if it differs from the staged one.
+  bool update(const uint8_t* newPayload);
+
+  // Writes the staged position to the next slot if it hasn't been written yet
+  bool flush(WriteFn write, void* ctx);
+
+  // Rewrites the staged position from slot 0 on the next flush, for when progress.bin was deleted under the journal
+  void restart();
+
+  const uint8_t* getPayload() const { return payload; }
+  bool isDirty() const { return dirty; }
+
+ private:
+  uint8_t payload[PAYLOAD_SIZE] = {};
+  uint32_t sequence = 0;  // of the newest record in the file, 0 if none
+  size_t nextSlot = 0;
+  size_t fileSize = 0;
+  bool dirty = false;
+};
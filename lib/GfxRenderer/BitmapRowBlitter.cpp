@@ -0,0 +1,155 @@
+#include "BitmapRowBlitter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+inline uint8_t reverseBits(uint8_t b) {
+  b = static_cast<uint8_t>((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+  b = static_cast<uint8_t>((b & 0xCC) >> 2 | (b & 0x33) << 2);
+  return static_cast<uint8_t>((b & 0xAA) >> 1 | (b & 0x55) << 1);
+}
+
+// 8x8 bit matrix transpose, row 0 in the top byte and column 0 in each byte's MSB (Hacker's Delight, transpose8)
+inline uint64_t transpose8(uint64_t m) {
+  m = (m & 0xAA55AA55AA55AA55ull) | (m & 0x00AA00AA00AA00AAull) << 7 | (m >> 7 & 0x00AA00AA00AA00AAull);
+  m = (m & 0xCCCC3333CCCC3333ull) | (m & 0x0000CCCC0000CCCCull) << 14 | (m >> 14 & 0x0000CCCC0000CCCCull);
+  return (m & 0xF0F0F0F00F0F0F0Full) | (m & 0x00000000F0F0F0F0ull) << 28 | (m >> 28 & 0x00000000F0F0F0F0ull);
+}
+
+}  // namespace
+
+BitmapRowBlitter::BitmapRowBlitter(uint8_t* frameBuffer, const int panelWidthBytes, const int panelHeight,
+                                   const RowAxis axis, const bool state)
+    : frameBuffer(frameBuffer), panelWidthBytes(panelWidthBytes), panelHeight(panelHeight), axis(axis), state(state) {}
+
+BitmapRowBlitter::~BitmapRowBlitter() {
+  free(xMap);
+  free(masks);
+}
+
+bool BitmapRowBlitter::begin(const int bmpWidth, const int cropPixX, const bool isScaled, const float scale,
+                             const int x, const int screenWidth) {
+  xBegin = cropPixX;
+  xEnd = cropPixX;
+  const int columns = bmpWidth - 2 * cropPixX;
+  if (columns <= 0) {
+    return true;
+  }
+  // A logical row spans the panel width in landscape and the panel height in portrait
+  maskStride = isPortrait() ? (panelHeight + 7) / 8 : panelWidthBytes;
+  masks = static_cast<uint8_t*>(calloc(isPortrait() ? 8 * maskStride : maskStride, 1));
+  xMap = static_cast<int16_t*>(malloc(columns * sizeof(int16_t)));
+  if (!masks || !xMap) {
+    return false;
+  }
+
+  int count = 0;
+  for (int bmpX = cropPixX; bmpX < bmpWidth - cropPixX; bmpX++) {
+    int screenX = bmpX - cropPixX;
+    if (isScaled) {
+      screenX = std::floor(screenX * scale);
+    }
+    screenX += x;  // the offset should not be scaled
+    if (screenX >= screenWidth) {
+      break;
+    }
+    if (screenX < 0) {
+      xBegin = bmpX + 1;
+      continue;
+    }
+    xMap[count++] = static_cast<int16_t>(screenX);
+  }
+  xEnd = xBegin + count;
+  if (count > 0) {
+    firstByte = xMap[0] / 8;
+    lastByte = xMap[count - 1] / 8;
+  }
+  return true;
+}
+
+void BitmapRowBlitter::addRow(const int screenY, const uint8_t* outputRow, const uint8_t drawValues) {
+  if (xEnd == xBegin) {
+    return;
+  }
+  // Portrait keeps rows until one falls in another panel byte column
+  const bool sameGroup = isPortrait() ? pendingY >= 0 && pendingY / 8 == screenY / 8 : pendingY == screenY;
+  if (!sameGroup) {
+    flush();
+  }
+  pendingY = screenY;
+  uint8_t* mask = masks + (isPortrait() ? (screenY % 8) * maskStride : 0);
+  for (int bmpX = xBegin; bmpX < xEnd; bmpX++) {
+    const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+    if (drawValues >> val & 1) {
+      const int screenX = xMap[bmpX - xBegin];
+      mask[screenX / 8] |= 0x80 >> (screenX % 8);
+    }
+  }
+}
+
+void BitmapRowBlitter::flush() {
+  if (pendingY < 0) {
+    return;
+  }
+  if (isPortrait()) {
+    blitGroup(pendingY / 8);
+    for (int row = 0; row < 8; row++) {
+      memset(masks + row * maskStride + firstByte, 0, lastByte - firstByte + 1);
+    }
+  } else {
+    blitRow(pendingY);
+    memset(masks + firstByte, 0, lastByte - firstByte + 1);
+  }
+  pendingY = -1;
+}
+
+void BitmapRowBlitter::applyByte(uint8_t& target, const uint8_t bits) const {
+  if (state) {
+    target &= ~bits;  // Clear bits
+  } else {
+    target |= bits;  // Set bits
+  }
+}
+
+// Same pixels as drawPixel(x, y, state) for every set mask bit of logical row y
+void BitmapRowBlitter::blitRow(const int y) const {
+  if (axis == RowAxis::PANEL_ROW) {
+    uint8_t* row = frameBuffer + y * panelWidthBytes;
+    for (int i = firstByte; i <= lastByte; i++) {
+      if (masks[i]) applyByte(row[i], masks[i]);
+    }
+    return;
+  }
+  // Both axes mirrored: logical byte i is panel byte (widthBytes - 1 - i) with its bits reversed
+  uint8_t* row = frameBuffer + (panelHeight - 1 - y) * panelWidthBytes;
+  for (int i = firstByte; i <= lastByte; i++) {
+    if (masks[i]) applyByte(row[panelWidthBytes - 1 - i], reverseBits(masks[i]));
+  }
+}
+
+// Same pixels as drawPixel(x, y, state) for every set mask bit of logical rows group * 8 to group * 8 + 7. Those rows
+// are the eight bits of panel byte column `group` (mirrored: the last column minus group), so after transposing, the
+// bits of logical x for all eight rows are one panel byte.
+void BitmapRowBlitter::blitGroup(const int group) const {
+  const bool mirrored = axis == RowAxis::PANEL_COLUMN_MIRRORED;
+  uint8_t* column = frameBuffer + (mirrored ? panelWidthBytes - 1 - group : group);
+  for (int i = firstByte; i <= lastByte; i++) {
+    uint64_t block = 0;
+    for (int row = 0; row < 8; row++) {
+      block = block << 8 | masks[row * maskStride + i];
+    }
+    if (!block) continue;
+    block = transpose8(block);
+    for (int b = 0; b < 8; b++) {
+      // Byte b from the top holds logical x = i * 8 + b, row 0 in its MSB
+      const auto bits = static_cast<uint8_t>(block >> (56 - 8 * b));
+      if (!bits) continue;
+      const int x = i * 8 + b;
+      const int phyY = mirrored ? x : panelHeight - 1 - x;
+      applyByte(column[phyY * panelWidthBytes], mirrored ? reverseBits(bits) : bits);
+    }
+  }
+}
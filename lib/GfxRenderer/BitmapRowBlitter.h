@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Scaled-row engine for BMP drawing. The bitmap x -> screen x mapping is computed once per image, every decoded row is
+ * turned into a packed mask of the pixels the current render mode draws (one bit per logical x, MSB first), and the
+ * masks are written to the framebuffer a byte at a time. Source rows that scale onto the same screen row are merged
+ * into one mask, which gives the same result as drawing them pixel by pixel since a pass only ever sets one state.
+ *
+ * In landscape a logical row is a panel row and each mask byte is one framebuffer byte. In portrait a logical row is a
+ * panel column, so eight consecutive rows are buffered and their masks transposed 8x8 at a time: each panel byte then
+ * takes the bits of all eight rows in one write.
+ */
+class BitmapRowBlitter {
+ public:
+  // Where logical (x, y) lands on a panel of W x H pixels, for each of GfxRenderer's orientations
+  enum class RowAxis : uint8_t {
+    PANEL_ROW,              // LandscapeCounterClockwise: (x, y)
+    PANEL_ROW_MIRRORED,     // LandscapeClockwise: (W - 1 - x, H - 1 - y)
+    PANEL_COLUMN,           // Portrait: (y, H - 1 - x)
+    PANEL_COLUMN_MIRRORED,  // PortraitInverted: (W - 1 - y, x)
+  };
+
+  // `frameBuffer` is the 1-bit panel buffer, `panelWidthBytes` wide and `panelHeight` rows. `state` is the one
+  // drawPixel would be called with: true clears bits (black), false sets them.
+  BitmapRowBlitter(uint8_t* frameBuffer, int panelWidthBytes, int panelHeight, RowAxis axis, bool state);
+  ~BitmapRowBlitter();
+  BitmapRowBlitter(const BitmapRowBlitter&) = delete;
+  BitmapRowBlitter& operator=(const BitmapRowBlitter&) = delete;
+
+  // Maps bitmap columns [cropPixX, bmpWidth - cropPixX) to screen x = x + floor((bmpX - cropPixX) * scale), dropping
+  // the columns that fall outside [0, screenWidth). Returns false if the tables cannot be allocated.
+  bool begin(int bmpWidth, int cropPixX, bool isScaled, float scale, int x, int screenWidth);
+
+  // Adds the pixels of a readNextRow() output row whose 2-bit value has its bit set in drawValues
+  void addRow(int screenY, const uint8_t* outputRow, uint8_t drawValues);
+
+  // Writes the pending rows to the framebuffer
+  void flush();
+
+ private:
+  uint8_t* frameBuffer;
+  int panelWidthBytes;
+  int panelHeight;
+  RowAxis axis;
+  bool state;
+  int16_t* xMap = nullptr;  // screen x of bitmap columns [xBegin, xEnd)
+  int xBegin = 0;
+  int xEnd = 0;
+  int firstByte = 0;  // mask bytes the mapped columns can touch
+  int lastByte = 0;
+  // One row mask, or in portrait the masks of the eight rows of one panel byte column, maskStride bytes apart
+  uint8_t* masks = nullptr;
+  int maskStride = 0;
+  int pendingY = -1;  // screen row of the pending mask; in portrait any row of the pending group
+
+  bool isPortrait() const { return axis == RowAxis::PANEL_COLUMN || axis == RowAxis::PANEL_COLUMN_MIRRORED; }
+  void applyByte(uint8_t& target, uint8_t bits) const;
+  void blitRow(int y) const;
+  void blitGroup(int group) const;
+};
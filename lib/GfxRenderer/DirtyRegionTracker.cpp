@@ -0,0 +1,73 @@
+#include "DirtyRegionTracker.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr int TILE_BYTES = DirtyRegionTracker::TILE_WIDTH / 8;
+
+// 64-bit FNV-1a over the tile's bytes, row by row
+uint64_t tileSignature(const uint8_t* tile, const int stride, const int rowCount) {
+  uint64_t hash = 14695981039346656037ull;
+  for (int row = 0; row < rowCount; row++) {
+    const uint8_t* p = tile + row * stride;
+    for (int i = 0; i < TILE_BYTES; i++) {
+      hash = (hash ^ p[i]) * 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
+DirtyRegionTracker::DirtyRegionTracker(const int widthBytes, const int height)
+    : widthBytes(widthBytes),
+      height(height),
+      columns(widthBytes / TILE_BYTES),
+      rows((height + TILE_HEIGHT - 1) / TILE_HEIGHT),
+      signatures(static_cast<size_t>(columns) * rows) {}
+
+DirtyRegionTracker::Region DirtyRegionTracker::update(const uint8_t* frame) {
+  int minColumn = columns;
+  int maxColumn = -1;
+  int minRow = rows;
+  int maxRow = -1;
+  for (int row = 0; row < rows; row++) {
+    const int y = row * TILE_HEIGHT;
+    const int rowCount = std::min(TILE_HEIGHT, height - y);
+    for (int column = 0; column < columns; column++) {
+      const uint64_t signature = tileSignature(frame + y * widthBytes + column * TILE_BYTES, widthBytes, rowCount);
+      uint64_t& previous = signatures[row * columns + column];
+      if (valid && signature == previous) {
+        continue;
+      }
+      previous = signature;
+      minColumn = std::min(minColumn, column);
+      maxColumn = std::max(maxColumn, column);
+      minRow = std::min(minRow, row);
+      maxRow = std::max(maxRow, row);
+    }
+  }
+  valid = true;
+
+  Region region;
+  if (maxColumn < 0) {
+    return region;
+  }
+  region.x = minColumn * TILE_WIDTH;
+  region.width = (maxColumn - minColumn + 1) * TILE_WIDTH;
+  region.y = minRow * TILE_HEIGHT;
+  region.height = std::min(height, (maxRow + 1) * TILE_HEIGHT) - region.y;
+  return region;
+}
+
+DirtyRegionTracker::Push DirtyRegionTracker::planPush(const uint8_t* frame, const bool fastRefresh, Region& changed) {
+  changed = update(frame);
+  if (!fastRefresh) {
+    return Push::FULL_FRAME;
+  }
+  if (changed.isEmpty()) {
+    return Push::NOTHING;
+  }
+  return changed.byteCount() <= maxWindowBytes() ? Push::WINDOW : Push::FULL_FRAME;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Finds the part of a 1-bit frame buffer that changed since the last frame pushed to the panel.
+ *
+ * Screens clear and redraw the whole buffer for every frame, so changes can't be told from the draw calls. Instead
+ * the buffer is cut into TILE_WIDTH x TILE_HEIGHT tiles and a signature of every tile is kept from the last push
+ * (6KB for the 800x480 panel rather than a 48KB copy of the frame). Signatures are 64-bit: a 32-bit one has
+ * collisions within reach of ordinary screen content, and a tile whose change it misses stays wrong on the panel.
+ * Tiles are whole bytes wide, so the changed region can be sent to the panel as is.
+ */
+class DirtyRegionTracker {
+ public:
+  static constexpr int TILE_WIDTH = 32;
+  static constexpr int TILE_HEIGHT = 16;
+
+  // In panel pixels; x and width are multiples of 8
+  struct Region {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool isEmpty() const { return width == 0 || height == 0; }
+    int byteCount() const { return width / 8 * height; }
+  };
+
+  // How a frame goes to the panel
+  enum class Push { NOTHING, WINDOW, FULL_FRAME };
+
+  // `widthBytes` is the frame buffer stride, a multiple of TILE_WIDTH / 8
+  DirtyRegionTracker(int widthBytes, int height);
+
+  // Region covering every tile of `frame` that differs from the previous call, the whole frame after invalidate().
+  // Remembers `frame` as what the panel shows.
+  Region update(const uint8_t* frame);
+
+  // update() plus the push decision of GfxRenderer::displayBuffer. A fast refresh skips an unchanged frame and sends
+  // only the changed region while that is at most maxWindowBytes(); anything else sends the whole frame.
+  Push planPush(const uint8_t* frame, bool fastRefresh, Region& changed);
+
+  // Past half the frame a windowed refresh saves little over sending the whole buffer
+  int maxWindowBytes() const { return widthBytes * height / 2; }
+
+  // The panel no longer shows the last frame passed to update(), e.g. after grayscale planes were written to it
+  void invalidate() { valid = false; }
+
+ private:
+  int widthBytes;
+  int height;
+  int columns;
+  int rows;
+  bool valid = false;
+  std::vector<uint64_t> signatures;
+};
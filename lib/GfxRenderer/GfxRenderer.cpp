@@ -3,6 +3,10 @@
 #include <Logging.h>
 #include <Utf8.h>
 
+#include <cstring>
+
+#include "BitmapRowBlitter.h"
+
 const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const {
   if (fontData->groups != nullptr) {
     if (!fontDecompressor) {
@@ -23,7 +27,47 @@ void GfxRenderer::begin() {
   }
 }
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  if (findFont(fontId)) {
+    return;  // first registration wins
+  }
+  if (fontCount >= MAX_FONTS) {
+    LOG_ERR("GFX", "!! Font table full, dropping font %d", fontId);
+    return;
+  }
+  fontIds[fontCount] = fontId;
+  fontFamilies[fontCount] = font;
+  fontCount++;
+}
+
+void GfxRenderer::removeFont(const int fontId) {
+  for (uint8_t i = 0; i < fontCount; i++) {
+    if (fontIds[i] == fontId) {
+      for (uint8_t j = i + 1; j < fontCount; j++) {
+        fontIds[j - 1] = fontIds[j];
+        fontFamilies[j - 1] = fontFamilies[j];
+      }
+      fontCount--;
+      lastFontIndex = 0;
+      return;
+    }
+  }
+}
+
+const EpdFontFamily* GfxRenderer::findFont(const int fontId) const {
+  // Text calls for the same font come in long runs, so check the last hit before scanning
+  const uint8_t last = lastFontIndex;
+  if (last < fontCount && fontIds[last] == fontId) {
+    return &fontFamilies[last];
+  }
+  for (uint8_t i = 0; i < fontCount; i++) {
+    if (fontIds[i] == fontId) {
+      lastFontIndex = i;
+      return &fontFamilies[i];
+    }
+  }
+  return nullptr;
+}
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
@@ -181,14 +225,14 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
   int w = 0, h = 0;
-  fontIt->second.getTextDimensions(text, &w, &h, style);
+  family->getTextDimensions(text, &w, &h, style);
   return w;
 }
 
@@ -211,12 +255,12 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto& font = fontIt->second;
+  const auto& font = *family;
   constexpr int MIN_COMBINING_GAP_PX = 1;
 
   uint32_t cp;
@@ -567,6 +611,24 @@ void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, con
   display.drawImageTransparent(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
+namespace {
+
+BitmapRowBlitter::RowAxis rowAxis(const GfxRenderer::Orientation orientation) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      return BitmapRowBlitter::RowAxis::PANEL_COLUMN;
+    case GfxRenderer::PortraitInverted:
+      return BitmapRowBlitter::RowAxis::PANEL_COLUMN_MIRRORED;
+    case GfxRenderer::LandscapeClockwise:
+      return BitmapRowBlitter::RowAxis::PANEL_ROW_MIRRORED;
+    case GfxRenderer::LandscapeCounterClockwise:
+      break;
+  }
+  return BitmapRowBlitter::RowAxis::PANEL_ROW;
+}
+
+}  // namespace
+
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
                              const float cropX, const float cropY) const {
   // For 1-bit bitmaps, use optimized 1-bit rendering path (no crop support for 1-bit)
@@ -592,13 +654,29 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   }
   LOG_DBG("GFX", "Scaling by %f - %s", scale, isScaled ? "scaled" : "not scaled");
 
+  // 2-bit values drawn in each pass: BW draws everything but white, MSB the two grays, LSB only dark gray
+  uint8_t drawValues;
+  switch (renderMode) {
+    case GRAYSCALE_MSB:
+      drawValues = 0b0110;
+      break;
+    case GRAYSCALE_LSB:
+      drawValues = 0b0010;
+      break;
+    default:
+      drawValues = 0b0111;
+      break;
+  }
+  BitmapRowBlitter blitter(frameBuffer, HalDisplay::DISPLAY_WIDTH_BYTES, HalDisplay::DISPLAY_HEIGHT,
+                           rowAxis(orientation), renderMode == BW);
+
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
 
-  if (!outputRow || !rowBytes) {
+  if (!outputRow || !rowBytes || !blitter.begin(bitmap.getWidth(), cropPixX, isScaled, scale, x, getScreenWidth())) {
     LOG_ERR("GFX", "!! Failed to allocate BMP row buffers");
     free(outputRow);
     free(rowBytes);
@@ -619,6 +697,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
       LOG_ERR("GFX", "Failed to read row %d from bitmap", bmpY);
+      blitter.flush();
       free(outputRow);
       free(rowBytes);
       return;
@@ -633,31 +712,10 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       continue;
     }
 
-    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
-      }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
-
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
-      }
-    }
+    blitter.addRow(screenY, outputRow, drawValues);
   }
 
+  blitter.flush();
   free(outputRow);
   free(rowBytes);
 }
@@ -675,12 +733,18 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     isScaled = true;
   }
 
+  // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3). Black pixels are drawn in every render mode,
+  // white pixels are not drawn (leave background)
+  constexpr uint8_t drawValues = 0b0111;
+  BitmapRowBlitter blitter(frameBuffer, HalDisplay::DISPLAY_WIDTH_BYTES, HalDisplay::DISPLAY_HEIGHT,
+                           rowAxis(orientation), true);
+
   // For 1-bit BMP, output is still 2-bit packed (for consistency with readNextRow)
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
 
-  if (!outputRow || !rowBytes) {
+  if (!outputRow || !rowBytes || !blitter.begin(bitmap.getWidth(), 0, isScaled, scale, x, getScreenWidth())) {
     LOG_ERR("GFX", "!! Failed to allocate 1-bit BMP row buffers");
     free(outputRow);
     free(rowBytes);
@@ -691,6 +755,7 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     // Read rows sequentially using readNextRow
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
       LOG_ERR("GFX", "Failed to read row %d from 1-bit bitmap", bmpY);
+      blitter.flush();
       free(outputRow);
       free(rowBytes);
       return;
@@ -706,27 +771,10 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
       continue;
     }
 
-    for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
-
-      // Get 2-bit value (result of readNextRow quantization)
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
-      // val < 3 means black pixel (draw it)
-      if (val < 3) {
-        drawPixel(screenX, screenY, true);
-      }
-      // White pixels (val == 3) are not drawn (leave background)
-    }
+    blitter.addRow(screenY, outputRow, drawValues);
   }
 
+  blitter.flush();
   free(outputRow);
   free(rowBytes);
 }
@@ -816,7 +864,20 @@ void GfxRenderer::invertScreen() const {
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
-  display.displayBuffer(refreshMode, fadingFix);
+  DirtyRegionTracker::Region changed;
+  switch (dirtyRegion.planPush(frameBuffer, refreshMode == HalDisplay::FAST_REFRESH, changed)) {
+    case DirtyRegionTracker::Push::NOTHING:
+      LOG_DBG("GFX", "Frame unchanged, nothing to send");
+      return;
+    case DirtyRegionTracker::Push::WINDOW:
+      LOG_DBG("GFX", "Sending %dx%d band at %d,%d (%d bytes)", changed.width, changed.height, changed.x, changed.y,
+              changed.byteCount());
+      display.displayWindow(changed.x, changed.y, changed.width, changed.height, fadingFix);
+      return;
+    case DirtyRegionTracker::Push::FULL_FRAME:
+      display.displayBuffer(refreshMode, fadingFix);
+      return;
+  }
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -933,36 +994,36 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  const EpdGlyph* spaceGlyph = fontIt->second.getGlyph(' ', style);
+  const EpdGlyph* spaceGlyph = family->getGlyph(' ', style);
   return spaceGlyph ? fp4::toPixel(spaceGlyph->advanceX) : 0;  // snap 12.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getSpaceKernAdjust(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                                     const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const auto& font = fontIt->second;
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) return 0;
+  const auto& font = *family;
   const int kernFP = font.getKerning(leftCp, ' ', style) + font.getKerning(' ', rightCp, style);  // 4.4 fixed-point
   return fp4::toPixel(kernFP);  // snap 4.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getKerning(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                             const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const int kernFP = fontIt->second.getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) return 0;
+  const int kernFP = family->getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
   return fp4::toPixel(kernFP);                                           // snap 4.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
@@ -970,7 +1031,7 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
   uint32_t cp;
   uint32_t prevCp = 0;
   int32_t widthFP = 0;  // 12.4 fixed-point accumulator
-  const auto& font = fontIt->second;
+  const auto& font = *family;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     if (utf8IsCombiningMark(cp)) {
       continue;
@@ -987,32 +1048,32 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->advanceY;
+  return family->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -1022,13 +1083,13 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
 
-  const auto& font = fontIt->second;
+  const auto& font = *family;
 
   int32_t yPosFP = fp4::fromPixel(y);  // 12.4 fixed-point accumulator
   int lastBaseY = y;
@@ -1081,11 +1142,22 @@ size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
 // unused
 // void GfxRenderer::grayscaleRevert() const { display.grayscaleRevert(); }
 
-void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuffers(frameBuffer); }
+// Grayscale planes overwrite the panel's copy of the last frame, so the next push has to send the whole frame again
+
+void GfxRenderer::copyGrayscaleLsbBuffers() const {
+  dirtyRegion.invalidate();
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
+void GfxRenderer::copyGrayscaleMsbBuffers() const {
+  dirtyRegion.invalidate();
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  dirtyRegion.invalidate();
+  display.displayGrayBuffer(fadingFix);
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -1154,6 +1226,7 @@ void GfxRenderer::restoreBwBuffer() {
     memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
   }
 
+  dirtyRegion.invalidate();
   display.cleanupGrayscaleBuffers(frameBuffer);
 
   freeBwBufferChunks();
@@ -1166,6 +1239,7 @@ void GfxRenderer::restoreBwBuffer() {
  */
 void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   if (frameBuffer) {
+    dirtyRegion.invalidate();
     display.cleanupGrayscaleBuffers(frameBuffer);
   }
 }
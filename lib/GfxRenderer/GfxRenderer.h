@@ -4,11 +4,11 @@
 #include <FontDecompressor.h>
 #include <HalDisplay.h>
 
-#include <map>
 #include <string>
 #include <vector>
 
 #include "Bitmap.h"
+#include "DirtyRegionTracker.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -38,8 +38,17 @@ class GfxRenderer {
   bool fadingFix;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
-  std::map<int, EpdFontFamily> fontMap;
+  // What changed since the last frame pushed to the panel, so fast refreshes only send that band
+  mutable DirtyRegionTracker dirtyRegion{HalDisplay::DISPLAY_WIDTH_BYTES, HalDisplay::DISPLAY_HEIGHT};
+  // Flat fontId -> family table. Font IDs are sparse hashes, but only a handful of fonts are registered, so a
+  // linear scan with a last-hit shortcut beats a std::map lookup on every text call.
+  static constexpr uint8_t MAX_FONTS = 24;
+  int fontIds[MAX_FONTS] = {};
+  EpdFontFamily fontFamilies[MAX_FONTS];
+  uint8_t fontCount = 0;
+  mutable uint8_t lastFontIndex = 0;
   FontDecompressor* fontDecompressor = nullptr;
+  const EpdFontFamily* findFont(int fontId) const;
   void freeBwBufferChunks();
   template <Color color>
   void drawPixelDither(int x, int y) const;
@@ -59,6 +68,7 @@ class GfxRenderer {
   // Setup
   void begin();  // must be called right after display.begin()
   void insertFont(int fontId, EpdFontFamily font);
+  void removeFont(int fontId);
   void setFontDecompressor(FontDecompressor* d) { fontDecompressor = d; }
   void clearFontCache() {
     if (fontDecompressor) fontDecompressor->clearCache();
@@ -74,9 +84,9 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // Fast refreshes send only the band that changed since the last push, or nothing if the frame is unchanged. Other
+  // modes always send the whole frame.
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -0,0 +1,293 @@
+#include "ScaledBmpWriter.h"
+
+#include <Logging.h>
+#include <Print.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "BitmapHelpers.h"
+
+// ============================================================================
+// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
+// ============================================================================
+constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
+// Dithering method selection (only one should be true, or all false for simple quantization):
+constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
+constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
+// ============================================================================
+
+namespace {
+
+inline void write16(Print& out, const uint16_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+}
+
+inline void write32(Print& out, const uint32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+inline void write32Signed(Print& out, const int32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+// Shared BMP file + DIB header (top-down, BI_RGB), followed by `colors` palette entries written by the caller
+void writeBmpHeader(Print& bmpOut, const int width, const int height, const uint16_t bitsPerPixel, const int bytesPerRow,
+                    const uint32_t colors) {
+  const uint32_t imageSize = bytesPerRow * height;
+  const uint32_t dataOffset = 14 + 40 + colors * 4;
+
+  // BMP File Header (14 bytes)
+  bmpOut.write('B');
+  bmpOut.write('M');
+  write32(bmpOut, dataOffset + imageSize);  // File size
+  write32(bmpOut, 0);                       // Reserved
+  write32(bmpOut, dataOffset);              // Offset to pixel data
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  write32(bmpOut, 40);
+  write32Signed(bmpOut, width);
+  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
+  write16(bmpOut, 1);              // Color planes
+  write16(bmpOut, bitsPerPixel);
+  write32(bmpOut, 0);  // BI_RGB (no compression)
+  write32(bmpOut, imageSize);
+  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
+  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
+  write32(bmpOut, colors);
+  write32(bmpOut, colors);
+}
+
+void writePalette(Print& bmpOut, const uint8_t* levels, const int count) {
+  // Format: Blue, Green, Red, Reserved (BGRA)
+  for (int i = 0; i < count; i++) {
+    bmpOut.write(levels[i]);
+    bmpOut.write(levels[i]);
+    bmpOut.write(levels[i]);
+    bmpOut.write(static_cast<uint8_t>(0));
+  }
+}
+
+}  // namespace
+
+ScaledBmpWriter::~ScaledBmpWriter() { release(); }
+
+void ScaledBmpWriter::release() {
+  free(rowBuffer);
+  free(grayOut);
+  delete[] rowAccum;
+  delete[] rowCount;
+  delete atkinsonDitherer;
+  delete fsDitherer;
+  delete atkinson1BitDitherer;
+  rowBuffer = nullptr;
+  grayOut = nullptr;
+  rowAccum = nullptr;
+  rowCount = nullptr;
+  atkinsonDitherer = nullptr;
+  fsDitherer = nullptr;
+  atkinson1BitDitherer = nullptr;
+}
+
+void ScaledBmpWriter::computeOutputSize(const BmpOutputSpec& spec, const int imageWidth, const int imageHeight,
+                                        int& outWidth, int& outHeight) {
+  outWidth = imageWidth;
+  outHeight = imageHeight;
+  if (spec.targetWidth <= 0 || spec.targetHeight <= 0 ||
+      (imageWidth == spec.targetWidth && imageHeight == spec.targetHeight)) {
+    return;
+  }
+
+  // Calculate scale to fit/fill target dimensions while maintaining aspect ratio
+  const float scaleToFitWidth = static_cast<float>(spec.targetWidth) / imageWidth;
+  const float scaleToFitHeight = static_cast<float>(spec.targetHeight) / imageHeight;
+  float scale;
+  if (spec.crop) {  // if we will crop, scale to the smaller dimension
+    scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+  } else {  // else, scale to the larger dimension to fit
+    scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+  }
+
+  outWidth = static_cast<int>(imageWidth * scale);
+  outHeight = static_cast<int>(imageHeight * scale);
+  if (outWidth < 1) outWidth = 1;
+  if (outHeight < 1) outHeight = 1;
+}
+
+bool ScaledBmpWriter::begin(const BmpOutputSpec& spec, const int imageWidth, const int imageHeight,
+                            const int srcWidth, const int srcHeight) {
+  release();
+  out = spec.out;
+  oneBit = spec.oneBit;
+  this->srcWidth = srcWidth;
+  srcY = 0;
+  currentOutY = 0;
+
+  computeOutputSize(spec, imageWidth, imageHeight, outWidth, outHeight);
+  needsScaling = outWidth != srcWidth || outHeight != srcHeight;
+  if (needsScaling) {
+    scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+    scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
+    LOG_DBG("BMP", "Scaling %dx%d -> %dx%d (target %dx%d)", srcWidth, srcHeight, outWidth, outHeight,
+            spec.targetWidth, spec.targetHeight);
+  } else {
+    scaleX_fp = 65536;
+    scaleY_fp = 65536;
+  }
+
+  // Write BMP header with output dimensions
+  if (USE_8BIT_OUTPUT && !oneBit) {
+    bytesPerRow = (outWidth + 3) / 4 * 4;
+    writeBmpHeader(*out, outWidth, outHeight, 8, bytesPerRow, 256);
+    for (int i = 0; i < 256; i++) {
+      const uint8_t level = static_cast<uint8_t>(i);
+      writePalette(*out, &level, 1);
+    }
+  } else if (oneBit) {
+    // Note: In 1-bit BMP, palette index 0 = black, 1 = white
+    static constexpr uint8_t levels[2] = {0x00, 0xFF};
+    bytesPerRow = (outWidth + 31) / 32 * 4;
+    writeBmpHeader(*out, outWidth, outHeight, 1, bytesPerRow, 2);
+    writePalette(*out, levels, 2);
+  } else {
+    static constexpr uint8_t levels[4] = {0x00, 0x55, 0xAA, 0xFF};
+    bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
+    writeBmpHeader(*out, outWidth, outHeight, 2, bytesPerRow, 4);
+    writePalette(*out, levels, 4);
+  }
+
+  rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
+  if (!rowBuffer) {
+    LOG_ERR("BMP", "Failed to allocate row buffer");
+    return false;
+  }
+
+  if (needsScaling) {
+    grayOut = static_cast<uint8_t*>(malloc(outWidth));
+    rowAccum = new uint32_t[outWidth]();
+    rowCount = new uint16_t[outWidth]();
+    if (!grayOut) {
+      LOG_ERR("BMP", "Failed to allocate scaled row buffer");
+      release();
+      return false;
+    }
+  }
+
+  // Use OUTPUT dimensions for dithering (after prescaling)
+  if (oneBit) {
+    // For 1-bit output, use Atkinson dithering for better quality
+    atkinson1BitDitherer = new Atkinson1BitDitherer(outWidth);
+  } else if (!USE_8BIT_OUTPUT) {
+    if (USE_ATKINSON) {
+      atkinsonDitherer = new AtkinsonDitherer(outWidth);
+    } else if (USE_FLOYD_STEINBERG) {
+      fsDitherer = new FloydSteinbergDitherer(outWidth);
+    }
+  }
+  return true;
+}
+
+void ScaledBmpWriter::emitRow(const uint8_t* gray) {
+  memset(rowBuffer, 0, bytesPerRow);
+
+  if (USE_8BIT_OUTPUT && !oneBit) {
+    for (int x = 0; x < outWidth; x++) {
+      rowBuffer[x] = adjustPixel(gray[x]);
+    }
+  } else if (oneBit) {
+    // 1-bit output with Atkinson dithering for better quality
+    for (int x = 0; x < outWidth; x++) {
+      const uint8_t bit =
+          atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray[x], x) : quantize1bit(gray[x], x, currentOutY);
+      // Pack 1-bit value: MSB first, 8 pixels per byte
+      rowBuffer[x / 8] |= (bit << (7 - (x % 8)));
+    }
+    if (atkinson1BitDitherer) atkinson1BitDitherer->nextRow();
+  } else {
+    // 2-bit output
+    for (int x = 0; x < outWidth; x++) {
+      const uint8_t adjusted = adjustPixel(gray[x]);
+      uint8_t twoBit;
+      if (atkinsonDitherer) {
+        twoBit = atkinsonDitherer->processPixel(adjusted, x);
+      } else if (fsDitherer) {
+        twoBit = fsDitherer->processPixel(adjusted, x);
+      } else {
+        twoBit = quantize(adjusted, x, currentOutY);
+      }
+      rowBuffer[(x * 2) / 8] |= (twoBit << (6 - ((x * 2) % 8)));
+    }
+    if (atkinsonDitherer)
+      atkinsonDitherer->nextRow();
+    else if (fsDitherer)
+      fsDitherer->nextRow();
+  }
+
+  out->write(rowBuffer, bytesPerRow);
+  currentOutY++;
+}
+
+void ScaledBmpWriter::pushSourceRow(const uint8_t* grayRow) {
+  if (!rowBuffer || currentOutY >= outHeight) {
+    return;
+  }
+
+  if (!needsScaling) {
+    // No scaling - direct output (1:1 mapping)
+    emitRow(grayRow);
+    srcY++;
+    return;
+  }
+
+  // Fixed-point area averaging for exact fit scaling
+  // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
+  for (int outX = 0; outX < outWidth; outX++) {
+    const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
+    const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
+
+    int sum = 0;
+    int count = 0;
+    for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
+      sum += grayRow[srcX];
+      count++;
+    }
+
+    // Handle edge case: if no pixels in range, use nearest
+    if (count == 0 && srcXStart < srcWidth) {
+      sum = grayRow[srcXStart];
+      count = 1;
+    }
+
+    rowAccum[outX] += sum;
+    rowCount[outX] += count;
+  }
+
+  // Output all rows whose boundaries we've crossed (handles both up and downscaling)
+  // For upscaling, one source row may produce multiple output rows
+  const uint32_t srcY_fp = static_cast<uint32_t>(++srcY) << 16;
+  while (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
+    for (int x = 0; x < outWidth; x++) {
+      grayOut[x] = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
+    }
+    emitRow(grayOut);
+
+    // Update boundary for next output row
+    nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
+
+    // For upscaling: keep accumulator data while more output rows come from the same source row
+    if (srcY_fp >= nextOutY_srcStart) {
+      continue;
+    }
+    // Moving to next source row - reset accumulators
+    memset(rowAccum, 0, outWidth * sizeof(uint32_t));
+    memset(rowCount, 0, outWidth * sizeof(uint16_t));
+  }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+class Print;
+class AtkinsonDitherer;
+class FloydSteinbergDitherer;
+class Atkinson1BitDitherer;
+
+// One BMP output requested from an image decode. Several of these can be fed from a single decode pass, e.g. the
+// fit and cropped sleep covers plus every home screen thumbnail size.
+struct BmpOutputSpec {
+  Print* out;
+  int targetWidth;   // <= 0 keeps the source size
+  int targetHeight;  // <= 0 keeps the source size
+  bool oneBit;       // 1-bit (thumbnails) instead of 2-bit
+  bool crop;         // true: scale to fill the target (caller crops), false: scale to fit inside it
+};
+
+// Area-averaging downscaler + ditherer + BMP encoder for one output. Decoders push grayscale source rows top-down and
+// every writer attached to the decode emits its own scaled, dithered rows as soon as they are complete.
+class ScaledBmpWriter {
+ public:
+  ScaledBmpWriter() = default;
+  ~ScaledBmpWriter();
+  ScaledBmpWriter(const ScaledBmpWriter&) = delete;
+  ScaledBmpWriter& operator=(const ScaledBmpWriter&) = delete;
+
+  // Computes the output size for an imageWidth x imageHeight picture the same way begin() does.
+  static void computeOutputSize(const BmpOutputSpec& spec, int imageWidth, int imageHeight, int& outWidth,
+                                int& outHeight);
+
+  // Writes the BMP header and allocates the row state. imageWidth/imageHeight are the picture's real dimensions and
+  // decide the output size; srcWidth/srcHeight are the dimensions of the rows that will be pushed, which are smaller
+  // when the decoder already reduced the image (e.g. JPEG DC-only decoding).
+  bool begin(const BmpOutputSpec& spec, int imageWidth, int imageHeight, int srcWidth, int srcHeight);
+
+  // Consumes the next srcWidth grayscale pixels of the source image.
+  void pushSourceRow(const uint8_t* grayRow);
+
+  int getOutputWidth() const { return outWidth; }
+  int getOutputHeight() const { return outHeight; }
+
+ private:
+  Print* out = nullptr;
+  bool oneBit = false;
+  int srcWidth = 0;
+  int outWidth = 0;
+  int outHeight = 0;
+  int bytesPerRow = 0;
+  bool needsScaling = false;
+  uint32_t scaleX_fp = 65536;  // source pixels per output pixel, 16.16 fixed point
+  uint32_t scaleY_fp = 65536;
+  int srcY = 0;
+  int currentOutY = 0;
+  uint32_t nextOutY_srcStart = 0;
+
+  uint8_t* rowBuffer = nullptr;  // packed output row
+  uint8_t* grayOut = nullptr;    // averaged output row before dithering (scaling only)
+  uint32_t* rowAccum = nullptr;
+  uint16_t* rowCount = nullptr;
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+  Atkinson1BitDitherer* atkinson1BitDitherer = nullptr;
+
+  void emitRow(const uint8_t* gray);
+  void release();
+};
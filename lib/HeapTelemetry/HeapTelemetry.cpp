@@ -0,0 +1,298 @@
+#include "HeapTelemetry.h"
+
+#include <cstdio>
+
+#ifdef ENABLE_HEAP_TELEMETRY
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+
+struct AtomicTagStats {
+  std::atomic<uint32_t> allocations{0};
+  std::atomic<uint32_t> frees{0};
+  std::atomic<uint32_t> failedAllocations{0};
+  std::atomic<uint64_t> bytesRequested{0};
+  std::atomic<uint32_t> largestAllocation{0};
+  std::atomic<uint32_t> peakBytes{0};
+  std::atomic<uint32_t> minFreeHeap{0};
+  std::atomic<uint32_t> minLargestFreeBlock{0};
+  std::atomic<uint32_t> sizeClasses[HeapTelemetry::SIZE_CLASS_COUNT] = {};
+};
+
+AtomicTagStats tagStats[HeapTelemetry::TAG_COUNT];
+std::atomic<size_t> live{0};
+// Innermost open scope of each task; scopes link to the one they were opened in
+thread_local HeapTelemetry::Scope* currentScope = nullptr;
+
+void raiseTo(std::atomic<uint32_t>& value, const uint32_t candidate) {
+  uint32_t current = value.load(std::memory_order_relaxed);
+  while (candidate > current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+  }
+}
+
+#ifdef ARDUINO
+// 0 means not sampled yet, so it never wins
+void lowerTo(std::atomic<uint32_t>& value, const uint32_t candidate) {
+  uint32_t current = value.load(std::memory_order_relaxed);
+  while ((current == 0 || candidate < current) &&
+         !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+  }
+}
+#endif
+
+void sampleHeap(AtomicTagStats& stats, const bool largestBlock) {
+#ifdef ARDUINO
+  lowerTo(stats.minFreeHeap, heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  if (largestBlock) {
+    lowerTo(stats.minLargestFreeBlock, heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+  }
+#else
+  (void)stats;
+  (void)largestBlock;
+#endif
+}
+
+size_t sizeClass(const size_t size) {
+  size_t i = 0;
+  while (i < HeapTelemetry::SIZE_CLASS_COUNT - 1 && size > HeapTelemetry::SIZE_CLASS_LIMITS[i]) {
+    i++;
+  }
+  return i;
+}
+
+}  // namespace
+
+HeapTelemetry::Tag HeapTelemetry::currentTag() { return currentScope ? currentScope->tag : UNTAGGED; }
+
+HeapTelemetry::Scope::Scope(const Tag tag)
+    : tag(tag), parent(currentScope), baseline(live.load(std::memory_order_relaxed)), peak(0) {
+  currentScope = this;
+}
+
+HeapTelemetry::Scope::~Scope() {
+  currentScope = parent;
+  auto& stats = tagStats[tag];
+  raiseTo(stats.peakBytes, peak);
+  sampleHeap(stats, true);
+}
+
+void HeapTelemetry::recordAllocation(const size_t requested, const size_t usable) {
+  auto& stats = tagStats[currentTag()];
+  stats.allocations.fetch_add(1, std::memory_order_relaxed);
+  stats.bytesRequested.fetch_add(requested, std::memory_order_relaxed);
+  stats.sizeClasses[sizeClass(requested)].fetch_add(1, std::memory_order_relaxed);
+  raiseTo(stats.largestAllocation, requested);
+
+  // Every open scope on this task sees the growth, so an outer scope's peak includes its inner scopes
+  const size_t nowLive = live.fetch_add(usable, std::memory_order_relaxed) + usable;
+  for (Scope* scope = currentScope; scope; scope = scope->parent) {
+    if (nowLive > scope->baseline && nowLive - scope->baseline > scope->peak) {
+      scope->peak = nowLive - scope->baseline;
+    }
+  }
+  sampleHeap(stats, requested >= LARGE_ALLOCATION);
+}
+
+void HeapTelemetry::recordFailedAllocation(const size_t requested) {
+  auto& stats = tagStats[currentTag()];
+  stats.failedAllocations.fetch_add(1, std::memory_order_relaxed);
+  raiseTo(stats.largestAllocation, requested);
+  sampleHeap(stats, true);
+}
+
+void HeapTelemetry::recordFree(const size_t usable) {
+  tagStats[currentTag()].frees.fetch_add(1, std::memory_order_relaxed);
+  live.fetch_sub(usable, std::memory_order_relaxed);
+}
+
+HeapTelemetry::TagStats HeapTelemetry::stats(const Tag tag) {
+  const auto& source = tagStats[tag];
+  TagStats result;
+  result.allocations = source.allocations.load(std::memory_order_relaxed);
+  result.frees = source.frees.load(std::memory_order_relaxed);
+  result.failedAllocations = source.failedAllocations.load(std::memory_order_relaxed);
+  result.bytesRequested = source.bytesRequested.load(std::memory_order_relaxed);
+  result.largestAllocation = source.largestAllocation.load(std::memory_order_relaxed);
+  result.peakBytes = source.peakBytes.load(std::memory_order_relaxed);
+  result.minFreeHeap = source.minFreeHeap.load(std::memory_order_relaxed);
+  result.minLargestFreeBlock = source.minLargestFreeBlock.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+    result.sizeClasses[i] = source.sizeClasses[i].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+size_t HeapTelemetry::liveBytes() { return live.load(std::memory_order_relaxed); }
+
+// Live bytes are kept: the blocks they count are still allocated
+void HeapTelemetry::reset() {
+  for (auto& stats : tagStats) {
+    stats.allocations = 0;
+    stats.frees = 0;
+    stats.failedAllocations = 0;
+    stats.bytesRequested = 0;
+    stats.largestAllocation = 0;
+    stats.peakBytes = 0;
+    stats.minFreeHeap = 0;
+    stats.minLargestFreeBlock = 0;
+    for (auto& count : stats.sizeClasses) {
+      count = 0;
+    }
+  }
+}
+
+#ifdef ARDUINO
+// Linked with -Wl,--wrap=malloc and friends, so every heap user in the image, including the SDK and the WiFi stack,
+// goes through these. heap_caps_get_allocated_size() gives the block size back on free without a header.
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  if (ptr) {
+    HeapTelemetry::recordAllocation(size, heap_caps_get_allocated_size(ptr));
+  } else {
+    HeapTelemetry::recordFailedAllocation(size);
+  }
+  return ptr;
+}
+
+void* __wrap_calloc(const size_t count, const size_t size) {
+  void* ptr = __real_calloc(count, size);
+  if (ptr) {
+    HeapTelemetry::recordAllocation(count * size, heap_caps_get_allocated_size(ptr));
+  } else {
+    HeapTelemetry::recordFailedAllocation(count * size);
+  }
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, const size_t size) {
+  const size_t oldSize = ptr ? heap_caps_get_allocated_size(ptr) : 0;
+  void* resized = __real_realloc(ptr, size);
+  if (resized) {
+    if (ptr) {
+      HeapTelemetry::recordFree(oldSize);
+    }
+    HeapTelemetry::recordAllocation(size, heap_caps_get_allocated_size(resized));
+  } else if (size > 0) {
+    HeapTelemetry::recordFailedAllocation(size);
+  } else if (ptr) {
+    HeapTelemetry::recordFree(oldSize);  // realloc(ptr, 0) freed it
+  }
+  return resized;
+}
+
+void __wrap_free(void* ptr) {
+  if (ptr) {
+    HeapTelemetry::recordFree(heap_caps_get_allocated_size(ptr));
+  }
+  __real_free(ptr);
+}
+}
+#else
+// Host builds replace the global allocation functions instead, which covers the containers and strings the tested
+// code allocates through
+namespace {
+
+size_t usableSize(void* ptr) {
+#ifdef __APPLE__
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+void* hookedNew(const size_t size) {
+  void* ptr = malloc(size ? size : 1);
+  if (ptr) {
+    HeapTelemetry::recordAllocation(size, usableSize(ptr));
+  } else {
+    HeapTelemetry::recordFailedAllocation(size);
+  }
+  return ptr;
+}
+
+void hookedDelete(void* ptr) {
+  if (ptr) {
+    HeapTelemetry::recordFree(usableSize(ptr));
+    free(ptr);
+  }
+}
+
+}  // namespace
+
+void* operator new(const size_t size) {
+  void* ptr = hookedNew(size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void* operator new[](const size_t size) { return operator new(size); }
+void* operator new(const size_t size, const std::nothrow_t&) noexcept { return hookedNew(size); }
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept { return hookedNew(size); }
+void operator delete(void* ptr) noexcept { hookedDelete(ptr); }
+void operator delete[](void* ptr) noexcept { hookedDelete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { hookedDelete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { hookedDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { hookedDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { hookedDelete(ptr); }
+#endif
+#endif
+
+const char* HeapTelemetry::tagName(const Tag tag) {
+  switch (tag) {
+    case UNTAGGED:
+      return "untagged";
+    case INDEXING:
+      return "indexing";
+    case RENDER:
+      return "render";
+    case IMAGE_DECODE:
+      return "image";
+    case NETWORK:
+      return "network";
+    default:
+      return "?";
+  }
+}
+
+size_t HeapTelemetry::formatReport(char* out, const size_t len) {
+  size_t used = 0;
+  const auto append = [&](const int written) {
+    if (written > 0) {
+      used += written;
+    }
+  };
+  const auto rest = [&]() { return used < len ? out + used : nullptr; };
+  const auto restLen = [&]() { return used < len ? len - used : 0; };
+
+  append(snprintf(rest(), restLen(), "%-9s %8s %8s %6s %10s %8s %8s %8s %8s  sizes <=32/256/1K/8K/more\n", "tag",
+                  "allocs", "frees", "failed", "requested", "largest", "peak", "minFree", "minBlock"));
+  for (int tag = 0; tag < TAG_COUNT; tag++) {
+    const auto s = stats(static_cast<Tag>(tag));
+    append(snprintf(rest(), restLen(), "%-9s %8lu %8lu %6lu %10llu %8lu %8lu %8lu %8lu  %lu/%lu/%lu/%lu/%lu\n",
+                    tagName(static_cast<Tag>(tag)), static_cast<unsigned long>(s.allocations),
+                    static_cast<unsigned long>(s.frees), static_cast<unsigned long>(s.failedAllocations),
+                    static_cast<unsigned long long>(s.bytesRequested), static_cast<unsigned long>(s.largestAllocation),
+                    static_cast<unsigned long>(s.peakBytes), static_cast<unsigned long>(s.minFreeHeap),
+                    static_cast<unsigned long>(s.minLargestFreeBlock), static_cast<unsigned long>(s.sizeClasses[0]),
+                    static_cast<unsigned long>(s.sizeClasses[1]), static_cast<unsigned long>(s.sizeClasses[2]),
+                    static_cast<unsigned long>(s.sizeClasses[3]), static_cast<unsigned long>(s.sizeClasses[4])));
+  }
+  return used;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Opt-in heap telemetry per subsystem. Built with ENABLE_HEAP_TELEMETRY (see the heap_telemetry environment in
+ * platformio.ini), every allocation is counted against the tag of the innermost Scope open on the allocating task, or
+ * UNTAGGED outside any scope. Without the flag, Scope is empty and nothing is hooked.
+ *
+ * Per tag it records allocation and free counts, bytes requested, the largest request, a size histogram, and the
+ * peak heap growth over any one scope of that tag: live bytes, counting every task's allocations and frees, minus the
+ * live bytes when the scope opened, measured at each allocation the scope's own task makes. On the device it also
+ * samples the free heap and the largest free block while a tag is active, so fragmentation shows up as a large free
+ * heap with a small largest block.
+ *
+ * Allocations are hooked through the linker's malloc/free wrapping on the device and through the global operator
+ * new/delete on the host, where the free heap isn't modelled and those samples stay 0.
+ */
+class HeapTelemetry {
+ public:
+  enum Tag : uint8_t { UNTAGGED, INDEXING, RENDER, IMAGE_DECODE, NETWORK, TAG_COUNT };
+
+  // Upper bounds of the allocation size classes; the last class takes everything larger
+  static constexpr size_t SIZE_CLASS_LIMITS[] = {32, 256, 1024, 8192};
+  static constexpr size_t SIZE_CLASS_COUNT = sizeof(SIZE_CLASS_LIMITS) / sizeof(SIZE_CLASS_LIMITS[0]) + 1;
+  // Requests at least this large also sample the largest free block, which walks the heap
+  static constexpr size_t LARGE_ALLOCATION = 1024;
+
+  struct TagStats {
+    uint32_t allocations = 0;
+    uint32_t frees = 0;
+    uint32_t failedAllocations = 0;
+    uint64_t bytesRequested = 0;
+    uint32_t largestAllocation = 0;
+    uint32_t peakBytes = 0;
+    uint32_t minFreeHeap = 0;          // 0 = not sampled
+    uint32_t minLargestFreeBlock = 0;  // 0 = not sampled
+    uint32_t sizeClasses[SIZE_CLASS_COUNT] = {};
+  };
+
+  static const char* tagName(Tag tag);
+  // Writes a one-line-per-tag text report, returns the length it needed like snprintf
+  static size_t formatReport(char* out, size_t len);
+
+#ifdef ENABLE_HEAP_TELEMETRY
+  static constexpr bool ENABLED = true;
+
+  class Scope {
+   public:
+    explicit Scope(Tag tag);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    friend class HeapTelemetry;
+    Tag tag;
+    Scope* parent;
+    size_t baseline;
+    size_t peak;
+  };
+
+  static TagStats stats(Tag tag);
+  // Bytes currently allocated through the hooks
+  static size_t liveBytes();
+  static void reset();
+
+  // Hook entry points, called with the usable size of the block
+  static void recordAllocation(size_t requested, size_t usable);
+  static void recordFailedAllocation(size_t requested);
+  static void recordFree(size_t usable);
+
+ private:
+  static Tag currentTag();
+#else
+  static constexpr bool ENABLED = false;
+
+  class Scope {
+   public:
+    explicit Scope(Tag) {}
+  };
+
+  static TagStats stats(Tag) { return {}; }
+  static size_t liveBytes() { return 0; }
+  static void reset() {}
+#endif
+};
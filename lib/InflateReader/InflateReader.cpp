@@ -3,34 +3,32 @@
 #include <cstring>
 #include <type_traits>
 
-namespace {
-constexpr size_t INFLATE_DICT_SIZE = 32768;
-}
-
 // Guarantee the cast pattern in the header comment is valid.
 static_assert(std::is_standard_layout<InflateReader>::value,
               "InflateReader must be standard-layout for the uzlib callback cast to work");
 
 InflateReader::~InflateReader() { deinit(); }
 
-bool InflateReader::init(const bool streaming) {
+bool InflateReader::init(const bool streaming, uint8_t* ring) {
   deinit();  // free any previously allocated ring buffer and reset state
 
   if (streaming) {
-    ringBuffer = static_cast<uint8_t*>(malloc(INFLATE_DICT_SIZE));
+    ownsRingBuffer = ring == nullptr;
+    ringBuffer = ring ? ring : static_cast<uint8_t*>(malloc(DICT_SIZE));
     if (!ringBuffer) return false;
-    memset(ringBuffer, 0, INFLATE_DICT_SIZE);
+    memset(ringBuffer, 0, DICT_SIZE);
   }
 
-  uzlib_uncompress_init(&decomp, ringBuffer, ringBuffer ? INFLATE_DICT_SIZE : 0);
+  uzlib_uncompress_init(&decomp, ringBuffer, ringBuffer ? DICT_SIZE : 0);
   return true;
 }
 
 void InflateReader::deinit() {
-  if (ringBuffer) {
+  if (ringBuffer && ownsRingBuffer) {
     free(ringBuffer);
-    ringBuffer = nullptr;
   }
+  ringBuffer = nullptr;
+  ownsRingBuffer = false;
   memset(&decomp, 0, sizeof(decomp));
 }
 
@@ -3,6 +3,7 @@
 #include <uzlib.h>
 
 #include <cstddef>
+#include <cstdint>
 
 // Return value for readAtMost().
 enum class InflateStatus {
@@ -16,7 +17,8 @@ enum class InflateStatus {
 // Two modes:
 //   init(false)  — one-shot: input is a contiguous buffer, call read() once.
 //   init(true)   — streaming: allocates a 32KB ring buffer for back-references
-//                  across multiple read() / readAtMost() calls.
+//                  across multiple read() / readAtMost() calls, or uses one
+//                  the caller passes in (e.g. from a ScratchArena lease).
 //
 // Streaming callback pattern:
 //   The uzlib read callback receives a `struct uzlib_uncomp*` with no separate
@@ -38,6 +40,8 @@ enum class InflateStatus {
 //
 class InflateReader {
  public:
+  static constexpr size_t DICT_SIZE = 32768;
+
   InflateReader() = default;
   ~InflateReader();
 
@@ -45,9 +49,10 @@ class InflateReader {
   InflateReader& operator=(const InflateReader&) = delete;
 
   // Initialise decompressor. streaming=true allocates a 32KB ring buffer needed
-  // when read() or readAtMost() will be called multiple times.
+  // when read() or readAtMost() will be called multiple times, unless `ring`
+  // points to DICT_SIZE caller-owned bytes to use instead.
   // Returns false only in streaming mode if the ring buffer allocation fails.
-  bool init(bool streaming = false);
+  bool init(bool streaming = false, uint8_t* ring = nullptr);
 
   // Release the ring buffer and reset internal state.
   void deinit();
@@ -82,4 +87,5 @@ class InflateReader {
  private:
   uzlib_uncomp decomp = {};
   uint8_t* ringBuffer = nullptr;
+  bool ownsRingBuffer = false;
 };
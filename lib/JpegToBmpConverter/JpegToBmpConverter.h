@@ -1,6 +1,7 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <ScaledBmpWriter.h>
 
 class Print;
 class ZipFile;
@@ -8,10 +9,11 @@ class ZipFile;
 class JpegToBmpConverter {
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
                                         unsigned char* pBytes_actually_read, void* pCallback_data);
-  static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
-                                          bool oneBit, bool crop = true);
 
  public:
+  // Decode once and write every requested BMP output (up to 8). Uses DC-only decoding when all outputs are at
+  // least 8x smaller than the source.
+  static bool jpegFileToBmpStreams(FsFile& jpegFile, const BmpOutputSpec* outputs, int outputCount);
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, bool crop = true);
   // Convert with custom target size (for thumbnails)
   static bool jpegFileToBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
@@ -0,0 +1,230 @@
+#include "OpdsFeedPage.h"
+
+#include <algorithm>
+
+namespace {
+
+// Multi-byte fields are little-endian, whatever the host's byte order
+void put16(std::string& out, const uint16_t value) {
+  out.push_back(static_cast<char>(value & 0xFF));
+  out.push_back(static_cast<char>(value >> 8));
+}
+
+void put32(std::string& out, const uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+uint16_t get16(const uint8_t* in) { return static_cast<uint16_t>(in[0] | (in[1] << 8)); }
+
+uint32_t get32(const uint8_t* in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) | (static_cast<uint32_t>(in[2]) << 16) |
+         (static_cast<uint32_t>(in[3]) << 24);
+}
+
+void putString(std::string& out, const std::string& value) {
+  const auto len = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+  put16(out, len);
+  out.append(value, 0, len);
+}
+
+// Reads a length-prefixed string at `pos`, advancing it; false if it runs past `len`
+bool getString(const uint8_t* data, const size_t len, size_t& pos, std::string& value) {
+  if (pos + 2 > len) {
+    return false;
+  }
+  const uint16_t size = get16(data + pos);
+  pos += 2;
+  if (pos + size > len) {
+    return false;
+  }
+  value.assign(reinterpret_cast<const char*>(data + pos), size);
+  pos += size;
+  return true;
+}
+
+}  // namespace
+
+void OpdsFeedPage::begin(const WriteFn write, void* ctx) {
+  this->write = write;
+  writeCtx = ctx;
+  ramOnly = false;
+  writeFailed = false;
+  truncated = false;
+  entryCount = 0;
+  end = HEADER_SIZE;
+  screenOffsets.clear();
+  nextHref.clear();
+  window.clear();
+  windowScreen = 0;
+
+  if (!write || !writeHeader(0)) {
+    ramOnly = true;
+    writeFailed = true;
+  }
+}
+
+bool OpdsFeedPage::append(const OpdsEntry& entry) {
+  const bool inFirstScreen = entryCount < screenSize;
+  if (!writeFailed) {
+    std::string record;
+    record.push_back(static_cast<char>(entry.type));
+    putString(record, entry.title);
+    putString(record, entry.author);
+    putString(record, entry.href);
+    putString(record, entry.id);
+
+    if (writeAt(end, record)) {
+      if (entryCount % screenSize == 0) {
+        screenOffsets.push_back(static_cast<uint32_t>(end));
+      }
+      end += record.size();
+    } else {
+      writeFailed = true;
+      ramOnly = inFirstScreen;
+    }
+  }
+
+  if (writeFailed && !(ramOnly && inFirstScreen)) {
+    truncated = true;
+    return false;
+  }
+  entryCount++;
+  if (inFirstScreen) {
+    window.push_back(entry);
+    return true;
+  }
+  return false;
+}
+
+bool OpdsFeedPage::finish(const std::string& nextHref) {
+  this->nextHref = nextHref;
+  if (writeFailed) {
+    return false;
+  }
+
+  std::string trailer;
+  put32(trailer, static_cast<uint32_t>(screenOffsets.size()));
+  for (const uint32_t offset : screenOffsets) {
+    put32(trailer, offset);
+  }
+  putString(trailer, nextHref);
+  return writeAt(end, trailer) && writeHeader(VERSION);
+}
+
+bool OpdsFeedPage::load(const ReadFn read, void* ctx, const size_t fileSize) {
+  write = nullptr;
+  writeCtx = nullptr;
+  ramOnly = false;
+  writeFailed = true;
+  truncated = false;
+  window.clear();
+  windowScreen = 0;
+
+  uint8_t header[HEADER_SIZE];
+  if (fileSize < HEADER_SIZE || read(ctx, 0, header, HEADER_SIZE) != HEADER_SIZE || get32(header) != MAGIC ||
+      header[4] != VERSION) {
+    return false;
+  }
+  const uint32_t count = get32(header + 8);
+  const uint32_t trailerOffset = get32(header + 12);
+  if (trailerOffset < HEADER_SIZE || trailerOffset >= fileSize) {
+    return false;
+  }
+
+  std::vector<uint8_t> trailer(fileSize - trailerOffset);
+  if (read(ctx, trailerOffset, trailer.data(), trailer.size()) != trailer.size() || trailer.size() < 4) {
+    return false;
+  }
+  const uint32_t screens = get32(trailer.data());
+  if (screens != (count + screenSize - 1) / screenSize || 4 + static_cast<size_t>(screens) * 4 > trailer.size()) {
+    return false;
+  }
+  // Screens start after the header, in order, and before the trailer; showScreen() sizes its read from them
+  screenOffsets.clear();
+  for (uint32_t i = 0; i < screens; i++) {
+    const uint32_t offset = get32(trailer.data() + 4 + i * 4);
+    const uint32_t previous = screenOffsets.empty() ? HEADER_SIZE - 1 : screenOffsets.back();
+    if (offset <= previous || offset >= trailerOffset) {
+      screenOffsets.clear();
+      return false;
+    }
+    screenOffsets.push_back(offset);
+  }
+  size_t pos = 4 + screens * 4;
+  if (!getString(trailer.data(), trailer.size(), pos, nextHref)) {
+    return false;
+  }
+
+  entryCount = count;
+  end = trailerOffset;
+  return showScreen(read, ctx, 0);
+}
+
+bool OpdsFeedPage::showScreen(const ReadFn read, void* ctx, const size_t screen) {
+  if (ramOnly) {
+    windowScreen = screen;
+    return true;
+  }
+
+  std::vector<OpdsEntry> entries;
+  const size_t first = screen * screenSize;
+  if (first < entryCount) {
+    if (screen >= screenOffsets.size()) {
+      return false;
+    }
+    // One read for the whole screen: from its first entry to the next screen's, or to the end of the entries
+    const size_t from = screenOffsets[screen];
+    const size_t to = screen + 1 < screenOffsets.size() ? screenOffsets[screen + 1] : end;
+    if (from >= to || to > end) {
+      return false;
+    }
+    std::vector<uint8_t> bytes(to - from);
+    if (read(ctx, from, bytes.data(), bytes.size()) != bytes.size()) {
+      return false;
+    }
+
+    const size_t count = std::min(screenSize, entryCount - first);
+    entries.reserve(count);
+    size_t pos = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (pos >= bytes.size() || bytes[pos] > static_cast<uint8_t>(OpdsEntryType::BOOK)) {
+        return false;
+      }
+      OpdsEntry entry;
+      entry.type = static_cast<OpdsEntryType>(bytes[pos++]);
+      if (!getString(bytes.data(), bytes.size(), pos, entry.title) ||
+          !getString(bytes.data(), bytes.size(), pos, entry.author) ||
+          !getString(bytes.data(), bytes.size(), pos, entry.href) ||
+          !getString(bytes.data(), bytes.size(), pos, entry.id)) {
+        return false;
+      }
+      entries.push_back(std::move(entry));
+    }
+  }
+
+  window = std::move(entries);
+  windowScreen = screen;
+  return true;
+}
+
+const std::vector<OpdsEntry>& OpdsFeedPage::getWindow() const {
+  // A RAM-only page keeps its one screen while another screen is shown
+  static const std::vector<OpdsEntry> empty;
+  return ramOnly && windowScreen != 0 ? empty : window;
+}
+
+bool OpdsFeedPage::writeAt(const size_t offset, const std::string& data) {
+  return write(writeCtx, offset, reinterpret_cast<const uint8_t*>(data.data()), data.size()) == data.size();
+}
+
+bool OpdsFeedPage::writeHeader(const uint8_t version) {
+  std::string header;
+  put32(header, MAGIC);
+  header.push_back(static_cast<char>(version));
+  header.append(3, '\0');
+  put32(header, static_cast<uint32_t>(entryCount));
+  put32(header, version == 0 ? 0 : static_cast<uint32_t>(end));
+  return writeAt(0, header);
+}
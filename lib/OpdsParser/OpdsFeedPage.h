@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OpdsParser.h"
+
+/**
+ * One page of an OPDS catalog, spilled to a file as its entries stream in from the parser so that RAM only ever holds
+ * the screenful being shown.
+ *
+ * The file starts with a header holding the entry count and the offset of the trailer, followed by the entries in
+ * feed order and the trailer: the offset of the first entry of every screen and the feed's rel="next" href. The
+ * header keeps version 0 until finish() has written the trailer, so a page cut short by a failed fetch or power loss
+ * is never loaded back.
+ *
+ * While writing, the window fills with the first screen, so the list can be drawn as soon as it is full. When the file
+ * can't take an entry (no file, card full), the entries spilled so far stay readable and later ones are dropped; if
+ * that happens within the first screen, the page is kept in RAM only and holds just that screen. Reads and writes go
+ * through callbacks, so this class doesn't depend on the storage layer.
+ */
+class OpdsFeedPage {
+ public:
+  static constexpr uint32_t MAGIC = 0x5044504F;  // "OPDP"
+  static constexpr uint8_t VERSION = 1;
+  static constexpr size_t HEADER_SIZE = 16;
+
+  using ReadFn = size_t (*)(void* ctx, size_t offset, uint8_t* out, size_t len);
+  using WriteFn = size_t (*)(void* ctx, size_t offset, const uint8_t* data, size_t len);
+
+  explicit OpdsFeedPage(size_t screenSize) : screenSize(screenSize) {}
+
+  // Starts a new page; `write` may be nullptr to keep the first screen in RAM only
+  void begin(WriteFn write, void* ctx);
+  // Spills an entry and adds it to the window while the first screen is filling. Returns true if the window changed.
+  bool append(const OpdsEntry& entry);
+  // Writes the trailer and the final header; returns false if the page couldn't be saved for a later load()
+  bool finish(const std::string& nextHref);
+
+  // Reads back a finished page and shows its first screen
+  bool load(ReadFn read, void* ctx, size_t fileSize);
+  // Loads the entries of `screen` into the window; a screen past the last entry gives an empty window
+  bool showScreen(ReadFn read, void* ctx, size_t screen);
+
+  // Entries of the window screen, starting at entry getWindowScreen() * getScreenSize()
+  const std::vector<OpdsEntry>& getWindow() const;
+  size_t getWindowScreen() const { return windowScreen; }
+  size_t getScreenSize() const { return screenSize; }
+  size_t getEntryCount() const { return entryCount; }
+  const std::string& getNextHref() const { return nextHref; }
+  // True when entries were dropped because the file couldn't take them
+  bool isTruncated() const { return truncated; }
+
+ private:
+  bool writeAt(size_t offset, const std::string& data);
+  bool writeHeader(uint8_t version);
+
+  size_t screenSize;
+  WriteFn write = nullptr;
+  void* writeCtx = nullptr;
+  bool ramOnly = false;      // the first screen lives in RAM only and is never reloaded
+  bool writeFailed = false;  // later entries are dropped
+  bool truncated = false;
+
+  size_t entryCount = 0;
+  size_t end = HEADER_SIZE;  // end of the spilled entries
+  std::vector<uint32_t> screenOffsets;  // file offset of each screen's first entry
+  std::string nextHref;
+
+  std::vector<OpdsEntry> window;
+  size_t windowScreen = 0;
+};
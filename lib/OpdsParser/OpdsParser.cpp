@@ -1,14 +1,12 @@
 #include "OpdsParser.h"
 
-#include <Logging.h>
-
 #include <cstring>
 
-OpdsParser::OpdsParser() {
+OpdsParser::OpdsParser(EntryCallback onEntry) : onEntry(std::move(onEntry)) {
   parser = XML_ParserCreate(nullptr);
   if (!parser) {
     errorOccured = true;
-    LOG_DBG("OPDS", "Couldn't allocate memory for parser");
+    errorMessage = "Couldn't allocate memory for parser";
   }
 }
 
@@ -41,10 +39,7 @@ size_t OpdsParser::write(const uint8_t* xmlData, const size_t length) {
   while (remaining > 0) {
     void* const buf = XML_GetBuffer(parser, chunkSize);
     if (!buf) {
-      errorOccured = true;
-      LOG_DBG("OPDS", "Couldn't allocate memory for buffer");
-      XML_ParserFree(parser);
-      parser = nullptr;
+      fail("Couldn't allocate memory for buffer");
       return length;
     }
 
@@ -52,11 +47,7 @@ size_t OpdsParser::write(const uint8_t* xmlData, const size_t length) {
     memcpy(buf, currentPos, toRead);
 
     if (XML_ParseBuffer(parser, static_cast<int>(toRead), 0) == XML_STATUS_ERROR) {
-      errorOccured = true;
-      LOG_DBG("OPDS", "Parse error at line %lu: %s", XML_GetCurrentLineNumber(parser),
-              XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_ParserFree(parser);
-      parser = nullptr;
+      fail(XML_ErrorString(XML_GetErrorCode(parser)));
       return length;
     }
 
@@ -67,17 +58,27 @@ size_t OpdsParser::write(const uint8_t* xmlData, const size_t length) {
 }
 
 void OpdsParser::flush() {
+  // A failed parser was already freed
+  if (!parser) {
+    return;
+  }
   if (XML_Parse(parser, nullptr, 0, XML_TRUE) != XML_STATUS_OK) {
-    errorOccured = true;
-    XML_ParserFree(parser);
-    parser = nullptr;
+    fail(XML_ErrorString(XML_GetErrorCode(parser)));
   }
 }
 
+void OpdsParser::fail(const char* message) {
+  errorOccured = true;
+  errorMessage = message;
+  XML_ParserFree(parser);
+  parser = nullptr;
+}
+
 bool OpdsParser::error() const { return errorOccured; }
 
 void OpdsParser::clear() {
   entries.clear();
+  nextHref.clear();
   currentEntry = OpdsEntry{};
   currentText.clear();
   inEntry = false;
@@ -116,7 +117,17 @@ void XMLCALL OpdsParser::startElement(void* userData, const XML_Char* name, cons
     return;
   }
 
-  if (!self->inEntry) return;
+  if (!self->inEntry) {
+    // Feed-level rel="next" link to the next page of a paginated catalog
+    if (strcmp(name, "link") == 0 || strstr(name, ":link") != nullptr) {
+      const char* rel = findAttribute(atts, "rel");
+      const char* href = findAttribute(atts, "href");
+      if (rel && href && strcmp(rel, "next") == 0) {
+        self->nextHref = href;
+      }
+    }
+    return;
+  }
 
   // Check for title element
   if (strcmp(name, "title") == 0 || strstr(name, ":title") != nullptr) {
@@ -177,7 +188,11 @@ void XMLCALL OpdsParser::endElement(void* userData, const XML_Char* name) {
   if (strcmp(name, "entry") == 0 || strstr(name, ":entry") != nullptr) {
     // Only add entry if it has required fields (title and href)
     if (!self->currentEntry.title.empty() && !self->currentEntry.href.empty()) {
-      self->entries.push_back(self->currentEntry);
+      if (self->onEntry) {
+        self->onEntry(self->currentEntry);
+      } else {
+        self->entries.push_back(self->currentEntry);
+      }
     }
     self->inEntry = false;
     self->currentEntry = OpdsEntry{};
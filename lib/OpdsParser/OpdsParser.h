@@ -1,7 +1,7 @@
 #pragma once
-#include <Print.h>
 #include <expat.h>
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -31,6 +31,10 @@ using OpdsBook = OpdsEntry;
  * Parser for OPDS (Open Publication Distribution System) Atom feeds.
  * Uses the Expat XML parser to parse OPDS catalog entries.
  *
+ * The feed is fed in with write() in chunks of any size as it arrives and finished with flush(); OpdsParserStream
+ * adapts it to an Arduino Stream for the HTTP client. With an entry callback, each entry is handed over as soon as its
+ * closing tag is parsed and nothing is collected, so a large catalog never sits in RAM as a whole.
+ *
  * Usage:
  *   OpdsParser parser;
  *   if (parser.parse(xmlData, xmlLength)) {
@@ -43,21 +47,25 @@ using OpdsBook = OpdsEntry;
  *     }
  *   }
  */
-class OpdsParser final : public Print {
+class OpdsParser final {
  public:
-  OpdsParser();
+  using EntryCallback = std::function<void(const OpdsEntry& entry)>;
+
+  explicit OpdsParser(EntryCallback onEntry = nullptr);
   ~OpdsParser();
 
   // Disable copy
   OpdsParser(const OpdsParser&) = delete;
   OpdsParser& operator=(const OpdsParser&) = delete;
 
-  size_t write(uint8_t) override;
-  size_t write(const uint8_t*, size_t) override;
+  size_t write(uint8_t);
+  size_t write(const uint8_t*, size_t);
 
-  void flush() override;
+  void flush();
 
   bool error() const;
+  // What went wrong, for logging; nullptr if nothing did
+  const char* getErrorMessage() const { return errorMessage; }
 
   operator bool() { return !error(); }
 
@@ -74,6 +82,11 @@ class OpdsParser final : public Print {
    */
   std::vector<OpdsEntry> getBooks() const;
 
+  /**
+   * Target of the feed's rel="next" link: the next page of a paginated catalog, empty on the last page.
+   */
+  const std::string& getNextHref() const { return nextHref; }
+
   /**
    * Clear all parsed entries.
    */
@@ -88,10 +101,14 @@ class OpdsParser final : public Print {
   // Helper to find attribute value
   static const char* findAttribute(const XML_Char** atts, const char* name);
 
+  void fail(const char* message);
+
   XML_Parser parser = nullptr;
+  EntryCallback onEntry;
   std::vector<OpdsEntry> entries;
   OpdsEntry currentEntry;
   std::string currentText;
+  std::string nextHref;
 
   // Parser state
   bool inEntry = false;
@@ -101,4 +118,5 @@ class OpdsParser final : public Print {
   bool inId = false;
 
   bool errorOccured = false;
+  const char* errorMessage = nullptr;
 };
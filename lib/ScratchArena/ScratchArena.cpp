@@ -0,0 +1,77 @@
+#include "ScratchArena.h"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace {
+
+constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+uint8_t* region = nullptr;
+std::atomic<bool> leased{false};
+
+size_t alignUp(const size_t bytes) { return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+}  // namespace
+
+bool ScratchArena::reserve() {
+  if (!region) {
+    region = static_cast<uint8_t*>(malloc(SIZE));
+  }
+  return region != nullptr;
+}
+
+bool ScratchArena::isReserved() { return region != nullptr; }
+
+bool ScratchArena::release() {
+  bool expected = false;
+  if (!leased.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+    return false;
+  }
+  free(region);
+  region = nullptr;
+  leased.store(false, std::memory_order_release);
+  return true;
+}
+
+ScratchArena::Lease::Lease() {
+  bool expected = false;
+  if (!leased.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+    return;
+  }
+  active = reserve();
+  if (!active) {
+    leased.store(false, std::memory_order_release);
+  }
+}
+
+ScratchArena::Lease::~Lease() {
+  if (active) {
+    leased.store(false, std::memory_order_release);
+  }
+}
+
+bool ScratchArena::Lease::hasRoom(const size_t bytes) const { return active && alignUp(used) + bytes <= SIZE; }
+
+void* ScratchArena::Lease::allocate(const size_t bytes) {
+  if (!hasRoom(bytes)) {
+    return nullptr;
+  }
+  void* block = region + alignUp(used);
+  used = alignUp(used) + bytes;
+  return block;
+}
+
+ScratchBuffer::ScratchBuffer(ScratchArena::Lease& lease, const size_t bytes)
+    : data(static_cast<uint8_t*>(lease.allocate(bytes))), onHeap(false) {
+  if (!data) {
+    data = static_cast<uint8_t*>(malloc(bytes));
+    onHeap = true;
+  }
+}
+
+ScratchBuffer::~ScratchBuffer() {
+  if (onHeap) {
+    free(data);
+  }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/**
+ * Scratch region for the large transient buffers of image decoding and book indexing: the PNGdec and JPEGDEC
+ * decoder objects, the 32KB inflate dictionary of zip and PNG streams, and image pixel caches. Allocating those from
+ * the general heap made decodes fail whenever the heap was too fragmented for one 40-60KB block, even with plenty of
+ * memory free.
+ *
+ * The region is reserved by the first Lease, so a session that never opens a book or an image doesn't give it up, and
+ * is kept from then on so later decodes don't depend on the heap staying in one piece. The WiFi activities release()
+ * it before the radio starts, since the WiFi stack and TLS need that memory more than a reader that isn't drawing.
+ *
+ * A Lease gives its holder the whole region until it goes out of scope; blocks are carved off it in order and all
+ * return with the lease. Only one lease holds the region at a time. A lease taken while another one is held, or when
+ * the region can't be reserved, holds nothing, and ScratchBuffer and ScratchObject then fall back to the heap.
+ */
+class ScratchArena {
+ public:
+  // PNGdec's decoder object is the largest user: a 32KB zlib window and ~7KB inflate state, plus a 16KB scanline
+  // buffer with this build's PNG_MAX_BUFFERED_PIXELS, ~58KB in all
+  static constexpr size_t SIZE = 64 * 1024;
+
+  // Reserves the region if it isn't already; Lease calls this on first use
+  static bool reserve();
+  static bool isReserved();
+  // Returns the region to the heap unless a lease holds it; the next Lease reserves it again
+  static bool release();
+
+  class Lease {
+   public:
+    Lease();
+    ~Lease();
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    bool isActive() const { return active; }
+    bool hasRoom(size_t bytes) const;
+    // The next `bytes` of the region, or nullptr if the lease is inactive or out of room
+    void* allocate(size_t bytes);
+
+   private:
+    bool active = false;
+    size_t used = 0;
+  };
+};
+
+// A block from the lease when it has room, from the heap otherwise. Check get() for nullptr like malloc.
+class ScratchBuffer {
+ public:
+  ScratchBuffer(ScratchArena::Lease& lease, size_t bytes);
+  ~ScratchBuffer();
+  ScratchBuffer(const ScratchBuffer&) = delete;
+  ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+  uint8_t* get() const { return data; }
+  bool inArena() const { return data && !onHeap; }
+
+ private:
+  uint8_t* data;
+  bool onHeap;
+};
+
+// A T constructed in a ScratchBuffer and destroyed with it
+template <typename T>
+class ScratchObject {
+ public:
+  template <typename... Args>
+  explicit ScratchObject(ScratchArena::Lease& lease, Args&&... args) : buffer(lease, sizeof(T)) {
+    if (buffer.get()) {
+      object = new (buffer.get()) T(std::forward<Args>(args)...);
+    }
+  }
+  ~ScratchObject() {
+    if (object) {
+      object->~T();
+    }
+  }
+  ScratchObject(const ScratchObject&) = delete;
+  ScratchObject& operator=(const ScratchObject&) = delete;
+
+  T* get() const { return object; }
+  T* operator->() const { return object; }
+  explicit operator bool() const { return object != nullptr; }
+  bool inArena() const { return buffer.inArena(); }
+
+ private:
+  ScratchBuffer buffer;
+  T* object = nullptr;
+};
@@ -1,14 +1,14 @@
 #include "Txt.h"
 
+#include <BookCacheKey.h>
 #include <FsHelpers.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 
 Txt::Txt(std::string path, std::string cacheBasePath)
     : filepath(std::move(path)), cacheBasePath(std::move(cacheBasePath)) {
-  // Generate cache path from file path hash
-  const size_t hash = std::hash<std::string>{}(filepath);
-  cachePath = this->cacheBasePath + "/txt_" + std::to_string(hash);
+  // Keyed by content so the index and progress survive renames and moves
+  cachePath = BookCacheKey::cachePath(filepath, this->cacheBasePath, "txt_");
 }
 
 bool Txt::load() {
@@ -7,9 +7,15 @@
 
 #include "Xtc.h"
 
+#include <BookCacheKey.h>
 #include <HalStorage.h>
 #include <Logging.h>
 
+Xtc::Xtc(std::string filepath, const std::string& cacheDir)
+    : filepath(std::move(filepath)),
+      cachePath(BookCacheKey::cachePath(this->filepath, cacheDir, "xtc_")),
+      loaded(false) {}
+
 bool Xtc::load() {
   LOG_DBG("XTC", "Loading XTC: %s", filepath.c_str());
 
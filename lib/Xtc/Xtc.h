@@ -27,10 +27,8 @@ class Xtc {
   bool loaded;
 
  public:
-  explicit Xtc(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)), loaded(false) {
-    // Create cache key based on filepath (same as Epub)
-    cachePath = cacheDir + "/xtc_" + std::to_string(std::hash<std::string>{}(this->filepath));
-  }
+  // The cache directory is keyed by a fingerprint of the file contents (see BookCacheKey)
+  explicit Xtc(std::string filepath, const std::string& cacheDir);
   ~Xtc() = default;
 
   /**
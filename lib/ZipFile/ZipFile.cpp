@@ -3,6 +3,7 @@
 #include <HalStorage.h>
 #include <InflateReader.h>
 #include <Logging.h>
+#include <ScratchArena.h>
 
 #include <algorithm>
 
@@ -557,13 +558,15 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       return false;
     }
 
+    // The inflate dictionary comes from the scratch arena when it's free, the heap otherwise
+    ScratchArena::Lease scratch;
     ZipInflateCtx ctx;
     ctx.file = &file;
     ctx.fileRemaining = deflatedDataSize;
     ctx.readBuf = fileReadBuffer;
     ctx.readBufSize = chunkSize;
 
-    if (!ctx.reader.init(true)) {
+    if (!ctx.reader.init(true, static_cast<uint8_t*>(scratch.allocate(InflateReader::DICT_SIZE)))) {
       LOG_ERR("ZIP", "Failed to init inflate reader");
       free(outputBuffer);
       free(fileReadBuffer);
@@ -37,6 +37,13 @@ void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen)
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
 }
 
+void HalDisplay::displayWindow(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height,
+                               const bool turnOffScreen) {
+  const uint16_t alignedX = x & ~7;
+  const uint16_t alignedWidth = ((x + width + 7) & ~7) - alignedX;
+  einkDisplay.displayWindow(alignedX, y, alignedWidth, height, turnOffScreen);
+}
+
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
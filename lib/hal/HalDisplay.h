@@ -34,6 +34,9 @@ class HalDisplay {
                             bool fromProgmem = false) const;
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Sends only a band of the frame buffer and refreshes it with the fast waveform. Panel coordinates; x and width are
+  // widened to whole bytes.
+  void displayWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
 
   // Power management
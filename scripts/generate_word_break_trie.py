@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Compile a Thai word list into the constexpr dictionary trie used by the line-break segmenter."""
+
+from __future__ import annotations
+
+import argparse
+import pathlib
+
+# Thai codepoints are stored as one byte each (codepoint - THAI_BASE); every dictionary letter lies in U+0E01..U+0E5B.
+THAI_BASE = 0x0E00
+THAI_FIRST = 0x0E01
+THAI_LAST = 0x0E5B
+
+
+def _format_bytes(blob: bytes, per_line: int = 16) -> str:
+    # Render the blob as a comma separated list of hex literals with consistent wrapping.
+    lines = []
+    for i in range(0, len(blob), per_line):
+        chunk = ', '.join(f"0x{b:02X}" for b in blob[i : i + per_line])
+        lines.append(f"    {chunk},")
+    if not lines:
+        lines.append("    0x00,")
+    return '\n'.join(lines)
+
+
+def _symbol_from_output(path: pathlib.Path) -> str:
+    # Derive a stable C identifier from the destination header name (e.g., th-words.trie.h -> th_words).
+    name = path.name
+    if name.endswith('.trie.h'):
+        name = name[:-7]
+    return name.replace('-', '_')
+
+
+def read_words(path: pathlib.Path) -> list[bytes]:
+    # Accepts plain word lists and ICU's thaidict.txt (comments start with '#', one word per line).
+    words = set()
+    for line in path.read_text(encoding='utf-8').splitlines():
+        word = line.strip()
+        if not word or word.startswith('#'):
+            continue
+        if not all(THAI_FIRST <= ord(ch) <= THAI_LAST for ch in word):
+            continue
+        words.add(bytes(ord(ch) - THAI_BASE for ch in word))
+    return sorted(words)
+
+
+class _Node:
+    __slots__ = ('terminal', 'children')
+
+    def __init__(self) -> None:
+        self.terminal = False
+        self.children: dict[int, _Node] = {}
+
+
+def build_trie(words: list[bytes]) -> tuple[bytes, int]:
+    # Serialized node layout (children are written before their parent, so the root is the last node):
+    #   header: bit 7 terminal, bits 6..5 stride (1..3 bytes), bits 4..0 child count (31 -> extra count byte)
+    #   transitions: one letter byte per child, ascending
+    #   targets: big-endian backward distance from this node's address to each child, `stride` bytes each
+    # Identical subtrees are emitted once, which folds the shared suffixes of the word list.
+    root = _Node()
+    for word in words:
+        node = root
+        for letter in word:
+            node = node.children.setdefault(letter, _Node())
+        node.terminal = True
+
+    blob = bytearray()
+    emitted: dict[tuple, int] = {}
+
+    def emit(node: _Node) -> int:
+        children = [(letter, emit(child)) for letter, child in sorted(node.children.items())]
+        key = (node.terminal, tuple(children))
+        if key in emitted:
+            return emitted[key]
+
+        addr = len(blob)
+        distances = [addr - child_addr for _, child_addr in children]
+        stride = 1
+        while any(d >= 1 << (8 * stride) for d in distances):
+            stride += 1
+        if stride > 3:
+            raise ValueError('dictionary too large for 24-bit child offsets')
+
+        count = len(children)
+        blob.append((0x80 if node.terminal else 0) | (stride << 5) | min(count, 31))
+        if count >= 31:
+            blob.append(count)
+        blob.extend(letter for letter, _ in children)
+        for distance in distances:
+            blob.extend(distance.to_bytes(stride, 'big'))
+
+        emitted[key] = addr
+        return addr
+
+    root_addr = emit(root)
+    return bytes(blob), root_addr
+
+
+def write_header(path: pathlib.Path, blob: bytes, root_addr: int, symbol: str, word_count: int) -> None:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    data_symbol = f"{symbol}_trie_data"
+    trie_symbol = f"{symbol}_trie"
+
+    content = f"""#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../SerializedWordTrie.h"
+
+// Auto-generated by generate_word_break_trie.py from {word_count} words. Do not edit manually.
+alignas(4) constexpr uint8_t {data_symbol}[] = {{
+{_format_bytes(blob)}
+}};
+
+constexpr SerializedWordTrie {trie_symbol} = {{
+    0x{root_addr:02X}u,
+    {data_symbol},
+    sizeof({data_symbol}),
+}};
+"""
+    path.write_text(content)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--input', required=True, help='UTF-8 word list, one word per line')
+    parser.add_argument('--output', required=True, help='Destination header path (*.trie.h)')
+    args = parser.parse_args()
+
+    words = read_words(pathlib.Path(args.input))
+    blob, root_addr = build_trie(words)
+    out_path = pathlib.Path(args.output)
+    write_header(out_path, blob, root_addr, _symbol_from_output(out_path), len(words))
+    print(f'wrote {args.output} ({len(words)} words, {len(blob)} bytes payload)')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+cd "$ROOT_DIR"
+
+mkdir -p "build"
+wget -O "build/thaidict.txt" \
+  "https://raw.githubusercontent.com/unicode-org/icu/main/icu4c/source/data/brkitr/dictionaries/thaidict.txt"
+cp "build/thaidict.txt" "scripts/data/th-words.txt"
+
+python scripts/generate_word_break_trie.py \
+  --input "scripts/data/th-words.txt" \
+  --output "lib/Epub/Epub/linebreak/generated/th-words.trie.h"
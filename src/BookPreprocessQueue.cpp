@@ -0,0 +1,184 @@
+#include "BookPreprocessQueue.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "CrossPointSettings.h"
+#include "UserFonts.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "components/UITheme.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t PREPROCESS_FILE_VERSION = 1;
+constexpr char PREPROCESS_FILE[] = "/.crosspoint/preprocess.bin";
+constexpr size_t MAX_PENDING_BOOKS = 32;
+constexpr int MAX_THUMB_HEIGHTS = 3;
+
+bool isEpubPath(const std::string& path) { return StringUtils::checkFileExtension(path, ".epub"); }
+
+bool isXtcPath(const std::string& path) {
+  return StringUtils::checkFileExtension(path, ".xtc") || StringUtils::checkFileExtension(path, ".xtch");
+}
+}  // namespace
+
+BookPreprocessQueue BookPreprocessQueue::instance;
+
+void BookPreprocessQueue::enqueue(const std::string& path) {
+  if (SETTINGS.prepareTransfers == CrossPointSettings::PREPARE_NONE || (!isEpubPath(path) && !isXtcPath(path))) {
+    return;
+  }
+
+  // A re-uploaded book starts over, its old caches were just dropped
+  if (!pending.empty() && pending.front().path == path) {
+    releaseBook();
+  }
+  pending.erase(
+      std::remove_if(pending.begin(), pending.end(), [&](const PendingBook& book) { return book.path == path; }),
+      pending.end());
+  if (pending.size() >= MAX_PENDING_BOOKS) {
+    LOG_DBG("BPQ", "Queue full, not preparing %s", path.c_str());
+    return;
+  }
+
+  pending.push_back({path, 0});
+  lastEnqueueTime = millis();
+  saveToFile();
+  LOG_DBG("BPQ", "Queued %s (%u pending)", path.c_str(), static_cast<unsigned>(pending.size()));
+}
+
+bool BookPreprocessQueue::processNext(GfxRenderer& renderer) {
+  if (pending.empty()) {
+    return false;
+  }
+
+  PendingBook& book = pending.front();
+  const uint32_t start = millis();
+  const bool done = !Storage.exists(book.path.c_str()) || runStep(renderer, book);
+  LOG_DBG("BPQ", "Step %u of %s took %lu ms", book.nextStep, book.path.c_str(), millis() - start);
+
+  if (done) {
+    releaseBook();
+    pending.erase(pending.begin());
+  } else {
+    book.nextStep++;
+  }
+  saveToFile();
+  return true;
+}
+
+bool BookPreprocessQueue::runStep(GfxRenderer& renderer, PendingBook& book) {
+  int thumbHeights[MAX_THUMB_HEIGHTS];
+  const int thumbHeightCount = UITheme::getCoverThumbHeights(thumbHeights, MAX_THUMB_HEIGHTS);
+
+  if (isXtcPath(book.path)) {
+    Xtc xtc(book.path, "/.crosspoint");
+    if (xtc.load()) {
+      for (int i = 0; i < thumbHeightCount; i++) {
+        xtc.generateThumbBmp(thumbHeights[i]);
+      }
+      xtc.generateCoverBmp();
+    }
+    return true;
+  }
+
+  if (!loadedEpub) {
+    auto epub = std::make_shared<Epub>(book.path, "/.crosspoint");
+    if (!epub->load(true, SETTINGS.embeddedStyle == 0)) {
+      return true;  // The reader won't be able to open it either
+    }
+    loadedEpub = std::move(epub);
+  }
+  const std::shared_ptr<Epub>& epub = loadedEpub;
+
+  if (book.nextStep == 0) {
+    const bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+    epub->generateCoverImages(!cropped, cropped, thumbHeights, thumbHeightCount);
+    return epub->getSpineItemsCount() == 0;
+  }
+
+  // The section a first open lands on goes first, the rest follow in reading order
+  const int openingIndex = std::max(0, epub->getSpineIndexForTextReference());
+  const int sectionCount =
+      SETTINGS.prepareTransfers == CrossPointSettings::PREPARE_ALL_CHAPTERS ? epub->getSpineItemsCount() : 1;
+  const int step = book.nextStep - 1;
+  const int spineIndex = step == 0 ? openingIndex : (step - 1 < openingIndex ? step - 1 : step);
+
+  // Sections are laid out with the font the reader will use
+  USER_FONTS.sync(renderer);
+  uint16_t viewportWidth, viewportHeight;
+  EpubReaderActivity::getReaderViewport(renderer, &viewportWidth, &viewportHeight);
+  Section section(epub, spineIndex, renderer);
+  if (!section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                               viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                               SETTINGS.imageRendering)) {
+    section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                              SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                              viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                              SETTINGS.imageRendering);
+  }
+  return step + 1 >= sectionCount;
+}
+
+bool BookPreprocessQueue::saveToFile() const {
+  Storage.mkdir("/.crosspoint");
+  if (pending.empty()) {
+    if (Storage.exists(PREPROCESS_FILE)) {
+      Storage.remove(PREPROCESS_FILE);
+    }
+    return true;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForWrite("BPQ", PREPROCESS_FILE, file)) {
+    return false;
+  }
+  serialization::writePod(file, PREPROCESS_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(pending.size()));
+  for (const auto& book : pending) {
+    serialization::writeString(file, book.path);
+    serialization::writePod(file, book.nextStep);
+  }
+  file.close();
+  return true;
+}
+
+bool BookPreprocessQueue::loadFromFile() {
+  releaseBook();
+  pending.clear();
+  if (!Storage.exists(PREPROCESS_FILE)) {
+    return false;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("BPQ", PREPROCESS_FILE, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  uint8_t count = 0;
+  serialization::readPod(file, version);
+  if (version != PREPROCESS_FILE_VERSION) {
+    LOG_ERR("BPQ", "Deserialization failed: Unknown version %u", version);
+    file.close();
+    return false;
+  }
+  serialization::readPod(file, count);
+  for (uint8_t i = 0; i < count && file.available() > 0; i++) {
+    PendingBook book;
+    serialization::readString(file, book.path);
+    serialization::readPod(file, book.nextStep);
+    pending.push_back(std::move(book));
+  }
+  file.close();
+  LOG_DBG("BPQ", "%u books waiting to be prepared", static_cast<unsigned>(pending.size()));
+  return true;
+}
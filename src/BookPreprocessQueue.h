@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Epub;
+class GfxRenderer;
+
+/**
+ * Books waiting to be prepared after a file transfer, persisted in /.crosspoint/preprocess.bin so the work survives a
+ * reboot. Preparing a book builds what its first open would otherwise pay for: the EPUB metadata and CSS caches, the
+ * home screen thumbnails and sleep cover, and the first (or every) section for the current reader layout.
+ *
+ * The work is split into steps of at most one section each, so callers can run it from their loop while the device
+ * is otherwise idle without blocking input or the web server for long.
+ */
+class BookPreprocessQueue {
+  struct PendingBook {
+    std::string path;
+    uint16_t nextStep;  // 0 = metadata and covers, n = section n - 1
+  };
+
+  // Static instance
+  static BookPreprocessQueue instance;
+
+  std::vector<PendingBook> pending;
+  unsigned long lastEnqueueTime = 0;
+  // The front book, loaded by its first step and kept for the rest so each section step doesn't parse it again
+  std::shared_ptr<Epub> loadedEpub;
+
+  // Runs one step for the front book. Returns true once the book needs no further steps.
+  bool runStep(GfxRenderer& renderer, PendingBook& book);
+
+ public:
+  ~BookPreprocessQueue() = default;
+
+  // Get singleton instance
+  static BookPreprocessQueue& getInstance() { return instance; }
+
+  // Queues a book that just arrived over a file transfer. Files the readers can't open are ignored.
+  void enqueue(const std::string& path);
+
+  bool isEmpty() const { return pending.empty(); }
+
+  // millis() of the last enqueue, so callers can wait for a batch of uploads to finish
+  unsigned long getLastEnqueueTime() const { return lastEnqueueTime; }
+
+  // Runs the next preparation step. Returns false if there was nothing to do.
+  bool processNext(GfxRenderer& renderer);
+
+  // Frees the book kept loaded between steps, for when preparing pauses for something that needs the memory
+  void releaseBook() { loadedEpub.reset(); }
+
+  bool saveToFile() const;
+
+  bool loadFromFile();
+};
+
+// Helper macro to access the preprocessing queue
+#define PREPROCESS_QUEUE BookPreprocessQueue::getInstance()
@@ -8,6 +8,7 @@
 #include <cstring>
 #include <string>
 
+#include "UserFonts.h"
 #include "fontIds.h"
 
 // Initialize the static instance
@@ -293,7 +294,28 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
+uint64_t CrossPointSettings::getCacheBudgetBytes() const {
+  constexpr uint64_t MB = 1024ULL * 1024;
+  switch (cacheBudget) {
+    case CACHE_UNLIMITED:
+    default:
+      return 0;
+    case CACHE_100_MB:
+      return 100 * MB;
+    case CACHE_250_MB:
+      return 250 * MB;
+    case CACHE_500_MB:
+      return 500 * MB;
+    case CACHE_1_GB:
+      return 1024 * MB;
+  }
+}
+
 int CrossPointSettings::getReaderFontId() const {
+  // Falls back to Bookerly while no SD card font is open
+  if (fontFamily == SD_CARD_FONT && USER_FONTS.getFontId() != 0) {
+    return USER_FONTS.getFontId();
+  }
   switch (fontFamily) {
     case BOOKERLY:
     default:
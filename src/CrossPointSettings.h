@@ -92,7 +92,7 @@ class CrossPointSettings {
   enum SIDE_BUTTON_LAYOUT { PREV_NEXT = 0, NEXT_PREV = 1, SIDE_BUTTON_LAYOUT_COUNT };
 
   // Font family options
-  enum FONT_FAMILY { BOOKERLY = 0, NOTOSANS = 1, OPENDYSLEXIC = 2, FONT_FAMILY_COUNT };
+  enum FONT_FAMILY { BOOKERLY = 0, NOTOSANS = 1, OPENDYSLEXIC = 2, SD_CARD_FONT = 3, FONT_FAMILY_COUNT };
   // Font size options
   enum FONT_SIZE { SMALL = 0, MEDIUM = 1, LARGE = 2, EXTRA_LARGE = 3, FONT_SIZE_COUNT };
   enum LINE_COMPRESSION { TIGHT = 0, NORMAL = 1, WIDE = 2, LINE_COMPRESSION_COUNT };
@@ -137,6 +137,24 @@ class CrossPointSettings {
   // Image rendering in EPUB reader
   enum IMAGE_RENDERING { IMAGES_DISPLAY = 0, IMAGES_PLACEHOLDER = 1, IMAGES_SUPPRESS = 2, IMAGE_RENDERING_COUNT };
 
+  // Size limit for cached book data on the SD card
+  enum CACHE_BUDGET {
+    CACHE_UNLIMITED = 0,
+    CACHE_100_MB = 1,
+    CACHE_250_MB = 2,
+    CACHE_500_MB = 3,
+    CACHE_1_GB = 4,
+    CACHE_BUDGET_COUNT
+  };
+
+  // How much of a transferred book is prepared ahead of its first open
+  enum PREPARE_TRANSFERS {
+    PREPARE_NONE = 0,
+    PREPARE_FIRST_CHAPTER = 1,
+    PREPARE_ALL_CHAPTERS = 2,
+    PREPARE_TRANSFERS_COUNT
+  };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -173,6 +191,8 @@ class CrossPointSettings {
   uint8_t fontSize = MEDIUM;
   uint8_t lineSpacing = NORMAL;
   uint8_t paragraphAlignment = JUSTIFIED;
+  // Family of the SD card font (file name prefix in /.crosspoint/fonts), empty = first one installed
+  char sdFontFamily[32] = "";
   // Auto-sleep timeout setting (default 10 minutes)
   uint8_t sleepTimeout = SLEEP_10_MIN;
   // E-ink refresh frequency (default 15 pages)
@@ -199,6 +219,12 @@ class CrossPointSettings {
   uint8_t showHiddenFiles = 0;
   // Image rendering mode in EPUB reader
   uint8_t imageRendering = IMAGES_DISPLAY;
+  // Book cache size limit; least recently read books are trimmed first
+  uint8_t cacheBudget = CACHE_UNLIMITED;
+  // Draw the next EPUB page into spare buffers while idle, so forward page turns only refresh the panel
+  uint8_t renderAhead = 0;
+  // Metadata, covers and sections built for books received over a file transfer
+  uint8_t prepareTransfers = PREPARE_FIRST_CHAPTER;
 
   ~CrossPointSettings() = default;
 
@@ -225,6 +251,7 @@ class CrossPointSettings {
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  uint64_t getCacheBudgetBytes() const;
 };
 
 // Helper macro to access settings
@@ -0,0 +1,191 @@
+#include "UserFonts.h"
+
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char FONT_DIR[] = "/.crosspoint/fonts";
+constexpr char FONT_EXTENSION[] = ".epdfont";
+// Same order as the EpdFontFamily constructor
+const char* const STYLE_NAMES[] = {"regular", "bold", "italic", "bolditalic"};
+
+size_t readFromFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file.seekSet(offset)) {
+    return 0;
+  }
+  const int bytesRead = file.read(out, len);
+  return bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0;
+}
+
+// Splits "<family>_<size>_<style>.epdfont". Returns false for any other file name.
+bool parseFontFileName(const std::string& name, std::string& family, int& size) {
+  if (!StringUtils::checkFileExtension(name, FONT_EXTENSION)) {
+    return false;
+  }
+  const std::string stem = name.substr(0, name.size() - strlen(FONT_EXTENSION));
+  const auto styleSep = stem.rfind('_');
+  if (styleSep == std::string::npos || styleSep == 0) {
+    return false;
+  }
+  const auto sizeSep = stem.rfind('_', styleSep - 1);
+  if (sizeSep == std::string::npos || sizeSep == 0) {
+    return false;
+  }
+  family = stem.substr(0, sizeSep);
+  size = atoi(stem.c_str() + sizeSep + 1);
+  return size > 0;
+}
+
+uint32_t fnv1a(uint32_t hash, const void* data, const size_t len) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Everything in a face that changes line breaks and page layout: vertical metrics, the glyph set and every glyph's
+// size and advance, kerning and ligatures. A different font of the same file size then still gets another id.
+uint32_t hashMetrics(uint32_t hash, const EpdFontData& data) {
+  hash = fnv1a(hash, &data.advanceY, sizeof(data.advanceY));
+  hash = fnv1a(hash, &data.ascender, sizeof(data.ascender));
+  hash = fnv1a(hash, &data.descender, sizeof(data.descender));
+  hash = fnv1a(hash, data.intervals, data.intervalCount * sizeof(EpdUnicodeInterval));
+  if (data.intervalCount > 0) {
+    const EpdUnicodeInterval& last = data.intervals[data.intervalCount - 1];
+    const uint32_t glyphCount = last.offset + last.last - last.first + 1;
+    for (uint32_t i = 0; i < glyphCount; i++) {
+      const EpdGlyph& glyph = data.glyph[i];
+      const int16_t metrics[] = {glyph.width, glyph.height, static_cast<int16_t>(glyph.advanceX), glyph.left,
+                                 glyph.top};
+      hash = fnv1a(hash, metrics, sizeof(metrics));
+    }
+  }
+  if (data.kernMatrix) {
+    hash = fnv1a(hash, data.kernLeftClasses, data.kernLeftEntryCount * sizeof(EpdKernClassEntry));
+    hash = fnv1a(hash, data.kernRightClasses, data.kernRightEntryCount * sizeof(EpdKernClassEntry));
+    hash = fnv1a(hash, data.kernMatrix, data.kernLeftClassCount * data.kernRightClassCount);
+  }
+  if (data.ligaturePairs) {
+    hash = fnv1a(hash, data.ligaturePairs, data.ligaturePairCount * sizeof(EpdLigaturePair));
+  }
+  return hash;
+}
+}  // namespace
+
+UserFonts UserFonts::instance;
+
+void UserFonts::sync(GfxRenderer& renderer) {
+  if (SETTINGS.fontFamily != CrossPointSettings::SD_CARD_FONT) {
+    close(renderer);
+    return;
+  }
+
+  // Installed sizes of the configured family. Without a configured name, the alphabetically first family is used.
+  const bool pickFirst = SETTINGS.sdFontFamily[0] == '\0';
+  std::string family = SETTINGS.sdFontFamily;
+  std::vector<int> sizes;
+  auto dir = Storage.open(FONT_DIR);
+  if (dir && dir.isDirectory()) {
+    char name[128];
+    for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+      file.getName(name, sizeof(name));
+      file.close();
+      std::string fileFamily;
+      int size = 0;
+      if (!parseFontFileName(name, fileFamily, size)) {
+        continue;
+      }
+      if (pickFirst && (family.empty() || fileFamily < family)) {
+        family = fileFamily;
+        sizes.clear();
+      }
+      if (fileFamily == family && std::find(sizes.begin(), sizes.end(), size) == sizes.end()) {
+        sizes.push_back(size);
+      }
+    }
+  }
+  if (dir) dir.close();
+
+  if (sizes.empty()) {
+    LOG_DBG("UFN", "No SD card font %s installed", family.c_str());
+    close(renderer);
+    return;
+  }
+  std::sort(sizes.begin(), sizes.end());
+  const int size = sizes[std::min<size_t>(SETTINGS.fontSize, sizes.size() - 1)];
+  if (openKey == family + "_" + std::to_string(size)) {
+    return;
+  }
+
+  close(renderer);
+  if (!open(renderer, family, size)) {
+    close(renderer);
+  }
+}
+
+bool UserFonts::open(GfxRenderer& renderer, const std::string& family, const int size) {
+  const std::string prefix = std::string(FONT_DIR) + "/" + family + "_" + std::to_string(size) + "_";
+  uint32_t hash = 2166136261u;
+  size_t tableBytes = 0;
+  for (int style = 0; style < STYLE_COUNT; style++) {
+    const std::string path = prefix + STYLE_NAMES[style] + FONT_EXTENSION;
+    Face& face = faces[style];
+    if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("UFN", path, face.file)) {
+      continue;
+    }
+    const size_t fileSize = face.file.fileSize();
+    if (!face.font.open(readFromFile, &face.file, fileSize)) {
+      LOG_ERR("UFN", "Invalid font file or tables over %u bytes: %s", static_cast<unsigned>(SdFont::MAX_TABLE_BYTES),
+              path.c_str());
+      face.file.close();
+      continue;
+    }
+    fonts[style].data = face.font.getData();
+    tableBytes += face.font.getTableBytes();
+    hash = fnv1a(hash, path.c_str(), path.size());
+    hash = fnv1a(hash, &fileSize, sizeof(fileSize));
+    hash = hashMetrics(hash, *face.font.getData());
+  }
+  if (!faces[0].font.isOpen()) {
+    LOG_ERR("UFN", "SD card font %s size %d has no regular style", family.c_str(), size);
+    return false;
+  }
+
+  const auto styleOrNull = [this](const int style) { return faces[style].font.isOpen() ? &fonts[style] : nullptr; };
+  // Zero means "no SD font" to callers
+  fontId = hash != 0 ? static_cast<int>(hash) : 1;
+  openKey = family + "_" + std::to_string(size);
+  // Cached groups are keyed by EpdFontData address, which the faces reuse across families
+  renderer.clearFontCache();
+  renderer.insertFont(fontId, EpdFontFamily(&fonts[0], styleOrNull(1), styleOrNull(2), styleOrNull(3)));
+  LOG_DBG("UFN", "Opened SD card font %s, %u bytes of tables in RAM", openKey.c_str(),
+          static_cast<unsigned>(tableBytes));
+  return true;
+}
+
+void UserFonts::close(GfxRenderer& renderer) {
+  if (fontId != 0) {
+    renderer.removeFont(fontId);
+    renderer.clearFontCache();
+    fontId = 0;
+  }
+  for (int style = 0; style < STYLE_COUNT; style++) {
+    faces[style].font.close();
+    if (faces[style].file) {
+      faces[style].file.close();
+    }
+    fonts[style].data = nullptr;
+  }
+  openKey.clear();
+}
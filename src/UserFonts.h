@@ -0,0 +1,53 @@
+#pragma once
+#include <EpdFont.h>
+#include <HalStorage.h>
+#include <SdFont.h>
+
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * Reader font installed on the SD card as .epdfont files (see fontconvert.py --binary) in /.crosspoint/fonts, named
+ * like the built-in fonts: <family>_<size>_<style>.epdfont with style regular, bold, italic or bolditalic.
+ *
+ * Only the family and size picked in the settings is open, one file per style. The installed sizes of a family map
+ * onto the Font Size setting in ascending order. Missing styles fall back to regular.
+ */
+class UserFonts {
+  static constexpr int STYLE_COUNT = 4;
+
+  struct Face {
+    FsFile file;
+    SdFont font;
+  };
+
+  // Static instance
+  static UserFonts instance;
+
+  Face faces[STYLE_COUNT];
+  EpdFont fonts[STYLE_COUNT] = {EpdFont(nullptr), EpdFont(nullptr), EpdFont(nullptr), EpdFont(nullptr)};
+  std::string openKey;  // "<family>_<size>" of the open faces, empty if none
+  int fontId = 0;
+
+  void close(GfxRenderer& renderer);
+  bool open(GfxRenderer& renderer, const std::string& family, int size);
+
+ public:
+  ~UserFonts() = default;
+
+  // Get singleton instance
+  static UserFonts& getInstance() { return instance; }
+
+  // Opens the faces the current settings ask for and registers them with the renderer, or releases them when the
+  // reader uses a built-in font. Does nothing if the right faces are already open.
+  void sync(GfxRenderer& renderer);
+
+  // Renderer font ID of the open family, 0 if none. Derived from the file names and sizes and from the metrics of each
+  // face, so replacing a font file, even with one of the same size, invalidates the section caches laid out with the
+  // old one.
+  int getFontId() const { return fontId; }
+};
+
+// Helper macro to access the SD card reader font
+#define USER_FONTS UserFonts::getInstance()
@@ -1,6 +1,7 @@
 #include "ActivityManager.h"
 
 #include <HalPowerManager.h>
+#include <HeapTelemetry.h>
 
 #include "boot_sleep/BootActivity.h"
 #include "boot_sleep/SleepActivity.h"
@@ -36,6 +37,7 @@ void ActivityManager::renderTaskLoop() {
     RenderLock lock;
     if (currentActivity) {
       HalPowerManager::Lock powerLock;  // Ensure we don't go into low-power mode while rendering
+      HeapTelemetry::Scope heapScope(HeapTelemetry::RENDER);
       currentActivity->render(std::move(lock));
     }
     // Notify any task blocked in requestUpdateAndWait() that the render is done.
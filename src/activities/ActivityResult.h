@@ -25,6 +25,7 @@ struct MenuResult {
 
 struct ChapterResult {
   int spineIndex = 0;
+  std::string anchor;  // fragment of the TOC entry, empty for the start of the spine item
 };
 
 struct PercentResult {
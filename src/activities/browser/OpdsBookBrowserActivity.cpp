@@ -1,12 +1,16 @@
 #include "OpdsBookBrowserActivity.h"
 
-#include <Epub.h>
+#include <BookCacheKey.h>
 #include <GfxRenderer.h>
+#include <HalStorage.h>
 #include <I18n.h>
 #include <Logging.h>
 #include <OpdsStream.h>
 #include <WiFi.h>
 
+#include <algorithm>
+#include <functional>
+
 #include "CrossPointSettings.h"
 #include "MappedInputManager.h"
 #include "activities/network/WifiSelectionActivity.h"
@@ -17,15 +21,40 @@
 #include "util/UrlUtils.h"
 
 namespace {
-constexpr int PAGE_ITEMS = 23;
+constexpr char CACHE_DIR[] = "/.crosspoint/opds";
+constexpr size_t MAX_CACHED_PAGES = 8;
+
+std::string pagePath(const std::string& feedPath) {
+  return std::string(CACHE_DIR) + "/" + std::to_string(std::hash<std::string>{}(feedPath)) + ".bin";
+}
+
+size_t readFromFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file || !file.seekSet(offset)) {
+    return 0;
+  }
+  const int count = file.read(out, len);
+  return count > 0 ? count : 0;
+}
+
+size_t writeToFile(void* ctx, const size_t offset, const uint8_t* data, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file.seekSet(offset)) {
+    return 0;
+  }
+  return file.write(data, len);
+}
 }  // namespace
 
 void OpdsBookBrowserActivity::onEnter() {
   Activity::onEnter();
 
   state = BrowserState::CHECK_WIFI;
-  entries.clear();
+  page.begin(nullptr, nullptr);
   navigationHistory.clear();
+  cachedPaths.clear();
+  // Catalog pages are only kept for one visit; the server may have changed since the last one
+  Storage.removeDir(CACHE_DIR);
   currentPath = "";  // Root path - user provides full URL in settings
   selectorIndex = 0;
   errorMessage.clear();
@@ -42,8 +71,10 @@ void OpdsBookBrowserActivity::onExit() {
   // Turn off WiFi when exiting
   WiFi.mode(WIFI_OFF);
 
-  entries.clear();
+  page.begin(nullptr, nullptr);
   navigationHistory.clear();
+  cachedPaths.clear();
+  Storage.removeDir(CACHE_DIR);
 }
 
 void OpdsBookBrowserActivity::loop() {
@@ -99,39 +130,30 @@ void OpdsBookBrowserActivity::loop() {
   // Handle browsing state
   if (state == BrowserState::BROWSING) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-      if (!entries.empty()) {
-        const auto& entry = entries[selectorIndex];
-        if (entry.type == OpdsEntryType::BOOK) {
-          downloadBook(entry);
+      if (const OpdsEntry* entry = selectedEntry()) {
+        if (entry->type == OpdsEntryType::BOOK) {
+          downloadBook(*entry);
         } else {
-          navigateToEntry(entry);
+          navigateToEntry(*entry);
         }
+      } else if (selectorIndex < rowCount()) {
+        navigateToPath(page.getNextHref());
       }
     } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
       navigateBack();
     }
 
     // Handle navigation
-    if (!entries.empty()) {
-      buttonNavigator.onNextRelease([this] {
-        selectorIndex = ButtonNavigator::nextIndex(selectorIndex, entries.size());
-        requestUpdate();
-      });
+    if (rowCount() > 0) {
+      buttonNavigator.onNextRelease([this] { select(ButtonNavigator::nextIndex(selectorIndex, rowCount())); });
 
-      buttonNavigator.onPreviousRelease([this] {
-        selectorIndex = ButtonNavigator::previousIndex(selectorIndex, entries.size());
-        requestUpdate();
-      });
+      buttonNavigator.onPreviousRelease([this] { select(ButtonNavigator::previousIndex(selectorIndex, rowCount())); });
 
-      buttonNavigator.onNextContinuous([this] {
-        selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        requestUpdate();
-      });
+      buttonNavigator.onNextContinuous(
+          [this] { select(ButtonNavigator::nextPageIndex(selectorIndex, rowCount(), PAGE_ITEMS)); });
 
-      buttonNavigator.onPreviousContinuous([this] {
-        selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        requestUpdate();
-      });
+      buttonNavigator.onPreviousContinuous(
+          [this] { select(ButtonNavigator::previousPageIndex(selectorIndex, rowCount(), PAGE_ITEMS)); });
     }
   }
 }
@@ -189,23 +211,26 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
   // Browsing state
   // Show appropriate button hint based on selected entry type
   const char* confirmLabel = tr(STR_OPEN);
-  if (!entries.empty() && entries[selectorIndex].type == OpdsEntryType::BOOK) {
+  const OpdsEntry* selected = selectedEntry();
+  if (selected && selected->type == OpdsEntryType::BOOK) {
     confirmLabel = tr(STR_DOWNLOAD);
   }
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), confirmLabel, tr(STR_DIR_UP), tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  if (entries.empty()) {
+  if (rowCount() == 0) {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, tr(STR_NO_ENTRIES));
     renderer.displayBuffer();
     return;
   }
 
-  const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
+  // The window holds the entries of the screen on display, read back from the page file
+  const auto& window = page.getWindow();
+  const size_t pageStartIndex = page.getWindowScreen() * PAGE_ITEMS;
   renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
 
-  for (size_t i = pageStartIndex; i < entries.size() && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
-    const auto& entry = entries[i];
+  for (size_t i = pageStartIndex; i < pageStartIndex + window.size(); i++) {
+    const auto& entry = window[i - pageStartIndex];
 
     // Format display text with type indicator
     std::string displayText;
@@ -224,6 +249,14 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
                       i != static_cast<size_t>(selectorIndex));
   }
 
+  // "Next page" row after the last entry of a paginated feed
+  const size_t nextRow = page.getEntryCount();
+  if (!page.getNextHref().empty() && nextRow / PAGE_ITEMS == page.getWindowScreen()) {
+    const std::string displayText = std::string("> ") + tr(STR_OPDS_NEXT_PAGE);
+    renderer.drawText(UI_10_FONT_ID, 20, 60 + (nextRow % PAGE_ITEMS) * 30, displayText.c_str(),
+                      nextRow != static_cast<size_t>(selectorIndex));
+  }
+
   renderer.displayBuffer();
 }
 
@@ -236,33 +269,69 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     return;
   }
 
+  if (loadCachedPage(path)) {
+    LOG_DBG("OPDS", "Showing saved page of %s", path.c_str());
+    state = BrowserState::BROWSING;
+    requestUpdate();
+    return;
+  }
+
   std::string url = UrlUtils::buildUrl(serverUrl, path);
   LOG_DBG("OPDS", "Fetching: %s", url.c_str());
 
-  OpdsParser parser;
-
+  // Entries go to the page file as they are parsed; without a file only the first screen is kept
+  const std::string filePath = pagePath(path);
+  Storage.mkdir(CACHE_DIR);
+  FsFile file;
+  const bool spilling = Storage.openFileForWrite("OPDS", filePath, file);
   {
-    OpdsParserStream stream{parser};
-    if (!HttpDownloader::fetchUrl(url, stream)) {
-      state = BrowserState::ERROR;
-      errorMessage = tr(STR_FETCH_FEED_FAILED);
+    RenderLock lock(*this);
+    page.begin(spilling ? writeToFile : nullptr, &file);
+    selectorIndex = 0;
+  }
+
+  OpdsParser parser([this](const OpdsEntry& entry) {
+    RenderLock lock(*this);
+    page.append(entry);
+    // Show the list as soon as the first screen is full; the rest of the feed keeps streaming in
+    if (state == BrowserState::LOADING && page.getEntryCount() == PAGE_ITEMS) {
+      state = BrowserState::BROWSING;
       requestUpdate();
-      return;
     }
+  });
+
+  bool fetched;
+  {
+    OpdsParserStream stream{parser};
+    fetched = HttpDownloader::fetchUrl(url, stream);
+  }
+  const bool saved = page.finish(parser.getNextHref());
+  file.close();
+
+  if (!fetched) {
+    state = BrowserState::ERROR;
+    errorMessage = tr(STR_FETCH_FEED_FAILED);
+    requestUpdate();
+    return;
   }
 
   if (!parser) {
+    LOG_DBG("OPDS", "Parse error: %s", parser.getErrorMessage());
     state = BrowserState::ERROR;
     errorMessage = tr(STR_PARSE_FEED_FAILED);
     requestUpdate();
     return;
   }
 
-  entries = std::move(parser).getEntries();
-  LOG_DBG("OPDS", "Found %d entries", entries.size());
-  selectorIndex = 0;
+  LOG_DBG("OPDS", "Found %d entries", static_cast<int>(page.getEntryCount()));
+  if (page.isTruncated()) {
+    LOG_ERR("OPDS", "Could not save the whole page to %s, entries were dropped", filePath.c_str());
+  }
+  if (saved) {
+    rememberCachedPage(path);
+  }
 
-  if (entries.empty()) {
+  if (rowCount() == 0) {
     state = BrowserState::ERROR;
     errorMessage = tr(STR_NO_ENTRIES);
     requestUpdate();
@@ -273,15 +342,85 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   requestUpdate();
 }
 
-void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
+bool OpdsBookBrowserActivity::loadCachedPage(const std::string& path) {
+  const auto cached = std::find(cachedPaths.begin(), cachedPaths.end(), path);
+  if (cached == cachedPaths.end()) {
+    return false;
+  }
+  cachedPaths.erase(cached);
+
+  FsFile file;
+  if (!Storage.openFileForRead("OPDS", pagePath(path), file)) {
+    return false;
+  }
+  bool loaded;
+  {
+    RenderLock lock(*this);
+    loaded = page.load(readFromFile, &file, file.fileSize());
+    selectorIndex = 0;
+  }
+  file.close();
+  if (loaded) {
+    cachedPaths.push_back(path);
+  }
+  return loaded;
+}
+
+void OpdsBookBrowserActivity::rememberCachedPage(const std::string& path) {
+  cachedPaths.push_back(path);
+  if (cachedPaths.size() > MAX_CACHED_PAGES) {
+    Storage.remove(pagePath(cachedPaths.front()).c_str());
+    cachedPaths.erase(cachedPaths.begin());
+  }
+}
+
+int OpdsBookBrowserActivity::rowCount() const {
+  return static_cast<int>(page.getEntryCount()) + (page.getNextHref().empty() ? 0 : 1);
+}
+
+const OpdsEntry* OpdsBookBrowserActivity::selectedEntry() const {
+  const auto& window = page.getWindow();
+  const int first = static_cast<int>(page.getWindowScreen()) * PAGE_ITEMS;
+  if (selectorIndex < first || selectorIndex >= first + static_cast<int>(window.size())) {
+    return nullptr;
+  }
+  return &window[selectorIndex - first];
+}
+
+void OpdsBookBrowserActivity::select(const int index) {
+  // Moving onto another screen reads its entries back from the page file
+  const size_t screen = index / PAGE_ITEMS;
+  if (screen != page.getWindowScreen()) {
+    FsFile file;
+    Storage.openFileForRead("OPDS", pagePath(currentPath), file);
+    bool shown;
+    {
+      RenderLock lock(*this);
+      shown = page.showScreen(readFromFile, &file, screen);
+    }
+    file.close();
+    if (!shown) {
+      LOG_ERR("OPDS", "Could not read screen %d of %s", static_cast<int>(screen), currentPath.c_str());
+      cachedPaths.erase(std::remove(cachedPaths.begin(), cachedPaths.end(), currentPath), cachedPaths.end());
+      state = BrowserState::ERROR;
+      errorMessage = tr(STR_FETCH_FEED_FAILED);
+      requestUpdate();
+      return;
+    }
+  }
+  selectorIndex = index;
+  requestUpdate();
+}
+
+void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) { navigateToPath(entry.href); }
+
+void OpdsBookBrowserActivity::navigateToPath(const std::string& path) {
   // Push current path to history before navigating
   navigationHistory.push_back(currentPath);
-  currentPath = entry.href;
+  currentPath = path;
 
   state = BrowserState::LOADING;
   statusMessage = tr(STR_LOADING);
-  entries.clear();
-  selectorIndex = 0;
   requestUpdate(true);  // Force update to show loading state immediately before fetch
 
   fetchFeed(currentPath);
@@ -298,8 +437,6 @@ void OpdsBookBrowserActivity::navigateBack() {
 
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
-    entries.clear();
-    selectorIndex = 0;
     requestUpdate();
 
     fetchFeed(currentPath);
@@ -336,8 +473,7 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
     LOG_DBG("OPDS", "Download complete: %s", filename.c_str());
 
     // Invalidate any existing cache for this file to prevent stale metadata issues
-    Epub epub(filename, "/.crosspoint");
-    epub.clearCache();
+    BookCacheKey::discard(filename, "/.crosspoint", "epub_");
     LOG_DBG("OPDS", "Cleared cache for: %s", filename.c_str());
 
     state = BrowserState::BROWSING;
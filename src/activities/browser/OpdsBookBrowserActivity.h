@@ -1,4 +1,5 @@
 #pragma once
+#include <OpdsFeedPage.h>
 #include <OpdsParser.h>
 
 #include <functional>
@@ -12,6 +13,11 @@
  * Activity for browsing and downloading books from an OPDS server.
  * Supports navigation through catalog hierarchy and downloading EPUBs.
  * When WiFi connection fails, launches WiFi selection to let user connect.
+ *
+ * Feeds are parsed as they download and spilled to /.crosspoint/opds, one file per catalog page; the list shows as
+ * soon as the first screenful has arrived and only the screen on display is kept in RAM. A paginated feed's
+ * rel="next" link becomes a "Next page" row that fetches the next page on demand. The last few pages shown stay on
+ * the card for this visit, so going back doesn't refetch them.
  */
 class OpdsBookBrowserActivity final : public Activity {
  public:
@@ -33,12 +39,15 @@ class OpdsBookBrowserActivity final : public Activity {
   void render(RenderLock&&) override;
 
  private:
+  static constexpr int PAGE_ITEMS = 23;
+
   ButtonNavigator buttonNavigator;
   BrowserState state = BrowserState::LOADING;
-  std::vector<OpdsEntry> entries;
+  OpdsFeedPage page{PAGE_ITEMS};
   std::vector<std::string> navigationHistory;  // Stack of previous feed paths for back navigation
   std::string currentPath;                     // Current feed path being displayed
-  int selectorIndex = 0;
+  std::vector<std::string> cachedPaths;        // Feed paths with a saved page file, least recently shown first
+  int selectorIndex = 0;                       // Entry index in the page; the entry count selects "Next page"
   std::string errorMessage;
   std::string statusMessage;
   size_t downloadProgress = 0;
@@ -48,7 +57,13 @@ class OpdsBookBrowserActivity final : public Activity {
   void launchWifiSelection();
   void onWifiSelectionComplete(bool connected);
   void fetchFeed(const std::string& path);
+  bool loadCachedPage(const std::string& path);
+  void rememberCachedPage(const std::string& path);
+  int rowCount() const;
+  const OpdsEntry* selectedEntry() const;
+  void select(int index);
   void navigateToEntry(const OpdsEntry& entry);
+  void navigateToPath(const std::string& path);
   void navigateBack();
   void downloadBook(const OpdsEntry& book);
   bool preventAutoSleep() override { return true; }
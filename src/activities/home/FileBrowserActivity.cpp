@@ -1,6 +1,6 @@
 #include "FileBrowserActivity.h"
 
-#include <Epub.h>
+#include <BookCacheKey.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <I18n.h>
@@ -11,6 +11,7 @@
 #include "MappedInputManager.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "util/SleepScreenCache.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -121,9 +122,10 @@ void FileBrowserActivity::onExit() {
 void FileBrowserActivity::clearFileMetadata(const std::string& fullPath) {
   // Only clear cache for .epub files
   if (StringUtils::checkFileExtension(fullPath, ".epub")) {
-    Epub(fullPath, "/.crosspoint").clearCache();
+    BookCacheKey::discard(fullPath, "/.crosspoint", "epub_");
     LOG_DBG("FileBrowser", "Cleared metadata cache for: %s", fullPath.c_str());
   }
+  SleepScreenCache::invalidate(fullPath);
 }
 
 void FileBrowserActivity::loop() {
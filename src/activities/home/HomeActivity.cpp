@@ -72,7 +72,11 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
           }
           GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-          bool success = epub.generateThumbBmp(coverHeight);
+          // Decode the cover once for every theme's thumbnail and the configured sleep cover
+          int thumbHeights[4] = {coverHeight};
+          const int thumbHeightCount = 1 + UITheme::getCoverThumbHeights(thumbHeights + 1, 3);
+          const bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+          bool success = epub.generateCoverImages(!cropped, cropped, thumbHeights, thumbHeightCount);
           if (!success) {
             RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
             book.coverBmpPath = "";
@@ -4,11 +4,13 @@
 #include <ESPmDNS.h>
 #include <GfxRenderer.h>
 #include <I18n.h>
+#include <ScratchArena.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 
 #include <cstddef>
 
+#include "BookPreprocessQueue.h"
 #include "MappedInputManager.h"
 #include "NetworkModeSelectionActivity.h"
 #include "WifiSelectionActivity.h"
@@ -30,6 +32,9 @@ constexpr int QR_CODE_HEIGHT = 198;
 // DNS server for captive portal (redirects all DNS queries to our IP)
 DNSServer* dnsServer = nullptr;
 constexpr uint16_t DNS_PORT = 53;
+
+// Quiet period after the last received book before preparing it, so a batch of uploads isn't slowed down
+constexpr unsigned long PREPARE_IDLE_MS = 5000;
 }  // namespace
 
 void CrossPointWebServerActivity::onEnter() {
@@ -71,6 +76,9 @@ void CrossPointWebServerActivity::onExit() {
   // Stop mDNS
   MDNS.end();
 
+  // A book being prepared is loaded again when preparing resumes
+  PREPROCESS_QUEUE.releaseBook();
+
   // Stop DNS server if running (AP mode)
   if (dnsServer) {
     LOG_DBG("WEBACT", "Stopping DNS server...");
@@ -183,6 +191,8 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(const bool connected)
 
 void CrossPointWebServerActivity::startAccessPoint() {
   LOG_DBG("WEBACT", "Starting Access Point mode...");
+  // Hand the image decoding scratch region back to the heap for the WiFi stack
+  ScratchArena::release();
   LOG_DBG("WEBACT", "Free heap before AP start: %d bytes", ESP.getFreeHeap());
 
   // Configure and start the AP
@@ -339,6 +349,15 @@ void CrossPointWebServerActivity::loop() {
       onGoHome();
       return;
     }
+
+    // Prepare received books one step per loop while transfers are idle
+    if (webServer && webServer->isRunning() && !PREPROCESS_QUEUE.isEmpty() && !webServer->isUploadInProgress() &&
+        millis() - PREPROCESS_QUEUE.getLastEnqueueTime() >= PREPARE_IDLE_MS) {
+      RenderLock lock(*this);
+      PREPROCESS_QUEUE.processNext(renderer);
+      // The step's decodes reserved the scratch region; the server needs it back between steps
+      ScratchArena::release();
+    }
   }
 }
 
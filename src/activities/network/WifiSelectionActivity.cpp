@@ -3,6 +3,7 @@
 #include <GfxRenderer.h>
 #include <I18n.h>
 #include <Logging.h>
+#include <ScratchArena.h>
 #include <WiFi.h>
 
 #include <map>
@@ -16,6 +17,12 @@
 void WifiSelectionActivity::onEnter() {
   Activity::onEnter();
 
+  // Hand the image decoding scratch region back to the heap for the WiFi stack
+  if (ScratchArena::release()) {
+    LOG_DBG("WIFI", "Released scratch arena, free heap %d bytes, largest block %d bytes", ESP.getFreeHeap(),
+            ESP.getMaxAllocHeap());
+  }
+
   // Load saved WiFi credentials - SD card operations need lock as we use SPI
   // for both
   {
@@ -75,20 +75,15 @@ void EpubReaderActivity::onEnter() {
 
   epub->setupCacheDir();
 
-  FsFile f;
-  if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[6];
-    int dataSize = f.read(data, 6);
-    if (dataSize == 4 || dataSize == 6) {
-      currentSpineIndex = data[0] + (data[1] << 8);
-      nextPageNumber = data[2] + (data[3] << 8);
-      cachedSpineIndex = currentSpineIndex;
-      LOG_DBG("ERS", "Loaded cache: %d, %d", currentSpineIndex, nextPageNumber);
-    }
-    if (dataSize == 6) {
-      cachedChapterTotalPageCount = data[4] + (data[5] << 8);
-    }
-    f.close();
+  // Spine index, page and chapter page count; progress.bin from before the page count was saved holds a zero there
+  uint8_t data[ReadingProgress::PAYLOAD_SIZE];
+  if (readingProgress.load(epub->getCachePath(), data)) {
+    currentSpineIndex = data[0] + (data[1] << 8);
+    nextPageNumber = data[2] + (data[3] << 8);
+    cachedSpineIndex = currentSpineIndex;
+    cachedChapterTotalPageCount = data[4] + (data[5] << 8);
+    progressSpineIndex = currentSpineIndex;
+    LOG_DBG("ERS", "Loaded cache: %d, %d", currentSpineIndex, nextPageNumber);
   }
   // We may want a better condition to detect if we are opening for the first time.
   // This will trigger if the book is re-opened at Chapter 0.
@@ -115,6 +110,8 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
+  readingProgress.flush();
+  renderAhead.release();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   section.reset();
@@ -128,6 +125,12 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  // Don't wait out a render for it, the next loop will do
+  if (readingProgress.isDirty() && !RenderLock::peek()) {
+    RenderLock lock(*this);
+    readingProgress.flushIfIdle();
+  }
+
   if (automaticPageTurnActive) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm) ||
         mappedInput.wasReleased(MappedInputManager::Button::Back)) {
@@ -319,10 +322,15 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
       startActivityForResult(
           std::make_unique<EpubReaderChapterSelectionActivity>(renderer, mappedInput, epub, path, spineIdx),
           [this](const ActivityResult& result) {
-            if (!result.isCancelled && currentSpineIndex != std::get<ChapterResult>(result.data).spineIndex) {
+            if (result.isCancelled) {
+              return;
+            }
+            const auto& chapter = std::get<ChapterResult>(result.data);
+            if (currentSpineIndex != chapter.spineIndex || !chapter.anchor.empty()) {
               RenderLock lock(*this);
-              currentSpineIndex = std::get<ChapterResult>(result.data).spineIndex;
+              currentSpineIndex = chapter.spineIndex;
               nextPageNumber = 0;
+              pendingAnchor = chapter.anchor;
               section.reset();
             }
           });
@@ -397,7 +405,9 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           section.reset();
           epub->clearCache();
           epub->setupCacheDir();
+          readingProgress.restart();
           saveProgress(backupSpine, backupPage, backupPageCount);
+          readingProgress.flush();
         }
       }
       onGoHome();
@@ -435,6 +445,40 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
   }
 }
 
+void EpubReaderActivity::getContentMargins(const GfxRenderer& renderer, const bool automaticPageTurnActive,
+                                           int* orientedMarginTop, int* orientedMarginRight,
+                                           int* orientedMarginBottom, int* orientedMarginLeft) {
+  // Apply screen viewable areas and additional padding
+  renderer.getOrientedViewableTRBL(orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+  *orientedMarginTop += SETTINGS.screenMargin;
+  *orientedMarginLeft += SETTINGS.screenMargin;
+  *orientedMarginRight += SETTINGS.screenMargin;
+
+  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+
+  // reserves space for automatic page turn indicator when no status bar or progress bar only
+  if (automaticPageTurnActive &&
+      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
+    *orientedMarginBottom +=
+        std::max(SETTINGS.screenMargin,
+                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
+  } else {
+    *orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
+  }
+}
+
+void EpubReaderActivity::getReaderViewport(GfxRenderer& renderer, uint16_t* viewportWidth, uint16_t* viewportHeight) {
+  const auto previousOrientation = renderer.getOrientation();
+  applyReaderOrientation(renderer, SETTINGS.orientation);
+
+  int marginTop, marginRight, marginBottom, marginLeft;
+  getContentMargins(renderer, false, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  *viewportWidth = renderer.getScreenWidth() - marginLeft - marginRight;
+  *viewportHeight = renderer.getScreenHeight() - marginTop - marginBottom;
+
+  renderer.setOrientation(previousOrientation);
+}
+
 void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   // No-op if the selected orientation matches current settings.
   if (SETTINGS.orientation == orientation) {
@@ -541,25 +585,23 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     return;
   }
 
-  // Apply screen viewable areas and additional padding
   int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-
-  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
-
-  // reserves space for automatic page turn indicator when no status bar or progress bar only
-  if (automaticPageTurnActive &&
-      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
-    orientedMarginBottom +=
-        std::max(SETTINGS.screenMargin,
-                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
-  } else {
-    orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
+  getContentMargins(renderer, automaticPageTurnActive, &orientedMarginTop, &orientedMarginRight,
+                    &orientedMarginBottom, &orientedMarginLeft);
+
+  // Forward page turn onto the page drawn ahead: no loading or drawing before the refresh
+  if (section && renderAhead.holds(currentSpineIndex, section->currentPage, renderAheadKey())) {
+    showPageRenderedAhead();
+    saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+    if (pendingScreenshot) {
+      pendingScreenshot = false;
+      ScreenshotUtil::takeScreenshot(renderer);
+    }
+    renderNextPageAhead(orientedMarginTop, orientedMarginLeft);
+    return;
   }
+  // Any other page is drawn here, which may need the heap the spare buffers hold
+  renderAhead.release();
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
@@ -575,12 +617,16 @@ void EpubReaderActivity::render(RenderLock&& lock) {
                                   SETTINGS.imageRendering)) {
       LOG_DBG("ERS", "Cache not found, building...");
 
-      const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
+      Rect popupRect;
+      const auto popupFn = [this, &popupRect]() { popupRect = GUI.drawPopup(renderer, tr(STR_INDEXING)); };
+      const auto progressFn = [this, &popupRect](const int percent) {
+        GUI.fillPopupProgress(renderer, popupRect, percent);
+      };
 
       if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                       viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
-                                      SETTINGS.imageRendering, popupFn)) {
+                                      SETTINGS.imageRendering, popupFn, progressFn)) {
         LOG_ERR("ERS", "Failed to persist page data to SD");
         section.reset();
         return;
@@ -606,6 +652,15 @@ void EpubReaderActivity::render(RenderLock&& lock) {
       cachedChapterTotalPageCount = 0;  // resets to 0 to prevent reading cached progress again
     }
 
+    if (!pendingAnchor.empty()) {
+      // Jump straight to the page holding the link or TOC target, page 0 if the id is not in this section
+      const int anchorPage = section->findAnchorPage(pendingAnchor);
+      if (anchorPage >= 0) {
+        section->currentPage = anchorPage;
+      }
+      pendingAnchor.clear();
+    }
+
     if (pendingPercentJump && section->pageCount > 0) {
       // Apply the pending percent jump now that we know the new section's page count.
       int newPage = static_cast<int>(pendingSpineProgress * static_cast<float>(section->pageCount));
@@ -663,25 +718,29 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     pendingScreenshot = false;
     ScreenshotUtil::takeScreenshot(renderer);
   }
+
+  renderNextPageAhead(orientedMarginTop, orientedMarginLeft);
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
-  FsFile f;
-  if (Storage.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[6];
-    data[0] = currentSpineIndex & 0xFF;
-    data[1] = (currentSpineIndex >> 8) & 0xFF;
-    data[2] = currentPage & 0xFF;
-    data[3] = (currentPage >> 8) & 0xFF;
-    data[4] = pageCount & 0xFF;
-    data[5] = (pageCount >> 8) & 0xFF;
-    f.write(data, 6);
-    f.close();
-    LOG_DBG("ERS", "Progress saved: Chapter %d, Page %d", spineIndex, currentPage);
-  } else {
-    LOG_ERR("ERS", "Could not save progress!");
+  uint8_t data[ReadingProgress::PAYLOAD_SIZE] = {};
+  data[0] = spineIndex & 0xFF;
+  data[1] = (spineIndex >> 8) & 0xFF;
+  data[2] = currentPage & 0xFF;
+  data[3] = (currentPage >> 8) & 0xFF;
+  data[4] = pageCount & 0xFF;
+  data[5] = (pageCount >> 8) & 0xFF;
+  if (!readingProgress.update(data)) {
+    return;
+  }
+  LOG_DBG("ERS", "Progress staged: Chapter %d, Page %d", spineIndex, currentPage);
+  // Page turns within a chapter are written behind; a chapter change is written right away
+  if (spineIndex != progressSpineIndex) {
+    progressSpineIndex = spineIndex;
+    readingProgress.flush();
   }
 }
+
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
@@ -709,12 +768,8 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
       renderer.displayBuffer(HalDisplay::HALF_REFRESH);
     }
     // Double FAST_REFRESH handles ghosting for image pages; don't count toward full refresh cadence
-  } else if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
   } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+    displayWithRefreshCadence();
   }
 
   // Save bw buffer to reset buffer state after grayscale data sync
@@ -743,6 +798,95 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   renderer.restoreBwBuffer();
 }
 
+void EpubReaderActivity::displayWithRefreshCadence() {
+  if (pagesUntilFullRefresh <= 1) {
+    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  } else {
+    renderer.displayBuffer();
+    pagesUntilFullRefresh--;
+  }
+}
+
+// Everything a page drawn ahead depends on besides its position. Settings only change from other activities, after
+// which the current page is redrawn and the page ahead dropped anyway; this catches any path that doesn't.
+uint32_t EpubReaderActivity::renderAheadKey() const {
+  uint32_t key = 2166136261u;
+  const auto mix = [&key](const uint32_t value) { key = (key ^ value) * 16777619u; };
+  mix(SETTINGS.getReaderFontId());
+  mix(renderer.getOrientation());
+  mix(SETTINGS.textAntiAliasing);
+  mix(SETTINGS.statusBar);
+  mix(SETTINGS.statusBarTitle);
+  mix(SETTINGS.statusBarProgressBar);
+  mix(SETTINGS.screenMargin);
+  mix(automaticPageTurnActive);
+  return key;
+}
+
+void EpubReaderActivity::renderNextPageAhead(const int orientedMarginTop, const int orientedMarginLeft) {
+  if (!SETTINGS.renderAhead || !section || section->currentPage + 1 >= section->pageCount) {
+    renderAhead.release();
+    return;
+  }
+
+  // Next chapters and image pages are drawn on the turn as before
+  const int page = section->currentPage;
+  section->currentPage = page + 1;
+  auto p = section->loadPageFromSectionFile();
+  if (!p || p->hasImages() || !renderAhead.allocate(SETTINGS.textAntiAliasing)) {
+    section->currentPage = page;
+    renderAhead.release();
+    return;
+  }
+
+  const auto start = millis();
+  // The frame buffer still holds the page on screen: park it in the BW plane while the planes ahead are drawn, then
+  // swap the BW plane of the next page in for it
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  renderAhead.store(PageRenderAhead::BW, frameBuffer);
+  if (renderAhead.hasGrayscale()) {
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    p->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    renderAhead.store(PageRenderAhead::GRAYSCALE_LSB, frameBuffer);
+
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    p->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    renderAhead.store(PageRenderAhead::GRAYSCALE_MSB, frameBuffer);
+    renderer.setRenderMode(GfxRenderer::BW);
+  }
+  renderer.clearScreen();
+  p->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderStatusBar();
+  renderAhead.swap(PageRenderAhead::BW, frameBuffer);
+  renderer.clearFontCache();
+
+  section->currentPage = page;
+  renderAhead.setPage(currentSpineIndex, page + 1, renderAheadKey(), std::move(p->footnotes));
+  LOG_DBG("ERS", "Rendered page %d ahead in %lums", page + 2, millis() - start);
+}
+
+void EpubReaderActivity::showPageRenderedAhead() {
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  renderAhead.load(PageRenderAhead::BW, frameBuffer);
+  currentPageFootnotes = renderAhead.takeFootnotes();
+  renderAhead.clearPage();
+  displayWithRefreshCadence();
+
+  if (renderAhead.hasGrayscale()) {
+    renderAhead.load(PageRenderAhead::GRAYSCALE_LSB, frameBuffer);
+    renderer.copyGrayscaleLsbBuffers();
+    renderAhead.load(PageRenderAhead::GRAYSCALE_MSB, frameBuffer);
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.displayGrayBuffer();
+    // The BW plane is still in the spare buffer, so no copy has to be stored like renderContents does
+    renderAhead.load(PageRenderAhead::BW, frameBuffer);
+    renderer.cleanupGrayscaleWithFrameBuffer();
+  }
+}
+
 void EpubReaderActivity::renderStatusBar() const {
   // Calculate progress in book
   const int currentPage = section->currentPage + 1;
@@ -795,7 +939,7 @@ void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool s
 
   int targetSpineIndex;
   if (sameFile) {
-    // Same file — navigate to page 0 of current spine item
+    // Same file — the anchor table decides the page within the current spine item
     targetSpineIndex = currentSpineIndex;
   } else {
     targetSpineIndex = epub->resolveHrefToSpineIndex(hrefStr);
@@ -811,6 +955,8 @@ void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool s
     RenderLock lock(*this);
     currentSpineIndex = targetSpineIndex;
     nextPageNumber = 0;
+    const size_t hashPos = hrefStr.find('#');
+    pendingAnchor = hashPos != std::string::npos ? hrefStr.substr(hashPos + 1) : "";
     section.reset();
   }
   requestUpdate();
@@ -4,6 +4,8 @@
 #include <Epub/Section.h>
 
 #include "EpubReaderMenuActivity.h"
+#include "PageRenderAhead.h"
+#include "ReadingProgress.h"
 #include "activities/Activity.h"
 
 class EpubReaderActivity final : public Activity {
@@ -14,6 +16,9 @@ class EpubReaderActivity final : public Activity {
   int pagesUntilFullRefresh = 0;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
+  ReadingProgress readingProgress;
+  int progressSpineIndex = -1;  // chapter of the staged position; moving to another one flushes it
+  PageRenderAhead renderAhead;
   unsigned long lastPageTurnTime = 0UL;
   unsigned long pageTurnDuration = 0UL;
   // Signals that the next render should reposition within the newly loaded section
@@ -21,6 +26,8 @@ class EpubReaderActivity final : public Activity {
   bool pendingPercentJump = false;
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
+  // Element id to open the next loaded section at (link or TOC fragment), looked up in the section's anchor table.
+  std::string pendingAnchor;
   bool pendingScreenshot = false;
   bool skipNextButtonCheck = false;  // Skip button processing for one frame after subactivity exit
   bool automaticPageTurnActive = false;
@@ -35,9 +42,16 @@ class EpubReaderActivity final : public Activity {
   SavedPosition savedPositions[MAX_FOOTNOTE_DEPTH] = {};
   int footnoteDepth = 0;
 
+  static void getContentMargins(const GfxRenderer& renderer, bool automaticPageTurnActive, int* orientedMarginTop,
+                                int* orientedMarginRight, int* orientedMarginBottom, int* orientedMarginLeft);
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar() const;
+  void displayWithRefreshCadence();
+  // Render-ahead: draws the page after the current one into spare buffers, and shows it when it comes up
+  uint32_t renderAheadKey() const;
+  void renderNextPageAhead(int orientedMarginTop, int orientedMarginLeft);
+  void showPageRenderedAhead();
   void saveProgress(int spineIndex, int currentPage, int pageCount);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
@@ -58,4 +72,7 @@ class EpubReaderActivity final : public Activity {
   void loop() override;
   void render(RenderLock&& lock) override;
   bool isReaderActivity() const override { return true; }
+
+  // Section layout size for the configured reading orientation, margins and status bar, as used for section caches
+  static void getReaderViewport(GfxRenderer& renderer, uint16_t* viewportWidth, uint16_t* viewportHeight);
 };
@@ -0,0 +1,84 @@
+#include "PageRenderAhead.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+bool PageRenderAhead::allocate(const bool grayscale) {
+  const int planes = grayscale ? PLANE_COUNT : 1;
+  if (chunks[BW][0] && hasGrayscale() == grayscale) {
+    return true;
+  }
+  release();
+
+  const size_t needed = planes * HalDisplay::BUFFER_SIZE;
+  if (ESP.getFreeHeap() < needed + MIN_FREE_HEAP || ESP.getMaxAllocHeap() < CHUNK_SIZE) {
+    LOG_DBG("RAH", "Not rendering ahead, %u bytes free", ESP.getFreeHeap());
+    return false;
+  }
+  for (int plane = 0; plane < planes; plane++) {
+    for (auto& chunk : chunks[plane]) {
+      chunk = static_cast<uint8_t*>(malloc(CHUNK_SIZE));
+      if (!chunk) {
+        LOG_ERR("RAH", "Failed to allocate render-ahead chunk");
+        release();
+        return false;
+      }
+    }
+  }
+  LOG_DBG("RAH", "Allocated %d render-ahead plane(s)", planes);
+  return true;
+}
+
+void PageRenderAhead::release() {
+  for (auto& plane : chunks) {
+    for (auto& chunk : plane) {
+      free(chunk);
+      chunk = nullptr;
+    }
+  }
+  valid = false;
+  footnotes.clear();
+}
+
+void PageRenderAhead::store(const Plane plane, const uint8_t* frameBuffer) {
+  for (size_t i = 0; i < CHUNKS_PER_PLANE; i++) {
+    memcpy(chunks[plane][i], frameBuffer + i * CHUNK_SIZE, CHUNK_SIZE);
+  }
+}
+
+void PageRenderAhead::load(const Plane plane, uint8_t* frameBuffer) const {
+  for (size_t i = 0; i < CHUNKS_PER_PLANE; i++) {
+    memcpy(frameBuffer + i * CHUNK_SIZE, chunks[plane][i], CHUNK_SIZE);
+  }
+}
+
+void PageRenderAhead::swap(const Plane plane, uint8_t* frameBuffer) {
+  uint8_t temp[256];
+  for (size_t i = 0; i < CHUNKS_PER_PLANE; i++) {
+    uint8_t* chunk = chunks[plane][i];
+    uint8_t* frame = frameBuffer + i * CHUNK_SIZE;
+    for (size_t offset = 0; offset < CHUNK_SIZE; offset += sizeof(temp)) {
+      const size_t len = std::min(sizeof(temp), CHUNK_SIZE - offset);
+      memcpy(temp, chunk + offset, len);
+      memcpy(chunk + offset, frame + offset, len);
+      memcpy(frame + offset, temp, len);
+    }
+  }
+}
+
+void PageRenderAhead::setPage(const int spineIndex, const int page, const uint32_t settingsKey,
+                              std::vector<FootnoteEntry> pageFootnotes) {
+  valid = true;
+  this->spineIndex = spineIndex;
+  this->page = page;
+  this->settingsKey = settingsKey;
+  footnotes = std::move(pageFootnotes);
+}
+
+bool PageRenderAhead::holds(const int spineIndex, const int page, const uint32_t settingsKey) const {
+  return valid && this->spineIndex == spineIndex && this->page == page && this->settingsKey == settingsKey;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Epub/FootnoteEntry.h>
+#include <HalDisplay.h>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Spare frame buffers holding the EPUB page after the one on screen, drawn while the reader waits for input so a
+ * forward page turn only has to copy it in and refresh the panel.
+ *
+ * Each plane is kept in CHUNK_SIZE pieces like GfxRenderer's stored BW buffer, so no 48KB contiguous block is needed.
+ * The grayscale planes are only allocated when text anti-aliasing is on. Nothing is allocated when that would leave
+ * less than MIN_FREE_HEAP, and the reader releases the planes before any page it has to draw itself.
+ */
+class PageRenderAhead {
+ public:
+  enum Plane { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, PLANE_COUNT };
+
+  static constexpr size_t CHUNK_SIZE = 8000;
+  static constexpr size_t CHUNKS_PER_PLANE = HalDisplay::BUFFER_SIZE / CHUNK_SIZE;
+  static_assert(CHUNK_SIZE * CHUNKS_PER_PLANE == HalDisplay::BUFFER_SIZE, "Chunks must tile the frame buffer");
+  // Heap left for the rest of the reader (section loading, image decoding, grayscale BW backup) after allocating
+  static constexpr size_t MIN_FREE_HEAP = 64 * 1024;
+
+  ~PageRenderAhead() { release(); }
+
+  // Allocates the BW plane, and the grayscale planes if `grayscale`. Returns false if the heap is too low.
+  bool allocate(bool grayscale);
+  void release();
+
+  bool hasGrayscale() const { return chunks[GRAYSCALE_LSB][0] != nullptr; }
+
+  void store(Plane plane, const uint8_t* frameBuffer);
+  void load(Plane plane, uint8_t* frameBuffer) const;
+  // Exchanges the plane with the frame buffer
+  void swap(Plane plane, uint8_t* frameBuffer);
+
+  // Marks the planes as holding `page` of `spineIndex`, drawn with the settings hashed into `settingsKey`
+  void setPage(int spineIndex, int page, uint32_t settingsKey, std::vector<FootnoteEntry> pageFootnotes);
+  bool holds(int spineIndex, int page, uint32_t settingsKey) const;
+  // Drops the page but keeps the planes for the next one
+  void clearPage() { valid = false; }
+  std::vector<FootnoteEntry> takeFootnotes() { return std::move(footnotes); }
+
+ private:
+  uint8_t* chunks[PLANE_COUNT][CHUNKS_PER_PLANE] = {};
+  bool valid = false;
+  int spineIndex = 0;
+  int page = 0;
+  uint32_t settingsKey = 0;
+  std::vector<FootnoteEntry> footnotes;
+};
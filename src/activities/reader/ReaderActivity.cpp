@@ -1,5 +1,6 @@
 #include "ReaderActivity.h"
 
+#include <BookCacheIndex.h>
 #include <HalStorage.h>
 
 #include "CrossPointSettings.h"
@@ -7,6 +8,7 @@
 #include "EpubReaderActivity.h"
 #include "Txt.h"
 #include "TxtReaderActivity.h"
+#include "UserFonts.h"
 #include "Xtc.h"
 #include "XtcReaderActivity.h"
 #include "activities/util/BmpViewerActivity.h"
@@ -32,6 +34,11 @@ bool ReaderActivity::isTxtFile(const std::string& path) {
 
 bool ReaderActivity::isBmpFile(const std::string& path) { return StringUtils::checkFileExtension(path, ".bmp"); }
 
+void ReaderActivity::trackBookCache(const std::string& cachePath, const std::string& bookPath) {
+  BookCacheIndex::touch(cachePath, bookPath);
+  BookCacheIndex::enforceBudget("/.crosspoint", SETTINGS.getCacheBudgetBytes(), cachePath);
+}
+
 std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
   if (!Storage.exists(path.c_str())) {
     LOG_ERR("READER", "File does not exist: %s", path.c_str());
@@ -40,6 +47,7 @@ std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
 
   auto epub = std::unique_ptr<Epub>(new Epub(path, "/.crosspoint"));
   if (epub->load(true, SETTINGS.embeddedStyle == 0)) {
+    trackBookCache(epub->getCachePath(), path);
     return epub;
   }
 
@@ -55,6 +63,7 @@ std::unique_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
 
   auto xtc = std::unique_ptr<Xtc>(new Xtc(path, "/.crosspoint"));
   if (xtc->load()) {
+    trackBookCache(xtc->getCachePath(), path);
     return xtc;
   }
 
@@ -70,6 +79,7 @@ std::unique_ptr<Txt> ReaderActivity::loadTxt(const std::string& path) {
 
   auto txt = std::unique_ptr<Txt>(new Txt(path, "/.crosspoint"));
   if (txt->load()) {
+    trackBookCache(txt->getCachePath(), path);
     return txt;
   }
 
@@ -114,6 +124,11 @@ void ReaderActivity::onEnter() {
   }
 
   currentBookPath = initialBookPath;
+  {
+    // The font settings may have changed since the last book
+    RenderLock lock(*this);
+    USER_FONTS.sync(renderer);
+  }
   if (isBmpFile(initialBookPath)) {
     onGoToBmpViewer(initialBookPath);
   } else if (isXtcFile(initialBookPath)) {
@@ -17,6 +17,8 @@ class ReaderActivity final : public Activity {
   static bool isXtcFile(const std::string& path);
   static bool isTxtFile(const std::string& path);
   static bool isBmpFile(const std::string& path);
+  // Records the opened book in the cache index and trims other books' caches to the configured budget
+  static void trackBookCache(const std::string& cachePath, const std::string& bookPath);
 
   static std::string extractFolderPath(const std::string& filePath);
   void goToLibrary(const std::string& fromBookPath = "");
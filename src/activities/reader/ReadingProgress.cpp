@@ -0,0 +1,78 @@
+#include "ReadingProgress.h"
+
+#include <Arduino.h>
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <cstring>
+
+namespace {
+
+size_t readFromFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file.seekSet(offset)) {
+    return 0;
+  }
+  const int count = file.read(out, len);
+  return count > 0 ? count : 0;
+}
+
+size_t writeToFile(void* ctx, const size_t offset, const uint8_t* data, const size_t len) {
+  auto& file = *static_cast<FsFile*>(ctx);
+  if (!file.seekSet(offset)) {
+    return 0;
+  }
+  return file.write(data, len);
+}
+
+}  // namespace
+
+bool ReadingProgress::load(const std::string& cachePath, uint8_t* payload) {
+  path = cachePath + "/progress.bin";
+  bool found = false;
+  FsFile file;
+  if (Storage.openFileForRead("RPJ", path, file)) {
+    found = journal.load(readFromFile, &file, file.fileSize());
+    file.close();
+  } else {
+    journal.load(readFromFile, &file, 0);
+  }
+  memcpy(payload, journal.getPayload(), PAYLOAD_SIZE);
+  return found;
+}
+
+bool ReadingProgress::update(const uint8_t* payload) {
+  if (!journal.update(payload)) {
+    return false;
+  }
+  changedAt = millis();
+  return true;
+}
+
+bool ReadingProgress::flush() {
+  if (!journal.isDirty() || path.empty()) {
+    return true;
+  }
+  // Opened without truncating: the journal rewrites one record in place
+  FsFile file = Storage.open(path.c_str(), O_RDWR | O_CREAT);
+  if (!file) {
+    LOG_ERR("RPJ", "Could not open %s", path.c_str());
+    return false;
+  }
+  const bool written = journal.flush(writeToFile, &file);
+  file.close();
+  if (!written) {
+    LOG_ERR("RPJ", "Could not save progress!");
+    return false;
+  }
+  LOG_DBG("RPJ", "Progress saved");
+  return true;
+}
+
+void ReadingProgress::flushIfIdle() {
+  if (journal.isDirty() && millis() - changedAt >= FLUSH_IDLE_MS && !flush()) {
+    changedAt = millis();  // retry after another idle period rather than on every loop
+  }
+}
+
+void ReadingProgress::restart() { journal.restart(); }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ProgressJournal.h>
+
+#include <string>
+
+/**
+ * Reading position of the open book, journaled to "<cachePath>/progress.bin".
+ *
+ * Page turns only stage the position in RAM. The reader writes it out with flush() on chapter changes and when it
+ * exits (which includes going to sleep), and flushIfIdle() writes it once the position has stopped changing for
+ * FLUSH_IDLE_MS, so a power cut loses at most the pages turned since.
+ */
+class ReadingProgress {
+ public:
+  static constexpr unsigned long FLUSH_IDLE_MS = 10000;
+  static constexpr size_t PAYLOAD_SIZE = ProgressJournal::PAYLOAD_SIZE;
+
+  // Loads the saved position into `payload` (zero-filled if there is none). Returns true if one was found.
+  bool load(const std::string& cachePath, uint8_t* payload);
+
+  // Stages a new position. Returns true if it differs from the staged one.
+  bool update(const uint8_t* payload);
+
+  // Writes the staged position if it hasn't been written yet
+  bool flush();
+
+  // Flushes once the staged position is FLUSH_IDLE_MS old
+  void flushIfIdle();
+
+  // The cache directory was cleared: start a fresh progress.bin on the next flush
+  void restart();
+
+  bool isDirty() const { return journal.isDirty(); }
+
+ private:
+  ProgressJournal journal;
+  std::string path;
+  unsigned long changedAt = 0;
+};
@@ -63,6 +63,8 @@ void TxtReaderActivity::onEnter() {
 void TxtReaderActivity::onExit() {
   Activity::onExit();
 
+  readingProgress.flush();
+
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
@@ -74,6 +76,12 @@ void TxtReaderActivity::onExit() {
 }
 
 void TxtReaderActivity::loop() {
+  // Don't wait out a render for it, the next loop will do
+  if (readingProgress.isDirty() && !RenderLock::peek()) {
+    RenderLock lock(*this);
+    readingProgress.flushIfIdle();
+  }
+
   // Long press BACK (1s+) goes to file selection
   if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= goHomeMs) {
     activityManager.goToFileBrowser(txt ? txt->getPath() : "");
@@ -438,34 +446,24 @@ void TxtReaderActivity::renderStatusBar() const {
   GUI.drawStatusBar(renderer, progress, currentPage + 1, totalPages, title);
 }
 
-void TxtReaderActivity::saveProgress() const {
-  FsFile f;
-  if (Storage.openFileForWrite("TRS", txt->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentPage & 0xFF;
-    data[1] = (currentPage >> 8) & 0xFF;
-    data[2] = 0;
-    data[3] = 0;
-    f.write(data, 4);
-    f.close();
-  }
+void TxtReaderActivity::saveProgress() {
+  uint8_t data[ReadingProgress::PAYLOAD_SIZE] = {};
+  data[0] = currentPage & 0xFF;
+  data[1] = (currentPage >> 8) & 0xFF;
+  readingProgress.update(data);
 }
 
 void TxtReaderActivity::loadProgress() {
-  FsFile f;
-  if (Storage.openFileForRead("TRS", txt->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    if (f.read(data, 4) == 4) {
-      currentPage = data[0] + (data[1] << 8);
-      if (currentPage >= totalPages) {
-        currentPage = totalPages - 1;
-      }
-      if (currentPage < 0) {
-        currentPage = 0;
-      }
-      LOG_DBG("TRS", "Loaded progress: page %d/%d", currentPage, totalPages);
+  uint8_t data[ReadingProgress::PAYLOAD_SIZE];
+  if (readingProgress.load(txt->getCachePath(), data)) {
+    currentPage = data[0] + (data[1] << 8);
+    if (currentPage >= totalPages) {
+      currentPage = totalPages - 1;
     }
-    f.close();
+    if (currentPage < 0) {
+      currentPage = 0;
+    }
+    LOG_DBG("TRS", "Loaded progress: page %d/%d", currentPage, totalPages);
   }
 }
 
@@ -9,6 +9,7 @@
 
 #include <Xtc.h>
 
+#include "ReadingProgress.h"
 #include "activities/Activity.h"
 
 class XtcReaderActivity final : public Activity {
@@ -16,9 +17,10 @@ class XtcReaderActivity final : public Activity {
 
   uint32_t currentPage = 0;
   int pagesUntilFullRefresh = 0;
+  ReadingProgress readingProgress;
 
   void renderPage();
-  void saveProgress() const;
+  void saveProgress();
   void loadProgress();
 
  public:
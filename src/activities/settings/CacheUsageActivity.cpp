@@ -0,0 +1,107 @@
+#include "CacheUsageActivity.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <cstdio>
+
+#include "CrossPointSettings.h"
+#include "MappedInputManager.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+
+std::string formatSize(const uint64_t bytes) {
+  char buffer[16];
+  if (bytes >= 1024ULL * 1024 * 1024) {
+    snprintf(buffer, sizeof(buffer), "%.1f GB", static_cast<double>(bytes) / (1024.0 * 1024 * 1024));
+  } else if (bytes >= 1024ULL * 1024) {
+    snprintf(buffer, sizeof(buffer), "%.1f MB", static_cast<double>(bytes) / (1024.0 * 1024));
+  } else {
+    snprintf(buffer, sizeof(buffer), "%llu KB", static_cast<unsigned long long>((bytes + 1023) / 1024));
+  }
+  return buffer;
+}
+
+std::string displayName(const BookCacheIndex::BookUsage& book) {
+  if (book.bookPath.empty()) {
+    return book.dirName;
+  }
+  const auto lastSlash = book.bookPath.find_last_of('/');
+  return lastSlash == std::string::npos ? book.bookPath : book.bookPath.substr(lastSlash + 1);
+}
+
+}  // namespace
+
+void CacheUsageActivity::onEnter() {
+  Activity::onEnter();
+
+  books = BookCacheIndex::usage("/.crosspoint");
+  totalBytes = 0;
+  for (const auto& book : books) {
+    totalBytes += book.bytes;
+  }
+  selectedIndex = 0;
+  requestUpdate();
+}
+
+void CacheUsageActivity::onExit() {
+  Activity::onExit();
+  books.clear();
+  books.shrink_to_fit();
+}
+
+void CacheUsageActivity::loop() {
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    finish();
+    return;
+  }
+
+  const int itemCount = static_cast<int>(books.size());
+  if (itemCount == 0) {
+    return;
+  }
+  buttonNavigator.onNextRelease([this, itemCount] {
+    selectedIndex = ButtonNavigator::nextIndex(selectedIndex, itemCount);
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousRelease([this, itemCount] {
+    selectedIndex = ButtonNavigator::previousIndex(selectedIndex, itemCount);
+    requestUpdate();
+  });
+}
+
+void CacheUsageActivity::render(RenderLock&&) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  const auto& metrics = UITheme::getInstance().getMetrics();
+
+  // Subtitle: "Total 84.2 MB / 250.0 MB" when a limit is set
+  std::string total = std::string(tr(STR_CACHE_TOTAL)) + " " + formatSize(totalBytes);
+  const uint64_t budget = SETTINGS.getCacheBudgetBytes();
+  if (budget > 0) {
+    total += " / " + formatSize(budget);
+  }
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_CACHE_USAGE),
+                 total.c_str());
+
+  if (books.empty()) {
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, tr(STR_NO_CACHED_BOOKS));
+  } else {
+    const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+    const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+    GUI.drawList(
+        renderer, Rect{0, contentTop, pageWidth, contentHeight}, static_cast<int>(books.size()), selectedIndex,
+        [this](int index) { return displayName(books[index]); }, nullptr, nullptr,
+        [this](int index) { return formatSize(books[index].bytes); });
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), "", tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+
+  renderer.displayBuffer();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <BookCacheIndex.h>
+
+#include <vector>
+
+#include "../Activity.h"
+#include "util/ButtonNavigator.h"
+
+/**
+ * Lists the SD card space taken by each book's cache, most recently read first
+ */
+class CacheUsageActivity final : public Activity {
+ public:
+  explicit CacheUsageActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
+      : Activity("CacheUsage", renderer, mappedInput) {}
+
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+
+ private:
+  ButtonNavigator buttonNavigator;
+  std::vector<BookCacheIndex::BookUsage> books;
+  uint64_t totalBytes = 0;
+  int selectedIndex = 0;
+};
@@ -74,6 +74,21 @@ std::string UITheme::getCoverThumbPath(std::string coverBmpPath, int coverHeight
   return coverBmpPath;
 }
 
+int UITheme::getCoverThumbHeights(int* heights, const int maxCount) {
+  const ThemeMetrics* allMetrics[] = {&BaseMetrics::values, &LyraMetrics::values, &Lyra3CoversMetrics::values};
+  int count = 0;
+  for (const ThemeMetrics* metrics : allMetrics) {
+    bool seen = false;
+    for (int i = 0; i < count; i++) {
+      seen |= heights[i] == metrics->homeCoverHeight;
+    }
+    if (!seen && count < maxCount) {
+      heights[count++] = metrics->homeCoverHeight;
+    }
+  }
+  return count;
+}
+
 UIIcon UITheme::getFileIcon(std::string filename) {
   if (filename.back() == '/') {
     return Folder;
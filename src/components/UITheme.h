@@ -21,6 +21,8 @@ class UITheme {
   static int getNumberOfItemsPerPage(const GfxRenderer& renderer, bool hasHeader, bool hasTabBar, bool hasButtonHints,
                                      bool hasSubtitle);
   static std::string getCoverThumbPath(std::string coverBmpPath, int coverHeight);
+  // Distinct home cover thumbnail heights across all themes, so one cover decode can produce all of them
+  static int getCoverThumbHeights(int* heights, int maxCount);
   static UIIcon getFileIcon(std::string filename);
   static int getStatusBarHeight();
   static int getProgressBarHeight();
@@ -1,11 +1,14 @@
 #include <Arduino.h>
 #include <Epub.h>
+#include <Epub/hyphenation/LanguageRegistry.h>
+#include <Epub/hyphenation/SdHyphenationPatterns.h>
 #include <FontDecompressor.h>
 #include <GfxRenderer.h>
 #include <HalDisplay.h>
 #include <HalGPIO.h>
 #include <HalPowerManager.h>
 #include <HalStorage.h>
+#include <HeapTelemetry.h>
 #include <I18n.h>
 #include <Logging.h>
 #include <SPI.h>
@@ -13,6 +16,7 @@
 
 #include <cstring>
 
+#include "BookPreprocessQueue.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "KOReaderCredentialStore.h"
@@ -252,6 +256,8 @@ void setup() {
   SETTINGS.loadFromFile();
   I18N.loadSettings();
   KOREADER_STORE.loadFromFile();
+  // Languages without built-in patterns can be installed as /.crosspoint/hyphenation/<lang>.bin
+  setHyphenatorLoader(loadSdHyphenator);
   UITheme::getInstance().reload();
   ButtonNavigator::setMappedInputManager(mappedInputManager);
 
@@ -282,6 +288,7 @@ void setup() {
 
   APP_STATE.loadFromFile();
   RECENT_BOOKS.loadFromFile();
+  PREPROCESS_QUEUE.loadFromFile();
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
@@ -328,6 +335,16 @@ void loop() {
         uint8_t* buf = display.getFrameBuffer();
         logSerial.write(buf, HalDisplay::BUFFER_SIZE);
         logSerial.printf("SCREENSHOT_END\n");
+      } else if (cmd == "HEAP") {
+        if (HeapTelemetry::ENABLED) {
+          char report[1024];
+          HeapTelemetry::formatReport(report, sizeof(report));
+          logSerial.print(report);
+        } else {
+          logSerial.printf("Heap telemetry is not built in, use the heap_telemetry environment\n");
+        }
+      } else if (cmd == "HEAP_RESET") {
+        HeapTelemetry::reset();
       }
     }
   }
@@ -383,6 +400,16 @@ void loop() {
     }
   }
 
+  // While charging and idle outside the reader, keep preparing books received over a file transfer
+  if (gpio.isUsbConnected() && !PREPROCESS_QUEUE.isEmpty() && !activityManager.isReaderActivity() &&
+      millis() - lastActivityTime >= HalPowerManager::IDLE_POWER_SAVING_MS) {
+    RenderLock lock;
+    PREPROCESS_QUEUE.processNext(renderer);
+  } else if (activityManager.isReaderActivity()) {
+    // The reader needs the memory of a book kept loaded between steps
+    PREPROCESS_QUEUE.releaseBook();
+  }
+
   // Add delay at the end of the loop to prevent tight spinning
   // When an activity requests skip loop delay (e.g., webserver running), use yield() for faster response
   // Otherwise, use longer delay to save power
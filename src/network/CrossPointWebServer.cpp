@@ -1,21 +1,25 @@
 #include "CrossPointWebServer.h"
 
 #include <ArduinoJson.h>
-#include <Epub.h>
+#include <BookCacheIndex.h>
+#include <BookCacheKey.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
+#include <HeapTelemetry.h>
 #include <Logging.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 
 #include <algorithm>
 
+#include "BookPreprocessQueue.h"
 #include "CrossPointSettings.h"
 #include "SettingsList.h"
 #include "WebDAVHandler.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 #include "html/SettingsPageHtml.generated.h"
+#include "util/SleepScreenCache.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -41,13 +45,14 @@ String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
 
-// Helper function to clear epub cache after upload
+// Helper function to clear epub cache and sleep snapshots after upload
 void clearEpubCacheIfNeeded(const String& filePath) {
   // Only clear cache for .epub files
   if (StringUtils::checkFileExtension(filePath, ".epub")) {
-    Epub(filePath.c_str(), "/.crosspoint").clearCache();
+    BookCacheKey::discard(filePath.c_str(), "/.crosspoint", "epub_");
     LOG_DBG("WEB", "Cleared epub cache for: %s", filePath.c_str());
   }
+  SleepScreenCache::invalidate(filePath.c_str());
 }
 
 String normalizeWebPath(const String& inputPath) {
@@ -134,6 +139,8 @@ void CrossPointWebServer::begin() {
   server->on("/files", HTTP_GET, [this] { handleFileList(); });
 
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
+  server->on("/api/cache", HTTP_GET, [this] { handleCacheUsage(); });
+  server->on("/api/heap", HTTP_GET, [this] { handleHeapTelemetry(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
 
@@ -258,6 +265,7 @@ void CrossPointWebServer::handleClient() {
     lastDebugPrint = millis();
   }
 
+  HeapTelemetry::Scope heapScope(HeapTelemetry::NETWORK);
   server->handleClient();
 
   // Handle WebSocket events
@@ -300,6 +308,8 @@ CrossPointWebServer::WsUploadStatus CrossPointWebServer::getWsUploadStatus() con
   return status;
 }
 
+bool CrossPointWebServer::isUploadInProgress() const { return wsUploadInProgress || upload.file.isOpen(); }
+
 static void sendHtmlContent(WebServer* server, const char* data, size_t len) {
   server->sendHeader("Content-Encoding", "gzip");
   server->send_P(200, "text/html", data, len);
@@ -333,6 +343,80 @@ void CrossPointWebServer::handleStatus() const {
   server->send(200, "application/json", json);
 }
 
+void CrossPointWebServer::handleHeapTelemetry() const {
+  JsonDocument doc;
+  doc["enabled"] = HeapTelemetry::ENABLED;
+  doc["freeHeap"] = ESP.getFreeHeap();
+  doc["minFreeHeap"] = ESP.getMinFreeHeap();
+  doc["maxAllocHeap"] = ESP.getMaxAllocHeap();
+  doc["liveBytes"] = HeapTelemetry::liveBytes();
+  JsonArray tags = doc["tags"].to<JsonArray>();
+  for (int tag = 0; tag < HeapTelemetry::TAG_COUNT && HeapTelemetry::ENABLED; tag++) {
+    const auto stats = HeapTelemetry::stats(static_cast<HeapTelemetry::Tag>(tag));
+    JsonObject entry = tags.add<JsonObject>();
+    entry["tag"] = HeapTelemetry::tagName(static_cast<HeapTelemetry::Tag>(tag));
+    entry["allocations"] = stats.allocations;
+    entry["frees"] = stats.frees;
+    entry["failedAllocations"] = stats.failedAllocations;
+    entry["bytesRequested"] = stats.bytesRequested;
+    entry["largestAllocation"] = stats.largestAllocation;
+    entry["peakBytes"] = stats.peakBytes;
+    entry["minFreeHeap"] = stats.minFreeHeap;
+    entry["minLargestFreeBlock"] = stats.minLargestFreeBlock;
+    JsonArray sizeClasses = entry["sizeClasses"].to<JsonArray>();
+    for (const uint32_t count : stats.sizeClasses) {
+      sizeClasses.add(count);
+    }
+  }
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handleCacheUsage() const {
+  const auto books = BookCacheIndex::usage("/.crosspoint");
+  uint64_t used = 0;
+  for (const auto& book : books) {
+    used += book.bytes;
+  }
+
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "application/json", "");
+
+  char output[512];
+  snprintf(output, sizeof(output), "{\"budget\":%llu,\"used\":%llu,\"books\":[",
+           static_cast<unsigned long long>(SETTINGS.getCacheBudgetBytes()), static_cast<unsigned long long>(used));
+  server->sendContent(output);
+
+  bool seenFirst = false;
+  JsonDocument doc;
+  for (const auto& book : books) {
+    doc.clear();
+    doc["dir"] = book.dirName;
+    doc["path"] = book.bookPath;
+    doc["bytes"] = book.bytes;
+    doc["lastAccess"] = book.lastAccess;
+
+    const size_t written = serializeJson(doc, output, sizeof(output));
+    if (written >= sizeof(output)) {
+      LOG_DBG("WEB", "Skipping oversized cache entry JSON for: %s", book.dirName.c_str());
+      continue;
+    }
+
+    if (seenFirst) {
+      server->sendContent(",");
+    } else {
+      seenFirst = true;
+    }
+    server->sendContent(output);
+  }
+
+  server->sendContent("]}");
+  server->sendContent("");
+  LOG_DBG("WEB", "Served cache usage for %u books", static_cast<unsigned>(books.size()));
+}
+
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
   FsFile root = Storage.open(path);
   if (!root) {
@@ -669,6 +753,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
         clearEpubCacheIfNeeded(filePath);
+        PREPROCESS_QUEUE.enqueue(filePath.c_str());
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -814,11 +899,14 @@ void CrossPointWebServer::handleRename() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    // Caches are keyed by content, so the book keeps its cache under the new name
+    BookCacheKey::rename(itemPath.c_str(), newPath.c_str(), "/.crosspoint");
+    SleepScreenCache::invalidate(itemPath.c_str());
+    SleepScreenCache::invalidate(newPath.c_str());
     LOG_DBG("WEB", "Renamed file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Renamed successfully");
   } else {
@@ -907,11 +995,14 @@ void CrossPointWebServer::handleMove() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    // Caches are keyed by content, so the book keeps its cache under the new name
+    BookCacheKey::rename(itemPath.c_str(), newPath.c_str(), "/.crosspoint");
+    SleepScreenCache::invalidate(itemPath.c_str());
+    SleepScreenCache::invalidate(newPath.c_str());
     LOG_DBG("WEB", "Moved file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Moved successfully");
   } else {
@@ -1328,6 +1419,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         clearEpubCacheIfNeeded(filePath);
+        PREPROCESS_QUEUE.enqueue(filePath.c_str());
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
@@ -65,6 +65,9 @@ class CrossPointWebServer {
 
   WsUploadStatus getWsUploadStatus() const;
 
+  // True while a file is being received over HTTP or WebSocket
+  bool isUploadInProgress() const;
+
   // Get the port number
   uint16_t getPort() const { return port; }
 
@@ -91,6 +94,8 @@ class CrossPointWebServer {
   void handleRoot() const;
   void handleNotFound() const;
   void handleStatus() const;
+  void handleCacheUsage() const;
+  void handleHeapTelemetry() const;
   void handleFileList() const;
   void handleFileListData() const;
   void handleDownload() const;
@@ -1,6 +1,7 @@
 #include "HttpDownloader.h"
 
 #include <HTTPClient.h>
+#include <HeapTelemetry.h>
 #include <Logging.h>
 #include <NetworkClient.h>
 #include <NetworkClientSecure.h>
@@ -53,6 +54,7 @@ class FileWriteStream final : public Stream {
 }  // namespace
 
 bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent) {
+  HeapTelemetry::Scope heapScope(HeapTelemetry::NETWORK);
   // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
   std::unique_ptr<NetworkClient> client;
   if (UrlUtils::isHttpsUrl(url)) {
@@ -93,6 +95,7 @@ bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent) {
 }
 
 bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
+  HeapTelemetry::Scope heapScope(HeapTelemetry::NETWORK);
   StreamString stream;
   if (!fetchUrl(url, stream)) {
     return false;
@@ -103,6 +106,7 @@ bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
 
 HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
                                                              ProgressCallback progress) {
+  HeapTelemetry::Scope heapScope(HeapTelemetry::NETWORK);
   // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
   std::unique_ptr<NetworkClient> client;
   if (UrlUtils::isHttpsUrl(url)) {
@@ -1,11 +1,13 @@
 #include "WebDAVHandler.h"
 
-#include <Epub.h>
+#include <BookCacheKey.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <esp_task_wdt.h>
 
+#include "BookPreprocessQueue.h"
+#include "util/SleepScreenCache.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -388,6 +390,7 @@ void WebDAVHandler::handlePut(WebServer& s) {
   }
 
   clearEpubCacheIfNeeded(path);
+  PREPROCESS_QUEUE.enqueue(path.c_str());
   s.send(_putExisted ? 204 : 201);
   LOG_DBG("DAV", "PUT complete: %s", path.c_str());
 }
@@ -545,11 +548,14 @@ void WebDAVHandler::handleMove(WebServer& s) {
     return;
   }
 
-  clearEpubCacheIfNeeded(srcPath);
   bool success = file.rename(dstPath.c_str());
   file.close();
 
   if (success) {
+    // Caches are keyed by content, so the book keeps its cache at the destination
+    BookCacheKey::rename(srcPath.c_str(), dstPath.c_str(), "/.crosspoint");
+    SleepScreenCache::invalidate(srcPath.c_str());
+    SleepScreenCache::invalidate(dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     s.send(500, "text/plain", "Move failed");
@@ -644,6 +650,7 @@ void WebDAVHandler::handleCopy(WebServer& s) {
   dstFile.close();
 
   if (copyOk) {
+    SleepScreenCache::invalidate(dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     Storage.remove(dstPath.c_str());
@@ -802,9 +809,10 @@ bool WebDAVHandler::getOverwrite(WebServer& s) const {
 
 void WebDAVHandler::clearEpubCacheIfNeeded(const String& path) const {
   if (StringUtils::checkFileExtension(path, ".epub")) {
-    Epub(path.c_str(), "/.crosspoint").clearCache();
+    BookCacheKey::discard(path.c_str(), "/.crosspoint", "epub_");
     LOG_DBG("DAV", "Cleared epub cache for: %s", path.c_str());
   }
+  SleepScreenCache::invalidate(path.c_str());
 }
 
 String WebDAVHandler::getMimeType(const String& path) const {
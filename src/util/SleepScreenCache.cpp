@@ -0,0 +1,290 @@
+#include "SleepScreenCache.h"
+
+#include <Bitmap.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <functional>
+
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr char CACHE_DIR[] = "/.crosspoint/sleep";
+constexpr char MANIFEST_PATH[] = "/.crosspoint/sleep/manifest.bin";
+constexpr uint8_t SNAPSHOT_VERSION = 2;
+constexpr uint8_t MANIFEST_VERSION = 1;
+constexpr uint8_t INCOMPLETE_VERSION = 0;  // header version while a snapshot is still being written
+
+// Everything besides the source image that changes what renderBitmapSleepScreen draws
+uint16_t settingsSignature(const GfxRenderer& renderer) {
+  return static_cast<uint16_t>(SETTINGS.sleepScreenCoverMode | (SETTINGS.sleepScreenCoverFilter << 4) |
+                               (static_cast<uint8_t>(renderer.getOrientation()) << 8));
+}
+
+bool isSleepDir(const std::string& path) { return path == "/sleep" || path == "/.sleep"; }
+
+std::string snapshotPath(const std::string& sourcePath) {
+  return std::string(CACHE_DIR) + "/" + std::to_string(std::hash<std::string>{}(sourcePath)) + ".fb";
+}
+
+// FNV-1a, used to fingerprint the directory listing and source images
+uint32_t fnv1a(uint32_t hash, const void* data, const size_t len) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Bytes hashed at each end of the source image: the BMP header and palette with the first rows, and the last rows
+constexpr uint32_t SOURCE_SAMPLE_BYTES = 4096;
+
+struct SourceSignature {
+  uint32_t size = 0;  // 0 = source missing
+  uint32_t hash = 0;
+};
+
+// Fixed-dimension BMPs all have the same file size, so a replaced image is told apart by its content. File times
+// can't be used: the device has no clock, so images written on it all carry the same timestamp.
+SourceSignature sourceSignature(const std::string& sourcePath) {
+  SourceSignature signature;
+  FsFile file = Storage.open(sourcePath.c_str());
+  if (!file) {
+    return signature;
+  }
+  signature.size = file.fileSize();
+  uint32_t hash = fnv1a(2166136261u, &signature.size, sizeof(signature.size));
+  uint8_t buffer[512];
+  const uint32_t tailStart = signature.size > SOURCE_SAMPLE_BYTES ? signature.size - SOURCE_SAMPLE_BYTES : 0;
+  for (const uint32_t start : {uint32_t{0}, tailStart}) {
+    if (!file.seekSet(start)) {
+      break;
+    }
+    for (uint32_t done = 0; done < SOURCE_SAMPLE_BYTES;) {
+      const int bytesRead = file.read(buffer, sizeof(buffer));
+      if (bytesRead <= 0) {
+        break;
+      }
+      hash = fnv1a(hash, buffer, bytesRead);
+      done += bytesRead;
+    }
+  }
+  file.close();
+  signature.hash = hash;
+  return signature;
+}
+}  // namespace
+
+std::vector<std::string> SleepScreenCache::listSleepImages(FsFile& dir, const char* dirPath) {
+  std::vector<std::string> candidates;
+  uint32_t listingHash = fnv1a(2166136261u, dirPath, strlen(dirPath));
+  char name[500];
+
+  // Cheap pass: names and sizes come from the directory entries, no file data is read
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.close();
+      continue;
+    }
+    file.getName(name, sizeof(name));
+    auto filename = std::string(name);
+    if (filename[0] == '.') {
+      file.close();
+      continue;
+    }
+
+    if (filename.length() < 4 || filename.substr(filename.length() - 4) != ".bmp") {
+      LOG_DBG("SLP", "Skipping non-.bmp file name: %s", name);
+      file.close();
+      continue;
+    }
+    const uint32_t size = file.fileSize();
+    listingHash = fnv1a(listingHash, filename.data(), filename.size() + 1);
+    listingHash = fnv1a(listingHash, &size, sizeof(size));
+    candidates.emplace_back(std::move(filename));
+    file.close();
+  }
+
+  FsFile manifest;
+  if (Storage.exists(MANIFEST_PATH) && Storage.openFileForRead("SLP", MANIFEST_PATH, manifest)) {
+    uint8_t version = 0;
+    uint32_t storedHash = 0;
+    uint32_t count = 0;
+    serialization::readPod(manifest, version);
+    serialization::readPod(manifest, storedHash);
+    serialization::readPod(manifest, count);
+    if (version == MANIFEST_VERSION && storedHash == listingHash && count <= candidates.size()) {
+      std::vector<std::string> files(count);
+      for (auto& file : files) {
+        serialization::readString(manifest, file);
+      }
+      manifest.close();
+      LOG_DBG("SLP", "Sleep image manifest up to date (%u images)", count);
+      return files;
+    }
+    manifest.close();
+  }
+
+  // Listing changed: validate every BMP header once and remember the result
+  std::vector<std::string> files;
+  files.reserve(candidates.size());
+  for (auto& filename : candidates) {
+    FsFile file;
+    if (!Storage.openFileForRead("SLP", std::string(dirPath) + "/" + filename, file)) {
+      continue;
+    }
+    Bitmap bitmap(file);
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      LOG_DBG("SLP", "Skipping invalid BMP file: %s", filename.c_str());
+      file.close();
+      continue;
+    }
+    file.close();
+    files.emplace_back(std::move(filename));
+  }
+
+  Storage.mkdir(CACHE_DIR);
+  if (Storage.openFileForWrite("SLP", MANIFEST_PATH, manifest)) {
+    serialization::writePod(manifest, MANIFEST_VERSION);
+    serialization::writePod(manifest, listingHash);
+    serialization::writePod(manifest, static_cast<uint32_t>(files.size()));
+    for (const auto& file : files) {
+      serialization::writeString(manifest, file);
+    }
+    manifest.close();
+  }
+  return files;
+}
+
+bool SleepScreenCache::render(GfxRenderer& renderer, const std::string& sourcePath) {
+  const std::string path = snapshotPath(sourcePath);
+  if (!Storage.exists(path.c_str())) {
+    return false;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("SLP", path, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  uint8_t planeCount = 0;
+  uint16_t settings = 0;
+  uint32_t sourceSize = 0;
+  uint32_t sourceHash = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, planeCount);
+  serialization::readPod(file, settings);
+  serialization::readPod(file, sourceSize);
+  serialization::readPod(file, sourceHash);
+
+  const size_t expectedSize = file.position() + planeCount * GfxRenderer::getBufferSize();
+  bool valid = version == SNAPSHOT_VERSION && (planeCount == 1 || planeCount == 3) &&
+               settings == settingsSignature(renderer) && file.fileSize() == expectedSize;
+  if (valid) {
+    const SourceSignature source = sourceSignature(sourcePath);
+    valid = sourceSize == source.size && sourceHash == source.hash;
+  }
+  if (!valid) {
+    LOG_DBG("SLP", "Stale sleep snapshot for %s", sourcePath.c_str());
+    file.close();
+    Storage.remove(path.c_str());
+    return false;
+  }
+
+  LOG_DBG("SLP", "Rendering sleep snapshot for %s", sourcePath.c_str());
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  if (file.read(frameBuffer, bufferSize) != static_cast<int>(bufferSize)) {
+    LOG_ERR("SLP", "Failed to read sleep snapshot");
+    file.close();
+    return false;
+  }
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+
+  if (planeCount == 3) {
+    // The gray planes go straight to the controller, exactly like the LSB/MSB passes of a normal render
+    if (file.read(frameBuffer, bufferSize) == static_cast<int>(bufferSize)) {
+      renderer.copyGrayscaleLsbBuffers();
+      if (file.read(frameBuffer, bufferSize) == static_cast<int>(bufferSize)) {
+        renderer.copyGrayscaleMsbBuffers();
+        renderer.displayGrayBuffer();
+      }
+    }
+  }
+  file.close();
+  return true;
+}
+
+void SleepScreenCache::invalidate(const std::string& path) {
+  if (isSleepDir(path)) {
+    // A folder moved into place of the sleep folder brings other images under the same paths
+    Storage.removeDir(CACHE_DIR);
+    LOG_DBG("SLP", "Dropped sleep snapshots for %s", path.c_str());
+    return;
+  }
+  if (path.size() < 4 || path.compare(path.size() - 4, 4, ".bmp") != 0) {
+    return;
+  }
+  const std::string snapshot = snapshotPath(path);
+  if (Storage.exists(snapshot.c_str())) {
+    Storage.remove(snapshot.c_str());
+    LOG_DBG("SLP", "Dropped sleep snapshot for %s", path.c_str());
+  }
+  // A replacement with the same name and size keeps the listing hash, but its header still has to be checked
+  if (isSleepDir(path.substr(0, path.rfind('/'))) && Storage.exists(MANIFEST_PATH)) {
+    Storage.remove(MANIFEST_PATH);
+  }
+}
+
+SleepScreenCache::Writer::Writer(const GfxRenderer& renderer, const std::string& sourcePath,
+                                 const uint8_t planeCount)
+    : path(snapshotPath(sourcePath)), planeCount(planeCount) {
+  const SourceSignature source = sourceSignature(sourcePath);
+  if (source.size == 0) {
+    return;
+  }
+  Storage.mkdir(CACHE_DIR);
+  if (!Storage.openFileForWrite("SLP", path, file)) {
+    return;
+  }
+  serialization::writePod(file, INCOMPLETE_VERSION);
+  serialization::writePod(file, planeCount);
+  serialization::writePod(file, settingsSignature(renderer));
+  serialization::writePod(file, source.size);
+  serialization::writePod(file, source.hash);
+  ok = true;
+}
+
+SleepScreenCache::Writer::~Writer() {
+  if (file) {
+    finish();
+  }
+}
+
+void SleepScreenCache::Writer::addPlane(const GfxRenderer& renderer) {
+  if (!ok) {
+    return;
+  }
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  ok = file.write(renderer.getFrameBuffer(), bufferSize) == bufferSize;
+  planesWritten++;
+}
+
+void SleepScreenCache::Writer::finish() {
+  if (!file) {
+    return;
+  }
+  if (ok && planesWritten == planeCount) {
+    // Only flag the header valid once every plane is on the card
+    file.seek(0);
+    serialization::writePod(file, SNAPSHOT_VERSION);
+    file.close();
+    LOG_DBG("SLP", "Stored sleep snapshot %s", path.c_str());
+    return;
+  }
+  file.close();
+  Storage.remove(path.c_str());
+}
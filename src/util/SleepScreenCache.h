@@ -0,0 +1,49 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <string>
+#include <vector>
+
+class GfxRenderer;
+
+// Panel-native framebuffer snapshots of rendered sleep screens, so going to sleep is a straight file-to-framebuffer
+// copy instead of a BMP decode with scaling and dithering. A snapshot is captured the first time an image is rendered
+// and reused while the source file (its size and a hash of its first and last 4KB) and the sleep screen settings stay
+// the same. Those checks only sample the image, so the web server, WebDAV and the file browser also invalidate() the
+// paths they write, move or delete.
+class SleepScreenCache {
+ public:
+  // Valid sleep BMP names in `dir` (opened on `dirPath`). The BMP headers are only parsed again when the directory
+  // listing (names and sizes) no longer matches the stored manifest.
+  static std::vector<std::string> listSleepImages(FsFile& dir, const char* dirPath);
+
+  // Draws the stored snapshot of `sourcePath` and refreshes the panel. Returns false if there is no valid snapshot.
+  static bool render(GfxRenderer& renderer, const std::string& sourcePath);
+
+  // Drops what a change at `path` may have made stale: the snapshot and folder manifest for a BMP, every snapshot for
+  // a sleep image folder. Other paths are ignored.
+  static void invalidate(const std::string& path);
+
+  // Captures the framebuffer planes of a sleep screen while it is being rendered the slow way.
+  class Writer {
+   public:
+    // planeCount is 1 (BW only) or 3 (BW, grayscale LSB, grayscale MSB)
+    Writer(const GfxRenderer& renderer, const std::string& sourcePath, uint8_t planeCount);
+    ~Writer();
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    // Appends the current framebuffer as the next plane
+    void addPlane(const GfxRenderer& renderer);
+    // Marks the snapshot complete once every plane was written, otherwise discards it
+    void finish();
+
+   private:
+    FsFile file;
+    std::string path;
+    uint8_t planeCount;
+    uint8_t planesWritten = 0;
+    bool ok = false;
+  };
+};
@@ -0,0 +1,341 @@
+// Host equivalence check for BitmapRowBlitter. Random 2-bit bitmap rows, as Bitmap::readNextRow produces them, are
+// drawn by the per-pixel loops GfxRenderer::drawBitmap and drawBitmap1Bit used before the blitter (drawPixel with its
+// rotation and bounds check) and by the row loops they use now, in every orientation and render mode and with crop,
+// scale, offsets and both row orders. The two framebuffers must match byte for byte. Also reports the time each takes
+// for a full-screen image.
+
+#include <BitmapRowBlitter.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int PANEL_WIDTH = 800;
+constexpr int PANEL_HEIGHT = 480;
+constexpr int WIDTH_BYTES = PANEL_WIDTH / 8;
+constexpr int BUFFER_SIZE = WIDTH_BYTES * PANEL_HEIGHT;
+
+// GfxRenderer's orientations, in the same order
+enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
+enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+const char* const ORIENTATION_NAMES[] = {"portrait", "landscape CW", "portrait inverted", "landscape CCW"};
+
+BitmapRowBlitter::RowAxis rowAxis(const Orientation orientation) {
+  switch (orientation) {
+    case Portrait:
+      return BitmapRowBlitter::RowAxis::PANEL_COLUMN;
+    case PortraitInverted:
+      return BitmapRowBlitter::RowAxis::PANEL_COLUMN_MIRRORED;
+    case LandscapeClockwise:
+      return BitmapRowBlitter::RowAxis::PANEL_ROW_MIRRORED;
+    case LandscapeCounterClockwise:
+      break;
+  }
+  return BitmapRowBlitter::RowAxis::PANEL_ROW;
+}
+
+struct Image {
+  int width;
+  int height;
+  bool topDown;
+  bool oneBit;
+  std::vector<std::vector<uint8_t>> rows;  // readNextRow() output, 2 bits per pixel, in file order
+};
+
+struct Draw {
+  Orientation orientation;
+  RenderMode renderMode;
+  int x;
+  int y;
+  int maxWidth;
+  int maxHeight;
+  float cropX;
+  float cropY;
+};
+
+int screenWidth(const Orientation orientation) {
+  return orientation == Portrait || orientation == PortraitInverted ? PANEL_HEIGHT : PANEL_WIDTH;
+}
+int screenHeight(const Orientation orientation) {
+  return orientation == Portrait || orientation == PortraitInverted ? PANEL_WIDTH : PANEL_HEIGHT;
+}
+
+// GfxRenderer::drawPixel before the blitter
+void drawPixel(std::vector<uint8_t>& frame, const Orientation orientation, const int x, const int y,
+               const bool state) {
+  int phyX = 0;
+  int phyY = 0;
+  switch (orientation) {
+    case Portrait:
+      phyX = y;
+      phyY = PANEL_HEIGHT - 1 - x;
+      break;
+    case LandscapeClockwise:
+      phyX = PANEL_WIDTH - 1 - x;
+      phyY = PANEL_HEIGHT - 1 - y;
+      break;
+    case PortraitInverted:
+      phyX = PANEL_WIDTH - 1 - y;
+      phyY = x;
+      break;
+    case LandscapeCounterClockwise:
+      phyX = x;
+      phyY = y;
+      break;
+  }
+  if (phyX < 0 || phyX >= PANEL_WIDTH || phyY < 0 || phyY >= PANEL_HEIGHT) {
+    return;
+  }
+  uint8_t& byte = frame[phyY * WIDTH_BYTES + phyX / 8];
+  const uint8_t bit = 1 << (7 - phyX % 8);
+  byte = state ? byte & ~bit : byte | bit;
+}
+
+void scaleFor(const Image& image, const Draw& draw, const float cropX, const float cropY, float& scale,
+              bool& isScaled) {
+  scale = 1.0f;
+  isScaled = false;
+  if (draw.maxWidth > 0 && (1.0f - cropX) * image.width > draw.maxWidth) {
+    scale = static_cast<float>(draw.maxWidth) / static_cast<float>((1.0f - cropX) * image.width);
+    isScaled = true;
+  }
+  if (draw.maxHeight > 0 && (1.0f - cropY) * image.height > draw.maxHeight) {
+    scale = std::min(scale, static_cast<float>(draw.maxHeight) / static_cast<float>((1.0f - cropY) * image.height));
+    isScaled = true;
+  }
+}
+
+// The per-pixel drawBitmap / drawBitmap1Bit loops before the blitter
+void drawPerPixel(std::vector<uint8_t>& frame, const Image& image, const Draw& draw) {
+  const int sw = screenWidth(draw.orientation);
+  const int sh = screenHeight(draw.orientation);
+  float scale;
+  bool isScaled;
+  if (image.oneBit) {
+    scaleFor(image, draw, 0.0f, 0.0f, scale, isScaled);
+    for (int bmpY = 0; bmpY < image.height; bmpY++) {
+      const uint8_t* outputRow = image.rows[bmpY].data();
+      const int bmpYOffset = image.topDown ? bmpY : image.height - 1 - bmpY;
+      const int screenY = draw.y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
+      if (screenY >= sh || screenY < 0) {
+        continue;
+      }
+      for (int bmpX = 0; bmpX < image.width; bmpX++) {
+        const int screenX = draw.x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
+        if (screenX >= sw) {
+          break;
+        }
+        if (screenX < 0) {
+          continue;
+        }
+        const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+        if (val < 3) {
+          drawPixel(frame, draw.orientation, screenX, screenY, true);
+        }
+      }
+    }
+    return;
+  }
+
+  const int cropPixX = std::floor(image.width * draw.cropX / 2.0f);
+  const int cropPixY = std::floor(image.height * draw.cropY / 2.0f);
+  scaleFor(image, draw, draw.cropX, draw.cropY, scale, isScaled);
+  for (int bmpY = 0; bmpY < image.height - cropPixY; bmpY++) {
+    int screenY = -cropPixY + (image.topDown ? bmpY : image.height - 1 - bmpY);
+    if (isScaled) {
+      screenY = std::floor(screenY * scale);
+    }
+    screenY += draw.y;
+    if (screenY >= sh) {
+      break;
+    }
+    if (screenY < 0 || bmpY < cropPixY) {
+      continue;
+    }
+    const uint8_t* outputRow = image.rows[bmpY].data();
+    for (int bmpX = cropPixX; bmpX < image.width - cropPixX; bmpX++) {
+      int screenX = bmpX - cropPixX;
+      if (isScaled) {
+        screenX = std::floor(screenX * scale);
+      }
+      screenX += draw.x;
+      if (screenX >= sw) {
+        break;
+      }
+      if (screenX < 0) {
+        continue;
+      }
+      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if (draw.renderMode == BW && val < 3) {
+        drawPixel(frame, draw.orientation, screenX, screenY, true);
+      } else if (draw.renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
+        drawPixel(frame, draw.orientation, screenX, screenY, false);
+      } else if (draw.renderMode == GRAYSCALE_LSB && val == 1) {
+        drawPixel(frame, draw.orientation, screenX, screenY, false);
+      }
+    }
+  }
+}
+
+// The row loops of drawBitmap / drawBitmap1Bit as they are now
+bool drawBlitted(std::vector<uint8_t>& frame, const Image& image, const Draw& draw) {
+  const int sw = screenWidth(draw.orientation);
+  const int sh = screenHeight(draw.orientation);
+  float scale;
+  bool isScaled;
+  if (image.oneBit) {
+    scaleFor(image, draw, 0.0f, 0.0f, scale, isScaled);
+    BitmapRowBlitter blitter(frame.data(), WIDTH_BYTES, PANEL_HEIGHT, rowAxis(draw.orientation), true);
+    if (!blitter.begin(image.width, 0, isScaled, scale, draw.x, sw)) {
+      return false;
+    }
+    for (int bmpY = 0; bmpY < image.height; bmpY++) {
+      const int bmpYOffset = image.topDown ? bmpY : image.height - 1 - bmpY;
+      const int screenY = draw.y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
+      if (screenY >= sh || screenY < 0) {
+        continue;
+      }
+      blitter.addRow(screenY, image.rows[bmpY].data(), 0b0111);
+    }
+    blitter.flush();
+    return true;
+  }
+
+  const int cropPixX = std::floor(image.width * draw.cropX / 2.0f);
+  const int cropPixY = std::floor(image.height * draw.cropY / 2.0f);
+  scaleFor(image, draw, draw.cropX, draw.cropY, scale, isScaled);
+  const uint8_t drawValues = draw.renderMode == GRAYSCALE_MSB ? 0b0110 : draw.renderMode == GRAYSCALE_LSB ? 0b0010
+                                                                                                          : 0b0111;
+  BitmapRowBlitter blitter(frame.data(), WIDTH_BYTES, PANEL_HEIGHT, rowAxis(draw.orientation), draw.renderMode == BW);
+  if (!blitter.begin(image.width, cropPixX, isScaled, scale, draw.x, sw)) {
+    return false;
+  }
+  for (int bmpY = 0; bmpY < image.height - cropPixY; bmpY++) {
+    int screenY = -cropPixY + (image.topDown ? bmpY : image.height - 1 - bmpY);
+    if (isScaled) {
+      screenY = std::floor(screenY * scale);
+    }
+    screenY += draw.y;
+    if (screenY >= sh) {
+      break;
+    }
+    if (screenY < 0 || bmpY < cropPixY) {
+      continue;
+    }
+    blitter.addRow(screenY, image.rows[bmpY].data(), drawValues);
+  }
+  blitter.flush();
+  return true;
+}
+
+Image randomImage(std::mt19937& random, const bool oneBit) {
+  Image image;
+  image.width = 1 + random() % (random() % 4 == 0 ? 1000 : 120);
+  image.height = 1 + random() % (random() % 4 == 0 ? 1000 : 120);
+  image.topDown = random() % 2;
+  image.oneBit = oneBit;
+  image.rows.resize(image.height, std::vector<uint8_t>((image.width + 3) / 4));
+  for (auto& row : image.rows) {
+    for (auto& byte : row) {
+      byte = static_cast<uint8_t>(random());
+      if (oneBit) {
+        // readNextRow gives 1-bit images only black (0) or white (3)
+        for (int shift = 0; shift < 8; shift += 2) {
+          byte = (byte >> shift & 1) ? byte | 3 << shift : byte & ~(3 << shift);
+        }
+      }
+    }
+  }
+  return image;
+}
+
+Draw randomDraw(std::mt19937& random, const bool oneBit) {
+  Draw draw;
+  draw.orientation = static_cast<Orientation>(random() % 4);
+  draw.renderMode = oneBit ? BW : static_cast<RenderMode>(random() % 3);
+  draw.x = static_cast<int>(random() % 900) - 100;
+  draw.y = static_cast<int>(random() % 900) - 100;
+  draw.maxWidth = random() % 2 ? 1 + random() % 600 : 0;
+  draw.maxHeight = random() % 2 ? 1 + random() % 600 : 0;
+  draw.cropX = oneBit || random() % 2 ? 0.0f : (random() % 60) / 100.0f;
+  draw.cropY = oneBit || random() % 2 ? 0.0f : (random() % 60) / 100.0f;
+  return draw;
+}
+
+template <typename F>
+double millisecondsFor(const int repeats, F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeats; i++) {
+    f();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count() / repeats;
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 random(30);
+  int failures = 0;
+  int cases = 0;
+  int perOrientation[4] = {};
+  for (int i = 0; i < 4000; i++) {
+    const bool oneBit = i % 5 == 0;
+    const Image image = randomImage(random, oneBit);
+    const Draw draw = randomDraw(random, oneBit);
+    // Start from a random background so both set and cleared bits are checked
+    std::vector<uint8_t> expected(BUFFER_SIZE);
+    for (auto& byte : expected) {
+      byte = static_cast<uint8_t>(random());
+    }
+    std::vector<uint8_t> actual = expected;
+    drawPerPixel(expected, image, draw);
+    if (!drawBlitted(actual, image, draw) || actual != expected) {
+      if (failures < 10) {
+        std::cerr << "FAIL: case " << i << ": " << image.width << "x" << image.height << (oneBit ? " 1-bit" : "")
+                  << " " << ORIENTATION_NAMES[draw.orientation] << " mode " << draw.renderMode << " at " << draw.x
+                  << "," << draw.y << " max " << draw.maxWidth << "x" << draw.maxHeight << " crop " << draw.cropX
+                  << "," << draw.cropY << "\n";
+      }
+      failures++;
+    }
+    cases++;
+    perOrientation[draw.orientation]++;
+  }
+  printf("%d bitmaps: %d portrait, %d landscape CW, %d portrait inverted, %d landscape CCW\n", cases,
+         perOrientation[Portrait], perOrientation[LandscapeClockwise], perOrientation[PortraitInverted],
+         perOrientation[LandscapeCounterClockwise]);
+
+  // A full-screen 2-bit sleep image in each orientation
+  std::vector<uint8_t> frame(BUFFER_SIZE, 0xFF);
+  for (const Orientation orientation : {Portrait, LandscapeCounterClockwise}) {
+    Image image = randomImage(random, false);
+    image.width = screenWidth(orientation);
+    image.height = screenHeight(orientation);
+    image.rows.assign(image.height, std::vector<uint8_t>((image.width + 3) / 4));
+    for (auto& row : image.rows) {
+      for (auto& byte : row) {
+        byte = static_cast<uint8_t>(random());
+      }
+    }
+    const Draw draw{orientation, BW, 0, 0, 0, 0, 0.0f, 0.0f};
+    const double perPixel = millisecondsFor(20, [&] { drawPerPixel(frame, image, draw); });
+    const double blitted = millisecondsFor(20, [&] { drawBlitted(frame, image, draw); });
+    printf("%-18s per pixel %7.3f ms, blitter %7.3f ms (%.2fx)\n", ORIENTATION_NAMES[orientation], perPixel, blitted,
+           perPixel / blitted);
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " bitmap blit check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All bitmap blit checks passed\n";
+  return 0;
+}
@@ -0,0 +1,127 @@
+// Host checks for BookCacheKey on an in-memory card (see host/HalStorage.h). Copies of a book share one cache
+// directory, so deleting or replacing one copy, through discard() like the web server, WebDAV and the file browser do
+// or by cachePath() noticing the new contents, must keep the sections and progress.bin the other copy still uses. The
+// last copy going away removes the directory.
+
+#include <BookCacheKey.h>
+#include <HalStorage.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string CACHE_DIR = "/.crosspoint";
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << "\n";
+    failures++;
+  }
+}
+
+std::vector<uint8_t> book(const uint8_t seed, const size_t size = 300 * 1024) {
+  std::vector<uint8_t> bytes(size);
+  uint32_t state = seed * 2654435761u + 1;
+  for (auto& byte : bytes) {
+    state = state * 1664525u + 1013904223u;
+    byte = static_cast<uint8_t>(state >> 24);
+  }
+  return bytes;
+}
+
+// Opens the book like Epub does and leaves reading progress in its cache directory
+std::string open(const std::string& path) {
+  const std::string cachePath = BookCacheKey::cachePath(path, CACHE_DIR, "epub_");
+  Storage.mkdir(cachePath.c_str());
+  Storage.files[cachePath + "/progress.bin"] = {1, 2, 3, 4};
+  return cachePath;
+}
+
+bool hasProgress(const std::string& cachePath) { return Storage.files.count(cachePath + "/progress.bin") > 0; }
+
+void reset() {
+  Storage.files.clear();
+  Storage.dirs.clear();
+  // Drop the key map loaded from the previous card
+  BookCacheKey::cachePath("/reset.epub", "/reset", "epub_");
+}
+
+}  // namespace
+
+int main() {
+  // Deleting one of two copies keeps the shared cache; deleting the second removes it
+  {
+    reset();
+    Storage.files["/a.epub"] = book(1);
+    Storage.files["/copies/a.epub"] = book(1);
+    const std::string shared = open("/a.epub");
+    check(open("/copies/a.epub") == shared, "copies get the same cache directory");
+
+    Storage.remove("/a.epub");
+    BookCacheKey::discard("/a.epub", CACHE_DIR, "epub_");
+    check(hasProgress(shared), "deleting one copy keeps the progress the other copy uses");
+    check(BookCacheKey::cachePath("/copies/a.epub", CACHE_DIR, "epub_") == shared, "remaining copy keeps its key");
+
+    Storage.remove("/copies/a.epub");
+    BookCacheKey::discard("/copies/a.epub", CACHE_DIR, "epub_");
+    check(!Storage.exists(shared.c_str()), "deleting the last copy removes the cache");
+  }
+
+  // Uploading over one copy discards its old contents without touching the other copy's cache
+  {
+    reset();
+    Storage.files["/a.epub"] = book(1);
+    Storage.files["/b.epub"] = book(1);
+    const std::string shared = open("/a.epub");
+    open("/b.epub");
+
+    Storage.files["/a.epub"] = book(2);
+    BookCacheKey::discard("/a.epub", CACHE_DIR, "epub_");
+    check(hasProgress(shared), "replacing one copy keeps the progress the other copy uses");
+    const std::string replaced = open("/a.epub");
+    check(replaced != shared, "replaced contents get a new key");
+    check(BookCacheKey::cachePath("/b.epub", CACHE_DIR, "epub_") == shared && hasProgress(shared),
+          "other copy still maps to its cache");
+  }
+
+  // A copy replaced behind the key map's back is noticed by cachePath(), which must not remove the shared cache either
+  {
+    reset();
+    Storage.files["/a.epub"] = book(1);
+    Storage.files["/b.epub"] = book(1);
+    const std::string shared = open("/a.epub");
+    open("/b.epub");
+
+    Storage.files["/a.epub"] = book(3, 200 * 1024);
+    check(open("/a.epub") != shared, "contents replaced in place get a new key");
+    check(hasProgress(shared), "stale-key cleanup keeps a cache another copy uses");
+
+    // With no copy left, the stale cache of a replaced book is removed
+    const std::string previous = open("/b.epub");
+    Storage.files["/b.epub"] = book(4);
+    open("/b.epub");
+    check(!Storage.exists(previous.c_str()), "stale cache of the only copy is removed");
+  }
+
+  // A book nothing is remembered about only loses its legacy path-hash cache, and nothing is fingerprinted
+  {
+    reset();
+    const std::string legacy = CACHE_DIR + "/epub_" + std::to_string(std::hash<std::string>{}("/old.epub"));
+    Storage.files[legacy + "/progress.bin"] = {1};
+    Storage.files["/c.epub"] = book(5);
+    const std::string other = open("/c.epub");
+    BookCacheKey::discard("/old.epub", CACHE_DIR, "epub_");
+    check(!Storage.exists(legacy.c_str()), "legacy cache of an unknown path is removed");
+    check(hasProgress(other), "unrelated cache is kept");
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " book cache key check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All book cache key checks passed\n";
+  return 0;
+}
@@ -0,0 +1,108 @@
+#pragma once
+// In-memory stand-in for lib/hal/HalStorage.h: files are byte vectors keyed by path, and a directory exists while a
+// path below it does or after mkdir().
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+inline unsigned long millis() { return 0; }
+
+class HalFile {
+ public:
+  size_t fileSize() const { return data ? data->size() : 0; }
+  bool seekSet(const size_t offset) {
+    if (!data || offset > data->size()) {
+      return false;
+    }
+    pos = offset;
+    return true;
+  }
+  int available() const { return data ? static_cast<int>(data->size() - pos) : 0; }
+  int read(void* buf, const size_t count) {
+    if (!data) {
+      return -1;
+    }
+    const size_t n = std::min(count, data->size() - pos);
+    memcpy(buf, data->data() + pos, n);
+    pos += n;
+    return static_cast<int>(n);
+  }
+  size_t write(const void* buf, const size_t count) {
+    if (!data) {
+      return 0;
+    }
+    const auto* bytes = static_cast<const uint8_t*>(buf);
+    data->insert(data->end(), bytes, bytes + count);
+    return count;
+  }
+  bool close() {
+    data = nullptr;
+    return true;
+  }
+  explicit operator bool() const { return data != nullptr; }
+
+  std::vector<uint8_t>* data = nullptr;
+  size_t pos = 0;
+};
+
+using FsFile = HalFile;
+
+class HalStorage {
+ public:
+  std::map<std::string, std::vector<uint8_t>> files;
+  std::set<std::string> dirs;
+
+  bool exists(const char* path) {
+    const std::string prefix = std::string(path) + "/";
+    return files.count(path) || dirs.count(path) ||
+           std::any_of(files.begin(), files.end(), [&](const auto& f) { return f.first.rfind(prefix, 0) == 0; });
+  }
+  bool mkdir(const char* path, const bool = true) { return dirs.insert(path).second; }
+  bool remove(const char* path) { return files.erase(path) > 0; }
+  bool removeDir(const char* path) {
+    const std::string prefix = std::string(path) + "/";
+    std::erase_if(files, [&](const auto& f) { return f.first.rfind(prefix, 0) == 0; });
+    std::erase_if(dirs, [&](const std::string& d) { return d == path || d.rfind(prefix, 0) == 0; });
+    return true;
+  }
+  bool rename(const char* oldPath, const char* newPath) {
+    const std::string from = oldPath;
+    const std::string to = newPath;
+    std::map<std::string, std::vector<uint8_t>> moved;
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first == from || it->first.rfind(from + "/", 0) == 0) {
+        moved[to + it->first.substr(from.size())] = std::move(it->second);
+        it = files.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    files.merge(moved);
+    if (dirs.erase(from)) {
+      dirs.insert(to);
+    }
+    return true;
+  }
+  bool openFileForRead(const char*, const std::string& path, HalFile& file) {
+    const auto it = files.find(path);
+    if (it == files.end()) {
+      return false;
+    }
+    file.data = &it->second;
+    file.pos = 0;
+    return true;
+  }
+  bool openFileForWrite(const char*, const std::string& path, HalFile& file) {
+    file.data = &files[path];
+    file.data->clear();
+    file.pos = 0;
+    return true;
+  }
+};
+
+inline HalStorage Storage;
@@ -0,0 +1,8 @@
+#pragma once
+// Host stand-in for lib/Logging/Logging.h: messages are formatted nowhere, but their arguments still count as used
+
+inline void logDiscard(const char*, const char*, ...) {}
+
+#define LOG_ERR(origin, format, ...) logDiscard(origin, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_INF(origin, format, ...) logDiscard(origin, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_DBG(origin, format, ...) logDiscard(origin, format __VA_OPT__(, ) __VA_ARGS__)
@@ -0,0 +1,308 @@
+// Host simulation of windowed panel refreshes. UI screens are redrawn from scratch into a portrait frame buffer the
+// way GfxRenderer lays them out on the 800x480 panel, and every frame goes through DirtyRegionTracker::planPush, the
+// push decision GfxRenderer::displayBuffer makes. The simulated panel only takes the bytes of the band it was sent, so
+// after every push it must match the frame buffer exactly. Reports the bytes sent per frame against full pushes.
+
+#include <DirtyRegionTracker.h>
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int PANEL_WIDTH = 800;
+constexpr int PANEL_HEIGHT = 480;
+constexpr int WIDTH_BYTES = PANEL_WIDTH / 8;
+constexpr int BUFFER_SIZE = WIDTH_BYTES * PANEL_HEIGHT;
+
+// Portrait logical screen as GfxRenderer::Portrait maps it onto the panel
+constexpr int SCREEN_WIDTH = PANEL_HEIGHT;
+constexpr int SCREEN_HEIGHT = PANEL_WIDTH;
+
+struct Frame {
+  std::vector<uint8_t> bytes = std::vector<uint8_t>(BUFFER_SIZE, 0xFF);
+
+  void clear() { std::fill(bytes.begin(), bytes.end(), 0xFF); }
+
+  void pixel(const int x, const int y, const bool black) {
+    if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) {
+      return;
+    }
+    const int phyX = y;
+    const int phyY = PANEL_HEIGHT - 1 - x;
+    uint8_t& byte = bytes[phyY * WIDTH_BYTES + phyX / 8];
+    const uint8_t bit = 1 << (7 - phyX % 8);
+    byte = black ? byte & ~bit : byte | bit;
+  }
+
+  void fillRect(const int x, const int y, const int width, const int height, const bool black) {
+    for (int py = y; py < y + height; py++) {
+      for (int px = x; px < x + width; px++) {
+        pixel(px, py, black);
+      }
+    }
+  }
+
+  void drawRect(const int x, const int y, const int width, const int height) {
+    fillRect(x, y, width, 1, true);
+    fillRect(x, y + height - 1, width, 1, true);
+    fillRect(x, y, 1, height, true);
+    fillRect(x + width - 1, y, 1, height, true);
+  }
+
+  // Stand-in for a line of text: glyph-sized ink blots whose pattern depends on the string
+  void text(const int x, const int y, const std::string& s, const bool black) {
+    uint32_t seed = 2166136261u;
+    for (const char c : s) {
+      seed = (seed ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    std::minstd_rand ink(seed);
+    for (size_t i = 0; i < s.size(); i++) {
+      for (int py = 4; py < 18; py++) {
+        for (int px = 1; px < 9; px++) {
+          if (ink() % 3 == 0) {
+            pixel(x + static_cast<int>(i) * 10 + px, y + py, black);
+          }
+        }
+      }
+    }
+  }
+};
+
+struct Totals {
+  int frames = 0;
+  int windowed = 0;
+  int skipped = 0;
+  long sentBytes = 0;
+  long fullBytes = 0;
+};
+
+// Panel that only takes the band it is sent
+class SimulatedPanel {
+ public:
+  std::vector<uint8_t> shown = std::vector<uint8_t>(BUFFER_SIZE, 0x00);
+  int failures = 0;
+
+  void push(const Frame& frame, DirtyRegionTracker& tracker, Totals& totals, const char* what) {
+    DirtyRegionTracker::Region region;
+    const auto push = tracker.planPush(frame.bytes.data(), true, region);
+    totals.frames++;
+    totals.fullBytes += BUFFER_SIZE;
+    if (push == DirtyRegionTracker::Push::NOTHING) {
+      if (!region.isEmpty()) {
+        std::cerr << what << ": changed frame " << totals.frames << " was not sent\n";
+        failures++;
+      }
+      totals.skipped++;
+    } else if (push == DirtyRegionTracker::Push::WINDOW) {
+      if (region.x % 8 != 0 || region.width % 8 != 0 || region.x + region.width > PANEL_WIDTH ||
+          region.y + region.height > PANEL_HEIGHT) {
+        std::cerr << what << ": band " << region.x << "," << region.y << " " << region.width << "x" << region.height
+                  << " is not byte aligned inside the panel\n";
+        failures++;
+        return;
+      }
+      for (int y = region.y; y < region.y + region.height; y++) {
+        const size_t offset = y * WIDTH_BYTES + region.x / 8;
+        memcpy(shown.data() + offset, frame.bytes.data() + offset, region.width / 8);
+      }
+      totals.windowed++;
+      totals.sentBytes += region.byteCount();
+    } else {
+      shown = frame.bytes;
+      totals.sentBytes += BUFFER_SIZE;
+    }
+    if (shown != frame.bytes) {
+      std::cerr << what << ": panel differs from the frame buffer after frame " << totals.frames << "\n";
+      failures++;
+    }
+  }
+};
+
+void report(const char* what, const Totals& totals) {
+  printf("%-26s %6d %9d %8d %12ld %12ld %8.1f%%\n", what, totals.frames, totals.windowed, totals.skipped,
+         totals.sentBytes / totals.frames, totals.fullBytes / totals.frames,
+         100.0 * (totals.fullBytes - totals.sentBytes) / totals.fullBytes);
+}
+
+// BaseTheme header, list rows and button hints (BaseMetrics: header 45, rows 30, hints 40)
+void drawSettings(Frame& frame, const int selected, const std::vector<bool>& values) {
+  frame.clear();
+  frame.text(20, 10, "Settings", true);
+  frame.fillRect(0, 45, SCREEN_WIDTH, 1, true);
+  constexpr int ROW_HEIGHT = 30;
+  constexpr int LIST_Y = 60;
+  frame.fillRect(0, LIST_Y + selected * ROW_HEIGHT - 2, SCREEN_WIDTH, ROW_HEIGHT, true);
+  for (int i = 0; i < static_cast<int>(values.size()); i++) {
+    const int y = LIST_Y + i * ROW_HEIGHT;
+    frame.text(20, y, "Setting number " + std::to_string(i), i != selected);
+    frame.text(SCREEN_WIDTH - 60, y, values[i] ? "ON" : "OFF", i != selected);
+  }
+  for (int i = 0; i < 4; i++) {
+    frame.drawRect(25 + i * 110, SCREEN_HEIGHT - 40, 100, 40);
+    frame.text(40 + i * 110, SCREEN_HEIGHT - 32, i == 1 ? "Toggle" : "Move", true);
+  }
+}
+
+// KeyboardEntryActivity with BaseMetrics keys (22x30, 10 spacing, 13 per row, 5 rows)
+void drawKeyboard(Frame& frame, const int row, const int column, const std::string& typed) {
+  frame.clear();
+  frame.text(20, 10, "Enter name", true);
+  frame.drawRect(10, 70, SCREEN_WIDTH - 20, 40);
+  frame.text(20, 80, typed, true);
+  constexpr int KEY_WIDTH = 22;
+  constexpr int KEY_HEIGHT = 30;
+  constexpr int SPACING = 10;
+  constexpr int START_Y = 150;
+  const int leftMargin = (SCREEN_WIDTH - 13 * (KEY_WIDTH + SPACING)) / 2;
+  for (int r = 0; r < 5; r++) {
+    for (int c = 0; c < 13; c++) {
+      const int x = leftMargin + c * (KEY_WIDTH + SPACING);
+      const int y = START_Y + r * (KEY_HEIGHT + SPACING);
+      const bool selected = r == row && c == column;
+      if (selected) {
+        frame.fillRect(x, y, KEY_WIDTH, KEY_HEIGHT, true);
+      }
+      frame.text(x + 6, y + 4, std::string(1, static_cast<char>('a' + r * 13 + c)), !selected);
+    }
+  }
+}
+
+int checkSettings() {
+  SimulatedPanel panel;
+  DirtyRegionTracker tracker(WIDTH_BYTES, PANEL_HEIGHT);
+  Frame frame;
+  Totals totals;
+  std::vector<bool> values(18, false);
+  int selected = 0;
+  drawSettings(frame, selected, values);
+  panel.push(frame, tracker, totals, "settings");
+  for (int step = 0; step < 40; step++) {
+    if (step % 4 == 3) {
+      values[selected] = !values[selected];
+    } else {
+      selected = (selected + 1) % static_cast<int>(values.size());
+    }
+    drawSettings(frame, selected, values);
+    panel.push(frame, tracker, totals, "settings");
+  }
+  // Redrawing the same screen sends nothing
+  panel.push(frame, tracker, totals, "settings");
+  report("settings cursor + toggle", totals);
+  return panel.failures;
+}
+
+int checkKeyboard() {
+  SimulatedPanel panel;
+  DirtyRegionTracker tracker(WIDTH_BYTES, PANEL_HEIGHT);
+  Frame frame;
+  Totals totals;
+  int row = 0;
+  int column = 0;
+  std::string typed;
+  drawKeyboard(frame, row, column, typed);
+  panel.push(frame, tracker, totals, "keyboard");
+  for (int step = 0; step < 60; step++) {
+    if (step % 13 == 12) {
+      row = (row + 1) % 5;
+    } else if (step % 5 == 4) {
+      typed += static_cast<char>('a' + row * 13 + column);
+    } else {
+      column = (column + 1) % 13;
+    }
+    drawKeyboard(frame, row, column, typed);
+    panel.push(frame, tracker, totals, "keyboard");
+  }
+  report("keyboard highlight + type", totals);
+  return panel.failures;
+}
+
+// Random edits of any size, with the panel's copy invalidated now and then like a grayscale render does
+int checkRandomEdits() {
+  SimulatedPanel panel;
+  DirtyRegionTracker tracker(WIDTH_BYTES, PANEL_HEIGHT);
+  Frame frame;
+  Totals totals;
+  std::mt19937 random(1234);
+  panel.push(frame, tracker, totals, "random");
+  for (int step = 0; step < 2000; step++) {
+    const int edits = random() % 3;
+    for (int e = 0; e < edits; e++) {
+      const int width = 1 + random() % (random() % 4 == 0 ? SCREEN_WIDTH : 40);
+      const int height = 1 + random() % (random() % 4 == 0 ? SCREEN_HEIGHT : 40);
+      frame.fillRect(random() % SCREEN_WIDTH, random() % SCREEN_HEIGHT, width, height, random() % 2);
+    }
+    // Last pixel of the panel, in the bottom right tile
+    if (step % 97 == 0) {
+      frame.pixel(0, SCREEN_HEIGHT - 1, step % 2);
+    }
+    if (step % 50 == 0) {
+      tracker.invalidate();
+      std::fill(panel.shown.begin(), panel.shown.end(), 0x55);
+    }
+    panel.push(frame, tracker, totals, "random");
+  }
+  report("random edits", totals);
+  return panel.failures;
+}
+
+// Refresh modes other than fast always send the whole frame, changed or not
+int checkFullRefresh() {
+  DirtyRegionTracker tracker(WIDTH_BYTES, PANEL_HEIGHT);
+  Frame frame;
+  DirtyRegionTracker::Region region;
+  int failures = 0;
+  for (int step = 0; step < 3; step++) {
+    frame.fillRect(0, 0, step * 10, 10, true);
+    if (tracker.planPush(frame.bytes.data(), false, region) != DirtyRegionTracker::Push::FULL_FRAME) {
+      std::cerr << "full refresh " << step << " did not send the whole frame\n";
+      failures++;
+    }
+  }
+  return failures;
+}
+
+// Two contents of the top left tile that a 32-bit FNV-1a signature can't tell apart: a change between them must still
+// be sent
+int checkSignatureCollision() {
+  DirtyRegionTracker tracker(WIDTH_BYTES, PANEL_HEIGHT);
+  std::vector<uint8_t> frame(BUFFER_SIZE, 0xFF);
+  const auto setTile = [&frame](const uint8_t row6a, const uint8_t row6b, const uint8_t row7a, const uint8_t row7b) {
+    frame[6 * WIDTH_BYTES] = row6a;
+    frame[6 * WIDTH_BYTES + 1] = row6b;
+    frame[7 * WIDTH_BYTES] = row7a;
+    frame[7 * WIDTH_BYTES + 1] = row7b;
+  };
+  setTile(0x86, 0x73, 0x4C, 0x01);
+  tracker.update(frame.data());
+  setTile(0x46, 0x00, 0x00, 0x02);
+  if (tracker.update(frame.data()).isEmpty()) {
+    std::cerr << "tile change with a colliding 32-bit signature was not sent\n";
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main() {
+  printf("%-26s %6s %9s %8s %12s %12s %9s\n", "scenario", "frames", "windowed", "skipped", "bytes/frame",
+         "full/frame", "saved");
+  int failures = 0;
+  failures += checkSettings();
+  failures += checkKeyboard();
+  failures += checkRandomEdits();
+  failures += checkFullRefresh();
+  failures += checkSignatureCollision();
+  if (failures > 0) {
+    std::cerr << failures << " display refresh check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All display refresh checks passed\n";
+  return 0;
+}
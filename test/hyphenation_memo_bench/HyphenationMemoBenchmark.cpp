@@ -0,0 +1,210 @@
+// Host benchmark for the memoized Hyphenator::breakOffsets. Builds paragraphs by sampling the hyphenation_eval word
+// lists by their frequency in the source books, hyphenates every word of five or more bytes the way the line breaker
+// does at a line end, and compares the previous vector-returning implementation with the buffer + memo API. Both must
+// report identical breaks before anything is timed.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
+#include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
+
+namespace {
+
+constexpr int PARAGRAPHS = 400;
+constexpr int WORDS_PER_PARAGRAPH = 80;
+constexpr int ITERATIONS = 5;
+
+struct Corpus {
+  const char* label;
+  const char* file;
+  const char* primaryTag;
+};
+
+const Corpus CORPORA[] = {
+    {"english", "test/hyphenation_eval/resources/english_hyphenation_tests.txt", "en"},
+    {"french", "test/hyphenation_eval/resources/french_hyphenation_tests.txt", "fr"},
+    {"german", "test/hyphenation_eval/resources/german_hyphenation_tests.txt", "de"},
+    {"russian", "test/hyphenation_eval/resources/russian_hyphenation_tests.txt", "ru"},
+    {"spanish", "test/hyphenation_eval/resources/spanish_hyphenation_tests.txt", "es"},
+    {"italian", "test/hyphenation_eval/resources/italian_hyphenation_tests.txt", "it"},
+};
+
+// The previous Hyphenator::breakOffsets: fresh vectors per call and no memo
+std::vector<Hyphenator::BreakInfo> legacyBreakOffsets(const std::string& word, const bool includeFallback,
+                                                      const LanguageHyphenator* hyphenator) {
+  if (word.empty()) {
+    return {};
+  }
+  auto cps = collectCodepoints(word);
+  trimSurroundingPunctuationAndFootnote(cps);
+
+  std::vector<Hyphenator::BreakInfo> explicitBreakInfos;
+  for (size_t i = 1; i + 1 < cps.size(); ++i) {
+    const uint32_t cp = cps[i].value;
+    if (isExplicitHyphen(cp) && isAlphabetic(cps[i - 1].value) && isAlphabetic(cps[i + 1].value)) {
+      explicitBreakInfos.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    }
+  }
+  if (!explicitBreakInfos.empty()) {
+    if (hyphenator) {
+      size_t segStart = 0;
+      for (size_t i = 0; i <= cps.size(); ++i) {
+        const bool atEnd = (i == cps.size());
+        if (atEnd || isExplicitHyphen(cps[i].value)) {
+          if (i > segStart) {
+            std::vector<CodepointInfo> segment(cps.begin() + segStart, cps.begin() + i);
+            for (const size_t idx : hyphenator->breakIndexes(segment)) {
+              if (segStart + idx < cps.size()) {
+                explicitBreakInfos.push_back({cps[segStart + idx].byteOffset, true});
+              }
+            }
+          }
+          segStart = i + 1;
+        }
+      }
+      std::sort(explicitBreakInfos.begin(), explicitBreakInfos.end(),
+                [](const auto& a, const auto& b) { return a.byteOffset < b.byteOffset; });
+    }
+    return explicitBreakInfos;
+  }
+
+  std::vector<size_t> indexes;
+  if (hyphenator) {
+    indexes = hyphenator->breakIndexes(cps);
+  }
+  if (includeFallback && indexes.empty()) {
+    const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
+    const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
+    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
+      indexes.push_back(idx);
+    }
+  }
+
+  std::vector<Hyphenator::BreakInfo> breaks;
+  for (const size_t idx : indexes) {
+    breaks.push_back({idx < cps.size() ? cps[idx].byteOffset : cps.back().byteOffset, true});
+  }
+  return breaks;
+}
+
+bool loadParagraphs(const char* path, std::vector<std::vector<std::string>>& paragraphs) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::vector<std::string> words;
+  std::vector<double> weights;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string word, hyphenated, frequency;
+    if (std::getline(fields, word, '|') && std::getline(fields, hyphenated, '|') && std::getline(fields, frequency)) {
+      words.push_back(word);
+      weights.push_back(std::stod(frequency));
+    }
+  }
+
+  std::mt19937 rng(42);
+  std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+  paragraphs.assign(PARAGRAPHS, {});
+  for (auto& paragraph : paragraphs) {
+    for (int i = 0; i < WORDS_PER_PARAGRAPH; i++) {
+      const std::string& word = words[pick(rng)];
+      if (word.size() >= 5) {
+        paragraph.push_back(word);
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  int mismatches = 0;
+  std::cout << PARAGRAPHS << " paragraphs of " << WORDS_PER_PARAGRAPH << " sampled words per language\n";
+
+  for (const auto& corpus : CORPORA) {
+    std::vector<std::vector<std::string>> paragraphs;
+    if (!loadParagraphs(corpus.file, paragraphs)) {
+      std::cerr << "Cannot read " << corpus.file << "\n";
+      return 1;
+    }
+    const LanguageHyphenator* hyphenator = getLanguageHyphenatorForPrimaryTag(corpus.primaryTag);
+    Hyphenator::setPreferredLanguage(corpus.primaryTag);
+
+    // Correctness: same breaks from both paths, with and without fallback
+    Hyphenator::BreakInfo buffer[Hyphenator::MAX_BREAKS];
+    for (const auto& paragraph : paragraphs) {
+      for (const auto& word : paragraph) {
+        for (const bool fallback : {false, true}) {
+          const auto expected = legacyBreakOffsets(word, fallback, hyphenator);
+          const size_t count = Hyphenator::breakOffsets(word, fallback, buffer, Hyphenator::MAX_BREAKS);
+          bool same = count == std::min(expected.size(), Hyphenator::MAX_BREAKS);
+          for (size_t i = 0; same && i < count; i++) {
+            same = buffer[i].byteOffset == expected[i].byteOffset &&
+                   buffer[i].requiresInsertedHyphen == expected[i].requiresInsertedHyphen;
+          }
+          if (!same) {
+            std::cerr << corpus.label << ": breaks differ for " << word << "\n";
+            mismatches++;
+          }
+        }
+      }
+    }
+
+    // Timing starts from an empty memo, like a freshly opened book
+    Hyphenator::setPreferredLanguage("");
+    Hyphenator::setPreferredLanguage(corpus.primaryTag);
+    const auto before = Hyphenator::memoStats();
+
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+      for (const auto& paragraph : paragraphs) {
+        for (const auto& word : paragraph) {
+          checksum += legacyBreakOffsets(word, false, hyphenator).size();
+        }
+      }
+    }
+    const std::chrono::duration<double, std::micro> legacyTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+      for (const auto& paragraph : paragraphs) {
+        for (const auto& word : paragraph) {
+          checksum += Hyphenator::breakOffsets(word, false, buffer, Hyphenator::MAX_BREAKS);
+        }
+      }
+    }
+    const std::chrono::duration<double, std::micro> memoTime = std::chrono::steady_clock::now() - start;
+
+    const auto after = Hyphenator::memoStats();
+    const double lookups = (after.hits - before.hits) + (after.misses - before.misses);
+    const double perParagraph = static_cast<double>(PARAGRAPHS) * ITERATIONS;
+    std::cout << corpus.label << " (checksum " << checksum << ")\n";
+    std::cout << "  vector, no memo: " << legacyTime.count() / perParagraph << " us/paragraph\n";
+    std::cout << "  buffer + memo:   " << memoTime.count() / perParagraph << " us/paragraph ("
+              << legacyTime.count() / memoTime.count() << "x), hit rate "
+              << 100.0 * (after.hits - before.hits) / std::max(lookups, 1.0) << "%, "
+              << after.evictions - before.evictions << " evictions\n";
+  }
+
+  if (mismatches > 0) {
+    std::cerr << mismatches << " mismatches\n";
+    return 1;
+  }
+  return 0;
+}
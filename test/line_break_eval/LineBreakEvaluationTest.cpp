@@ -0,0 +1,138 @@
+// Host checks for the CJK/Thai line-break segmenter used by ParsedText. Segments known sentences, checks that breaks
+// never split a Thai character cluster, and that every word of the dictionary list comes back whole.
+
+#include <Utf8.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/linebreak/LineBreakSegmenter.h"
+#include "lib/Epub/Epub/linebreak/ThaiWordBreaker.h"
+
+namespace {
+
+std::vector<std::string> segments(const std::string& text) {
+  std::vector<std::string> out;
+  size_t start = 0;
+  for (const size_t offset : LineBreakSegmenter::breakOffsets(text)) {
+    out.push_back(text.substr(start, offset - start));
+    start = offset;
+  }
+  out.push_back(text.substr(start));
+  return out;
+}
+
+std::string join(const std::vector<std::string>& parts) {
+  std::string out;
+  for (size_t i = 0; i < parts.size(); i++) {
+    out += (i > 0 ? "|" : "") + parts[i];
+  }
+  return out;
+}
+
+uint32_t firstCodepoint(const std::string& s) {
+  const auto* ptr = reinterpret_cast<const unsigned char*>(s.c_str());
+  return utf8NextCodepoint(&ptr);
+}
+
+uint32_t lastCodepoint(const std::string& s) {
+  size_t i = s.size() - 1;
+  while (i > 0 && (static_cast<uint8_t>(s[i]) & 0xC0) == 0x80) {
+    --i;
+  }
+  const auto* ptr = reinterpret_cast<const unsigned char*>(s.c_str() + i);
+  return utf8NextCodepoint(&ptr);
+}
+
+struct Case {
+  const char* text;
+  const char* expected;  // segments joined with '|'
+};
+
+const Case CASES[] = {
+    {"hello", "hello"},
+    {"Straße", "Straße"},
+    {"日本語の本です。", "日|本|語|の|本|で|す。"},
+    {"「こんにちは」と言った。", "「こ|ん|に|ち|は」|と|言っ|た。"},
+    {"ちょっと", "ちょっ|と"},
+    {"コーヒー", "コー|ヒー"},
+    {"Unicode文字", "Unicode|文|字"},
+    {"中文，English。", "中|文，|English。"},
+    {"ฉันรักภาษาไทย", "ฉัน|รัก|ภาษา|ไทย"},
+    {"เด็กนักเรียนอ่านหนังสือ", "เด็ก|นักเรียน|อ่าน|หนังสือ"},
+    {"วันนี้ฝนตก", "วัน|นี้|ฝน|ตก"},
+    {"ไทย日本", "ไทย|日|本"},
+    {"English「本」", "English|「本」"},
+    {"กขค", "กขค"},
+    {"ภาษาฆฌฎฏไทย", "ภาษา|ฆฌฎฏ|ไทย"},  // text the dictionary doesn't know stays whole
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int failures = 0;
+
+  for (const auto& testCase : CASES) {
+    const std::string actual = join(segments(testCase.text));
+    if (actual != testCase.expected) {
+      std::cerr << "Segmented \"" << testCase.text << "\" as " << actual << ", expected " << testCase.expected << "\n";
+      failures++;
+    }
+  }
+
+  if (LineBreakSegmenter::needsSegmentation("Quadratkilometer") || LineBreakSegmenter::needsSegmentation("слово") ||
+      !LineBreakSegmenter::needsSegmentation("abc漢") || !LineBreakSegmenter::needsSegmentation("ภาษา")) {
+    std::cerr << "needsSegmentation misclassifies a word\n";
+    failures++;
+  }
+
+  // A run longer than one dictionary pass still breaks on word boundaries only
+  std::string longRun;
+  for (int i = 0; i < 40; i++) {
+    longRun += "ภาษาไทย";
+  }
+  for (const auto& part : segments(longRun)) {
+    if (part != "ภาษา" && part != "ไทย") {
+      std::cerr << "Long Thai run produced segment " << part << "\n";
+      failures++;
+      break;
+    }
+  }
+
+  for (int i = 1; i < argc; i++) {
+    std::ifstream file(argv[i]);
+    if (!file) {
+      std::cerr << "Cannot read " << argv[i] << "\n";
+      return 1;
+    }
+    size_t checked = 0;
+    std::string word;
+    while (std::getline(file, word)) {
+      if (word.empty() || word[0] == '#') {
+        continue;
+      }
+      const auto parts = segments(word);
+      if (parts.size() != 1) {
+        std::cerr << "Dictionary word " << word << " split as " << join(parts) << "\n";
+        failures++;
+      }
+      for (size_t p = 1; p < parts.size(); p++) {
+        if (!ThaiWordBreaker::isClusterBoundary(lastCodepoint(parts[p - 1]), firstCodepoint(parts[p]))) {
+          std::cerr << "Break inside a cluster in " << word << "\n";
+          failures++;
+        }
+      }
+      checked++;
+    }
+    std::cout << "Checked " << checked << " dictionary words from " << argv[i] << "\n";
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " line-break check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All line-break checks passed\n";
+  return 0;
+}
@@ -0,0 +1,92 @@
+// Host checks for Hyphenator::widestFittingBreak, the break choice ParsedText makes when a word doesn't fit the rest of
+// a line. Words longer than Hyphenator::MAX_BREAKS codepoints must still offer their late break points, so on a wide
+// line the prefix reaches close to the line width instead of stopping at the 64th break.
+
+#include <iostream>
+#include <string>
+
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+namespace {
+
+struct Case {
+  const char* name;
+  std::string word;
+  bool includeFallback;
+  int lineWidth;         // in codepoints, every codepoint and the inserted hyphen being one unit wide
+  size_t expectedBytes;  // prefix length of the chosen break
+};
+
+// Width of the prefix in the one-unit-per-codepoint font of the test
+int prefixWidth(const std::string& word, const size_t byteOffset, const bool withHyphen) {
+  int width = withHyphen ? 1 : 0;
+  for (size_t i = 0; i < byteOffset; i++) {
+    if ((static_cast<uint8_t>(word[i]) & 0xC0) != 0x80) {
+      width++;
+    }
+  }
+  return width;
+}
+
+std::string repeat(const std::string& part, const int times, const std::string& separator = "") {
+  std::string out;
+  for (int i = 0; i < times; i++) {
+    out += (i > 0 ? separator : "") + part;
+  }
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  Hyphenator::setPreferredLanguage("de");
+
+  const std::string longLatin = repeat("x", 200);
+  const std::string longCyrillic = repeat("ж", 120);  // 240 bytes
+  const std::string compound = repeat("Haus", 30, "-");
+
+  const Case cases[] = {
+      // Fallback breaks every codepoint: the 149-codepoint prefix plus its hyphen fills a 150-wide line
+      {"fallback, 200 codepoints", longLatin, true, 150, 149},
+      {"fallback, multi-byte", longCyrillic, true, 100, 99 * 2},
+      // Explicit hyphens only, the last one that fits is after the 29th "Haus-"
+      {"explicit hyphens", compound, false, 149, 29 * 5},
+      // Short words keep using the stack buffer
+      {"fallback, short word", repeat("x", 10), true, 6, 5},
+  };
+
+  int failures = 0;
+  for (const auto& testCase : cases) {
+    const std::string& word = testCase.word;
+    Hyphenator::BreakInfo chosen{};
+    int chosenWidth = -1;
+    const bool found = Hyphenator::widestFittingBreak(
+        word, testCase.includeFallback, testCase.lineWidth,
+        [&](const size_t offset, const bool withHyphen) { return prefixWidth(word, offset, withHyphen); }, chosen,
+        chosenWidth);
+    if (!found || chosen.byteOffset != testCase.expectedBytes || chosenWidth > testCase.lineWidth) {
+      std::cerr << testCase.name << ": chose byte " << (found ? chosen.byteOffset : 0) << " (width " << chosenWidth
+                << "), expected byte " << testCase.expectedBytes << "\n";
+      failures++;
+    }
+  }
+
+  // Nothing fits a line narrower than the shortest prefix
+  Hyphenator::BreakInfo chosen{};
+  int chosenWidth = -1;
+  if (Hyphenator::widestFittingBreak(
+          longLatin, true, 1, [&](const size_t offset, const bool withHyphen) {
+            return prefixWidth(longLatin, offset, withHyphen);
+          },
+          chosen, chosenWidth)) {
+    std::cerr << "A break was chosen for a line too narrow for any prefix\n";
+    failures++;
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " long-word break check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All long-word break checks passed\n";
+  return 0;
+}
@@ -0,0 +1,341 @@
+// Host checks for streaming OPDS catalogs. Feeds the recorded feeds to the parser in chunks of every size from one
+// byte up and checks that the entries handed to the entry callback and the rel="next" link match a whole-document
+// parse. Then spills each feed through OpdsFeedPage into an in-memory page file, checks that the first screen was
+// ready before the parse finished and that every screen reads back from the file, including after a reload, and cuts
+// the file off at every size to check that a page that couldn't be written keeps what it can and is never loaded.
+// Pages with corrupt screen offsets must not load either.
+//
+// With --stream the feed is read from stdin instead and its entry count and next link are printed; the test script
+// uses that to walk the recorded feeds through a local HTTP server.
+
+#include <OpdsFeedPage.h>
+#include <OpdsParser.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t SCREEN_SIZE = 23;  // OpdsBookBrowserActivity's PAGE_ITEMS
+
+struct RecordedFeed {
+  const char* name;
+  size_t entries;
+  const char* nextHref;
+};
+
+// Books without an epub link, like the one on the second page, are skipped by the parser
+constexpr RecordedFeed FEEDS[] = {
+    {"catalog.xml", 3, ""},
+    {"books-1.xml", 40, "/books-2.xml"},
+    {"books-2.xml", 40, "/books-3.xml"},
+    {"books-3.xml", 12, ""},
+};
+
+struct SimulatedFile {
+  std::vector<uint8_t> bytes;
+  size_t capacity = SIZE_MAX;  // writes past this many bytes fail, like a full card
+};
+
+size_t readFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  const auto& file = *static_cast<SimulatedFile*>(ctx);
+  if (offset >= file.bytes.size()) {
+    return 0;
+  }
+  const size_t count = std::min(len, file.bytes.size() - offset);
+  memcpy(out, file.bytes.data() + offset, count);
+  return count;
+}
+
+size_t writeFile(void* ctx, const size_t offset, const uint8_t* data, const size_t len) {
+  auto& file = *static_cast<SimulatedFile*>(ctx);
+  if (offset + len > file.capacity) {
+    return 0;
+  }
+  if (file.bytes.size() < offset + len) {
+    file.bytes.resize(offset + len);
+  }
+  memcpy(file.bytes.data() + offset, data, len);
+  return len;
+}
+
+bool sameEntry(const OpdsEntry& a, const OpdsEntry& b) {
+  return a.type == b.type && a.title == b.title && a.author == b.author && a.href == b.href && a.id == b.id;
+}
+
+void feedInChunks(OpdsParser& parser, const std::string& xml, const size_t chunkSize) {
+  for (size_t pos = 0; pos < xml.size(); pos += chunkSize) {
+    const size_t len = std::min(chunkSize, xml.size() - pos);
+    parser.write(reinterpret_cast<const uint8_t*>(xml.data() + pos), len);
+  }
+  parser.flush();
+}
+
+int checkStreaming(const RecordedFeed& feed, const std::string& xml, const std::vector<OpdsEntry>& reference) {
+  int failures = 0;
+  if (reference.size() != feed.entries) {
+    std::cerr << feed.name << ": whole-document parse found " << reference.size() << " entries, expected "
+              << feed.entries << "\n";
+    failures++;
+  }
+
+  for (size_t chunkSize = 1; chunkSize <= xml.size(); chunkSize = chunkSize < 16 ? chunkSize + 1 : chunkSize * 3) {
+    std::vector<OpdsEntry> streamed;
+    OpdsParser parser([&streamed](const OpdsEntry& entry) { streamed.push_back(entry); });
+    feedInChunks(parser, xml, chunkSize);
+
+    const bool same = streamed.size() == reference.size() &&
+                      std::equal(streamed.begin(), streamed.end(), reference.begin(), sameEntry);
+    if (!parser || !same || parser.getNextHref() != feed.nextHref || !parser.getEntries().empty()) {
+      std::cerr << feed.name << ": streaming in " << chunkSize << " byte chunks gave " << streamed.size()
+                << " entries, next '" << parser.getNextHref() << "'\n";
+      failures++;
+      break;
+    }
+  }
+  return failures;
+}
+
+int checkScreens(const char* name, OpdsFeedPage& page, SimulatedFile& file, const std::vector<OpdsEntry>& reference) {
+  const size_t screens = (reference.size() + SCREEN_SIZE - 1) / SCREEN_SIZE;
+  // Back to front and once past the end, where only a "next page" row would be
+  for (size_t screen = screens + 1; screen-- > 0;) {
+    if (!page.showScreen(readFile, &file, screen)) {
+      std::cerr << name << ": screen " << screen << " didn't read back\n";
+      return 1;
+    }
+    const auto& window = page.getWindow();
+    const size_t first = screen * SCREEN_SIZE;
+    const size_t count = first < reference.size() ? std::min(SCREEN_SIZE, reference.size() - first) : 0;
+    if (page.getWindowScreen() != screen || window.size() != count ||
+        !std::equal(window.begin(), window.end(), reference.begin() + first, sameEntry)) {
+      std::cerr << name << ": screen " << screen << " holds " << window.size() << " entries, expected " << count
+                << "\n";
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int checkSpill(const RecordedFeed& feed, const std::string& xml, const std::vector<OpdsEntry>& reference) {
+  int failures = 0;
+  SimulatedFile file;
+  OpdsFeedPage page(SCREEN_SIZE);
+  page.begin(writeFile, &file);
+  size_t windowChanges = 0;
+  size_t firstScreenReadyAt = 0;
+  OpdsParser parser([&](const OpdsEntry& entry) {
+    if (page.append(entry)) {
+      windowChanges++;
+    }
+    if (firstScreenReadyAt == 0 && page.getWindow().size() == std::min(SCREEN_SIZE, feed.entries)) {
+      firstScreenReadyAt = page.getEntryCount();
+    }
+  });
+  feedInChunks(parser, xml, 512);
+
+  if (windowChanges != std::min(SCREEN_SIZE, feed.entries) || firstScreenReadyAt != windowChanges) {
+    std::cerr << feed.name << ": the window changed " << windowChanges << " times and was full after "
+              << firstScreenReadyAt << " entries\n";
+    failures++;
+  }
+  if (!page.finish(parser.getNextHref()) || page.getEntryCount() != reference.size() || page.isTruncated()) {
+    std::cerr << feed.name << ": page didn't finish with all " << reference.size() << " entries\n";
+    failures++;
+  }
+  failures += checkScreens(feed.name, page, file, reference);
+
+  OpdsFeedPage reloaded(SCREEN_SIZE);
+  if (!reloaded.load(readFile, &file, file.bytes.size()) || reloaded.getEntryCount() != reference.size() ||
+      reloaded.getNextHref() != feed.nextHref || reloaded.getWindowScreen() != 0) {
+    std::cerr << feed.name << ": the finished page didn't load back\n";
+    failures++;
+  } else {
+    failures += checkScreens(feed.name, reloaded, file, reference);
+  }
+  // A reader with another screen size can't use the offsets and must refetch
+  OpdsFeedPage otherSize(SCREEN_SIZE + 1);
+  if (feed.entries > SCREEN_SIZE && otherSize.load(readFile, &file, file.bytes.size())) {
+    std::cerr << feed.name << ": page loaded with the wrong screen size\n";
+    failures++;
+  }
+  return failures;
+}
+
+int checkFullCard(const RecordedFeed& feed, const std::string& xml, const std::vector<OpdsEntry>& reference) {
+  SimulatedFile complete;
+  {
+    OpdsFeedPage page(SCREEN_SIZE);
+    page.begin(writeFile, &complete);
+    OpdsParser parser([&page](const OpdsEntry& entry) { page.append(entry); });
+    feedInChunks(parser, xml, 4096);
+    page.finish(parser.getNextHref());
+  }
+
+  for (size_t capacity = 0; capacity < complete.bytes.size(); capacity++) {
+    SimulatedFile file;
+    file.capacity = capacity;
+    OpdsFeedPage page(SCREEN_SIZE);
+    page.begin(writeFile, &file);
+    OpdsParser parser([&page](const OpdsEntry& entry) { page.append(entry); });
+    feedInChunks(parser, xml, 4096);
+    const bool finished = page.finish(parser.getNextHref());
+
+    // The first screen always shows; past it, every entry that made it to the file still reads back
+    const size_t count = page.getEntryCount();
+    const std::vector<OpdsEntry> kept(reference.begin(), reference.begin() + std::min(count, reference.size()));
+    const char* problem = nullptr;
+    if (finished) {
+      problem = "finished on a full card";
+    } else if (count < std::min(SCREEN_SIZE, reference.size()) || count > reference.size()) {
+      problem = "lost part of the first screen";
+    } else if (count < reference.size() && !page.isTruncated()) {
+      problem = "dropped entries without saying so";
+    } else if (checkScreens(feed.name, page, file, kept) != 0) {
+      problem = "kept entries that don't read back";
+    } else if (OpdsFeedPage reloaded(SCREEN_SIZE); reloaded.load(readFile, &file, file.bytes.size())) {
+      problem = "left a page that loads";
+    }
+    if (problem) {
+      std::cerr << feed.name << ": with room for " << capacity << " bytes the page " << problem << "\n";
+      return 1;
+    }
+  }
+
+  // No file at all keeps the first screen
+  OpdsFeedPage page(SCREEN_SIZE);
+  page.begin(nullptr, nullptr);
+  OpdsParser parser([&page](const OpdsEntry& entry) { page.append(entry); });
+  feedInChunks(parser, xml, 4096);
+  if (page.finish(parser.getNextHref()) || page.getEntryCount() != std::min(SCREEN_SIZE, reference.size()) ||
+      page.getNextHref() != feed.nextHref || page.isTruncated() != (reference.size() > SCREEN_SIZE)) {
+    std::cerr << feed.name << ": without a file the page kept " << page.getEntryCount() << " entries\n";
+    return 1;
+  }
+  return 0;
+}
+
+// Screen offsets out of order, inside the header or past the trailer must reject the page instead of sizing a read
+int checkCorruptOffsets(const RecordedFeed& feed, const std::string& xml) {
+  SimulatedFile complete;
+  OpdsFeedPage page(SCREEN_SIZE);
+  page.begin(writeFile, &complete);
+  OpdsParser parser([&page](const OpdsEntry& entry) { page.append(entry); });
+  feedInChunks(parser, xml, 4096);
+  page.finish(parser.getNextHref());
+  if (page.getEntryCount() <= SCREEN_SIZE) {
+    return 0;
+  }
+
+  const auto get32 = [](const uint8_t* in) {
+    return static_cast<uint32_t>(in[0] | (in[1] << 8) | (in[2] << 16) | (static_cast<uint32_t>(in[3]) << 24));
+  };
+  const auto put32 = [](uint8_t* out, const uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      out[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+  };
+  const uint32_t trailerOffset = get32(complete.bytes.data() + 12);
+  const size_t firstOffset = trailerOffset + 4;
+  const size_t secondOffset = trailerOffset + 8;
+  const uint32_t first = get32(complete.bytes.data() + firstOffset);
+  const uint32_t second = get32(complete.bytes.data() + secondOffset);
+
+  const struct {
+    const char* what;
+    size_t at;
+    uint32_t value;
+  } corruptions[] = {
+      {"a screen starting inside the header", firstOffset, 0},
+      {"screens out of order", secondOffset, first},
+      {"a screen before the previous one", firstOffset, second + 1},
+      {"a screen starting at the trailer", secondOffset, trailerOffset},
+      {"a screen past the end of the file", secondOffset, UINT32_MAX},
+  };
+  for (const auto& corruption : corruptions) {
+    SimulatedFile file = complete;
+    put32(file.bytes.data() + corruption.at, corruption.value);
+    OpdsFeedPage reloaded(SCREEN_SIZE);
+    if (reloaded.load(readFile, &file, file.bytes.size())) {
+      std::cerr << feed.name << ": a page with " << corruption.what << " loaded\n";
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int checkMalformed() {
+  const std::string xml = "<feed><entry><title>Cut short</title><link href=\"/a\" type=\"application/atom+xml\"/>";
+  size_t entries = 0;
+  OpdsParser parser([&entries](const OpdsEntry&) { entries++; });
+  feedInChunks(parser, xml + "</entry><entry><title>", 7);
+  if (parser || !parser.getErrorMessage() || entries != 1) {
+    std::cerr << "A truncated feed wasn't reported as an error after its complete entries\n";
+    return 1;
+  }
+  // Writing and flushing after the error is harmless
+  parser.write(reinterpret_cast<const uint8_t*>("</feed>"), 7);
+  parser.flush();
+  return 0;
+}
+
+int streamStdin() {
+  size_t entries = 0;
+  OpdsParser parser([&entries](const OpdsEntry&) { entries++; });
+  char buffer[1500];
+  size_t chunk = 1;
+  while (std::cin.read(buffer, static_cast<std::streamsize>(chunk)) || std::cin.gcount() > 0) {
+    parser.write(reinterpret_cast<const uint8_t*>(buffer), static_cast<size_t>(std::cin.gcount()));
+    chunk = chunk * 7 % sizeof(buffer) + 1;  // uneven chunk sizes, like packets off the network
+  }
+  parser.flush();
+  if (!parser) {
+    std::cerr << "Parse error: " << parser.getErrorMessage() << "\n";
+    return 1;
+  }
+  std::cout << "entries " << entries << "\n";
+  std::cout << "next " << parser.getNextHref() << "\n";
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1 && strcmp(argv[1], "--stream") == 0) {
+    return streamStdin();
+  }
+  const std::string feedDir = argc > 1 ? argv[1] : "test/opds_feed_eval/feeds";
+
+  int failures = checkMalformed();
+  for (const auto& feed : FEEDS) {
+    std::ifstream in(feedDir + "/" + feed.name, std::ios::binary);
+    if (!in) {
+      std::cerr << "Cannot open " << feedDir << "/" << feed.name << "\n";
+      return 1;
+    }
+    const std::string xml{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+    OpdsParser whole;
+    whole.write(reinterpret_cast<const uint8_t*>(xml.data()), xml.size());
+    whole.flush();
+    const std::vector<OpdsEntry> reference = whole.getEntries();
+
+    failures += checkStreaming(feed, xml, reference);
+    failures += checkSpill(feed, xml, reference);
+    failures += checkFullCard(feed, xml, reference);
+    failures += checkCorruptOffsets(feed, xml);
+    std::cout << feed.name << ": " << reference.size() << " entries, next '" << whole.getNextHref() << "'\n";
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " OPDS feed check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All OPDS feed checks passed\n";
+  return 0;
+}
@@ -0,0 +1,205 @@
+// Host benchmark for hyphenation patterns paged in from a trie file. Writes every flash-resident trie back out in the
+// hypher `.bin` layout, opens it through PagedHyphenationTrie, checks that both sources give identical breaks for the
+// hyphenation_eval word lists and then times a frequency-sampled word stream against each. Block reads are reported
+// per thousand words since host file reads come from the page cache and don't reflect SD latency.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
+#include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
+#include "lib/Epub/Epub/hyphenation/PagedHyphenationTrie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-de.trie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-en.trie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-es.trie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-fr.trie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-it.trie.h"
+#include "lib/Epub/Epub/hyphenation/generated/hyph-ru.trie.h"
+
+namespace {
+
+constexpr int SAMPLED_WORDS = 20000;
+constexpr int ITERATIONS = 5;
+// The default cache and the budget the SD loader uses
+constexpr size_t CACHE_BLOCKS[] = {PagedHyphenationTrie::DEFAULT_BLOCK_COUNT, 32};
+
+struct Corpus {
+  const char* label;
+  const char* file;
+  const SerializedHyphenationPatterns& patterns;
+  bool (*isLetter)(uint32_t);
+  uint32_t (*toLower)(uint32_t);
+  size_t minPrefix;
+  size_t minSuffix;
+};
+
+const Corpus CORPORA[] = {
+    {"english", "test/hyphenation_eval/resources/english_hyphenation_tests.txt", en_patterns, isLatinLetter,
+     toLowerLatin, 3, 3},
+    {"french", "test/hyphenation_eval/resources/french_hyphenation_tests.txt", fr_patterns, isLatinLetter,
+     toLowerLatin, 2, 2},
+    {"german", "test/hyphenation_eval/resources/german_hyphenation_tests.txt", de_patterns, isLatinLetter,
+     toLowerLatin, 2, 2},
+    {"russian", "test/hyphenation_eval/resources/russian_hyphenation_tests.txt", ru_patterns, isCyrillicLetter,
+     toLowerCyrillic, 2, 2},
+    {"spanish", "test/hyphenation_eval/resources/spanish_hyphenation_tests.txt", es_patterns, isLatinLetter,
+     toLowerLatin, 2, 2},
+    {"italian", "test/hyphenation_eval/resources/italian_hyphenation_tests.txt", it_patterns, isLatinLetter,
+     toLowerLatin, 2, 2},
+};
+
+size_t readFromFile(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  auto* file = static_cast<FILE*>(ctx);
+  if (std::fseek(file, static_cast<long>(offset), SEEK_SET) != 0) {
+    return 0;
+  }
+  return std::fread(out, 1, len, file);
+}
+
+// Restores the 4-byte big-endian root header generate_hyphenation_trie.py strips from hypher's files
+bool writeTrieFile(const std::string& path, const SerializedHyphenationPatterns& patterns) {
+  FILE* file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  const size_t root = patterns.rootOffset + PagedHyphenationTrie::HEADER_SIZE;
+  const uint8_t header[] = {static_cast<uint8_t>(root >> 24), static_cast<uint8_t>(root >> 16),
+                            static_cast<uint8_t>(root >> 8), static_cast<uint8_t>(root)};
+  const bool ok = std::fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                  std::fwrite(patterns.data, 1, patterns.size, file) == patterns.size;
+  std::fclose(file);
+  return ok;
+}
+
+bool loadWords(const char* path, std::vector<std::string>& words, std::vector<double>& weights) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string word, hyphenated, frequency;
+    if (std::getline(fields, word, '|') && std::getline(fields, hyphenated, '|') && std::getline(fields, frequency)) {
+      words.push_back(word);
+      weights.push_back(std::stod(frequency));
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string tempDir = argc > 1 ? argv[1] : ".";
+  int mismatches = 0;
+  std::cout << SAMPLED_WORDS << " sampled words x " << ITERATIONS << " iterations per language, "
+            << PagedHyphenationTrie::BLOCK_SIZE << "-byte blocks\n";
+
+  for (const auto& corpus : CORPORA) {
+    std::vector<std::string> words;
+    std::vector<double> weights;
+    if (!loadWords(corpus.file, words, weights)) {
+      std::cerr << "Cannot read " << corpus.file << "\n";
+      return 1;
+    }
+
+    const std::string triePath = tempDir + "/" + corpus.label + ".bin";
+    if (!writeTrieFile(triePath, corpus.patterns)) {
+      std::cerr << "Cannot write " << triePath << "\n";
+      return 1;
+    }
+    FILE* file = std::fopen(triePath.c_str(), "rb");
+    if (!file) {
+      std::cerr << "Cannot open " << triePath << "\n";
+      return 1;
+    }
+    const size_t fileSize = corpus.patterns.size + PagedHyphenationTrie::HEADER_SIZE;
+
+    std::vector<std::vector<CodepointInfo>> wordCps;
+    for (const auto& word : words) {
+      auto cps = collectCodepoints(word);
+      trimSurroundingPunctuationAndFootnote(cps);
+      wordCps.push_back(std::move(cps));
+    }
+
+    std::mt19937 rng(42);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    std::vector<size_t> stream(SAMPLED_WORDS);
+    for (auto& index : stream) {
+      index = pick(rng);
+    }
+
+    const LanguageHyphenator flash(corpus.patterns, corpus.isLetter, corpus.toLower, corpus.minPrefix,
+                                   corpus.minSuffix);
+    size_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+      for (const size_t index : stream) {
+        checksum += flash.breakIndexes(wordCps[index]).size();
+      }
+    }
+    const std::chrono::duration<double, std::micro> flashTime = std::chrono::steady_clock::now() - start;
+    const double lookups = static_cast<double>(SAMPLED_WORDS) * ITERATIONS;
+    std::cout << corpus.label << " (" << corpus.patterns.size << " bytes)\n";
+    std::cout << "  flash:            " << flashTime.count() / lookups << " us/word\n";
+
+    for (const size_t blocks : CACHE_BLOCKS) {
+      PagedHyphenationTrie trie;
+      if (!trie.open(readFromFile, file, fileSize, blocks)) {
+        std::cerr << "Cannot open " << triePath << " as a trie\n";
+        return 1;
+      }
+      const LanguageHyphenator paged(trie, corpus.isLetter, corpus.toLower, corpus.minPrefix, corpus.minSuffix);
+
+      for (size_t i = 0; i < words.size(); i++) {
+        if (flash.breakIndexes(wordCps[i]) != paged.breakIndexes(wordCps[i])) {
+          std::cerr << corpus.label << ": breaks differ for " << words[i] << "\n";
+          mismatches++;
+        }
+      }
+
+      const uint32_t readsBefore = trie.getBlockReads();
+      const uint32_t hitsBefore = trie.getBlockHits();
+      size_t pagedChecksum = 0;
+      const auto pagedStart = std::chrono::steady_clock::now();
+      for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (const size_t index : stream) {
+          pagedChecksum += paged.breakIndexes(wordCps[index]).size();
+        }
+      }
+      const std::chrono::duration<double, std::micro> pagedTime = std::chrono::steady_clock::now() - pagedStart;
+      if (pagedChecksum != checksum) {
+        std::cerr << corpus.label << ": paged checksum " << pagedChecksum << " != " << checksum << "\n";
+        mismatches++;
+      }
+
+      const double reads = trie.getBlockReads() - readsBefore;
+      const double switches = reads + (trie.getBlockHits() - hitsBefore);
+      std::cout << "  paged, " << blocks << " blocks: " << pagedTime.count() / lookups << " us/word ("
+                << pagedTime.count() / flashTime.count() << "x), " << 1000.0 * reads / lookups
+                << " block reads per 1000 words, block hit rate "
+                << 100.0 * (1.0 - reads / std::max(switches, 1.0)) << "%\n";
+    }
+
+    std::fclose(file);
+    std::remove(triePath.c_str());
+  }
+
+  if (mismatches > 0) {
+    std::cerr << mismatches << " mismatches\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/book_cache_key_eval"
+BINARY="$BUILD_DIR/BookCacheKeyEvaluationTest"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/book_cache_key_eval/BookCacheKeyEvaluationTest.cpp"
+  "$ROOT_DIR/lib/FsHelpers/BookCacheKey.cpp"
+)
+
+# host/ stands in for the storage and logging layers, so it comes before lib/. Serialization.h defines static
+# helpers for streams that BookCacheKey doesn't use.
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-function
+  -I"$ROOT_DIR/test/book_cache_key_eval/host"
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/Serialization"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
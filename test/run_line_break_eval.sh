@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/line_break_eval"
+BINARY="$BUILD_DIR/LineBreakEvaluationTest"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/line_break_eval/LineBreakEvaluationTest.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/linebreak/LineBreakSegmenter.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/linebreak/ThaiWordBreaker.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/Utf8"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+if [ "$#" -gt 0 ]; then
+  "$BINARY" "$@"
+  exit 0
+fi
+
+# Default: every dictionary word must come back as a single segment
+"$BINARY" "$ROOT_DIR/scripts/data/th-words.txt"
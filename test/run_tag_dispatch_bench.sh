@@ -0,0 +1,50 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/tag_dispatch_bench"
+BINARY="$BUILD_DIR/TagDispatchBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+# Same expat configuration as platformio.ini
+EXPAT_FLAGS=(
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/lib/expat"
+)
+
+EXPAT_OBJECTS=()
+for source in xmlparse xmlrole xmltok; do
+  cc -O2 "${EXPAT_FLAGS[@]}" -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$source.o"
+  EXPAT_OBJECTS+=("$BUILD_DIR/$source.o")
+done
+
+c++ "${CXXFLAGS[@]}" "${EXPAT_FLAGS[@]}" "$ROOT_DIR/test/tag_dispatch_bench/TagDispatchBenchmark.cpp" \
+  "${EXPAT_OBJECTS[@]}" -o "$BINARY"
+
+if [ "$#" -gt 0 ]; then
+  "$BINARY" "$@"
+  exit 0
+fi
+
+# Default corpus: the chapters of the test EPUBs; the benchmark adds its own tag-dense sample
+CORPUS=()
+if command -v unzip >/dev/null 2>&1; then
+  for epub in "$ROOT_DIR"/test/epubs/*.epub; do
+    out="$BUILD_DIR/$(basename "$epub" .epub).xhtml"
+    unzip -p "$epub" '*.xhtml' '*.html' >"$out" 2>/dev/null || true
+    [ -s "$out" ] && CORPUS+=("$out")
+  done
+fi
+
+"$BINARY" ${CORPUS[@]+"${CORPUS[@]}"}
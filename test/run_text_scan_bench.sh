@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/text_scan_bench"
+BINARY="$BUILD_DIR/TextScanBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "$ROOT_DIR/test/text_scan_bench/TextScanBenchmark.cpp" -o "$BINARY"
+
+if [ "$#" -gt 0 ]; then
+  "$BINARY" "$@"
+  exit 0
+fi
+
+# Default corpus: the chapters of the test EPUBs plus the multilingual hyphenation word lists
+CORPUS=()
+if command -v unzip >/dev/null 2>&1; then
+  for epub in "$ROOT_DIR"/test/epubs/*.epub; do
+    out="$BUILD_DIR/$(basename "$epub" .epub).xhtml"
+    unzip -p "$epub" '*.xhtml' '*.html' >"$out" 2>/dev/null || true
+    [ -s "$out" ] && CORPUS+=("$out")
+  done
+fi
+CORPUS+=("$ROOT_DIR"/test/hyphenation_eval/resources/*_hyphenation_tests.txt)
+
+"$BINARY" "${CORPUS[@]}"
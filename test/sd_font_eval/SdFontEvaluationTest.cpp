@@ -0,0 +1,257 @@
+// Host checks for SD card fonts. Writes compressed built-in fonts out in the .epdfont layout that fontconvert.py
+// --binary produces, opens them with SdFont and checks that glyph, kerning and ligature lookups and the compressed
+// group bytes read through the file source match the compiled-in font, including the per-glyph group map of
+// corpus-grouped fonts. Also checks that damaged files are refused, and reports how much RAM each face keeps against
+// its file size.
+
+#include <EpdFont.h>
+#include <SdFont.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/notosans_12_italic.h>
+#include <builtinFonts/opendyslexic_10_regular.h>
+#include <builtinFonts/opendyslexic_14_bolditalic.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+struct NamedFont {
+  const char* name;
+  const EpdFontData* data;
+};
+
+const NamedFont FONTS[] = {
+    {"bookerly_14_regular", &bookerly_14_regular}, {"bookerly_14_bold", &bookerly_14_bold},
+    {"notosans_12_italic", &notosans_12_italic},   {"opendyslexic_10_regular", &opendyslexic_10_regular},
+    {"opendyslexic_14_bolditalic", &opendyslexic_14_bolditalic},
+};
+
+template <typename T>
+void append(std::vector<uint8_t>& out, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void appendArray(std::vector<uint8_t>& out, const T* values, const size_t count) {
+  if (count > 0) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+  }
+}
+
+uint32_t glyphCount(const EpdFontData& font) {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    count += font.intervals[i].last - font.intervals[i].first + 1;
+  }
+  return count;
+}
+
+uint32_t bitmapSize(const EpdFontData& font) {
+  uint32_t size = 0;
+  for (uint16_t i = 0; i < font.groupCount; i++) {
+    size = std::max(size, font.groups[i].compressedOffset + font.groups[i].compressedSize);
+  }
+  return size;
+}
+
+// Mirror of the fontconvert.py --binary writer
+std::vector<uint8_t> writeFontFile(const EpdFontData& font) {
+  std::vector<uint8_t> out;
+  const uint8_t flags = (font.is2Bit ? 0x01 : 0) | (font.glyphGroups ? 0x02 : 0);
+  out.insert(out.end(), {'E', 'P', 'D', 'F', SdFont::FILE_VERSION, flags, font.advanceY, 0});
+  append(out, static_cast<int16_t>(font.ascender));
+  append(out, static_cast<int16_t>(font.descender));
+  append(out, font.kernLeftClassCount);
+  append(out, font.kernRightClassCount);
+  append(out, font.groupCount);
+  append(out, glyphCount(font));
+  append(out, font.intervalCount);
+  append(out, font.kernLeftEntryCount);
+  append(out, font.kernRightEntryCount);
+  append(out, font.ligaturePairCount);
+  append(out, font.latinLookup ? EPD_LATIN_LOOKUP_SIZE : 0);
+  append(out, bitmapSize(font));
+  appendArray(out, font.glyph, glyphCount(font));
+  appendArray(out, font.intervals, font.intervalCount);
+  appendArray(out, font.groups, font.groupCount);
+  appendArray(out, font.latinLookup, font.latinLookup ? EPD_LATIN_LOOKUP_SIZE : 0);
+  appendArray(out, font.ligaturePairs, font.ligaturePairCount);
+  appendArray(out, font.kernLeftClasses, font.kernLeftEntryCount);
+  appendArray(out, font.kernRightClasses, font.kernRightEntryCount);
+  appendArray(out, font.kernMatrix, font.kernMatrix ? font.kernLeftClassCount * font.kernRightClassCount : 0);
+  appendArray(out, font.glyphGroups, font.glyphGroups ? glyphCount(font) : 0);
+  appendArray(out, font.bitmap, bitmapSize(font));
+  return out;
+}
+
+size_t readFromBuffer(void* ctx, const size_t offset, uint8_t* out, const size_t len) {
+  const auto& file = *static_cast<const std::vector<uint8_t>*>(ctx);
+  if (offset >= file.size()) {
+    return 0;
+  }
+  const size_t count = std::min(len, file.size() - offset);
+  memcpy(out, file.data() + offset, count);
+  return count;
+}
+
+bool sameGlyph(const EpdGlyph* a, const EpdGlyph* b) {
+  if (!a || !b) {
+    return a == b;
+  }
+  return a->width == b->width && a->height == b->height && a->advanceX == b->advanceX && a->left == b->left &&
+         a->top == b->top && a->dataLength == b->dataLength && a->dataOffset == b->dataOffset;
+}
+
+int compareFont(const NamedFont& named) {
+  int failures = 0;
+  std::vector<uint8_t> file = writeFontFile(*named.data);
+  SdFont sdFont;
+  if (!sdFont.open(readFromBuffer, &file, file.size())) {
+    std::cerr << named.name << ": SdFont refused a valid file\n";
+    return 1;
+  }
+  const EpdFont builtin(named.data);
+  const EpdFont loaded(sdFont.getData());
+
+  // Codepoints up to the end of the BMP, including the misses that resolve to the replacement glyph
+  for (uint32_t cp = 0; cp < 0x10000; cp++) {
+    if (!sameGlyph(builtin.getGlyph(cp), loaded.getGlyph(cp))) {
+      std::cerr << named.name << ": glyph differs for U+" << std::hex << cp << std::dec << "\n";
+      failures++;
+    }
+  }
+
+  for (uint32_t left = 0x20; left < 0x250; left++) {
+    for (uint32_t right = 0x20; right < 0x250; right++) {
+      if (builtin.getKerning(left, right) != loaded.getKerning(left, right)) {
+        failures++;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < named.data->ligaturePairCount; i++) {
+    const uint32_t pair = named.data->ligaturePairs[i].pair;
+    if (loaded.getLigature(pair >> 16, pair & 0xFFFF) != named.data->ligaturePairs[i].ligatureCp) {
+      failures++;
+    }
+  }
+
+  // Every group has to come back byte for byte through the file source FontDecompressor reads from
+  const EpdFontData& data = *sdFont.getData();
+  for (uint16_t i = 0; i < data.groupCount; i++) {
+    const EpdFontGroup& group = data.groups[i];
+    std::vector<uint8_t> compressed(group.compressedSize);
+    const EpdFontFileSource& source = *data.fileSource;
+    const size_t read =
+        source.read(source.ctx, source.bitmapOffset + group.compressedOffset, compressed.data(), compressed.size());
+    if (read != compressed.size() ||
+        memcmp(compressed.data(), named.data->bitmap + group.compressedOffset, compressed.size()) != 0) {
+      std::cerr << named.name << ": group " << i << " reads back differently\n";
+      failures++;
+    }
+  }
+
+  std::cout << named.name << ": " << glyphCount(*named.data) << " glyphs, " << data.groupCount << " groups, "
+            << sdFont.getTableBytes() << " bytes of tables in RAM of " << file.size() << " in the file\n";
+  return failures;
+}
+
+// The same groups described glyph by glyph, the way fontconvert.py --group-corpus writes them
+std::vector<uint8_t> glyphGroupMap(const EpdFontData& font) {
+  std::vector<uint8_t> map(glyphCount(font));
+  for (uint16_t i = 0; i < font.groupCount; i++) {
+    std::fill_n(map.begin() + font.groups[i].firstGlyphIndex, font.groups[i].glyphCount, static_cast<uint8_t>(i));
+  }
+  return map;
+}
+
+int checkGlyphGroupMap() {
+  int failures = 0;
+  const std::vector<uint8_t> map = glyphGroupMap(bookerly_14_regular);
+  EpdFontData mapped = bookerly_14_regular;
+  mapped.glyphGroups = map.data();
+  std::vector<uint8_t> file = writeFontFile(mapped);
+
+  SdFont sdFont;
+  if (!sdFont.open(readFromBuffer, &file, file.size())) {
+    std::cerr << "SdFont refused a file with a glyph group map\n";
+    return 1;
+  }
+  const EpdFontData& data = *sdFont.getData();
+  if (!data.glyphGroups || memcmp(data.glyphGroups, map.data(), map.size()) != 0) {
+    std::cerr << "Glyph group map reads back differently\n";
+    failures++;
+  }
+  if (data.kernMatrix && memcmp(data.kernMatrix, mapped.kernMatrix,
+                                mapped.kernLeftClassCount * mapped.kernRightClassCount) != 0) {
+    std::cerr << "Kern matrix moved by the glyph group map\n";
+    failures++;
+  }
+  sdFont.close();
+
+  // A glyph pointing past the group directory
+  file[file.size() - bitmapSize(mapped) - 1] = static_cast<uint8_t>(mapped.groupCount);
+  if (sdFont.open(readFromBuffer, &file, file.size())) {
+    std::cerr << "Accepted a glyph group map pointing past the groups\n";
+    failures++;
+  }
+  return failures;
+}
+
+int checkDamagedFiles() {
+  int failures = 0;
+  const std::vector<uint8_t> valid = writeFontFile(opendyslexic_10_regular);
+  const auto refuses = [&failures](const char* what, std::vector<uint8_t> file) {
+    SdFont font;
+    if (font.open(readFromBuffer, &file, file.size())) {
+      std::cerr << "Accepted a file with " << what << "\n";
+      failures++;
+    }
+  };
+
+  std::vector<uint8_t> file = valid;
+  file[0] = 'X';
+  refuses("a bad magic", file);
+
+  file = valid;
+  file.resize(file.size() - 1);
+  refuses("truncated group data", file);
+
+  // First glyph interval pointing past the glyph table
+  file = valid;
+  const size_t intervalOffset = 40 + glyphCount(opendyslexic_10_regular) * sizeof(EpdGlyph);
+  const uint32_t badOffset = 0xFFFF;
+  memcpy(file.data() + intervalOffset + offsetof(EpdUnicodeInterval, offset), &badOffset, sizeof(badOffset));
+  refuses("an interval past the glyph table", file);
+
+  // Group data claimed beyond the end of the file
+  file = valid;
+  const size_t groupOffset = intervalOffset + opendyslexic_10_regular.intervalCount * sizeof(EpdUnicodeInterval);
+  const uint32_t badSize = 0x7FFFFFFF;
+  memcpy(file.data() + groupOffset + offsetof(EpdFontGroup, compressedSize), &badSize, sizeof(badSize));
+  refuses("a group past the end of the data", file);
+  return failures;
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+  for (const auto& font : FONTS) {
+    failures += compareFont(font);
+  }
+  failures += checkGlyphGroupMap();
+  failures += checkDamagedFiles();
+
+  if (failures > 0) {
+    std::cerr << failures << " SD font check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All SD font checks passed\n";
+  return 0;
+}
@@ -0,0 +1,254 @@
+// Host checks for EPUB table layout in ChapterHtmlSlimParser. Chapters are parsed with expat into pages set in the
+// fixed-pitch font of host/GfxRenderer.h (10 pixels a codepoint, 5 a space, 20 a line) and the placed lines are
+// checked: column positions and widths of a table that fits, paragraphs and line breaks inside a cell, the flattened
+// "Tab Row N, Cell M:" paragraphs of tables over the column, cell and word caps, and the pages that ids and footnotes
+// inside a table land on.
+
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/SectionAnchor.h"
+#include "lib/Epub/Epub/converters/ImageDecoderFactory.h"
+#include "lib/Epub/Epub/css/CssParser.h"
+#include "lib/Epub/Epub/parsers/ChapterHtmlSlimParser.h"
+#include "lib/FsHelpers/FsHelpers.h"
+
+// Link stand-ins for the image and stylesheet paths, which these chapters don't reach
+bool Epub::readItemContentsToStream(const std::string&, Print&, size_t) const { return false; }
+bool ImageDecoderFactory::isFormatSupported(const std::string&) { return false; }
+ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string&) { return nullptr; }
+CssStyle CssParser::resolveStyle(const std::string&, const std::string&) const { return {}; }
+CssStyle CssParser::parseInlineStyle(const std::string&) { return {}; }
+std::string FsHelpers::normalisePath(const std::string& path) { return path; }
+ImageBlock::ImageBlock(const std::string&, int16_t, int16_t) {}
+void ImageBlock::render(GfxRenderer&, int, int) {}
+bool ImageBlock::serialize(FsFile&) { return false; }
+std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile&) { return nullptr; }
+
+namespace {
+
+constexpr int VIEWPORT_WIDTH = 480;
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << "\n";
+    failures++;
+  }
+}
+
+struct PlacedLine {
+  int page;
+  int x;
+  int y;
+  std::string text;
+};
+
+struct Chapter {
+  std::vector<PlacedLine> lines;
+  int rules = 0;
+  std::vector<std::pair<int, std::string>> footnotes;  // <page, number>
+  std::vector<std::pair<int, uint32_t>> anchors;       // <page, id hash>
+  int pages = 0;
+
+  const PlacedLine* find(const std::string& text) const {
+    for (const auto& line : lines) {
+      if (line.text == text) {
+        return &line;
+      }
+    }
+    return nullptr;
+  }
+  int anchorPage(const char* id) const {
+    const uint32_t hash = SectionAnchor::hashId(id, strlen(id));
+    for (const auto& [page, anchor] : anchors) {
+      if (anchor == hash) {
+        return page;
+      }
+    }
+    return -1;
+  }
+  int footnotePage(const std::string& number) const {
+    for (const auto& [page, footnote] : footnotes) {
+      if (footnote == number) {
+        return page;
+      }
+    }
+    return -1;
+  }
+  std::string allText() const {
+    std::string text;
+    for (const auto& line : lines) {
+      text += (text.empty() ? "" : " ") + line.text;
+    }
+    return text;
+  }
+};
+
+Chapter parse(const std::string& body, const int viewportHeight = 800) {
+  const std::string path = "/chapter.xhtml";
+  const std::string html = "<html><body>" + body + "</body></html>";
+  Storage.files[path].assign(html.begin(), html.end());
+
+  Chapter chapter;
+  GfxRenderer renderer;
+  ChapterHtmlSlimParser parser(
+      nullptr, path, renderer, 0, 1.0f, true, static_cast<uint8_t>(CssTextAlign::Left), VIEWPORT_WIDTH,
+      viewportHeight, false,
+      [&chapter](std::unique_ptr<Page> page) {
+        for (const auto& element : page->elements) {
+          if (element->getTag() == TAG_PageRule) {
+            chapter.rules++;
+          } else if (element->getTag() == TAG_PageLine) {
+            std::string text;
+            for (const auto& word : static_cast<const PageLine&>(*element).getBlock()->getWords()) {
+              text += (text.empty() ? "" : " ") + word;
+            }
+            chapter.lines.push_back({chapter.pages, element->xPos, element->yPos, text});
+          }
+        }
+        for (const auto& footnote : page->footnotes) {
+          chapter.footnotes.push_back({chapter.pages, footnote.number});
+        }
+        chapter.pages++;
+      },
+      false, "", "", 0, nullptr, nullptr, nullptr,
+      [&chapter](const uint32_t hash) { chapter.anchors.push_back({chapter.pages, hash}); });
+  check(parser.parseAndBuildPages(), "chapter parses");
+  return chapter;
+}
+
+std::string rows(const int count, const int columns, const std::string& prefix = "r") {
+  std::ostringstream html;
+  for (int r = 1; r <= count; r++) {
+    html << "<tr>";
+    for (int c = 1; c <= columns; c++) {
+      html << "<td>" << prefix << r << "c" << c << "</td>";
+    }
+    html << "</tr>";
+  }
+  return html.str();
+}
+
+}  // namespace
+
+int main() {
+  // A table that fits: columns as wide as their widest cell, two spaces apart, header centred, a rule around each row
+  {
+    const Chapter chapter = parse(
+        "<table><tr><th>Name</th><th>Qty</th></tr>"
+        "<tr><td>Apples</td><td>3</td></tr>"
+        "<tr><td>Kiwi</td><td>12</td></tr></table>");
+    const PlacedLine* apples = chapter.find("Apples");
+    const PlacedLine* three = chapter.find("3");
+    const PlacedLine* kiwi = chapter.find("Kiwi");
+    const PlacedLine* twelve = chapter.find("12");
+    check(apples && three && kiwi && twelve && chapter.find("Name") && chapter.find("Qty"), "every cell is set");
+    if (apples && three && kiwi && twelve) {
+      check(apples->x == 0 && kiwi->x == 0, "first column at the left edge");
+      // "Apples" is 60 wide, then a 10 pixel gap
+      check(three->x == 70 && twelve->x == 70, "second column after the widest first cell and the gap");
+      check(three->y == apples->y && twelve->y == kiwi->y, "cells of a row share a line");
+      check(kiwi->y > apples->y, "rows run down the page");
+    }
+    check(chapter.rules == 4, "a rule above the table and below each of its three rows");
+    check(chapter.allText().find("Tab") == std::string::npos, "a table that fits isn't flattened");
+  }
+
+  // Paragraphs and line breaks inside a cell each start a new line of the cell; the other cell is unaffected
+  {
+    const Chapter chapter =
+        parse("<table><tr><td><p>One</p><p>Two</p><p>Three<br/>Four</p><div>Five</div></td><td>Side</td></tr></table>");
+    const char* expected[] = {"One", "Two", "Three", "Four", "Five"};
+    const PlacedLine* first = chapter.find("One");
+    check(first != nullptr, "first paragraph of the cell is its own line");
+    for (int i = 0; first && i < 5; i++) {
+      const PlacedLine* line = chapter.find(expected[i]);
+      check(line && line->x == 0 && line->y == first->y + i * GfxRenderer::LINE_HEIGHT,
+            std::string("cell line ") + expected[i] + " below the previous one");
+    }
+    // "Three" is the widest line of the first column
+    const PlacedLine* side = chapter.find("Side");
+    check(side && first && side->y == first->y && side->x == 60, "neighbouring cell beside the cell's first line");
+    check(chapter.find("One Two Three Four Five") == nullptr, "cell paragraphs don't run together");
+  }
+
+  // Over the column cap: flattened into one paragraph per cell, in order
+  {
+    const Chapter chapter = parse("<table>" + rows(2, 9) + "</table>");
+    check(chapter.find("Tab Row 1, Cell 1: r1c1") != nullptr, "over-wide table is flattened");
+    check(chapter.find("Tab Row 2, Cell 9: r2c9") != nullptr, "cells after the cap are flattened too");
+    check(chapter.rules == 0, "a flattened table has no rules");
+  }
+
+  // Over the word cap: the cells buffered so far are replayed, with the paragraphs of a cell kept apart
+  {
+    std::string words;
+    for (int i = 0; i < 600; i++) {
+      words += "w ";
+    }
+    const Chapter chapter =
+        parse("<table><tr><td><p>Top</p><p>Bottom</p></td><td>b</td></tr><tr><td>" + words + "</td></tr></table>");
+    check(chapter.find("Tab Row 1, Cell 1: Top") != nullptr, "buffered cell replayed as a flattened paragraph");
+    check(chapter.find("Bottom") != nullptr, "second paragraph of a replayed cell is its own line");
+    check(chapter.find("Tab Row 1, Cell 2: b") != nullptr, "next buffered cell replayed");
+    check(chapter.allText().find("Tab Row 2, Cell 1: w w") != std::string::npos, "open cell continues flattened");
+  }
+
+  // Over the cell cap
+  {
+    const Chapter chapter = parse("<table>" + rows(130, 2) + "</table>");
+    check(chapter.find("Tab Row 1, Cell 1: r1c1") != nullptr, "table over the cell cap is flattened");
+    check(chapter.find("Tab Row 130, Cell 2: r130c2") != nullptr, "every cell of it is kept");
+  }
+
+  // Ids and footnotes land on the page of the line their cell text is on, not the table's first page. 30 rows of one
+  // line each don't fit a 400 pixel page.
+  {
+    std::string table = "<table id=\"table\">";
+    for (int r = 1; r <= 30; r++) {
+      table += "<tr><td id=\"r" + std::to_string(r) + "\">row" + std::to_string(r) + "</td><td>";
+      if (r == 25) {
+        table += "<p>a</p><p id=\"late\">b</p><p>c <a href=\"notes.xhtml#n1\">1</a></p>";
+      } else {
+        table += "x";
+      }
+      table += "</td></tr>";
+    }
+    table += "</table><p id=\"after\">After</p>";
+    const Chapter chapter = parse(table, 400);
+    const PlacedLine* late = chapter.find("b");
+    const PlacedLine* note = chapter.find("c 1");
+    check(chapter.pages > 1 && late && late->page > 0, "the table runs onto a later page");
+    check(chapter.anchorPage("table") == 0 && chapter.anchorPage("r1") == 0, "ids of the first row on the first page");
+    if (late && note) {
+      check(chapter.anchorPage("r25") == chapter.find("row25")->page, "row id on its row's page");
+      check(chapter.anchorPage("late") == late->page, "id of a cell paragraph on that paragraph's page");
+      check(chapter.footnotePage("1") == note->page, "footnote on the page of its reference");
+    }
+    const PlacedLine* after = chapter.find("After");
+    check(after && chapter.anchorPage("after") == after->page, "id after the table on the paragraph it belongs to");
+  }
+
+  // The same in a flattened table
+  {
+    const Chapter chapter = parse("<table>" + rows(40, 9) + "<tr><td id=\"flat\">end</td></tr></table>", 400);
+    const PlacedLine* end = chapter.find("Tab Row 41, Cell 1: end");
+    check(end && end->page > 0 && chapter.anchorPage("flat") == end->page, "id in a flattened table on its page");
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " table layout check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All table layout checks passed\n";
+  return 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+// Host stand-in for lib/GfxRenderer/GfxRenderer.h with a fixed-pitch font: every codepoint is 10 pixels wide, a space
+// 5, with no kerning. Drawing does nothing; the tests look at where the layout put things.
+
+#include <EpdFontFamily.h>
+
+#include <cstdint>
+
+class GfxRenderer {
+ public:
+  static constexpr int GLYPH_WIDTH = 10;
+  static constexpr int SPACE_WIDTH = 5;
+  static constexpr int LINE_HEIGHT = 20;
+
+  int getScreenWidth() const { return 480; }
+  int getScreenHeight() const { return 800; }
+  void drawLine(int, int, int, int, bool = true) const {}
+  void fillRect(int, int, int, int, bool = true) const {}
+  void drawText(int, int, int, const char*, bool = true, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {}
+  int getTextWidth(const int fontId, const char* text,
+                   const EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    return getTextAdvanceX(fontId, text, style);
+  }
+  int getTextAdvanceX(int, const char* text, EpdFontFamily::Style) const {
+    int width = 0;
+    for (; *text; text++) {
+      if ((static_cast<uint8_t>(*text) & 0xC0) != 0x80) {
+        width += GLYPH_WIDTH;
+      }
+    }
+    return width;
+  }
+  int getSpaceWidth(int, EpdFontFamily::Style = EpdFontFamily::REGULAR) const { return SPACE_WIDTH; }
+  int getSpaceKernAdjust(int, uint32_t, uint32_t, EpdFontFamily::Style) const { return 0; }
+  int getKerning(int, uint32_t, uint32_t, EpdFontFamily::Style) const { return 0; }
+  int getFontAscenderSize(int) const { return 15; }
+  int getLineHeight(int) const { return LINE_HEIGHT; }
+};
@@ -0,0 +1,82 @@
+#pragma once
+// Host stand-in for lib/hal/HalStorage.h: files are byte vectors keyed by path
+
+#include <Print.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+inline unsigned long millis() { return 0; }
+inline void delay(unsigned long) {}
+
+class HalFile : public Print {
+ public:
+  size_t size() const { return data ? data->size() : 0; }
+  size_t fileSize() const { return size(); }
+  size_t position() const { return pos; }
+  int available() const { return data ? static_cast<int>(data->size() - pos) : 0; }
+  bool seekSet(const size_t offset) {
+    pos = std::min(offset, size());
+    return data != nullptr;
+  }
+  int read(void* buf, const size_t count) {
+    const size_t n = data ? std::min(count, data->size() - pos) : 0;
+    if (n > 0) {
+      memcpy(buf, data->data() + pos, n);
+    }
+    pos += n;
+    return static_cast<int>(n);
+  }
+  int read() {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+  }
+  size_t write(const void* buf, const size_t count) {
+    if (!data) {
+      return 0;
+    }
+    const auto* bytes = static_cast<const uint8_t*>(buf);
+    data->insert(data->end(), bytes, bytes + count);
+    return count;
+  }
+  size_t write(const uint8_t b) override { return write(&b, 1); }
+  void flush() {}
+  bool close() {
+    data = nullptr;
+    return true;
+  }
+  explicit operator bool() const { return data != nullptr; }
+
+  std::vector<uint8_t>* data = nullptr;
+  size_t pos = 0;
+};
+
+using FsFile = HalFile;
+
+class HalStorage {
+ public:
+  std::map<std::string, std::vector<uint8_t>> files;
+
+  bool exists(const char* path) { return files.count(path) > 0; }
+  bool remove(const char* path) { return files.erase(path) > 0; }
+  bool openFileForRead(const char*, const std::string& path, HalFile& file) {
+    const auto it = files.find(path);
+    if (it == files.end()) {
+      return false;
+    }
+    file.data = &it->second;
+    file.pos = 0;
+    return true;
+  }
+  bool openFileForWrite(const char*, const std::string& path, HalFile& file) {
+    file.data = &files[path];
+    file.data->clear();
+    file.pos = 0;
+    return true;
+  }
+};
+
+inline HalStorage Storage;
@@ -0,0 +1,11 @@
+#pragma once
+// Host stand-in for the Arduino Print interface
+
+#include <cstddef>
+#include <cstdint>
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t b) = 0;
+};
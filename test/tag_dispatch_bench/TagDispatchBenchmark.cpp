@@ -0,0 +1,315 @@
+// Host microbenchmark for element dispatch in ChapterHtmlSlimParser. The chapters go through expat with the parser's
+// configuration, and every start and end tag it reports is classified with the previous strcmp chains and attribute
+// copies, and with what startElement runs now: the HtmlTagTable perfect hash and ElementAttributes. Checks that both
+// agree on the tag flags and the attribute values and reports the elements per second of each.
+
+#include <expat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/parsers/ElementAttributes.h"
+#include "lib/Epub/Epub/parsers/HtmlTagTable.h"
+
+namespace {
+
+using namespace HtmlTagTable;
+
+// The candidate lists and helpers the parser used before HtmlTagTable
+const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
+constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
+const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
+constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
+const char* BOLD_TAGS[] = {"b", "strong"};
+constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
+const char* ITALIC_TAGS[] = {"i", "em"};
+constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
+const char* UNDERLINE_TAGS[] = {"u", "ins"};
+constexpr int NUM_UNDERLINE_TAGS = sizeof(UNDERLINE_TAGS) / sizeof(UNDERLINE_TAGS[0]);
+const char* IMAGE_TAGS[] = {"img"};
+constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
+const char* SKIP_TAGS[] = {"head"};
+constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+
+bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
+  for (int i = 0; i < possible_tag_count; i++) {
+    if (strcmp(tag_name, possible_tags[i]) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isHeaderOrBlock(const char* name) {
+  return matches(name, HEADER_TAGS, NUM_HEADER_TAGS) || matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS);
+}
+
+bool isTableStructuralTag(const char* name) {
+  return strcmp(name, "table") == 0 || strcmp(name, "tr") == 0 || strcmp(name, "td") == 0 || strcmp(name, "th") == 0;
+}
+
+// Same order of checks as the old startElement, reduced to the flags the branches stand for
+uint8_t legacyStartFlags(const char* name) {
+  if (isTableStructuralTag(name)) return TAG_TABLE;
+  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) return TAG_IMAGE;
+  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) return TAG_SKIP;
+  if (strcmp(name, "a") == 0) return 0;
+  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) return TAG_HEADER;
+  if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) return TAG_BLOCK;
+  if (matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS)) return TAG_UNDERLINE;
+  if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) return TAG_BOLD;
+  if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) return TAG_ITALIC;
+  if (strcmp(name, "span") == 0 || !isHeaderOrBlock(name)) return 0;
+  return 0;
+}
+
+// The checks the old endElement made on every closing tag; it never looked at skip tags
+constexpr uint8_t END_FLAGS = static_cast<uint8_t>(~TAG_SKIP);
+
+uint8_t legacyEndFlags(const char* name) {
+  uint8_t flags = 0;
+  if (isHeaderOrBlock(name)) flags |= matches(name, HEADER_TAGS, NUM_HEADER_TAGS) ? TAG_HEADER : TAG_BLOCK;
+  if (isTableStructuralTag(name)) flags |= TAG_TABLE;
+  if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) flags |= TAG_BOLD;
+  if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) flags |= TAG_ITALIC;
+  if (matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS)) flags |= TAG_UNDERLINE;
+  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) flags |= TAG_IMAGE;
+  return flags;
+}
+
+// Attribute values the old startElement read, copied the way it copied them
+struct LegacyAttributes {
+  const char* id = nullptr;
+  const char* name = nullptr;
+  std::string cls;
+  std::string style;
+  std::string src;
+  std::string alt;
+  const char* href = nullptr;
+  bool pageBreak = false;
+};
+
+const char* getAttribute(const XML_Char** atts, const char* attrName) {
+  if (!atts) return nullptr;
+  for (int i = 0; atts[i]; i += 2) {
+    if (strcmp(atts[i], attrName) == 0) return atts[i + 1];
+  }
+  return nullptr;
+}
+
+// The attribute scans of the old startElement: id and name lookups, class and style copies, src and alt copies for
+// images, the page-break scan and the href lookup for links
+LegacyAttributes legacyAttributes(const uint8_t flags, const bool isLink, const XML_Char** atts) {
+  LegacyAttributes attrs;
+  attrs.id = getAttribute(atts, "id");
+  attrs.name = getAttribute(atts, "name");
+  if (atts != nullptr) {
+    for (int i = 0; atts[i]; i += 2) {
+      if (strcmp(atts[i], "class") == 0) {
+        attrs.cls = atts[i + 1];
+      } else if (strcmp(atts[i], "style") == 0) {
+        attrs.style = atts[i + 1];
+      }
+    }
+  }
+  if ((flags & TAG_IMAGE) && atts != nullptr) {
+    for (int i = 0; atts[i]; i += 2) {
+      if (strcmp(atts[i], "src") == 0) {
+        attrs.src = atts[i + 1];
+      } else if (strcmp(atts[i], "alt") == 0) {
+        attrs.alt = atts[i + 1];
+      }
+    }
+  }
+  if (atts != nullptr) {
+    for (int i = 0; atts[i]; i += 2) {
+      if ((strcmp(atts[i], "role") == 0 && strcmp(atts[i + 1], "doc-pagebreak") == 0) ||
+          (strcmp(atts[i], "epub:type") == 0 && strcmp(atts[i + 1], "pagebreak") == 0)) {
+        attrs.pageBreak = true;
+      }
+    }
+  }
+  if (isLink) {
+    attrs.href = getAttribute(atts, "href");
+  }
+  return attrs;
+}
+
+std::string valueOf(const char* value) { return value ? value : ""; }
+
+struct TagEvent {
+  std::string name;
+  bool isEnd;
+  std::vector<std::string> attributes;  // name, value, name, value...
+  std::vector<const XML_Char*> atts;    // expat's layout: pointers into `attributes`, null-terminated
+};
+
+void XMLCALL collectStart(void* userData, const XML_Char* name, const XML_Char** atts) {
+  TagEvent event{name, false, {}, {}};
+  for (int i = 0; atts[i]; i++) {
+    event.attributes.emplace_back(atts[i]);
+  }
+  static_cast<std::vector<TagEvent>*>(userData)->push_back(std::move(event));
+}
+
+void XMLCALL collectEnd(void* userData, const XML_Char* name) {
+  static_cast<std::vector<TagEvent>*>(userData)->push_back({name, true, {}, {}});
+}
+
+// Entities go to the parser's default handler, which the dispatch doesn't depend on
+void XMLCALL ignoreDefault(void*, const XML_Char*, int) {}
+
+// Element events in document order, as expat reports them to startElement/endElement. The input may hold several
+// documents back to back (every chapter of a book); each is parsed on its own, like the parser does per chapter.
+std::vector<TagEvent> tagEvents(const std::string& markup, int& parseErrors) {
+  std::vector<TagEvent> events;
+  size_t pos = 0;
+  while ((pos = markup.find_first_not_of(" \t\r\n", pos)) != std::string::npos) {
+    const size_t htmlEnd = markup.find("</html>", pos);
+    const size_t end = htmlEnd == std::string::npos ? markup.size() : htmlEnd + 7;
+    const XML_Parser parser = XML_ParserCreate(nullptr);
+    XML_SetUserData(parser, &events);
+    XML_SetElementHandler(parser, collectStart, collectEnd);
+    XML_SetDefaultHandlerExpand(parser, ignoreDefault);
+    if (XML_Parse(parser, markup.data() + pos, static_cast<int>(end - pos), XML_TRUE) == XML_STATUS_ERROR) {
+      parseErrors++;
+    }
+    XML_ParserFree(parser);
+    pos = end;
+  }
+
+  for (auto& event : events) {
+    for (const auto& attribute : event.attributes) {
+      event.atts.push_back(attribute.c_str());
+    }
+    event.atts.push_back(nullptr);
+  }
+  return events;
+}
+
+// Inline-heavy markup in the style of annotated editions: every word pair wrapped, frequent links and breaks
+std::string tagDenseSample() {
+  std::string markup = "<html><head><title>t</title></head><body><section>";
+  for (int i = 0; i < 2000; i++) {
+    markup += "<p class=\"x\"><span class=\"a\">one</span> <em>two</em> <a href=\"#n" + std::to_string(i) +
+              "\"><sup>" + std::to_string(i) + "</sup></a><strong>three</strong><br/><small>four</small>" +
+              "<ins>five</ins><code>six</code></p><blockquote><div><i>seven</i></div></blockquote>";
+  }
+  return markup + "</section></body></html>";
+}
+
+double elementsPerSecond(const std::vector<TagEvent>& events, const bool useTable, const int iterations,
+                         unsigned& checksum) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int iteration = 0; iteration < iterations; iteration++) {
+    for (const auto& event : events) {
+      const char* name = event.name.c_str();
+      const XML_Char** atts = const_cast<const XML_Char**>(event.atts.data());
+      if (useTable) {
+        const TagInfo& tag = lookup(name);
+        checksum += tag.flags;
+        if (!event.isEnd) {
+          const ElementAttributes attrs(atts);
+          checksum += (attrs.cls != nullptr) + (attrs.style != nullptr) + attrs.pageBreak;
+        }
+      } else if (event.isEnd) {
+        checksum += legacyEndFlags(name);
+      } else {
+        const uint8_t flags = legacyStartFlags(name);
+        const auto attrs = legacyAttributes(flags, strcmp(name, "a") == 0, atts);
+        checksum += flags + !attrs.cls.empty() + !attrs.style.empty() + attrs.pageBreak;
+      }
+    }
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(events.size()) * iterations / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string corpus;
+  for (int i = 1; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    if (!file) {
+      std::cerr << "Cannot read " << argv[i] << "\n";
+      return 1;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    corpus += buffer.str();
+  }
+
+  int mismatches = 0;
+  for (const auto& info : TAGS) {
+    if (&lookup(info.name) != &info) {
+      std::cerr << "Table lookup misses " << info.name << "\n";
+      mismatches++;
+    }
+  }
+
+  struct Corpus {
+    const char* label;
+    std::vector<TagEvent> events;
+  };
+  int parseErrors = 0;
+  std::vector<Corpus> corpora;
+  if (!corpus.empty()) {
+    corpora.push_back({"Chapters", tagEvents(corpus, parseErrors)});
+  }
+  corpora.push_back({"Tag-dense sample", tagEvents(tagDenseSample(), parseErrors)});
+  if (parseErrors > 0) {
+    std::cout << parseErrors << " document(s) stopped at a parse error, their elements up to it are used\n";
+  }
+
+  for (const auto& [label, events] : corpora) {
+    for (const auto& event : events) {
+      const char* name = event.name.c_str();
+      const uint8_t expected = event.isEnd ? legacyEndFlags(name) : legacyStartFlags(name);
+      const TagInfo& tag = lookup(name);
+      const uint8_t actual = tag.flags & (event.isEnd ? END_FLAGS : 0xFF);
+      if (actual != expected) {
+        std::cerr << label << ": flags differ for <" << (event.isEnd ? "/" : "") << event.name << ">\n";
+        mismatches++;
+      }
+      if (event.isEnd) {
+        continue;
+      }
+      const XML_Char** atts = const_cast<const XML_Char**>(event.atts.data());
+      const ElementAttributes attrs(atts);
+      const bool isLink = tag.tag == HtmlTag::A;
+      const auto legacy = legacyAttributes(expected, isLink, atts);
+      if (valueOf(attrs.id) != valueOf(legacy.id) || valueOf(attrs.name) != valueOf(legacy.name) ||
+          valueOf(attrs.cls) != legacy.cls || valueOf(attrs.style) != legacy.style ||
+          attrs.pageBreak != legacy.pageBreak ||
+          ((expected & TAG_IMAGE) && (valueOf(attrs.src) != legacy.src || valueOf(attrs.alt) != legacy.alt)) ||
+          (isLink && valueOf(attrs.href) != valueOf(legacy.href))) {
+        std::cerr << label << ": attributes differ for <" << event.name << ">\n";
+        mismatches++;
+      }
+    }
+  }
+  if (mismatches > 0) {
+    return 1;
+  }
+
+  std::cout << "Perfect hash seed " << SEED << ", " << TAG_COUNT << " tags in " << SLOT_COUNT << " slots\n";
+  for (const auto& [label, events] : corpora) {
+    const int iterations = std::max(1, static_cast<int>(5000000 / std::max<size_t>(events.size(), 1)));
+    unsigned checksum = 0;
+    const double legacy = elementsPerSecond(events, false, iterations, checksum);
+    const double table = elementsPerSecond(events, true, iterations, checksum);
+    std::cout << label << ": " << events.size() << " tags, classification identical (checksum " << checksum << ")\n";
+    std::cout << "  strcmp chains, copied attributes: " << legacy / 1e6 << " M elements/s\n";
+    std::cout << "  perfect hash, borrowed attributes: " << table / 1e6 << " M elements/s (" << table / legacy
+              << "x)\n";
+  }
+  return 0;
+}
@@ -0,0 +1,248 @@
+// Host microbenchmark for the characterData text scanner. Tokenizes chapter text with a byte-at-a-time loop and with
+// TextRunScanner::appendWords, the word loop ChapterHtmlSlimParser::characterData runs, checks that both produce the
+// same tokens and reports the throughput of each.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/parsers/TextRunScanner.h"
+
+namespace {
+
+constexpr int MAX_WORD_SIZE = 200;
+
+struct Token {
+  std::string word;
+  bool continues;
+  bool joins;
+  bool operator==(const Token& other) const {
+    return word == other.word && continues == other.continues && joins == other.joins;
+  }
+};
+
+// The word-buffer members of ChapterHtmlSlimParser that appendWords works on
+struct Tokenizer {
+  char partWordBuffer[MAX_WORD_SIZE + 1] = {};
+  int partWordBufferIndex = 0;
+  bool nextWordContinues = false;
+  bool nextWordJoins = false;
+  bool recordTokens = true;  // timing runs only count, so token storage doesn't dominate the measurement
+  std::vector<Token> tokens;
+  size_t tokenCount = 0;
+
+  void flushPartWordBuffer() {
+    partWordBuffer[partWordBufferIndex] = '\0';
+    if (recordTokens) {
+      tokens.push_back({partWordBuffer, nextWordContinues, nextWordJoins});
+    }
+    tokenCount++;
+    partWordBufferIndex = 0;
+    nextWordContinues = false;
+    nextWordJoins = false;
+  }
+
+  void emitNoBreakSpace() {
+    if (partWordBufferIndex > 0) {
+      flushPartWordBuffer();
+    }
+    partWordBuffer[0] = ' ';
+    partWordBuffer[1] = '\0';
+    partWordBufferIndex = 1;
+    nextWordContinues = true;
+    flushPartWordBuffer();
+    nextWordContinues = true;
+  }
+};
+
+// Byte-at-a-time loop in the style characterData used before TextRunScanner, with the same cut of overlong words on
+// the last codepoint boundary of the current run of plain bytes
+void characterDataBytewise(Tokenizer& self, const char* s, const int len) {
+  int runStart = self.partWordBufferIndex;  // where the current run of plain bytes began in the word buffer
+  for (int i = 0; i < len; i++) {
+    const auto c = static_cast<uint8_t>(s[i]);
+    if (TextRunScanner::isWhitespace(s[i])) {
+      if (self.partWordBufferIndex > 0) {
+        self.flushPartWordBuffer();
+      }
+      self.nextWordContinues = false;
+      self.nextWordJoins = false;
+      runStart = 0;
+      continue;
+    }
+    if (c == 0xC2 && i + 1 < len && static_cast<uint8_t>(s[i + 1]) == 0xA0) {
+      self.emitNoBreakSpace();
+      runStart = 0;
+      i++;
+      continue;
+    }
+    if (c == 0xE2 && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0x80 && static_cast<uint8_t>(s[i + 2]) == 0xAF) {
+      self.emitNoBreakSpace();
+      runStart = 0;
+      i += 2;
+      continue;
+    }
+    if (c == 0xEF && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0xBB && static_cast<uint8_t>(s[i + 2]) == 0xBF) {
+      runStart = self.partWordBufferIndex;
+      i += 2;
+      continue;
+    }
+    if (TextRunScanner::isSpecialByte(c)) {
+      // A lead byte on its own is word text, but ends the run
+      if (self.partWordBufferIndex >= MAX_WORD_SIZE) {
+        self.flushPartWordBuffer();
+        self.nextWordJoins = true;
+      }
+      self.partWordBuffer[self.partWordBufferIndex++] = s[i];
+      runStart = self.partWordBufferIndex;
+      continue;
+    }
+    if (self.partWordBufferIndex >= MAX_WORD_SIZE) {
+      // Move the bytes of a codepoint cut in half on to the next word
+      int cut = MAX_WORD_SIZE;
+      while (cut > runStart && ((cut == MAX_WORD_SIZE ? c : static_cast<uint8_t>(self.partWordBuffer[cut])) & 0xC0) ==
+                                   0x80) {
+        cut--;
+      }
+      if (cut == 0) {
+        cut = MAX_WORD_SIZE;
+      }
+      const std::string carry(self.partWordBuffer + cut, MAX_WORD_SIZE - cut);
+      self.partWordBufferIndex = cut;
+      self.flushPartWordBuffer();
+      self.nextWordJoins = true;
+      memcpy(self.partWordBuffer, carry.data(), carry.size());
+      self.partWordBufferIndex = static_cast<int>(carry.size());
+      runStart = 0;
+    }
+    self.partWordBuffer[self.partWordBufferIndex++] = s[i];
+  }
+}
+
+void characterDataRuns(Tokenizer& self, const char* s, const int len) { TextRunScanner::appendWords(self, s, len); }
+
+// Splits markup roughly the way expat hands text to characterData: one call per text node, long nodes in chunks
+std::vector<std::string> textSegments(const std::string& markup, const size_t chunkSize) {
+  std::vector<std::string> segments;
+  size_t pos = 0;
+  while (pos < markup.size()) {
+    const size_t tagStart = markup.find('<', pos);
+    const size_t textEnd = tagStart == std::string::npos ? markup.size() : tagStart;
+    for (size_t start = pos; start < textEnd; start += chunkSize) {
+      segments.push_back(markup.substr(start, std::min(chunkSize, textEnd - start)));
+    }
+    if (tagStart == std::string::npos) {
+      break;
+    }
+    const size_t tagEnd = markup.find('>', tagStart);
+    pos = tagEnd == std::string::npos ? markup.size() : tagEnd + 1;
+  }
+  return segments;
+}
+
+using CharacterDataFn = void (*)(Tokenizer&, const char*, int);
+
+std::vector<Token> tokenize(const std::vector<std::string>& segments, const CharacterDataFn fn) {
+  Tokenizer tokenizer;
+  for (const auto& segment : segments) {
+    fn(tokenizer, segment.data(), static_cast<int>(segment.size()));
+  }
+  if (tokenizer.partWordBufferIndex > 0) {
+    tokenizer.flushPartWordBuffer();
+  }
+  return tokenizer.tokens;
+}
+
+double megabytesPerSecond(const std::vector<std::string>& segments, const size_t bytes, const CharacterDataFn fn,
+                          const int iterations) {
+  Tokenizer tokenizer;
+  tokenizer.recordTokens = false;
+  const auto start = std::chrono::steady_clock::now();
+  for (int iteration = 0; iteration < iterations; iteration++) {
+    for (const auto& segment : segments) {
+      fn(tokenizer, segment.data(), static_cast<int>(segment.size()));
+    }
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  if (tokenizer.tokenCount == 0) {
+    std::cerr << "No tokens produced\n";
+  }
+  return static_cast<double>(bytes) * iterations / elapsed.count() / (1024.0 * 1024.0);
+}
+
+// Random text dense in the special sequences, including truncated ones and ones split across calls, and in words
+// long enough to be cut
+std::string randomSpecialText(std::mt19937& rng, const size_t length) {
+  static const char* pieces[] = {"a",  "word", " ",    "\n",           "\t",   "\r",       "\xC2\xA0", "\xE2\x80\xAF",
+                                 "\xEF\xBB\xBF", "\xC2", "\xE2\x80", "\xEF\xBB", "\xC3\xA9", "\x01", "\x1F", "\xD0\x96",
+                                 "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x9C\xAC",
+                                 "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"};
+  std::string text;
+  while (text.size() < length) {
+    text += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+  }
+  return text;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string corpus;
+  for (int i = 1; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    if (!file) {
+      std::cerr << "Cannot read " << argv[i] << "\n";
+      return 1;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    corpus += buffer.str();
+  }
+  if (corpus.empty()) {
+    std::cerr << "Usage: " << argv[0] << " <chapter.xhtml|text>...\n";
+    return 1;
+  }
+
+  // Token equivalence: real text with several call splits, then adversarial random text
+  int mismatches = 0;
+  for (const size_t chunkSize : {size_t{7}, size_t{64}, size_t{1024}}) {
+    const auto segments = textSegments(corpus, chunkSize);
+    if (tokenize(segments, characterDataBytewise) != tokenize(segments, characterDataRuns)) {
+      std::cerr << "Token mismatch on corpus with chunk size " << chunkSize << "\n";
+      mismatches++;
+    }
+  }
+  std::mt19937 rng(1234);
+  for (int round = 0; round < 2000; round++) {
+    const auto segments = textSegments(randomSpecialText(rng, 1 + rng() % 600), 1 + rng() % 40);
+    if (tokenize(segments, characterDataBytewise) != tokenize(segments, characterDataRuns)) {
+      std::cerr << "Token mismatch on random text round " << round << "\n";
+      mismatches++;
+    }
+  }
+  if (mismatches > 0) {
+    return 1;
+  }
+
+  const auto segments = textSegments(corpus, 1024);
+  size_t textBytes = 0;
+  for (const auto& segment : segments) {
+    textBytes += segment.size();
+  }
+  const int iterations = std::max(1, static_cast<int>((200u << 20) / std::max<size_t>(textBytes, 1)));
+  const double bytewise = megabytesPerSecond(segments, textBytes, characterDataBytewise, iterations);
+  const double runs = megabytesPerSecond(segments, textBytes, characterDataRuns, iterations);
+
+  std::cout << "Text bytes: " << textBytes << " in " << segments.size() << " calls, " << iterations << " iterations\n";
+  std::cout << "Tokens identical: yes (" << tokenize(segments, characterDataRuns).size() << " tokens)\n";
+  std::cout << "Byte-at-a-time: " << bytewise << " MB/s\n";
+  std::cout << "Run scanner:    " << runs << " MB/s (" << runs / bytewise << "x)\n";
+  return 0;
+}